@@ -0,0 +1,336 @@
+/*******************************************************************************************
+*
+*   raylib [bench] - benchmarks runner
+*
+*   Usage: raylib_bench [--filter <text>] [--json <file>] [--samples <count>] [--list]
+*
+*       --filter <text>     Run only benchmarks whose "module/name" contains text
+*       --json <file>       Export results as JSON to file ("-" for standard output)
+*       --samples <count>   Number of measured samples per benchmark (median is reported)
+*       --list              List benchmarks without running them
+*
+*   Every benchmark is warmed up, calibrated to run at least BENCH_SAMPLE_TIME per sample,
+*   then measured BENCH_SAMPLES times, median and minimum time per operation are reported
+*
+*   Benchmarks licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include "bench.h"
+
+#include <stdio.h>          // Required for: printf(), fprintf(), fopen(), fclose()
+#include <stdlib.h>         // Required for: atoi(), qsort()
+#include <string.h>         // Required for: strcmp(), strstr()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define BENCH_SAMPLES               9       // Default measured samples per benchmark
+#define BENCH_MAX_SAMPLES          64       // Maximum measured samples per benchmark
+#define BENCH_SAMPLE_TIME        0.05       // Minimum time per sample (seconds), runs per sample calibrated to it
+#define BENCH_MAX_RESULTS         128       // Maximum number of benchmark results
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Benchmark result
+typedef struct BenchResult {
+    char module[32];                // Module name
+    char name[64];                  // Benchmark name
+    char unit[32];                  // Operation unit (i.e. sprites, pixels, bytes)
+    double nsPerOp;                 // Median time per operation (nanoseconds)
+    double nsPerOpMin;              // Minimum time per operation (nanoseconds)
+    long long runs;                 // Runs per sample
+    int samples;                    // Number of measured samples
+    const char *skipped;            // Reason benchmark was skipped, NULL if measured
+} BenchResult;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static BenchResult results[BENCH_MAX_RESULTS] = { 0 };
+static int resultCount = 0;
+
+static const char *filter = NULL;   // Benchmarks filter ("module/name" substring)
+static int sampleCount = BENCH_SAMPLES;
+static bool listOnly = false;
+static FILE *report = NULL;         // Results table output, standard error when JSON is exported to standard output
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static BenchResult *AddResult(const char *module, const char *name, const char *unit);
+static void SyncGPU(void);          // Wait for GPU to complete submitted drawing
+static int CompareDoubles(const void *a, const void *b);
+static const char *FormatThroughput(double nsPerOp, const char *unit);  // Format operations per second with unit prefix
+static bool ExportResults(const char *fileName);
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *jsonFileName = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--filter") == 0) && (i + 1 < argc)) filter = argv[++i];
+        else if ((strcmp(argv[i], "--json") == 0) && (i + 1 < argc)) jsonFileName = argv[++i];
+        else if ((strcmp(argv[i], "--samples") == 0) && (i + 1 < argc)) sampleCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--list") == 0) listOnly = true;
+        else
+        {
+            printf("Usage: %s [--filter <text>] [--json <file>] [--samples <count>] [--list]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (sampleCount < 1) sampleCount = 1;
+    if (sampleCount > BENCH_MAX_SAMPLES) sampleCount = BENCH_MAX_SAMPLES;
+
+    report = ((jsonFileName != NULL) && (strcmp(jsonFileName, "-") == 0))? stderr : stdout;
+
+    // Initialization
+    //--------------------------------------------------------------------------------------
+    rl_SetTraceLogLevel(LOG_WARNING);
+    rl_SetConfigFlags(FLAG_WINDOW_HIDDEN);      // No VSync, frames are not presented
+    rl_InitWindow(BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT, "raylib [bench] - benchmarks");
+    rl_SetRandomSeed(BENCH_RANDOM_SEED);
+
+    if (!listOnly)
+    {
+        fprintf(report, "raylib %s benchmarks (%i samples)\n\n", rl_RAYLIB_VERSION, sampleCount);
+        fprintf(report, "%-10s %-28s %14s %14s %22s\n", "module", "benchmark", "median ns/op", "min ns/op", "throughput");
+    }
+    //--------------------------------------------------------------------------------------
+
+    // Benchmarks
+    //--------------------------------------------------------------------------------------
+    BenchRlgl();
+    BenchShapes();
+    BenchText();
+    BenchTextures();
+    BenchModels();
+    BenchAudio();
+    BenchUtils();
+    //--------------------------------------------------------------------------------------
+
+    // De-Initialization
+    //--------------------------------------------------------------------------------------
+    rl_CloseWindow();
+
+    if ((jsonFileName != NULL) && !listOnly)
+    {
+        if (!ExportResults(jsonFileName))
+        {
+            fprintf(stderr, "Failed to export results: %s\n", jsonFileName);
+            return 1;
+        }
+    }
+    //--------------------------------------------------------------------------------------
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Check if benchmark is selected by filter
+// NOTE: In list mode benchmarks are listed here and never run
+bool BenchEnabled(const char *module, const char *name)
+{
+    char fullName[128] = { 0 };
+    snprintf(fullName, sizeof(fullName), "%s/%s", module, name);
+
+    bool enabled = ((filter == NULL) || (strstr(fullName, filter) != NULL));
+
+    if (enabled && listOnly)
+    {
+        printf("%s\n", fullName);
+        enabled = false;
+    }
+
+    return enabled;
+}
+
+// Measure benchmark run function
+// NOTE: GPU benchmarks wait for drawing completion at sample end, time includes GPU work
+void BenchRun(const char *module, const char *name, const char *unit, double opsPerRun, bool gpu, BenchFunc func, void *data)
+{
+    if (!BenchEnabled(module, name)) return;
+
+    // Warm up and calibrate runs per sample
+    long long runs = 1;
+    double elapsed = 0.0;
+
+    func(data);
+    if (gpu) SyncGPU();
+
+    while (true)
+    {
+        double start = rl_GetTime();
+        for (long long i = 0; i < runs; i++) func(data);
+        if (gpu) SyncGPU();
+        elapsed = rl_GetTime() - start;
+
+        if ((elapsed >= BENCH_SAMPLE_TIME) || (runs >= (1LL << 40))) break;
+
+        // Estimate runs required, doubled at least
+        long long estimate = (elapsed > 0.0)? (long long)(runs*BENCH_SAMPLE_TIME*1.2/elapsed) : runs*16;
+        runs = (estimate > runs*2)? estimate : runs*2;
+    }
+
+    // Measure samples
+    double times[BENCH_MAX_SAMPLES] = { 0 };
+
+    for (int s = 0; s < sampleCount; s++)
+    {
+        double start = rl_GetTime();
+        for (long long i = 0; i < runs; i++) func(data);
+        if (gpu) SyncGPU();
+        times[s] = (rl_GetTime() - start)*1e9/((double)runs*opsPerRun);
+    }
+
+    qsort(times, sampleCount, sizeof(double), CompareDoubles);
+
+    BenchResult *result = AddResult(module, name, unit);
+    if (result == NULL) return;
+
+    result->nsPerOp = times[sampleCount/2];
+    result->nsPerOpMin = times[0];
+    result->runs = runs;
+    result->samples = sampleCount;
+
+    fprintf(report, "%-10s %-28s %14.3f %14.3f %22s\n", module, name, result->nsPerOp, result->nsPerOpMin, FormatThroughput(result->nsPerOp, unit));
+}
+
+// Report benchmark measured by caller
+void BenchReport(const char *module, const char *name, const char *unit, double nsPerOp, int samples)
+{
+    BenchResult *result = AddResult(module, name, unit);
+    if (result == NULL) return;
+
+    result->nsPerOp = nsPerOp;
+    result->nsPerOpMin = nsPerOp;
+    result->runs = 1;
+    result->samples = samples;
+
+    fprintf(report, "%-10s %-28s %14.3f %14s %22s\n", module, name, nsPerOp, "-", FormatThroughput(nsPerOp, unit));
+}
+
+// Report benchmark skipped
+void BenchSkip(const char *module, const char *name, const char *reason)
+{
+    BenchResult *result = AddResult(module, name, "");
+    if (result == NULL) return;
+
+    result->skipped = reason;
+
+    fprintf(report, "%-10s %-28s skipped: %s\n", module, name, reason);
+}
+
+// Get examples resource file path
+const char *BenchResourcePath(const char *fileName)
+{
+    return rl_TextFormat("%s%s", BENCH_RESOURCES_PATH, fileName);
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Add benchmark result
+static BenchResult *AddResult(const char *module, const char *name, const char *unit)
+{
+    if (resultCount >= BENCH_MAX_RESULTS) return NULL;
+
+    BenchResult *result = &results[resultCount++];
+    snprintf(result->module, sizeof(result->module), "%s", module);
+    snprintf(result->name, sizeof(result->name), "%s", name);
+    snprintf(result->unit, sizeof(result->unit), "%s", unit);
+
+    return result;
+}
+
+// Wait for GPU to complete submitted drawing
+// NOTE: Reading back a framebuffer pixel waits for all previous drawing
+static void SyncGPU(void)
+{
+    rlDrawRenderBatchActive();
+
+    unsigned char *pixels = rlReadScreenPixels(1, 1);
+    rl_MemFree(pixels);
+}
+
+// Compare doubles, used to sort samples
+static int CompareDoubles(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+
+    return (da > db) - (da < db);
+}
+
+// Format operations per second with unit prefix
+static const char *FormatThroughput(double nsPerOp, const char *unit)
+{
+    double opsPerSec = 1e9/nsPerOp;
+
+    if (opsPerSec >= 1e9) return rl_TextFormat("%.3f G%s/s", opsPerSec/1e9, unit);
+    else if (opsPerSec >= 1e6) return rl_TextFormat("%.3f M%s/s", opsPerSec/1e6, unit);
+    else if (opsPerSec >= 1e3) return rl_TextFormat("%.3f K%s/s", opsPerSec/1e3, unit);
+    else return rl_TextFormat("%.3f %s/s", opsPerSec, unit);
+}
+
+// Export results as JSON
+static bool ExportResults(const char *fileName)
+{
+    FILE *file = (strcmp(fileName, "-") == 0)? stdout : fopen(fileName, "wt");
+    if (file == NULL) return false;
+
+    const char *graphics = "unknown";
+    switch (rlGetVersion())
+    {
+        case RL_OPENGL_11_SOFTWARE: graphics = "OpenGL 1.1 (software)"; break;
+        case RL_OPENGL_11: graphics = "OpenGL 1.1"; break;
+        case RL_OPENGL_21: graphics = "OpenGL 2.1"; break;
+        case RL_OPENGL_33: graphics = "OpenGL 3.3"; break;
+        case RL_OPENGL_43: graphics = "OpenGL 4.3"; break;
+        case RL_OPENGL_ES_20: graphics = "OpenGL ES 2.0"; break;
+        case RL_OPENGL_ES_30: graphics = "OpenGL ES 3.0"; break;
+        default: break;
+    }
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"raylib\": \"%s\",\n", rl_RAYLIB_VERSION);
+    fprintf(file, "  \"graphics\": \"%s\",\n", graphics);
+    fprintf(file, "  \"seed\": %i,\n", BENCH_RANDOM_SEED);
+    fprintf(file, "  \"results\": [\n");
+
+    for (int i = 0; i < resultCount; i++)
+    {
+        BenchResult *result = &results[i];
+
+        fprintf(file, "    { \"module\": \"%s\", \"name\": \"%s\", ", result->module, result->name);
+
+        if (result->skipped != NULL) fprintf(file, "\"skipped\": \"%s\" }", result->skipped);
+        else
+        {
+            fprintf(file, "\"unit\": \"%s\", \"ns_per_op\": %.4f, \"ns_per_op_min\": %.4f, \"ops_per_sec\": %.1f, \"runs\": %lld, \"samples\": %i }",
+                result->unit, result->nsPerOp, result->nsPerOpMin, 1e9/result->nsPerOp, result->runs, result->samples);
+        }
+
+        fprintf(file, "%s\n", (i < resultCount - 1)? "," : "");
+    }
+
+    fprintf(file, "  ]\n}\n");
+
+    if (file != stdout) fclose(file);
+
+    return true;
+}
@@ -0,0 +1,57 @@
+/*******************************************************************************************
+*
+*   raylib [bench] - benchmarks runner
+*
+*   Benchmarks are reproducible microbenchmarks of raylib modules, run on a hidden window
+*   with fixed sizes and random seed, results are printed and exported as JSON
+*
+*   Benchmarks licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "raylib.h"
+
+#include <stddef.h>         // Required for: NULL
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define BENCH_SCREEN_WIDTH          640     // Benchmark window width
+#define BENCH_SCREEN_HEIGHT         480     // Benchmark window height
+#define BENCH_RANDOM_SEED      20260101     // Random seed, same generated data on every run
+
+#ifndef BENCH_RESOURCES_PATH
+    #define BENCH_RESOURCES_PATH  "../examples/"    // Examples resources, used by loading benchmarks
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Benchmark run function, runs one iteration of measured code
+typedef void (*BenchFunc)(void *data);
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+bool BenchEnabled(const char *module, const char *name);    // Check if benchmark is selected by filter (skip setup if not)
+void BenchRun(const char *module, const char *name, const char *unit, double opsPerRun, bool gpu, BenchFunc func, void *data); // Measure benchmark run function, ops per run in unit
+void BenchReport(const char *module, const char *name, const char *unit, double nsPerOp, int samples); // Report benchmark measured by caller
+void BenchSkip(const char *module, const char *name, const char *reason); // Report benchmark skipped (required data or device not available)
+const char *BenchResourcePath(const char *fileName);        // Get examples resource file path
+
+// Modules benchmarks
+void BenchRlgl(void);           // rlgl: render batch (sprites, textures switch, flushes)
+void BenchShapes(void);         // rshapes: primitives drawing
+void BenchText(void);           // rtext: text drawing and measuring
+void BenchTextures(void);       // rtextures: image processing, textures update and drawing
+void BenchModels(void);         // rmodels: models loading, skinning and meshes drawing
+void BenchAudio(void);          // raudio: wave processing and voices mixing
+void BenchUtils(void);          // utils: data compression and hashing
+
+#endif // BENCH_H
@@ -0,0 +1,128 @@
+/*******************************************************************************************
+*
+*   raylib [bench] - raudio wave processing and mixing benchmarks
+*
+*   NOTE: Mixing runs on audio device thread, mixing cost is sampled from rl_GetAudioVoiceStats()
+*   while voices play, benchmark is skipped if no audio device is available
+*
+*   Benchmarks licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "bench.h"
+
+#include <math.h>           // Required for: sinf()
+#include <stdlib.h>         // Required for: qsort()
+
+#define WAVE_SAMPLE_RATE    48000       // Generated wave sample rate
+#define WAVE_SECONDS        4           // Generated wave duration
+#define MIX_VOICES          32          // Voices played at once for mixing benchmark
+#define MIX_SAMPLES         20          // Mixing stats samples taken
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static rl_Wave wave = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+static void FormatWave(void *data)
+{
+    rl_Wave copy = rl_WaveCopy(wave);
+    rl_WaveFormat(&copy, 44100, 16, 2);
+    rl_UnloadWave(copy);
+}
+
+static void LoadSamples(void *data)
+{
+    float *samples = rl_LoadWaveSamples(wave);
+    rl_UnloadWaveSamples(samples);
+}
+
+static int CompareFloats(const void *a, const void *b)
+{
+    float fa = *(const float *)a;
+    float fb = *(const float *)b;
+
+    return (fa > fb) - (fa < fb);
+}
+
+// Measure mixing cost of voices played at once
+static void BenchMixing(void)
+{
+    if (!BenchEnabled("audio", "mix_voices")) return;
+
+    rl_InitAudioDevice();
+
+    if (!rl_IsAudioDeviceReady())
+    {
+        BenchSkip("audio", "mix_voices", "audio device not available");
+        return;
+    }
+
+    rl_Sound sound = rl_LoadSoundFromWave(wave);
+    rl_Sound aliases[MIX_VOICES] = { 0 };
+
+    for (int i = 0; i < MIX_VOICES; i++)
+    {
+        aliases[i] = rl_LoadSoundAlias(sound);
+        rl_SetSoundPitch(aliases[i], 0.5f + 0.05f*i);     // Pitched voices are resampled
+        rl_PlaySound(aliases[i]);
+    }
+
+    // Sample mixing load, relative to mixed audio duration
+    float loads[MIX_SAMPLES] = { 0 };
+    int loadCount = 0;
+
+    rl_WaitTime(0.1);
+
+    for (int i = 0; i < MIX_SAMPLES; i++)
+    {
+        rl_WaitTime(0.05);
+
+        rl_AudioVoiceStats stats = rl_GetAudioVoiceStats();
+        if (stats.voicesReal > 0) loads[loadCount++] = stats.mixLoad/stats.voicesReal;
+    }
+
+    if (loadCount > 0)
+    {
+        qsort(loads, loadCount, sizeof(float), CompareFloats);
+
+        // Time per second of voice audio mixed
+        BenchReport("audio", "mix_voices", "voice_seconds", 1e9*loads[loadCount/2], loadCount);
+    }
+    else BenchSkip("audio", "mix_voices", "no voices mixed");
+
+    for (int i = 0; i < MIX_VOICES; i++) rl_UnloadSoundAlias(aliases[i]);
+    rl_UnloadSound(sound);
+
+    rl_CloseAudioDevice();
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+void BenchAudio(void)
+{
+    // Generate mono 32bit float wave: sine tone
+    wave.frameCount = WAVE_SAMPLE_RATE*WAVE_SECONDS;
+    wave.sampleRate = WAVE_SAMPLE_RATE;
+    wave.sampleSize = 32;
+    wave.channels = 1;
+    wave.data = rl_MemAlloc(wave.frameCount*sizeof(float));
+
+    for (unsigned int i = 0; i < wave.frameCount; i++) ((float *)wave.data)[i] = 0.5f*sinf(2.0f*rl_PI*440.0f*i/WAVE_SAMPLE_RATE);
+
+    BenchRun("audio", "wave_format", "frames", wave.frameCount, false, FormatWave, NULL);
+    BenchRun("audio", "wave_load_samples", "frames", wave.frameCount, false, LoadSamples, NULL);
+
+    BenchMixing();
+
+    rl_UnloadWave(wave);
+}
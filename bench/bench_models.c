@@ -0,0 +1,140 @@
+/*******************************************************************************************
+*
+*   raylib [bench] - rmodels loading, skinning and drawing benchmarks
+*
+*   NOTE: OBJ loading benchmark exports a generated mesh to the working directory,
+*   glTF benchmarks require examples resources (BENCH_RESOURCES_PATH), skipped if not found
+*
+*   Benchmarks licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "raymath.h"
+
+#include "bench.h"
+
+#include <stdio.h>          // Required for: remove()
+
+#define OBJ_FILE_NAME       "raylib_bench_sphere.obj"
+#define GLTF_FILE_NAME      "models/resources/models/gltf/robot.glb"
+
+#define MESH_DRAW_COUNT     100         // Meshes drawn per run
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct AnimationData {
+    rl_Model model;
+    rl_ModelAnimation *anims;
+    int frame;
+} AnimationData;
+
+typedef struct MeshDrawData {
+    rl_Mesh mesh;
+    rl_Material material;
+    rl_Camera3D camera;
+} MeshDrawData;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+static void LoadModelFile(void *data)
+{
+    rl_Model model = rl_LoadModel((const char *)data);
+    rl_UnloadModel(model);
+}
+
+static void UpdateAnimation(void *data)
+{
+    AnimationData *animation = (AnimationData *)data;
+
+    rl_UpdateModelAnimation(animation->model, animation->anims[0], animation->frame);
+    animation->frame = (animation->frame + 1)%animation->anims[0].frameCount;
+}
+
+static void DrawMeshes(void *data)
+{
+    MeshDrawData *draw = (MeshDrawData *)data;
+
+    rl_BeginMode3D(draw->camera);
+    for (int i = 0; i < MESH_DRAW_COUNT; i++)
+    {
+        rl_DrawMesh(draw->mesh, draw->material, MatrixTranslate((float)(i%10) - 4.5f, (float)(i/10) - 4.5f, 0.0f));
+    }
+    rl_EndMode3D();
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+void BenchModels(void)
+{
+    rl_Mesh sphere = rl_GenMeshSphere(0.4f, 32, 32);
+
+    // Models loading
+    if (BenchEnabled("models", "load_obj"))
+    {
+        if (rl_ExportMesh(sphere, OBJ_FILE_NAME))
+        {
+            BenchRun("models", "load_obj", "vertices", sphere.vertexCount, false, LoadModelFile, (void *)OBJ_FILE_NAME);
+            remove(OBJ_FILE_NAME);
+        }
+        else BenchSkip("models", "load_obj", "mesh export failed");
+    }
+
+    const char *gltfPath = BenchResourcePath(GLTF_FILE_NAME);
+    static char gltfFileName[512] = { 0 };
+    rl_TextCopy(gltfFileName, gltfPath);
+
+    if (rl_FileExists(gltfFileName))
+    {
+        BenchRun("models", "load_gltf", "models", 1, false, LoadModelFile, gltfFileName);
+
+        // CPU skinning
+        if (BenchEnabled("models", "skinning_cpu"))
+        {
+            AnimationData animation = { 0 };
+            int animCount = 0;
+
+            animation.model = rl_LoadModel(gltfFileName);
+            animation.anims = rl_LoadModelAnimations(gltfFileName, &animCount);
+
+            if ((animCount > 0) && (animation.anims[0].frameCount > 0))
+            {
+                int vertexCount = 0;
+                for (int i = 0; i < animation.model.meshCount; i++) vertexCount += animation.model.meshes[i].vertexCount;
+
+                BenchRun("models", "skinning_cpu", "vertices", vertexCount, false, UpdateAnimation, &animation);
+            }
+            else BenchSkip("models", "skinning_cpu", "no animations");
+
+            rl_UnloadModelAnimations(animation.anims, animCount);
+            rl_UnloadModel(animation.model);
+        }
+    }
+    else
+    {
+        if (BenchEnabled("models", "load_gltf")) BenchSkip("models", "load_gltf", "resource not found");
+        if (BenchEnabled("models", "skinning_cpu")) BenchSkip("models", "skinning_cpu", "resource not found");
+    }
+
+    // Meshes drawing
+    if (BenchEnabled("models", "draw_mesh"))
+    {
+        MeshDrawData draw = { 0 };
+
+        draw.mesh = sphere;
+        draw.material = rl_LoadMaterialDefault();
+        draw.camera = (rl_Camera3D){ { 0.0f, 0.0f, 12.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, 45.0f, CAMERA_PERSPECTIVE };
+
+        BenchRun("models", "draw_mesh", "meshes", MESH_DRAW_COUNT, true, DrawMeshes, &draw);
+
+        rl_UnloadMaterial(draw.material);
+    }
+
+    rl_UnloadMesh(sphere);
+}
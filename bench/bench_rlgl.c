@@ -0,0 +1,122 @@
+/*******************************************************************************************
+*
+*   raylib [bench] - rlgl render batch benchmarks
+*
+*   Benchmarks licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include "bench.h"
+
+#define SPRITES_COUNT       10000       // Sprites drawn per run
+#define TEXTURES_COUNT          8       // Textures switched when drawing sprites
+#define TRIANGLES_COUNT     20000       // Triangles defined per run
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct SpritesData {
+    rl_Texture2D textures[TEXTURES_COUNT];
+    rl_Vector2 positions[SPRITES_COUNT];
+    int textureCount;               // Textures switched per sprite (1: single texture)
+    int flushCount;                 // Sprites drawn between forced batch flushes (0: no forced flush)
+} SpritesData;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static float triangles[TRIANGLES_COUNT*3*2] = { 0 };    // Triangles vertex positions (XY)
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Draw sprites through render batch
+static void DrawSprites(void *data)
+{
+    SpritesData *sprites = (SpritesData *)data;
+
+    for (int i = 0; i < SPRITES_COUNT; i++)
+    {
+        rl_DrawTextureV(sprites->textures[i%sprites->textureCount], sprites->positions[i], rl_WHITE);
+
+        if ((sprites->flushCount > 0) && (((i + 1)%sprites->flushCount) == 0)) rlDrawRenderBatchActive();
+    }
+
+    rlDrawRenderBatchActive();
+}
+
+// Define triangles vertex by vertex
+static void DrawTrianglesVertex(void *data)
+{
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(230, 41, 55, 255);
+        for (int i = 0; i < TRIANGLES_COUNT*3; i++) rlVertex2f(triangles[2*i], triangles[2*i + 1]);
+    rlEnd();
+
+    rlDrawRenderBatchActive();
+}
+
+// Define triangles with bulk vertex definition
+static void DrawTrianglesVertices(void *data)
+{
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(230, 41, 55, 255);
+        rlVertices2f(triangles, TRIANGLES_COUNT*3);
+    rlEnd();
+
+    rlDrawRenderBatchActive();
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+void BenchRlgl(void)
+{
+    static SpritesData sprites = { 0 };
+
+    for (int i = 0; i < TEXTURES_COUNT; i++)
+    {
+        rl_Image image = rl_GenImageChecked(32, 32, 8, 8, rl_ColorFromHSV(i*45.0f, 0.8f, 0.9f), rl_WHITE);
+        sprites.textures[i] = rl_LoadTextureFromImage(image);
+        rl_UnloadImage(image);
+    }
+
+    for (int i = 0; i < SPRITES_COUNT; i++)
+    {
+        sprites.positions[i] = (rl_Vector2){ (float)rl_GetRandomValue(0, BENCH_SCREEN_WIDTH - 32), (float)rl_GetRandomValue(0, BENCH_SCREEN_HEIGHT - 32) };
+    }
+
+    sprites.textureCount = 1;
+    sprites.flushCount = 0;
+    BenchRun("rlgl", "sprites_batched", "sprites", SPRITES_COUNT, true, DrawSprites, &sprites);
+
+    sprites.textureCount = TEXTURES_COUNT;
+    BenchRun("rlgl", "sprites_texture_switch", "sprites", SPRITES_COUNT, true, DrawSprites, &sprites);
+
+    sprites.textureCount = 1;
+    sprites.flushCount = 16;
+    BenchRun("rlgl", "sprites_flush_16", "sprites", SPRITES_COUNT, true, DrawSprites, &sprites);
+
+    for (int i = 0; i < TEXTURES_COUNT; i++) rl_UnloadTexture(sprites.textures[i]);
+
+    // Small triangles, vertex definition cost dominates over rasterization
+    for (int i = 0; i < TRIANGLES_COUNT; i++)
+    {
+        float x = (float)rl_GetRandomValue(0, BENCH_SCREEN_WIDTH - 4);
+        float y = (float)rl_GetRandomValue(0, BENCH_SCREEN_HEIGHT - 4);
+        float *v = triangles + 6*i;
+
+        v[0] = x; v[1] = y;
+        v[2] = x; v[3] = y + 4;
+        v[4] = x + 4; v[5] = y + 4;
+    }
+
+    BenchRun("rlgl", "triangles_vertex", "triangles", TRIANGLES_COUNT, true, DrawTrianglesVertex, NULL);
+    BenchRun("rlgl", "triangles_vertices", "triangles", TRIANGLES_COUNT, true, DrawTrianglesVertices, NULL);
+}
@@ -0,0 +1,85 @@
+/*******************************************************************************************
+*
+*   raylib [bench] - rshapes primitives benchmarks
+*
+*   Benchmarks licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include "bench.h"
+
+#define SHAPES_COUNT        1000        // Shapes drawn per run
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static rl_Vector2 points[SHAPES_COUNT] = { 0 };
+static rl_Color colors[SHAPES_COUNT] = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+static void DrawRectangles(void *data)
+{
+    for (int i = 0; i < SHAPES_COUNT; i++) rl_DrawRectangleV(points[i], (rl_Vector2){ 24, 16 }, colors[i]);
+    rlDrawRenderBatchActive();
+}
+
+static void DrawRectanglesRounded(void *data)
+{
+    for (int i = 0; i < SHAPES_COUNT; i++) rl_DrawRectangleRounded((rl_Rectangle){ points[i].x, points[i].y, 48, 32 }, 0.4f, 8, colors[i]);
+    rlDrawRenderBatchActive();
+}
+
+static void DrawCircles(void *data)
+{
+    for (int i = 0; i < SHAPES_COUNT; i++) rl_DrawCircleV(points[i], 12.0f, colors[i]);
+    rlDrawRenderBatchActive();
+}
+
+static void DrawLines(void *data)
+{
+    for (int i = 0; i < SHAPES_COUNT; i++) rl_DrawLineEx(points[i], points[(i + 1)%SHAPES_COUNT], 2.0f, colors[i]);
+    rlDrawRenderBatchActive();
+}
+
+static void DrawTriangles(void *data)
+{
+    for (int i = 0; i < SHAPES_COUNT; i++)
+    {
+        rl_Vector2 p = points[i];
+        rl_DrawTriangle(p, (rl_Vector2){ p.x - 12, p.y + 20 }, (rl_Vector2){ p.x + 12, p.y + 20 }, colors[i]);
+    }
+    rlDrawRenderBatchActive();
+}
+
+static void DrawPolys(void *data)
+{
+    for (int i = 0; i < SHAPES_COUNT; i++) rl_DrawPoly(points[i], 6, 12.0f, (float)i, colors[i]);
+    rlDrawRenderBatchActive();
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+void BenchShapes(void)
+{
+    for (int i = 0; i < SHAPES_COUNT; i++)
+    {
+        points[i] = (rl_Vector2){ (float)rl_GetRandomValue(0, BENCH_SCREEN_WIDTH), (float)rl_GetRandomValue(0, BENCH_SCREEN_HEIGHT) };
+        colors[i] = rl_ColorFromHSV((float)rl_GetRandomValue(0, 360), 0.7f, 0.9f);
+    }
+
+    BenchRun("shapes", "rectangle", "shapes", SHAPES_COUNT, true, DrawRectangles, NULL);
+    BenchRun("shapes", "rectangle_rounded", "shapes", SHAPES_COUNT, true, DrawRectanglesRounded, NULL);
+    BenchRun("shapes", "circle", "shapes", SHAPES_COUNT, true, DrawCircles, NULL);
+    BenchRun("shapes", "line_thick", "shapes", SHAPES_COUNT, true, DrawLines, NULL);
+    BenchRun("shapes", "triangle", "shapes", SHAPES_COUNT, true, DrawTriangles, NULL);
+    BenchRun("shapes", "poly_hexagon", "shapes", SHAPES_COUNT, true, DrawPolys, NULL);
+}
@@ -0,0 +1,52 @@
+/*******************************************************************************************
+*
+*   raylib [bench] - rtext drawing and measuring benchmarks
+*
+*   Benchmarks licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include "bench.h"
+
+#include <string.h>         // Required for: strlen()
+
+#define TEXT_LINES          40          // Text lines drawn or measured per run
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const char *text = "The quick brown fox jumps over the lazy dog 0123456789";
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+static void DrawTextLines(void *data)
+{
+    for (int i = 0; i < TEXT_LINES; i++) rl_DrawText(text, 10, 10 + (i%20)*22, 20, rl_DARKGRAY);
+    rlDrawRenderBatchActive();
+}
+
+static void MeasureTextLines(void *data)
+{
+    rl_Font font = rl_GetFontDefault();
+    volatile float width = 0.0f;
+
+    for (int i = 0; i < TEXT_LINES; i++) width += rl_MeasureTextEx(font, text, 20.0f + i, 2.0f).x;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+void BenchText(void)
+{
+    const double glyphs = (double)strlen(text)*TEXT_LINES;
+
+    BenchRun("text", "draw_text", "glyphs", glyphs, true, DrawTextLines, NULL);
+    BenchRun("text", "measure_text", "glyphs", glyphs, false, MeasureTextLines, NULL);
+}
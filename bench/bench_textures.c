@@ -0,0 +1,115 @@
+/*******************************************************************************************
+*
+*   raylib [bench] - rtextures image processing and textures benchmarks
+*
+*   NOTE: Image processing benchmarks work on a copy of source image, copy time is included,
+*   compare with image_copy benchmark for processing time alone
+*
+*   Benchmarks licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+#include "rlgl.h"
+
+#include "bench.h"
+
+#define IMAGE_SIZE          512         // Source image size (square)
+#define DRAW_COUNT          1000        // Textures drawn per run
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static rl_Image source = { 0 };
+static rl_Texture2D texture = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+static void CopyImage(void *data)
+{
+    rl_Image image = rl_ImageCopy(source);
+    rl_UnloadImage(image);
+}
+
+static void FormatImage(void *data)
+{
+    rl_Image image = rl_ImageCopy(source);
+    rl_ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R5G6B5);
+    rl_UnloadImage(image);
+}
+
+static void ResizeImage(void *data)
+{
+    rl_Image image = rl_ImageCopy(source);
+    rl_ImageResize(&image, IMAGE_SIZE/2, IMAGE_SIZE/2);
+    rl_UnloadImage(image);
+}
+
+static void BlurImage(void *data)
+{
+    rl_Image image = rl_ImageCopy(source);
+    rl_ImageBlurGaussian(&image, 4);
+    rl_UnloadImage(image);
+}
+
+static void DrawImage(void *data)
+{
+    rl_Image image = rl_ImageCopy(*(rl_Image *)data);
+    rl_ImageDraw(&image, source, (rl_Rectangle){ 0, 0, IMAGE_SIZE, IMAGE_SIZE }, (rl_Rectangle){ 0, 0, IMAGE_SIZE, IMAGE_SIZE }, (rl_Color){ 255, 255, 255, 200 });
+    rl_UnloadImage(image);
+}
+
+static void UpdateTexture(void *data)
+{
+    rl_UpdateTexture(texture, source.data);
+}
+
+static void DrawTextures(void *data)
+{
+    rl_Rectangle src = { 0, 0, (float)texture.width, (float)texture.height };
+
+    for (int i = 0; i < DRAW_COUNT; i++)
+    {
+        rl_Rectangle dest = { (float)(i%BENCH_SCREEN_WIDTH), (float)((i*7)%BENCH_SCREEN_HEIGHT), 64, 64 };
+        rl_DrawTexturePro(texture, src, dest, (rl_Vector2){ 32, 32 }, (float)i, rl_WHITE);
+    }
+
+    rlDrawRenderBatchActive();
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+void BenchTextures(void)
+{
+    const double pixels = (double)IMAGE_SIZE*IMAGE_SIZE;
+
+    source = rl_GenImagePerlinNoise(IMAGE_SIZE, IMAGE_SIZE, 0, 0, 4.0f);
+    texture = rl_LoadTextureFromImage(source);
+
+    rl_Image target = rl_GenImageColor(IMAGE_SIZE, IMAGE_SIZE, rl_SKYBLUE);
+    rl_Image targetR5G5B5A1 = rl_ImageCopy(target);
+    rl_ImageFormat(&targetR5G5B5A1, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1);
+    rl_Image targetR32G32B32A32 = rl_ImageCopy(target);
+    rl_ImageFormat(&targetR32G32B32A32, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32);
+
+    BenchRun("textures", "image_copy", "pixels", pixels, false, CopyImage, NULL);
+    BenchRun("textures", "image_format_r5g6b5", "pixels", pixels, false, FormatImage, NULL);
+    BenchRun("textures", "image_resize_half", "pixels", pixels, false, ResizeImage, NULL);
+    BenchRun("textures", "image_blur_gaussian", "pixels", pixels, false, BlurImage, NULL);
+    BenchRun("textures", "image_draw_r8g8b8a8", "pixels", pixels, false, DrawImage, &target);
+    BenchRun("textures", "image_draw_r5g5b5a1", "pixels", pixels, false, DrawImage, &targetR5G5B5A1);
+    BenchRun("textures", "image_draw_r32g32b32a32", "pixels", pixels, false, DrawImage, &targetR32G32B32A32);
+    BenchRun("textures", "texture_update", "pixels", pixels, true, UpdateTexture, NULL);
+    BenchRun("textures", "texture_draw_pro", "textures", DRAW_COUNT, true, DrawTextures, NULL);
+
+    rl_UnloadImage(targetR32G32B32A32);
+    rl_UnloadImage(targetR5G5B5A1);
+    rl_UnloadImage(target);
+    rl_UnloadTexture(texture);
+    rl_UnloadImage(source);
+}
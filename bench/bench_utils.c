@@ -0,0 +1,71 @@
+/*******************************************************************************************
+*
+*   raylib [bench] - data compression and hashing benchmarks
+*
+*   Benchmarks licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#include "raylib.h"
+
+#include "bench.h"
+
+#define DATA_SIZE           (1024*1024)     // Processed data size (bytes)
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static unsigned char *data = NULL;
+static unsigned char *compData = NULL;
+static int compDataSize = 0;
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+static void Compress(void *userData)
+{
+    int size = 0;
+    rl_MemFree(rl_CompressData(data, DATA_SIZE, &size));
+}
+
+static void Decompress(void *userData)
+{
+    int size = 0;
+    rl_MemFree(rl_DecompressData(compData, compDataSize, &size));
+}
+
+static void HashCRC32(void *userData) { volatile unsigned int crc = rl_ComputeCRC32(data, DATA_SIZE); (void)crc; }
+static void HashMD5(void *userData) { rl_ComputeMD5(data, DATA_SIZE); }
+static void HashSHA1(void *userData) { rl_ComputeSHA1(data, DATA_SIZE); }
+static void HashSHA256(void *userData) { rl_ComputeSHA256(data, DATA_SIZE); }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+void BenchUtils(void)
+{
+    // Generate compressible data: random words from a small dictionary
+    static const char *words[] = { "raylib ", "simple ", "and ", "easy-to-use ", "library ", "to ", "enjoy ", "videogames ", "programming ", "\n" };
+    data = (unsigned char *)rl_MemAlloc(DATA_SIZE);
+
+    for (int i = 0; i < DATA_SIZE; )
+    {
+        const char *word = words[rl_GetRandomValue(0, 9)];
+        for (int k = 0; (word[k] != '\0') && (i < DATA_SIZE); k++, i++) data[i] = (unsigned char)word[k];
+    }
+
+    compData = rl_CompressData(data, DATA_SIZE, &compDataSize);
+
+    BenchRun("utils", "compress", "bytes", DATA_SIZE, false, Compress, NULL);
+    BenchRun("utils", "decompress", "bytes", DATA_SIZE, false, Decompress, NULL);
+    BenchRun("utils", "crc32", "bytes", DATA_SIZE, false, HashCRC32, NULL);
+    BenchRun("utils", "md5", "bytes", DATA_SIZE, false, HashMD5, NULL);
+    BenchRun("utils", "sha1", "bytes", DATA_SIZE, false, HashSHA1, NULL);
+    BenchRun("utils", "sha256", "bytes", DATA_SIZE, false, HashSHA256, NULL);
+
+    rl_MemFree(compData);
+    rl_MemFree(data);
+}
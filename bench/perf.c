@@ -0,0 +1,519 @@
+/*******************************************************************************************
+*
+*   raylib [bench] - performance regression runner
+*
+*   Usage:
+*       raylib_perf run [--frames <count>] [--events <dir>] [--examples <dir>] [--filter <text>]
+*                       [--json <file>] [--verbose] [program ...]
+*       raylib_perf compare <baseline> <results> [--threshold <percent>] [--count-threshold <percent>]
+*
+*   run:
+*       --frames <count>            Measured frames per program (default: PERF_FRAMES)
+*       --events <dir>              Automation events directory, <program>.rae files replayed as input
+*       --examples <dir>            Run examples built in dir, listed in examples_list.txt
+*       --filter <text>             Run only examples whose name contains text
+*       --json <file>               Results file (default: perf_results.json)
+*       --verbose                   Show programs output
+*
+*   compare:
+*       --threshold <percent>       Frame times regression threshold (default: PERF_TIME_THRESHOLD)
+*       --count-threshold <percent> Draw calls, vertices, allocations and memory regression threshold (default: PERF_COUNT_THRESHOLD)
+*
+*   Programs run unmodified in a raylib performance run (raylib built with SUPPORT_PERF_RUN), set by environment
+*   variables: frames are not paced, frame time is fixed and input is replayed from automation events, results
+*   are collected in a single JSON file, to be stored as baseline and compared with later runs
+*
+*   Input to replay is recorded running a program with RAYLIB_PERF_RECORD=<program>.rae (rl_StartAutomationEventRecordingToFile())
+*
+*   Benchmarks licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+*   BSD-like license that allows static linking with closed source software
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+********************************************************************************************/
+
+#if !defined(_WIN32)
+    #define _POSIX_C_SOURCE 200112L     // Required for: setenv(), unsetenv()
+#endif
+
+#include <stdio.h>          // Required for: printf(), fprintf(), snprintf(), fopen(), fclose(), remove()
+#include <stdlib.h>         // Required for: atoi(), atof(), strtod(), system(), malloc(), free()
+#include <string.h>         // Required for: strcmp(), strstr(), strchr(), strrchr(), strncpy()
+#include <stdbool.h>        // Required for: bool
+
+#if defined(_WIN32)
+    #include <direct.h>     // Required for: _getcwd()
+    #define getcwd _getcwd
+    #define PATH_SEPARATOR  '\\'
+    #define NULL_DEVICE     "NUL"
+#else
+    #include <unistd.h>     // Required for: getcwd()
+    #define PATH_SEPARATOR  '/'
+    #define NULL_DEVICE     "/dev/null"
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define PERF_FRAMES                 600     // Default measured frames per program
+#define PERF_TIME_THRESHOLD        10.0     // Default frame times regression threshold (percent)
+#define PERF_COUNT_THRESHOLD        1.0     // Default counts and memory regression threshold (percent)
+#define PERF_MAX_PROGRAMS           512     // Maximum number of programs per run
+#define PERF_MAX_METRICS             16     // Maximum number of metrics per program
+#define PERF_MAX_PATH              1024     // Maximum path length
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Program metric, parsed from results JSON
+typedef struct PerfMetric {
+    char name[32];                  // Metric name (i.e. frame_p99_ms, draw_calls)
+    double value;                   // Metric value
+} PerfMetric;
+
+// Program results
+typedef struct PerfResult {
+    char name[128];                 // Program name
+    PerfMetric metrics[PERF_MAX_METRICS];
+    int metricCount;
+} PerfResult;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static char programs[PERF_MAX_PROGRAMS][PERF_MAX_PATH] = { 0 };
+static int programCount = 0;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static int RunPrograms(int argc, char *argv[]);         // Run programs and export results
+static int CompareResults(int argc, char *argv[]);      // Compare results with baseline, returns 1 on regressions
+static void AddExamples(const char *examplesPath, const char *filter);  // Add examples listed in examples_list.txt
+static bool RunProgram(const char *path, const char *eventsPath, int frames, bool verbose, PerfResult *result); // Run program performance run
+static int LoadResults(const char *fileName, PerfResult *results, int maxResults); // Load results file
+static int ParseMetrics(const char *text, PerfMetric *metrics, int maxMetrics); // Parse JSON "key": number pairs
+static const PerfMetric *FindMetric(const PerfResult *result, const char *name);
+static char *LoadText(const char *fileName);            // Load text file (to be freed)
+static const char *GetName(const char *path);           // Get program name from path (no directory and extension)
+static void SetEnvironment(const char *name, const char *value); // Set environment variable (NULL to unset)
+static void PrintUsage(void);
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    if ((argc > 1) && (strcmp(argv[1], "run") == 0)) return RunPrograms(argc - 2, argv + 2);
+    else if ((argc > 1) && (strcmp(argv[1], "compare") == 0)) return CompareResults(argc - 2, argv + 2);
+
+    PrintUsage();
+
+    return 1;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Run programs and export results
+static int RunPrograms(int argc, char *argv[])
+{
+    const char *eventsPath = NULL;
+    const char *examplesPath = NULL;
+    const char *filter = NULL;
+    const char *jsonFileName = "perf_results.json";
+    int frames = PERF_FRAMES;
+    bool verbose = false;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--frames") == 0) && (i + 1 < argc)) frames = atoi(argv[++i]);
+        else if ((strcmp(argv[i], "--events") == 0) && (i + 1 < argc)) eventsPath = argv[++i];
+        else if ((strcmp(argv[i], "--examples") == 0) && (i + 1 < argc)) examplesPath = argv[++i];
+        else if ((strcmp(argv[i], "--filter") == 0) && (i + 1 < argc)) filter = argv[++i];
+        else if ((strcmp(argv[i], "--json") == 0) && (i + 1 < argc)) jsonFileName = argv[++i];
+        else if (strcmp(argv[i], "--verbose") == 0) verbose = true;
+        else if (argv[i][0] == '-') { PrintUsage(); return 1; }
+        else if (programCount < PERF_MAX_PROGRAMS) snprintf(programs[programCount++], PERF_MAX_PATH, "%s", argv[i]);
+    }
+
+    if (examplesPath != NULL) AddExamples(examplesPath, filter);
+    if (frames < 1) frames = 1;
+
+    if (programCount == 0)
+    {
+        fprintf(stderr, "No programs to run\n");
+        return 1;
+    }
+
+    FILE *file = fopen(jsonFileName, "wt");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Failed to create results file: %s\n", jsonFileName);
+        return 1;
+    }
+
+    fprintf(file, "{\n  \"frames\": %i,\n  \"programs\": {\n", frames);
+    printf("%-40s %12s %12s %12s %12s %12s\n", "program", "mean ms", "p99 ms", "draw calls", "vertices", "allocations");
+
+    int resultCount = 0;
+    int failedCount = 0;
+
+    for (int i = 0; i < programCount; i++)
+    {
+        PerfResult result = { 0 };
+
+        if (!RunProgram(programs[i], eventsPath, frames, verbose, &result))
+        {
+            printf("%-40s failed, no results exported (raylib built with SUPPORT_PERF_RUN?)\n", GetName(programs[i]));
+            failedCount++;
+            continue;
+        }
+
+        // NOTE: One program per line, compare parses results line by line
+        fprintf(file, "%s    \"%s\": { ", (resultCount > 0)? ",\n" : "", result.name);
+        for (int m = 0; m < result.metricCount; m++) fprintf(file, "%s\"%s\": %.10g", (m > 0)? ", " : "", result.metrics[m].name, result.metrics[m].value);
+        fprintf(file, " }");
+        resultCount++;
+
+        const PerfMetric *mean = FindMetric(&result, "frame_mean_ms");
+        const PerfMetric *p99 = FindMetric(&result, "frame_p99_ms");
+        const PerfMetric *drawCalls = FindMetric(&result, "draw_calls");
+        const PerfMetric *vertices = FindMetric(&result, "vertices");
+        const PerfMetric *allocations = FindMetric(&result, "allocations");
+
+        printf("%-40s %12.3f %12.3f %12.1f %12.1f %12.1f\n", result.name, (mean != NULL)? mean->value : 0.0, (p99 != NULL)? p99->value : 0.0,
+            (drawCalls != NULL)? drawCalls->value : 0.0, (vertices != NULL)? vertices->value : 0.0, (allocations != NULL)? allocations->value : 0.0);
+    }
+
+    fprintf(file, "\n  }\n}\n");
+    fclose(file);
+
+    printf("\n%i programs measured, %i failed, results exported: %s\n", resultCount, failedCount, jsonFileName);
+
+    return (failedCount > 0)? 1 : 0;
+}
+
+// Compare results with baseline, returns 1 on regressions
+// NOTE: All metrics are lower-is-better, frame times and counts have their own thresholds,
+// frame times are noisy (machine load), counts and memory are expected to be the same on every run
+static int CompareResults(int argc, char *argv[])
+{
+    const char *baselineFileName = NULL;
+    const char *resultsFileName = NULL;
+    double timeThreshold = PERF_TIME_THRESHOLD;
+    double countThreshold = PERF_COUNT_THRESHOLD;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "--threshold") == 0) && (i + 1 < argc)) timeThreshold = atof(argv[++i]);
+        else if ((strcmp(argv[i], "--count-threshold") == 0) && (i + 1 < argc)) countThreshold = atof(argv[++i]);
+        else if (argv[i][0] == '-') { PrintUsage(); return 1; }
+        else if (baselineFileName == NULL) baselineFileName = argv[i];
+        else if (resultsFileName == NULL) resultsFileName = argv[i];
+    }
+
+    if ((baselineFileName == NULL) || (resultsFileName == NULL)) { PrintUsage(); return 1; }
+
+    static PerfResult baseline[PERF_MAX_PROGRAMS] = { 0 };
+    static PerfResult results[PERF_MAX_PROGRAMS] = { 0 };
+
+    int baselineCount = LoadResults(baselineFileName, baseline, PERF_MAX_PROGRAMS);
+    int resultCount = LoadResults(resultsFileName, results, PERF_MAX_PROGRAMS);
+
+    if ((baselineCount < 0) || (resultCount < 0)) return 1;
+
+    int regressions = 0;
+    int improvements = 0;
+    int missing = 0;
+
+    printf("%-40s %-16s %14s %14s %10s\n", "program", "metric", "baseline", "result", "change");
+
+    for (int i = 0; i < baselineCount; i++)
+    {
+        const PerfResult *result = NULL;
+        for (int k = 0; k < resultCount; k++) if (strcmp(results[k].name, baseline[i].name) == 0) result = &results[k];
+
+        if (result == NULL)
+        {
+            printf("%-40s missing in results\n", baseline[i].name);
+            missing++;
+            continue;
+        }
+
+        for (int m = 0; m < baseline[i].metricCount; m++)
+        {
+            const PerfMetric *base = &baseline[i].metrics[m];
+            const PerfMetric *value = FindMetric(result, base->name);
+
+            if ((value == NULL) || (strcmp(base->name, "frames") == 0)) continue;
+
+            bool time = (strstr(base->name, "_ms") != NULL);
+            double threshold = time? timeThreshold : countThreshold;
+            double change = (base->value != 0.0)? (value->value - base->value)*100.0/base->value : ((value->value != 0.0)? 100.0 : 0.0);
+
+            if (change > threshold)
+            {
+                printf("%-40s %-16s %14.3f %14.3f %+9.1f%% REGRESSION\n", result->name, base->name, base->value, value->value, change);
+                regressions++;
+            }
+            else if (change < -threshold)
+            {
+                printf("%-40s %-16s %14.3f %14.3f %+9.1f%% improved\n", result->name, base->name, base->value, value->value, change);
+                improvements++;
+            }
+        }
+    }
+
+    printf("\n%i programs compared, %i regressions, %i improvements, %i missing (thresholds: frame times %.1f%%, counts %.1f%%)\n",
+        baselineCount - missing, regressions, improvements, missing, timeThreshold, countThreshold);
+
+    return ((regressions > 0) || (missing > 0))? 1 : 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Add examples listed in examples_list.txt
+// NOTE: List lines are <example_category>;<example_name>;..., examples not built are skipped
+static void AddExamples(const char *examplesPath, const char *filter)
+{
+    char listFileName[PERF_MAX_PATH] = { 0 };
+    snprintf(listFileName, PERF_MAX_PATH, "%s/examples_list.txt", examplesPath);
+
+    char *text = LoadText(listFileName);
+    if (text == NULL)
+    {
+        fprintf(stderr, "Failed to load examples list: %s\n", listFileName);
+        return;
+    }
+
+    for (char *line = strtok(text, "\r\n"); line != NULL; line = strtok(NULL, "\r\n"))
+    {
+        if ((line[0] == '#') || (strchr(line, ';') == NULL)) continue;
+
+        char category[64] = { 0 };
+        char name[128] = { 0 };
+        if (sscanf(line, "%63[^;];%127[^;]", category, name) != 2) continue;
+        if ((filter != NULL) && (strstr(name, filter) == NULL)) continue;
+
+        char path[PERF_MAX_PATH] = { 0 };
+#if defined(_WIN32)
+        snprintf(path, PERF_MAX_PATH, "%s/%s/%s.exe", examplesPath, category, name);
+#else
+        snprintf(path, PERF_MAX_PATH, "%s/%s/%s", examplesPath, category, name);
+#endif
+        FILE *program = fopen(path, "rb");
+        if (program == NULL) continue;
+        fclose(program);
+
+        if (programCount < PERF_MAX_PROGRAMS) snprintf(programs[programCount++], PERF_MAX_PATH, "%s", path);
+    }
+
+    free(text);
+}
+
+// Run program performance run
+// NOTE: Program runs from its own directory (resources are loaded relative to it), results and events paths are absolute
+static bool RunProgram(const char *path, const char *eventsPath, int frames, bool verbose, PerfResult *result)
+{
+    char workPath[PERF_MAX_PATH] = { 0 };
+    if (getcwd(workPath, PERF_MAX_PATH) == NULL) return false;
+
+    const char *name = GetName(path);
+    snprintf(result->name, sizeof(result->name), "%s", name);
+
+    char resultsFileName[PERF_MAX_PATH] = { 0 };
+    char framesText[16] = { 0 };
+    snprintf(resultsFileName, PERF_MAX_PATH, "%s%cperf_%s.json", workPath, PATH_SEPARATOR, name);
+    snprintf(framesText, sizeof(framesText), "%i", frames);
+    remove(resultsFileName);
+
+    SetEnvironment("RAYLIB_PERF_RUN", resultsFileName);
+    SetEnvironment("RAYLIB_PERF_FRAMES", framesText);
+    SetEnvironment("RAYLIB_PERF_EVENTS", NULL);
+
+    if (eventsPath != NULL)
+    {
+        char eventsFileName[PERF_MAX_PATH] = { 0 };
+        if ((eventsPath[0] == '/') || (eventsPath[0] == '\\') || ((eventsPath[0] != '\0') && (eventsPath[1] == ':'))) snprintf(eventsFileName, PERF_MAX_PATH, "%s%c%s.rae", eventsPath, PATH_SEPARATOR, name);
+        else snprintf(eventsFileName, PERF_MAX_PATH, "%s%c%s%c%s.rae", workPath, PATH_SEPARATOR, eventsPath, PATH_SEPARATOR, name);
+
+        FILE *events = fopen(eventsFileName, "rb");
+        if (events != NULL)
+        {
+            fclose(events);
+            SetEnvironment("RAYLIB_PERF_EVENTS", eventsFileName);
+        }
+    }
+
+    // Program directory and file name
+    char directory[PERF_MAX_PATH] = { 0 };
+    snprintf(directory, PERF_MAX_PATH, "%s", path);
+    char *separator = strrchr(directory, '/');
+    if (separator == NULL) separator = strrchr(directory, '\\');
+    const char *fileName = (separator != NULL)? path + (separator - directory) + 1 : path;
+    if (separator != NULL) *separator = '\0';
+    else snprintf(directory, PERF_MAX_PATH, ".");
+
+    char command[3*PERF_MAX_PATH] = { 0 };
+#if defined(_WIN32)
+    snprintf(command, sizeof(command), "cd /d \"%s\" && \"%s\"%s", directory, fileName, verbose? "" : " > " NULL_DEVICE " 2>&1");
+#else
+    snprintf(command, sizeof(command), "cd \"%s\" && \"./%s\"%s", directory, fileName, verbose? "" : " > " NULL_DEVICE " 2>&1");
+#endif
+
+    int status = system(command);
+    (void)status;       // Results file is checked instead, programs exit code is not relevant
+
+    char *text = LoadText(resultsFileName);
+    if (text == NULL) return false;
+
+    result->metricCount = ParseMetrics(text, result->metrics, PERF_MAX_METRICS);
+
+    free(text);
+    remove(resultsFileName);
+
+    return (result->metricCount > 0);
+}
+
+// Load results file
+static int LoadResults(const char *fileName, PerfResult *results, int maxResults)
+{
+    char *text = LoadText(fileName);
+    if (text == NULL)
+    {
+        fprintf(stderr, "Failed to load results file: %s\n", fileName);
+        return -1;
+    }
+
+    int count = 0;
+
+    for (char *line = strtok(text, "\r\n"); (line != NULL) && (count < maxResults); line = strtok(NULL, "\r\n"))
+    {
+        // Program line: "name": { "metric": value, ... }
+        char *start = strchr(line, '"');
+        char *metrics = strchr(line, '{');
+        if ((start == NULL) || (metrics == NULL) || (metrics < start)) continue;
+
+        char *end = strchr(start + 1, '"');
+        if ((end == NULL) || (end > metrics)) continue;
+
+        PerfResult *result = &results[count];
+        memset(result, 0, sizeof(PerfResult));
+        snprintf(result->name, sizeof(result->name), "%.*s", (int)(end - start - 1), start + 1);
+        result->metricCount = ParseMetrics(metrics + 1, result->metrics, PERF_MAX_METRICS);
+
+        if (result->metricCount > 0) count++;
+    }
+
+    free(text);
+
+    return count;
+}
+
+// Parse JSON "key": number pairs
+// NOTE: Flat objects only, pairs with non-numeric values are skipped
+static int ParseMetrics(const char *text, PerfMetric *metrics, int maxMetrics)
+{
+    int count = 0;
+    const char *ptr = text;
+
+    while ((ptr = strchr(ptr, '"')) != NULL)
+    {
+        const char *end = strchr(ptr + 1, '"');
+        if (end == NULL) break;
+
+        const char *value = end + 1;
+        while ((*value == ' ') || (*value == '\t')) value++;
+
+        if (*value != ':') { ptr = end + 1; continue; }     // String value, not a key
+        value++;
+        while ((*value == ' ') || (*value == '\t')) value++;
+
+        char *valueEnd = NULL;
+        double number = strtod(value, &valueEnd);
+
+        if ((valueEnd != value) && (count < maxMetrics))
+        {
+            snprintf(metrics[count].name, sizeof(metrics[count].name), "%.*s", (int)(end - ptr - 1), ptr + 1);
+            metrics[count].value = number;
+            count++;
+            ptr = valueEnd;
+        }
+        else ptr = value;
+    }
+
+    return count;
+}
+
+// Find program metric by name
+static const PerfMetric *FindMetric(const PerfResult *result, const char *name)
+{
+    for (int i = 0; i < result->metricCount; i++)
+    {
+        if (strcmp(result->metrics[i].name, name) == 0) return &result->metrics[i];
+    }
+
+    return NULL;
+}
+
+// Load text file (to be freed)
+static char *LoadText(const char *fileName)
+{
+    FILE *file = fopen(fileName, "rb");
+    if (file == NULL) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char *text = (size >= 0)? (char *)malloc(size + 1) : NULL;
+    if (text != NULL)
+    {
+        size_t count = fread(text, 1, size, file);
+        text[count] = '\0';
+    }
+
+    fclose(file);
+
+    return text;
+}
+
+// Get program name from path (no directory and extension)
+static const char *GetName(const char *path)
+{
+    static char name[128] = { 0 };
+
+    const char *fileName = strrchr(path, '/');
+    const char *fileNameWin = strrchr(path, '\\');
+    if ((fileNameWin != NULL) && ((fileName == NULL) || (fileNameWin > fileName))) fileName = fileNameWin;
+    fileName = (fileName != NULL)? fileName + 1 : path;
+
+    snprintf(name, sizeof(name), "%s", fileName);
+
+    char *extension = strrchr(name, '.');
+    if ((extension != NULL) && (extension != name)) *extension = '\0';
+
+    return name;
+}
+
+// Set environment variable (NULL to unset)
+static void SetEnvironment(const char *name, const char *value)
+{
+#if defined(_WIN32)
+    _putenv_s(name, (value != NULL)? value : "");
+#else
+    if (value != NULL) setenv(name, value, 1);
+    else unsetenv(name);
+#endif
+}
+
+// Print command line usage
+static void PrintUsage(void)
+{
+    printf("Usage:\n");
+    printf("    raylib_perf run [--frames <count>] [--events <dir>] [--examples <dir>] [--filter <text>]\n");
+    printf("                    [--json <file>] [--verbose] [program ...]\n");
+    printf("    raylib_perf compare <baseline> <results> [--threshold <percent>] [--count-threshold <percent>]\n");
+}
@@ -66,6 +66,10 @@ elseif (${PLATFORM} MATCHES "Web")
     if(NOT GRAPHICS)
         set(GRAPHICS "GRAPHICS_API_OPENGL_ES2")
     endif()
+    if (SUPPORT_WEB_RENDER_WORKER)
+        # NOTE: Programs must link with: -pthread -sPROXY_TO_PTHREAD -sOFFSCREENCANVAS_SUPPORT
+        add_compile_options(-pthread)
+    endif ()
     set(CMAKE_STATIC_LIBRARY_SUFFIX ".a")
 
 elseif (${PLATFORM} MATCHES "Android")
@@ -107,6 +111,20 @@ elseif ("${PLATFORM}" MATCHES "DRM")
     set(LIBS_PRIVATE ${GLESV2} ${EGL} ${DRM} ${GBM} atomic pthread dl)
     set(LIBS_PUBLIC m)
 
+elseif ("${PLATFORM}" MATCHES "Headless")
+    set(PLATFORM_CPP "PLATFORM_HEADLESS")
+
+    add_definitions(-D_DEFAULT_SOURCE)
+    add_definitions(-DEGL_NO_X11)
+
+    find_library(EGL EGL)
+    set(LIBS_PRIVATE ${EGL} pthread dl rt)
+    if ("${OPENGL_VERSION}" MATCHES "ES")
+        find_library(GLESV2 GLESv2)
+        set(LIBS_PRIVATE ${LIBS_PRIVATE} ${GLESV2})
+    endif ()
+    set(LIBS_PUBLIC m)
+
 elseif ("${PLATFORM}" MATCHES "SDL")
 	# First, check if SDL is included as a subdirectory
 	if(TARGET SDL3::SDL3)
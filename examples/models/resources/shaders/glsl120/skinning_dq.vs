@@ -0,0 +1,52 @@
+#version 120
+
+// NOTE: Dual quaternions take 2 vec4 per bone, twice the bones of bone matrices in the same uniform space
+#define MAX_BONE_NUM 128
+
+// Input vertex attributes
+attribute vec3 vertexPosition;
+attribute vec2 vertexTexCoord;
+attribute vec4 vertexColor;
+attribute vec4 vertexBoneIds;
+attribute vec4 vertexBoneWeights;
+
+// Input uniform values
+uniform mat4 mvp;
+uniform vec4 boneDualQuats[2*MAX_BONE_NUM];     // Rotation and translation per bone
+
+// Output vertex attributes (to fragment shader)
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+
+void main()
+{
+    int boneIndex0 = int(vertexBoneIds.x);
+    int boneIndex1 = int(vertexBoneIds.y);
+    int boneIndex2 = int(vertexBoneIds.z);
+    int boneIndex3 = int(vertexBoneIds.w);
+
+    // Rotations flipped to the first bone hemisphere, blending follows the shortest path
+    vec4 pivot = boneDualQuats[2*boneIndex0];
+    vec4 weights = vertexBoneWeights*vec4(1.0,
+        sign(dot(boneDualQuats[2*boneIndex1], pivot) + 1e-6),
+        sign(dot(boneDualQuats[2*boneIndex2], pivot) + 1e-6),
+        sign(dot(boneDualQuats[2*boneIndex3], pivot) + 1e-6));
+
+    vec4 real = weights.x*boneDualQuats[2*boneIndex0] + weights.y*boneDualQuats[2*boneIndex1] +
+                weights.z*boneDualQuats[2*boneIndex2] + weights.w*boneDualQuats[2*boneIndex3];
+    vec4 dual = weights.x*boneDualQuats[2*boneIndex0 + 1] + weights.y*boneDualQuats[2*boneIndex1 + 1] +
+                weights.z*boneDualQuats[2*boneIndex2 + 1] + weights.w*boneDualQuats[2*boneIndex3 + 1];
+
+    float len = length(real);
+    real /= len;
+    dual /= len;
+
+    // Rotation by real part, translation from dual part (2*dual*conjugate(real))
+    vec3 skinnedPosition = vertexPosition + 2.0*cross(real.xyz, cross(real.xyz, vertexPosition) + real.w*vertexPosition);
+    skinnedPosition += 2.0*(real.w*dual.xyz - dual.w*real.xyz + cross(real.xyz, dual.xyz));
+
+    fragTexCoord = vertexTexCoord;
+    fragColor = vertexColor;
+
+    gl_Position = mvp*vec4(skinnedPosition, 1.0);
+}
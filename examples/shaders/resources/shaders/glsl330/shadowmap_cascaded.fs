@@ -0,0 +1,81 @@
+#version 330
+
+// This shader supports one directional light with cascaded shadow maps,
+// uniforms shadowMap, shadowMatrices, shadowSplits and shadowCascadeCount are set by rl_SetShaderShadowMap()
+
+#define MAX_SHADOW_MAP_CASCADES     4
+
+// Input vertex attributes (from vertex shader)
+in vec3 fragPosition;
+in vec2 fragTexCoord;
+//in vec4 fragColor;
+in vec3 fragNormal;
+in float fragViewDepth;
+
+// Input uniform values
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+
+// Output fragment color
+out vec4 finalColor;
+
+// Input lighting values
+uniform vec3 lightDir;
+uniform vec4 lightColor;
+uniform vec4 ambient;
+
+// Input shadowmapping values
+uniform sampler2DArrayShadow shadowMap;                     // Cascades depth layers, hardware depth comparison
+uniform mat4 shadowMatrices[MAX_SHADOW_MAP_CASCADES];       // Cascades light view-projection matrices
+uniform float shadowSplits[MAX_SHADOW_MAP_CASCADES];        // Cascades end distance (camera view depth)
+uniform int shadowCascadeCount;
+
+float GetShadow(vec3 normal, vec3 l)
+{
+    // Select first cascade containing fragment, no shadow beyond last cascade
+    int cascade = 0;
+    while ((cascade < shadowCascadeCount) && (fragViewDepth > shadowSplits[cascade])) cascade++;
+    if (cascade == shadowCascadeCount) return 0.0;
+
+    // Normal offset bias: position pushed along normal by cascade texel world size (orthographic scale),
+    // avoids shadow acne on every cascade without peter-panning
+    vec2 texelSize = 1.0/vec2(textureSize(shadowMap, 0).xy);
+    mat4 matrix = shadowMatrices[cascade];
+    float texelWorldSize = 2.0*texelSize.x/length(vec3(matrix[0][0], matrix[1][0], matrix[2][0]));
+    vec3 offset = normal*texelWorldSize*(1.5 + 1.5*(1.0 - dot(normal, l)));
+
+    vec4 fragPosLightSpace = matrix*vec4(fragPosition + offset, 1.0);
+    vec3 coords = fragPosLightSpace.xyz/fragPosLightSpace.w*0.5 + 0.5;   // Transform from [-1, 1] range to [0, 1] range
+    float bias = 0.0002;
+
+    // PCF (percentage-closer filtering) with hardware 2x2 bilinear comparison per tap
+    float shadow = 0.0;
+    for (int x = -1; x <= 1; x++)
+    {
+        for (int y = -1; y <= 1; y++)
+        {
+            shadow += 1.0 - texture(shadowMap, vec4(coords.xy + texelSize*vec2(x, y), float(cascade), coords.z - bias));
+        }
+    }
+
+    return shadow/9.0;
+}
+
+void main()
+{
+    // Texel color fetching from texture sampler
+    vec4 texelColor = texture(texture0, fragTexCoord);
+    vec3 normal = normalize(fragNormal);
+    vec3 l = -normalize(lightDir);
+
+    float NdotL = max(dot(normal, l), 0.0);
+    vec3 lightDot = lightColor.rgb*NdotL*(1.0 - GetShadow(normal, l));
+
+    finalColor = texelColor*colDiffuse*vec4(lightDot, 1.0);
+
+    // Add ambient lighting whether in shadow or not
+    finalColor += texelColor*(ambient/10.0)*colDiffuse;
+
+    // Gamma correction
+    finalColor = pow(finalColor, vec4(1.0/2.2));
+}
@@ -57,18 +57,51 @@
 // Use busy wait loop for timing sync, if not defined, a high-resolution timer is set up and used
 //#define SUPPORT_BUSY_WAIT_LOOP          1
 // Use a partial-busy wait loop, in this case frame sleeps for most of the time, but then runs a busy loop at the end for accuracy
+// NOTE: Busy loop is limited to measured sleep overshoot, rl_EndDrawing() frame pacing is set with rl_SetFramePacingMode()
 #define SUPPORT_PARTIALBUSY_WAIT_LOOP    1
 // Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 // WARNING: It also requires SUPPORT_IMAGE_EXPORT and SUPPORT_FILEFORMAT_PNG flags
 #define SUPPORT_SCREEN_CAPTURE          1
 // Support rl_CompressData() and rl_DecompressData() functions
 #define SUPPORT_COMPRESSION_API         1
+// Support worker threads for block-parallel compression in rl_CompressDataEx() and rl_DecompressDataEx()
+// NOTE: Requires POSIX threads, blocks are processed on caller thread if not available
+#define SUPPORT_COMPRESSION_THREADS     1
 // Support automatic generated events, loading and recording of those events when required
 #define SUPPORT_AUTOMATION_EVENTS       1
+// Support timestamped input events stream, platform callbacks push events into a lock-free queue, read with rl_GetInputEvent()
+#define SUPPORT_INPUT_EVENTS            1
 // Support custom frame control, only for advanced users
 // By default rl_EndDrawing() does this job: draws everything + rl_SwapScreenBuffer() + manage frame timing + rl_PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
 //#define SUPPORT_CUSTOM_FRAME_CONTROL    1
+// Support an optional render thread, rl_EnableRenderThread() moves frame submit + rl_SwapScreenBuffer() to a dedicated thread
+// NOTE: Only available on PLATFORM_DESKTOP_GLFW with POSIX threads, it requires RLGL_ENABLE_COMMAND_BUFFERS (enabled automatically)
+//#define SUPPORT_RENDER_THREAD           1
+// Support secondary windows sharing main window graphics resources (textures, meshes, shaders), rl_InitSecondaryWindow()
+// NOTE: Only available on PLATFORM_DESKTOP_GLFW and PLATFORM_DESKTOP_SDL, it requires OpenGL 3.3 or OpenGL ES 3.0
+#define SUPPORT_MULTIPLE_WINDOWS        1
+// Support running raylib on a Web Worker rendering to an OffscreenCanvas, browser main thread only forwards input events
+// NOTE: Only available on PLATFORM_WEB, programs must use emscripten_set_main_loop() and link with:
+// -pthread -sPROXY_TO_PTHREAD -sOFFSCREENCANVAS_SUPPORT (ASYNCIFY is not required)
+//#define SUPPORT_WEB_RENDER_WORKER       1
+// Support shader program binary cache, linked programs are saved to disk and reloaded on next launch (skipping compilation)
+// NOTE: Requires OpenGL 4.1 (GL_ARB_get_program_binary) or OpenGL ES 3.0, shaders are compiled from source otherwise
+//#define SUPPORT_SHADER_CACHE            1
+// Support assets hot reload, files of shaders loaded with rl_LoadShader() and shared textures are watched for changes
+// and reloaded in place (same id) by rl_BeginDrawing(), rl_SetAssetReloadedCallback() notifies reloaded files
+// NOTE: Uses file system events on Linux (inotify), watched files are polled on other platforms (ASSETS_HOT_RELOAD_POLL_FILES per frame)
+//#define SUPPORT_ASSETS_HOT_RELOAD       1
+// Support worker threads for recursive directory scanning in rl_LoadDirectoryFilesEx(), subdirectories are scanned in parallel
+// NOTE: Requires POSIX threads, directories are scanned on caller thread if not available
+#define SUPPORT_DIRECTORY_SCAN_THREADS  1
+// Support CPU frame profiler, named zones (rl_BeginProfileZone()) recorded per thread and exported as Chrome trace
+// NOTE: raylib frame stages (drawing, swap, input polling, waits), rlgl batch flushes and loaders are instrumented
+//#define SUPPORT_CPU_PROFILER            1
+// Support performance runs set by environment variables, programs run unmodified a number of frames replaying recorded input,
+// frame times percentiles, draw calls and allocations are exported as JSON (RAYLIB_PERF_RUN=<file>, see rcore.c)
+// NOTE: Frames are not paced and rl_GetFrameTime() returns a fixed time, same frames are drawn on every run
+//#define SUPPORT_PERF_RUN                1
 
 // Support for clipboard image loading
 // NOTE: Only working on SDL3, GLFW (Windows) and RGFW (Windows)
@@ -96,7 +129,13 @@
 
 // rcore: Configuration values
 //------------------------------------------------------------------------------------
-#define MAX_FILEPATH_CAPACITY        8192       // Maximum file paths capacity
+#define MAX_FILEPATH_CAPACITY        8192       // Initial file paths capacity for directory scanning, grows as required
+#define CPU_PROFILER_MAX_ZONES      16384       // Maximum zones recorded per thread, oldest zones overwritten (SUPPORT_CPU_PROFILER)
+#define PERF_RUN_DEFAULT_FRAMES       600       // Performance run measured frames, if not set by RAYLIB_PERF_FRAMES (SUPPORT_PERF_RUN)
+#define MAX_DIRECTORY_SCAN_THREADS      4       // Maximum number of threads scanning subdirectories (caller thread included)
+#define FILE_HASH_CHUNK_SIZE        65536       // File data chunk size read on file hash computation (bytes)
+#define COMPRESSION_BLOCK_SIZE     262144       // Compressed blocks stream block size (bytes), blocks are compressed independently
+#define MAX_COMPRESSION_THREADS         8       // Maximum number of threads processing compressed blocks (caller thread included)
 #define MAX_FILEPATH_LENGTH          4096       // Maximum length for filepaths (Linux PATH_MAX default value)
 
 #define MAX_KEYBOARD_KEYS             512       // Maximum number of keyboard keys supported
@@ -111,7 +150,14 @@
 
 #define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
 
-#define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
+#define MAX_AUTOMATION_EVENTS       16384       // Initial capacity of automation events list (grows as required)
+#define MAX_SECONDARY_WINDOWS           8       // Maximum number of secondary windows opened at once
+#define MAX_INPUT_EVENTS_QUEUE       1024       // Maximum number of input events queued, must be a power of two (rl_GetInputEvent())
+
+#define FRAME_PACING_HISTOGRAM_STEP     0.5f    // Frame times histogram bin size in milliseconds (rl_GetFramePacingStats())
+
+#define SHADER_CACHE_DIRECTORY  "shadercache"   // Shader program binary cache directory, relative to storage base path (SUPPORT_SHADER_CACHE)
+#define ASSETS_HOT_RELOAD_POLL_FILES      8     // Maximum watched files polled per frame, if file system events are not available (SUPPORT_ASSETS_HOT_RELOAD)
 
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
@@ -123,16 +169,48 @@
 // Show OpenGL extensions and capabilities detailed logs on init
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
+// Use persistently mapped render batch vertex buffers (GL_ARB_buffer_storage), buffer orphaning used as fallback
+//#define RLGL_ENABLE_PERSISTENT_BATCH_BUFFERS   1
+
+// Use interleaved vertex layout for render batch vertex buffers (32 bytes per vertex, single VBO)
+//#define RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS  1
+
+// Let render batch draw calls reference multiple textures with default shader (texture slot stored per-vertex)
+//#define RLGL_ENABLE_MULTITEXTURE_BATCH         1
+
+// Enable GPU frame profiler (timestamp queries per named pass, results read back asynchronously)
+//#define RLGL_ENABLE_GPU_PROFILER               1
+
+// Enable command buffers, rlgl immediate-mode calls recorded from any thread and replayed on GL thread
+//#define RLGL_ENABLE_COMMAND_BUFFERS            1
+
+// Keep a shadow copy of GL state and skip redundant GL calls (program, VAO, textures, blending, toggles, viewport)
+//#define RLGL_ENABLE_STATE_CACHE                1
+
+// Store rlgl and raylib state per thread, every thread calling rl_InitWindow() gets an independent context
+// NOTE: Only available on PLATFORM_HEADLESS
+//#define RLGL_ENABLE_THREAD_CONTEXTS            1
+
+// Software renderer (OpenGL 1.1 software) worker threads for tile-binned rasterization, 0 disables it
+// NOTE: Requires POSIX threads, rendering throughput scales with cores on GPU-less devices
+//#define SW_RASTER_THREADS                      3
+
+// Software renderer triangles rasterization using edge functions on pixel blocks instead of scanlines
+// NOTE: Multiple pixels are evaluated at once with SIMD when rlsw is built with RLSW_USE_SIMD_INTRINSICS
+//#define SW_RASTER_HALF_SPACE                   1
+
 #define RL_SUPPORT_MESH_GPU_SKINNING           1      // GPU skinning, comment if your GPU does not support more than 8 VBOs
 
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
+#define RL_DEFAULT_BATCH_PERSISTENT_BUFFERS    3      // Default number of batch buffers when using persistent mapping (ring buffering)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (rl_SetShaderValueTexture())
+#define RL_DEFAULT_BATCH_DRAW_TEXTURES         4      // Maximum number of textures referenced by a single draw call (RLGL_ENABLE_MULTITEXTURE_BATCH)
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal rl_Matrix stack
 
-#define RL_MAX_SHADER_LOCATIONS               32      // Maximum number of shader locations supported
+#define RL_MAX_SHADER_LOCATIONS               40      // Maximum number of shader locations supported
 
 #define RL_CULL_DISTANCE_NEAR              0.05       // Default projection matrix near cull distance
 #define RL_CULL_DISTANCE_FAR             4000.0       // Default projection matrix far cull distance
@@ -148,6 +226,7 @@
 #if defined(RL_SUPPORT_MESH_GPU_SKINNING)
     #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS     7
     #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS 8
+    #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCE_PALETTE 13
 #endif
 #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCE_TX 9
 
@@ -179,7 +258,10 @@
 
 // rshapes: Configuration values
 //------------------------------------------------------------------------------------
-#define SPLINE_SEGMENT_DIVISIONS       24       // Spline segments subdivisions
+#define SPLINE_SEGMENT_DIVISIONS       24       // Spline segments subdivisions (bezier lines)
+#define SPLINE_SEGMENT_DIVISIONS_MAX  128       // Spline segments maximum subdivisions, adapted to curve flatness and drawing scale
+#define SPLINE_TESSELLATION_ERROR   0.25f       // Spline maximum distance between tessellated and exact curve, in screen pixels
+#define LINE_STROKE_MITER_LIMIT      4.0f       // Line strip stroke miter length limit relative to half thickness, bevel join used over it
 
 //------------------------------------------------------------------------------------
 // Module: rtextures - Configuration Flags
@@ -195,7 +277,7 @@
 #define SUPPORT_FILEFORMAT_DDS      1
 //#define SUPPORT_FILEFORMAT_HDR      1
 //#define SUPPORT_FILEFORMAT_PIC          1
-//#define SUPPORT_FILEFORMAT_KTX      1
+#define SUPPORT_FILEFORMAT_KTX      1
 //#define SUPPORT_FILEFORMAT_ASTC     1
 //#define SUPPORT_FILEFORMAT_PKM      1
 //#define SUPPORT_FILEFORMAT_PVR      1
@@ -207,6 +289,20 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: rl_ImageFormat(), rl_ImageCrop(), rl_ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Support worker threads for image filters, rl_ImageBlurGaussian() and rl_ImageKernelConvolution() rows,
+// for rl_LoadImages() files decoding, PNG export rows compression and rl_ExportImageAsync() export thread
+// NOTE: Requires POSIX threads, jobs run on job system worker threads, on caller thread if not available
+#define SUPPORT_IMAGE_WORKER_THREADS    1
+// Support shared textures, textures loaded from the same file (rl_LoadTexture(), models materials) or the same
+// model image data share one GPU texture with reference counting, rl_UnloadTexture() releases one reference
+// NOTE: Updates to a shared texture (data, filter, wrap) apply to all its references
+//#define SUPPORT_SHARED_TEXTURES         1
+// Support render graph for post-processing chains [rl_LoadRenderGraph()], passes declared with inputs/outputs,
+// unused passes culled and transient targets aliased through render textures pool
+#define SUPPORT_RENDER_GRAPH            1
+// Support memory mapped raw image files for rl_LoadImageRawMapped(), pixel data paged in from file on access
+// NOTE: Requires POSIX mmap(), regions are read from file on demand if not available
+#define SUPPORT_IMAGE_FILE_MAPPING      1
 
 //------------------------------------------------------------------------------------
 // Module: rtext - Configuration Flags
@@ -214,10 +310,14 @@
 // Default font is loaded on window initialization to be available for the user to render simple text
 // NOTE: If enabled, uses external module functions to load default raylib font
 #define SUPPORT_DEFAULT_FONT            1
+// Default font is loaded on first use instead of window initialization [rl_GetFontDefault()]
+// NOTE: Shapes use rlgl default texture, batching with text is kept by font shapes texture (SUPPORT_FONT_SHAPES_TEXTURE)
+//#define SUPPORT_LAZY_DEFAULT_FONT       1
 // Selected desired font fileformats to be supported for loading
 #define SUPPORT_FILEFORMAT_TTF          1
 #define SUPPORT_FILEFORMAT_FNT          1
 //#define SUPPORT_FILEFORMAT_BDF          1
+#define SUPPORT_FILEFORMAT_RFNT         1
 
 // Support text management functions
 // If not defined, still some functions are supported: rl_TextLength(), rl_TextFormat()
@@ -228,15 +328,28 @@
 // drawing text and shapes with a single draw call [rl_SetShapesTexture()]
 #define SUPPORT_FONT_ATLAS_WHITE_REC    1
 
+// Fonts atlas with white rectangle are set as shapes texture while drawing text with them,
+// shapes and text labels are batched together (user provided shapes texture is kept) [rl_SetShapesTexture()]
+#define SUPPORT_FONT_SHAPES_TEXTURE     1
+
 // Support conservative font atlas size estimation
 //#define SUPPORT_FONT_ATLAS_SIZE_CONSERVATIVE    1
 
+// Support font atlas cache, generated TTF fonts atlas and glyphs metrics are saved to disk
+// and reloaded on next launch (skipping glyphs rasterization)
+//#define SUPPORT_FONT_ATLAS_CACHE        1
+
 // rtext: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
                                                 // rl_TextFormat(), rl_TextSubtext(), rl_TextToUpper(), rl_TextToLower(), rl_TextToPascal(), rl_TextSplit()
 #define MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: rl_TextSplit()
 
+#define FONT_CACHE_DIRECTORY    "fontcache"     // Font atlas cache directory, relative to storage base path (SUPPORT_FONT_ATLAS_CACHE)
+#define FONT_KERNING_MAX_GLYPHS       512       // Maximum number of font glyphs with all pairs kerning read on font loading
+#define TEXT_SHAPING_CACHE_SIZE        64       // Maximum number of shaped texts layouts cached: rl_SetTextShaping()
+#define FONT_SHAPES_TEXTURES_MAX       32       // Maximum number of fonts atlas used as shapes texture (SUPPORT_FONT_SHAPES_TEXTURE)
+
 //------------------------------------------------------------------------------------
 // Module: rmodels - Configuration Flags
 //------------------------------------------------------------------------------------
@@ -247,13 +360,35 @@
 #define SUPPORT_FILEFORMAT_GLTF         1
 #define SUPPORT_FILEFORMAT_VOX          1
 #define SUPPORT_FILEFORMAT_M3D          1
+// Support raylib model cache files (.rmdl), binary GPU-ready data loaded with no parsing
+#define SUPPORT_FILEFORMAT_RMDL         1
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
+// Support occlusion culling on rl_DrawMesh(), using a depth pyramid built from async depth readbacks
+// NOTE: Culling is enabled at runtime with rl_EnableOcclusionCulling(), requires OpenGL 3.3
+#define SUPPORT_OCCLUSION_CULLING       1
+// Support cascaded shadow maps for directional lights, casters drawn from draw lists
+// NOTE: Requires OpenGL 3.3 or OpenGL ES 3.0 (depth texture arrays), cascades not changed are kept cached
+#define SUPPORT_SHADOW_MAPS             1
+// Support deferred rendering, materials written to G-buffer and lit by many point lights (light volumes)
+// NOTE: Requires OpenGL 3.3 or OpenGL ES 3.0 (multiple render targets)
+#define SUPPORT_DEFERRED_RENDERING      1
+// Support worker threads for ray batch collision functions, CPU skinning in rl_UpdateModelAnimation()
+// and models decoding in rl_LoadModelAsync()
+// NOTE: Requires POSIX threads, jobs run on job system worker threads, on caller thread if not available
+#define SUPPORT_MODELS_WORKER_THREADS   1
+// Support dual quaternion blending on CPU skinning (rl_UpdateModelSkinning()), instead of linear blending of bone matrices
+// NOTE: Avoids volume loss on twisted joints (candy-wrapper effect) but bones scale is ignored,
+// GPU skinning uses dual quaternions when shader declares boneDualQuats uniform, independently of this flag
+//#define SUPPORT_MESH_DUAL_QUATERNION_SKINNING 1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_MATERIAL_MAPS              12       // Maximum number of shader maps supported
+#define MAX_SHADOW_MAP_CASCADES         4       // Maximum shadow map cascades (shader shadowMatrices array size)
+#define MAX_DRAWLIST_TRACKED_CHANGES  128       // Draw list changes kept to find out cached shadow map cascades still valid
+#define MAX_MESH_STREAM_BUFFERS         3       // Maximum vertex buffers per attribute on streamed meshes (rl_UploadMeshStreamed())
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
 #define MAX_MESH_VERTEX_BUFFERS         9       // Maximum vertex buffers (VBO) per mesh
@@ -272,14 +407,27 @@
 //#define SUPPORT_FILEFORMAT_FLAC         1
 #define SUPPORT_FILEFORMAT_XM           1
 #define SUPPORT_FILEFORMAT_MOD          1
+// Support worker threads for rl_ProcessWaves() batch processing, waves processed in parallel
+// NOTE: Requires POSIX threads, waves are processed on caller thread if not available
+#define SUPPORT_WAVE_WORKER_THREADS     1
+// Audio device initialization is deferred to first audio resource loaded [rl_InitAudioDevice()]
+// NOTE: Programs not playing audio skip audio backend startup time
+//#define SUPPORT_LAZY_AUDIO_DEVICE       1
 
 // raudio: Configuration values
 //------------------------------------------------------------------------------------
 #define AUDIO_DEVICE_FORMAT    ma_format_f32    // Device output format (miniaudio: float-32bit)
 #define AUDIO_DEVICE_CHANNELS              2    // Device output channels: stereo
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
+#define AUDIO_DEVICE_PERIOD_SIZE           0    // Device period size in frames (0: device default)
+#define AUDIO_DEVICE_PERIODS               0    // Device periods count (0: device default)
 
 #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define AUDIO_COMMAND_QUEUE_SIZE         256    // Maximum audio commands queued to audio thread per mix (power of two)
+#define AUDIO_VOICES_MAX                   0    // Maximum sounds mixed at once (0: no limit), excess sounds are virtual
+#define AUDIO_MUSIC_DECODE_BUFFERS         4    // Music sub-buffers decoded ahead by decoder thread, for threaded music streams
+#define AUDIO_RESAMPLER_QUALITY            1    // Mixing time resampler quality: 0-Linear, 1-Filtered (4th order), 2-Filtered high (8th order)
+#define AUDIO_SOUND_COMPRESSED_SIZE        0    // Sounds over this size on device format (in bytes) are kept QOA compressed (0: disabled), i.e. (8*1024*1024)
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -290,9 +438,28 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Support file I/O worker threads for rl_LoadFileDataAsync() and rl_SaveFileDataAsync() requests
+// NOTE: Requires POSIX threads, requests are completed on caller thread if not available
+#define SUPPORT_FILE_IO_THREADS         1
+// Support job system worker threads for rl_RunJob() and rl_ParallelFor(), also used by modules worker jobs
+// (image filters, ray batches, CPU skinning, waves processing), one thread pool shared by raylib and user code
+// NOTE: Requires POSIX threads, jobs run on caller thread if not available
+#define SUPPORT_JOB_WORKER_THREADS      1
+// Support packed archives mounting with rl_MountArchive(), files are resolved by rl_LoadFileData() and rl_LoadFileText()
+// NOTE: Archives are memory mapped on POSIX systems, loaded into memory otherwise
+#define SUPPORT_FILE_ARCHIVES           1
+// Support memory tracking, raylib modules allocations (RL_MALLOC, RL_CALLOC...) are tagged by module,
+// tracked in rl_GetMemoryStats() and routed through allocator callbacks set with rl_SetMemoryCallbacks()
+// WARNING: Memory released by raylib must be allocated by raylib or rl_MemAlloc(), a tag header precedes every allocation
+//#define SUPPORT_MEMORY_TRACKING         1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_FILE_IO_THREADS             2       // Max number of file I/O worker threads (async file requests)
+#define MAX_JOB_WORKER_THREADS          8       // Max number of job system worker threads (one per additional processor by default)
+#define MEMORY_FRAME_ARENA_SIZE    (256*1024)   // Frame arena initial size (in bytes), grows to the largest frame usage
+#define MEMORY_FRAME_ARENA_MAX_SIZE (16*1024*1024) // Frame arena maximum size (in bytes), usage over it served from overflow blocks
+#define MAX_MOUNTED_ARCHIVES            8       // Max number of packed archives mounted at the same time (rl_MountArchive())
 
 #endif // CONFIG_H
@@ -39,8 +39,13 @@ typedef struct DIR DIR;
 
 struct dirent {
     char *d_name;
+    unsigned char d_type;       // Entry type: DT_DIR or DT_REG (from find data attributes)
 };
 
+#define DT_UNKNOWN  0
+#define DT_DIR      4
+#define DT_REG      8
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -164,6 +169,7 @@ struct dirent *readdir(DIR *dir)
         {
             result = &dir->result;
             result->d_name = dir->info.name;
+            result->d_type = (dir->info.attrib & _A_SUBDIR)? DT_DIR : DT_REG;
         }
     }
     else errno = EBADF;
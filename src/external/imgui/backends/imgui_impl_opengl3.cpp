@@ -24,6 +24,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-15: OpenGL: Added optional '#define IMGUI_IMPL_OPENGL_STREAM_BUFFER' mode: all draw lists are written into one orphaned ring buffer pair per frame and drawn with base vertex offsets (Desktop GL 3.2+).
 //  2025-XX-XX: Platform: Added support for multiple windows via the ImGuiPlatformIO interface.
 //  2025-12-11: OpenGL: Fixed embedded loader multiple init/shutdown cycles broken on some platforms. (#8792, #9112)
 //  2025-09-18: Call platform_io.ClearRendererHandlers() on shutdown.
@@ -216,6 +217,11 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
 #endif
 
+// [Configuration] Stream all draw lists into one vertex/index ring buffer pair, requires glDrawElementsBaseVertex() and glMapBufferRange()
+#if defined(IMGUI_IMPL_OPENGL_STREAM_BUFFER) && defined(IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET) && defined(GL_MAP_UNSYNCHRONIZED_BIT)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_STREAM_BUFFER
+#endif
+
 // Desktop GL 3.3+ and GL ES 3.0+ have glBindSampler()
 #if !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3))
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
@@ -253,6 +259,9 @@ struct ImGui_ImplOpenGL3_Data
     bool            HasBindSampler;
     bool            HasClipOrigin;
     bool            UseBufferSubData;
+    bool            UseStreamBuffer;         // Draw lists appended into VboHandle/ElementsHandle used as rings of VertexBufferSize/IndexBufferSize bytes
+    GLsizeiptr      StreamVtxOffset;         // Ring write offsets, in bytes
+    GLsizeiptr      StreamIdxOffset;
     ImVector<char>  TempBuffer;
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
@@ -373,6 +382,9 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
     if (bd->GlVersion >= 320)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_STREAM_BUFFER
+    bd->UseStreamBuffer = (bd->GlVersion >= 320);
 #endif
     io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;       // We can honor ImGuiPlatformIO::Textures[] requests during render.
     io.BackendFlags |= ImGuiBackendFlags_RendererHasViewports;      // We can create multi-viewports on the Renderer side (optional)
@@ -534,6 +546,65 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_STREAM_BUFFER
+// Write all draw lists into the stream ring buffers, which must be bound (done by ImGui_ImplOpenGL3_SetupRenderState()).
+// - Each frame writes a range never written since the buffer storage was last specified, so it is mapped unsynchronized without waiting for in-flight draws.
+// - When a ring is full, its storage is orphaned with glBufferData(nullptr) and writing restarts at 0, the driver keeps the previous storage alive for pending draws.
+// Returns false if data could not be uploaded, rings are re-specified on next frame and caller falls back to per-list uploads.
+static bool ImGui_ImplOpenGL3_UploadStreamBuffer(ImDrawData* draw_data, GLint* out_vtx_base, GLsizeiptr* out_idx_offset)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const GLsizeiptr vtx_size = (GLsizeiptr)draw_data->TotalVtxCount * (int)sizeof(ImDrawVert);
+    const GLsizeiptr idx_size = (GLsizeiptr)draw_data->TotalIdxCount * (int)sizeof(ImDrawIdx);
+    if (vtx_size == 0 || idx_size == 0)
+        return false;
+
+    // Orphan full rings, capacity grown to hold several frames between orphaning
+    if (bd->StreamVtxOffset + vtx_size > bd->VertexBufferSize)
+    {
+        if (bd->VertexBufferSize < vtx_size * 4)
+            bd->VertexBufferSize = (vtx_size * 8 > (1 << 20)) ? vtx_size * 8 : (1 << 20);
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, bd->VertexBufferSize, nullptr, GL_STREAM_DRAW));
+        bd->StreamVtxOffset = 0;
+    }
+    if (bd->StreamIdxOffset + idx_size > bd->IndexBufferSize)
+    {
+        if (bd->IndexBufferSize < idx_size * 4)
+            bd->IndexBufferSize = (idx_size * 8 > (1 << 19)) ? idx_size * 8 : (1 << 19);
+        GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, nullptr, GL_STREAM_DRAW));
+        bd->StreamIdxOffset = 0;
+    }
+
+    const GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+    char* vtx_dst = (char*)glMapBufferRange(GL_ARRAY_BUFFER, bd->StreamVtxOffset, vtx_size, access);
+    char* idx_dst = (char*)glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, bd->StreamIdxOffset, idx_size, access);
+    if (vtx_dst != nullptr && idx_dst != nullptr)
+    {
+        for (const ImDrawList* draw_list : draw_data->CmdLists)
+        {
+            memcpy(vtx_dst, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+            memcpy(idx_dst, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+            vtx_dst += draw_list->VtxBuffer.Size * sizeof(ImDrawVert);
+            idx_dst += draw_list->IdxBuffer.Size * sizeof(ImDrawIdx);
+        }
+    }
+    bool vtx_ok = (vtx_dst != nullptr) && glUnmapBuffer(GL_ARRAY_BUFFER);
+    bool idx_ok = (idx_dst != nullptr) && glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+    if (!vtx_ok || !idx_ok)
+    {
+        bd->VertexBufferSize = bd->IndexBufferSize = 0;
+        bd->StreamVtxOffset = bd->StreamIdxOffset = 0;
+        return false;
+    }
+
+    *out_vtx_base = (GLint)(bd->StreamVtxOffset / (int)sizeof(ImDrawVert));
+    *out_idx_offset = bd->StreamIdxOffset;
+    bd->StreamVtxOffset += vtx_size;
+    bd->StreamIdxOffset += idx_size;
+    return true;
+}
+#endif
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -604,6 +675,15 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
+    // Upload all draw lists at once when streaming, lists are then drawn at their offset in the ring buffers
+    bool use_stream_buffer = false;
+    GLint list_vtx_base = 0;            // In vertices
+    GLsizeiptr list_idx_offset = 0;     // In bytes
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_STREAM_BUFFER
+    if (bd->UseStreamBuffer)
+        use_stream_buffer = ImGui_ImplOpenGL3_UploadStreamBuffer(draw_data, &list_vtx_base, &list_idx_offset);
+#endif
+
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
@@ -621,7 +701,11 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
         const GLsizeiptr vtx_buffer_size = (GLsizeiptr)draw_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
         const GLsizeiptr idx_buffer_size = (GLsizeiptr)draw_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
-        if (bd->UseBufferSubData)
+        if (use_stream_buffer)
+        {
+            // Already uploaded by ImGui_ImplOpenGL3_UploadStreamBuffer()
+        }
+        else if (bd->UseBufferSubData)
         {
             if (bd->VertexBufferSize < vtx_buffer_size)
             {
@@ -669,12 +753,17 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
-                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
+                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(list_idx_offset + pcmd->IdxOffset * sizeof(ImDrawIdx)), list_vtx_base + (GLint)pcmd->VtxOffset));
                 else
 #endif
                 GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
             }
         }
+        if (use_stream_buffer)
+        {
+            list_vtx_base += draw_list->VtxBuffer.Size;
+            list_idx_offset += idx_buffer_size;
+        }
     }
 
     // Destroy the temporary VAO
@@ -1049,6 +1138,8 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
+    bd->VertexBufferSize = bd->IndexBufferSize = 0;
+    bd->StreamVtxOffset = bd->StreamIdxOffset = 0;
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
 
     // Destroy all textures
@@ -0,0 +1,339 @@
+// dear imgui: Platform Backend for raylib
+// This needs to be used along with a Renderer (e.g. rlgl)
+// (Info: raylib is a simple and easy-to-use library to enjoy videogames programming, this backend reads inputs through its core module)
+
+// Implemented features:
+//  [X] Platform: Clipboard support.
+//  [X] Platform: Mouse support.
+//  [X] Platform: Keyboard support. Since 1.87 we are using the io.AddKeyEvent() function. Pass ImGuiKey values to all key functions e.g. ImGui::IsKeyPressed(ImGuiKey_Space).
+//  [X] Platform: Gamepad support (first gamepad only).
+//  [X] Platform: Mouse cursor shape and visibility (ImGuiBackendFlags_HasMouseCursors). Disable with 'io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange'.
+// Missing features or Issues:
+//  [ ] Platform: Multi-viewport support.
+//  [ ] Platform: IME support.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// CHANGELOG
+//  2026-10-15: Initial version, inputs polled from raylib core module state.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_raylib.h"
+
+// raylib
+#include "raylib.h"
+
+// raylib Data
+struct ImGui_ImplRaylib_Data
+{
+    double                  Time;
+    bool                    WindowFocused;
+    ImGuiMouseCursor        MouseLastCursor;
+
+    ImGui_ImplRaylib_Data() { memset((void*)this, 0, sizeof(*this)); MouseLastCursor = ImGuiMouseCursor_COUNT; }
+};
+
+// Backend data stored in io.BackendPlatformUserData to allow support for multiple Dear ImGui contexts
+// FIXME: some shared resources (mouse cursor shape, gamepad) are mishandled when using multi-context.
+static ImGui_ImplRaylib_Data* ImGui_ImplRaylib_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplRaylib_Data*)ImGui::GetIO().BackendPlatformUserData : nullptr;
+}
+
+// Keyboard keys polled every frame, raylib key -> ImGuiKey
+struct ImGui_ImplRaylib_KeyMap { int RaylibKey; ImGuiKey Key; };
+static const ImGui_ImplRaylib_KeyMap ImGui_ImplRaylib_Keys[] =
+{
+    { KEY_APOSTROPHE, ImGuiKey_Apostrophe }, { KEY_COMMA, ImGuiKey_Comma }, { KEY_MINUS, ImGuiKey_Minus },
+    { KEY_PERIOD, ImGuiKey_Period }, { KEY_SLASH, ImGuiKey_Slash }, { KEY_SEMICOLON, ImGuiKey_Semicolon },
+    { KEY_EQUAL, ImGuiKey_Equal }, { KEY_LEFT_BRACKET, ImGuiKey_LeftBracket }, { KEY_BACKSLASH, ImGuiKey_Backslash },
+    { KEY_RIGHT_BRACKET, ImGuiKey_RightBracket }, { KEY_GRAVE, ImGuiKey_GraveAccent },
+    { KEY_ZERO, ImGuiKey_0 }, { KEY_ONE, ImGuiKey_1 }, { KEY_TWO, ImGuiKey_2 }, { KEY_THREE, ImGuiKey_3 }, { KEY_FOUR, ImGuiKey_4 },
+    { KEY_FIVE, ImGuiKey_5 }, { KEY_SIX, ImGuiKey_6 }, { KEY_SEVEN, ImGuiKey_7 }, { KEY_EIGHT, ImGuiKey_8 }, { KEY_NINE, ImGuiKey_9 },
+    { KEY_A, ImGuiKey_A }, { KEY_B, ImGuiKey_B }, { KEY_C, ImGuiKey_C }, { KEY_D, ImGuiKey_D }, { KEY_E, ImGuiKey_E },
+    { KEY_F, ImGuiKey_F }, { KEY_G, ImGuiKey_G }, { KEY_H, ImGuiKey_H }, { KEY_I, ImGuiKey_I }, { KEY_J, ImGuiKey_J },
+    { KEY_K, ImGuiKey_K }, { KEY_L, ImGuiKey_L }, { KEY_M, ImGuiKey_M }, { KEY_N, ImGuiKey_N }, { KEY_O, ImGuiKey_O },
+    { KEY_P, ImGuiKey_P }, { KEY_Q, ImGuiKey_Q }, { KEY_R, ImGuiKey_R }, { KEY_S, ImGuiKey_S }, { KEY_T, ImGuiKey_T },
+    { KEY_U, ImGuiKey_U }, { KEY_V, ImGuiKey_V }, { KEY_W, ImGuiKey_W }, { KEY_X, ImGuiKey_X }, { KEY_Y, ImGuiKey_Y },
+    { KEY_Z, ImGuiKey_Z },
+    { KEY_SPACE, ImGuiKey_Space }, { KEY_ESCAPE, ImGuiKey_Escape }, { KEY_ENTER, ImGuiKey_Enter }, { KEY_TAB, ImGuiKey_Tab },
+    { KEY_BACKSPACE, ImGuiKey_Backspace }, { KEY_INSERT, ImGuiKey_Insert }, { KEY_DELETE, ImGuiKey_Delete },
+    { KEY_RIGHT, ImGuiKey_RightArrow }, { KEY_LEFT, ImGuiKey_LeftArrow }, { KEY_DOWN, ImGuiKey_DownArrow }, { KEY_UP, ImGuiKey_UpArrow },
+    { KEY_PAGE_UP, ImGuiKey_PageUp }, { KEY_PAGE_DOWN, ImGuiKey_PageDown }, { KEY_HOME, ImGuiKey_Home }, { KEY_END, ImGuiKey_End },
+    { KEY_CAPS_LOCK, ImGuiKey_CapsLock }, { KEY_SCROLL_LOCK, ImGuiKey_ScrollLock }, { KEY_NUM_LOCK, ImGuiKey_NumLock },
+    { KEY_PRINT_SCREEN, ImGuiKey_PrintScreen }, { KEY_PAUSE, ImGuiKey_Pause },
+    { KEY_F1, ImGuiKey_F1 }, { KEY_F2, ImGuiKey_F2 }, { KEY_F3, ImGuiKey_F3 }, { KEY_F4, ImGuiKey_F4 }, { KEY_F5, ImGuiKey_F5 },
+    { KEY_F6, ImGuiKey_F6 }, { KEY_F7, ImGuiKey_F7 }, { KEY_F8, ImGuiKey_F8 }, { KEY_F9, ImGuiKey_F9 }, { KEY_F10, ImGuiKey_F10 },
+    { KEY_F11, ImGuiKey_F11 }, { KEY_F12, ImGuiKey_F12 },
+    { KEY_LEFT_SHIFT, ImGuiKey_LeftShift }, { KEY_LEFT_CONTROL, ImGuiKey_LeftCtrl }, { KEY_LEFT_ALT, ImGuiKey_LeftAlt },
+    { KEY_LEFT_SUPER, ImGuiKey_LeftSuper }, { KEY_RIGHT_SHIFT, ImGuiKey_RightShift }, { KEY_RIGHT_CONTROL, ImGuiKey_RightCtrl },
+    { KEY_RIGHT_ALT, ImGuiKey_RightAlt }, { KEY_RIGHT_SUPER, ImGuiKey_RightSuper }, { KEY_KB_MENU, ImGuiKey_Menu },
+    { KEY_KP_0, ImGuiKey_Keypad0 }, { KEY_KP_1, ImGuiKey_Keypad1 }, { KEY_KP_2, ImGuiKey_Keypad2 }, { KEY_KP_3, ImGuiKey_Keypad3 },
+    { KEY_KP_4, ImGuiKey_Keypad4 }, { KEY_KP_5, ImGuiKey_Keypad5 }, { KEY_KP_6, ImGuiKey_Keypad6 }, { KEY_KP_7, ImGuiKey_Keypad7 },
+    { KEY_KP_8, ImGuiKey_Keypad8 }, { KEY_KP_9, ImGuiKey_Keypad9 }, { KEY_KP_DECIMAL, ImGuiKey_KeypadDecimal },
+    { KEY_KP_DIVIDE, ImGuiKey_KeypadDivide }, { KEY_KP_MULTIPLY, ImGuiKey_KeypadMultiply }, { KEY_KP_SUBTRACT, ImGuiKey_KeypadSubtract },
+    { KEY_KP_ADD, ImGuiKey_KeypadAdd }, { KEY_KP_ENTER, ImGuiKey_KeypadEnter }, { KEY_KP_EQUAL, ImGuiKey_KeypadEqual },
+};
+
+// Mouse cursors, ImGuiMouseCursor -> raylib cursor
+static const int ImGui_ImplRaylib_MouseCursors[ImGuiMouseCursor_COUNT] =
+{
+    MOUSE_CURSOR_ARROW,             // ImGuiMouseCursor_Arrow
+    MOUSE_CURSOR_IBEAM,             // ImGuiMouseCursor_TextInput
+    MOUSE_CURSOR_RESIZE_ALL,        // ImGuiMouseCursor_ResizeAll
+    MOUSE_CURSOR_RESIZE_NS,         // ImGuiMouseCursor_ResizeNS
+    MOUSE_CURSOR_RESIZE_EW,         // ImGuiMouseCursor_ResizeEW
+    MOUSE_CURSOR_RESIZE_NESW,       // ImGuiMouseCursor_ResizeNESW
+    MOUSE_CURSOR_RESIZE_NWSE,       // ImGuiMouseCursor_ResizeNWSE
+    MOUSE_CURSOR_POINTING_HAND,     // ImGuiMouseCursor_Hand
+    MOUSE_CURSOR_DEFAULT,           // ImGuiMouseCursor_Wait (not available)
+    MOUSE_CURSOR_DEFAULT,           // ImGuiMouseCursor_Progress (not available)
+    MOUSE_CURSOR_NOT_ALLOWED,       // ImGuiMouseCursor_NotAllowed
+};
+
+// Functions
+static const char* ImGui_ImplRaylib_GetClipboardText(ImGuiContext*)
+{
+    return rl_GetClipboardText();
+}
+
+static void ImGui_ImplRaylib_SetClipboardText(ImGuiContext*, const char* text)
+{
+    rl_SetClipboardText(text);
+}
+
+static bool ImGui_ImplRaylib_OpenInShell(ImGuiContext*, const char* url)
+{
+    rl_OpenURL(url);
+    return true;
+}
+
+bool ImGui_ImplRaylib_Init()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendPlatformUserData == nullptr && "Already initialized a platform backend!");
+    IM_ASSERT(rl_IsWindowReady() && "Window must be initialized before the platform backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplRaylib_Data* bd = IM_NEW(ImGui_ImplRaylib_Data)();
+    io.BackendPlatformUserData = (void*)bd;
+    io.BackendPlatformName = "imgui_impl_raylib";
+    io.BackendFlags |= ImGuiBackendFlags_HasMouseCursors;       // We can honor GetMouseCursor() values (optional)
+    io.BackendFlags |= ImGuiBackendFlags_HasSetMousePos;        // We can honor io.WantSetMousePos requests (optional, rarely used)
+
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+    platform_io.Platform_GetClipboardTextFn = ImGui_ImplRaylib_GetClipboardText;
+    platform_io.Platform_SetClipboardTextFn = ImGui_ImplRaylib_SetClipboardText;
+    platform_io.Platform_OpenInShellFn = ImGui_ImplRaylib_OpenInShell;
+
+    // Set platform dependent data in viewport
+    ImGuiViewport* main_viewport = ImGui::GetMainViewport();
+    main_viewport->PlatformHandle = rl_GetWindowHandle();
+
+    bd->WindowFocused = rl_IsWindowFocused();
+    io.AddFocusEvent(bd->WindowFocused);
+
+    return true;
+}
+
+void ImGui_ImplRaylib_Shutdown()
+{
+    ImGui_ImplRaylib_Data* bd = ImGui_ImplRaylib_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No platform backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+
+    ImGui::GetMainViewport()->PlatformHandle = nullptr;
+    io.BackendPlatformName = nullptr;
+    io.BackendPlatformUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_HasMouseCursors | ImGuiBackendFlags_HasSetMousePos | ImGuiBackendFlags_HasGamepad);
+    platform_io.ClearPlatformHandlers();
+    IM_DELETE(bd);
+}
+
+static void ImGui_ImplRaylib_UpdateKeys()
+{
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Modifiers first, duplicated events are filtered by io.AddKeyEvent()
+    io.AddKeyEvent(ImGuiMod_Ctrl, rl_IsKeyDown(KEY_LEFT_CONTROL) || rl_IsKeyDown(KEY_RIGHT_CONTROL));
+    io.AddKeyEvent(ImGuiMod_Shift, rl_IsKeyDown(KEY_LEFT_SHIFT) || rl_IsKeyDown(KEY_RIGHT_SHIFT));
+    io.AddKeyEvent(ImGuiMod_Alt, rl_IsKeyDown(KEY_LEFT_ALT) || rl_IsKeyDown(KEY_RIGHT_ALT));
+    io.AddKeyEvent(ImGuiMod_Super, rl_IsKeyDown(KEY_LEFT_SUPER) || rl_IsKeyDown(KEY_RIGHT_SUPER));
+
+    // Key transitions of current frame, a key pressed and released within the same frame is kept as a press
+    for (const ImGui_ImplRaylib_KeyMap& map : ImGui_ImplRaylib_Keys)
+    {
+        if (rl_IsKeyPressed(map.RaylibKey))
+        {
+            io.AddKeyEvent(map.Key, true);
+            io.SetKeyEventNativeData(map.Key, map.RaylibKey, -1);
+        }
+        if (rl_IsKeyReleased(map.RaylibKey))
+        {
+            io.AddKeyEvent(map.Key, false);
+            io.SetKeyEventNativeData(map.Key, map.RaylibKey, -1);
+        }
+    }
+
+    // Characters queued this frame
+    for (int codepoint = rl_GetCharPressed(); codepoint != 0; codepoint = rl_GetCharPressed())
+        io.AddInputCharacter((unsigned int)codepoint);
+}
+
+static void ImGui_ImplRaylib_UpdateMouseData()
+{
+    ImGui_ImplRaylib_Data* bd = ImGui_ImplRaylib_GetBackendData();
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Focus changes, mouse is only forwarded while window is focused
+    bool focused = rl_IsWindowFocused();
+    if (focused != bd->WindowFocused)
+    {
+        bd->WindowFocused = focused;
+        io.AddFocusEvent(focused);
+        if (!focused)
+            io.AddMousePosEvent(-FLT_MAX, -FLT_MAX);
+    }
+    if (!focused)
+        return;
+
+    // (Optional) Set OS mouse position from Dear ImGui if requested (rarely used, only when io.ConfigNavMoveSetMousePos is enabled by user)
+    if (io.WantSetMousePos)
+        rl_SetMousePosition((int)io.MousePos.x, (int)io.MousePos.y);
+
+    rl_Vector2 mouse_pos = rl_GetMousePosition();
+    io.AddMousePosEvent(mouse_pos.x, mouse_pos.y);
+
+    // raylib mouse buttons 0..4 (left, right, middle, side, extra) match ImGuiMouseButton order
+    for (int button = 0; button < ImGuiMouseButton_COUNT; button++)
+    {
+        if (rl_IsMouseButtonPressed(button))
+            io.AddMouseButtonEvent(button, true);
+        if (rl_IsMouseButtonReleased(button))
+            io.AddMouseButtonEvent(button, false);
+    }
+
+    rl_Vector2 wheel = rl_GetMouseWheelMoveV();
+    if (wheel.x != 0.0f || wheel.y != 0.0f)
+        io.AddMouseWheelEvent(wheel.x, wheel.y);
+}
+
+static void ImGui_ImplRaylib_UpdateMouseCursor()
+{
+    ImGui_ImplRaylib_Data* bd = ImGui_ImplRaylib_GetBackendData();
+    ImGuiIO& io = ImGui::GetIO();
+    if (io.ConfigFlags & ImGuiConfigFlags_NoMouseCursorChange)
+        return;
+
+    ImGuiMouseCursor imgui_cursor = ImGui::GetMouseCursor();
+    if (io.MouseDrawCursor || imgui_cursor == ImGuiMouseCursor_None)
+    {
+        // Hide OS mouse cursor if imgui is drawing it or if it wants no cursor
+        if (!rl_IsCursorHidden())
+            rl_HideCursor();
+    }
+    else
+    {
+        // Show OS mouse cursor, only changed when shape differs from last frame
+        if (imgui_cursor != bd->MouseLastCursor)
+        {
+            rl_SetMouseCursor(ImGui_ImplRaylib_MouseCursors[imgui_cursor]);
+            bd->MouseLastCursor = imgui_cursor;
+        }
+        if (rl_IsCursorHidden())
+            rl_ShowCursor();
+    }
+}
+
+static void ImGui_ImplRaylib_UpdateGamepadButton(ImGuiIO& io, ImGuiKey key, int button)
+{
+    io.AddKeyEvent(key, rl_IsGamepadButtonDown(0, button));
+}
+
+static inline float Saturate(float v) { return v < 0.0f ? 0.0f : v  > 1.0f ? 1.0f : v; }
+static void ImGui_ImplRaylib_UpdateGamepadAnalog(ImGuiIO& io, ImGuiKey key, int axis, float v0, float v1)
+{
+    float vn = Saturate((rl_GetGamepadAxisMovement(0, axis) - v0) / (v1 - v0));
+    io.AddKeyAnalogEvent(key, vn > 0.1f, vn);
+}
+
+static void ImGui_ImplRaylib_UpdateGamepads()
+{
+    ImGuiIO& io = ImGui::GetIO();
+
+    io.BackendFlags &= ~ImGuiBackendFlags_HasGamepad;
+    if (!rl_IsGamepadAvailable(0))
+        return;
+    io.BackendFlags |= ImGuiBackendFlags_HasGamepad;
+
+    // Update gamepad inputs
+    // NOTE: raylib axis values are normalized: sticks in [-1..1], triggers in [-1..1] (released: -1)
+    const float thumb_dead_zone = 0.25f;
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadStart,       GAMEPAD_BUTTON_MIDDLE_RIGHT);
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadBack,        GAMEPAD_BUTTON_MIDDLE_LEFT);
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadFaceLeft,    GAMEPAD_BUTTON_RIGHT_FACE_LEFT);      // Xbox X, PS Square
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadFaceRight,   GAMEPAD_BUTTON_RIGHT_FACE_RIGHT);     // Xbox B, PS Circle
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadFaceUp,      GAMEPAD_BUTTON_RIGHT_FACE_UP);        // Xbox Y, PS Triangle
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadFaceDown,    GAMEPAD_BUTTON_RIGHT_FACE_DOWN);      // Xbox A, PS Cross
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadDpadLeft,    GAMEPAD_BUTTON_LEFT_FACE_LEFT);
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadDpadRight,   GAMEPAD_BUTTON_LEFT_FACE_RIGHT);
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadDpadUp,      GAMEPAD_BUTTON_LEFT_FACE_UP);
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadDpadDown,    GAMEPAD_BUTTON_LEFT_FACE_DOWN);
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadL1,          GAMEPAD_BUTTON_LEFT_TRIGGER_1);
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadR1,          GAMEPAD_BUTTON_RIGHT_TRIGGER_1);
+    ImGui_ImplRaylib_UpdateGamepadAnalog(io, ImGuiKey_GamepadL2,          GAMEPAD_AXIS_LEFT_TRIGGER,  -1.0f, 1.0f);
+    ImGui_ImplRaylib_UpdateGamepadAnalog(io, ImGuiKey_GamepadR2,          GAMEPAD_AXIS_RIGHT_TRIGGER, -1.0f, 1.0f);
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadL3,          GAMEPAD_BUTTON_LEFT_THUMB);
+    ImGui_ImplRaylib_UpdateGamepadButton(io, ImGuiKey_GamepadR3,          GAMEPAD_BUTTON_RIGHT_THUMB);
+    ImGui_ImplRaylib_UpdateGamepadAnalog(io, ImGuiKey_GamepadLStickLeft,  GAMEPAD_AXIS_LEFT_X,  -thumb_dead_zone, -1.0f);
+    ImGui_ImplRaylib_UpdateGamepadAnalog(io, ImGuiKey_GamepadLStickRight, GAMEPAD_AXIS_LEFT_X,  +thumb_dead_zone, +1.0f);
+    ImGui_ImplRaylib_UpdateGamepadAnalog(io, ImGuiKey_GamepadLStickUp,    GAMEPAD_AXIS_LEFT_Y,  -thumb_dead_zone, -1.0f);
+    ImGui_ImplRaylib_UpdateGamepadAnalog(io, ImGuiKey_GamepadLStickDown,  GAMEPAD_AXIS_LEFT_Y,  +thumb_dead_zone, +1.0f);
+    ImGui_ImplRaylib_UpdateGamepadAnalog(io, ImGuiKey_GamepadRStickLeft,  GAMEPAD_AXIS_RIGHT_X, -thumb_dead_zone, -1.0f);
+    ImGui_ImplRaylib_UpdateGamepadAnalog(io, ImGuiKey_GamepadRStickRight, GAMEPAD_AXIS_RIGHT_X, +thumb_dead_zone, +1.0f);
+    ImGui_ImplRaylib_UpdateGamepadAnalog(io, ImGuiKey_GamepadRStickUp,    GAMEPAD_AXIS_RIGHT_Y, -thumb_dead_zone, -1.0f);
+    ImGui_ImplRaylib_UpdateGamepadAnalog(io, ImGuiKey_GamepadRStickDown,  GAMEPAD_AXIS_RIGHT_Y, +thumb_dead_zone, +1.0f);
+}
+
+void ImGui_ImplRaylib_NewFrame()
+{
+    ImGui_ImplRaylib_Data* bd = ImGui_ImplRaylib_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplRaylib_Init()?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Setup display size (every frame to accommodate for window resizing)
+    // NOTE: Screen size is in logical units (mouse coordinates), render size considers HiDPI
+    int w = rl_GetScreenWidth();
+    int h = rl_GetScreenHeight();
+    io.DisplaySize = ImVec2((float)w, (float)h);
+    if (w > 0 && h > 0)
+        io.DisplayFramebufferScale = ImVec2((float)rl_GetRenderWidth() / w, (float)rl_GetRenderHeight() / h);
+
+    // Setup time step (raylib frame time is 0 on first frame)
+    double current_time = rl_GetTime();
+    io.DeltaTime = bd->Time > 0.0 ? (float)(current_time - bd->Time) : (float)(1.0f / 60.0f);
+    if (io.DeltaTime <= 0.0f)
+        io.DeltaTime = 0.00001f;
+    bd->Time = current_time;
+
+    ImGui_ImplRaylib_UpdateKeys();
+    ImGui_ImplRaylib_UpdateMouseData();
+    ImGui_ImplRaylib_UpdateMouseCursor();
+
+    // Update game controllers (if enabled and available)
+    if (io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad)
+        ImGui_ImplRaylib_UpdateGamepads();
+}
+
+//-----------------------------------------------------------------------------
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,38 @@
+// dear imgui: Platform Backend for raylib
+// This needs to be used along with a Renderer (e.g. rlgl)
+// (Info: raylib is a simple and easy-to-use library to enjoy videogames programming, this backend reads inputs through its core module)
+
+// Implemented features:
+//  [X] Platform: Clipboard support.
+//  [X] Platform: Mouse support.
+//  [X] Platform: Keyboard support. Since 1.87 we are using the io.AddKeyEvent() function. Pass ImGuiKey values to all key functions e.g. ImGui::IsKeyPressed(ImGuiKey_Space).
+//  [X] Platform: Gamepad support (first gamepad only).
+//  [X] Platform: Mouse cursor shape and visibility (ImGuiBackendFlags_HasMouseCursors). Disable with 'io.ConfigFlags |= ImGuiConfigFlags_NoMouseCursorChange'.
+// Missing features or Issues:
+//  [ ] Platform: Multi-viewport support.
+//  [ ] Platform: IME support.
+
+// About inputs:
+// - Inputs are polled from raylib current frame state in ImGui_ImplRaylib_NewFrame(), no events need to be forwarded.
+// - Characters are consumed from raylib characters queue (rl_GetCharPressed()), do not read it in your application while ImGui wants text input.
+// - Use io.WantCaptureMouse / io.WantCaptureKeyboard to know when to skip inputs in your application.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+// NOTE: Window must be initialized (rl_InitWindow()) before calling ImGui_ImplRaylib_Init()
+IMGUI_IMPL_API bool     ImGui_ImplRaylib_Init();
+IMGUI_IMPL_API void     ImGui_ImplRaylib_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplRaylib_NewFrame();
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,652 @@
+// dear imgui: Renderer Backend for raylib rlgl
+// - Desktop GL: 3.3 4.3
+// - Embedded GL: ES 2.0 (WebGL 1.0), ES 3.0 (WebGL 2.0)
+// - Legacy GL 1.1 and software renderer, drawn through rlgl internal render batch
+// This needs to be used along with a Platform Backend (e.g. raylib)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use rlgl texture id (rl_Texture2D.id) as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: raylib fonts sharing, glyphs taken from rl_Font instead of rasterized again (ImGui_ImplRlgl_AddFont(), ImGui_ImplRlgl_AddText()).
+// Missing features or Issues:
+//  [ ] Renderer: Multi-viewport support.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// CHANGELOG
+//  2026-10-15: Added ImGui_ImplRlgl_IsDrawDataChanged() to skip rendering idle frames along with raylib events waiting.
+//  2026-10-15: Added ImGui_ImplRlgl_AddFont() and ImGui_ImplRlgl_AddText() to share raylib fonts glyphs and atlas textures with ImGui.
+//  2026-10-15: Initial version, draw lists uploaded into rlgl vertex buffers and drawn with rlgl default shader.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_rlgl.h"
+#include "imgui_internal.h"     // ImFontLoader, ImFontAtlasPackAddRect(), ImFontAtlasBakedSetFontGlyphBitmap(), ImHashData()
+#include <stdint.h>     // intptr_t
+
+// raylib
+#include "raylib.h"     // Required for: rl_Matrix type shared with rlgl
+#include "rlgl.h"
+
+// rlgl Data
+struct ImGui_ImplRlgl_Data
+{
+    bool            UseRenderBatch;         // No vertex buffers support (OpenGL 1.1, software renderer), draw lists submitted to rlgl render batch
+    unsigned int    VaoId;                  // Vertex array object, 0 if not supported (draw state set on every frame)
+    unsigned int    VboId;
+    unsigned int    EboId;
+    int             VertexBufferSize;       // Vertex buffer capacity, in vertices
+    int             IndexBufferSize;        // Index buffer capacity, in indices
+    int             LastVtxOffset;          // Vertex offset of current attributes configuration, in vertices
+    int             LastScissor[4];
+    ImVector<char>  TempBuffer;
+    ImGuiID         LastDrawDataHash;       // Hash of last draw data checked by ImGui_ImplRlgl_IsDrawDataChanged()
+
+    ImGui_ImplRlgl_Data() { memset((void*)this, 0, sizeof(*this)); VertexBufferSize = 5000; IndexBufferSize = 10000; }
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplRlgl_Data* ImGui_ImplRlgl_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplRlgl_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+// Forward Declarations
+static bool ImGui_ImplRlgl_CreateBuffers(ImGui_ImplRlgl_Data* bd);
+static void ImGui_ImplRlgl_DestroyBuffers(ImGui_ImplRlgl_Data* bd);
+
+// Functions
+bool ImGui_ImplRlgl_Init()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+    static_assert(sizeof(ImDrawIdx) == 2, "rlDrawVertexArrayElements() only supports 16-bit indices");
+
+    // Setup backend capabilities flags
+    ImGui_ImplRlgl_Data* bd = IM_NEW(ImGui_ImplRlgl_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_rlgl";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;   // We can honor ImGuiPlatformIO::Textures[] requests during render.
+
+    int version = rlGetVersion();
+    bd->UseRenderBatch = (version == RL_OPENGL_11_SOFTWARE) || (version == RL_OPENGL_11);
+
+    return true;
+}
+
+void ImGui_ImplRlgl_Shutdown()
+{
+    ImGui_ImplRlgl_Data* bd = ImGui_ImplRlgl_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+    ImGuiPlatformIO& platform_io = ImGui::GetPlatformIO();
+
+    ImGui_ImplRlgl_DestroyDeviceObjects();
+
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasTextures);
+    platform_io.ClearRendererHandlers();
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplRlgl_NewFrame()
+{
+    ImGui_ImplRlgl_Data* bd = ImGui_ImplRlgl_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplRlgl_Init()?");
+
+    if (!bd->UseRenderBatch && bd->VboId == 0)
+        if (!ImGui_ImplRlgl_CreateDeviceObjects())
+            IM_ASSERT(0 && "ImGui_ImplRlgl_CreateDeviceObjects() failed!");
+}
+
+// Vertex attributes point to vertex buffer at given vertex offset, only reconfigured when offset changes
+// NOTE: Position is provided as 2 floats, rlgl default shader vertexPosition z component defaults to 0.0
+static void ImGui_ImplRlgl_SetupVertexAttributes(ImGui_ImplRlgl_Data* bd, int vtx_offset)
+{
+    const int* locs = rlGetShaderLocsDefault();
+    const int base = vtx_offset * (int)sizeof(ImDrawVert);
+    rlSetVertexAttribute(locs[RL_SHADER_LOC_VERTEX_POSITION], 2, RL_FLOAT, false, sizeof(ImDrawVert), base + (int)offsetof(ImDrawVert, pos));
+    rlSetVertexAttribute(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, false, sizeof(ImDrawVert), base + (int)offsetof(ImDrawVert, uv));
+    rlSetVertexAttribute(locs[RL_SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, true, sizeof(ImDrawVert), base + (int)offsetof(ImDrawVert, col));
+    bd->LastVtxOffset = vtx_offset;
+}
+
+static void ImGui_ImplRlgl_SetupRenderState(ImDrawData* draw_data)
+{
+    ImGui_ImplRlgl_Data* bd = ImGui_ImplRlgl_GetBackendData();
+
+    // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled
+    // NOTE: rlgl caches this state, only changes from current state reach the driver
+    rlSetBlendMode(RL_BLEND_ALPHA);
+    rlEnableColorBlend();
+    rlDisableBackfaceCulling();
+    rlDisableDepthTest();
+    rlEnableScissorTest();
+    bd->LastScissor[0] = bd->LastScissor[1] = bd->LastScissor[2] = bd->LastScissor[3] = -1;
+
+    // Setup orthographic projection matrix
+    // Our visible imgui space lies from draw_data->DisplayPos (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
+    float L = draw_data->DisplayPos.x;
+    float R = draw_data->DisplayPos.x + draw_data->DisplaySize.x;
+    float T = draw_data->DisplayPos.y;
+    float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
+
+    if (bd->UseRenderBatch)
+    {
+        // Render batch vertex are transformed by current matrices, replaced until rendering ends
+        rlMatrixMode(RL_PROJECTION);
+        rlLoadIdentity();
+        rlOrtho(L, R, B, T, -1.0, 1.0);
+        rlMatrixMode(RL_MODELVIEW);
+        rlLoadIdentity();
+        return;
+    }
+
+    rl_Matrix ortho_projection = {
+        2.0f/(R - L), 0.0f,         0.0f,  (R + L)/(L - R),
+        0.0f,         2.0f/(T - B), 0.0f,  (T + B)/(B - T),
+        0.0f,         0.0f,         -1.0f, 0.0f,
+        0.0f,         0.0f,         0.0f,  1.0f,
+    };
+    const float col_diffuse[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    const int tex_slot = 0;
+    const int* locs = rlGetShaderLocsDefault();
+    rlEnableShader(rlGetShaderIdDefault());
+    rlSetUniformMatrix(locs[RL_SHADER_LOC_MATRIX_MVP], ortho_projection);
+    rlSetUniform(locs[RL_SHADER_LOC_COLOR_DIFFUSE], col_diffuse, RL_SHADER_UNIFORM_VEC4, 1);
+    rlSetUniform(locs[RL_SHADER_LOC_MAP_DIFFUSE], &tex_slot, RL_SHADER_UNIFORM_INT, 1);
+    rlActiveTextureSlot(0);
+
+    // Bind vertex/index buffers, vertex array keeps attributes enabled and index buffer binding
+    if (!rlEnableVertexArray(bd->VaoId))
+    {
+        rlEnableVertexBufferElement(bd->EboId);
+        rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+        rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+        rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+    }
+    rlEnableVertexBuffer(bd->VboId);
+    bd->LastVtxOffset = -1;
+}
+
+// Submit draw command triangles to rlgl render batch (OpenGL 1.1, software renderer)
+static void ImGui_ImplRlgl_RenderDrawCmdBatch(const ImDrawList* draw_list, const ImDrawCmd* pcmd)
+{
+    const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
+    const ImDrawIdx* idx_buffer = draw_list->IdxBuffer.Data + pcmd->IdxOffset;
+
+    rlSetTexture((unsigned int)(intptr_t)pcmd->GetTexID());
+    rlBegin(RL_TRIANGLES);
+    for (unsigned int i = 0; i < pcmd->ElemCount; i++)
+    {
+        const ImDrawVert& v = vtx_buffer[idx_buffer[i]];
+        rlColor4ub((unsigned char)(v.col >> IM_COL32_R_SHIFT), (unsigned char)(v.col >> IM_COL32_G_SHIFT), (unsigned char)(v.col >> IM_COL32_B_SHIFT), (unsigned char)(v.col >> IM_COL32_A_SHIFT));
+        rlTexCoord2f(v.uv.x, v.uv.y);
+        rlVertex2f(v.pos.x, v.pos.y);
+    }
+    rlEnd();
+}
+
+// rlgl Render function
+void ImGui_ImplRlgl_RenderDrawData(ImDrawData* draw_data)
+{
+    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    if (fb_width <= 0 || fb_height <= 0)
+        return;
+
+    ImGui_ImplRlgl_Data* bd = ImGui_ImplRlgl_GetBackendData();
+
+    // Draw pending raylib shapes/textures first, keeps draw order and leaves rlgl render batch empty
+    rlDrawRenderBatchActive();
+
+    // Catch up with texture updates. Most of the times, the list will have 1 element with an OK status, aka nothing to do.
+    // (This almost always points to ImGui::GetPlatformIO().Textures[] but is part of ImDrawData to allow overriding or disabling texture updates).
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                ImGui_ImplRlgl_UpdateTexture(tex);
+
+    if (bd->UseRenderBatch)
+    {
+        rlMatrixMode(RL_PROJECTION);
+        rlPushMatrix();
+        rlMatrixMode(RL_MODELVIEW);
+        rlPushMatrix();
+    }
+    else
+    {
+        // Grow vertex/index buffers if required, buffers are recreated with some margin to avoid frequent reallocations
+        if (bd->VboId == 0 || draw_data->TotalVtxCount > bd->VertexBufferSize || draw_data->TotalIdxCount > bd->IndexBufferSize)
+        {
+            ImGui_ImplRlgl_DestroyBuffers(bd);
+            if (draw_data->TotalVtxCount > bd->VertexBufferSize) bd->VertexBufferSize = draw_data->TotalVtxCount + 5000;
+            if (draw_data->TotalIdxCount > bd->IndexBufferSize) bd->IndexBufferSize = draw_data->TotalIdxCount + 10000;
+            if (!ImGui_ImplRlgl_CreateBuffers(bd))
+                return;
+        }
+    }
+
+    ImGui_ImplRlgl_SetupRenderState(draw_data);
+
+    // Upload all draw lists vertex/index data into a single buffer pair
+    // NOTE: Uploaded after vertex array binding, index buffer updates bind to ImGui vertex array (not rlgl render batch one)
+    if (!bd->UseRenderBatch)
+    {
+        int vtx_dst = 0;
+        int idx_dst = 0;
+        for (const ImDrawList* draw_list : draw_data->CmdLists)
+        {
+            rlUpdateVertexBuffer(bd->VboId, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size * (int)sizeof(ImDrawVert), vtx_dst * (int)sizeof(ImDrawVert));
+            rlUpdateVertexBufferElements(bd->EboId, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx), idx_dst * (int)sizeof(ImDrawIdx));
+            vtx_dst += draw_list->VtxBuffer.Size;
+            idx_dst += draw_list->IdxBuffer.Size;
+        }
+    }
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Render command lists
+    int global_vtx_offset = 0;
+    int global_idx_offset = 0;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                    ImGui_ImplRlgl_SetupRenderState(draw_data);
+                else
+                    pcmd->UserCallback(draw_list, pcmd);
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+
+            // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
+            // NOTE: Render batch must be drawn before scissor changes, only done when clipping rectangle changes
+            int scissor[4] = { (int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y) };
+            if (memcmp(scissor, bd->LastScissor, sizeof(scissor)) != 0)
+            {
+                if (bd->UseRenderBatch)
+                    rlDrawRenderBatchActive();
+                rlScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+                memcpy(bd->LastScissor, scissor, sizeof(scissor));
+            }
+
+            if (bd->UseRenderBatch)
+            {
+                ImGui_ImplRlgl_RenderDrawCmdBatch(draw_list, pcmd);
+                continue;
+            }
+
+            // Vertex offset applied through attributes base offset (no base vertex draw support in rlgl)
+            int vtx_offset = global_vtx_offset + (int)pcmd->VtxOffset;
+            if (vtx_offset != bd->LastVtxOffset)
+                ImGui_ImplRlgl_SetupVertexAttributes(bd, vtx_offset);
+
+            // Bind texture, Draw
+            rlEnableTexture((unsigned int)(intptr_t)pcmd->GetTexID());
+            rlDrawVertexArrayElements(global_idx_offset + (int)pcmd->IdxOffset, (int)pcmd->ElemCount, 0);
+        }
+        global_idx_offset += draw_list->IdxBuffer.Size;
+        global_vtx_offset += draw_list->VtxBuffer.Size;
+    }
+
+    // Leave raylib default state, rlgl render batch binds its own shader, textures and buffers on next draw
+    if (bd->UseRenderBatch)
+    {
+        rlDrawRenderBatchActive();
+        rlMatrixMode(RL_PROJECTION);
+        rlPopMatrix();
+        rlMatrixMode(RL_MODELVIEW);
+        rlPopMatrix();
+    }
+    else
+        rlDisableVertexArray();
+    rlDisableScissorTest();
+    rlEnableBackfaceCulling();
+}
+
+static void ImGui_ImplRlgl_DestroyTexture(ImTextureData* tex)
+{
+    rlUnloadTexture((unsigned int)(intptr_t)tex->TexID);
+
+    // Clear identifiers and mark as destroyed (in order to allow e.g. calling InvalidateDeviceObjects while running)
+    tex->SetTexID(ImTextureID_Invalid);
+    tex->SetStatus(ImTextureStatus_Destroyed);
+}
+
+// Create and upload texture to graphics system
+// (Bilinear sampling is required by default. Set 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines' or 'style.AntiAliasedLinesUseTex = false' to allow point/nearest sampling)
+static void ImGui_ImplRlgl_CreateTexture(ImTextureData* tex)
+{
+    IM_ASSERT(tex->Format == ImTextureFormat_RGBA32);
+    unsigned int id = rlLoadTexture(tex->GetPixels(), tex->Width, tex->Height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    rlTextureParameters(id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+    rlTextureParameters(id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+    rlTextureParameters(id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
+    rlTextureParameters(id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
+
+    // Store identifiers
+    tex->SetTexID((ImTextureID)(intptr_t)id);
+    tex->SetStatus(ImTextureStatus_OK);
+}
+
+void ImGui_ImplRlgl_UpdateTexture(ImTextureData* tex)
+{
+    if (tex->Status == ImTextureStatus_WantCreate)
+    {
+        IM_ASSERT(tex->TexID == ImTextureID_Invalid && tex->BackendUserData == nullptr);
+        ImGui_ImplRlgl_CreateTexture(tex);
+    }
+    else if (tex->Status == ImTextureStatus_WantUpdates && rlGetVersion() == RL_OPENGL_11_SOFTWARE)
+    {
+        // Software renderer does not support texture regions updates, texture is uploaded again
+        // NOTE: Draw commands get texture id from texture data when rendering, new id is used by current frame
+        rlUnloadTexture((unsigned int)(intptr_t)tex->TexID);
+        ImGui_ImplRlgl_CreateTexture(tex);
+    }
+    else if (tex->Status == ImTextureStatus_WantUpdates)
+    {
+        // Update selected blocks. We only ever write to textures regions which have never been used before!
+        // NOTE: rlUpdateTexture() expects tightly packed data, rows are copied to a contiguous buffer
+        ImGui_ImplRlgl_Data* bd = ImGui_ImplRlgl_GetBackendData();
+        unsigned int id = (unsigned int)(intptr_t)tex->TexID;
+        for (ImTextureRect& r : tex->Updates)
+        {
+            const int src_pitch = r.w * tex->BytesPerPixel;
+            bd->TempBuffer.resize(r.h * src_pitch);
+            char* out_p = bd->TempBuffer.Data;
+            for (int y = 0; y < r.h; y++, out_p += src_pitch)
+                memcpy(out_p, tex->GetPixelsAt(r.x, r.y + y), src_pitch);
+            IM_ASSERT(out_p == bd->TempBuffer.end());
+            rlUpdateTexture(id, r.x, r.y, r.w, r.h, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, bd->TempBuffer.Data);
+        }
+        tex->SetStatus(ImTextureStatus_OK);
+    }
+    else if (tex->Status == ImTextureStatus_WantDestroy && tex->UnusedFrames > 0)
+        ImGui_ImplRlgl_DestroyTexture(tex);
+}
+
+// Dynamic vertex/index buffers, filled on every frame
+// NOTE: Index buffer is bound while vertex array is bound, binding is stored in vertex array
+static bool ImGui_ImplRlgl_CreateBuffers(ImGui_ImplRlgl_Data* bd)
+{
+    const int* locs = rlGetShaderLocsDefault();
+    bd->VaoId = rlLoadVertexArray();
+    bool use_vao = rlEnableVertexArray(bd->VaoId);
+    bd->VboId = rlLoadVertexBuffer(nullptr, bd->VertexBufferSize * (int)sizeof(ImDrawVert), true);
+    bd->EboId = rlLoadVertexBufferElement(nullptr, bd->IndexBufferSize * (int)sizeof(ImDrawIdx), true);
+    if (use_vao)
+    {
+        rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+        rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+        rlEnableVertexAttribute(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+        rlDisableVertexArray();
+    }
+    bd->LastVtxOffset = -1;
+
+    return bd->VboId != 0 && bd->EboId != 0;
+}
+
+static void ImGui_ImplRlgl_DestroyBuffers(ImGui_ImplRlgl_Data* bd)
+{
+    if (bd->VaoId) { rlUnloadVertexArray(bd->VaoId); bd->VaoId = 0; }
+    if (bd->VboId) { rlUnloadVertexBuffer(bd->VboId); bd->VboId = 0; }
+    if (bd->EboId) { rlUnloadVertexBuffer(bd->EboId); bd->EboId = 0; }
+}
+
+bool ImGui_ImplRlgl_CreateDeviceObjects()
+{
+    ImGui_ImplRlgl_Data* bd = ImGui_ImplRlgl_GetBackendData();
+    if (bd->UseRenderBatch)
+        return true;
+
+    return ImGui_ImplRlgl_CreateBuffers(bd);
+}
+
+void ImGui_ImplRlgl_DestroyDeviceObjects()
+{
+    ImGui_ImplRlgl_Data* bd = ImGui_ImplRlgl_GetBackendData();
+    ImGui_ImplRlgl_DestroyBuffers(bd);
+
+    // Destroy all textures
+    for (ImTextureData* tex : ImGui::GetPlatformIO().Textures)
+        if (tex->RefCount == 1)
+            ImGui_ImplRlgl_DestroyTexture(tex);
+}
+
+//-----------------------------------------------------------------------------
+// Idle rendering
+//-----------------------------------------------------------------------------
+
+// Check if draw data differs from the one checked on previous call
+// Draw lists are hashed: vertices, indices and commands, textures referenced by id (user textures) or by data (font atlas)
+bool ImGui_ImplRlgl_IsDrawDataChanged(ImDrawData* draw_data)
+{
+    ImGui_ImplRlgl_Data* bd = ImGui_ImplRlgl_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplRlgl_Init()?");
+
+    // Pending texture requests must always be processed by ImGui_ImplRlgl_RenderDrawData()
+    bool texturesChanged = false;
+    if (draw_data->Textures != nullptr)
+        for (ImTextureData* tex : *draw_data->Textures)
+            if (tex->Status != ImTextureStatus_OK)
+                texturesChanged = true;
+
+    ImGuiID hash = ImHashData(&draw_data->DisplayPos, sizeof(ImVec2));
+    hash = ImHashData(&draw_data->DisplaySize, sizeof(ImVec2), hash);
+    hash = ImHashData(&draw_data->FramebufferScale, sizeof(ImVec2), hash);
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), hash);
+        hash = ImHashData(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            // NOTE: Texture reference fields hashed directly, GetTexID() asserts on textures not yet uploaded
+            hash = ImHashData(&cmd.ClipRect, sizeof(ImVec4), hash);
+            hash = ImHashData(&cmd.TexRef._TexData, sizeof(ImTextureData*), hash);
+            hash = ImHashData(&cmd.TexRef._TexID, sizeof(ImTextureID), hash);
+            hash = ImHashData(&cmd.VtxOffset, sizeof(unsigned int), hash);
+            hash = ImHashData(&cmd.IdxOffset, sizeof(unsigned int), hash);
+            hash = ImHashData(&cmd.ElemCount, sizeof(unsigned int), hash);
+            hash = ImHashData(&cmd.UserCallback, sizeof(ImDrawCallback), hash);
+        }
+    }
+
+    bool changed = texturesChanged || (hash != bd->LastDrawDataHash);
+    bd->LastDrawDataHash = hash;
+    return changed;
+}
+
+//-----------------------------------------------------------------------------
+// raylib fonts sharing
+//-----------------------------------------------------------------------------
+// ImGui font source FontData is a copy of rl_Font struct (owned by ImGui atlas), glyphs and atlas are owned by raylib.
+// Glyphs metrics and images are provided at font base size, scaled to ImGui baked font size.
+
+static bool ImGui_ImplRlgl_FontSrcContainsGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImWchar codepoint)
+{
+    IM_UNUSED(atlas);
+    const rl_Font& font = *(const rl_Font*)src->FontData;
+    return font.glyphs[rl_GetGlyphIndex(font, (int)codepoint)].value == (int)codepoint;
+}
+
+static bool ImGui_ImplRlgl_FontBakedInit(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*)
+{
+    IM_UNUSED(atlas);
+
+    // raylib glyphs offsets are relative to line top, line height is font size
+    if (src->MergeMode == false)
+    {
+        baked->Ascent = baked->Size;
+        baked->Descent = 0.0f;
+    }
+    return true;
+}
+
+static bool ImGui_ImplRlgl_FontBakedLoadGlyph(ImFontAtlas* atlas, ImFontConfig* src, ImFontBaked* baked, void*, ImWchar codepoint, ImFontGlyph* out_glyph, float* out_advance_x)
+{
+    // NOTE: raylib returns '?' glyph for missing codepoints, rejected to let ImGui use next source or its fallback glyph
+    // NOTE: Dynamic fonts rasterize glyph into raylib cache on lookup, glyph image is valid until evicted
+    const rl_Font& font = *(const rl_Font*)src->FontData;
+    const int index = rl_GetGlyphIndex(font, (int)codepoint);
+    const rl_GlyphInfo& glyph = font.glyphs[index];
+    if (glyph.value != (int)codepoint)
+        return false;
+
+    const float scale = baked->Size / (float)font.baseSize;
+    const float advance_x = ((glyph.advanceX != 0) ? (float)glyph.advanceX : font.recs[index].width) * scale;
+
+    // Load metrics only mode
+    if (out_advance_x != nullptr)
+    {
+        IM_ASSERT(out_glyph == nullptr);
+        *out_advance_x = advance_x;
+        return true;
+    }
+
+    // Prepare glyph
+    out_glyph->Codepoint = codepoint;
+    out_glyph->AdvanceX = advance_x;
+
+    // Glyph coverage from glyph image alpha, any pixel format (single channel fonts store coverage as gray value)
+    const rl_Image& image = glyph.image;
+    rl_Color* colors = (image.data != nullptr && image.width > 0 && image.height > 0) ? rl_LoadImageColors(image) : nullptr;
+    if (colors == nullptr)
+        return true;
+
+    const int w = image.width;
+    const int h = image.height;
+    ImFontAtlasBuilder* builder = atlas->Builder;
+    builder->TempBuffer.resize(w * h);
+    unsigned char* bitmap_pixels = builder->TempBuffer.Data;
+    bool is_visible = false;
+    for (int i = 0; i < w * h; i++)
+    {
+        bitmap_pixels[i] = (image.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ? colors[i].r : colors[i].a;
+        is_visible |= (bitmap_pixels[i] != 0);
+    }
+    rl_UnloadImageColors(colors);
+    if (!is_visible)
+        return true;
+
+    // Pack and retrieve position inside texture atlas
+    ImFontAtlasRectId pack_id = ImFontAtlasPackAddRect(atlas, w, h);
+    if (pack_id == ImFontAtlasRectId_Invalid)
+    {
+        // Pathological out of memory case (TexMaxWidth/TexMaxHeight set too small?)
+        IM_ASSERT(pack_id != ImFontAtlasRectId_Invalid && "Out of texture memory.");
+        return false;
+    }
+    ImTextureRect* r = ImFontAtlasPackGetRect(atlas, pack_id);
+
+    // Register glyph, bitmap at font base size is scaled to baked size
+    const float ref_size = baked->OwnerFont->Sources[0]->SizePixels;
+    const float offsets_scale = (ref_size != 0.0f) ? (baked->Size / ref_size) : 1.0f;
+    const float font_off_x = ImFloor(src->GlyphOffset.x * offsets_scale + 0.5f);
+    const float font_off_y = ImFloor(src->GlyphOffset.y * offsets_scale + 0.5f);
+    out_glyph->X0 = glyph.offsetX * scale + font_off_x;
+    out_glyph->Y0 = glyph.offsetY * scale + font_off_y;
+    out_glyph->X1 = out_glyph->X0 + w * scale;
+    out_glyph->Y1 = out_glyph->Y0 + h * scale;
+    out_glyph->Visible = true;
+    out_glyph->PackId = pack_id;
+    ImFontAtlasBakedSetFontGlyphBitmap(atlas, baked, src, out_glyph, r, bitmap_pixels, ImTextureFormat_Alpha8, w);
+
+    return true;
+}
+
+ImFont* ImGui_ImplRlgl_AddFont(const rl_Font* font, const ImFontConfig* font_cfg_template)
+{
+    IM_ASSERT(font != nullptr && rl_IsFontValid(*font) && "Invalid raylib font!");
+    IM_ASSERT(font->type != FONT_SDF && font->type != FONT_MSDF && "Distance field raylib fonts are not supported!");
+
+    static ImFontLoader loader;
+    loader.Name = "raylib";
+    loader.FontSrcContainsGlyph = ImGui_ImplRlgl_FontSrcContainsGlyph;
+    loader.FontBakedInit = ImGui_ImplRlgl_FontBakedInit;
+    loader.FontBakedLoadGlyph = ImGui_ImplRlgl_FontBakedLoadGlyph;
+
+    ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
+    IM_ASSERT(font_cfg.FontData == nullptr && "Font data is provided by raylib font!");
+    font_cfg.FontData = IM_ALLOC(sizeof(rl_Font));
+    font_cfg.FontDataSize = (int)sizeof(rl_Font);
+    font_cfg.FontDataOwnedByAtlas = true;
+    memcpy(font_cfg.FontData, font, sizeof(rl_Font));
+    font_cfg.FontLoader = &loader;
+    if (font_cfg.SizePixels <= 0.0f)
+        font_cfg.SizePixels = (float)font->baseSize;
+    if (font_cfg.Name[0] == '\0')
+        ImFormatString(font_cfg.Name, IM_COUNTOF(font_cfg.Name), "raylib font, %dpx", font->baseSize);
+
+    return ImGui::GetIO().Fonts->AddFont(&font_cfg);
+}
+
+// Draw text with raylib font atlas texture, same glyphs layout as rl_DrawTextEx() with no spacing
+void ImGui_ImplRlgl_AddText(ImDrawList* draw_list, const rl_Font* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end)
+{
+    if ((col & IM_COL32_A_MASK) == 0 || font->texture.id == 0)
+        return;
+    if (text_end == nullptr)
+        text_end = text_begin + strlen(text_begin);
+
+    const float scale = font_size / (float)font->baseSize;
+    const float padding = (float)font->glyphPadding;
+    const ImVec2 tex_scale(1.0f / (float)font->texture.width, 1.0f / (float)font->texture.height);
+    ImVec2 cursor = pos;
+
+    draw_list->PushTexture(ImTextureRef((ImTextureID)(intptr_t)font->texture.id));
+    for (const char* s = text_begin; s < text_end; )
+    {
+        unsigned int c;
+        s += ImTextCharFromUtf8(&c, s, text_end);
+        if (c == '\n')
+        {
+            cursor = ImVec2(pos.x, cursor.y + font_size);
+            continue;
+        }
+
+        const int index = rl_GetGlyphIndex(*font, (int)c);
+        const rl_GlyphInfo& glyph = font->glyphs[index];
+        const rl_Rectangle& rec = font->recs[index];
+        if (c != ' ' && c != '\t' && rec.width > 0.0f && rec.height > 0.0f)
+        {
+            ImVec2 p_min(cursor.x + (glyph.offsetX - padding) * scale, cursor.y + (glyph.offsetY - padding) * scale);
+            ImVec2 p_max(p_min.x + (rec.width + 2.0f * padding) * scale, p_min.y + (rec.height + 2.0f * padding) * scale);
+            ImVec2 uv_min((rec.x - padding) * tex_scale.x, (rec.y - padding) * tex_scale.y);
+            ImVec2 uv_max((rec.x + rec.width + padding) * tex_scale.x, (rec.y + rec.height + padding) * tex_scale.y);
+            draw_list->PrimReserve(6, 4);
+            draw_list->PrimRectUV(p_min, p_max, uv_min, uv_max, col);
+        }
+        cursor.x += ((glyph.advanceX != 0) ? (float)glyph.advanceX : rec.width) * scale;
+    }
+    draw_list->PopTexture();
+}
+
+//-----------------------------------------------------------------------------
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,81 @@
+// dear imgui: Renderer Backend for raylib rlgl
+// - Desktop GL: 3.3 4.3
+// - Embedded GL: ES 2.0 (WebGL 1.0), ES 3.0 (WebGL 2.0)
+// - Legacy GL 1.1 and software renderer, drawn through rlgl internal render batch
+// This needs to be used along with a Platform Backend (e.g. raylib)
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use rlgl texture id (rl_Texture2D.id) as texture identifier. Read the FAQ about ImTextureID/ImTextureRef!
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Texture updates support for dynamic font atlas (ImGuiBackendFlags_RendererHasTextures).
+//  [X] Renderer: Idle frames detection, rendering and buffers swap skipped when draw data is unchanged (ImGui_ImplRlgl_IsDrawDataChanged()).
+//  [X] Renderer: raylib fonts sharing, glyphs taken from rl_Font instead of rasterized again (ImGui_ImplRlgl_AddFont(), ImGui_ImplRlgl_AddText()).
+// Missing features or Issues:
+//  [ ] Renderer: Multi-viewport support.
+
+// About rlgl state:
+// - No GL calls are issued directly, rlgl state cache elides redundant binds (program, vao, textures, capabilities, scissor).
+// - GL state is not saved/restored: rlgl internal render batch is flushed before drawing and raylib default
+//   state is left on return (alpha blending, no depth test, backface culling, no scissor test).
+// - Vertex and index buffers are uploaded into one rlgl-managed dynamic buffer pair, grown on demand.
+// - Drawn with rlgl default shader, ImDrawIdx must be 16-bit (default), as required by rlDrawVertexArrayElements().
+
+// About raylib fonts and textures:
+// - Any raylib texture can be drawn by ImGui, e.g. ImGui::Image((ImTextureID)(intptr_t)texture.id, size).
+// - ImGui_ImplRlgl_AddFont() adds a raylib font as ImGui font: glyphs bitmaps are copied from rl_Font glyphs images on first use,
+//   no TTF data is parsed or rasterized by ImGui. Dynamic fonts (rl_LoadFontDynamic()) are supported, glyphs are rasterized by raylib cache.
+//   Glyphs are scaled from font base size, use the font at its base size for crisp text. SDF/MSDF fonts are not supported.
+// - ImGui_ImplRlgl_AddText() draws text straight from rl_Font atlas texture, nothing is copied into ImGui font atlas.
+//   Dynamic fonts atlas must hold all glyphs drawn in a frame, glyphs evicted before ImGui renders would be overwritten.
+// - rl_Font data must stay loaded while used by ImGui.
+
+// About idle rendering:
+// - ImGui_ImplRlgl_IsDrawDataChanged() hashes draw data and returns false when it matches previous call (same vertices, commands and textures).
+// - Unchanged frames can skip drawing and keep previous screen with rl_SkipScreenBufferSwap(), pair it with raylib events waiting
+//   so idle frames block on input instead of spinning:
+//       ImGui::Render();
+//       bool changed = ImGui_ImplRlgl_IsDrawDataChanged(ImGui::GetDrawData()) || myAppDirty;
+//       rl_BeginDrawing();
+//       if (changed) { rl_ClearBackground(bg); ImGui_ImplRlgl_RenderDrawData(ImGui::GetDrawData()); }
+//       else rl_SkipScreenBufferSwap();
+//       rl_EndDrawing();
+//       if (changed) rl_DisableEventWaiting(); else rl_EnableEventWaiting();
+// - ImGui needs a few frames to settle after an input (hover, animations), events waiting is only enabled once draw data stops changing.
+// - Set a timeout with rl_SetEventWaitingTimeout() (e.g. 0.5 seconds) to let time based content update while idle (text cursor blinking, tooltips delays).
+// - Anything drawn by the application out of ImGui must be tracked by the application (myAppDirty above).
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+// NOTE: rlgl must be initialized (rl_InitWindow()) before calling ImGui_ImplRlgl_Init()
+IMGUI_IMPL_API bool     ImGui_ImplRlgl_Init();
+IMGUI_IMPL_API void     ImGui_ImplRlgl_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplRlgl_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplRlgl_RenderDrawData(ImDrawData* draw_data);
+
+// (Optional) Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplRlgl_CreateDeviceObjects();
+IMGUI_IMPL_API void     ImGui_ImplRlgl_DestroyDeviceObjects();
+
+// (Advanced) Use e.g. if you need to precisely control the timing of texture updates (e.g. for staged rendering), by setting ImDrawData::Textures = nullptr to handle this manually.
+IMGUI_IMPL_API void     ImGui_ImplRlgl_UpdateTexture(ImTextureData* tex);
+
+// (Optional) Check if draw data changed since previous call, see "About idle rendering" above
+IMGUI_IMPL_API bool     ImGui_ImplRlgl_IsDrawDataChanged(ImDrawData* draw_data);
+
+// (Optional) Share raylib fonts with ImGui, see "About raylib fonts and textures" above
+struct rl_Font;
+IMGUI_IMPL_API ImFont*  ImGui_ImplRlgl_AddFont(const rl_Font* font, const ImFontConfig* font_cfg = nullptr);
+IMGUI_IMPL_API void     ImGui_ImplRlgl_AddText(ImDrawList* draw_list, const rl_Font* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = nullptr);
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,250 @@
+// dear imgui: raylib live profiler overlay
+// (code)
+
+// CHANGELOG
+//  2026-10-15: Initial version, frame times, GPU passes, render, memory and audio stats.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_raylib_profiler.h"
+#include <stdio.h>      // snprintf()
+
+// raylib
+#include "raylib.h"     // Required for: rl_GetFrameTime(), rl_GetFramePacingStats(), rl_GetMemoryStats(), audio stats
+#include "rlgl.h"       // Required for: rlGetRenderStats(), rlGetProfilerPass()
+
+#ifndef IMGUI_DISABLE_DEBUG_TOOLS
+
+#define IMGUI_RAYLIB_PROFILER_HISTORY   240     // Frames kept on history graphs
+#define IMGUI_RAYLIB_MEMORY_MODULES     (MEMORY_MODULE_UTILS + 1)
+
+// Profiler data, stats sampled on last ImGuiRaylib::UpdateProfiler() call
+struct ImGuiRaylibProfilerData
+{
+    float                   FrameTimes[IMGUI_RAYLIB_PROFILER_HISTORY];  // Frame times (in milliseconds)
+    float                   GpuTimes[IMGUI_RAYLIB_PROFILER_HISTORY];    // GPU frame times (in milliseconds), 0.0f if not measured
+    float                   AudioLoads[IMGUI_RAYLIB_PROFILER_HISTORY];  // Audio callback time relative to mixed audio duration
+    int                     HistoryOffset;                              // Next history slot, oldest value when history is full
+    bool                    HasGpuTimes;
+    rl_FramePacingStats     FramePacing;
+    rlRenderStats           RenderStats;
+    int                     PassCount;
+    rlProfilerPass          Passes[RL_MAX_PROFILER_PASSES];
+    rl_MemoryStats          Memory[IMGUI_RAYLIB_MEMORY_MODULES];
+    rl_MemoryStats          MemoryTotal;
+    rl_TextureStreamStats   TextureStreams;
+    bool                    AudioReady;
+    rl_AudioProfileStats    AudioProfile;
+    rl_AudioVoiceStats      AudioVoices;
+
+    ImGuiRaylibProfilerData() { memset((void*)this, 0, sizeof(*this)); }
+};
+
+static ImGuiRaylibProfilerData GImGuiRaylibProfiler;
+
+static const char* const ImGuiRaylib_FlushReasonNames[] = { "Explicit", "Buffer limit", "Draw calls limit", "Texture", "Shader", "Blend mode", "Render mode" };
+static const char* const ImGuiRaylib_MemoryModuleNames[] = { "User", "Core", "Shapes", "Textures", "Text", "Models", "Audio", "Utils" };
+static_assert(IM_COUNTOF(ImGuiRaylib_FlushReasonNames) == RL_BATCH_FLUSH_REASON_COUNT, "rlBatchFlushReason names mismatch");
+static_assert(IM_COUNTOF(ImGuiRaylib_MemoryModuleNames) == IMGUI_RAYLIB_MEMORY_MODULES, "rl_MemoryModule names mismatch");
+
+static const char* ImGuiRaylib_FormatBytes(char* buf, size_t buf_size, long long bytes)
+{
+    if (bytes >= 1024 * 1024)
+        snprintf(buf, buf_size, "%.2f MB", (double)bytes / (1024.0 * 1024.0));
+    else if (bytes >= 1024)
+        snprintf(buf, buf_size, "%.1f KB", (double)bytes / 1024.0);
+    else
+        snprintf(buf, buf_size, "%lld B", bytes);
+    return buf;
+}
+
+// History graph scaled to its maximum value, at least min_scale_max
+static void ImGuiRaylib_PlotHistory(const char* label, const float* values, float min_scale_max, const char* overlay_fmt)
+{
+    ImGuiRaylibProfilerData& pd = GImGuiRaylibProfiler;
+    float scale_max = min_scale_max;
+    for (int i = 0; i < IMGUI_RAYLIB_PROFILER_HISTORY; i++)
+        scale_max = (values[i] > scale_max) ? values[i] : scale_max;
+
+    const int last = (pd.HistoryOffset + IMGUI_RAYLIB_PROFILER_HISTORY - 1) % IMGUI_RAYLIB_PROFILER_HISTORY;
+    char overlay[64];
+    snprintf(overlay, sizeof(overlay), overlay_fmt, values[last], scale_max);
+    ImGui::PlotLines(label, values, IMGUI_RAYLIB_PROFILER_HISTORY, pd.HistoryOffset, overlay, 0.0f, scale_max, ImVec2(-FLT_MIN, ImGui::GetTextLineHeight() * 4.0f));
+}
+
+void ImGuiRaylib::UpdateProfiler()
+{
+    ImGuiRaylibProfilerData& pd = GImGuiRaylibProfiler;
+
+    pd.FramePacing = rl_GetFramePacingStats();
+    pd.RenderStats = rlGetRenderStats();
+    pd.PassCount = rlGetProfilerPassCount();
+    if (pd.PassCount > RL_MAX_PROFILER_PASSES)
+        pd.PassCount = RL_MAX_PROFILER_PASSES;
+    for (int i = 0; i < pd.PassCount; i++)
+        pd.Passes[i] = rlGetProfilerPass(i);
+    for (int module = 0; module < IMGUI_RAYLIB_MEMORY_MODULES; module++)
+        pd.Memory[module] = rl_GetMemoryStats(module, -1);
+    pd.MemoryTotal = rl_GetMemoryStats(-1, -1);
+    pd.TextureStreams = rl_GetTextureStreamStats();
+    pd.AudioReady = rl_IsAudioDeviceReady();
+    if (pd.AudioReady)
+    {
+        pd.AudioProfile = rl_GetAudioProfileStats();
+        pd.AudioVoices = rl_GetAudioVoiceStats();
+    }
+
+    // GPU frame time is measured by frame pass (index 0), results are some frames behind
+    const float gpu_time = (pd.PassCount > 0) ? pd.Passes[0].gpuTime : 0.0f;
+    pd.HasGpuTimes |= (gpu_time > 0.0f);
+    pd.FrameTimes[pd.HistoryOffset] = rl_GetFrameTime() * 1000.0f;
+    pd.GpuTimes[pd.HistoryOffset] = gpu_time;
+    pd.AudioLoads[pd.HistoryOffset] = pd.AudioReady ? pd.AudioProfile.load : 0.0f;
+    pd.HistoryOffset = (pd.HistoryOffset + 1) % IMGUI_RAYLIB_PROFILER_HISTORY;
+}
+
+void ImGuiRaylib::ResetProfiler()
+{
+    GImGuiRaylibProfiler = ImGuiRaylibProfilerData();
+    rl_ResetFramePacingStats();
+    if (rl_IsAudioDeviceReady())
+        rl_ResetAudioProfileStats();
+}
+
+void ImGuiRaylib::ShowProfilerWindow(bool* p_open)
+{
+    ImGuiRaylibProfilerData& pd = GImGuiRaylibProfiler;
+    char buf[2][32];
+
+    ImGui::SetNextWindowSize(ImVec2(420.0f, 600.0f), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin("raylib Profiler", p_open))
+    {
+        ImGui::End();
+        return;
+    }
+
+    const ImGuiTableFlags table_flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp;
+
+    // Frame times
+    if (ImGui::CollapsingHeader("Frame", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        const rl_FramePacingStats& fp = pd.FramePacing;
+        ImGuiRaylib_PlotHistory("##cpu", pd.FrameTimes, 1000.0f / 60.0f, "CPU %.2f ms (max %.2f ms)");
+        if (pd.HasGpuTimes)
+            ImGuiRaylib_PlotHistory("##gpu", pd.GpuTimes, 1000.0f / 60.0f, "GPU %.2f ms (max %.2f ms)");
+        else
+            ImGui::TextDisabled("GPU frame time not measured (RLGL_ENABLE_GPU_PROFILER)");
+        ImGui::Text("Average: %.2f ms (%.0f FPS), min %.2f ms, max %.2f ms", fp.frameTimeAverage, (fp.frameTimeAverage > 0.0f) ? 1000.0f / fp.frameTimeAverage : 0.0f, fp.frameTimeMin, fp.frameTimeMax);
+        ImGui::Text("Jitter: %.2f ms, missed frames: %u / %u", fp.frameJitter, fp.missedFrames, fp.frameCount);
+        ImGui::Text("Sleep overshoot: %.2f ms, spin: %.2f ms", fp.sleepOvershoot, fp.spinTime);
+    }
+
+    // GPU profiler passes, nested passes indented
+    if (pd.PassCount > 0 && ImGui::CollapsingHeader("GPU Passes", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        if (ImGui::BeginTable("passes", 5, table_flags))
+        {
+            ImGui::TableSetupColumn("Pass", ImGuiTableColumnFlags_WidthStretch, 3.0f);
+            ImGui::TableSetupColumn("GPU ms");
+            ImGui::TableSetupColumn("Draws");
+            ImGui::TableSetupColumn("Vertices");
+            ImGui::TableSetupColumn("Flushes");
+            ImGui::TableHeadersRow();
+            for (int i = 0; i < pd.PassCount; i++)
+            {
+                const rlProfilerPass& pass = pd.Passes[i];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%*s%s", pass.depth * 2, "", pass.name);
+                ImGui::TableNextColumn(); ImGui::Text("%.3f", pass.gpuTime);
+                ImGui::TableNextColumn(); ImGui::Text("%d", pass.drawCalls);
+                ImGui::TableNextColumn(); ImGui::Text("%d", pass.vertices);
+                ImGui::TableNextColumn(); ImGui::Text("%d", pass.batchFlushes);
+            }
+            ImGui::EndTable();
+        }
+    }
+
+    // Render stats
+    if (ImGui::CollapsingHeader("Render", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        const rlRenderStats& rs = pd.RenderStats;
+        ImGui::Text("Draw calls: %d, vertices: %d", rs.drawCalls, rs.vertices);
+        ImGui::Text("State changes: %d textures, %d shaders, %d blend modes", rs.textureChanges, rs.shaderChanges, rs.blendModeChanges);
+        ImGui::Text("Culled meshes: %d, LOD saved triangles: %d", rs.culledMeshes, rs.lodSavedTriangles);
+        ImGui::Text("Render batch flushes: %d", rs.batchFlushes);
+        if (ImGui::BeginTable("flushes", 2, table_flags))
+        {
+            for (int reason = 0; reason < RL_BATCH_FLUSH_REASON_COUNT; reason++)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::TextUnformatted(ImGuiRaylib_FlushReasonNames[reason]);
+                ImGui::TableNextColumn(); ImGui::Text("%d", rs.flushReasons[reason]);
+            }
+            ImGui::EndTable();
+        }
+    }
+
+    // Memory stats, textures and meshes data are tracked by their module
+    if (ImGui::CollapsingHeader("Memory", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        if (pd.MemoryTotal.totalCount == 0)
+            ImGui::TextDisabled("Allocations not tracked (SUPPORT_MEMORY_TRACKING)");
+        else if (ImGui::BeginTable("memory", 5, table_flags))
+        {
+            ImGui::TableSetupColumn("Module", ImGuiTableColumnFlags_WidthStretch, 2.0f);
+            ImGui::TableSetupColumn("Live");
+            ImGui::TableSetupColumn("Peak");
+            ImGui::TableSetupColumn("Allocs");
+            ImGui::TableSetupColumn("Frame");
+            ImGui::TableHeadersRow();
+            for (int module = 0; module <= IMGUI_RAYLIB_MEMORY_MODULES; module++)
+            {
+                const rl_MemoryStats& ms = (module < IMGUI_RAYLIB_MEMORY_MODULES) ? pd.Memory[module] : pd.MemoryTotal;
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::TextUnformatted((module < IMGUI_RAYLIB_MEMORY_MODULES) ? ImGuiRaylib_MemoryModuleNames[module] : "Total");
+                ImGui::TableNextColumn(); ImGui::TextUnformatted(ImGuiRaylib_FormatBytes(buf[0], sizeof(buf[0]), ms.liveBytes));
+                ImGui::TableNextColumn(); ImGui::TextUnformatted(ImGuiRaylib_FormatBytes(buf[1], sizeof(buf[1]), ms.peakBytes));
+                ImGui::TableNextColumn(); ImGui::Text("%d", ms.liveCount);
+                ImGui::TableNextColumn(); ImGui::Text("%u", ms.frameCount);
+            }
+            ImGui::EndTable();
+        }
+
+        const rl_TextureStreamStats& ts = pd.TextureStreams;
+        if (ts.streamCount > 0)
+        {
+            ImGui::Text("Texture streams: %d, pending uploads: %d", ts.streamCount, ts.pendingUploads);
+            ImGui::Text("Resident: %s / requested: %s", ImGuiRaylib_FormatBytes(buf[0], sizeof(buf[0]), ts.residentBytes), ImGuiRaylib_FormatBytes(buf[1], sizeof(buf[1]), ts.requestedBytes));
+            if (ts.budgetBytes > 0)
+                ImGui::ProgressBar((float)((double)ts.residentBytes / (double)ts.budgetBytes), ImVec2(-FLT_MIN, 0.0f), ImGuiRaylib_FormatBytes(buf[0], sizeof(buf[0]), ts.budgetBytes));
+        }
+    }
+
+    // Audio callback load, >1.0f means audio callback is slower than mixed audio duration
+    if (pd.AudioReady && ImGui::CollapsingHeader("Audio", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        const rl_AudioProfileStats& ap = pd.AudioProfile;
+        const rl_AudioVoiceStats& av = pd.AudioVoices;
+        ImGuiRaylib_PlotHistory("##audio", pd.AudioLoads, 1.0f, "Callback load %.2f (max %.2f)");
+        ImGui::Text("Callback: %.3f ms, average %.3f ms, max %.3f ms", ap.callbackTime, ap.callbackTimeAverage, ap.callbackTimeMax);
+        ImGui::Text("Commands: %.3f ms, converter: %.3f ms", ap.commandTime, ap.converterTime);
+        ImGui::Text("Buffers: %d mixed / %d active", ap.buffersMixed, ap.buffersActive);
+        ImGui::Text("Voices: %d playing, %d real, %d virtual, %u stolen", av.voicesPlaying, av.voicesReal, av.voicesVirtual, av.voicesStolen);
+        ImGui::Text("Overloads: %u, underruns: %u, command waits: %u", ap.overloads, ap.underruns, ap.commandWaits);
+    }
+
+    ImGui::Separator();
+    if (ImGui::Button("Reset"))
+        ResetProfiler();
+    ImGui::End();
+}
+
+#else
+
+void ImGuiRaylib::UpdateProfiler() {}
+void ImGuiRaylib::ShowProfilerWindow(bool*) {}
+void ImGuiRaylib::ResetProfiler() {}
+
+#endif // #ifndef IMGUI_DISABLE_DEBUG_TOOLS
+
+#endif // #ifndef IMGUI_DISABLE
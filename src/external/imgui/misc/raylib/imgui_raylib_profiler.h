@@ -0,0 +1,31 @@
+// dear imgui: raylib live profiler overlay
+// (headers)
+
+#pragma once
+#include "imgui.h"      // IMGUI_API
+#ifndef IMGUI_DISABLE
+
+// Usage:
+// - Call ImGuiRaylib::UpdateProfiler() once per frame, it samples raylib stats into history buffers (cheap, call it even if window is hidden).
+//   Call it before rl_BeginDrawing(): render stats are reset by rl_BeginDrawing(), previous frame complete stats are read.
+// - Call ImGuiRaylib::ShowProfilerWindow() to display the overlay, e.g.:
+//      if (ImGui::IsKeyPressed(ImGuiKey_F10)) show_profiler = !show_profiler;
+//      if (show_profiler) ImGuiRaylib::ShowProfilerWindow(&show_profiler);
+// - Functions are empty when '#define IMGUI_DISABLE_DEBUG_TOOLS' is set (release builds), same as ImGui::ShowMetricsWindow().
+
+// Displayed stats (sections are shown only when raylib provides data):
+// - Frame: frame time and GPU frame time graphs, frame pacing stats (rl_GetFramePacingStats())
+// - GPU passes: GPU time, draw calls and vertices per pass (rlGetProfilerPass(), requires RLGL_ENABLE_GPU_PROFILER)
+// - Render: draw calls, vertices, render batch flushes by reason and state changes (rlGetRenderStats())
+// - Memory: tagged allocations per module, textures and meshes data included (rl_GetMemoryStats(), requires SUPPORT_MEMORY_TRACKING)
+//   and texture streaming GPU memory (rl_GetTextureStreamStats())
+// - Audio: audio callback load graph, voices and callback stats (rl_GetAudioProfileStats(), rl_GetAudioVoiceStats())
+
+namespace ImGuiRaylib
+{
+    IMGUI_API void  UpdateProfiler();                               // Sample raylib stats, once per frame
+    IMGUI_API void  ShowProfilerWindow(bool* p_open = nullptr);     // Show profiler window
+    IMGUI_API void  ResetProfiler();                                // Clear history buffers and reset raylib stats maximums (frame pacing, audio)
+}
+
+#endif // #ifndef IMGUI_DISABLE
@@ -2152,11 +2152,45 @@ static void jar_xm_mixdown(jar_xm_context_t* ctx, float* left, float* right) {
     if(*right < -1.0) {*right = -1.0;} else if(*right > 1.0) {*right = 1.0;};
 };
 
+/* Check if no channel is playing and no volume/panning ramp is pending, mixdown would only output silence */
+static bool jar_xm_is_silent(jar_xm_context_t* ctx) {
+    if(ctx->max_loop_count > 0 && ctx->loop_count > ctx->max_loop_count) return true;
+
+    for(uint8_t i = 0; i < ctx->module.num_channels; ++i) {
+        jar_xm_channel_context_t* ch = ctx->channels + i;
+        if(ch->instrument != NULL && ch->sample != NULL && ch->sample_position >= 0) return false;
+        if(ctx->module.ramping && (ch->actual_volume != ch->target_volume || ch->actual_panning != ch->target_panning)) return false;
+    };
+
+    return true;
+};
+
 void jar_xm_generate_samples(jar_xm_context_t* ctx, float* output, size_t numsamples) {
     if(ctx && output) {
         ctx->generated_samples += numsamples;
-        for(size_t i = 0; i < numsamples; i++) {
-            jar_xm_mixdown(ctx, output + (2 * i), output + (2 * i + 1));
+        size_t i = 0;
+        while(i < numsamples) {
+            if(ctx->remaining_samples_in_tick <= 0) {
+                jar_xm_tick(ctx);
+            };
+
+            /* Samples left on current tick, next tick starts once they are generated */
+            size_t count = (ctx->remaining_samples_in_tick > 0)? (size_t)ceilf(ctx->remaining_samples_in_tick) : 1;
+            if(count > numsamples - i) count = numsamples - i;
+
+            if(jar_xm_is_silent(ctx)) {
+                /* Silent samples are not mixed down, channels only advance ramping frame count */
+                memset(output + (2 * i), 0, 2 * count * sizeof(float));
+                ctx->remaining_samples_in_tick -= (float)count;
+                if(ctx->module.ramping && !(ctx->max_loop_count > 0 && ctx->loop_count > ctx->max_loop_count)) {
+                    for(uint8_t c = 0; c < ctx->module.num_channels; ++c) ctx->channels[c].frame_count += count;
+                };
+                i += count;
+            } else {
+                for(size_t end = i + count; i < end; i++) {
+                    jar_xm_mixdown(ctx, output + (2 * i), output + (2 * i + 1));
+                };
+            };
         };
     };
 };
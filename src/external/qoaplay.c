@@ -33,12 +33,20 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
+// QOA data reading callbacks, seek position is absolute from QOA data beginning
+typedef unsigned int (*qoaplay_read_proc)(void *user_data, void *buffer, unsigned int size);
+typedef int (*qoaplay_seek_proc)(void *user_data, unsigned int position);
+
 // QOA streaming data descriptor
 typedef struct {
     qoa_desc info;                  // QOA descriptor data
 
-    FILE *file;                     // QOA file to read, if NULL, using memory buffer -> file_data
-    unsigned char *file_data;       // QOA file data on memory
+    FILE *file;                     // QOA file to read, if NULL, using read callbacks or memory buffer -> file_data
+    qoaplay_read_proc read;         // QOA data read callback, if NULL, using memory buffer -> file_data
+    qoaplay_seek_proc seek;         // QOA data seek callback
+    void *user_data;                // QOA data read/seek callbacks user data
+
+    const unsigned char *file_data; // QOA file data on memory (not copied, must be kept valid)
     unsigned int file_data_size;    // QOA file data on memory size
     unsigned int file_data_offset;  // QOA file data on memory offset for next read
 
@@ -63,6 +71,7 @@ extern "C" {            // Prevents name mangling of functions
 
 qoaplay_desc *qoaplay_open(const char *path);
 qoaplay_desc *qoaplay_open_memory(const unsigned char *data, int data_size);
+qoaplay_desc *qoaplay_open_callbacks(qoaplay_read_proc read, qoaplay_seek_proc seek, void *user_data);
 void qoaplay_close(qoaplay_desc *qoa_ctx);
 
 void qoaplay_rewind(qoaplay_desc *qoa_ctx);
@@ -125,6 +134,7 @@ qoaplay_desc *qoaplay_open(const char *path)
 }
 
 // Open QOA file from memory, no FILE pointer required
+// NOTE: File data is not copied, it is decoded in place and must be kept valid until closed
 qoaplay_desc *qoaplay_open_memory(const unsigned char *data, int data_size)
 {
     qoa_desc qoa;
@@ -134,16 +144,13 @@ qoaplay_desc *qoaplay_open_memory(const unsigned char *data, int data_size)
 
     // Allocate one chunk of memory for the qoaplay_desc struct
     // + the sample data for one frame
-    // + a buffer to hold one frame of encoded data
     unsigned int sample_data_size = qoa.channels*QOA_FRAME_LEN*sizeof(short)*2;
-    qoaplay_desc *qoa_ctx = (qoaplay_desc *)QOA_MALLOC(sizeof(qoaplay_desc) + sample_data_size + data_size);
+    qoaplay_desc *qoa_ctx = (qoaplay_desc *)QOA_MALLOC(sizeof(qoaplay_desc) + sample_data_size);
     memset(qoa_ctx, 0, sizeof(qoaplay_desc));
 
     qoa_ctx->file = NULL;
 
-    // Keep a copy of file data provided to be managed internally
-    qoa_ctx->file_data = (((unsigned char *)qoa_ctx) + sizeof(qoaplay_desc) + sample_data_size);
-    memcpy(qoa_ctx->file_data, data, data_size);
+    qoa_ctx->file_data = data;
     qoa_ctx->file_data_size = data_size;
     qoa_ctx->file_data_offset = first_frame_pos;
     qoa_ctx->first_frame_pos = first_frame_pos;
@@ -159,6 +166,45 @@ qoaplay_desc *qoaplay_open_memory(const unsigned char *data, int data_size)
     return qoa_ctx;
 }
 
+// Open QOA data from read/seek callbacks, data is read one frame at a time
+// NOTE: Callbacks read from QOA data beginning, seek positions are absolute
+qoaplay_desc *qoaplay_open_callbacks(qoaplay_read_proc read, qoaplay_seek_proc seek, void *user_data)
+{
+    if ((read == NULL) || (seek == NULL)) return NULL;
+
+    // Read and decode the data header
+    unsigned char header[QOA_MIN_FILESIZE];
+    if (!seek(user_data, 0) || (read(user_data, header, QOA_MIN_FILESIZE) != QOA_MIN_FILESIZE)) return NULL;
+
+    qoa_desc qoa;
+    unsigned int first_frame_pos = qoa_decode_header(header, QOA_MIN_FILESIZE, &qoa);
+    if (!first_frame_pos || !seek(user_data, first_frame_pos)) return NULL;
+
+    // Allocate one chunk of memory for the qoaplay_desc struct
+    // + the sample data for one frame
+    // + a buffer to hold one frame of encoded data
+    unsigned int buffer_size = qoa_max_frame_size(&qoa);
+    unsigned int sample_data_size = qoa.channels*QOA_FRAME_LEN*sizeof(short)*2;
+    qoaplay_desc *qoa_ctx = (qoaplay_desc *)QOA_MALLOC(sizeof(qoaplay_desc) + buffer_size + sample_data_size);
+    memset(qoa_ctx, 0, sizeof(qoaplay_desc));
+
+    qoa_ctx->read = read;
+    qoa_ctx->seek = seek;
+    qoa_ctx->user_data = user_data;
+    qoa_ctx->file_data_offset = first_frame_pos;
+    qoa_ctx->first_frame_pos = first_frame_pos;
+
+    // Setup data pointers to previously allocated data
+    qoa_ctx->buffer = ((unsigned char *)qoa_ctx) + sizeof(qoaplay_desc);
+    qoa_ctx->sample_data = (short *)(((unsigned char *)qoa_ctx) + sizeof(qoaplay_desc) + buffer_size);
+
+    qoa_ctx->info.channels = qoa.channels;
+    qoa_ctx->info.samplerate = qoa.samplerate;
+    qoa_ctx->info.samples = qoa.samples;
+
+    return qoa_ctx;
+}
+
 // Close QOA file (if open) and free internal memory
 void qoaplay_close(qoaplay_desc *qoa_ctx)
 {
@@ -172,18 +218,26 @@ void qoaplay_close(qoaplay_desc *qoa_ctx)
 // Decode one frame from QOA data
 unsigned int qoaplay_decode_frame(qoaplay_desc *qoa_ctx)
 {
-    unsigned char *buffer;
+    const unsigned char *buffer;
     unsigned int buffer_len;
 
     if (qoa_ctx->file)
     {
         buffer = qoa_ctx->buffer;
-        buffer_len = fread(buffer, 1, qoa_max_frame_size(&qoa_ctx->info), qoa_ctx->file);
+        buffer_len = fread(qoa_ctx->buffer, 1, qoa_max_frame_size(&qoa_ctx->info), qoa_ctx->file);
+    }
+    else if (qoa_ctx->read)
+    {
+        buffer = qoa_ctx->buffer;
+        buffer_len = qoa_ctx->read(qoa_ctx->user_data, qoa_ctx->buffer, qoa_max_frame_size(&qoa_ctx->info));
     }
     else
     {
+        // NOTE: Read size is limited to data size, last frame could be smaller than max frame size
         buffer = qoa_ctx->file_data + qoa_ctx->file_data_offset;
         buffer_len = qoa_max_frame_size(&qoa_ctx->info);
+        if (qoa_ctx->file_data_offset >= qoa_ctx->file_data_size) buffer_len = 0;
+        else if (buffer_len > (qoa_ctx->file_data_size - qoa_ctx->file_data_offset)) buffer_len = qoa_ctx->file_data_size - qoa_ctx->file_data_offset;
         qoa_ctx->file_data_offset += buffer_len;
     }
 
@@ -199,6 +253,7 @@ unsigned int qoaplay_decode_frame(qoaplay_desc *qoa_ctx)
 void qoaplay_rewind(qoaplay_desc *qoa_ctx)
 {
     if (qoa_ctx->file) fseek(qoa_ctx->file, qoa_ctx->first_frame_pos, SEEK_SET);
+    else if (qoa_ctx->seek) qoa_ctx->seek(qoa_ctx->user_data, qoa_ctx->first_frame_pos);
     else qoa_ctx->file_data_offset = qoa_ctx->first_frame_pos;
 
     qoa_ctx->sample_position = 0;
@@ -272,5 +327,6 @@ void qoaplay_seek_frame(qoaplay_desc *qoa_ctx, int frame)
     unsigned int offset = qoa_ctx->first_frame_pos + frame*qoa_max_frame_size(&qoa_ctx->info);
 
     if (qoa_ctx->file) fseek(qoa_ctx->file, offset, SEEK_SET);
+    else if (qoa_ctx->seek) qoa_ctx->seek(qoa_ctx->user_data, offset);
     else qoa_ctx->file_data_offset = offset;
 }
@@ -116,7 +116,9 @@ typedef enum {
     RL_GPUTEX_PIXELFORMAT_COMPRESSED_PVRT_RGB,            // 4 bpp
     RL_GPUTEX_PIXELFORMAT_COMPRESSED_PVRT_RGBA,           // 4 bpp
     RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA,       // 8 bpp
-    RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA        // 2 bpp
+    RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA,       // 2 bpp
+    RL_GPUTEX_PIXELFORMAT_COMPRESSED_BC7_RGBA,            // 8 bpp
+    RL_GPUTEX_PIXELFORMAT_COMPRESSED_BC4_R                // 4 bpp
 } rlGpuTexPixelFormat;
 
 //----------------------------------------------------------------------------------
@@ -522,7 +524,7 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
 
     // NOTE: Before start of every mipmap data block, we have: unsigned int data_size
 
-    if (file_data_ptr != RL_GPUTEX_NULL)
+    if ((file_data_ptr != RL_GPUTEX_NULL) && (file_size >= sizeof(ktx_header)))
     {
         ktx_header *header = (ktx_header *)file_data_ptr;
 
@@ -541,18 +543,86 @@ void *rl_load_ktx_from_memory(const unsigned char *file_data, unsigned int file_
 
             file_data_ptr += header->key_value_data_size; // Skip value data size
 
-            int data_size = ((int *)file_data_ptr)[0];
-            file_data_ptr += sizeof(int);
+            // Get pixel format from OpenGL formats, uncompressed formats identified by format and data type
+            // NOTE: Sized and unsized internal formats are saved depending on OpenGL version, both are supported
+            *format = 0;
 
-            image_data = RL_GPUTEX_MALLOC(data_size*sizeof(unsigned char));
+            switch (header->gl_internal_format)
+            {
+                case 0x83f0: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT1_RGB; break;
+                case 0x83f1: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT1_RGBA; break;
+                case 0x83f2: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT3_RGBA; break;
+                case 0x83f3: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT5_RGBA; break;
+                case 0x8d64: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC1_RGB; break;
+                case 0x9274: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_RGB; break;
+                case 0x9278: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA; break;
+                case 0x8c00: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_PVRT_RGB; break;
+                case 0x8c02: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_PVRT_RGBA; break;
+                case 0x93b0: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA; break;
+                case 0x93b7: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA; break;
+                case 0x8e8c: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_BC7_RGBA; break;
+                case 0x8dbb: *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_BC4_R; break;
+                default:
+                {
+                    int half_float = (header->gl_type == 0x140b) || (header->gl_type == 0x8d61);   // GL_HALF_FLOAT, GL_HALF_FLOAT_OES
 
-            RL_GPUTEX_MEMCPY(image_data, file_data_ptr, data_size);
+                    if (header->gl_type == 0x8363) *format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R5G6B5;          // GL_UNSIGNED_SHORT_5_6_5
+                    else if (header->gl_type == 0x8034) *format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1;   // GL_UNSIGNED_SHORT_5_5_5_1
+                    else if (header->gl_type == 0x8033) *format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4;   // GL_UNSIGNED_SHORT_4_4_4_4
+                    else if (header->gl_type == 0x1401)     // GL_UNSIGNED_BYTE
+                    {
+                        if ((header->gl_format == 0x1903) || (header->gl_format == 0x1909)) *format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;       // GL_RED, GL_LUMINANCE
+                        else if ((header->gl_format == 0x8227) || (header->gl_format == 0x190a)) *format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; // GL_RG, GL_LUMINANCE_ALPHA
+                        else if (header->gl_format == 0x1907) *format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R8G8B8;       // GL_RGB
+                        else if (header->gl_format == 0x1908) *format = RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;     // GL_RGBA
+                    }
+                    else if ((header->gl_type == 0x1406) || half_float)     // GL_FLOAT
+                    {
+                        if ((header->gl_format == 0x1903) || (header->gl_format == 0x1909)) *format = half_float? RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R16 : RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R32;
+                        else if (header->gl_format == 0x1907) *format = half_float? RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R16G16B16 : RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R32G32B32;
+                        else if (header->gl_format == 0x1908) *format = half_float? RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16 : RL_GPUTEX_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+                    }
+                } break;
+            }
+
+            // Mipmap levels are stored consecutively, every level data preceded by its data size
+            // and padded to 4 bytes (KTX 1.1 mipPadding), only first face and array element are supported
+            // NOTE: Levels are validated against file size, truncated files load the complete levels
+            const unsigned char *file_data_end = file_data + file_size;
+            const unsigned char *level_ptr = file_data_ptr;
+            int mip_count = (header->mipmap_levels > 0)? (int)header->mipmap_levels : 1;
+            int levels = 0;
+            int image_size = 0;
+
+            for (; levels < mip_count; levels++)
+            {
+                if ((level_ptr + sizeof(unsigned int)) > file_data_end) break;
 
-            if (header->gl_internal_format == 0x8D64) *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC1_RGB;
-            else if (header->gl_internal_format == 0x9274) *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_RGB;
-            else if (header->gl_internal_format == 0x9278) *format = RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+                unsigned int level_size = 0;
+                RL_GPUTEX_MEMCPY(&level_size, level_ptr, sizeof(unsigned int));
+                if ((level_size == 0) || (level_size > (unsigned int)(file_data_end - level_ptr - sizeof(unsigned int)))) break;
 
-            // TODO: Support uncompressed data formats? Right now it returns format = 0!
+                image_size += level_size;
+                level_ptr += sizeof(unsigned int) + ((level_size + 3) & ~3u);
+            }
+
+            if ((*format == 0) || (levels == 0)) RL_GPUTEX_LOG("KTX file data format not supported (0x%x)", header->gl_internal_format);
+            else
+            {
+                *mips = levels;
+                image_data = RL_GPUTEX_MALLOC(image_size*sizeof(unsigned char));
+
+                level_ptr = file_data_ptr;
+                for (int i = 0, offset = 0; i < levels; i++)
+                {
+                    unsigned int level_size = 0;
+                    RL_GPUTEX_MEMCPY(&level_size, level_ptr, sizeof(unsigned int));
+                    RL_GPUTEX_MEMCPY((unsigned char *)image_data + offset, level_ptr + sizeof(unsigned int), level_size);
+
+                    offset += level_size;
+                    level_ptr += sizeof(unsigned int) + ((level_size + 3) & ~3u);
+                }
+            }
         }
     }
 
@@ -600,12 +670,14 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
     */
 
     // Calculate file data_size required
+    // NOTE: Every mipmap level is preceded by its data size and padded to 4 bytes (KTX 1.1 mipPadding)
     int data_size = sizeof(ktx_header);
 
     for (int i = 0, w = width, h = height; i < mipmaps; i++)
     {
-        data_size += get_pixel_data_size(w, h, format);
-        w /= 2; h /= 2;
+        data_size += 4 + ((get_pixel_data_size(w, h, format) + 3) & ~3);
+        w = (w > 1)? w/2 : 1;
+        h = (h > 1)? h/2 : 1;
     }
 
     unsigned char *file_data = RL_GPUTEX_MALLOC(data_size);
@@ -635,8 +707,29 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
     header.mipmap_levels = mipmaps;         // If it was 0, it means mipmaps should be generated on loading (not for compressed formats)
     header.key_value_data_size = 0;         // No extra data after the header
 
-    // TODO: WARNING: Function dependant on rlgl library!
-    rlGetGlTextureFormats(format, &header.gl_internal_format, &header.gl_format, &header.gl_type); // rlgl module function
+    // NOTE: Compressed formats internal format does not depend on OpenGL version,
+    // they are saved even if current OpenGL version does not support them (offline export)
+    switch (format)
+    {
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT1_RGB: header.gl_internal_format = 0x83f0; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT1_RGBA: header.gl_internal_format = 0x83f1; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT3_RGBA: header.gl_internal_format = 0x83f2; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT5_RGBA: header.gl_internal_format = 0x83f3; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC1_RGB: header.gl_internal_format = 0x8d64; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_RGB: header.gl_internal_format = 0x9274; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: header.gl_internal_format = 0x9278; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_PVRT_RGB: header.gl_internal_format = 0x8c00; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_PVRT_RGBA: header.gl_internal_format = 0x8c02; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: header.gl_internal_format = 0x93b0; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: header.gl_internal_format = 0x93b7; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_BC7_RGBA: header.gl_internal_format = 0x8e8c; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_BC4_R: header.gl_internal_format = 0x8dbb; break;
+        default:
+        {
+            // TODO: WARNING: Function dependant on rlgl library!
+            rlGetGlTextureFormats(format, &header.gl_internal_format, &header.gl_format, &header.gl_type); // rlgl module function
+        } break;
+    }
 
     header.gl_base_internal_format = header.gl_format; // TODO: WARNING: KTX 1.1 only
 
@@ -659,11 +752,12 @@ int rl_save_ktx(const char *file_name, void *data, int width, int height, int fo
 
             RL_GPUTEX_MEMCPY(file_data_ptr, &data_size, sizeof(unsigned int));
             RL_GPUTEX_MEMCPY(file_data_ptr + 4, (unsigned char *)data + data_offset, data_size);
+            for (unsigned int p = data_size; p < ((data_size + 3) & ~3u); p++) file_data_ptr[4 + p] = 0;
 
-            temp_width /= 2;
-            temp_height /= 2;
+            temp_width = (temp_width > 1)? temp_width/2 : 1;
+            temp_height = (temp_height > 1)? temp_height/2 : 1;
             data_offset += data_size;
-            file_data_ptr += (4 + data_size);
+            file_data_ptr += (4 + ((data_size + 3) & ~3u));
         }
     }
 
@@ -922,11 +1016,13 @@ static int get_pixel_data_size(int width, int height, int format)
         case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC1_RGB:
         case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_RGB:
         case RL_GPUTEX_PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_PVRT_RGBA:
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_BC4_R: bpp = 4; break;
         case RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
         case RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
         case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA:
+        case RL_GPUTEX_PIXELFORMAT_COMPRESSED_BC7_RGBA: bpp = 8; break;
         case RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
         default: break;
     }
@@ -939,6 +1035,8 @@ static int get_pixel_data_size(int width, int height, int format)
     {
         if ((format >= RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT3_RGBA)) data_size = 8;
         else if ((format >= RL_GPUTEX_PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < RL_GPUTEX_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) data_size = 16;
+        else if (format == RL_GPUTEX_PIXELFORMAT_COMPRESSED_BC7_RGBA) data_size = 16;
+        else if (format == RL_GPUTEX_PIXELFORMAT_COMPRESSED_BC4_R) data_size = 8;
     }
 
     return data_size;
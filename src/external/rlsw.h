@@ -18,22 +18,67 @@
 *       - Texture features supported:
 *           - All uncompressed texture formats supported by raylib
 *           - Texture Minification/Magnification checks
-*           - Point and Bilinear filtering
+*           - Point and Bilinear filtering, SIMD accelerated for RGBA8 texels
+*           - Mipmaps (generated or uploaded per level) with nearest/linear levels filtering
+*           - Tiled texture storage (4x4 texels blocks) for better cache locality
 *           - Texture Wrap Modes with separate checks for S/T coordinates
 *       - Vertex Arrays support with direct primitive drawing mode
+*           - Vertices transformed with SIMD matrix-vector products, post-transform cache for indexed draws
+*           - Trivial accept/reject of primitives by vertex clip codes before polygon clipping
 *       - Matrix Stack support (Matrix Push/Pop)
 *       - Other GL misc features:
 *           - GL-style getter functions
 *           - Framebuffer resizing
-*           - Perspective correction
+*           - Perspective correction, divisions per scanline span with fast reciprocals (SW_PERSPECTIVE_SPAN)
 *           - Scissor clipping
 *           - Depth testing
 *           - Blend modes
 *           - Face culling
+*       - Tile-binned multithreaded rasterization (optional, SW_RASTER_THREADS)
+*       - Half-space triangle rasterization on pixel blocks, SIMD accelerated (optional, SW_RASTER_HALF_SPACE)
+*       - Raster functions specialized per state (texture filter, depth test, blend mode), selected at draw time
+*       - Sprite blitting for axis-aligned textured quads, integer texel stepping and SIMD blending (32-bit color buffer)
+*       - Framebuffer clears with block fills, copies with SIMD format conversion kernels (RGBA8, BGRA8, RGB565)
+*       - Hierarchical depth buffer, occluded triangle pixels rejected per tile before shading (optional, SW_DEPTH_TILES)
+*       - Dirty region tracking of the color buffer, for partial copies and presentation of the modified pixels
 *
 *   ADDITIONAL NOTES:
 *       Check PR for more info: https://github.com/raysan5/raylib/pull/4832
 *
+*       When SW_RASTER_THREADS is greater than 0, clipped and projected triangles and quads are not
+*       rasterized immediately but sorted into tiles (bands of SW_RASTER_TILE_HEIGHT framebuffer rows),
+*       tiles are rasterized in parallel by the worker threads and the calling thread, every tile
+*       processing its primitives in submission order, so the result matches immediate rasterization.
+*       Binned primitives are rasterized on swFinish() and, implicitly, before any operation reading
+*       or changing the framebuffer, textures or blending state; lines and points are rasterized
+*       immediately, after the binned primitives. POSIX threads are required
+*       NOTE: When rendering into user memory (swSetColorBuffer()), swFinish() must be called before reading it
+*
+*       When SW_RASTER_HALF_SPACE is enabled, triangles are rasterized evaluating their edge functions on
+*       blocks of 2x2 pixels (4x2 with AVX), one pixel per SIMD lane, instead of walking scanlines; blocks
+*       are grouped in 8x8 pixels tiles rejected or accepted as a whole, and depth test, attributes
+*       interpolation and blending are computed for all the block pixels at once. Without SIMD support
+*       (RLSW_USE_SIMD_INTRINSICS), the same logic runs on scalar code
+*
+*       When SW_DEPTH_TILES is enabled, the farthest depth of every 8x8 pixels tile is kept in a coarse
+*       depth buffer, so depth tested triangles skip the tiles pixels they are behind before any
+*       interpolation, texturing or blending work. Tiles farthest depth only decreases when the tile is
+*       entirely overdrawn by depth tested triangles and is reset by swClear(), drawing with depth test
+*       disabled disables tiles rejection until the depth buffer is cleared again
+*       NOTE: With SW_RASTER_THREADS, SW_RASTER_TILE_HEIGHT must be a multiple of 8
+*
+*       Perspective-correct attributes (colors, texture coordinates) are divided by the interpolated w
+*       every SW_PERSPECTIVE_SPAN pixels of a scanline and interpolated linearly in between, divisions use
+*       SIMD reciprocal approximations refined with a Newton-Raphson step (also on half-space blocks);
+*       the error is below 8-bit color precision for usual spans. Triangles with constant w (orthographic
+*       projection, 2D) are interpolated without divisions. SW_PERSPECTIVE_SPAN 1 divides exactly per pixel
+*
+*       The color buffer region modified since the last swResetDirtyRegion() is tracked as the union of the
+*       drawn primitives screen bounds and the cleared rectangles; clearing the whole color buffer to the
+*       same color as its previous whole clear only dirties the region drawn in between, so static frames
+*       leave the region empty. swGetDirtyRegion() and swCopyFramebufferRegion() let platform layers copy
+*       and present only the modified pixels; the region is conservative, it can include unmodified pixels
+*
 *   CONFIGURATION:
 *       #define RLSW_IMPLEMENTATION
 *           Generates the implementation of the library into the included file
@@ -59,6 +104,12 @@
 *           #define SW_MAX_MODELVIEW_STACK_SIZE     8
 *           #define SW_MAX_TEXTURE_STACK_SIZE       2
 *           #define SW_MAX_TEXTURES                 128
+*           #define SW_RASTER_THREADS               0       // Worker threads for tile-binned rasterization, 0 disables it
+*           #define SW_RASTER_TILE_HEIGHT           32      // Tile height in framebuffer rows
+*           #define SW_RASTER_BIN_CAPACITY          16384   // Binned primitives stored before rasterization is forced
+*           #define SW_RASTER_HALF_SPACE            0       // Rasterize triangles with edge functions on pixel blocks
+*           #define SW_DEPTH_TILES                  1       // Reject occluded pixels per 8x8 tiles with a coarse depth buffer
+*           #define SW_PERSPECTIVE_SPAN             8       // Scanline pixels between exact perspective divisions, 1 divides per pixel
 *
 *
 *   LICENSE: MIT
@@ -145,6 +196,30 @@
     #define SW_MAX_TEXTURES                 128
 #endif
 
+#ifndef SW_RASTER_THREADS
+    #define SW_RASTER_THREADS               0   //< Worker threads for tile-binned rasterization, 0 disables it
+#endif
+
+#ifndef SW_RASTER_TILE_HEIGHT
+    #define SW_RASTER_TILE_HEIGHT           32
+#endif
+
+#ifndef SW_RASTER_BIN_CAPACITY
+    #define SW_RASTER_BIN_CAPACITY          16384
+#endif
+
+#ifndef SW_RASTER_HALF_SPACE
+    #define SW_RASTER_HALF_SPACE            0   //< Rasterize triangles with edge functions on pixel blocks, 0 uses scanlines
+#endif
+
+#ifndef SW_DEPTH_TILES
+    #define SW_DEPTH_TILES                  1   //< Reject occluded pixels per 8x8 tiles with a coarse depth buffer (hierarchical depth)
+#endif
+
+#ifndef SW_PERSPECTIVE_SPAN
+    #define SW_PERSPECTIVE_SPAN             8   //< Scanline pixels between exact perspective divisions, linearly interpolated in between, 1 divides per pixel
+#endif
+
 // Under normal circumstances, clipping a polygon can add at most one vertex per clipping plane
 // Considering the largest polygon involved is a quadrilateral (4 vertices),
 // and that clipping occurs against both the frustum (6 planes) and the scissors (4 planes),
@@ -271,6 +346,10 @@ typedef double              GLclampd;
 
 #define GL_NEAREST                          0x2600
 #define GL_LINEAR                           0x2601
+#define GL_NEAREST_MIPMAP_NEAREST           0x2700
+#define GL_LINEAR_MIPMAP_NEAREST            0x2701
+#define GL_NEAREST_MIPMAP_LINEAR            0x2702
+#define GL_LINEAR_MIPMAP_LINEAR             0x2703
 
 #define GL_REPEAT                           0x2901
 #define GL_CLAMP                            0x2900
@@ -302,6 +381,9 @@ typedef double              GLclampd;
 #define GL_INT                              0x1404
 #define GL_UNSIGNED_INT                     0x1405
 #define GL_FLOAT                            0x1406
+#define GL_UNSIGNED_SHORT_5_6_5             0x8363
+#define GL_UNSIGNED_SHORT_5_5_5_1           0x8034
+#define GL_UNSIGNED_SHORT_4_4_4_4           0x8033
 
 // OpenGL Definitions NOT USED
 #define GL_PERSPECTIVE_CORRECTION_HINT      0x0C50
@@ -325,6 +407,7 @@ typedef double              GLclampd;
 // OpenGL Bindings to rlsw
 //----------------------------------------------------------------------------------
 #define glReadPixels(x, y, w, h, f, t, p)           swCopyFramebuffer((x), (y), (w), (h), (f), (t), (p))
+#define glFinish()                                  swFinish()
 #define glEnable(state)                             swEnable((state))
 #define glDisable(state)                            swDisable((state))
 #define glGetFloatv(pname, params)                  swGetFloatv((pname), (params))
@@ -381,7 +464,8 @@ typedef double              GLclampd;
 #define glDrawElements(m,c,t,i)                     swDrawElements((m),(c),(t),(i))
 #define glGenTextures(c, v)                         swGenTextures((c), (v))
 #define glDeleteTextures(c, v)                      swDeleteTextures((c), (v))
-#define glTexImage2D(tr, l, if, w, h, b, f, t, p)   swTexImage2D((w), (h), (f), (t), (p))
+#define glTexImage2D(tr, l, if, w, h, b, f, t, p)   swTexImage2DLevel((l), (w), (h), (f), (t), (p))
+#define glGenerateMipmap(tr)                        swGenerateMipmap()
 #define glTexParameteri(tr, pname, param)           swTexParameteri((pname), (param))
 #define glBindTexture(tr, id)                       swBindTexture((id))
 
@@ -493,12 +577,19 @@ typedef enum {
     SW_SHORT = GL_SHORT,
     SW_UNSIGNED_INT = GL_UNSIGNED_INT,
     SW_INT = GL_INT,
-    SW_FLOAT = GL_FLOAT
+    SW_FLOAT = GL_FLOAT,
+    SW_UNSIGNED_SHORT_5_6_5 = GL_UNSIGNED_SHORT_5_6_5,
+    SW_UNSIGNED_SHORT_5_5_5_1 = GL_UNSIGNED_SHORT_5_5_5_1,
+    SW_UNSIGNED_SHORT_4_4_4_4 = GL_UNSIGNED_SHORT_4_4_4_4
 } SWtype;
 
 typedef enum {
     SW_NEAREST = GL_NEAREST,
-    SW_LINEAR = GL_LINEAR
+    SW_LINEAR = GL_LINEAR,
+    SW_NEAREST_MIPMAP_NEAREST = GL_NEAREST_MIPMAP_NEAREST,
+    SW_LINEAR_MIPMAP_NEAREST = GL_LINEAR_MIPMAP_NEAREST,
+    SW_NEAREST_MIPMAP_LINEAR = GL_NEAREST_MIPMAP_LINEAR,
+    SW_LINEAR_MIPMAP_LINEAR = GL_LINEAR_MIPMAP_LINEAR
 } SWfilter;
 
 typedef enum {
@@ -531,6 +622,12 @@ SWAPI void swClose(void);
 SWAPI bool swResizeFramebuffer(int w, int h);
 SWAPI void swCopyFramebuffer(int x, int y, int w, int h, SWformat format, SWtype type, void *pixels);
 SWAPI void swBlitFramebuffer(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySrc, int wSrc, int hSrc, SWformat format, SWtype type, void *pixels);
+SWAPI bool swSetColorBuffer(void *pixels, int pitch);
+SWAPI void swFinish(void);
+
+SWAPI bool swGetDirtyRegion(int *x, int *y, int *w, int *h);
+SWAPI void swResetDirtyRegion(void);
+SWAPI void swCopyFramebufferRegion(int x, int y, int w, int h, SWformat format, SWtype type, void *pixels, int pitch);
 
 SWAPI void swEnable(SWstate state);
 SWAPI void swDisable(SWstate state);
@@ -597,6 +694,8 @@ SWAPI void swGenTextures(int count, uint32_t *textures);
 SWAPI void swDeleteTextures(int count, uint32_t *textures);
 
 SWAPI void swTexImage2D(int width, int height, SWformat format, SWtype type, const void *data);
+SWAPI void swTexImage2DLevel(int level, int width, int height, SWformat format, SWtype type, const void *data);
+SWAPI void swGenerateMipmap(void);
 SWAPI void swTexParameteri(int param, int value);
 SWAPI void swBindTexture(uint32_t id);
 
@@ -613,6 +712,11 @@ SWAPI void swBindTexture(uint32_t id);
 #include <stdlib.h>         // Required for: malloc(), free()
 #include <stddef.h>         // Required for: NULL, size_t, uint8_t, uint16_t, uint32_t...
 #include <math.h>           // Required for: sinf(), cosf(), floorf(), fabsf(), sqrtf(), roundf()
+#include <string.h>         // Required for: memcpy()
+
+#if (SW_RASTER_THREADS > 0)
+    #include <pthread.h>    // Required for: pthread_create(), pthread_join(), pthread_mutex_lock(), pthread_cond_wait()...
+#endif
 
 // Simple log system to avoid printf() calls if required
 // NOTE: Avoiding those calls, also avoids const strings memory usage
@@ -713,13 +817,6 @@ SWAPI void swBindTexture(uint32_t id);
 
 #define SW_COLOR_PIXEL_SIZE     (SW_COLOR_BUFFER_BITS >> 3)
 #define SW_DEPTH_PIXEL_SIZE     (SW_DEPTH_BUFFER_BITS >> 3)
-#define SW_PIXEL_SIZE           (SW_COLOR_PIXEL_SIZE + SW_DEPTH_PIXEL_SIZE)
-
-#if (SW_PIXEL_SIZE <= 4)
-    #define SW_PIXEL_ALIGNMENT 4
-#else // if (SW_PIXEL_SIZE <= 8)
-    #define SW_PIXEL_ALIGNMENT 8
-#endif
 
 #if (SW_COLOR_BUFFER_BITS == 8)
     #define SW_COLOR_TYPE       uint8_t
@@ -792,6 +889,57 @@ SWAPI void swBindTexture(uint32_t id);
 #define SW_STATE_CULL_FACE      (1 << 3)
 #define SW_STATE_BLEND          (1 << 4)
 
+#define SW_TEXTURE_MAX_LEVELS   16          // Mipmap levels, enough for 32768x32768 textures
+#define SW_TEXTURE_TILE_SHIFT   2           // Texels stored in tiles of 4x4, one 64 bytes cache line
+#define SW_TEXTURE_TILE_SIZE    (1 << SW_TEXTURE_TILE_SHIFT)
+#define SW_TEXTURE_TILE_MASK    (SW_TEXTURE_TILE_SIZE - 1)
+
+#define SW_FILL_BLOCK_SIZE      4096        // Bytes replicated before block copies in buffer fills, fits L1 cache
+
+#define SW_VERTEX_CACHE_SIZE    256         // Post-transform cache entries of indexed draws, power of two
+
+#define SW_DEPTH_TILE_SHIFT     3           // Coarse depth buffer tiles of 8x8 pixels, one bit per pixel in coverage masks
+#define SW_DEPTH_TILE_SIZE      (1 << SW_DEPTH_TILE_SHIFT)
+#define SW_DEPTH_TILE_MASK      (SW_DEPTH_TILE_SIZE - 1)
+#define SW_DEPTH_TILE_EPSILON   1e-5f       // Depth interpolation rounding error bound, keeps tiles depth conservative
+
+#if SW_DEPTH_TILES && (SW_RASTER_THREADS > 0) && ((SW_RASTER_TILE_HEIGHT % SW_DEPTH_TILE_SIZE) != 0)
+    #error "SW_RASTER_TILE_HEIGHT must be a multiple of 8 with SW_DEPTH_TILES, depth tiles are updated by a single thread"
+#endif
+
+// Raster functions variants, one raster function specialized at compile time per state combination
+// NOTE: Variant index: texture mode (bits 0-1), depth test (bit 2), blend mode (bits 3-4)
+#define SW_RASTER_TEX_NONE          0       // Texturing disabled
+#define SW_RASTER_TEX_FILTERED      1       // Min/mag filter selected per sample
+#define SW_RASTER_TEX_NEAREST       2       // Nearest filtering only
+#define SW_RASTER_TEX_LINEAR        3       // Bilinear filtering only
+
+#define SW_RASTER_BLEND_NONE        0       // Blending disabled (or SW_ONE, SW_ZERO)
+#define SW_RASTER_BLEND_FACTORS     1       // Any factors, blend factor functions
+#define SW_RASTER_BLEND_ALPHA       2       // SW_SRC_ALPHA, SW_ONE_MINUS_SRC_ALPHA
+#define SW_RASTER_BLEND_ADDITIVE    3       // SW_SRC_ALPHA, SW_ONE
+
+#define SW_RASTER_VARIANT(tex, depth, blend) ((tex) | ((depth) << 2) | ((blend) << 3))
+#define SW_RASTER_VARIANT_COUNT     32
+
+#define SW_RASTER_VARIANT_TEX_MODE(variant)     ((variant) & 3)
+#define SW_RASTER_VARIANT_DEPTH_TEST(variant)   (((variant) >> 2) & 1)
+#define SW_RASTER_VARIANT_BLEND_MODE(variant)   ((variant) >> 3)
+
+// Polygon rasterization paths, selected per polygon at draw time
+#define SW_RASTER_PATH_POLYGON      0       // Triangle fan, see sw_polygon_raster()
+#define SW_RASTER_PATH_AXIS_ALIGNED 1       // Axis-aligned quad, attributes interpolated along screen axes
+#define SW_RASTER_PATH_SPRITE       2       // Axis-aligned sprite quad, blitted with integer texel stepping
+
+// Expand X(NAME, T, D, B) for every raster variant, in variant index order
+#define SW_RASTER_VARIANTS_TEX(X, NAME, D, B)   X(NAME, 0, D, B) X(NAME, 1, D, B) X(NAME, 2, D, B) X(NAME, 3, D, B)
+#define SW_RASTER_VARIANTS_DEPTH(X, NAME, B)    SW_RASTER_VARIANTS_TEX(X, NAME, 0, B) SW_RASTER_VARIANTS_TEX(X, NAME, 1, B)
+#define SW_RASTER_VARIANTS(X, NAME)             SW_RASTER_VARIANTS_DEPTH(X, NAME, 0) SW_RASTER_VARIANTS_DEPTH(X, NAME, 1) \
+                                                SW_RASTER_VARIANTS_DEPTH(X, NAME, 2) SW_RASTER_VARIANTS_DEPTH(X, NAME, 3)
+
+#define SW_RASTER_VARIANT_NAME(NAME, T, D, B)   NAME##_t##T##_d##D##_b##B
+#define SW_RASTER_VARIANT_ENTRY(NAME, T, D, B)  SW_RASTER_VARIANT_NAME(NAME, T, D, B),
+
 //----------------------------------------------------------------------------------
 // Module Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -833,11 +981,21 @@ typedef struct {
 } sw_vertex_t;
 
 typedef struct {
-    uint8_t *pixels;            // Texture pixels (RGBA32)
+    uint8_t *pixels;            // Level pixels (RGBA32), stored in tiles of 4x4 texels
+    int width, height;          // Dimensions of the level
+    int wMinus1, hMinus1;       // Dimensions minus one
+    int tileStride;             // Tiles per row
+} sw_texture_level_t;
+
+typedef struct {
+    uint8_t *pixels;            // Texture pixels (RGBA32), all levels in one allocation
 
     int width, height;          // Dimensions of the texture
     int wMinus1, hMinus1;       // Dimensions minus one
 
+    sw_texture_level_t levels[SW_TEXTURE_MAX_LEVELS]; // Mipmap levels, level 0 is the base texture
+    int levelCount;             // Mipmap levels available
+
     SWfilter minFilter;         // Minification filter
     SWfilter magFilter;         // Magnification filter
 
@@ -848,25 +1006,97 @@ typedef struct {
     float ty;                   // Texel height
 } sw_texture_t;
 
-// Pixel data type
-typedef SW_ALIGN(SW_PIXEL_ALIGNMENT) struct {
+// Pixel data types
+// NOTE: Color and depth are stored in separate buffers, so color can be rendered directly into user memory
+typedef struct {
     SW_COLOR_TYPE color[SW_COLOR_PACK_COMP];
+} sw_color_t;
+
+typedef struct {
     SW_DEPTH_TYPE depth[SW_DEPTH_PACK_COMP];
-#if (SW_PIXEL_SIZE % SW_PIXEL_ALIGNMENT != 0)
-    uint8_t padding[SW_PIXEL_ALIGNMENT - SW_PIXEL_SIZE % SW_PIXEL_ALIGNMENT];
+} sw_depth_t;
+
+#if SW_DEPTH_TILES
+// Coarse depth buffer tile, depth values stored in the tile pixels are never greater than maxDepth
+// NOTE: Pixels overdrawn since the last maxDepth update are tracked in a second layer (coverage mask and
+// its farthest depth), maxDepth is lowered to the layer depth once the layer covers the whole tile
+typedef struct {
+    float maxDepth;                 // Farthest depth of the tile pixels
+    float layerDepth;               // Farthest depth of the layer pixels
+    uint64_t layerMask;             // Layer pixels, bit (y%8)*8 + x%8 (pixels outside framebuffer always set)
+} sw_depth_tile_t;
 #endif
-} sw_pixel_t;
 
 typedef struct {
-    sw_pixel_t *pixels;
+    sw_color_t *color;              // Color buffer, internal or user provided with swSetColorBuffer()
+    sw_depth_t *depth;              // Depth buffer
+    sw_color_t *colorInternal;      // Internal color buffer
+    int pitch;                      // Color buffer bytes per row
     int width;
     int height;
     int allocSz;
+#if SW_DEPTH_TILES
+    sw_depth_tile_t *depthTiles;    // Coarse depth buffer, SW_DEPTH_TILE_SIZE pixels square tiles
+    int depthTilesPitch;            // Depth tiles per row
+    int depthTilesAllocSz;
+    bool depthTilesValid;           // Tiles depth is an upper bound of the depth buffer, reset by swClear()
+#endif
+    int dirtyMin[2];                // Color buffer region modified since swResetDirtyRegion(), empty if min > max
+    int dirtyMax[2];
+    int drawnMin[2];                // Color buffer region drawn since its last whole clear
+    int drawnMax[2];
+    int pendingMin[2];              // Region drawn since last update of dirty and drawn regions
+    int pendingMax[2];
+    sw_color_t clearedColor;        // Color of the last whole clear, outside of the drawn region
+    bool cleared;                   // Color buffer holds clearedColor outside of the drawn region
 } sw_framebuffer_t;
 
+#if (SW_RASTER_THREADS > 0)
+// Binned primitive, clipped and projected polygon waiting for tiled rasterization
+typedef struct {
+    uint32_t vertexOffset;          // First polygon vertex in bins vertex buffer
+    uint32_t texture;               // Texture id used by the primitive
+    uint8_t vertexCount;            // Polygon vertex count
+    uint8_t variant;                // Raster functions variant, see sw_get_raster_variant()
+    uint8_t path;                   // Rasterization path, see SW_RASTER_PATH_*
+} sw_bin_primitive_t;
+
+// Tile bin, primitives overlapping a band of SW_RASTER_TILE_HEIGHT rows
+typedef struct {
+    uint32_t *primitives;           // Primitives indices, in submission order
+    int count;
+    int capacity;
+} sw_bin_tile_t;
+
+typedef struct {
+    sw_vertex_t *vertices;          // Binned polygons vertices
+    int vertexCount;
+    int vertexCapacity;
+
+    sw_bin_primitive_t *primitives; // Binned primitives, in submission order
+    int primitiveCount;
+    int primitiveCapacity;
+
+    sw_bin_tile_t *tiles;           // Tiles bins, from top to bottom of the framebuffer
+    int tileCount;
+
+    pthread_t threads[SW_RASTER_THREADS];
+    int threadCount;                // Worker threads running
+    pthread_mutex_t mutex;
+    pthread_cond_t start;           // Signaled when tiles are ready to be rasterized
+    pthread_cond_t done;            // Signaled when all worker threads finished rasterizing
+    unsigned int generation;        // Rasterization pass counter, workers wait for it to change
+    int nextTile;                   // Next tile to be rasterized (protected by mutex)
+    int busyWorkers;                // Worker threads still rasterizing current pass (protected by mutex)
+    bool quit;
+    bool isReady;
+} sw_bins_t;
+#endif
+
 typedef struct {
     sw_framebuffer_t framebuffer;   // Main framebuffer
-    sw_pixel_t clearValue;          // Clear value of the framebuffer
+    sw_color_t clearColor;          // Clear color value of the framebuffer
+    sw_depth_t clearDepth;          // Clear depth value of the framebuffer
 
     float vpCenter[2];              // Viewport center
     float vpHalf[2];                // Viewport half dimensions
@@ -895,6 +1125,9 @@ typedef struct {
     sw_vertex_t vertexBuffer[SW_MAX_CLIPPED_POLYGON_VERTICES];  // Buffer used for storing primitive vertices, used for processing and rendering
     int vertexCounter;                                          // Number of vertices in 'ctx.vertexBuffer'
 
+    sw_vertex_t vertexCache[SW_VERTEX_CACHE_SIZE];              // Post-transform cache of indexed draws, direct mapped by index
+    uint32_t vertexCacheIndex[SW_VERTEX_CACHE_SIZE];            // Index of the cached vertices, UINT32_MAX if empty
+
     SWdraw drawMode;                                            // Current primitive mode (e.g., lines, triangles)
     SWpoly polyMode;                                            // Current polygon filling mode (e.g., lines, triangles)
     int reqVertices;                                            // Number of vertices required for the primitive being drawn
@@ -928,6 +1161,10 @@ typedef struct {
     int freeTextureIdCount;
 
     uint32_t stateFlags;
+
+#if (SW_RASTER_THREADS > 0)
+    sw_bins_t bins;                                             // Tile-binned rasterization data
+#endif
 } sw_context_t;
 
 //----------------------------------------------------------------------------------
@@ -1005,6 +1242,26 @@ static inline float sw_fract(float x)
     return (x - floorf(x));
 }
 
+// Reciprocal used by perspective division
+// NOTE: With SW_PERSPECTIVE_SPAN > 1, SIMD reciprocal estimate refined with Newton-Raphson steps (~22 bits)
+static inline float sw_rcp(float x)
+{
+#if (SW_PERSPECTIVE_SPAN > 1) && (defined(SW_HAS_SSE) || defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42))
+    __m128 v = _mm_set_ss(x);
+    __m128 r = _mm_rcp_ss(v);
+    r = _mm_mul_ss(r, _mm_sub_ss(_mm_set_ss(2.0f), _mm_mul_ss(v, r)));
+    return _mm_cvtss_f32(r);
+#elif (SW_PERSPECTIVE_SPAN > 1) && (defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA))
+    float32x2_t v = vdup_n_f32(x);
+    float32x2_t r = vrecpe_f32(v);
+    r = vmul_f32(vrecps_f32(v, r), r);
+    r = vmul_f32(vrecps_f32(v, r), r);
+    return vget_lane_f32(r, 0);
+#else
+    return 1.0f/x;
+#endif
+}
+
 static inline int sw_clampi(int v, int min, int max)
 {
     if (v < min) return min;
@@ -1012,6 +1269,19 @@ static inline int sw_clampi(int v, int min, int max)
     return v;
 }
 
+// Fast log2() approximation, enough for texture level of detail
+// NOTE: Exponent extracted from float bits, mantissa log2 approximated with a quadratic in [1, 2)
+static inline float sw_log2(float x)
+{
+    union { float f; uint32_t u; } fb;
+    fb.f = x;
+
+    float exponent = (float)((int)((fb.u >> 23) & 0xFF) - 127);
+    fb.u = (fb.u & 0x007FFFFF) | 0x3F800000;
+
+    return exponent + (-0.34484843f*fb.f + 2.02466578f)*fb.f - 1.67487759f;
+}
+
 static inline void sw_lerp_vertex_PTCH(sw_vertex_t *SW_RESTRICT out, const sw_vertex_t *SW_RESTRICT a, const sw_vertex_t *SW_RESTRICT b, float t)
 {
     const float tInv = 1.0f - t;
@@ -1267,44 +1537,219 @@ static inline sw_half_t sw_half_from_float(float i)
 
 // Framebuffer management functions
 //-------------------------------------------------------------------------------------------
+#if SW_DEPTH_TILES
+// Allocate depth tiles covering w x h pixels, tiles are invalid until the depth buffer is cleared
+static inline bool sw_depth_tiles_resize(int w, int h)
+{
+    int pitch = (w + SW_DEPTH_TILE_MASK) >> SW_DEPTH_TILE_SHIFT;
+    int size = pitch*((h + SW_DEPTH_TILE_MASK) >> SW_DEPTH_TILE_SHIFT);
+
+    if (size > RLSW.framebuffer.depthTilesAllocSz)
+    {
+        void *newTiles = SW_REALLOC(RLSW.framebuffer.depthTiles, sizeof(sw_depth_tile_t)*size);
+        if (newTiles == NULL) return false;
+        RLSW.framebuffer.depthTiles = newTiles;
+        RLSW.framebuffer.depthTilesAllocSz = size;
+    }
+
+    RLSW.framebuffer.depthTilesPitch = pitch;
+    RLSW.framebuffer.depthTilesValid = false;
+
+    return true;
+}
+#else
+static inline bool sw_depth_tiles_resize(int w, int h) { (void)w; (void)h; return true; }
+#endif
+
+// Dirty region tracking
+// NOTE: Regions are inclusive pixel rectangles, clamped to the framebuffer
+static inline void sw_dirty_region_union(int min[2], int max[2], int x0, int y0, int x1, int y1)
+{
+    if (x0 < min[0]) min[0] = x0;
+    if (y0 < min[1]) min[1] = y0;
+    if (x1 > max[0]) max[0] = x1;
+    if (y1 > max[1]) max[1] = y1;
+}
+
+static inline void sw_dirty_region_empty(int min[2], int max[2])
+{
+    min[0] = RLSW.framebuffer.width;
+    min[1] = RLSW.framebuffer.height;
+    max[0] = -1;
+    max[1] = -1;
+}
+
+// Mark the whole color buffer modified, its content is unknown
+static inline void sw_dirty_region_invalidate(void)
+{
+    sw_framebuffer_t *fb = &RLSW.framebuffer;
+
+    fb->dirtyMin[0] = 0;
+    fb->dirtyMin[1] = 0;
+    fb->dirtyMax[0] = fb->width - 1;
+    fb->dirtyMax[1] = fb->height - 1;
+
+    sw_dirty_region_empty(fb->drawnMin, fb->drawnMax);
+    sw_dirty_region_empty(fb->pendingMin, fb->pendingMax);
+    fb->cleared = false;
+}
+
+// Add the region drawn since last update to the dirty and drawn regions
+// NOTE: Primitives only grow the pending region, keeping a single union per primitive
+static inline void sw_dirty_region_update(void)
+{
+    sw_framebuffer_t *fb = &RLSW.framebuffer;
+
+    if (fb->pendingMin[0] > fb->pendingMax[0]) return;
+
+    sw_dirty_region_union(fb->dirtyMin, fb->dirtyMax, fb->pendingMin[0], fb->pendingMin[1], fb->pendingMax[0], fb->pendingMax[1]);
+    sw_dirty_region_union(fb->drawnMin, fb->drawnMax, fb->pendingMin[0], fb->pendingMin[1], fb->pendingMax[0], fb->pendingMax[1]);
+    sw_dirty_region_empty(fb->pendingMin, fb->pendingMax);
+}
+
+// Add a drawn pixels rectangle to the dirty region
+static inline void sw_dirty_region_add(int x0, int y0, int x1, int y1)
+{
+    sw_framebuffer_t *fb = &RLSW.framebuffer;
+
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > fb->width - 1) x1 = fb->width - 1;
+    if (y1 > fb->height - 1) y1 = fb->height - 1;
+    if ((x0 > x1) || (y0 > y1)) return;
+
+    sw_dirty_region_union(fb->pendingMin, fb->pendingMax, x0, y0, x1, y1);
+}
+
+// Add the screen bounds of projected vertices, expanded by pad pixels and restricted to the scissor rectangle
+static inline void sw_dirty_region_add_vertices(const sw_vertex_t *vertices, int count, float pad)
+{
+    float xMin = vertices[0].screen[0], xMax = xMin;
+    float yMin = vertices[0].screen[1], yMax = yMin;
+
+    for (int i = 1; i < count; i++)
+    {
+        const float *screen = vertices[i].screen;
+        if (screen[0] < xMin) xMin = screen[0];
+        if (screen[0] > xMax) xMax = screen[0];
+        if (screen[1] < yMin) yMin = screen[1];
+        if (screen[1] > yMax) yMax = screen[1];
+    }
+
+    // Bounds clamped in float, projected vertices of points and lines can lie far outside,
+    // then shifted to positive values so truncation rounds down
+    float w = (float)RLSW.framebuffer.width, h = (float)RLSW.framebuffer.height;
+    xMin -= pad; yMin -= pad;
+    xMax += pad; yMax += pad;
+    if (xMin < -1.0f) xMin = -1.0f;
+    if (yMin < -1.0f) yMin = -1.0f;
+    if (xMax > w) xMax = w;
+    if (yMax > h) yMax = h;
+
+    int x0 = (int)(xMin + 1.0f) - 1;
+    int y0 = (int)(yMin + 1.0f) - 1;
+    int x1 = (int)(xMax + 1.0f) - 1;
+    int y1 = (int)(yMax + 1.0f) - 1;
+
+    if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
+    {
+        if (x0 < RLSW.scMin[0]) x0 = RLSW.scMin[0];
+        if (y0 < RLSW.scMin[1]) y0 = RLSW.scMin[1];
+        if (x1 > RLSW.scMax[0]) x1 = RLSW.scMax[0];
+        if (y1 > RLSW.scMax[1]) y1 = RLSW.scMax[1];
+    }
+
+    sw_dirty_region_add(x0, y0, x1, y1);
+}
+
+// Add a cleared pixels rectangle to the dirty region
+// NOTE: A whole clear to the color of the previous whole clear only restores the region drawn in between
+static inline void sw_dirty_region_clear(int x0, int y0, int x1, int y1, sw_color_t value)
+{
+    sw_framebuffer_t *fb = &RLSW.framebuffer;
+
+    sw_dirty_region_update();
+
+    if ((x0 > 0) || (y0 > 0) || (x1 < fb->width - 1) || (y1 < fb->height - 1))
+    {
+        sw_dirty_region_add(x0, y0, x1, y1);
+        return;
+    }
+
+    if (fb->cleared && (memcmp(&fb->clearedColor, &value, sizeof(sw_color_t)) == 0))
+    {
+        if (fb->drawnMin[0] <= fb->drawnMax[0]) sw_dirty_region_union(fb->dirtyMin, fb->dirtyMax, fb->drawnMin[0], fb->drawnMin[1], fb->drawnMax[0], fb->drawnMax[1]);
+    }
+    else sw_dirty_region_union(fb->dirtyMin, fb->dirtyMax, 0, 0, fb->width - 1, fb->height - 1);
+
+    sw_dirty_region_empty(fb->drawnMin, fb->drawnMax);
+    fb->clearedColor = value;
+    fb->cleared = true;
+}
+
 static inline bool sw_framebuffer_load(int w, int h)
 {
     int size = w*h;
 
-    RLSW.framebuffer.pixels = SW_MALLOC(sizeof(sw_pixel_t)*size);
-    if (RLSW.framebuffer.pixels == NULL) return false;
+    RLSW.framebuffer.colorInternal = SW_MALLOC(sizeof(sw_color_t)*size);
+    RLSW.framebuffer.depth = SW_MALLOC(sizeof(sw_depth_t)*size);
+    if ((RLSW.framebuffer.colorInternal == NULL) || (RLSW.framebuffer.depth == NULL)) return false;
+    if (!sw_depth_tiles_resize(w, h)) return false;
 
+    RLSW.framebuffer.color = RLSW.framebuffer.colorInternal;
+    RLSW.framebuffer.pitch = w*(int)sizeof(sw_color_t);
     RLSW.framebuffer.width = w;
     RLSW.framebuffer.height = h;
     RLSW.framebuffer.allocSz = size;
 
+    sw_dirty_region_invalidate();
+
     return true;
 }
 
+// NOTE: User provided color buffer is detached, it could not fit the new size
 static inline bool sw_framebuffer_resize(int w, int h)
 {
     int newSize = w*h;
 
-    if (newSize <= RLSW.framebuffer.allocSz)
+    if (newSize > RLSW.framebuffer.allocSz)
     {
-        RLSW.framebuffer.width = w;
-        RLSW.framebuffer.height = h;
-        return true;
-    }
+        void *newColor = SW_REALLOC(RLSW.framebuffer.colorInternal, sizeof(sw_color_t)*newSize);
+        if (newColor == NULL) return false;
+        RLSW.framebuffer.colorInternal = newColor;
 
-    void *newPixels = SW_REALLOC(RLSW.framebuffer.pixels, sizeof(sw_pixel_t)*newSize);
-    if (newPixels == NULL) return false;
+        void *newDepth = SW_REALLOC(RLSW.framebuffer.depth, sizeof(sw_depth_t)*newSize);
+        if (newDepth == NULL) return false;
+        RLSW.framebuffer.depth = newDepth;
 
-    RLSW.framebuffer.pixels = newPixels;
+        RLSW.framebuffer.allocSz = newSize;
+    }
+
+    if (!sw_depth_tiles_resize(w, h)) return false;
 
+    RLSW.framebuffer.color = RLSW.framebuffer.colorInternal;
+    RLSW.framebuffer.pitch = w*(int)sizeof(sw_color_t);
     RLSW.framebuffer.width = w;
     RLSW.framebuffer.height = h;
-    RLSW.framebuffer.allocSz = newSize;
+
+    sw_dirty_region_invalidate();
 
     return true;
 }
 
-static inline void sw_framebuffer_read_color(float dst[4], const sw_pixel_t *src)
+// Get color buffer pixel, rows are pitch bytes apart
+static inline sw_color_t *sw_framebuffer_color_at(int x, int y)
+{
+    return (sw_color_t *)((uint8_t *)RLSW.framebuffer.color + y*RLSW.framebuffer.pitch) + x;
+}
+
+// Get depth buffer pixel
+static inline sw_depth_t *sw_framebuffer_depth_at(int x, int y)
+{
+    return RLSW.framebuffer.depth + y*RLSW.framebuffer.width + x;
+}
+
+static inline void sw_framebuffer_read_color(float dst[4], const sw_color_t *src)
 {
 #if SW_COLOR_IS_PACKED
     SW_COLOR_TYPE pixel = src->color[0];
@@ -1317,7 +1762,7 @@ static inline void sw_framebuffer_read_color(float dst[4], const sw_pixel_t *src
 #endif
 }
 
-static inline void sw_framebuffer_read_color8(uint8_t dst[4], const sw_pixel_t *src)
+static inline void sw_framebuffer_read_color8(uint8_t dst[4], const sw_color_t *src)
 {
 #if SW_COLOR_IS_PACKED
     SW_COLOR_TYPE pixel = src->color[0];
@@ -1334,7 +1779,7 @@ static inline void sw_framebuffer_read_color8(uint8_t dst[4], const sw_pixel_t *
 #endif
 }
 
-static inline float sw_framebuffer_read_depth(const sw_pixel_t *src)
+static inline float sw_framebuffer_read_depth(const sw_depth_t *src)
 {
 #if SW_DEPTH_IS_PACKED
     return src->depth[0]*SW_DEPTH_SCALE;
@@ -1343,7 +1788,7 @@ static inline float sw_framebuffer_read_depth(const sw_pixel_t *src)
 #endif
 }
 
-static inline void sw_framebuffer_write_color(sw_pixel_t *dst, const float src[4])
+static inline void sw_framebuffer_write_color(sw_color_t *dst, const float src[4])
 {
 #if SW_COLOR_IS_PACKED
     dst->color[0] = SW_PACK_COLOR(src[0], src[1], src[2]);
@@ -1352,7 +1797,7 @@ static inline void sw_framebuffer_write_color(sw_pixel_t *dst, const float src[4
 #endif
 }
 
-static inline void sw_framebuffer_write_depth(sw_pixel_t *dst, float depth)
+static inline void sw_framebuffer_write_depth(sw_depth_t *dst, float depth)
 {
     depth = sw_saturate(depth); // REVIEW: An overflow can occur in certain circumstances with clipping, and needs to be reviewed...
 
@@ -1365,169 +1810,424 @@ static inline void sw_framebuffer_write_depth(sw_pixel_t *dst, float depth)
 #endif
 }
 
-static inline void sw_framebuffer_fill_color(sw_pixel_t *ptr, int size, const SW_COLOR_TYPE color[SW_COLOR_PACK_COMP])
+// Fill memory with a pixel value repeated count times
+// NOTE: Value replicated by doubling copies into a cache resident block, then the block is copied,
+// so fills run at memcpy()/memset() speed (vectorized by the C library) for any pixel size
+static inline void sw_fill_pixels(uint8_t *dst, const void *value, int size, int count)
 {
-    if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
-    {
-        int w = RLSW.scMax[0] - RLSW.scMin[0] + 1;
-        for (int y = RLSW.scMin[1]; y <= RLSW.scMax[1]; y++)
-        {
-            sw_pixel_t *row = ptr + y*RLSW.framebuffer.width + RLSW.scMin[0];
-            for (int x = 0; x < w; x++, row++)
-            {
-                for (int i = 0; i < SW_COLOR_PACK_COMP; i++) row->color[i] = color[i];
-            }
-        }
-    }
-    else
+    const uint8_t *bytes = (const uint8_t *)value;
+    size_t total = (size_t)count*size;
+
+    bool uniform = true;
+    for (int i = 1; i < size; i++) uniform = uniform && (bytes[i] == bytes[0]);
+
+    if (uniform)
     {
-        for (int i = 0; i < size; i++, ptr++)
-        {
-            for (int j = 0; j < SW_COLOR_PACK_COMP; j++) ptr->color[j] = color[j];
-        }
+        memset(dst, bytes[0], total);
+        return;
     }
-}
 
-static inline void sw_framebuffer_fill_depth(sw_pixel_t *ptr, int size, const SW_DEPTH_TYPE depth[SW_DEPTH_PACK_COMP])
-{
-    if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
+    size_t blockSize = (size_t)(SW_FILL_BLOCK_SIZE/size)*size;
+    if (blockSize > total) blockSize = total;
+
+    memcpy(dst, bytes, size);
+    for (size_t filled = size; filled < blockSize; filled *= 2)
     {
-        int w = RLSW.scMax[0] - RLSW.scMin[0] + 1;
-        for (int y = RLSW.scMin[1]; y <= RLSW.scMax[1]; y++)
-        {
-            sw_pixel_t *row = ptr + y*RLSW.framebuffer.width + RLSW.scMin[0];
-            for (int x = 0; x < w; x++, row++)
-            {
-                for (int i = 0; i < SW_DEPTH_PACK_COMP; i++) row->depth[i] = depth[i];
-            }
-        }
+        memcpy(dst + filled, dst, ((2*filled) < blockSize)? filled : (blockSize - filled));
     }
-    else
+
+    for (size_t offset = blockSize; offset < total; offset += blockSize)
     {
-        for (int i = 0; i < size; i++, ptr++)
-        {
-            for (int j = 0; j < SW_DEPTH_PACK_COMP; j++) ptr->depth[j] = depth[j];
-        }
+        memcpy(dst + offset, dst, ((offset + blockSize) < total)? blockSize : (total - offset));
     }
 }
 
-static inline void sw_framebuffer_fill(sw_pixel_t *ptr, int size, sw_pixel_t value)
+// Fill color buffer with value, limited to scissor rectangle if enabled
+static inline void sw_framebuffer_fill_color(sw_color_t value)
 {
+    int xMin = 0, yMin = 0, yMax = RLSW.framebuffer.height - 1;
+    int w = RLSW.framebuffer.width;
+
     if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
     {
-        int w = RLSW.scMax[0] - RLSW.scMin[0] + 1;
-        for (int y = RLSW.scMin[1]; y <= RLSW.scMax[1]; y++)
-        {
-            sw_pixel_t *row = ptr + y*RLSW.framebuffer.width + RLSW.scMin[0];
-            for (int x = 0; x < w; x++, row++) *row = value;
-        }
+        xMin = RLSW.scMin[0];
+        yMin = RLSW.scMin[1];
+        yMax = RLSW.scMax[1];
+        w = RLSW.scMax[0] - RLSW.scMin[0] + 1;
     }
-    else
+
+    sw_dirty_region_clear(xMin, yMin, xMin + w - 1, yMax, value);
+
+    // Rows without padding filled at once
+    if ((w == RLSW.framebuffer.width) && (RLSW.framebuffer.pitch == w*(int)sizeof(sw_color_t)))
     {
-        for (int i = 0; i < size; i++, ptr++) *ptr = value;
+        sw_fill_pixels((uint8_t *)sw_framebuffer_color_at(0, yMin), &value, sizeof(sw_color_t), w*(yMax - yMin + 1));
+        return;
     }
+
+    uint8_t *first = (uint8_t *)sw_framebuffer_color_at(xMin, yMin);
+    sw_fill_pixels(first, &value, sizeof(sw_color_t), w);
+
+    for (int y = yMin + 1; y <= yMax; y++) memcpy(sw_framebuffer_color_at(xMin, y), first, w*sizeof(sw_color_t));
 }
 
-static inline void sw_framebuffer_copy_fast(void* dst)
+#if SW_DEPTH_TILES
+// Get the pixels of a depth tile outside the framebuffer, always set in the tile layer mask
+static inline uint64_t sw_depth_tile_outside_mask(int tx, int ty)
 {
-    int size = RLSW.framebuffer.width*RLSW.framebuffer.height;
-    const sw_pixel_t *pixels = RLSW.framebuffer.pixels;
+    int cols = RLSW.framebuffer.width - (tx << SW_DEPTH_TILE_SHIFT);
+    int rows = RLSW.framebuffer.height - (ty << SW_DEPTH_TILE_SHIFT);
+    uint64_t mask = 0;
 
-#if SW_COLOR_BUFFER_BITS == 8
-    uint8_t *dst8 = (uint8_t*)dst;
-    for (int i = 0; i < size; i++) dst8[i] = pixels[i].color[0];
-#elif SW_COLOR_BUFFER_BITS == 16
-    uint16_t *dst16 = (uint16_t*)dst;
-    for (int i = 0; i < size; i++) dst16[i] = *(uint16_t*)pixels[i].color;
-#else // 32 bits
-    uint32_t *dst32 = (uint32_t*)dst;
-    #if SW_GL_FRAMEBUFFER_COPY_BGRA
-        for (int i = 0; i < size; i++)
-        {
-            const uint8_t *c = pixels[i].color;
-            dst32[i] = (uint32_t)c[2] | ((uint32_t)c[1] << 8) | ((uint32_t)c[0] << 16) | ((uint32_t)c[3] << 24);
-        }
-    #else // RGBA
-        for (int i = 0; i < size; i++) dst32[i] = *(uint32_t*)pixels[i].color;
-    #endif
-#endif
+    if (cols < SW_DEPTH_TILE_SIZE) mask |= 0x0101010101010101ULL*(uint8_t)(0xFF << cols);
+    if (rows < SW_DEPTH_TILE_SIZE) mask |= ~0ULL << (rows*SW_DEPTH_TILE_SIZE);
+
+    return mask;
 }
 
-#define DEFINE_FRAMEBUFFER_COPY_BEGIN(name, DST_PTR_T)                          \
-static inline void sw_framebuffer_copy_to_##name(int x, int y, int w, int h, DST_PTR_T *dst) \
-{                                                                               \
-    const int stride = RLSW.framebuffer.width;                                  \
-    const sw_pixel_t *src = RLSW.framebuffer.pixels + (y*stride + x);           \
-                                                                                \
-    for (int iy = 0; iy < h; iy++) {                                            \
-        const sw_pixel_t *line = src;                                           \
-        for (int ix = 0; ix < w; ix++) {                                        \
-            uint8_t color[4];                                                   \
-            sw_framebuffer_read_color8(color, line);                            \
+// Set depth tiles overlapping pixels [x0, x1) x [y0, y1) to a cleared depth value
+// NOTE: Tiles partially cleared keep the farthest of their depth and the cleared depth
+static inline void sw_depth_tiles_fill(float depth, int x0, int y0, int x1, int y1)
+{
+    for (int ty = y0 >> SW_DEPTH_TILE_SHIFT; ty <= ((y1 - 1) >> SW_DEPTH_TILE_SHIFT); ty++)
+    {
+        int py0 = ty << SW_DEPTH_TILE_SHIFT;
+        int py1 = sw_clampi(py0 + SW_DEPTH_TILE_SIZE, 0, RLSW.framebuffer.height);
 
-#define DEFINE_FRAMEBUFFER_COPY_END()                                           \
-            ++line;                                                             \
-        }                                                                       \
-        src += stride;                                                          \
-    }                                                                           \
+        for (int tx = x0 >> SW_DEPTH_TILE_SHIFT; tx <= ((x1 - 1) >> SW_DEPTH_TILE_SHIFT); tx++)
+        {
+            int px0 = tx << SW_DEPTH_TILE_SHIFT;
+            int px1 = sw_clampi(px0 + SW_DEPTH_TILE_SIZE, 0, RLSW.framebuffer.width);
+
+            sw_depth_tile_t *tile = &RLSW.framebuffer.depthTiles[ty*RLSW.framebuffer.depthTilesPitch + tx];
+            bool inside = (px0 >= x0) && (px1 <= x1) && (py0 >= y0) && (py1 <= y1);
+
+            if (inside || (depth > tile->maxDepth)) tile->maxDepth = depth;
+            tile->layerDepth = 0.0f;
+            tile->layerMask = sw_depth_tile_outside_mask(tx, ty);
+        }
+    }
 }
 
-DEFINE_FRAMEBUFFER_COPY_BEGIN(GRAYSCALE, uint8_t)
+// Check if depth is behind all the pixels of a depth tile, with depth test
+static inline bool sw_depth_tile_occluded(int tx, int ty, float depth)
 {
-    // NTSC grayscale conversion: Y = 0.299R + 0.587G + 0.114B
-    uint8_t gray = (uint8_t)((color[0]*299 + color[1]*587 + color[2]*114 + 500)/1000);
-    *dst++ = gray;
+    if (!RLSW.framebuffer.depthTilesValid) return false;
+
+    return (depth - SW_DEPTH_TILE_EPSILON) > RLSW.framebuffer.depthTiles[ty*RLSW.framebuffer.depthTilesPitch + tx].maxDepth;
 }
-DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_BEGIN(GRAYALPHA, uint8_t)
+// Add pixels overdrawn by a depth tested primitive to a depth tile layer
+// NOTE: Pixels failing the depth test are closer than the primitive, so the
+// primitive farthest depth over the pixels bounds them all after rasterization
+static inline void sw_depth_tile_cover(int tx, int ty, uint64_t mask, float depth)
 {
-    // Convert RGB to grayscale using NTSC formula
-    uint8_t gray = (uint8_t)((color[0]*299 + color[1]*587 + color[2]*114 + 500)/1000);
+    if (!RLSW.framebuffer.depthTilesValid) return;
 
-    dst[0] = gray;
-    dst[1] = color[3]; // alpha
+    sw_depth_tile_t *tile = &RLSW.framebuffer.depthTiles[ty*RLSW.framebuffer.depthTilesPitch + tx];
 
-    dst += 2;
+    depth += SW_DEPTH_TILE_EPSILON;
+    if (depth > tile->layerDepth) tile->layerDepth = depth;
+    tile->layerMask |= mask;
+
+    if (tile->layerMask == ~0ULL)
+    {
+        if (tile->layerDepth < tile->maxDepth) tile->maxDepth = tile->layerDepth;
+        tile->layerDepth = 0.0f;
+        tile->layerMask = sw_depth_tile_outside_mask(tx, ty);
+    }
 }
-DEFINE_FRAMEBUFFER_COPY_END()
+#endif
 
-DEFINE_FRAMEBUFFER_COPY_BEGIN(R5G6B5, uint16_t)
+// Fill depth buffer with value, limited to scissor rectangle if enabled
+static inline void sw_framebuffer_fill_depth(sw_depth_t value)
 {
-    // Convert 8-bit RGB to 5:6:5 format
-    uint8_t r5 = (color[0]*31 + 127)/255;
-    uint8_t g6 = (color[1]*63 + 127)/255;
-    uint8_t b5 = (color[2]*31 + 127)/255;
+    if (RLSW.stateFlags & SW_STATE_SCISSOR_TEST)
+    {
+        int w = RLSW.scMax[0] - RLSW.scMin[0] + 1;
 
-#if SW_GL_FRAMEBUFFER_COPY_BGRA
-    uint16_t rgb565 = (b5 << 11) | (g6 << 5) | r5;
-#else // RGBA
-    uint16_t rgb565 = (r5 << 11) | (g6 << 5) | b5;
+        uint8_t *first = (uint8_t *)sw_framebuffer_depth_at(RLSW.scMin[0], RLSW.scMin[1]);
+        sw_fill_pixels(first, &value, sizeof(sw_depth_t), w);
+
+        for (int y = RLSW.scMin[1] + 1; y <= RLSW.scMax[1]; y++) memcpy(sw_framebuffer_depth_at(RLSW.scMin[0], y), first, w*sizeof(sw_depth_t));
+
+#if SW_DEPTH_TILES
+        // Tiles outside the scissor rectangle stay unknown if they were
+        if (RLSW.framebuffer.depthTilesValid)
+        {
+            sw_depth_tiles_fill(sw_framebuffer_read_depth(&value), RLSW.scMin[0], RLSW.scMin[1], RLSW.scMax[0] + 1, RLSW.scMax[1] + 1);
+        }
 #endif
+    }
+    else
+    {
+        sw_fill_pixels((uint8_t *)RLSW.framebuffer.depth, &value, sizeof(sw_depth_t), RLSW.framebuffer.width*RLSW.framebuffer.height);
 
-    *dst++ = rgb565;
+#if SW_DEPTH_TILES
+        sw_depth_tiles_fill(sw_framebuffer_read_depth(&value), 0, 0, RLSW.framebuffer.width, RLSW.framebuffer.height);
+        RLSW.framebuffer.depthTilesValid = true;
+#endif
+    }
 }
-DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_BEGIN(R8G8B8, uint8_t)
+// Swap red and blue channels of RGBA8 pixels, RGBA <-> BGRA
+static inline void sw_swizzle_rgba_bgra(uint8_t *dst, const uint8_t *src, int count)
 {
-#if SW_GL_FRAMEBUFFER_COPY_BGRA
-    dst[0] = color[2];
-    dst[1] = color[1];
-    dst[2] = color[0];
-#else // RGBA
-    dst[0] = color[0];
-    dst[1] = color[1];
-    dst[2] = color[2];
+    int i = 0;
+
+#if defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+    __m128i maskGA = _mm_set1_epi32((int)0xFF00FF00);
+    __m128i maskR = _mm_set1_epi32(0x000000FF);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i p = _mm_loadu_si128((const __m128i *)(src + 4*i));
+        __m128i rb = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(p, 16), maskR), _mm_slli_epi32(_mm_and_si128(p, maskR), 16));
+        _mm_storeu_si128((__m128i *)(dst + 4*i), _mm_or_si128(_mm_and_si128(p, maskGA), rb));
+    }
+#elif defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t p = vld4_u8(src + 4*i);
+        uint8x8_t r = p.val[0];
+        p.val[0] = p.val[2];
+        p.val[2] = r;
+        vst4_u8(dst + 4*i, p);
+    }
 #endif
 
-    dst += 3;
+    for (; i < count; i++)
+    {
+        uint8_t r = src[4*i + 0];
+        dst[4*i + 0] = src[4*i + 2];
+        dst[4*i + 1] = src[4*i + 1];
+        dst[4*i + 2] = r;
+        dst[4*i + 3] = src[4*i + 3];
+    }
 }
-DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_BEGIN(R5G5B5A1, uint16_t)
+// Pack RGBA8 pixels to 5:6:5, channels rounded as (c*max + 127)/255
+// NOTE: Division by 255 computed as (x + 1 + (x >> 8)) >> 8, exact for 16-bit values
+static inline void sw_pack_rgba_r5g6b5(uint16_t *dst, const uint8_t *src, int count, bool bgr)
 {
-    uint8_t r5 = (color[0]*31 + 127)/255;
+    int i = 0;
+    int rShift = bgr? 0 : 11;
+    int bShift = bgr? 11 : 0;
+
+#if defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+    __m128i mask = _mm_set1_epi32(0xFF);
+    __m128i one = _mm_set1_epi32(1);
+    __m128i bias = _mm_set1_epi32(127);
+    __m128i scale5 = _mm_set1_epi32(31);
+    __m128i scale6 = _mm_set1_epi32(63);
+    __m128i rCount = _mm_cvtsi32_si128(rShift);
+    __m128i bCount = _mm_cvtsi32_si128(bShift);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i packed[2];
+
+        for (int k = 0; k < 2; k++)
+        {
+            __m128i p = _mm_loadu_si128((const __m128i *)(src + 4*(i + 4*k)));
+
+            // NOTE: Channels in 32-bit lanes, products fit the low 16 bits
+            __m128i r = _mm_add_epi32(_mm_mullo_epi16(_mm_and_si128(p, mask), scale5), bias);
+            __m128i g = _mm_add_epi32(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(p, 8), mask), scale6), bias);
+            __m128i b = _mm_add_epi32(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(p, 16), mask), scale5), bias);
+
+            r = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(r, one), _mm_srli_epi32(r, 8)), 8);
+            g = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(g, one), _mm_srli_epi32(g, 8)), 8);
+            b = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(b, one), _mm_srli_epi32(b, 8)), 8);
+
+            __m128i pixel = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(r, rCount), _mm_slli_epi32(g, 5)), _mm_sll_epi32(b, bCount));
+
+            // Sign extension of the low 16 bits, so signed saturation keeps the value bits
+            packed[k] = _mm_srai_epi32(_mm_slli_epi32(pixel, 16), 16);
+        }
+
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(packed[0], packed[1]));
+    }
+#elif defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
+    uint16x8_t one = vdupq_n_u16(1);
+    uint16x8_t bias = vdupq_n_u16(127);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t p = vld4_u8(src + 4*i);
+
+        uint16x8_t r = vmlal_u8(bias, p.val[0], vdup_n_u8(31));
+        uint16x8_t g = vmlal_u8(bias, p.val[1], vdup_n_u8(63));
+        uint16x8_t b = vmlal_u8(bias, p.val[2], vdup_n_u8(31));
+
+        r = vshrq_n_u16(vaddq_u16(vsraq_n_u16(r, r, 8), one), 8);
+        g = vshrq_n_u16(vaddq_u16(vsraq_n_u16(g, g, 8), one), 8);
+        b = vshrq_n_u16(vaddq_u16(vsraq_n_u16(b, b, 8), one), 8);
+
+        uint16x8_t pixel = vorrq_u16(vorrq_u16(vshlq_u16(r, vdupq_n_s16(rShift)), vshlq_n_u16(g, 5)), vshlq_u16(b, vdupq_n_s16(bShift)));
+        vst1q_u16(dst + i, pixel);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const uint8_t *c = src + 4*i;
+        uint16_t r5 = (c[0]*31 + 127)/255;
+        uint16_t g6 = (c[1]*63 + 127)/255;
+        uint16_t b5 = (c[2]*31 + 127)/255;
+
+        dst[i] = (uint16_t)((r5 << rShift) | (g6 << 5) | (b5 << bShift));
+    }
+}
+
+// Convert a framebuffer row to RGBA8 (or BGRA8 if SW_GL_FRAMEBUFFER_COPY_BGRA)
+static inline void sw_framebuffer_row_to_R8G8B8A8(uint8_t *dst, const sw_color_t *src, int count)
+{
+#if (SW_COLOR_BUFFER_BITS == 32)
+    #if SW_GL_FRAMEBUFFER_COPY_BGRA
+    sw_swizzle_rgba_bgra(dst, src->color, count);
+    #else
+    memcpy(dst, src, count*sizeof(sw_color_t));
+    #endif
+#else
+    for (int i = 0; i < count; i++)
+    {
+        uint8_t color[4];
+        sw_framebuffer_read_color8(color, &src[i]);
+
+    #if SW_GL_FRAMEBUFFER_COPY_BGRA
+        dst[4*i + 0] = color[2];
+        dst[4*i + 1] = color[1];
+        dst[4*i + 2] = color[0];
+    #else
+        dst[4*i + 0] = color[0];
+        dst[4*i + 1] = color[1];
+        dst[4*i + 2] = color[2];
+    #endif
+        dst[4*i + 3] = color[3];
+    }
+#endif
+}
+
+// Convert a framebuffer row to 5:6:5 (blue in high bits if SW_GL_FRAMEBUFFER_COPY_BGRA)
+static inline void sw_framebuffer_row_to_R5G6B5(uint16_t *dst, const sw_color_t *src, int count)
+{
+#if (SW_COLOR_BUFFER_BITS == 32)
+    sw_pack_rgba_r5g6b5(dst, src->color, count, SW_GL_FRAMEBUFFER_COPY_BGRA);
+#elif (SW_COLOR_BUFFER_BITS == 16) && !SW_GL_FRAMEBUFFER_COPY_BGRA
+    memcpy(dst, src, count*sizeof(sw_color_t));
+#else
+    for (int i = 0; i < count; i++)
+    {
+        uint8_t color[4];
+        sw_framebuffer_read_color8(color, &src[i]);
+
+        uint16_t r5 = (color[0]*31 + 127)/255;
+        uint16_t g6 = (color[1]*63 + 127)/255;
+        uint16_t b5 = (color[2]*31 + 127)/255;
+
+    #if SW_GL_FRAMEBUFFER_COPY_BGRA
+        dst[i] = (uint16_t)((b5 << 11) | (g6 << 5) | r5);
+    #else
+        dst[i] = (uint16_t)((r5 << 11) | (g6 << 5) | b5);
+    #endif
+    }
+#endif
+}
+
+static inline void sw_framebuffer_copy_fast(void* dst)
+{
+    const int width = RLSW.framebuffer.width;
+    const int height = RLSW.framebuffer.height;
+
+#if (SW_COLOR_BUFFER_BITS != 32) || !SW_GL_FRAMEBUFFER_COPY_BGRA
+    // Nothing to copy if rendering directly into destination
+    if ((dst == (void *)RLSW.framebuffer.color) && (RLSW.framebuffer.pitch == width*(int)sizeof(sw_color_t))) return;
+#endif
+
+    // Native format rows, only converted for BGRA copies
+    for (int y = 0; y < height; y++)
+    {
+        uint8_t *row = (uint8_t *)dst + (size_t)y*width*sizeof(sw_color_t);
+
+#if (SW_COLOR_BUFFER_BITS == 32) && SW_GL_FRAMEBUFFER_COPY_BGRA
+        sw_swizzle_rgba_bgra(row, sw_framebuffer_color_at(0, y)->color, width);
+#else
+        memcpy(row, sw_framebuffer_color_at(0, y), width*sizeof(sw_color_t));
+#endif
+    }
+}
+
+// Copy framebuffer region to RGBA8 pixels, with row conversion kernels
+static inline void sw_framebuffer_copy_to_R8G8B8A8(int x, int y, int w, int h, uint8_t *dst)
+{
+    for (int iy = 0; iy < h; iy++) sw_framebuffer_row_to_R8G8B8A8(dst + (size_t)iy*w*4, sw_framebuffer_color_at(x, y + iy), w);
+}
+
+// Copy framebuffer region to 5:6:5 pixels, with row conversion kernels
+static inline void sw_framebuffer_copy_to_R5G6B5(int x, int y, int w, int h, uint16_t *dst)
+{
+    for (int iy = 0; iy < h; iy++) sw_framebuffer_row_to_R5G6B5(dst + (size_t)iy*w, sw_framebuffer_color_at(x, y + iy), w);
+}
+
+#define DEFINE_FRAMEBUFFER_COPY_BEGIN(name, DST_PTR_T)                          \
+static inline void sw_framebuffer_copy_to_##name(int x, int y, int w, int h, DST_PTR_T *dst) \
+{                                                                               \
+    const int pitch = RLSW.framebuffer.pitch;                                   \
+    const sw_color_t *src = sw_framebuffer_color_at(x, y);                      \
+                                                                                \
+    for (int iy = 0; iy < h; iy++) {                                            \
+        const sw_color_t *line = src;                                           \
+        for (int ix = 0; ix < w; ix++) {                                        \
+            uint8_t color[4];                                                   \
+            sw_framebuffer_read_color8(color, line);                            \
+
+#define DEFINE_FRAMEBUFFER_COPY_END()                                           \
+            ++line;                                                             \
+        }                                                                       \
+        src = (const sw_color_t *)((const uint8_t *)src + pitch);               \
+    }                                                                           \
+}
+
+DEFINE_FRAMEBUFFER_COPY_BEGIN(GRAYSCALE, uint8_t)
+{
+    // NTSC grayscale conversion: Y = 0.299R + 0.587G + 0.114B
+    uint8_t gray = (uint8_t)((color[0]*299 + color[1]*587 + color[2]*114 + 500)/1000);
+    *dst++ = gray;
+}
+DEFINE_FRAMEBUFFER_COPY_END()
+
+DEFINE_FRAMEBUFFER_COPY_BEGIN(GRAYALPHA, uint8_t)
+{
+    // Convert RGB to grayscale using NTSC formula
+    uint8_t gray = (uint8_t)((color[0]*299 + color[1]*587 + color[2]*114 + 500)/1000);
+
+    dst[0] = gray;
+    dst[1] = color[3]; // alpha
+
+    dst += 2;
+}
+DEFINE_FRAMEBUFFER_COPY_END()
+
+DEFINE_FRAMEBUFFER_COPY_BEGIN(R8G8B8, uint8_t)
+{
+#if SW_GL_FRAMEBUFFER_COPY_BGRA
+    dst[0] = color[2];
+    dst[1] = color[1];
+    dst[2] = color[0];
+#else // RGBA
+    dst[0] = color[0];
+    dst[1] = color[1];
+    dst[2] = color[2];
+#endif
+
+    dst += 3;
+}
+DEFINE_FRAMEBUFFER_COPY_END()
+
+DEFINE_FRAMEBUFFER_COPY_BEGIN(R5G5B5A1, uint16_t)
+{
+    uint8_t r5 = (color[0]*31 + 127)/255;
     uint8_t g5 = (color[1]*31 + 127)/255;
     uint8_t b5 = (color[2]*31 + 127)/255;
     uint8_t a1 = (color[3] >= 128)? 1 : 0;
@@ -1559,31 +2259,12 @@ DEFINE_FRAMEBUFFER_COPY_BEGIN(R4G4B4A4, uint16_t)
 }
 DEFINE_FRAMEBUFFER_COPY_END()
 
-DEFINE_FRAMEBUFFER_COPY_BEGIN(R8G8B8A8, uint8_t)
-{
-#if SW_GL_FRAMEBUFFER_COPY_BGRA
-    dst[0] = color[2];
-    dst[1] = color[1];
-    dst[2] = color[0];
-#else // RGBA
-    dst[0] = color[0];
-    dst[1] = color[1];
-    dst[2] = color[2];
-#endif
-    dst[3] = color[3];
-
-    dst += 4;
-}
-DEFINE_FRAMEBUFFER_COPY_END()
-
 #define DEFINE_FRAMEBUFFER_BLIT_BEGIN(name, DST_PTR_T)                          \
 static inline void sw_framebuffer_blit_to_##name(                               \
     int xDst, int yDst, int wDst, int hDst,                                     \
     int xSrc, int ySrc, int wSrc, int hSrc,                                     \
     DST_PTR_T *dst)                                                             \
 {                                                                               \
-    const sw_pixel_t *srcBase = RLSW.framebuffer.pixels;                        \
-    const int fbWidth = RLSW.framebuffer.width;                                 \
                                                                                 \
     const uint32_t xScale = ((uint32_t)wSrc << 16)/(uint32_t)wDst;              \
     const uint32_t yScale = ((uint32_t)hSrc << 16)/(uint32_t)hDst;              \
@@ -1591,13 +2272,11 @@ static inline void sw_framebuffer_blit_to_##name(
     for (int dy = 0; dy < hDst; dy++) {                                         \
         uint32_t yFix = ((uint32_t)ySrc << 16) + dy*yScale;                     \
         int sy = yFix >> 16;                                                    \
-        const sw_pixel_t *srcLine = srcBase + sy*fbWidth + xSrc;                \
-                                                                                \
-        const sw_pixel_t *srcPtr = srcLine;                                     \
+        const sw_color_t *srcPtr = sw_framebuffer_color_at(xSrc, sy);           \
         for (int dx = 0; dx < wDst; dx++) {                                     \
             uint32_t xFix = dx*xScale;                                          \
             int sx = xFix >> 16;                                                \
-            const sw_pixel_t *pixel = srcPtr + sx;                              \
+            const sw_color_t *pixel = srcPtr + sx;                              \
             uint8_t color[4];                                                   \
             sw_framebuffer_read_color8(color, pixel);
 
@@ -1725,6 +2404,11 @@ static inline int sw_get_pixel_format(SWformat format, SWtype type)
         default: return SW_PIXELFORMAT_UNKNOWN;
     }
 
+    // Packed types, all channels stored in a single value
+    if (type == SW_UNSIGNED_SHORT_5_6_5) return (channels == 3)? SW_PIXELFORMAT_UNCOMPRESSED_R5G6B5 : SW_PIXELFORMAT_UNKNOWN;
+    if (type == SW_UNSIGNED_SHORT_5_5_5_1) return (channels == 4)? SW_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1 : SW_PIXELFORMAT_UNKNOWN;
+    if (type == SW_UNSIGNED_SHORT_4_4_4_4) return (channels == 4)? SW_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4 : SW_PIXELFORMAT_UNKNOWN;
+
     // Determine the depth of each channel (type)
     switch (type)
     {
@@ -1900,97 +2584,279 @@ static inline void sw_get_pixel(uint8_t *color, const void *pixels, uint32_t off
 
 // Texture sampling functionality
 //-------------------------------------------------------------------------------------------
-static inline void sw_texture_fetch(float* color, const sw_texture_t* tex, int x, int y)
+// Get texel address in tiled level storage
+static inline const uint8_t *sw_texture_texel(const sw_texture_level_t *level, int x, int y)
+{
+    int tile = (y >> SW_TEXTURE_TILE_SHIFT)*level->tileStride + (x >> SW_TEXTURE_TILE_SHIFT);
+    int offset = (tile << (2*SW_TEXTURE_TILE_SHIFT)) + ((y & SW_TEXTURE_TILE_MASK) << SW_TEXTURE_TILE_SHIFT) + (x & SW_TEXTURE_TILE_MASK);
+
+    return &level->pixels[4*offset];
+}
+
+static inline void sw_texture_fetch(float* color, const sw_texture_level_t* level, int x, int y)
+{
+    sw_float_from_unorm8_simd(color, sw_texture_texel(level, x, y));
+}
+
+// Bilinear interpolation of four RGBA8 texels
+static inline void sw_texture_bilinear_simd(float color[4], const uint8_t *c00, const uint8_t *c10, const uint8_t *c01, const uint8_t *c11, float fx, float fy)
 {
-    sw_float_from_unorm8_simd(color, &tex->pixels[4*(y*tex->width + x)]);
+#if defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+    const __m128i zero = _mm_setzero_si128();
+
+    // Widen texels pairs to 16 bits, then to 32 bits floats
+    __m128i top = _mm_unpacklo_epi8(_mm_unpacklo_epi32(_mm_cvtsi32_si128(*(const int *)c00), _mm_cvtsi32_si128(*(const int *)c10)), zero);
+    __m128i bottom = _mm_unpacklo_epi8(_mm_unpacklo_epi32(_mm_cvtsi32_si128(*(const int *)c01), _mm_cvtsi32_si128(*(const int *)c11)), zero);
+
+    __m128 f00 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(top, zero));
+    __m128 f10 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(top, zero));
+    __m128 f01 = _mm_cvtepi32_ps(_mm_unpacklo_epi16(bottom, zero));
+    __m128 f11 = _mm_cvtepi32_ps(_mm_unpackhi_epi16(bottom, zero));
+
+    __m128 vfx = _mm_set1_ps(fx);
+    __m128 t = _mm_add_ps(f00, _mm_mul_ps(vfx, _mm_sub_ps(f10, f00)));
+    __m128 b = _mm_add_ps(f01, _mm_mul_ps(vfx, _mm_sub_ps(f11, f01)));
+    __m128 result = _mm_add_ps(t, _mm_mul_ps(_mm_set1_ps(fy), _mm_sub_ps(b, t)));
+
+    _mm_storeu_ps(color, _mm_mul_ps(result, _mm_set1_ps(SW_INV_255)));
+#elif defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
+    uint32x2_t topPair = vset_lane_u32(*(const uint32_t *)c10, vdup_n_u32(*(const uint32_t *)c00), 1);
+    uint32x2_t bottomPair = vset_lane_u32(*(const uint32_t *)c11, vdup_n_u32(*(const uint32_t *)c01), 1);
+
+    // Widen texels pairs to 16 bits, then to 32 bits floats
+    uint16x8_t top = vmovl_u8(vreinterpret_u8_u32(topPair));
+    uint16x8_t bottom = vmovl_u8(vreinterpret_u8_u32(bottomPair));
+
+    float32x4_t f00 = vcvtq_f32_u32(vmovl_u16(vget_low_u16(top)));
+    float32x4_t f10 = vcvtq_f32_u32(vmovl_u16(vget_high_u16(top)));
+    float32x4_t f01 = vcvtq_f32_u32(vmovl_u16(vget_low_u16(bottom)));
+    float32x4_t f11 = vcvtq_f32_u32(vmovl_u16(vget_high_u16(bottom)));
+
+    float32x4_t t = vmlaq_n_f32(f00, vsubq_f32(f10, f00), fx);
+    float32x4_t b = vmlaq_n_f32(f01, vsubq_f32(f11, f01), fx);
+    float32x4_t result = vmlaq_n_f32(t, vsubq_f32(b, t), fy);
+
+    vst1q_f32(color, vmulq_n_f32(result, SW_INV_255));
+#else
+    for (int i = 0; i < 4; i++)
+    {
+        float t = c00[i] + fx*(c10[i] - c00[i]);
+        float b = c01[i] + fx*(c11[i] - c01[i]);
+        color[i] = (t + fy*(b - t))*SW_INV_255;
+    }
+#endif
 }
 
-static inline void sw_texture_sample_nearest(float *color, const sw_texture_t *tex, float u, float v)
+static inline void sw_texture_sample_nearest(float *color, const sw_texture_t *tex, const sw_texture_level_t *level, float u, float v)
 {
     u = (tex->sWrap == SW_REPEAT)? sw_fract(u) : sw_saturate(u);
     v = (tex->tWrap == SW_REPEAT)? sw_fract(v) : sw_saturate(v);
 
-    int x = u*tex->width;
-    int y = v*tex->height;
+    int x = u*level->width;
+    int y = v*level->height;
+
+    // NOTE: Saturated texcoords of 1.0f map to the texel past the edge
+    x = (x > level->wMinus1)? level->wMinus1 : x;
+    y = (y > level->hMinus1)? level->hMinus1 : y;
 
-    sw_texture_fetch(color, tex, x, y);
+    sw_texture_fetch(color, level, x, y);
 }
 
-static inline void sw_texture_sample_linear(float *color, const sw_texture_t *tex, float u, float v)
+static inline void sw_texture_sample_linear(float *color, const sw_texture_t *tex, const sw_texture_level_t *level, float u, float v)
 {
-    // TODO: With a bit more cleverness we could clearly reduce the
-    // number of operations here, but for now it works fine
-
-    float xf = (u*tex->width) - 0.5f;
-    float yf = (v*tex->height) - 0.5f;
+    // Texcoords wrapped first, so texels indices stay in [-1, size] and no division is required
+    u = (tex->sWrap == SW_REPEAT)? sw_fract(u) : sw_saturate(u);
+    v = (tex->tWrap == SW_REPEAT)? sw_fract(v) : sw_saturate(v);
 
-    float fx = sw_fract(xf);
-    float fy = sw_fract(yf);
+    // NOTE: Sampling position offset by one texel, so truncation works as floor
+    float xf = (u*level->width) + 0.5f;
+    float yf = (v*level->height) + 0.5f;
 
-    int x0 = (int)xf;
-    int y0 = (int)yf;
+    int x1 = (int)xf;
+    int y1 = (int)yf;
 
-    int x1 = x0 + 1;
-    int y1 = y0 + 1;
+    float fx = xf - (float)x1;
+    float fy = yf - (float)y1;
 
-    // NOTE: If the textures are POT we could avoid the division for SW_REPEAT
+    int x0 = x1 - 1;
+    int y0 = y1 - 1;
 
     if (tex->sWrap == SW_CLAMP)
     {
-        x0 = (x0 > tex->wMinus1)? tex->wMinus1 : x0;
-        x1 = (x1 > tex->wMinus1)? tex->wMinus1 : x1;
+        x0 = (x0 < 0)? 0 : x0;
+        x1 = (x1 > level->wMinus1)? level->wMinus1 : x1;
     }
     else
     {
-        x0 = (x0%tex->width + tex->width)%tex->width;
-        x1 = (x1%tex->width + tex->width)%tex->width;
+        x0 = (x0 < 0)? level->wMinus1 : x0;
+        x1 = (x1 > level->wMinus1)? 0 : x1;
     }
 
     if (tex->tWrap == SW_CLAMP)
     {
-        y0 = (y0 > tex->hMinus1)? tex->hMinus1 : y0;
-        y1 = (y1 > tex->hMinus1)? tex->hMinus1 : y1;
+        y0 = (y0 < 0)? 0 : y0;
+        y1 = (y1 > level->hMinus1)? level->hMinus1 : y1;
     }
     else
     {
-        y0 = (y0%tex->height + tex->height)%tex->height;
-        y1 = (y1%tex->height + tex->height)%tex->height;
+        y0 = (y0 < 0)? level->hMinus1 : y0;
+        y1 = (y1 > level->hMinus1)? 0 : y1;
     }
 
-    float c00[4], c10[4], c01[4], c11[4];
-    sw_texture_fetch(c00, tex, x0, y0);
-    sw_texture_fetch(c10, tex, x1, y0);
-    sw_texture_fetch(c01, tex, x0, y1);
-    sw_texture_fetch(c11, tex, x1, y1);
+    sw_texture_bilinear_simd(color,
+        sw_texture_texel(level, x0, y0), sw_texture_texel(level, x1, y0),
+        sw_texture_texel(level, x0, y1), sw_texture_texel(level, x1, y1), fx, fy);
+}
 
-    for (int i = 0; i < 4; i++)
+static inline void sw_texture_sample_level(float *color, const sw_texture_t *tex, int level, bool linear, float u, float v)
+{
+    if (linear) sw_texture_sample_linear(color, tex, &tex->levels[level], u, v);
+    else sw_texture_sample_nearest(color, tex, &tex->levels[level], u, v);
+}
+
+// Get squared texels footprint of a pixel, the level of detail is half its log2
+// NOTE: Derivatives are shared by the pixels of a span (scanline) or a 2x2 quad (half-space),
+// so the level selection is done per span/quad
+static inline float sw_texture_footprint(const sw_texture_t *tex, float dUdx, float dUdy, float dVdx, float dVdy)
+{
+    float dUdxTex = dUdx*tex->width, dVdxTex = dVdx*tex->height;
+    float dUdyTex = dUdy*tex->width, dVdyTex = dVdy*tex->height;
+
+    float dx2 = dUdxTex*dUdxTex + dVdxTex*dVdxTex;
+    float dy2 = dUdyTex*dUdyTex + dVdyTex*dVdyTex;
+
+    return (dx2 > dy2)? dx2 : dy2;
+}
+
+static inline void sw_texture_sample(float *color, const sw_texture_t *tex, float u, float v, float dUdx, float dUdy, float dVdx, float dVdy)
+{
+    float rho2 = sw_texture_footprint(tex, dUdx, dUdy, dVdx, dVdy);
+
+    // Magnification, texels larger than pixels
+    if (rho2 <= 1.0f)
     {
-        float t = c00[i] + fx*(c10[i] - c00[i]);
-        float b = c01[i] + fx*(c11[i] - c01[i]);
-        color[i] = t + fy*(b - t);
+        sw_texture_sample_level(color, tex, 0, (tex->magFilter == SW_LINEAR), u, v);
+        return;
+    }
+
+    // Minification without mipmaps, level of detail not required
+    if ((tex->minFilter == SW_NEAREST) || (tex->minFilter == SW_LINEAR))
+    {
+        sw_texture_sample_level(color, tex, 0, (tex->minFilter == SW_LINEAR), u, v);
+        return;
+    }
+
+    // NOTE: No need to compute the square root, log2(sqrt(x)) == 0.5f*log2(x)
+    float lod = 0.5f*sw_log2(rho2);
+    int maxLevel = tex->levelCount - 1;
+
+    switch (tex->minFilter)
+    {
+        case SW_NEAREST_MIPMAP_NEAREST:
+        case SW_LINEAR_MIPMAP_NEAREST:
+        {
+            int level = sw_clampi((int)(lod + 0.5f), 0, maxLevel);
+            sw_texture_sample_level(color, tex, level, (tex->minFilter == SW_LINEAR_MIPMAP_NEAREST), u, v);
+        } break;
+        case SW_NEAREST_MIPMAP_LINEAR:
+        case SW_LINEAR_MIPMAP_LINEAR:
+        default:
+        {
+            // Trilinear filtering, blend samples of the two nearest levels
+            bool linear = (tex->minFilter == SW_LINEAR_MIPMAP_LINEAR);
+            int level = (int)lod;
+
+            if (level >= maxLevel)
+            {
+                sw_texture_sample_level(color, tex, maxLevel, linear, u, v);
+                break;
+            }
+
+            float color1[4];
+            float t = lod - (float)level;
+            sw_texture_sample_level(color, tex, level, linear, u, v);
+            sw_texture_sample_level(color1, tex, level + 1, linear, u, v);
+
+            color[0] += t*(color1[0] - color[0]);
+            color[1] += t*(color1[1] - color[1]);
+            color[2] += t*(color1[2] - color[2]);
+            color[3] += t*(color1[3] - color[3]);
+        } break;
     }
 }
 
-static inline void sw_texture_sample(float *color, const sw_texture_t *tex, float u, float v, float dUdx, float dUdy, float dVdx, float dVdy)
+// Texture sampling specialized for a raster variant texture mode, known at compile time
+static inline void sw_texture_sample_mode(float *color, const sw_texture_t *tex, float u, float v, float dUdx, float dUdy, float dVdx, float dVdy, int mode)
+{
+    switch (mode)
+    {
+        case SW_RASTER_TEX_NEAREST: sw_texture_sample_nearest(color, tex, &tex->levels[0], u, v); break;
+        case SW_RASTER_TEX_LINEAR: sw_texture_sample_linear(color, tex, &tex->levels[0], u, v); break;
+        default: sw_texture_sample(color, tex, u, v, dUdx, dUdy, dVdx, dVdy); break;
+    }
+}
+
+// Resize texture pixels storage to hold levels [0, levelCount), levels stored one after another
+// NOTE: Levels offsets only depend on texture dimensions, existing levels are preserved
+static bool sw_texture_alloc_levels(sw_texture_t *texture, int levelCount)
 {
-    // Previous method: There is no need to compute the square root
-    // because using the squared value, the comparison remains `L2 > 1.0f*1.0f`
-    //float du = sqrtf(dUdx*dUdx + dUdy*dUdy);
-    //float dv = sqrtf(dVdx*dVdx + dVdy*dVdy);
-    //float L = (du > dv)? du : dv;
+    sw_texture_level_t levels[SW_TEXTURE_MAX_LEVELS] = { 0 };
+    size_t offsets[SW_TEXTURE_MAX_LEVELS] = { 0 };
+    size_t size = 0;
+
+    for (int i = 0; i < levelCount; i++)
+    {
+        int width = ((texture->width >> i) > 0)? (texture->width >> i) : 1;
+        int height = ((texture->height >> i) > 0)? (texture->height >> i) : 1;
+        int tileRows = (height + SW_TEXTURE_TILE_MASK) >> SW_TEXTURE_TILE_SHIFT;
+
+        levels[i].width = width;
+        levels[i].height = height;
+        levels[i].wMinus1 = width - 1;
+        levels[i].hMinus1 = height - 1;
+        levels[i].tileStride = (width + SW_TEXTURE_TILE_MASK) >> SW_TEXTURE_TILE_SHIFT;
+
+        offsets[i] = size;
+        size += 4*(size_t)levels[i].tileStride*tileRows*SW_TEXTURE_TILE_SIZE*SW_TEXTURE_TILE_SIZE;
+    }
 
-    // Calculate the derivatives for each axis
-    float dU2 = dUdx*dUdx + dUdy*dUdy;
-    float dV2 = dVdx*dVdx + dVdy*dVdy;
-    float L2 = (dU2 > dV2)? dU2 : dV2;
+    // NOTE: Extra bytes at the end, texels could be loaded with 8 bytes reads
+    uint8_t *pixels = (uint8_t *)SW_REALLOC(texture->pixels, size + 4);
+    if (pixels == NULL) return false;
 
-    SWfilter filter = (L2 > 1.0f)? tex->minFilter : tex->magFilter;
+    texture->pixels = pixels;
+    texture->levelCount = levelCount;
 
-    switch (filter)
+    for (int i = 0; i < levelCount; i++)
     {
-        case SW_NEAREST: sw_texture_sample_nearest(color, tex, u, v); break;
-        case SW_LINEAR: sw_texture_sample_linear(color, tex, u, v); break;
-        default: break;
+        texture->levels[i] = levels[i];
+        texture->levels[i].pixels = pixels + offsets[i];
+    }
+
+    return true;
+}
+
+// Generate a texture level from the previous one, 2x2 box filter
+static void sw_texture_downsample(const sw_texture_level_t *dst, const sw_texture_level_t *src)
+{
+    for (int y = 0; y < dst->height; y++)
+    {
+        int y0 = sw_clampi(2*y, 0, src->hMinus1);
+        int y1 = sw_clampi(2*y + 1, 0, src->hMinus1);
+
+        for (int x = 0; x < dst->width; x++)
+        {
+            int x0 = sw_clampi(2*x, 0, src->wMinus1);
+            int x1 = sw_clampi(2*x + 1, 0, src->wMinus1);
+
+            const uint8_t *c00 = sw_texture_texel(src, x0, y0);
+            const uint8_t *c10 = sw_texture_texel(src, x1, y0);
+            const uint8_t *c01 = sw_texture_texel(src, x0, y1);
+            const uint8_t *c11 = sw_texture_texel(src, x1, y1);
+            uint8_t *texel = (uint8_t *)sw_texture_texel(dst, x, y);
+
+            for (int i = 0; i < 4; i++) texel[i] = (uint8_t)((c00[i] + c10[i] + c01[i] + c11[i] + 2) >> 2);
+        }
     }
 }
 //-------------------------------------------------------------------------------------------
@@ -2069,6 +2935,35 @@ static inline void sw_blend_colors(float *SW_RESTRICT dst/*[4]*/, const float *S
     dst[2] = srcFactor[2]*src[2] + dstFactor[2]*dst[2];
     dst[3] = srcFactor[3]*src[3] + dstFactor[3]*dst[3];
 }
+
+static inline void sw_blend_colors_alpha(float *SW_RESTRICT dst/*[4]*/, const float *SW_RESTRICT src/*[4]*/)
+{
+    float invAlpha = 1.0f - src[3];
+
+    dst[0] = src[3]*src[0] + invAlpha*dst[0];
+    dst[1] = src[3]*src[1] + invAlpha*dst[1];
+    dst[2] = src[3]*src[2] + invAlpha*dst[2];
+    dst[3] = src[3]*src[3] + invAlpha*dst[3];
+}
+
+static inline void sw_blend_colors_additive(float *SW_RESTRICT dst/*[4]*/, const float *SW_RESTRICT src/*[4]*/)
+{
+    dst[0] = src[3]*src[0] + dst[0];
+    dst[1] = src[3]*src[1] + dst[1];
+    dst[2] = src[3]*src[2] + dst[2];
+    dst[3] = src[3]*src[3] + dst[3];
+}
+
+// Color blending specialized for a raster variant blend mode, known at compile time
+static inline void sw_blend_colors_mode(float *SW_RESTRICT dst/*[4]*/, const float *SW_RESTRICT src/*[4]*/, int mode)
+{
+    switch (mode)
+    {
+        case SW_RASTER_BLEND_ALPHA: sw_blend_colors_alpha(dst, src); break;
+        case SW_RASTER_BLEND_ADDITIVE: sw_blend_colors_additive(dst, src); break;
+        default: sw_blend_colors(dst, src); break;
+    }
+}
 //-------------------------------------------------------------------------------------------
 
 // Projection helper functions
@@ -2160,6 +3055,30 @@ DEFINE_CLIP_FUNC(scissor_y_min, IS_INSIDE_SCISSOR_Y_MIN, COMPUTE_T_SCISSOR_Y_MIN
 DEFINE_CLIP_FUNC(scissor_y_max, IS_INSIDE_SCISSOR_Y_MAX, COMPUTE_T_SCISSOR_Y_MAX)
 //-------------------------------------------------------------------------------------------
 
+// Get the clip planes a clip space position is outside of, one bit per plane
+static inline int sw_clip_code(const float h[4], bool scissor)
+{
+    int code = 0;
+
+    if (!IS_INSIDE_PLANE_W(h)) code |= (1 << 0);
+    if (!IS_INSIDE_PLANE_X_POS(h)) code |= (1 << 1);
+    if (!IS_INSIDE_PLANE_X_NEG(h)) code |= (1 << 2);
+    if (!IS_INSIDE_PLANE_Y_POS(h)) code |= (1 << 3);
+    if (!IS_INSIDE_PLANE_Y_NEG(h)) code |= (1 << 4);
+    if (!IS_INSIDE_PLANE_Z_POS(h)) code |= (1 << 5);
+    if (!IS_INSIDE_PLANE_Z_NEG(h)) code |= (1 << 6);
+
+    if (scissor)
+    {
+        if (!IS_INSIDE_SCISSOR_X_MIN(h)) code |= (1 << 7);
+        if (!IS_INSIDE_SCISSOR_X_MAX(h)) code |= (1 << 8);
+        if (!IS_INSIDE_SCISSOR_Y_MIN(h)) code |= (1 << 9);
+        if (!IS_INSIDE_SCISSOR_Y_MAX(h)) code |= (1 << 10);
+    }
+
+    return code;
+}
+
 // Main polygon clip function
 static inline bool sw_polygon_clip(sw_vertex_t polygon[SW_MAX_CLIPPED_POLYGON_VERTICES], int *vertexCounter)
 {
@@ -2167,6 +3086,24 @@ static inline bool sw_polygon_clip(sw_vertex_t polygon[SW_MAX_CLIPPED_POLYGON_VE
 
     int n = *vertexCounter;
 
+    // Trivial accept or reject, polygon inside all the planes or outside one of them
+    bool scissor = (RLSW.stateFlags & SW_STATE_SCISSOR_TEST);
+    int codeOr = 0, codeAnd = ~0;
+    for (int i = 0; i < n; i++)
+    {
+        int code = sw_clip_code(polygon[i].homogeneous, scissor);
+        codeOr |= code;
+        codeAnd &= code;
+    }
+
+    if (codeAnd != 0)
+    {
+        *vertexCounter = 0;
+        return false;
+    }
+
+    if (codeOr == 0) return (n >= 3);
+
     #define CLIP_AGAINST_PLANE(FUNC_CLIP)                       \
     {                                                           \
         n = FUNC_CLIP(tmp, polygon, n);                         \
@@ -2285,8 +3222,98 @@ static inline void sw_triangle_clip_and_project(void)
     }
 }
 
-#define DEFINE_TRIANGLE_RASTER_SCANLINE(FUNC_NAME, ENABLE_TEXTURE, ENABLE_DEPTH_TEST, ENABLE_COLOR_BLEND) \
-static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,     \
+#if SW_DEPTH_TILES
+// Test span pixels [x, runEnd) inside a depth tile, interpolated depth z at pixel x
+// Returns true if the pixels are occluded, otherwise they are added to the tile layer
+static inline bool sw_depth_tile_span(int x, int xEnd, int y, float z, float dZdx, int *runEnd)
+{
+    int end = (x | SW_DEPTH_TILE_MASK) + 1;
+    if (end > xEnd) end = xEnd;
+    *runEnd = end;
+
+    float zLast = z + dZdx*(float)(end - 1 - x);
+    int tx = x >> SW_DEPTH_TILE_SHIFT;
+    int ty = y >> SW_DEPTH_TILE_SHIFT;
+
+    if (sw_depth_tile_occluded(tx, ty, (zLast < z)? zLast : z)) return true;
+
+    uint64_t rowMask = ((1u << (end - x)) - 1) << (x & SW_DEPTH_TILE_MASK);
+    sw_depth_tile_cover(tx, ty, rowMask << ((y & SW_DEPTH_TILE_MASK) << SW_DEPTH_TILE_SHIFT), (zLast > z)? zLast : z);
+
+    return false;
+}
+
+// Check if a triangle is behind all the depth tiles it overlaps in rows [y0, y1)
+// NOTE: Interpolated depths are never closer than the closest vertex depth
+static inline bool sw_depth_tiles_triangle_occluded(const sw_vertex_t *v0, const sw_vertex_t *v1, const sw_vertex_t *v2, int y0, int y1)
+{
+    if (!RLSW.framebuffer.depthTilesValid || (y0 >= y1)) return false;
+
+    float xMin = fminf(v0->screen[0], fminf(v1->screen[0], v2->screen[0]));
+    float xMax = fmaxf(v0->screen[0], fmaxf(v1->screen[0], v2->screen[0]));
+    float depth = fminf(v0->homogeneous[2], fminf(v1->homogeneous[2], v2->homogeneous[2]));
+
+    int tx0 = sw_clampi((int)xMin, 0, RLSW.framebuffer.width - 1) >> SW_DEPTH_TILE_SHIFT;
+    int tx1 = sw_clampi((int)xMax, 0, RLSW.framebuffer.width - 1) >> SW_DEPTH_TILE_SHIFT;
+    int ty0 = sw_clampi(y0, 0, RLSW.framebuffer.height - 1) >> SW_DEPTH_TILE_SHIFT;
+    int ty1 = sw_clampi(y1 - 1, 0, RLSW.framebuffer.height - 1) >> SW_DEPTH_TILE_SHIFT;
+
+    for (int ty = ty0; ty <= ty1; ty++)
+    {
+        for (int tx = tx0; tx <= tx1; tx++)
+        {
+            if (!sw_depth_tile_occluded(tx, ty, depth)) return false;
+        }
+    }
+
+    return true;
+}
+
+// Check if all span pixels [x, xEnd) are occluded, interpolated depth z at pixel x
+static inline bool sw_depth_tile_span_occluded(int x, int xEnd, int y, float z, float dZdx)
+{
+    if (!RLSW.framebuffer.depthTilesValid) return false;
+
+    int ty = y >> SW_DEPTH_TILE_SHIFT;
+
+    for (int runStart = x; runStart < xEnd; )
+    {
+        int end = (runStart | SW_DEPTH_TILE_MASK) + 1;
+        if (end > xEnd) end = xEnd;
+
+        float zFirst = z + dZdx*(float)(runStart - x);
+        float zLast = z + dZdx*(float)(end - 1 - x);
+
+        if (!sw_depth_tile_occluded(runStart >> SW_DEPTH_TILE_SHIFT, ty, (zLast < zFirst)? zLast : zFirst)) return false;
+
+        runStart = end;
+    }
+
+    return true;
+}
+#else
+static inline bool sw_depth_tile_span(int x, int xEnd, int y, float z, float dZdx, int *runEnd)
+{
+    (void)x; (void)y; (void)z; (void)dZdx;
+    *runEnd = xEnd;
+    return false;
+}
+
+static inline bool sw_depth_tile_span_occluded(int x, int xEnd, int y, float z, float dZdx)
+{
+    (void)x; (void)xEnd; (void)y; (void)z; (void)dZdx;
+    return false;
+}
+
+static inline bool sw_depth_tiles_triangle_occluded(const sw_vertex_t *v0, const sw_vertex_t *v1, const sw_vertex_t *v2, int y0, int y1)
+{
+    (void)v0; (void)v1; (void)v2; (void)y0; (void)y1;
+    return false;
+}
+#endif
+
+#define DEFINE_TRIANGLE_RASTER_SCANLINE(FUNC_NAME, TEXTURE_MODE, ENABLE_DEPTH_TEST, BLEND_MODE) \
+static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,     \
                              const sw_vertex_t *end, float dUdy, float dVdy)        \
 {                                                                                   \
     /* Gets the start and end coordinates */                                        \
@@ -2315,7 +3342,7 @@ static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,
                                                                                     \
     float dUdx = 0.0f;                                                              \
     float dVdx = 0.0f;                                                              \
-    if (ENABLE_TEXTURE) {                                                           \
+    if (TEXTURE_MODE) {                                                             \
         dUdx = (end->texcoord[0] - start->texcoord[0])*dxRcp;                       \
         dVdx = (end->texcoord[1] - start->texcoord[1])*dxRcp;                       \
     }                                                                               \
@@ -2333,58 +3360,117 @@ static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,
                                                                                     \
     float u = 0.0f;                                                                 \
     float v = 0.0f;                                                                 \
-    if (ENABLE_TEXTURE) {                                                           \
+    if (TEXTURE_MODE) {                                                             \
         u = start->texcoord[0] + dUdx*xSubstep;                                     \
         v = start->texcoord[1] + dVdx*xSubstep;                                     \
     }                                                                               \
                                                                                     \
     /* Pre-calculate the starting pointers for the framebuffer row */               \
     int y = (int)start->screen[1];                                                  \
-    sw_pixel_t *ptr = RLSW.framebuffer.pixels + y*RLSW.framebuffer.width + xStart;  \
+    if (ENABLE_DEPTH_TEST && sw_depth_tile_span_occluded(xStart, xEnd, y, z, dZdx)) return; \
+    sw_color_t *cptr = sw_framebuffer_color_at(xStart, y);                          \
+    sw_depth_t *dptr = sw_framebuffer_depth_at(xStart, y);                          \
+                                                                                    \
+    /* Pixels run in the current depth tile, occluded runs skip the pixels work */  \
+    int runEnd = xStart;                                                            \
+    bool runOccluded = false;                                                       \
+                                                                                    \
+    /* Perspective-correct attributes, divided by w at the spans ends and */        \
+    /* linearly interpolated in between, no division if w is constant */            \
+    bool affine = (dWdx == 0.0f);                                                   \
+    float wRcpAffine = 1.0f/w;                                                      \
+    int spanEnd = xStart;                                                           \
+    float srcBase[4] = { 0 }, srcBaseEnd[4] = { 0 }, dSrcdx[4] = { 0 };             \
+    float s = 0.0f, t = 0.0f, sEnd = 0.0f, tEnd = 0.0f, dSdx = 0.0f, dTdx = 0.0f;   \
                                                                                     \
     /* Scanline rasterization */                                                    \
     for (int x = xStart; x < xEnd; x++)                                             \
     {                                                                               \
-        float wRcp = 1.0f/w;                                                        \
-        float srcColor[4] = {                                                       \
-            color[0]*wRcp,                                                          \
-            color[1]*wRcp,                                                          \
-            color[2]*wRcp,                                                          \
-            color[3]*wRcp                                                           \
-        };                                                                          \
+        if (x == spanEnd)                                                           \
+        {                                                                           \
+            if (affine)                                                             \
+            {                                                                       \
+                for (int i = 0; i < 4; i++) srcBase[i] = color[i]*wRcpAffine;       \
+                if (TEXTURE_MODE) { s = u*wRcpAffine; t = v*wRcpAffine; }           \
+                spanEnd = x + 1;                                                    \
+            }                                                                       \
+            else                                                                    \
+            {                                                                       \
+                /* Span start is previous span end, divided once per span */        \
+                if (x == xStart)                                                    \
+                {                                                                   \
+                    float wRcp = sw_rcp(w);                                         \
+                    for (int i = 0; i < 4; i++) srcBase[i] = color[i]*wRcp;         \
+                    if (TEXTURE_MODE) { s = u*wRcp; t = v*wRcp; }                   \
+                }                                                                   \
+                else                                                                \
+                {                                                                   \
+                    for (int i = 0; i < 4; i++) srcBase[i] = srcBaseEnd[i];         \
+                    if (TEXTURE_MODE) { s = sEnd; t = tEnd; }                       \
+                }                                                                   \
+                                                                                    \
+                int n = xEnd - x;                                                   \
+                if (n > SW_PERSPECTIVE_SPAN) n = SW_PERSPECTIVE_SPAN;               \
+                float nRcp = 1.0f/n;                                                \
+                float wRcpEnd = sw_rcp(w + dWdx*n);                                 \
+                                                                                    \
+                for (int i = 0; i < 4; i++)                                         \
+                {                                                                   \
+                    srcBaseEnd[i] = (color[i] + dCdx[i]*n)*wRcpEnd;                 \
+                    dSrcdx[i] = (srcBaseEnd[i] - srcBase[i])*nRcp;                  \
+                }                                                                   \
+                if (TEXTURE_MODE)                                                   \
+                {                                                                   \
+                    sEnd = (u + dUdx*n)*wRcpEnd;                                    \
+                    tEnd = (v + dVdx*n)*wRcpEnd;                                    \
+                    dSdx = (sEnd - s)*nRcp;                                         \
+                    dTdx = (tEnd - t)*nRcp;                                         \
+                }                                                                   \
+                spanEnd = x + n;                                                    \
+            }                                                                       \
+        }                                                                           \
                                                                                     \
         if (ENABLE_DEPTH_TEST)                                                      \
         {                                                                           \
+            if (x == runEnd) runOccluded = sw_depth_tile_span(x, xEnd, y, z, dZdx, &runEnd); \
+            if (runOccluded) goto discard;                                          \
+                                                                                    \
             /* TODO: Implement different depth funcs? */                            \
-            float depth =  sw_framebuffer_read_depth(ptr);                          \
+            float depth =  sw_framebuffer_read_depth(dptr);                         \
             if (z > depth) goto discard;                                            \
         }                                                                           \
                                                                                     \
         /* TODO: Implement depth mask */                                            \
-        sw_framebuffer_write_depth(ptr, z);                                         \
+        sw_framebuffer_write_depth(dptr, z);                                        \
                                                                                     \
-        if (ENABLE_TEXTURE)                                                         \
+        float srcColor[4] = {                                                       \
+            srcBase[0],                                                             \
+            srcBase[1],                                                             \
+            srcBase[2],                                                             \
+            srcBase[3]                                                              \
+        };                                                                          \
+                                                                                    \
+        if (TEXTURE_MODE)                                                           \
         {                                                                           \
             float texColor[4];                                                      \
-            float s = u*wRcp;                                                       \
-            float t = v*wRcp;                                                       \
-            sw_texture_sample(texColor, tex, s, t, dUdx, dUdy, dVdx, dVdy);         \
+            sw_texture_sample_mode(texColor, tex, s, t,                             \
+                                   dUdx, dUdy, dVdx, dVdy, TEXTURE_MODE);           \
             srcColor[0] *= texColor[0];                                             \
             srcColor[1] *= texColor[1];                                             \
             srcColor[2] *= texColor[2];                                             \
             srcColor[3] *= texColor[3];                                             \
         }                                                                           \
                                                                                     \
-        if (ENABLE_COLOR_BLEND)                                                     \
+        if (BLEND_MODE)                                                             \
         {                                                                           \
             float dstColor[4];                                                      \
-            sw_framebuffer_read_color(dstColor, ptr);                               \
-            sw_blend_colors(dstColor, srcColor);                                    \
-            sw_framebuffer_write_color(ptr, dstColor);                              \
+            sw_framebuffer_read_color(dstColor, cptr);                              \
+            sw_blend_colors_mode(dstColor, srcColor, BLEND_MODE);                   \
+            sw_framebuffer_write_color(cptr, dstColor);                             \
         }                                                                           \
         else                                                                        \
         {                                                                           \
-            sw_framebuffer_write_color(ptr, srcColor);                              \
+            sw_framebuffer_write_color(cptr, srcColor);                             \
         }                                                                           \
                                                                                     \
         /* Increment the interpolation parameter, UVs, and pointers */              \
@@ -2395,18 +3481,28 @@ static inline void FUNC_NAME(const sw_texture_t *tex, const sw_vertex_t *start,
         color[1] += dCdx[1];                                                        \
         color[2] += dCdx[2];                                                        \
         color[3] += dCdx[3];                                                        \
-        if (ENABLE_TEXTURE)                                                         \
+        if (TEXTURE_MODE)                                                           \
         {                                                                           \
             u += dUdx;                                                              \
             v += dVdx;                                                              \
         }                                                                           \
-        ++ptr;                                                                      \
+        srcBase[0] += dSrcdx[0];                                                    \
+        srcBase[1] += dSrcdx[1];                                                    \
+        srcBase[2] += dSrcdx[2];                                                    \
+        srcBase[3] += dSrcdx[3];                                                    \
+        if (TEXTURE_MODE)                                                           \
+        {                                                                           \
+            s += dSdx;                                                              \
+            t += dTdx;                                                              \
+        }                                                                           \
+        ++cptr; ++dptr;                                                             \
     }                                                                               \
 }
 
-#define DEFINE_TRIANGLE_RASTER(FUNC_NAME, FUNC_SCANLINE, ENABLE_TEXTURE)            \
+#define DEFINE_TRIANGLE_RASTER(FUNC_NAME, FUNC_SCANLINE, TEXTURE_MODE, ENABLE_DEPTH_TEST) \
 static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1,          \
-                             const sw_vertex_t *v2, const sw_texture_t *tex)        \
+                             const sw_vertex_t *v2, const sw_texture_t *tex,        \
+                             int rowMin, int rowMax)                                \
 {                                                                                   \
     /* Swap vertices by increasing y */                                             \
     if (v0->screen[1] > v1->screen[1]) { const sw_vertex_t *tmp = v0; v0 = v1; v1 = tmp; } \
@@ -2444,6 +3540,12 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1,
     int yMid = (int)y1;                                                             \
     int yBot = (int)y2;                                                             \
                                                                                     \
+    /* Skip triangles outside of the rows range to rasterize (tile) */              \
+    if ((yBot <= rowMin) || (yTop >= rowMax)) return;                               \
+                                                                                    \
+    /* Skip triangles behind all the depth tiles they overlap */                    \
+    if (ENABLE_DEPTH_TEST && sw_depth_tiles_triangle_occluded(v0, v1, v2, (yTop > rowMin)? yTop : rowMin, (yBot < rowMax)? yBot : rowMax)) return; \
+                                                                                    \
     /* Compute gradients for each side of the triangle */                           \
     sw_vertex_t dVXdy02, dVXdy01, dVXdy12;                                          \
     sw_get_vertex_grad_PTCH(&dVXdy02, v0, v2, h02Rcp);                              \
@@ -2455,62 +3557,895 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1,
     sw_add_vertex_grad_scaled_PTCH(&vLeft, &dVXdy02, y0Substep);                    \
     sw_add_vertex_grad_scaled_PTCH(&vRight, &dVXdy01, y0Substep);                   \
                                                                                     \
-    vLeft.screen[0] += dXdy02*y0Substep;                                            \
-    vRight.screen[0] += dXdy01*y0Substep;                                           \
+    vLeft.screen[0] += dXdy02*y0Substep;                                            \
+    vRight.screen[0] += dXdy01*y0Substep;                                           \
+                                                                                    \
+    /* Skip the upper rows outside of the rows range */                             \
+    /* NOTE: Gradients added per row, interpolation must match the unrestricted one */\
+    int y = yTop;                                                                   \
+    int ySkip = (rowMin < yMid)? rowMin : yMid;                                     \
+    for (; y < ySkip; y++)                                                          \
+    {                                                                               \
+        sw_add_vertex_grad_PTCH(&vLeft, &dVXdy02);                                  \
+        vLeft.screen[0] += dXdy02;                                                  \
+        sw_add_vertex_grad_PTCH(&vRight, &dVXdy01);                                 \
+        vRight.screen[0] += dXdy01;                                                 \
+    }                                                                               \
+                                                                                    \
+    /* Scanline for the upper part of the triangle */                               \
+    int yEnd = (yMid < rowMax)? yMid : rowMax;                                      \
+    for (; y < yEnd; y++)                                                           \
+    {                                                                               \
+        vLeft.screen[1] = vRight.screen[1] = y;                                     \
+                                                                                    \
+        if (vLeft.screen[0] < vRight.screen[0]) FUNC_SCANLINE(tex, &vLeft, &vRight, dVXdy02.texcoord[0], dVXdy02.texcoord[1]); \
+        else FUNC_SCANLINE(tex, &vRight, &vLeft, dVXdy02.texcoord[0], dVXdy02.texcoord[1]); \
+                                                                                    \
+        sw_add_vertex_grad_PTCH(&vLeft, &dVXdy02);                                  \
+        vLeft.screen[0] += dXdy02;                                                  \
+                                                                                    \
+        sw_add_vertex_grad_PTCH(&vRight, &dVXdy01);                                 \
+        vRight.screen[0] += dXdy01;                                                 \
+    }                                                                               \
+                                                                                    \
+    if (yMid >= rowMax) return;                                                     \
+                                                                                    \
+    /* Get a copy of next right for interpolation and apply substep correction */   \
+    vRight = *v1;                                                                   \
+    sw_add_vertex_grad_scaled_PTCH(&vRight, &dVXdy12, y1Substep);                   \
+    vRight.screen[0] += dXdy12*y1Substep;                                           \
+                                                                                    \
+    /* Skip the lower rows outside of the rows range */                             \
+    for (; y < rowMin; y++)                                                         \
+    {                                                                               \
+        sw_add_vertex_grad_PTCH(&vLeft, &dVXdy02);                                  \
+        vLeft.screen[0] += dXdy02;                                                  \
+        sw_add_vertex_grad_PTCH(&vRight, &dVXdy12);                                 \
+        vRight.screen[0] += dXdy12;                                                 \
+    }                                                                               \
+                                                                                    \
+    /* Scanline for the lower part of the triangle */                               \
+    yEnd = (yBot < rowMax)? yBot : rowMax;                                          \
+    for (; y < yEnd; y++)                                                           \
+    {                                                                               \
+        vLeft.screen[1] = vRight.screen[1] = y;                                     \
+                                                                                    \
+        if (vLeft.screen[0] < vRight.screen[0]) FUNC_SCANLINE(tex, &vLeft, &vRight, dVXdy02.texcoord[0], dVXdy02.texcoord[1]); \
+        else FUNC_SCANLINE(tex, &vRight, &vLeft, dVXdy02.texcoord[0], dVXdy02.texcoord[1]); \
+                                                                                    \
+        sw_add_vertex_grad_PTCH(&vLeft, &dVXdy02);                                  \
+        vLeft.screen[0] += dXdy02;                                                  \
+                                                                                    \
+        sw_add_vertex_grad_PTCH(&vRight, &dVXdy12);                                 \
+        vRight.screen[0] += dXdy12;                                                 \
+    }                                                                               \
+}
+
+// Scanline and triangle raster functions of a variant
+#define DEFINE_TRIANGLE_RASTER_VARIANT(NAME, T, D, B) \
+    DEFINE_TRIANGLE_RASTER_SCANLINE(SW_RASTER_VARIANT_NAME(NAME##_scanline, T, D, B), T, D, B) \
+    DEFINE_TRIANGLE_RASTER(SW_RASTER_VARIANT_NAME(NAME, T, D, B), SW_RASTER_VARIANT_NAME(NAME##_scanline, T, D, B), T, D)
+
+SW_RASTER_VARIANTS(DEFINE_TRIANGLE_RASTER_VARIANT, sw_triangle_raster)
+
+#if SW_RASTER_HALF_SPACE
+// Half-space triangle rasterization
+// NOTE: Edge functions are evaluated on blocks of SW_HS_BLOCK_WIDTH x 2 pixels, one pixel per lane,
+// so every 2x2 pixels quad provides the screen-space derivatives required for texture sampling
+#if defined(SW_HAS_AVX2) || defined(SW_HAS_FMA_AVX2)
+    #define SW_HS_LANES 8
+    typedef __m256 sw_hs_vec_t;
+    static inline sw_hs_vec_t sw_hs_set1(float x) { return _mm256_set1_ps(x); }
+    static inline sw_hs_vec_t sw_hs_load(const float *p) { return _mm256_load_ps(p); }
+    static inline void sw_hs_store(float *p, sw_hs_vec_t a) { _mm256_store_ps(p, a); }
+    static inline sw_hs_vec_t sw_hs_add(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm256_add_ps(a, b); }
+    static inline sw_hs_vec_t sw_hs_sub(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm256_sub_ps(a, b); }
+    static inline sw_hs_vec_t sw_hs_mul(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm256_mul_ps(a, b); }
+    static inline sw_hs_vec_t sw_hs_div(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm256_div_ps(a, b); }
+#if (SW_PERSPECTIVE_SPAN > 1)
+    static inline sw_hs_vec_t sw_hs_rcp(sw_hs_vec_t a)
+    {
+        __m256 r = _mm256_rcp_ps(a);
+        return _mm256_mul_ps(r, _mm256_sub_ps(_mm256_set1_ps(2.0f), _mm256_mul_ps(a, r)));
+    }
+#else
+    static inline sw_hs_vec_t sw_hs_rcp(sw_hs_vec_t a) { return _mm256_div_ps(_mm256_set1_ps(1.0f), a); }
+#endif
+    static inline sw_hs_vec_t sw_hs_min(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm256_min_ps(a, b); }
+    static inline sw_hs_vec_t sw_hs_max(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm256_max_ps(a, b); }
+    static inline int sw_hs_gt(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ)); }
+    static inline int sw_hs_le(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LE_OQ)); }
+    static inline void sw_hs_pack_unorm8(uint32_t *dst, const sw_hs_vec_t *color)
+    {
+        const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f), scale = _mm256_set1_ps(255.0f);
+        __m256i r = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(color[0], zero), one), scale));
+        __m256i g = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(color[1], zero), one), scale));
+        __m256i b = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(color[2], zero), one), scale));
+        __m256i a = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(color[3], zero), one), scale));
+        __m256i rg = _mm256_or_si256(r, _mm256_slli_epi32(g, 8));
+        __m256i ba = _mm256_or_si256(_mm256_slli_epi32(b, 16), _mm256_slli_epi32(a, 24));
+        _mm256_store_si256((__m256i *)dst, _mm256_or_si256(rg, ba));
+    }
+    static inline void sw_hs_unpack_unorm8(sw_hs_vec_t *color, const uint32_t *src)
+    {
+        const __m256i mask = _mm256_set1_epi32(0xFF);
+        const __m256 scale = _mm256_set1_ps(SW_INV_255);
+        __m256i packed = _mm256_load_si256((const __m256i *)src);
+        color[0] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(packed, mask)), scale);
+        color[1] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(packed, 8), mask)), scale);
+        color[2] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(packed, 16), mask)), scale);
+        color[3] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(packed, 24)), scale);
+    }
+#elif defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+    #define SW_HS_LANES 4
+    typedef __m128 sw_hs_vec_t;
+    static inline sw_hs_vec_t sw_hs_set1(float x) { return _mm_set1_ps(x); }
+    static inline sw_hs_vec_t sw_hs_load(const float *p) { return _mm_load_ps(p); }
+    static inline void sw_hs_store(float *p, sw_hs_vec_t a) { _mm_store_ps(p, a); }
+    static inline sw_hs_vec_t sw_hs_add(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm_add_ps(a, b); }
+    static inline sw_hs_vec_t sw_hs_sub(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm_sub_ps(a, b); }
+    static inline sw_hs_vec_t sw_hs_mul(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm_mul_ps(a, b); }
+    static inline sw_hs_vec_t sw_hs_div(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm_div_ps(a, b); }
+#if (SW_PERSPECTIVE_SPAN > 1)
+    static inline sw_hs_vec_t sw_hs_rcp(sw_hs_vec_t a)
+    {
+        __m128 r = _mm_rcp_ps(a);
+        return _mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(2.0f), _mm_mul_ps(a, r)));
+    }
+#else
+    static inline sw_hs_vec_t sw_hs_rcp(sw_hs_vec_t a) { return _mm_div_ps(_mm_set1_ps(1.0f), a); }
+#endif
+    static inline sw_hs_vec_t sw_hs_min(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm_min_ps(a, b); }
+    static inline sw_hs_vec_t sw_hs_max(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm_max_ps(a, b); }
+    static inline int sw_hs_gt(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm_movemask_ps(_mm_cmpgt_ps(a, b)); }
+    static inline int sw_hs_le(sw_hs_vec_t a, sw_hs_vec_t b) { return _mm_movemask_ps(_mm_cmple_ps(a, b)); }
+    static inline void sw_hs_pack_unorm8(uint32_t *dst, const sw_hs_vec_t *color)
+    {
+        const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f), scale = _mm_set1_ps(255.0f);
+        __m128i r = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(color[0], zero), one), scale));
+        __m128i g = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(color[1], zero), one), scale));
+        __m128i b = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(color[2], zero), one), scale));
+        __m128i a = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(color[3], zero), one), scale));
+        __m128i rg = _mm_or_si128(r, _mm_slli_epi32(g, 8));
+        __m128i ba = _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(a, 24));
+        _mm_store_si128((__m128i *)dst, _mm_or_si128(rg, ba));
+    }
+    static inline void sw_hs_unpack_unorm8(sw_hs_vec_t *color, const uint32_t *src)
+    {
+        const __m128i mask = _mm_set1_epi32(0xFF);
+        const __m128 scale = _mm_set1_ps(SW_INV_255);
+        __m128i packed = _mm_load_si128((const __m128i *)src);
+        color[0] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(packed, mask)), scale);
+        color[1] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(packed, 8), mask)), scale);
+        color[2] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(packed, 16), mask)), scale);
+        color[3] = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(packed, 24)), scale);
+    }
+#elif defined(SW_HAS_NEON_FMA) || defined(SW_HAS_NEON)
+    #define SW_HS_LANES 4
+    typedef float32x4_t sw_hs_vec_t;
+    static inline int sw_hs_movemask(uint32x4_t m)
+    {
+        return (int)((vgetq_lane_u32(m, 0) & 1) | (vgetq_lane_u32(m, 1) & 2) | (vgetq_lane_u32(m, 2) & 4) | (vgetq_lane_u32(m, 3) & 8));
+    }
+    static inline sw_hs_vec_t sw_hs_set1(float x) { return vdupq_n_f32(x); }
+    static inline sw_hs_vec_t sw_hs_load(const float *p) { return vld1q_f32(p); }
+    static inline void sw_hs_store(float *p, sw_hs_vec_t a) { vst1q_f32(p, a); }
+    static inline sw_hs_vec_t sw_hs_add(sw_hs_vec_t a, sw_hs_vec_t b) { return vaddq_f32(a, b); }
+    static inline sw_hs_vec_t sw_hs_sub(sw_hs_vec_t a, sw_hs_vec_t b) { return vsubq_f32(a, b); }
+    static inline sw_hs_vec_t sw_hs_mul(sw_hs_vec_t a, sw_hs_vec_t b) { return vmulq_f32(a, b); }
+#if defined(SW_ARCH_ARM64)
+    static inline sw_hs_vec_t sw_hs_div(sw_hs_vec_t a, sw_hs_vec_t b) { return vdivq_f32(a, b); }
+#else
+    static inline sw_hs_vec_t sw_hs_div(sw_hs_vec_t a, sw_hs_vec_t b)
+    {
+        // NOTE: No vector division on ARMv7, reciprocal estimate refined with two Newton-Raphson steps
+        float32x4_t r = vrecpeq_f32(b);
+        r = vmulq_f32(vrecpsq_f32(b, r), r);
+        r = vmulq_f32(vrecpsq_f32(b, r), r);
+        return vmulq_f32(a, r);
+    }
+#endif
+#if (SW_PERSPECTIVE_SPAN > 1)
+    static inline sw_hs_vec_t sw_hs_rcp(sw_hs_vec_t a)
+    {
+        float32x4_t r = vrecpeq_f32(a);
+        r = vmulq_f32(vrecpsq_f32(a, r), r);
+        return vmulq_f32(vrecpsq_f32(a, r), r);
+    }
+#else
+    static inline sw_hs_vec_t sw_hs_rcp(sw_hs_vec_t a) { return sw_hs_div(vdupq_n_f32(1.0f), a); }
+#endif
+    static inline sw_hs_vec_t sw_hs_min(sw_hs_vec_t a, sw_hs_vec_t b) { return vminq_f32(a, b); }
+    static inline sw_hs_vec_t sw_hs_max(sw_hs_vec_t a, sw_hs_vec_t b) { return vmaxq_f32(a, b); }
+    static inline int sw_hs_gt(sw_hs_vec_t a, sw_hs_vec_t b) { return sw_hs_movemask(vcgtq_f32(a, b)); }
+    static inline int sw_hs_le(sw_hs_vec_t a, sw_hs_vec_t b) { return sw_hs_movemask(vcleq_f32(a, b)); }
+    static inline void sw_hs_pack_unorm8(uint32_t *dst, const sw_hs_vec_t *color)
+    {
+        const float32x4_t zero = vdupq_n_f32(0.0f), one = vdupq_n_f32(1.0f);
+        uint32x4_t r = vcvtq_u32_f32(vmulq_n_f32(vminq_f32(vmaxq_f32(color[0], zero), one), 255.0f));
+        uint32x4_t g = vcvtq_u32_f32(vmulq_n_f32(vminq_f32(vmaxq_f32(color[1], zero), one), 255.0f));
+        uint32x4_t b = vcvtq_u32_f32(vmulq_n_f32(vminq_f32(vmaxq_f32(color[2], zero), one), 255.0f));
+        uint32x4_t a = vcvtq_u32_f32(vmulq_n_f32(vminq_f32(vmaxq_f32(color[3], zero), one), 255.0f));
+        uint32x4_t rg = vorrq_u32(r, vshlq_n_u32(g, 8));
+        uint32x4_t ba = vorrq_u32(vshlq_n_u32(b, 16), vshlq_n_u32(a, 24));
+        vst1q_u32(dst, vorrq_u32(rg, ba));
+    }
+    static inline void sw_hs_unpack_unorm8(sw_hs_vec_t *color, const uint32_t *src)
+    {
+        const uint32x4_t mask = vdupq_n_u32(0xFF);
+        uint32x4_t packed = vld1q_u32(src);
+        color[0] = vmulq_n_f32(vcvtq_f32_u32(vandq_u32(packed, mask)), SW_INV_255);
+        color[1] = vmulq_n_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(packed, 8), mask)), SW_INV_255);
+        color[2] = vmulq_n_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(packed, 16), mask)), SW_INV_255);
+        color[3] = vmulq_n_f32(vcvtq_f32_u32(vshrq_n_u32(packed, 24)), SW_INV_255);
+    }
+#else
+    #define SW_HS_LANES 4
+    typedef struct { float v[SW_HS_LANES]; } sw_hs_vec_t;
+    #define SW_HS_SCALAR_OP(expr) sw_hs_vec_t r; for (int i = 0; i < SW_HS_LANES; i++) r.v[i] = (expr); return r
+    #define SW_HS_SCALAR_CMP(expr) int m = 0; for (int i = 0; i < SW_HS_LANES; i++) m |= (expr) << i; return m
+    static inline sw_hs_vec_t sw_hs_set1(float x) { SW_HS_SCALAR_OP(x); }
+    static inline sw_hs_vec_t sw_hs_load(const float *p) { SW_HS_SCALAR_OP(p[i]); }
+    static inline void sw_hs_store(float *p, sw_hs_vec_t a) { for (int i = 0; i < SW_HS_LANES; i++) p[i] = a.v[i]; }
+    static inline sw_hs_vec_t sw_hs_add(sw_hs_vec_t a, sw_hs_vec_t b) { SW_HS_SCALAR_OP(a.v[i] + b.v[i]); }
+    static inline sw_hs_vec_t sw_hs_sub(sw_hs_vec_t a, sw_hs_vec_t b) { SW_HS_SCALAR_OP(a.v[i] - b.v[i]); }
+    static inline sw_hs_vec_t sw_hs_mul(sw_hs_vec_t a, sw_hs_vec_t b) { SW_HS_SCALAR_OP(a.v[i]*b.v[i]); }
+    static inline sw_hs_vec_t sw_hs_div(sw_hs_vec_t a, sw_hs_vec_t b) { SW_HS_SCALAR_OP(a.v[i]/b.v[i]); }
+    static inline sw_hs_vec_t sw_hs_rcp(sw_hs_vec_t a) { SW_HS_SCALAR_OP(1.0f/a.v[i]); }
+    static inline sw_hs_vec_t sw_hs_min(sw_hs_vec_t a, sw_hs_vec_t b) { SW_HS_SCALAR_OP((a.v[i] < b.v[i])? a.v[i] : b.v[i]); }
+    static inline sw_hs_vec_t sw_hs_max(sw_hs_vec_t a, sw_hs_vec_t b) { SW_HS_SCALAR_OP((a.v[i] > b.v[i])? a.v[i] : b.v[i]); }
+    static inline int sw_hs_gt(sw_hs_vec_t a, sw_hs_vec_t b) { SW_HS_SCALAR_CMP(a.v[i] > b.v[i]); }
+    static inline int sw_hs_le(sw_hs_vec_t a, sw_hs_vec_t b) { SW_HS_SCALAR_CMP(a.v[i] <= b.v[i]); }
+    static inline void sw_hs_pack_unorm8(uint32_t *dst, const sw_hs_vec_t *color)
+    {
+        for (int i = 0; i < SW_HS_LANES; i++)
+        {
+            float rgba[4] = { color[0].v[i], color[1].v[i], color[2].v[i], color[3].v[i] };
+            uint8_t value[4];
+            sw_float_to_unorm8_simd(value, rgba);
+            dst[i] = (uint32_t)value[0] | ((uint32_t)value[1] << 8) | ((uint32_t)value[2] << 16) | ((uint32_t)value[3] << 24);
+        }
+    }
+    static inline void sw_hs_unpack_unorm8(sw_hs_vec_t *color, const uint32_t *src)
+    {
+        for (int i = 0; i < SW_HS_LANES; i++)
+        {
+            for (int c = 0; c < 4; c++) color[c].v[i] = (float)((src[i] >> (8*c)) & 0xFF)*SW_INV_255;
+        }
+    }
+#endif
+
+#define SW_HS_BLOCK_WIDTH   (SW_HS_LANES/2)         // Block pixels per row, blocks are two rows high
+#define SW_HS_LANES_MASK    ((1 << SW_HS_LANES) - 1)
+#define SW_HS_TILE_SIZE     SW_DEPTH_TILE_SIZE      // Coarse tiles dimensions, multiple of the block dimensions
+#define SW_HS_ATTRIBS       8                       // Interpolated attributes: z, 1/w, color (4), texcoord (2)
+
+// Lanes position inside the block, row by row
+#if (SW_HS_LANES == 8)
+static const SW_ALIGN(32) float sw_hs_lane_x[SW_HS_LANES] = { 0, 1, 2, 3, 0, 1, 2, 3 };
+static const SW_ALIGN(32) float sw_hs_lane_y[SW_HS_LANES] = { 0, 0, 0, 0, 1, 1, 1, 1 };
+#else
+static const SW_ALIGN(16) float sw_hs_lane_x[SW_HS_LANES] = { 0, 1, 0, 1 };
+static const SW_ALIGN(16) float sw_hs_lane_y[SW_HS_LANES] = { 0, 0, 1, 1 };
+#endif
+
+typedef struct {
+    float a[3], b[3], c[3];             // Edge functions, E(x, y) = a*x + b*y + c, positive inside
+    float margin[3];                    // Edge functions rounding error bound, for coarse tiles tests
+    float threshold[3];                 // Edge functions values covered pixels are greater than (fill rule)
+    float x0, y0;                       // Attributes planes origin (first vertex screen position)
+    float attr[SW_HS_ATTRIBS][3];       // Attributes planes: value at origin, x gradient, y gradient
+    int xMin, yMin, xMax, yMax;         // Pixels bounds, maximum excluded
+} sw_hs_triangle_t;
+
+// Setup triangle edge functions and attributes planes, restricted to rows [rowMin, rowMax)
+// NOTE: Pixel (x, y) is sampled at screen position (x + 1, y + 1) since screen coordinates
+// are offset by half a pixel (see sw_project_ndc_to_screen()), as the scanline rasterizer does
+static inline bool sw_hs_triangle_setup(sw_hs_triangle_t *tri, const sw_vertex_t *v0, const sw_vertex_t *v1, const sw_vertex_t *v2, int rowMin, int rowMax)
+{
+    float area = (v1->screen[0] - v0->screen[0])*(v2->screen[1] - v0->screen[1]) -
+                 (v2->screen[0] - v0->screen[0])*(v1->screen[1] - v0->screen[1]);
+
+    if (fabsf(area) < 1e-6f) return false;
+
+    // Keep a positive area so edge functions are positive inside
+    if (area < 0.0f) { const sw_vertex_t *tmp = v1; v1 = v2; v2 = tmp; area = -area; }
+
+    const sw_vertex_t *v[3] = { v0, v1, v2 };
+
+    // Pixels bounds, pixel x covered by samples in range [x + 1, x + 2)
+    float xMin = v0->screen[0], xMax = v0->screen[0];
+    float yMin = v0->screen[1], yMax = v0->screen[1];
+    for (int i = 1; i < 3; i++)
+    {
+        if (v[i]->screen[0] < xMin) xMin = v[i]->screen[0];
+        if (v[i]->screen[0] > xMax) xMax = v[i]->screen[0];
+        if (v[i]->screen[1] < yMin) yMin = v[i]->screen[1];
+        if (v[i]->screen[1] > yMax) yMax = v[i]->screen[1];
+    }
+
+    tri->xMin = sw_clampi((int)ceilf(xMin) - 1, 0, RLSW.framebuffer.width);
+    tri->xMax = sw_clampi((int)floorf(xMax), 0, RLSW.framebuffer.width);
+    tri->yMin = sw_clampi((int)ceilf(yMin) - 1, (rowMin > 0)? rowMin : 0, RLSW.framebuffer.height);
+    tri->yMax = sw_clampi((int)floorf(yMax), 0, (rowMax < RLSW.framebuffer.height)? rowMax : RLSW.framebuffer.height);
+
+    if ((tri->xMin >= tri->xMax) || (tri->yMin >= tri->yMax)) return false;
+
+    float xBound = (float)RLSW.framebuffer.width + 1.0f;
+    float yBound = (float)RLSW.framebuffer.height + 1.0f;
+
+    for (int i = 0; i < 3; i++)
+    {
+        // Edge opposite to vertex i, computed from its vertices in a fixed order so triangles
+        // sharing the edge get exactly opposite values and no pixel is covered twice or missed
+        const sw_vertex_t *p = v[(i + 1)%3];
+        const sw_vertex_t *q = v[(i + 2)%3];
+        bool flip = (q->screen[1] < p->screen[1]) || ((q->screen[1] == p->screen[1]) && (q->screen[0] < p->screen[0]));
+        if (flip) { const sw_vertex_t *tmp = p; p = q; q = tmp; }
+
+        float a = p->screen[1] - q->screen[1];
+        float b = q->screen[0] - p->screen[0];
+        float c = p->screen[0]*q->screen[1] - q->screen[0]*p->screen[1];
+
+        tri->a[i] = flip? -a : a;
+        tri->b[i] = flip? -b : b;
+        tri->c[i] = flip? -c : c;
+        tri->margin[i] = (fabsf(a)*xBound + fabsf(b)*yBound + fabsf(c))*2e-6f;
+
+        // Fill rule: right and bottom edges are inclusive (E >= 0), left and top edges exclusive (E > 0)
+        // NOTE: E >= 0 tested as E > -FLT_MIN, edge functions are never denormal but at zero
+        bool inclusive = (tri->a[i] < 0.0f) || ((tri->a[i] == 0.0f) && (tri->b[i] < 0.0f));
+        tri->threshold[i] = inclusive? -1.17549435e-38f : 0.0f;
+    }
+
+    // Attributes planes, gradients from barycentric weights (edge functions divided by area)
+    const float areaRcp = 1.0f/area;
+
+    tri->x0 = v0->screen[0];
+    tri->y0 = v0->screen[1];
+
+    for (int k = 0; k < SW_HS_ATTRIBS; k++)
+    {
+        float value[3];
+        for (int i = 0; i < 3; i++)
+        {
+            if (k < 2) value[i] = v[i]->homogeneous[2 + k];
+            else if (k < 6) value[i] = v[i]->color[k - 2];
+            else value[i] = v[i]->texcoord[k - 6];
+        }
+
+        tri->attr[k][0] = value[0];
+        tri->attr[k][1] = (value[0]*tri->a[0] + value[1]*tri->a[1] + value[2]*tri->a[2])*areaRcp;
+        tri->attr[k][2] = (value[0]*tri->b[0] + value[1]*tri->b[1] + value[2]*tri->b[2])*areaRcp;
+    }
+
+    return true;
+}
+
+// Test a tile of pixels [x0, x1) x [y0, y1) against the triangle edges
+// Returns -1 if the tile is outside the triangle, 1 if fully inside, 0 if partially covered
+static inline int sw_hs_tile_test(const sw_hs_triangle_t *tri, int x0, int y0, int x1, int y1)
+{
+    // Tile corners samples
+    float sx0 = (float)(x0 + 1), sx1 = (float)x1;
+    float sy0 = (float)(y0 + 1), sy1 = (float)y1;
+
+    int result = 1;
+
+    for (int i = 0; i < 3; i++)
+    {
+        float a = tri->a[i], b = tri->b[i];
+        float eMax = a*((a > 0.0f)? sx1 : sx0) + b*((b > 0.0f)? sy1 : sy0) + tri->c[i];
+        float eMin = a*((a > 0.0f)? sx0 : sx1) + b*((b > 0.0f)? sy0 : sy1) + tri->c[i];
+
+        if (eMax < -tri->margin[i]) return -1;
+        if (eMin <= tri->margin[i]) result = 0;
+    }
+
+    return result;
+}
+
+// Get the lanes mask of the block pixels inside an edge of the triangle
+// NOTE: Edge functions are evaluated as E = a*x + (b*y + c), row term (b*y + c) computed once per blocks row
+static inline int sw_hs_edge_mask(const sw_hs_triangle_t *tri, int edge, sw_hs_vec_t x, sw_hs_vec_t rowTerm)
+{
+    sw_hs_vec_t e = sw_hs_add(sw_hs_mul(sw_hs_set1(tri->a[edge]), x), rowTerm);
+    return sw_hs_gt(e, sw_hs_set1(tri->threshold[edge]));
+}
+
+// Get attribute offsets of the block lanes from the block origin and attribute step between blocks
+static inline void sw_hs_attrib_lanes(const sw_hs_triangle_t *tri, int attrib, sw_hs_vec_t laneX, sw_hs_vec_t laneY, sw_hs_vec_t *lanes, sw_hs_vec_t *step)
+{
+    *lanes = sw_hs_add(sw_hs_mul(sw_hs_set1(tri->attr[attrib][1]), laneX), sw_hs_mul(sw_hs_set1(tri->attr[attrib][2]), laneY));
+    *step = sw_hs_set1(tri->attr[attrib][1]*SW_HS_BLOCK_WIDTH);
+}
+
+// Get attribute values of the block lanes, (dx, dy) is the block origin relative to the attributes planes origin
+static inline sw_hs_vec_t sw_hs_attrib_at(const sw_hs_triangle_t *tri, int attrib, float dx, float dy, sw_hs_vec_t lanes)
+{
+    return sw_hs_add(sw_hs_set1(tri->attr[attrib][0] + tri->attr[attrib][1]*dx + tri->attr[attrib][2]*dy), lanes);
+}
+
+// Sample texture for the block lanes in mask, derivatives taken from the 2x2 pixels quad every lane belongs to
+static inline void sw_hs_texture_sample(sw_hs_vec_t *color/*[4]*/, const sw_texture_t *tex, int mask, int mode, sw_hs_vec_t u, sw_hs_vec_t v)
+{
+    SW_ALIGN(32) float s[SW_HS_LANES], t[SW_HS_LANES];
+    SW_ALIGN(32) float texColor[4][SW_HS_LANES] = { 0 };
+
+    sw_hs_store(s, u);
+    sw_hs_store(t, v);
+
+    for (int i = 0; i < SW_HS_LANES; i++)
+    {
+        if ((mask & (1 << i)) == 0) continue;
+
+        int q = (i%SW_HS_BLOCK_WIDTH) & ~1;
+        float dUdx = s[q + 1] - s[q];
+        float dUdy = s[q + SW_HS_BLOCK_WIDTH] - s[q];
+        float dVdx = t[q + 1] - t[q];
+        float dVdy = t[q + SW_HS_BLOCK_WIDTH] - t[q];
+
+        float texel[4] = { 0 };
+        sw_texture_sample_mode(texel, tex, s[i], t[i], dUdx, dUdy, dVdx, dVdy, mode);
+        texColor[0][i] = texel[0];
+        texColor[1][i] = texel[1];
+        texColor[2][i] = texel[2];
+        texColor[3][i] = texel[3];
+    }
+
+    color[0] = sw_hs_load(texColor[0]);
+    color[1] = sw_hs_load(texColor[1]);
+    color[2] = sw_hs_load(texColor[2]);
+    color[3] = sw_hs_load(texColor[3]);
+}
+
+// Get the lanes mask of the block pixels inside a block region of cols x rows pixels
+static inline int sw_hs_bounds_mask(int cols, int rows)
+{
+    if ((cols >= SW_HS_BLOCK_WIDTH) && (rows >= 2)) return SW_HS_LANES_MASK;
+
+    int mask = 0;
+    for (int i = 0; i < SW_HS_LANES; i++)
+    {
+        if (((i%SW_HS_BLOCK_WIDTH) < cols) && ((i/SW_HS_BLOCK_WIDTH) < rows)) mask |= (1 << i);
+    }
+
+    return mask;
+}
+
+// Read block depth values, lanes outside the mask are set to zero
+static inline sw_hs_vec_t sw_hs_read_depth(int x, int y, int mask)
+{
+    SW_ALIGN(32) float value[SW_HS_LANES] = { 0 };
+
+    for (int row = 0; row < 2; row++)
+    {
+        int rowMask = (mask >> (row*SW_HS_BLOCK_WIDTH)) & ((1 << SW_HS_BLOCK_WIDTH) - 1);
+        if (rowMask == 0) continue;
+
+        const sw_depth_t *src = sw_framebuffer_depth_at(x, y + row);
+        for (int i = 0; i < SW_HS_BLOCK_WIDTH; i++)
+        {
+            if (rowMask & (1 << i)) value[row*SW_HS_BLOCK_WIDTH + i] = sw_framebuffer_read_depth(&src[i]);
+        }
+    }
+
+    return sw_hs_load(value);
+}
+
+static inline void sw_hs_write_depth(int x, int y, int mask, sw_hs_vec_t depth)
+{
+    SW_ALIGN(32) float value[SW_HS_LANES];
+    sw_hs_store(value, sw_hs_min(sw_hs_max(depth, sw_hs_set1(0.0f)), sw_hs_set1(1.0f)));
+
+    for (int row = 0; row < 2; row++)
+    {
+        int rowMask = (mask >> (row*SW_HS_BLOCK_WIDTH)) & ((1 << SW_HS_BLOCK_WIDTH) - 1);
+        if (rowMask == 0) continue;
+
+        sw_depth_t *dst = sw_framebuffer_depth_at(x, y + row);
+        for (int i = 0; i < SW_HS_BLOCK_WIDTH; i++)
+        {
+            if ((rowMask & (1 << i)) == 0) continue;
+            float depthValue = value[row*SW_HS_BLOCK_WIDTH + i];
+        #if SW_DEPTH_IS_PACKED
+            dst[i].depth[0] = SW_PACK_DEPTH(depthValue);
+        #else
+            dst[i].depth[0] = SW_PACK_DEPTH_0(depthValue);
+            dst[i].depth[1] = SW_PACK_DEPTH_1(depthValue);
+            dst[i].depth[2] = SW_PACK_DEPTH_2(depthValue);
+        #endif
+        }
+    }
+}
+
+// Read block colors, channels stored separately (one vector per channel)
+static inline void sw_hs_read_color(sw_hs_vec_t *color/*[4]*/, int x, int y, int mask)
+{
+#if SW_COLOR_IS_PACKED
+    SW_ALIGN(32) float value[4][SW_HS_LANES] = { 0 };
+#else
+    SW_ALIGN(32) uint32_t value[SW_HS_LANES] = { 0 };
+#endif
+
+    for (int row = 0; row < 2; row++)
+    {
+        int rowMask = (mask >> (row*SW_HS_BLOCK_WIDTH)) & ((1 << SW_HS_BLOCK_WIDTH) - 1);
+        if (rowMask == 0) continue;
+
+        const sw_color_t *src = sw_framebuffer_color_at(x, y + row);
+    #if !SW_COLOR_IS_PACKED
+        if (rowMask == ((1 << SW_HS_BLOCK_WIDTH) - 1))
+        {
+            memcpy(&value[row*SW_HS_BLOCK_WIDTH], src, SW_HS_BLOCK_WIDTH*sizeof(uint32_t));
+            continue;
+        }
+    #endif
+        for (int i = 0; i < SW_HS_BLOCK_WIDTH; i++)
+        {
+            if ((rowMask & (1 << i)) == 0) continue;
+            int lane = row*SW_HS_BLOCK_WIDTH + i;
+        #if SW_COLOR_IS_PACKED
+            float rgba[4];
+            sw_framebuffer_read_color(rgba, &src[i]);
+            for (int c = 0; c < 4; c++) value[c][lane] = rgba[c];
+        #else
+            value[lane] = *(const uint32_t *)src[i].color;
+        #endif
+        }
+    }
+
+#if SW_COLOR_IS_PACKED
+    for (int c = 0; c < 4; c++) color[c] = sw_hs_load(value[c]);
+#else
+    sw_hs_unpack_unorm8(color, value);
+#endif
+}
+
+static inline void sw_hs_write_color(int x, int y, int mask, const sw_hs_vec_t *color/*[4]*/)
+{
+#if SW_COLOR_IS_PACKED
+    SW_ALIGN(32) float value[4][SW_HS_LANES];
+    for (int c = 0; c < 4; c++) sw_hs_store(value[c], color[c]);
+#else
+    SW_ALIGN(32) uint32_t value[SW_HS_LANES];
+    sw_hs_pack_unorm8(value, color);
+#endif
+
+    for (int row = 0; row < 2; row++)
+    {
+        int rowMask = (mask >> (row*SW_HS_BLOCK_WIDTH)) & ((1 << SW_HS_BLOCK_WIDTH) - 1);
+        if (rowMask == 0) continue;
+
+        sw_color_t *dst = sw_framebuffer_color_at(x, y + row);
+    #if !SW_COLOR_IS_PACKED
+        if (rowMask == ((1 << SW_HS_BLOCK_WIDTH) - 1))
+        {
+            memcpy(dst, &value[row*SW_HS_BLOCK_WIDTH], SW_HS_BLOCK_WIDTH*sizeof(uint32_t));
+            continue;
+        }
+    #endif
+        for (int i = 0; i < SW_HS_BLOCK_WIDTH; i++)
+        {
+            if ((rowMask & (1 << i)) == 0) continue;
+            int lane = row*SW_HS_BLOCK_WIDTH + i;
+        #if SW_COLOR_IS_PACKED
+            float rgba[4] = { value[0][lane], value[1][lane], value[2][lane], value[3][lane] };
+            sw_framebuffer_write_color(&dst[i], rgba);
+        #else
+            *(uint32_t *)dst[i].color = value[lane];
+        #endif
+        }
+    }
+}
+
+static inline void sw_hs_blend_factor(sw_hs_vec_t *SW_RESTRICT factor, SWfactor func, const sw_hs_vec_t *SW_RESTRICT src, const sw_hs_vec_t *SW_RESTRICT dst)
+{
+    const sw_hs_vec_t one = sw_hs_set1(1.0f);
+
+    switch (func)
+    {
+        case SW_ZERO: factor[0] = factor[1] = factor[2] = factor[3] = sw_hs_set1(0.0f); break;
+        case SW_SRC_COLOR: for (int i = 0; i < 4; i++) factor[i] = src[i]; break;
+        case SW_ONE_MINUS_SRC_COLOR: for (int i = 0; i < 4; i++) factor[i] = sw_hs_sub(one, src[i]); break;
+        case SW_SRC_ALPHA: factor[0] = factor[1] = factor[2] = factor[3] = src[3]; break;
+        case SW_ONE_MINUS_SRC_ALPHA: factor[0] = factor[1] = factor[2] = factor[3] = sw_hs_sub(one, src[3]); break;
+        case SW_DST_ALPHA: factor[0] = factor[1] = factor[2] = factor[3] = dst[3]; break;
+        case SW_ONE_MINUS_DST_ALPHA: factor[0] = factor[1] = factor[2] = factor[3] = sw_hs_sub(one, dst[3]); break;
+        case SW_DST_COLOR: for (int i = 0; i < 4; i++) factor[i] = dst[i]; break;
+        case SW_ONE_MINUS_DST_COLOR: for (int i = 0; i < 4; i++) factor[i] = sw_hs_sub(one, dst[i]); break;
+        case SW_SRC_ALPHA_SATURATE: factor[0] = factor[1] = factor[2] = one; factor[3] = sw_hs_min(src[3], one); break;
+        case SW_ONE:
+        default: factor[0] = factor[1] = factor[2] = factor[3] = one; break;
+    }
+}
+
+// Blend block colors, channels stored separately (one vector per channel), same as sw_blend_colors()
+static inline void sw_hs_blend_colors(sw_hs_vec_t *SW_RESTRICT dst/*[4]*/, const sw_hs_vec_t *SW_RESTRICT src/*[4]*/)
+{
+    sw_hs_vec_t srcFactor[4], dstFactor[4];
+
+    sw_hs_blend_factor(srcFactor, RLSW.srcFactor, src, dst);
+    sw_hs_blend_factor(dstFactor, RLSW.dstFactor, src, dst);
+
+    for (int i = 0; i < 4; i++)
+    {
+        dst[i] = sw_hs_add(sw_hs_mul(srcFactor[i], src[i]), sw_hs_mul(dstFactor[i], dst[i]));
+    }
+}
+
+// Blend block colors specialized for a raster variant blend mode, same as sw_blend_colors_mode()
+static inline void sw_hs_blend_colors_mode(sw_hs_vec_t *SW_RESTRICT dst/*[4]*/, const sw_hs_vec_t *SW_RESTRICT src/*[4]*/, int mode)
+{
+    switch (mode)
+    {
+        case SW_RASTER_BLEND_ALPHA:
+        {
+            sw_hs_vec_t invAlpha = sw_hs_sub(sw_hs_set1(1.0f), src[3]);
+            dst[0] = sw_hs_add(sw_hs_mul(src[3], src[0]), sw_hs_mul(invAlpha, dst[0]));
+            dst[1] = sw_hs_add(sw_hs_mul(src[3], src[1]), sw_hs_mul(invAlpha, dst[1]));
+            dst[2] = sw_hs_add(sw_hs_mul(src[3], src[2]), sw_hs_mul(invAlpha, dst[2]));
+            dst[3] = sw_hs_add(sw_hs_mul(src[3], src[3]), sw_hs_mul(invAlpha, dst[3]));
+        } break;
+        case SW_RASTER_BLEND_ADDITIVE:
+        {
+            dst[0] = sw_hs_add(sw_hs_mul(src[3], src[0]), dst[0]);
+            dst[1] = sw_hs_add(sw_hs_mul(src[3], src[1]), dst[1]);
+            dst[2] = sw_hs_add(sw_hs_mul(src[3], src[2]), dst[2]);
+            dst[3] = sw_hs_add(sw_hs_mul(src[3], src[3]), dst[3]);
+        } break;
+        default: sw_hs_blend_colors(dst, src); break;
+    }
+}
+
+// Get the depth plane range over a tile of pixels [x0, x1) x [y0, y1), minimum and maximum
+static inline void sw_hs_tile_depth_range(const sw_hs_triangle_t *tri, int x0, int y0, int x1, int y1, float range[2])
+{
+    float dx0 = (float)(x0 + 1) - tri->x0, dx1 = (float)x1 - tri->x0;
+    float dy0 = (float)(y0 + 1) - tri->y0, dy1 = (float)y1 - tri->y0;
+    float gx = tri->attr[0][1], gy = tri->attr[0][2];
+
+    range[0] = tri->attr[0][0] + gx*((gx > 0.0f)? dx0 : dx1) + gy*((gy > 0.0f)? dy0 : dy1);
+    range[1] = tri->attr[0][0] + gx*((gx > 0.0f)? dx1 : dx0) + gy*((gy > 0.0f)? dy1 : dy0);
+}
+
+#if SW_DEPTH_TILES
+// Get the depth tile coverage mask of the block lanes in mask
+static inline uint64_t sw_hs_depth_tile_mask(int x, int y, int mask)
+{
+    int rowBits = (1 << SW_HS_BLOCK_WIDTH) - 1;
+    int shift = (x & SW_DEPTH_TILE_MASK) + ((y & SW_DEPTH_TILE_MASK) << SW_DEPTH_TILE_SHIFT);
+
+    // NOTE: Lanes of the second row are masked out when it is outside the tile
+    return ((uint64_t)(mask & rowBits) | ((uint64_t)(mask >> SW_HS_BLOCK_WIDTH) << SW_DEPTH_TILE_SIZE)) << shift;
+}
+
+static inline bool sw_hs_depth_tile_occluded(int x, int y, float depth)
+{
+    return sw_depth_tile_occluded(x >> SW_DEPTH_TILE_SHIFT, y >> SW_DEPTH_TILE_SHIFT, depth);
+}
+
+static inline void sw_hs_depth_tile_cover(int x, int y, uint64_t mask, float depth)
+{
+    if (mask != 0) sw_depth_tile_cover(x >> SW_DEPTH_TILE_SHIFT, y >> SW_DEPTH_TILE_SHIFT, mask, depth);
+}
+#else
+static inline uint64_t sw_hs_depth_tile_mask(int x, int y, int mask) { (void)x; (void)y; (void)mask; return 0; }
+static inline bool sw_hs_depth_tile_occluded(int x, int y, float depth) { (void)x; (void)y; (void)depth; return false; }
+static inline void sw_hs_depth_tile_cover(int x, int y, uint64_t mask, float depth) { (void)x; (void)y; (void)mask; (void)depth; }
+#endif
+
+#define DEFINE_TRIANGLE_RASTER_HALF_SPACE(FUNC_NAME, TEXTURE_MODE, ENABLE_DEPTH_TEST, BLEND_MODE) \
+static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1,          \
+                             const sw_vertex_t *v2, const sw_texture_t *tex,        \
+                             int rowMin, int rowMax)                                \
+{                                                                                   \
+    sw_hs_triangle_t tri;                                                           \
+    if (!sw_hs_triangle_setup(&tri, v0, v1, v2, rowMin, rowMax)) return;            \
+                                                                                    \
+    /* Attributes offsets of the block lanes and steps between blocks */            \
+    /* NOTE: Attributes loops are unrolled so the compiler keeps them in registers */ \
+    const sw_hs_vec_t laneX = sw_hs_load(sw_hs_lane_x);                             \
+    const sw_hs_vec_t laneY = sw_hs_load(sw_hs_lane_y);                             \
+    sw_hs_vec_t laneAttr[SW_HS_ATTRIBS], stepAttr[SW_HS_ATTRIBS];                   \
+    sw_hs_attrib_lanes(&tri, 0, laneX, laneY, &laneAttr[0], &stepAttr[0]);          \
+    sw_hs_attrib_lanes(&tri, 1, laneX, laneY, &laneAttr[1], &stepAttr[1]);          \
+    sw_hs_attrib_lanes(&tri, 2, laneX, laneY, &laneAttr[2], &stepAttr[2]);          \
+    sw_hs_attrib_lanes(&tri, 3, laneX, laneY, &laneAttr[3], &stepAttr[3]);          \
+    sw_hs_attrib_lanes(&tri, 4, laneX, laneY, &laneAttr[4], &stepAttr[4]);          \
+    sw_hs_attrib_lanes(&tri, 5, laneX, laneY, &laneAttr[5], &stepAttr[5]);          \
+    if (TEXTURE_MODE)                                                               \
+    {                                                                               \
+        sw_hs_attrib_lanes(&tri, 6, laneX, laneY, &laneAttr[6], &stepAttr[6]);      \
+        sw_hs_attrib_lanes(&tri, 7, laneX, laneY, &laneAttr[7], &stepAttr[7]);      \
+    }                                                                               \
+                                                                                    \
+    /* Constant w over the triangle, a single exact division */                     \
+    const bool affine = ((tri.attr[1][1] == 0.0f) && (tri.attr[1][2] == 0.0f));     \
+    const sw_hs_vec_t wRcpAffine = sw_hs_set1(1.0f/tri.attr[1][0]);                 \
+                                                                                    \
+    /* NOTE: Tiles aligned on the framebuffer grid, every tile lies in a single depth tile */ \
+    for (int ty = tri.yMin, tyEnd; ty < tri.yMax; ty = tyEnd)                       \
+    {                                                                               \
+        tyEnd = (ty | (SW_HS_TILE_SIZE - 1)) + 1;                                   \
+        if (tyEnd > tri.yMax) tyEnd = tri.yMax;                                     \
+                                                                                    \
+        for (int tx = tri.xMin, txEnd; tx < tri.xMax; tx = txEnd)                   \
+        {                                                                           \
+            txEnd = (tx | (SW_HS_TILE_SIZE - 1)) + 1;                               \
+            if (txEnd > tri.xMax) txEnd = tri.xMax;                                 \
+                                                                                    \
+            /* Early rejection of the tiles outside the triangle */                 \
+            int tileCoverage = sw_hs_tile_test(&tri, tx, ty, txEnd, tyEnd);         \
+            if (tileCoverage < 0) continue;                                         \
+                                                                                    \
+            /* Early rejection of the tiles behind the depth tile */                \
+            float tileDepth[2] = { 0 };                                             \
+            uint64_t tileMask = 0;                                                  \
+            if (ENABLE_DEPTH_TEST)                                                  \
+            {                                                                       \
+                sw_hs_tile_depth_range(&tri, tx, ty, txEnd, tyEnd, tileDepth);      \
+                if (sw_hs_depth_tile_occluded(tx, ty, tileDepth[0])) continue;      \
+            }                                                                       \
+                                                                                    \
+            for (int by = ty; by < tyEnd; by += 2)                                  \
+            {                                                                       \
+                /* Edge functions row terms and attributes at the first block of the row */ \
+                sw_hs_vec_t y = sw_hs_add(sw_hs_set1((float)(by + 1)), laneY);      \
+                sw_hs_vec_t rowTerm[3];                                             \
+                rowTerm[0] = sw_hs_add(sw_hs_mul(sw_hs_set1(tri.b[0]), y), sw_hs_set1(tri.c[0])); \
+                rowTerm[1] = sw_hs_add(sw_hs_mul(sw_hs_set1(tri.b[1]), y), sw_hs_set1(tri.c[1])); \
+                rowTerm[2] = sw_hs_add(sw_hs_mul(sw_hs_set1(tri.b[2]), y), sw_hs_set1(tri.c[2])); \
+                                                                                    \
+                float dx = (float)(tx + 1) - tri.x0;                                \
+                float dy = (float)(by + 1) - tri.y0;                                \
+                sw_hs_vec_t attr[SW_HS_ATTRIBS];                                    \
+                attr[0] = sw_hs_attrib_at(&tri, 0, dx, dy, laneAttr[0]);            \
+                attr[1] = sw_hs_attrib_at(&tri, 1, dx, dy, laneAttr[1]);            \
+                attr[2] = sw_hs_attrib_at(&tri, 2, dx, dy, laneAttr[2]);            \
+                attr[3] = sw_hs_attrib_at(&tri, 3, dx, dy, laneAttr[3]);            \
+                attr[4] = sw_hs_attrib_at(&tri, 4, dx, dy, laneAttr[4]);            \
+                attr[5] = sw_hs_attrib_at(&tri, 5, dx, dy, laneAttr[5]);            \
+                if (TEXTURE_MODE)                                                   \
+                {                                                                   \
+                    attr[6] = sw_hs_attrib_at(&tri, 6, dx, dy, laneAttr[6]);        \
+                    attr[7] = sw_hs_attrib_at(&tri, 7, dx, dy, laneAttr[7]);        \
+                }                                                                   \
+                                                                                    \
+                for (int bx = tx; bx < txEnd; bx += SW_HS_BLOCK_WIDTH)              \
+                {                                                                   \
+                    if (bx != tx)                                                   \
+                    {                                                               \
+                        attr[0] = sw_hs_add(attr[0], stepAttr[0]);                  \
+                        attr[1] = sw_hs_add(attr[1], stepAttr[1]);                  \
+                        attr[2] = sw_hs_add(attr[2], stepAttr[2]);                  \
+                        attr[3] = sw_hs_add(attr[3], stepAttr[3]);                  \
+                        attr[4] = sw_hs_add(attr[4], stepAttr[4]);                  \
+                        attr[5] = sw_hs_add(attr[5], stepAttr[5]);                  \
+                        if (TEXTURE_MODE)                                           \
+                        {                                                           \
+                            attr[6] = sw_hs_add(attr[6], stepAttr[6]);              \
+                            attr[7] = sw_hs_add(attr[7], stepAttr[7]);              \
+                        }                                                           \
+                    }                                                               \
                                                                                     \
-    /* Scanline for the upper part of the triangle */                               \
-    for (int y = yTop; y < yMid; y++)                                               \
-    {                                                                               \
-        vLeft.screen[1] = vRight.screen[1] = y;                                     \
+                    int mask = sw_hs_bounds_mask(txEnd - bx, tyEnd - by);           \
                                                                                     \
-        if (vLeft.screen[0] < vRight.screen[0]) FUNC_SCANLINE(tex, &vLeft, &vRight, dVXdy02.texcoord[0], dVXdy02.texcoord[1]); \
-        else FUNC_SCANLINE(tex, &vRight, &vLeft, dVXdy02.texcoord[0], dVXdy02.texcoord[1]); \
+                    if (tileCoverage == 0)                                          \
+                    {                                                               \
+                        sw_hs_vec_t x = sw_hs_add(sw_hs_set1((float)(bx + 1)), laneX); \
+                        mask &= sw_hs_edge_mask(&tri, 0, x, rowTerm[0]);            \
+                        mask &= sw_hs_edge_mask(&tri, 1, x, rowTerm[1]);            \
+                        mask &= sw_hs_edge_mask(&tri, 2, x, rowTerm[2]);            \
+                        if (mask == 0) continue;                                    \
+                    }                                                               \
                                                                                     \
-        sw_add_vertex_grad_PTCH(&vLeft, &dVXdy02);                                  \
-        vLeft.screen[0] += dXdy02;                                                  \
+                    if (ENABLE_DEPTH_TEST)                                          \
+                    {                                                               \
+                        tileMask |= sw_hs_depth_tile_mask(bx, by, mask);            \
                                                                                     \
-        sw_add_vertex_grad_PTCH(&vRight, &dVXdy01);                                 \
-        vRight.screen[0] += dXdy01;                                                 \
-    }                                                                               \
+                        /* TODO: Implement different depth funcs? */                \
+                        mask &= sw_hs_le(attr[0], sw_hs_read_depth(bx, by, mask));  \
+                        if (mask == 0) continue;                                    \
+                    }                                                               \
                                                                                     \
-    /* Get a copy of next right for interpolation and apply substep correction */   \
-    vRight = *v1;                                                                   \
-    sw_add_vertex_grad_scaled_PTCH(&vRight, &dVXdy12, y1Substep);                   \
-    vRight.screen[0] += dXdy12*y1Substep;                                           \
+                    /* TODO: Implement depth mask */                                \
+                    sw_hs_write_depth(bx, by, mask, attr[0]);                       \
                                                                                     \
-    /* Scanline for the lower part of the triangle */                               \
-    for (int y = yMid; y < yBot; y++)                                               \
-    {                                                                               \
-        vLeft.screen[1] = vRight.screen[1] = y;                                     \
+                    /* Perspective-correct color */                                 \
+                    sw_hs_vec_t wRcp = affine? wRcpAffine : sw_hs_rcp(attr[1]);     \
+                    sw_hs_vec_t srcColor[4];                                        \
+                    srcColor[0] = sw_hs_mul(attr[2], wRcp);                         \
+                    srcColor[1] = sw_hs_mul(attr[3], wRcp);                         \
+                    srcColor[2] = sw_hs_mul(attr[4], wRcp);                         \
+                    srcColor[3] = sw_hs_mul(attr[5], wRcp);                         \
                                                                                     \
-        if (vLeft.screen[0] < vRight.screen[0]) FUNC_SCANLINE(tex, &vLeft, &vRight, dVXdy02.texcoord[0], dVXdy02.texcoord[1]); \
-        else FUNC_SCANLINE(tex, &vRight, &vLeft, dVXdy02.texcoord[0], dVXdy02.texcoord[1]); \
+                    if (TEXTURE_MODE)                                               \
+                    {                                                               \
+                        sw_hs_vec_t texColor[4];                                    \
+                        sw_hs_texture_sample(texColor, tex, mask, TEXTURE_MODE, sw_hs_mul(attr[6], wRcp), sw_hs_mul(attr[7], wRcp)); \
+                        srcColor[0] = sw_hs_mul(srcColor[0], texColor[0]);          \
+                        srcColor[1] = sw_hs_mul(srcColor[1], texColor[1]);          \
+                        srcColor[2] = sw_hs_mul(srcColor[2], texColor[2]);          \
+                        srcColor[3] = sw_hs_mul(srcColor[3], texColor[3]);          \
+                    }                                                               \
                                                                                     \
-        sw_add_vertex_grad_PTCH(&vLeft, &dVXdy02);                                  \
-        vLeft.screen[0] += dXdy02;                                                  \
+                    if (BLEND_MODE)                                                 \
+                    {                                                               \
+                        sw_hs_vec_t dstColor[4];                                    \
+                        sw_hs_read_color(dstColor, bx, by, mask);                   \
+                        sw_hs_blend_colors_mode(dstColor, srcColor, BLEND_MODE);    \
+                        sw_hs_write_color(bx, by, mask, dstColor);                  \
+                    }                                                               \
+                    else                                                            \
+                    {                                                               \
+                        sw_hs_write_color(bx, by, mask, srcColor);                  \
+                    }                                                               \
+                }                                                                   \
+            }                                                                       \
                                                                                     \
-        sw_add_vertex_grad_PTCH(&vRight, &dVXdy12);                                 \
-        vRight.screen[0] += dXdy12;                                                 \
+            if (ENABLE_DEPTH_TEST) sw_hs_depth_tile_cover(tx, ty, tileMask, tileDepth[1]); \
+        }                                                                           \
     }                                                                               \
 }
 
-DEFINE_TRIANGLE_RASTER_SCANLINE(sw_triangle_raster_scanline, 0, 0, 0)
-DEFINE_TRIANGLE_RASTER_SCANLINE(sw_triangle_raster_scanline_TEX, 1, 0, 0)
-DEFINE_TRIANGLE_RASTER_SCANLINE(sw_triangle_raster_scanline_DEPTH, 0, 1, 0)
-DEFINE_TRIANGLE_RASTER_SCANLINE(sw_triangle_raster_scanline_BLEND, 0, 0, 1)
-DEFINE_TRIANGLE_RASTER_SCANLINE(sw_triangle_raster_scanline_TEX_DEPTH, 1, 1, 0)
-DEFINE_TRIANGLE_RASTER_SCANLINE(sw_triangle_raster_scanline_TEX_BLEND, 1, 0, 1)
-DEFINE_TRIANGLE_RASTER_SCANLINE(sw_triangle_raster_scanline_DEPTH_BLEND, 0, 1, 1)
-DEFINE_TRIANGLE_RASTER_SCANLINE(sw_triangle_raster_scanline_TEX_DEPTH_BLEND, 1, 1, 1)
-
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster, sw_triangle_raster_scanline, false)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX, sw_triangle_raster_scanline_TEX, true)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_DEPTH, sw_triangle_raster_scanline_DEPTH, false)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_BLEND, sw_triangle_raster_scanline_BLEND, false)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH, sw_triangle_raster_scanline_TEX_DEPTH, true)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX_BLEND, sw_triangle_raster_scanline_TEX_BLEND, true)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_DEPTH_BLEND, sw_triangle_raster_scanline_DEPTH_BLEND, false)
-DEFINE_TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH_BLEND, sw_triangle_raster_scanline_TEX_DEPTH_BLEND, true)
+#define DEFINE_TRIANGLE_RASTER_HALF_SPACE_VARIANT(NAME, T, D, B) \
+    DEFINE_TRIANGLE_RASTER_HALF_SPACE(SW_RASTER_VARIANT_NAME(NAME, T, D, B), T, D, B)
+
+SW_RASTER_VARIANTS(DEFINE_TRIANGLE_RASTER_HALF_SPACE_VARIANT, sw_triangle_raster_half_space)
+#endif // SW_RASTER_HALF_SPACE
+
+typedef void (*sw_triangle_raster_f)(const sw_vertex_t *v0, const sw_vertex_t *v1, const sw_vertex_t *v2, const sw_texture_t *tex, int rowMin, int rowMax);
+
+// Triangle raster functions indexed by variant, see sw_get_raster_variant()
+static const sw_triangle_raster_f sw_triangle_raster_variants[SW_RASTER_VARIANT_COUNT] = {
+#if SW_RASTER_HALF_SPACE
+    SW_RASTER_VARIANTS(SW_RASTER_VARIANT_ENTRY, sw_triangle_raster_half_space)
+#else
+    SW_RASTER_VARIANTS(SW_RASTER_VARIANT_ENTRY, sw_triangle_raster)
+#endif
+};
+
+// Get the raster functions variant for current state, see SW_RASTER_VARIANT()
+static inline int sw_get_raster_variant(void)
+{
+    int texMode = SW_RASTER_TEX_NONE;
+    int blendMode = SW_RASTER_BLEND_NONE;
+
+    if (SW_STATE_CHECK(SW_STATE_TEXTURE_2D) && (RLSW.currentTexture != 0))
+    {
+        const sw_texture_t *tex = &RLSW.loadedTextures[RLSW.currentTexture];
+
+        if (tex->minFilter != tex->magFilter) texMode = SW_RASTER_TEX_FILTERED;
+        else if (tex->minFilter == SW_LINEAR) texMode = SW_RASTER_TEX_LINEAR;
+        else texMode = SW_RASTER_TEX_NEAREST;
+    }
+
+    if (SW_STATE_CHECK(SW_STATE_BLEND))
+    {
+        if ((RLSW.srcFactor == SW_ONE) && (RLSW.dstFactor == SW_ZERO)) blendMode = SW_RASTER_BLEND_NONE;
+        else if ((RLSW.srcFactor == SW_SRC_ALPHA) && (RLSW.dstFactor == SW_ONE_MINUS_SRC_ALPHA)) blendMode = SW_RASTER_BLEND_ALPHA;
+        else if ((RLSW.srcFactor == SW_SRC_ALPHA) && (RLSW.dstFactor == SW_ONE)) blendMode = SW_RASTER_BLEND_ADDITIVE;
+        else blendMode = SW_RASTER_BLEND_FACTORS;
+    }
+
+    return SW_RASTER_VARIANT(texMode, SW_STATE_CHECK(SW_STATE_DEPTH_TEST), blendMode);
+}
+
+// Rasterize a convex polygon as a triangle fan, restricted to rows [rowMin, rowMax)
+static inline void sw_polygon_raster(const sw_vertex_t *polygon, int vertexCount, const sw_texture_t *tex, int variant, int rowMin, int rowMax)
+{
+    sw_triangle_raster_f raster = sw_triangle_raster_variants[variant];
+
+    for (int i = 0; i < vertexCount - 2; i++)
+    {
+        raster(&polygon[0], &polygon[i + 1], &polygon[i + 2], tex, rowMin, rowMax);
+    }
+}
+
+#if (SW_RASTER_THREADS > 0)
+static bool sw_bins_push_polygon(int variant, int path);    // Defined in tile-binned rasterization logic
+#endif
 
 static inline void sw_triangle_render(void)
 {
@@ -2523,33 +4458,15 @@ static inline void sw_triangle_render(void)
 
     if (RLSW.vertexCounter < 3) return;
 
-    #define TRIANGLE_RASTER(RASTER_FUNC)                        \
-    {                                                           \
-        for (int i = 0; i < RLSW.vertexCounter - 2; i++)        \
-        {                                                       \
-            RASTER_FUNC(                                        \
-                &RLSW.vertexBuffer[0],                          \
-                &RLSW.vertexBuffer[i + 1],                      \
-                &RLSW.vertexBuffer[i + 2],                      \
-                &RLSW.loadedTextures[RLSW.currentTexture]       \
-            );                                                  \
-        }                                                       \
-    }
+    sw_dirty_region_add_vertices(RLSW.vertexBuffer, RLSW.vertexCounter, 1.0f);
 
-    uint32_t state = RLSW.stateFlags;
-    if (RLSW.currentTexture == 0) state &= ~SW_STATE_TEXTURE_2D;
-    if ((RLSW.srcFactor == SW_ONE) && (RLSW.dstFactor == SW_ZERO)) state &= ~SW_STATE_BLEND;
+    int variant = sw_get_raster_variant();
 
-    if (SW_STATE_CHECK_EX(state, SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH_BLEND)
-    else if (SW_STATE_CHECK_EX(state, SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_DEPTH_BLEND)
-    else if (SW_STATE_CHECK_EX(state, SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_TEX_BLEND)
-    else if (SW_STATE_CHECK_EX(state, SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST)) TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH)
-    else if (SW_STATE_CHECK_EX(state, SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_BLEND)
-    else if (SW_STATE_CHECK_EX(state, SW_STATE_DEPTH_TEST)) TRIANGLE_RASTER(sw_triangle_raster_DEPTH)
-    else if (SW_STATE_CHECK_EX(state, SW_STATE_TEXTURE_2D)) TRIANGLE_RASTER(sw_triangle_raster_TEX)
-    else TRIANGLE_RASTER(sw_triangle_raster)
+#if (SW_RASTER_THREADS > 0)
+    if (sw_bins_push_polygon(variant, SW_RASTER_PATH_POLYGON)) return;
+#endif
 
-    #undef TRIANGLE_RASTER
+    sw_polygon_raster(RLSW.vertexBuffer, RLSW.vertexCounter, &RLSW.loadedTextures[RLSW.currentTexture], variant, 0, RLSW.framebuffer.height);
 }
 //-------------------------------------------------------------------------------------------
 
@@ -2681,10 +4598,8 @@ static inline bool sw_quad_is_axis_aligned(void)
     return true;
 }
 
-static inline void sw_quad_sort_cw(const sw_vertex_t* *output)
+static inline void sw_quad_sort_cw(const sw_vertex_t* *output, const sw_vertex_t *input)
 {
-    const sw_vertex_t *input = RLSW.vertexBuffer;
-
     // Calculate the centroid of the quad
     float cx = (input[0].screen[0] + input[1].screen[0] +
                 input[2].screen[0] + input[3].screen[0])*0.25f;
@@ -2722,11 +4637,12 @@ static inline void sw_quad_sort_cw(const sw_vertex_t* *output)
 // TODO: REVIEW: Could a perfectly aligned quad, where one of the four points has a different depth,
 // still appear perfectly aligned from a certain point of view?
 // Because in that case, we would still need to perform perspective division for textures and colors...
-#define DEFINE_QUAD_RASTER_AXIS_ALIGNED(FUNC_NAME, ENABLE_TEXTURE, ENABLE_DEPTH_TEST, ENABLE_COLOR_BLEND) \
-static inline void FUNC_NAME(void)                                              \
+#define DEFINE_QUAD_RASTER_AXIS_ALIGNED(FUNC_NAME, TEXTURE_MODE, ENABLE_DEPTH_TEST, BLEND_MODE) \
+static inline void FUNC_NAME(const sw_vertex_t *vertices, const sw_texture_t *tex,\
+                             int rowMin, int rowMax)                            \
 {                                                                               \
     const sw_vertex_t *sortedVerts[4];                                          \
-    sw_quad_sort_cw(sortedVerts);                                               \
+    sw_quad_sort_cw(sortedVerts, vertices);                                     \
                                                                                 \
     const sw_vertex_t *v0 = sortedVerts[0];                                     \
     const sw_vertex_t *v1 = sortedVerts[1];                                     \
@@ -2754,7 +4670,7 @@ static inline void FUNC_NAME(void)
     /* Calculation of vertex gradients in X and Y */                            \
     float dUdx = 0.0f, dVdx = 0.0f;                                             \
     float dUdy = 0.0f, dVdy = 0.0f;                                             \
-    if (ENABLE_TEXTURE) {                                                       \
+    if (TEXTURE_MODE) {                                                         \
         dUdx = (v1->texcoord[0] - v0->texcoord[0])*wRcp;                        \
         dVdx = (v1->texcoord[1] - v0->texcoord[1])*wRcp;                        \
         dUdy = (v3->texcoord[0] - v0->texcoord[0])*hRcp;                        \
@@ -2776,12 +4692,6 @@ static inline void FUNC_NAME(void)
     dZdy = (v3->homogeneous[2] - v0->homogeneous[2])*hRcp;                      \
                                                                                 \
     /* Start of quad rasterization */                                           \
-    const sw_texture_t *tex;                                                    \
-    if (ENABLE_TEXTURE) tex = &RLSW.loadedTextures[RLSW.currentTexture];        \
-                                                                                \
-    sw_pixel_t *pixels = RLSW.framebuffer.pixels;                               \
-    int wDst = RLSW.framebuffer.width;                                          \
-                                                                                \
     float zScanline = v0->homogeneous[2] + dZdx*xSubstep + dZdy*ySubstep;       \
     float uScanline = v0->texcoord[0] + dUdx*xSubstep + dUdy*ySubstep;          \
     float vScanline = v0->texcoord[1] + dVdx*xSubstep + dVdy*ySubstep;          \
@@ -2793,9 +4703,30 @@ static inline void FUNC_NAME(void)
         v0->color[3] + dCdx[3]*xSubstep + dCdy[3]*ySubstep                      \
     };                                                                          \
                                                                                 \
-    for (int y = yMin; y < yMax; y++)                                           \
+    /* Restrict rows to the range to rasterize (tile) */                        \
+    int yStart = (yMin > rowMin)? yMin : rowMin;                                \
+    int yEnd = (yMax < rowMax)? yMax : rowMax;                                  \
+                                                                                \
+    /* NOTE: Gradients added per row, interpolation must match the unrestricted one */\
+    for (int y = yMin; y < yStart; y++)                                         \
+    {                                                                           \
+        zScanline += dZdy;                                                      \
+        colorScanline[0] += dCdy[0];                                            \
+        colorScanline[1] += dCdy[1];                                            \
+        colorScanline[2] += dCdy[2];                                            \
+        colorScanline[3] += dCdy[3];                                            \
+                                                                                \
+        if (TEXTURE_MODE)                                                       \
+        {                                                                       \
+            uScanline += dUdy;                                                  \
+            vScanline += dVdy;                                                  \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    for (int y = yStart; y < yEnd; y++)                                         \
     {                                                                           \
-        sw_pixel_t *ptr = pixels + y*wDst + xMin;                               \
+        sw_color_t *cptr = sw_framebuffer_color_at(xMin, y);                    \
+        sw_depth_t *dptr = sw_framebuffer_depth_at(xMin, y);                    \
                                                                                 \
         float z = zScanline;                                                    \
         float u = uScanline;                                                    \
@@ -2823,31 +4754,32 @@ static inline void FUNC_NAME(void)
             if (ENABLE_DEPTH_TEST)                                              \
             {                                                                   \
                 /* TODO: Implement different depth funcs? */                    \
-                float depth =  sw_framebuffer_read_depth(ptr);                  \
+                float depth =  sw_framebuffer_read_depth(dptr);                 \
                 if (z > depth) goto discard;                                    \
             }                                                                   \
                                                                                 \
             /* TODO: Implement depth mask */                                    \
-            sw_framebuffer_write_depth(ptr, z);                                 \
+            sw_framebuffer_write_depth(dptr, z);                                \
                                                                                 \
-            if (ENABLE_TEXTURE)                                                 \
+            if (TEXTURE_MODE)                                                   \
             {                                                                   \
                 float texColor[4];                                              \
-                sw_texture_sample(texColor, tex, u, v, dUdx, dUdy, dVdx, dVdy); \
+                sw_texture_sample_mode(texColor, tex, u, v,                     \
+                                       dUdx, dUdy, dVdx, dVdy, TEXTURE_MODE);   \
                 srcColor[0] *= texColor[0];                                     \
                 srcColor[1] *= texColor[1];                                     \
                 srcColor[2] *= texColor[2];                                     \
                 srcColor[3] *= texColor[3];                                     \
             }                                                                   \
                                                                                 \
-            if (ENABLE_COLOR_BLEND)                                             \
+            if (BLEND_MODE)                                                     \
             {                                                                   \
                 float dstColor[4];                                              \
-                sw_framebuffer_read_color(dstColor, ptr);                       \
-                sw_blend_colors(dstColor, srcColor);                            \
-                sw_framebuffer_write_color(ptr, dstColor);                      \
+                sw_framebuffer_read_color(dstColor, cptr);                      \
+                sw_blend_colors_mode(dstColor, srcColor, BLEND_MODE);           \
+                sw_framebuffer_write_color(cptr, dstColor);                     \
             }                                                                   \
-            else sw_framebuffer_write_color(ptr, srcColor);                     \
+            else sw_framebuffer_write_color(cptr, srcColor);                    \
                                                                                 \
         discard:                                                                \
             z += dZdx;                                                          \
@@ -2855,12 +4787,12 @@ static inline void FUNC_NAME(void)
             color[1] += dCdx[1];                                                \
             color[2] += dCdx[2];                                                \
             color[3] += dCdx[3];                                                \
-            if (ENABLE_TEXTURE)                                                 \
+            if (TEXTURE_MODE)                                                   \
             {                                                                   \
                 u += dUdx;                                                      \
                 v += dVdx;                                                      \
             }                                                                   \
-            ++ptr;                                                              \
+            ++cptr; ++dptr;                                                     \
         }                                                                       \
                                                                                 \
         zScanline += dZdy;                                                      \
@@ -2869,7 +4801,7 @@ static inline void FUNC_NAME(void)
         colorScanline[2] += dCdy[2];                                            \
         colorScanline[3] += dCdy[3];                                            \
                                                                                 \
-        if (ENABLE_TEXTURE)                                                     \
+        if (TEXTURE_MODE)                                                       \
         {                                                                       \
             uScanline += dUdy;                                                  \
             vScanline += dVdy;                                                  \
@@ -2877,67 +4809,684 @@ static inline void FUNC_NAME(void)
     }                                                                           \
 }
 
-DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned, 0, 0, 0)
-DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_TEX, 1, 0, 0)
-DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_DEPTH, 0, 1, 0)
-DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_BLEND, 0, 0, 1)
-DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_TEX_DEPTH, 1, 1, 0)
-DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_TEX_BLEND, 1, 0, 1)
-DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_DEPTH_BLEND, 0, 1, 1)
-DEFINE_QUAD_RASTER_AXIS_ALIGNED(sw_quad_raster_axis_aligned_TEX_DEPTH_BLEND, 1, 1, 1)
+#define DEFINE_QUAD_RASTER_AXIS_ALIGNED_VARIANT(NAME, T, D, B) \
+    DEFINE_QUAD_RASTER_AXIS_ALIGNED(SW_RASTER_VARIANT_NAME(NAME, T, D, B), T, D, B)
+
+SW_RASTER_VARIANTS(DEFINE_QUAD_RASTER_AXIS_ALIGNED_VARIANT, sw_quad_raster_axis_aligned)
+
+typedef void (*sw_quad_raster_f)(const sw_vertex_t *vertices, const sw_texture_t *tex, int rowMin, int rowMax);
+
+// Axis-aligned quad raster functions indexed by variant, see sw_get_raster_variant()
+static const sw_quad_raster_f sw_quad_raster_axis_aligned_variants[SW_RASTER_VARIANT_COUNT] = {
+    SW_RASTER_VARIANTS(SW_RASTER_VARIANT_ENTRY, sw_quad_raster_axis_aligned)
+};
+
+#if (SW_COLOR_BUFFER_BITS == 32)
+// Sprite blitting, axis-aligned quads with constant color and depth and texcoords following the screen axes,
+// as drawn by raylib 2D functions, texels fetched with 16.16 fixed point stepping and combined on RGBA8 spans
+#define SW_SPRITE_SPAN_SIZE     64          // Pixels combined per span, texels gathered in a stack buffer
+#define SW_SPRITE_EPSILON       (1.0f/256)  // Texels offset tolerated over a quad, below RGBA8 precision with bilinear filtering
+
+typedef struct {
+    const sw_texture_level_t *level;        // Texture level sampled, NULL if texturing disabled
+    int xMin, yMin, xMax, yMax;             // Pixels covered, same bounds as the axis-aligned quad raster
+    int32_t s, t;                           // Texel coordinates at the first pixel center (16.16 fixed point)
+    int32_t dSdx, dTdy;                     // Texel coordinates steps per pixel (16.16 fixed point)
+    bool contiguous;                        // Texels rows fetched in order, unscaled and not flipped
+    bool tinted;                            // Color is not opaque white, texels must be modulated
+    uint8_t color[4];                       // Quad color, vertex colors are all equal
+    sw_depth_t depth;                       // Quad depth, vertex depths are all equal
+    int blendMode;                          // Raster blend mode, see SW_RASTER_BLEND_*
+} sw_sprite_t;
+
+// Setup axis-aligned quad blitting, returns false if the quad must be rasterized with interpolation
+static bool sw_sprite_setup(sw_sprite_t *sprite, const sw_vertex_t *vertices, const sw_texture_t *tex, int variant)
+{
+    int texMode = SW_RASTER_VARIANT_TEX_MODE(variant);
+    int blendMode = SW_RASTER_VARIANT_BLEND_MODE(variant);
+
+    if (SW_RASTER_VARIANT_DEPTH_TEST(variant) || (blendMode == SW_RASTER_BLEND_FACTORS)) return false;
+
+    for (int i = 1; i < 4; i++)
+    {
+        if ((vertices[i].color[0] != vertices[0].color[0]) || (vertices[i].color[1] != vertices[0].color[1]) ||
+            (vertices[i].color[2] != vertices[0].color[2]) || (vertices[i].color[3] != vertices[0].color[3])) return false;
+
+        if (vertices[i].homogeneous[2] != vertices[0].homogeneous[2]) return false;
+    }
+
+    const sw_vertex_t *sortedVerts[4];
+    sw_quad_sort_cw(sortedVerts, vertices);
+
+    const sw_vertex_t *v0 = sortedVerts[0];
+    const sw_vertex_t *v1 = sortedVerts[1];
+    const sw_vertex_t *v2 = sortedVerts[2];
+    const sw_vertex_t *v3 = sortedVerts[3];
+
+    float w = v2->screen[0] - v0->screen[0];
+    float h = v2->screen[1] - v0->screen[1];
+
+    if ((w <= 0.0f) || (h <= 0.0f)) return false;
+
+    sprite->xMin = (int)v0->screen[0];
+    sprite->yMin = (int)v0->screen[1];
+    sprite->xMax = (int)v2->screen[0];
+    sprite->yMax = (int)v2->screen[1];
+
+    sprite->level = NULL;
+    sprite->s = sprite->t = 0;
+    sprite->dSdx = sprite->dTdy = 0;
+    sprite->contiguous = false;
+
+    if (texMode != SW_RASTER_TEX_NONE)
+    {
+        // Texcoords must follow the screen axes and stay inside the texture, so no wrapping is required
+        if ((v0->texcoord[0] != v3->texcoord[0]) || (v1->texcoord[0] != v2->texcoord[0]) ||
+            (v0->texcoord[1] != v1->texcoord[1]) || (v3->texcoord[1] != v2->texcoord[1])) return false;
+
+        if ((v0->texcoord[0] < 0.0f) || (v0->texcoord[0] > 1.0f) || (v1->texcoord[0] < 0.0f) || (v1->texcoord[0] > 1.0f) ||
+            (v0->texcoord[1] < 0.0f) || (v0->texcoord[1] > 1.0f) || (v3->texcoord[1] < 0.0f) || (v3->texcoord[1] > 1.0f)) return false;
+
+        const sw_texture_level_t *level = &tex->levels[0];
+        if ((level->width > INT16_MAX) || (level->height > INT16_MAX)) return false;
+
+        // Texel coordinates at the first pixel center, subpixel corrected as the axis-aligned quad raster
+        float dSdx = (v1->texcoord[0] - v0->texcoord[0])*level->width/w;
+        float dTdy = (v3->texcoord[1] - v0->texcoord[1])*level->height/h;
+        float s = v0->texcoord[0]*level->width + dSdx*(1.0f - sw_fract(v0->screen[0]));
+        float t = v0->texcoord[1]*level->height + dTdy*(1.0f - sw_fract(v0->screen[1]));
+
+        // Unscaled quads keep one texel per pixel, steps snapped to avoid drifting
+        bool unscaledX = (fabsf(fabsf(dSdx) - 1.0f)*w < SW_SPRITE_EPSILON);
+        bool unscaledY = (fabsf(fabsf(dTdy) - 1.0f)*h < SW_SPRITE_EPSILON);
+        if (unscaledX) dSdx = (dSdx > 0.0f)? 1.0f : -1.0f;
+        if (unscaledY) dTdy = (dTdy > 0.0f)? 1.0f : -1.0f;
+
+        // Level of detail is constant over the quad, so the filter is resolved once,
+        // bilinear filtering only supported when pixel centers fall on texel centers
+        SWfilter filter = ((dSdx*dSdx <= 1.0f) && (dTdy*dTdy <= 1.0f))? tex->magFilter : tex->minFilter;
+        bool texelCentered = unscaledX && unscaledY &&
+            (fabsf(sw_fract(s) - 0.5f) < SW_SPRITE_EPSILON) && (fabsf(sw_fract(t) - 0.5f) < SW_SPRITE_EPSILON);
+
+        if ((filter != SW_NEAREST) && !texelCentered) return false;
+
+        sprite->level = level;
+        sprite->s = (int32_t)floorf(s*65536.0f + 0.5f);
+        sprite->t = (int32_t)floorf(t*65536.0f + 0.5f);
+        sprite->dSdx = (int32_t)floorf(dSdx*65536.0f + 0.5f);
+        sprite->dTdy = (int32_t)floorf(dTdy*65536.0f + 0.5f);
+
+        // Texels of a row fetched in order if steps are one texel and no index is clamped
+        int sLast = (sprite->s + (sprite->xMax - sprite->xMin - 1)*sprite->dSdx) >> 16;
+        sprite->contiguous = (sprite->dSdx == 65536) && (sprite->s >= 0) && (sLast <= level->wMinus1);
+    }
+
+    sw_float_to_unorm8_simd(sprite->color, v0->color);
+    sprite->tinted = (sprite->color[0] != 255) || (sprite->color[1] != 255) || (sprite->color[2] != 255) || (sprite->color[3] != 255);
+
+    sw_framebuffer_write_depth(&sprite->depth, v0->homogeneous[2]);
+    sprite->blendMode = blendMode;
+
+    return true;
+}
+
+// Fetch the texels of a sprite row span, count pixels starting at sprite column x
+static inline void sw_sprite_fetch_span(uint8_t *dst, const sw_sprite_t *sprite, int x, int y, int count)
+{
+    const sw_texture_level_t *level = sprite->level;
+
+    int32_t t = sprite->t + (y - sprite->yMin)*sprite->dTdy;
+    int ty = (t < 0)? 0 : (t >> 16);
+    ty = (ty > level->hMinus1)? level->hMinus1 : ty;
+
+    int32_t s = sprite->s + x*sprite->dSdx;
+
+    if (sprite->contiguous)
+    {
+        // Texels are contiguous along tile rows, copied up to the next tile boundary
+        int tx = s >> 16;
+
+        while (count > 0)
+        {
+            int run = SW_TEXTURE_TILE_SIZE - (tx & SW_TEXTURE_TILE_MASK);
+            if (run > count) run = count;
+
+            memcpy(dst, sw_texture_texel(level, tx, ty), 4*run);
+
+            dst += 4*run;
+            tx += run;
+            count -= run;
+        }
+
+        return;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        int tx = (s < 0)? 0 : (s >> 16);
+        tx = (tx > level->wMinus1)? level->wMinus1 : tx;
+
+        memcpy(dst + 4*i, sw_texture_texel(level, tx, ty), 4);
+        s += sprite->dSdx;
+    }
+}
+
+// Modulate RGBA8 pixels by color, p*(c + 1)/256, exact for white and black
+static inline void sw_sprite_span_modulate(uint8_t *pixels, const uint8_t color[4], int count)
+{
+    int i = 0;
+
+#if defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+    __m128i zero = _mm_setzero_si128();
+    __m128i scale = _mm_setr_epi16(color[0] + 1, color[1] + 1, color[2] + 1, color[3] + 1,
+                                   color[0] + 1, color[1] + 1, color[2] + 1, color[3] + 1);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i p = _mm_loadu_si128((const __m128i *)(pixels + 4*i));
+        __m128i lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(p, zero), scale), 8);
+        __m128i hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(p, zero), scale), 8);
+        _mm_storeu_si128((__m128i *)(pixels + 4*i), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
+    uint8x8x4_t scale;
+    for (int c = 0; c < 4; c++) scale.val[c] = vdup_n_u8(color[c]);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t p = vld4_u8(pixels + 4*i);
+        for (int c = 0; c < 4; c++)
+        {
+            uint16x8_t product = vmull_u8(p.val[c], scale.val[c]);
+            p.val[c] = vshrn_n_u16(vaddw_u8(product, p.val[c]), 8);
+        }
+        vst4_u8(pixels + 4*i, p);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        uint8_t *p = pixels + 4*i;
+        p[0] = (uint8_t)((p[0]*(color[0] + 1)) >> 8);
+        p[1] = (uint8_t)((p[1]*(color[1] + 1)) >> 8);
+        p[2] = (uint8_t)((p[2]*(color[2] + 1)) >> 8);
+        p[3] = (uint8_t)((p[3]*(color[3] + 1)) >> 8);
+    }
+}
+
+// Blend RGBA8 pixels over destination, (s*a + d*(255 - a))/255 rounded
+static inline void sw_sprite_span_blend_alpha(uint8_t *dst, const uint8_t *src, int count)
+{
+    int i = 0;
+
+#if defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+    __m128i zero = _mm_setzero_si128();
+    __m128i one = _mm_set1_epi16(255);
+    __m128i bias = _mm_set1_epi16(128);
+    __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + 4*i));
+        int opaque = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(s, alphaMask), alphaMask));
+        int transparent = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(s, alphaMask), zero));
+
+        // Skip blending of fully opaque or fully transparent pixels groups
+        if (opaque == 0xFFFF) { _mm_storeu_si128((__m128i *)(dst + 4*i), s); continue; }
+        if (transparent == 0xFFFF) continue;
+
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + 4*i));
+
+        __m128i sLo = _mm_unpacklo_epi8(s, zero);
+        __m128i sHi = _mm_unpackhi_epi8(s, zero);
+        __m128i aLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        __m128i aHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+        // NOTE: Sums fit 16 bits unsigned, (x + 128 + ((x + 128) >> 8)) >> 8 is x/255 rounded
+        __m128i lo = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(sLo, aLo), _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_sub_epi16(one, aLo))), bias);
+        __m128i hi = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(sHi, aHi), _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_sub_epi16(one, aHi))), bias);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+        _mm_storeu_si128((__m128i *)(dst + 4*i), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t s = vld4_u8(src + 4*i);
+        uint8x8x4_t d = vld4_u8(dst + 4*i);
+        uint8x8_t invAlpha = vmvn_u8(s.val[3]);
+
+        for (int c = 0; c < 4; c++)
+        {
+            uint16x8_t x = vmlal_u8(vmull_u8(s.val[c], s.val[3]), d.val[c], invAlpha);
+            d.val[c] = vrshrn_n_u16(vrsraq_n_u16(x, x, 8), 8);
+        }
+        vst4_u8(dst + 4*i, d);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const uint8_t *s = src + 4*i;
+        uint8_t *d = dst + 4*i;
+        int a = s[3];
+
+        for (int c = 0; c < 4; c++)
+        {
+            int x = s[c]*a + d[c]*(255 - a) + 128;
+            d[c] = (uint8_t)((x + (x >> 8)) >> 8);
+        }
+    }
+}
+
+// Add RGBA8 pixels scaled by their alpha to destination, d + s*a/255 rounded and saturated
+static inline void sw_sprite_span_blend_additive(uint8_t *dst, const uint8_t *src, int count)
+{
+    int i = 0;
+
+#if defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+    __m128i zero = _mm_setzero_si128();
+    __m128i bias = _mm_set1_epi16(128);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + 4*i));
+        __m128i sLo = _mm_unpacklo_epi8(s, zero);
+        __m128i sHi = _mm_unpackhi_epi8(s, zero);
+        __m128i aLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        __m128i aHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(sLo, aLo), bias);
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(sHi, aHi), bias);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst + 4*i));
+        _mm_storeu_si128((__m128i *)(dst + 4*i), _mm_adds_epu8(d, _mm_packus_epi16(lo, hi)));
+    }
+#elif defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t s = vld4_u8(src + 4*i);
+        uint8x8x4_t d = vld4_u8(dst + 4*i);
+
+        for (int c = 0; c < 4; c++)
+        {
+            uint16x8_t x = vmull_u8(s.val[c], s.val[3]);
+            d.val[c] = vqadd_u8(d.val[c], vrshrn_n_u16(vrsraq_n_u16(x, x, 8), 8));
+        }
+        vst4_u8(dst + 4*i, d);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const uint8_t *s = src + 4*i;
+        uint8_t *d = dst + 4*i;
+        int a = s[3];
+
+        for (int c = 0; c < 4; c++)
+        {
+            int x = s[c]*a + 128;
+            x = d[c] + ((x + (x >> 8)) >> 8);
+            d[c] = (uint8_t)((x > 255)? 255 : x);
+        }
+    }
+}
+
+// Blit sprite rows in range [rowMin, rowMax)
+static void sw_sprite_blit(const sw_sprite_t *sprite, int rowMin, int rowMax)
+{
+    SW_ALIGN(16) uint8_t texels[4*SW_SPRITE_SPAN_SIZE];
+
+    int yStart = (sprite->yMin > rowMin)? sprite->yMin : rowMin;
+    int yEnd = (sprite->yMax < rowMax)? sprite->yMax : rowMax;
+    int width = sprite->xMax - sprite->xMin;
+
+    // Untextured quads blend the quad color
+    if (sprite->level == NULL)
+    {
+        for (int i = 0; i < SW_SPRITE_SPAN_SIZE; i++) memcpy(&texels[4*i], sprite->color, 4);
+    }
+
+    for (int y = yStart; y < yEnd; y++)
+    {
+        uint8_t *cptr = (uint8_t *)sw_framebuffer_color_at(sprite->xMin, y);
+        sw_depth_t *dptr = sw_framebuffer_depth_at(sprite->xMin, y);
+
+        // TODO: Implement depth mask
+        for (int x = 0; x < width; x++) dptr[x] = sprite->depth;
+
+        // Opaque textured quads fetch texels straight into the framebuffer
+        if ((sprite->level != NULL) && (sprite->blendMode == SW_RASTER_BLEND_NONE))
+        {
+            sw_sprite_fetch_span(cptr, sprite, 0, y, width);
+            if (sprite->tinted) sw_sprite_span_modulate(cptr, sprite->color, width);
+            continue;
+        }
+
+        for (int x = 0; x < width; x += SW_SPRITE_SPAN_SIZE)
+        {
+            int count = ((width - x) < SW_SPRITE_SPAN_SIZE)? (width - x) : SW_SPRITE_SPAN_SIZE;
+
+            if (sprite->level != NULL)
+            {
+                sw_sprite_fetch_span(texels, sprite, x, y, count);
+                if (sprite->tinted) sw_sprite_span_modulate(texels, sprite->color, count);
+            }
+
+            switch (sprite->blendMode)
+            {
+                case SW_RASTER_BLEND_ALPHA: sw_sprite_span_blend_alpha(cptr + 4*x, texels, count); break;
+                case SW_RASTER_BLEND_ADDITIVE: sw_sprite_span_blend_additive(cptr + 4*x, texels, count); break;
+                default: memcpy(cptr + 4*x, texels, 4*count); break;
+            }
+        }
+    }
+}
+#endif // SW_COLOR_BUFFER_BITS == 32
+
+static inline void sw_quad_render(void)
+{
+    if (RLSW.stateFlags & SW_STATE_CULL_FACE)
+    {
+        if (!sw_quad_face_culling()) return;
+    }
+
+    sw_quad_clip_and_project();
+
+    if (RLSW.vertexCounter < 3) return;
+
+    sw_dirty_region_add_vertices(RLSW.vertexBuffer, RLSW.vertexCounter, 1.0f);
+
+    int variant = sw_get_raster_variant();
+    int path = SW_RASTER_PATH_POLYGON;
+
+    const sw_texture_t *tex = &RLSW.loadedTextures[RLSW.currentTexture];
+#if (SW_COLOR_BUFFER_BITS == 32)
+    sw_sprite_t sprite;
+#endif
+
+    if ((RLSW.vertexCounter == 4) && sw_quad_is_axis_aligned())
+    {
+        path = SW_RASTER_PATH_AXIS_ALIGNED;
+#if (SW_COLOR_BUFFER_BITS == 32)
+        if (sw_sprite_setup(&sprite, RLSW.vertexBuffer, tex, variant)) path = SW_RASTER_PATH_SPRITE;
+#endif
+    }
+
+#if (SW_RASTER_THREADS > 0)
+    if (sw_bins_push_polygon(variant, path)) return;
+#endif
+
+    switch (path)
+    {
+#if (SW_COLOR_BUFFER_BITS == 32)
+        case SW_RASTER_PATH_SPRITE: sw_sprite_blit(&sprite, 0, RLSW.framebuffer.height); break;
+#endif
+        case SW_RASTER_PATH_AXIS_ALIGNED: sw_quad_raster_axis_aligned_variants[variant](RLSW.vertexBuffer, tex, 0, RLSW.framebuffer.height); break;
+        default: sw_polygon_raster(RLSW.vertexBuffer, RLSW.vertexCounter, tex, variant, 0, RLSW.framebuffer.height); break;
+    }
+}
+//-------------------------------------------------------------------------------------------
+
+// Tile-binned rasterization logic
+//-------------------------------------------------------------------------------------------
+#if (SW_RASTER_THREADS > 0)
+// Grow a bins buffer to hold at least the required elements count
+static bool sw_bins_reserve(void **buffer, int *capacity, int required, int elementSize)
+{
+    if (required <= *capacity) return true;
+
+    int newCapacity = (*capacity > 0)? *capacity : 64;
+    while (newCapacity < required) newCapacity *= 2;
+
+    void *data = SW_REALLOC(*buffer, (size_t)newCapacity*elementSize);
+    if (data == NULL) return false;
+
+    *buffer = data;
+    *capacity = newCapacity;
+
+    return true;
+}
+
+// Rasterize the primitives of a tile, in submission order
+static void sw_bins_raster_tile(int tile)
+{
+    const sw_bin_tile_t *bin = &RLSW.bins.tiles[tile];
+    int rowMin = tile*SW_RASTER_TILE_HEIGHT;
+    int rowMax = rowMin + SW_RASTER_TILE_HEIGHT;
+
+    for (int i = 0; i < bin->count; i++)
+    {
+        const sw_bin_primitive_t *primitive = &RLSW.bins.primitives[bin->primitives[i]];
+        const sw_vertex_t *polygon = &RLSW.bins.vertices[primitive->vertexOffset];
+        const sw_texture_t *tex = &RLSW.loadedTextures[primitive->texture];
+
+        switch (primitive->path)
+        {
+#if (SW_COLOR_BUFFER_BITS == 32)
+            case SW_RASTER_PATH_SPRITE:
+            {
+                sw_sprite_t sprite;
+                sw_sprite_setup(&sprite, polygon, tex, primitive->variant);
+                sw_sprite_blit(&sprite, rowMin, rowMax);
+            } break;
+#endif
+            case SW_RASTER_PATH_AXIS_ALIGNED: sw_quad_raster_axis_aligned_variants[primitive->variant](polygon, tex, rowMin, rowMax); break;
+            default: sw_polygon_raster(polygon, primitive->vertexCount, tex, primitive->variant, rowMin, rowMax); break;
+        }
+    }
+}
+
+// Rasterize tiles until none is left, run by the worker threads and the calling thread
+static void sw_bins_raster_tiles(void)
+{
+    while (true)
+    {
+        pthread_mutex_lock(&RLSW.bins.mutex);
+        int tile = RLSW.bins.nextTile++;
+        pthread_mutex_unlock(&RLSW.bins.mutex);
+
+        if (tile >= RLSW.bins.tileCount) break;
+
+        if (RLSW.bins.tiles[tile].count > 0) sw_bins_raster_tile(tile);
+    }
+}
+
+static void *sw_bins_worker(void *arg)
+{
+    (void)arg;
+    unsigned int generation = 0;
+
+    pthread_mutex_lock(&RLSW.bins.mutex);
+
+    while (true)
+    {
+        while (!RLSW.bins.quit && (RLSW.bins.generation == generation)) pthread_cond_wait(&RLSW.bins.start, &RLSW.bins.mutex);
+        if (RLSW.bins.quit) break;
+
+        generation = RLSW.bins.generation;
+        pthread_mutex_unlock(&RLSW.bins.mutex);
+
+        sw_bins_raster_tiles();
+
+        pthread_mutex_lock(&RLSW.bins.mutex);
+        RLSW.bins.busyWorkers--;
+        if (RLSW.bins.busyWorkers == 0) pthread_cond_signal(&RLSW.bins.done);
+    }
+
+    pthread_mutex_unlock(&RLSW.bins.mutex);
+
+    return NULL;
+}
+
+// Rasterize all binned primitives, waits for completion
+static void sw_bins_flush(void)
+{
+    if (RLSW.bins.primitiveCount == 0) return;
 
-static inline void sw_quad_render(void)
+    pthread_mutex_lock(&RLSW.bins.mutex);
+    RLSW.bins.nextTile = 0;
+    RLSW.bins.busyWorkers = RLSW.bins.threadCount;
+    RLSW.bins.generation++;
+    pthread_cond_broadcast(&RLSW.bins.start);
+    pthread_mutex_unlock(&RLSW.bins.mutex);
+
+    sw_bins_raster_tiles();
+
+    pthread_mutex_lock(&RLSW.bins.mutex);
+    while (RLSW.bins.busyWorkers > 0) pthread_cond_wait(&RLSW.bins.done, &RLSW.bins.mutex);
+    pthread_mutex_unlock(&RLSW.bins.mutex);
+
+    for (int i = 0; i < RLSW.bins.tileCount; i++) RLSW.bins.tiles[i].count = 0;
+    RLSW.bins.primitiveCount = 0;
+    RLSW.bins.vertexCount = 0;
+}
+
+// Set tiles count to cover the framebuffer height
+// NOTE: Only called with empty bins, framebuffer resizing rasterizes binned primitives first
+static bool sw_bins_resize_tiles(int tileCount)
 {
-    if (RLSW.stateFlags & SW_STATE_CULL_FACE)
+    for (int i = tileCount; i < RLSW.bins.tileCount; i++) SW_FREE(RLSW.bins.tiles[i].primitives);
+
+    sw_bin_tile_t *tiles = (sw_bin_tile_t *)SW_REALLOC(RLSW.bins.tiles, tileCount*sizeof(sw_bin_tile_t));
+    if (tiles == NULL)
     {
-        if (!sw_quad_face_culling()) return;
+        if (tileCount < RLSW.bins.tileCount) RLSW.bins.tileCount = tileCount;   // Freed tiles lists are not valid anymore
+        return false;
     }
 
-    sw_quad_clip_and_project();
+    for (int i = RLSW.bins.tileCount; i < tileCount; i++) tiles[i] = SW_CURLY_INIT(sw_bin_tile_t) { 0 };
 
-    if (RLSW.vertexCounter < 3) return;
+    RLSW.bins.tiles = tiles;
+    RLSW.bins.tileCount = tileCount;
+
+    return true;
+}
+
+// Sort the clipped and projected polygon in vertex buffer into the tiles it overlaps
+// NOTE: Returns false if the polygon must be rasterized immediately
+static bool sw_bins_push_polygon(int variant, int path)
+{
+    if (!RLSW.bins.isReady) return false;
 
-    uint32_t state = RLSW.stateFlags;
-    if (RLSW.currentTexture == 0) state &= ~SW_STATE_TEXTURE_2D;
-    if ((RLSW.srcFactor == SW_ONE) && (RLSW.dstFactor == SW_ZERO)) state &= ~SW_STATE_BLEND;
+    const sw_vertex_t *polygon = RLSW.vertexBuffer;
+    int vertexCount = RLSW.vertexCounter;
 
-    if ((RLSW.vertexCounter == 4) && sw_quad_is_axis_aligned())
+    // Get the rows covered by the polygon, rasterizers fill rows [(int)yMin, (int)yMax)
+    float yMin = polygon[0].screen[1];
+    float yMax = polygon[0].screen[1];
+    for (int i = 1; i < vertexCount; i++)
     {
-        if (SW_STATE_CHECK_EX(state, SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_TEX_DEPTH_BLEND();
-        else if (SW_STATE_CHECK_EX(state, SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_DEPTH_BLEND();
-        else if (SW_STATE_CHECK_EX(state, SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) sw_quad_raster_axis_aligned_TEX_BLEND();
-        else if (SW_STATE_CHECK_EX(state, SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST)) sw_quad_raster_axis_aligned_TEX_DEPTH();
-        else if (SW_STATE_CHECK_EX(state, SW_STATE_BLEND)) sw_quad_raster_axis_aligned_BLEND();
-        else if (SW_STATE_CHECK_EX(state, SW_STATE_DEPTH_TEST)) sw_quad_raster_axis_aligned_DEPTH();
-        else if (SW_STATE_CHECK_EX(state, SW_STATE_TEXTURE_2D)) sw_quad_raster_axis_aligned_TEX();
-        else sw_quad_raster_axis_aligned();
-        return;
+        if (polygon[i].screen[1] < yMin) yMin = polygon[i].screen[1];
+        if (polygon[i].screen[1] > yMax) yMax = polygon[i].screen[1];
     }
 
-    #define TRIANGLE_RASTER(RASTER_FUNC)                        \
-    {                                                           \
-        for (int i = 0; i < RLSW.vertexCounter - 2; i++)        \
-        {                                                       \
-            RASTER_FUNC(                                        \
-                &RLSW.vertexBuffer[0],                          \
-                &RLSW.vertexBuffer[i + 1],                      \
-                &RLSW.vertexBuffer[i + 2],                      \
-                &RLSW.loadedTextures[RLSW.currentTexture]       \
-            );                                                  \
-        }                                                       \
+    int rowMin = (int)yMin;
+    int rowMax = (int)yMax;
+    if (rowMax <= rowMin) return true;  // No row to fill
+
+    int tileCount = (RLSW.framebuffer.height + SW_RASTER_TILE_HEIGHT - 1)/SW_RASTER_TILE_HEIGHT;
+    if ((tileCount != RLSW.bins.tileCount) && !sw_bins_resize_tiles(tileCount)) return false;
+
+    int firstTile = sw_clampi(rowMin/SW_RASTER_TILE_HEIGHT, 0, tileCount - 1);
+    int lastTile = sw_clampi((rowMax - 1)/SW_RASTER_TILE_HEIGHT, 0, tileCount - 1);
+
+    if (RLSW.bins.primitiveCount >= SW_RASTER_BIN_CAPACITY) sw_bins_flush();
+
+    // Reserve space for the primitive, if not available rasterize binned primitives
+    // to keep the submission order, and then the polygon immediately
+    bool reserved = sw_bins_reserve((void **)&RLSW.bins.vertices, &RLSW.bins.vertexCapacity, RLSW.bins.vertexCount + vertexCount, sizeof(sw_vertex_t)) &&
+                    sw_bins_reserve((void **)&RLSW.bins.primitives, &RLSW.bins.primitiveCapacity, RLSW.bins.primitiveCount + 1, sizeof(sw_bin_primitive_t));
+
+    for (int i = firstTile; reserved && (i <= lastTile); i++)
+    {
+        sw_bin_tile_t *bin = &RLSW.bins.tiles[i];
+        reserved = sw_bins_reserve((void **)&bin->primitives, &bin->capacity, bin->count + 1, sizeof(uint32_t));
+    }
+
+    if (!reserved)
+    {
+        sw_bins_flush();
+        return false;
+    }
+
+    // Store the polygon and sort it into the tiles
+    sw_bin_primitive_t *primitive = &RLSW.bins.primitives[RLSW.bins.primitiveCount];
+    primitive->vertexOffset = (uint32_t)RLSW.bins.vertexCount;
+    primitive->texture = RLSW.currentTexture;
+    primitive->vertexCount = (uint8_t)vertexCount;
+    primitive->variant = (uint8_t)variant;
+    primitive->path = (uint8_t)path;
+
+    for (int i = 0; i < vertexCount; i++) RLSW.bins.vertices[RLSW.bins.vertexCount + i] = polygon[i];
+    RLSW.bins.vertexCount += vertexCount;
+
+    for (int i = firstTile; i <= lastTile; i++)
+    {
+        sw_bin_tile_t *bin = &RLSW.bins.tiles[i];
+        bin->primitives[bin->count++] = (uint32_t)RLSW.bins.primitiveCount;
+    }
+
+    RLSW.bins.primitiveCount++;
+
+    return true;
+}
+
+// Start worker threads, tile-binned rasterization is disabled if none can be created
+static void sw_bins_init(void)
+{
+    pthread_mutex_init(&RLSW.bins.mutex, NULL);
+    pthread_cond_init(&RLSW.bins.start, NULL);
+    pthread_cond_init(&RLSW.bins.done, NULL);
+
+    for (int i = 0; i < SW_RASTER_THREADS; i++)
+    {
+        if (pthread_create(&RLSW.bins.threads[i], NULL, sw_bins_worker, NULL) != 0) break;
+        RLSW.bins.threadCount++;
+    }
+
+    RLSW.bins.isReady = (RLSW.bins.threadCount > 0);
+
+    if (RLSW.bins.isReady) SW_LOG("INFO: RLSW: Tile-binned rasterization enabled (%i worker threads)\n", RLSW.bins.threadCount);
+    else
+    {
+        pthread_cond_destroy(&RLSW.bins.done);
+        pthread_cond_destroy(&RLSW.bins.start);
+        pthread_mutex_destroy(&RLSW.bins.mutex);
+
+        SW_LOG("WARNING: RLSW: Failed to create rasterization worker threads, tile-binned rasterization disabled\n");
     }
+}
+
+// Stop worker threads and free bins, binned primitives are discarded
+static void sw_bins_close(void)
+{
+    if (!RLSW.bins.isReady) return;
 
-    if (SW_STATE_CHECK_EX(state, SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH_BLEND)
-    else if (SW_STATE_CHECK_EX(state, SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_DEPTH_BLEND)
-    else if (SW_STATE_CHECK_EX(state, SW_STATE_TEXTURE_2D | SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_TEX_BLEND)
-    else if (SW_STATE_CHECK_EX(state, SW_STATE_TEXTURE_2D | SW_STATE_DEPTH_TEST)) TRIANGLE_RASTER(sw_triangle_raster_TEX_DEPTH)
-    else if (SW_STATE_CHECK_EX(state, SW_STATE_BLEND)) TRIANGLE_RASTER(sw_triangle_raster_BLEND)
-    else if (SW_STATE_CHECK_EX(state, SW_STATE_DEPTH_TEST)) TRIANGLE_RASTER(sw_triangle_raster_DEPTH)
-    else if (SW_STATE_CHECK_EX(state, SW_STATE_TEXTURE_2D)) TRIANGLE_RASTER(sw_triangle_raster_TEX)
-    else TRIANGLE_RASTER(sw_triangle_raster)
+    pthread_mutex_lock(&RLSW.bins.mutex);
+    RLSW.bins.quit = true;
+    pthread_cond_broadcast(&RLSW.bins.start);
+    pthread_mutex_unlock(&RLSW.bins.mutex);
 
-    #undef TRIANGLE_RASTER
+    for (int i = 0; i < RLSW.bins.threadCount; i++) pthread_join(RLSW.bins.threads[i], NULL);
+
+    pthread_cond_destroy(&RLSW.bins.done);
+    pthread_cond_destroy(&RLSW.bins.start);
+    pthread_mutex_destroy(&RLSW.bins.mutex);
+
+    for (int i = 0; i < RLSW.bins.tileCount; i++) SW_FREE(RLSW.bins.tiles[i].primitives);
+    SW_FREE(RLSW.bins.tiles);
+    SW_FREE(RLSW.bins.primitives);
+    SW_FREE(RLSW.bins.vertices);
+
+    RLSW.bins.isReady = false;
 }
+#else
+static inline void sw_bins_flush(void) { }
+#endif
 //-------------------------------------------------------------------------------------------
 
 // Line rendering logic
@@ -3083,8 +5632,6 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1) \
     float b = v0->color[2] + bInc*substep;                              \
     float a = v0->color[3] + aInc*substep;                              \
                                                                         \
-    const int fbWidth = RLSW.framebuffer.width;                         \
-    sw_pixel_t *pixels = RLSW.framebuffer.pixels;                       \
                                                                         \
     int numPixels = (int)(steps - substep) + 1;                         \
                                                                         \
@@ -3094,26 +5641,27 @@ static inline void FUNC_NAME(const sw_vertex_t *v0, const sw_vertex_t *v1) \
         int px = (int)(x - 0.5f);                                       \
         int py = (int)(y - 0.5f);                                       \
                                                                         \
-        sw_pixel_t *ptr = pixels + py*fbWidth + px;                     \
+        sw_color_t *cptr = sw_framebuffer_color_at(px, py);             \
+        sw_depth_t *dptr = sw_framebuffer_depth_at(px, py);             \
                                                                         \
         if (ENABLE_DEPTH_TEST)                                          \
         {                                                               \
-            float depth = sw_framebuffer_read_depth(ptr);               \
+            float depth = sw_framebuffer_read_depth(dptr);              \
             if (z > depth) goto discard;                                \
         }                                                               \
                                                                         \
-        sw_framebuffer_write_depth(ptr, z);                             \
+        sw_framebuffer_write_depth(dptr, z);                            \
                                                                         \
         float color[4] = {r, g, b, a};                                  \
                                                                         \
         if (ENABLE_COLOR_BLEND)                                         \
         {                                                               \
             float dstColor[4];                                          \
-            sw_framebuffer_read_color(dstColor, ptr);                   \
+            sw_framebuffer_read_color(dstColor, cptr);                  \
             sw_blend_colors(dstColor, color);                           \
-            sw_framebuffer_write_color(ptr, dstColor);                  \
+            sw_framebuffer_write_color(cptr, dstColor);                 \
         }                                                               \
-        else sw_framebuffer_write_color(ptr, color);                    \
+        else sw_framebuffer_write_color(cptr, color);                   \
                                                                         \
     discard:                                                            \
         x += xInc; y += yInc; z += zInc;                                \
@@ -3184,6 +5732,10 @@ static inline void sw_line_render(sw_vertex_t *vertices)
 {
     if (!sw_line_clip_and_project(&vertices[0], &vertices[1])) return;
 
+    sw_dirty_region_add_vertices(vertices, 2, 0.5f*RLSW.lineWidth + 1.0f);
+
+    sw_bins_flush();    // Lines are rasterized immediately, after binned primitives
+
     if (RLSW.lineWidth >= 2.0f)
     {
         if (SW_STATE_CHECK(SW_STATE_DEPTH_TEST | SW_STATE_BLEND)) sw_line_thick_raster_DEPTH_BLEND(&vertices[0], &vertices[1]);
@@ -3253,25 +5805,25 @@ static inline void FUNC_NAME(int x, int y, float z, const float color[4])   \
         if ((y < RLSW.scMin[1]) || (y >= RLSW.scMax[1])) return;            \
     }                                                                       \
                                                                             \
-    int offset = y*RLSW.framebuffer.width + x;                              \
-    sw_pixel_t *ptr = RLSW.framebuffer.pixels + offset;                     \
+    sw_color_t *cptr = sw_framebuffer_color_at(x, y);                       \
+    sw_depth_t *dptr = sw_framebuffer_depth_at(x, y);                       \
                                                                             \
     if (ENABLE_DEPTH_TEST)                                                  \
     {                                                                       \
-        float depth = sw_framebuffer_read_depth(ptr);                       \
+        float depth = sw_framebuffer_read_depth(dptr);                      \
         if (z > depth) return;                                              \
     }                                                                       \
                                                                             \
-    sw_framebuffer_write_depth(ptr, z);                                     \
+    sw_framebuffer_write_depth(dptr, z);                                    \
                                                                             \
     if (ENABLE_COLOR_BLEND)                                                 \
     {                                                                       \
         float dstColor[4];                                                  \
-        sw_framebuffer_read_color(dstColor, ptr);                           \
+        sw_framebuffer_read_color(dstColor, cptr);                          \
         sw_blend_colors(dstColor, color);                                   \
-        sw_framebuffer_write_color(ptr, dstColor);                          \
+        sw_framebuffer_write_color(cptr, dstColor);                         \
     }                                                                       \
-    else sw_framebuffer_write_color(ptr, color);                            \
+    else sw_framebuffer_write_color(cptr, color);                           \
 }
 
 #define DEFINE_POINT_THICK_RASTER(FUNC_NAME, RASTER_FUNC)                   \
@@ -3338,6 +5890,10 @@ static inline void sw_point_render(sw_vertex_t *v)
 {
     if (!sw_point_clip_and_project(v)) return;
 
+    sw_dirty_region_add_vertices(v, 1, RLSW.pointRadius + 1.0f);
+
+    sw_bins_flush();    // Points are rasterized immediately, after binned primitives
+
     if (RLSW.pointRadius >= 1.0f)
     {
         if (SW_STATE_CHECK(SW_STATE_SCISSOR_TEST))
@@ -3399,29 +5955,104 @@ static inline void sw_poly_fill_render(void)
 }
 //-------------------------------------------------------------------------------------------
 
-// Immediate rendering logic
+// Vertex processing logic
 //-------------------------------------------------------------------------------------------
-void sw_immediate_push_vertex(const float position[4], const float color[4], const float texcoord[2])
+// Calculate vertex homogeneous coordinates, position transformed by the MVP matrix
+// NOTE: Matrix columns scaled by the position components and summed in the same order as
+// the scalar expression m[0]*x + m[4]*y + m[8]*z + m[12]*w, so results match bit for bit
+static inline void sw_vertex_transform(sw_vertex_t *vertex)
 {
-    // Copy the attributes in the current vertex
-    sw_vertex_t *vertex = &RLSW.vertexBuffer[RLSW.vertexCounter++];
-    for (int i = 0; i < 4; i++)
-    {
-        vertex->position[i] = position[i];
-        if (i < 2) vertex->texcoord[i] = texcoord[i];
-        vertex->color[i] = color[i];
-    }
-
-    // Calculate homogeneous coordinates
     const float *m = RLSW.matMVP, *v = vertex->position;
+
+#if defined(SW_HAS_SSE) || defined(SW_HAS_SSE2) || defined(SW_HAS_SSE3) || defined(SW_HAS_SSSE3) || defined(SW_HAS_SSE41) || defined(SW_HAS_SSE42)
+    __m128 h = _mm_mul_ps(_mm_loadu_ps(m), _mm_set1_ps(v[0]));
+    h = _mm_add_ps(h, _mm_mul_ps(_mm_loadu_ps(m + 4), _mm_set1_ps(v[1])));
+    h = _mm_add_ps(h, _mm_mul_ps(_mm_loadu_ps(m + 8), _mm_set1_ps(v[2])));
+    h = _mm_add_ps(h, _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(v[3])));
+    _mm_storeu_ps(vertex->homogeneous, h);
+#elif defined(SW_HAS_NEON) || defined(SW_HAS_NEON_FMA)
+    float32x4_t h = vmulq_n_f32(vld1q_f32(m), v[0]);
+    h = vaddq_f32(h, vmulq_n_f32(vld1q_f32(m + 4), v[1]));
+    h = vaddq_f32(h, vmulq_n_f32(vld1q_f32(m + 8), v[2]));
+    h = vaddq_f32(h, vmulq_n_f32(vld1q_f32(m + 12), v[3]));
+    vst1q_f32(vertex->homogeneous, h);
+#else
     vertex->homogeneous[0] = m[0]*v[0] + m[4]*v[1] + m[8]*v[2] + m[12]*v[3];
     vertex->homogeneous[1] = m[1]*v[0] + m[5]*v[1] + m[9]*v[2] + m[13]*v[3];
     vertex->homogeneous[2] = m[2]*v[0] + m[6]*v[1] + m[10]*v[2] + m[14]*v[3];
     vertex->homogeneous[3] = m[3]*v[0] + m[7]*v[1] + m[11]*v[2] + m[15]*v[3];
+#endif
+}
+
+// Vertex arrays bound for a draw, with the attributes used when an array is not bound
+typedef struct {
+    const float *positions;
+    const float *texcoords;
+    const uint8_t *colors;
+    const float *texMatrix;
+    float texcoord[2];
+    float color[4];
+} sw_vertex_arrays_t;
+
+static inline void sw_vertex_arrays_init(sw_vertex_arrays_t *arrays)
+{
+    arrays->positions = RLSW.array.positions;
+    arrays->texcoords = RLSW.array.texcoords;
+    arrays->colors = RLSW.array.colors;
+    arrays->texMatrix = RLSW.stackTexture[RLSW.stackTextureCounter - 1];
+
+    for (int i = 0; i < 2; i++) arrays->texcoord[i] = RLSW.current.texcoord[i];
+    for (int i = 0; i < 4; i++) arrays->color[i] = RLSW.current.color[i];
+}
+
+// Fetch vertex attributes from arrays and transform the vertex
+static inline void sw_vertex_arrays_fetch(sw_vertex_t *vertex, const sw_vertex_arrays_t *arrays, int index)
+{
+    float u = arrays->texcoord[0];
+    float v = arrays->texcoord[1];
+    if (arrays->texcoords)
+    {
+        u = arrays->texcoords[2*index];
+        v = arrays->texcoords[2*index + 1];
+    }
+
+    const float *texMatrix = arrays->texMatrix;
+    vertex->texcoord[0] = texMatrix[0]*u + texMatrix[4]*v + texMatrix[12];
+    vertex->texcoord[1] = texMatrix[1]*u + texMatrix[5]*v + texMatrix[13];
+
+    for (int i = 0; i < 4; i++) vertex->color[i] = arrays->color[i];
+    if (arrays->colors)
+    {
+        const uint8_t *color = &arrays->colors[4*index];
+        vertex->color[0] *= (float)color[0]*SW_INV_255;
+        vertex->color[1] *= (float)color[1]*SW_INV_255;
+        vertex->color[2] *= (float)color[2]*SW_INV_255;
+        vertex->color[3] *= (float)color[3]*SW_INV_255;
+    }
+
+    const float *position = &arrays->positions[3*index];
+    vertex->position[0] = position[0];
+    vertex->position[1] = position[1];
+    vertex->position[2] = position[2];
+    vertex->position[3] = 1.0f;
 
+    sw_vertex_transform(vertex);
+}
+//-------------------------------------------------------------------------------------------
+
+// Immediate rendering logic
+//-------------------------------------------------------------------------------------------
+// Render the current primitive once all its vertices are pushed
+static inline void sw_immediate_push_primitive(void)
+{
     // Immediate rendering of the primitive if the required number is reached
     if (RLSW.vertexCounter == RLSW.reqVertices)
     {
+#if SW_DEPTH_TILES
+        // Depth written without depth test can be farther than depth tiles, tiles are unknown until cleared
+        if (!SW_STATE_CHECK(SW_STATE_DEPTH_TEST)) RLSW.framebuffer.depthTilesValid = false;
+#endif
+
         switch (RLSW.polyMode)
         {
             case SW_FILL: sw_poly_fill_render(); break;
@@ -3434,6 +6065,27 @@ void sw_immediate_push_vertex(const float position[4], const float color[4], con
     }
 }
 
+void sw_immediate_push_vertex(const float position[4], const float color[4], const float texcoord[2])
+{
+    // Copy the attributes in the current vertex
+    sw_vertex_t *vertex = &RLSW.vertexBuffer[RLSW.vertexCounter++];
+    for (int i = 0; i < 4; i++)
+    {
+        vertex->position[i] = position[i];
+        if (i < 2) vertex->texcoord[i] = texcoord[i];
+        vertex->color[i] = color[i];
+    }
+
+    sw_vertex_transform(vertex);
+    sw_immediate_push_primitive();
+}
+
+// Push a vertex already transformed, from the vertex cache or arrays
+static inline void sw_immediate_push_transformed(const sw_vertex_t *vertex)
+{
+    RLSW.vertexBuffer[RLSW.vertexCounter++] = *vertex;
+    sw_immediate_push_primitive();
+}
 //-------------------------------------------------------------------------------------------
 
 // Validity check helper functions
@@ -3454,6 +6106,13 @@ static inline bool sw_is_texture_filter_valid(int filter)
     return ((filter == SW_NEAREST) || (filter == SW_LINEAR));
 }
 
+static inline bool sw_is_texture_min_filter_valid(int filter)
+{
+    return (sw_is_texture_filter_valid(filter) ||
+        (filter == SW_NEAREST_MIPMAP_NEAREST) || (filter == SW_LINEAR_MIPMAP_NEAREST) ||
+        (filter == SW_NEAREST_MIPMAP_LINEAR) || (filter == SW_LINEAR_MIPMAP_LINEAR));
+}
+
 static inline bool sw_is_texture_wrap_valid(int wrap)
 {
     return ((wrap == SW_REPEAT) || (wrap == SW_CLAMP));
@@ -3558,8 +6217,8 @@ bool swInit(int w, int h)
     if (RLSW.loadedTextures == NULL) { swClose(); return false; }
 
     const float clearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
-    sw_framebuffer_write_color(&RLSW.clearValue, clearColor);
-    sw_framebuffer_write_depth(&RLSW.clearValue, 1.0f);
+    sw_framebuffer_write_color(&RLSW.clearColor, clearColor);
+    sw_framebuffer_write_depth(&RLSW.clearDepth, 1.0f);
 
     RLSW.currentMatrixMode = SW_MODELVIEW;
     RLSW.currentMatrix = &RLSW.stackModelview[0];
@@ -3591,11 +6250,10 @@ bool swInit(int w, int h)
     RLSW.polyMode = SW_FILL;
     RLSW.cullFace = SW_BACK;
 
-    static uint32_t defaultTex[3*2*2] = {
-        0xFFFFFFFF,
-        0xFFFFFFFF,
-        0xFFFFFFFF,
-        0xFFFFFFFF
+    // NOTE: Texture pixels stored in tiles, a 2x2 texture uses a full 4x4 tile
+    static uint32_t defaultTex[SW_TEXTURE_TILE_SIZE*SW_TEXTURE_TILE_SIZE + 2] = {
+        0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+        0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
     };
 
     RLSW.loadedTextures[0].pixels = (uint8_t*)defaultTex;
@@ -3603,6 +6261,13 @@ bool swInit(int w, int h)
     RLSW.loadedTextures[0].height = 2;
     RLSW.loadedTextures[0].wMinus1 = 1;
     RLSW.loadedTextures[0].hMinus1 = 1;
+    RLSW.loadedTextures[0].levels[0].pixels = (uint8_t*)defaultTex;
+    RLSW.loadedTextures[0].levels[0].width = 2;
+    RLSW.loadedTextures[0].levels[0].height = 2;
+    RLSW.loadedTextures[0].levels[0].wMinus1 = 1;
+    RLSW.loadedTextures[0].levels[0].hMinus1 = 1;
+    RLSW.loadedTextures[0].levels[0].tileStride = 1;
+    RLSW.loadedTextures[0].levelCount = 1;
     RLSW.loadedTextures[0].minFilter = SW_NEAREST;
     RLSW.loadedTextures[0].magFilter = SW_NEAREST;
     RLSW.loadedTextures[0].sWrap = SW_REPEAT;
@@ -3613,6 +6278,9 @@ bool swInit(int w, int h)
     RLSW.loadedTextureCount = 1;
 
     SW_LOG("INFO: RLSW: Software renderer initialized successfully\n");
+#if (SW_RASTER_THREADS > 0)
+    sw_bins_init();
+#endif
 #if defined(SW_HAS_FMA_AVX) && defined(SW_HAS_FMA_AVX2)
     SW_LOG("INFO: RLSW: Using SIMD instructions: FMA AVX\n");
 #endif
@@ -3634,6 +6302,10 @@ bool swInit(int w, int h)
 
 void swClose(void)
 {
+#if (SW_RASTER_THREADS > 0)
+    sw_bins_close();
+#endif
+
     // NOTE: Starts at texture 1, texture 0 does not have to be freed
     for (int i = 1; i < RLSW.loadedTextureCount; i++)
     {
@@ -3643,7 +6315,11 @@ void swClose(void)
         }
     }
 
-    SW_FREE(RLSW.framebuffer.pixels);
+    SW_FREE(RLSW.framebuffer.colorInternal);
+    SW_FREE(RLSW.framebuffer.depth);
+#if SW_DEPTH_TILES
+    SW_FREE(RLSW.framebuffer.depthTiles);
+#endif
     SW_FREE(RLSW.loadedTextures);
     SW_FREE(RLSW.freeTextureIds);
 
@@ -3652,11 +6328,74 @@ void swClose(void)
 
 bool swResizeFramebuffer(int w, int h)
 {
+    sw_bins_flush();
+
     return sw_framebuffer_resize(w, h);
 }
 
+// Set user memory to render color into, NULL restores internal color buffer
+// NOTE: Memory must fit framebuffer size with native color format (SW_COLOR_BUFFER_BITS), pitch in bytes per row
+bool swSetColorBuffer(void *pixels, int pitch)
+{
+    sw_bins_flush();
+
+    if (pixels == NULL)
+    {
+        RLSW.framebuffer.color = RLSW.framebuffer.colorInternal;
+        RLSW.framebuffer.pitch = RLSW.framebuffer.width*(int)sizeof(sw_color_t);
+        sw_dirty_region_invalidate();
+        return true;
+    }
+
+    if ((pitch < RLSW.framebuffer.width*(int)sizeof(sw_color_t)) || (pitch%(int)sizeof(SW_COLOR_TYPE) != 0))
+    {
+        RLSW.errCode = SW_INVALID_VALUE;
+        return false;
+    }
+
+    RLSW.framebuffer.color = (sw_color_t *)pixels;
+    RLSW.framebuffer.pitch = pitch;
+    sw_dirty_region_invalidate();
+
+    return true;
+}
+
+// Complete rasterization of submitted primitives, only required with tile-binned rasterization (SW_RASTER_THREADS)
+// NOTE: Called internally before the framebuffer is read, required before reading user memory color buffer
+void swFinish(void)
+{
+    sw_bins_flush();
+}
+
+// Get color buffer region modified since last swResetDirtyRegion(), false if no pixel was modified
+// NOTE: Region is conservative, it covers every modified pixel but can include unmodified ones
+bool swGetDirtyRegion(int *x, int *y, int *w, int *h)
+{
+    const sw_framebuffer_t *fb = &RLSW.framebuffer;
+
+    sw_dirty_region_update();
+
+    if ((fb->dirtyMin[0] > fb->dirtyMax[0]) || (fb->dirtyMin[1] > fb->dirtyMax[1])) return false;
+
+    if (x) *x = fb->dirtyMin[0];
+    if (y) *y = fb->dirtyMin[1];
+    if (w) *w = fb->dirtyMax[0] - fb->dirtyMin[0] + 1;
+    if (h) *h = fb->dirtyMax[1] - fb->dirtyMin[1] + 1;
+
+    return true;
+}
+
+// Reset color buffer modified region, usually once the frame is presented
+void swResetDirtyRegion(void)
+{
+    sw_dirty_region_update();
+    sw_dirty_region_empty(RLSW.framebuffer.dirtyMin, RLSW.framebuffer.dirtyMax);
+}
+
 void swCopyFramebuffer(int x, int y, int w, int h, SWformat format, SWtype type, void *pixels)
 {
+    sw_bins_flush();
+
     sw_pixelformat_t pFormat = (sw_pixelformat_t)sw_get_pixel_format(format, type);
 
     if (w <= 0) { RLSW.errCode = SW_INVALID_VALUE; return; }
@@ -3695,7 +6434,7 @@ void swCopyFramebuffer(int x, int y, int w, int h, SWformat format, SWtype type,
         case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8: sw_framebuffer_copy_to_R8G8B8(x, y, w, h, (uint8_t *)pixels); break;
         case SW_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: sw_framebuffer_copy_to_R5G5B5A1(x, y, w, h, (uint16_t *)pixels); break;
         case SW_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: sw_framebuffer_copy_to_R4G4B4A4(x, y, w, h, (uint16_t *)pixels); break;
-        //case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: sw_framebuffer_copy_to_R8G8B8A8(x, y, w, h, (uint8_t *)pixels); break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: sw_framebuffer_copy_to_R8G8B8A8(x, y, w, h, (uint8_t *)pixels); break;
         // Below: not implemented
         case SW_PIXELFORMAT_UNCOMPRESSED_R32:
         case SW_PIXELFORMAT_UNCOMPRESSED_R32G32B32:
@@ -3707,8 +6446,61 @@ void swCopyFramebuffer(int x, int y, int w, int h, SWformat format, SWtype type,
     }
 }
 
+// Copy framebuffer region into pixels at the same position, pixels rows are pitch bytes apart
+// NOTE: Useful to update only the modified region of a presented image, see swGetDirtyRegion()
+void swCopyFramebufferRegion(int x, int y, int w, int h, SWformat format, SWtype type, void *pixels, int pitch)
+{
+    sw_bins_flush();
+
+    sw_pixelformat_t pFormat = (sw_pixelformat_t)sw_get_pixel_format(format, type);
+
+    int x1 = sw_clampi(x + w, 0, RLSW.framebuffer.width);
+    int y1 = sw_clampi(y + h, 0, RLSW.framebuffer.height);
+    x = sw_clampi(x, 0, RLSW.framebuffer.width);
+    y = sw_clampi(y, 0, RLSW.framebuffer.height);
+    w = x1 - x;
+    h = y1 - y;
+
+    if ((w <= 0) || (h <= 0)) return;
+
+    int pixelSize = 0;
+    switch (pFormat)
+    {
+        case SW_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: pixelSize = 1; break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case SW_PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case SW_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case SW_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: pixelSize = 2; break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8: pixelSize = 3; break;
+        case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: pixelSize = 4; break;
+        default: RLSW.errCode = SW_INVALID_ENUM; return;
+    }
+
+    if (pitch < RLSW.framebuffer.width*pixelSize) { RLSW.errCode = SW_INVALID_VALUE; return; }
+
+    // Rows copied one by one with the copy conversion kernels
+    for (int iy = y; iy < y + h; iy++)
+    {
+        uint8_t *row = (uint8_t *)pixels + (size_t)iy*pitch + (size_t)x*pixelSize;
+
+        switch (pFormat)
+        {
+            case SW_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: sw_framebuffer_copy_to_GRAYSCALE(x, iy, w, 1, row); break;
+            case SW_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: sw_framebuffer_copy_to_GRAYALPHA(x, iy, w, 1, row); break;
+            case SW_PIXELFORMAT_UNCOMPRESSED_R5G6B5: sw_framebuffer_copy_to_R5G6B5(x, iy, w, 1, (uint16_t *)row); break;
+            case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8: sw_framebuffer_copy_to_R8G8B8(x, iy, w, 1, row); break;
+            case SW_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: sw_framebuffer_copy_to_R5G5B5A1(x, iy, w, 1, (uint16_t *)row); break;
+            case SW_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: sw_framebuffer_copy_to_R4G4B4A4(x, iy, w, 1, (uint16_t *)row); break;
+            case SW_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: sw_framebuffer_copy_to_R8G8B8A8(x, iy, w, 1, row); break;
+            default: break;
+        }
+    }
+}
+
 void swBlitFramebuffer(int xDst, int yDst, int wDst, int hDst, int xSrc, int ySrc, int wSrc, int hSrc, SWformat format, SWtype type, void *pixels)
 {
+    sw_bins_flush();
+
     sw_pixelformat_t pFormat = (sw_pixelformat_t)sw_get_pixel_format(format, type);
 
     if (wSrc <= 0) { RLSW.errCode = SW_INVALID_VALUE; return; }
@@ -3792,11 +6584,11 @@ void swGetFloatv(SWget name, float *v)
     {
         case SW_COLOR_CLEAR_VALUE:
         {
-            sw_framebuffer_read_color(v, &RLSW.clearValue);
+            sw_framebuffer_read_color(v, &RLSW.clearColor);
         } break;
         case SW_DEPTH_CLEAR_VALUE:
         {
-            v[0] = sw_framebuffer_read_depth(&RLSW.clearValue);
+            v[0] = sw_framebuffer_read_depth(&RLSW.clearDepth);
         } break;
         case SW_CURRENT_COLOR:
         {
@@ -3905,30 +6697,20 @@ void swScissor(int x, int y, int width, int height)
 void swClearColor(float r, float g, float b, float a)
 {
     float v[4] = { r, g, b, a };
-    sw_framebuffer_write_color(&RLSW.clearValue, v);
+    sw_framebuffer_write_color(&RLSW.clearColor, v);
 }
 
 void swClearDepth(float depth)
 {
-    sw_framebuffer_write_depth(&RLSW.clearValue, depth);
+    sw_framebuffer_write_depth(&RLSW.clearDepth, depth);
 }
 
 void swClear(uint32_t bitmask)
 {
-    int size = RLSW.framebuffer.width*RLSW.framebuffer.height;
+    sw_bins_flush();
 
-    if ((bitmask & (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT)) == (SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT))
-    {
-        sw_framebuffer_fill(RLSW.framebuffer.pixels, size, RLSW.clearValue);
-    }
-    else if (bitmask & (SW_COLOR_BUFFER_BIT))
-    {
-        sw_framebuffer_fill_color(RLSW.framebuffer.pixels, size, RLSW.clearValue.color);
-    }
-    else if (bitmask & SW_DEPTH_BUFFER_BIT)
-    {
-        sw_framebuffer_fill_depth(RLSW.framebuffer.pixels, size, RLSW.clearValue.depth);
-    }
+    if (bitmask & SW_COLOR_BUFFER_BIT) sw_framebuffer_fill_color(RLSW.clearColor);
+    if (bitmask & SW_DEPTH_BUFFER_BIT) sw_framebuffer_fill_depth(RLSW.clearDepth);
 }
 
 void swBlendFunc(SWfactor sfactor, SWfactor dfactor)
@@ -3940,6 +6722,8 @@ void swBlendFunc(SWfactor sfactor, SWfactor dfactor)
         return;
     }
 
+    if ((sfactor != RLSW.srcFactor) || (dfactor != RLSW.dstFactor)) sw_bins_flush();
+
     RLSW.srcFactor = sfactor;
     RLSW.dstFactor = dfactor;
 
@@ -4485,60 +7269,16 @@ void swDrawArrays(SWdraw mode, int offset, int count)
 
     swBegin(mode);
     {
-        const float *texMatrix = RLSW.stackTexture[RLSW.stackTextureCounter - 1];
-        const float *defaultTexcoord = RLSW.current.texcoord;
-        const float *defaultColor = RLSW.current.color;
-
-        const float *positions = RLSW.array.positions;
-        const float *texcoords = RLSW.array.texcoords;
-        const uint8_t *colors = RLSW.array.colors;
+        sw_vertex_arrays_t arrays;
+        sw_vertex_arrays_init(&arrays);
 
+        sw_vertex_t vertex;
         int end = offset + count;
 
         for (int i = offset; i < end; i++)
         {
-            float u, v;
-            if (texcoords)
-            {
-                int idx = 2*i;
-                u = texcoords[idx];
-                v = texcoords[idx + 1];
-            }
-            else
-            {
-                u = defaultTexcoord[0];
-                v = defaultTexcoord[1];
-            }
-
-            float texcoord[2];
-            texcoord[0] = texMatrix[0]*u + texMatrix[4]*v + texMatrix[12];
-            texcoord[1] = texMatrix[1]*u + texMatrix[5]*v + texMatrix[13];
-
-            float color[4] = {
-                defaultColor[0],
-                defaultColor[1],
-                defaultColor[2],
-                defaultColor[3]
-            };
-
-            if (colors)
-            {
-                int idx = 4*i;
-                color[0] *= (float)colors[idx]*SW_INV_255;
-                color[1] *= (float)colors[idx + 1]*SW_INV_255;
-                color[2] *= (float)colors[idx + 2]*SW_INV_255;
-                color[3] *= (float)colors[idx + 3]*SW_INV_255;
-            }
-
-            int idx = 3*i;
-            float position[4] = {
-                positions[idx],
-                positions[idx + 1],
-                positions[idx + 2],
-                1.0f
-            };
-
-            sw_immediate_push_vertex(position, color, texcoord);
+            sw_vertex_arrays_fetch(&vertex, &arrays, i);
+            sw_immediate_push_transformed(&vertex);
         }
     }
     swEnd();
@@ -4580,61 +7320,27 @@ void swDrawElements(SWdraw mode, int count, int type, const void *indices)
 
     swBegin(mode);
     {
-        const float *texMatrix = RLSW.stackTexture[RLSW.stackTextureCounter - 1];
-        const float *defaultTexcoord = RLSW.current.texcoord;
-        const float *defaultColor = RLSW.current.color;
+        sw_vertex_arrays_t arrays;
+        sw_vertex_arrays_init(&arrays);
 
-        const float *positions = RLSW.array.positions;
-        const float *texcoords = RLSW.array.texcoords;
-        const uint8_t *colors = RLSW.array.colors;
+        // Vertices shared by primitives are transformed once, while they stay cached
+        memset(RLSW.vertexCacheIndex, 0xFF, sizeof(RLSW.vertexCacheIndex));
 
         for (int i = 0; i < count; i++)
         {
-            int index = indicesUb? indicesUb[i] :
-                       (indicesUs? indicesUs[i] : indicesUi[i]);
-
-            float u, v;
-            if (texcoords)
-            {
-                int idx = 2*index;
-                u = texcoords[idx];
-                v = texcoords[idx + 1];
-            }
-            else
-            {
-                u = defaultTexcoord[0];
-                v = defaultTexcoord[1];
-            }
+            uint32_t index = indicesUb? indicesUb[i] :
+                            (indicesUs? indicesUs[i] : indicesUi[i]);
 
-            float texcoord[2];
-            texcoord[0] = texMatrix[0]*u + texMatrix[4]*v + texMatrix[12];
-            texcoord[1] = texMatrix[1]*u + texMatrix[5]*v + texMatrix[13];
+            int slot = index & (SW_VERTEX_CACHE_SIZE - 1);
+            sw_vertex_t *vertex = &RLSW.vertexCache[slot];
 
-            float color[4] = {
-                defaultColor[0],
-                defaultColor[1],
-                defaultColor[2],
-                defaultColor[3]
-            };
-
-            if (colors)
+            if (RLSW.vertexCacheIndex[slot] != index)
             {
-                int idx = 4*index;
-                color[0] *= (float)colors[idx]*SW_INV_255;
-                color[1] *= (float)colors[idx + 1]*SW_INV_255;
-                color[2] *= (float)colors[idx + 2]*SW_INV_255;
-                color[3] *= (float)colors[idx + 3]*SW_INV_255;
+                sw_vertex_arrays_fetch(vertex, &arrays, index);
+                RLSW.vertexCacheIndex[slot] = index;
             }
 
-            int idx = 3*index;
-            float position[4] = {
-                positions[idx],
-                positions[idx + 1],
-                positions[idx + 2],
-                1.0f
-            };
-
-            sw_immediate_push_vertex(position, color, texcoord);
+            sw_immediate_push_transformed(vertex);
         }
     }
     swEnd();
@@ -4665,6 +7371,8 @@ void swDeleteTextures(int count, uint32_t *textures)
 {
     if ((count == 0) || (textures == NULL)) return;
 
+    sw_bins_flush();
+
     for (int i = 0; i < count; i++)
     {
         if (!sw_is_texture_valid(textures[i]))
@@ -4682,6 +7390,13 @@ void swDeleteTextures(int count, uint32_t *textures)
 
 void swTexImage2D(int width, int height, SWformat format, SWtype type, const void *data)
 {
+    swTexImage2DLevel(0, width, height, format, type, data);
+}
+
+void swTexImage2DLevel(int level, int width, int height, SWformat format, SWtype type, const void *data)
+{
+    sw_bins_flush();
+
     uint32_t id = RLSW.currentTexture;
 
     if (!sw_is_texture_valid(id))
@@ -4700,31 +7415,91 @@ void swTexImage2D(int width, int height, SWformat format, SWtype type, const voi
 
     sw_texture_t *texture = &RLSW.loadedTextures[id];
 
-    int size = width*height;
-    texture->pixels = SW_MALLOC(4*size);
+    if (level == 0)
+    {
+        // Base level defines the texture, previous levels are discarded
+        if (texture->pixels == RLSW.loadedTextures[0].pixels) texture->pixels = NULL;
+        SW_FREE(texture->pixels);
+        texture->pixels = NULL;
+
+        texture->width = width;
+        texture->height = height;
+        texture->wMinus1 = width - 1;
+        texture->hMinus1 = height - 1;
+        texture->tx = 1.0f/width;
+        texture->ty = 1.0f/height;
+    }
+    else
+    {
+        // Levels must be provided in order, with the dimensions expected from the base level
+        bool valid = (texture->pixels != RLSW.loadedTextures[0].pixels) &&
+            (level > 0) && (level < SW_TEXTURE_MAX_LEVELS) && (level <= texture->levelCount);
+
+        if (valid)
+        {
+            int levelWidth = ((texture->width >> level) > 0)? (texture->width >> level) : 1;
+            int levelHeight = ((texture->height >> level) > 0)? (texture->height >> level) : 1;
+            valid = (width == levelWidth) && (height == levelHeight);
+        }
+
+        if (!valid)
+        {
+            RLSW.errCode = SW_INVALID_VALUE;
+            return;
+        }
+    }
 
-    if (texture->pixels == NULL)
+    int levelCount = (level == 0)? 1 : ((level < texture->levelCount)? texture->levelCount : level + 1);
+
+    if (!sw_texture_alloc_levels(texture, levelCount))
     {
         RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
         return;
     }
 
-    for (int i = 0; i < size; i++)
+    const sw_texture_level_t *dst = &texture->levels[level];
+
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            sw_get_pixel((uint8_t *)sw_texture_texel(dst, x, y), data, y*width + x, pixelFormat);
+        }
+    }
+}
+
+void swGenerateMipmap(void)
+{
+    sw_bins_flush();
+
+    uint32_t id = RLSW.currentTexture;
+
+    if (!sw_is_texture_valid(id) || (RLSW.loadedTextures[id].pixels == RLSW.loadedTextures[0].pixels))
+    {
+        RLSW.errCode = SW_INVALID_OPERATION;
+        return;
+    }
+
+    sw_texture_t *texture = &RLSW.loadedTextures[id];
+
+    // Levels count down to 1x1
+    int levelCount = 1;
+    int size = (texture->width > texture->height)? texture->width : texture->height;
+    while (((size >> levelCount) > 0) && (levelCount < SW_TEXTURE_MAX_LEVELS)) levelCount++;
+
+    if (!sw_texture_alloc_levels(texture, levelCount))
     {
-        uint32_t *dst = &((uint32_t*)texture->pixels)[i];
-        sw_get_pixel((uint8_t*)dst, data, i, pixelFormat);
+        RLSW.errCode = SW_STACK_OVERFLOW; // WARNING: Out of memory...
+        return;
     }
 
-    texture->width = width;
-    texture->height = height;
-    texture->wMinus1 = width - 1;
-    texture->hMinus1 = height - 1;
-    texture->tx = 1.0f/width;
-    texture->ty = 1.0f/height;
+    for (int i = 1; i < levelCount; i++) sw_texture_downsample(&texture->levels[i], &texture->levels[i - 1]);
 }
 
 void swTexParameteri(int param, int value)
 {
+    sw_bins_flush();
+
     uint32_t id = RLSW.currentTexture;
 
     if (!sw_is_texture_valid(id))
@@ -4739,7 +7514,7 @@ void swTexParameteri(int param, int value)
     {
         case SW_TEXTURE_MIN_FILTER:
         {
-            if (!sw_is_texture_filter_valid(value))
+            if (!sw_is_texture_min_filter_valid(value))
             {
                 RLSW.errCode = SW_INVALID_ENUM;
                 return;
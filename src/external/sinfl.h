@@ -426,7 +426,7 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
 
       if ((unsigned short)len != (unsigned short)~nlen)
         return (int)(out-o);
-      if (len > (e - s.bitptr) || !len)
+      if (len > (e - s.bitptr) || len > (oe - out) || !len)
         return (int)(out-o);
 
       memcpy(out, s.bitptr, (size_t)len);
@@ -468,9 +468,15 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         sinfl_refill(&s);
         sym = sinfl_decode(&s, hlens, 7);
         switch (sym) {default: lens[n++] = (unsigned char)sym; break;
-        case 16: for (i=3+sinfl_get(&s,2);i;i--,n++) lens[n]=lens[n-1]; break;
-        case 17: for (i=3+sinfl_get(&s,3);i;i--,n++) lens[n]=0; break;
-        case 18: for (i=11+sinfl_get(&s,7);i;i--,n++) lens[n]=0; break;}
+        case 16: i=3+sinfl_get(&s,2); if (!n || n+i > nlit+ndist) return (int)(out-o);
+          for (;i;i--,n++) lens[n]=lens[n-1];
+          break;
+        case 17: i=3+sinfl_get(&s,3); if (n+i > nlit+ndist) return (int)(out-o);
+          for (;i;i--,n++) lens[n]=0;
+          break;
+        case 18: i=11+sinfl_get(&s,7); if (n+i > nlit+ndist) return (int)(out-o);
+          for (;i;i--,n++) lens[n]=0;
+          break;}
       }
       /* build lit/dist tables */
       sinfl_build(s.lits, lens, 10, 15, nlit);
@@ -491,6 +497,9 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
           *out++ = (unsigned char)sym;
           sym = sinfl_decode(&s, s.lits, 10);
           if (sym < 256) {
+            if (sinfl_unlikely(out >= oe)) {
+              return (int)(out-o);
+            }
             *out++ = (unsigned char)sym;
             continue;
           }
@@ -511,7 +520,7 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
         int dsym = sinfl_decode(&s, s.dsts, 8);
         int offs = sinfl__get(&s, dbits[dsym]) + dbase[dsym];
         unsigned char *dst = out, *src = out - offs;
-        if (sinfl_unlikely(offs > (int)(out-o))) {
+        if (sinfl_unlikely(offs > (int)(out-o) || len > (int)(oe-out))) {
           return (int)(out-o);
         }
         out = out + len;
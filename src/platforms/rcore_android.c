@@ -15,6 +15,10 @@
 *
 *   ADDITIONAL NOTES:
 *       - TRACELOG() function is located in raylib [utils] module
+*       - Frames presentation is scheduled on display vsync timeline when available:
+*         AChoreographer (API level 24+) provides vsync timestamps and refresh rate changes (API level 30+),
+*         EGL_ANDROID_presentation_time requests every buffer to be presented on a vsync matching target frame time,
+*         both are loaded at runtime, eglSwapBuffers() is used as usual if not supported
 *
 *   CONFIGURATION:
 *       #define RCORE_PLATFORM_CUSTOM_FLAG
@@ -52,10 +56,29 @@
 #include <jni.h>                        // Required for: JNIEnv and JavaVM [Used in rl_OpenURL() and rl_GetCurrentMonitor()]
 
 #include <EGL/egl.h>                    // Native platform windowing system interface
+#include <EGL/eglext.h>                 // Required for: EGL_ANDROID_presentation_time
+#include <dlfcn.h>                      // Required for: dlopen(), dlsym() [Used to load AChoreographer API]
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
+// AChoreographer callbacks, API is loaded at runtime from libandroid.so
+typedef void (*ChoreographerFrameCallback)(long frameTimeNanos, void *data);
+typedef void (*ChoreographerFrameCallback64)(int64_t frameTimeNanos, void *data);
+typedef void (*ChoreographerRefreshRateCallback)(int64_t vsyncPeriodNanos, void *data);
+
+typedef struct {
+    void *library;                      // libandroid.so handle
+    void *instance;                     // AChoreographer of app thread looper
+    void *(*getInstance)(void);
+    void (*postFrameCallback)(void *choreographer, ChoreographerFrameCallback callback, void *data);
+    void (*postFrameCallback64)(void *choreographer, ChoreographerFrameCallback64 callback, void *data);
+    void (*registerRefreshRateCallback)(void *choreographer, ChoreographerRefreshRateCallback callback, void *data);
+    void (*unregisterRefreshRateCallback)(void *choreographer, ChoreographerRefreshRateCallback callback, void *data);
+    bool callbackPosted;                // Frame callback waiting for next vsync
+    bool refreshRateCallback;           // Refresh rate changes reported by callback
+} ChoreographerData;
+
 typedef struct {
     // Application data
     struct android_app *app;            // Android activity
@@ -68,6 +91,13 @@ typedef struct {
     EGLSurface surface;                 // Surface to draw on, framebuffers (connected to context)
     EGLContext context;                 // Graphic context, mode in which drawing can be done
     EGLConfig config;                   // Graphic config
+
+    // Frame pacing data
+    ChoreographerData choreographer;    // Display vsync timestamps provider
+    PFNEGLPRESENTATIONTIMEANDROIDPROC eglPresentationTime; // EGL_ANDROID_presentation_time (NULL if not supported)
+    int64_t vsyncTime;                  // Last display vsync timestamp (CLOCK_MONOTONIC, nanoseconds)
+    int64_t vsyncPeriod;                // Display refresh period (nanoseconds)
+    int64_t presentTime;                // Last requested presentation vsync (nanoseconds)
 } PlatformData;
 
 typedef struct {
@@ -266,9 +296,18 @@ void ClosePlatform(void);        // Close platform
 static void AndroidCommandCallback(struct android_app *app, int32_t cmd);           // Process Android activity lifecycle commands
 static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event);   // Process Android inputs
 static rl_GamepadButton AndroidTranslateGamepadButton(int button);                     // Map Android gamepad button to raylib gamepad button
+static void AndroidVsyncUpdate(int64_t vsyncTime);                                  // Register display vsync timestamp
+static void AndroidVsyncCallback(long frameTimeNanos, void *data);                  // AChoreographer frame callback (API level 24)
+static void AndroidVsyncCallback64(int64_t frameTimeNanos, void *data);             // AChoreographer frame callback (API level 29)
+static void AndroidRefreshRateCallback(int64_t vsyncPeriodNanos, void *data);       // AChoreographer refresh rate callback (API level 30)
 
 static void SetupFramebuffer(int width, int height); // Setup main framebuffer (required by InitPlatform())
 
+static void InitFramePacing(void);              // Load AChoreographer and EGL_ANDROID_presentation_time (if available)
+static void CloseFramePacing(void);             // Unregister AChoreographer callbacks
+static void PostChoreographerFrameCallback(void); // Request vsync timestamp of next frame
+static int64_t GetTimeNanos(void);              // Get CLOCK_MONOTONIC time in nanoseconds
+
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
@@ -304,7 +343,7 @@ void android_main(struct android_app *app)
         // Poll all events until we reach return value TIMEOUT, meaning no events left to process
         while ((pollResult = ALooper_pollOnce(0, NULL, &pollEvents, (void **)&platform.source)) > ALOOPER_POLL_TIMEOUT)
         {
-            if (platform.source != NULL) platform.source->process(app, platform.source);
+            if ((pollResult >= 0) && (platform.source != NULL)) platform.source->process(app, platform.source);
         }
     }
 }
@@ -434,6 +473,12 @@ void rl_SetWindowFocused(void)
     TRACELOG(LOG_WARNING, "rl_SetWindowFocused() not available on target platform");
 }
 
+// Set memory the screen is rendered into
+void rl_SetWindowFramebuffer(void *pixels)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowFramebuffer() not available on target platform");
+}
+
 // Get native window handle
 void *rl_GetWindowHandle(void)
 {
@@ -522,10 +567,45 @@ int rl_GetMonitorPhysicalHeight(int monitor)
 }
 
 // Get selected monitor refresh rate
+// NOTE: Refresh period is tracked from AChoreographer, queried from android.view.Display if not available yet
 int rl_GetMonitorRefreshRate(int monitor)
 {
-    TRACELOG(LOG_WARNING, "rl_GetMonitorRefreshRate() not implemented on target platform");
-    return 0;
+    int refreshRate = 0;
+
+    if (platform.vsyncPeriod > 0) refreshRate = (int)(1e9/(double)platform.vsyncPeriod + 0.5);
+    else
+    {
+        JNIEnv *env = NULL;
+        JavaVM *vm = platform.app->activity->vm;
+        (*vm)->AttachCurrentThread(vm, &env, NULL);
+
+        jobject activity = platform.app->activity->clazz;
+        jclass activityClass = (*env)->GetObjectClass(env, activity);
+        jmethodID getWindowManagerMethod = (*env)->GetMethodID(env, activityClass, "getWindowManager", "()Landroid/view/WindowManager;");
+        jobject windowManager = (*env)->CallObjectMethod(env, activity, getWindowManagerMethod);
+
+        jclass windowManagerClass = (*env)->FindClass(env, "android/view/WindowManager");
+        jmethodID getDefaultDisplayMethod = (*env)->GetMethodID(env, windowManagerClass, "getDefaultDisplay", "()Landroid/view/Display;");
+        jobject display = (*env)->CallObjectMethod(env, windowManager, getDefaultDisplayMethod);
+
+        if (display == NULL) TRACELOG(LOG_WARNING, "rl_GetMonitorRefreshRate() couldn't get the display object");
+        else
+        {
+            jclass displayClass = (*env)->FindClass(env, "android/view/Display");
+            jmethodID getRefreshRateMethod = (*env)->GetMethodID(env, displayClass, "getRefreshRate", "()F");
+            refreshRate = (int)((*env)->CallFloatMethod(env, display, getRefreshRateMethod) + 0.5f);
+            (*env)->DeleteLocalRef(env, displayClass);
+            (*env)->DeleteLocalRef(env, display);
+        }
+
+        (*env)->DeleteLocalRef(env, windowManagerClass);
+        (*env)->DeleteLocalRef(env, windowManager);
+        (*env)->DeleteLocalRef(env, activityClass);
+
+        (*vm)->DetachCurrentThread(vm);
+    }
+
+    return refreshRate;
 }
 
 // Get the human-readable, UTF-8 encoded name of the selected monitor
@@ -605,9 +685,32 @@ void rl_DisableCursor(void)
 }
 
 // Swap back buffer with front buffer (screen drawing)
+// NOTE: Presentation is requested on the vsync matching target frame time (whole number of refresh periods),
+// keeping a steady cadence on 90/120 Hz displays, late frames are presented on next vsync
 void rl_SwapScreenBuffer(void)
 {
-    if (platform.surface != EGL_NO_SURFACE) eglSwapBuffers(platform.device, platform.surface);
+    if (platform.surface == EGL_NO_SURFACE) return;
+
+    if ((platform.eglPresentationTime != NULL) && (platform.vsyncTime > 0) && (platform.vsyncPeriod > 0))
+    {
+        int64_t period = platform.vsyncPeriod;
+        int64_t interval = 1;
+        if (CORE.Time.target > 0.0) interval = (int64_t)(CORE.Time.target*1e9/(double)period + 0.5);
+        if (interval < 1) interval = 1;
+
+        // Next vsync after current time, extrapolated from last vsync timestamp
+        int64_t now = GetTimeNanos();
+        int64_t nextVsync = platform.vsyncTime + ((now - platform.vsyncTime)/period + 1)*period;
+
+        int64_t present = platform.presentTime + interval*period;
+        if ((present < nextVsync) || (present > (nextVsync + 4*interval*period))) present = nextVsync;
+        platform.presentTime = present;
+
+        // NOTE: Half a period earlier, buffer is latched on requested vsync despite timestamps jitter
+        platform.eglPresentationTime(platform.device, platform.surface, (EGLnsecsANDROID)(present - period/2));
+    }
+
+    eglSwapBuffers(platform.device, platform.surface);
 }
 
 //----------------------------------------------------------------------------------
@@ -747,10 +850,10 @@ void rl_PollInputEvents(void)
 
     // Poll Events (registered events) until we reach TIMEOUT which indicates there are no events left to poll
     // NOTE: Activity is paused if not enabled (platform.appEnabled) and always run flag is not set (FLAG_WINDOW_ALWAYS_RUN)
-    while ((pollResult = ALooper_pollOnce((platform.appEnabled || FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_ALWAYS_RUN))? 0 : -1, NULL, &pollEvents, ((void **)&platform.source)) > ALOOPER_POLL_TIMEOUT))
+    while ((pollResult = ALooper_pollOnce((platform.appEnabled || FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_ALWAYS_RUN))? 0 : -1, NULL, &pollEvents, ((void **)&platform.source))) > ALOOPER_POLL_TIMEOUT)
     {
         // Process this event
-        if (platform.source != NULL) platform.source->process(platform.app, platform.source);
+        if ((pollResult >= 0) && (platform.source != NULL)) platform.source->process(platform.app, platform.source);
 
         // NOTE: Allow closing the window in case a configuration change happened
         // The android_main function should be allowed to return to its caller in order for the
@@ -834,10 +937,10 @@ int InitPlatform(void)
     while (!CORE.Window.ready)
     {
         // Process events until we reach TIMEOUT, which indicates no more events queued
-        while ((pollResult = ALooper_pollOnce(0, NULL, &pollEvents, ((void **)&platform.source)) > ALOOPER_POLL_TIMEOUT))
+        while ((pollResult = ALooper_pollOnce(0, NULL, &pollEvents, ((void **)&platform.source))) > ALOOPER_POLL_TIMEOUT)
         {
             // Process this event
-            if (platform.source != NULL) platform.source->process(platform.app, platform.source);
+            if ((pollResult >= 0) && (platform.source != NULL)) platform.source->process(platform.app, platform.source);
 
             // NOTE: It's highly likely destroyRequested will never be non-zero at the start of the activity lifecycle
             //if (platform.app->destroyRequested != 0) CORE.Window.shouldClose = true;
@@ -852,6 +955,8 @@ int InitPlatform(void)
 // Close platform
 void ClosePlatform(void)
 {
+    CloseFramePacing();
+
     // Close surface, context and display
     if (platform.device != EGL_NO_DISPLAY)
     {
@@ -1014,6 +1119,8 @@ static int InitGraphicsDevice(void)
     // NOTE: GL procedures address loader is required to load extensions
     rlLoadExtensions(eglGetProcAddress);
 
+    InitFramePacing();      // Display vsync timestamps and presentation time (if available)
+
     CORE.Window.ready = true;
 
     if (FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_MINIMIZED)) rl_MinimizeWindow();
@@ -1074,7 +1181,7 @@ static void AndroidCommandCallback(struct android_app *app, int32_t cmd)
                     // Initialize hi-res timer
                     InitTimer();
 
-                #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
+                #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT) && !defined(SUPPORT_LAZY_DEFAULT_FONT)
                     // Load default font
                     // WARNING: External function: Module required: rtext
                     LoadFontDefault();
@@ -1111,6 +1218,7 @@ static void AndroidCommandCallback(struct android_app *app, int32_t cmd)
         {
             platform.appEnabled = true;
             FLAG_CLEAR(CORE.Window.flags, FLAG_WINDOW_UNFOCUSED);
+            PostChoreographerFrameCallback();   // Restart vsync callbacks (stopped while paused)
             //rl_ResumeMusicStream();
         } break;
         case APP_CMD_PAUSE: break;
@@ -1136,6 +1244,7 @@ static void AndroidCommandCallback(struct android_app *app, int32_t cmd)
                     platform.surface = EGL_NO_SURFACE;
                 }
 
+                platform.presentTime = 0;
                 platform.contextRebindRequired = true;
             }
             // If 'platform.device' is already set to 'EGL_NO_DISPLAY'
@@ -1292,9 +1401,19 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
 
                 CORE.Input.Keyboard.keyPressedQueue[CORE.Input.Keyboard.keyPressedQueueCount] = key;
                 CORE.Input.Keyboard.keyPressedQueueCount++;
+
+                PushInputEvent(INPUT_EVENT_KEY_PRESSED, 0, key, 0.0f, 0.0f);
+            }
+            else if (AKeyEvent_getAction(event) == AKEY_EVENT_ACTION_MULTIPLE)
+            {
+                CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
+                PushInputEvent(INPUT_EVENT_KEY_REPEAT, 0, key, 0.0f, 0.0f);
+            }
+            else
+            {
+                CORE.Input.Keyboard.currentKeyState[key] = 0;  // Key up
+                PushInputEvent(INPUT_EVENT_KEY_RELEASED, 0, key, 0.0f, 0.0f);
             }
-            else if (AKeyEvent_getAction(event) == AKEY_EVENT_ACTION_MULTIPLE) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
-            else CORE.Input.Keyboard.currentKeyState[key] = 0;  // Key up
         }
 
         if (keycode == AKEYCODE_POWER)
@@ -1342,6 +1461,16 @@ static int32_t AndroidInputCallback(struct android_app *app, AInputEvent *event)
     unsigned int flags = action & AMOTION_EVENT_ACTION_MASK;
     int32_t pointerIndex = (action & AMOTION_EVENT_ACTION_POINTER_INDEX_MASK) >> AMOTION_EVENT_ACTION_POINTER_INDEX_SHIFT;
 
+    // Register touch input events, down/up for action pointer and move for all pointers
+    if ((flags == AMOTION_EVENT_ACTION_DOWN) || (flags == AMOTION_EVENT_ACTION_POINTER_DOWN))
+        PushInputEvent(INPUT_EVENT_TOUCH_DOWN, touchRaw.pointId[pointerIndex], 0, touchRaw.position[pointerIndex].x, touchRaw.position[pointerIndex].y);
+    else if ((flags == AMOTION_EVENT_ACTION_UP) || (flags == AMOTION_EVENT_ACTION_POINTER_UP) || (flags == AMOTION_EVENT_ACTION_CANCEL))
+        PushInputEvent(INPUT_EVENT_TOUCH_UP, touchRaw.pointId[pointerIndex], 0, touchRaw.position[pointerIndex].x, touchRaw.position[pointerIndex].y);
+    else if (flags == AMOTION_EVENT_ACTION_MOVE)
+    {
+        for (int i = 0; (i < touchRaw.pointCount) && (i < MAX_TOUCH_POINTS); i++) PushInputEvent(INPUT_EVENT_TOUCH_MOVE, touchRaw.pointId[i], 0, touchRaw.position[i].x, touchRaw.position[i].y);
+    }
+
     if (flags == AMOTION_EVENT_ACTION_HOVER_ENTER)
     {
         // The new pointer is hover
@@ -1533,4 +1662,131 @@ static void SetupFramebuffer(int width, int height)
     }
 }
 
+// ANDROID: Register display vsync timestamp, provided by AChoreographer frame callback
+// NOTE: Refresh period is estimated from consecutive vsyncs if refresh rate changes are not reported (API level < 30)
+static void AndroidVsyncUpdate(int64_t vsyncTime)
+{
+    platform.choreographer.callbackPosted = false;
+
+    if (!platform.choreographer.refreshRateCallback && (platform.vsyncTime > 0))
+    {
+        int64_t delta = vsyncTime - platform.vsyncTime;
+
+        if (platform.vsyncPeriod <= 0) { if ((delta > 0) && (delta < 50000000)) platform.vsyncPeriod = delta; }
+        else if ((delta > 0) && (delta < platform.vsyncPeriod*3/2)) platform.vsyncPeriod += (delta - platform.vsyncPeriod)/8;
+    }
+
+    platform.vsyncTime = vsyncTime;
+
+    // NOTE: Vsync callbacks are stopped while activity is paused, restarted on focus gained
+    if (platform.appEnabled || FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_ALWAYS_RUN)) PostChoreographerFrameCallback();
+}
+
+// ANDROID: AChoreographer frame callbacks, frame time is display vsync timestamp
+static void AndroidVsyncCallback(long frameTimeNanos, void *data) { AndroidVsyncUpdate((int64_t)frameTimeNanos); }
+static void AndroidVsyncCallback64(int64_t frameTimeNanos, void *data) { AndroidVsyncUpdate(frameTimeNanos); }
+
+// ANDROID: AChoreographer refresh rate callback, display refresh rate changed (i.e. 60/90/120 Hz switch)
+static void AndroidRefreshRateCallback(int64_t vsyncPeriodNanos, void *data)
+{
+    if ((vsyncPeriodNanos <= 0) || (vsyncPeriodNanos == platform.vsyncPeriod)) return;
+
+    platform.vsyncPeriod = vsyncPeriodNanos;
+    platform.presentTime = 0;
+
+    // Frames paced by vblank wait for lower frame rates depending on refresh period
+    if (framePacing.mode == FRAME_PACING_VSYNC) framePacing.refreshPeriod = (double)vsyncPeriodNanos*1e-9;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Refresh rate changed: %.2f Hz", 1e9/(double)vsyncPeriodNanos);
+}
+
+// Load AChoreographer and EGL_ANDROID_presentation_time (if available)
+// NOTE: Required to be called from app thread, AChoreographer instance is attached to its looper
+static void InitFramePacing(void)
+{
+    ChoreographerData *choreographer = &platform.choreographer;
+
+    choreographer->library = dlopen("libandroid.so", RTLD_NOW | RTLD_LOCAL);
+
+    if (choreographer->library != NULL)
+    {
+        choreographer->getInstance = (void *(*)(void))dlsym(choreographer->library, "AChoreographer_getInstance");
+        choreographer->postFrameCallback = (void (*)(void *, ChoreographerFrameCallback, void *))dlsym(choreographer->library, "AChoreographer_postFrameCallback");
+        choreographer->postFrameCallback64 = (void (*)(void *, ChoreographerFrameCallback64, void *))dlsym(choreographer->library, "AChoreographer_postFrameCallback64");
+        choreographer->registerRefreshRateCallback = (void (*)(void *, ChoreographerRefreshRateCallback, void *))dlsym(choreographer->library, "AChoreographer_registerRefreshRateCallback");
+        choreographer->unregisterRefreshRateCallback = (void (*)(void *, ChoreographerRefreshRateCallback, void *))dlsym(choreographer->library, "AChoreographer_unregisterRefreshRateCallback");
+
+        if ((choreographer->getInstance != NULL) && ((choreographer->postFrameCallback64 != NULL) || (choreographer->postFrameCallback != NULL)))
+        {
+            choreographer->instance = choreographer->getInstance();
+        }
+    }
+
+    // Initial refresh period, queried from display
+    int refreshRate = rl_GetMonitorRefreshRate(0);
+    if (refreshRate > 0) platform.vsyncPeriod = 1000000000/refreshRate;
+
+    if (choreographer->instance != NULL)
+    {
+        if ((choreographer->registerRefreshRateCallback != NULL) && (choreographer->unregisterRefreshRateCallback != NULL))
+        {
+            choreographer->registerRefreshRateCallback(choreographer->instance, AndroidRefreshRateCallback, NULL);
+            choreographer->refreshRateCallback = true;
+        }
+
+        PostChoreographerFrameCallback();
+        TRACELOG(LOG_INFO, "DISPLAY: Frames paced by AChoreographer vsync (%i Hz)", refreshRate);
+    }
+    else TRACELOG(LOG_WARNING, "DISPLAY: AChoreographer not available, frames presentation not scheduled");
+
+    const char *eglExtensions = eglQueryString(platform.device, EGL_EXTENSIONS);
+
+    if ((eglExtensions != NULL) && (strstr(eglExtensions, "EGL_ANDROID_presentation_time") != NULL))
+    {
+        platform.eglPresentationTime = (PFNEGLPRESENTATIONTIMEANDROIDPROC)eglGetProcAddress("eglPresentationTimeANDROID");
+    }
+
+    if (platform.eglPresentationTime != NULL) TRACELOG(LOG_INFO, "DISPLAY: EGL_ANDROID_presentation_time supported");
+}
+
+// Unregister AChoreographer callbacks
+// NOTE: A posted frame callback can not be removed, it does not post again once instance is released
+static void CloseFramePacing(void)
+{
+    ChoreographerData *choreographer = &platform.choreographer;
+
+    if ((choreographer->instance != NULL) && choreographer->refreshRateCallback)
+    {
+        choreographer->unregisterRefreshRateCallback(choreographer->instance, AndroidRefreshRateCallback, NULL);
+    }
+
+    choreographer->instance = NULL;
+    choreographer->refreshRateCallback = false;
+    platform.eglPresentationTime = NULL;
+    platform.vsyncTime = 0;
+    platform.presentTime = 0;
+}
+
+// Request vsync timestamp of next frame
+static void PostChoreographerFrameCallback(void)
+{
+    ChoreographerData *choreographer = &platform.choreographer;
+
+    if ((choreographer->instance == NULL) || choreographer->callbackPosted) return;
+
+    if (choreographer->postFrameCallback64 != NULL) choreographer->postFrameCallback64(choreographer->instance, AndroidVsyncCallback64, NULL);
+    else choreographer->postFrameCallback(choreographer->instance, AndroidVsyncCallback, NULL);
+
+    choreographer->callbackPosted = true;
+}
+
+// Get CLOCK_MONOTONIC time in nanoseconds, same time base as display vsync timestamps
+static int64_t GetTimeNanos(void)
+{
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (int64_t)ts.tv_sec*1000000000LL + (int64_t)ts.tv_nsec;
+}
+
 // EOF
@@ -114,6 +114,10 @@
 //----------------------------------------------------------------------------------
 typedef struct {
     GLFWwindow *handle;                 // GLFW window handle (graphic device)
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+    GLFWwindow *secondaryHandles[MAX_SECONDARY_WINDOWS]; // GLFW secondary windows handles (contexts sharing main context objects)
+    unsigned int secondaryFboIds[MAX_SECONDARY_WINDOWS]; // Secondary windows present framebuffers (framebuffers are not shared between contexts)
+#endif
 } PlatformData;
 
 //----------------------------------------------------------------------------------
@@ -756,6 +760,12 @@ void rl_SetWindowFocused(void)
     glfwFocusWindow(platform.handle);
 }
 
+// Set memory the screen is rendered into
+void rl_SetWindowFramebuffer(void *pixels)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowFramebuffer() not available on target platform");
+}
+
 #if defined(__linux__) && defined(_GLFW_X11)
 // Local storage for the window handle returned by glfwGetX11Window
 // This is needed as X11 handles are integers and may not fit inside a pointer depending on platform
@@ -1118,6 +1128,101 @@ void rl_SwapScreenBuffer(void)
     glfwSwapBuffers(platform.handle);
 }
 
+#if defined(SUPPORT_RENDER_THREAD)
+// Set graphics context current on calling thread (or release it)
+// NOTE: Required by render thread, context can only be current on one thread at a time
+void SetGraphicsContextCurrent(bool current)
+{
+    glfwMakeContextCurrent(current? platform.handle : NULL);
+}
+#endif
+
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+// Initialize platform secondary window, its context shares main context objects (textures, buffers, shaders)
+// NOTE: Window hints are kept from main window initialization (context version, profile, samples)
+bool InitPlatformSecondaryWindow(int index, int width, int height, const char *title)
+{
+    glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+    glfwWindowHint(GLFW_DECORATED, GLFW_TRUE);
+    glfwWindowHint(GLFW_RESIZABLE, GLFW_TRUE);
+    glfwWindowHint(GLFW_FLOATING, GLFW_FALSE);
+    glfwWindowHint(GLFW_MAXIMIZED, GLFW_FALSE);
+
+    GLFWwindow *handle = glfwCreateWindow(width, height, (title != NULL)? title : "", NULL, platform.handle);
+
+    if (handle == NULL)
+    {
+        TRACELOG(LOG_WARNING, "GLFW: Failed to initialize secondary window");
+        return false;
+    }
+
+    // Secondary windows present without vsync, main window swap paces frames
+    glfwMakeContextCurrent(handle);
+    glfwSwapInterval(0);
+    glfwMakeContextCurrent(platform.handle);
+
+    platform.secondaryHandles[index] = handle;
+    platform.secondaryFboIds[index] = 0;
+
+    return true;
+}
+
+// Close platform secondary window
+void ClosePlatformSecondaryWindow(int index)
+{
+    if (platform.secondaryHandles[index] == NULL) return;
+
+    if (platform.secondaryFboIds[index] > 0)
+    {
+        glfwMakeContextCurrent(platform.secondaryHandles[index]);
+        rlUnloadFramebuffer(platform.secondaryFboIds[index]);
+        glfwMakeContextCurrent(platform.handle);
+    }
+
+    glfwDestroyWindow(platform.secondaryHandles[index]);
+
+    platform.secondaryHandles[index] = NULL;
+    platform.secondaryFboIds[index] = 0;
+}
+
+// Check if platform secondary window close has been requested
+bool IsPlatformSecondaryWindowCloseRequested(int index)
+{
+    return (glfwWindowShouldClose(platform.secondaryHandles[index]) == GLFW_TRUE);
+}
+
+// Get platform secondary window framebuffer size
+void GetPlatformSecondaryWindowSize(int index, int *width, int *height)
+{
+    glfwGetFramebufferSize(platform.secondaryHandles[index], width, height);
+}
+
+// Present render target to platform secondary window
+// NOTE: Render target texture is shared, it is attached to a framebuffer owned by window context and blitted to window
+void PresentPlatformSecondaryWindow(int index, unsigned int fboId, unsigned int textureId, int width, int height)
+{
+    (void)fboId;                        // Render target framebuffer only valid on main context
+
+    // NOTE: Context switch flushes main context commands, render target is complete for window context
+    glfwMakeContextCurrent(platform.secondaryHandles[index]);
+
+    // NOTE: Texture attached every frame, render target is reloaded on window resize
+    if (platform.secondaryFboIds[index] == 0) platform.secondaryFboIds[index] = rlLoadFramebuffer();
+    rlFramebufferAttach(platform.secondaryFboIds[index], textureId, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+
+    int fbWidth = 0, fbHeight = 0;
+    glfwGetFramebufferSize(platform.secondaryHandles[index], &fbWidth, &fbHeight);
+
+    rlBindFramebuffer(RL_READ_FRAMEBUFFER, platform.secondaryFboIds[index]);
+    rlBindFramebuffer(RL_DRAW_FRAMEBUFFER, 0);
+    rlBlitFramebuffer(0, 0, width, height, 0, 0, fbWidth, fbHeight, RL_COLOR_BUFFER_BIT);
+    rlBindFramebuffer(RL_READ_FRAMEBUFFER, 0);
+
+    glfwSwapBuffers(platform.secondaryHandles[index]);
+    glfwMakeContextCurrent(platform.handle);
+}
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Misc
 //----------------------------------------------------------------------------------
@@ -1348,7 +1453,9 @@ void rl_PollInputEvents(void)
     if ((CORE.Window.eventWaiting) ||
         (FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_MINIMIZED) && !FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_ALWAYS_RUN)))
     {
-        glfwWaitEvents();     // Wait for in input events before continue (drawing is paused)
+        // Wait for in input events before continue (drawing is paused)
+        if (CORE.Window.eventWaiting && (CORE.Window.eventWaitingTimeout > 0.0)) glfwWaitEventsTimeout(CORE.Window.eventWaitingTimeout);
+        else glfwWaitEvents();
         CORE.Time.previous = rl_GetTime();
     }
     else glfwPollEvents();      // Poll input events: keyboard/mouse/window events (callbacks) -> Update keys state
@@ -1964,6 +2071,8 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
     else if (action == GLFW_PRESS) CORE.Input.Keyboard.currentKeyState[key] = 1;
     else if (action == GLFW_REPEAT) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
 
+    PushInputEvent((action == GLFW_RELEASE)? INPUT_EVENT_KEY_RELEASED : ((action == GLFW_PRESS)? INPUT_EVENT_KEY_PRESSED : INPUT_EVENT_KEY_REPEAT), 0, key, 0.0f, 0.0f);
+
     // WARNING: Check if CAPS/NUM key modifiers are enabled and force down state for those keys
     if (((key == KEY_CAPS_LOCK) && (FLAG_IS_SET(mods, GLFW_MOD_CAPS_LOCK))) ||
         ((key == KEY_NUM_LOCK) && (FLAG_IS_SET(mods, GLFW_MOD_NUM_LOCK)))) CORE.Input.Keyboard.currentKeyState[key] = 1;
@@ -1988,6 +2097,8 @@ static void CharCallback(GLFWwindow *window, unsigned int codepoint)
     // REF: https://github.com/glfw/glfw/issues/668#issuecomment-166794907
     // REF: https://www.glfw.org/docs/latest/input_guide.html#input_char
 
+    PushInputEvent(INPUT_EVENT_CHAR, 0, (int)codepoint, 0.0f, 0.0f);
+
     // Check if there is space available in the queue
     if (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
     {
@@ -2005,6 +2116,8 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
     CORE.Input.Mouse.currentButtonState[button] = action;
     CORE.Input.Touch.currentTouchState[button] = action;
 
+    PushInputEvent((action == GLFW_PRESS)? INPUT_EVENT_MOUSE_BUTTON_PRESSED : INPUT_EVENT_MOUSE_BUTTON_RELEASED, 0, button, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
+
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
     // Process mouse events as touches to be able to use mouse-gestures
     GestureEvent gestureEvent = { 0 };
@@ -2040,6 +2153,8 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
     CORE.Input.Mouse.currentPosition.y = (float)y;
     CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
 
+    PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, (float)x, (float)y);
+
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
     // Process mouse events as touches to be able to use mouse-gestures
     GestureEvent gestureEvent = { 0 };
@@ -2068,6 +2183,8 @@ static void MouseCursorPosCallback(GLFWwindow *window, double x, double y)
 static void MouseScrollCallback(GLFWwindow *window, double xoffset, double yoffset)
 {
     CORE.Input.Mouse.currentWheelMove = (rl_Vector2){ (float)xoffset, (float)yoffset };
+
+    PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, (float)xoffset, (float)yoffset);
 }
 
 // GLFW3: Cursor ennter callback, when cursor enters the window
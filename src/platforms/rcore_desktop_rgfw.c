@@ -615,6 +615,12 @@ void rl_SetWindowFocused(void)
     RGFW_window_focus(platform.window);
 }
 
+// Set memory the screen is rendered into
+void rl_SetWindowFramebuffer(void *pixels)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowFramebuffer() not available on target platform");
+}
+
 // Get native window handle
 void *rl_GetWindowHandle(void)
 {
@@ -970,7 +976,9 @@ void rl_PollInputEvents(void)
 
     if ((CORE.Window.eventWaiting) || (rl_IsWindowState(FLAG_WINDOW_MINIMIZED) && !rl_IsWindowState(FLAG_WINDOW_ALWAYS_RUN)))
     {
-        RGFW_window_eventWait(platform.window, -1); // Wait for input events: keyboard/mouse/window events (callbacks) -> Update keys state
+        // Wait for input events: keyboard/mouse/window events (callbacks) -> Update keys state
+        int waitMS = (CORE.Window.eventWaiting && (CORE.Window.eventWaitingTimeout > 0.0))? (int)(CORE.Window.eventWaitingTimeout*1000.0) : -1;
+        RGFW_window_eventWait(platform.window, waitMS);
         CORE.Time.previous = rl_GetTime();
     }
 
@@ -1070,10 +1078,14 @@ void rl_PollInputEvents(void)
                     }
 
                     CORE.Input.Keyboard.currentKeyState[key] = 1;
+
+                    PushInputEvent(INPUT_EVENT_KEY_PRESSED, 0, key, 0.0f, 0.0f);
                 }
 
                 if (CORE.Input.Keyboard.currentKeyState[CORE.Input.Keyboard.exitKey]) CORE.Window.shouldClose = true;
 
+                PushInputEvent(INPUT_EVENT_CHAR, 0, (int)event->keyChar, 0.0f, 0.0f);
+
                 // NOTE: event.text.text data comes an UTF-8 text sequence but we register codepoints (int)
                 // Check if there is space available in the queue
                 if (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
@@ -1086,7 +1098,11 @@ void rl_PollInputEvents(void)
             case RGFW_keyReleased:
             {
                 rl_KeyboardKey key = ConvertScancodeToKey(event->key);
-                if (key != KEY_NULL) CORE.Input.Keyboard.currentKeyState[key] = 0;
+                if (key != KEY_NULL)
+                {
+                    CORE.Input.Keyboard.currentKeyState[key] = 0;
+                    PushInputEvent(INPUT_EVENT_KEY_RELEASED, 0, key, 0.0f, 0.0f);
+                }
             } break;
 
             // Check mouse events
@@ -1095,6 +1111,7 @@ void rl_PollInputEvents(void)
                 if ((event->button == RGFW_mouseScrollUp) || (event->button == RGFW_mouseScrollDown))
                 {
                     CORE.Input.Mouse.currentWheelMove.y = event->scroll;
+                    PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, 0.0f, (float)event->scroll);
                     break;
                 }
                 else CORE.Input.Mouse.currentWheelMove.y = 0;
@@ -1107,6 +1124,8 @@ void rl_PollInputEvents(void)
                 CORE.Input.Mouse.currentButtonState[btn - 1] = 1;
                 CORE.Input.Touch.currentTouchState[btn - 1] = 1;
 
+                PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_PRESSED, 0, btn - 1, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
+
                 touchAction = 1;
             } break;
             case RGFW_mouseButtonReleased:
@@ -1126,6 +1145,8 @@ void rl_PollInputEvents(void)
                 CORE.Input.Mouse.currentButtonState[btn - 1] = 0;
                 CORE.Input.Touch.currentTouchState[btn - 1] = 0;
 
+                PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_RELEASED, 0, btn - 1, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
+
                 touchAction = 0;
             } break;
             case RGFW_mousePosChanged:
@@ -1144,6 +1165,8 @@ void rl_PollInputEvents(void)
 
                 CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
                 touchAction = 2;
+
+                PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
             } break;
             case RGFW_gamepadConnected:
             {
@@ -101,10 +101,15 @@ typedef struct
 {
     SDL_Window* window;
     SDL_GLContext glContext;
+    SDL_Surface* surface;                   // Window surface last presented by software renderer
 
     SDL_GameController* gamepad[MAX_GAMEPADS];
     SDL_JoystickID gamepadId[MAX_GAMEPADS]; // Joystick instance ids, they do not start from 0
     SDL_Cursor* cursor;
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+    SDL_Window* secondaryWindows[MAX_SECONDARY_WINDOWS]; // Secondary windows, main OpenGL context is made current on them
+    bool secondaryWindowsClose[MAX_SECONDARY_WINDOWS];   // Secondary windows close requested
+#endif
 } PlatformData;
 
 //----------------------------------------------------------------------------------
@@ -964,6 +969,12 @@ void rl_SetWindowFocused(void)
     SDL_RaiseWindow(platform.window);
 }
 
+// Set memory the screen is rendered into
+void rl_SetWindowFramebuffer(void *pixels)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowFramebuffer() not available on target platform");
+}
+
 // Get native window handle
 void* rl_GetWindowHandle(void)
 {
@@ -1299,14 +1310,110 @@ void rl_SwapScreenBuffer(void)
 {
 #if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
     // NOTE: We use a preprocessor condition here because `rlCopyFramebuffer` is only declared for software rendering
+    // Only the region modified since previous frame is copied and presented, a new window surface is fully copied
     SDL_Surface* surface = SDL_GetWindowSurface(platform.window);
-    rlCopyFramebuffer(0, 0, CORE.Window.render.width, CORE.Window.render.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, surface->pixels);
-    SDL_UpdateWindowSurface(platform.window);
+    int x = 0, y = 0, width = 0, height = 0;
+    bool dirty = rlGetFramebufferDirtyRegion(&x, &y, &width, &height, true);
+
+    if (surface != platform.surface)
+    {
+        x = 0;
+        y = 0;
+        width = CORE.Window.render.width;
+        height = CORE.Window.render.height;
+        dirty = true;
+        platform.surface = surface;
+    }
+
+    if (dirty)
+    {
+        SDL_Rect rect = { x, y, width, height };
+        rlCopyFramebufferRegion(x, y, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, surface->pixels, surface->pitch);
+        SDL_UpdateWindowSurfaceRects(platform.window, &rect, 1);
+    }
 #else
     SDL_GL_SwapWindow(platform.window);
 #endif
 }
 
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+// Initialize platform secondary window, main OpenGL context is used to draw on it (all resources shared)
+// NOTE: Window pixel format matches main window, OpenGL attributes are kept from main window initialization
+bool InitPlatformSecondaryWindow(int index, int width, int height, const char *title)
+{
+    unsigned int flags = SDL_WINDOW_SHOWN | SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE;
+    if (FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_HIGHDPI)) flags |= SDL_WINDOW_ALLOW_HIGHDPI;
+
+#if defined(USING_VERSION_SDL3)
+    SDL_Window *window = SDL_CreateWindow((title != NULL)? title : "", width, height, flags);
+#else
+    SDL_Window *window = SDL_CreateWindow((title != NULL)? title : "", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, width, height, flags);
+#endif
+
+    if (window == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SDL: Failed to initialize secondary window: %s", SDL_GetError());
+        return false;
+    }
+
+    platform.secondaryWindows[index] = window;
+    platform.secondaryWindowsClose[index] = false;
+
+    return true;
+}
+
+// Close platform secondary window
+void ClosePlatformSecondaryWindow(int index)
+{
+    if (platform.secondaryWindows[index] == NULL) return;
+
+    SDL_DestroyWindow(platform.secondaryWindows[index]);
+    SDL_GL_MakeCurrent(platform.window, platform.glContext);
+
+    platform.secondaryWindows[index] = NULL;
+    platform.secondaryWindowsClose[index] = false;
+}
+
+// Check if platform secondary window close has been requested
+bool IsPlatformSecondaryWindowCloseRequested(int index)
+{
+    return platform.secondaryWindowsClose[index];
+}
+
+// Get platform secondary window framebuffer size
+void GetPlatformSecondaryWindowSize(int index, int *width, int *height)
+{
+#if defined(USING_VERSION_SDL3)
+    SDL_GetWindowSizeInPixels(platform.secondaryWindows[index], width, height);
+#else
+    SDL_GL_GetDrawableSize(platform.secondaryWindows[index], width, height);
+#endif
+}
+
+// Present render target to platform secondary window
+// NOTE: Main context is made current on secondary window, render target framebuffer is blitted to window
+void PresentPlatformSecondaryWindow(int index, unsigned int fboId, unsigned int textureId, int width, int height)
+{
+    (void)textureId;
+
+    SDL_GL_MakeCurrent(platform.secondaryWindows[index], platform.glContext);
+    SDL_GL_SetSwapInterval(0);          // Secondary windows present without vsync, main window swap paces frames
+
+    int fbWidth = 0, fbHeight = 0;
+    GetPlatformSecondaryWindowSize(index, &fbWidth, &fbHeight);
+
+    rlBindFramebuffer(RL_READ_FRAMEBUFFER, fboId);
+    rlBindFramebuffer(RL_DRAW_FRAMEBUFFER, 0);
+    rlBlitFramebuffer(0, 0, width, height, 0, 0, fbWidth, fbHeight, RL_COLOR_BUFFER_BIT);
+    rlBindFramebuffer(RL_READ_FRAMEBUFFER, 0);
+
+    SDL_GL_SwapWindow(platform.secondaryWindows[index]);
+
+    SDL_GL_MakeCurrent(platform.window, platform.glContext);
+    SDL_GL_SetSwapInterval(FLAG_IS_SET(CORE.Window.flags, FLAG_VSYNC_HINT)? 1 : 0);
+}
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Misc
 //----------------------------------------------------------------------------------
@@ -1447,7 +1554,8 @@ void rl_PollInputEvents(void)
 
     if ((CORE.Window.eventWaiting) || (FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_MINIMIZED) && !FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_ALWAYS_RUN)))
     {
-        SDL_WaitEvent(NULL);
+        if (CORE.Window.eventWaiting && (CORE.Window.eventWaitingTimeout > 0.0)) SDL_WaitEventTimeout(NULL, (int)(CORE.Window.eventWaitingTimeout*1000.0));
+        else SDL_WaitEvent(NULL);
         CORE.Time.previous = rl_GetTime();
     }
 
@@ -1459,6 +1567,34 @@ void rl_PollInputEvents(void)
             if (sdlEventCallbacks[i]) sdlEventCallbacks[i](&event);
         }
 
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+        // Secondary windows close requests are registered, other secondary windows events are skipped
+        // NOTE: SDL_QUIT is only generated on last window close, main window close request is also checked
+    #if defined(USING_VERSION_SDL3)
+        if (event.type == SDL_EVENT_WINDOW_CLOSE_REQUESTED)
+    #else
+        if ((event.type == SDL_WINDOWEVENT) && (event.window.event == SDL_WINDOWEVENT_CLOSE))
+    #endif
+        {
+            if (event.window.windowID == SDL_GetWindowID(platform.window)) CORE.Window.shouldClose = true;
+
+            for (int i = 0; i < MAX_SECONDARY_WINDOWS; i++)
+            {
+                if ((platform.secondaryWindows[i] != NULL) && (event.window.windowID == SDL_GetWindowID(platform.secondaryWindows[i]))) platform.secondaryWindowsClose[i] = true;
+            }
+        }
+
+        unsigned int eventWindowId = 0;
+        if (event.type == SDL_MOUSEMOTION) eventWindowId = event.motion.windowID;
+        else if ((event.type == SDL_MOUSEBUTTONDOWN) || (event.type == SDL_MOUSEBUTTONUP)) eventWindowId = event.button.windowID;
+        else if (event.type == SDL_MOUSEWHEEL) eventWindowId = event.wheel.windowID;
+    #if defined(USING_VERSION_SDL3)
+        else if ((event.type >= SDL_EVENT_WINDOW_FIRST) && (event.type <= SDL_EVENT_WINDOW_LAST)) eventWindowId = event.window.windowID;
+    #endif
+
+        if ((eventWindowId != 0) && (eventWindowId != SDL_GetWindowID(platform.window))) continue;
+#endif
+
         // All input events can be processed after polling
         switch (event.type)
         {
@@ -1642,6 +1778,8 @@ void rl_PollInputEvents(void)
                     }
 
                     CORE.Input.Keyboard.currentKeyState[key] = 1;
+
+                    PushInputEvent(event.key.repeat? INPUT_EVENT_KEY_REPEAT : INPUT_EVENT_KEY_PRESSED, 0, key, 0.0f, 0.0f);
                 }
 
                 if (event.key.repeat) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
@@ -1659,27 +1797,31 @@ void rl_PollInputEvents(void)
 #else
                 rl_KeyboardKey key = ConvertScancodeToKey(event.key.keysym.scancode);
 #endif
-                if (key != KEY_NULL) CORE.Input.Keyboard.currentKeyState[key] = 0;
+                if (key != KEY_NULL)
+                {
+                    CORE.Input.Keyboard.currentKeyState[key] = 0;
+                    PushInputEvent(INPUT_EVENT_KEY_RELEASED, 0, key, 0.0f, 0.0f);
+                }
             }
             break;
 
             case SDL_TEXTINPUT:
             {
                 // NOTE: event.text.text data comes an UTF-8 text sequence but we register codepoints (int)
+#if defined(USING_VERSION_SDL3)
+                size_t textLen         = strlen(event.text.text);
+                unsigned int codepoint = (unsigned int)SDL_StepUTF8(&event.text.text, &textLen);
+#else
+                int codepointSize = 0;
+                int codepoint     = GetCodepointNextSDL(event.text.text, &codepointSize);
+#endif
+
+                PushInputEvent(INPUT_EVENT_CHAR, 0, (int)codepoint, 0.0f, 0.0f);
 
                 // Check if there is space available in the queue
                 if (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
                 {
                     // Add character (codepoint) to the queue
-
-#if defined(USING_VERSION_SDL3)
-                    size_t textLen         = strlen(event.text.text);
-                    unsigned int codepoint = (unsigned int)SDL_StepUTF8(&event.text.text, &textLen);
-#else
-                    int codepointSize = 0;
-                    int codepoint     = GetCodepointNextSDL(event.text.text, &codepointSize);
-#endif
-
                     CORE.Input.Keyboard.charPressedQueue[CORE.Input.Keyboard.charPressedQueueCount] = codepoint;
                     CORE.Input.Keyboard.charPressedQueueCount++;
                 }
@@ -1699,6 +1841,8 @@ void rl_PollInputEvents(void)
                 CORE.Input.Mouse.currentButtonState[btn] = 1;
                 CORE.Input.Touch.currentTouchState[btn]  = 1;
 
+                PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_PRESSED, 0, btn, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
+
                 touchAction = 1;
             }
             break;
@@ -1714,6 +1858,8 @@ void rl_PollInputEvents(void)
                 CORE.Input.Mouse.currentButtonState[btn] = 0;
                 CORE.Input.Touch.currentTouchState[btn]  = 0;
 
+                PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_RELEASED, 0, btn, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
+
                 touchAction = 0;
             }
             break;
@@ -1721,6 +1867,8 @@ void rl_PollInputEvents(void)
             {
                 CORE.Input.Mouse.currentWheelMove.x = (float)event.wheel.x;
                 CORE.Input.Mouse.currentWheelMove.y = (float)event.wheel.y;
+
+                PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, (float)event.wheel.x, (float)event.wheel.y);
             }
             break;
             case SDL_MOUSEMOTION:
@@ -1739,6 +1887,8 @@ void rl_PollInputEvents(void)
 
                 CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
                 touchAction                  = 2;
+
+                PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
             }
             break;
 
@@ -2289,7 +2439,11 @@ void rl_UnregisterSDLEventCallback(rl_SDLEventCallback callback)
 // Update CORE input touch point info from SDL touch data
 static void UpdateTouchPointsSDL(SDL_TouchFingerEvent event)
 {
+    int eventType = (event.type == SDL_FINGERDOWN)? INPUT_EVENT_TOUCH_DOWN : ((event.type == SDL_FINGERUP)? INPUT_EVENT_TOUCH_UP : INPUT_EVENT_TOUCH_MOVE);
+
 #if defined(USING_VERSION_SDL3) // SDL3
+    PushInputEvent(eventType, (int)event.fingerID, 0, event.x*CORE.Window.screen.width, event.y*CORE.Window.screen.height);
+
     int count                   = 0;
     SDL_Finger** fingers        = SDL_GetTouchFingers(event.touchID, &count);
     CORE.Input.Touch.pointCount = count;
@@ -2306,6 +2460,7 @@ static void UpdateTouchPointsSDL(SDL_TouchFingerEvent event)
     SDL_free(fingers);
 
 #else // SDL2
+    PushInputEvent(eventType, (int)event.fingerId, 0, event.x*CORE.Window.screen.width, event.y*CORE.Window.screen.height);
 
     CORE.Input.Touch.pointCount = SDL_GetNumTouchFingers(event.touchId);
 
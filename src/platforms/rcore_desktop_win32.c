@@ -1012,6 +1012,12 @@ void rl_SetWindowFocused(void)
     TRACELOG(LOG_WARNING, "rl_SetWindowFocused not implemented");
 }
 
+// Set memory the screen is rendered into
+void rl_SetWindowFramebuffer(void *pixels)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowFramebuffer() not available on target platform");
+}
+
 // Get native window handle
 void *rl_GetWindowHandle(void)
 {
@@ -1211,12 +1217,17 @@ void rl_SwapScreenBuffer(void)
     if (!platform.hdc) abort();
 
 #if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
-    // Update framebuffer
-    rlCopyFramebuffer(0, 0, CORE.Window.render.width, CORE.Window.render.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, platform.pixels);
+    // Update framebuffer, only the region modified since previous frame
+    int x = 0, y = 0, width = 0, height = 0;
+    if (rlGetFramebufferDirtyRegion(&x, &y, &width, &height, true))
+    {
+        rlCopyFramebufferRegion(x, y, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, platform.pixels, CORE.Window.render.width*4);
 
-    // Force redraw
-    InvalidateRect(platform.hwnd, NULL, FALSE);
-    UpdateWindow(platform.hwnd);
+        // Force redraw of the modified region
+        RECT rect = { x, y, x + width, y + height };
+        InvalidateRect(platform.hwnd, &rect, FALSE);
+        UpdateWindow(platform.hwnd);
+    }
 #else
     if (!SwapBuffers(platform.hdc)) TRACELOG(LOG_ERROR, "WIN32: Failed to swap buffers [ERROR: %lu]", GetLastError());
     if (!ValidateRect(platform.hwnd, NULL)) TRACELOG(LOG_ERROR, "WIN32: Failed to validate screen rect [ERROR: %lu]", GetLastError());
@@ -1931,6 +1942,8 @@ static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lpara
                 CORE.Input.Mouse.currentPosition.x = (float)GET_X_LPARAM(lparam);
                 CORE.Input.Mouse.currentPosition.y = (float)GET_Y_LPARAM(lparam);
                 CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
+
+                PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
             }
         } break;
         case WM_KEYDOWN: HandleKey(wparam, lparam, 1); break;
@@ -1959,8 +1972,16 @@ static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lpara
                 default: TRACELOG(LOG_WARNING, "TODO: handle ex mouse button UP   wparam=%u", HIWORD(wparam)); break;
             }
         } break;
-        case WM_MOUSEWHEEL: CORE.Input.Mouse.currentWheelMove.y = ((float)GET_WHEEL_DELTA_WPARAM(wparam))/WHEEL_DELTA; break;
-        case WM_MOUSEHWHEEL: CORE.Input.Mouse.currentWheelMove.x = ((float)GET_WHEEL_DELTA_WPARAM(wparam))/WHEEL_DELTA; break;
+        case WM_MOUSEWHEEL:
+        {
+            CORE.Input.Mouse.currentWheelMove.y = ((float)GET_WHEEL_DELTA_WPARAM(wparam))/WHEEL_DELTA;
+            PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, 0.0f, CORE.Input.Mouse.currentWheelMove.y);
+        } break;
+        case WM_MOUSEHWHEEL:
+        {
+            CORE.Input.Mouse.currentWheelMove.x = ((float)GET_WHEEL_DELTA_WPARAM(wparam))/WHEEL_DELTA;
+            PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, CORE.Input.Mouse.currentWheelMove.x, 0.0f);
+        } break;
         case WM_APP_UPDATE_WINDOW_SIZE:
         {
             //UpdateWindowSize(UPDATE_WINDOW_NORMAL, hwnd, platform.appScreenWidth, platform.appScreenHeight, CORE.Window.flags);
@@ -1995,6 +2016,10 @@ static void HandleKey(WPARAM wparam, LPARAM lparam, char state)
 
     if (key != KEY_NULL)
     {
+        // NOTE: Key auto-repeat is reported as a new WM_KEYDOWN, previous key state bit (30) is set
+        bool repeat = (state == 1) && ((lparam & (1 << 30)) != 0);
+        PushInputEvent((state == 0)? INPUT_EVENT_KEY_RELEASED : (repeat? INPUT_EVENT_KEY_REPEAT : INPUT_EVENT_KEY_PRESSED), 0, key, 0.0f, 0.0f);
+
         CORE.Input.Keyboard.currentKeyState[key] = state;
 
         if ((key == KEY_ESCAPE) && (state == 1)) CORE.Window.shouldClose = true;
@@ -2010,6 +2035,8 @@ static void HandleMouseButton(int button, char state)
     // Register current mouse button state
     CORE.Input.Mouse.currentButtonState[button] = state;
     CORE.Input.Touch.currentTouchState[button] = state;
+
+    PushInputEvent((state == 1)? INPUT_EVENT_MOUSE_BUTTON_PRESSED : INPUT_EVENT_MOUSE_BUTTON_RELEASED, 0, button, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
 }
 
 // Handle raw input event
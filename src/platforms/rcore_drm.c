@@ -22,6 +22,10 @@
 *           WARNING: Reconfiguring standard input could lead to undesired effects, like breaking other
 *           running processes orblocking the device if not restored properly. Use with care
 *
+*       #define SUPPORT_DRM_CACHE
+*           Cache DRM framebuffers and swap with non-blocking page flips (triple buffered),
+*           using DRM atomic commits with render fences when supported by the driver
+*
 *   DEPENDENCIES:
 *       - DRM and GLM: System libraries for display initialization and configuration
 *       - gestures: Gestures system for touch-ready devices (or simulated from mouse inputs)
@@ -75,6 +79,8 @@
 #else
     #include <sys/mman.h>       // For mmap when copying to the dumb buffer
     #include <errno.h>          // For the conversion of certain error messages
+    #include <poll.h>           // Required for: drmHandleEvent() poll
+    #include <drm_fourcc.h>     // Required for: DRM_FORMAT_* dumb buffer formats
 #endif
 
 // NOTE: DRM cache enables triple buffered DRM caching
@@ -82,9 +88,11 @@
     #include <poll.h>       // Required for: drmHandleEvent() poll
     #include <errno.h>      // Required for: EBUSY, EAGAIN
 
-    #define MAX_DRM_CACHED_BUFFERS  3
+    #define MAX_DRM_CACHED_BUFFERS  4       // Scanned out, pending flip, queued and rendering buffers
 #endif // SUPPORT_DRM_CACHE
 
+#define DRM_FLIP_WAIT_TIMEOUT   100         // Maximum time waiting for a page flip to complete (milliseconds)
+
 #ifndef EGL_OPENGL_ES3_BIT
     #define EGL_OPENGL_ES3_BIT  0x40
 #endif
@@ -106,6 +114,16 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+typedef struct {
+    uint32_t handle;                    // Dumb buffer handle
+    uint32_t fb;                        // DRM framebuffer id
+    uint32_t pitch;                     // Dumb buffer bytes per row
+    uint64_t size;                      // Dumb buffer size in bytes
+    void *pixels;                       // Dumb buffer mapped memory
+} DumbBuffer;
+#endif
+
 typedef struct {
     // Display data
     int fd;                             // File descriptor for /dev/dri/...
@@ -123,7 +141,14 @@ typedef struct {
     EGLContext context;                 // Graphic context, mode in which drawing can be done
     EGLConfig config;                   // Graphic config
 #else
-    uint32_t prevDumbHandle;            // Handle to the previous dumb buffer (during frame swapping)
+    DumbBuffer dumbBuffers[2];          // Double buffered dumb buffers, one scanned out while the other is rendered
+    int dumbBufferIndex;                // Dumb buffer being rendered
+    void *dumbBufferScratch;            // Tightly packed copy buffer, only if dumb buffer rows are padded
+    int dumbBufferDirty[4];             // Region modified in previous frame (x, y, width, height), also missing in next dumb buffer
+    bool dumbBufferDirect;              // Software renderer draws directly into dumb buffers
+    bool dumbBufferBound;               // Current dumb buffer bound as software renderer color buffer
+    volatile bool dumbFlipPending;      // Page flip submitted and not completed yet
+    bool crtcReady;                     // CRTC set with the first dumb buffer
 #endif
 
     // Keyboard data
@@ -159,9 +184,27 @@ typedef struct {
     uint32_t fbId;          // DRM framebuffer ID
 } FramebufferCache;
 
+// Swap chain state, scanned out buffer object is platform.prevBO
+typedef struct {
+    struct gbm_bo *pendingBO;           // Buffer object of the submitted flip, waiting for vblank
+    struct gbm_bo *queuedBO;            // Buffer object rendered while a flip was pending
+    int queuedFenceFd;                  // Render fence of the queued buffer object (-1 if not available)
+
+    bool atomic;                        // DRM atomic modesetting available, used for non-blocking commits
+    uint32_t planeId;                   // Primary plane used by the CRTC
+    uint32_t propFbId;                  // Plane property id: FB_ID
+    uint32_t propCrtcId;                // Plane property id: CRTC_ID
+    uint32_t propInFenceFd;             // Plane property id: IN_FENCE_FD (0 if not supported)
+
+    // EGL_ANDROID_native_fence_sync functions, only loaded with atomic modesetting
+    PFNEGLCREATESYNCKHRPROC eglCreateSyncKHR;
+    PFNEGLDESTROYSYNCKHRPROC eglDestroySyncKHR;
+    PFNEGLDUPNATIVEFENCEFDANDROIDPROC eglDupNativeFenceFDANDROID;
+} SwapChain;
+
 static FramebufferCache fbCache[MAX_DRM_CACHED_BUFFERS] = { 0 };
 static volatile int fbCacheCount = 0;
-static volatile bool pendingFlip = false;
+static SwapChain swapChain = { 0 };
 static bool crtcSet = false;
 #endif // SUPPORT_DRM_CACHE
 
@@ -396,6 +439,12 @@ void rl_SetWindowFocused(void)
     TRACELOG(LOG_WARNING, "rl_SetWindowFocused() not available on target platform");
 }
 
+// Set memory the screen is rendered into
+void rl_SetWindowFramebuffer(void *pixels)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowFramebuffer() not available on target platform");
+}
+
 // Get native window handle
 void *rl_GetWindowHandle(void)
 {
@@ -646,6 +695,88 @@ static uint32_t GetOrCreateFbForBo(struct gbm_bo *bo)
     return fbId;
 }
 
+// Get DRM object property id by name, optionally retrieving its current value
+// NOTE: Returns 0 if property is not found
+static uint32_t GetDrmPropertyId(uint32_t objectId, uint32_t objectType, const char *name, uint64_t *value)
+{
+    uint32_t propId = 0;
+    drmModeObjectProperties *props = drmModeObjectGetProperties(platform.fd, objectId, objectType);
+
+    if (props == NULL) return 0;
+
+    for (uint32_t i = 0; (i < props->count_props) && (propId == 0); i++)
+    {
+        drmModePropertyRes *prop = drmModeGetProperty(platform.fd, props->props[i]);
+
+        if (prop != NULL)
+        {
+            if (strcmp(prop->name, name) == 0)
+            {
+                propId = prop->prop_id;
+                if (value != NULL) *value = props->prop_values[i];
+            }
+
+            drmModeFreeProperty(prop);
+        }
+    }
+
+    drmModeFreeObjectProperties(props);
+
+    return propId;
+}
+
+// Initialize DRM atomic modesetting: find primary plane used by the CRTC and its properties
+// NOTE: Initial mode is still set with drmModeSetCrtc(), atomic commits only update the plane framebuffer
+static bool InitAtomicModeset(void)
+{
+    if (drmSetClientCap(platform.fd, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1) != 0) return false;
+    if (drmSetClientCap(platform.fd, DRM_CLIENT_CAP_ATOMIC, 1) != 0) return false;
+
+    // Get CRTC index, required to check planes possible CRTCs bitmask
+    int crtcIndex = -1;
+    drmModeRes *res = drmModeGetResources(platform.fd);
+
+    if (res != NULL)
+    {
+        for (int i = 0; i < res->count_crtcs; i++) if (res->crtcs[i] == platform.crtc->crtc_id) crtcIndex = i;
+        drmModeFreeResources(res);
+    }
+
+    if (crtcIndex < 0) return false;
+
+    drmModePlaneRes *planes = drmModeGetPlaneResources(platform.fd);
+    if (planes == NULL) return false;
+
+    swapChain.planeId = 0;
+
+    for (uint32_t i = 0; i < planes->count_planes; i++)
+    {
+        drmModePlane *plane = drmModeGetPlane(platform.fd, planes->planes[i]);
+        if (plane == NULL) continue;
+
+        uint64_t type = 0;
+
+        if ((plane->possible_crtcs & (1u << crtcIndex)) &&
+            (GetDrmPropertyId(plane->plane_id, DRM_MODE_OBJECT_PLANE, "type", &type) != 0) && (type == DRM_PLANE_TYPE_PRIMARY))
+        {
+            // Prefer the primary plane already bound to the CRTC
+            if ((swapChain.planeId == 0) || (plane->crtc_id == platform.crtc->crtc_id)) swapChain.planeId = plane->plane_id;
+        }
+
+        drmModeFreePlane(plane);
+    }
+
+    drmModeFreePlaneResources(planes);
+
+    if (swapChain.planeId == 0) return false;
+
+    swapChain.propFbId = GetDrmPropertyId(swapChain.planeId, DRM_MODE_OBJECT_PLANE, "FB_ID", NULL);
+    swapChain.propCrtcId = GetDrmPropertyId(swapChain.planeId, DRM_MODE_OBJECT_PLANE, "CRTC_ID", NULL);
+    swapChain.propInFenceFd = GetDrmPropertyId(swapChain.planeId, DRM_MODE_OBJECT_PLANE, "IN_FENCE_FD", NULL);
+
+    return ((swapChain.propFbId != 0) && (swapChain.propCrtcId != 0));
+}
+
 // Renders a blank frame to allocate initial buffers
 // TODO: WARNING: Platform backend should not include OpenGL code
 void RenderBlankFrame()
@@ -696,11 +827,75 @@ int InitSwapScreenBuffer()
     platform.prevBO = bo;
     crtcSet = true;
 
+    swapChain.pendingBO = NULL;
+    swapChain.queuedBO = NULL;
+    swapChain.queuedFenceFd = -1;
+    swapChain.atomic = InitAtomicModeset();
+
+    if (swapChain.atomic)
+    {
+        // Render fences let the kernel wait for the GPU instead of the application
+        const char *eglExtensions = eglQueryString(platform.device, EGL_EXTENSIONS);
+
+        if ((swapChain.propInFenceFd != 0) && (eglExtensions != NULL) && (strstr(eglExtensions, "EGL_ANDROID_native_fence_sync") != NULL))
+        {
+            swapChain.eglCreateSyncKHR = (PFNEGLCREATESYNCKHRPROC)eglGetProcAddress("eglCreateSyncKHR");
+            swapChain.eglDestroySyncKHR = (PFNEGLDESTROYSYNCKHRPROC)eglGetProcAddress("eglDestroySyncKHR");
+            swapChain.eglDupNativeFenceFDANDROID = (PFNEGLDUPNATIVEFENCEFDANDROIDPROC)eglGetProcAddress("eglDupNativeFenceFDANDROID");
+
+            if (!swapChain.eglCreateSyncKHR || !swapChain.eglDestroySyncKHR) swapChain.eglDupNativeFenceFDANDROID = NULL;
+        }
+
+        TRACELOG(LOG_INFO, "DISPLAY: DRM: Atomic modesetting enabled (plane: %u, fences: %s)", swapChain.planeId, swapChain.eglDupNativeFenceFDANDROID? "yes" : "no");
+    }
+    else TRACELOG(LOG_INFO, "DISPLAY: DRM: Atomic modesetting not available, using legacy page flip");
+
     return 0;
 }
 
+// Submit buffer object for scanout on next vblank, returns immediately
+// NOTE: Completion is notified to PageFlipHandler() with the submitted buffer object as user data,
+// the render fence (if available) is waited by the kernel, so the GPU does not need to finish the frame first
+static int SubmitPageFlip(struct gbm_bo *bo, int fenceFd)
+{
+    int result = -1;
+    uint32_t fbId = GetOrCreateFbForBo(bo);
+
+    if (fbId)
+    {
+        if (swapChain.atomic)
+        {
+            drmModeAtomicReq *request = drmModeAtomicAlloc();
+
+            if (request)
+            {
+                drmModeAtomicAddProperty(request, swapChain.planeId, swapChain.propFbId, fbId);
+                drmModeAtomicAddProperty(request, swapChain.planeId, swapChain.propCrtcId, platform.crtc->crtc_id);
+                if (fenceFd >= 0) drmModeAtomicAddProperty(request, swapChain.planeId, swapChain.propInFenceFd, fenceFd);
+
+                result = drmModeAtomicCommit(platform.fd, request, DRM_MODE_ATOMIC_NONBLOCK | DRM_MODE_PAGE_FLIP_EVENT, bo);
+                drmModeAtomicFree(request);
+            }
+        }
+        else
+        {
+            // NOTE: drmModePageFlip() schedules a buffer flip for the next vblank, the DRM fd becomes readable once it happens
+            result = drmModePageFlip(platform.fd, platform.crtc->crtc_id, fbId, DRM_MODE_PAGE_FLIP_EVENT, bo);
+        }
+
+        if (result != 0) TRACELOG(LOG_DEBUG, "DISPLAY: DRM: Page flip failed. ERROR: %s", strerror(errno));
+    }
+
+    // Kernel keeps its own reference to the fence
+    if (fenceFd >= 0) close(fenceFd);
+
+    if (result == 0) swapChain.pendingBO = bo;
+
+    return result;
+}
+
 // Static page flip handler
-// NOTE: Called once the drmModePageFlip() finished from the drmHandleEvent() context
+// NOTE: Called once the submitted flip finished from the drmHandleEvent() context
 static void PageFlipHandler(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void *data)
 {
     // Unused inputs
@@ -709,27 +904,32 @@ static void PageFlipHandler(int fd, unsigned int frame, unsigned int sec, unsign
     (void)sec;
     (void)usec;
 
-    pendingFlip = false;
-    struct gbm_bo *boToRelease = (struct gbm_bo *)data;
+    struct gbm_bo *bo = (struct gbm_bo *)data;
 
-    // Buffers are released after the flip completes (via page_flip_handler), ensuring they're no longer in use
+    // Buffers are released after the flip completes, ensuring they're no longer in use
     // Prevents the GPU from writing to a buffer being scanned out
-    if (boToRelease) gbm_surface_release_buffer(platform.gbmSurface, boToRelease);
-}
+    if (platform.prevBO && (platform.prevBO != bo)) gbm_surface_release_buffer(platform.gbmSurface, platform.prevBO);
 
-// Swap implementation with proper caching
-void rl_SwapScreenBuffer()
-{
-    if (!crtcSet || !platform.gbmSurface) return;
+    platform.prevBO = bo;
+    swapChain.pendingBO = NULL;
 
-    static int loopCnt = 0;
-    static int errCnt[5] = { 0 };
-    loopCnt++;
+    // Submit the frame rendered while the flip was pending, it will be scanned out on next vblank
+    if (swapChain.queuedBO)
+    {
+        struct gbm_bo *queuedBO = swapChain.queuedBO;
+        int fenceFd = swapChain.queuedFenceFd;
 
-    // Call this only, if pendingFlip is not set
-    eglSwapBuffers(platform.device, platform.surface);
+        swapChain.queuedBO = NULL;
+        swapChain.queuedFenceFd = -1;
 
-    // Process pending events non-blocking
+        if (SubmitPageFlip(queuedBO, fenceFd) != 0) gbm_surface_release_buffer(platform.gbmSurface, queuedBO);
+    }
+}
+
+// Process DRM events (page flip completions), waiting up to timeout milliseconds for the first one
+// NOTE: Use timeout 0 for non-blocking processing
+static void ProcessDrmEvents(int timeout)
+{
     drmEventContext evctx = {
         .version = DRM_EVENT_CONTEXT_VERSION,
         .page_flip_handler = PageFlipHandler
@@ -737,64 +937,263 @@ void rl_SwapScreenBuffer()
 
     struct pollfd pfd = { .fd = platform.fd, .events = POLLIN };
 
-    // Polling for event for 0ms
-    while (poll(&pfd, 1, 0) > 0) drmHandleEvent(platform.fd, &evctx);
+    while (poll(&pfd, 1, timeout) > 0)
+    {
+        drmHandleEvent(platform.fd, &evctx);
+        timeout = 0;
+    }
+}
 
-    // Skip if previous flip pending
-    if (pendingFlip)
+// Swap implementation with proper caching
+// NOTE: Triple buffered: one buffer scanned out, one flip pending and one queued while rendering goes on,
+// only blocks when the GBM surface has no free buffer left to render the next frame
+void rl_SwapScreenBuffer()
+{
+    if (!crtcSet || !platform.gbmSurface) return;
+
+    // Create render fence before swapping, exported once the frame commands are flushed
+    EGLSyncKHR fence = EGL_NO_SYNC_KHR;
+    if (swapChain.eglDupNativeFenceFDANDROID)
     {
-        errCnt[0]++; // Skip frame: flip pending
-        return;
+        const EGLint fenceAttribs[] = { EGL_SYNC_NATIVE_FENCE_FD_ANDROID, EGL_NO_NATIVE_FENCE_FD_ANDROID, EGL_NONE };
+        fence = swapChain.eglCreateSyncKHR(platform.device, EGL_SYNC_NATIVE_FENCE_ANDROID, fenceAttribs);
+    }
+
+    eglSwapBuffers(platform.device, platform.surface);
+
+    int fenceFd = -1;
+    if (fence != EGL_NO_SYNC_KHR)
+    {
+        fenceFd = swapChain.eglDupNativeFenceFDANDROID(platform.device, fence);
+        swapChain.eglDestroySyncKHR(platform.device, fence);
     }
 
+    // Process pending events non-blocking
+    ProcessDrmEvents(0);
+
     // Get new front buffer
     struct gbm_bo *nextBO = gbm_surface_lock_front_buffer(platform.gbmSurface);
-    if (!nextBO) // Failed to lock front buffer
+    if (!nextBO)
     {
-        errCnt[1]++;
+        TRACELOG(LOG_DEBUG, "DISPLAY: DRM: Failed to lock front buffer");
+        if (fenceFd >= 0) close(fenceFd);
         return;
     }
 
-    // Get FB ID (creates new one if needed)
-    uint32_t fbId = GetOrCreateFbForBo(nextBO);
-    if (!fbId)
+    if (swapChain.pendingBO)
     {
-        gbm_surface_release_buffer(platform.gbmSurface, nextBO);
-        errCnt[2]++;
-        return;
+        // Flip pending: queue new frame to be submitted on flip completion, replacing any older queued frame
+        if (swapChain.queuedBO)
+        {
+            gbm_surface_release_buffer(platform.gbmSurface, swapChain.queuedBO);
+            if (swapChain.queuedFenceFd >= 0) close(swapChain.queuedFenceFd);
+        }
+
+        swapChain.queuedBO = nextBO;
+        swapChain.queuedFenceFd = fenceFd;
     }
+    else if (SubmitPageFlip(nextBO, fenceFd) != 0) gbm_surface_release_buffer(platform.gbmSurface, nextBO);
+
+    // Wait for a flip completion only if there is no free buffer to render next frame
+    if (!gbm_surface_has_free_buffers(platform.gbmSurface)) ProcessDrmEvents(DRM_FLIP_WAIT_TIMEOUT);
+}
+
+#else // !SUPPORT_DRM_CACHE
+
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+// Find a CRTC compatible with the connector for software rendering
+// NOTE: Connectors without encoder are accepted in software mode, so CRTC could not be set on initialization
+static bool InitSoftwareCrtc(void)
+{
+    uint32_t crtcId = 0;
 
-    // Attempt page flip
-    // NOTE: rmModePageFlip() schedules a buffer-flip for the next vblank and then notifies us about it
-    // It takes a CRTC-id, fb-id and an arbitrary data-pointer and then schedules the page-flip
-    // This is fully asynchronous and when the page-flip happens, the DRM-fd will become readable and we can call drmHandleEvent()
-    // This will read all vblank/page-flip events and call our modeset_page_flip_event() callback with the data-pointer that we passed to drmModePageFlip()
-    // We simply call modeset_draw_dev() then so the next frame is rendered... returns immediately
-    if (drmModePageFlip(platform.fd, platform.crtc->crtc_id, fbId, DRM_MODE_PAGE_FLIP_EVENT, platform.prevBO))
+    // Find a CRTC that's compatible with this connector
+    drmModeRes *res = drmModeGetResources(platform.fd);
+    if (!res)
     {
-        if (errno == EBUSY) errCnt[3]++; // Display busy - skip flip
-        else errCnt[4]++; // Page flip failed
+        TRACELOG(LOG_ERROR, "DISPLAY: Failed to get DRM resources");
+        return false;
+    }
 
-        gbm_surface_release_buffer(platform.gbmSurface, nextBO);
-        return;
+    // Check which CRTCs are compatible with this connector
+    drmModeEncoder *encoder = NULL;
+    if (platform.connector->encoder_id) encoder = drmModeGetEncoder(platform.fd, platform.connector->encoder_id);
+
+    if (encoder && encoder->crtc_id)
+    {
+        crtcId = encoder->crtc_id;
+        platform.crtc = drmModeGetCrtc(platform.fd, crtcId);
     }
+    else
+    {
+        // Find a free CRTC
+        for (int i = 0; i < res->count_crtcs; i++)
+        {
+            drmModeCrtc *crtc = drmModeGetCrtc(platform.fd, res->crtcs[i]);
+            if (crtc && !crtc->buffer_id) // CRTC is free
+            {
+                crtcId = res->crtcs[i];
+                if (platform.crtc) drmModeFreeCrtc(platform.crtc);
+                platform.crtc = crtc;
+                break;
+            }
 
-    // Success: update state
-    pendingFlip = true;
-    platform.prevBO = nextBO;
+            if (crtc) drmModeFreeCrtc(crtc);
+        }
+    }
 
-/*
-    // Some benchmarking code
-    if (loopCnt >= 600)
+    if (encoder) drmModeFreeEncoder(encoder);
+    drmModeFreeResources(res);
+
+    if (!crtcId || !platform.crtc)
     {
-        TRACELOG(LOG_INFO, "DRM: Error counters: %d, %d, %d, %d, %d, %d", errCnt[0], errCnt[1], errCnt[2], errCnt[3], errCnt[4], loopCnt);
-        for (int i = 0; i < 5; i++) errCnt[i] = 0;
-        loopCnt = 0;
+        TRACELOG(LOG_ERROR, "DISPLAY: No compatible CRTC found");
+        return false;
     }
-*/
+
+    return true;
 }
 
-#else // !SUPPORT_DRM_CACHE
+// Unload dumb buffers: unmap memory, remove framebuffers and destroy buffers
+static void UnloadDumbBuffers(void)
+{
+    // Software renderer could be rendering into dumb buffer memory
+    if (platform.dumbBufferBound) swSetColorBuffer(NULL, 0);
+
+    for (int i = 0; i < 2; i++)
+    {
+        DumbBuffer *buffer = &platform.dumbBuffers[i];
+
+        if (buffer->pixels) munmap(buffer->pixels, buffer->size);
+        if (buffer->fb) drmModeRmFB(platform.fd, buffer->fb);
+        if (buffer->handle)
+        {
+            struct drm_mode_destroy_dumb dreq = { 0 };
+            dreq.handle = buffer->handle;
+            drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
+        }
+
+        *buffer = (DumbBuffer){ 0 };
+    }
+
+    RL_FREE(platform.dumbBufferScratch);
+    platform.dumbBufferScratch = NULL;
+    platform.dumbBufferBound = false;
+    platform.crtcReady = false;
+}
+
+// Load double buffered dumb buffers, mapped for the whole swap chain lifetime
+// NOTE: If the display supports software renderer color layout, it renders directly into dumb buffers
+static int LoadDumbBuffers(uint32_t width, uint32_t height)
+{
+#if SW_COLOR_BUFFER_BITS == 16
+    const uint32_t bpp = 16;
+    uint32_t format = DRM_FORMAT_RGB565;    // Same layout as software renderer packed color
+#elif SW_COLOR_BUFFER_BITS == 32
+    const uint32_t bpp = 32;
+    uint32_t format = DRM_FORMAT_XBGR8888;  // Same layout as software renderer color: R, G, B, X bytes
+#else
+    const uint32_t bpp = 32;
+    uint32_t format = DRM_FORMAT_XRGB8888;
+#endif
+
+    // Direct rendering requires software framebuffer matching the display mode
+    platform.dumbBufferDirect = (format != DRM_FORMAT_XRGB8888) &&
+        ((uint32_t)CORE.Window.render.width == width) && ((uint32_t)CORE.Window.render.height == height);
+    if (!platform.dumbBufferDirect) format = DRM_FORMAT_XRGB8888;
+
+    for (int i = 0; i < 2; i++)
+    {
+        DumbBuffer *buffer = &platform.dumbBuffers[i];
+
+        // Create a dumb buffer for software rendering
+        struct drm_mode_create_dumb creq = { 0 };
+        creq.width = width;
+        creq.height = height;
+        creq.bpp = (format == DRM_FORMAT_XRGB8888)? 32 : bpp;
+
+        if (drmIoctl(platform.fd, DRM_IOCTL_MODE_CREATE_DUMB, &creq) < 0)
+        {
+            TRACELOG(LOG_ERROR, "DISPLAY: Failed to create dumb buffer: %s", strerror(errno));
+            UnloadDumbBuffers();
+            return -1;
+        }
+
+        buffer->handle = creq.handle;
+        buffer->pitch = creq.pitch;
+        buffer->size = creq.size;
+
+        // Create framebuffer with the correct format
+        uint32_t handles[4] = { creq.handle, 0, 0, 0 };
+        uint32_t pitches[4] = { creq.pitch, 0, 0, 0 };
+        uint32_t offsets[4] = { 0 };
+
+        int result = drmModeAddFB2(platform.fd, width, height, format, handles, pitches, offsets, &buffer->fb, 0);
+        if ((result != 0) && (i == 0) && (format != DRM_FORMAT_XRGB8888))
+        {
+            // Display does not support software renderer color layout, converted copy required every frame
+            TRACELOG(LOG_INFO, "DISPLAY: DRM: Direct software rendering format not supported, using framebuffer copy");
+            UnloadDumbBuffers();
+            platform.dumbBufferDirect = false;
+            format = DRM_FORMAT_XRGB8888;
+            i = -1;
+            continue;
+        }
+
+        if (result != 0)
+        {
+            TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB2() failed with result: %d (%s)", result, strerror(errno));
+            UnloadDumbBuffers();
+            return -1;
+        }
+
+        // Map the dumb buffer into userspace
+        struct drm_mode_map_dumb mreq = { 0 };
+        mreq.handle = creq.handle;
+        result = drmIoctl(platform.fd, DRM_IOCTL_MODE_MAP_DUMB, &mreq);
+        if (result == 0) buffer->pixels = mmap(0, creq.size, PROT_READ | PROT_WRITE, MAP_SHARED, platform.fd, mreq.offset);
+
+        if ((result != 0) || (buffer->pixels == MAP_FAILED))
+        {
+            TRACELOG(LOG_ERROR, "DISPLAY: Failed to map dumb buffer: %s", strerror(errno));
+            buffer->pixels = NULL;
+            UnloadDumbBuffers();
+            return -1;
+        }
+    }
+
+    platform.dumbBufferIndex = 0;
+
+    // Dumb buffers content is undefined, first copies cover the whole screen
+    platform.dumbBufferDirty[0] = 0;
+    platform.dumbBufferDirty[1] = 0;
+    platform.dumbBufferDirty[2] = (int)width;
+    platform.dumbBufferDirty[3] = (int)height;
+
+    // Scaled copies require a tightly packed intermediate buffer if dumb buffer rows are padded
+    bool scaled = ((uint32_t)CORE.Window.render.width != width) || ((uint32_t)CORE.Window.render.height != height);
+    if (!platform.dumbBufferDirect && scaled && (platform.dumbBuffers[0].pitch != width*4)) platform.dumbBufferScratch = RL_MALLOC(width*height*4);
+
+    TRACELOG(LOG_INFO, "DISPLAY: DRM: Dumb buffers loaded (%ux%u, pitch: %u, direct rendering: %s)", width, height,
+        platform.dumbBuffers[0].pitch, platform.dumbBufferDirect? "yes" : "no");
+
+    return 0;
+}
+
+// Software rendering page flip handler
+// NOTE: Called once the drmModePageFlip() finished from the drmHandleEvent() context
+static void DumbPageFlipHandler(int fd, unsigned int frame, unsigned int sec, unsigned int usec, void *data)
+{
+    // Unused inputs
+    (void)fd;
+    (void)frame;
+    (void)sec;
+    (void)usec;
+    (void)data;
+
+    platform.dumbFlipPending = false;
+}
+#endif
 
 // Swap back buffer with front buffer (screen drawing)
 void rl_SwapScreenBuffer(void)
@@ -839,165 +1238,105 @@ void rl_SwapScreenBuffer(void)
     uint32_t width = mode->hdisplay;
     uint32_t height = mode->vdisplay;
 
-    // Dumb buffers use a fixed format based on bpp
-#if SW_COLOR_BUFFER_BITS == 24
-    const uint32_t bpp = 32;    // 32 bits per pixel (XRGB8888 format)
-    const uint32_t depth = 24;  // rl_Color depth, here only 24 bits, alpha is not used
-#else
-    // REVIEW: Not sure how it will be interpreted (RGB or RGBA?)
-    const uint32_t bpp = SW_COLOR_BUFFER_BITS;
-    const uint32_t depth = SW_COLOR_BUFFER_BITS;
-#endif
-
-    // Create a dumb buffer for software rendering
-    struct drm_mode_create_dumb creq = { 0 };
-    creq.width = width;
-    creq.height = height;
-    creq.bpp = bpp;
-
-    int result = drmIoctl(platform.fd, DRM_IOCTL_MODE_CREATE_DUMB, &creq);
-    if (result < 0)
+    // Dumb buffers are loaded on first swap, once the software renderer is initialized
+    if (platform.dumbBuffers[0].pixels == NULL)
     {
-        TRACELOG(LOG_ERROR, "DISPLAY: Failed to create dumb buffer: %s", strerror(errno));
-        return;
+        if (!platform.crtc && !InitSoftwareCrtc()) return;
+        if (LoadDumbBuffers(width, height) != 0) return;
     }
 
-    // Create framebuffer with the correct format
-    uint32_t fb = 0;
-    result = drmModeAddFB(platform.fd, width, height, depth, bpp, creq.pitch, creq.handle, &fb);
-    if (result != 0)
-    {
-        TRACELOG(LOG_ERROR, "DISPLAY: drmModeAddFB() failed with result: %d (%s)", result, strerror(errno));
-        struct drm_mode_destroy_dumb dreq = { 0 };
-        dreq.handle = creq.handle;
-        drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
-        return;
-    }
+    DumbBuffer *buffer = &platform.dumbBuffers[platform.dumbBufferIndex];
 
-    // Map the dumb buffer to copy our software rendered buffer
-    struct drm_mode_map_dumb mreq = { 0 };
-    mreq.handle = creq.handle;
-    result = drmIoctl(platform.fd, DRM_IOCTL_MODE_MAP_DUMB, &mreq);
-    if (result != 0)
+    if (platform.dumbBufferDirect && !platform.dumbBufferBound)
     {
-        TRACELOG(LOG_ERROR, "DISPLAY: Failed to map dumb buffer: %s", strerror(errno));
-        drmModeRmFB(platform.fd, fb);
-        struct drm_mode_destroy_dumb dreq = { 0 };
-        dreq.handle = creq.handle;
-        drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
-        return;
-    }
+        // First frame was rendered before dumb buffers existed, it is dropped and
+        // next frames are rendered directly into the dumb buffer
+        platform.dumbBufferBound = swSetColorBuffer(buffer->pixels, (int)buffer->pitch);
+        if (platform.dumbBufferBound) return;
 
-    // Map the buffer into userspace
-    void *dumbBuffer = mmap(0, creq.size, PROT_READ | PROT_WRITE, MAP_SHARED, platform.fd, mreq.offset);
-    if (dumbBuffer == MAP_FAILED)
-    {
-        TRACELOG(LOG_ERROR, "DISPLAY: Failed to mmap dumb buffer: %s", strerror(errno));
-        drmModeRmFB(platform.fd, fb);
-        struct drm_mode_destroy_dumb dreq = { 0 };
-        dreq.handle = creq.handle;
-        drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
-        return;
+        platform.dumbBufferDirect = false;
     }
 
-    // Copy the software rendered buffer to the dumb buffer with scaling if needed
-    // NOTE: RLSW will make a simple copy if the dimensions match
-    swBlitFramebuffer(0, 0, width, height, 0, 0, width, height, SW_RGBA, SW_UNSIGNED_BYTE, dumbBuffer);
+    if (!platform.dumbBufferDirect && ((uint32_t)CORE.Window.render.width == width) && ((uint32_t)CORE.Window.render.height == height))
+    {
+        // Copy only the region modified by the software renderer
+        int x = 0, y = 0, w = 0, h = 0;
+        bool dirty = swGetDirtyRegion(&x, &y, &w, &h);
+        swResetDirtyRegion();
 
-    // Unmap the buffer
-    munmap(dumbBuffer, creq.size);
+        // Displayed dumb buffer is up to date if no pixel was modified, no copy and no page flip required
+        if (!dirty && platform.crtcReady) return;
 
-    // Find a CRTC compatible with the connector
-    uint32_t crtcId = 0;
-    if (platform.crtc) crtcId = platform.crtc->crtc_id;
-    else
-    {
-        // Find a CRTC that's compatible with this connector
-        drmModeRes *res = drmModeGetResources(platform.fd);
-        if (!res)
+        // Dumb buffer holds the frame before the previous one, copy covers both frames modified regions
+        int *prev = platform.dumbBufferDirty;
+        if (dirty)
         {
-            TRACELOG(LOG_ERROR, "DISPLAY: Failed to get DRM resources");
-            drmModeRmFB(platform.fd, fb);
-            struct drm_mode_destroy_dumb dreq = {0};
-            dreq.handle = creq.handle;
-            drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
-            return;
-        }
+            int x1 = (x + w > prev[0] + prev[2])? x + w : prev[0] + prev[2];
+            int y1 = (y + h > prev[1] + prev[3])? y + h : prev[1] + prev[3];
+            int x0 = (x < prev[0])? x : prev[0];
+            int y0 = (y < prev[1])? y : prev[1];
 
-        // Check which CRTCs are compatible with this connector
-        drmModeEncoder *encoder = NULL;
-        if (platform.connector->encoder_id) encoder = drmModeGetEncoder(platform.fd, platform.connector->encoder_id);
+            swCopyFramebufferRegion(x0, y0, x1 - x0, y1 - y0, SW_RGBA, SW_UNSIGNED_BYTE, buffer->pixels, (int)buffer->pitch);
 
-        if (encoder && encoder->crtc_id)
-        {
-            crtcId = encoder->crtc_id;
-            platform.crtc = drmModeGetCrtc(platform.fd, crtcId);
+            prev[0] = x;
+            prev[1] = y;
+            prev[2] = w;
+            prev[3] = h;
         }
+        else swCopyFramebufferRegion(prev[0], prev[1], prev[2], prev[3], SW_RGBA, SW_UNSIGNED_BYTE, buffer->pixels, (int)buffer->pitch);
+    }
+    else if (!platform.dumbBufferDirect)
+    {
+        // Scale the software rendered buffer into the dumb buffer
+        if (platform.dumbBufferScratch == NULL) swBlitFramebuffer(0, 0, width, height, 0, 0, width, height, SW_RGBA, SW_UNSIGNED_BYTE, buffer->pixels);
         else
         {
-            // Find a free CRTC
-            for (int i = 0; i < res->count_crtcs; i++)
-            {
-                drmModeCrtc *crtc = drmModeGetCrtc(platform.fd, res->crtcs[i]);
-                if (crtc && !crtc->buffer_id) // CRTC is free
-                {
-                    crtcId = res->crtcs[i];
-                    if (platform.crtc) drmModeFreeCrtc(platform.crtc);
-                    platform.crtc = crtc;
-                    break;
-                }
+            // Dumb buffer rows are padded, copy row by row from tightly packed buffer
+            swBlitFramebuffer(0, 0, width, height, 0, 0, width, height, SW_RGBA, SW_UNSIGNED_BYTE, platform.dumbBufferScratch);
 
-                if (crtc) drmModeFreeCrtc(crtc);
+            for (uint32_t y = 0; y < height; y++)
+            {
+                memcpy((unsigned char *)buffer->pixels + y*buffer->pitch, (unsigned char *)platform.dumbBufferScratch + y*width*4, width*4);
             }
         }
+    }
 
-        if (encoder) drmModeFreeEncoder(encoder);
-        drmModeFreeResources(res);
-
-        if (!crtcId)
+    if (!platform.crtcReady)
+    {
+        int result = drmModeSetCrtc(platform.fd, platform.crtc->crtc_id, buffer->fb, 0, 0, &platform.connector->connector_id, 1, mode);
+        if (result != 0)
         {
-            TRACELOG(LOG_ERROR, "DISPLAY: No compatible CRTC found");
-            drmModeRmFB(platform.fd, fb);
-            struct drm_mode_destroy_dumb dreq = {0};
-            dreq.handle = creq.handle;
-            drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
+            TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d (%s)", result, strerror(errno));
+            TRACELOG(LOG_ERROR, "DISPLAY: CRTC ID: %u, FB ID: %u, Connector ID: %u", platform.crtc->crtc_id, buffer->fb, platform.connector->connector_id);
+            TRACELOG(LOG_ERROR, "DISPLAY: Mode: %dx%d@%d", mode->hdisplay, mode->vdisplay, mode->vrefresh);
             return;
         }
-    }
 
-    // Set CRTC with better error handling
-    result = drmModeSetCrtc(platform.fd, crtcId, fb, 0, 0, &platform.connector->connector_id, 1, mode);
-    if (result != 0)
+        platform.crtcReady = true;
+    }
+    else if (drmModePageFlip(platform.fd, platform.crtc->crtc_id, buffer->fb, DRM_MODE_PAGE_FLIP_EVENT, NULL) == 0)
     {
-        TRACELOG(LOG_ERROR, "DISPLAY: drmModeSetCrtc() failed with result: %d (%s)", result, strerror(errno));
-        TRACELOG(LOG_ERROR, "DISPLAY: CRTC ID: %u, FB ID: %u, Connector ID: %u", crtcId, fb, platform.connector->connector_id);
-        TRACELOG(LOG_ERROR, "DISPLAY: Mode: %dx%d@%d", mode->hdisplay, mode->vdisplay, mode->vrefresh);
+        // Wait for flip completion, previous dumb buffer is scanned out until then
+        drmEventContext evctx = {
+            .version = DRM_EVENT_CONTEXT_VERSION,
+            .page_flip_handler = DumbPageFlipHandler
+        };
 
-        drmModeRmFB(platform.fd, fb);
-        struct drm_mode_destroy_dumb dreq = {0};
-        dreq.handle = creq.handle;
-        drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
-        return;
-    }
+        struct pollfd pfd = { .fd = platform.fd, .events = POLLIN };
 
-    // Clean up previous framebuffer
-    if (platform.prevFB)
-    {
-        result = drmModeRmFB(platform.fd, platform.prevFB);
-        if (result != 0) TRACELOG(LOG_WARNING, "DISPLAY: drmModeRmFB() failed with result: %d", result);
+        platform.dumbFlipPending = true;
+        while (platform.dumbFlipPending && (poll(&pfd, 1, DRM_FLIP_WAIT_TIMEOUT) > 0)) drmHandleEvent(platform.fd, &evctx);
     }
+    else drmModeSetCrtc(platform.fd, platform.crtc->crtc_id, buffer->fb, 0, 0, &platform.connector->connector_id, 1, mode); // Page flip not supported
 
-    platform.prevFB = fb;
+    // Next frame is rendered into the other dumb buffer
+    platform.dumbBufferIndex = 1 - platform.dumbBufferIndex;
 
-    // Clean up previous dumb buffer
-    if (platform.prevDumbHandle)
+    if (platform.dumbBufferDirect)
     {
-        struct drm_mode_destroy_dumb dreq = {0};
-        dreq.handle = platform.prevDumbHandle;
-        drmIoctl(platform.fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dreq);
+        DumbBuffer *next = &platform.dumbBuffers[platform.dumbBufferIndex];
+        platform.dumbBufferBound = swSetColorBuffer(next->pixels, (int)next->pitch);
     }
-
-    platform.prevDumbHandle = creq.handle;
 #endif
 }
 #endif // SUPPORT_DRM_CACHE
@@ -1149,7 +1488,10 @@ int InitPlatform(void)
     platform.gbmSurface = NULL;
     platform.prevBO = NULL;
 #else
-    platform.prevDumbHandle = 0;
+    memset(platform.dumbBuffers, 0, sizeof(platform.dumbBuffers));
+    platform.dumbBufferIndex = 0;
+    platform.dumbBufferBound = false;
+    platform.crtcReady = false;
 #endif
 
     // Initialize graphic device: display/window and graphic context
@@ -1666,6 +2008,27 @@ void ClosePlatform(void)
         platform.prevFB = 0;
     }
 
+#if defined(SUPPORT_DRM_CACHE)
+    // Drop queued frame and wait for pending flip, buffers can not be released while scanned out
+    if (swapChain.queuedBO)
+    {
+        gbm_surface_release_buffer(platform.gbmSurface, swapChain.queuedBO);
+        if (swapChain.queuedFenceFd >= 0) close(swapChain.queuedFenceFd);
+        swapChain.queuedBO = NULL;
+        swapChain.queuedFenceFd = -1;
+    }
+
+    if (swapChain.pendingBO) ProcessDrmEvents(DRM_FLIP_WAIT_TIMEOUT);
+
+    if (swapChain.pendingBO)
+    {
+        gbm_surface_release_buffer(platform.gbmSurface, swapChain.pendingBO);
+        swapChain.pendingBO = NULL;
+    }
+
+    crtcSet = false;
+#endif
+
 #if !defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
     if (platform.prevBO)
     {
@@ -1684,6 +2047,8 @@ void ClosePlatform(void)
         gbm_device_destroy(platform.gbmDevice);
         platform.gbmDevice = NULL;
     }
+#else
+    UnloadDumbBuffers();
 #endif
 
     if (platform.crtc)
@@ -2227,6 +2592,9 @@ static void PollKeyboardEvents(void)
                 CORE.Input.Keyboard.currentKeyState[keycode] = (event.value >= 1);
                 CORE.Input.Keyboard.keyRepeatInFrame[keycode] = (event.value == 2);
 
+                PushInputEvent((event.value == 0)? INPUT_EVENT_KEY_RELEASED : ((event.value == 2)? INPUT_EVENT_KEY_REPEAT : INPUT_EVENT_KEY_PRESSED), 0, keycode, 0.0f, 0.0f);
+                if (event.value == 1) PushInputEvent(INPUT_EVENT_CHAR, 0, evkeyToUnicodeLUT[event.code], 0.0f, 0.0f);
+
                 // If the key is pressed add it to the queues
                 if (event.value == 1)
                 {
@@ -2347,7 +2715,13 @@ static void PollMouseEvents(void)
                 touchAction = 2;    // TOUCH_ACTION_MOVE
             }
 
-            if (event.code == REL_WHEEL) platform.eventWheelMove.y += event.value;
+            if (event.code == REL_WHEEL)
+            {
+                platform.eventWheelMove.y += event.value;
+                PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, 0.0f, (float)event.value);
+            }
+
+            if ((event.code == REL_X) || (event.code == REL_Y)) PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
         }
 
         // Absolute movement parsing
@@ -2395,6 +2769,8 @@ static void PollMouseEvents(void)
                     // If this slot is active, it's a move. If not, we are just updating the buffer for when it becomes active.
                     // Only set to MOVE if we haven't already detected a DOWN or UP event this frame
                     if (platform.touchActive[platform.touchSlot] && touchAction == -1) touchAction = 2;    // TOUCH_ACTION_MOVE
+
+                    if (platform.touchActive[platform.touchSlot]) PushInputEvent(INPUT_EVENT_TOUCH_MOVE, platform.touchId[platform.touchSlot], 0, platform.touchPosition[platform.touchSlot].x, platform.touchPosition[platform.touchSlot].y);
                 }
             }
 
@@ -2407,6 +2783,8 @@ static void PollMouseEvents(void)
                     // If this slot is active, it's a move. If not, we are just updating the buffer for when it becomes active.
                     // Only set to MOVE if we haven't already detected a DOWN or UP event this frame
                     if (platform.touchActive[platform.touchSlot] && touchAction == -1) touchAction = 2;    // TOUCH_ACTION_MOVE
+
+                    if (platform.touchActive[platform.touchSlot]) PushInputEvent(INPUT_EVENT_TOUCH_MOVE, platform.touchId[platform.touchSlot], 0, platform.touchPosition[platform.touchSlot].x, platform.touchPosition[platform.touchSlot].y);
                 }
             }
 
@@ -2420,11 +2798,15 @@ static void PollMouseEvents(void)
                         platform.touchActive[platform.touchSlot] = true;
                         platform.touchId[platform.touchSlot] = event.value; // Use Tracking ID for unique IDs
 
+                        PushInputEvent(INPUT_EVENT_TOUCH_DOWN, event.value, 0, platform.touchPosition[platform.touchSlot].x, platform.touchPosition[platform.touchSlot].y);
+
                         touchAction = 1; // TOUCH_ACTION_DOWN
                     }
                     else
                     {
                         // Touch has ended for this point
+                        PushInputEvent(INPUT_EVENT_TOUCH_UP, platform.touchId[platform.touchSlot], 0, platform.touchPosition[platform.touchSlot].x, platform.touchPosition[platform.touchSlot].y);
+
                         platform.touchActive[platform.touchSlot] = false;
                         platform.touchPosition[platform.touchSlot].x = -1;
                         platform.touchPosition[platform.touchSlot].y = -1;
@@ -2528,6 +2910,23 @@ static void PollMouseEvents(void)
             if (event.code == BTN_EXTRA) platform.currentButtonStateEvdev[MOUSE_BUTTON_EXTRA] = event.value;
             if (event.code == BTN_FORWARD) platform.currentButtonStateEvdev[MOUSE_BUTTON_FORWARD] = event.value;
             if (event.code == BTN_BACK) platform.currentButtonStateEvdev[MOUSE_BUTTON_BACK] = event.value;
+
+            // Register mouse button event
+            int button = -1;
+            switch (event.code)
+            {
+                case BTN_TOUCH:
+                case BTN_LEFT: button = MOUSE_BUTTON_LEFT; break;
+                case BTN_RIGHT: button = MOUSE_BUTTON_RIGHT; break;
+                case BTN_MIDDLE: button = MOUSE_BUTTON_MIDDLE; break;
+                case BTN_SIDE: button = MOUSE_BUTTON_SIDE; break;
+                case BTN_EXTRA: button = MOUSE_BUTTON_EXTRA; break;
+                case BTN_FORWARD: button = MOUSE_BUTTON_FORWARD; break;
+                case BTN_BACK: button = MOUSE_BUTTON_BACK; break;
+                default: break;
+            }
+
+            if (button != -1) PushInputEvent((event.value > 0)? INPUT_EVENT_MOUSE_BUTTON_PRESSED : INPUT_EVENT_MOUSE_BUTTON_RELEASED, 0, button, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
         }
 
         // Screen confinement
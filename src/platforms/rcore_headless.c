@@ -0,0 +1,792 @@
+/**********************************************************************************************
+*
+*   rcore_headless - Functions to manage window, graphics device and inputs
+*
+*   PLATFORM: HEADLESS
+*       - Linux (EGL offscreen rendering, no display server or connected screen required)
+*
+*   LIMITATIONS:
+*       - No window and no input system
+*       - Hardware renderer only (OpenGL 1.1, 2.1, 3.3, 4.3 or ES2/ES3), use PLATFORM_MEMORY for software renderer
+*       - Screen is an EGL pbuffer surface, read it back with rl_LoadImageFromScreen() or rl_LoadImageFromScreenAsync()
+*
+*   POSSIBLE IMPROVEMENTS:
+*       - Select EGL device per context (multi-GPU systems)
+*       - Share GL objects between thread contexts
+*
+*   ADDITIONAL NOTES:
+*       - TRACELOG() function is located in raylib [utils] module
+*       - EGL display is selected in order: EGL_EXT_platform_device (hardware devices first),
+*         EGL_MESA_platform_surfaceless and default display, it is shared by all contexts
+*
+*   CONFIGURATION:
+*       #define RLGL_ENABLE_THREAD_CONTEXTS
+*           Every thread calling rl_InitWindow() gets an independent context, core, rlgl and modules state
+*           is stored per thread, contexts must be closed with rl_CloseWindow() from the thread that created them
+*
+*   DEPENDENCIES:
+*       - EGL: Offscreen graphic context (libEGL)
+*       - gestures: Gestures system for touch-ready devices (or simulated from mouse inputs)
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2025-2026 Ramon Santamaria (@raysan5) and contributors
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include <pthread.h>            // POSIX threads management (shared EGL display lock)
+
+#if !defined(EGL_NO_X11)
+    #define EGL_NO_X11          // Avoid X11 headers inclusion by EGL platform headers (conflicting types)
+#endif
+#if !defined(KHRONOS_APIENTRY)
+    #define KHRONOS_APIENTRY    // Not defined by khrplatform.h embedded in glad, required by EGL headers
+#endif
+#include "EGL/egl.h"            // Native platform windowing system interface
+#include "EGL/eglext.h"         // EGL extensions
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+    #define EGL_PLATFORM_SURFACELESS_MESA   0x31DD
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define MAX_EGL_DEVICES     16          // Maximum number of EGL devices checked (EGL_EXT_device_enumeration)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+    EGLDisplay device;                  // Shared EGL display (device or surfaceless platform)
+    EGLSurface surface;                 // Pbuffer surface to draw on (screen framebuffer)
+    EGLContext context;                 // Graphic context, mode in which drawing can be done
+    EGLConfig config;                   // Graphic config
+} PlatformData;
+
+// EGL display shared by all contexts
+// NOTE: eglTerminate() is not reference counted, display is terminated with last context
+typedef struct {
+    EGLDisplay display;                 // EGL display, initialized on first context creation
+    int contexts;                       // Number of contexts using the display
+    pthread_mutex_t lock;               // Display and GL extensions loading lock
+} HeadlessDisplay;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+extern RL_CONTEXT_LOCAL CoreData CORE;  // Global CORE state context
+
+static RL_CONTEXT_LOCAL PlatformData platform = { 0 };  // Platform specific data
+
+static HeadlessDisplay headless = { EGL_NO_DISPLAY, 0, PTHREAD_MUTEX_INITIALIZER };
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+int InitPlatform(void);                 // Initialize platform (graphics, inputs and more)
+void ClosePlatform(void);               // Close platform
+
+static EGLDisplay GetHeadlessDisplay(void);             // Get EGL display available without windowing system
+static bool CreateScreenSurface(int width, int height); // Create pbuffer surface used as screen framebuffer
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// NOTE: Functions declaration is provided by raylib.h
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Window and Graphics Device
+//----------------------------------------------------------------------------------
+
+// Check if application should close
+bool rl_WindowShouldClose(void)
+{
+    if (CORE.Window.ready) return CORE.Window.shouldClose;
+    else return true;
+}
+
+// Toggle fullscreen mode
+void rl_ToggleFullscreen(void)
+{
+    TRACELOG(LOG_WARNING, "rl_ToggleFullscreen() not available on target platform");
+}
+
+// Toggle borderless windowed mode
+void rl_ToggleBorderlessWindowed(void)
+{
+    TRACELOG(LOG_WARNING, "rl_ToggleBorderlessWindowed() not available on target platform");
+}
+
+// Set window state: maximized, if resizable
+void rl_MaximizeWindow(void)
+{
+    TRACELOG(LOG_WARNING, "rl_MaximizeWindow() not available on target platform");
+}
+
+// Set window state: minimized
+void rl_MinimizeWindow(void)
+{
+    TRACELOG(LOG_WARNING, "rl_MinimizeWindow() not available on target platform");
+}
+
+// Restore window from being minimized/maximized
+void rl_RestoreWindow(void)
+{
+    TRACELOG(LOG_WARNING, "rl_RestoreWindow() not available on target platform");
+}
+
+// Set window configuration state using flags
+void rl_SetWindowState(unsigned int flags)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowState() not available on target platform");
+}
+
+// Clear window configuration state flags
+void rl_ClearWindowState(unsigned int flags)
+{
+    TRACELOG(LOG_WARNING, "rl_ClearWindowState() not available on target platform");
+}
+
+// Set icon for window
+void rl_SetWindowIcon(rl_Image image)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowIcon() not available on target platform");
+}
+
+// Set icon for window
+void rl_SetWindowIcons(rl_Image *images, int count)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowIcons() not available on target platform");
+}
+
+// Set title for window
+void rl_SetWindowTitle(const char *title)
+{
+    CORE.Window.title = title;
+}
+
+// Set window position on screen (windowed mode)
+void rl_SetWindowPosition(int x, int y)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowPosition() not available on target platform");
+}
+
+// Set monitor for the current window
+void rl_SetWindowMonitor(int monitor)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowMonitor() not available on target platform");
+}
+
+// Set window minimum dimensions (FLAG_WINDOW_RESIZABLE)
+void rl_SetWindowMinSize(int width, int height)
+{
+    CORE.Window.screenMin.width = width;
+    CORE.Window.screenMin.height = height;
+}
+
+// Set window maximum dimensions (FLAG_WINDOW_RESIZABLE)
+void rl_SetWindowMaxSize(int width, int height)
+{
+    CORE.Window.screenMax.width = width;
+    CORE.Window.screenMax.height = height;
+}
+
+// Set window dimensions
+// NOTE: Screen pbuffer surface is recreated, its content is lost
+void rl_SetWindowSize(int width, int height)
+{
+    if ((width <= 0) || (height <= 0)) return;
+
+    if (platform.surface != EGL_NO_SURFACE)
+    {
+        rlDrawRenderBatchActive();  // Draw pending batch into current surface before destroying it
+
+        eglMakeCurrent(platform.device, EGL_NO_SURFACE, EGL_NO_SURFACE, platform.context);
+        eglDestroySurface(platform.device, platform.surface);
+        platform.surface = EGL_NO_SURFACE;
+    }
+
+    if (!CreateScreenSurface(width, height) ||
+        (eglMakeCurrent(platform.device, platform.surface, platform.surface, platform.context) == EGL_FALSE))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to resize screen surface (%i x %i)", width, height);
+        return;
+    }
+
+    CORE.Window.screen.width = width;
+    CORE.Window.screen.height = height;
+    CORE.Window.currentFbo.width = width;
+    CORE.Window.currentFbo.height = height;
+    CORE.Window.resizedLastFrame = true;
+
+    // Reset viewport and projection matrix for new size
+    // NOTE: Stores current render size: CORE.Window.render
+    SetupViewport(width, height);
+}
+
+// Set window opacity, value opacity is between 0.0 and 1.0
+void rl_SetWindowOpacity(float opacity)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowOpacity() not available on target platform");
+}
+
+// Set window focused
+void rl_SetWindowFocused(void)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowFocused() not available on target platform");
+}
+
+// Set memory the screen is rendered into
+void rl_SetWindowFramebuffer(void *pixels)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowFramebuffer() not available on target platform");
+}
+
+// Get native window handle
+// NOTE: Current thread EGL context (EGLContext)
+void *rl_GetWindowHandle(void)
+{
+    return (void *)platform.context;
+}
+
+// Get number of monitors
+int rl_GetMonitorCount(void)
+{
+    return 0;
+}
+
+// Get current monitor where window is placed
+int rl_GetCurrentMonitor(void)
+{
+    return 0;
+}
+
+// Get selected monitor position
+rl_Vector2 rl_GetMonitorPosition(int monitor)
+{
+    TRACELOG(LOG_WARNING, "rl_GetMonitorPosition() not available on target platform");
+    return (rl_Vector2){ 0, 0 };
+}
+
+// Get selected monitor width (currently used by monitor)
+int rl_GetMonitorWidth(int monitor)
+{
+    TRACELOG(LOG_WARNING, "rl_GetMonitorWidth() not available on target platform");
+    return 0;
+}
+
+// Get selected monitor height (currently used by monitor)
+int rl_GetMonitorHeight(int monitor)
+{
+    TRACELOG(LOG_WARNING, "rl_GetMonitorHeight() not available on target platform");
+    return 0;
+}
+
+// Get selected monitor physical width in millimetres
+int rl_GetMonitorPhysicalWidth(int monitor)
+{
+    TRACELOG(LOG_WARNING, "rl_GetMonitorPhysicalWidth() not available on target platform");
+    return 0;
+}
+
+// Get selected monitor physical height in millimetres
+int rl_GetMonitorPhysicalHeight(int monitor)
+{
+    TRACELOG(LOG_WARNING, "rl_GetMonitorPhysicalHeight() not available on target platform");
+    return 0;
+}
+
+// Get selected monitor refresh rate
+int rl_GetMonitorRefreshRate(int monitor)
+{
+    TRACELOG(LOG_WARNING, "rl_GetMonitorRefreshRate() not available on target platform");
+    return 0;
+}
+
+// Get the human-readable, UTF-8 encoded name of the selected monitor
+const char *rl_GetMonitorName(int monitor)
+{
+    TRACELOG(LOG_WARNING, "rl_GetMonitorName() not available on target platform");
+    return "";
+}
+
+// Get window position XY on monitor
+rl_Vector2 rl_GetWindowPosition(void)
+{
+    return (rl_Vector2){ 0, 0 };
+}
+
+// Get window scale DPI factor for current monitor
+rl_Vector2 rl_GetWindowScaleDPI(void)
+{
+    return (rl_Vector2){ 1.0f, 1.0f };
+}
+
+// Set clipboard text content
+void rl_SetClipboardText(const char *text)
+{
+    TRACELOG(LOG_WARNING, "rl_SetClipboardText() not available on target platform");
+}
+
+// Get clipboard text content
+const char *rl_GetClipboardText(void)
+{
+    TRACELOG(LOG_WARNING, "rl_GetClipboardText() not available on target platform");
+    return NULL;
+}
+
+// Get clipboard image
+rl_Image rl_GetClipboardImage(void)
+{
+    rl_Image image = { 0 };
+
+    TRACELOG(LOG_WARNING, "rl_GetClipboardImage() not available on target platform");
+
+    return image;
+}
+
+// Show mouse cursor
+void rl_ShowCursor(void)
+{
+    CORE.Input.Mouse.cursorHidden = false;
+}
+
+// Hides mouse cursor
+void rl_HideCursor(void)
+{
+    CORE.Input.Mouse.cursorHidden = true;
+}
+
+// Enables cursor (unlock cursor)
+void rl_EnableCursor(void)
+{
+    // Set cursor position in the middle
+    rl_SetMousePosition(CORE.Window.screen.width/2, CORE.Window.screen.height/2);
+
+    CORE.Input.Mouse.cursorHidden = false;
+}
+
+// Disables cursor (lock cursor)
+void rl_DisableCursor(void)
+{
+    // Set cursor position in the middle
+    rl_SetMousePosition(CORE.Window.screen.width/2, CORE.Window.screen.height/2);
+
+    CORE.Input.Mouse.cursorHidden = true;
+}
+
+// Swap back buffer with front buffer (screen drawing)
+// NOTE: Pbuffer surfaces are single buffered, commands are just flushed to the GPU,
+// so async readbacks and other fenced operations progress without any wait
+void rl_SwapScreenBuffer(void)
+{
+    glFlush();
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Misc
+//----------------------------------------------------------------------------------
+
+// Get elapsed time measure in seconds since InitTimer()
+double rl_GetTime(void)
+{
+    double time = 0.0;
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    unsigned long long int nanoSeconds = (unsigned long long int)ts.tv_sec*1000000000LLU + (unsigned long long int)ts.tv_nsec;
+
+    time = (double)(nanoSeconds - CORE.Time.base)*1e-9;  // Elapsed time since InitTimer()
+
+    return time;
+}
+
+// Open URL with default system browser (if available)
+void rl_OpenURL(const char *url)
+{
+    TRACELOG(LOG_WARNING, "rl_OpenURL() not available on target platform");
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Inputs
+//----------------------------------------------------------------------------------
+
+// Set internal gamepad mappings
+int rl_SetGamepadMappings(const char *mappings)
+{
+    TRACELOG(LOG_WARNING, "rl_SetGamepadMappings() not available on target platform");
+    return 0;
+}
+
+// Set gamepad vibration
+void rl_SetGamepadVibration(int gamepad, float leftMotor, float rightMotor, float duration)
+{
+    TRACELOG(LOG_WARNING, "rl_SetGamepadVibration() not available on target platform");
+}
+
+// Set mouse position XY
+void rl_SetMousePosition(int x, int y)
+{
+    CORE.Input.Mouse.currentPosition = (rl_Vector2){ (float)x, (float)y };
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+}
+
+// Set mouse cursor
+void rl_SetMouseCursor(int cursor)
+{
+    TRACELOG(LOG_WARNING, "rl_SetMouseCursor() not available on target platform");
+}
+
+// Get physical key name
+const char *rl_GetKeyName(int key)
+{
+    TRACELOG(LOG_WARNING, "rl_GetKeyName() not available on target platform");
+    return "";
+}
+
+// Register all input events
+// NOTE: There are no input devices, only frame states are reset,
+// inputs could still be injected with automation events
+void rl_PollInputEvents(void)
+{
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    // NOTE: Gestures update must be called every frame to reset gestures correctly
+    // because ProcessGestureEvent() is just called on an event, not every frame
+    UpdateGestures();
+#endif
+
+    // Reset keys/chars pressed registered
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+
+    // Reset last gamepad button/axis registered state
+    CORE.Input.Gamepad.lastButtonPressed = 0; // GAMEPAD_BUTTON_UNKNOWN
+
+    // Register previous touch states
+    for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
+
+    // Register previous keys states
+    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+    {
+        CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+        CORE.Input.Keyboard.keyRepeatInFrame[i] = 0;
+    }
+
+    // Register previous mouse states
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (rl_Vector2){ 0.0f, 0.0f };
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+
+    CORE.Window.resizedLastFrame = false;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Initialize platform: graphics, inputs and more
+int InitPlatform(void)
+{
+    // Headless platform requires a hardware renderer, software renderer is available on PLATFORM_MEMORY
+    if (rlGetVersion() == RL_OPENGL_11_SOFTWARE)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Headless platform requires a hardware renderer, use PLATFORM_MEMORY for software renderer");
+        TRACELOG(LOG_FATAL, "PLATFORM: Failed to initialize graphics device");
+        return -1;
+    }
+
+    FLAG_SET(CORE.Window.flags, FLAG_WINDOW_HIDDEN);    // No window is ever shown
+
+    // Initialize EGL display, shared by all contexts
+    //----------------------------------------------------------------------------
+    pthread_mutex_lock(&headless.lock);
+
+    if (headless.display == EGL_NO_DISPLAY)
+    {
+        EGLDisplay display = GetHeadlessDisplay();
+
+        if ((display != EGL_NO_DISPLAY) && (eglInitialize(display, NULL, NULL) != EGL_FALSE))
+        {
+            headless.display = display;
+            TRACELOG(LOG_INFO, "DISPLAY: EGL %s (%s) initialized successfully", eglQueryString(display, EGL_VERSION), eglQueryString(display, EGL_VENDOR));
+        }
+    }
+
+    if (headless.display != EGL_NO_DISPLAY) headless.contexts++;
+    platform.device = headless.display;
+
+    pthread_mutex_unlock(&headless.lock);
+
+    if (platform.device == EGL_NO_DISPLAY)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to initialize EGL display");
+        TRACELOG(LOG_FATAL, "PLATFORM: Failed to initialize graphics device");
+        return -1;
+    }
+    //----------------------------------------------------------------------------
+
+    // Choose graphic context API and version
+    //----------------------------------------------------------------------------
+    EGLenum api = EGL_OPENGL_API;
+    EGLint renderableType = EGL_OPENGL_BIT;
+    EGLint contextAttribs[16] = { 0 };
+    int attribCount = 0;
+
+    switch (rlGetVersion())
+    {
+        case RL_OPENGL_21:
+        {
+            contextAttribs[attribCount++] = EGL_CONTEXT_MAJOR_VERSION_KHR; contextAttribs[attribCount++] = 2;
+            contextAttribs[attribCount++] = EGL_CONTEXT_MINOR_VERSION_KHR; contextAttribs[attribCount++] = 1;
+        } break;
+        case RL_OPENGL_33:
+        case RL_OPENGL_43:
+        {
+            contextAttribs[attribCount++] = EGL_CONTEXT_MAJOR_VERSION_KHR; contextAttribs[attribCount++] = (rlGetVersion() == RL_OPENGL_43)? 4 : 3;
+            contextAttribs[attribCount++] = EGL_CONTEXT_MINOR_VERSION_KHR; contextAttribs[attribCount++] = 3;
+            contextAttribs[attribCount++] = EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR; contextAttribs[attribCount++] = EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR;
+#if defined(RLGL_ENABLE_OPENGL_DEBUG_CONTEXT)
+            if (rlGetVersion() == RL_OPENGL_43) { contextAttribs[attribCount++] = EGL_CONTEXT_FLAGS_KHR; contextAttribs[attribCount++] = EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR; }
+#endif
+        } break;
+        case RL_OPENGL_ES_20:
+        case RL_OPENGL_ES_30:
+        {
+            api = EGL_OPENGL_ES_API;
+            renderableType = (rlGetVersion() == RL_OPENGL_ES_30)? EGL_OPENGL_ES3_BIT_KHR : EGL_OPENGL_ES2_BIT;
+            contextAttribs[attribCount++] = EGL_CONTEXT_CLIENT_VERSION; contextAttribs[attribCount++] = (rlGetVersion() == RL_OPENGL_ES_30)? 3 : 2;
+        } break;
+        default: break;     // OpenGL 1.1, compatibility context
+    }
+
+    contextAttribs[attribCount] = EGL_NONE;
+    //----------------------------------------------------------------------------
+
+    // Choose framebuffer config and create graphic context
+    //----------------------------------------------------------------------------
+    EGLint samples = 0;
+    EGLint sampleBuffer = 0;
+    if (FLAG_IS_SET(CORE.Window.flags, FLAG_MSAA_4X_HINT))
+    {
+        samples = 4;
+        sampleBuffer = 1;
+        TRACELOG(LOG_INFO, "DISPLAY: Trying to enable MSAA x4");
+    }
+
+    const EGLint framebufferAttribs[] = {
+        EGL_RENDERABLE_TYPE, renderableType, // Type of context support
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,  // Offscreen surface
+        EGL_RED_SIZE, 8,            // rl_RED color bit depth
+        EGL_GREEN_SIZE, 8,          // rl_GREEN color bit depth
+        EGL_BLUE_SIZE, 8,           // rl_BLUE color bit depth
+        EGL_ALPHA_SIZE, 8,          // ALPHA bit depth (required for transparent framebuffer)
+        EGL_DEPTH_SIZE, 24,         // Depth buffer size (Required to use Depth testing!)
+        //EGL_STENCIL_SIZE, 8,      // Stencil buffer size
+        EGL_SAMPLE_BUFFERS, sampleBuffer, // Activate MSAA
+        EGL_SAMPLES, samples,       // 4x Antialiasing if activated
+        EGL_NONE
+    };
+
+    EGLint numConfigs = 0;
+    if ((eglChooseConfig(platform.device, framebufferAttribs, &platform.config, 1, &numConfigs) == EGL_FALSE) || (numConfigs == 0))
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to choose first EGL configuration");
+        ClosePlatform();
+        return -1;
+    }
+
+    eglBindAPI(api);
+
+    platform.context = eglCreateContext(platform.device, platform.config, EGL_NO_CONTEXT, contextAttribs);
+    if (platform.context == EGL_NO_CONTEXT)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create EGL context (0x%x)", eglGetError());
+        ClosePlatform();
+        return -1;
+    }
+    //----------------------------------------------------------------------------
+
+    // Create screen surface and make context current on calling thread
+    //----------------------------------------------------------------------------
+    if (!CreateScreenSurface(CORE.Window.screen.width, CORE.Window.screen.height) ||
+        (eglMakeCurrent(platform.device, platform.surface, platform.surface, platform.context) == EGL_FALSE))
+    {
+        TRACELOG(LOG_FATAL, "PLATFORM: Failed to initialize graphics device");
+        ClosePlatform();
+        return -1;
+    }
+
+    CORE.Window.display.width = CORE.Window.screen.width;
+    CORE.Window.display.height = CORE.Window.screen.height;
+    CORE.Window.render.width = CORE.Window.screen.width;
+    CORE.Window.render.height = CORE.Window.screen.height;
+    CORE.Window.currentFbo.width = CORE.Window.render.width;
+    CORE.Window.currentFbo.height = CORE.Window.render.height;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Device initialized successfully");
+    TRACELOG(LOG_INFO, "    > Display size: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
+    TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+    TRACELOG(LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
+    TRACELOG(LOG_INFO, "    > Viewport offsets: %i, %i", CORE.Window.renderOffset.x, CORE.Window.renderOffset.y);
+
+    CORE.Window.ready = true;
+    //----------------------------------------------------------------------------
+
+    // Load OpenGL extensions
+    // NOTE: GL procedures address loader is required to load extensions,
+    // functions pointers are shared by all contexts, loading is serialized
+    //----------------------------------------------------------------------------
+    pthread_mutex_lock(&headless.lock);
+    rlLoadExtensions(eglGetProcAddress);
+    pthread_mutex_unlock(&headless.lock);
+    //----------------------------------------------------------------------------
+
+    // Initialize timing system
+    //----------------------------------------------------------------------------
+    InitTimer();
+    //----------------------------------------------------------------------------
+
+    // Initialize storage system
+    //----------------------------------------------------------------------------
+    CORE.Storage.basePath = rl_GetWorkingDirectory();
+    //----------------------------------------------------------------------------
+
+    TRACELOG(LOG_INFO, "PLATFORM: HEADLESS: Initialized successfully");
+
+    return 0;
+}
+
+// Close platform
+void ClosePlatform(void)
+{
+    if (platform.device == EGL_NO_DISPLAY) return;
+
+    eglMakeCurrent(platform.device, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+    if (platform.surface != EGL_NO_SURFACE)
+    {
+        eglDestroySurface(platform.device, platform.surface);
+        platform.surface = EGL_NO_SURFACE;
+    }
+
+    if (platform.context != EGL_NO_CONTEXT)
+    {
+        eglDestroyContext(platform.device, platform.context);
+        platform.context = EGL_NO_CONTEXT;
+    }
+
+    eglReleaseThread();
+
+    // Terminate shared display when last context is closed
+    pthread_mutex_lock(&headless.lock);
+
+    headless.contexts--;
+    if (headless.contexts == 0)
+    {
+        eglTerminate(headless.display);
+        headless.display = EGL_NO_DISPLAY;
+    }
+
+    pthread_mutex_unlock(&headless.lock);
+
+    platform.device = EGL_NO_DISPLAY;
+}
+
+// Get EGL display available without windowing system
+// NOTE: Device platform hardware devices are preferred, software devices are left to surfaceless platform
+static EGLDisplay GetHeadlessDisplay(void)
+{
+    EGLDisplay display = EGL_NO_DISPLAY;
+
+    // Client extensions are only available with EGL_EXT_client_extensions, NULL otherwise
+    const char *eglClientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+    if ((eglClientExtensions != NULL) && (eglGetPlatformDisplayEXT != NULL))
+    {
+        // Try device platform, GPU used directly without any windowing system (EGL_EXT_platform_device)
+        if ((strstr(eglClientExtensions, "EGL_EXT_platform_device") != NULL) && (strstr(eglClientExtensions, "EGL_EXT_device_enumeration") != NULL))
+        {
+            PFNEGLQUERYDEVICESEXTPROC eglQueryDevicesEXT = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+            PFNEGLQUERYDEVICESTRINGEXTPROC eglQueryDeviceStringEXT = (PFNEGLQUERYDEVICESTRINGEXTPROC)eglGetProcAddress("eglQueryDeviceStringEXT");
+
+            EGLDeviceEXT devices[MAX_EGL_DEVICES] = { 0 };
+            EGLint deviceCount = 0;
+
+            if ((eglQueryDevicesEXT != NULL) && (eglQueryDevicesEXT(MAX_EGL_DEVICES, devices, &deviceCount) != EGL_FALSE))
+            {
+                for (int i = 0; (i < deviceCount) && (display == EGL_NO_DISPLAY); i++)
+                {
+                    const char *deviceExtensions = (eglQueryDeviceStringEXT != NULL)? eglQueryDeviceStringEXT(devices[i], EGL_EXTENSIONS) : NULL;
+
+                    // Skip software rasterizer devices
+                    if ((deviceExtensions != NULL) && (strstr(deviceExtensions, "EGL_MESA_device_software") != NULL)) continue;
+
+                    display = eglGetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, devices[i], NULL);
+
+                    if (display != EGL_NO_DISPLAY)
+                    {
+                        const char *deviceFile = ((deviceExtensions != NULL) && (strstr(deviceExtensions, "EGL_EXT_device_drm") != NULL))?
+                            eglQueryDeviceStringEXT(devices[i], EGL_DRM_DEVICE_FILE_EXT) : NULL;
+                        TRACELOG(LOG_INFO, "DISPLAY: Using EGL device platform (device %i: %s)", i, (deviceFile != NULL)? deviceFile : "unknown");
+                    }
+                }
+            }
+        }
+
+        // Try surfaceless platform, driver selects the device (EGL_MESA_platform_surfaceless)
+        if ((display == EGL_NO_DISPLAY) && (strstr(eglClientExtensions, "EGL_MESA_platform_surfaceless") != NULL))
+        {
+            display = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+            if (display != EGL_NO_DISPLAY) TRACELOG(LOG_INFO, "DISPLAY: Using EGL surfaceless platform");
+        }
+    }
+
+    // In case extensions not found or display could not be retrieved, try default display
+    if (display == EGL_NO_DISPLAY)
+    {
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        if (display != EGL_NO_DISPLAY) TRACELOG(LOG_INFO, "DISPLAY: Using EGL default display");
+    }
+
+    return display;
+}
+
+// Create pbuffer surface used as screen framebuffer
+static bool CreateScreenSurface(int width, int height)
+{
+    const EGLint surfaceAttribs[] = {
+        EGL_WIDTH, width,
+        EGL_HEIGHT, height,
+        EGL_NONE
+    };
+
+    platform.surface = eglCreatePbufferSurface(platform.device, platform.config, surfaceAttribs);
+
+    if (platform.surface == EGL_NO_SURFACE)
+    {
+        TRACELOG(LOG_WARNING, "DISPLAY: Failed to create EGL pbuffer surface (0x%x)", eglGetError());
+        return false;
+    }
+
+    return true;
+}
+
+// EOF
@@ -66,7 +66,9 @@ __declspec(dllimport) int __stdcall QueryPerformanceFrequency(LARGE_INTEGER *lpF
 #endif
 
 typedef struct {
-    unsigned int *pixels;   // Pointer to pixel data buffer (RGBA8888 format)
+    unsigned int *pixels;   // Pointer to pixel data buffer (RGBA8888 format), internal or user memory
+    unsigned int *buffer;   // Internal pixel data buffer
+    bool pixelsBound;       // Software renderer draws directly into pixel data buffer
 #if defined(_WIN32)
     LARGE_INTEGER timerFrequency;
 #endif
@@ -213,11 +215,20 @@ void rl_SetWindowFocused(void)
     TRACELOG(LOG_WARNING, "rl_SetWindowFocused() not available on target platform");
 }
 
+// Set memory the screen is rendered into
+// NOTE: Memory must fit screen size in R8G8B8A8 format, NULL restores internal memory,
+// it takes effect on next rl_EndDrawing(), current frame is copied into it
+void rl_SetWindowFramebuffer(void *pixels)
+{
+    platform.pixels = (pixels != NULL)? (unsigned int *)pixels : platform.buffer;
+    platform.pixelsBound = false;
+}
+
 // Get native window handle
+// NOTE: Memory framebuffer pixel data (R8G8B8A8), valid after rl_EndDrawing() until next frame drawing
 void *rl_GetWindowHandle(void)
 {
-    TRACELOG(LOG_WARNING, "rl_GetWindowHandle() not implemented on target platform");
-    return NULL;
+    return (void *)platform.pixels;
 }
 
 // Get number of monitors
@@ -355,7 +366,15 @@ void rl_DisableCursor(void)
 void rl_SwapScreenBuffer(void)
 {
     // Update framebuffer
+    // NOTE: Copy is skipped by the software renderer if it is already rendering into framebuffer,
+    // framebuffer modified region is not reset, so applications presenting the framebuffer pixels on
+    // slow displays can update only that region, see rlGetFramebufferDirtyRegion()
     rlCopyFramebuffer(0, 0, CORE.Window.render.width, CORE.Window.render.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, platform.pixels);
+
+#if (SW_COLOR_BUFFER_BITS == 32)
+    // Next frames are rendered directly into framebuffer, no copy required
+    if (!platform.pixelsBound) platform.pixelsBound = rlSetFramebufferMemory(platform.pixels, CORE.Window.render.width*4);
+#endif
 }
 
 //----------------------------------------------------------------------------------
@@ -498,7 +517,9 @@ int InitPlatform(void)
     else
     {
         // Load memory framebuffer with desired screen size
-        platform.pixels = (unsigned int *)RL_CALLOC(CORE.Window.screen.width*CORE.Window.screen.height, sizeof(int));
+        platform.buffer = (unsigned int *)RL_CALLOC(CORE.Window.screen.width*CORE.Window.screen.height, sizeof(int));
+        platform.pixels = platform.buffer;
+        platform.pixelsBound = false;
     }
     //----------------------------------------------------------------------------
 
@@ -554,7 +575,10 @@ int InitPlatform(void)
 // Close platform
 void ClosePlatform(void)
 {
-    RL_FREE(platform.pixels);
+    RL_FREE(platform.buffer);
+    platform.buffer = NULL;
+    platform.pixels = NULL;
+    platform.pixelsBound = false;
 }
 
 //----------------------------------------------------------------------------------
@@ -189,6 +189,12 @@ void rl_SetWindowFocused(void)
     TRACELOG(LOG_WARNING, "rl_SetWindowFocused() not available on target platform");
 }
 
+// Set memory the screen is rendered into
+void rl_SetWindowFramebuffer(void *pixels)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowFramebuffer() not available on target platform");
+}
+
 // Get native window handle
 void *rl_GetWindowHandle(void)
 {
@@ -701,6 +701,12 @@ void rl_SetWindowFocused(void)
     TRACELOG(LOG_WARNING, "rl_SetWindowFocused() not available on target platform");
 }
 
+// Set memory the screen is rendered into
+void rl_SetWindowFramebuffer(void *pixels)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowFramebuffer() not available on target platform");
+}
+
 // Get native window handle
 void *rl_GetWindowHandle(void)
 {
@@ -1526,6 +1532,8 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode, int action, i
     else if (action == GLFW_PRESS) CORE.Input.Keyboard.currentKeyState[key] = 1;
     else if (action == GLFW_REPEAT) CORE.Input.Keyboard.keyRepeatInFrame[key] = 1;
 
+    PushInputEvent((action == GLFW_RELEASE)? INPUT_EVENT_KEY_RELEASED : ((action == GLFW_PRESS)? INPUT_EVENT_KEY_PRESSED : INPUT_EVENT_KEY_REPEAT), 0, key, 0.0f, 0.0f);
+
     // Check if there is space available in the key queue
     if ((CORE.Input.Keyboard.keyPressedQueueCount < MAX_KEY_PRESSED_QUEUE) && (action == GLFW_PRESS))
     {
@@ -1548,6 +1556,8 @@ static void CharCallback(GLFWwindow *window, unsigned int key)
     // REF: https://github.com/glfw/glfw/issues/668#issuecomment-166794907
     // REF: https://www.glfw.org/docs/latest/input_guide.html#input_char
 
+    PushInputEvent(INPUT_EVENT_CHAR, 0, (int)key, 0.0f, 0.0f);
+
     // Check if there is space available in the queue
     if (CORE.Input.Keyboard.charPressedQueueCount < MAX_CHAR_PRESSED_QUEUE)
     {
@@ -1565,6 +1575,8 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action, int
     CORE.Input.Mouse.currentButtonState[button] = action;
     CORE.Input.Touch.currentTouchState[button] = action;
 
+    PushInputEvent((action == GLFW_PRESS)? INPUT_EVENT_MOUSE_BUTTON_PRESSED : INPUT_EVENT_MOUSE_BUTTON_RELEASED, 0, button, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
+
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
     // Process mouse events as touches to be able to use mouse-gestures
     GestureEvent gestureEvent = { 0 };
@@ -1604,6 +1616,8 @@ static void MouseMoveCallback(GLFWwindow *window, double x, double y)
         CORE.Input.Mouse.currentPosition.x = (float)x;
         CORE.Input.Mouse.currentPosition.y = (float)y;
         CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
+
+        PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, (float)x, (float)y);
     }
 
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
@@ -1634,6 +1648,8 @@ static void MouseMoveCallback(GLFWwindow *window, double x, double y)
 static void MouseScrollCallback(GLFWwindow *window, double xoffset, double yoffset)
 {
     CORE.Input.Mouse.currentWheelMove = (rl_Vector2){ (float)xoffset, (float)yoffset };
+
+    PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, (float)xoffset, (float)yoffset);
 }
 
 // GLFW3: Called on mouse entering the window
@@ -1740,6 +1756,13 @@ static EM_BOOL EmscriptenTouchCallback(int eventType, const EmscriptenTouchEvent
 
         if (eventType == EMSCRIPTEN_EVENT_TOUCHSTART) CORE.Input.Touch.currentTouchState[i] = 1;
         else if (eventType == EMSCRIPTEN_EVENT_TOUCHEND) CORE.Input.Touch.currentTouchState[i] = 0;
+
+        if (touchEvent->touches[i].isChanged)
+        {
+            int touchEventType = (eventType == EMSCRIPTEN_EVENT_TOUCHSTART)? INPUT_EVENT_TOUCH_DOWN :
+                (((eventType == EMSCRIPTEN_EVENT_TOUCHEND) || (eventType == EMSCRIPTEN_EVENT_TOUCHCANCEL))? INPUT_EVENT_TOUCH_UP : INPUT_EVENT_TOUCH_MOVE);
+            PushInputEvent(touchEventType, CORE.Input.Touch.pointId[i], 0, CORE.Input.Touch.position[i].x, CORE.Input.Touch.position[i].y);
+        }
     }
 
     // Update mouse position if we detect a single touch
@@ -13,10 +13,14 @@
 *
 *   ADDITIONAL NOTES:
 *       - TRACELOG() function is located in raylib [utils] module
+*       - Browser DOM is only accessed from browser main thread (MAIN_THREAD_EM_ASM), required by render worker
 *
 *   CONFIGURATION:
-*       #define RCORE_PLATFORM_CUSTOM_FLAG
-*           Custom flag for rcore on target platform -not used-
+*       #define SUPPORT_WEB_RENDER_WORKER
+*           Run raylib on a Web Worker rendering to an OffscreenCanvas, browser main thread is kept free,
+*           input events are forwarded from main thread and frames are paced by requestAnimationFrame
+*           NOTE: Program must be linked with: -pthread -sPROXY_TO_PTHREAD -sOFFSCREENCANVAS_SUPPORT
+*           and use emscripten_set_main_loop(), ASYNCIFY is not required (blocking main loops are not supported)
 *
 *   DEPENDENCIES:
 *       - emscripten: Allow interaction between browser API and C
@@ -46,6 +50,9 @@
 
 #include <emscripten/emscripten.h>      // Emscripten functionality for C
 #include <emscripten/html5.h>           // Emscripten HTML5 library
+#if defined(SUPPORT_WEB_RENDER_WORKER)
+    #include <emscripten/threading.h>   // Required for: emscripten_is_main_browser_thread()
+#endif
 
 #include <sys/time.h>   // Required for: timespec, nanosleep(), select() - POSIX
 
@@ -113,12 +120,6 @@ static EM_BOOL EmscriptenPointerlockCallback(int eventType, const EmscriptenPoin
 static EM_BOOL EmscriptenTouchCallback(int eventType, const EmscriptenTouchEvent *touchEvent, void *userData);
 static EM_BOOL EmscriptenGamepadCallback(int eventType, const EmscriptenGamepadEvent *gamepadEvent, void *userData);
 
-// JS: Set the canvas id provided by the module configuration
-EM_JS(void, SetCanvasIdJs, (char *out, int outSize), {
-    var canvasId = "#" + Module.canvas.id;
-    stringToUTF8(canvasId, out, outSize);
-});
-
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
@@ -133,6 +134,11 @@ EM_JS(void, SetCanvasIdJs, (char *out, int outSize), {
 // Sleep is handled in rl_EndDrawing() for synchronous code
 bool rl_WindowShouldClose(void)
 {
+#if defined(SUPPORT_WEB_RENDER_WORKER)
+    // NOTE: Render worker frames are only presented when worker returns control to browser,
+    // emscripten_set_main_loop() must be used, paced by requestAnimationFrame on worker
+    return false;
+#else
     // Emscripten Asyncify is required to run synchronous code in asynchronous JS
     // REF: https://emscripten.org/docs/porting/asyncify.html
 
@@ -145,6 +151,7 @@ bool rl_WindowShouldClose(void)
     emscripten_sleep(12);
 
     return false;
+#endif
 }
 
 // Toggle fullscreen mode
@@ -152,20 +159,20 @@ void rl_ToggleFullscreen(void)
 {
     bool enterFullscreen = false;
 
-    const bool wasFullscreen = EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
+    const bool wasFullscreen = MAIN_THREAD_EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
     if (wasFullscreen)
     {
         if (FLAG_IS_SET(CORE.Window.flags, FLAG_FULLSCREEN_MODE)) enterFullscreen = false;
         else if (FLAG_IS_SET(CORE.Window.flags, FLAG_BORDERLESS_WINDOWED_MODE)) enterFullscreen = true;
         else
         {
-            const int canvasWidth = EM_ASM_INT( { return Module.canvas.width; }, 0);
-            const int canvasStyleWidth = EM_ASM_INT( { return parseInt(Module.canvas.style.width); }, 0);
+            const int canvasWidth = MAIN_THREAD_EM_ASM_INT( { return Module.canvas.width; }, 0);
+            const int canvasStyleWidth = MAIN_THREAD_EM_ASM_INT( { return parseInt(Module.canvas.style.width); }, 0);
             if (canvasStyleWidth > canvasWidth) enterFullscreen = false;
             else enterFullscreen = true;
         }
 
-        EM_ASM(document.exitFullscreen(););
+        MAIN_THREAD_EM_ASM(document.exitFullscreen(););
 
         FLAG_CLEAR(CORE.Window.flags, FLAG_FULLSCREEN_MODE);
         FLAG_CLEAR(CORE.Window.flags, FLAG_BORDERLESS_WINDOWED_MODE);
@@ -175,7 +182,7 @@ void rl_ToggleFullscreen(void)
     if (enterFullscreen)
     {
         // NOTE: The setTimeouts handle the browser mode change delay
-        EM_ASM
+        MAIN_THREAD_EM_ASM
         (
             setTimeout(function()
             {
@@ -188,7 +195,7 @@ void rl_ToggleFullscreen(void)
 
     // NOTE: Old notes below:
     /*
-        EM_ASM
+        MAIN_THREAD_EM_ASM
         (
             // This strategy works well while using raylib minimal web shell for emscripten,
             // it re-scales the canvas to fullscreen using monitor resolution, for tools this
@@ -198,7 +205,7 @@ void rl_ToggleFullscreen(void)
             else Module.requestFullscreen(true, true); //false, true);
         );
     */
-    // EM_ASM(Module.requestFullscreen(false, false););
+    // MAIN_THREAD_EM_ASM(Module.requestFullscreen(false, false););
     /*
         if (!FLAG_IS_SET(CORE.Window.flags, FLAG_FULLSCREEN_MODE))
         {
@@ -257,20 +264,20 @@ void rl_ToggleBorderlessWindowed(void)
 {
     bool enterBorderless = false;
 
-    const bool wasFullscreen = EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
+    const bool wasFullscreen = MAIN_THREAD_EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
     if (wasFullscreen)
     {
         if (FLAG_IS_SET(CORE.Window.flags, FLAG_BORDERLESS_WINDOWED_MODE)) enterBorderless = false;
         else if (FLAG_IS_SET(CORE.Window.flags, FLAG_FULLSCREEN_MODE)) enterBorderless = true;
         else
         {
-            const int canvasWidth = EM_ASM_INT( { return Module.canvas.width; }, 0);
-            const int screenWidth = EM_ASM_INT( { return screen.width; }, 0);
+            const int canvasWidth = MAIN_THREAD_EM_ASM_INT( { return Module.canvas.width; }, 0);
+            const int screenWidth = MAIN_THREAD_EM_ASM_INT( { return screen.width; }, 0);
             if (screenWidth == canvasWidth) enterBorderless = false;
             else enterBorderless = true;
         }
 
-        EM_ASM(document.exitFullscreen(););
+        MAIN_THREAD_EM_ASM(document.exitFullscreen(););
 
         FLAG_CLEAR(CORE.Window.flags, FLAG_FULLSCREEN_MODE);
         FLAG_CLEAR(CORE.Window.flags, FLAG_BORDERLESS_WINDOWED_MODE);
@@ -281,7 +288,7 @@ void rl_ToggleBorderlessWindowed(void)
     {
         // 1. The setTimeouts handle the browser mode change delay
         // 2. The style unset handles the possibility of a width="value%" like on the default shell.html file
-        EM_ASM
+        MAIN_THREAD_EM_ASM
         (
             setTimeout(function()
             {
@@ -301,8 +308,8 @@ void rl_MaximizeWindow(void)
 {
     if (FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_RESIZABLE) && !FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_MAXIMIZED))
     {
-        const int tabWidth = EM_ASM_INT( return window.innerWidth; );
-        const int tabHeight = EM_ASM_INT( return window.innerHeight; );
+        const int tabWidth = MAIN_THREAD_EM_ASM_INT( return window.innerWidth; );
+        const int tabHeight = MAIN_THREAD_EM_ASM_INT( return window.innerHeight; );
 
         FLAG_SET(CORE.Window.flags, FLAG_WINDOW_MAXIMIZED);
     }
@@ -341,11 +348,11 @@ void rl_SetWindowState(unsigned int flags)
     if (FLAG_IS_SET(flags, FLAG_BORDERLESS_WINDOWED_MODE))
     {
         // NOTE: Window state flag updated inside rl_ToggleBorderlessWindowed() function
-        const bool wasFullscreen = EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
+        const bool wasFullscreen = MAIN_THREAD_EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
         if (wasFullscreen)
         {
-            const int canvasWidth = EM_ASM_INT( { return Module.canvas.width; }, 0);
-            const int canvasStyleWidth = EM_ASM_INT( { return parseInt(Module.canvas.style.width); }, 0);
+            const int canvasWidth = MAIN_THREAD_EM_ASM_INT( { return Module.canvas.width; }, 0);
+            const int canvasStyleWidth = MAIN_THREAD_EM_ASM_INT( { return parseInt(Module.canvas.style.width); }, 0);
             if ((FLAG_IS_SET(CORE.Window.flags, FLAG_FULLSCREEN_MODE)) || canvasStyleWidth > canvasWidth) rl_ToggleBorderlessWindowed();
         }
         else rl_ToggleBorderlessWindowed();
@@ -355,11 +362,11 @@ void rl_SetWindowState(unsigned int flags)
     if (FLAG_IS_SET(flags, FLAG_FULLSCREEN_MODE))
     {
         // NOTE: Window state flag updated inside rl_ToggleFullscreen() function
-        const bool wasFullscreen = EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
+        const bool wasFullscreen = MAIN_THREAD_EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
         if (wasFullscreen)
         {
-            const int canvasWidth = EM_ASM_INT( { return Module.canvas.width; }, 0);
-            const int screenWidth = EM_ASM_INT( { return screen.width; }, 0);
+            const int canvasWidth = MAIN_THREAD_EM_ASM_INT( { return Module.canvas.width; }, 0);
+            const int screenWidth = MAIN_THREAD_EM_ASM_INT( { return screen.width; }, 0);
             if (FLAG_IS_SET(CORE.Window.flags, FLAG_BORDERLESS_WINDOWED_MODE) || (screenWidth == canvasWidth)) rl_ToggleFullscreen();
         }
         else rl_ToggleFullscreen();
@@ -394,8 +401,8 @@ void rl_SetWindowState(unsigned int flags)
     {
         if (FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_RESIZABLE))
         {
-            const int tabWidth = EM_ASM_INT( return window.innerWidth; );
-            const int tabHeight = EM_ASM_INT( return window.innerHeight; );
+            const int tabWidth = MAIN_THREAD_EM_ASM_INT( return window.innerWidth; );
+            const int tabHeight = MAIN_THREAD_EM_ASM_INT( return window.innerHeight; );
 
             FLAG_SET(CORE.Window.flags, FLAG_WINDOW_MAXIMIZED);
         }
@@ -468,12 +475,12 @@ void rl_ClearWindowState(unsigned int flags)
     // State change: FLAG_BORDERLESS_WINDOWED_MODE
     if (FLAG_IS_SET(flags, FLAG_BORDERLESS_WINDOWED_MODE))
     {
-        const bool wasFullscreen = EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
+        const bool wasFullscreen = MAIN_THREAD_EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
         if (wasFullscreen)
         {
-            const int canvasWidth = EM_ASM_INT( { return Module.canvas.width; }, 0);
-            const int screenWidth = EM_ASM_INT( { return screen.width; }, 0);
-            if (FLAG_IS_SET(CORE.Window.flags, FLAG_BORDERLESS_WINDOWED_MODE) || (screenWidth == canvasWidth)) EM_ASM(document.exitFullscreen(););
+            const int canvasWidth = MAIN_THREAD_EM_ASM_INT( { return Module.canvas.width; }, 0);
+            const int screenWidth = MAIN_THREAD_EM_ASM_INT( { return screen.width; }, 0);
+            if (FLAG_IS_SET(CORE.Window.flags, FLAG_BORDERLESS_WINDOWED_MODE) || (screenWidth == canvasWidth)) MAIN_THREAD_EM_ASM(document.exitFullscreen(););
         }
 
         FLAG_CLEAR(CORE.Window.flags, FLAG_BORDERLESS_WINDOWED_MODE);
@@ -482,12 +489,12 @@ void rl_ClearWindowState(unsigned int flags)
     // State change: FLAG_FULLSCREEN_MODE
     if (FLAG_IS_SET(flags, FLAG_FULLSCREEN_MODE))
     {
-        const bool wasFullscreen = EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
+        const bool wasFullscreen = MAIN_THREAD_EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
         if (wasFullscreen)
         {
-            const int canvasWidth = EM_ASM_INT( { return Module.canvas.width; }, 0);
-            const int canvasStyleWidth = EM_ASM_INT( { return parseInt(Module.canvas.style.width); }, 0);
-            if (FLAG_IS_SET(CORE.Window.flags, FLAG_FULLSCREEN_MODE) || (canvasStyleWidth > canvasWidth)) EM_ASM(document.exitFullscreen(););
+            const int canvasWidth = MAIN_THREAD_EM_ASM_INT( { return Module.canvas.width; }, 0);
+            const int canvasStyleWidth = MAIN_THREAD_EM_ASM_INT( { return parseInt(Module.canvas.style.width); }, 0);
+            if (FLAG_IS_SET(CORE.Window.flags, FLAG_FULLSCREEN_MODE) || (canvasStyleWidth > canvasWidth)) MAIN_THREAD_EM_ASM(document.exitFullscreen(););
         }
 
         FLAG_CLEAR(CORE.Window.flags, FLAG_FULLSCREEN_MODE);
@@ -652,8 +659,8 @@ void rl_SetWindowSize(int width, int height)
 
     // Set canvas CSS size
     // TODO: Consider canvas CSS style if already scaled 100%
-    EM_ASM({ Module.canvas.style.width = $0; }, width*dpr);
-    EM_ASM({ Module.canvas.style.height = $0; }, height*dpr);
+    MAIN_THREAD_EM_ASM({ Module.canvas.style.width = $0; }, width*dpr);
+    MAIN_THREAD_EM_ASM({ Module.canvas.style.height = $0; }, height*dpr);
 
     SetupViewport(width*dpr, height*dpr); // Reset viewport and projection matrix for new size
 }
@@ -664,7 +671,7 @@ void rl_SetWindowOpacity(float opacity)
     if (opacity >= 1.0f) opacity = 1.0f;
     else if (opacity <= 0.0f) opacity = 0.0f;
 
-    EM_ASM({ Module.canvas.style.opacity = $0; }, opacity);
+    MAIN_THREAD_EM_ASM({ Module.canvas.style.opacity = $0; }, opacity);
 }
 
 // Set window focused
@@ -673,6 +680,12 @@ void rl_SetWindowFocused(void)
     TRACELOG(LOG_WARNING, "rl_SetWindowFocused() not available on target platform");
 }
 
+// Set memory the screen is rendered into
+void rl_SetWindowFramebuffer(void *pixels)
+{
+    TRACELOG(LOG_WARNING, "rl_SetWindowFramebuffer() not available on target platform");
+}
+
 // Get native window handle
 void *rl_GetWindowHandle(void)
 {
@@ -708,7 +721,7 @@ int rl_GetMonitorWidth(int monitor)
     // no physical pixels, it would require multiplying by device pixel ratio
     // NOTE: Returned value is limited to the current monitor where the browser window is located
     int width = 0;
-    width = EM_ASM_INT( { return window.screen.width; }, 0);
+    width = MAIN_THREAD_EM_ASM_INT( { return window.screen.width; }, 0);
     return width;
 }
 
@@ -719,7 +732,7 @@ int rl_GetMonitorHeight(int monitor)
     // no physical pixels, it would require multiplying by device pixel ratio
     // NOTE: Returned value is limited to the current monitor where the browser window is located
     int height = 0;
-    height = EM_ASM_INT( { return window.screen.height; }, 0);
+    height = MAIN_THREAD_EM_ASM_INT( { return window.screen.height; }, 0);
     return height;
 }
 
@@ -757,8 +770,8 @@ rl_Vector2 rl_GetWindowPosition(void)
     // Browser window position, top-left corner relative to the physical screen origin, expressed in CSS logical pixels
     // NOTE: Returned position is relative to the current monitor where the browser window is located
     rl_Vector2 position = { 0, 0 };
-    position.x = (float)EM_ASM_INT( { return window.screenX; }, 0);
-    position.y = (float)EM_ASM_INT( { return window.screenY; }, 0);
+    position.x = (float)MAIN_THREAD_EM_ASM_INT( { return window.screenX; }, 0);
+    position.y = (float)MAIN_THREAD_EM_ASM_INT( { return window.screenY; }, 0);
     return position;
 }
 
@@ -768,7 +781,7 @@ rl_Vector2 rl_GetWindowScaleDPI(void)
     // Get device pixel ratio
     // NOTE: Returned scale is relative to the current monitor where the browser window is located
     rl_Vector2 scale = { 1.0f, 1.0f };
-    scale.x = (float)EM_ASM_DOUBLE( { return window.devicePixelRatio; } );
+    scale.x = (float)MAIN_THREAD_EM_ASM_DOUBLE( { return window.devicePixelRatio; } );
     scale.y = scale.x;
     return scale;
 }
@@ -778,7 +791,7 @@ void rl_SetClipboardText(const char *text)
 {
     // Security check to (partially) avoid malicious code
     if (strchr(text, '\'') != NULL) TRACELOG(LOG_WARNING, "SYSTEM: Provided Clipboard could be potentially malicious, avoid [\'] character");
-    else EM_ASM({ navigator.clipboard.writeText(UTF8ToString($0)); }, text);
+    else MAIN_THREAD_EM_ASM({ navigator.clipboard.writeText(UTF8ToString($0)); }, text);
 }
 
 // Get clipboard text content
@@ -820,7 +833,7 @@ void rl_ShowCursor(void)
 {
     if (CORE.Input.Mouse.cursorHidden)
     {
-        EM_ASM( { Module.canvas.style.cursor = UTF8ToString($0); }, cursorLUT[CORE.Input.Mouse.cursor]);
+        MAIN_THREAD_EM_ASM( { Module.canvas.style.cursor = UTF8ToString($0); }, cursorLUT[CORE.Input.Mouse.cursor]);
 
         CORE.Input.Mouse.cursorHidden = false;
     }
@@ -831,7 +844,7 @@ void rl_HideCursor(void)
 {
     if (!CORE.Input.Mouse.cursorHidden)
     {
-        EM_ASM(Module.canvas.style.cursor = 'none';);
+        MAIN_THREAD_EM_ASM(Module.canvas.style.cursor = 'none';);
 
         CORE.Input.Mouse.cursorHidden = true;
     }
@@ -867,7 +880,7 @@ void rl_SwapScreenBuffer(void)
     rlCopyFramebuffer(0, 0, CORE.Window.render.width, CORE.Window.render.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, platform.pixels);
 
     // Copy framebuffer data into canvas
-    EM_ASM({
+    MAIN_THREAD_EM_ASM({
         const width = $0;
         const height = $1;
         const ptr = $2;
@@ -903,7 +916,7 @@ double rl_GetTime(void)
     unsigned long long int nanoSeconds = (unsigned long long int)ts.tv_sec*1000000000LLU + (unsigned long long int)ts.tv_nsec;
     time = (double)(nanoSeconds - CORE.Time.base)*1e-9;  // Elapsed time since InitTimer()
     */
-    time = emscripten_get_now()*1000.0;
+    time = emscripten_get_now()/1000.0;    // Milliseconds to seconds
 
     return time;
 }
@@ -916,7 +929,7 @@ void rl_OpenURL(const char *url)
 {
     // Security check to (partially) avoid malicious code on target platform
     if (strchr(url, '\'') != NULL) TRACELOG(LOG_WARNING, "SYSTEM: Provided URL could be potentially malicious, avoid [\'] character");
-    else emscripten_run_script(rl_TextFormat("window.open('%s', '_blank')", url));
+    else MAIN_THREAD_EM_ASM({ window.open(UTF8ToString($0), '_blank'); }, url);
 }
 
 //----------------------------------------------------------------------------------
@@ -946,7 +959,7 @@ void rl_SetGamepadVibration(int gamepad, float leftMotor, float rightMotor, floa
         // NOTE: [2024.10.21] Current browser support:
         // - vibrationActuator API: Chrome, Edge, Opera, Safari, Android Chrome, Android Webview
         // - hapticActuators API: Firefox
-        EM_ASM({
+        MAIN_THREAD_EM_ASM({
             try { navigator.getGamepads()[$0].vibrationActuator.playEffect('dual-rumble', { startDelay: 0, duration: $3, weakMagnitude: $1, strongMagnitude: $2 }); }
             catch (e)
             {
@@ -968,7 +981,7 @@ void rl_SetMouseCursor(int cursor)
 {
     if (CORE.Input.Mouse.cursor != cursor)
     {
-        if (!CORE.Input.Mouse.cursorLocked) EM_ASM( { Module.canvas.style.cursor = UTF8ToString($0); }, cursorLUT[cursor]);
+        if (!CORE.Input.Mouse.cursorLocked) MAIN_THREAD_EM_ASM( { Module.canvas.style.cursor = UTF8ToString($0); }, cursorLUT[cursor]);
         CORE.Input.Mouse.cursor = cursor;
     }
 }
@@ -1099,7 +1112,18 @@ void rl_PollInputEvents(void)
 // Initialize platform: graphics, inputs and more
 int InitPlatform(void)
 {
-    SetCanvasIdJs(platform.canvasId, 64); // Get the current canvas id
+    // Get the current canvas id provided by the module configuration
+    MAIN_THREAD_EM_ASM({ stringToUTF8("#" + Module.canvas.id, $0, $1); }, platform.canvasId, 64);
+
+#if defined(SUPPORT_WEB_RENDER_WORKER)
+    if (emscripten_is_main_browser_thread()) TRACELOG(LOG_WARNING, "PLATFORM: WEB: Render worker running on browser main thread, link with -sPROXY_TO_PTHREAD");
+
+    if (rlGetVersion() == RL_OPENGL_11_SOFTWARE)
+    {
+        TRACELOG(LOG_FATAL, "PLATFORM: WEB: Software rendering not supported by render worker");
+        return -1;
+    }
+#endif
 
     // Initialize graphic device: display/window and graphic context
     //----------------------------------------------------------------------------
@@ -1110,6 +1134,12 @@ int InitPlatform(void)
     attribs.depth = EM_TRUE;
     attribs.stencil = EM_FALSE;
     attribs.antialias = EM_FALSE;
+#if defined(SUPPORT_WEB_RENDER_WORKER)
+    // Context is created on worker owning the OffscreenCanvas (transferred by -sOFFSCREENCANVAS_SUPPORT),
+    // GL calls are not proxied to browser main thread and frames are presented when worker yields
+    attribs.proxyContextToMainThread = EMSCRIPTEN_WEBGL_CONTEXT_PROXY_DISALLOW;
+    attribs.renderViaOffscreenBackBuffer = EM_FALSE;
+#endif
 
     // Check window creation flags
     // Disable FLAG_WINDOW_MINIMIZED, not supported
@@ -1133,7 +1163,7 @@ int InitPlatform(void)
     {
         // Avoid creating a WebGL canvas, create 2d canvas for software rendering
         emscripten_set_canvas_element_size(platform.canvasId, CORE.Window.screen.width, CORE.Window.screen.height);
-        EM_ASM({
+        MAIN_THREAD_EM_ASM({
             const canvas = document.getElementById(platform.canvasId);
             Module.canvas = canvas;
         });
@@ -1248,7 +1278,12 @@ int InitPlatform(void)
     CORE.Storage.basePath = rl_GetWorkingDirectory();
     //----------------------------------------------------------------------------
 
+#if defined(SUPPORT_WEB_RENDER_WORKER)
+    // NOTE: Events callbacks are registered from worker thread, browser main thread forwards events to it
+    TRACELOG(LOG_INFO, "PLATFORM: WEB: Initialized successfully (render worker)");
+#else
     TRACELOG(LOG_INFO, "PLATFORM: WEB: Initialized successfully");
+#endif
 
     return 0;
 }
@@ -1287,8 +1322,8 @@ static EM_BOOL EmscriptenResizeCallback(int eventType, const EmscriptenUiEvent *
 */
     // This event is called whenever the window changes sizes,
     // so the size of the canvas object is explicitly retrieved below
-    int width = EM_ASM_INT( return window.innerWidth; );
-    int height = EM_ASM_INT( return window.innerHeight; );
+    int width = MAIN_THREAD_EM_ASM_INT( return window.innerWidth; );
+    int height = MAIN_THREAD_EM_ASM_INT( return window.innerHeight; );
 
     if (width < (int)CORE.Window.screenMin.width) width = CORE.Window.screenMin.width;
     else if ((width > (int)CORE.Window.screenMax.width) && (CORE.Window.screenMax.width > 0)) width = CORE.Window.screenMax.width;
@@ -1344,7 +1379,7 @@ static EM_BOOL EmscriptenVisibilityChangeCallback(int eventType, const Emscripte
 static EM_BOOL EmscriptenFullscreenChangeCallback(int eventType, const EmscriptenFullscreenChangeEvent *event, void *userData)
 {
     // NOTE: Reset the fullscreen flags if the user left fullscreen manually by pressing the Escape key
-    const bool wasFullscreen = EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
+    const bool wasFullscreen = MAIN_THREAD_EM_ASM_INT( { if (document.fullscreenElement) return 1; }, 0);
     if (!wasFullscreen)
     {
         FLAG_CLEAR(CORE.Window.flags, FLAG_FULLSCREEN_MODE);
@@ -1393,15 +1428,21 @@ static EM_BOOL EmscriptenKeyboardCallback(int eventType, const EmscriptenKeyboar
     {
         case EMSCRIPTEN_EVENT_KEYPRESS:
         {
-            if (keyboardEvent->repeat) CORE.Input.Keyboard.keyRepeatInFrame[keyboardEvent->keyCode] = 1;
+            if (keyboardEvent->repeat)
+            {
+                CORE.Input.Keyboard.keyRepeatInFrame[keyboardEvent->keyCode] = 1;
+                PushInputEvent(INPUT_EVENT_KEY_REPEAT, 0, keyboardEvent->keyCode, 0.0f, 0.0f);
+            }
         } break;
         case EMSCRIPTEN_EVENT_KEYDOWN:
         {
             CORE.Input.Keyboard.currentKeyState[keyboardEvent->keyCode] = 1;
+            PushInputEvent(INPUT_EVENT_KEY_PRESSED, 0, keyboardEvent->keyCode, 0.0f, 0.0f);
         } break;
         case EMSCRIPTEN_EVENT_KEYUP:
         {
             CORE.Input.Keyboard.currentKeyState[keyboardEvent->keyCode] = 0;
+            PushInputEvent(INPUT_EVENT_KEY_RELEASED, 0, keyboardEvent->keyCode, 0.0f, 0.0f);
         } break;
         default: break;
     }
@@ -1448,12 +1489,16 @@ static EM_BOOL EmscriptenMouseCallback(int eventType, const EmscriptenMouseEvent
             else if (mouseEvent->button == 2) CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_RIGHT] = 1;
 
             //CORE.Input.Touch.currentTouchState[button] = action;
+
+            if (mouseEvent->button <= 2) PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_PRESSED, 0, (mouseEvent->button == 0)? MOUSE_BUTTON_LEFT : ((mouseEvent->button == 1)? MOUSE_BUTTON_MIDDLE : MOUSE_BUTTON_RIGHT), CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
         } break;
         case EMSCRIPTEN_EVENT_MOUSEUP:
         {
             if (mouseEvent->button == 0) CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_LEFT] = 0;
             else if (mouseEvent->button == 1) CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_MIDDLE] = 0;
             else if (mouseEvent->button == 2) CORE.Input.Mouse.currentButtonState[MOUSE_BUTTON_RIGHT] = 0;
+
+            if (mouseEvent->button <= 2) PushInputEvent(INPUT_EVENT_MOUSE_BUTTON_RELEASED, 0, (mouseEvent->button == 0)? MOUSE_BUTTON_LEFT : ((mouseEvent->button == 1)? MOUSE_BUTTON_MIDDLE : MOUSE_BUTTON_RIGHT), CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
         } break;
         default: break;
     }
@@ -1528,6 +1573,8 @@ static EM_BOOL EmscriptenMouseMoveCallback(int eventType, const EmscriptenMouseE
         //int mouseY = (int)(e->canvasY*dpr);
 
         CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
+
+        PushInputEvent(INPUT_EVENT_MOUSE_MOVE, 0, 0, CORE.Input.Mouse.currentPosition.x, CORE.Input.Mouse.currentPosition.y);
     }
 
 #if defined(SUPPORT_GESTURES_SYSTEM) && defined(SUPPORT_MOUSE_GESTURES)
@@ -1563,6 +1610,8 @@ static EM_BOOL EmscriptenMouseWheelCallback(int eventType, const EmscriptenWheel
     {
         CORE.Input.Mouse.currentWheelMove.x = (float)wheelEvent->deltaX;
         CORE.Input.Mouse.currentWheelMove.y = (float)wheelEvent->deltaY;
+
+        PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, 0, (float)wheelEvent->deltaX, (float)wheelEvent->deltaY);
     }
 
     return 1; // The event was consumed by the callback handler
@@ -1571,7 +1620,7 @@ static EM_BOOL EmscriptenMouseWheelCallback(int eventType, const EmscriptenWheel
 // Emscripten: Called on pointer lock events
 static EM_BOOL EmscriptenPointerlockCallback(int eventType, const EmscriptenPointerlockChangeEvent *pointerlockChangeEvent, void *userData)
 {
-    CORE.Input.Mouse.cursorLocked = EM_ASM_INT( { if (document.pointerLockElement) return 1; }, 0);
+    CORE.Input.Mouse.cursorLocked = MAIN_THREAD_EM_ASM_INT( { if (document.pointerLockElement) return 1; }, 0);
 
     if (CORE.Input.Mouse.cursorLocked)
     {
@@ -1631,6 +1680,13 @@ static EM_BOOL EmscriptenTouchCallback(int eventType, const EmscriptenTouchEvent
 
         if (eventType == EMSCRIPTEN_EVENT_TOUCHSTART) CORE.Input.Touch.currentTouchState[i] = 1;
         else if (eventType == EMSCRIPTEN_EVENT_TOUCHEND) CORE.Input.Touch.currentTouchState[i] = 0;
+
+        if (touchEvent->touches[i].isChanged)
+        {
+            int touchEventType = (eventType == EMSCRIPTEN_EVENT_TOUCHSTART)? INPUT_EVENT_TOUCH_DOWN :
+                (((eventType == EMSCRIPTEN_EVENT_TOUCHEND) || (eventType == EMSCRIPTEN_EVENT_TOUCHCANCEL))? INPUT_EVENT_TOUCH_UP : INPUT_EVENT_TOUCH_MOVE);
+            PushInputEvent(touchEventType, CORE.Input.Touch.pointId[i], 0, CORE.Input.Touch.position[i].x, CORE.Input.Touch.position[i].y);
+        }
     }
 
     // Update mouse position if we detect a single touch
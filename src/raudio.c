@@ -8,6 +8,7 @@
 *       - Manage mixing channels
 *       - Load and unload audio files
 *       - Format wave data (sample rate, size, channels)
+*       - Process waves batches in parallel (trim, normalize, format)
 *       - Play/Stop/Pause/Resume loaded audio
 *
 *   CONFIGURATION:
@@ -28,6 +29,19 @@
 *           Selected desired fileformats to be supported for loading. Some of those formats are
 *           supported by default, to remove support, just comment unrequired #define in this module
 *
+*       #define SUPPORT_WAVE_WORKER_THREADS
+*           Process waves in parallel on worker threads for rl_ProcessWaves(), not supported on web,
+*           job system worker threads are used if not RAUDIO_STANDALONE, miniaudio threads otherwise
+*           (one per additional processor, single worker if processors count is not available)
+*
+*       #define SUPPORT_LAZY_AUDIO_DEVICE
+*           rl_InitAudioDevice() defers device initialization to first audio resource loaded,
+*           programs not playing audio skip audio backend initialization time
+*
+*   NOTES:
+*       - Playback state changes are sent to the audio thread through a lock-free single-producer
+*         single-consumer command queue, all audio functions must be called from the same program thread
+*
 *   DEPENDENCIES:
 *       miniaudio.h  - Audio device management lib (https://github.com/mackron/miniaudio)
 *       stb_vorbis.h - Ogg audio files loading (http://www.nothings.org/stb_vorbis/)
@@ -78,6 +92,7 @@
     #if !defined(EXTERNAL_CONFIG_FLAGS)
         #include "config.h"     // Defines module configuration flags
     #endif
+    #define RL_MEMORY_MODULE MEMORY_MODULE_AUDIO     // Memory tracking allocations module
     #include "utils.h"          // Required for: fopen() Android mapping
 #endif
 
@@ -183,6 +198,26 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in rl_IsFileExtension(), rl_LoadWaveFromMemory(), rl_LoadMusicStreamFromMemory()]
+#include <math.h>                       // Required for: sqrtf(), cosf(), powf(), fabsf() [Used in spatial sounds]
+#include <limits.h>                     // Required for: INT_MAX [Used in rl_LoadMusicStreamFromReader()]
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>              // Required for: SSE2 intrinsics [Used in MixAudioFrames()]
+    #define RAUDIO_SSE2_ENABLED
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #include <arm_neon.h>               // Required for: NEON intrinsics [Used in MixAudioFrames()]
+    #define RAUDIO_NEON_ENABLED
+#endif
+
+// Wave worker threads (batch processing) are not supported on web (no threads)
+#if defined(SUPPORT_WAVE_WORKER_THREADS)
+    #if defined(PLATFORM_WEB)
+        #undef SUPPORT_WAVE_WORKER_THREADS
+    #endif
+#endif
+#if defined(SUPPORT_WAVE_WORKER_THREADS) && defined(RAUDIO_STANDALONE) && !defined(_WIN32)
+    #include <unistd.h>                 // Required for: sysconf() [Used in rl_ProcessWaves()]
+#endif
 
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
@@ -202,6 +237,10 @@ typedef struct tagBITMAPINFOHEADER {
     #ifndef RL_FREE
         #define RL_FREE(ptr)            free(ptr)
     #endif
+
+    // CPU profiler zones not available
+    #define PROFILE_ZONE_BEGIN(name)    (void)0
+    #define PROFILE_ZONE_END()          (void)0
 #endif
 
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -294,10 +333,61 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef AUDIO_DEVICE_SAMPLE_RATE
     #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device output sample rate
 #endif
+#ifndef AUDIO_DEVICE_PERIOD_SIZE
+    #define AUDIO_DEVICE_PERIOD_SIZE           0    // Device period size in frames (0: device default)
+#endif
+#ifndef AUDIO_DEVICE_PERIODS
+    #define AUDIO_DEVICE_PERIODS               0    // Device periods count (0: device default)
+#endif
 
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE         256    // Audio commands queue size, must be a power of two
+#endif
+#ifndef AUDIO_VOICES_MAX
+    #define AUDIO_VOICES_MAX                   0    // Maximum sounds mixed at once (0: no limit), excess sounds are virtual
+#endif
+#ifndef AUDIO_VOICE_SWAPS_MAX
+    #define AUDIO_VOICE_SWAPS_MAX              4    // Maximum virtual voices swapped with real voices per mix
+#endif
+#ifndef AUDIO_MUSIC_DECODE_BUFFERS
+    #define AUDIO_MUSIC_DECODE_BUFFERS         4    // Music sub-buffers decoded ahead by decoder thread
+#endif
+#ifndef AUDIO_RESAMPLER_QUALITY
+    #define AUDIO_RESAMPLER_QUALITY            1    // Mixing time resampler quality: rl_AudioResamplerQuality
+#endif
+#ifndef AUDIO_SOUND_COMPRESSED_SIZE
+    #define AUDIO_SOUND_COMPRESSED_SIZE        0    // Sounds over this size on device format (in bytes) are kept QOA compressed (0: disabled)
+#endif
+#ifndef AUDIO_MUSIC_DECODER_SLEEP
+    #define AUDIO_MUSIC_DECODER_SLEEP         10    // Music decoder thread sleep time when no decoding is required (in milliseconds)
+#endif
+#ifndef AUDIO_SPATIAL_BATCH_SIZE
+    #define AUDIO_SPATIAL_BATCH_SIZE          64    // Spatial sounds evaluated per batch (multiple of 4)
+#endif
+#ifndef AUDIO_SPEED_OF_SOUND
+    #define AUDIO_SPEED_OF_SOUND          343.3f    // Default speed of sound for doppler effect (in world units per second)
+#endif
+#ifndef MAX_WAVE_WORKER_THREADS
+    #define MAX_WAVE_WORKER_THREADS            8    // Maximum wave worker threads (batch processing)
+#endif
+#ifndef AUDIO_BUS_BLOCK_SIZE
+    #define AUDIO_BUS_BLOCK_SIZE            1024    // Audio buses mixing block size (in frames), larger periods are mixed in several blocks
+#endif
+
+#define AUDIO_SPATIAL_EPSILON            1e-6f      // Spatial evaluation minimum distance and divisor
+#define AUDIO_SPATIAL_PITCH_MIN          0.25f      // Doppler pitch minimum
+#define AUDIO_SPATIAL_PITCH_MAX           4.0f      // Doppler pitch maximum
+#define AUDIO_SPATIAL_PITCH_STEP        0.002f      // Doppler pitch relative change to update resampling rate (~3.5 cents)
+
+#define AUDIO_CALLBACK_STATS_SMOOTHING   0.05f      // Audio callback timing averages smoothing factor
+#define AUDIO_COMPRESSOR_STEP               16      // Compressor frames per gain computation
+#define AUDIO_REVERB_STEREO_SPREAD          23      // Reverb right channel delay lines extra length (in frames at 44100 Hz)
+#define AUDIO_REVERB_INPUT_GAIN          0.03f      // Reverb comb filters input gain
+#define AUDIO_REVERB_WET_GAIN             3.0f      // Reverb output gain
+#define AUDIO_REVERB_DENORMAL           1e-18f      // Reverb input offset, avoids denormals on delay lines
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -338,6 +428,44 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+// Audio stream sub-buffer state, defines which thread owns the sub-buffer data
+typedef enum {
+    AUDIO_SUBBUFFER_PROCESSED = 0,  // Processed by audio thread, available for updating by program thread
+    AUDIO_SUBBUFFER_QUEUED,         // Updated by program thread, submit command not yet processed
+    AUDIO_SUBBUFFER_PENDING         // Owned by audio thread, pending to be processed
+} AudioSubBufferState;
+
+// Audio command type
+// NOTE: Commands are queued by program thread and processed by audio thread at the start of every mix
+typedef enum {
+    AUDIO_COMMAND_PLAY = 0,         // Play audio buffer from the start
+    AUDIO_COMMAND_STOP,             // Stop audio buffer
+    AUDIO_COMMAND_PAUSE,            // Pause audio buffer
+    AUDIO_COMMAND_RESUME,           // Resume audio buffer
+    AUDIO_COMMAND_PITCH,            // Set audio buffer pitch
+    AUDIO_COMMAND_SUBMIT,           // Submit updated sub-buffer to be played
+    AUDIO_COMMAND_FLUSH,            // Discard sub-buffers pending to be played
+    AUDIO_COMMAND_CALLBACK,         // Set audio buffer callback
+    AUDIO_COMMAND_TRACK,            // Add audio buffer to mixing list
+    AUDIO_COMMAND_UNTRACK,          // Remove audio buffer from mixing list, returned to be released
+    AUDIO_COMMAND_ATTACH,           // Add processor to audio buffer or mixed output
+    AUDIO_COMMAND_DETACH,           // Remove processor from audio buffer or mixed output, returned to be released
+    AUDIO_COMMAND_DECODER,          // Set music decoder feeding audio buffer sub-buffers, previous one returned to be released
+    AUDIO_COMMAND_BUS_ADD,          // Add audio bus to mixing list
+    AUDIO_COMMAND_BUS_REMOVE,       // Remove audio bus from mixing list, returned to be released
+    AUDIO_COMMAND_BUS_OUTPUT,       // Set audio bus output bus
+    AUDIO_COMMAND_BUS_ROUTE         // Set audio buffer output bus
+} AudioCommandType;
+
+typedef struct AudioMusicDecoder AudioMusicDecoder;
+
+// Music stream reader, adapts reader callbacks to decoders
+// NOTE: Formats not supporting incremental reads (OGG, XM, MOD) are read at once into data
+typedef struct AudioMusicReader {
+    rl_AudioReader reader;          // Reader callbacks provided by user
+    unsigned char *data;            // Data read at once, NULL if data is pulled incrementally
+} AudioMusicReader;
+
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
@@ -348,18 +476,63 @@ struct rAudioBuffer {
     float volume;                   // Audio buffer volume
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (0.0f to 1.0f)
+    float mixLevels[2];             // Audio buffer channel levels applied on last mix, ramped to volume and pan
 
-    bool playing;                   // Audio buffer state: AUDIO_PLAYING
-    bool paused;                    // Audio buffer state: AUDIO_PAUSED
+    ma_int32 priority;              // Voice priority, higher priority voices are mixed first
+    float distance;                 // Voice distance to listener, used to rank voices
+    bool isVirtual;                 // Voice is not mixed, playback position is tracked
+    bool isVoiceNew;                // Voice started playing and has not been mixed yet
+    bool isPassthrough;             // Audio buffer data matches mixing format and rate, conversion is skipped
+
+    ma_uint32 playing;              // Audio buffer state: AUDIO_PLAYING
+    ma_uint32 paused;               // Audio buffer state: AUDIO_PAUSED
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    ma_uint32 subBufferState[2];    // SubBuffer state (virtual double buffer): AudioSubBufferState
     unsigned int sizeInFrames;      // Total buffer size in frames
-    unsigned int frameCursorPos;    // Frame cursor position
-    unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
+    ma_uint32 frameCursorPos;       // Frame cursor position
+    bool isRing;                    // Stream is a ring buffer, frames written in place by program thread (size is power of two)
+    ma_uint32 ringWrite;            // Ring frames written counter, only updated by program thread
+    ma_uint32 ringRead;             // Ring frames read counter, only updated by audio thread
+    ma_uint32 framesProcessed;      // Total frames processed in this buffer (required for play timing)
+
+    ma_uint32 isSpatial;            // Sound is spatialized, panned and attenuated relative to listener
+    float position[3];              // Spatial sound emitter position
+    float velocity[3];              // Spatial sound emitter velocity, used for doppler effect
+    float direction[3];             // Spatial sound emitter cone direction (normalized)
+    ma_uint32 attenuation;          // Spatial sound distance attenuation model: rl_AudioAttenuation
+    float minDistance;              // Spatial sound distance where attenuation starts
+    float maxDistance;              // Spatial sound distance where attenuation stops
+    float rolloff;                  // Spatial sound attenuation rolloff factor
+    float coneInner;                // Spatial sound cone inner half angle cosine
+    float coneOuter;                // Spatial sound cone outer half angle cosine
+    float coneOuterGain;            // Spatial sound gain outside cone outer angle
+    float spatialGain;              // Spatial gain from distance and cone, updated by audio thread
+    float spatialPan;               // Spatial pan from listener orientation, updated by audio thread
+    float spatialPitch;             // Spatial doppler pitch applied to resampling rate, updated by audio thread
+
+    rAudioBus *bus;                 // Audio bus mixed to, NULL for master output, used by audio thread
+
+    ma_uint64 startFrame;           // Scheduled playback start device frame (0: not scheduled), used by audio thread
+    ma_uint32 commandsPending;      // State commands queued and not yet processed by audio thread
+    bool requestedPlaying;          // Playing state requested by program thread
+    bool requestedPaused;           // Paused state requested by program thread
+
+    AudioMusicDecoder *decoder;     // Music decoder feeding sub-buffers, used by audio thread
+    AudioMusicDecoder *requestedDecoder; // Music decoder set by program thread
+    ma_uint32 decoderGeneration;    // Music decoder generation of sub-buffers data, used by audio thread
+    AudioMusicReader *reader;       // Music stream reader, NULL if music data is not pulled by reader
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    unsigned int qoaSize;           // QOA data size, compressed sound data is kept QOA encoded
+    qoa_desc qoa;                   // QOA description, used to decode compressed sound frames
+    short *qoaFrame;                // QOA frame decoded samples, updated by audio thread
+    ma_uint32 qoaFrameIndex;        // QOA frame decoded index plus one (0: no frame decoded)
+#endif
+
+    unsigned int memorySize;        // Memory owned by buffer (in bytes): buffer, audio data and QOA frame (memory stats)
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
@@ -373,29 +546,242 @@ struct rAudioProcessor {
     rAudioProcessor *prev;          // Previous audio processor on the list
 };
 
+// Audio bus reverb delay line, used by comb and allpass filters
+typedef struct AudioReverbLine {
+    float *buffer;                  // Delay line samples
+    int length;                     // Delay line length
+    int position;                   // Delay line position
+    float store;                    // Comb filter damping state
+} AudioReverbLine;
+
+// Audio bus, sounds and streams routed to it are mixed and processed together
+// NOTE: Effects parameters are set by program thread, effects state is only accessed by audio thread
+struct rAudioBus {
+    float volume;                   // Bus volume
+    float mixVolume;                // Bus volume applied on last mix, ramped to volume
+    float mixTime;                  // Bus processing time on last mix (in milliseconds)
+    double processTime;             // Bus processing time on current mix (in seconds)
+
+    ma_uint32 version;              // Effects parameters version, incremented by program thread on changes
+    ma_uint32 appliedVersion;       // Effects parameters version applied by audio thread
+
+    ma_uint32 filterType;           // Filter type: rl_AudioFilter
+    float filterFrequency;          // Filter cutoff or center frequency (in Hz)
+    float filterResonance;          // Filter resonance (Q)
+    float compressorThreshold;      // Compressor threshold (in dB)
+    float compressorRatio;          // Compressor ratio (1.0f: disabled)
+    float compressorAttack;         // Compressor attack time (in milliseconds)
+    float compressorRelease;        // Compressor release time (in milliseconds)
+    float reverbRoomSize;           // Reverb room size
+    float reverbDamping;            // Reverb high frequencies damping
+    float reverbMix;                // Reverb level (0.0f: disabled)
+
+    ma_biquad filter;               // Filter state
+    bool isFilterActive;            // Filter processed
+    float compressorLevel;          // Compressor threshold level (linear)
+    float compressorExponent;       // Compressor gain exponent over threshold: 1/ratio - 1
+    float compressorAttackCoeff;    // Compressor envelope attack coefficient
+    float compressorReleaseCoeff;   // Compressor envelope release coefficient
+    float compressorEnvelope;       // Compressor level envelope
+    float compressorGain;           // Compressor gain applied on last frame
+    bool isCompressorActive;        // Compressor processed
+    float *reverbData;              // Reverb delay lines data
+    AudioReverbLine reverbCombs[2][8];      // Reverb comb filters per channel
+    AudioReverbLine reverbAllpasses[2][4];  // Reverb allpass filters per channel
+    float reverbFeedback;           // Reverb comb filters feedback
+    float reverbDamp;               // Reverb comb filters damping
+    float reverbLevel;              // Reverb level applied
+    bool isReverbActive;            // Reverb processed
+
+    float frames[AUDIO_BUS_BLOCK_SIZE*AUDIO_DEVICE_CHANNELS];   // Bus mixed frames for current block
+
+    rAudioBus *output;              // Bus output, NULL for master output, used by audio thread
+    rAudioBus *requestedOutput;     // Bus output set by program thread
+    int depth;                      // Bus routing depth, buses are processed before their outputs
+    rAudioBus *next;                // Next audio bus on audio thread list, sorted by depth
+    rAudioBus *loadedNext;          // Next audio bus on program thread list
+};
+
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Music decoded chunk, one sub-buffer of music data
+typedef struct AudioMusicChunk {
+    ma_uint32 frameCount;           // Frames decoded
+    ma_uint32 position;             // Music position of first frame decoded
+    ma_uint32 generation;           // Music decoder generation when decoded
+} AudioMusicChunk;
+
+// Music decoder, decodes music stream sub-buffers ahead on decoder thread
+// NOTE: Decoded chunks ring is single producer (decoder thread) single consumer (audio thread),
+// music context and decoding position are only accessed with decoders lock
+struct AudioMusicDecoder {
+    rl_Music music;                 // Music decoded
+    unsigned char *data;            // Decoded chunks data, AUDIO_MUSIC_DECODE_BUFFERS sub-buffers
+    AudioMusicChunk chunks[AUDIO_MUSIC_DECODE_BUFFERS];
+    ma_uint32 head;                 // Write position, updated by decoder thread
+    ma_uint32 tail;                 // Read position, updated by audio thread
+    ma_uint32 generation;           // Incremented when music is seeked or rewound, older chunks are discarded
+    ma_uint32 ended;                // Generation fully decoded, music is not looping
+    ma_uint32 rewind;               // Generation ended playing, rewind requested by audio thread
+    ma_uint32 looping;              // Music looping, synced on rl_UpdateMusicStream()
+    unsigned int framesDecoded;     // Music position decoded
+    AudioMusicDecoder *next;        // Next music decoder on the list
+};
+
+// Audio command, passed between program thread and audio thread
+typedef struct AudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Target audio buffer, NULL for mixed output processors
+    rAudioProcessor *processor;     // Processor to attach or to be released
+    AudioCallback callback;         // Audio buffer callback or processor callback to detach
+    AudioMusicDecoder *decoder;     // Music decoder to set or to be released
+    rAudioBus *bus;                 // Audio bus to add, route or to be released
+    rAudioBus *output;              // Audio bus output, NULL for master output
+    float value;                    // Command value: pitch
+    ma_uint64 frame;                // Command device frame: scheduled playback start (0: next mix)
+    int param;                      // Command parameter: sub-buffer index, buffer data ownership
+} AudioCommand;
+
+// Audio command queue, lock-free single producer single consumer ring
+// NOTE: Positions are free-running counters, only written by its owner thread
+typedef struct AudioCommandQueue {
+    AudioCommand commands[AUDIO_COMMAND_QUEUE_SIZE];
+    ma_uint32 head;                 // Write position, updated by producer thread
+    ma_uint32 tail;                 // Read position, updated by consumer thread
+} AudioCommandQueue;
+
+// Spatial sounds batch, evaluated as structure of arrays
+// NOTE: Emitter positions are relative to listener
+typedef struct AudioSpatialBatch {
+    int count;                                      // Emitters in batch
+    AudioBuffer *buffers[AUDIO_SPATIAL_BATCH_SIZE]; // Emitters audio buffers
+    int models[AUDIO_SPATIAL_BATCH_SIZE];           // Emitters attenuation model
+    float x[AUDIO_SPATIAL_BATCH_SIZE];              // Emitters position relative to listener: x
+    float y[AUDIO_SPATIAL_BATCH_SIZE];              // Emitters position relative to listener: y
+    float z[AUDIO_SPATIAL_BATCH_SIZE];              // Emitters position relative to listener: z
+    float vx[AUDIO_SPATIAL_BATCH_SIZE];             // Emitters velocity: x
+    float vy[AUDIO_SPATIAL_BATCH_SIZE];             // Emitters velocity: y
+    float vz[AUDIO_SPATIAL_BATCH_SIZE];             // Emitters velocity: z
+    float dx[AUDIO_SPATIAL_BATCH_SIZE];             // Emitters cone direction: x
+    float dy[AUDIO_SPATIAL_BATCH_SIZE];             // Emitters cone direction: y
+    float dz[AUDIO_SPATIAL_BATCH_SIZE];             // Emitters cone direction: z
+    float minDistance[AUDIO_SPATIAL_BATCH_SIZE];    // Emitters attenuation min distance
+    float maxDistance[AUDIO_SPATIAL_BATCH_SIZE];    // Emitters attenuation max distance
+    float rolloff[AUDIO_SPATIAL_BATCH_SIZE];        // Emitters attenuation rolloff factor
+    float inverse[AUDIO_SPATIAL_BATCH_SIZE];        // Emitters inverse attenuation weight (1.0f or 0.0f)
+    float linear[AUDIO_SPATIAL_BATCH_SIZE];         // Emitters linear attenuation weight (1.0f or 0.0f)
+    float coneInner[AUDIO_SPATIAL_BATCH_SIZE];      // Emitters cone inner half angle cosine
+    float coneOuter[AUDIO_SPATIAL_BATCH_SIZE];      // Emitters cone outer half angle cosine
+    float coneOuterGain[AUDIO_SPATIAL_BATCH_SIZE];  // Emitters gain outside cone outer angle
+    float distance[AUDIO_SPATIAL_BATCH_SIZE];       // Evaluated emitters distance to listener
+    float gain[AUDIO_SPATIAL_BATCH_SIZE];           // Evaluated emitters gain
+    float pan[AUDIO_SPATIAL_BATCH_SIZE];            // Evaluated emitters pan
+    float pitch[AUDIO_SPATIAL_BATCH_SIZE];          // Evaluated emitters doppler pitch
+    float listenerRight[3];                         // Listener right direction
+    float listenerVelocity[3];                      // Listener velocity
+    float doppler;                                  // Doppler factor
+    float speedOfSound;                             // Speed of sound
+} AudioSpatialBatch;
+
+// Wave processing job, waves are distributed to processing threads
+typedef struct WaveProcessingJob {
+    rl_Wave *waves;                 // Waves to process
+    int count;                      // Waves count
+    rl_WaveProcessing processing;   // Processing options
+    ma_uint32 next;                 // Next wave to process (atomic)
+    ma_uint32 failed;               // Waves failed to process (atomic)
+    ma_uint64 frames;               // Input frames processed (atomic)
+} WaveProcessingJob;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
         bool isReady;               // Check if audio device is ready
+        bool isPending;             // Device initialization deferred to first use (SUPPORT_LAZY_AUDIO_DEVICE)
+        int periodSize;             // Device period size requested (deferred initialization)
+        int periods;                // Device periods count requested (deferred initialization)
+        bool lowLatency;            // Device low latency requested (deferred initialization)
+        float pendingVolume;        // Master volume set before deferred initialization (negative: not set)
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
+        int resamplerQuality;       // Resampler quality for audio buffers loaded: rl_AudioResamplerQuality
     } System;
+    struct {
+        ma_timer timer;             // Audio callback timer, started on device initialization
+        double time;                // Last audio callback time (in seconds)
+        ma_uint32 count;            // Audio callbacks since device initialization
+        ma_uint64 frames;           // Frames mixed since device initialization, audio device clock
+        float interval;             // Audio callbacks interval average (in milliseconds)
+        float jitter;               // Audio callbacks interval deviation from period duration average (in milliseconds)
+        float jitterMax;            // Audio callbacks interval deviation from period duration maximum (in milliseconds)
+    } Callback;
     struct {
         AudioBuffer *first;         // Pointer to first AudioBuffer in the list
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        rAudioBus *first;           // Pointer to first audio bus in the mixing list, used by audio thread
+        rAudioBus *loaded;          // Pointer to first audio bus loaded, used by program thread
+    } Bus;
+    struct {
+        ma_uint32 max;              // Maximum real voices (0: no limit)
+        int real;                   // Real voices, updated by audio thread
+        ma_uint32 playing;          // Voices playing on last mix
+        ma_uint32 mixed;            // Voices mixed on last mix
+        ma_uint32 stolen;           // Voices demoted to virtual since device initialization
+        float mixTime;              // Last mix time (in milliseconds)
+        float mixLoad;              // Last mix time relative to mixed audio duration
+    } Voice;
+    struct {
+        float callbackTime;         // Last audio callback time (in milliseconds)
+        float callbackTimeAverage;  // Audio callback time average (in milliseconds)
+        float callbackTimeMax;      // Audio callback time maximum (in milliseconds)
+        float commandTime;          // Last audio callback commands processing time (in milliseconds)
+        float converterTime;        // Last audio callback data conversion time (in milliseconds)
+        float load;                 // Last audio callback time relative to mixed audio duration
+        ma_uint32 buffersActive;    // Audio buffers on mixing list on last audio callback
+        ma_uint32 overloads;        // Audio callbacks slower than mixed audio duration
+        ma_uint32 underruns;        // Audio stream sub-buffers not refilled in time
+        ma_uint32 commandWaits;     // Program thread waits on full commands queue
+        float lockWaitTime;         // Music lock wait time maximum (in milliseconds)
+        ma_uint32 reset;            // Audio thread stats reset requested by program thread
+        double converterTimeMix;    // Data conversion time accumulated on current audio callback, used by audio thread
+    } Profile;
+    struct {
+        AudioCommandQueue queue;    // Commands sent from program thread to audio thread
+        AudioCommandQueue release;  // Buffers and processors returned by audio thread to be released
+    } Command;
+    struct {
+        ma_thread thread;           // Music decoder thread
+        ma_mutex lock;              // Music decoders list and contexts lock
+        ma_uint32 isRunning;        // Music decoder thread running
+        AudioMusicDecoder *first;   // Pointer to first music decoder in the list
+    } Music;
+    struct {
+        ma_uint64 liveBytes;        // Audio buffers memory currently allocated (in bytes)
+        ma_uint64 peakBytes;        // Maximum audio buffers memory allocated at the same time (in bytes)
+        ma_uint32 liveCount;        // Audio buffers currently alive
+        ma_uint32 totalCount;       // Audio buffers loaded since program start
+    } Memory;
+    struct {
+        float position[3];          // Listener position
+        float right[3];             // Listener right direction (normalized), used for panning
+        float velocity[3];          // Listener velocity, used for doppler effect
+        float doppler;              // Doppler factor (0.0f: disabled)
+        float speedOfSound;         // Speed of sound (in world units per second)
+    } Listener;
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
+// Reverb comb and allpass filters delay lines length (in frames at 44100 Hz), from Freeverb
+static const float reverbTunings[12] = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617, 556, 441, 341, 225 };
+
 static AudioData AUDIO = {          // Global AUDIO context
 
     // NOTE: rl_Music buffer size is defined by number of samples, independent of sample size and channels number
@@ -403,6 +789,11 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+    .System.resamplerQuality = AUDIO_RESAMPLER_QUALITY,
+    .Voice.max = AUDIO_VOICES_MAX,
+    .Listener.right = { 1.0f, 0.0f, 0.0f },
+    .Listener.doppler = 1.0f,
+    .Listener.speedOfSound = AUDIO_SPEED_OF_SOUND,
     .mixedProcessor = NULL
 };
 
@@ -414,13 +805,96 @@ static void OnLog(void *pUserData, ma_uint32 level, const char *pMessage);
 // Reads audio data from an AudioBuffer object in internal/device formats
 static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
+static ma_uint32 ReadAudioRingFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount);
+static void MixAudioRingFrames(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
+static void UpdateAudioCallbackStats(ma_uint32 frameCount);
+static void UpdateAudioProfileStats(float callbackTime, float commandTime, ma_uint32 buffersActive, ma_uint32 frameCount);
+static void UpdateAudioMemoryStats(AudioBuffer *buffer, unsigned int size, bool release);
+static void LockAudioMusic(void);
+static void MixAudioBuffer(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static void MixAudioFramesLevels(float *framesOut, const float *framesIn, ma_uint32 frameCount, const float *levels, const float *steps);
+static void MixAudioFramesStereo(float *framesOut, const float *framesIn, ma_uint32 frameCount, const float *levels, const float *steps);
+static void GetAudioBufferMixLevels(AudioBuffer *buffer, ma_uint32 channels, float *levels);
+static bool IsAudioBufferPassthrough(AudioBuffer *buffer, ma_uint32 sampleRateOut);
+static ma_uint64 ConvertAudioFrames(void *framesOut, ma_uint64 frameCountOut, ma_format formatOut, ma_uint32 channelsOut, ma_uint32 sampleRateOut,
+                                    const void *framesIn, ma_uint64 frameCountIn, ma_format formatIn, ma_uint32 channelsIn, ma_uint32 sampleRateIn);
+
+static float GetWaveSample(const rl_Wave *wave, unsigned int index);
+static bool FormatWave(rl_Wave *wave, int sampleRate, int sampleSize, int channels);
+static bool ProcessWave(rl_Wave *wave, const rl_WaveProcessing *processing);
+#if defined(RAUDIO_STANDALONE)
+static ma_thread_result MA_THREADCALL WaveProcessingThread(void *pUserData);
+#else
+static void ProcessWavesRange(void *userData, int start, int end); // Process waves range on current thread (job system callback)
+#endif
+
+static bool PushAudioCommand(AudioCommandQueue *queue, const AudioCommand *command);
+static void SendAudioCommand(AudioCommand command);
+static void ProcessAudioCommands(void);
+static bool ProcessAudioCommand(const AudioCommand *command);
+static void ReleaseAudioCommands(void);
+
+static void SyncAudioBufferState(AudioBuffer *buffer);
+static void SendAudioBufferStateCommand(AudioBuffer *buffer, int type);
+static void StopAudioBufferInAudioThread(AudioBuffer *buffer);
+
+static void UpdateAudioVoices(void);
+static AudioBuffer *FindAudioVoice(bool isVirtual, bool highest);
+static float GetAudioVoiceAudibility(AudioBuffer *buffer);
+static void PromoteAudioVoice(AudioBuffer *buffer);
+static void DemoteAudioVoice(AudioBuffer *buffer);
+static void AdvanceAudioVoice(AudioBuffer *buffer, ma_uint32 frameCount);
+static void UpdateAudioStreamSubBuffer(rl_AudioStream stream, int subBuffer, const void *data, int frameCount);
+static void UpdateAudioStreamRing(rl_AudioStream stream, const void *data, int frameCount);
+static unsigned int GetAudioStreamSubBufferSize(void);
+
+static void StoreAudioVector(float *vector, rl_Vector3 value);
+static void UpdateAudioSpatial(void);
+static void EvaluateAudioSpatialBatch(AudioSpatialBatch *batch);
+static void ApplyAudioSpatialBatch(AudioSpatialBatch *batch);
+static void SetAudioBufferRate(AudioBuffer *buffer);
+
+static void UpdateAudioBuses(void);
+static void SortAudioBuses(void);
+static void MixAudioBuses(float *framesOut, ma_uint32 frameCount);
+static void ProcessAudioBusCompressor(rAudioBus *bus, ma_uint32 frameCount, ma_uint32 channels);
+static void ProcessAudioBusReverb(rAudioBus *bus, ma_uint32 frameCount, ma_uint32 channels);
+
+static void ReadMusicStreamFrames(rl_Music music, void *framesOut, unsigned int frameCount);
+static size_t ReadMusicReader(void *userData, void *buffer, size_t size);
+static bool SeekMusicReader(void *userData, long long offset, int origin);
+static ma_uint32 TellMusicReader(void *userData, ma_int64 *cursor);
+#if defined(SUPPORT_FILEFORMAT_WAV)
+static drwav_bool32 SeekMusicReaderWav(void *userData, int offset, drwav_seek_origin origin);
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+static drmp3_bool32 SeekMusicReaderMp3(void *userData, int offset, drmp3_seek_origin origin);
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+static unsigned int ReadMusicReaderQoa(void *userData, void *buffer, unsigned int size);
+static int SeekMusicReaderQoa(void *userData, unsigned int position);
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+static drflac_bool32 SeekMusicReaderFlac(void *userData, int offset, drflac_seek_origin origin);
+#endif
+static void RewindMusicStream(rl_Music music);
+#if defined(SUPPORT_FILEFORMAT_MOD)
+static void SetMusicModuleConfig(jar_mod_context_t *ctxMod);
+#endif
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *pUserData);
+static bool DecodeMusicChunk(AudioMusicDecoder *decoder);
+static void UpdateAudioBufferFromDecoder(AudioBuffer *buffer);
+static void InitPlaybackDevice(int periodSize, int periods, bool lowLatency); // Initialize audio context and playback device
+static void InitAudioDevicePending(void);           // Initialize audio device if initialization was deferred
 
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
-static void StopAudioBufferInLockedState(AudioBuffer *buffer);
-static void UpdateAudioStreamInLockedState(rl_AudioStream stream, const void *data, int frameCount);
+#if defined(SUPPORT_FILEFORMAT_QOA)
+static bool IsSoundCompressed(unsigned int frameCount, unsigned int sampleRate);
+static rl_Sound LoadSoundCompressed(unsigned char *data, unsigned int dataSize);
+static const short *DecodeAudioBufferFrames(AudioBuffer *buffer, ma_uint32 *frameCount);
+#endif
 
 #if defined(RAUDIO_STANDALONE)
 static bool rl_IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -458,6 +932,36 @@ void UntrackAudioBuffer(AudioBuffer *buffer);
 // Initialize audio device
 void rl_InitAudioDevice(void)
 {
+    rl_InitAudioDeviceEx(AUDIO_DEVICE_PERIOD_SIZE, AUDIO_DEVICE_PERIODS, false);
+}
+
+// Initialize audio device with period size (in frames) and periods count requested (0: device defaults)
+// NOTE: Low latency requests exclusive share mode and low latency profile, shared mode is used if exclusive mode is not available
+void rl_InitAudioDeviceEx(int periodSize, int periods, bool lowLatency)
+{
+#if defined(SUPPORT_LAZY_AUDIO_DEVICE)
+    // Device is initialized on first audio resource loaded, startup does not wait for audio backend
+    if (!AUDIO.System.isReady)
+    {
+        AUDIO.System.isPending = true;
+        AUDIO.System.periodSize = periodSize;
+        AUDIO.System.periods = periods;
+        AUDIO.System.lowLatency = lowLatency;
+        AUDIO.System.pendingVolume = -1.0f;
+
+        TRACELOG(LOG_INFO, "AUDIO: Device initialization deferred to first use");
+    }
+#else
+    InitPlaybackDevice(periodSize, periods, lowLatency);
+#endif
+}
+
+// Initialize audio context and playback device
+static void InitPlaybackDevice(int periodSize, int periods, bool lowLatency)
+{
+    ma_timer initTimer = { 0 };
+    ma_timer_init(&initTimer);
+
     // Init audio context
     ma_context_config ctxConfig = ma_context_config_init();
     ma_log_callback_init(OnLog, NULL);
@@ -479,29 +983,40 @@ void rl_InitAudioDevice(void)
     config.capture.format = ma_format_s16;
     config.capture.channels = 1;
     config.sampleRate = AUDIO_DEVICE_SAMPLE_RATE;
+    config.periodSizeInFrames = (periodSize > 0)? (ma_uint32)periodSize : 0;
+    config.periods = (periods > 0)? (ma_uint32)periods : 0;
+    config.performanceProfile = lowLatency? ma_performance_profile_low_latency : ma_performance_profile_conservative;
+    config.playback.shareMode = lowLatency? ma_share_mode_exclusive : ma_share_mode_shared;
     config.dataCallback = OnSendAudioDataToDevice;
     config.pUserData = NULL;
 
     result = ma_device_init(&AUDIO.System.context, &config, &AUDIO.System.device);
-    if (result != MA_SUCCESS)
+    if ((result != MA_SUCCESS) && lowLatency)
     {
-        TRACELOG(LOG_WARNING, "AUDIO: Failed to initialize playback device");
-        ma_context_uninit(&AUDIO.System.context);
-        return;
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to initialize playback device in exclusive mode, using shared mode");
+
+        config.playback.shareMode = ma_share_mode_shared;
+        result = ma_device_init(&AUDIO.System.context, &config, &AUDIO.System.device);
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary
-    if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
+    if (result != MA_SUCCESS)
     {
-        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
-        ma_device_uninit(&AUDIO.System.device);
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to initialize playback device");
         ma_context_uninit(&AUDIO.System.context);
         return;
     }
 
+    // Mixing happens on a separate thread, program thread changes are sent through a lock-free command queue
+    // processed at the start of every mix, so neither thread waits on the other
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played
+    ma_timer_init(&AUDIO.Callback.timer);
+    ma_atomic_store_32(&AUDIO.Callback.count, 0);
+    ma_atomic_store_64(&AUDIO.Callback.frames, 0);
+    ma_atomic_store_f32(&AUDIO.Callback.interval, 0.0f);
+    ma_atomic_store_f32(&AUDIO.Callback.jitter, 0.0f);
+    ma_atomic_store_f32(&AUDIO.Callback.jitterMax, 0.0f);
+
     result = ma_device_start(&AUDIO.System.device);
     if (result != MA_SUCCESS)
     {
@@ -517,20 +1032,56 @@ void rl_InitAudioDevice(void)
     TRACELOG(LOG_INFO, "    > Channels:      %d -> %d", AUDIO.System.device.playback.channels, AUDIO.System.device.playback.internalChannels);
     TRACELOG(LOG_INFO, "    > Sample rate:   %d -> %d", AUDIO.System.device.sampleRate, AUDIO.System.device.playback.internalSampleRate);
     TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods);
+    TRACELOG(LOG_INFO, "    > Latency:       %.2f ms (%s)", (float)(AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods)*1000.0f/AUDIO.System.device.playback.internalSampleRate, (AUDIO.System.device.playback.shareMode == ma_share_mode_exclusive)? "exclusive" : "shared");
+
+    ma_atomic_store_32(&AUDIO.Voice.stolen, 0);
 
     AUDIO.System.isReady = true;
+
+    TRACELOG(LOG_DEBUG, "AUDIO: Device initialization time: %.2f ms", ma_timer_get_time_in_seconds(&initTimer)*1000.0);
+}
+
+// Initialize audio device if initialization was deferred (SUPPORT_LAZY_AUDIO_DEVICE)
+// NOTE: Called by audio resources loading functions, master volume set while pending is applied
+static void InitAudioDevicePending(void)
+{
+    if (!AUDIO.System.isPending) return;
+
+    AUDIO.System.isPending = false;
+    InitPlaybackDevice(AUDIO.System.periodSize, AUDIO.System.periods, AUDIO.System.lowLatency);
+
+    if (AUDIO.System.isReady && (AUDIO.System.pendingVolume >= 0.0f)) ma_device_set_master_volume(&AUDIO.System.device, AUDIO.System.pendingVolume);
 }
 
 // Close the audio device for all contexts
 void rl_CloseAudioDevice(void)
 {
+    AUDIO.System.isPending = false;
+
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
+        // Music decoders are released with their audio buffers
+        if (AUDIO.Music.isRunning)
+        {
+            ma_atomic_store_32(&AUDIO.Music.isRunning, false);
+            ma_thread_wait(&AUDIO.Music.thread);
+            ma_mutex_uninit(&AUDIO.Music.lock);
+        }
+
+        AUDIO.Music.first = NULL;
+
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
         AUDIO.System.isReady = false;
+
+        // Audio thread is stopped, remaining commands are processed here
+        do
+        {
+            ProcessAudioCommands();
+            ReleaseAudioCommands();
+        } while (AUDIO.Command.queue.tail != AUDIO.Command.queue.head);
+
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -541,25 +1092,177 @@ void rl_CloseAudioDevice(void)
 }
 
 // Check if device has been initialized successfully
+// NOTE: Device with deferred initialization is considered ready, it is initialized on first use
 bool rl_IsAudioDeviceReady(void)
 {
-    return AUDIO.System.isReady;
+    return (AUDIO.System.isReady || AUDIO.System.isPending);
 }
 
 // Set master volume (listener)
 void rl_SetMasterVolume(float volume)
 {
-    ma_device_set_master_volume(&AUDIO.System.device, volume);
+    if (AUDIO.System.isPending) AUDIO.System.pendingVolume = volume;
+    else ma_device_set_master_volume(&AUDIO.System.device, volume);
 }
 
 // Get master volume (listener)
 float rl_GetMasterVolume(void)
 {
     float volume = 0.0f;
-    ma_device_get_master_volume(&AUDIO.System.device, &volume);
+    if (AUDIO.System.isPending) volume = (AUDIO.System.pendingVolume >= 0.0f)? AUDIO.System.pendingVolume : 1.0f;
+    else ma_device_get_master_volume(&AUDIO.System.device, &volume);
     return volume;
 }
 
+// Get audio device time (in seconds), audio mixed since audio device initialization
+// NOTE: Time advances once per audio callback, use it as reference to schedule sounds ahead
+double rl_GetAudioTime(void)
+{
+    ma_uint32 sampleRate = AUDIO.System.device.sampleRate;
+
+    return (AUDIO.System.isReady && (sampleRate > 0))? (double)ma_atomic_load_64(&AUDIO.Callback.frames)/sampleRate : 0.0;
+}
+
+// Set maximum number of sounds mixed at once (0: no limit)
+// NOTE: Excess sounds are virtual: not mixed but playback position tracked, promoted when ranked higher
+void rl_SetAudioVoicesMax(int count)
+{
+    ma_atomic_store_32(&AUDIO.Voice.max, (count > 0)? (ma_uint32)count : 0);
+}
+
+// Set resampler quality for sounds and streams loaded afterwards
+// NOTE: Resampling at mixing time is only required for audio streams, compressed and pitched sounds
+void rl_SetAudioResamplerQuality(int quality)
+{
+    if ((quality >= AUDIO_RESAMPLER_LINEAR) && (quality <= AUDIO_RESAMPLER_FILTERED_HIGH)) AUDIO.System.resamplerQuality = quality;
+    else TRACELOG(LOG_WARNING, "AUDIO: Resampler quality not supported");
+}
+
+// Set audio listener position and orientation, looking from position to target
+// NOTE: Spatial sounds (with a position set) are panned and attenuated relative to listener
+void rl_SetAudioListener(rl_Vector3 position, rl_Vector3 target, rl_Vector3 up)
+{
+    rl_Vector3 forward = { target.x - position.x, target.y - position.y, target.z - position.z };
+    rl_Vector3 right = { forward.y*up.z - forward.z*up.y, forward.z*up.x - forward.x*up.z, forward.x*up.y - forward.y*up.x };
+    float length = sqrtf(right.x*right.x + right.y*right.y + right.z*right.z);
+
+    StoreAudioVector(AUDIO.Listener.position, position);
+
+    // Orientation is kept if listener direction is not valid
+    if (length > 0.0f) StoreAudioVector(AUDIO.Listener.right, (rl_Vector3){ right.x/length, right.y/length, right.z/length });
+}
+
+// Set audio listener velocity, used for doppler effect
+void rl_SetAudioListenerVelocity(rl_Vector3 velocity)
+{
+    StoreAudioVector(AUDIO.Listener.velocity, velocity);
+}
+
+// Set doppler effect factor (0.0f: disabled) and speed of sound (in world units per second)
+void rl_SetAudioDoppler(float factor, float speedOfSound)
+{
+    if ((factor < 0.0f) || (speedOfSound <= 0.0f))
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Doppler parameters not valid");
+        return;
+    }
+
+    ma_atomic_store_f32(&AUDIO.Listener.doppler, factor);
+    ma_atomic_store_f32(&AUDIO.Listener.speedOfSound, speedOfSound);
+}
+
+// Get audio voices stats (real vs virtual voices and mixing cost)
+rl_AudioVoiceStats rl_GetAudioVoiceStats(void)
+{
+    rl_AudioVoiceStats stats = { 0 };
+
+    stats.voicesPlaying = (int)ma_atomic_load_32(&AUDIO.Voice.playing);
+    stats.voicesReal = (int)ma_atomic_load_32(&AUDIO.Voice.mixed);
+    stats.voicesVirtual = (stats.voicesPlaying > stats.voicesReal)? (stats.voicesPlaying - stats.voicesReal) : 0;
+    stats.voicesMax = (int)ma_atomic_load_32(&AUDIO.Voice.max);
+    stats.voicesStolen = ma_atomic_load_32(&AUDIO.Voice.stolen);
+    stats.mixTime = ma_atomic_load_f32(&AUDIO.Voice.mixTime);
+    stats.mixLoad = ma_atomic_load_f32(&AUDIO.Voice.mixLoad);
+
+    return stats;
+}
+
+// Get audio buffers memory stats (sounds, aliases and streams data)
+// NOTE: Unloaded buffers memory is released once audio thread returns them, on next audio call sending a command
+rl_MemoryStats rl_GetAudioMemoryStats(void)
+{
+    rl_MemoryStats stats = { 0 };
+
+    stats.liveBytes = (long long)ma_atomic_load_64(&AUDIO.Memory.liveBytes);
+    stats.peakBytes = (long long)ma_atomic_load_64(&AUDIO.Memory.peakBytes);
+    stats.liveCount = (int)ma_atomic_load_32(&AUDIO.Memory.liveCount);
+    stats.totalCount = ma_atomic_load_32(&AUDIO.Memory.totalCount);
+
+    return stats;
+}
+
+// Get audio callback profiling stats (callback cost, buffers, underruns and waits)
+rl_AudioProfileStats rl_GetAudioProfileStats(void)
+{
+    rl_AudioProfileStats stats = { 0 };
+
+    stats.callbackTime = ma_atomic_load_f32(&AUDIO.Profile.callbackTime);
+    stats.callbackTimeAverage = ma_atomic_load_f32(&AUDIO.Profile.callbackTimeAverage);
+    stats.callbackTimeMax = ma_atomic_load_f32(&AUDIO.Profile.callbackTimeMax);
+    stats.commandTime = ma_atomic_load_f32(&AUDIO.Profile.commandTime);
+    stats.converterTime = ma_atomic_load_f32(&AUDIO.Profile.converterTime);
+    stats.load = ma_atomic_load_f32(&AUDIO.Profile.load);
+    stats.buffersActive = (int)ma_atomic_load_32(&AUDIO.Profile.buffersActive);
+    stats.buffersMixed = (int)ma_atomic_load_32(&AUDIO.Voice.mixed);
+    stats.overloads = ma_atomic_load_32(&AUDIO.Profile.overloads);
+    stats.underruns = ma_atomic_load_32(&AUDIO.Profile.underruns);
+    stats.commandWaits = ma_atomic_load_32(&AUDIO.Profile.commandWaits);
+    stats.lockWaitTime = ma_atomic_load_f32(&AUDIO.Profile.lockWaitTime);
+
+    return stats;
+}
+
+// Reset audio profiling stats maximums and counters
+// NOTE: Audio thread stats are reset on next audio callback
+void rl_ResetAudioProfileStats(void)
+{
+    ma_atomic_store_32(&AUDIO.Profile.commandWaits, 0);
+    ma_atomic_store_f32(&AUDIO.Profile.lockWaitTime, 0.0f);
+
+    if (AUDIO.System.isReady) ma_atomic_store_32(&AUDIO.Profile.reset, 1);
+    else
+    {
+        ma_atomic_store_f32(&AUDIO.Profile.callbackTimeMax, 0.0f);
+        ma_atomic_store_32(&AUDIO.Profile.overloads, 0);
+        ma_atomic_store_32(&AUDIO.Profile.underruns, 0);
+    }
+}
+
+// Get audio device latency and callback timing stats
+// NOTE: Latency is the device buffer duration, backends could add some extra latency
+rl_AudioLatencyStats rl_GetAudioLatencyStats(void)
+{
+    rl_AudioLatencyStats stats = { 0 };
+
+    if (AUDIO.System.isReady)
+    {
+        const ma_uint32 sampleRate = AUDIO.System.device.playback.internalSampleRate;
+
+        stats.periodSize = (int)AUDIO.System.device.playback.internalPeriodSizeInFrames;
+        stats.periods = (int)AUDIO.System.device.playback.internalPeriods;
+        stats.sampleRate = (int)sampleRate;
+        stats.isExclusive = (AUDIO.System.device.playback.shareMode == ma_share_mode_exclusive);
+        stats.latency = (sampleRate > 0)? (float)(stats.periodSize*stats.periods)*1000.0f/sampleRate : 0.0f;
+    }
+
+    stats.callbackCount = ma_atomic_load_32(&AUDIO.Callback.count);
+    stats.callbackInterval = ma_atomic_load_f32(&AUDIO.Callback.interval);
+    stats.callbackJitter = ma_atomic_load_f32(&AUDIO.Callback.jitter);
+    stats.callbackJitterMax = ma_atomic_load_f32(&AUDIO.Callback.jitterMax);
+
+    return stats;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -575,12 +1278,18 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
         return NULL;
     }
 
-    if (sizeInFrames > 0) audioBuffer->data = (unsigned char *)RL_CALLOC(sizeInFrames*channels*ma_get_bytes_per_sample(format), 1);
+    unsigned int dataSize = sizeInFrames*channels*ma_get_bytes_per_sample(format);
+    if (sizeInFrames > 0) audioBuffer->data = (unsigned char *)RL_CALLOC(dataSize, 1);
 
     // Audio data runs through a format converter
     ma_data_converter_config converterConfig = ma_data_converter_config_init(format, AUDIO_DEVICE_FORMAT, channels, AUDIO_DEVICE_CHANNELS, sampleRate, AUDIO.System.device.sampleRate);
     converterConfig.allowDynamicSampleRate = true;
 
+    // NOTE: Resampler low-pass filter attenuates aliasing, its order defines quality and cost
+    if (AUDIO.System.resamplerQuality == AUDIO_RESAMPLER_LINEAR) converterConfig.resampling.linear.lpfOrder = 0;
+    else if (AUDIO.System.resamplerQuality == AUDIO_RESAMPLER_FILTERED) converterConfig.resampling.linear.lpfOrder = 4;
+    else converterConfig.resampling.linear.lpfOrder = MA_MAX_FILTER_ORDER;
+
     ma_result result = ma_data_converter_init(&converterConfig, NULL, &audioBuffer->converter);
 
     if (result != MA_SUCCESS)
@@ -595,6 +1304,18 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->pitch = 1.0f;
     audioBuffer->pan = 0.0f; // Center
 
+    audioBuffer->isSpatial = false;
+    audioBuffer->attenuation = AUDIO_ATTENUATION_INVERSE;
+    audioBuffer->minDistance = 1.0f;
+    audioBuffer->maxDistance = 1000.0f;
+    audioBuffer->rolloff = 1.0f;
+    audioBuffer->coneInner = -1.0f;  // No cone: 360 degrees
+    audioBuffer->coneOuter = -1.0f;
+    audioBuffer->coneOuterGain = 1.0f;
+    audioBuffer->spatialGain = 1.0f;
+    audioBuffer->spatialPan = 0.0f;
+    audioBuffer->spatialPitch = 1.0f;
+
     audioBuffer->callback = NULL;
     audioBuffer->processor = NULL;
 
@@ -606,11 +1327,14 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->frameCursorPos = 0;
     audioBuffer->framesProcessed = 0;
     audioBuffer->sizeInFrames = sizeInFrames;
+    audioBuffer->isPassthrough = IsAudioBufferPassthrough(audioBuffer, audioBuffer->converter.sampleRateOut);
 
     // Buffers should be marked as processed by default so that a call to
     // rl_UpdateAudioStream() immediately after initialization works correctly
-    audioBuffer->isSubBufferProcessed[0] = true;
-    audioBuffer->isSubBufferProcessed[1] = true;
+    audioBuffer->subBufferState[0] = AUDIO_SUBBUFFER_PROCESSED;
+    audioBuffer->subBufferState[1] = AUDIO_SUBBUFFER_PROCESSED;
+
+    UpdateAudioMemoryStats(audioBuffer, sizeof(AudioBuffer) + dataSize, false);
 
     // Track audio buffer to linked list next position
     TrackAudioBuffer(audioBuffer);
@@ -619,24 +1343,23 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
 }
 
 // Delete an audio buffer
+// NOTE: Buffer is released once audio thread removes it from the mixing list
 void UnloadAudioBuffer(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
-    {
-        UntrackAudioBuffer(buffer);
-        ma_data_converter_uninit(&buffer->converter, NULL);
-        RL_FREE(buffer->data);
-        RL_FREE(buffer);
-    }
+    if (buffer != NULL) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer, .param = 1 });
 }
 
-// Check if an audio buffer is playing from a program state without lock
+// Check if an audio buffer is playing from a program state
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = IsAudioBufferPlayingInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (buffer != NULL)
+    {
+        SyncAudioBufferState(buffer);
+        result = (buffer->requestedPlaying && !buffer->requestedPaused);
+    }
+
     return result;
 }
 
@@ -647,23 +1370,29 @@ void PlayAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
-        buffer->framesProcessed = 0;
-        buffer->isSubBufferProcessed[0] = true;
-        buffer->isSubBufferProcessed[1] = true;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        buffer->requestedPlaying = true;
+        buffer->requestedPaused = false;
+        ma_atomic_store_32(&buffer->framesProcessed, 0);
+
+        SendAudioBufferStateCommand(buffer, AUDIO_COMMAND_PLAY);
     }
 }
 
-// Stop an audio buffer from a program state without lock
+// Stop an audio buffer from a program state
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    StopAudioBufferInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (buffer != NULL)
+    {
+        SyncAudioBufferState(buffer);
+
+        if (buffer->requestedPlaying && !buffer->requestedPaused)
+        {
+            buffer->requestedPlaying = false;
+            ma_atomic_store_32(&buffer->framesProcessed, 0);
+        }
+
+        SendAudioBufferStateCommand(buffer, AUDIO_COMMAND_STOP);
+    }
 }
 
 // Pause an audio buffer
@@ -671,9 +1400,10 @@ void PauseAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = true;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        SyncAudioBufferState(buffer);
+        buffer->requestedPaused = true;
+
+        SendAudioBufferStateCommand(buffer, AUDIO_COMMAND_PAUSE);
     }
 }
 
@@ -682,39 +1412,24 @@ void ResumeAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = false;
-        ma_mutex_unlock(&AUDIO.System.lock);
+        SyncAudioBufferState(buffer);
+        buffer->requestedPaused = false;
+
+        SendAudioBufferStateCommand(buffer, AUDIO_COMMAND_RESUME);
     }
 }
 
 // Set volume for an audio buffer
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
 {
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->volume = volume;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) ma_atomic_store_f32(&buffer->volume, volume);
 }
 
 // Set pitch for an audio buffer
+// NOTE: Data converter is only accessed by audio thread, pitch is applied on next mix
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
-    if ((buffer != NULL) && (pitch > 0.0f))
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        // Pitching is just an adjustment of the sample rate
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if ((buffer != NULL) && (pitch > 0.0f)) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PITCH, .buffer = buffer, .value = pitch });
 }
 
 // Set pan for an audio buffer
@@ -723,46 +1438,20 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     if (pan < -1.0f) pan = -1.0f;
     else if (pan > 1.0f) pan = 1.0f;
 
-    if (buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        buffer->pan = pan;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (buffer != NULL) ma_atomic_store_f32(&buffer->pan, pan);
 }
 
 // Track audio buffer to linked list next position
 void TrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
-
-        AUDIO.Buffer.last = buffer;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_TRACK, .buffer = buffer });
 }
 
 // Untrack audio buffer from linked list
+// NOTE: Buffer is released once audio thread removes it, buffer data is owned by the caller
 void UntrackAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
-
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
-
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_UNTRACK, .buffer = buffer, .param = 0 });
 }
 
 //----------------------------------------------------------------------------------
@@ -774,6 +1463,8 @@ rl_Wave rl_LoadWave(const char *fileName)
 {
     rl_Wave wave = { 0 };
 
+    PROFILE_ZONE_BEGIN("rl_LoadWave");
+
     // Loading file to memory
     int dataSize = 0;
     unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
@@ -783,6 +1474,8 @@ rl_Wave rl_LoadWave(const char *fileName)
 
     rl_UnloadFileData(fileData);
 
+    PROFILE_ZONE_END();
+
     return wave;
 }
 
@@ -914,6 +1607,33 @@ bool rl_IsWaveValid(rl_Wave wave)
 // NOTE: The entire file is loaded to memory to be played (no-streaming)
 rl_Sound rl_LoadSound(const char *fileName)
 {
+    InitAudioDevicePending();
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    // Big QOA sounds are kept compressed as loaded, no encoding is required
+    if (rl_IsFileExtension(fileName, ".qoa"))
+    {
+        int dataSize = 0;
+        unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
+        qoa_desc qoa = { 0 };
+
+        if ((fileData != NULL) && (qoa_decode_header(fileData, dataSize, &qoa) > 0) && IsSoundCompressed(qoa.samples, qoa.samplerate))
+        {
+            rl_Sound sound = LoadSoundCompressed(fileData, dataSize);
+            if (sound.stream.buffer != NULL) return sound;
+        }
+
+        rl_Wave wave = { 0 };
+        if (fileData != NULL) wave = rl_LoadWaveFromMemory(".qoa", fileData, dataSize);
+        rl_UnloadFileData(fileData);
+
+        rl_Sound sound = rl_LoadSoundFromWave(wave);
+        rl_UnloadWave(wave);
+
+        return sound;
+    }
+#endif
+
     rl_Wave wave = rl_LoadWave(fileName);
 
     rl_Sound sound = rl_LoadSoundFromWave(wave);
@@ -929,6 +1649,34 @@ rl_Sound rl_LoadSoundFromWave(rl_Wave wave)
 {
     rl_Sound sound = { 0 };
 
+    InitAudioDevicePending();
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    // Big sounds are kept QOA compressed in memory and decoded on mixing
+    if ((wave.data != NULL) && (wave.channels <= QOA_MAX_CHANNELS) && IsSoundCompressed(wave.frameCount, wave.sampleRate))
+    {
+        rl_Wave waveCopy = rl_WaveCopy(wave);
+        if (waveCopy.sampleSize != 16) rl_WaveFormat(&waveCopy, waveCopy.sampleRate, 16, waveCopy.channels);
+
+        qoa_desc qoa = { 0 };
+        qoa.channels = waveCopy.channels;
+        qoa.samplerate = waveCopy.sampleRate;
+        qoa.samples = waveCopy.frameCount;
+
+        unsigned int dataSize = 0;
+        unsigned char *data = (unsigned char *)qoa_encode((const short *)waveCopy.data, &qoa, &dataSize);
+        rl_UnloadWave(waveCopy);
+
+        if (data != NULL)
+        {
+            sound = LoadSoundCompressed(data, dataSize);
+            if (sound.stream.buffer != NULL) return sound;
+
+            RL_FREE(data);
+        }
+    }
+#endif
+
     if (wave.data != NULL)
     {
         // When using miniaudio we need to do our own mixing
@@ -943,7 +1691,7 @@ rl_Sound rl_LoadSoundFromWave(rl_Wave wave)
         ma_format formatIn = ((wave.sampleSize == 8)? ma_format_u8 : ((wave.sampleSize == 16)? ma_format_s16 : ma_format_f32));
         ma_uint32 frameCountIn = wave.frameCount;
 
-        ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+        ma_uint32 frameCount = (ma_uint32)ConvertAudioFrames(NULL, 0, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, NULL, frameCountIn, formatIn, wave.channels, wave.sampleRate);
         if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed to get frame count for format conversion");
 
         AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, frameCount, AUDIO_BUFFER_USAGE_STATIC);
@@ -953,7 +1701,7 @@ rl_Sound rl_LoadSoundFromWave(rl_Wave wave)
             return sound; // early return to avoid dereferencing the audioBuffer null pointer
         }
 
-        frameCount = (ma_uint32)ma_convert_frames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
+        frameCount = (ma_uint32)ConvertAudioFrames(audioBuffer->data, frameCount, AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, wave.data, frameCountIn, formatIn, wave.channels, wave.sampleRate);
         if (frameCount == 0) TRACELOG(LOG_WARNING, "SOUND: Failed format conversion");
 
         sound.frameCount = frameCount;
@@ -974,7 +1722,9 @@ rl_Sound rl_LoadSoundAlias(rl_Sound source)
 
     if (source.stream.buffer->data != NULL)
     {
-        AudioBuffer *audioBuffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+        // NOTE: Compressed sounds data is kept on sound format, it is converted on mixing
+        ma_format format = (source.stream.sampleSize == 16)? ma_format_s16 : AUDIO_DEVICE_FORMAT;
+        AudioBuffer *audioBuffer = LoadAudioBuffer(format, source.stream.channels, source.stream.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
 
         if (audioBuffer == NULL)
         {
@@ -985,15 +1735,26 @@ rl_Sound rl_LoadSoundAlias(rl_Sound source)
         audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
         audioBuffer->data = source.stream.buffer->data;
 
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        // Compressed sound alias decodes shared QOA data on its own
+        if (source.stream.buffer->qoaSize > 0)
+        {
+            audioBuffer->qoaSize = source.stream.buffer->qoaSize;
+            audioBuffer->qoa = source.stream.buffer->qoa;
+            audioBuffer->qoaFrame = (short *)RL_CALLOC(QOA_FRAME_LEN*source.stream.channels, sizeof(short));
+            UpdateAudioMemoryStats(audioBuffer, QOA_FRAME_LEN*source.stream.channels*sizeof(short), false);
+        }
+#endif
+
         // Initalize the buffer as if it was new
         audioBuffer->volume = 1.0f;
         audioBuffer->pitch = 1.0f;
         audioBuffer->pan = 0.0f; // Center
 
         sound.frameCount = source.frameCount;
-        sound.stream.sampleRate = AUDIO.System.device.sampleRate;
-        sound.stream.sampleSize = 32;
-        sound.stream.channels = AUDIO_DEVICE_CHANNELS;
+        sound.stream.sampleRate = source.stream.sampleRate;
+        sound.stream.sampleSize = source.stream.sampleSize;
+        sound.stream.channels = source.stream.channels;
         sound.stream.buffer = audioBuffer;
     }
 
@@ -1031,12 +1792,7 @@ void rl_UnloadSound(rl_Sound sound)
 void rl_UnloadSoundAlias(rl_Sound alias)
 {
     // Untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
-    if (alias.stream.buffer != NULL)
-    {
-        UntrackAudioBuffer(alias.stream.buffer);
-        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
-        RL_FREE(alias.stream.buffer);
-    }
+    if (alias.stream.buffer != NULL) UntrackAudioBuffer(alias.stream.buffer);
 }
 
 // Update sound buffer with new data
@@ -1046,6 +1802,13 @@ void rl_UpdateSound(rl_Sound sound, const void *data, int frameCount)
 {
     if (sound.stream.buffer != NULL)
     {
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        if (sound.stream.buffer->qoaSize > 0)
+        {
+            TRACELOG(LOG_WARNING, "SOUND: Compressed sound data can not be updated");
+            return;
+        }
+#endif
         StopAudioBuffer(sound.stream.buffer);
 
         memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
@@ -1183,6 +1946,27 @@ void rl_PlaySound(rl_Sound sound)
     PlayAudioBuffer(sound.stream.buffer);
 }
 
+// Play a sound scheduled at audio device time (in seconds), see rl_GetAudioTime()
+// NOTE: Sound starts sample accurate, it is considered playing while waiting its start time,
+// commands are processed in order, so sounds scheduled before stopping are cancelled
+void rl_PlaySoundScheduled(rl_Sound sound, double time)
+{
+    AudioBuffer *buffer = sound.stream.buffer;
+
+    if (buffer != NULL)
+    {
+        buffer->requestedPlaying = true;
+        buffer->requestedPaused = false;
+        ma_atomic_store_32(&buffer->framesProcessed, 0);
+
+        // Start time already mixed plays on next mix
+        ma_uint64 frame = (time > 0.0)? (ma_uint64)(time*AUDIO.System.device.sampleRate + 0.5) : 0;
+
+        ma_atomic_fetch_add_32(&buffer->commandsPending, 1);
+        SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY, .buffer = buffer, .frame = frame });
+    }
+}
+
 // Pause a sound
 void rl_PauseSound(rl_Sound sound)
 {
@@ -1229,38 +2013,229 @@ void rl_SetSoundPan(rl_Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
-// Convert wave data to desired format
-void rl_WaveFormat(rl_Wave *wave, int sampleRate, int sampleSize, int channels)
+// Set priority for a sound, higher priority sounds are mixed first when voices are limited
+void rl_SetSoundPriority(rl_Sound sound, int priority)
 {
-    ma_format formatIn = ((wave->sampleSize == 8)? ma_format_u8 : ((wave->sampleSize == 16)? ma_format_s16 : ma_format_f32));
-    ma_format formatOut = ((sampleSize == 8)? ma_format_u8 : ((sampleSize == 16)? ma_format_s16 : ma_format_f32));
+    if (sound.stream.buffer != NULL) ma_atomic_store_i32(&sound.stream.buffer->priority, priority);
+}
 
-    ma_uint32 frameCountIn = wave->frameCount;
-    ma_uint32 frameCount = (ma_uint32)ma_convert_frames(NULL, 0, formatOut, channels, sampleRate, NULL, frameCountIn, formatIn, wave->channels, wave->sampleRate);
+// Set distance to listener for a sound, closer sounds are mixed first when voices are limited
+void rl_SetSoundDistance(rl_Sound sound, float distance)
+{
+    if (sound.stream.buffer != NULL) ma_atomic_store_f32(&sound.stream.buffer->distance, distance);
+}
 
-    if (frameCount == 0)
-    {
-        TRACELOG(LOG_WARNING, "WAVE: Failed to get frame count for format conversion");
-        return;
-    }
+// Set position for a sound, sound is spatialized relative to audio listener afterwards
+void rl_SetSoundPosition(rl_Sound sound, rl_Vector3 position)
+{
+    if (sound.stream.buffer == NULL) return;
 
-    void *data = RL_MALLOC(frameCount*channels*(sampleSize/8));
+    StoreAudioVector(sound.stream.buffer->position, position);
+    ma_atomic_store_32(&sound.stream.buffer->isSpatial, true);
+}
 
-    frameCount = (ma_uint32)ma_convert_frames(data, frameCount, formatOut, channels, sampleRate, wave->data, frameCountIn, formatIn, wave->channels, wave->sampleRate);
-    if (frameCount == 0)
+// Set velocity for a spatial sound, used for doppler effect
+void rl_SetSoundVelocity(rl_Sound sound, rl_Vector3 velocity)
+{
+    if (sound.stream.buffer != NULL) StoreAudioVector(sound.stream.buffer->velocity, velocity);
+}
+
+// Set distance attenuation for a spatial sound, distance is clamped between min and max distance
+void rl_SetSoundAttenuation(rl_Sound sound, int model, float minDistance, float maxDistance, float rolloff)
+{
+    if (sound.stream.buffer == NULL) return;
+
+    if ((model < AUDIO_ATTENUATION_NONE) || (model > AUDIO_ATTENUATION_EXPONENTIAL) || (minDistance <= 0.0f) || (maxDistance < minDistance) || (rolloff < 0.0f))
     {
-        RL_FREE(wave->data);
-        TRACELOG(LOG_WARNING, "WAVE: Failed format conversion");
+        TRACELOG(LOG_WARNING, "SOUND: Attenuation parameters not valid");
         return;
     }
 
-    wave->frameCount = frameCount;
-    wave->sampleSize = sampleSize;
-    wave->sampleRate = sampleRate;
-    wave->channels = channels;
+    ma_atomic_store_32(&sound.stream.buffer->attenuation, model);
+    ma_atomic_store_f32(&sound.stream.buffer->minDistance, minDistance);
+    ma_atomic_store_f32(&sound.stream.buffer->maxDistance, maxDistance);
+    ma_atomic_store_f32(&sound.stream.buffer->rolloff, rolloff);
+}
 
-    RL_FREE(wave->data);
-    wave->data = data;
+// Set directional cone for a spatial sound, angles are full cone angles (in degrees)
+// NOTE: Sound volume is interpolated from 1.0f inside inner angle to outerVolume outside outer angle, 360 degrees inner angle disables the cone
+void rl_SetSoundCone(rl_Sound sound, rl_Vector3 direction, float innerAngle, float outerAngle, float outerVolume)
+{
+    if (sound.stream.buffer == NULL) return;
+
+    float length = sqrtf(direction.x*direction.x + direction.y*direction.y + direction.z*direction.z);
+    float coneInner = -1.0f;
+    float coneOuter = -1.0f;
+    float coneOuterGain = 1.0f;
+
+    if ((length > 0.0f) && (innerAngle < 360.0f))
+    {
+        if (innerAngle < 0.0f) innerAngle = 0.0f;
+        if (outerAngle < innerAngle) outerAngle = innerAngle;
+        if (outerAngle > 360.0f) outerAngle = 360.0f;
+
+        // Cone angles are compared as cosines of half angles
+        coneInner = cosf(innerAngle*0.5f*(3.14159265358979323846f/180.0f));
+        coneOuter = cosf(outerAngle*0.5f*(3.14159265358979323846f/180.0f));
+        coneOuterGain = (outerVolume < 0.0f)? 0.0f : outerVolume;
+        direction = (rl_Vector3){ direction.x/length, direction.y/length, direction.z/length };
+    }
+    else direction = (rl_Vector3){ 0 };
+
+    StoreAudioVector(sound.stream.buffer->direction, direction);
+    ma_atomic_store_f32(&sound.stream.buffer->coneInner, coneInner);
+    ma_atomic_store_f32(&sound.stream.buffer->coneOuter, coneOuter);
+    ma_atomic_store_f32(&sound.stream.buffer->coneOuterGain, coneOuterGain);
+}
+
+// Convert wave data to desired format
+// NOTE: Sample size reduction is done in place, wave data is kept on failure
+void rl_WaveFormat(rl_Wave *wave, int sampleRate, int sampleSize, int channels)
+{
+    if (!FormatWave(wave, sampleRate, sampleSize, channels)) TRACELOG(LOG_WARNING, "WAVE: Failed format conversion");
+}
+
+// Normalize wave samples to peak level, in place
+// NOTE: Silent waves are kept unchanged
+void rl_WaveNormalize(rl_Wave *wave, float peak)
+{
+    if ((wave->data == NULL) || (wave->frameCount == 0) || (peak <= 0.0f)) return;
+
+    unsigned int sampleCount = wave->frameCount*wave->channels;
+    float level = 0.0f;
+
+    for (unsigned int i = 0; i < sampleCount; i++)
+    {
+        float sample = fabsf(GetWaveSample(wave, i));
+        if (sample > level) level = sample;
+    }
+
+    if (level <= 0.0f) return;
+
+    float scale = ((peak > 1.0f)? 1.0f : peak)/level;
+
+    if (wave->sampleSize == 8)
+    {
+        unsigned char *samples = (unsigned char *)wave->data;
+
+        for (unsigned int i = 0; i < sampleCount; i++)
+        {
+            float sample = roundf((samples[i] - 128)*scale) + 128.0f;
+            samples[i] = (unsigned char)((sample < 0.0f)? 0.0f : ((sample > 255.0f)? 255.0f : sample));
+        }
+    }
+    else if (wave->sampleSize == 16)
+    {
+        short *samples = (short *)wave->data;
+
+        for (unsigned int i = 0; i < sampleCount; i++)
+        {
+            float sample = roundf(samples[i]*scale);
+            samples[i] = (short)((sample < -32768.0f)? -32768.0f : ((sample > 32767.0f)? 32767.0f : sample));
+        }
+    }
+    else if (wave->sampleSize == 32)
+    {
+        float *samples = (float *)wave->data;
+
+        for (unsigned int i = 0; i < sampleCount; i++) samples[i] *= scale;
+    }
+}
+
+// Trim wave silence under level at start and end, in place
+// NOTE: A frame is silent when all its channels are under level, fully silent waves are kept unchanged
+void rl_WaveTrimSilence(rl_Wave *wave, float threshold)
+{
+    if ((wave->data == NULL) || (wave->frameCount == 0) || (threshold <= 0.0f)) return;
+
+    unsigned int initFrame = 0;
+    unsigned int finalFrame = wave->frameCount;
+
+    for (; initFrame < finalFrame; initFrame++)
+    {
+        bool silent = true;
+        for (unsigned int c = 0; (c < wave->channels) && silent; c++) silent = (fabsf(GetWaveSample(wave, initFrame*wave->channels + c)) <= threshold);
+        if (!silent) break;
+    }
+
+    if (initFrame == finalFrame) return;
+
+    for (; finalFrame > initFrame; finalFrame--)
+    {
+        bool silent = true;
+        for (unsigned int c = 0; (c < wave->channels) && silent; c++) silent = (fabsf(GetWaveSample(wave, (finalFrame - 1)*wave->channels + c)) <= threshold);
+        if (!silent) break;
+    }
+
+    if ((initFrame > 0) || (finalFrame < wave->frameCount)) rl_WaveCrop(wave, (int)initFrame, (int)finalFrame);
+}
+
+// Process waves batch in parallel: trim silence, normalize and format, waves are modified in place
+// NOTE: Every wave is processed by a single thread, waves are distributed to worker threads and caller thread
+rl_WaveProcessingStats rl_ProcessWaves(rl_Wave *waves, int count, rl_WaveProcessing processing)
+{
+    rl_WaveProcessingStats stats = { 0 };
+
+    if ((waves == NULL) || (count <= 0)) return stats;
+
+    WaveProcessingJob job = { 0 };
+    job.waves = waves;
+    job.count = count;
+    job.processing = processing;
+
+    ma_timer timer = { 0 };
+    ma_timer_init(&timer);
+
+    int threadCount = 0;
+
+#if !defined(RAUDIO_STANDALONE)
+#if defined(SUPPORT_WAVE_WORKER_THREADS)
+    // Waves are distributed to job system worker threads (shared with raylib modules and user jobs) and caller thread
+    rl_ParallelFor(ProcessWavesRange, &job, count, 1);
+
+    threadCount = rl_GetJobWorkerCount();
+    if (threadCount > (count - 1)) threadCount = count - 1;
+#else
+    ProcessWavesRange(&job, 0, count);
+#endif
+#else
+#if defined(SUPPORT_WAVE_WORKER_THREADS)
+    // One worker per additional processor, caller thread is also processing
+    // NOTE: Processors count requires POSIX sysconf(), a single worker is used otherwise (i.e. Windows)
+#if defined(_SC_NPROCESSORS_ONLN)
+    long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+#else
+    long processorCount = 2;
+#endif
+    int workerCount = (processorCount > 1)? (int)processorCount - 1 : 0;
+    if (workerCount > MAX_WAVE_WORKER_THREADS) workerCount = MAX_WAVE_WORKER_THREADS;
+    if (workerCount > (count - 1)) workerCount = count - 1;
+
+    ma_thread threads[MAX_WAVE_WORKER_THREADS];
+
+    for (; threadCount < workerCount; threadCount++)
+    {
+        if (ma_thread_create(&threads[threadCount], ma_thread_priority_normal, 0, WaveProcessingThread, &job, NULL) != MA_SUCCESS) break;
+    }
+#endif
+
+    WaveProcessingThread(&job);
+
+#if defined(SUPPORT_WAVE_WORKER_THREADS)
+    for (int i = 0; i < threadCount; i++) ma_thread_wait(&threads[i]);
+#endif
+#endif
+
+    stats.waves = count;
+    stats.failed = (int)job.failed;
+    stats.threads = threadCount + 1;
+    stats.time = (float)(ma_timer_get_time_in_seconds(&timer)*1000.0);
+    stats.frames = (long long)job.frames;
+    stats.framesPerSecond = (stats.time > 0.0f)? (float)(stats.frames*1000.0/stats.time) : 0.0f;
+
+    if (stats.failed > 0) TRACELOG(LOG_WARNING, "WAVE: Failed to process %i of %i waves", stats.failed, count);
+
+    return stats;
 }
 
 // Copy a wave to a new wave
@@ -1285,19 +2260,23 @@ rl_Wave rl_WaveCopy(rl_Wave wave)
 }
 
 // Crop a wave to defined frames range
-// NOTE: Security check in case of out-of-range
+// NOTE 1: Security check in case of out-of-range
+// NOTE 2: Frames are moved in place, data is shrunk to cropped size
 void rl_WaveCrop(rl_Wave *wave, int initFrame, int finalFrame)
 {
     if ((initFrame >= 0) && (initFrame < finalFrame) && ((unsigned int)finalFrame <= wave->frameCount))
     {
         int frameCount = finalFrame - initFrame;
+        int frameSize = wave->channels*wave->sampleSize/8;
 
-        void *data = RL_MALLOC(frameCount*wave->channels*wave->sampleSize/8);
+        if (initFrame > 0) memmove(wave->data, (unsigned char *)wave->data + initFrame*frameSize, frameCount*frameSize);
 
-        memcpy(data, (unsigned char *)wave->data + (initFrame*wave->channels*wave->sampleSize/8), frameCount*wave->channels*wave->sampleSize/8);
+        if ((unsigned int)frameCount < wave->frameCount)
+        {
+            void *data = RL_REALLOC(wave->data, frameCount*frameSize);
+            if (data != NULL) wave->data = data;
+        }
 
-        RL_FREE(wave->data);
-        wave->data = data;
         wave->frameCount = (unsigned int)frameCount;
     }
     else TRACELOG(LOG_WARNING, "WAVE: Crop range out of bounds");
@@ -1338,6 +2317,8 @@ rl_Music rl_LoadMusicStream(const char *fileName)
     rl_Music music = { 0 };
     bool musicLoaded = false;
 
+    InitAudioDevicePending();
+
     if (false) { }
 #if defined(SUPPORT_FILEFORMAT_WAV)
     else if (rl_IsFileExtension(fileName, ".wav"))
@@ -1485,6 +2466,7 @@ rl_Music rl_LoadMusicStream(const char *fileName)
     {
         jar_mod_context_t *ctxMod = (jar_mod_context_t *)RL_CALLOC(1, sizeof(jar_mod_context_t));
         jar_mod_init(ctxMod);
+        SetMusicModuleConfig(ctxMod);
         int result = jar_mod_load_file(ctxMod, fileName);
 
         if (result > 0)
@@ -1492,7 +2474,7 @@ rl_Music rl_LoadMusicStream(const char *fileName)
             music.ctxType = MUSIC_MODULE_MOD;
             music.ctxData = ctxMod;
             // NOTE: Only stereo is supported for MOD
-            music.stream = rl_LoadAudioStream(AUDIO.System.device.sampleRate, 16, AUDIO_DEVICE_CHANNELS);
+            music.stream = rl_LoadAudioStream(AUDIO.System.device.sampleRate, (AUDIO_DEVICE_FORMAT == ma_format_f32)? 32 : 16, AUDIO_DEVICE_CHANNELS);
             music.frameCount = (unsigned int)jar_mod_max_samples(ctxMod);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1524,12 +2506,16 @@ rl_Music rl_LoadMusicStream(const char *fileName)
 }
 
 // Load music stream from memory buffer, fileType refers to extension: i.e. ".wav"
+// NOTE: Data is decoded in place (not copied) for WAV, OGG, MP3, QOA and FLAC, it must be kept valid
+// until music is unloaded, so memory-mapped file regions can be streamed without any copy
 // WARNING: File extension must be provided in lower-case
 rl_Music rl_LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data, int dataSize)
 {
     rl_Music music = { 0 };
     bool musicLoaded = false;
 
+    InitAudioDevicePending();
+
     if (false) { }
 #if defined(SUPPORT_FILEFORMAT_WAV)
     else if ((strcmp(fileType, ".wav") == 0) || (strcmp(fileType, ".WAV") == 0))
@@ -1686,6 +2672,7 @@ rl_Music rl_LoadMusicStreamFromMemory(const char *fileType, const unsigned char
         int result = 0;
 
         jar_mod_init(ctxMod);
+        SetMusicModuleConfig(ctxMod);
 
         // Copy data to allocated memory for default rl_UnloadMusicStream
         unsigned char *newData = (unsigned char *)RL_MALLOC(dataSize);
@@ -1706,7 +2693,7 @@ rl_Music rl_LoadMusicStreamFromMemory(const char *fileType, const unsigned char
             music.ctxData = ctxMod;
 
             // NOTE: Only stereo is supported for MOD
-            music.stream = rl_LoadAudioStream(AUDIO.System.device.sampleRate, 16, 2);
+            music.stream = rl_LoadAudioStream(AUDIO.System.device.sampleRate, (AUDIO_DEVICE_FORMAT == ma_format_f32)? 32 : 16, AUDIO_DEVICE_CHANNELS);
             music.frameCount = (unsigned int)jar_mod_max_samples(ctxMod);    // NOTE: Always 2 channels (stereo)
             music.looping = true;   // Looping enabled by default
             musicLoaded = true;
@@ -1737,6 +2724,157 @@ rl_Music rl_LoadMusicStreamFromMemory(const char *fileType, const unsigned char
     return music;
 }
 
+// Load music stream from reader callbacks, fileType refers to extension: i.e. ".wav"
+// NOTE: WAV, MP3, QOA and FLAC are read incrementally while streaming, reader callbacks are called
+// from decoder thread on threaded music streams; other formats are read at once on loading
+rl_Music rl_LoadMusicStreamFromReader(const char *fileType, rl_AudioReader reader)
+{
+    rl_Music music = { 0 };
+    bool musicLoaded = false;
+
+    InitAudioDevicePending();
+
+    if ((reader.read == NULL) || (reader.seek == NULL) || (reader.tell == NULL))
+    {
+        TRACELOG(LOG_WARNING, "STREAM: rl_Music reader callbacks not provided");
+        return music;
+    }
+
+    AudioMusicReader *musicReader = (AudioMusicReader *)RL_CALLOC(1, sizeof(AudioMusicReader));
+    musicReader->reader = reader;
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_WAV)
+    else if ((strcmp(fileType, ".wav") == 0) || (strcmp(fileType, ".WAV") == 0))
+    {
+        drwav *ctxWav = (drwav *)RL_CALLOC(1, sizeof(drwav));
+
+        bool success = drwav_init(ctxWav, ReadMusicReader, SeekMusicReaderWav, TellMusicReader, musicReader, NULL);
+
+        if (success)
+        {
+            music.ctxType = MUSIC_AUDIO_WAV;
+            music.ctxData = ctxWav;
+            int sampleSize = ctxWav->bitsPerSample;
+            if (ctxWav->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on rl_UpdateMusicStream()
+
+            music.stream = rl_LoadAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
+            music.frameCount = (unsigned int)ctxWav->totalPCMFrameCount;
+            music.looping = true;   // Looping enabled by default
+            musicLoaded = true;
+        }
+        else
+        {
+            drwav_uninit(ctxWav);
+            RL_FREE(ctxWav);
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    else if ((strcmp(fileType, ".mp3") == 0) || (strcmp(fileType, ".MP3") == 0))
+    {
+        drmp3 *ctxMp3 = (drmp3 *)RL_CALLOC(1, sizeof(drmp3));
+        int success = drmp3_init(ctxMp3, ReadMusicReader, SeekMusicReaderMp3, TellMusicReader, NULL, musicReader, NULL);
+
+        if (success)
+        {
+            music.ctxType = MUSIC_AUDIO_MP3;
+            music.ctxData = ctxMp3;
+            music.stream = rl_LoadAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
+            music.frameCount = (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
+            music.looping = true;   // Looping enabled by default
+            musicLoaded = true;
+        }
+        else
+        {
+            drmp3_uninit(ctxMp3);
+            RL_FREE(ctxMp3);
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+    else if ((strcmp(fileType, ".qoa") == 0) || (strcmp(fileType, ".QOA") == 0))
+    {
+        qoaplay_desc *ctxQoa = qoaplay_open_callbacks(ReadMusicReaderQoa, SeekMusicReaderQoa, musicReader);
+
+        if (ctxQoa != NULL)
+        {
+            music.ctxType = MUSIC_AUDIO_QOA;
+            music.ctxData = ctxQoa;
+            // NOTE: We are loading samples are 32bit float normalized data, so,
+            // we configure the output audio stream to also use float 32bit
+            music.stream = rl_LoadAudioStream(ctxQoa->info.samplerate, 32, ctxQoa->info.channels);
+            music.frameCount = ctxQoa->info.samples;
+            music.looping = true;   // Looping enabled by default
+            musicLoaded = true;
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+    else if ((strcmp(fileType, ".flac") == 0) || (strcmp(fileType, ".FLAC") == 0))
+    {
+        drflac *ctxFlac = drflac_open(ReadMusicReader, SeekMusicReaderFlac, TellMusicReader, musicReader, NULL);
+
+        if (ctxFlac != NULL)
+        {
+            music.ctxType = MUSIC_AUDIO_FLAC;
+            music.ctxData = ctxFlac;
+            int sampleSize = ctxFlac->bitsPerSample;
+            if (ctxFlac->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on rl_UpdateMusicStream()
+            music.stream = rl_LoadAudioStream(ctxFlac->sampleRate, sampleSize, ctxFlac->channels);
+            music.frameCount = (unsigned int)ctxFlac->totalPCMFrameCount;
+            music.looping = true;   // Looping enabled by default
+            musicLoaded = true;
+        }
+    }
+#endif
+    else
+    {
+        // Formats not supporting incremental reads are read at once and decoded from memory
+        long long dataSize = 0;
+        if (reader.seek(reader.userData, 0, SEEK_END)) dataSize = reader.tell(reader.userData);
+
+        if ((dataSize > 0) && (dataSize <= INT_MAX) && reader.seek(reader.userData, 0, SEEK_SET))
+        {
+            musicReader->data = (unsigned char *)RL_MALLOC((size_t)dataSize);
+
+            if (ReadMusicReader(musicReader, musicReader->data, (size_t)dataSize) == (size_t)dataSize)
+            {
+                music = rl_LoadMusicStreamFromMemory(fileType, musicReader->data, (int)dataSize);
+            }
+        }
+
+        if (music.ctxData != NULL) music.stream.buffer->reader = musicReader;
+        else
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: rl_Music data could not be read");
+            RL_FREE(musicReader->data);
+            RL_FREE(musicReader);
+        }
+
+        return music;
+    }
+
+    if (!musicLoaded)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: rl_Music data could not be loaded from reader");
+        RL_FREE(musicReader);
+    }
+    else
+    {
+        music.stream.buffer->reader = musicReader;
+
+        // Show some music stream info
+        TRACELOG(LOG_INFO, "FILEIO: rl_Music data loaded successfully from reader");
+        TRACELOG(LOG_INFO, "    > Sample rate:   %i Hz", music.stream.sampleRate);
+        TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
+        TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
+        TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+    }
+
+    return music;
+}
+
 // Checks if a music stream is valid (context and buffers initialized)
 bool rl_IsMusicValid(rl_Music music)
 {
@@ -1750,13 +2888,17 @@ bool rl_IsMusicValid(rl_Music music)
 // Unload music stream
 void rl_UnloadMusicStream(rl_Music music)
 {
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->requestedDecoder != NULL)) rl_SetMusicStreamThreaded(music, false);
+
+    AudioMusicReader *reader = (music.stream.buffer != NULL)? music.stream.buffer->reader : NULL;
+
     rl_UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
     {
         if (false) { }
 #if defined(SUPPORT_FILEFORMAT_WAV)
-        else if (music.ctxType == MUSIC_AUDIO_WAV) drwav_uninit((drwav *)music.ctxData);
+        else if (music.ctxType == MUSIC_AUDIO_WAV) { drwav_uninit((drwav *)music.ctxData); RL_FREE(music.ctxData); }
 #endif
 #if defined(SUPPORT_FILEFORMAT_OGG)
         else if (music.ctxType == MUSIC_AUDIO_OGG) stb_vorbis_close((stb_vorbis *)music.ctxData);
@@ -1768,7 +2910,7 @@ void rl_UnloadMusicStream(rl_Music music)
         else if (music.ctxType == MUSIC_AUDIO_QOA) qoaplay_close((qoaplay_desc *)music.ctxData);
 #endif
 #if defined(SUPPORT_FILEFORMAT_FLAC)
-        else if (music.ctxType == MUSIC_AUDIO_FLAC) { drflac_close((drflac *)music.ctxData); drflac_free((drflac *)music.ctxData, NULL); }
+        else if (music.ctxType == MUSIC_AUDIO_FLAC) drflac_close((drflac *)music.ctxData);   // NOTE: Context is freed on close
 #endif
 #if defined(SUPPORT_FILEFORMAT_XM)
         else if (music.ctxType == MUSIC_MODULE_XM) jar_xm_free_context((jar_xm_context_t *)music.ctxData);
@@ -1777,6 +2919,13 @@ void rl_UnloadMusicStream(rl_Music music)
         else if (music.ctxType == MUSIC_MODULE_MOD) { jar_mod_unload((jar_mod_context_t *)music.ctxData); RL_FREE(music.ctxData); }
 #endif
     }
+
+    // Reader is released after context, decoders could read on uninit
+    if (reader != NULL)
+    {
+        RL_FREE(reader->data);
+        RL_FREE(reader);
+    }
 }
 
 // Start music playing (open stream) from beginning
@@ -1802,31 +2951,18 @@ void rl_StopMusicStream(rl_Music music)
 {
     rl_StopAudioStream(music.stream);
 
-    switch (music.ctxType)
+    AudioMusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->requestedDecoder : NULL;
+
+    if (decoder != NULL)
     {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
+        // Decoder thread discards music decoded ahead and decodes from start
+        LockAudioMusic();
+        RewindMusicStream(music);
+        decoder->framesDecoded = 0;
+        ma_atomic_store_32(&decoder->generation, decoder->generation + 1);
+        ma_mutex_unlock(&AUDIO.Music.lock);
     }
+    else RewindMusicStream(music);
 }
 
 // Seek music to a certain position (in seconds)
@@ -1836,6 +2972,9 @@ void rl_SeekMusicStream(rl_Music music, float position)
     if ((music.ctxType == MUSIC_MODULE_XM) || (music.ctxType == MUSIC_MODULE_MOD)) return;
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
+    AudioMusicDecoder *decoder = music.stream.buffer->requestedDecoder;
+
+    if (decoder != NULL) LockAudioMusic();
 
     switch (music.ctxType)
     {
@@ -1864,20 +3003,35 @@ void rl_SeekMusicStream(rl_Music music, float position)
         default: break;
     }
 
-    ma_mutex_lock(&AUDIO.System.lock);
-    music.stream.buffer->framesProcessed = positionInFrames;
-    music.stream.buffer->isSubBufferProcessed[0] = true;
-    music.stream.buffer->isSubBufferProcessed[1] = true;
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (decoder != NULL)
+    {
+        // Decoder thread discards music decoded ahead and decodes from new position,
+        // audio thread discards sub-buffers data once music decoded from new position is available
+        decoder->framesDecoded = positionInFrames;
+        ma_atomic_store_32(&decoder->generation, decoder->generation + 1);
+        ma_mutex_unlock(&AUDIO.Music.lock);
+    }
+    else
+    {
+        ma_atomic_store_32(&music.stream.buffer->framesProcessed, positionInFrames);
+        SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_FLUSH, .buffer = music.stream.buffer });
+    }
 }
 
 // Update (re-fill) music buffers if data already processed
 void rl_UpdateMusicStream(rl_Music music)
 {
     if (music.stream.buffer == NULL) return;
-    if (!music.stream.buffer->playing) return;
 
-    ma_mutex_lock(&AUDIO.System.lock);
+    // Threaded music is decoded by decoder thread, only music looping is synced
+    if (music.stream.buffer->requestedDecoder != NULL)
+    {
+        ma_atomic_store_32(&music.stream.buffer->requestedDecoder->looping, music.looping);
+        return;
+    }
+
+    SyncAudioBufferState(music.stream.buffer);
+    if (!music.stream.buffer->requestedPlaying) return;
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
@@ -1895,7 +3049,7 @@ void rl_UpdateMusicStream(rl_Music music)
     // Check both sub-buffers to check if they require refilling
     for (int i = 0; i < 2; i++)
     {
-        unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
+        unsigned int framesLeft = music.frameCount - ma_atomic_load_32(&music.stream.buffer->framesProcessed);  // Frames left to be processed
         unsigned int framesToStream = 0;                 // Total frames to be streamed
 
         if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
@@ -1904,134 +3058,91 @@ void rl_UpdateMusicStream(rl_Music music)
         if (framesToStream == 0)
         {
             // Check if both buffers have been processed
-            if (music.stream.buffer->isSubBufferProcessed[0] && music.stream.buffer->isSubBufferProcessed[1])
-            {
-                ma_mutex_unlock(&AUDIO.System.lock);
-                rl_StopMusicStream(music);
-                return;
-            }
+            if ((ma_atomic_load_32(&music.stream.buffer->subBufferState[0]) == AUDIO_SUBBUFFER_PROCESSED) &&
+                (ma_atomic_load_32(&music.stream.buffer->subBufferState[1]) == AUDIO_SUBBUFFER_PROCESSED)) rl_StopMusicStream(music);
 
-            ma_mutex_unlock(&AUDIO.System.lock);
             return;
         }
 
-        if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
+        if (ma_atomic_load_32(&music.stream.buffer->subBufferState[i]) != AUDIO_SUBBUFFER_PROCESSED) continue; // No refilling required, move to next sub-buffer
 
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
+        ReadMusicStreamFrames(music, AUDIO.System.pcmBuffer, framesToStream);
 
-        switch (music.ctxType)
+        UpdateAudioStreamSubBuffer(music.stream, i, AUDIO.System.pcmBuffer, framesToStream);
+    }
+}
+
+// Set music decoding on decoder thread, music is decoded ahead and audio thread refills stream sub-buffers
+// NOTE: rl_UpdateMusicStream() is not required for threaded music, it only syncs music looping
+void rl_SetMusicStreamThreaded(rl_Music music, bool threaded)
+{
+    AudioBuffer *buffer = music.stream.buffer;
+
+    if ((buffer == NULL) || (music.ctxData == NULL) || (threaded == (buffer->requestedDecoder != NULL))) return;
+
+    if (threaded)
+    {
+        // Decoder thread is started with first threaded music
+        if (!AUDIO.Music.isRunning)
         {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
+            if (ma_mutex_init(&AUDIO.Music.lock) != MA_SUCCESS)
             {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
+                TRACELOG(LOG_WARNING, "STREAM: Failed to initialize music decoder lock");
+                return;
+            }
+
+            AUDIO.Music.isRunning = true;
+
+            if (ma_thread_create(&AUDIO.Music.thread, ma_thread_priority_normal, 0, MusicDecoderThread, NULL, NULL) != MA_SUCCESS)
             {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+                AUDIO.Music.isRunning = false;
+                ma_mutex_uninit(&AUDIO.Music.lock);
+                TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder thread");
+                return;
+            }
 
-            } break;
-        #endif
-            default: break;
+            TRACELOG(LOG_INFO, "STREAM: Music decoder thread started");
         }
 
-        UpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
+        int frameSize = music.stream.channels*music.stream.sampleSize/8;
+        AudioMusicDecoder *decoder = (AudioMusicDecoder *)RL_CALLOC(1, sizeof(AudioMusicDecoder));
+
+        decoder->data = (unsigned char *)RL_CALLOC(AUDIO_MUSIC_DECODE_BUFFERS*(buffer->sizeInFrames/2), frameSize);
+        decoder->music = music;
+        decoder->generation = 1;
+        decoder->looping = music.looping;
+
+        // Decoding continues from last music position sent to audio stream
+        decoder->framesDecoded = ma_atomic_load_32(&buffer->framesProcessed);
+        if (music.looping) decoder->framesDecoded %= music.frameCount;
+
+        LockAudioMusic();
+        decoder->next = AUDIO.Music.first;
+        AUDIO.Music.first = decoder;
+        ma_mutex_unlock(&AUDIO.Music.lock);
+
+        buffer->requestedDecoder = decoder;
+        SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DECODER, .buffer = buffer, .decoder = decoder });
     }
+    else
+    {
+        // Decoder is released once audio thread stops using it, music decoded ahead is discarded
+        if (AUDIO.Music.isRunning) LockAudioMusic();
+
+        for (AudioMusicDecoder **decoder = &AUDIO.Music.first; *decoder != NULL; decoder = &(*decoder)->next)
+        {
+            if (*decoder == buffer->requestedDecoder)
+            {
+                *decoder = buffer->requestedDecoder->next;
+                break;
+            }
+        }
+
+        if (AUDIO.Music.isRunning) ma_mutex_unlock(&AUDIO.Music.lock);
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+        buffer->requestedDecoder = NULL;
+        SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DECODER, .buffer = buffer, .decoder = NULL });
+    }
 }
 
 // Check if any music is playing
@@ -2078,26 +3189,27 @@ float rl_GetMusicTimePlayed(rl_Music music)
         if (music.ctxType == MUSIC_MODULE_XM)
         {
             uint64_t framesPlayed = 0;
+            AudioMusicDecoder *decoder = music.stream.buffer->requestedDecoder;
 
+            if (decoder != NULL) LockAudioMusic();
             jar_xm_get_position((jar_xm_context_t *)music.ctxData, NULL, NULL, NULL, &framesPlayed);
+            if (decoder != NULL) ma_mutex_unlock(&AUDIO.Music.lock);
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
         }
         else
 #endif
         {
-            ma_mutex_lock(&AUDIO.System.lock);
             //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
-            int framesProcessed = (int)music.stream.buffer->framesProcessed;
+            int framesProcessed = (int)ma_atomic_load_32(&music.stream.buffer->framesProcessed);
             int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
+            int framesInFirstBuffer = (ma_atomic_load_32(&music.stream.buffer->subBufferState[0]) == AUDIO_SUBBUFFER_PROCESSED)? 0 : subBufferSize;
+            int framesInSecondBuffer = (ma_atomic_load_32(&music.stream.buffer->subBufferState[1]) == AUDIO_SUBBUFFER_PROCESSED)? 0 : subBufferSize;
             int framesInBuffers = framesInFirstBuffer + framesInSecondBuffer;
             if (((unsigned int)framesInBuffers > music.frameCount) && !music.looping) framesInBuffers = music.frameCount;
-            int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
+            int framesSentToMix = ma_atomic_load_32(&music.stream.buffer->frameCursorPos)%subBufferSize;
             int framesPlayed = (framesProcessed - framesInBuffers + framesSentToMix)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
-            ma_mutex_unlock(&AUDIO.System.lock);
         }
     }
 
@@ -2109,31 +3221,56 @@ rl_AudioStream rl_LoadAudioStream(unsigned int sampleRate, unsigned int sampleSi
 {
     rl_AudioStream stream = { 0 };
 
+    InitAudioDevicePending();
+
     stream.sampleRate = sampleRate;
     stream.sampleSize = sampleSize;
     stream.channels = channels;
 
     ma_format formatIn = ((stream.sampleSize == 8)? ma_format_u8 : ((stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
 
-    // The size of a streaming buffer must be at least double the size of a period
-    unsigned int periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+    // Create a double audio buffer of defined size
+    stream.buffer = LoadAudioBuffer(formatIn, stream.channels, stream.sampleRate, GetAudioStreamSubBufferSize()*2, AUDIO_BUFFER_USAGE_STREAM);
 
-    // If the buffer is not set, compute one that would give us a buffer good enough for a decent frame rate at the device bit size/rate
-    int deviceBitsPerSample = AUDIO.System.device.playback.format;
-    if (deviceBitsPerSample > 4)  deviceBitsPerSample = 4;
-    deviceBitsPerSample *= AUDIO.System.device.playback.channels;
+    if (stream.buffer != NULL)
+    {
+        stream.buffer->looping = true;    // Always loop for streaming buffers
+        TRACELOG(LOG_INFO, "STREAM: Initialized successfully (%i Hz, %i bit, %s)", stream.sampleRate, stream.sampleSize, (stream.channels == 1)? "Mono" : "Stereo");
+    }
+    else TRACELOG(LOG_WARNING, "STREAM: Failed to load audio buffer, stream could not be created");
 
-    unsigned int subBufferSize = (AUDIO.Buffer.defaultSize == 0)? (AUDIO.System.device.sampleRate/30*deviceBitsPerSample) : AUDIO.Buffer.defaultSize;
+    return stream;
+}
 
-    if (subBufferSize < periodSize) subBufferSize = periodSize;
+// Load audio stream with lock-free ring buffer, frames are written in place with rl_BeginAudioStreamWrite()
+// NOTE: Ring size is rounded up to a power of two, at least double the size of a period (0: default streams size)
+rl_AudioStream rl_LoadAudioStreamRing(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int sizeInFrames)
+{
+    rl_AudioStream stream = { 0 };
 
-    // Create a double audio buffer of defined size
-    stream.buffer = LoadAudioBuffer(formatIn, stream.channels, stream.sampleRate, subBufferSize*2, AUDIO_BUFFER_USAGE_STREAM);
+    InitAudioDevicePending();
+
+    stream.sampleRate = sampleRate;
+    stream.sampleSize = sampleSize;
+    stream.channels = channels;
+
+    ma_format formatIn = ((stream.sampleSize == 8)? ma_format_u8 : ((stream.sampleSize == 16)? ma_format_s16 : ma_format_f32));
+
+    unsigned int periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+    if (sizeInFrames == 0) sizeInFrames = GetAudioStreamSubBufferSize()*2;
+    if (sizeInFrames < periodSize*2) sizeInFrames = periodSize*2;
+
+    // Frames counters wrap around consistently with power of two sizes
+    unsigned int ringSize = 1;
+    while ((ringSize < sizeInFrames) && (ringSize < 0x40000000)) ringSize <<= 1;
+
+    stream.buffer = LoadAudioBuffer(formatIn, stream.channels, stream.sampleRate, ringSize, AUDIO_BUFFER_USAGE_STREAM);
 
     if (stream.buffer != NULL)
     {
         stream.buffer->looping = true;    // Always loop for streaming buffers
-        TRACELOG(LOG_INFO, "STREAM: Initialized successfully (%i Hz, %i bit, %s)", stream.sampleRate, stream.sampleSize, (stream.channels == 1)? "Mono" : "Stereo");
+        stream.buffer->isRing = true;
+        TRACELOG(LOG_INFO, "STREAM: Initialized successfully (%i Hz, %i bit, %s, ring: %i frames)", stream.sampleRate, stream.sampleSize, (stream.channels == 1)? "Mono" : "Stereo", ringSize);
     }
     else TRACELOG(LOG_WARNING, "STREAM: Failed to load audio buffer, stream could not be created");
 
@@ -2160,25 +3297,85 @@ void rl_UnloadAudioStream(rl_AudioStream stream)
 // Update audio stream buffers with data
 // NOTE 1: Only updates one buffer of the stream source: dequeue -> update -> queue
 // NOTE 2: To dequeue a buffer it needs to be processed: rl_IsAudioStreamProcessed()
+// NOTE 3: Ring streams get data copied to ring, no sub-buffer required
 void rl_UpdateAudioStream(rl_AudioStream stream, const void *data, int frameCount)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    UpdateAudioStreamInLockedState(stream, data, frameCount);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (stream.buffer != NULL)
+    {
+        if (stream.buffer->isRing) UpdateAudioStreamRing(stream, data, frameCount);
+        // Update the first processed sub-buffer, if both are processed audio thread moves the cursor back to the front
+        else if (ma_atomic_load_32(&stream.buffer->subBufferState[0]) == AUDIO_SUBBUFFER_PROCESSED) UpdateAudioStreamSubBuffer(stream, 0, data, frameCount);
+        else if (ma_atomic_load_32(&stream.buffer->subBufferState[1]) == AUDIO_SUBBUFFER_PROCESSED) UpdateAudioStreamSubBuffer(stream, 1, data, frameCount);
+        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+    }
 }
 
 // Check if any audio stream buffers requires refill
+// NOTE: Ring streams require refill when half of the ring is free
 bool rl_IsAudioStreamProcessed(rl_AudioStream stream)
 {
     if (stream.buffer == NULL) return false;
 
-    bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (stream.buffer->isRing) return ((unsigned int)rl_GetAudioStreamQueuedFrames(stream) <= stream.buffer->sizeInFrames/2);
+
+    bool result = ((ma_atomic_load_32(&stream.buffer->subBufferState[0]) == AUDIO_SUBBUFFER_PROCESSED) ||
+                   (ma_atomic_load_32(&stream.buffer->subBufferState[1]) == AUDIO_SUBBUFFER_PROCESSED));
+
     return result;
 }
 
+// Begin ring audio stream write, returns pointer to ring frames to be written in place
+// NOTE 1: frameCount is requested frames (0: all) and it is set to contiguous frames writable, ring end splits writes
+// NOTE 2: Ring frames are owned by program thread until rl_EndAudioStreamWrite(), only one writer is supported
+void *rl_BeginAudioStreamWrite(rl_AudioStream stream, int *frameCount)
+{
+    if ((stream.buffer == NULL) || !stream.buffer->isRing)
+    {
+        if (frameCount != NULL) *frameCount = 0;
+        return NULL;
+    }
+
+    AudioBuffer *buffer = stream.buffer;
+    ma_uint32 write = buffer->ringWrite;
+    ma_uint32 available = buffer->sizeInFrames - (write - ma_atomic_load_32(&buffer->ringRead));
+    ma_uint32 offset = write & (buffer->sizeInFrames - 1);
+
+    ma_uint32 framesWritable = buffer->sizeInFrames - offset;
+    if (framesWritable > available) framesWritable = available;
+    if ((frameCount != NULL) && (*frameCount > 0) && ((ma_uint32)*frameCount < framesWritable)) framesWritable = (ma_uint32)*frameCount;
+
+    if (frameCount != NULL) *frameCount = (int)framesWritable;
+
+    return buffer->data + offset*ma_get_bytes_per_frame(buffer->converter.formatIn, buffer->converter.channelsIn);
+}
+
+// End ring audio stream write, frames written are committed to be played
+void rl_EndAudioStreamWrite(rl_AudioStream stream, int frameCount)
+{
+    if ((stream.buffer == NULL) || !stream.buffer->isRing || (frameCount <= 0)) return;
+
+    AudioBuffer *buffer = stream.buffer;
+    ma_uint32 write = buffer->ringWrite;
+    ma_uint32 available = buffer->sizeInFrames - (write - ma_atomic_load_32(&buffer->ringRead));
+
+    if ((ma_uint32)frameCount > available)
+    {
+        TRACELOG(LOG_WARNING, "STREAM: Attempting to commit more frames than available on ring");
+        frameCount = (int)available;
+    }
+
+    ma_atomic_fetch_add_32(&buffer->framesProcessed, frameCount);
+    ma_atomic_store_32(&buffer->ringWrite, write + (ma_uint32)frameCount);
+}
+
+// Get ring audio stream frames written and not yet played
+int rl_GetAudioStreamQueuedFrames(rl_AudioStream stream)
+{
+    if ((stream.buffer == NULL) || !stream.buffer->isRing) return 0;
+
+    return (int)(ma_atomic_load_32(&stream.buffer->ringWrite) - ma_atomic_load_32(&stream.buffer->ringRead));
+}
+
 // Play audio stream
 void rl_PlayAudioStream(rl_AudioStream stream)
 {
@@ -2236,12 +3433,7 @@ void rl_SetAudioStreamBufferSizeDefault(int size)
 // Audio thread callback to request new data
 void rl_SetAudioStreamCallback(rl_AudioStream stream, AudioCallback callback)
 {
-    if (stream.buffer != NULL)
-    {
-        ma_mutex_lock(&AUDIO.System.lock);
-        stream.buffer->callback = callback;
-        ma_mutex_unlock(&AUDIO.System.lock);
-    }
+    if (stream.buffer != NULL) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_CALLBACK, .buffer = stream.buffer, .callback = callback });
 }
 
 // Add processor to audio stream. Contrary to buffers, the order of processors is important
@@ -2249,105 +3441,231 @@ void rl_SetAudioStreamCallback(rl_AudioStream stream, AudioCallback callback)
 // a given stream, we iterate through the list to find the end. That way we don't need a pointer to the last element
 void rl_AttachAudioStreamProcessor(rl_AudioStream stream, AudioCallback process)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if (stream.buffer == NULL) return;
+
+    rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
+    processor->process = process;
+
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH, .buffer = stream.buffer, .processor = processor });
+}
+
+// Remove processor from audio stream
+void rl_DetachAudioStreamProcessor(rl_AudioStream stream, AudioCallback process)
+{
+    if (stream.buffer != NULL) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH, .buffer = stream.buffer, .callback = process });
+}
 
+// Add processor to audio pipeline. Order of processors is important
+// Works the same way as {Attach,Detach}AudioStreamProcessor() functions, except
+// these two work on the already mixed output just before sending it to the sound hardware
+void rl_AttachAudioMixedProcessor(AudioCallback process)
+{
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = stream.buffer->processor;
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH, .buffer = NULL, .processor = processor });
+}
+
+// Remove processor from audio pipeline
+void rl_DetachAudioMixedProcessor(AudioCallback process)
+{
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH, .buffer = NULL, .callback = process });
+}
+
+// Load audio bus, routed to master output
+// NOTE: Sounds and streams routed to a bus are mixed together, bus effects are processed once for all of them
+rl_AudioBus rl_LoadAudioBus(void)
+{
+    InitAudioDevicePending();
+
+    rl_AudioBus bus = { 0 };
+    rAudioBus *audioBus = (rAudioBus *)RL_CALLOC(1, sizeof(rAudioBus));
+
+    if (audioBus == NULL)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate memory for bus");
+        return bus;
+    }
+
+    ma_biquad_config filterConfig = ma_biquad_config_init(ma_format_f32, AUDIO_DEVICE_CHANNELS, 1.0, 0.0, 0.0, 1.0, 0.0, 0.0);
+    if (ma_biquad_init(&filterConfig, NULL, &audioBus->filter) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to initialize bus filter");
+        RL_FREE(audioBus);
+        return bus;
+    }
+
+    // Reverb delay lines are sized for device sample rate
+    ma_uint32 sampleRate = (AUDIO.System.isReady)? AUDIO.System.device.sampleRate : 0;
+    if (sampleRate == 0) sampleRate = 48000;
 
-    while (last && last->next)
+    int reverbSize = 0;
+    for (int i = 0; i < 12; i++) reverbSize += 2*(int)(reverbTunings[i]*(float)sampleRate/44100.0f) + AUDIO_REVERB_STEREO_SPREAD;
+
+    audioBus->reverbData = (float *)RL_CALLOC(reverbSize, sizeof(float));
+    if (audioBus->reverbData == NULL)
     {
-        last = last->next;
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate memory for bus reverb");
+        ma_biquad_uninit(&audioBus->filter, NULL);
+        RL_FREE(audioBus);
+        return bus;
     }
-    if (last)
+
+    float *reverbLine = audioBus->reverbData;
+    for (int c = 0; c < 2; c++)
     {
-        processor->prev = last;
-        last->next = processor;
+        for (int i = 0; i < 12; i++)
+        {
+            // Right channel lines are slightly longer for stereo spread
+            AudioReverbLine *line = (i < 8)? &audioBus->reverbCombs[c][i] : &audioBus->reverbAllpasses[c][i - 8];
+            line->buffer = reverbLine;
+            line->length = (int)(reverbTunings[i]*(float)sampleRate/44100.0f) + c*AUDIO_REVERB_STEREO_SPREAD;
+            reverbLine += line->length;
+        }
     }
-    else stream.buffer->processor = processor;
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    audioBus->volume = 1.0f;
+    audioBus->mixVolume = 1.0f;
+    audioBus->filterResonance = 0.7071f;
+    audioBus->compressorRatio = 1.0f;
+
+    audioBus->loadedNext = AUDIO.Bus.loaded;
+    AUDIO.Bus.loaded = audioBus;
+
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_BUS_ADD, .bus = audioBus });
+
+    bus.bus = audioBus;
+
+    return bus;
 }
 
-// Remove processor from audio stream
-void rl_DetachAudioStreamProcessor(rl_AudioStream stream, AudioCallback process)
+// Checks if an audio bus is valid
+bool rl_IsAudioBusValid(rl_AudioBus bus)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    return (bus.bus != NULL);
+}
 
-    rAudioProcessor *processor = stream.buffer->processor;
+// Unload audio bus, sounds and buses routed to it are routed to its output
+void rl_UnloadAudioBus(rl_AudioBus bus)
+{
+    if (bus.bus == NULL) return;
 
-    while (processor)
+    // Keep routing requested by program thread in sync, used to avoid routing cycles
+    for (rAudioBus *audioBus = AUDIO.Bus.loaded; audioBus != NULL; audioBus = audioBus->loadedNext)
     {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
+        if (audioBus->requestedOutput == bus.bus) audioBus->requestedOutput = bus.bus->requestedOutput;
+    }
 
-        if (processor->process == process)
-        {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
+    rAudioBus **loaded = &AUDIO.Bus.loaded;
+    while (*loaded != bus.bus) loaded = &(*loaded)->loadedNext;
+    *loaded = bus.bus->loadedNext;
 
-            RL_FREE(processor);
-        }
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_BUS_REMOVE, .bus = bus.bus });
+}
+
+// Set audio bus output, routed to another bus or to master output ({ 0 })
+// NOTE: Routing creating a cycle is not allowed
+void rl_SetAudioBusOutput(rl_AudioBus bus, rl_AudioBus output)
+{
+    if (bus.bus == NULL) return;
 
-        processor = next;
+    for (rAudioBus *audioBus = output.bus; audioBus != NULL; audioBus = audioBus->requestedOutput)
+    {
+        if (audioBus == bus.bus)
+        {
+            TRACELOG(LOG_WARNING, "AUDIO: Bus output can not be routed to itself");
+            return;
+        }
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    bus.bus->requestedOutput = output.bus;
+
+    SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_BUS_OUTPUT, .bus = bus.bus, .output = output.bus });
 }
 
-// Add processor to audio pipeline. Order of processors is important
-// Works the same way as {Attach,Detach}AudioStreamProcessor() functions, except
-// these two work on the already mixed output just before sending it to the sound hardware
-void rl_AttachAudioMixedProcessor(AudioCallback process)
+// Set volume for an audio bus (1.0 is base level)
+void rl_SetAudioBusVolume(rl_AudioBus bus, float volume)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
-    processor->process = process;
+    if (bus.bus != NULL) ma_atomic_store_f32(&bus.bus->volume, volume);
+}
 
-    rAudioProcessor *last = AUDIO.mixedProcessor;
+// Set audio bus filter, frequency in Hz and resonance as filter Q (0.707 for a flat response)
+void rl_SetAudioBusFilter(rl_AudioBus bus, int type, float frequency, float resonance)
+{
+    if (bus.bus == NULL) return;
 
-    while (last && last->next)
+    if ((type < AUDIO_FILTER_NONE) || (type > AUDIO_FILTER_BANDPASS) || (frequency <= 0.0f) || (resonance <= 0.0f))
     {
-        last = last->next;
+        TRACELOG(LOG_WARNING, "AUDIO: Bus filter parameters not valid");
+        return;
     }
-    if (last)
+
+    ma_atomic_store_32(&bus.bus->filterType, type);
+    ma_atomic_store_f32(&bus.bus->filterFrequency, frequency);
+    ma_atomic_store_f32(&bus.bus->filterResonance, resonance);
+    ma_atomic_fetch_add_32(&bus.bus->version, 1);
+}
+
+// Set audio bus compressor, threshold in dB, attack and release times in milliseconds
+// NOTE: Ratio of 1.0 disables the compressor
+void rl_SetAudioBusCompressor(rl_AudioBus bus, float threshold, float ratio, float attack, float release)
+{
+    if (bus.bus == NULL) return;
+
+    if ((ratio < 1.0f) || (attack < 0.0f) || (release < 0.0f))
     {
-        processor->prev = last;
-        last->next = processor;
+        TRACELOG(LOG_WARNING, "AUDIO: Bus compressor parameters not valid");
+        return;
     }
-    else AUDIO.mixedProcessor = processor;
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_atomic_store_f32(&bus.bus->compressorThreshold, threshold);
+    ma_atomic_store_f32(&bus.bus->compressorRatio, ratio);
+    ma_atomic_store_f32(&bus.bus->compressorAttack, attack);
+    ma_atomic_store_f32(&bus.bus->compressorRelease, release);
+    ma_atomic_fetch_add_32(&bus.bus->version, 1);
 }
 
-// Remove processor from audio pipeline
-void rl_DetachAudioMixedProcessor(AudioCallback process)
+// Set audio bus reverb, room size and damping in [0..1] range
+// NOTE: Mix is reverb level relative to dry level, mix of 0.0 disables the reverb
+void rl_SetAudioBusReverb(rl_AudioBus bus, float roomSize, float damping, float mix)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
+    if (bus.bus == NULL) return;
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
-
-    while (processor)
+    if ((roomSize < 0.0f) || (roomSize > 1.0f) || (damping < 0.0f) || (damping > 1.0f) || (mix < 0.0f) || (mix > 1.0f))
     {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
+        TRACELOG(LOG_WARNING, "AUDIO: Bus reverb parameters not valid");
+        return;
+    }
 
-        if (processor->process == process)
-        {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
+    ma_atomic_store_f32(&bus.bus->reverbRoomSize, roomSize);
+    ma_atomic_store_f32(&bus.bus->reverbDamping, damping);
+    ma_atomic_store_f32(&bus.bus->reverbMix, mix);
+    ma_atomic_fetch_add_32(&bus.bus->version, 1);
+}
 
-            RL_FREE(processor);
-        }
+// Get audio bus processing time on last audio callback (in milliseconds)
+// NOTE: Bus effects and mixing to its output are measured, sounds mixed to the bus are not
+float rl_GetAudioBusMixTime(rl_AudioBus bus)
+{
+    return (bus.bus != NULL)? ma_atomic_load_f32(&bus.bus->mixTime) : 0.0f;
+}
 
-        processor = next;
-    }
+// Set audio bus for an audio stream, routed to master output by default ({ 0 })
+void rl_SetAudioStreamBus(rl_AudioStream stream, rl_AudioBus bus)
+{
+    if (stream.buffer != NULL) SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_BUS_ROUTE, .buffer = stream.buffer, .output = bus.bus });
+}
+
+// Set audio bus for a sound
+void rl_SetSoundBus(rl_Sound sound, rl_AudioBus bus)
+{
+    rl_SetAudioStreamBus(sound.stream, bus);
+}
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+// Set audio bus for a music
+void rl_SetMusicBus(rl_Music music, rl_AudioBus bus)
+{
+    rl_SetAudioStreamBus(music.stream, bus);
 }
 
 //----------------------------------------------------------------------------------
@@ -2366,21 +3684,27 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     if (audioBuffer->callback)
     {
         audioBuffer->callback(framesOut, frameCount);
-        audioBuffer->framesProcessed += frameCount;
+        ma_atomic_fetch_add_32(&audioBuffer->framesProcessed, frameCount);
 
         return frameCount;
     }
 
+    // Ring streams frames are read up to frames written
+    if (audioBuffer->isRing) return ReadAudioRingFrames(audioBuffer, framesOut, frameCount);
+
+    // Threaded music sub-buffers are refilled with music decoded ahead
+    if (audioBuffer->decoder != NULL) UpdateAudioBufferFromDecoder(audioBuffer);
+
     ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
     ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
 
     if (currentSubBufferIndex > 1) return 0;
 
-    // Another thread can update the processed state of buffers, so
-    // we just take a copy here to try and avoid potential synchronization problems
+    // Sub-buffers are only handed to audio thread through submit commands, so
+    // we just take a copy here of the ones pending to be processed
     bool isSubBufferProcessed[2] = { 0 };
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+    isSubBufferProcessed[0] = (ma_atomic_load_32(&audioBuffer->subBufferState[0]) != AUDIO_SUBBUFFER_PENDING);
+    isSubBufferProcessed[1] = (ma_atomic_load_32(&audioBuffer->subBufferState[1]) != AUDIO_SUBBUFFER_PENDING);
 
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
@@ -2418,14 +3742,19 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         ma_uint32 framesToRead = totalFramesRemaining;
         if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
 
-        memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
-        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+        const unsigned char *framesIn = audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes);
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        // Compressed sounds are decoded one QOA frame at a time
+        if (audioBuffer->qoaSize > 0) framesIn = (const unsigned char *)DecodeAudioBufferFrames(audioBuffer, &framesToRead);
+#endif
+        memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), framesIn, framesToRead*frameSizeInBytes);
+        ma_atomic_store_32(&audioBuffer->frameCursorPos, (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames);
         framesRead += framesToRead;
 
         // If we've read to the end of the buffer, mark it as processed
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
+            ma_atomic_store_32(&audioBuffer->subBufferState[currentSubBufferIndex], AUDIO_SUBBUFFER_PROCESSED);
             isSubBufferProcessed[currentSubBufferIndex] = true;
 
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
@@ -2433,7 +3762,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
             // We need to break from this loop if we're not looping
             if (!audioBuffer->looping)
             {
-                StopAudioBufferInLockedState(audioBuffer);
+                StopAudioBufferInAudioThread(audioBuffer);
                 break;
             }
         }
@@ -2445,6 +3774,9 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     {
         memset((unsigned char *)framesOut + (framesRead*frameSizeInBytes), 0, totalFramesRemaining*frameSizeInBytes);
 
+        // Playing stream ran out of sub-buffers filled, program thread did not update it in time
+        if ((audioBuffer->usage != AUDIO_BUFFER_USAGE_STATIC) && audioBuffer->playing) ma_atomic_store_32(&AUDIO.Profile.underruns, ma_atomic_load_32(&AUDIO.Profile.underruns) + 1);
+
         // For static buffers we can fill the remaining frames with silence for safety, but we don't want
         // to report those frames as "read". The reason for this is that the caller uses the return value
         // to know whether a non-looping sound has finished playback
@@ -2454,6 +3786,57 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     return framesRead;
 }
 
+// Read ring stream frames up to frames written, missing frames are filled with silence
+// NOTE: Only audio thread updates read counter, ring frames are never copied while being written
+static ma_uint32 ReadAudioRingFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+{
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+    ma_uint32 read = audioBuffer->ringRead;
+    ma_uint32 framesQueued = ma_atomic_load_32(&audioBuffer->ringWrite) - read;
+    ma_uint32 framesRead = (frameCount < framesQueued)? frameCount : framesQueued;
+
+    // Ring end splits read in two copies
+    ma_uint32 offset = read & (audioBuffer->sizeInFrames - 1);
+    ma_uint32 framesFirst = audioBuffer->sizeInFrames - offset;
+    if (framesFirst > framesRead) framesFirst = framesRead;
+
+    memcpy(framesOut, audioBuffer->data + offset*frameSizeInBytes, framesFirst*frameSizeInBytes);
+    if (framesRead > framesFirst) memcpy((unsigned char *)framesOut + framesFirst*frameSizeInBytes, audioBuffer->data, (framesRead - framesFirst)*frameSizeInBytes);
+
+    ma_atomic_store_32(&audioBuffer->ringRead, read + framesRead);
+
+    if (framesRead < frameCount)
+    {
+        memset((unsigned char *)framesOut + framesRead*frameSizeInBytes, 0, (frameCount - framesRead)*frameSizeInBytes);
+
+        // Playing stream ran out of frames written, program thread did not write in time
+        if (audioBuffer->playing) ma_atomic_store_32(&AUDIO.Profile.underruns, ma_atomic_load_32(&AUDIO.Profile.underruns) + 1);
+    }
+
+    return frameCount;
+}
+
+// Mix ring stream frames in place, ring frames must match mixing format
+static void MixAudioRingFrames(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    ma_uint32 channels = AUDIO.System.device.playback.channels;
+    ma_uint32 read = audioBuffer->ringRead;
+    ma_uint32 framesQueued = ma_atomic_load_32(&audioBuffer->ringWrite) - read;
+    ma_uint32 framesRead = (frameCount < framesQueued)? frameCount : framesQueued;
+
+    ma_uint32 offset = read & (audioBuffer->sizeInFrames - 1);
+    ma_uint32 framesFirst = audioBuffer->sizeInFrames - offset;
+    if (framesFirst > framesRead) framesFirst = framesRead;
+
+    MixAudioFrames(framesOut, (const float *)audioBuffer->data + offset*channels, framesFirst, audioBuffer);
+    if (framesRead > framesFirst) MixAudioFrames(framesOut + framesFirst*channels, (const float *)audioBuffer->data, framesRead - framesFirst, audioBuffer);
+
+    ma_atomic_store_32(&audioBuffer->ringRead, read + framesRead);
+
+    // Missing frames are silence, nothing to mix
+    if ((framesRead < frameCount) && audioBuffer->playing) ma_atomic_store_32(&AUDIO.Profile.underruns, ma_atomic_load_32(&AUDIO.Profile.underruns) + 1);
+}
+
 // Reads audio data from an AudioBuffer object in device format, returned data will be in a format appropriate for mixing
 static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
 {
@@ -2461,7 +3844,10 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
     // frames. This can be achieved with ma_data_converter_get_required_input_frame_count()
-    ma_uint8 inputBuffer[4096] = { 0 };
+    // Data matching mixing format and rate is read directly, no conversion required
+    if (audioBuffer->isPassthrough) return ReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+
+    ma_uint8 inputBuffer[4096];     // NOTE: Only frames read are converted, no initialization required
     ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
     ma_uint32 totalOutputFramesProcessed = 0;
@@ -2481,7 +3867,11 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
         // At this point we can convert the data to our mixing format
         ma_uint64 inputFramesProcessedThisIteration = ReadAudioBufferFramesInInternalFormat(audioBuffer, inputBuffer, (ma_uint32)inputFramesToProcessThisIteration);
         ma_uint64 outputFramesProcessedThisIteration = outputFramesToProcessThisIteration;
+
+        ma_timer timer = { 0 };
+        ma_timer_init(&timer);
         ma_data_converter_process_pcm_frames(&audioBuffer->converter, inputBuffer, &inputFramesProcessedThisIteration, runningFramesOut, &outputFramesProcessedThisIteration);
+        AUDIO.Profile.converterTimeMix += ma_timer_get_time_in_seconds(&timer);
 
         totalOutputFramesProcessed += (ma_uint32)outputFramesProcessedThisIteration; // Safe cast
 
@@ -2502,127 +3892,303 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 {
     (void)pDevice;
 
+    UpdateAudioCallbackStats(frameCount);
+
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    ma_timer timer = { 0 };
+    ma_timer_init(&timer);
+
+    AUDIO.Profile.converterTimeMix = 0.0;
+
+    // Apply program thread changes queued since last mix, no lock is required
+    // because mixing list, processors and playing state are only modified here
+    ProcessAudioCommands();
+    float commandTime = (float)ma_timer_get_time_in_seconds(&timer);
+
+    UpdateAudioSpatial();
+    UpdateAudioVoices();
+    UpdateAudioBuses();
+
+    ma_uint32 buffersActive = 0;
+    ma_uint32 voicesPlaying = 0;
+    ma_uint32 voicesMixed = 0;
+    ma_uint64 mixFrame = AUDIO.Callback.frames;     // Audio device clock at mix start
+
+    // Mixing is done in blocks fitting buses frames, usually the whole period is a single block
+    for (ma_uint32 blockFrame = 0; blockFrame < frameCount; blockFrame += AUDIO_BUS_BLOCK_SIZE)
     {
+        ma_uint32 blockCount = ((frameCount - blockFrame) < AUDIO_BUS_BLOCK_SIZE)? (frameCount - blockFrame) : AUDIO_BUS_BLOCK_SIZE;
+        float *blockOut = (float *)pFramesOut + (blockFrame*AUDIO.System.device.playback.channels);
+
+        for (rAudioBus *bus = AUDIO.Bus.first; bus != NULL; bus = bus->next) memset(bus->frames, 0, blockCount*AUDIO.System.device.playback.channels*sizeof(float));
+
         for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
         {
+            if (blockFrame == 0) buffersActive++;
+
             // Ignore stopped or paused sounds
             if (!audioBuffer->playing || audioBuffer->paused) continue;
 
-            ma_uint32 framesRead = 0;
+            if (blockFrame == 0) voicesPlaying++;
 
-            while (1)
+            // Scheduled sounds start mixing at their start frame within the block
+            ma_uint32 startOffset = 0;
+            if (audioBuffer->startFrame > 0)
             {
-                if (framesRead >= frameCount) break;
+                ma_uint64 blockStartFrame = mixFrame + blockFrame;
 
-                // Just read as much data as we can from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
+                if (audioBuffer->startFrame >= (blockStartFrame + blockCount)) continue;
+                if (audioBuffer->startFrame > blockStartFrame) startOffset = (ma_uint32)(audioBuffer->startFrame - blockStartFrame);
+                audioBuffer->startFrame = 0;
+            }
 
-                while (framesToRead > 0)
-                {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+            // Virtual voices are not mixed once faded out, playback position is still tracked
+            if (audioBuffer->isVirtual && (audioBuffer->mixLevels[0] == 0.0f) && (audioBuffer->mixLevels[1] == 0.0f))
+            {
+                audioBuffer->isVoiceNew = false;
+                AdvanceAudioVoice(audioBuffer, blockCount - startOffset);
+                continue;
+            }
 
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
-                    {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
-                    }
+            audioBuffer->isVoiceNew = false;
+            if (blockFrame == 0) voicesMixed++;
 
-                    ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
-                    {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
-                        float *framesIn = tempBuffer;
+            // Sounds routed to a bus are mixed to bus frames, processed and mixed to output afterwards
+            float *mixOut = (audioBuffer->bus != NULL)? audioBuffer->bus->frames : blockOut;
+            MixAudioBuffer(audioBuffer, mixOut + startOffset*AUDIO.System.device.playback.channels, blockCount - startOffset);
+        }
 
-                        // Apply processors chain if defined
-                        rAudioProcessor *processor = audioBuffer->processor;
-                        while (processor)
-                        {
-                            processor->process(framesIn, framesJustRead);
-                            processor = processor->next;
-                        }
+        MixAudioBuses(blockOut, blockCount);
+    }
 
-                        MixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
+    rAudioProcessor *processor = AUDIO.mixedProcessor;
+    while (processor)
+    {
+        processor->process(pFramesOut, frameCount);
+        processor = processor->next;
+    }
 
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
-                    }
+    // Mixer stats, mixing time relative to the duration of audio mixed
+    float mixTime = (float)ma_timer_get_time_in_seconds(&timer);
 
-                    if (!audioBuffer->playing)
-                    {
-                        framesRead = frameCount;
-                        break;
-                    }
+    ma_atomic_store_32(&AUDIO.Voice.playing, voicesPlaying);
+    ma_atomic_store_32(&AUDIO.Voice.mixed, voicesMixed);
+    ma_atomic_store_f32(&AUDIO.Voice.mixTime, mixTime*1000.0f);
+    ma_atomic_store_f32(&AUDIO.Voice.mixLoad, (frameCount > 0)? mixTime*pDevice->sampleRate/frameCount : 0.0f);
 
-                    // If we weren't able to read all the frames we requested, break
-                    if (framesJustRead < framesToReadRightNow)
-                    {
-                        if (!audioBuffer->looping)
-                        {
-                            StopAudioBufferInLockedState(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but just for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
-                    }
-                }
+    UpdateAudioProfileStats(mixTime*1000.0f, commandTime*1000.0f, buffersActive, frameCount);
 
-                // If for some reason we weren't able to read every frame we'll need to break from the loop
-                // Not doing this could theoretically put us into an infinite loop
-                if (framesToRead > 0) break;
-            }
-        }
+    ma_atomic_store_64(&AUDIO.Callback.frames, mixFrame + frameCount);
+
+    for (rAudioBus *bus = AUDIO.Bus.first; bus != NULL; bus = bus->next)
+    {
+        ma_atomic_store_f32(&bus->mixTime, (float)bus->processTime*1000.0f);
+        bus->processTime = 0.0;
     }
+}
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
-    while (processor)
+// Update audio callback timing stats, interval between callbacks compared to mixed frames duration
+// NOTE: Averages are smoothed, recent callbacks weight more
+static void UpdateAudioCallbackStats(ma_uint32 frameCount)
+{
+    double time = ma_timer_get_time_in_seconds(&AUDIO.Callback.timer);
+    ma_uint32 count = ma_atomic_load_32(&AUDIO.Callback.count);
+
+    if (count > 0)
     {
-        processor->process(pFramesOut, frameCount);
-        processor = processor->next;
+        float interval = (float)(time - AUDIO.Callback.time)*1000.0f;
+        float deviation = fabsf(interval - (float)frameCount*1000.0f/AUDIO.System.device.sampleRate);
+
+        // Averages start from first interval measured
+        float smoothing = (count == 1)? 1.0f : AUDIO_CALLBACK_STATS_SMOOTHING;
+        float averageInterval = ma_atomic_load_f32(&AUDIO.Callback.interval);
+        float averageJitter = ma_atomic_load_f32(&AUDIO.Callback.jitter);
+
+        ma_atomic_store_f32(&AUDIO.Callback.interval, averageInterval + (interval - averageInterval)*smoothing);
+        ma_atomic_store_f32(&AUDIO.Callback.jitter, averageJitter + (deviation - averageJitter)*smoothing);
+        if (deviation > ma_atomic_load_f32(&AUDIO.Callback.jitterMax)) ma_atomic_store_f32(&AUDIO.Callback.jitterMax, deviation);
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    AUDIO.Callback.time = time;
+    ma_atomic_store_32(&AUDIO.Callback.count, count + 1);
 }
 
-// Main mixing function, pretty simple in this project, just an accumulation
-// NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
-static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
+// Update audio callback profiling stats, called by audio thread at the end of every mix
+static void UpdateAudioProfileStats(float callbackTime, float commandTime, ma_uint32 buffersActive, ma_uint32 frameCount)
 {
-    const float localVolume = buffer->volume;
-    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+    float duration = (float)frameCount*1000.0f/AUDIO.System.device.sampleRate;
+    float load = (duration > 0.0f)? callbackTime/duration : 0.0f;
 
-    if (channels == 2)  // We consider panning
+    if (ma_atomic_exchange_32(&AUDIO.Profile.reset, 0))
     {
-        const float right = (buffer->pan + 1.0f)/2.0f; // Normalize: [-1..1] -> [0..1]
-        const float left = 1.0f - right;
+        ma_atomic_store_f32(&AUDIO.Profile.callbackTimeMax, 0.0f);
+        ma_atomic_store_32(&AUDIO.Profile.overloads, 0);
+        ma_atomic_store_32(&AUDIO.Profile.underruns, 0);
+    }
 
-        // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+    float average = ma_atomic_load_f32(&AUDIO.Profile.callbackTimeAverage);
+    if (average == 0.0f) average = callbackTime;
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+    ma_atomic_store_f32(&AUDIO.Profile.callbackTime, callbackTime);
+    ma_atomic_store_f32(&AUDIO.Profile.callbackTimeAverage, average + (callbackTime - average)*AUDIO_CALLBACK_STATS_SMOOTHING);
+    if (callbackTime > ma_atomic_load_f32(&AUDIO.Profile.callbackTimeMax)) ma_atomic_store_f32(&AUDIO.Profile.callbackTimeMax, callbackTime);
+    ma_atomic_store_f32(&AUDIO.Profile.commandTime, commandTime);
+    ma_atomic_store_f32(&AUDIO.Profile.converterTime, (float)AUDIO.Profile.converterTimeMix*1000.0f);
+    ma_atomic_store_f32(&AUDIO.Profile.load, load);
+    ma_atomic_store_32(&AUDIO.Profile.buffersActive, buffersActive);
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
+    // Mixing slower than audio duration, device is starved of data
+    if (load > 1.0f) ma_atomic_store_32(&AUDIO.Profile.overloads, ma_atomic_load_32(&AUDIO.Profile.overloads) + 1);
+}
+
+// Update audio buffers memory stats, memory added to a buffer or released with the buffer
+// NOTE: Buffers are loaded and released by program thread, stats can be read from any thread
+static void UpdateAudioMemoryStats(AudioBuffer *buffer, unsigned int size, bool release)
+{
+    if (release)
+    {
+        ma_atomic_fetch_sub_64(&AUDIO.Memory.liveBytes, size);
+        ma_atomic_fetch_sub_32(&AUDIO.Memory.liveCount, 1);
+        return;
+    }
+
+    if (buffer->memorySize == 0)
+    {
+        ma_atomic_fetch_add_32(&AUDIO.Memory.liveCount, 1);
+        ma_atomic_fetch_add_32(&AUDIO.Memory.totalCount, 1);
+    }
+
+    buffer->memorySize += size;
+
+    ma_uint64 liveBytes = ma_atomic_fetch_add_64(&AUDIO.Memory.liveBytes, size) + size;
+    if (liveBytes > ma_atomic_load_64(&AUDIO.Memory.peakBytes)) ma_atomic_store_64(&AUDIO.Memory.peakBytes, liveBytes);
+}
+
+// Lock music decoders list and contexts, wait time is tracked on audio profiling stats
+static void LockAudioMusic(void)
+{
+    ma_timer timer = { 0 };
+    ma_timer_init(&timer);
+
+    ma_mutex_lock(&AUDIO.Music.lock);
+
+    float waitTime = (float)ma_timer_get_time_in_seconds(&timer)*1000.0f;
+    if (waitTime > ma_atomic_load_f32(&AUDIO.Profile.lockWaitTime)) ma_atomic_store_f32(&AUDIO.Profile.lockWaitTime, waitTime);
+}
+
+// Mix audio buffer frames to output, reading from audio buffer in mixing format
+static void MixAudioBuffer(AudioBuffer *audioBuffer, float *framesOut, ma_uint32 frameCount)
+{
+    // Ring frames matching mixing format are mixed in place, processors require a copy to work on
+    if (audioBuffer->isRing && audioBuffer->isPassthrough && (audioBuffer->processor == NULL))
+    {
+        MixAudioRingFrames(audioBuffer, framesOut, frameCount);
+        return;
+    }
+
+    ma_uint32 framesRead = 0;
+
+    while (1)
+    {
+        if (framesRead >= frameCount) break;
+
+        // Just read as much data as we can from the stream
+        ma_uint32 framesToRead = (frameCount - framesRead);
+
+        while (framesToRead > 0)
         {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+            float tempBuffer[1024];         // Frames for stereo, only frames read are mixed
+
+            ma_uint32 framesToReadRightNow = framesToRead;
+            if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+            {
+                framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+            }
+
+            ma_uint32 framesJustRead = ReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
+            if (framesJustRead > 0)
+            {
+                float *frameOut = framesOut + (framesRead*AUDIO.System.device.playback.channels);
+                float *framesIn = tempBuffer;
+
+                // Apply processors chain if defined
+                rAudioProcessor *processor = audioBuffer->processor;
+                while (processor)
+                {
+                    processor->process(framesIn, framesJustRead);
+                    processor = processor->next;
+                }
+
+                MixAudioFrames(frameOut, framesIn, framesJustRead, audioBuffer);
+
+                framesToRead -= framesJustRead;
+                framesRead += framesJustRead;
+            }
+
+            if (!audioBuffer->playing)
+            {
+                framesRead = frameCount;
+                break;
+            }
 
-            frameOut += 2;
-            frameIn += 2;
+            // If we weren't able to read all the frames we requested, break
+            if (framesJustRead < framesToReadRightNow)
+            {
+                if (!audioBuffer->looping)
+                {
+                    StopAudioBufferInAudioThread(audioBuffer);
+                    break;
+                }
+                else
+                {
+                    // Should never get here, but just for safety,
+                    // move the cursor position back to the start and continue the loop
+                    ma_atomic_store_32(&audioBuffer->frameCursorPos, 0);
+                    continue;
+                }
+            }
         }
+
+        // If for some reason we weren't able to read every frame we'll need to break from the loop
+        // Not doing this could theoretically put us into an infinite loop
+        if (framesToRead > 0) break;
     }
+}
+
+// Main mixing function, pretty simple in this project, just an accumulation
+// NOTE: framesOut is both an input and an output, it is initially filled with zeros outside of this function
+// Levels are ramped from the ones applied on previous mix to avoid zipper noise on volume and pan changes
+static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer)
+{
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+
+    if (frameCount == 0) return;
+
+    // Virtual voices are faded out before they stop being mixed
+    float levels[2] = { 0 };
+    if (!buffer->isVirtual) GetAudioBufferMixLevels(buffer, channels, levels);
+
+    const float start[2] = { buffer->mixLevels[0], buffer->mixLevels[1] };
+    const float steps[2] = { (levels[0] - start[0])/frameCount, (levels[1] - start[1])/frameCount };
+
+    buffer->mixLevels[0] = levels[0];
+    buffer->mixLevels[1] = levels[1];
+
+    MixAudioFramesLevels(framesOut, framesIn, frameCount, start, steps);
+}
+
+// Mix frames, levels are increased by steps on every frame
+static void MixAudioFramesLevels(float *framesOut, const float *framesIn, ma_uint32 frameCount, const float *levels, const float *steps)
+{
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+
+    if (channels == 2) MixAudioFramesStereo(framesOut, framesIn, frameCount, levels, steps);  // We consider panning
     else  // We do not consider panning
     {
+        float level = levels[0];
+
         for (ma_uint32 frame = 0; frame < frameCount; frame++)
         {
             for (ma_uint32 c = 0; c < channels; c++)
@@ -2631,87 +4197,1790 @@ static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 fr
                 const float *frameIn = framesIn + (frame*channels);
 
                 // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
+                frameOut[c] += (frameIn[c]*level);
             }
+
+            level += steps[0];
         }
     }
 }
 
-// Check if an audio buffer is playing, assuming the audio system mutex has been locked
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
+// Mix stereo frames, levels for left and right channels are increased by steps on every frame
+// NOTE: SIMD path mixes 4 frames per iteration, two interleaved frames per vector
+static void MixAudioFramesStereo(float *framesOut, const float *framesIn, ma_uint32 frameCount, const float *levels, const float *steps)
 {
-    bool result = false;
+    ma_uint32 frame = 0;
+
+#if defined(RAUDIO_SSE2_ENABLED) || defined(RAUDIO_NEON_ENABLED)
+    const float gains[8] = {
+        levels[0], levels[1], levels[0] + steps[0], levels[1] + steps[1],
+        levels[0] + 2*steps[0], levels[1] + 2*steps[1], levels[0] + 3*steps[0], levels[1] + 3*steps[1]
+    };
+    const float increments[4] = { 4*steps[0], 4*steps[1], 4*steps[0], 4*steps[1] };
+#endif
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+#if defined(RAUDIO_SSE2_ENABLED)
+    __m128 gain0 = _mm_loadu_ps(gains);
+    __m128 gain1 = _mm_loadu_ps(gains + 4);
+    const __m128 increment = _mm_loadu_ps(increments);
 
-    return result;
+    for (; (frame + 4) <= frameCount; frame += 4)
+    {
+        float *frameOut = framesOut + frame*2;
+        const float *frameIn = framesIn + frame*2;
+
+        _mm_storeu_ps(frameOut, _mm_add_ps(_mm_loadu_ps(frameOut), _mm_mul_ps(_mm_loadu_ps(frameIn), gain0)));
+        _mm_storeu_ps(frameOut + 4, _mm_add_ps(_mm_loadu_ps(frameOut + 4), _mm_mul_ps(_mm_loadu_ps(frameIn + 4), gain1)));
+
+        gain0 = _mm_add_ps(gain0, increment);
+        gain1 = _mm_add_ps(gain1, increment);
+    }
+#elif defined(RAUDIO_NEON_ENABLED)
+    float32x4_t gain0 = vld1q_f32(gains);
+    float32x4_t gain1 = vld1q_f32(gains + 4);
+    const float32x4_t increment = vld1q_f32(increments);
+
+    for (; (frame + 4) <= frameCount; frame += 4)
+    {
+        float *frameOut = framesOut + frame*2;
+        const float *frameIn = framesIn + frame*2;
+
+        vst1q_f32(frameOut, vmlaq_f32(vld1q_f32(frameOut), vld1q_f32(frameIn), gain0));
+        vst1q_f32(frameOut + 4, vmlaq_f32(vld1q_f32(frameOut + 4), vld1q_f32(frameIn + 4), gain1));
+
+        gain0 = vaddq_f32(gain0, increment);
+        gain1 = vaddq_f32(gain1, increment);
+    }
+#endif
+
+    // Remaining frames (or all frames if no SIMD support)
+    float left = levels[0] + steps[0]*frame;
+    float right = levels[1] + steps[1]*frame;
+
+    for (; frame < frameCount; frame++)
+    {
+        framesOut[frame*2] += (framesIn[frame*2]*left);
+        framesOut[frame*2 + 1] += (framesIn[frame*2 + 1]*right);
+
+        left += steps[0];
+        right += steps[1];
+    }
 }
 
-// Stop an audio buffer, assuming the audio system mutex has been locked
-static void StopAudioBufferInLockedState(AudioBuffer *buffer)
+// Get audio buffer channel levels for mixing from volume and pan
+// NOTE: Spatial gain and pan are combined with sound volume and pan
+static void GetAudioBufferMixLevels(AudioBuffer *buffer, ma_uint32 channels, float *levels)
 {
-    if (buffer != NULL)
+    const float volume = ma_atomic_load_f32(&buffer->volume)*buffer->spatialGain;
+
+    if (channels == 2)
     {
-        if (IsAudioBufferPlayingInLockedState(buffer))
+        float pan = ma_atomic_load_f32(&buffer->pan) + buffer->spatialPan;
+        if (pan < -1.0f) pan = -1.0f;
+        else if (pan > 1.0f) pan = 1.0f;
+
+        const float right = (pan + 1.0f)/2.0f; // Normalize: [-1..1] -> [0..1]
+        const float left = 1.0f - right;
+
+        // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
+        levels[0] = volume*0.5f*left*(3.0f - left*left);
+        levels[1] = volume*0.5f*right*(3.0f - right*right);
+    }
+    else
+    {
+        levels[0] = volume;
+        levels[1] = volume;
+    }
+}
+
+// Check if audio buffer data matches mixing format for an output sample rate, no conversion is required
+static bool IsAudioBufferPassthrough(AudioBuffer *buffer, ma_uint32 sampleRateOut)
+{
+    return ((buffer->converter.formatIn == ma_format_f32) && (buffer->converter.formatOut == ma_format_f32) &&
+            (buffer->converter.channelsIn == buffer->converter.channelsOut) && (buffer->converter.sampleRateIn == sampleRateOut));
+}
+
+// Convert audio frames on loading, highest quality resampling is used
+static ma_uint64 ConvertAudioFrames(void *framesOut, ma_uint64 frameCountOut, ma_format formatOut, ma_uint32 channelsOut, ma_uint32 sampleRateOut,
+                                    const void *framesIn, ma_uint64 frameCountIn, ma_format formatIn, ma_uint32 channelsIn, ma_uint32 sampleRateIn)
+{
+    ma_data_converter_config config = ma_data_converter_config_init(formatIn, formatOut, channelsIn, channelsOut, sampleRateIn, sampleRateOut);
+    config.resampling.linear.lpfOrder = MA_MAX_FILTER_ORDER;
+
+    return ma_convert_frames_ex(framesOut, frameCountOut, framesIn, frameCountIn, &config);
+}
+
+// Get wave sample normalized to range [-1..1]
+static float GetWaveSample(const rl_Wave *wave, unsigned int index)
+{
+    if (wave->sampleSize == 8) return (float)(((unsigned char *)wave->data)[index] - 128)/128.0f;
+    else if (wave->sampleSize == 16) return (float)(((short *)wave->data)[index])/32768.0f;
+    else return ((float *)wave->data)[index];
+}
+
+// Convert wave data to desired format, returns false on failure keeping wave data
+// NOTE: No logging, also called from wave worker threads
+static bool FormatWave(rl_Wave *wave, int sampleRate, int sampleSize, int channels)
+{
+    if ((wave->data == NULL) || (wave->frameCount == 0) || (sampleRate <= 0) || (channels <= 0)) return false;
+    if ((sampleSize != 8) && (sampleSize != 16) && (sampleSize != 32)) return false;
+
+    if (((unsigned int)sampleRate == wave->sampleRate) && ((unsigned int)sampleSize == wave->sampleSize) && ((unsigned int)channels == wave->channels)) return true;
+
+    ma_format formatIn = ((wave->sampleSize == 8)? ma_format_u8 : ((wave->sampleSize == 16)? ma_format_s16 : ma_format_f32));
+    ma_format formatOut = ((sampleSize == 8)? ma_format_u8 : ((sampleSize == 16)? ma_format_s16 : ma_format_f32));
+
+    // Sample size reduction only, samples are converted in place and data shrunk
+    // NOTE: Narrower samples are written forward, every sample is read before being overwritten
+    if (((unsigned int)sampleRate == wave->sampleRate) && ((unsigned int)channels == wave->channels) && ((unsigned int)sampleSize < wave->sampleSize))
+    {
+        ma_pcm_convert(wave->data, formatOut, wave->data, formatIn, (ma_uint64)wave->frameCount*channels, ma_dither_mode_none);
+
+        void *data = RL_REALLOC(wave->data, wave->frameCount*channels*(sampleSize/8));
+        if (data != NULL) wave->data = data;
+
+        wave->sampleSize = sampleSize;
+
+        return true;
+    }
+
+    ma_uint32 frameCountIn = wave->frameCount;
+    ma_uint32 frameCount = (ma_uint32)ConvertAudioFrames(NULL, 0, formatOut, channels, sampleRate, NULL, frameCountIn, formatIn, wave->channels, wave->sampleRate);
+
+    if (frameCount == 0) return false;
+
+    void *data = RL_MALLOC(frameCount*channels*(sampleSize/8));
+    if (data == NULL) return false;
+
+    frameCount = (ma_uint32)ConvertAudioFrames(data, frameCount, formatOut, channels, sampleRate, wave->data, frameCountIn, formatIn, wave->channels, wave->sampleRate);
+
+    if (frameCount == 0)
+    {
+        RL_FREE(data);
+        return false;
+    }
+
+    wave->frameCount = frameCount;
+    wave->sampleSize = sampleSize;
+    wave->sampleRate = sampleRate;
+    wave->channels = channels;
+
+    RL_FREE(wave->data);
+    wave->data = data;
+
+    return true;
+}
+
+// Process wave: trim silence, normalize and format
+// NOTE: Normalization is done on widest sample size, after format conversion if it increases sample size
+static bool ProcessWave(rl_Wave *wave, const rl_WaveProcessing *processing)
+{
+    if ((wave->data == NULL) || (wave->frameCount == 0)) return false;
+
+    int sampleRate = (processing->sampleRate > 0)? processing->sampleRate : (int)wave->sampleRate;
+    int sampleSize = (processing->sampleSize > 0)? processing->sampleSize : (int)wave->sampleSize;
+    int channels = (processing->channels > 0)? processing->channels : (int)wave->channels;
+    bool normalizeFirst = ((unsigned int)sampleSize <= wave->sampleSize);
+
+    // Silence trimmed first, less frames to normalize and resample
+    if (processing->trimThreshold > 0.0f) rl_WaveTrimSilence(wave, processing->trimThreshold);
+    if ((processing->normalize > 0.0f) && normalizeFirst) rl_WaveNormalize(wave, processing->normalize);
+
+    if (!FormatWave(wave, sampleRate, sampleSize, channels)) return false;
+
+    if ((processing->normalize > 0.0f) && !normalizeFirst) rl_WaveNormalize(wave, processing->normalize);
+
+    return true;
+}
+
+#if defined(RAUDIO_STANDALONE)
+// Wave processing thread, waves are taken from job until all waves are processed
+// NOTE: Also called on caller thread
+static ma_thread_result MA_THREADCALL WaveProcessingThread(void *pUserData)
+{
+    WaveProcessingJob *job = (WaveProcessingJob *)pUserData;
+    ma_uint64 frames = 0;
+    ma_uint32 failed = 0;
+
+    for (int index = (int)ma_atomic_fetch_add_32(&job->next, 1); index < job->count; index = (int)ma_atomic_fetch_add_32(&job->next, 1))
+    {
+        frames += job->waves[index].frameCount;
+        if (!ProcessWave(&job->waves[index], &job->processing)) failed++;
+    }
+
+    ma_atomic_fetch_add_64(&job->frames, frames);
+    ma_atomic_fetch_add_32(&job->failed, failed);
+
+    return (ma_thread_result)0;
+}
+#else
+// Process waves range on current thread, called by job system threads
+static void ProcessWavesRange(void *userData, int start, int end)
+{
+    WaveProcessingJob *job = (WaveProcessingJob *)userData;
+    ma_uint64 frames = 0;
+    ma_uint32 failed = 0;
+
+    for (int index = start; index < end; index++)
+    {
+        frames += job->waves[index].frameCount;
+        if (!ProcessWave(&job->waves[index], &job->processing)) failed++;
+    }
+
+    ma_atomic_fetch_add_64(&job->frames, frames);
+    ma_atomic_fetch_add_32(&job->failed, failed);
+}
+#endif
+
+// Push command to queue, returns false if queue is full
+// WARNING: Single producer, only called from queue producer thread (program thread or audio thread for release queue)
+static bool PushAudioCommand(AudioCommandQueue *queue, const AudioCommand *command)
+{
+    ma_uint32 head = queue->head;
+
+    if ((head - ma_atomic_load_32(&queue->tail)) >= AUDIO_COMMAND_QUEUE_SIZE) return false;
+
+    queue->commands[head & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = *command;
+    ma_atomic_store_32(&queue->head, head + 1);
+
+    return true;
+}
+
+// Send command from program thread to audio thread
+// NOTE: If audio device is not running, command is processed right away
+// WARNING: Not thread-safe, audio functions must be called from a single program thread (see module NOTES)
+static void SendAudioCommand(AudioCommand command)
+{
+    ReleaseAudioCommands();
+
+    if (AUDIO.System.isReady)
+    {
+        // Queue is emptied by audio thread on every mix, it only gets full with
+        // hundreds of commands sent in a single period, wait for next mix in that case
+        while (!PushAudioCommand(&AUDIO.Command.queue, &command))
         {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            ma_atomic_store_32(&AUDIO.Profile.commandWaits, ma_atomic_load_32(&AUDIO.Profile.commandWaits) + 1);
+            ma_sleep(1);
+            ReleaseAudioCommands();
         }
     }
+    else
+    {
+        ProcessAudioCommand(&command);
+        ReleaseAudioCommands();
+    }
 }
 
-// Update audio stream, assuming the audio system mutex has been locked
-static void UpdateAudioStreamInLockedState(rl_AudioStream stream, const void *data, int frameCount)
+// Process commands sent by program thread, called by audio thread at the start of every mix
+static void ProcessAudioCommands(void)
 {
-    if (stream.buffer != NULL)
+    AudioCommandQueue *queue = &AUDIO.Command.queue;
+    ma_uint32 head = ma_atomic_load_32(&queue->head);
+
+    while (queue->tail != head)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
+        // Release queue is full, command is processed on next mix
+        if (!ProcessAudioCommand(&queue->commands[queue->tail & (AUDIO_COMMAND_QUEUE_SIZE - 1)])) break;
+
+        ma_atomic_store_32(&queue->tail, queue->tail + 1);
+    }
+}
+
+// Process command on audio thread, returns false if it could not be processed yet
+static bool ProcessAudioCommand(const AudioCommand *command)
+{
+    AudioBuffer *buffer = command->buffer;
+
+    switch (command->type)
+    {
+        case AUDIO_COMMAND_PLAY:
         {
-            ma_uint32 subBufferToUpdate = 0;
+            // Sound starts at current levels, no ramping required
+            // If voices limit is reached it starts virtual, it can still be promoted before being mixed
+            GetAudioBufferMixLevels(buffer, AUDIO.System.device.playback.channels, buffer->mixLevels);
+            buffer->isVoiceNew = true;
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
+            if ((buffer->usage == AUDIO_BUFFER_USAGE_STATIC) && (!buffer->playing || buffer->paused || buffer->isVirtual))
             {
-                // Both buffers are available for updating
-                // Update the first one and make sure the cursor is moved back to the front
-                subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
+                int voicesMax = (int)ma_atomic_load_32(&AUDIO.Voice.max);
+
+                buffer->isVirtual = false;
+                if ((voicesMax == 0) || (AUDIO.Voice.real < voicesMax)) AUDIO.Voice.real++;
+                else DemoteAudioVoice(buffer);
             }
-            else
+
+            ma_atomic_store_32(&buffer->playing, true);
+            ma_atomic_store_32(&buffer->paused, false);
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+            buffer->startFrame = command->frame;
+
+            for (int i = 0; i < 2; i++)
             {
-                // Just update whichever sub-buffer is processed
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
+                if (ma_atomic_load_32(&buffer->subBufferState[i]) == AUDIO_SUBBUFFER_PENDING) ma_atomic_store_32(&buffer->subBufferState[i], AUDIO_SUBBUFFER_PROCESSED);
             }
+        } break;
+        case AUDIO_COMMAND_STOP: StopAudioBufferInAudioThread(buffer); break;
+        case AUDIO_COMMAND_PAUSE: ma_atomic_store_32(&buffer->paused, true); break;
+        case AUDIO_COMMAND_RESUME: ma_atomic_store_32(&buffer->paused, false); break;
+        case AUDIO_COMMAND_PITCH:
+        {
+            buffer->pitch = command->value;
+            SetAudioBufferRate(buffer);
+        } break;
+        case AUDIO_COMMAND_SUBMIT:
+        {
+            // Both sub-buffers were available for updating when the first one was updated,
+            // make sure the cursor is moved back to the front
+            if ((command->param == 0) && (ma_atomic_load_32(&buffer->subBufferState[1]) != AUDIO_SUBBUFFER_PENDING)) ma_atomic_store_32(&buffer->frameCursorPos, 0);
 
-            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
-            unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
+            ma_atomic_store_32(&buffer->subBufferState[command->param], AUDIO_SUBBUFFER_PENDING);
+        } break;
+        case AUDIO_COMMAND_FLUSH:
+        {
+            for (int i = 0; i < 2; i++)
+            {
+                if (ma_atomic_load_32(&buffer->subBufferState[i]) == AUDIO_SUBBUFFER_PENDING) ma_atomic_store_32(&buffer->subBufferState[i], AUDIO_SUBBUFFER_PROCESSED);
+            }
+        } break;
+        case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+        case AUDIO_COMMAND_TRACK:
+        {
+            if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
+            else
+            {
+                AUDIO.Buffer.last->next = buffer;
+                buffer->prev = AUDIO.Buffer.last;
+            }
 
-            stream.buffer->framesProcessed += frameCount;
+            AUDIO.Buffer.last = buffer;
+        } break;
+        case AUDIO_COMMAND_UNTRACK:
+        {
+            // Buffer is returned to program thread to be released, it is not accessed anymore
+            if ((AUDIO.Command.release.head - ma_atomic_load_32(&AUDIO.Command.release.tail)) >= AUDIO_COMMAND_QUEUE_SIZE) return false;
 
-            // Does this API expect a whole buffer to be updated in one go?
-            // Assuming so, but if not will need to change this logic
-            if (subBufferSizeInFrames >= (ma_uint32)frameCount)
-            {
-                ma_uint32 framesToWrite = (ma_uint32)frameCount;
+            if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
+            else buffer->prev->next = buffer->next;
 
-                ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
-                memcpy(subBuffer, data, bytesToWrite);
+            if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
+            else buffer->next->prev = buffer->prev;
 
-                // Any leftover frames should be filled with zeros
-                ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+            buffer->prev = NULL;
+            buffer->next = NULL;
 
-                if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+            PushAudioCommand(&AUDIO.Command.release, command);
+        } break;
+        case AUDIO_COMMAND_ATTACH:
+        {
+            rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+            rAudioProcessor *last = *first;
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
+            while (last && last->next)
+            {
+                last = last->next;
             }
-            else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
-        }
-        else TRACELOG(LOG_WARNING, "STREAM: Buffer not available for updating");
+            if (last)
+            {
+                command->processor->prev = last;
+                last->next = command->processor;
+            }
+            else *first = command->processor;
+        } break;
+        case AUDIO_COMMAND_DETACH:
+        {
+            rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+
+            // Check release queue has room for all the processors to be removed
+            ma_uint32 count = 0;
+            for (rAudioProcessor *processor = *first; processor != NULL; processor = processor->next)
+            {
+                if (processor->process == command->callback) count++;
+            }
+
+            if ((AUDIO.Command.release.head - ma_atomic_load_32(&AUDIO.Command.release.tail) + count) > AUDIO_COMMAND_QUEUE_SIZE) return false;
+
+            rAudioProcessor *processor = *first;
+
+            while (processor)
+            {
+                rAudioProcessor *next = processor->next;
+                rAudioProcessor *prev = processor->prev;
+
+                if (processor->process == command->callback)
+                {
+                    if (*first == processor) *first = next;
+                    if (prev) prev->next = next;
+                    if (next) next->prev = prev;
+
+                    PushAudioCommand(&AUDIO.Command.release, &(AudioCommand){ .type = AUDIO_COMMAND_DETACH, .processor = processor });
+                }
+
+                processor = next;
+            }
+        } break;
+        case AUDIO_COMMAND_DECODER:
+        {
+            // Previous decoder is returned to program thread to be released,
+            // music decoding continues on program thread from last position decoded
+            if (buffer->decoder != NULL)
+            {
+                if ((AUDIO.Command.release.head - ma_atomic_load_32(&AUDIO.Command.release.tail)) >= AUDIO_COMMAND_QUEUE_SIZE) return false;
+
+                ma_atomic_store_32(&buffer->framesProcessed, buffer->decoder->framesDecoded);
+                PushAudioCommand(&AUDIO.Command.release, &(AudioCommand){ .type = AUDIO_COMMAND_DECODER, .decoder = buffer->decoder });
+            }
+
+            buffer->decoder = command->decoder;
+            if (buffer->decoder != NULL) buffer->decoderGeneration = ma_atomic_load_32(&buffer->decoder->generation);
+        } break;
+        case AUDIO_COMMAND_BUS_ADD:
+        {
+            command->bus->next = AUDIO.Bus.first;
+            AUDIO.Bus.first = command->bus;
+            SortAudioBuses();
+        } break;
+        case AUDIO_COMMAND_BUS_REMOVE:
+        {
+            // Bus is returned to program thread to be released, sounds and buses routed to it are routed to its output
+            if ((AUDIO.Command.release.head - ma_atomic_load_32(&AUDIO.Command.release.tail)) >= AUDIO_COMMAND_QUEUE_SIZE) return false;
+
+            rAudioBus *bus = command->bus;
+
+            for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+            {
+                if (audioBuffer->bus == bus) audioBuffer->bus = bus->output;
+            }
+
+            rAudioBus **position = &AUDIO.Bus.first;
+            while (*position != NULL)
+            {
+                if (*position == bus) *position = bus->next;
+                else
+                {
+                    if ((*position)->output == bus) (*position)->output = bus->output;
+                    position = &(*position)->next;
+                }
+            }
+
+            SortAudioBuses();
+            PushAudioCommand(&AUDIO.Command.release, command);
+        } break;
+        case AUDIO_COMMAND_BUS_OUTPUT:
+        {
+            command->bus->output = command->output;
+            SortAudioBuses();
+        } break;
+        case AUDIO_COMMAND_BUS_ROUTE: buffer->bus = command->output; break;
+        default: break;
+    }
+
+    // State commands processed, audio thread state matches program requested state
+    if (command->type <= AUDIO_COMMAND_RESUME) ma_atomic_fetch_sub_32(&buffer->commandsPending, 1);
+
+    return true;
+}
+
+// Release buffers and processors returned by audio thread, called from program thread
+static void ReleaseAudioCommands(void)
+{
+    AudioCommandQueue *release = &AUDIO.Command.release;
+    ma_uint32 head = ma_atomic_load_32(&release->head);
+
+    while (release->tail != head)
+    {
+        AudioCommand *command = &release->commands[release->tail & (AUDIO_COMMAND_QUEUE_SIZE - 1)];
+
+        if (command->type == AUDIO_COMMAND_UNTRACK)
+        {
+            UpdateAudioMemoryStats(command->buffer, command->buffer->memorySize, true);
+            ma_data_converter_uninit(&command->buffer->converter, NULL);
+            if (command->param == 1) RL_FREE(command->buffer->data);    // Sound alias data is owned by source sound
+#if defined(SUPPORT_FILEFORMAT_QOA)
+            RL_FREE(command->buffer->qoaFrame);
+#endif
+            RL_FREE(command->buffer);
+        }
+        else if (command->type == AUDIO_COMMAND_DETACH) RL_FREE(command->processor);
+        else if (command->type == AUDIO_COMMAND_DECODER)
+        {
+            RL_FREE(command->decoder->data);
+            RL_FREE(command->decoder);
+        }
+        else if (command->type == AUDIO_COMMAND_BUS_REMOVE)
+        {
+            ma_biquad_uninit(&command->bus->filter, NULL);
+            RL_FREE(command->bus->reverbData);
+            RL_FREE(command->bus);
+        }
+
+        ma_atomic_store_32(&release->tail, release->tail + 1);
+    }
+}
+
+// Sync program requested state with audio thread state, once all state commands have been processed
+// NOTE: Audio thread can also stop a non-looping sound on its own when it reaches the end
+static void SyncAudioBufferState(AudioBuffer *buffer)
+{
+    if (ma_atomic_load_32(&buffer->commandsPending) == 0)
+    {
+        buffer->requestedPlaying = ma_atomic_load_32(&buffer->playing);
+        buffer->requestedPaused = ma_atomic_load_32(&buffer->paused);
+    }
+}
+
+// Send audio buffer state command, requested state is used until audio thread processes it
+static void SendAudioBufferStateCommand(AudioBuffer *buffer, int type)
+{
+    ma_atomic_fetch_add_32(&buffer->commandsPending, 1);
+    SendAudioCommand((AudioCommand){ .type = type, .buffer = buffer });
+}
+
+// Stop an audio buffer, called from audio thread
+static void StopAudioBufferInAudioThread(AudioBuffer *buffer)
+{
+    if ((buffer != NULL) && buffer->playing && !buffer->paused)
+    {
+        ma_atomic_store_32(&buffer->playing, false);
+        ma_atomic_store_32(&buffer->paused, false);
+        ma_atomic_store_32(&buffer->frameCursorPos, 0);
+        buffer->startFrame = 0;
+
+        // Ring frames not played are discarded
+        if (buffer->isRing) ma_atomic_store_32(&buffer->ringRead, ma_atomic_load_32(&buffer->ringWrite));
+
+        for (int i = 0; i < 2; i++)
+        {
+            if (ma_atomic_load_32(&buffer->subBufferState[i]) == AUDIO_SUBBUFFER_PENDING) ma_atomic_store_32(&buffer->subBufferState[i], AUDIO_SUBBUFFER_PROCESSED);
+        }
+
+        // Threaded music frames processed are only updated by audio thread
+        if (buffer->decoder != NULL) ma_atomic_store_32(&buffer->framesProcessed, 0);
+    }
+}
+
+// Update real and virtual voices, called by audio thread before mixing
+// NOTE: Streams are always mixed, sounds exceeding the voices limit are kept virtual (not mixed,
+// playback position tracked), voices are ranked by priority, then by volume and distance
+static void UpdateAudioVoices(void)
+{
+    int voicesMax = (int)ma_atomic_load_32(&AUDIO.Voice.max);
+    int available = voicesMax;
+    int real = 0;
+
+    for (AudioBuffer *buffer = AUDIO.Buffer.first; buffer != NULL; buffer = buffer->next)
+    {
+        if (!buffer->playing || buffer->paused) continue;
+
+        if ((buffer->usage != AUDIO_BUFFER_USAGE_STATIC) || (voicesMax == 0))
+        {
+            if (buffer->isVirtual) PromoteAudioVoice(buffer);
+            if (buffer->usage != AUDIO_BUFFER_USAGE_STATIC) available--;
+        }
+        else if (!buffer->isVirtual) real++;
+    }
+
+    AUDIO.Voice.real = real;
+
+    if (voicesMax == 0) return;
+    if (available < 0) available = 0;
+
+    // Demote lowest ranked voices over the limit, voices are stolen
+    while (real > available)
+    {
+        DemoteAudioVoice(FindAudioVoice(false, false));
+        ma_atomic_fetch_add_32(&AUDIO.Voice.stolen, 1);
+        real--;
+    }
+
+    // Promote highest ranked virtual voices to free voices
+    AudioBuffer *best = NULL;
+    while ((real < available) && ((best = FindAudioVoice(true, true)) != NULL))
+    {
+        PromoteAudioVoice(best);
+        real++;
+    }
+
+    // Swap highest ranked virtual voices with lowest ranked real voices, a few per mix
+    // NOTE: Same priority voices are only swapped if clearly louder (~3.5dB) to avoid voices flickering
+    for (int i = 0; i < AUDIO_VOICE_SWAPS_MAX; i++)
+    {
+        best = FindAudioVoice(true, true);
+        AudioBuffer *worst = FindAudioVoice(false, false);
+
+        if ((best == NULL) || (worst == NULL)) break;
+
+        int bestPriority = ma_atomic_load_i32(&best->priority);
+        int worstPriority = ma_atomic_load_i32(&worst->priority);
+
+        if ((bestPriority < worstPriority) ||
+            ((bestPriority == worstPriority) && (GetAudioVoiceAudibility(best) <= GetAudioVoiceAudibility(worst)*1.5f))) break;
+
+        DemoteAudioVoice(worst);
+        PromoteAudioVoice(best);
+        ma_atomic_fetch_add_32(&AUDIO.Voice.stolen, 1);
+    }
+
+    AUDIO.Voice.real = real;
+}
+
+// Find highest or lowest ranked voice between real or virtual playing sounds
+static AudioBuffer *FindAudioVoice(bool isVirtual, bool highest)
+{
+    AudioBuffer *result = NULL;
+    int resultPriority = 0;
+    float resultAudibility = 0.0f;
+
+    for (AudioBuffer *buffer = AUDIO.Buffer.first; buffer != NULL; buffer = buffer->next)
+    {
+        if (!buffer->playing || buffer->paused || (buffer->usage != AUDIO_BUFFER_USAGE_STATIC) || (buffer->isVirtual != isVirtual)) continue;
+
+        int priority = ma_atomic_load_i32(&buffer->priority);
+        float audibility = GetAudioVoiceAudibility(buffer);
+
+        bool isHigher = (priority > resultPriority) || ((priority == resultPriority) && (audibility > resultAudibility));
+        bool isLower = (priority < resultPriority) || ((priority == resultPriority) && (audibility < resultAudibility));
+
+        if ((result == NULL) || (highest && isHigher) || (!highest && isLower))
+        {
+            result = buffer;
+            resultPriority = priority;
+            resultAudibility = audibility;
+        }
+    }
+
+    return result;
+}
+
+// Get voice audibility, used to rank same priority voices
+// NOTE: Spatial sounds are ranked by spatial gain, distance set is still considered if any
+static float GetAudioVoiceAudibility(AudioBuffer *buffer)
+{
+    float distance = ma_atomic_load_f32(&buffer->distance);
+
+    return ma_atomic_load_f32(&buffer->volume)*buffer->spatialGain/(1.0f + ((distance > 0.0f)? distance : 0.0f));
+}
+
+// Update audio buses effects from parameters set by program thread
+static void UpdateAudioBuses(void)
+{
+    const float sampleRate = (float)AUDIO.System.device.sampleRate;
+
+    for (rAudioBus *bus = AUDIO.Bus.first; bus != NULL; bus = bus->next)
+    {
+        ma_uint32 version = ma_atomic_load_32(&bus->version);
+        if (version == bus->appliedVersion) continue;
+
+        bus->appliedVersion = version;
+
+        // Filter coefficients from RBJ audio EQ cookbook, filter state is kept on parameters changes
+        int filterType = (int)ma_atomic_load_32(&bus->filterType);
+        if (filterType != AUDIO_FILTER_NONE)
+        {
+            float frequency = ma_atomic_load_f32(&bus->filterFrequency);
+            if (frequency > sampleRate*0.49f) frequency = sampleRate*0.49f;
+
+            double w = 2.0*MA_PI_D*frequency/sampleRate;
+            double alpha = sin(w)/(2.0*ma_atomic_load_f32(&bus->filterResonance));
+            double cosw = cos(w);
+            double b0 = alpha;
+            double b1 = 0.0;
+            double b2 = -alpha;
+
+            if (filterType == AUDIO_FILTER_LOWPASS)
+            {
+                b0 = (1.0 - cosw)/2.0;
+                b1 = 1.0 - cosw;
+                b2 = b0;
+            }
+            else if (filterType == AUDIO_FILTER_HIGHPASS)
+            {
+                b0 = (1.0 + cosw)/2.0;
+                b1 = -(1.0 + cosw);
+                b2 = b0;
+            }
+
+            if (!bus->isFilterActive)
+            {
+                memset(bus->filter.pR1, 0, bus->filter.channels*sizeof(ma_biquad_coefficient));
+                memset(bus->filter.pR2, 0, bus->filter.channels*sizeof(ma_biquad_coefficient));
+            }
+
+            ma_biquad_config filterConfig = ma_biquad_config_init(ma_format_f32, bus->filter.channels, b0, b1, b2, 1.0 + alpha, -2.0*cosw, 1.0 - alpha);
+            ma_biquad_reinit(&filterConfig, &bus->filter);
+        }
+
+        bus->isFilterActive = (filterType != AUDIO_FILTER_NONE);
+
+        // Compressor envelope coefficients from attack and release times
+        float ratio = ma_atomic_load_f32(&bus->compressorRatio);
+        if (ratio > 1.0f)
+        {
+            float attack = ma_atomic_load_f32(&bus->compressorAttack);
+            float release = ma_atomic_load_f32(&bus->compressorRelease);
+
+            bus->compressorLevel = powf(10.0f, ma_atomic_load_f32(&bus->compressorThreshold)/20.0f);
+            bus->compressorExponent = 1.0f/ratio - 1.0f;
+            bus->compressorAttackCoeff = (attack > 0.0f)? expf(-1000.0f/(attack*sampleRate)) : 0.0f;
+            bus->compressorReleaseCoeff = (release > 0.0f)? expf(-1000.0f/(release*sampleRate)) : 0.0f;
+
+            if (!bus->isCompressorActive)
+            {
+                bus->compressorEnvelope = 0.0f;
+                bus->compressorGain = 1.0f;
+            }
+        }
+
+        bus->isCompressorActive = (ratio > 1.0f);
+
+        // Reverb delay lines are cleared when enabled, previous reverb tail is not heard
+        float mix = ma_atomic_load_f32(&bus->reverbMix);
+        if (mix > 0.0f)
+        {
+            if (!bus->isReverbActive)
+            {
+                for (int c = 0; c < 2; c++)
+                {
+                    for (int i = 0; i < 12; i++)
+                    {
+                        AudioReverbLine *line = (i < 8)? &bus->reverbCombs[c][i] : &bus->reverbAllpasses[c][i - 8];
+                        memset(line->buffer, 0, line->length*sizeof(float));
+                        line->position = 0;
+                        line->store = 0.0f;
+                    }
+                }
+            }
+
+            bus->reverbFeedback = ma_atomic_load_f32(&bus->reverbRoomSize)*0.28f + 0.7f;
+            bus->reverbDamp = ma_atomic_load_f32(&bus->reverbDamping)*0.4f;
+            bus->reverbLevel = mix;
+        }
+
+        bus->isReverbActive = (mix > 0.0f);
+    }
+}
+
+// Sort audio buses by routing depth, deeper buses first so buses are processed before their outputs
+static void SortAudioBuses(void)
+{
+    for (rAudioBus *bus = AUDIO.Bus.first; bus != NULL; bus = bus->next)
+    {
+        bus->depth = 0;
+        for (rAudioBus *output = bus->output; output != NULL; output = output->output) bus->depth++;
+    }
+
+    rAudioBus *sorted = NULL;
+    rAudioBus *bus = AUDIO.Bus.first;
+
+    while (bus != NULL)
+    {
+        rAudioBus *next = bus->next;
+        rAudioBus **position = &sorted;
+
+        while ((*position != NULL) && ((*position)->depth >= bus->depth)) position = &(*position)->next;
+
+        bus->next = *position;
+        *position = bus;
+        bus = next;
+    }
+
+    AUDIO.Bus.first = sorted;
+}
+
+// Process audio buses effects and mix them to their outputs
+// NOTE: Buses are sorted by depth, buses mixed to a bus are processed before it
+static void MixAudioBuses(float *framesOut, ma_uint32 frameCount)
+{
+    const ma_uint32 channels = AUDIO.System.device.playback.channels;
+
+    ma_timer timer = { 0 };
+    ma_timer_init(&timer);
+    double time = 0.0;
+
+    for (rAudioBus *bus = AUDIO.Bus.first; bus != NULL; bus = bus->next)
+    {
+        if (bus->isFilterActive) ma_biquad_process_pcm_frames(&bus->filter, bus->frames, bus->frames, frameCount);
+        if (bus->isCompressorActive) ProcessAudioBusCompressor(bus, frameCount, channels);
+        if (bus->isReverbActive) ProcessAudioBusReverb(bus, frameCount, channels);
+
+        // Bus volume is ramped from the one applied on previous mix
+        const float volume = ma_atomic_load_f32(&bus->volume);
+        const float levels[2] = { bus->mixVolume, bus->mixVolume };
+        const float steps[2] = { (volume - bus->mixVolume)/frameCount, (volume - bus->mixVolume)/frameCount };
+
+        bus->mixVolume = volume;
+
+        MixAudioFramesLevels((bus->output != NULL)? bus->output->frames : framesOut, bus->frames, frameCount, levels, steps);
+
+        double now = ma_timer_get_time_in_seconds(&timer);
+        bus->processTime += (now - time);
+        time = now;
+    }
+}
+
+// Process audio bus compressor, stereo linked peak envelope
+// NOTE: Gain is computed every few frames and interpolated in between
+static void ProcessAudioBusCompressor(rAudioBus *bus, ma_uint32 frameCount, ma_uint32 channels)
+{
+    float envelope = bus->compressorEnvelope;
+    float gain = bus->compressorGain;
+
+    for (ma_uint32 frame = 0; frame < frameCount; frame += AUDIO_COMPRESSOR_STEP)
+    {
+        ma_uint32 count = ((frameCount - frame) < AUDIO_COMPRESSOR_STEP)? (frameCount - frame) : AUDIO_COMPRESSOR_STEP;
+        float *frames = bus->frames + (frame*channels);
+
+        for (ma_uint32 i = 0; i < count; i++)
+        {
+            float peak = 0.0f;
+            for (ma_uint32 c = 0; c < channels; c++) peak = (fabsf(frames[i*channels + c]) > peak)? fabsf(frames[i*channels + c]) : peak;
+
+            envelope = peak + ((peak > envelope)? bus->compressorAttackCoeff : bus->compressorReleaseCoeff)*(envelope - peak);
+        }
+
+        // Level over threshold is reduced by ratio
+        float target = (envelope > bus->compressorLevel)? powf(envelope/bus->compressorLevel, bus->compressorExponent) : 1.0f;
+        float step = (target - gain)/count;
+
+        for (ma_uint32 i = 0; i < count; i++)
+        {
+            gain += step;
+            for (ma_uint32 c = 0; c < channels; c++) frames[i*channels + c] *= gain;
+        }
+    }
+
+    bus->compressorEnvelope = envelope;
+    bus->compressorGain = gain;
+}
+
+// Process audio bus reverb, based on Freeverb: 8 parallel comb filters and 4 serial allpass filters per channel
+// NOTE: Reverb is processed for first two channels only, input is mixed down to mono
+static void ProcessAudioBusReverb(rAudioBus *bus, ma_uint32 frameCount, ma_uint32 channels)
+{
+    const int reverbChannels = (channels < 2)? channels : 2;
+    const float feedback = bus->reverbFeedback;
+    const float damp = bus->reverbDamp;
+    const float level = bus->reverbLevel;
+
+    for (ma_uint32 frame = 0; frame < frameCount; frame++)
+    {
+        float *frameOut = bus->frames + (frame*channels);
+
+        // Input has a tiny offset, avoiding denormals on decaying delay lines
+        float input = AUDIO_REVERB_DENORMAL;
+        for (int c = 0; c < reverbChannels; c++) input += frameOut[c]*(AUDIO_REVERB_INPUT_GAIN/reverbChannels);
+
+        for (int c = 0; c < reverbChannels; c++)
+        {
+            float output = 0.0f;
+
+            for (int i = 0; i < 8; i++)
+            {
+                AudioReverbLine *comb = &bus->reverbCombs[c][i];
+                float sample = comb->buffer[comb->position];
+
+                comb->store = sample*(1.0f - damp) + comb->store*damp;
+                comb->buffer[comb->position] = input + comb->store*feedback;
+                if (++comb->position >= comb->length) comb->position = 0;
+
+                output += sample;
+            }
+
+            for (int i = 0; i < 4; i++)
+            {
+                AudioReverbLine *allpass = &bus->reverbAllpasses[c][i];
+                float sample = allpass->buffer[allpass->position];
+
+                allpass->buffer[allpass->position] = output + sample*0.5f;
+                if (++allpass->position >= allpass->length) allpass->position = 0;
+
+                output = sample - output;
+            }
+
+            frameOut[c] = frameOut[c]*(1.0f - level) + output*level*AUDIO_REVERB_WET_GAIN;
+        }
+    }
+}
+
+// Store vector components shared with audio thread
+// NOTE: Components are stored one by one, a vector being updated could be read partially updated for one mix
+static void StoreAudioVector(float *vector, rl_Vector3 value)
+{
+    ma_atomic_store_f32(&vector[0], value.x);
+    ma_atomic_store_f32(&vector[1], value.y);
+    ma_atomic_store_f32(&vector[2], value.z);
+}
+
+// Update spatial sounds gain, pan and doppler pitch from emitters and listener
+// NOTE: Emitters are gathered in batches evaluated as structure of arrays, so SIMD evaluates several emitters at once
+static void UpdateAudioSpatial(void)
+{
+    AudioSpatialBatch batch;
+    float listener[3] = { 0 };
+
+    for (int i = 0; i < 3; i++)
+    {
+        listener[i] = ma_atomic_load_f32(&AUDIO.Listener.position[i]);
+        batch.listenerRight[i] = ma_atomic_load_f32(&AUDIO.Listener.right[i]);
+        batch.listenerVelocity[i] = ma_atomic_load_f32(&AUDIO.Listener.velocity[i]);
+    }
+
+    batch.doppler = ma_atomic_load_f32(&AUDIO.Listener.doppler);
+    batch.speedOfSound = ma_atomic_load_f32(&AUDIO.Listener.speedOfSound);
+    batch.count = 0;
+
+    for (AudioBuffer *buffer = AUDIO.Buffer.first; buffer != NULL; buffer = buffer->next)
+    {
+        if (!buffer->playing || buffer->paused || !ma_atomic_load_32(&buffer->isSpatial)) continue;
+
+        int i = batch.count;
+        int model = (int)ma_atomic_load_32(&buffer->attenuation);
+
+        batch.buffers[i] = buffer;
+        batch.models[i] = model;
+        batch.x[i] = ma_atomic_load_f32(&buffer->position[0]) - listener[0];
+        batch.y[i] = ma_atomic_load_f32(&buffer->position[1]) - listener[1];
+        batch.z[i] = ma_atomic_load_f32(&buffer->position[2]) - listener[2];
+        batch.vx[i] = ma_atomic_load_f32(&buffer->velocity[0]);
+        batch.vy[i] = ma_atomic_load_f32(&buffer->velocity[1]);
+        batch.vz[i] = ma_atomic_load_f32(&buffer->velocity[2]);
+        batch.dx[i] = ma_atomic_load_f32(&buffer->direction[0]);
+        batch.dy[i] = ma_atomic_load_f32(&buffer->direction[1]);
+        batch.dz[i] = ma_atomic_load_f32(&buffer->direction[2]);
+        batch.minDistance[i] = ma_atomic_load_f32(&buffer->minDistance);
+        batch.maxDistance[i] = ma_atomic_load_f32(&buffer->maxDistance);
+        batch.rolloff[i] = ma_atomic_load_f32(&buffer->rolloff);
+        batch.inverse[i] = (model == AUDIO_ATTENUATION_INVERSE)? 1.0f : 0.0f;
+        batch.linear[i] = (model == AUDIO_ATTENUATION_LINEAR)? 1.0f : 0.0f;
+        batch.coneInner[i] = ma_atomic_load_f32(&buffer->coneInner);
+        batch.coneOuter[i] = ma_atomic_load_f32(&buffer->coneOuter);
+        batch.coneOuterGain[i] = ma_atomic_load_f32(&buffer->coneOuterGain);
+
+        batch.count++;
+
+        if (batch.count == AUDIO_SPATIAL_BATCH_SIZE)
+        {
+            EvaluateAudioSpatialBatch(&batch);
+            ApplyAudioSpatialBatch(&batch);
+            batch.count = 0;
+        }
+    }
+
+    if (batch.count > 0)
+    {
+        EvaluateAudioSpatialBatch(&batch);
+        ApplyAudioSpatialBatch(&batch);
+    }
+}
+
+// Evaluate spatial emitters batch: distance, gain from distance and cone, pan and doppler pitch
+// NOTE: Exponential attenuation is not evaluated here (gain from distance is 1.0f), it requires pow()
+static void EvaluateAudioSpatialBatch(AudioSpatialBatch *batch)
+{
+    int i = 0;
+
+#if defined(RAUDIO_SSE2_ENABLED)
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 epsilon = _mm_set1_ps(AUDIO_SPATIAL_EPSILON);
+    const __m128 rx = _mm_set1_ps(batch->listenerRight[0]);
+    const __m128 ry = _mm_set1_ps(batch->listenerRight[1]);
+    const __m128 rz = _mm_set1_ps(batch->listenerRight[2]);
+    const __m128 lvx = _mm_set1_ps(batch->listenerVelocity[0]);
+    const __m128 lvy = _mm_set1_ps(batch->listenerVelocity[1]);
+    const __m128 lvz = _mm_set1_ps(batch->listenerVelocity[2]);
+    const __m128 doppler = _mm_set1_ps(batch->doppler);
+    const __m128 speedOfSound = _mm_set1_ps(batch->speedOfSound);
+    const __m128 pitchMin = _mm_set1_ps(AUDIO_SPATIAL_PITCH_MIN);
+    const __m128 pitchMax = _mm_set1_ps(AUDIO_SPATIAL_PITCH_MAX);
+
+    for (; (i + 4) <= batch->count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(batch->x + i);
+        __m128 y = _mm_loadu_ps(batch->y + i);
+        __m128 z = _mm_loadu_ps(batch->z + i);
+
+        __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+        __m128 inv = _mm_and_ps(_mm_cmpgt_ps(distance, epsilon), _mm_div_ps(one, distance));
+
+        // Unit vector from emitter to listener
+        __m128 ux = _mm_sub_ps(zero, _mm_mul_ps(x, inv));
+        __m128 uy = _mm_sub_ps(zero, _mm_mul_ps(y, inv));
+        __m128 uz = _mm_sub_ps(zero, _mm_mul_ps(z, inv));
+
+        __m128 pan = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, rx), _mm_mul_ps(y, ry)), _mm_mul_ps(z, rz)), inv);
+        pan = _mm_min_ps(_mm_max_ps(pan, minusOne), one);
+
+        // Distance attenuation, inverse and linear models weighted by emitter model
+        __m128 minDistance = _mm_loadu_ps(batch->minDistance + i);
+        __m128 maxDistance = _mm_loadu_ps(batch->maxDistance + i);
+        __m128 rolloff = _mm_loadu_ps(batch->rolloff + i);
+        __m128 range = _mm_mul_ps(rolloff, _mm_sub_ps(_mm_min_ps(_mm_max_ps(distance, minDistance), maxDistance), minDistance));
+
+        __m128 inverse = _mm_div_ps(minDistance, _mm_add_ps(minDistance, range));
+        __m128 linear = _mm_sub_ps(one, _mm_div_ps(range, _mm_max_ps(_mm_sub_ps(maxDistance, minDistance), epsilon)));
+        linear = _mm_max_ps(linear, zero);
+
+        __m128 gain = _mm_add_ps(one, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(batch->inverse + i), _mm_sub_ps(inverse, one)),
+                                                 _mm_mul_ps(_mm_loadu_ps(batch->linear + i), _mm_sub_ps(linear, one))));
+
+        // Cone attenuation, interpolated between inner and outer angles
+        __m128 angle = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(batch->dx + i), ux), _mm_mul_ps(_mm_loadu_ps(batch->dy + i), uy)),
+                                  _mm_mul_ps(_mm_loadu_ps(batch->dz + i), uz));
+        __m128 coneInner = _mm_loadu_ps(batch->coneInner + i);
+        __m128 coneOuter = _mm_loadu_ps(batch->coneOuter + i);
+        __m128 coneOuterGain = _mm_loadu_ps(batch->coneOuterGain + i);
+        __m128 cone = _mm_div_ps(_mm_sub_ps(angle, coneOuter), _mm_max_ps(_mm_sub_ps(coneInner, coneOuter), epsilon));
+        cone = _mm_min_ps(_mm_max_ps(cone, zero), one);
+
+        gain = _mm_mul_ps(gain, _mm_add_ps(coneOuterGain, _mm_mul_ps(_mm_sub_ps(one, coneOuterGain), cone)));
+
+        // Doppler shift, listener and emitter velocities projected on emitter to listener direction
+        __m128 listenerSpeed = _mm_add_ps(_mm_add_ps(_mm_mul_ps(lvx, ux), _mm_mul_ps(lvy, uy)), _mm_mul_ps(lvz, uz));
+        __m128 emitterSpeed = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_loadu_ps(batch->vx + i), ux), _mm_mul_ps(_mm_loadu_ps(batch->vy + i), uy)),
+                                         _mm_mul_ps(_mm_loadu_ps(batch->vz + i), uz));
+        __m128 pitch = _mm_div_ps(_mm_sub_ps(speedOfSound, _mm_mul_ps(doppler, listenerSpeed)),
+                                  _mm_max_ps(_mm_sub_ps(speedOfSound, _mm_mul_ps(doppler, emitterSpeed)), epsilon));
+        pitch = _mm_min_ps(_mm_max_ps(pitch, pitchMin), pitchMax);
+
+        _mm_storeu_ps(batch->distance + i, distance);
+        _mm_storeu_ps(batch->gain + i, gain);
+        _mm_storeu_ps(batch->pan + i, pan);
+        _mm_storeu_ps(batch->pitch + i, pitch);
+    }
+#elif defined(RAUDIO_NEON_ENABLED) && (defined(__aarch64__) || defined(_M_ARM64))
+    // NOTE: Vector division and square root are only available on AArch64
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t minusOne = vdupq_n_f32(-1.0f);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t epsilon = vdupq_n_f32(AUDIO_SPATIAL_EPSILON);
+    const float32x4_t rx = vdupq_n_f32(batch->listenerRight[0]);
+    const float32x4_t ry = vdupq_n_f32(batch->listenerRight[1]);
+    const float32x4_t rz = vdupq_n_f32(batch->listenerRight[2]);
+    const float32x4_t lvx = vdupq_n_f32(batch->listenerVelocity[0]);
+    const float32x4_t lvy = vdupq_n_f32(batch->listenerVelocity[1]);
+    const float32x4_t lvz = vdupq_n_f32(batch->listenerVelocity[2]);
+    const float32x4_t doppler = vdupq_n_f32(batch->doppler);
+    const float32x4_t speedOfSound = vdupq_n_f32(batch->speedOfSound);
+    const float32x4_t pitchMin = vdupq_n_f32(AUDIO_SPATIAL_PITCH_MIN);
+    const float32x4_t pitchMax = vdupq_n_f32(AUDIO_SPATIAL_PITCH_MAX);
+
+    for (; (i + 4) <= batch->count; i += 4)
+    {
+        float32x4_t x = vld1q_f32(batch->x + i);
+        float32x4_t y = vld1q_f32(batch->y + i);
+        float32x4_t z = vld1q_f32(batch->z + i);
+
+        float32x4_t distance = vsqrtq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(x, x), y, y), z, z));
+        float32x4_t inv = vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(distance, epsilon), vreinterpretq_u32_f32(vdivq_f32(one, distance))));
+
+        // Unit vector from emitter to listener
+        float32x4_t ux = vnegq_f32(vmulq_f32(x, inv));
+        float32x4_t uy = vnegq_f32(vmulq_f32(y, inv));
+        float32x4_t uz = vnegq_f32(vmulq_f32(z, inv));
+
+        float32x4_t pan = vmulq_f32(vmlaq_f32(vmlaq_f32(vmulq_f32(x, rx), y, ry), z, rz), inv);
+        pan = vminq_f32(vmaxq_f32(pan, minusOne), one);
+
+        // Distance attenuation, inverse and linear models weighted by emitter model
+        float32x4_t minDistance = vld1q_f32(batch->minDistance + i);
+        float32x4_t maxDistance = vld1q_f32(batch->maxDistance + i);
+        float32x4_t rolloff = vld1q_f32(batch->rolloff + i);
+        float32x4_t range = vmulq_f32(rolloff, vsubq_f32(vminq_f32(vmaxq_f32(distance, minDistance), maxDistance), minDistance));
+
+        float32x4_t inverse = vdivq_f32(minDistance, vaddq_f32(minDistance, range));
+        float32x4_t linear = vsubq_f32(one, vdivq_f32(range, vmaxq_f32(vsubq_f32(maxDistance, minDistance), epsilon)));
+        linear = vmaxq_f32(linear, zero);
+
+        float32x4_t gain = vmlaq_f32(vmlaq_f32(one, vld1q_f32(batch->inverse + i), vsubq_f32(inverse, one)),
+                                     vld1q_f32(batch->linear + i), vsubq_f32(linear, one));
+
+        // Cone attenuation, interpolated between inner and outer angles
+        float32x4_t angle = vmlaq_f32(vmlaq_f32(vmulq_f32(vld1q_f32(batch->dx + i), ux), vld1q_f32(batch->dy + i), uy), vld1q_f32(batch->dz + i), uz);
+        float32x4_t coneInner = vld1q_f32(batch->coneInner + i);
+        float32x4_t coneOuter = vld1q_f32(batch->coneOuter + i);
+        float32x4_t coneOuterGain = vld1q_f32(batch->coneOuterGain + i);
+        float32x4_t cone = vdivq_f32(vsubq_f32(angle, coneOuter), vmaxq_f32(vsubq_f32(coneInner, coneOuter), epsilon));
+        cone = vminq_f32(vmaxq_f32(cone, zero), one);
+
+        gain = vmulq_f32(gain, vmlaq_f32(coneOuterGain, vsubq_f32(one, coneOuterGain), cone));
+
+        // Doppler shift, listener and emitter velocities projected on emitter to listener direction
+        float32x4_t listenerSpeed = vmlaq_f32(vmlaq_f32(vmulq_f32(lvx, ux), lvy, uy), lvz, uz);
+        float32x4_t emitterSpeed = vmlaq_f32(vmlaq_f32(vmulq_f32(vld1q_f32(batch->vx + i), ux), vld1q_f32(batch->vy + i), uy), vld1q_f32(batch->vz + i), uz);
+        float32x4_t pitch = vdivq_f32(vmlsq_f32(speedOfSound, doppler, listenerSpeed), vmaxq_f32(vmlsq_f32(speedOfSound, doppler, emitterSpeed), epsilon));
+        pitch = vminq_f32(vmaxq_f32(pitch, pitchMin), pitchMax);
+
+        vst1q_f32(batch->distance + i, distance);
+        vst1q_f32(batch->gain + i, gain);
+        vst1q_f32(batch->pan + i, pan);
+        vst1q_f32(batch->pitch + i, pitch);
+    }
+#endif
+
+    // Remaining emitters (or all emitters if no SIMD support)
+    for (; i < batch->count; i++)
+    {
+        const float x = batch->x[i];
+        const float y = batch->y[i];
+        const float z = batch->z[i];
+
+        float distance = sqrtf(x*x + y*y + z*z);
+        float inv = (distance > AUDIO_SPATIAL_EPSILON)? 1.0f/distance : 0.0f;
+
+        // Unit vector from emitter to listener
+        float ux = -x*inv;
+        float uy = -y*inv;
+        float uz = -z*inv;
+
+        float pan = (x*batch->listenerRight[0] + y*batch->listenerRight[1] + z*batch->listenerRight[2])*inv;
+        if (pan < -1.0f) pan = -1.0f;
+        else if (pan > 1.0f) pan = 1.0f;
+
+        // Distance attenuation, inverse and linear models weighted by emitter model
+        float minDistance = batch->minDistance[i];
+        float maxDistance = batch->maxDistance[i];
+        float clamped = (distance < minDistance)? minDistance : ((distance > maxDistance)? maxDistance : distance);
+        float range = batch->rolloff[i]*(clamped - minDistance);
+
+        float inverse = minDistance/(minDistance + range);
+        float linear = 1.0f - range/(((maxDistance - minDistance) > AUDIO_SPATIAL_EPSILON)? (maxDistance - minDistance) : AUDIO_SPATIAL_EPSILON);
+        if (linear < 0.0f) linear = 0.0f;
+
+        float gain = 1.0f + batch->inverse[i]*(inverse - 1.0f) + batch->linear[i]*(linear - 1.0f);
+
+        // Cone attenuation, interpolated between inner and outer angles
+        float angle = batch->dx[i]*ux + batch->dy[i]*uy + batch->dz[i]*uz;
+        float coneRange = batch->coneInner[i] - batch->coneOuter[i];
+        float cone = (angle - batch->coneOuter[i])/((coneRange > AUDIO_SPATIAL_EPSILON)? coneRange : AUDIO_SPATIAL_EPSILON);
+        if (cone < 0.0f) cone = 0.0f;
+        else if (cone > 1.0f) cone = 1.0f;
+
+        gain *= batch->coneOuterGain[i] + (1.0f - batch->coneOuterGain[i])*cone;
+
+        // Doppler shift, listener and emitter velocities projected on emitter to listener direction
+        float listenerSpeed = batch->listenerVelocity[0]*ux + batch->listenerVelocity[1]*uy + batch->listenerVelocity[2]*uz;
+        float emitterSpeed = batch->vx[i]*ux + batch->vy[i]*uy + batch->vz[i]*uz;
+        float denominator = batch->speedOfSound - batch->doppler*emitterSpeed;
+        float pitch = (batch->speedOfSound - batch->doppler*listenerSpeed)/((denominator > AUDIO_SPATIAL_EPSILON)? denominator : AUDIO_SPATIAL_EPSILON);
+        if (pitch < AUDIO_SPATIAL_PITCH_MIN) pitch = AUDIO_SPATIAL_PITCH_MIN;
+        else if (pitch > AUDIO_SPATIAL_PITCH_MAX) pitch = AUDIO_SPATIAL_PITCH_MAX;
+
+        batch->distance[i] = distance;
+        batch->gain[i] = gain;
+        batch->pan[i] = pan;
+        batch->pitch[i] = pitch;
+    }
+}
+
+// Apply spatial emitters batch evaluated values to audio buffers
+static void ApplyAudioSpatialBatch(AudioSpatialBatch *batch)
+{
+    for (int i = 0; i < batch->count; i++)
+    {
+        AudioBuffer *buffer = batch->buffers[i];
+        float gain = batch->gain[i];
+
+        if (batch->models[i] == AUDIO_ATTENUATION_EXPONENTIAL)
+        {
+            float minDistance = batch->minDistance[i];
+            float maxDistance = batch->maxDistance[i];
+            float distance = (batch->distance[i] < minDistance)? minDistance : ((batch->distance[i] > maxDistance)? maxDistance : batch->distance[i]);
+
+            gain *= powf(distance/minDistance, -batch->rolloff[i]);
+        }
+
+        buffer->spatialGain = gain;
+        buffer->spatialPan = batch->pan[i];
+
+        // Doppler pitch requires resampling rate update, only done for mixed voices on noticeable changes
+        if (!buffer->isVirtual && (fabsf(batch->pitch[i] - buffer->spatialPitch) > buffer->spatialPitch*AUDIO_SPATIAL_PITCH_STEP))
+        {
+            buffer->spatialPitch = batch->pitch[i];
+            SetAudioBufferRate(buffer);
+        }
+    }
+}
+
+// Set audio buffer resampling rate from pitch and doppler pitch
+static void SetAudioBufferRate(AudioBuffer *buffer)
+{
+    // Pitching is just an adjustment of the sample rate
+    // Note that this changes the duration of the sound:
+    //  - higher pitches will make the sound faster
+    //  - lower pitches make it slower
+    ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/(buffer->pitch*buffer->spatialPitch));
+    ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+    // Resampler state is outdated after conversion being skipped
+    bool isPassthrough = IsAudioBufferPassthrough(buffer, outputSampleRate);
+    if (buffer->isPassthrough && !isPassthrough) ma_data_converter_reset(&buffer->converter);
+    buffer->isPassthrough = isPassthrough;
+}
+
+// Promote virtual voice to be mixed, fading in unless it has just started playing
+static void PromoteAudioVoice(AudioBuffer *buffer)
+{
+    buffer->isVirtual = false;
+
+    if (buffer->isVoiceNew) GetAudioBufferMixLevels(buffer, AUDIO.System.device.playback.channels, buffer->mixLevels);
+}
+
+// Demote voice to virtual, it is faded out on next mix unless it has just started playing
+static void DemoteAudioVoice(AudioBuffer *buffer)
+{
+    buffer->isVirtual = true;
+
+    if (buffer->isVoiceNew)
+    {
+        buffer->mixLevels[0] = 0.0f;
+        buffer->mixLevels[1] = 0.0f;
+    }
+}
+
+// Advance virtual voice playback position as if it was mixed
+static void AdvanceAudioVoice(AudioBuffer *buffer, ma_uint32 frameCount)
+{
+    ma_uint64 framesIn = 0;
+    ma_data_converter_get_required_input_frame_count(&buffer->converter, frameCount, &framesIn);
+
+    if (buffer->isRing)
+    {
+        ma_uint32 framesQueued = ma_atomic_load_32(&buffer->ringWrite) - buffer->ringRead;
+        ma_atomic_store_32(&buffer->ringRead, buffer->ringRead + ((framesIn < framesQueued)? (ma_uint32)framesIn : framesQueued));
+        return;
+    }
+
+    ma_uint64 cursor = buffer->frameCursorPos + framesIn;
+
+    if (cursor >= buffer->sizeInFrames)
+    {
+        if (!buffer->looping || (buffer->sizeInFrames == 0))
+        {
+            StopAudioBufferInAudioThread(buffer);
+            return;
+        }
+
+        cursor %= buffer->sizeInFrames;
+    }
+
+    ma_atomic_store_32(&buffer->frameCursorPos, (ma_uint32)cursor);
+}
+
+// Update audio stream sub-buffer with data and submit it to audio thread
+// NOTE: Sub-buffer must be processed, it is owned by program thread until submitted
+static void UpdateAudioStreamSubBuffer(rl_AudioStream stream, int subBuffer, const void *data, int frameCount)
+{
+    ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
+    unsigned char *subBufferData = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBuffer);
+
+    ma_atomic_fetch_add_32(&stream.buffer->framesProcessed, frameCount);
+
+    // Does this API expect a whole buffer to be updated in one go?
+    // Assuming so, but if not will need to change this logic
+    if (subBufferSizeInFrames >= (ma_uint32)frameCount)
+    {
+        ma_uint32 framesToWrite = (ma_uint32)frameCount;
+
+        ma_uint32 bytesToWrite = framesToWrite*stream.channels*(stream.sampleSize/8);
+        memcpy(subBufferData, data, bytesToWrite);
+
+        // Any leftover frames should be filled with zeros
+        ma_uint32 leftoverFrameCount = subBufferSizeInFrames - framesToWrite;
+
+        if (leftoverFrameCount > 0) memset(subBufferData + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
+
+        ma_atomic_store_32(&stream.buffer->subBufferState[subBuffer], AUDIO_SUBBUFFER_QUEUED);
+        SendAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_SUBMIT, .buffer = stream.buffer, .param = subBuffer });
+    }
+    else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
+}
+
+// Update ring audio stream with data copied to ring
+static void UpdateAudioStreamRing(rl_AudioStream stream, const void *data, int frameCount)
+{
+    int frameSize = stream.channels*stream.sampleSize/8;
+    int framesWritten = 0;
+
+    // Ring end splits data in two writes
+    while (framesWritten < frameCount)
+    {
+        int framesToWrite = frameCount - framesWritten;
+        void *frames = rl_BeginAudioStreamWrite(stream, &framesToWrite);
+
+        if (framesToWrite == 0) break;
+
+        memcpy(frames, (const unsigned char *)data + framesWritten*frameSize, framesToWrite*frameSize);
+        rl_EndAudioStreamWrite(stream, framesToWrite);
+        framesWritten += framesToWrite;
+    }
+
+    if (framesWritten < frameCount) TRACELOG(LOG_WARNING, "STREAM: Ring full, %i frames not written", frameCount - framesWritten);
+}
+
+// Get audio streams sub-buffer size, good enough for a decent frame rate at the device bit size/rate if not set
+// NOTE: The size of a streaming buffer must be at least double the size of a period
+static unsigned int GetAudioStreamSubBufferSize(void)
+{
+    unsigned int periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+
+    int deviceBitsPerSample = AUDIO.System.device.playback.format;
+    if (deviceBitsPerSample > 4)  deviceBitsPerSample = 4;
+    deviceBitsPerSample *= AUDIO.System.device.playback.channels;
+
+    unsigned int subBufferSize = (AUDIO.Buffer.defaultSize == 0)? (AUDIO.System.device.sampleRate/30*deviceBitsPerSample) : AUDIO.Buffer.defaultSize;
+
+    if (subBufferSize < periodSize) subBufferSize = periodSize;
+
+    return subBufferSize;
+}
+
+// Read music frames from music context, music is rewound when reaching the end
+static void ReadMusicStreamFrames(rl_Music music, void *framesOut, unsigned int frameCount)
+{
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    int frameCountStillNeeded = (int)frameCount;
+    int frameCountReadTotal = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+            else if (music.stream.sampleSize == 32)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            while (true)
+            {
+                int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)framesOut + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)framesOut, frameCount);
+            frameCountReadTotal += frameCountRead;
+            /*
+            while (true)
+            {
+                int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)framesOut + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+            }
+            */
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drflac__seek_to_first_frame((drflac *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)framesOut, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)framesOut, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)framesOut, frameCount);
+            //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            if (music.stream.sampleSize == 32)
+            {
+                // Samples are generated into the second half of output and expanded to float in place,
+                // every float written only overlaps samples already read, no conversion is required on mixing
+                short *samples = (short *)framesOut + frameCount*AUDIO_DEVICE_CHANNELS;
+                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, samples, frameCount, 0);
+
+                for (unsigned int i = 0; i < frameCount*AUDIO_DEVICE_CHANNELS; i++) ((float *)framesOut)[i] = (float)samples[i]/32768.0f;
+            }
+            else jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)framesOut, frameCount, 0);
+            //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+        } break;
+    #endif
+        default: break;
+    }
+}
+
+#if defined(SUPPORT_FILEFORMAT_MOD)
+// Set MOD module generation at device sample rate, required before loading
+static void SetMusicModuleConfig(jar_mod_context_t *ctxMod)
+{
+    if (AUDIO.System.device.sampleRate > 0) jar_mod_setcfg(ctxMod, AUDIO.System.device.sampleRate, 16, 1, ctxMod->stereo_separation, ctxMod->filter);
+}
+#endif
+
+// Rewind music context to the start
+static void RewindMusicStream(rl_Music music)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+// Read music stream reader data, returns bytes read
+static size_t ReadMusicReader(void *userData, void *buffer, size_t size)
+{
+    rl_AudioReader *reader = &((AudioMusicReader *)userData)->reader;
+    size_t bytesRead = 0;
+
+    // NOTE: Big reads are split, reader callback reads up to INT_MAX bytes
+    while (bytesRead < size)
+    {
+        size_t bytesToRead = size - bytesRead;
+        if (bytesToRead > INT_MAX) bytesToRead = INT_MAX;
+
+        int result = reader->read(reader->userData, (unsigned char *)buffer + bytesRead, (int)bytesToRead);
+        if (result <= 0) break;
+
+        bytesRead += (size_t)result;
+    }
+
+    return bytesRead;
+}
+
+// Seek music stream reader data, origin: SEEK_SET, SEEK_CUR or SEEK_END
+static bool SeekMusicReader(void *userData, long long offset, int origin)
+{
+    rl_AudioReader *reader = &((AudioMusicReader *)userData)->reader;
+
+    return reader->seek(reader->userData, offset, origin);
+}
+
+// Get music stream reader data position
+static ma_uint32 TellMusicReader(void *userData, ma_int64 *cursor)
+{
+    rl_AudioReader *reader = &((AudioMusicReader *)userData)->reader;
+
+    long long position = reader->tell(reader->userData);
+    if (position < 0) return MA_FALSE;
+
+    *cursor = position;
+
+    return MA_TRUE;
+}
+
+#if defined(SUPPORT_FILEFORMAT_WAV)
+// Seek music stream reader data, dr_wav callback
+static drwav_bool32 SeekMusicReaderWav(void *userData, int offset, drwav_seek_origin origin)
+{
+    return SeekMusicReader(userData, offset, (origin == DRWAV_SEEK_SET)? SEEK_SET : (origin == DRWAV_SEEK_CUR)? SEEK_CUR : SEEK_END);
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_MP3)
+// Seek music stream reader data, dr_mp3 callback
+static drmp3_bool32 SeekMusicReaderMp3(void *userData, int offset, drmp3_seek_origin origin)
+{
+    return SeekMusicReader(userData, offset, (origin == DRMP3_SEEK_SET)? SEEK_SET : (origin == DRMP3_SEEK_CUR)? SEEK_CUR : SEEK_END);
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+// Read music stream reader data, qoaplay callback
+static unsigned int ReadMusicReaderQoa(void *userData, void *buffer, unsigned int size)
+{
+    return (unsigned int)ReadMusicReader(userData, buffer, size);
+}
+
+// Seek music stream reader data, qoaplay callback
+static int SeekMusicReaderQoa(void *userData, unsigned int position)
+{
+    return SeekMusicReader(userData, position, SEEK_SET);
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+// Seek music stream reader data, dr_flac callback
+static drflac_bool32 SeekMusicReaderFlac(void *userData, int offset, drflac_seek_origin origin)
+{
+    return SeekMusicReader(userData, offset, (origin == DRFLAC_SEEK_SET)? SEEK_SET : (origin == DRFLAC_SEEK_CUR)? SEEK_CUR : SEEK_END);
+}
+#endif
+
+// Music decoder thread, keeps threaded music decoded ahead
+static ma_thread_result MA_THREADCALL MusicDecoderThread(void *pUserData)
+{
+    (void)pUserData;
+
+    while (ma_atomic_load_32(&AUDIO.Music.isRunning))
+    {
+        // One chunk is decoded per music on every pass, lock is released between passes
+        bool isDecoded = false;
+
+        LockAudioMusic();
+
+        for (AudioMusicDecoder *decoder = AUDIO.Music.first; decoder != NULL; decoder = decoder->next)
+        {
+            if (DecodeMusicChunk(decoder)) isDecoded = true;
+        }
+
+        ma_mutex_unlock(&AUDIO.Music.lock);
+
+        if (!isDecoded) ma_sleep(AUDIO_MUSIC_DECODER_SLEEP);
+    }
+
+    return (ma_thread_result)0;
+}
+
+// Decode next music chunk if there is room in decoded chunks ring, called from decoder thread
+// NOTE: Decoders lock must be held, returns true if a chunk was decoded
+static bool DecodeMusicChunk(AudioMusicDecoder *decoder)
+{
+    rl_Music music = decoder->music;
+
+    // Music ended playing, it is rewound as rl_StopMusicStream() does
+    if (ma_atomic_load_32(&decoder->rewind) == decoder->generation)
+    {
+        RewindMusicStream(music);
+        decoder->framesDecoded = 0;
+        ma_atomic_store_32(&decoder->generation, decoder->generation + 1);
+    }
+
+    if ((decoder->head - ma_atomic_load_32(&decoder->tail)) >= AUDIO_MUSIC_DECODE_BUFFERS) return false;
+
+    unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    bool looping = ma_atomic_load_32(&decoder->looping);
+
+    unsigned int framesLeft = music.frameCount - decoder->framesDecoded;
+    unsigned int framesToStream = ((framesLeft >= subBufferSizeInFrames) || looping)? subBufferSizeInFrames : framesLeft;
+
+    if (framesToStream == 0)
+    {
+        ma_atomic_store_32(&decoder->ended, decoder->generation);
+        return false;
+    }
+
+    ma_uint32 index = decoder->head%AUDIO_MUSIC_DECODE_BUFFERS;
+
+    ReadMusicStreamFrames(music, decoder->data + index*subBufferSizeInFrames*frameSize, framesToStream);
+
+    decoder->chunks[index].frameCount = framesToStream;
+    decoder->chunks[index].position = decoder->framesDecoded;
+    decoder->chunks[index].generation = decoder->generation;
+
+    decoder->framesDecoded += framesToStream;
+    if (looping) decoder->framesDecoded %= music.frameCount;
+
+    ma_atomic_store_32(&decoder->head, decoder->head + 1);
+
+    return true;
+}
+
+// Update audio buffer sub-buffers with music decoded ahead, called from audio thread
+// NOTE: Sub-buffers of threaded music are only updated by audio thread
+static void UpdateAudioBufferFromDecoder(AudioBuffer *buffer)
+{
+    AudioMusicDecoder *decoder = buffer->decoder;
+
+    // NOTE: Ended generation is loaded first, all its chunks are available afterwards
+    ma_uint32 ended = ma_atomic_load_32(&decoder->ended);
+    ma_uint32 generation = ma_atomic_load_32(&decoder->generation);
+    ma_uint32 head = ma_atomic_load_32(&decoder->head);
+    ma_uint32 tail = decoder->tail;
+
+    // Music seeked or rewound, sub-buffers data is discarded
+    if (buffer->decoderGeneration != generation)
+    {
+        for (int i = 0; i < 2; i++) ma_atomic_store_32(&buffer->subBufferState[i], AUDIO_SUBBUFFER_PROCESSED);
+
+        buffer->decoderGeneration = generation;
+    }
+
+    // Chunks decoded before seeking or rewinding are discarded
+    while ((tail != head) && (decoder->chunks[tail%AUDIO_MUSIC_DECODE_BUFFERS].generation < generation)) tail++;
+
+    ma_uint32 subBufferSizeInFrames = buffer->sizeInFrames/2;
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(buffer->converter.formatIn, buffer->converter.channelsIn);
+
+    while ((tail != head) && (decoder->chunks[tail%AUDIO_MUSIC_DECODE_BUFFERS].generation == generation))
+    {
+        bool isSubBufferPending[2] = { 0 };
+        isSubBufferPending[0] = (ma_atomic_load_32(&buffer->subBufferState[0]) == AUDIO_SUBBUFFER_PENDING);
+        isSubBufferPending[1] = (ma_atomic_load_32(&buffer->subBufferState[1]) == AUDIO_SUBBUFFER_PENDING);
+
+        if (isSubBufferPending[0] && isSubBufferPending[1]) break;
+
+        // Both sub-buffers available, cursor is moved back to the front
+        int subBuffer = isSubBufferPending[0]? 1 : 0;
+        if (!isSubBufferPending[0] && !isSubBufferPending[1]) ma_atomic_store_32(&buffer->frameCursorPos, 0);
+
+        AudioMusicChunk *chunk = &decoder->chunks[tail%AUDIO_MUSIC_DECODE_BUFFERS];
+        unsigned char *subBufferData = buffer->data + subBuffer*subBufferSizeInFrames*frameSizeInBytes;
+
+        memcpy(subBufferData, decoder->data + (tail%AUDIO_MUSIC_DECODE_BUFFERS)*subBufferSizeInFrames*frameSizeInBytes, chunk->frameCount*frameSizeInBytes);
+        if (chunk->frameCount < subBufferSizeInFrames) memset(subBufferData + chunk->frameCount*frameSizeInBytes, 0, (subBufferSizeInFrames - chunk->frameCount)*frameSizeInBytes);
+
+        ma_atomic_store_32(&buffer->framesProcessed, chunk->position + chunk->frameCount);
+        ma_atomic_store_32(&buffer->subBufferState[subBuffer], AUDIO_SUBBUFFER_PENDING);
+        tail++;
+    }
+
+    ma_atomic_store_32(&decoder->tail, tail);
+
+    // Music ended once all music decoded has been processed, decoder thread rewinds it
+    if ((ended == generation) && (tail == head) &&
+        (ma_atomic_load_32(&buffer->subBufferState[0]) != AUDIO_SUBBUFFER_PENDING) &&
+        (ma_atomic_load_32(&buffer->subBufferState[1]) != AUDIO_SUBBUFFER_PENDING))
+    {
+        StopAudioBufferInAudioThread(buffer);
+        ma_atomic_store_32(&decoder->rewind, generation);
+    }
+}
+
+#if defined(SUPPORT_FILEFORMAT_QOA)
+// Check if a sound is kept compressed, considering its size once converted to device format
+static bool IsSoundCompressed(unsigned int frameCount, unsigned int sampleRate)
+{
+    if ((AUDIO_SOUND_COMPRESSED_SIZE <= 0) || (sampleRate == 0)) return false;
+
+    double deviceSize = (double)frameCount*AUDIO.System.device.sampleRate/sampleRate*ma_get_bytes_per_frame(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS);
+
+    return (deviceSize >= (double)AUDIO_SOUND_COMPRESSED_SIZE);
+}
+
+// Load compressed sound from QOA data, data ownership is taken on success
+// NOTE: rl_Sound data is kept on QOA format and decoded by audio thread on mixing
+static rl_Sound LoadSoundCompressed(unsigned char *data, unsigned int dataSize)
+{
+    rl_Sound sound = { 0 };
+    qoa_desc qoa = { 0 };
+
+    if (qoa_decode_header(data, dataSize, &qoa) == 0) return sound;
+
+    AudioBuffer *audioBuffer = LoadAudioBuffer(ma_format_s16, qoa.channels, qoa.samplerate, 0, AUDIO_BUFFER_USAGE_STATIC);
+    if (audioBuffer == NULL)
+    {
+        TRACELOG(LOG_WARNING, "SOUND: Failed to create buffer");
+        return sound;
+    }
+
+    audioBuffer->data = data;
+    audioBuffer->sizeInFrames = qoa.samples;
+    audioBuffer->qoaSize = dataSize;
+    audioBuffer->qoa = qoa;
+    audioBuffer->qoaFrame = (short *)RL_CALLOC(QOA_FRAME_LEN*qoa.channels, sizeof(short));
+    UpdateAudioMemoryStats(audioBuffer, dataSize + QOA_FRAME_LEN*qoa.channels*sizeof(short), false);
+
+    sound.frameCount = qoa.samples;
+    sound.stream.sampleRate = qoa.samplerate;
+    sound.stream.sampleSize = 16;
+    sound.stream.channels = qoa.channels;
+    sound.stream.buffer = audioBuffer;
+
+    TRACELOG(LOG_INFO, "SOUND: Data kept compressed (QOA): %i KB, %i KB on device format", dataSize/1024,
+        (int)((double)qoa.samples*AUDIO.System.device.sampleRate/qoa.samplerate*ma_get_bytes_per_frame(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS)/1024));
+
+    return sound;
+}
+
+// Decode compressed sound QOA frame at cursor position, called from audio thread
+// NOTE: Frames count is limited to the frames available in decoded QOA frame
+static const short *DecodeAudioBufferFrames(AudioBuffer *buffer, ma_uint32 *frameCount)
+{
+    ma_uint32 frameIndex = buffer->frameCursorPos/QOA_FRAME_LEN;
+    ma_uint32 frameOffset = buffer->frameCursorPos%QOA_FRAME_LEN;
+
+    if (buffer->qoaFrameIndex != (frameIndex + 1))
+    {
+        // NOTE: All QOA frames but last one are full frames, frames are located without parsing
+        unsigned int offset = 8 + frameIndex*QOA_FRAME_SIZE(buffer->qoa.channels, QOA_SLICES_PER_FRAME);
+        unsigned int frameLength = 0;
+
+        if ((offset >= buffer->qoaSize) || (qoa_decode_frame(buffer->data + offset, buffer->qoaSize - offset, &buffer->qoa, buffer->qoaFrame, &frameLength) == 0))
+        {
+            memset(buffer->qoaFrame, 0, QOA_FRAME_LEN*buffer->qoa.channels*sizeof(short));
+        }
+
+        buffer->qoaFrameIndex = frameIndex + 1;
     }
+
+    if (*frameCount > (QOA_FRAME_LEN - frameOffset)) *frameCount = QOA_FRAME_LEN - frameOffset;
+
+    return buffer->qoaFrame + frameOffset*buffer->qoa.channels;
 }
+#endif
 
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
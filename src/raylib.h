@@ -25,6 +25,8 @@
 *       - One default rl_Texture2D is loaded on rlglInit(), 1x1 white pixel R8G8B8A8 [rlgl] (OpenGL 3.3 or ES2)
 *       - One default rl_Shader is loaded on rlglInit()->rlLoadShaderDefault() [rlgl] (OpenGL 3.3 or ES2)
 *       - One default RenderBatch is loaded on rlglInit()->rlLoadRenderBatch() [rlgl] (OpenGL 3.3 or ES2)
+*       - Audio functions must be called from a single program thread, commands are sent to the audio thread
+*         through a single-producer queue [raudio]
 *
 *   DEPENDENCIES (included):
 *       [rcore][GLFW] rglfw (Camilla Löwy - github.com/glfw/glfw) for window/context management and input
@@ -267,6 +269,16 @@ typedef struct rl_Image {
     int format;             // Data format (rl_PixelFormat type)
 } rl_Image;
 
+// rl_ImageView, non-owning view of image pixels area (rows stride in bytes)
+typedef struct rl_ImageView {
+    void *data;             // First pixel of view area
+    int width;              // View width
+    int height;             // View height
+    int stride;             // Bytes between rows start
+    int format;             // Data format (rl_PixelFormat type, uncompressed)
+    void *storage;          // Reference-counted storage shared by views (NULL if not shared)
+} rl_ImageView;
+
 // rl_Texture, tex data stored in GPU memory (VRAM)
 typedef struct rl_Texture {
     unsigned int id;        // OpenGL texture id
@@ -282,6 +294,26 @@ typedef rl_Texture rl_Texture2D;
 // rl_TextureCubemap, same as rl_Texture
 typedef rl_Texture rl_TextureCubemap;
 
+// rl_TextureArray, array of 2D texture layers of same size and format stored in GPU memory (VRAM)
+typedef struct rl_TextureArray {
+    unsigned int id;        // OpenGL texture id
+    int width;              // Layers width
+    int height;             // Layers height
+    int layers;             // Number of layers
+    int mipmaps;            // Mipmap levels, 1 by default
+    int format;             // Data format (rl_PixelFormat type)
+} rl_TextureArray;
+
+// rl_Texture3D, volume texture stored in GPU memory (VRAM)
+typedef struct rl_Texture3D {
+    unsigned int id;        // OpenGL texture id
+    int width;              // rl_Texture base width
+    int height;             // rl_Texture base height
+    int depth;              // rl_Texture base depth
+    int mipmaps;            // Mipmap levels, 1 by default
+    int format;             // Data format (rl_PixelFormat type)
+} rl_Texture3D;
+
 // rl_RenderTexture, fbo for texture rendering
 typedef struct rl_RenderTexture {
     unsigned int id;        // OpenGL framebuffer object id
@@ -292,6 +324,55 @@ typedef struct rl_RenderTexture {
 // rl_RenderTexture2D, same as rl_RenderTexture
 typedef rl_RenderTexture rl_RenderTexture2D;
 
+// rl_TextureStream, texture with mipmap levels streamed to GPU on demand
+typedef struct rl_TextureStream {
+    unsigned int id;        // Texture stream id (0: not loaded)
+    int width;              // Full resolution width
+    int height;             // Full resolution height
+    int mipmaps;            // Mipmap levels
+    int format;             // Data format (rl_PixelFormat type)
+} rl_TextureStream;
+
+// rl_TextureAtlas, images packed at runtime in a single texture
+typedef struct rl_TextureAtlas {
+    unsigned int id;        // rl_Texture atlas id (0: not loaded)
+    rl_Texture2D texture;   // Atlas texture, shared by packed images
+} rl_TextureAtlas;
+
+// rl_AnimatedTexture, texture updated with animated image frames decoded on demand
+typedef struct rl_AnimatedTexture {
+    unsigned int id;        // Animated texture id (0: not loaded)
+    rl_Texture2D texture;   // Texture showing current frame
+    int frameCount;         // Number of frames
+} rl_AnimatedTexture;
+
+// rl_ImageTexture, texture mirroring an image, image drawing changes are uploaded on sync
+typedef struct rl_ImageTexture {
+    unsigned int id;        // Image texture id (0: not loaded)
+    rl_Texture2D texture;   // Texture mirroring image
+} rl_ImageTexture;
+
+// rl_RenderGraph, post-processing passes with transient targets from render textures pool (opaque)
+typedef struct rl_RenderGraph rl_RenderGraph;
+
+// rl_ImageMapped, raw image file mapped in memory, pixel data paged in from file on access
+typedef struct rl_ImageMapped {
+    unsigned int id;        // Mapped image id (0: not loaded)
+    const void *data;       // Pixel data mapped from file, read-only (NULL if mapping not available, regions read from file)
+    int width;              // Image base width
+    int height;             // Image base height
+    int format;             // Data format (rl_PixelFormat type)
+} rl_ImageMapped;
+
+// rl_TextureStreamStats, texture streaming GPU memory stats
+typedef struct rl_TextureStreamStats {
+    int streamCount;            // Texture streams loaded
+    int pendingUploads;         // Mipmap levels uploads in flight
+    long long residentBytes;    // GPU memory used by resident levels (including uploads in flight)
+    long long requestedBytes;   // GPU memory required by requested levels
+    long long budgetBytes;      // Streaming budget (0: no budget)
+} rl_TextureStreamStats;
+
 // rl_NPatchInfo, n-patch layout info
 typedef struct rl_NPatchInfo {
     rl_Rectangle source;       // rl_Texture source rectangle
@@ -319,8 +400,14 @@ typedef struct rl_Font {
     rl_Texture2D texture;      // rl_Texture atlas containing the glyphs
     rl_Rectangle *recs;        // Rectangles in texture for the glyphs
     rl_GlyphInfo *glyphs;      // Glyphs info data
+    int *glyphLookup;       // Glyphs index lookup by codepoint, built on load (NULL: glyphs are scanned)
+    int type;               // Font type (rl_FontType), SDF and MSDF fonts drawn with distance field shader
+    int *kerning;           // Glyphs pairs kerning, built on load (NULL: no kerning)
 } rl_Font;
 
+// rl_TextLayout, text glyphs positioned once and quads cached for drawing (opaque)
+typedef struct rl_TextLayout rl_TextLayout;
+
 // rl_Camera, defines position/orientation in 3d space
 typedef struct rl_Camera3D {
     rl_Vector3 position;       // rl_Camera position
@@ -340,6 +427,37 @@ typedef struct rl_Camera2D {
     float zoom;             // rl_Camera zoom (scaling around target), must not be set to 0, set to 1.0f for no scale
 } rl_Camera2D;
 
+// Opaque structs declaration
+// NOTE: Actual struct is defined internally in rmodels module
+typedef struct rl_MeshBVH rl_MeshBVH;
+
+// rl_MeshLOD, mesh levels of detail (opaque, generated by rl_GenMeshLOD())
+typedef struct rl_MeshLOD rl_MeshLOD;
+
+// rl_MeshStream, mesh streamed vertex buffers ring (opaque, loaded by rl_UploadMeshStreamed())
+typedef struct rl_MeshStream rl_MeshStream;
+
+// rl_StaticBatch, static meshes merged by material and spatial chunk (opaque)
+typedef struct rl_StaticBatch rl_StaticBatch;
+
+// rl_DrawList, models meshes drawn sorted by shader and material (opaque)
+typedef struct rl_DrawList rl_DrawList;
+
+// rl_ShadowMap, directional light cascaded shadow maps (opaque)
+typedef struct rl_ShadowMap rl_ShadowMap;
+
+// rl_DeferredRenderer, G-buffer and lighting pass resources (opaque)
+typedef struct rl_DeferredRenderer rl_DeferredRenderer;
+
+// rl_BillboardBatch, billboards drawn with instancing (opaque)
+typedef struct rl_BillboardBatch rl_BillboardBatch;
+
+// rl_Terrain, heightmap terrain split in chunks with levels of detail (opaque)
+typedef struct rl_Terrain rl_Terrain;
+
+// rl_VoxelWorld, voxels grid split in greedy meshed chunks (opaque)
+typedef struct rl_VoxelWorld rl_VoxelWorld;
+
 // rl_Mesh, vertex data and vao/vbo
 typedef struct rl_Mesh {
     int vertexCount;        // Number of vertices stored in arrays
@@ -362,11 +480,62 @@ typedef struct rl_Mesh {
     rl_Matrix *boneMatrices;   // Bones animated transformation matrices
     int boneCount;          // Number of bones
 
+    // Bounds data, computed by rl_UploadMesh() (used for culling)
+    rl_Vector3 boundsMin;   // rl_Mesh bounding box minimum corner (mesh space)
+    rl_Vector3 boundsMax;   // rl_Mesh bounding box maximum corner (mesh space)
+    rl_MeshBVH *bvh;        // rl_Mesh bounding volume hierarchy (optional, generated by rl_GenMeshBVH(), used for collisions)
+    rl_MeshLOD *lod;        // rl_Mesh levels of detail (optional, generated by rl_GenMeshLOD(), selected by rl_DrawMesh())
+    rl_MeshStream *stream;  // rl_Mesh streamed vertex buffers (optional, loaded by rl_UploadMeshStreamed(), rotated by rl_UpdateMeshBuffer())
+
     // OpenGL identifiers
+    unsigned int quantization; // Vertex buffers quantized attributes (rl_MeshQuantization flags), set by rl_UploadMesh()
     unsigned int vaoId;     // OpenGL Vertex Array Object id
     unsigned int *vboId;    // OpenGL Vertex Buffer Objects id (default vertex data)
 } rl_Mesh;
 
+// rl_InstanceBuffer, instances transforms kept in GPU memory, reusable across frames
+typedef struct rl_InstanceBuffer {
+    int count;                  // Number of instances transforms in the buffer
+    unsigned int vboId;         // OpenGL Vertex Buffer Object id (instances transforms)
+} rl_InstanceBuffer;
+
+// rl_MeshInstances, instances transforms kept in GPU memory, culled and drawn on GPU
+// NOTE: Requires OpenGL 4.3 (compute shaders, SSBOs and indirect drawing)
+typedef struct rl_MeshInstances {
+    int count;                  // Number of instances
+    rl_Vector3 boundsCenter;    // rl_Mesh bounding sphere center (mesh space)
+    float boundsRadius;         // rl_Mesh bounding sphere radius (mesh space)
+
+    // OpenGL identifiers
+    unsigned int transformsId;  // Instances transforms buffer id (SSBO)
+    unsigned int visibleId;     // Visible instances transforms buffer id (SSBO, written by culling pass)
+    unsigned int commandId;     // Indirect draw command buffer id (instances count written by culling pass)
+} rl_MeshInstances;
+
+// rl_BillboardInstance, billboard instance data, uploaded as is to GPU instances buffer
+typedef struct rl_BillboardInstance {
+    rl_Vector3 position;        // Billboard center position
+    float rotation;             // Billboard rotation (degrees)
+    rl_Vector2 size;            // Billboard size
+    rl_Color color;             // Billboard color (tint)
+} rl_BillboardInstance;
+
+// rl_DeferredLight, deferred rendering point light
+typedef struct rl_DeferredLight {
+    rl_Vector3 position;        // Light position
+    float radius;               // Light radius, attenuation reaches zero at radius
+    rl_Color color;             // Light color
+    float intensity;            // Light intensity (color multiplier)
+} rl_DeferredLight;
+
+// rl_BonePalette, bone matrices of many skeleton instances kept in GPU memory
+// NOTE: Stored as float texture, one row per palette and 4 texels (matrix columns) per bone
+typedef struct rl_BonePalette {
+    unsigned int id;            // OpenGL texture id
+    int boneCount;              // Number of bones per palette
+    int paletteCount;           // Number of palettes (skeleton instances)
+} rl_BonePalette;
+
 // rl_Shader
 typedef struct rl_Shader {
     unsigned int id;        // rl_Shader program id
@@ -414,6 +583,7 @@ typedef struct rl_Model {
     int boneCount;          // Number of bones
     rl_BoneInfo *bones;        // Bones information (skeleton)
     rl_Transform *bindPose;    // Bones base transformation (pose)
+    rl_Matrix *bindInverse;    // Bones inverse bind matrices, computed at load (optional)
 } rl_Model;
 
 // rl_ModelAnimation
@@ -425,6 +595,40 @@ typedef struct rl_ModelAnimation {
     char name[32];          // Animation name
 } rl_ModelAnimation;
 
+// rl_CompressedAnimation, model animation with reduced and quantized bones keys
+typedef struct rl_CompressedAnimation {
+    int boneCount;          // Number of bones
+    int frameCount;         // Number of animation frames
+    rl_BoneInfo *bones;        // Bones information (skeleton)
+    int dataSize;           // Compressed data size in bytes
+    unsigned char *data;    // Compressed data (bones channels and keys)
+    char name[32];          // Animation name
+} rl_CompressedAnimation;
+
+// rl_ModelLoader, async model loading state (opaque)
+typedef struct rl_ModelLoader rl_ModelLoader;
+
+// rl_FileRequest, async file read/write request state (opaque)
+typedef struct rl_FileRequest rl_FileRequest;
+
+// rl_Job, job system task state (opaque)
+typedef struct rl_Job rl_Job;
+
+// rl_MemoryStats, tagged memory allocations stats
+typedef struct rl_MemoryStats {
+    long long liveBytes;        // Memory currently allocated (in bytes)
+    long long peakBytes;        // Maximum memory allocated at the same time (in bytes)
+    int liveCount;              // Allocations currently alive
+    unsigned int totalCount;    // Allocations since program start
+    unsigned int frameCount;    // Allocations since frame start (rl_BeginDrawing())
+} rl_MemoryStats;
+
+// rl_CompressionStream, streamed compression/decompression state (opaque)
+typedef struct rl_CompressionStream rl_CompressionStream;
+
+// rl_AutomationEventStream, automation events streamed to/from binary file (opaque)
+typedef struct rl_AutomationEventStream rl_AutomationEventStream;
+
 // rl_Ray, ray for raycasting
 typedef struct rl_Ray {
     rl_Vector3 position;       // rl_Ray position (origin)
@@ -458,6 +662,7 @@ typedef struct rl_Wave {
 // NOTE: Actual structs are defined internally in raudio module
 typedef struct rAudioBuffer rAudioBuffer;
 typedef struct rAudioProcessor rAudioProcessor;
+typedef struct rAudioBus rAudioBus;
 
 // rl_AudioStream, custom audio stream
 typedef struct rl_AudioStream {
@@ -469,6 +674,11 @@ typedef struct rl_AudioStream {
     unsigned int channels;      // Number of channels (1-mono, 2-stereo, ...)
 } rl_AudioStream;
 
+// rl_AudioBus, submix bus, sounds and streams routed to it are mixed and processed together
+typedef struct rl_AudioBus {
+    rAudioBus *bus;             // Pointer to internal bus data, NULL for master output
+} rl_AudioBus;
+
 // rl_Sound
 typedef struct rl_Sound {
     rl_AudioStream stream;         // Audio stream
@@ -485,6 +695,114 @@ typedef struct rl_Music {
     void *ctxData;              // Audio context data, depends on type
 } rl_Music;
 
+// Audio reader callbacks, origin: SEEK_SET, SEEK_CUR or SEEK_END
+typedef int (*AudioReadCallback)(void *userData, void *buffer, int size);           // Read data, returns bytes read
+typedef bool (*AudioSeekCallback)(void *userData, long long offset, int origin);    // Seek data position, returns success
+typedef long long (*AudioTellCallback)(void *userData);                             // Get data position, returns -1 on failure
+
+// rl_AudioReader, audio data reader, music streams pull data from it while streaming (i.e. pack files)
+typedef struct rl_AudioReader {
+    void *userData;             // Reader user data, provided to callbacks
+    AudioReadCallback read;     // Read data callback
+    AudioSeekCallback seek;     // Seek data callback, positions relative to audio data start
+    AudioTellCallback tell;     // Tell data position callback
+} rl_AudioReader;
+
+// rl_AudioVoiceStats, audio mixer voices stats
+typedef struct rl_AudioVoiceStats {
+    int voicesPlaying;          // Sounds and streams playing
+    int voicesReal;             // Voices mixed on last audio callback
+    int voicesVirtual;          // Voices playing but not mixed, playback position tracked
+    int voicesMax;              // Maximum sounds mixed at once (0: no limit)
+    unsigned int voicesStolen;  // Voices demoted to virtual since audio device initialization
+    float mixTime;              // Last audio callback mixing time (in milliseconds)
+    float mixLoad;              // Last audio callback mixing time relative to mixed audio duration
+} rl_AudioVoiceStats;
+
+// rl_AudioLatencyStats, audio device latency and callback timing stats
+typedef struct rl_AudioLatencyStats {
+    float latency;              // Device buffer latency: periods duration (in milliseconds)
+    int periodSize;             // Device period size (in frames)
+    int periods;                // Device periods count
+    int sampleRate;             // Device sample rate
+    bool isExclusive;           // Device opened in exclusive share mode
+    unsigned int callbackCount; // Audio callbacks since audio device initialization
+    float callbackInterval;     // Audio callbacks interval average (in milliseconds)
+    float callbackJitter;       // Audio callbacks interval deviation from mixed frames duration average (in milliseconds)
+    float callbackJitterMax;    // Audio callbacks interval deviation from mixed frames duration maximum (in milliseconds)
+} rl_AudioLatencyStats;
+
+// rl_AudioProfileStats, audio callback profiling stats
+typedef struct rl_AudioProfileStats {
+    float callbackTime;         // Last audio callback time (in milliseconds)
+    float callbackTimeAverage;  // Audio callback time average (in milliseconds)
+    float callbackTimeMax;      // Audio callback time maximum (in milliseconds)
+    float commandTime;          // Last audio callback commands processing time (in milliseconds)
+    float converterTime;        // Last audio callback data conversion and resampling time (in milliseconds)
+    float load;                 // Last audio callback time relative to mixed audio duration (>1.0f: overload)
+    int buffersActive;          // Audio buffers on mixing list (sounds and streams loaded)
+    int buffersMixed;           // Audio buffers mixed on last audio callback
+    unsigned int overloads;     // Audio callbacks slower than mixed audio duration
+    unsigned int underruns;     // Audio streams running out of data, not updated in time
+    unsigned int commandWaits;  // Program thread waits on full audio commands queue
+    float lockWaitTime;         // Music decoders lock wait time maximum (in milliseconds)
+} rl_AudioProfileStats;
+
+// rl_WaveProcessing, batch wave processing options, applied in order: trim, normalize, format
+typedef struct rl_WaveProcessing {
+    int sampleRate;             // Output sample rate (0: keep wave sample rate)
+    int sampleSize;             // Output sample size: 8, 16 or 32 bits (0: keep wave sample size)
+    int channels;               // Output channels (0: keep wave channels)
+    float normalize;            // Normalize samples to peak level [0.0f..1.0f] (0.0f: disabled)
+    float trimThreshold;        // Trim silence under level at start and end [0.0f..1.0f] (0.0f: disabled)
+} rl_WaveProcessing;
+
+// rl_WaveProcessingStats, batch wave processing stats
+typedef struct rl_WaveProcessingStats {
+    int waves;                  // Waves processed
+    int failed;                 // Waves failed to process (invalid or format conversion failure)
+    int threads;                // Threads used, including caller thread
+    float time;                 // Processing time (in milliseconds)
+    long long frames;           // Input frames processed
+    float framesPerSecond;      // Input frames processed per second
+} rl_WaveProcessingStats;
+
+// rl_Spline, spline tessellated as triangle strip, static splines are drawn with no tessellation
+typedef struct rl_Spline {
+    int vertexCount;            // Triangle strip vertex count
+    rl_Vector2 *vertices;       // Triangle strip vertices, segments joined by degenerated triangles
+    float thick;                // Spline thickness
+    int capCount;               // Circle caps count (B-Spline and Catmull-Rom splines)
+    rl_Vector2 caps[2];         // Circle caps centers, spline begin and end
+} rl_Spline;
+
+// rl_Polygon, polygon triangulated for drawing, holes supported
+typedef struct rl_Polygon {
+    int vertexCount;            // Polygon vertex count (outer and holes contours)
+    rl_Vector2 *vertices;       // Polygon vertices
+    int triangleCount;          // Triangles count
+    unsigned short *indices;    // Triangles vertex indices, 3 per triangle
+} rl_Polygon;
+
+// rl_Path, vector path of lines and Bezier curves subpaths
+typedef struct rl_Path {
+    int commandCount;           // Path commands count
+    int commandCapacity;        // Path commands allocated capacity
+    unsigned char *commands;    // Path commands (rl_PathCommand)
+    int pointCount;             // Path points count
+    int pointCapacity;          // Path points allocated capacity
+    rl_Vector2 *points;         // Path points, commands end points and control points
+} rl_Path;
+
+// rl_DrawingList, recorded draws stored in GPU memory, replayed as a whole
+typedef struct rl_DrawingList {
+    int vertexCount;            // Number of vertices recorded
+    int drawCount;              // Number of draws recorded (texture or primitive changes)
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (position, texcoord, normal, color)
+    unsigned int *draws;        // Draws data, 4 values per draw: mode, first vertex, vertex count, texture id
+} rl_DrawingList;
+
 // rl_VrDeviceInfo, Head-Mounted-Display device parameters
 typedef struct rl_VrDeviceInfo {
     int hResolution;                // Horizontal resolution in pixels
@@ -517,6 +835,34 @@ typedef struct rl_FilePathList {
     char **paths;                   // Filepaths entries
 } rl_FilePathList;
 
+// Hash state, streaming hash computation
+typedef struct rl_HashState {
+    int type;                       // Hash type (rl_HashType)
+    unsigned int digest[8];         // Hash digest values (size depends on type)
+    unsigned long long size;        // Data size processed (bytes)
+    unsigned char block[64];        // Data block pending to be processed
+    int blockSize;                  // Data block pending size (bytes)
+} rl_HashState;
+
+// Input event, timestamped on arrival
+typedef struct rl_InputEvent {
+    double time;                    // Event time (in seconds, rl_GetTime() timebase)
+    int type;                       // Event type (rl_InputEventType)
+    int device;                     // Event device: gamepad index or touch point id, 0 for keyboard and mouse
+    int code;                       // Event code: key, codepoint, mouse button, gamepad button or axis
+    rl_Vector2 value;                  // Event value: mouse/touch position, wheel move or axis value (x)
+} rl_InputEvent;
+
+// Gesture touch point, multi-touch gestures state for one touch point
+typedef struct rl_GestureTouch {
+    int id;                         // Touch point id
+    int gesture;                    // Gesture detected for this touch point (rl_Gesture)
+    rl_Vector2 position;               // Touch current position (normalized screen units)
+    rl_Vector2 downPosition;           // Touch down position (normalized screen units)
+    rl_Vector2 velocity;               // Touch velocity (normalized screen units per second)
+    float duration;                 // Time since touch down (in seconds)
+} rl_GestureTouch;
+
 // Automation event
 typedef struct rl_AutomationEvent {
     unsigned int frame;             // Event frame
@@ -526,11 +872,34 @@ typedef struct rl_AutomationEvent {
 
 // Automation event list
 typedef struct rl_AutomationEventList {
-    unsigned int capacity;          // Events max entries (MAX_AUTOMATION_EVENTS)
+    unsigned int capacity;          // Events max entries (grows as required)
     unsigned int count;             // Events entries count
     rl_AutomationEvent *events;        // Events entries
 } rl_AutomationEventList;
 
+// rl_FramePacingStats, frame times stats and histogram
+typedef struct rl_FramePacingStats {
+    unsigned int frameCount;    // Frames measured since last reset
+    unsigned int missedFrames;  // Frames finished after their deadline (target time exceeded)
+    float frameTime;            // Last frame time (in milliseconds)
+    float frameTimeAverage;     // Frame time average (in milliseconds)
+    float frameTimeMin;         // Frame time minimum (in milliseconds)
+    float frameTimeMax;         // Frame time maximum (in milliseconds)
+    float frameJitter;          // Frame time deviation from target time average (in milliseconds)
+    float sleepOvershoot;       // Sleep overshoot estimate, busy waited at sleep end (in milliseconds)
+    float spinTime;             // Last frame busy wait time (in milliseconds)
+    float histogramStep;        // Histogram bin size (in milliseconds)
+    unsigned int histogram[64]; // Frame times histogram, last bin also counts longer frames
+} rl_FramePacingStats;
+
+// rl_StartupStats, rl_InitWindow() phases timings
+typedef struct rl_StartupStats {
+    float platformTime;         // Platform initialization: window, graphics context and extensions (in milliseconds)
+    float graphicsTime;         // rlgl initialization: default texture, shader and render batch (in milliseconds)
+    float fontTime;             // Default font loading, 0 if deferred to first use (in milliseconds)
+    float totalTime;            // rl_InitWindow() total time (in milliseconds)
+} rl_StartupStats;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -569,6 +938,13 @@ typedef enum {
     LOG_NONE            // Disable logging
 } rl_TraceLogLevel;
 
+// Frame pacing modes, target frame time wait on rl_EndDrawing()
+typedef enum {
+    FRAME_PACING_SLEEP = 0,     // Sleep until frame deadline, busy waiting only measured sleep overshoot (default)
+    FRAME_PACING_BUSY,          // Busy wait until frame deadline, lowest jitter but one core fully used
+    FRAME_PACING_VSYNC          // Frames paced by display vblank on buffers swap (FLAG_VSYNC_HINT enabled)
+} rl_FramePacingMode;
+
 // Keyboard keys (US keyboard layout)
 // NOTE: Use rl_GetKeyPressed() to allow redefining
 // required keys for alternative layouts
@@ -752,6 +1128,41 @@ typedef enum {
     GAMEPAD_AXIS_RIGHT_TRIGGER = 5      // Gamepad back trigger right, pressure level: [1..-1]
 } rl_GamepadAxis;
 
+// Input event types
+typedef enum {
+    INPUT_EVENT_NONE = 0,               // No event
+    INPUT_EVENT_KEY_PRESSED,            // Key pressed, code: key
+    INPUT_EVENT_KEY_RELEASED,           // Key released, code: key
+    INPUT_EVENT_KEY_REPEAT,             // Key repeat, code: key
+    INPUT_EVENT_CHAR,                   // Character input, code: unicode codepoint
+    INPUT_EVENT_MOUSE_BUTTON_PRESSED,   // Mouse button pressed, code: mouse button, value: position
+    INPUT_EVENT_MOUSE_BUTTON_RELEASED,  // Mouse button released, code: mouse button, value: position
+    INPUT_EVENT_MOUSE_MOVE,             // Mouse moved, value: position
+    INPUT_EVENT_MOUSE_WHEEL,            // Mouse wheel moved, value: wheel move
+    INPUT_EVENT_TOUCH_DOWN,             // Touch point down, device: point id, value: position
+    INPUT_EVENT_TOUCH_UP,               // Touch point up, device: point id, value: position
+    INPUT_EVENT_TOUCH_MOVE,             // Touch point moved, device: point id, value: position
+    INPUT_EVENT_GAMEPAD_CONNECTED,      // Gamepad connected, device: gamepad
+    INPUT_EVENT_GAMEPAD_DISCONNECTED,   // Gamepad disconnected, device: gamepad
+    INPUT_EVENT_GAMEPAD_BUTTON_PRESSED, // Gamepad button pressed, device: gamepad, code: button
+    INPUT_EVENT_GAMEPAD_BUTTON_RELEASED,// Gamepad button released, device: gamepad, code: button
+    INPUT_EVENT_GAMEPAD_AXIS            // Gamepad axis moved, device: gamepad, code: axis, value.x: axis value
+} rl_InputEventType;
+
+// Hash type, used by streaming hash computation
+typedef enum {
+    HASH_CRC32 = 0,                 // CRC32 hash (digest: int[1])
+    HASH_MD5,                       // MD5 hash (digest: int[4], 16 bytes)
+    HASH_SHA1,                      // SHA-1 hash (digest: int[5], 20 bytes)
+    HASH_SHA256                     // SHA-256 hash (digest: int[8], 32 bytes)
+} rl_HashType;
+
+// Compression codec, used by compressed blocks stream
+typedef enum {
+    COMPRESSION_DEFLATE = 0,        // DEFLATE (RFC 1951), better compression ratio
+    COMPRESSION_LZ4                 // LZ4 block format, faster compression and decompression
+} rl_CompressionCodec;
+
 // rl_Material map index
 typedef enum {
     MATERIAL_MAP_ALBEDO = 0,        // Albedo material (same as: rl_MATERIAL_MAP_DIFFUSE)
@@ -801,7 +1212,10 @@ typedef enum {
     SHADER_LOC_VERTEX_BONEIDS,      // rl_Shader location: vertex attribute: boneIds
     SHADER_LOC_VERTEX_BONEWEIGHTS,  // rl_Shader location: vertex attribute: boneWeights
     SHADER_LOC_BONE_MATRICES,       // rl_Shader location: array of matrices uniform: boneMatrices
-    SHADER_LOC_VERTEX_INSTANCE_TX   // rl_Shader location: vertex attribute: instanceTransform
+    SHADER_LOC_VERTEX_INSTANCE_TX,  // rl_Shader location: vertex attribute: instanceTransform
+    SHADER_LOC_BONE_PALETTE,        // rl_Shader location: sampler2d texture: bonePalette
+    SHADER_LOC_VERTEX_INSTANCE_PALETTE, // rl_Shader location: vertex attribute: instancePalette
+    SHADER_LOC_BONE_DUALQUATS       // rl_Shader location: array of vec4 uniform: boneDualQuats (rotation and translation per bone)
 } rl_ShaderLocationIndex;
 
 #define rl_SHADER_LOC_MAP_DIFFUSE      SHADER_LOC_MAP_ALBEDO
@@ -858,7 +1272,9 @@ typedef enum {
     PIXELFORMAT_COMPRESSED_PVRT_RGB,        // 4 bpp
     PIXELFORMAT_COMPRESSED_PVRT_RGBA,       // 4 bpp
     PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA,   // 8 bpp
-    PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA    // 2 bpp
+    PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA,   // 2 bpp
+    PIXELFORMAT_COMPRESSED_BC7_RGBA,        // 8 bpp
+    PIXELFORMAT_COMPRESSED_BC4_R            // 4 bpp
 } rl_PixelFormat;
 
 // rl_Texture parameters: filter mode
@@ -873,6 +1289,19 @@ typedef enum {
     TEXTURE_FILTER_ANISOTROPIC_16X,         // Anisotropic filtering 16x
 } rl_TextureFilter;
 
+// rl_Image mipmaps generation filter
+typedef enum {
+    MIPMAP_FILTER_BOX = 0,                  // 2x2 box filter
+    MIPMAP_FILTER_KAISER,                   // Kaiser windowed sinc filter (sharper levels)
+} rl_MipmapFilter;
+
+// rl_Image dithering method
+typedef enum {
+    DITHER_FLOYD_STEINBERG = 0,             // Error diffusion (serial)
+    DITHER_ORDERED_BAYER,                   // Ordered dithering, 8x8 Bayer matrix
+    DITHER_BLUE_NOISE,                      // Ordered dithering, 64x64 blue noise tile (less visible pattern)
+} rl_DitherMethod;
+
 // rl_Texture parameters: wrap mode
 typedef enum {
     TEXTURE_WRAP_REPEAT = 0,                // Repeats texture in tiled mode
@@ -894,9 +1323,17 @@ typedef enum {
 typedef enum {
     FONT_DEFAULT = 0,               // Default font generation, anti-aliased
     FONT_BITMAP,                    // Bitmap font generation, no anti-aliasing
-    FONT_SDF                        // SDF font generation, requires external shader
+    FONT_SDF,                       // SDF font generation, single channel distance field
+    FONT_MSDF                       // MSDF font generation, multi-channel distance field (sharp corners)
 } rl_FontType;
 
+// Text layout lines alignment
+typedef enum {
+    TEXT_ALIGN_LEFT = 0,            // Lines aligned to left
+    TEXT_ALIGN_CENTER,              // Lines centered on wrap width (or layout width)
+    TEXT_ALIGN_RIGHT                // Lines aligned to right of wrap width (or layout width)
+} rl_TextAlignment;
+
 // rl_Color blending modes (pre-defined)
 typedef enum {
     BLEND_ALPHA = 0,                // Blend textures considering alpha (default)
@@ -947,6 +1384,109 @@ typedef enum {
     NPATCH_THREE_PATCH_HORIZONTAL   // Npatch layout: 3x1 tiles
 } rl_NPatchLayout;
 
+// Mesh vertex attributes quantization flags
+// NOTE: Used by rl_UploadMesh(), quantized attributes are decoded by GPU
+typedef enum {
+    MESH_QUANTIZE_POSITIONS   = 1,  // Positions as half floats (only if precision is enough)
+    MESH_QUANTIZE_NORMALS     = 2,  // Normals and tangents as normalized signed bytes
+    MESH_QUANTIZE_TEXCOORDS   = 4,  // Texcoords as normalized unsigned shorts (only if in [0..1] range)
+    MESH_QUANTIZE_BONEWEIGHTS = 8,  // Bone weights as normalized unsigned bytes
+    MESH_QUANTIZE_ALL         = 15  // All supported vertex attributes
+} rl_MeshQuantization;
+
+// Audio resampler quality
+// NOTE: Used on mixing time conversion (audio streams, pitched sounds), sounds are resampled on loading
+typedef enum {
+    AUDIO_RESAMPLER_LINEAR = 0,     // Linear interpolation, no low-pass filtering (fastest)
+    AUDIO_RESAMPLER_FILTERED,       // Linear interpolation, 4th order low-pass filtering
+    AUDIO_RESAMPLER_FILTERED_HIGH   // Linear interpolation, 8th order low-pass filtering
+} rl_AudioResamplerQuality;
+
+// Audio distance attenuation model
+// NOTE: Used by spatial sounds, distance is clamped between sound min and max distance
+typedef enum {
+    AUDIO_ATTENUATION_NONE = 0,     // No distance attenuation
+    AUDIO_ATTENUATION_INVERSE,      // Inverse distance: min/(min + rolloff*(distance - min))
+    AUDIO_ATTENUATION_LINEAR,       // Linear distance: 1 - rolloff*(distance - min)/(max - min)
+    AUDIO_ATTENUATION_EXPONENTIAL   // Exponential distance: (distance/min)^-rolloff
+} rl_AudioAttenuation;
+
+// Audio bus filter type
+// NOTE: Filters are 2nd order (biquad) filters
+typedef enum {
+    AUDIO_FILTER_NONE = 0,          // No filtering
+    AUDIO_FILTER_LOWPASS,           // Low-pass filter
+    AUDIO_FILTER_HIGHPASS,          // High-pass filter
+    AUDIO_FILTER_BANDPASS           // Band-pass filter (0 dB peak gain)
+} rl_AudioFilter;
+
+// Line strip stroke join
+typedef enum {
+    LINE_JOIN_MITER = 0,            // Miter join, bevel join over miter limit
+    LINE_JOIN_BEVEL,                // Bevel join
+    LINE_JOIN_ROUND                 // Round join
+} rl_LineJoin;
+
+// Line strip stroke cap
+typedef enum {
+    LINE_CAP_BUTT = 0,              // Butt cap, line ends at end points
+    LINE_CAP_SQUARE,                // Square cap, line extended half thickness over end points
+    LINE_CAP_ROUND                  // Round cap
+} rl_LineCap;
+
+// Path command
+typedef enum {
+    PATH_MOVE_TO = 0,               // Begin subpath, 1 point
+    PATH_LINE_TO,                   // Line, 1 point
+    PATH_QUAD_TO,                   // Quadratic Bezier curve, 2 points: [c1, p2]
+    PATH_CUBIC_TO,                  // Cubic Bezier curve, 3 points: [c1, c2, p3]
+    PATH_CLOSE                      // Close subpath, no points
+} rl_PathCommand;
+
+// Path fill rule
+typedef enum {
+    FILL_RULE_NONZERO = 0,          // Non-zero winding fill rule
+    FILL_RULE_EVENODD               // Even-odd fill rule
+} rl_FillRule;
+
+// Spline type
+typedef enum {
+    SPLINE_LINEAR = 0,              // Linear, minimum 2 points
+    SPLINE_BASIS,                   // B-Spline, minimum 4 points
+    SPLINE_CATMULLROM,              // Catmull-Rom, minimum 4 points
+    SPLINE_BEZIER_QUADRATIC,        // Quadratic Bezier, minimum 3 points (1 control point): [p1, c2, p3, c4...]
+    SPLINE_BEZIER_CUBIC             // Cubic Bezier, minimum 4 points (2 control points): [p1, c2, c3, p4, c5, c6...]
+} rl_SplineType;
+
+// Memory modules, tagged allocations owner module
+typedef enum {
+    MEMORY_MODULE_USER = 0,         // User allocations: rl_MemAlloc()
+    MEMORY_MODULE_CORE,             // Module: rcore (including rlgl and platform)
+    MEMORY_MODULE_SHAPES,           // Module: rshapes
+    MEMORY_MODULE_TEXTURES,         // Module: rtextures
+    MEMORY_MODULE_TEXT,             // Module: rtext
+    MEMORY_MODULE_MODELS,           // Module: rmodels
+    MEMORY_MODULE_AUDIO,            // Module: raudio
+    MEMORY_MODULE_UTILS             // Module: utils (file data, frame arena)
+} rl_MemoryModule;
+
+// Memory purposes, tagged allocations expected lifetime
+typedef enum {
+    MEMORY_PURPOSE_GENERAL = 0,     // General allocations
+    MEMORY_PURPOSE_RESOURCE,        // Resource data, released on resource unloading
+    MEMORY_PURPOSE_TEMPORARY        // Temporary buffers, released on function return or frame start
+} rl_MemoryPurpose;
+
+// GPU memory types, loaded GPU resources type
+// NOTE: Values match rlgl rlGpuMemoryType
+typedef enum {
+    GPU_MEMORY_TEXTURE = 0,         // Textures: 2d, cubemap, array and 3d textures (mipmaps included)
+    GPU_MEMORY_RENDER_TARGET,       // Render targets: depth textures and renderbuffers, G-buffer attachments
+    GPU_MEMORY_VERTEX_BUFFER,       // Vertex buffers: meshes, render batch and drawing lists
+    GPU_MEMORY_INDEX_BUFFER,        // Index buffers: meshes and render batch
+    GPU_MEMORY_SHADER_BUFFER        // Shader storage and uniform buffers
+} rl_GpuMemoryType;
+
 // Callbacks to hook some internal functions
 // WARNING: These callbacks are intended for advanced users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
@@ -954,6 +1494,16 @@ typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSi
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, const char *text); // FileIO: Save text data
+typedef void (*ScreenCaptureCallback)(rl_Image image, void *userData);   // Screen capture: Receive async screen readback (image data only valid during callback)
+typedef bool (*DirectoryFileCallback)(const char *path, bool isDirectory, void *userData); // FileIO: Receive scanned path (only valid during callback), return false to stop scanning
+typedef void (*AssetReloadedCallback)(const char *fileName);     // Hot reload: Receive reloaded asset file name (shader or texture)
+typedef void *(*MemAllocCallback)(unsigned int size, int module, int purpose);  // Memory: Allocate memory block (not initialized)
+typedef void *(*MemReallocCallback)(void *ptr, unsigned int size, int module, int purpose); // Memory: Reallocate memory block
+typedef void (*MemFreeCallback)(void *ptr, int module, int purpose);     // Memory: Free memory block
+typedef void (*JobCallback)(void *userData);                            // Jobs: Run job (worker thread) or receive job completion (rl_UpdateJobs() thread)
+typedef void (*JobRangeCallback)(void *userData, int start, int end);   // Jobs: Process range [start, end) of parallel job (worker thread)
+typedef bool (*CompressionStreamCallback)(const unsigned char *data, int dataSize, void *userData); // Compression: Receive stream output data (only valid during callback), return false to stop stream
+typedef void (*RenderGraphPassCallback)(const rl_Texture2D *inputs, int inputCount, void *userData); // Render graph: Draw pass into output target (bound), inputs textures only valid during callback
 
 //------------------------------------------------------------------------------------
 // Global Variables Definition
@@ -980,6 +1530,13 @@ rl_RLAPI void rl_InitWindow(int width, int height, const char *title);  // Initi
 rl_RLAPI void rl_CloseWindow(void);                                     // Close window and unload OpenGL context
 rl_RLAPI bool rl_WindowShouldClose(void);                               // Check if application should close (KEY_ESCAPE pressed or windows close icon clicked)
 rl_RLAPI bool rl_IsWindowReady(void);                                   // Check if window has been initialized successfully
+rl_RLAPI int rl_InitSecondaryWindow(int width, int height, const char *title); // Initialize secondary window sharing main window graphics resources, returns window id (0 on failure)
+rl_RLAPI void rl_CloseSecondaryWindow(int window);                      // Close secondary window
+rl_RLAPI bool rl_SecondaryWindowShouldClose(int window);                // Check if secondary window close icon has been clicked
+rl_RLAPI int rl_GetSecondaryWindowWidth(int window);                    // Get secondary window render width
+rl_RLAPI int rl_GetSecondaryWindowHeight(int window);                   // Get secondary window render height
+rl_RLAPI void rl_BeginSecondaryWindowDrawing(int window);               // Begin drawing to secondary window (between rl_BeginDrawing() and rl_EndDrawing())
+rl_RLAPI void rl_EndSecondaryWindowDrawing(void);                       // End drawing to secondary window and present it
 rl_RLAPI bool rl_IsWindowFullscreen(void);                              // Check if window is currently fullscreen
 rl_RLAPI bool rl_IsWindowHidden(void);                                  // Check if window is currently hidden
 rl_RLAPI bool rl_IsWindowMinimized(void);                               // Check if window is currently minimized
@@ -1004,6 +1561,7 @@ rl_RLAPI void rl_SetWindowMaxSize(int width, int height);               // Set w
 rl_RLAPI void rl_SetWindowSize(int width, int height);                  // Set window dimensions
 rl_RLAPI void rl_SetWindowOpacity(float opacity);                       // Set window opacity [0.0f..1.0f]
 rl_RLAPI void rl_SetWindowFocused(void);                                // Set window focused
+rl_RLAPI void rl_SetWindowFramebuffer(void *pixels);                    // Set memory the screen is rendered into (R8G8B8A8, screen size), NULL for internal (PLATFORM_MEMORY only)
 rl_RLAPI void *rl_GetWindowHandle(void);                                // Get native window handle
 rl_RLAPI int rl_GetScreenWidth(void);                                   // Get current screen width
 rl_RLAPI int rl_GetScreenHeight(void);                                  // Get current screen height
@@ -1025,6 +1583,7 @@ rl_RLAPI const char *rl_GetClipboardText(void);                         // Get c
 rl_RLAPI rl_Image rl_GetClipboardImage(void);                              // Get clipboard image content
 rl_RLAPI void rl_EnableEventWaiting(void);                              // Enable waiting for events on rl_EndDrawing(), no automatic event polling
 rl_RLAPI void rl_DisableEventWaiting(void);                             // Disable waiting for events on rl_EndDrawing(), automatic events polling
+rl_RLAPI void rl_SetEventWaitingTimeout(double seconds);                // Set events waiting timeout, frame ends without events after timeout (0: wait indefinitely)
 
 // Cursor-related functions
 rl_RLAPI void rl_ShowCursor(void);                                      // Shows cursor
@@ -1038,6 +1597,10 @@ rl_RLAPI bool rl_IsCursorOnScreen(void);                                // Check
 rl_RLAPI void rl_ClearBackground(rl_Color color);                          // Set background color (framebuffer clear color)
 rl_RLAPI void rl_BeginDrawing(void);                                    // Setup canvas (framebuffer) to start drawing
 rl_RLAPI void rl_EndDrawing(void);                                      // End canvas drawing and swap buffers (double buffering)
+rl_RLAPI void rl_SkipScreenBufferSwap(void);                            // Skip buffers swap on current frame rl_EndDrawing(), screen keeps previous frame (nothing changed)
+rl_RLAPI void rl_EnableRenderThread(int queueDepth);                    // Enable render thread, frames are recorded and submitted + swapped on a dedicated thread
+rl_RLAPI void rl_DisableRenderThread(void);                              // Disable render thread, waits for queued frames and returns graphics context to main thread
+rl_RLAPI bool rl_IsRenderThreadEnabled(void);                            // Check if render thread is enabled
 rl_RLAPI void rl_BeginMode2D(rl_Camera2D camera);                          // Begin 2D mode with custom camera (2D)
 rl_RLAPI void rl_EndMode2D(void);                                       // Ends 2D mode with custom camera
 rl_RLAPI void rl_BeginMode3D(rl_Camera3D camera);                          // Begin 3D mode with custom camera (3D)
@@ -1053,6 +1616,14 @@ rl_RLAPI void rl_EndScissorMode(void);                                  // End s
 rl_RLAPI void rl_BeginVrStereoMode(rl_VrStereoConfig config);              // Begin stereo rendering (requires VR simulator)
 rl_RLAPI void rl_EndVrStereoMode(void);                                 // End stereo rendering (requires VR simulator)
 
+// Drawing list functions, shapes/textures/text draws recorded once into GPU memory and replayed
+// NOTE: Drawing lists are not available on OpenGL 1.1, state changes (shader, blending) are not recorded
+rl_RLAPI void rl_BeginDrawingList(void);                                // Begin recording draws into a drawing list (draws are not displayed)
+rl_RLAPI rl_DrawingList rl_EndDrawingList(void);                           // End recording draws, returns drawing list loaded in GPU memory
+rl_RLAPI bool rl_IsDrawingListValid(rl_DrawingList list);                  // Check if a drawing list is valid (loaded in GPU)
+rl_RLAPI void rl_DrawDrawingList(rl_DrawingList list, rl_Matrix transform);   // Draw a drawing list with a transform applied
+rl_RLAPI void rl_UnloadDrawingList(rl_DrawingList list);                   // Unload drawing list from GPU memory (VRAM)
+
 // VR stereo config functions for VR simulator
 rl_RLAPI rl_VrStereoConfig rl_LoadVrStereoConfig(rl_VrDeviceInfo device);     // Load VR stereo config for VR simulator device parameters
 rl_RLAPI void rl_UnloadVrStereoConfig(rl_VrStereoConfig config);           // Unload VR stereo config
@@ -1061,6 +1632,8 @@ rl_RLAPI void rl_UnloadVrStereoConfig(rl_VrStereoConfig config);           // Un
 // NOTE: rl_Shader functionality is not available on OpenGL 1.1
 rl_RLAPI rl_Shader rl_LoadShader(const char *vsFileName, const char *fsFileName);   // Load shader from files and bind default locations
 rl_RLAPI rl_Shader rl_LoadShaderFromMemory(const char *vsCode, const char *fsCode); // Load shader from code strings and bind default locations
+rl_RLAPI rl_Shader rl_LoadShaderFromMemoryAsync(const char *vsCode, const char *fsCode); // Load shader from code strings, compiled in background (locations bound on rl_IsShaderReady())
+rl_RLAPI bool rl_IsShaderReady(rl_Shader *shader);                                  // Check if an async shader has been built, completes it and binds default locations when ready
 rl_RLAPI bool rl_IsShaderValid(rl_Shader shader);                                   // Check if a shader is valid (loaded on GPU)
 rl_RLAPI int rl_GetShaderLocation(rl_Shader shader, const char *uniformName);       // Get shader uniform location
 rl_RLAPI int rl_GetShaderLocationAttrib(rl_Shader shader, const char *attribName);  // Get shader attribute location
@@ -1068,7 +1641,10 @@ rl_RLAPI void rl_SetShaderValue(rl_Shader shader, int locIndex, const void *valu
 rl_RLAPI void rl_SetShaderValueV(rl_Shader shader, int locIndex, const void *value, int uniformType, int count);   // Set shader uniform value vector
 rl_RLAPI void rl_SetShaderValueMatrix(rl_Shader shader, int locIndex, rl_Matrix mat);         // Set shader uniform value (matrix 4x4)
 rl_RLAPI void rl_SetShaderValueTexture(rl_Shader shader, int locIndex, rl_Texture2D texture); // Set shader uniform value and bind the texture (sampler2d)
+rl_RLAPI void rl_SetShaderValueTextureArray(rl_Shader shader, int locIndex, rl_TextureArray texture); // Set shader uniform value and bind the texture array (sampler2DArray)
+rl_RLAPI void rl_SetShaderValueTexture3D(rl_Shader shader, int locIndex, rl_Texture3D texture); // Set shader uniform value and bind the 3D texture (sampler3D)
 rl_RLAPI void rl_UnloadShader(rl_Shader shader);                                    // Unload shader from GPU memory (VRAM)
+rl_RLAPI void rl_SetAssetReloadedCallback(AssetReloadedCallback callback);         // Set assets hot reload callback, called when a watched shader or texture file is reloaded
 
 // Screen-space-related functions
 #define rl_GetMouseRay rl_GetScreenToWorldRay     // Compatibility hack for previous raylib versions
@@ -1081,11 +1657,34 @@ rl_RLAPI rl_Vector2 rl_GetScreenToWorld2D(rl_Vector2 position, rl_Camera2D camer
 rl_RLAPI rl_Matrix rl_GetCameraMatrix(rl_Camera camera);                            // Get camera transform matrix (view matrix)
 rl_RLAPI rl_Matrix rl_GetCameraMatrix2D(rl_Camera2D camera);                        // Get camera 2d transform matrix
 
+// Large worlds functions (camera-relative rendering)
+// NOTE: World positions are kept in double precision by user, 3D drawing positions are relative to render origin (camera),
+// float positions and matrices stay small and precise far away from world origin
+rl_RLAPI void rl_SetRenderOrigin(double x, double y, double z);                        // Set render origin, world position drawn at (0, 0, 0)
+rl_RLAPI rl_Vector3 rl_GetRenderPosition(double x, double y, double z);                // Get render position for a world position, relative to render origin
+rl_RLAPI void rl_GetWorldPosition(rl_Vector3 position, double *x, double *y, double *z); // Get world position for a render position (double precision)
+rl_RLAPI void rl_UpdateRenderOrigin(rl_Camera *camera);                                // Move render origin to camera position, camera shifted to (0, 0, 0)
+
 // Timing-related functions
 rl_RLAPI void rl_SetTargetFPS(int fps);                                 // Set target FPS (maximum)
 rl_RLAPI float rl_GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
 rl_RLAPI double rl_GetTime(void);                                       // Get elapsed time in seconds since rl_InitWindow()
+rl_RLAPI unsigned int rl_GetFrameCount(void);                           // Get number of frames drawn since rl_InitWindow()
 rl_RLAPI int rl_GetFPS(void);                                           // Get current FPS
+rl_RLAPI void rl_SetFramePacingMode(int mode);                          // Set frame pacing mode, target frame time wait (rl_FramePacingMode)
+rl_RLAPI rl_FramePacingStats rl_GetFramePacingStats(void);                 // Get frame pacing stats (frame times histogram, jitter and sleep overshoot)
+rl_RLAPI void rl_ResetFramePacingStats(void);                           // Reset frame pacing stats
+rl_RLAPI rl_StartupStats rl_GetStartupStats(void);                       // Get rl_InitWindow() phases timings (startup trace)
+
+// CPU profiler functions (SUPPORT_CPU_PROFILER), named zones recorded per thread, functions are empty if not supported
+rl_RLAPI void rl_BeginProfileZone(const char *name);                    // Begin named CPU profiler zone on calling thread (name not copied, i.e. string literal)
+rl_RLAPI void rl_EndProfileZone(void);                                  // End last CPU profiler zone begun on calling thread
+rl_RLAPI void rl_ResetProfileZones(void);                               // Reset recorded CPU profiler zones of all threads
+rl_RLAPI bool rl_ExportProfileTrace(const char *fileName);              // Export recorded CPU profiler zones as Chrome trace events JSON (chrome://tracing, Perfetto)
+
+// Memory accounting functions, GPU memory estimated from loaded resources size and format
+rl_RLAPI rl_MemoryStats rl_GetGpuMemoryStats(int type);                 // Get GPU memory stats by resource type (rl_GpuMemoryType), use -1 to accumulate all types
+rl_RLAPI bool rl_ExportMemoryReport(const char *fileName);              // Export memory report as text file (GPU by resource type, CPU by module, audio buffers), NULL to log it
 
 // Custom frame control functions
 // NOTE: Those functions are intended for advanced users that want full control over the frame processing
@@ -1113,6 +1712,12 @@ rl_RLAPI void rl_SetTraceLogLevel(int logLevel);                        // Set t
 rl_RLAPI void *rl_MemAlloc(unsigned int size);                          // Internal memory allocator
 rl_RLAPI void *rl_MemRealloc(void *ptr, unsigned int size);             // Internal memory reallocator
 rl_RLAPI void rl_MemFree(void *ptr);                                    // Internal memory free
+rl_RLAPI void *rl_MemAllocTagged(unsigned int size, int module, int purpose); // Tagged memory allocator, tracked by module and purpose (rl_MemoryModule, rl_MemoryPurpose)
+rl_RLAPI void *rl_MemReallocTagged(void *ptr, unsigned int size, int module, int purpose); // Tagged memory reallocator, module and purpose only used if ptr is NULL
+rl_RLAPI void rl_MemFreeTagged(void *ptr);                              // Tagged memory free
+rl_RLAPI rl_MemoryStats rl_GetMemoryStats(int module, int purpose);     // Get tagged memory stats, use -1 module or purpose to accumulate all
+rl_RLAPI void *rl_MemFrameAlloc(unsigned int size);                     // Frame arena allocator (per thread), memory released on next frame start
+rl_RLAPI void rl_MemFrameReset(void);                                   // Release frame arena allocations of calling thread, called by rl_BeginDrawing()
 
 // Set custom callbacks
 // WARNING: Callbacks setup is intended for advanced users
@@ -1121,6 +1726,7 @@ rl_RLAPI void rl_SetLoadFileDataCallback(LoadFileDataCallback callback);  // Set
 rl_RLAPI void rl_SetSaveFileDataCallback(SaveFileDataCallback callback);  // Set custom file binary data saver
 rl_RLAPI void rl_SetLoadFileTextCallback(LoadFileTextCallback callback);  // Set custom file text data loader
 rl_RLAPI void rl_SetSaveFileTextCallback(SaveFileTextCallback callback);  // Set custom file text data saver
+rl_RLAPI void rl_SetMemoryCallbacks(MemAllocCallback allocCallback, MemReallocCallback reallocCallback, MemFreeCallback freeCallback); // Set custom tagged memory allocator (NULL for default), set before any allocation
 
 // Files management functions
 rl_RLAPI unsigned char *rl_LoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
@@ -1130,6 +1736,26 @@ rl_RLAPI bool rl_ExportDataAsCode(const unsigned char *data, int dataSize, const
 rl_RLAPI char *rl_LoadFileText(const char *fileName);                     // Load text data from file (read), returns a '\0' terminated string
 rl_RLAPI void rl_UnloadFileText(char *text);                              // Unload file text data allocated by rl_LoadFileText()
 rl_RLAPI bool rl_SaveFileText(const char *fileName, const char *text);    // Save text data to file (write), string must be '\0' terminated, returns true on success
+rl_RLAPI rl_FileRequest *rl_LoadFileDataAsync(const char *fileName);      // Load file data asynchronously (read on a file I/O worker thread)
+rl_RLAPI rl_FileRequest *rl_SaveFileDataAsync(const char *fileName, void *data, int dataSize); // Save data to file asynchronously (data is copied)
+rl_RLAPI bool rl_IsFileRequestDone(rl_FileRequest *request);              // Check if file request has been completed (non-blocking)
+rl_RLAPI unsigned char *rl_FinishFileRequest(rl_FileRequest *request, int *dataSize); // Finish file request (waits if required), returns loaded data (load requests), request is freed
+rl_RLAPI bool rl_MountArchive(const char *fileName, const char *mountPath); // Mount packed archive (.rpak), files under mountPath are loaded from archive
+rl_RLAPI void rl_UnmountArchive(const char *fileName);                    // Unmount packed archive, NULL to unmount all archives
+rl_RLAPI bool rl_ExportArchive(const char *fileName, rl_FilePathList files, const char *basePath, bool compress); // Export files into a packed archive (.rpak), entries named relative to basePath
+
+// Job system functions, worker threads shared with raylib modules jobs (image filters, ray batches, skinning...)
+// NOTE: Jobs run on caller thread if worker threads are not available
+rl_RLAPI rl_Job *rl_RunJob(JobCallback callback, void *userData, rl_Job *const *dependencies, int dependencyCount); // Run job on worker threads, once dependencies jobs are completed
+rl_RLAPI rl_Job *rl_RunJobRange(JobRangeCallback callback, void *userData, int count, int chunkSize, rl_Job *const *dependencies, int dependencyCount); // Run parallel job on worker threads, range [0, count) processed in chunks
+rl_RLAPI void rl_ParallelFor(JobRangeCallback callback, void *userData, int count, int chunkSize); // Process range [0, count) in chunks on worker threads and caller thread, returns once completed
+rl_RLAPI void rl_SetJobCompletedCallback(rl_Job *job, JobCallback callback, void *userData); // Set job completed callback, called by rl_UpdateJobs() on its thread (main thread)
+rl_RLAPI bool rl_IsJobCompleted(rl_Job *job);                            // Check if job has been completed (non-blocking)
+rl_RLAPI void rl_WaitJob(rl_Job *job);                                   // Wait for job completion, caller thread runs queued jobs meanwhile
+rl_RLAPI void rl_ReleaseJob(rl_Job *job);                                // Release job handle, job is still run if not completed
+rl_RLAPI void rl_UpdateJobs(void);                                       // Call completed jobs callbacks, called by rl_BeginDrawing()
+rl_RLAPI void rl_SetJobWorkerCount(int count);                           // Set job worker threads count (-1: one per additional processor), running workers complete queued jobs
+rl_RLAPI int rl_GetJobWorkerCount(void);                                 // Get job worker threads count (0 if jobs run on caller thread)
 //------------------------------------------------------------------
 
 // File system functions
@@ -1157,6 +1783,7 @@ rl_RLAPI bool rl_IsPathFile(const char *path);                            // Che
 rl_RLAPI bool rl_IsFileNameValid(const char *fileName);                   // Check if fileName is valid for the platform/OS
 rl_RLAPI rl_FilePathList rl_LoadDirectoryFiles(const char *dirPath);         // Load directory filepaths
 rl_RLAPI rl_FilePathList rl_LoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs); // Load directory filepaths with extension filtering and recursive directory scan. Use 'DIR' in the filter string to include directories in the result
+rl_RLAPI int rl_ScanDirectoryFiles(const char *basePath, const char *filter, bool scanSubdirs, DirectoryFileCallback callback, void *userData); // Scan directory filepaths, streamed to callback (no list allocated), returns paths count
 rl_RLAPI void rl_UnloadDirectoryFiles(rl_FilePathList files);                // Unload filepaths
 rl_RLAPI bool rl_IsFileDropped(void);                                     // Check if a file has been dropped into window
 rl_RLAPI rl_FilePathList rl_LoadDroppedFiles(void);                          // Load dropped filepaths
@@ -1165,22 +1792,36 @@ rl_RLAPI void rl_UnloadDroppedFiles(rl_FilePathList files);                  //
 // Compression/Encoding functionality
 rl_RLAPI unsigned char *rl_CompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be rl_MemFree()
 rl_RLAPI unsigned char *rl_DecompressData(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress data (DEFLATE algorithm), memory must be rl_MemFree()
+rl_RLAPI unsigned char *rl_CompressDataEx(const unsigned char *data, int dataSize, int *compDataSize, int codec, int threads); // Compress data into compressed blocks stream (rl_CompressionCodec), blocks compressed in parallel, memory must be rl_MemFree()
+rl_RLAPI unsigned char *rl_DecompressDataEx(const unsigned char *compData, int compDataSize, int *dataSize, int threads); // Decompress compressed blocks stream, blocks decompressed in parallel, memory must be rl_MemFree()
+rl_RLAPI rl_CompressionStream *rl_InitCompressionStream(int codec, bool decompress, CompressionStreamCallback callback, void *userData); // Init compression stream, output data is streamed to callback
+rl_RLAPI bool rl_UpdateCompressionStream(rl_CompressionStream *stream, const unsigned char *data, int dataSize); // Update compression stream with input data chunk
+rl_RLAPI bool rl_CloseCompressionStream(rl_CompressionStream *stream);   // Close compression stream, remaining data is flushed, returns false on failure
 rl_RLAPI char *rl_EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize);               // Encode data to Base64 string (includes NULL terminator), memory must be rl_MemFree()
 rl_RLAPI unsigned char *rl_DecodeDataBase64(const char *text, int *outputSize);                             // Decode Base64 string (expected NULL terminated), memory must be rl_MemFree()
 rl_RLAPI unsigned int rl_ComputeCRC32(unsigned char *data, int dataSize);       // Compute CRC32 hash code
 rl_RLAPI unsigned int *rl_ComputeMD5(unsigned char *data, int dataSize);        // Compute MD5 hash code, returns static int[4] (16 bytes)
 rl_RLAPI unsigned int *rl_ComputeSHA1(unsigned char *data, int dataSize);       // Compute SHA1 hash code, returns static int[5] (20 bytes)
 rl_RLAPI unsigned int *rl_ComputeSHA256(unsigned char *data, int dataSize);     // Compute SHA256 hash code, returns static int[8] (32 bytes)
+rl_RLAPI rl_HashState rl_InitHash(int hashType);                         // Init hash state for streaming hash computation (rl_HashType)
+rl_RLAPI void rl_UpdateHash(rl_HashState *state, const unsigned char *data, int dataSize); // Update hash state with data chunk
+rl_RLAPI unsigned int *rl_FinishHash(rl_HashState *state);               // Finish hash computation, returns state digest (size depends on hash type)
+rl_RLAPI unsigned int *rl_ComputeFileHash(const char *fileName, int hashType); // Compute file hash code streaming file data, returns static int[8], NULL on failure
 
 // Automation events functionality
-rl_RLAPI rl_AutomationEventList rl_LoadAutomationEventList(const char *fileName); // Load automation events list from file, NULL for empty list, capacity = MAX_AUTOMATION_EVENTS
+rl_RLAPI rl_AutomationEventList rl_LoadAutomationEventList(const char *fileName); // Load automation events list from file, NULL for empty list, initial capacity = MAX_AUTOMATION_EVENTS
 rl_RLAPI void rl_UnloadAutomationEventList(rl_AutomationEventList list);   // Unload automation events list from file
 rl_RLAPI bool rl_ExportAutomationEventList(rl_AutomationEventList list, const char *fileName); // Export automation events list as text file
+rl_RLAPI bool rl_ExportAutomationEventListBinary(rl_AutomationEventList list, const char *fileName, bool compress); // Export automation events list as binary file, optionally compressed
 rl_RLAPI void rl_SetAutomationEventList(rl_AutomationEventList *list);     // Set automation event list to record to
 rl_RLAPI void rl_SetAutomationEventBaseFrame(int frame);                // Set automation event internal base frame to start recording
 rl_RLAPI void rl_StartAutomationEventRecording(void);                   // Start recording automation events (rl_AutomationEventList must be set)
+rl_RLAPI bool rl_StartAutomationEventRecordingToFile(const char *fileName, bool compress); // Start recording automation events streamed to binary file
 rl_RLAPI void rl_StopAutomationEventRecording(void);                    // Stop recording automation events
 rl_RLAPI void rl_PlayAutomationEvent(rl_AutomationEvent event);            // Play a recorded automation event
+rl_RLAPI rl_AutomationEventStream *rl_LoadAutomationEventStream(const char *fileName); // Load automation events binary file for streamed playback
+rl_RLAPI bool rl_ReadAutomationEvent(rl_AutomationEventStream *stream, rl_AutomationEvent *event); // Read next automation event from stream, returns false on stream end
+rl_RLAPI void rl_UnloadAutomationEventStream(rl_AutomationEventStream *stream); // Unload automation events stream
 
 //------------------------------------------------------------------------------------
 // Input Handling Functions (Module: core)
@@ -1197,6 +1838,10 @@ rl_RLAPI int rl_GetCharPressed(void);                               // Get char
 rl_RLAPI const char *rl_GetKeyName(int key);                        // Get name of a QWERTY key on the current keyboard layout (eg returns string 'q' for KEY_A on an AZERTY keyboard)
 rl_RLAPI void rl_SetExitKey(int key);                               // Set a custom key to exit program (default is ESC)
 
+// Input-related functions: events
+rl_RLAPI bool rl_GetInputEvent(rl_InputEvent *event);                  // Get next timestamped input event (keyboard, mouse, touch, gamepad), returns false when the queue is empty
+rl_RLAPI unsigned int rl_GetInputEventsDropped(void);               // Get number of input events dropped because queue was full
+
 // Input-related functions: gamepads
 rl_RLAPI bool rl_IsGamepadAvailable(int gamepad);                   // Check if a gamepad is available
 rl_RLAPI const char *rl_GetGamepadName(int gamepad);                // Get gamepad internal name id
@@ -1244,6 +1889,8 @@ rl_RLAPI rl_Vector2 rl_GetGestureDragVector(void);                     // Get ge
 rl_RLAPI float rl_GetGestureDragAngle(void);                        // Get gesture drag angle
 rl_RLAPI rl_Vector2 rl_GetGesturePinchVector(void);                    // Get gesture pinch delta
 rl_RLAPI float rl_GetGesturePinchAngle(void);                       // Get gesture pinch angle
+rl_RLAPI int rl_GetGestureTouchCount(void);                         // Get number of touch points tracked by multi-touch gestures
+rl_RLAPI rl_GestureTouch rl_GetGestureTouch(int index);             // Get multi-touch gestures state for a tracked touch point (per touch gesture)
 
 //------------------------------------------------------------------------------------
 // rl_Camera System Functions (Module: rcamera)
@@ -1260,14 +1907,20 @@ rl_RLAPI void rl_UpdateCameraPro(rl_Camera *camera, rl_Vector3 movement, rl_Vect
 rl_RLAPI void rl_SetShapesTexture(rl_Texture2D texture, rl_Rectangle source); // Set texture and rectangle to be used on shapes drawing
 rl_RLAPI rl_Texture2D rl_GetShapesTexture(void);                 // Get texture that is used for shapes drawing
 rl_RLAPI rl_Rectangle rl_GetShapesTextureRectangle(void);        // Get texture source rectangle that is used for shapes drawing
+rl_RLAPI void rl_BeginShapesSDFMode(void);                       // Begin SDF shapes mode, circles, full rings and rounded rectangles drawn as one quad each
+rl_RLAPI void rl_EndShapesSDFMode(void);                         // End SDF shapes mode
+rl_RLAPI void rl_BeginShapesAAMode(void);                        // Begin anti-aliased shapes mode, shapes edges drawn with one pixel alpha fringes (no MSAA required)
+rl_RLAPI void rl_EndShapesAAMode(void);                          // End anti-aliased shapes mode
 
 // Basic shapes drawing functions
 rl_RLAPI void rl_DrawPixel(int posX, int posY, rl_Color color);                                                   // Draw a pixel using geometry [Can be slow, use with care]
+rl_RLAPI void rl_DrawPixels(const rl_Vector2 *positions, const rl_Color *colors, int count);              // Draw multiple pixels, one color per pixel (instanced, one draw call)
 rl_RLAPI void rl_DrawPixelV(rl_Vector2 position, rl_Color color);                                                    // Draw a pixel using geometry (Vector version) [Can be slow, use with care]
 rl_RLAPI void rl_DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, rl_Color color);                // Draw a line
 rl_RLAPI void rl_DrawLineV(rl_Vector2 startPos, rl_Vector2 endPos, rl_Color color);                                     // Draw a line (using gl lines)
 rl_RLAPI void rl_DrawLineEx(rl_Vector2 startPos, rl_Vector2 endPos, float thick, rl_Color color);                       // Draw a line (using triangles/quads)
 rl_RLAPI void rl_DrawLineStrip(const rl_Vector2 *points, int pointCount, rl_Color color);                            // Draw lines sequence (using gl lines)
+rl_RLAPI void rl_DrawLineStripEx(const rl_Vector2 *points, int pointCount, float thick, int join, int cap, rl_Color color); // Draw lines sequence with thickness, joins (rl_LineJoin) and caps (rl_LineCap)
 rl_RLAPI void rl_DrawLineBezier(rl_Vector2 startPos, rl_Vector2 endPos, float thick, rl_Color color);                   // Draw line segment cubic-bezier in-out interpolation
 rl_RLAPI void rl_DrawLineDashed(rl_Vector2 startPos, rl_Vector2 endPos, int dashSize, int spaceSize, rl_Color color);   // Draw a dashed line
 rl_RLAPI void rl_DrawCircle(int centerX, int centerY, float radius, rl_Color color);                              // Draw a color-filled circle
@@ -1285,6 +1938,7 @@ rl_RLAPI void rl_DrawRing(rl_Vector2 center, float innerRadius, float outerRadiu
 rl_RLAPI void rl_DrawRingLines(rl_Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, int segments, rl_Color color);    // Draw ring outline
 rl_RLAPI void rl_DrawRectangle(int posX, int posY, int width, int height, rl_Color color);                        // Draw a color-filled rectangle
 rl_RLAPI void rl_DrawRectangleV(rl_Vector2 position, rl_Vector2 size, rl_Color color);                                  // Draw a color-filled rectangle (Vector version)
+rl_RLAPI void rl_DrawRectangles(const rl_Rectangle *recs, const rl_Color *colors, int count);         // Draw multiple color-filled rectangles, one color per rectangle (instanced, one draw call)
 rl_RLAPI void rl_DrawRectangleRec(rl_Rectangle rec, rl_Color color);                                                 // Draw a color-filled rectangle
 rl_RLAPI void rl_DrawRectanglePro(rl_Rectangle rec, rl_Vector2 origin, float rotation, rl_Color color);                 // Draw a color-filled rectangle with pro parameters
 rl_RLAPI void rl_DrawRectangleGradientV(int posX, int posY, int width, int height, rl_Color top, rl_Color bottom);   // Draw a vertical-gradient-filled rectangle
@@ -1302,6 +1956,20 @@ rl_RLAPI void rl_DrawTriangleStrip(const rl_Vector2 *points, int pointCount, rl_
 rl_RLAPI void rl_DrawPoly(rl_Vector2 center, int sides, float radius, float rotation, rl_Color color);               // Draw a regular polygon (Vector version)
 rl_RLAPI void rl_DrawPolyLines(rl_Vector2 center, int sides, float radius, float rotation, rl_Color color);          // Draw a polygon outline of n sides
 rl_RLAPI void rl_DrawPolyLinesEx(rl_Vector2 center, int sides, float radius, float rotation, float lineThick, rl_Color color); // Draw a polygon outline of n sides with extended parameters
+rl_RLAPI rl_Polygon rl_LoadPolygon(const rl_Vector2 *points, int pointCount);                             // Load polygon triangulated for drawing, concave polygons supported
+rl_RLAPI rl_Polygon rl_LoadPolygonEx(const rl_Vector2 *points, const int *contourCounts, int contourCount); // Load polygon with holes triangulated for drawing, outer contour points followed by holes points
+rl_RLAPI void rl_UnloadPolygon(rl_Polygon polygon);                                                       // Unload polygon vertex and triangles data
+rl_RLAPI void rl_DrawPolygon(rl_Polygon polygon, rl_Color color);                                         // Draw polygon, triangulated on loading
+
+// Paths drawing functions
+rl_RLAPI void rl_PathMoveTo(rl_Path *path, rl_Vector2 point);                                             // Begin path subpath at point
+rl_RLAPI void rl_PathLineTo(rl_Path *path, rl_Vector2 point);                                             // Add line to path
+rl_RLAPI void rl_PathQuadTo(rl_Path *path, rl_Vector2 control, rl_Vector2 point);                         // Add quadratic Bezier curve to path
+rl_RLAPI void rl_PathCubicTo(rl_Path *path, rl_Vector2 control1, rl_Vector2 control2, rl_Vector2 point);  // Add cubic Bezier curve to path
+rl_RLAPI void rl_PathClose(rl_Path *path);                                                                // Close path current subpath
+rl_RLAPI void rl_UnloadPath(rl_Path path);                                                                // Unload path commands and points data
+rl_RLAPI rl_Polygon rl_LoadPathFill(rl_Path path, int fillRule, float scale);                             // Load path fill (rl_FillRule) for drawing scale (<= 0.0f: current scale), drawn with rl_DrawPolygon()
+rl_RLAPI rl_Spline rl_LoadPathStroke(rl_Path path, float thick, int join, int cap, float scale);           // Load path stroke for drawing scale (<= 0.0f: current scale), drawn with rl_DrawSpline()
 
 // Splines drawing functions
 rl_RLAPI void rl_DrawSplineLinear(const rl_Vector2 *points, int pointCount, float thick, rl_Color color);            // Draw spline: Linear, minimum 2 points
@@ -1314,6 +1982,10 @@ rl_RLAPI void rl_DrawSplineSegmentBasis(rl_Vector2 p1, rl_Vector2 p2, rl_Vector2
 rl_RLAPI void rl_DrawSplineSegmentCatmullRom(rl_Vector2 p1, rl_Vector2 p2, rl_Vector2 p3, rl_Vector2 p4, float thick, rl_Color color); // Draw spline segment: Catmull-Rom, 4 points
 rl_RLAPI void rl_DrawSplineSegmentBezierQuadratic(rl_Vector2 p1, rl_Vector2 c2, rl_Vector2 p3, float thick, rl_Color color); // Draw spline segment: Quadratic Bezier, 2 points, 1 control point
 rl_RLAPI void rl_DrawSplineSegmentBezierCubic(rl_Vector2 p1, rl_Vector2 c2, rl_Vector2 c3, rl_Vector2 p4, float thick, rl_Color color); // Draw spline segment: Cubic Bezier, 2 points, 2 control points
+rl_RLAPI rl_Spline rl_LoadSpline(int type, const rl_Vector2 *points, int pointCount, float thick, float scale); // Load spline tessellated for drawing scale (<= 0.0f: current scale), static splines drawn with no tessellation
+rl_RLAPI rl_Spline rl_LoadLineStripStroke(const rl_Vector2 *points, int pointCount, float thick, int join, int cap); // Load line strip stroke with joins and caps, drawn with rl_DrawSpline()
+rl_RLAPI void rl_UnloadSpline(rl_Spline spline);                                                         // Unload spline vertex data
+rl_RLAPI void rl_DrawSpline(rl_Spline spline, rl_Color color);                                            // Draw spline, tessellated on loading
 
 // Spline segment point evaluation functions, for a given t [0.0f .. 1.0f]
 rl_RLAPI rl_Vector2 rl_GetSplinePointLinear(rl_Vector2 startPos, rl_Vector2 endPos, float t);                           // Get (evaluate) spline point: Linear
@@ -1332,6 +2004,11 @@ rl_RLAPI bool rl_CheckCollisionPointCircle(rl_Vector2 point, rl_Vector2 center,
 rl_RLAPI bool rl_CheckCollisionPointTriangle(rl_Vector2 point, rl_Vector2 p1, rl_Vector2 p2, rl_Vector2 p3);               // Check if point is inside a triangle
 rl_RLAPI bool rl_CheckCollisionPointLine(rl_Vector2 point, rl_Vector2 p1, rl_Vector2 p2, int threshold);                // Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]
 rl_RLAPI bool rl_CheckCollisionPointPoly(rl_Vector2 point, const rl_Vector2 *points, int pointCount);                // Check if point is within a polygon described by array of vertices
+rl_RLAPI int rl_CheckCollisionPointRecs(rl_Vector2 point, const rl_Rectangle *recs, int recCount, int *indices);    // Check point against array of rectangles, collided indices stored (if not NULL), returns collisions count
+rl_RLAPI int rl_CheckCollisionPointCircles(rl_Vector2 point, const rl_Vector2 *centers, const float *radius, int circleCount, int *indices); // Check point against arrays of circles, collided indices stored (if not NULL), returns collisions count
+rl_RLAPI int rl_CheckCollisionPointsRec(const rl_Vector2 *points, int pointCount, rl_Rectangle rec, int *indices);  // Check array of points against rectangle, collided indices stored (if not NULL), returns collisions count
+rl_RLAPI int rl_CheckCollisionPointsCircle(const rl_Vector2 *points, int pointCount, rl_Vector2 center, float radius, int *indices); // Check array of points against circle, collided indices stored (if not NULL), returns collisions count
+rl_RLAPI int rl_CheckCollisionPointsPoly(const rl_Vector2 *points, int pointCount, const rl_Vector2 *polyPoints, int polyPointCount, int *indices); // Check array of points against polygon, collided indices stored (if not NULL), returns collisions count
 rl_RLAPI bool rl_CheckCollisionLines(rl_Vector2 startPos1, rl_Vector2 endPos1, rl_Vector2 startPos2, rl_Vector2 endPos2, rl_Vector2 *collisionPoint); // Check the collision between two lines defined by two points each, returns collision point by reference
 rl_RLAPI rl_Rectangle rl_GetCollisionRec(rl_Rectangle rec1, rl_Rectangle rec2);                                         // Get collision rectangle for two rectangles collision
 
@@ -1346,14 +2023,32 @@ rl_RLAPI rl_Image rl_LoadImageRaw(const char *fileName, int width, int height, i
 rl_RLAPI rl_Image rl_LoadImageAnim(const char *fileName, int *frames);                                            // Load image sequence from file (frames appended to image.data)
 rl_RLAPI rl_Image rl_LoadImageAnimFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int *frames); // Load image sequence from memory buffer
 rl_RLAPI rl_Image rl_LoadImageFromMemory(const char *fileType, const unsigned char *fileData, int dataSize);      // Load image from memory buffer, fileType refers to extension: i.e. '.png'
+rl_RLAPI rl_Image *rl_LoadImages(const char **fileNames, int count);                                              // Load images from files, decoded in parallel on worker threads
+rl_RLAPI void rl_UnloadImages(rl_Image *images, int count);                                                      // Unload images loaded with rl_LoadImages()
+rl_RLAPI void rl_SetImageCacheSize(long long bytes);                                                             // Set decoded images cache size in bytes, images loaded from file are cached by path and modification time (0: disabled)
+rl_RLAPI void rl_ClearImageCache(void);                                                                          // Clear decoded images cache
 rl_RLAPI rl_Image rl_LoadImageFromTexture(rl_Texture2D texture);                                                     // Load image from GPU texture data
 rl_RLAPI rl_Image rl_LoadImageFromScreen(void);                                                                   // Load image from screen buffer and (screenshot)
+rl_RLAPI void rl_LoadImageFromScreenAsync(ScreenCaptureCallback callback, void *userData);                            // Load image from screen buffer asynchronously, callback called when available (1-2 frames later)
 rl_RLAPI bool rl_IsImageValid(rl_Image image);                                                                    // Check if an image is valid (data and parameters)
 rl_RLAPI void rl_UnloadImage(rl_Image image);                                                                     // Unload image from CPU memory (RAM)
 rl_RLAPI bool rl_ExportImage(rl_Image image, const char *fileName);                                               // Export image data to file, returns true on success
 rl_RLAPI unsigned char *rl_ExportImageToMemory(rl_Image image, const char *fileType, int *fileSize);              // Export image to memory buffer
+rl_RLAPI bool rl_ExportImageAsync(rl_Image image, const char *fileName);                                          // Export image data to file on a background thread (data is copied), returns true if queued
+rl_RLAPI void rl_WaitImageExports(void);                                                                          // Wait for images queued by rl_ExportImageAsync() to be exported
+rl_RLAPI void rl_SetImageExportCompression(int level);                                                            // Set PNG export compression level [0..8], lower levels export faster (default: 2)
 rl_RLAPI bool rl_ExportImageAsCode(rl_Image image, const char *fileName);                                         // Export image as code file defining an array of bytes, returns true on success
 
+// rl_Image mapping functions
+// NOTE: Raw image file is not loaded in memory, only regions accessed are paged in,
+// images bigger than RAM can be browsed loading visible regions as tile textures
+rl_RLAPI rl_ImageMapped rl_LoadImageRawMapped(const char *fileName, int width, int height, int format, long long headerSize); // Load mapped image from RAW file data (uncompressed formats)
+rl_RLAPI bool rl_IsImageMappedValid(rl_ImageMapped image);                                                      // Check if a mapped image is valid (loaded)
+rl_RLAPI void rl_UnloadImageMapped(rl_ImageMapped image);                                                       // Unload mapped image, file mapping is released
+rl_RLAPI rl_Image rl_ImageFromMapped(rl_ImageMapped image, rl_Rectangle rec);                                   // Load image from mapped image region (region copied)
+rl_RLAPI rl_Texture2D rl_LoadTextureMapped(rl_ImageMapped image, rl_Rectangle rec);                             // Load texture from mapped image region
+rl_RLAPI void rl_UpdateTextureMapped(rl_Texture2D texture, rl_ImageMapped image, rl_Rectangle source, rl_Vector2 position); // Update texture area at position with mapped image region (same format)
+
 // rl_Image generation functions
 rl_RLAPI rl_Image rl_GenImageColor(int width, int height, rl_Color color);                                           // Generate image: plain color
 rl_RLAPI rl_Image rl_GenImageGradientLinear(int width, int height, int direction, rl_Color start, rl_Color end);        // Generate image: linear gradient, direction in degrees [0..360], 0=Vertical gradient
@@ -1372,6 +2067,7 @@ rl_RLAPI rl_Image rl_ImageFromChannel(rl_Image image, int selectedChannel);
 rl_RLAPI rl_Image rl_ImageText(const char *text, int fontSize, rl_Color color);                                      // Create an image from text (default font)
 rl_RLAPI rl_Image rl_ImageTextEx(rl_Font font, const char *text, float fontSize, float spacing, rl_Color tint);         // Create an image from text (custom sprite font)
 rl_RLAPI void rl_ImageFormat(rl_Image *image, int newFormat);                                                     // Convert image data to desired format
+rl_RLAPI void rl_ImageCompress(rl_Image *image, int format);                                                      // Compress image data to GPU compressed format (DXT, ETC1, ETC2, BC7, BC4)
 rl_RLAPI void rl_ImageToPOT(rl_Image *image, rl_Color fill);                                                         // Convert image to POT (power-of-two)
 rl_RLAPI void rl_ImageCrop(rl_Image *image, rl_Rectangle crop);                                                      // Crop an image to a defined rectangle
 rl_RLAPI void rl_ImageAlphaCrop(rl_Image *image, float threshold);                                                // Crop image depending on alpha value
@@ -1381,10 +2077,13 @@ rl_RLAPI void rl_ImageAlphaPremultiply(rl_Image *image);
 rl_RLAPI void rl_ImageBlurGaussian(rl_Image *image, int blurSize);                                                // Apply Gaussian blur using a box blur approximation
 rl_RLAPI void rl_ImageKernelConvolution(rl_Image *image, const float *kernel, int kernelSize);                    // Apply custom square convolution kernel to image
 rl_RLAPI void rl_ImageResize(rl_Image *image, int newWidth, int newHeight);                                       // Resize image (Bicubic scaling algorithm)
+rl_RLAPI void rl_ImageResizeEx(rl_Image *image, int newWidth, int newHeight, int threadCount);                    // Resize image (Bicubic scaling algorithm), rows split between threads (0: worker threads count)
 rl_RLAPI void rl_ImageResizeNN(rl_Image *image, int newWidth, int newHeight);                                     // Resize image (Nearest-Neighbor scaling algorithm)
 rl_RLAPI void rl_ImageResizeCanvas(rl_Image *image, int newWidth, int newHeight, int offsetX, int offsetY, rl_Color fill); // Resize canvas and fill with color
 rl_RLAPI void rl_ImageMipmaps(rl_Image *image);                                                                   // Compute all mipmap levels for a provided image
+rl_RLAPI void rl_ImageMipmapsEx(rl_Image *image, int filter, bool srgb, float alphaCutoff);                         // Compute all mipmap levels with filter (rl_MipmapFilter), sRGB-correct filtering and alpha test coverage preservation (cutoff 0.0f: disabled)
 rl_RLAPI void rl_ImageDither(rl_Image *image, int rBpp, int gBpp, int bBpp, int aBpp);                            // Dither image data to 16bpp or lower (Floyd-Steinberg dithering)
+rl_RLAPI void rl_ImageDitherEx(rl_Image *image, int rBpp, int gBpp, int bBpp, int aBpp, int method);              // Dither image data to 16bpp or lower with method (rl_DitherMethod), ordered methods run on worker threads
 rl_RLAPI void rl_ImageFlipVertical(rl_Image *image);                                                              // Flip image vertically
 rl_RLAPI void rl_ImageFlipHorizontal(rl_Image *image);                                                            // Flip image horizontally
 rl_RLAPI void rl_ImageRotate(rl_Image *image, int degrees);                                                       // Rotate image by input angle in degrees (-359 to 359)
@@ -1396,6 +2095,22 @@ rl_RLAPI void rl_ImageColorGrayscale(rl_Image *image);
 rl_RLAPI void rl_ImageColorContrast(rl_Image *image, float contrast);                                             // Modify image color: contrast (-100 to 100)
 rl_RLAPI void rl_ImageColorBrightness(rl_Image *image, int brightness);                                           // Modify image color: brightness (-255 to 255)
 rl_RLAPI void rl_ImageColorReplace(rl_Image *image, rl_Color color, rl_Color replace);                                  // Modify image color: replace color
+
+// rl_Image views functions, pixels are not copied and view operations are applied in place
+rl_RLAPI rl_ImageView rl_GetImageView(rl_Image image, rl_Rectangle rec);                                             // Get view of image area (valid while image is not modified or unloaded)
+rl_RLAPI rl_ImageView rl_LoadImageView(rl_Image image);                                                              // Load image view sharing reference-counted storage, image data ownership is taken
+rl_RLAPI rl_ImageView rl_GetImageSubView(rl_ImageView view, rl_Rectangle rec);                                       // Get view of view area (adds storage reference if shared)
+rl_RLAPI void rl_UnloadImageView(rl_ImageView view);                                                              // Unload image view, shared storage released with last reference
+rl_RLAPI bool rl_IsImageViewValid(rl_ImageView view);                                                             // Check if an image view is valid
+rl_RLAPI rl_Image rl_ImageFromView(rl_ImageView view);                                                               // Create an image from view pixels (copied)
+rl_RLAPI void rl_ImageViewFlipVertical(rl_ImageView view);                                                        // Flip image view vertically
+rl_RLAPI void rl_ImageViewFlipHorizontal(rl_ImageView view);                                                      // Flip image view horizontally
+rl_RLAPI void rl_ImageViewColorTint(rl_ImageView view, rl_Color color);                                              // Modify image view color: tint
+rl_RLAPI void rl_ImageViewColorInvert(rl_ImageView view);                                                         // Modify image view color: invert
+rl_RLAPI void rl_ImageViewColorGrayscale(rl_ImageView view);                                                      // Modify image view color: grayscale (format is kept)
+rl_RLAPI void rl_ImageViewColorContrast(rl_ImageView view, float contrast);                                       // Modify image view color: contrast (-100 to 100)
+rl_RLAPI void rl_ImageViewColorBrightness(rl_ImageView view, int brightness);                                     // Modify image view color: brightness (-255 to 255)
+rl_RLAPI void rl_ImageViewColorReplace(rl_ImageView view, rl_Color color, rl_Color replace);                         // Modify image view color: replace color
 rl_RLAPI rl_Color *rl_LoadImageColors(rl_Image image);                                                               // Load color data from image as a rl_Color array (RGBA - 32bit)
 rl_RLAPI rl_Color *rl_LoadImagePalette(rl_Image image, int maxPaletteSize, int *colorCount);                         // Load colors palette from image as a rl_Color array (RGBA - 32bit)
 rl_RLAPI void rl_UnloadImageColors(rl_Color *colors);                                                             // Unload color data loaded with rl_LoadImageColors()
@@ -1427,25 +2142,119 @@ rl_RLAPI void rl_ImageDrawTriangleStrip(rl_Image *dst, const rl_Vector2 *points,
 rl_RLAPI void rl_ImageDraw(rl_Image *dst, rl_Image src, rl_Rectangle srcRec, rl_Rectangle dstRec, rl_Color tint);             // Draw a source image within a destination image (tint applied to source)
 rl_RLAPI void rl_ImageDrawText(rl_Image *dst, const char *text, int posX, int posY, int fontSize, rl_Color color);   // Draw text (using default font) within an image (destination)
 rl_RLAPI void rl_ImageDrawTextEx(rl_Image *dst, rl_Font font, const char *text, rl_Vector2 position, float fontSize, float spacing, rl_Color tint); // Draw text (custom sprite font) within an image (destination)
+rl_RLAPI void rl_BeginImageCanvas(rl_Image *dst);                                                                 // Begin image canvas mode, drawing primitives on image are recorded
+rl_RLAPI void rl_EndImageCanvas(void);                                                                            // End image canvas mode, recorded primitives are rasterized by tiles in parallel
 
 // rl_Texture loading functions
 // NOTE: These functions require GPU access
 rl_RLAPI rl_Texture2D rl_LoadTexture(const char *fileName);                                                       // Load texture from file into GPU memory (VRAM)
 rl_RLAPI rl_Texture2D rl_LoadTextureFromImage(rl_Image image);                                                       // Load texture from image data
+rl_RLAPI rl_Texture2D rl_LoadTextureFromImageAsync(rl_Image image);                                                  // Load texture from image data, GPU transfer completes asynchronously (image can be unloaded on return)
+rl_RLAPI void rl_SetTextureCompression(int format);                                                              // Set GPU compressed format for textures loaded from uncompressed images (0 to disable)
 rl_RLAPI rl_TextureCubemap rl_LoadTextureCubemap(rl_Image image, int layout);                                        // Load cubemap from image, multiple image cubemap layouts supported
+rl_RLAPI rl_TextureArray rl_LoadTextureArray(const rl_Image *images, int count);                                     // Load texture array from images (same size and format), one layer per image
+rl_RLAPI rl_TextureArray rl_LoadTextureArrayFromImage(rl_Image image, int tileWidth, int tileHeight);                // Load texture array from image tiles, one layer per tile
+rl_RLAPI rl_Texture3D rl_LoadTexture3D(const rl_Image *slices, int count);                                           // Load 3D texture from depth slices images (same size and format)
 rl_RLAPI rl_RenderTexture2D rl_LoadRenderTexture(int width, int height);                                          // Load texture for rendering (framebuffer)
 rl_RLAPI bool rl_IsTextureValid(rl_Texture2D texture);                                                            // Check if a texture is valid (loaded in GPU)
+rl_RLAPI bool rl_IsTextureReady(rl_Texture2D texture);                                                            // Check if a texture async upload has completed (ready to be drawn)
 rl_RLAPI void rl_UnloadTexture(rl_Texture2D texture);                                                             // Unload texture from GPU memory (VRAM)
+rl_RLAPI int rl_ReloadModifiedTextures(void);                                                       // Reload shared textures with modified files (hot reload), returns reloaded textures count
+rl_RLAPI int rl_GetTextureReferenceCount(rl_Texture2D texture);                                     // Get shared texture references count (0 if texture is not shared)
+rl_RLAPI bool rl_IsTextureArrayValid(rl_TextureArray texture);                                                    // Check if a texture array is valid (loaded in GPU)
+rl_RLAPI void rl_UnloadTextureArray(rl_TextureArray texture);                                                     // Unload texture array from GPU memory (VRAM)
+rl_RLAPI bool rl_IsTexture3DValid(rl_Texture3D texture);                                                          // Check if a 3D texture is valid (loaded in GPU)
+rl_RLAPI void rl_UnloadTexture3D(rl_Texture3D texture);                                                           // Unload 3D texture from GPU memory (VRAM)
 rl_RLAPI bool rl_IsRenderTextureValid(rl_RenderTexture2D target);                                                 // Check if a render texture is valid (loaded in GPU)
 rl_RLAPI void rl_UnloadRenderTexture(rl_RenderTexture2D target);                                                  // Unload render texture from GPU memory (VRAM)
+rl_RLAPI rl_RenderTexture2D rl_AcquireRenderTexture(int width, int height, int format, bool depth);              // Get transient render texture from pool (size, color format, depth), valid until frame end
+rl_RLAPI void rl_ReleaseRenderTexture(rl_RenderTexture2D target);                                                 // Return transient render texture to pool before frame end, for reuse in next passes
 rl_RLAPI void rl_UpdateTexture(rl_Texture2D texture, const void *pixels);                                         // Update GPU texture with new data (pixels should be able to fill texture)
 rl_RLAPI void rl_UpdateTextureRec(rl_Texture2D texture, rl_Rectangle rec, const void *pixels);                       // Update GPU texture rectangle with new data (pixels and rec should fit in texture)
+rl_RLAPI void rl_UpdateTextureArrayLayer(rl_TextureArray texture, int layer, const void *pixels);                    // Update GPU texture array layer with new data
+rl_RLAPI void rl_UpdateTexture3D(rl_Texture3D texture, const void *pixels);                                          // Update GPU 3D texture with new data (all depth slices)
 
 // rl_Texture configuration functions
 rl_RLAPI void rl_GenTextureMipmaps(rl_Texture2D *texture);                                                        // Generate GPU mipmaps for a texture
 rl_RLAPI void rl_SetTextureFilter(rl_Texture2D texture, int filter);                                              // Set texture scaling filter mode
 rl_RLAPI void rl_SetTextureWrap(rl_Texture2D texture, int wrap);                                                  // Set texture wrapping mode
 
+// rl_Texture processing functions
+// NOTE: Processing runs on GPU (fragment passes), render texture keeps image orientation (first row on top)
+// and its id can change when processed, read it back with rl_LoadImageFromTexture() if required
+rl_RLAPI rl_RenderTexture2D rl_LoadRenderTextureFromImage(rl_Image image);                                     // Load render texture from image data, for processing functions
+rl_RLAPI rl_RenderTexture2D rl_LoadRenderTextureFromTexture(rl_Texture2D texture);                             // Load render texture from texture (copy), for processing functions
+rl_RLAPI void rl_RenderTextureCrop(rl_RenderTexture2D *target, rl_Rectangle crop);                             // Crop a render texture to a defined rectangle
+rl_RLAPI void rl_RenderTextureResize(rl_RenderTexture2D *target, int newWidth, int newHeight);                 // Resize render texture (bilinear filtering)
+rl_RLAPI void rl_RenderTextureResizeNN(rl_RenderTexture2D *target, int newWidth, int newHeight);               // Resize render texture (Nearest-Neighbor scaling algorithm)
+rl_RLAPI void rl_RenderTextureDither(rl_RenderTexture2D *target, int rBpp, int gBpp, int bBpp, int aBpp);      // Dither render texture data to channels bpp (ordered dithering)
+rl_RLAPI void rl_RenderTextureFlipVertical(rl_RenderTexture2D *target);                                        // Flip render texture vertically
+rl_RLAPI void rl_RenderTextureFlipHorizontal(rl_RenderTexture2D *target);                                      // Flip render texture horizontally
+rl_RLAPI void rl_RenderTextureRotate(rl_RenderTexture2D *target, int degrees);                                 // Rotate render texture by input angle in degrees (-359 to 359)
+rl_RLAPI void rl_RenderTextureRotateCW(rl_RenderTexture2D *target);                                            // Rotate render texture clockwise 90deg
+rl_RLAPI void rl_RenderTextureRotateCCW(rl_RenderTexture2D *target);                                           // Rotate render texture counter-clockwise 90deg
+rl_RLAPI void rl_RenderTextureBlurGaussian(rl_RenderTexture2D *target, int blurSize);                          // Apply Gaussian blur to render texture
+rl_RLAPI void rl_RenderTextureColorTint(rl_RenderTexture2D *target, rl_Color color);                           // Modify render texture color: tint
+rl_RLAPI void rl_RenderTextureColorInvert(rl_RenderTexture2D *target);                                         // Modify render texture color: invert
+rl_RLAPI void rl_RenderTextureColorGrayscale(rl_RenderTexture2D *target);                                      // Modify render texture color: grayscale
+rl_RLAPI void rl_RenderTextureColorContrast(rl_RenderTexture2D *target, float contrast);                       // Modify render texture color: contrast (-100 to 100)
+rl_RLAPI void rl_RenderTextureColorBrightness(rl_RenderTexture2D *target, int brightness);                     // Modify render texture color: brightness (-255 to 255)
+rl_RLAPI void rl_RenderTextureColorReplace(rl_RenderTexture2D *target, rl_Color color, rl_Color replace);      // Modify render texture color: replace color
+rl_RLAPI void rl_RenderTexturePerlinNoise(rl_RenderTexture2D *target, int offsetX, int offsetY, float scale);  // Generate render texture: perlin noise (same noise as rl_GenImagePerlinNoise())
+rl_RLAPI void rl_RenderTextureCellular(rl_RenderTexture2D *target, int tileSize);                              // Generate render texture: cellular algorithm, bigger tileSize means bigger cells
+
+// rl_Texture palette functions
+// NOTE: Indexed images store 8-bit palette indices (PIXELFORMAT_UNCOMPRESSED_GRAYSCALE), indexed textures
+// are drawn in palette mode with palette lookup on GPU, swapping palettes does not modify index textures
+rl_RLAPI rl_Image rl_ImageIndexed(rl_Image image, const rl_Color *palette, int colorCount);                     // Create indexed image from image and palette (nearest palette color, 256 colors max)
+rl_RLAPI rl_Image rl_ImageFromIndexed(rl_Image indexed, const rl_Color *palette, int colorCount);               // Create image from indexed image and palette (RGBA - 32bit)
+rl_RLAPI rl_Texture2D rl_LoadTexturePalette(const rl_Color *colors, int colorCount);                            // Load palette texture for indexed textures drawing (256 colors, missing ones rl_BLANK)
+rl_RLAPI void rl_UpdateTexturePalette(rl_Texture2D palette, const rl_Color *colors, int colorCount);            // Update palette texture colors
+rl_RLAPI void rl_BeginPaletteMode(rl_Texture2D palette);                                                        // Begin palette mode, drawn textures are indexed textures looked up in palette
+rl_RLAPI void rl_EndPaletteMode(void);                                                                          // End palette mode (returns to default shader)
+
+// rl_Texture streaming functions
+// NOTE: Mipmap levels are streamed in asynchronously when requested (on-screen size) and evicted over budget,
+// resident texture changes along frames, get it with rl_GetTextureStreamTexture() every frame it's used
+rl_RLAPI rl_TextureStream rl_LoadTextureStream(const char *fileName);                                          // Load texture stream from file, low mipmap levels uploaded on load
+rl_RLAPI rl_TextureStream rl_LoadTextureStreamFromImage(rl_Image image);                                       // Load texture stream from image data (mipmaps generated if missing)
+rl_RLAPI bool rl_IsTextureStreamValid(rl_TextureStream stream);                                                // Check if a texture stream is valid (loaded)
+rl_RLAPI void rl_UnloadTextureStream(rl_TextureStream stream);                                                 // Unload texture stream from RAM and VRAM
+rl_RLAPI void rl_RequestTextureStreamSize(rl_TextureStream stream, float screenWidth, float screenHeight);     // Request texture stream mipmap level for an on-screen size (pixels), streamed at frame end
+rl_RLAPI rl_Texture2D rl_GetTextureStreamTexture(rl_TextureStream stream);                                     // Get texture stream resident texture (size of resident mipmap level)
+rl_RLAPI void rl_SetTextureStreamBudget(long long bytes);                                                      // Set texture streaming VRAM budget in bytes (0 for no budget)
+rl_RLAPI rl_TextureStreamStats rl_GetTextureStreamStats(void);                                                 // Get texture streaming stats (resident vs requested bytes)
+rl_RLAPI void rl_DrawTextureStream(rl_TextureStream stream, rl_Rectangle source, rl_Rectangle dest, rl_Vector2 origin, float rotation, rl_Color tint); // Draw a part of a texture stream (full resolution source), requesting level for destination size
+
+// rl_Texture atlas functions
+// NOTE: Images added at runtime share atlas texture and batch together, draw them with atlas rectangles
+rl_RLAPI rl_TextureAtlas rl_LoadTextureAtlas(int width, int height);                                            // Load texture atlas, images packed at runtime (RGBA8)
+rl_RLAPI bool rl_IsTextureAtlasValid(rl_TextureAtlas atlas);                                                    // Check if a texture atlas is valid (loaded)
+rl_RLAPI void rl_UnloadTextureAtlas(rl_TextureAtlas atlas);                                                     // Unload texture atlas from RAM and VRAM
+rl_RLAPI int rl_AddTextureAtlasImage(rl_TextureAtlas atlas, rl_Image image);                                    // Add image to texture atlas, returns entry id (0 if image does not fit)
+rl_RLAPI void rl_RemoveTextureAtlasImage(rl_TextureAtlas atlas, int entryId);                                   // Remove image from texture atlas, space reclaimed on defragmentation
+rl_RLAPI rl_Rectangle rl_GetTextureAtlasRect(rl_TextureAtlas atlas, int entryId);                               // Get texture atlas image rectangle, changes on defragmentation
+rl_RLAPI bool rl_DefragTextureAtlas(rl_TextureAtlas atlas);                                                     // Defragment texture atlas, repacking images to reclaim removed images space
+
+// rl_Texture animation functions
+// NOTE: Frames are decoded on demand (GIF), memory does not depend on frames count
+rl_RLAPI rl_AnimatedTexture rl_LoadAnimatedTexture(const char *fileName);                                      // Load animated texture from file, first frame decoded on load
+rl_RLAPI rl_AnimatedTexture rl_LoadAnimatedTextureFromMemory(const char *fileType, const unsigned char *fileData, int dataSize); // Load animated texture from memory buffer, fileType refers to extension: i.e. '.gif'
+rl_RLAPI bool rl_IsAnimatedTextureValid(rl_AnimatedTexture anim);                                              // Check if an animated texture is valid (loaded)
+rl_RLAPI void rl_UnloadAnimatedTexture(rl_AnimatedTexture anim);                                               // Unload animated texture from RAM and VRAM
+rl_RLAPI void rl_UpdateAnimatedTexture(rl_AnimatedTexture anim, float deltaTime);                              // Update animated texture, advancing frames by elapsed time (seconds) with file frames delays
+rl_RLAPI void rl_SetAnimatedTextureFrame(rl_AnimatedTexture anim, int frame);                                  // Set animated texture current frame
+rl_RLAPI int rl_GetAnimatedTextureFrame(rl_AnimatedTexture anim);                                              // Get animated texture current frame
+
+// rl_Image texture functions
+// NOTE: Texture mirrors an image kept by the user, rl_ImageDraw*() changes are tracked as dirty rectangles
+// and only merged dirty regions are uploaded on sync (image size and format must not change)
+rl_RLAPI rl_ImageTexture rl_LoadImageTexture(rl_Image *image);                                                // Load image texture mirroring image, image must stay valid while loaded
+rl_RLAPI bool rl_IsImageTextureValid(rl_ImageTexture texture);                                                // Check if an image texture is valid (loaded)
+rl_RLAPI void rl_UnloadImageTexture(rl_ImageTexture texture);                                                 // Unload image texture from VRAM (image is not unloaded)
+rl_RLAPI void rl_SetImageTextureDirty(rl_ImageTexture texture, rl_Rectangle rec);                             // Set image texture region dirty, for image changes not done by rl_ImageDraw*()
+rl_RLAPI int rl_SyncImageTexture(rl_ImageTexture texture);                                                    // Upload image texture dirty regions, returns regions uploaded
+
 // rl_Texture drawing functions
 rl_RLAPI void rl_DrawTexture(rl_Texture2D texture, int posX, int posY, rl_Color tint);                               // Draw a rl_Texture2D
 rl_RLAPI void rl_DrawTextureV(rl_Texture2D texture, rl_Vector2 position, rl_Color tint);                                // Draw a rl_Texture2D with position defined as rl_Vector2
@@ -1454,6 +2263,20 @@ rl_RLAPI void rl_DrawTextureRec(rl_Texture2D texture, rl_Rectangle source, rl_Ve
 rl_RLAPI void rl_DrawTexturePro(rl_Texture2D texture, rl_Rectangle source, rl_Rectangle dest, rl_Vector2 origin, float rotation, rl_Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
 rl_RLAPI void rl_DrawTextureNPatch(rl_Texture2D texture, rl_NPatchInfo nPatchInfo, rl_Rectangle dest, rl_Vector2 origin, float rotation, rl_Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
 
+// rl_RenderGraph functions
+// NOTE: Passes run in declaration order, passes not contributing to an output are culled, transient targets are
+// acquired from render textures pool on first write and released after last read (aliased by later passes),
+// consecutive passes writing the same target are merged in one render pass
+rl_RLAPI rl_RenderGraph *rl_LoadRenderGraph(void);                                                             // Load empty render graph
+rl_RLAPI void rl_UnloadRenderGraph(rl_RenderGraph *graph);                                                     // Unload render graph (imported render textures are not unloaded)
+rl_RLAPI int rl_AddRenderGraphTarget(rl_RenderGraph *graph, int width, int height, int format, bool depth);    // Add transient target (size 0 for render size, negative for render size divided), returns resource
+rl_RLAPI int rl_AddRenderGraphInput(rl_RenderGraph *graph, rl_RenderTexture2D target);                         // Add imported render texture read by passes (e.g. scene), returns resource
+rl_RLAPI int rl_AddRenderGraphOutput(rl_RenderGraph *graph, rl_RenderTexture2D target);                        // Add imported render texture written by passes (id 0 for screen), returns resource
+rl_RLAPI void rl_SetRenderGraphTexture(rl_RenderGraph *graph, int resource, rl_RenderTexture2D target);        // Set imported resource render texture (e.g. acquired every frame)
+rl_RLAPI int rl_AddRenderGraphPass(rl_RenderGraph *graph, rl_Shader shader, const int *inputs, int inputCount, int output); // Add fullscreen shader pass, inputs bound to texture0..textureN samplers, returns pass
+rl_RLAPI int rl_AddRenderGraphPassCallback(rl_RenderGraph *graph, RenderGraphPassCallback callback, void *userData, const int *inputs, int inputCount, int output); // Add custom drawing pass, returns pass
+rl_RLAPI int rl_ExecuteRenderGraph(rl_RenderGraph *graph);                                                     // Execute render graph passes, returns number of passes executed
+
 // rl_Color/pixel related functions
 rl_RLAPI bool rl_ColorIsEqual(rl_Color col1, rl_Color col2);                            // Check if two colors are equal
 rl_RLAPI rl_Color rl_Fade(rl_Color color, float alpha);                                 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
@@ -1483,11 +2306,16 @@ rl_RLAPI rl_Font rl_LoadFont(const char *fileName);
 rl_RLAPI rl_Font rl_LoadFontEx(const char *fileName, int fontSize, const int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
 rl_RLAPI rl_Font rl_LoadFontFromImage(rl_Image image, rl_Color key, int firstChar);                        // Load font from rl_Image (XNA style)
 rl_RLAPI rl_Font rl_LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+rl_RLAPI rl_Font rl_LoadFontSDF(const char *fileName, int fontSize, const int *codepoints, int codepointCount, int type); // Load SDF or MSDF font from file (.ttf/.otf), drawn scaled with distance field shader
+rl_RLAPI rl_Font rl_LoadFontDynamic(const char *fileName, int fontSize, int atlasSize);              // Load dynamic font from file (.ttf/.otf), glyphs rasterized on first use, least recently used evicted (atlasSize 0: default)
+rl_RLAPI rl_Font rl_LoadFontDynamicFromMemory(const unsigned char *fileData, int dataSize, int fontSize, int atlasSize); // Load dynamic font from memory buffer (.ttf/.otf data)
 rl_RLAPI bool rl_IsFontValid(rl_Font font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
+rl_RLAPI void rl_SetFontAtlasFormat(int format);                                                     // Set pixel format for generated fonts atlas textures (GRAY_ALPHA by default, GRAYSCALE or COMPRESSED_BC4_R)
 rl_RLAPI rl_GlyphInfo *rl_LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount, int type, int *glyphCount); // Load font data for further use
 rl_RLAPI rl_Image rl_GenImageFontAtlas(const rl_GlyphInfo *glyphs, rl_Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
 rl_RLAPI void rl_UnloadFontData(rl_GlyphInfo *glyphs, int glyphCount);                               // Unload font chars info data (RAM)
 rl_RLAPI void rl_UnloadFont(rl_Font font);                                                           // Unload font from GPU memory (VRAM)
+rl_RLAPI bool rl_ExportFont(rl_Font font, const char *fileName);                                    // Export font as cooked font file (.rfnt), returns true on success
 rl_RLAPI bool rl_ExportFontAsCode(rl_Font font, const char *fileName);                               // Export font as code file, returns true on success
 
 // Text drawing functions
@@ -1498,11 +2326,23 @@ rl_RLAPI void rl_DrawTextPro(rl_Font font, const char *text, rl_Vector2 position
 rl_RLAPI void rl_DrawTextCodepoint(rl_Font font, int codepoint, rl_Vector2 position, float fontSize, rl_Color tint); // Draw one character (codepoint)
 rl_RLAPI void rl_DrawTextCodepoints(rl_Font font, const int *codepoints, int codepointCount, rl_Vector2 position, float fontSize, float spacing, rl_Color tint); // Draw multiple character (codepoint)
 
+// Text layout functions
+rl_RLAPI rl_TextLayout *rl_LoadTextLayout(rl_Font font, const char *text, float fontSize, float spacing, float wrapWidth); // Load text layout, glyphs positioned once for static text (wrapWidth 0: no wrapping)
+rl_RLAPI void rl_UnloadTextLayout(rl_TextLayout *layout);                                         // Unload text layout
+rl_RLAPI void rl_AppendTextLayout(rl_TextLayout *layout, const char *text, rl_Color color);       // Append text to layout with text color (style span), only last line laid out again
+rl_RLAPI void rl_SetTextLayoutAlignment(rl_TextLayout *layout, int alignment);                    // Set text layout lines alignment (rl_TextAlignment), aligned to wrap width or layout width
+rl_RLAPI int rl_GetTextLayoutLineCount(const rl_TextLayout *layout);                              // Get text layout lines count, including wrapped lines
+rl_RLAPI void rl_DrawTextLayout(const rl_TextLayout *layout, rl_Vector2 position, rl_Color tint); // Draw text layout, cached glyphs quads submitted at once
+rl_RLAPI void rl_DrawTextLayoutLines(const rl_TextLayout *layout, rl_Vector2 position, int firstLine, int lineCount, rl_Color tint); // Draw text layout lines range, first line drawn at position
+rl_RLAPI rl_Vector2 rl_MeasureTextLayout(const rl_TextLayout *layout);                            // Measure text layout size (cached, same as rl_MeasureTextEx() for layout lines)
+
 // Text font info functions
 rl_RLAPI void rl_SetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
+rl_RLAPI void rl_SetTextShaping(bool enabled);                                                    // Set text shaping (kerning) for text drawing, measuring and layouts, shaped texts cached (disabled by default)
 rl_RLAPI int rl_MeasureText(const char *text, int fontSize);                                      // Measure string width for default font
 rl_RLAPI rl_Vector2 rl_MeasureTextEx(rl_Font font, const char *text, float fontSize, float spacing);    // Measure string size for rl_Font
 rl_RLAPI int rl_GetGlyphIndex(rl_Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
+rl_RLAPI float rl_GetCodepointKerning(rl_Font font, int codepoint, int nextCodepoint);              // Get kerning between two codepoints (unicode characters) in pixels at font base size
 rl_RLAPI rl_GlyphInfo rl_GetGlyphInfo(rl_Font font, int codepoint);                                     // Get glyph font info data for a codepoint (unicode character), fallback to '?' if not found
 rl_RLAPI rl_Rectangle rl_GetGlyphAtlasRec(rl_Font font, int codepoint);                                 // Get glyph rectangle in font atlas for a codepoint (unicode character), fallback to '?' if not found
 
@@ -1526,14 +2366,19 @@ rl_RLAPI int rl_TextCopy(char *dst, const char *src);
 rl_RLAPI bool rl_TextIsEqual(const char *text1, const char *text2);                               // Check if two text string are equal
 rl_RLAPI unsigned int rl_TextLength(const char *text);                                            // Get text length, checks for '\0' ending
 rl_RLAPI const char *rl_TextFormat(const char *text, ...);                                        // Text formatting with variables (sprintf() style)
+rl_RLAPI int rl_TextFormatBuffer(char *buffer, int bufferSize, const char *text, ...);            // Text formatting with variables into provided buffer, returns required length (thread-safe)
 rl_RLAPI const char *rl_TextSubtext(const char *text, int position, int length);                  // Get a piece of a text string
+rl_RLAPI int rl_TextSubtextBuffer(char *buffer, int bufferSize, const char *text, int position, int length); // Get a piece of a text string into provided buffer, returns required length (thread-safe)
 rl_RLAPI const char *rl_TextRemoveSpaces(const char *text);                                       // Remove text spaces, concat words
 rl_RLAPI char *rl_GetTextBetween(const char *text, const char *begin, const char *end);           // Get text between two strings
 rl_RLAPI char *rl_TextReplace(const char *text, const char *search, const char *replacement);     // Replace text string (WARNING: memory must be freed!)
+rl_RLAPI int rl_TextReplaceBuffer(char *buffer, int bufferSize, const char *text, const char *search, const char *replacement); // Replace text string into provided buffer, returns required length (-1: not valid search)
 rl_RLAPI char *rl_TextReplaceBetween(const char *text, const char *begin, const char *end, const char *replacement); // Replace text between two specific strings (WARNING: memory must be freed!)
 rl_RLAPI char *rl_TextInsert(const char *text, const char *insert, int position);                 // Insert text in a position (WARNING: memory must be freed!)
 rl_RLAPI char *rl_TextJoin(char **textList, int count, const char *delimiter);                    // Join text strings with delimiter
+rl_RLAPI int rl_TextJoinBuffer(char *buffer, int bufferSize, char **textList, int count, const char *delimiter); // Join text strings with delimiter into provided buffer, returns required length (thread-safe)
 rl_RLAPI char **rl_TextSplit(const char *text, char delimiter, int *count);                       // Split text into multiple strings, using MAX_TEXTSPLIT_COUNT static strings
+rl_RLAPI int rl_TextSplitOffsets(const char *text, char delimiter, int *offsets, int *lengths, int maxCount); // Split text into substrings offsets and lengths in text, returns substrings count (thread-safe, no copies)
 rl_RLAPI void rl_TextAppend(char *text, const char *append, int *position);                       // Append text at specific position and move cursor
 rl_RLAPI int rl_TextFindIndex(const char *text, const char *search);                              // Find first text occurrence within a string, -1 if not found
 rl_RLAPI char *rl_TextToUpper(const char *text);                                                  // Get upper case version of provided string
@@ -1578,9 +2423,15 @@ rl_RLAPI void rl_DrawGrid(int slices, float spacing);
 // rl_Model management functions
 rl_RLAPI rl_Model rl_LoadModel(const char *fileName);                                                // Load model from files (meshes and materials)
 rl_RLAPI rl_Model rl_LoadModelFromMesh(rl_Mesh mesh);                                                   // Load model from generated mesh (default material)
+rl_RLAPI rl_Model rl_LoadModelFromCache(const char *fileName);                                       // Load model from model cache file (.rmdl)
+rl_RLAPI rl_ModelLoader *rl_LoadModelAsync(const char *fileName);                                    // Load model asynchronously, file loading and decoding on a worker thread
+rl_RLAPI float rl_UpdateModelAsync(rl_ModelLoader *loader);                                          // Update async model loading (GPU uploads), returns progress [0.0f..1.0f]
+rl_RLAPI rl_Model rl_FinishModelAsync(rl_ModelLoader *loader);                                       // Finish async model loading (waits if required), loader is freed
 rl_RLAPI bool rl_IsModelValid(rl_Model model);                                                       // Check if a model is valid (loaded in GPU, VAO/VBOs)
 rl_RLAPI void rl_UnloadModel(rl_Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
 rl_RLAPI rl_BoundingBox rl_GetModelBoundingBox(rl_Model model);                                         // Compute model bounding box limits (considers all meshes)
+rl_RLAPI void rl_GenModelLOD(rl_Model *model, int levelCount, float reduction);                      // Generate model meshes levels of detail
+rl_RLAPI bool rl_ExportModel(rl_Model model, const rl_ModelAnimation *animations, int animCount, const char *fileName); // Export model as model cache file (.rmdl), animations are optional, returns true on success
 
 // rl_Model drawing functions
 rl_RLAPI void rl_DrawModel(rl_Model model, rl_Vector3 position, float scale, rl_Color tint);               // Draw a model (with texture if set)
@@ -1589,19 +2440,72 @@ rl_RLAPI void rl_DrawModelWires(rl_Model model, rl_Vector3 position, float scale
 rl_RLAPI void rl_DrawModelWiresEx(rl_Model model, rl_Vector3 position, rl_Vector3 rotationAxis, float rotationAngle, rl_Vector3 scale, rl_Color tint); // Draw a model wires (with texture if set) with extended parameters
 rl_RLAPI void rl_DrawModelPoints(rl_Model model, rl_Vector3 position, float scale, rl_Color tint); // Draw a model as points
 rl_RLAPI void rl_DrawModelPointsEx(rl_Model model, rl_Vector3 position, rl_Vector3 rotationAxis, float rotationAngle, rl_Vector3 scale, rl_Color tint); // Draw a model as points with extended parameters
+rl_RLAPI rl_DrawList *rl_LoadDrawList(void);                                                         // Load draw list, models meshes are drawn sorted by shader and material
+rl_RLAPI int rl_AddDrawListModel(rl_DrawList *list, rl_Model model, rl_Matrix transform);           // Add model to draw list (meshes and materials referenced), returns draw list model index
+rl_RLAPI void rl_SetDrawListModelTransform(rl_DrawList *list, int index, rl_Matrix transform);      // Set draw list model transform, world matrices are cached
+rl_RLAPI void rl_SetDrawListModelVisible(rl_DrawList *list, int index, bool visible);               // Set draw list model visibility
+rl_RLAPI void rl_SubmitDrawList(rl_DrawList *list);                                                  // Draw list models meshes, state only changed between different shaders, materials and meshes
+rl_RLAPI void rl_UnloadDrawList(rl_DrawList *list);                                                  // Unload draw list from memory (meshes and materials are not unloaded)
 rl_RLAPI void rl_DrawBoundingBox(rl_BoundingBox box, rl_Color color);                                   // Draw bounding box (wires)
+rl_RLAPI void rl_EnableFrustumCulling(void);                                                        // Enable frustum culling, rl_DrawMesh() skips meshes outside current view
+rl_RLAPI void rl_DisableFrustumCulling(void);                                                       // Disable frustum culling
+rl_RLAPI void rl_EnableOcclusionCulling(void);                                                      // Enable occlusion culling, rl_DrawMesh() skips meshes hidden in occlusion depth pyramid
+rl_RLAPI void rl_DisableOcclusionCulling(void);                                                     // Disable occlusion culling, unload occlusion depth pyramid
+rl_RLAPI void rl_UpdateOcclusionDepth(rl_RenderTexture2D target);                                   // Request target depth readback to build occlusion depth pyramid (call inside rl_BeginMode3D(), after occluders)
+rl_RLAPI bool rl_IsBoundingBoxOccluded(rl_BoundingBox box, rl_Matrix transform);                       // Check if transformed bounding box is hidden in occlusion depth pyramid
+rl_RLAPI rl_ShadowMap *rl_LoadShadowMap(int size, int cascadeCount, float distance);               // Load cascaded shadow map (depth texture array, one layer per cascade), shadows up to distance from camera
+rl_RLAPI void rl_SetShadowMapLight(rl_ShadowMap *shadowMap, rl_Vector3 direction);                 // Set shadow map directional light direction (cascades redrawn when changed)
+rl_RLAPI int rl_UpdateShadowMap(rl_ShadowMap *shadowMap, rl_Camera camera, const rl_DrawList *casters); // Update shadow map cascades for camera view, only cascades changed are drawn, returns cascades drawn
+rl_RLAPI void rl_SetShaderShadowMap(rl_Shader shader, const rl_ShadowMap *shadowMap);              // Set shader shadow map uniforms (shadowMap, shadowMatrices, shadowSplits, shadowCascadeCount)
+rl_RLAPI rl_TextureArray rl_GetShadowMapTexture(const rl_ShadowMap *shadowMap);                   // Get shadow map cascades depth texture array
+rl_RLAPI void rl_UnloadShadowMap(rl_ShadowMap *shadowMap);                                          // Unload shadow map from memory (RAM and VRAM)
+rl_RLAPI rl_DeferredRenderer *rl_LoadDeferredRenderer(int width, int height);                       // Load deferred renderer, G-buffer (albedo-specular, normals, depth) and lighting resources
+rl_RLAPI void rl_BeginDeferredMode(rl_DeferredRenderer *renderer, rl_Camera camera);                 // Begin G-buffer pass, meshes with default shader materials write G-buffer (3D mode)
+rl_RLAPI void rl_EndDeferredMode(void);                                                              // End G-buffer pass
+rl_RLAPI void rl_DrawDeferredLighting(rl_DeferredRenderer *renderer, const rl_DeferredLight *lights, int count, rl_Color ambient); // Draw lit scene into current target (light volumes), scene depth written
+rl_RLAPI rl_Shader rl_GetDeferredShader(void);                                                        // Get G-buffer pass material shader (loaded with first deferred renderer)
+rl_RLAPI rl_Texture2D rl_GetDeferredTexture(const rl_DeferredRenderer *renderer, int index);          // Get G-buffer texture: 0-albedo/specular, 1-normals (octahedral), 2-depth
+rl_RLAPI void rl_UnloadDeferredRenderer(rl_DeferredRenderer *renderer);                              // Unload deferred renderer from memory (RAM and VRAM)
 rl_RLAPI void rl_DrawBillboard(rl_Camera camera, rl_Texture2D texture, rl_Vector3 position, float scale, rl_Color tint);   // Draw a billboard texture
 rl_RLAPI void rl_DrawBillboardRec(rl_Camera camera, rl_Texture2D texture, rl_Rectangle source, rl_Vector3 position, rl_Vector2 size, rl_Color tint); // Draw a billboard texture defined by source
 rl_RLAPI void rl_DrawBillboardPro(rl_Camera camera, rl_Texture2D texture, rl_Rectangle source, rl_Vector3 position, rl_Vector3 up, rl_Vector2 size, rl_Vector2 origin, float rotation, rl_Color tint); // Draw a billboard texture defined by source and rotation
+rl_RLAPI rl_BillboardBatch *rl_LoadBillboardBatch(int capacity);                                     // Load billboard batch, billboards drawn with instancing (quads expanded on GPU)
+rl_RLAPI void rl_UpdateBillboardBatch(rl_BillboardBatch *batch, const rl_BillboardInstance *instances, int count); // Update billboard batch instances (data copied)
+rl_RLAPI void rl_DrawBillboardBatch(rl_BillboardBatch *batch, rl_Camera camera, rl_Texture2D texture, rl_Rectangle source, bool sortByDepth); // Draw billboard batch, optionally sorted back to front (worker threads)
+rl_RLAPI void rl_UnloadBillboardBatch(rl_BillboardBatch *batch);                                     // Unload billboard batch from memory (RAM and VRAM)
 
 // rl_Mesh management functions
 rl_RLAPI void rl_UploadMesh(rl_Mesh *mesh, bool dynamic);                                            // Upload mesh vertex data in GPU and provide VAO/VBO ids
+rl_RLAPI void rl_UploadMeshStreamed(rl_Mesh *mesh, int bufferCount);                                // Upload mesh vertex data in GPU with multiple buffers per attribute, rotated every frame
 rl_RLAPI void rl_UpdateMeshBuffer(rl_Mesh mesh, int index, const void *data, int dataSize, int offset); // Update mesh vertex data in GPU for a specific buffer index
+rl_RLAPI void rl_SetMeshQuantization(unsigned int flags);                                            // Set vertex attributes quantization for next uploaded meshes (rl_MeshQuantization flags)
 rl_RLAPI void rl_UnloadMesh(rl_Mesh mesh);                                                           // Unload mesh data from CPU and GPU
 rl_RLAPI void rl_DrawMesh(rl_Mesh mesh, rl_Material material, rl_Matrix transform);                        // Draw a 3d mesh with material and transform
 rl_RLAPI void rl_DrawMeshInstanced(rl_Mesh mesh, rl_Material material, const rl_Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+rl_RLAPI void rl_DrawMeshInstancedSkinned(rl_Mesh mesh, rl_Material material, const rl_Matrix *transforms, const int *paletteIds, int instances, rl_BonePalette palette); // Draw multiple skinned mesh instances with different transforms and bone palettes
+rl_RLAPI rl_InstanceBuffer rl_LoadInstanceBuffer(const rl_Matrix *transforms, int count, bool dynamic); // Load instance buffer with transforms into GPU memory (transforms can be NULL)
+rl_RLAPI void rl_UpdateInstanceBuffer(rl_InstanceBuffer buffer, const rl_Matrix *transforms, int offset, int count); // Update instance buffer transforms (range)
+rl_RLAPI void rl_UnloadInstanceBuffer(rl_InstanceBuffer buffer);                                    // Unload instance buffer from GPU memory
+rl_RLAPI void rl_DrawMeshInstanceBuffer(rl_Mesh mesh, rl_Material material, rl_InstanceBuffer buffer, int instances); // Draw multiple mesh instances with transforms from instance buffer
+rl_RLAPI rl_MeshInstances rl_LoadMeshInstances(rl_Mesh mesh, const rl_Matrix *transforms, int count); // Load mesh instances transforms into GPU memory (OpenGL 4.3)
+rl_RLAPI void rl_UpdateMeshInstances(rl_MeshInstances instances, const rl_Matrix *transforms, int offset, int count); // Update mesh instances transforms (range)
+rl_RLAPI void rl_UnloadMeshInstances(rl_MeshInstances instances);                                   // Unload mesh instances from GPU memory
+rl_RLAPI void rl_DrawMeshInstancesCulled(rl_Mesh mesh, rl_Material material, rl_MeshInstances instances); // Draw mesh instances visible in current view (GPU frustum culling)
+rl_RLAPI rl_StaticBatch *rl_LoadStaticBatch(float chunkSize);                                        // Load static batch, meshes are merged by material and spatial chunk (0.0f for a single chunk)
+rl_RLAPI int rl_AddStaticBatchMesh(rl_StaticBatch *batch, rl_Mesh mesh, rl_Material material, rl_Matrix transform); // Add mesh to static batch (vertex data copied and transformed), returns piece index
+rl_RLAPI int rl_AddStaticBatchModel(rl_StaticBatch *batch, rl_Model model, rl_Matrix transform);      // Add model meshes to static batch, returns first piece index
+rl_RLAPI void rl_BuildStaticBatch(rl_StaticBatch *batch);                                            // Build static batch, merged meshes are uploaded to GPU
+rl_RLAPI void rl_SetStaticBatchPieceVisible(rl_StaticBatch *batch, int piece, bool visible);          // Set static batch piece visibility
+rl_RLAPI void rl_DrawStaticBatch(rl_StaticBatch *batch);                                             // Draw static batch, one draw per visible chunk and material
+rl_RLAPI void rl_UnloadStaticBatch(rl_StaticBatch *batch);                                           // Unload static batch from memory (RAM and VRAM)
 rl_RLAPI rl_BoundingBox rl_GetMeshBoundingBox(rl_Mesh mesh);                                            // Compute mesh bounding box limits
 rl_RLAPI void rl_GenMeshTangents(rl_Mesh *mesh);                                                     // Compute mesh tangents
+rl_RLAPI void rl_OptimizeMesh(rl_Mesh *mesh);                                                        // Optimize mesh for rendering: weld vertices, reorder triangles (vertex cache, overdraw) and vertices (fetch)
+rl_RLAPI float rl_GetMeshACMR(rl_Mesh mesh);                                                         // Get mesh average cache miss ratio (transformed vertices per triangle)
+rl_RLAPI void rl_GenMeshBVH(rl_Mesh *mesh);                                                          // Generate mesh bounding volume hierarchy (used by mesh collision functions)
+rl_RLAPI void rl_UnloadMeshBVH(rl_Mesh *mesh);                                                       // Unload mesh bounding volume hierarchy
+rl_RLAPI void rl_GenMeshLOD(rl_Mesh *mesh, int levelCount, float reduction);                         // Generate mesh levels of detail (quadric error simplification), selected by projected error on drawing
+rl_RLAPI void rl_UnloadMeshLOD(rl_Mesh *mesh);                                                       // Unload mesh levels of detail
 rl_RLAPI bool rl_ExportMesh(rl_Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 rl_RLAPI bool rl_ExportMeshAsCode(rl_Mesh mesh, const char *fileName);                               // Export mesh as code file (.h) defining multiple arrays of vertex attributes
 
@@ -1618,6 +2522,24 @@ rl_RLAPI rl_Mesh rl_GenMeshKnot(float radius, float size, int radSeg, int sides)
 rl_RLAPI rl_Mesh rl_GenMeshHeightmap(rl_Image heightmap, rl_Vector3 size);                                 // Generate heightmap mesh from image data
 rl_RLAPI rl_Mesh rl_GenMeshCubicmap(rl_Image cubicmap, rl_Vector3 cubeSize);                               // Generate cubes-based map mesh from image data
 
+// rl_Terrain loading/unloading and drawing functions
+rl_RLAPI rl_Terrain *rl_LoadTerrain(rl_Image heightmap, rl_Vector3 size);                            // Load chunked terrain from heightmap image (size: x, z extent and y maximum height)
+rl_RLAPI rl_Terrain *rl_LoadTerrainTiles(const char *fileName, int tilesX, int tilesZ, rl_Vector3 tileSize); // Load streamed terrain from height tiles files (fileName with tile x and z formats)
+rl_RLAPI void rl_UpdateTerrain(rl_Terrain *terrain, rl_Vector3 viewPosition, float viewDistance);    // Update terrain streaming, tiles in view distance loaded and far tiles unloaded
+rl_RLAPI void rl_DrawTerrain(rl_Terrain *terrain, rl_Material material);                             // Draw terrain visible chunks, levels of detail selected by projected error
+rl_RLAPI float rl_GetTerrainHeight(rl_Terrain *terrain, float x, float z);                           // Get terrain height at world position (loaded chunks)
+rl_RLAPI rl_BoundingBox rl_GetTerrainBoundingBox(rl_Terrain *terrain);                               // Get terrain bounding box (loaded chunks)
+rl_RLAPI void rl_UnloadTerrain(rl_Terrain *terrain);                                                 // Unload terrain from memory (RAM and VRAM)
+
+// rl_VoxelWorld loading/unloading, editing and drawing functions
+rl_RLAPI rl_VoxelWorld *rl_LoadVoxelWorld(int chunksX, int chunksY, int chunksZ, float voxelSize);   // Load voxel world (empty), chunks of VOXEL_CHUNK_SIZE voxels per side
+rl_RLAPI void rl_SetVoxel(rl_VoxelWorld *world, int x, int y, int z, unsigned char type);            // Set voxel type (0 for empty), chunks re-meshed on next update
+rl_RLAPI unsigned char rl_GetVoxel(const rl_VoxelWorld *world, int x, int y, int z);                 // Get voxel type (0 for empty or out of world)
+rl_RLAPI void rl_SetVoxelColor(rl_VoxelWorld *world, unsigned char type, rl_Color color);            // Set voxel type color (vertex colors)
+rl_RLAPI int rl_UpdateVoxelWorld(rl_VoxelWorld *world);                                              // Update voxel world, changed chunks re-meshed (worker threads) and uploaded, returns chunks updated
+rl_RLAPI void rl_DrawVoxelWorld(rl_VoxelWorld *world, rl_Material material);                         // Draw voxel world visible chunks
+rl_RLAPI void rl_UnloadVoxelWorld(rl_VoxelWorld *world);                                             // Unload voxel world from memory (RAM and VRAM)
+
 // rl_Material loading/unloading functions
 rl_RLAPI rl_Material *rl_LoadMaterials(const char *fileName, int *materialCount);                    // Load materials from model file
 rl_RLAPI rl_Material rl_LoadMaterialDefault(void);                                                   // Load default material (Supports: DIFFUSE, SPECULAR, NORMAL maps)
@@ -1630,9 +2552,22 @@ rl_RLAPI void rl_SetModelMeshMaterial(rl_Model *model, int meshId, int materialI
 rl_RLAPI rl_ModelAnimation *rl_LoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
 rl_RLAPI void rl_UpdateModelAnimation(rl_Model model, rl_ModelAnimation anim, int frame);               // Update model animation pose (CPU)
 rl_RLAPI void rl_UpdateModelAnimationBones(rl_Model model, rl_ModelAnimation anim, int frame);          // Update model animation mesh bone matrices (GPU skinning)
+rl_RLAPI void rl_SampleModelAnimation(rl_ModelAnimation anim, float frame, rl_Transform *pose);         // Sample model animation pose at fractional frame (interpolated, looping)
+rl_RLAPI void rl_BlendModelPoses(const rl_Transform *poseA, const rl_Transform *poseB, int boneCount, float weight, const float *boneWeights, rl_Transform *result); // Blend model poses, optional per-bone weights for layering
+rl_RLAPI void rl_UpdateModelPose(rl_Model model, const rl_Transform *pose);                             // Update model mesh bone matrices from pose (GPU skinning)
+rl_RLAPI void rl_UpdateModelSkinning(rl_Model model);                                                   // Update model vertex data from mesh bone matrices (CPU skinning)
+rl_RLAPI rl_BonePalette rl_LoadBonePalette(int boneCount, int paletteCount);                           // Load bone palette for many skeleton instances into GPU memory (float texture)
+rl_RLAPI void rl_UpdateBonePalette(rl_BonePalette palette, int index, const rl_Matrix *boneMatrices);  // Update bone palette with bone matrices
+rl_RLAPI void rl_UpdateBonePalettePose(rl_BonePalette palette, int index, rl_Model model, const rl_Transform *pose); // Update bone palette from model pose
+rl_RLAPI void rl_UnloadBonePalette(rl_BonePalette palette);                                             // Unload bone palette from GPU memory
 rl_RLAPI void rl_UnloadModelAnimation(rl_ModelAnimation anim);                                       // Unload animation data
 rl_RLAPI void rl_UnloadModelAnimations(rl_ModelAnimation *animations, int animCount);                // Unload animation array data
 rl_RLAPI bool rl_IsModelAnimationValid(rl_Model model, rl_ModelAnimation anim);                         // Check model animation skeleton match
+rl_RLAPI rl_CompressedAnimation rl_CompressModelAnimation(rl_ModelAnimation anim, float tolerance);     // Compress model animation (keys reduction and quantization)
+rl_RLAPI rl_CompressedAnimation rl_LoadCompressedAnimation(const char *fileName);                      // Load compressed animation from file
+rl_RLAPI bool rl_ExportCompressedAnimation(rl_CompressedAnimation anim, const char *fileName);         // Export compressed animation to file, returns true on success
+rl_RLAPI void rl_UnloadCompressedAnimation(rl_CompressedAnimation anim);                               // Unload compressed animation data
+rl_RLAPI void rl_SampleCompressedAnimation(rl_CompressedAnimation anim, float frame, rl_Transform *pose); // Sample compressed animation pose at fractional frame (interpolated, looping)
 
 // Collision detection functions
 rl_RLAPI bool rl_CheckCollisionSpheres(rl_Vector3 center1, float radius1, rl_Vector3 center2, float radius2); // Check collision between two spheres
@@ -1641,20 +2576,37 @@ rl_RLAPI bool rl_CheckCollisionBoxSphere(rl_BoundingBox box, rl_Vector3 center,
 rl_RLAPI rl_RayCollision rl_GetRayCollisionSphere(rl_Ray ray, rl_Vector3 center, float radius);            // Get collision info between ray and sphere
 rl_RLAPI rl_RayCollision rl_GetRayCollisionBox(rl_Ray ray, rl_BoundingBox box);                            // Get collision info between ray and box
 rl_RLAPI rl_RayCollision rl_GetRayCollisionMesh(rl_Ray ray, rl_Mesh mesh, rl_Matrix transform);               // Get collision info between ray and mesh
+rl_RLAPI void rl_GetRayCollisionMeshBatch(const rl_Ray *rays, int count, rl_Mesh mesh, rl_Matrix transform, rl_RayCollision *collisions); // Get collision info between rays and mesh (multithreaded)
+rl_RLAPI void rl_GetRayCollisionBoxBatch(const rl_Ray *rays, int count, rl_BoundingBox box, rl_RayCollision *collisions); // Get collision info between rays and box (multithreaded)
+rl_RLAPI bool rl_CheckCollisionMeshSphere(rl_Mesh mesh, rl_Matrix transform, rl_Vector3 center, float radius); // Check collision between mesh and sphere
+rl_RLAPI bool rl_CheckCollisionMeshBox(rl_Mesh mesh, rl_Matrix transform, rl_BoundingBox box);          // Check collision between mesh and box
 rl_RLAPI rl_RayCollision rl_GetRayCollisionTriangle(rl_Ray ray, rl_Vector3 p1, rl_Vector3 p2, rl_Vector3 p3);    // Get collision info between ray and triangle
 rl_RLAPI rl_RayCollision rl_GetRayCollisionQuad(rl_Ray ray, rl_Vector3 p1, rl_Vector3 p2, rl_Vector3 p3, rl_Vector3 p4); // Get collision info between ray and quad
 
 //------------------------------------------------------------------------------------
 // Audio Loading and Playing Functions (Module: audio)
+// WARNING: Not thread-safe, all audio functions must be called from the same program thread
 //------------------------------------------------------------------------------------
 typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
 
 // Audio device management functions
 rl_RLAPI void rl_InitAudioDevice(void);                                     // Initialize audio device and context
+rl_RLAPI void rl_InitAudioDeviceEx(int periodSize, int periods, bool lowLatency); // Initialize audio device with period size (in frames) and periods requested (0: default), low latency requests exclusive mode
 rl_RLAPI void rl_CloseAudioDevice(void);                                    // Close the audio device and context
 rl_RLAPI bool rl_IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 rl_RLAPI void rl_SetMasterVolume(float volume);                             // Set master volume (listener)
 rl_RLAPI float rl_GetMasterVolume(void);                                    // Get master volume (listener)
+rl_RLAPI double rl_GetAudioTime(void);                                      // Get audio device time (in seconds), audio mixed since device initialization
+rl_RLAPI void rl_SetAudioVoicesMax(int count);                              // Set maximum number of sounds mixed at once, excess sounds are virtual (0: no limit)
+rl_RLAPI rl_AudioVoiceStats rl_GetAudioVoiceStats(void);                    // Get audio voices stats (real vs virtual voices and mixing cost)
+rl_RLAPI rl_AudioLatencyStats rl_GetAudioLatencyStats(void);                // Get audio device latency and callback timing jitter stats
+rl_RLAPI rl_AudioProfileStats rl_GetAudioProfileStats(void);                // Get audio callback profiling stats (callback cost, buffers, underruns and waits)
+rl_RLAPI rl_MemoryStats rl_GetAudioMemoryStats(void);                       // Get audio buffers memory stats (sounds, aliases and streams data)
+rl_RLAPI void rl_ResetAudioProfileStats(void);                              // Reset audio profiling stats maximums and counters
+rl_RLAPI void rl_SetAudioResamplerQuality(int quality);                     // Set resampler quality for sounds and streams loaded afterwards (rl_AudioResamplerQuality)
+rl_RLAPI void rl_SetAudioListener(rl_Vector3 position, rl_Vector3 target, rl_Vector3 up); // Set audio listener position and orientation, spatial sounds are relative to listener
+rl_RLAPI void rl_SetAudioListenerVelocity(rl_Vector3 velocity);             // Set audio listener velocity, used for doppler effect
+rl_RLAPI void rl_SetAudioDoppler(float factor, float speedOfSound);         // Set doppler effect factor (0.0 disabled) and speed of sound (in world units per second)
 
 // rl_Wave/rl_Sound loading/unloading functions
 rl_RLAPI rl_Wave rl_LoadWave(const char *fileName);                            // Load wave data from file
@@ -1673,6 +2625,7 @@ rl_RLAPI bool rl_ExportWaveAsCode(rl_Wave wave, const char *fileName);         /
 
 // rl_Wave/rl_Sound management functions
 rl_RLAPI void rl_PlaySound(rl_Sound sound);                                    // Play a sound
+rl_RLAPI void rl_PlaySoundScheduled(rl_Sound sound, double time);              // Play a sound at audio device time (in seconds), sample accurate
 rl_RLAPI void rl_StopSound(rl_Sound sound);                                    // Stop playing a sound
 rl_RLAPI void rl_PauseSound(rl_Sound sound);                                   // Pause a sound
 rl_RLAPI void rl_ResumeSound(rl_Sound sound);                                  // Resume a paused sound
@@ -1680,20 +2633,31 @@ rl_RLAPI bool rl_IsSoundPlaying(rl_Sound sound);                               /
 rl_RLAPI void rl_SetSoundVolume(rl_Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 rl_RLAPI void rl_SetSoundPitch(rl_Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 rl_RLAPI void rl_SetSoundPan(rl_Sound sound, float pan);                       // Set pan for a sound (-1.0 left, 0.0 center, 1.0 right)
+rl_RLAPI void rl_SetSoundPriority(rl_Sound sound, int priority);               // Set priority for a sound, higher priority sounds are mixed first when voices are limited
+rl_RLAPI void rl_SetSoundDistance(rl_Sound sound, float distance);             // Set distance to listener for a sound, closer sounds are mixed first when voices are limited
+rl_RLAPI void rl_SetSoundPosition(rl_Sound sound, rl_Vector3 position);        // Set position for a sound, sound is spatialized relative to audio listener
+rl_RLAPI void rl_SetSoundVelocity(rl_Sound sound, rl_Vector3 velocity);        // Set velocity for a spatial sound, used for doppler effect
+rl_RLAPI void rl_SetSoundAttenuation(rl_Sound sound, int model, float minDistance, float maxDistance, float rolloff); // Set distance attenuation for a spatial sound (rl_AudioAttenuation)
+rl_RLAPI void rl_SetSoundCone(rl_Sound sound, rl_Vector3 direction, float innerAngle, float outerAngle, float outerVolume); // Set directional cone for a spatial sound (angles in degrees)
 rl_RLAPI rl_Wave rl_WaveCopy(rl_Wave wave);                                       // Copy a wave to a new wave
 rl_RLAPI void rl_WaveCrop(rl_Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range
 rl_RLAPI void rl_WaveFormat(rl_Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
+rl_RLAPI void rl_WaveNormalize(rl_Wave *wave, float peak);                     // Normalize wave samples to peak level [0.0f..1.0f], in place
+rl_RLAPI void rl_WaveTrimSilence(rl_Wave *wave, float threshold);              // Trim wave silence under level at start and end, in place
+rl_RLAPI rl_WaveProcessingStats rl_ProcessWaves(rl_Wave *waves, int count, rl_WaveProcessing processing); // Process waves batch in parallel (trim, normalize, format)
 rl_RLAPI float *rl_LoadWaveSamples(rl_Wave wave);                              // Load samples data from wave as a 32bit float data array
 rl_RLAPI void rl_UnloadWaveSamples(float *samples);                         // Unload samples data loaded with rl_LoadWaveSamples()
 
 // rl_Music management functions
 rl_RLAPI rl_Music rl_LoadMusicStream(const char *fileName);                    // Load music stream from file
-rl_RLAPI rl_Music rl_LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data, int dataSize); // Load music stream from data
+rl_RLAPI rl_Music rl_LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data, int dataSize); // Load music stream from data (not copied, i.e. memory-mapped file region)
+rl_RLAPI rl_Music rl_LoadMusicStreamFromReader(const char *fileType, rl_AudioReader reader); // Load music stream from reader callbacks, data read while streaming
 rl_RLAPI bool rl_IsMusicValid(rl_Music music);                                 // Checks if a music stream is valid (context and buffers initialized)
 rl_RLAPI void rl_UnloadMusicStream(rl_Music music);                            // Unload music stream
 rl_RLAPI void rl_PlayMusicStream(rl_Music music);                              // Start music playing
 rl_RLAPI bool rl_IsMusicStreamPlaying(rl_Music music);                         // Check if music is playing
 rl_RLAPI void rl_UpdateMusicStream(rl_Music music);                            // Updates buffers for music streaming
+rl_RLAPI void rl_SetMusicStreamThreaded(rl_Music music, bool threaded);        // Set music decoding on decoder thread, rl_UpdateMusicStream() not required
 rl_RLAPI void rl_StopMusicStream(rl_Music music);                              // Stop music playing
 rl_RLAPI void rl_PauseMusicStream(rl_Music music);                             // Pause music playing
 rl_RLAPI void rl_ResumeMusicStream(rl_Music music);                            // Resume playing paused music
@@ -1706,10 +2670,14 @@ rl_RLAPI float rl_GetMusicTimePlayed(rl_Music music);                          /
 
 // rl_AudioStream management functions
 rl_RLAPI rl_AudioStream rl_LoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Load audio stream (to stream raw audio pcm data)
+rl_RLAPI rl_AudioStream rl_LoadAudioStreamRing(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels, unsigned int sizeInFrames); // Load audio stream with lock-free ring buffer, frames written in place
 rl_RLAPI bool rl_IsAudioStreamValid(rl_AudioStream stream);                    // Checks if an audio stream is valid (buffers initialized)
 rl_RLAPI void rl_UnloadAudioStream(rl_AudioStream stream);                     // Unload audio stream and free memory
 rl_RLAPI void rl_UpdateAudioStream(rl_AudioStream stream, const void *data, int frameCount); // Update audio stream buffers with data
 rl_RLAPI bool rl_IsAudioStreamProcessed(rl_AudioStream stream);                // Check if any audio stream buffers requires refill
+rl_RLAPI void *rl_BeginAudioStreamWrite(rl_AudioStream stream, int *frameCount); // Begin ring audio stream write, returns frames pointer, frameCount set to contiguous frames writable (0: all)
+rl_RLAPI void rl_EndAudioStreamWrite(rl_AudioStream stream, int frameCount);   // End ring audio stream write, commit frames written to be played
+rl_RLAPI int rl_GetAudioStreamQueuedFrames(rl_AudioStream stream);             // Get ring audio stream frames written and not yet played
 rl_RLAPI void rl_PlayAudioStream(rl_AudioStream stream);                       // Play audio stream
 rl_RLAPI void rl_PauseAudioStream(rl_AudioStream stream);                      // Pause audio stream
 rl_RLAPI void rl_ResumeAudioStream(rl_AudioStream stream);                     // Resume audio stream
@@ -1727,6 +2695,20 @@ rl_RLAPI void rl_DetachAudioStreamProcessor(rl_AudioStream stream, AudioCallback
 rl_RLAPI void rl_AttachAudioMixedProcessor(AudioCallback processor); // Attach audio stream processor to the entire audio pipeline, receives frames x 2 samples as 'float' (stereo)
 rl_RLAPI void rl_DetachAudioMixedProcessor(AudioCallback processor); // Detach audio stream processor from the entire audio pipeline
 
+// rl_AudioBus management functions
+rl_RLAPI rl_AudioBus rl_LoadAudioBus(void);                                 // Load audio bus (submix), routed to master output
+rl_RLAPI bool rl_IsAudioBusValid(rl_AudioBus bus);                          // Checks if an audio bus is valid
+rl_RLAPI void rl_UnloadAudioBus(rl_AudioBus bus);                           // Unload audio bus, sounds and buses routed to it are routed to its output
+rl_RLAPI void rl_SetAudioBusOutput(rl_AudioBus bus, rl_AudioBus output);    // Set audio bus output, another bus or master output ({ 0 })
+rl_RLAPI void rl_SetAudioBusVolume(rl_AudioBus bus, float volume);          // Set volume for an audio bus (1.0 is base level)
+rl_RLAPI void rl_SetAudioBusFilter(rl_AudioBus bus, int type, float frequency, float resonance); // Set audio bus filter (rl_AudioFilter), frequency in Hz and resonance (Q)
+rl_RLAPI void rl_SetAudioBusCompressor(rl_AudioBus bus, float threshold, float ratio, float attack, float release); // Set audio bus compressor, threshold in dB, times in ms (ratio 1.0 disabled)
+rl_RLAPI void rl_SetAudioBusReverb(rl_AudioBus bus, float roomSize, float damping, float mix); // Set audio bus reverb, parameters in [0..1] range (mix 0.0 disabled)
+rl_RLAPI float rl_GetAudioBusMixTime(rl_AudioBus bus);                      // Get audio bus processing time on last audio callback (in milliseconds)
+rl_RLAPI void rl_SetAudioStreamBus(rl_AudioStream stream, rl_AudioBus bus); // Set audio bus for an audio stream, master output by default ({ 0 })
+rl_RLAPI void rl_SetSoundBus(rl_Sound sound, rl_AudioBus bus);              // Set audio bus for a sound
+rl_RLAPI void rl_SetMusicBus(rl_Music music, rl_AudioBus bus);              // Set audio bus for a music
+
 #if defined(__cplusplus)
 }
 #endif
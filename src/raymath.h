@@ -11,7 +11,8 @@
 *       Example: In memory order, row0 is [m0 m4 m8 m12] but in semantic math row0 is [m0 m1 m2 m3]
 *     - Functions are always self-contained, no function use another raymath function inside,
 *       required code is directly re-implemented inside
-*     - Functions input parameters are always received by value (2 unavoidable exceptions)
+*     - Functions input parameters are always received by value (2 unavoidable exceptions,
+*       and batch functions working on arrays)
 *     - Functions use always a "result" variable for return (except C++ operators)
 *     - Functions are always defined inline
 *     - Angles are always in radians (rl_DEG2RAD/rl_RAD2DEG macros provided for convenience)
@@ -31,9 +32,18 @@
 *           Disables C++ operator overloads for raymath types.
 *
 *       #define RAYMATH_USE_SIMD_INTRINSICS
-*           Try to enable SIMD intrinsics for MatrixMultiply()
+*           Try to enable SIMD intrinsics for MatrixMultiply(), MatrixInvert(), Vector3Transform(),
+*           QuaternionToMatrix(), rl_Frustum checks and batch functions
 *           Note that users enabling it must be aware of the target platform where application will
-*           run to support the selected SIMD intrinsic, for now, only SSE is supported
+*           run to support the selected SIMD intrinsic, SSE, AVX and NEON are supported
+*           NOTE: AVX is used by MatrixMultiply() and batch functions, rl_Frustum checks are SSE only
+*
+*       #define RAYMATH_FAST_MATH
+*           Use approximations on hot functions instead of sqrtf(), sinf(), cosf() and acosf() calls:
+*           normalizations use FastInvSqrt(), rotations use FastSin()/FastCos() polynomials and
+*           QuaternionSlerp() is computed as nlerp with corrected interpolation amount
+*           Maximum errors: FastInvSqrt() 5e-6 relative (3e-7 with SIMD intrinsics enabled),
+*           FastSin()/FastCos() 1e-7 absolute for angles in [-2*PI, 2*PI], QuaternionSlerp() 5e-4 absolute
 *
 *   LICENSE: zlib/libpng
 *
@@ -163,6 +173,25 @@ typedef struct rl_Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
+#if !defined(RL_FRUSTUM_TYPE)
+// rl_Frustum type, view volume planes (normalized, pointing inwards)
+typedef struct rl_Frustum {
+    rl_Vector4 planes[6];       // Planes: left, right, bottom, top, near, far (xyz: normal, w: distance)
+} rl_Frustum;
+#define RL_FRUSTUM_TYPE
+#endif
+
+#if !defined(RL_MATRIX3X4_TYPE)
+// rl_Matrix3x4 type, affine transform (rl_Matrix without fourth row, implicitly [0 0 0 1])
+// NOTE: Same memory layout as rl_Matrix first three rows, translation in m12, m13, m14
+typedef struct rl_Matrix3x4 {
+    float m0, m4, m8, m12;      // rl_Matrix3x4 first row (4 components)
+    float m1, m5, m9, m13;      // rl_Matrix3x4 second row (4 components)
+    float m2, m6, m10, m14;     // rl_Matrix3x4 third row (4 components)
+} rl_Matrix3x4;
+#define RL_MATRIX3X4_TYPE
+#endif
+
 // NOTE: Helper types to be used instead of array return types for *ToFloat functions
 typedef struct rl_float3 {
     float v[3];
@@ -173,12 +202,13 @@ typedef struct rl_float16 {
 } rl_float16;
 
 #include <math.h>       // Required for: sinf(), cosf(), tan(), atan2f(), sqrtf(), floor(), fminf(), fmaxf(), fabsf()
+#include <stddef.h>     // Required for: NULL
 
 #if defined(RAYMATH_USE_SIMD_INTRINSICS)
-    // SIMD is used on the most costly raymath function MatrixMultiply()
-    // NOTE: Only SSE intrinsics support implemented
+    // SIMD is used on the most costly raymath functions: matrix and quaternion core and batch functions
+    // NOTE: SSE, AVX and NEON intrinsics support implemented, results match the scalar code
     // TODO: Consider support for other SIMD instrinsics:
-    //  - SSEx, AVX, AVX2, FMA, NEON, RVV
+    //  - SSEx, AVX2, FMA, RVV
     /*
     #if defined(__SSE4_2__)
         #include <nmmintrin.h>
@@ -200,6 +230,15 @@ typedef struct rl_float16 {
     #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
         #include <xmmintrin.h>
         #define RAYMATH_SSE_ENABLED
+
+        // NOTE: AVX extends SSE support, SSE code paths remain enabled
+        #if defined(__AVX__)
+            #include <immintrin.h>
+            #define RAYMATH_AVX_ENABLED
+        #endif
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+        #include <arm_neon.h>
+        #define RAYMATH_NEON_ENABLED
     #endif
 #endif
 
@@ -261,6 +300,93 @@ rl_RMAPI int FloatEquals(float x, float y)
     return result;
 }
 
+// Get approximated inverse square root, 1.0f/sqrtf(value)
+// NOTE: Initial estimate refined with Newton-Raphson steps, relative error below 5e-6,
+// below 3e-7 with SIMD intrinsics enabled, value must be greater than 0.0f
+rl_RMAPI float FastInvSqrt(float value)
+{
+    float result = 0.0f;
+
+#if defined(RAYMATH_SSE_ENABLED)
+    // SSE estimate (12 bits) refined with one step
+    float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+    result = estimate*(1.5f - 0.5f*value*estimate*estimate);
+#elif defined(RAYMATH_NEON_ENABLED)
+    // NEON estimate (8 bits) refined with two steps
+    float32x2_t v = vdup_n_f32(value);
+    float32x2_t estimate = vrsqrte_f32(v);
+    estimate = vmul_f32(estimate, vrsqrts_f32(vmul_f32(v, estimate), estimate));
+    estimate = vmul_f32(estimate, vrsqrts_f32(vmul_f32(v, estimate), estimate));
+    result = vget_lane_f32(estimate, 0);
+#else
+    // Bits estimate (exponent halved) refined with two steps
+    union { float f; unsigned int i; } bits = { value };
+    bits.i = 0x5f375a86 - (bits.i >> 1);
+    result = bits.f;
+    result = result*(1.5f - 0.5f*value*result*result);
+    result = result*(1.5f - 0.5f*value*result*result);
+#endif
+
+    return result;
+}
+
+// Get approximated sine of angle (radians)
+// NOTE: Reduced to [-PI/4, PI/4] and evaluated with minimax polynomials, absolute error below 1e-7
+// for angles in [-2*PI, 2*PI], precision degrades slowly with larger angles (up to +/-8192)
+rl_RMAPI float FastSin(float angle)
+{
+    float result = 0.0f;
+
+    float x = fabsf(angle);
+    int octant = (int)(x*1.27323954473516f);  // 4/PI
+    octant = (octant + 1) & ~1;
+    float y = (float)octant;
+
+    // Extended precision reduction, x - y*PI/4
+    x = ((x - y*0.78515625f) - y*2.4187564849853515625e-4f) - y*3.77489497744594108e-8f;
+    float z = x*x;
+
+    float sinres = ((-1.9515295891e-4f*z + 8.3321608736e-3f)*z - 1.6666654611e-1f)*z*x + x;
+    float cosres = ((2.443315711809948e-5f*z - 1.388731625493765e-3f)*z + 4.166664568298827e-2f)*z*z - 0.5f*z + 1.0f;
+
+    // Quadrant selects polynomial and sign, bits masking avoids mispredicted branches
+    union { float f; unsigned int i; } sinbits = { sinres }, cosbits = { cosres }, bits = { angle };
+    unsigned int quadrant = (unsigned int)(octant >> 1);
+    unsigned int mask = 0u - (quadrant & 1u);
+    bits.i = ((sinbits.i & ~mask) | (cosbits.i & mask)) ^ (((quadrant << 30) ^ bits.i) & 0x80000000u);
+    result = bits.f;
+
+    return result;
+}
+
+// Get approximated cosine of angle (radians)
+// NOTE: Same reduction and polynomials than FastSin(), same error bounds
+rl_RMAPI float FastCos(float angle)
+{
+    float result = 0.0f;
+
+    float x = fabsf(angle);
+    int octant = (int)(x*1.27323954473516f);  // 4/PI
+    octant = (octant + 1) & ~1;
+    float y = (float)octant;
+
+    // Extended precision reduction, x - y*PI/4
+    x = ((x - y*0.78515625f) - y*2.4187564849853515625e-4f) - y*3.77489497744594108e-8f;
+    float z = x*x;
+
+    float sinres = ((-1.9515295891e-4f*z + 8.3321608736e-3f)*z - 1.6666654611e-1f)*z*x + x;
+    float cosres = ((2.443315711809948e-5f*z - 1.388731625493765e-3f)*z + 4.166664568298827e-2f)*z*z - 0.5f*z + 1.0f;
+
+    // Quadrant selects polynomial and sign, bits masking avoids mispredicted branches
+    union { float f; unsigned int i; } sinbits = { sinres }, cosbits = { cosres }, bits = { 0.0f };
+    unsigned int quadrant = (unsigned int)(octant >> 1) + 1u;
+    unsigned int mask = 0u - (quadrant & 1u);
+    bits.i = ((sinbits.i & ~mask) | (cosbits.i & mask)) ^ ((quadrant << 30) & 0x80000000u);
+    result = bits.f;
+
+    return result;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - rl_Vector2 math
 //----------------------------------------------------------------------------------
@@ -425,11 +551,19 @@ rl_RMAPI rl_Vector2 Vector2Divide(rl_Vector2 v1, rl_Vector2 v2)
 rl_RMAPI rl_Vector2 Vector2Normalize(rl_Vector2 v)
 {
     rl_Vector2 result = { 0 };
+#if defined(RAYMATH_FAST_MATH)
+    float length = (v.x*v.x) + (v.y*v.y);
+
+    if (length > 0)
+    {
+        float ilength = FastInvSqrt(length);
+#else
     float length = sqrtf((v.x*v.x) + (v.y*v.y));
 
     if (length > 0)
     {
         float ilength = 1.0f/length;
+#endif
         result.x = v.x*ilength;
         result.y = v.y*ilength;
     }
@@ -503,8 +637,13 @@ rl_RMAPI rl_Vector2 Vector2Rotate(rl_Vector2 v, float angle)
 {
     rl_Vector2 result = { 0 };
 
+#if defined(RAYMATH_FAST_MATH)
+    float cosres = FastCos(angle);
+    float sinres = FastSin(angle);
+#else
     float cosres = cosf(angle);
     float sinres = sinf(angle);
+#endif
 
     result.x = v.x*cosres - v.y*sinres;
     result.y = v.x*sinres + v.y*cosres;
@@ -805,10 +944,17 @@ rl_RMAPI rl_Vector3 Vector3Normalize(rl_Vector3 v)
 {
     rl_Vector3 result = v;
 
+#if defined(RAYMATH_FAST_MATH)
+    float length = v.x*v.x + v.y*v.y + v.z*v.z;
+    if (length != 0.0f)
+    {
+        float ilength = FastInvSqrt(length);
+#else
     float length = sqrtf(v.x*v.x + v.y*v.y + v.z*v.z);
     if (length != 0.0f)
     {
         float ilength = 1.0f/length;
+#endif
 
         result.x *= ilength;
         result.y *= ilength;
@@ -896,9 +1042,43 @@ rl_RMAPI rl_Vector3 Vector3Transform(rl_Vector3 v, rl_Matrix mat)
     float y = v.y;
     float z = v.z;
 
+#if defined(RAYMATH_SSE_ENABLED)
+    // rl_Matrix rows in memory (m0, m4, m8, m12) transposed to columns (m0, m1, m2, m3)
+    __m128 c0 = _mm_loadu_ps(&mat.m0);
+    __m128 c1 = _mm_loadu_ps(&mat.m1);
+    __m128 c2 = _mm_loadu_ps(&mat.m2);
+    __m128 c3 = _mm_loadu_ps(&mat.m3);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    float tmp[4] = { 0 };
+    __m128 col = _mm_mul_ps(c0, _mm_set1_ps(x));
+    col = _mm_add_ps(col, _mm_mul_ps(c1, _mm_set1_ps(y)));
+    col = _mm_add_ps(col, _mm_mul_ps(c2, _mm_set1_ps(z)));
+    col = _mm_add_ps(col, c3);
+    _mm_storeu_ps(tmp, col);
+
+    result.x = tmp[0];
+    result.y = tmp[1];
+    result.z = tmp[2];
+#elif defined(RAYMATH_NEON_ENABLED)
+    // De-interleaved load, rl_Matrix rows in memory (m0, m4, m8, m12) become columns (m0, m1, m2, m3)
+    float32x4x4_t c = vld4q_f32(&mat.m0);
+
+    float tmp[4] = { 0 };
+    float32x4_t col = vmulq_n_f32(c.val[0], x);
+    col = vaddq_f32(col, vmulq_n_f32(c.val[1], y));
+    col = vaddq_f32(col, vmulq_n_f32(c.val[2], z));
+    col = vaddq_f32(col, c.val[3]);
+    vst1q_f32(tmp, col);
+
+    result.x = tmp[0];
+    result.y = tmp[1];
+    result.z = tmp[2];
+#else
     result.x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
     result.y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
     result.z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+#endif
 
     return result;
 }
@@ -1395,11 +1575,19 @@ rl_RMAPI rl_Vector4 Vector4Divide(rl_Vector4 v1, rl_Vector4 v2)
 rl_RMAPI rl_Vector4 Vector4Normalize(rl_Vector4 v)
 {
     rl_Vector4 result = { 0 };
+#if defined(RAYMATH_FAST_MATH)
+    float length = (v.x*v.x) + (v.y*v.y) + (v.z*v.z) + (v.w*v.w);
+
+    if (length > 0)
+    {
+        float ilength = FastInvSqrt(length);
+#else
     float length = sqrtf((v.x*v.x) + (v.y*v.y) + (v.z*v.z) + (v.w*v.w));
 
     if (length > 0)
     {
         float ilength = 1.0f/length;
+#endif
         result.x = v.x*ilength;
         result.y = v.y*ilength;
         result.z = v.z*ilength;
@@ -1594,6 +1782,75 @@ rl_RMAPI rl_Matrix MatrixInvert(rl_Matrix mat)
     // Calculate the invert determinant (inlined to avoid double-caching)
     float invDet = 1.0f/(b00*b11 - b01*b10 + b02*b09 + b03*b08 - b04*b07 + b05*b06);
 
+#if defined(RAYMATH_SSE_ENABLED)
+    // Cofactors of a result row computed at once, one result column per lane:
+    // rN lanes are (a1N, a0N, a3N, a2N) and pN lanes are pairs of the 2x2 minors
+    __m128 r0 = _mm_loadu_ps(&mat.m0);
+    __m128 r1 = _mm_loadu_ps(&mat.m1);
+    __m128 r2 = _mm_loadu_ps(&mat.m2);
+    __m128 r3 = _mm_loadu_ps(&mat.m3);
+    r0 = _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(2, 3, 0, 1));
+    r1 = _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(2, 3, 0, 1));
+    r2 = _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(2, 3, 0, 1));
+    r3 = _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(2, 3, 0, 1));
+
+    __m128 p0 = _mm_set_ps(b05, b05, b11, b11);
+    __m128 p1 = _mm_set_ps(b04, b04, b10, b10);
+    __m128 p2 = _mm_set_ps(b03, b03, b09, b09);
+    __m128 p3 = _mm_set_ps(b02, b02, b08, b08);
+    __m128 p4 = _mm_set_ps(b01, b01, b07, b07);
+    __m128 p5 = _mm_set_ps(b00, b00, b06, b06);
+
+    __m128 signOdd = _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+    __m128 signEven = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+    __m128 det = _mm_set1_ps(invDet);
+
+    __m128 c0 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(r1, p0), _mm_mul_ps(r2, p1)), _mm_mul_ps(r3, p2));
+    __m128 c1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(r0, p0), _mm_mul_ps(r2, p3)), _mm_mul_ps(r3, p4));
+    __m128 c2 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(r0, p1), _mm_mul_ps(r1, p3)), _mm_mul_ps(r3, p5));
+    __m128 c3 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(r0, p2), _mm_mul_ps(r1, p4)), _mm_mul_ps(r2, p5));
+    c0 = _mm_mul_ps(_mm_xor_ps(c0, signOdd), det);
+    c1 = _mm_mul_ps(_mm_xor_ps(c1, signEven), det);
+    c2 = _mm_mul_ps(_mm_xor_ps(c2, signOdd), det);
+    c3 = _mm_mul_ps(_mm_xor_ps(c3, signEven), det);
+
+    // Result rows (m0, m1, m2, m3) transposed back to memory layout (m0, m4, m8, m12)
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    _mm_storeu_ps(&result.m0, c0);
+    _mm_storeu_ps(&result.m1, c1);
+    _mm_storeu_ps(&result.m2, c2);
+    _mm_storeu_ps(&result.m3, c3);
+#elif defined(RAYMATH_NEON_ENABLED)
+    // Cofactors of a result row computed at once, same lanes layout than SSE path
+    float32x4_t r0 = vrev64q_f32(vld1q_f32(&mat.m0));
+    float32x4_t r1 = vrev64q_f32(vld1q_f32(&mat.m1));
+    float32x4_t r2 = vrev64q_f32(vld1q_f32(&mat.m2));
+    float32x4_t r3 = vrev64q_f32(vld1q_f32(&mat.m3));
+
+    float32x4_t p0 = vcombine_f32(vdup_n_f32(b11), vdup_n_f32(b05));
+    float32x4_t p1 = vcombine_f32(vdup_n_f32(b10), vdup_n_f32(b04));
+    float32x4_t p2 = vcombine_f32(vdup_n_f32(b09), vdup_n_f32(b03));
+    float32x4_t p3 = vcombine_f32(vdup_n_f32(b08), vdup_n_f32(b02));
+    float32x4_t p4 = vcombine_f32(vdup_n_f32(b07), vdup_n_f32(b01));
+    float32x4_t p5 = vcombine_f32(vdup_n_f32(b06), vdup_n_f32(b00));
+
+    const float signOddValues[4] = { invDet, -invDet, invDet, -invDet };
+    float32x4_t signOdd = vld1q_f32(signOddValues);
+    float32x4_t signEven = vnegq_f32(signOdd);
+
+    float32x4x4_t c;
+    c.val[0] = vaddq_f32(vsubq_f32(vmulq_f32(r1, p0), vmulq_f32(r2, p1)), vmulq_f32(r3, p2));
+    c.val[1] = vaddq_f32(vsubq_f32(vmulq_f32(r0, p0), vmulq_f32(r2, p3)), vmulq_f32(r3, p4));
+    c.val[2] = vaddq_f32(vsubq_f32(vmulq_f32(r0, p1), vmulq_f32(r1, p3)), vmulq_f32(r3, p5));
+    c.val[3] = vaddq_f32(vsubq_f32(vmulq_f32(r0, p2), vmulq_f32(r1, p4)), vmulq_f32(r2, p5));
+    c.val[0] = vmulq_f32(c.val[0], signOdd);
+    c.val[1] = vmulq_f32(c.val[1], signEven);
+    c.val[2] = vmulq_f32(c.val[2], signOdd);
+    c.val[3] = vmulq_f32(c.val[3], signEven);
+
+    // Interleaved store, result rows (m0, m1, m2, m3) back to memory layout (m0, m4, m8, m12)
+    vst4q_f32(&result.m0, c);
+#else
     result.m0 = (a11*b11 - a12*b10 + a13*b09)*invDet;
     result.m1 = (-a01*b11 + a02*b10 - a03*b09)*invDet;
     result.m2 = (a31*b05 - a32*b04 + a33*b03)*invDet;
@@ -1610,6 +1867,7 @@ rl_RMAPI rl_Matrix MatrixInvert(rl_Matrix mat)
     result.m13 = (a00*b09 - a01*b07 + a02*b06)*invDet;
     result.m14 = (-a30*b03 + a31*b01 - a32*b00)*invDet;
     result.m15 = (a20*b03 - a21*b01 + a22*b00)*invDet;
+#endif
 
     return result;
 }
@@ -1691,6 +1949,46 @@ rl_RMAPI rl_Matrix MatrixMultiply(rl_Matrix left, rl_Matrix right)
     // Transpose so c0..c3 become *rows* of the right matrix in semantic order
     _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
 
+#if defined(RAYMATH_AVX_ENABLED)
+    // Two result rows per operation, right matrix rows duplicated in both 128-bit halves
+    __m256 d0 = _mm256_insertf128_ps(_mm256_castps128_ps256(c0), c0, 1);
+    __m256 d1 = _mm256_insertf128_ps(_mm256_castps128_ps256(c1), c1, 1);
+    __m256 d2 = _mm256_insertf128_ps(_mm256_castps128_ps256(c2), c2, 1);
+    __m256 d3 = _mm256_insertf128_ps(_mm256_castps128_ps256(c3), c3, 1);
+
+    float tmp[8] = { 0 };
+    __m256 rows;
+
+    // Rows 0 and 1 of result: [m0, m1, m2, m3], [m4, m5, m6, m7]
+    rows = _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(left.m0), _mm_set1_ps(left.m4), 1), d0);
+    rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(left.m1), _mm_set1_ps(left.m5), 1), d1));
+    rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(left.m2), _mm_set1_ps(left.m6), 1), d2));
+    rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(left.m3), _mm_set1_ps(left.m7), 1), d3));
+    _mm256_storeu_ps(tmp, rows);
+    result.m0 = tmp[0];
+    result.m1 = tmp[1];
+    result.m2 = tmp[2];
+    result.m3 = tmp[3];
+    result.m4 = tmp[4];
+    result.m5 = tmp[5];
+    result.m6 = tmp[6];
+    result.m7 = tmp[7];
+
+    // Rows 2 and 3 of result: [m8, m9, m10, m11], [m12, m13, m14, m15]
+    rows = _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(left.m8), _mm_set1_ps(left.m12), 1), d0);
+    rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(left.m9), _mm_set1_ps(left.m13), 1), d1));
+    rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(left.m10), _mm_set1_ps(left.m14), 1), d2));
+    rows = _mm256_add_ps(rows, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(left.m11), _mm_set1_ps(left.m15), 1), d3));
+    _mm256_storeu_ps(tmp, rows);
+    result.m8 = tmp[0];
+    result.m9 = tmp[1];
+    result.m10 = tmp[2];
+    result.m11 = tmp[3];
+    result.m12 = tmp[4];
+    result.m13 = tmp[5];
+    result.m14 = tmp[6];
+    result.m15 = tmp[7];
+#else
     float tmp[4] = { 0 };
     __m128 row;
     
@@ -1737,6 +2035,35 @@ rl_RMAPI rl_Matrix MatrixMultiply(rl_Matrix left, rl_Matrix right)
     result.m13 = tmp[1];
     result.m14 = tmp[2];
     result.m15 = tmp[3];
+#endif
+#elif defined(RAYMATH_NEON_ENABLED)
+    // De-interleaved load, right matrix memory rows become rows in semantic order
+    float32x4x4_t c = vld4q_f32(&right.m0);
+    float32x4x4_t rows;
+
+    // Result rows: [m0, m1, m2, m3], [m4, m5, m6, m7], [m8, m9, m10, m11], [m12, m13, m14, m15]
+    rows.val[0] = vmulq_n_f32(c.val[0], left.m0);
+    rows.val[0] = vaddq_f32(rows.val[0], vmulq_n_f32(c.val[1], left.m1));
+    rows.val[0] = vaddq_f32(rows.val[0], vmulq_n_f32(c.val[2], left.m2));
+    rows.val[0] = vaddq_f32(rows.val[0], vmulq_n_f32(c.val[3], left.m3));
+
+    rows.val[1] = vmulq_n_f32(c.val[0], left.m4);
+    rows.val[1] = vaddq_f32(rows.val[1], vmulq_n_f32(c.val[1], left.m5));
+    rows.val[1] = vaddq_f32(rows.val[1], vmulq_n_f32(c.val[2], left.m6));
+    rows.val[1] = vaddq_f32(rows.val[1], vmulq_n_f32(c.val[3], left.m7));
+
+    rows.val[2] = vmulq_n_f32(c.val[0], left.m8);
+    rows.val[2] = vaddq_f32(rows.val[2], vmulq_n_f32(c.val[1], left.m9));
+    rows.val[2] = vaddq_f32(rows.val[2], vmulq_n_f32(c.val[2], left.m10));
+    rows.val[2] = vaddq_f32(rows.val[2], vmulq_n_f32(c.val[3], left.m11));
+
+    rows.val[3] = vmulq_n_f32(c.val[0], left.m12);
+    rows.val[3] = vaddq_f32(rows.val[3], vmulq_n_f32(c.val[1], left.m13));
+    rows.val[3] = vaddq_f32(rows.val[3], vmulq_n_f32(c.val[2], left.m14));
+    rows.val[3] = vaddq_f32(rows.val[3], vmulq_n_f32(c.val[3], left.m15));
+
+    // Interleaved store, result rows back to memory layout
+    vst4q_f32(&result.m0, rows);
 #else
     result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
     result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
@@ -1782,14 +2109,23 @@ rl_RMAPI rl_Matrix MatrixRotate(rl_Vector3 axis, float angle)
 
     if ((lengthSquared != 1.0f) && (lengthSquared != 0.0f))
     {
+#if defined(RAYMATH_FAST_MATH)
+        float ilength = FastInvSqrt(lengthSquared);
+#else
         float ilength = 1.0f/sqrtf(lengthSquared);
+#endif
         x *= ilength;
         y *= ilength;
         z *= ilength;
     }
 
+#if defined(RAYMATH_FAST_MATH)
+    float sinres = FastSin(angle);
+    float cosres = FastCos(angle);
+#else
     float sinres = sinf(angle);
     float cosres = cosf(angle);
+#endif
     float t = 1.0f - cosres;
 
     result.m0 = x*x*t + cosres;
@@ -1824,8 +2160,13 @@ rl_RMAPI rl_Matrix MatrixRotateX(float angle)
                       0.0f, 0.0f, 1.0f, 0.0f,
                       0.0f, 0.0f, 0.0f, 1.0f }; // MatrixIdentity()
 
+#if defined(RAYMATH_FAST_MATH)
+    float cosres = FastCos(angle);
+    float sinres = FastSin(angle);
+#else
     float cosres = cosf(angle);
     float sinres = sinf(angle);
+#endif
 
     result.m5 = cosres;
     result.m6 = sinres;
@@ -1844,8 +2185,13 @@ rl_RMAPI rl_Matrix MatrixRotateY(float angle)
                       0.0f, 0.0f, 1.0f, 0.0f,
                       0.0f, 0.0f, 0.0f, 1.0f }; // MatrixIdentity()
 
+#if defined(RAYMATH_FAST_MATH)
+    float cosres = FastCos(angle);
+    float sinres = FastSin(angle);
+#else
     float cosres = cosf(angle);
     float sinres = sinf(angle);
+#endif
 
     result.m0 = cosres;
     result.m2 = -sinres;
@@ -1864,8 +2210,13 @@ rl_RMAPI rl_Matrix MatrixRotateZ(float angle)
                       0.0f, 0.0f, 1.0f, 0.0f,
                       0.0f, 0.0f, 0.0f, 1.0f }; // MatrixIdentity()
 
+#if defined(RAYMATH_FAST_MATH)
+    float cosres = FastCos(angle);
+    float sinres = FastSin(angle);
+#else
     float cosres = cosf(angle);
     float sinres = sinf(angle);
+#endif
 
     result.m0 = cosres;
     result.m1 = sinres;
@@ -2179,9 +2530,14 @@ rl_RMAPI rl_Quaternion QuaternionNormalize(rl_Quaternion q)
 {
     rl_Quaternion result = { 0 };
 
+#if defined(RAYMATH_FAST_MATH)
+    float length = q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w;
+    float ilength = (length == 0.0f)? 1.0f : FastInvSqrt(length);
+#else
     float length = sqrtf(q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w);
     if (length == 0.0f) length = 1.0f;
     float ilength = 1.0f/length;
+#endif
 
     result.x = q.x*ilength;
     result.y = q.y*ilength;
@@ -2274,9 +2630,14 @@ rl_RMAPI rl_Quaternion QuaternionNlerp(rl_Quaternion q1, rl_Quaternion q2, float
 
     // QuaternionNormalize(q);
     rl_Quaternion q = result;
+#if defined(RAYMATH_FAST_MATH)
+    float length = q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w;
+    float ilength = (length == 0.0f)? 1.0f : FastInvSqrt(length);
+#else
     float length = sqrtf(q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w);
     if (length == 0.0f) length = 1.0f;
     float ilength = 1.0f/length;
+#endif
 
     result.x = q.x*ilength;
     result.y = q.y*ilength;
@@ -2304,6 +2665,32 @@ rl_RMAPI rl_Quaternion QuaternionSlerp(rl_Quaternion q1, rl_Quaternion q2, float
     }
 
     if (fabsf(cosHalfTheta) >= 1.0f) result = q1;
+#if defined(RAYMATH_FAST_MATH)
+    else
+    {
+        // Nlerp with interpolation amount corrected to follow slerp angular speed,
+        // correction polynomials fitted on cosHalfTheta (https://zeux.io/2015/07/23/approximating-slerp/)
+        float d = cosHalfTheta;
+        float a = 1.0904f + d*(-3.2452f + d*(3.55645f - d*1.43519f));
+        float b = 0.848013f + d*(-1.06021f + d*0.215638f);
+        float k = a*(amount - 0.5f)*(amount - 0.5f) + b;
+        float t = amount + amount*(amount - 0.5f)*(amount - 1.0f)*k;
+
+        // QuaternionNlerp(q1, q2, t)
+        result.x = q1.x + t*(q2.x - q1.x);
+        result.y = q1.y + t*(q2.y - q1.y);
+        result.z = q1.z + t*(q2.z - q1.z);
+        result.w = q1.w + t*(q2.w - q1.w);
+
+        float length = result.x*result.x + result.y*result.y + result.z*result.z + result.w*result.w;
+        float ilength = (length == 0.0f)? 1.0f : FastInvSqrt(length);
+
+        result.x *= ilength;
+        result.y *= ilength;
+        result.z *= ilength;
+        result.w *= ilength;
+    }
+#else
     else if (cosHalfTheta > 0.95f) result = QuaternionNlerp(q1, q2, amount);
     else
     {
@@ -2328,6 +2715,7 @@ rl_RMAPI rl_Quaternion QuaternionSlerp(rl_Quaternion q1, rl_Quaternion q2, float
             result.w = (q1.w*ratioA + q2.w*ratioB);
         }
     }
+#endif
 
     return result;
 }
@@ -2458,6 +2846,51 @@ rl_RMAPI rl_Matrix QuaternionToMatrix(rl_Quaternion q)
                       0.0f, 0.0f, 1.0f, 0.0f,
                       0.0f, 0.0f, 0.0f, 1.0f }; // MatrixIdentity()
 
+#if defined(RAYMATH_SSE_ENABLED) || defined(RAYMATH_NEON_ENABLED)
+    // Off-diagonal terms from sums and differences of (ab, ac, bc) and (cd, bd, ad),
+    // diagonal terms from the sums of squares (b2 + c2, a2 + c2, a2 + b2), lanes in that order
+    float tmp[3][4] = { 0 };
+#endif
+#if defined(RAYMATH_SSE_ENABLED)
+    __m128 u = _mm_mul_ps(_mm_set_ps(0.0f, q.y, q.x, q.x), _mm_set_ps(0.0f, q.z, q.z, q.y));
+    __m128 v = _mm_mul_ps(_mm_set1_ps(q.w), _mm_set_ps(0.0f, q.x, q.y, q.z));
+    __m128 sa = _mm_set_ps(0.0f, q.x, q.x, q.y);
+    __m128 sb = _mm_set_ps(0.0f, q.y, q.z, q.z);
+    __m128 squares = _mm_add_ps(_mm_mul_ps(sa, sa), _mm_mul_ps(sb, sb));
+    __m128 two = _mm_set1_ps(2.0f);
+
+    _mm_storeu_ps(tmp[0], _mm_mul_ps(_mm_add_ps(u, v), two));
+    _mm_storeu_ps(tmp[1], _mm_mul_ps(_mm_sub_ps(u, v), two));
+    _mm_storeu_ps(tmp[2], _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(squares, two)));
+#elif defined(RAYMATH_NEON_ENABLED)
+    const float uA[4] = { q.x, q.x, q.y, 0.0f };
+    const float uB[4] = { q.y, q.z, q.z, 0.0f };
+    const float vB[4] = { q.z, q.y, q.x, 0.0f };
+    const float sA[4] = { q.y, q.x, q.x, 0.0f };
+    const float sB[4] = { q.z, q.z, q.y, 0.0f };
+    float32x4_t u = vmulq_f32(vld1q_f32(uA), vld1q_f32(uB));
+    float32x4_t v = vmulq_n_f32(vld1q_f32(vB), q.w);
+    float32x4_t sa = vld1q_f32(sA);
+    float32x4_t sb = vld1q_f32(sB);
+    float32x4_t squares = vaddq_f32(vmulq_f32(sa, sa), vmulq_f32(sb, sb));
+
+    vst1q_f32(tmp[0], vmulq_n_f32(vaddq_f32(u, v), 2.0f));
+    vst1q_f32(tmp[1], vmulq_n_f32(vsubq_f32(u, v), 2.0f));
+    vst1q_f32(tmp[2], vsubq_f32(vdupq_n_f32(1.0f), vmulq_n_f32(squares, 2.0f)));
+#endif
+#if defined(RAYMATH_SSE_ENABLED) || defined(RAYMATH_NEON_ENABLED)
+    result.m0 = tmp[2][0];
+    result.m1 = tmp[0][0];
+    result.m2 = tmp[1][1];
+
+    result.m4 = tmp[1][0];
+    result.m5 = tmp[2][1];
+    result.m6 = tmp[0][2];
+
+    result.m8 = tmp[0][1];
+    result.m9 = tmp[1][2];
+    result.m10 = tmp[2][2];
+#else
     float a2 = q.x*q.x;
     float b2 = q.y*q.y;
     float c2 = q.z*q.z;
@@ -2479,6 +2912,7 @@ rl_RMAPI rl_Matrix QuaternionToMatrix(rl_Quaternion q)
     result.m8 = 2*(ac + bd);
     result.m9 = 2*(bc - ad);
     result.m10 = 1 - 2*(a2 + b2);
+#endif
 
     return result;
 }
@@ -2506,8 +2940,13 @@ rl_RMAPI rl_Quaternion QuaternionFromAxisAngle(rl_Vector3 axis, float angle)
         axis.y *= ilength;
         axis.z *= ilength;
 
+#if defined(RAYMATH_FAST_MATH)
+        float sinres = FastSin(angle);
+        float cosres = FastCos(angle);
+#else
         float sinres = sinf(angle);
         float cosres = cosf(angle);
+#endif
 
         result.x = axis.x*sinres;
         result.y = axis.y*sinres;
@@ -2758,6 +3197,557 @@ rl_RMAPI void MatrixDecompose(rl_Matrix mat, rl_Vector3 *translation, rl_Quatern
     *rotation = QuaternionFromMatrix(rotationMatrix);
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - rl_Frustum math
+//----------------------------------------------------------------------------------
+
+// Get frustum planes from matrix
+// NOTE: Use view*projection for world space frustum, model*view*projection for model space frustum
+rl_RMAPI rl_Frustum FrustumFromMatrix(rl_Matrix mat)
+{
+    rl_Frustum result = { 0 };
+
+    // Planes are combinations of clip space matrix rows: w + x, w - x, w + y, w - y, w + z, w - z
+    rl_Vector4 left = { mat.m3 + mat.m0, mat.m7 + mat.m4, mat.m11 + mat.m8, mat.m15 + mat.m12 };
+    rl_Vector4 right = { mat.m3 - mat.m0, mat.m7 - mat.m4, mat.m11 - mat.m8, mat.m15 - mat.m12 };
+    rl_Vector4 bottom = { mat.m3 + mat.m1, mat.m7 + mat.m5, mat.m11 + mat.m9, mat.m15 + mat.m13 };
+    rl_Vector4 top = { mat.m3 - mat.m1, mat.m7 - mat.m5, mat.m11 - mat.m9, mat.m15 - mat.m13 };
+    rl_Vector4 nearPlane = { mat.m3 + mat.m2, mat.m7 + mat.m6, mat.m11 + mat.m10, mat.m15 + mat.m14 };
+    rl_Vector4 farPlane = { mat.m3 - mat.m2, mat.m7 - mat.m6, mat.m11 - mat.m10, mat.m15 - mat.m14 };
+
+    result.planes[0] = left;
+    result.planes[1] = right;
+    result.planes[2] = bottom;
+    result.planes[3] = top;
+    result.planes[4] = nearPlane;
+    result.planes[5] = farPlane;
+
+    for (int i = 0; i < 6; i++)
+    {
+        rl_Vector4 plane = result.planes[i];
+        float length = sqrtf(plane.x*plane.x + plane.y*plane.y + plane.z*plane.z);
+
+        if (length > 0.0f)
+        {
+            float ilength = 1.0f/length;
+            result.planes[i].x = plane.x*ilength;
+            result.planes[i].y = plane.y*ilength;
+            result.planes[i].z = plane.z*ilength;
+            result.planes[i].w = plane.w*ilength;
+        }
+    }
+
+    return result;
+}
+
+// Check if sphere is inside or intersecting frustum
+rl_RMAPI int FrustumCheckSphere(rl_Frustum frustum, rl_Vector3 center, float radius)
+{
+    int result = 1;
+
+#if defined(RAYMATH_SSE_ENABLED)
+    // Test planes 0..3 and 4..5 in two batches, one plane per lane
+    const rl_Vector4 *p = frustum.planes;
+    __m128 cx = _mm_set1_ps(center.x);
+    __m128 cy = _mm_set1_ps(center.y);
+    __m128 cz = _mm_set1_ps(center.z);
+    __m128 r = _mm_set1_ps(-radius);
+
+    __m128 d0 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set_ps(p[3].x, p[2].x, p[1].x, p[0].x), cx),
+                                      _mm_mul_ps(_mm_set_ps(p[3].y, p[2].y, p[1].y, p[0].y), cy)),
+                           _mm_add_ps(_mm_mul_ps(_mm_set_ps(p[3].z, p[2].z, p[1].z, p[0].z), cz),
+                                      _mm_set_ps(p[3].w, p[2].w, p[1].w, p[0].w)));
+    __m128 d1 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set_ps(p[5].x, p[4].x, p[5].x, p[4].x), cx),
+                                      _mm_mul_ps(_mm_set_ps(p[5].y, p[4].y, p[5].y, p[4].y), cy)),
+                           _mm_add_ps(_mm_mul_ps(_mm_set_ps(p[5].z, p[4].z, p[5].z, p[4].z), cz),
+                                      _mm_set_ps(p[5].w, p[4].w, p[5].w, p[4].w)));
+
+    if (_mm_movemask_ps(_mm_or_ps(_mm_cmplt_ps(d0, r), _mm_cmplt_ps(d1, r))) != 0) result = 0;
+#else
+    for (int i = 0; i < 6; i++)
+    {
+        rl_Vector4 plane = frustum.planes[i];
+
+        if ((plane.x*center.x + plane.y*center.y + plane.z*center.z + plane.w) < -radius)
+        {
+            result = 0;
+            break;
+        }
+    }
+#endif
+
+    return result;
+}
+
+// Check if axis aligned box is inside or intersecting frustum
+// NOTE: Conservative test, boxes close to frustum corners can be reported as intersecting
+rl_RMAPI int FrustumCheckBox(rl_Frustum frustum, rl_Vector3 min, rl_Vector3 max)
+{
+    int result = 1;
+
+#if defined(RAYMATH_SSE_ENABLED)
+    // Box corner farthest along plane normal: max(n*min, n*max) per axis, one plane per lane
+    const rl_Vector4 *p = frustum.planes;
+    __m128 minX = _mm_set1_ps(min.x), maxX = _mm_set1_ps(max.x);
+    __m128 minY = _mm_set1_ps(min.y), maxY = _mm_set1_ps(max.y);
+    __m128 minZ = _mm_set1_ps(min.z), maxZ = _mm_set1_ps(max.z);
+
+    __m128 nx = _mm_set_ps(p[3].x, p[2].x, p[1].x, p[0].x);
+    __m128 ny = _mm_set_ps(p[3].y, p[2].y, p[1].y, p[0].y);
+    __m128 nz = _mm_set_ps(p[3].z, p[2].z, p[1].z, p[0].z);
+    __m128 d0 = _mm_add_ps(_mm_add_ps(_mm_max_ps(_mm_mul_ps(nx, minX), _mm_mul_ps(nx, maxX)),
+                                      _mm_max_ps(_mm_mul_ps(ny, minY), _mm_mul_ps(ny, maxY))),
+                           _mm_add_ps(_mm_max_ps(_mm_mul_ps(nz, minZ), _mm_mul_ps(nz, maxZ)),
+                                      _mm_set_ps(p[3].w, p[2].w, p[1].w, p[0].w)));
+
+    nx = _mm_set_ps(p[5].x, p[4].x, p[5].x, p[4].x);
+    ny = _mm_set_ps(p[5].y, p[4].y, p[5].y, p[4].y);
+    nz = _mm_set_ps(p[5].z, p[4].z, p[5].z, p[4].z);
+    __m128 d1 = _mm_add_ps(_mm_add_ps(_mm_max_ps(_mm_mul_ps(nx, minX), _mm_mul_ps(nx, maxX)),
+                                      _mm_max_ps(_mm_mul_ps(ny, minY), _mm_mul_ps(ny, maxY))),
+                           _mm_add_ps(_mm_max_ps(_mm_mul_ps(nz, minZ), _mm_mul_ps(nz, maxZ)),
+                                      _mm_set_ps(p[5].w, p[4].w, p[5].w, p[4].w)));
+
+    __m128 zero = _mm_setzero_ps();
+    if (_mm_movemask_ps(_mm_or_ps(_mm_cmplt_ps(d0, zero), _mm_cmplt_ps(d1, zero))) != 0) result = 0;
+#else
+    for (int i = 0; i < 6; i++)
+    {
+        rl_Vector4 plane = frustum.planes[i];
+
+        // Box corner farthest along plane normal (positive vertex)
+        float x = (plane.x >= 0.0f)? max.x : min.x;
+        float y = (plane.y >= 0.0f)? max.y : min.y;
+        float z = (plane.z >= 0.0f)? max.z : min.z;
+
+        if ((plane.x*x + plane.y*y + plane.z*z + plane.w) < 0.0f)
+        {
+            result = 0;
+            break;
+        }
+    }
+#endif
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - rl_Matrix3x4 math
+//----------------------------------------------------------------------------------
+
+// Get affine matrix from rl_Matrix
+// NOTE: Fourth row is dropped, rl_Matrix must be affine (fourth row [0 0 0 1])
+rl_RMAPI rl_Matrix3x4 Matrix3x4FromMatrix(rl_Matrix mat)
+{
+    rl_Matrix3x4 result = {
+        mat.m0, mat.m4, mat.m8, mat.m12,
+        mat.m1, mat.m5, mat.m9, mat.m13,
+        mat.m2, mat.m6, mat.m10, mat.m14
+    };
+
+    return result;
+}
+
+// Get rl_Matrix from affine matrix
+rl_RMAPI rl_Matrix Matrix3x4ToMatrix(rl_Matrix3x4 mat)
+{
+    rl_Matrix result = {
+        mat.m0, mat.m4, mat.m8, mat.m12,
+        mat.m1, mat.m5, mat.m9, mat.m13,
+        mat.m2, mat.m6, mat.m10, mat.m14,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+
+    return result;
+}
+
+// Get two affine matrices product, same order as MatrixMultiply()
+// NOTE: 36 multiplications instead of 64, fourth row is not computed
+rl_RMAPI rl_Matrix3x4 Matrix3x4Multiply(rl_Matrix3x4 left, rl_Matrix3x4 right)
+{
+    rl_Matrix3x4 result = { 0 };
+
+    result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8;
+    result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9;
+    result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10;
+    result.m4 = left.m4*right.m0 + left.m5*right.m4 + left.m6*right.m8;
+    result.m5 = left.m4*right.m1 + left.m5*right.m5 + left.m6*right.m9;
+    result.m6 = left.m4*right.m2 + left.m5*right.m6 + left.m6*right.m10;
+    result.m8 = left.m8*right.m0 + left.m9*right.m4 + left.m10*right.m8;
+    result.m9 = left.m8*right.m1 + left.m9*right.m5 + left.m10*right.m9;
+    result.m10 = left.m8*right.m2 + left.m9*right.m6 + left.m10*right.m10;
+    result.m12 = left.m12*right.m0 + left.m13*right.m4 + left.m14*right.m8 + right.m12;
+    result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + right.m13;
+    result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + right.m14;
+
+    return result;
+}
+
+// Invert affine matrix
+// NOTE: 3x3 part inverted from its cofactors, translation transformed by it and negated
+rl_RMAPI rl_Matrix3x4 Matrix3x4Invert(rl_Matrix3x4 mat)
+{
+    rl_Matrix3x4 result = { 0 };
+
+    // Cofactors of first column
+    float c0 = mat.m5*mat.m10 - mat.m9*mat.m6;
+    float c1 = mat.m9*mat.m2 - mat.m1*mat.m10;
+    float c2 = mat.m1*mat.m6 - mat.m5*mat.m2;
+
+    float invDet = 1.0f/(mat.m0*c0 + mat.m4*c1 + mat.m8*c2);
+
+    result.m0 = c0*invDet;
+    result.m1 = c1*invDet;
+    result.m2 = c2*invDet;
+    result.m4 = (mat.m8*mat.m6 - mat.m4*mat.m10)*invDet;
+    result.m5 = (mat.m0*mat.m10 - mat.m8*mat.m2)*invDet;
+    result.m6 = (mat.m4*mat.m2 - mat.m0*mat.m6)*invDet;
+    result.m8 = (mat.m4*mat.m9 - mat.m8*mat.m5)*invDet;
+    result.m9 = (mat.m8*mat.m1 - mat.m0*mat.m9)*invDet;
+    result.m10 = (mat.m0*mat.m5 - mat.m4*mat.m1)*invDet;
+
+    result.m12 = -(result.m0*mat.m12 + result.m4*mat.m13 + result.m8*mat.m14);
+    result.m13 = -(result.m1*mat.m12 + result.m5*mat.m13 + result.m9*mat.m14);
+    result.m14 = -(result.m2*mat.m12 + result.m6*mat.m13 + result.m10*mat.m14);
+
+    return result;
+}
+
+// Invert rigid affine matrix (rotation and translation only)
+// NOTE: Rotation is transposed and translation negated, use Matrix3x4Invert() if matrix includes scale
+rl_RMAPI rl_Matrix3x4 Matrix3x4InvertRigid(rl_Matrix3x4 mat)
+{
+    rl_Matrix3x4 result = { 0 };
+
+    result.m0 = mat.m0;
+    result.m1 = mat.m4;
+    result.m2 = mat.m8;
+    result.m4 = mat.m1;
+    result.m5 = mat.m5;
+    result.m6 = mat.m9;
+    result.m8 = mat.m2;
+    result.m9 = mat.m6;
+    result.m10 = mat.m10;
+
+    result.m12 = -(result.m0*mat.m12 + result.m4*mat.m13 + result.m8*mat.m14);
+    result.m13 = -(result.m1*mat.m12 + result.m5*mat.m13 + result.m9*mat.m14);
+    result.m14 = -(result.m2*mat.m12 + result.m6*mat.m13 + result.m10*mat.m14);
+
+    return result;
+}
+
+// Get normal matrix of affine matrix, inverse transpose of its 3x3 part, no translation
+// NOTE: Equivalent to MatrixTranspose(MatrixInvert(mat)) for directions, computed from cofactors
+rl_RMAPI rl_Matrix3x4 Matrix3x4Normal(rl_Matrix3x4 mat)
+{
+    rl_Matrix3x4 result = { 0 };
+
+    // Cofactors of first column
+    float c0 = mat.m5*mat.m10 - mat.m9*mat.m6;
+    float c1 = mat.m9*mat.m2 - mat.m1*mat.m10;
+    float c2 = mat.m1*mat.m6 - mat.m5*mat.m2;
+
+    float invDet = 1.0f/(mat.m0*c0 + mat.m4*c1 + mat.m8*c2);
+
+    result.m0 = c0*invDet;
+    result.m4 = c1*invDet;
+    result.m8 = c2*invDet;
+    result.m1 = (mat.m8*mat.m6 - mat.m4*mat.m10)*invDet;
+    result.m5 = (mat.m0*mat.m10 - mat.m8*mat.m2)*invDet;
+    result.m9 = (mat.m4*mat.m2 - mat.m0*mat.m6)*invDet;
+    result.m2 = (mat.m4*mat.m9 - mat.m8*mat.m5)*invDet;
+    result.m6 = (mat.m8*mat.m1 - mat.m0*mat.m9)*invDet;
+    result.m10 = (mat.m0*mat.m5 - mat.m4*mat.m1)*invDet;
+
+    return result;
+}
+
+// Transform a rl_Vector3 by an affine matrix
+rl_RMAPI rl_Vector3 Vector3TransformMatrix3x4(rl_Vector3 v, rl_Matrix3x4 mat)
+{
+    rl_Vector3 result = { 0 };
+
+    float x = v.x;
+    float y = v.y;
+    float z = v.z;
+
+    result.x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+    result.y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+    result.z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Batch math
+//----------------------------------------------------------------------------------
+
+// Transform points by a given rl_Matrix, points provided as separate x, y, z arrays (SoA)
+// NOTE: Points are transformed in place, w array is optional (can be NULL),
+// when provided it receives the homogeneous w component (projection matrices)
+rl_RMAPI void Vector3TransformBatch(float *x, float *y, float *z, float *w, int count, rl_Matrix mat)
+{
+    int i = 0;
+
+#if defined(RAYMATH_AVX_ENABLED)
+    __m256 m0 = _mm256_set1_ps(mat.m0), m4 = _mm256_set1_ps(mat.m4), m8 = _mm256_set1_ps(mat.m8), m12 = _mm256_set1_ps(mat.m12);
+    __m256 m1 = _mm256_set1_ps(mat.m1), m5 = _mm256_set1_ps(mat.m5), m9 = _mm256_set1_ps(mat.m9), m13 = _mm256_set1_ps(mat.m13);
+    __m256 m2 = _mm256_set1_ps(mat.m2), m6 = _mm256_set1_ps(mat.m6), m10 = _mm256_set1_ps(mat.m10), m14 = _mm256_set1_ps(mat.m14);
+    __m256 m3 = _mm256_set1_ps(mat.m3), m7 = _mm256_set1_ps(mat.m7), m11 = _mm256_set1_ps(mat.m11), m15 = _mm256_set1_ps(mat.m15);
+
+    for (; (i + 8) <= count; i += 8)
+    {
+        __m256 px = _mm256_loadu_ps(x + i);
+        __m256 py = _mm256_loadu_ps(y + i);
+        __m256 pz = _mm256_loadu_ps(z + i);
+
+        _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m0, px), _mm256_mul_ps(m4, py)), _mm256_mul_ps(m8, pz)), m12));
+        _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m1, px), _mm256_mul_ps(m5, py)), _mm256_mul_ps(m9, pz)), m13));
+        _mm256_storeu_ps(z + i, _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m2, px), _mm256_mul_ps(m6, py)), _mm256_mul_ps(m10, pz)), m14));
+        if (w != NULL) _mm256_storeu_ps(w + i, _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m3, px), _mm256_mul_ps(m7, py)), _mm256_mul_ps(m11, pz)), m15));
+    }
+#endif
+#if defined(RAYMATH_SSE_ENABLED)
+    __m128 c0 = _mm_set1_ps(mat.m0), c4 = _mm_set1_ps(mat.m4), c8 = _mm_set1_ps(mat.m8), c12 = _mm_set1_ps(mat.m12);
+    __m128 c1 = _mm_set1_ps(mat.m1), c5 = _mm_set1_ps(mat.m5), c9 = _mm_set1_ps(mat.m9), c13 = _mm_set1_ps(mat.m13);
+    __m128 c2 = _mm_set1_ps(mat.m2), c6 = _mm_set1_ps(mat.m6), c10 = _mm_set1_ps(mat.m10), c14 = _mm_set1_ps(mat.m14);
+    __m128 c3 = _mm_set1_ps(mat.m3), c7 = _mm_set1_ps(mat.m7), c11 = _mm_set1_ps(mat.m11), c15 = _mm_set1_ps(mat.m15);
+
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128 px = _mm_loadu_ps(x + i);
+        __m128 py = _mm_loadu_ps(y + i);
+        __m128 pz = _mm_loadu_ps(z + i);
+
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, px), _mm_mul_ps(c4, py)), _mm_mul_ps(c8, pz)), c12));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c1, px), _mm_mul_ps(c5, py)), _mm_mul_ps(c9, pz)), c13));
+        _mm_storeu_ps(z + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c2, px), _mm_mul_ps(c6, py)), _mm_mul_ps(c10, pz)), c14));
+        if (w != NULL) _mm_storeu_ps(w + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(c3, px), _mm_mul_ps(c7, py)), _mm_mul_ps(c11, pz)), c15));
+    }
+#elif defined(RAYMATH_NEON_ENABLED)
+    for (; (i + 4) <= count; i += 4)
+    {
+        float32x4_t px = vld1q_f32(x + i);
+        float32x4_t py = vld1q_f32(y + i);
+        float32x4_t pz = vld1q_f32(z + i);
+
+        vst1q_f32(x + i, vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(px, mat.m0), vmulq_n_f32(py, mat.m4)), vmulq_n_f32(pz, mat.m8)), vdupq_n_f32(mat.m12)));
+        vst1q_f32(y + i, vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(px, mat.m1), vmulq_n_f32(py, mat.m5)), vmulq_n_f32(pz, mat.m9)), vdupq_n_f32(mat.m13)));
+        vst1q_f32(z + i, vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(px, mat.m2), vmulq_n_f32(py, mat.m6)), vmulq_n_f32(pz, mat.m10)), vdupq_n_f32(mat.m14)));
+        if (w != NULL) vst1q_f32(w + i, vaddq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(px, mat.m3), vmulq_n_f32(py, mat.m7)), vmulq_n_f32(pz, mat.m11)), vdupq_n_f32(mat.m15)));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float px = x[i];
+        float py = y[i];
+        float pz = z[i];
+
+        x[i] = mat.m0*px + mat.m4*py + mat.m8*pz + mat.m12;
+        y[i] = mat.m1*px + mat.m5*py + mat.m9*pz + mat.m13;
+        z[i] = mat.m2*px + mat.m6*py + mat.m10*pz + mat.m14;
+        if (w != NULL) w[i] = mat.m3*px + mat.m7*py + mat.m11*pz + mat.m15;
+    }
+}
+
+// Multiply pairs of matrices, result[i] = left[i]*right[i]
+// NOTE: result can point to left or right arrays
+rl_RMAPI void MatrixMultiplyBatch(const rl_Matrix *left, const rl_Matrix *right, rl_Matrix *result, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        const rl_Matrix *l = &left[i];
+        const rl_Matrix *r = &right[i];
+
+#if defined(RAYMATH_SSE_ENABLED)
+        // Right matrix memory rows transposed to rows in semantic order
+        __m128 c0 = _mm_loadu_ps(&r->m0);
+        __m128 c1 = _mm_loadu_ps(&r->m1);
+        __m128 c2 = _mm_loadu_ps(&r->m2);
+        __m128 c3 = _mm_loadu_ps(&r->m3);
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    #if defined(RAYMATH_AVX_ENABLED)
+        // Two result rows per operation, right matrix rows duplicated in both 128-bit halves
+        __m256 d0 = _mm256_insertf128_ps(_mm256_castps128_ps256(c0), c0, 1);
+        __m256 d1 = _mm256_insertf128_ps(_mm256_castps128_ps256(c1), c1, 1);
+        __m256 d2 = _mm256_insertf128_ps(_mm256_castps128_ps256(c2), c2, 1);
+        __m256 d3 = _mm256_insertf128_ps(_mm256_castps128_ps256(c3), c3, 1);
+
+        __m256 rows01 = _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(l->m0), _mm_set1_ps(l->m4), 1), d0);
+        rows01 = _mm256_add_ps(rows01, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(l->m1), _mm_set1_ps(l->m5), 1), d1));
+        rows01 = _mm256_add_ps(rows01, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(l->m2), _mm_set1_ps(l->m6), 1), d2));
+        rows01 = _mm256_add_ps(rows01, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(l->m3), _mm_set1_ps(l->m7), 1), d3));
+
+        __m256 rows23 = _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(l->m8), _mm_set1_ps(l->m12), 1), d0);
+        rows23 = _mm256_add_ps(rows23, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(l->m9), _mm_set1_ps(l->m13), 1), d1));
+        rows23 = _mm256_add_ps(rows23, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(l->m10), _mm_set1_ps(l->m14), 1), d2));
+        rows23 = _mm256_add_ps(rows23, _mm256_mul_ps(_mm256_insertf128_ps(_mm256_set1_ps(l->m11), _mm_set1_ps(l->m15), 1), d3));
+
+        __m128 row0 = _mm256_castps256_ps128(rows01);
+        __m128 row1 = _mm256_extractf128_ps(rows01, 1);
+        __m128 row2 = _mm256_castps256_ps128(rows23);
+        __m128 row3 = _mm256_extractf128_ps(rows23, 1);
+    #else
+        __m128 row0 = _mm_mul_ps(_mm_set1_ps(l->m0), c0);
+        row0 = _mm_add_ps(row0, _mm_mul_ps(_mm_set1_ps(l->m1), c1));
+        row0 = _mm_add_ps(row0, _mm_mul_ps(_mm_set1_ps(l->m2), c2));
+        row0 = _mm_add_ps(row0, _mm_mul_ps(_mm_set1_ps(l->m3), c3));
+
+        __m128 row1 = _mm_mul_ps(_mm_set1_ps(l->m4), c0);
+        row1 = _mm_add_ps(row1, _mm_mul_ps(_mm_set1_ps(l->m5), c1));
+        row1 = _mm_add_ps(row1, _mm_mul_ps(_mm_set1_ps(l->m6), c2));
+        row1 = _mm_add_ps(row1, _mm_mul_ps(_mm_set1_ps(l->m7), c3));
+
+        __m128 row2 = _mm_mul_ps(_mm_set1_ps(l->m8), c0);
+        row2 = _mm_add_ps(row2, _mm_mul_ps(_mm_set1_ps(l->m9), c1));
+        row2 = _mm_add_ps(row2, _mm_mul_ps(_mm_set1_ps(l->m10), c2));
+        row2 = _mm_add_ps(row2, _mm_mul_ps(_mm_set1_ps(l->m11), c3));
+
+        __m128 row3 = _mm_mul_ps(_mm_set1_ps(l->m12), c0);
+        row3 = _mm_add_ps(row3, _mm_mul_ps(_mm_set1_ps(l->m13), c1));
+        row3 = _mm_add_ps(row3, _mm_mul_ps(_mm_set1_ps(l->m14), c2));
+        row3 = _mm_add_ps(row3, _mm_mul_ps(_mm_set1_ps(l->m15), c3));
+    #endif
+
+        // Result rows transposed back to memory layout, stored once all inputs are read
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+        _mm_storeu_ps(&result[i].m0, row0);
+        _mm_storeu_ps(&result[i].m1, row1);
+        _mm_storeu_ps(&result[i].m2, row2);
+        _mm_storeu_ps(&result[i].m3, row3);
+#elif defined(RAYMATH_NEON_ENABLED)
+        // De-interleaved load, right matrix memory rows become rows in semantic order
+        float32x4x4_t c = vld4q_f32(&r->m0);
+        float32x4x4_t rows;
+
+        rows.val[0] = vmulq_n_f32(c.val[0], l->m0);
+        rows.val[0] = vaddq_f32(rows.val[0], vmulq_n_f32(c.val[1], l->m1));
+        rows.val[0] = vaddq_f32(rows.val[0], vmulq_n_f32(c.val[2], l->m2));
+        rows.val[0] = vaddq_f32(rows.val[0], vmulq_n_f32(c.val[3], l->m3));
+
+        rows.val[1] = vmulq_n_f32(c.val[0], l->m4);
+        rows.val[1] = vaddq_f32(rows.val[1], vmulq_n_f32(c.val[1], l->m5));
+        rows.val[1] = vaddq_f32(rows.val[1], vmulq_n_f32(c.val[2], l->m6));
+        rows.val[1] = vaddq_f32(rows.val[1], vmulq_n_f32(c.val[3], l->m7));
+
+        rows.val[2] = vmulq_n_f32(c.val[0], l->m8);
+        rows.val[2] = vaddq_f32(rows.val[2], vmulq_n_f32(c.val[1], l->m9));
+        rows.val[2] = vaddq_f32(rows.val[2], vmulq_n_f32(c.val[2], l->m10));
+        rows.val[2] = vaddq_f32(rows.val[2], vmulq_n_f32(c.val[3], l->m11));
+
+        rows.val[3] = vmulq_n_f32(c.val[0], l->m12);
+        rows.val[3] = vaddq_f32(rows.val[3], vmulq_n_f32(c.val[1], l->m13));
+        rows.val[3] = vaddq_f32(rows.val[3], vmulq_n_f32(c.val[2], l->m14));
+        rows.val[3] = vaddq_f32(rows.val[3], vmulq_n_f32(c.val[3], l->m15));
+
+        // Interleaved store, result rows back to memory layout
+        vst4q_f32(&result[i].m0, rows);
+#else
+        // NOTE: Computed into a copy, result can point to left or right
+        rl_Matrix mat = { 0 };
+
+        mat.m0 = l->m0*r->m0 + l->m1*r->m4 + l->m2*r->m8 + l->m3*r->m12;
+        mat.m1 = l->m0*r->m1 + l->m1*r->m5 + l->m2*r->m9 + l->m3*r->m13;
+        mat.m2 = l->m0*r->m2 + l->m1*r->m6 + l->m2*r->m10 + l->m3*r->m14;
+        mat.m3 = l->m0*r->m3 + l->m1*r->m7 + l->m2*r->m11 + l->m3*r->m15;
+        mat.m4 = l->m4*r->m0 + l->m5*r->m4 + l->m6*r->m8 + l->m7*r->m12;
+        mat.m5 = l->m4*r->m1 + l->m5*r->m5 + l->m6*r->m9 + l->m7*r->m13;
+        mat.m6 = l->m4*r->m2 + l->m5*r->m6 + l->m6*r->m10 + l->m7*r->m14;
+        mat.m7 = l->m4*r->m3 + l->m5*r->m7 + l->m6*r->m11 + l->m7*r->m15;
+        mat.m8 = l->m8*r->m0 + l->m9*r->m4 + l->m10*r->m8 + l->m11*r->m12;
+        mat.m9 = l->m8*r->m1 + l->m9*r->m5 + l->m10*r->m9 + l->m11*r->m13;
+        mat.m10 = l->m8*r->m2 + l->m9*r->m6 + l->m10*r->m10 + l->m11*r->m14;
+        mat.m11 = l->m8*r->m3 + l->m9*r->m7 + l->m10*r->m11 + l->m11*r->m15;
+        mat.m12 = l->m12*r->m0 + l->m13*r->m4 + l->m14*r->m8 + l->m15*r->m12;
+        mat.m13 = l->m12*r->m1 + l->m13*r->m5 + l->m14*r->m9 + l->m15*r->m13;
+        mat.m14 = l->m12*r->m2 + l->m13*r->m6 + l->m14*r->m10 + l->m15*r->m14;
+        mat.m15 = l->m12*r->m3 + l->m13*r->m7 + l->m14*r->m11 + l->m15*r->m15;
+
+        result[i] = mat;
+#endif
+    }
+}
+
+// Normalize quaternions, quaternions provided as separate x, y, z, w arrays (SoA)
+// NOTE: Quaternions are normalized in place
+rl_RMAPI void QuaternionNormalizeBatch(float *x, float *y, float *z, float *w, int count)
+{
+    int i = 0;
+
+#if defined(RAYMATH_AVX_ENABLED)
+    for (; (i + 8) <= count; i += 8)
+    {
+        __m256 qx = _mm256_loadu_ps(x + i);
+        __m256 qy = _mm256_loadu_ps(y + i);
+        __m256 qz = _mm256_loadu_ps(z + i);
+        __m256 qw = _mm256_loadu_ps(w + i);
+
+        __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(qx, qx), _mm256_mul_ps(qy, qy)), _mm256_mul_ps(qz, qz)), _mm256_mul_ps(qw, qw)));
+        __m256 one = _mm256_set1_ps(1.0f);
+        length = _mm256_blendv_ps(length, one, _mm256_cmp_ps(length, _mm256_setzero_ps(), _CMP_EQ_OQ));
+        __m256 ilength = _mm256_div_ps(one, length);
+
+        _mm256_storeu_ps(x + i, _mm256_mul_ps(qx, ilength));
+        _mm256_storeu_ps(y + i, _mm256_mul_ps(qy, ilength));
+        _mm256_storeu_ps(z + i, _mm256_mul_ps(qz, ilength));
+        _mm256_storeu_ps(w + i, _mm256_mul_ps(qw, ilength));
+    }
+#endif
+#if defined(RAYMATH_SSE_ENABLED)
+    for (; (i + 4) <= count; i += 4)
+    {
+        __m128 qx = _mm_loadu_ps(x + i);
+        __m128 qy = _mm_loadu_ps(y + i);
+        __m128 qz = _mm_loadu_ps(z + i);
+        __m128 qw = _mm_loadu_ps(w + i);
+
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(qx, qx), _mm_mul_ps(qy, qy)), _mm_mul_ps(qz, qz)), _mm_mul_ps(qw, qw)));
+        __m128 one = _mm_set1_ps(1.0f);
+        __m128 zero = _mm_cmpeq_ps(length, _mm_setzero_ps());
+        length = _mm_or_ps(_mm_andnot_ps(zero, length), _mm_and_ps(zero, one));
+        __m128 ilength = _mm_div_ps(one, length);
+
+        _mm_storeu_ps(x + i, _mm_mul_ps(qx, ilength));
+        _mm_storeu_ps(y + i, _mm_mul_ps(qy, ilength));
+        _mm_storeu_ps(z + i, _mm_mul_ps(qz, ilength));
+        _mm_storeu_ps(w + i, _mm_mul_ps(qw, ilength));
+    }
+#elif defined(RAYMATH_NEON_ENABLED) && (defined(__aarch64__) || defined(_M_ARM64))
+    // NOTE: Vector square root and division only available on AArch64
+    for (; (i + 4) <= count; i += 4)
+    {
+        float32x4_t qx = vld1q_f32(x + i);
+        float32x4_t qy = vld1q_f32(y + i);
+        float32x4_t qz = vld1q_f32(z + i);
+        float32x4_t qw = vld1q_f32(w + i);
+
+        float32x4_t length = vsqrtq_f32(vaddq_f32(vaddq_f32(vaddq_f32(vmulq_f32(qx, qx), vmulq_f32(qy, qy)), vmulq_f32(qz, qz)), vmulq_f32(qw, qw)));
+        float32x4_t one = vdupq_n_f32(1.0f);
+        length = vbslq_f32(vceqq_f32(length, vdupq_n_f32(0.0f)), one, length);
+        float32x4_t ilength = vdivq_f32(one, length);
+
+        vst1q_f32(x + i, vmulq_f32(qx, ilength));
+        vst1q_f32(y + i, vmulq_f32(qy, ilength));
+        vst1q_f32(z + i, vmulq_f32(qz, ilength));
+        vst1q_f32(w + i, vmulq_f32(qw, ilength));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float length = sqrtf(x[i]*x[i] + y[i]*y[i] + z[i]*z[i] + w[i]*w[i]);
+        if (length == 0.0f) length = 1.0f;
+        float ilength = 1.0f/length;
+
+        x[i] *= ilength;
+        y[i] *= ilength;
+        z[i] *= ilength;
+        w[i] *= ilength;
+    }
+}
+
 #if defined(__cplusplus) && !defined(RAYMATH_DISABLE_CPP_OPERATORS)
 
 // Optional C++ math operators
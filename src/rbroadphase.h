@@ -0,0 +1,1050 @@
+/**********************************************************************************************
+*
+*   rbroadphase - Broadphase collision detection for many moving 2d/3d objects
+*
+*   DESCRIPTION:
+*       Objects are stored as proxies (rl_Rectangle or rl_BoundingBox bounds) in an acceleration
+*       structure updated incrementally when they move, overlapping pairs and bounds queries only
+*       test nearby proxies instead of all of them, avoiding O(n^2) pairwise collision checks
+*
+*       Two broadphase types are available:
+*           BROADPHASE_DYNAMIC_TREE - Balanced AABB tree, proxies are stored with enlarged (fat) bounds
+*                                     so small moves do not require tree updates, any objects sizes
+*           BROADPHASE_UNIFORM_GRID - Hashed uniform grid, proxies are stored in every cell they touch,
+*                                     fast for similar sized objects, cell size should fit the objects
+*
+*   CONFIGURATION:
+*       #define RBROADPHASE_IMPLEMENTATION
+*           Generates the implementation of the library into the included file.
+*           If not defined, the library is in header only mode and can be included in other headers
+*           or source files without problems. But only ONE file should hold the implementation.
+*
+*   DEPENDENCIES:
+*       raylib.h    - rl_Rectangle, rl_BoundingBox types
+*
+*   USAGE:
+*       rl_Broadphase *broadphase = rl_LoadBroadphase(BROADPHASE_DYNAMIC_TREE, 4.0f);
+*       int id = rl_AddBroadphaseRec(broadphase, rec);      // Proxy id, used to move or remove it
+*       rl_MoveBroadphaseRec(broadphase, id, rec);          // Update proxy bounds when object moves
+*
+*       int count = rl_GetBroadphasePairs(broadphase, pairs, MAX_PAIRS);     // Overlapping proxies pairs
+*       rl_UnloadBroadphase(broadphase);
+*
+*   NOTE: Rectangles are stored as flat boxes (z = 0), rectangles and boxes share the same proxies
+*   space and can be mixed. Bounds touching on their borders are considered overlapping
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RBROADPHASE_H
+#define RBROADPHASE_H
+
+// Function specifiers in case library is build/used as a shared library (Windows)
+// NOTE: Microsoft specifiers to tell compiler that symbols are imported/exported from a .dll
+#if defined(_WIN32)
+    #if defined(BUILD_LIBTYPE_SHARED)
+        #define rl_RLAPI __declspec(dllexport)     // We are building raylib as a Win32 shared library (.dll)
+    #elif defined(USE_LIBTYPE_SHARED)
+        #define rl_RLAPI __declspec(dllimport)     // We are using raylib as a Win32 shared library (.dll)
+    #endif
+#endif
+
+// Function specifiers definition
+#ifndef rl_RLAPI
+    #define rl_RLAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef RBROADPHASE_GRID_MAX_CELLS
+    #define RBROADPHASE_GRID_MAX_CELLS          4096    // Maximum grid cells covered by a proxy, larger proxies are clamped
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Broadphase type
+typedef enum {
+    BROADPHASE_DYNAMIC_TREE = 0,        // Dynamic AABB tree, size parameter is the bounds margin
+    BROADPHASE_UNIFORM_GRID             // Uniform grid (hashed), size parameter is the cell size
+} rl_BroadphaseType;
+
+// Broadphase overlapping proxies pair
+typedef struct rl_BroadphasePair {
+    int proxyA;                 // First proxy id (smaller id)
+    int proxyB;                 // Second proxy id
+} rl_BroadphasePair;
+
+// Opaque struct declaration
+// NOTE: Actual struct is defined internally in the implementation
+typedef struct rl_Broadphase rl_Broadphase;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+rl_RLAPI rl_Broadphase *rl_LoadBroadphase(int type, float size);        // Load broadphase, size is tree bounds margin or grid cell size
+rl_RLAPI void rl_UnloadBroadphase(rl_Broadphase *broadphase);           // Unload broadphase and all its proxies
+rl_RLAPI int rl_AddBroadphaseBox(rl_Broadphase *broadphase, rl_BoundingBox box);   // Add box proxy, returns proxy id or -1 on failure
+rl_RLAPI int rl_AddBroadphaseRec(rl_Broadphase *broadphase, rl_Rectangle rec);     // Add rectangle proxy, returns proxy id or -1 on failure
+rl_RLAPI void rl_MoveBroadphaseBox(rl_Broadphase *broadphase, int id, rl_BoundingBox box); // Update box proxy bounds
+rl_RLAPI void rl_MoveBroadphaseRec(rl_Broadphase *broadphase, int id, rl_Rectangle rec);   // Update rectangle proxy bounds
+rl_RLAPI void rl_RemoveBroadphaseProxy(rl_Broadphase *broadphase, int id); // Remove proxy, its id can be reused by new proxies
+rl_RLAPI int rl_GetBroadphasePairs(rl_Broadphase *broadphase, rl_BroadphasePair *pairs, int maxPairs); // Get overlapping proxies pairs, returns total pairs (can exceed maxPairs)
+rl_RLAPI int rl_QueryBroadphaseBox(rl_Broadphase *broadphase, rl_BoundingBox box, int *ids, int maxIds); // Get proxies overlapping box, returns total proxies (can exceed maxIds)
+rl_RLAPI int rl_QueryBroadphaseRec(rl_Broadphase *broadphase, rl_Rectangle rec, int *ids, int maxIds);   // Get proxies overlapping rectangle, returns total proxies (can exceed maxIds)
+rl_RLAPI int rl_GetBroadphaseProxyCount(const rl_Broadphase *broadphase); // Get number of proxies in broadphase
+rl_RLAPI int rl_GetBroadphaseTestCount(const rl_Broadphase *broadphase);  // Get number of bounds overlap tests performed since last reset
+rl_RLAPI void rl_ResetBroadphaseTestCount(rl_Broadphase *broadphase);     // Reset bounds overlap tests counter
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RBROADPHASE_H
+
+/***********************************************************************************
+*
+*   RBROADPHASE IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RBROADPHASE_IMPLEMENTATION)
+
+#include <stdlib.h>         // Required for: RL_CALLOC(), RL_REALLOC(), RL_FREE()
+#include <math.h>           // Required for: floorf()
+
+#ifndef RL_CALLOC
+    #define RL_CALLOC(n,sz)     calloc(n,sz)
+#endif
+#ifndef RL_REALLOC
+    #define RL_REALLOC(ptr,sz)  realloc(ptr,sz)
+#endif
+#ifndef RL_FREE
+    #define RL_FREE(p)          free(p)
+#endif
+#ifndef TRACELOG
+    #define TRACELOG(level, ...) rl_TraceLog(level, __VA_ARGS__)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RBROADPHASE_NULL           -1       // Null node/proxy index
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Broadphase proxy
+typedef struct BroadphaseProxy {
+    rl_BoundingBox box;         // Proxy bounds
+    bool active;                // Proxy in use
+    int next;                   // Next free proxy (when not in use)
+    int node;                   // Tree: leaf node index
+    int cellMin[3];             // Grid: first cell covered
+    int cellMax[3];             // Grid: last cell covered
+    int stamp;                  // Grid: last query visiting the proxy
+} BroadphaseProxy;
+
+// Dynamic tree node
+// NOTE: Leaves have no children (child1 is RBROADPHASE_NULL), free nodes height is -1
+typedef struct BroadphaseNode {
+    rl_BoundingBox box;         // Node bounds, leaves store proxy bounds enlarged by margin
+    int parent;                 // Parent node, next free node when not in use
+    int child1;                 // First child node
+    int child2;                 // Second child node
+    int height;                 // Node height, leaves are 0
+    int proxy;                  // Leaf proxy id
+} BroadphaseNode;
+
+// Uniform grid cell, cells are stored in an open addressing hash table
+typedef struct BroadphaseCell {
+    int x, y, z;                // Cell coordinates
+    bool used;                  // Hash table slot in use
+    int count;                  // Number of proxies in cell
+    int capacity;               // Proxies array capacity
+    int *proxies;               // Proxies ids in cell
+} BroadphaseCell;
+
+// Broadphase data
+struct rl_Broadphase {
+    int type;                   // Broadphase type (rl_BroadphaseType)
+    float size;                 // Tree bounds margin or grid cell size
+    int testCount;              // Bounds overlap tests performed
+
+    BroadphaseProxy *proxies;   // Proxies array
+    int proxyCapacity;          // Proxies array capacity
+    int proxyCount;             // Proxies in use
+    int freeProxy;              // First free proxy
+
+    BroadphaseNode *nodes;      // Tree: nodes array
+    int nodeCapacity;           // Tree: nodes array capacity
+    int freeNode;               // Tree: first free node
+    int root;                   // Tree: root node
+
+    BroadphaseCell *cells;      // Grid: cells hash table
+    int cellCapacity;           // Grid: hash table capacity (power of two)
+    int cellCount;              // Grid: hash table slots in use
+    int stamp;                  // Grid: current query stamp
+
+    int *stack;                 // Traversal stack
+    int stackCapacity;          // Traversal stack capacity
+};
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool CheckBroadphaseBoxes(rl_Broadphase *broadphase, rl_BoundingBox box1, rl_BoundingBox box2); // Check bounds overlap, counting the test
+static rl_BoundingBox GetBroadphaseBoxUnion(rl_BoundingBox box1, rl_BoundingBox box2); // Get bounds enclosing both bounds
+static float GetBroadphaseBoxArea(rl_BoundingBox box);                  // Get bounds surface area (tree insertion cost)
+static void PushBroadphaseStack(rl_Broadphase *broadphase, int *count, int value); // Push value into traversal stack
+
+static int AllocBroadphaseNode(rl_Broadphase *broadphase);              // Tree: allocate node
+static void FreeBroadphaseNode(rl_Broadphase *broadphase, int node);    // Tree: free node
+static void InsertBroadphaseLeaf(rl_Broadphase *broadphase, int leaf);  // Tree: insert leaf, choosing sibling with lowest cost
+static void RemoveBroadphaseLeaf(rl_Broadphase *broadphase, int leaf);  // Tree: remove leaf
+static int BalanceBroadphaseNode(rl_Broadphase *broadphase, int node);  // Tree: rotate node if unbalanced, returns the new subtree root
+static void RefitBroadphaseAncestors(rl_Broadphase *broadphase, int node); // Tree: balance and refit bounds up to the root
+
+static void GetBroadphaseCellRange(const rl_Broadphase *broadphase, rl_BoundingBox box, int *cellMin, int *cellMax); // Grid: get cells covered by bounds
+static BroadphaseCell *GetBroadphaseCell(rl_Broadphase *broadphase, int x, int y, int z, bool create); // Grid: find cell, creating it if required
+static void InsertBroadphaseCells(rl_Broadphase *broadphase, int id);  // Grid: add proxy to covered cells
+static void RemoveBroadphaseCells(rl_Broadphase *broadphase, int id);  // Grid: remove proxy from covered cells
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load broadphase
+// NOTE: Tree margin enlarges stored bounds, larger margins reduce tree updates of moving proxies
+rl_Broadphase *rl_LoadBroadphase(int type, float size)
+{
+    if ((type == BROADPHASE_UNIFORM_GRID) && (size <= 0.0f))
+    {
+        TRACELOG(LOG_WARNING, "BROADPHASE: Uniform grid cell size must be greater than 0");
+        return NULL;
+    }
+
+    rl_Broadphase *broadphase = (rl_Broadphase *)RL_CALLOC(1, sizeof(rl_Broadphase));
+
+    broadphase->type = type;
+    broadphase->size = (size > 0.0f)? size : 0.0f;
+    broadphase->freeProxy = RBROADPHASE_NULL;
+    broadphase->freeNode = RBROADPHASE_NULL;
+    broadphase->root = RBROADPHASE_NULL;
+
+    TRACELOG(LOG_INFO, "BROADPHASE: %s loaded successfully", (type == BROADPHASE_UNIFORM_GRID)? "Uniform grid" : "Dynamic tree");
+
+    return broadphase;
+}
+
+// Unload broadphase and all its proxies
+void rl_UnloadBroadphase(rl_Broadphase *broadphase)
+{
+    if (broadphase == NULL) return;
+
+    for (int i = 0; i < broadphase->cellCapacity; i++) RL_FREE(broadphase->cells[i].proxies);
+
+    RL_FREE(broadphase->cells);
+    RL_FREE(broadphase->nodes);
+    RL_FREE(broadphase->proxies);
+    RL_FREE(broadphase->stack);
+    RL_FREE(broadphase);
+}
+
+// Add box proxy, returns proxy id or -1 on failure
+int rl_AddBroadphaseBox(rl_Broadphase *broadphase, rl_BoundingBox box)
+{
+    if (broadphase == NULL) return -1;
+
+    // Get a free proxy, growing proxies array if required
+    if (broadphase->freeProxy == RBROADPHASE_NULL)
+    {
+        int capacity = (broadphase->proxyCapacity > 0)? broadphase->proxyCapacity*2 : 64;
+        BroadphaseProxy *proxies = (BroadphaseProxy *)RL_REALLOC(broadphase->proxies, capacity*sizeof(BroadphaseProxy));
+        if (proxies == NULL) return -1;
+
+        for (int i = broadphase->proxyCapacity; i < capacity; i++)
+        {
+            proxies[i].active = false;
+            proxies[i].next = ((i + 1) < capacity)? (i + 1) : RBROADPHASE_NULL;
+        }
+
+        broadphase->freeProxy = broadphase->proxyCapacity;
+        broadphase->proxies = proxies;
+        broadphase->proxyCapacity = capacity;
+    }
+
+    int id = broadphase->freeProxy;
+    BroadphaseProxy *proxy = &broadphase->proxies[id];
+
+    broadphase->freeProxy = proxy->next;
+    broadphase->proxyCount++;
+
+    proxy->box = box;
+    proxy->active = true;
+    proxy->next = RBROADPHASE_NULL;
+    proxy->node = RBROADPHASE_NULL;
+    proxy->stamp = 0;
+
+    if (broadphase->type == BROADPHASE_UNIFORM_GRID) InsertBroadphaseCells(broadphase, id);
+    else
+    {
+        int node = AllocBroadphaseNode(broadphase);
+        float margin = broadphase->size;
+
+        broadphase->nodes[node].box.min = CLITERAL(rl_Vector3){ box.min.x - margin, box.min.y - margin, box.min.z - margin };
+        broadphase->nodes[node].box.max = CLITERAL(rl_Vector3){ box.max.x + margin, box.max.y + margin, box.max.z + margin };
+        broadphase->nodes[node].height = 0;
+        broadphase->nodes[node].proxy = id;
+        broadphase->proxies[id].node = node;
+
+        InsertBroadphaseLeaf(broadphase, node);
+    }
+
+    return id;
+}
+
+// Add rectangle proxy, returns proxy id or -1 on failure
+int rl_AddBroadphaseRec(rl_Broadphase *broadphase, rl_Rectangle rec)
+{
+    rl_BoundingBox box = { { rec.x, rec.y, 0.0f }, { rec.x + rec.width, rec.y + rec.height, 0.0f } };
+
+    return rl_AddBroadphaseBox(broadphase, box);
+}
+
+// Update box proxy bounds
+// NOTE: Tree is only updated if new bounds are not contained in proxy enlarged bounds
+void rl_MoveBroadphaseBox(rl_Broadphase *broadphase, int id, rl_BoundingBox box)
+{
+    if ((broadphase == NULL) || (id < 0) || (id >= broadphase->proxyCapacity) || !broadphase->proxies[id].active) return;
+
+    BroadphaseProxy *proxy = &broadphase->proxies[id];
+
+    if (broadphase->type == BROADPHASE_UNIFORM_GRID)
+    {
+        int cellMin[3] = { 0 };
+        int cellMax[3] = { 0 };
+        GetBroadphaseCellRange(broadphase, box, cellMin, cellMax);
+
+        bool sameCells = true;
+        for (int i = 0; i < 3; i++) if ((cellMin[i] != proxy->cellMin[i]) || (cellMax[i] != proxy->cellMax[i])) sameCells = false;
+
+        if (sameCells) proxy->box = box;
+        else
+        {
+            RemoveBroadphaseCells(broadphase, id);
+            proxy->box = box;
+            InsertBroadphaseCells(broadphase, id);
+        }
+    }
+    else
+    {
+        proxy->box = box;
+
+        BroadphaseNode *node = &broadphase->nodes[proxy->node];
+        bool contained = (box.min.x >= node->box.min.x) && (box.min.y >= node->box.min.y) && (box.min.z >= node->box.min.z) &&
+                         (box.max.x <= node->box.max.x) && (box.max.y <= node->box.max.y) && (box.max.z <= node->box.max.z);
+
+        if (!contained)
+        {
+            float margin = broadphase->size;
+
+            RemoveBroadphaseLeaf(broadphase, proxy->node);
+
+            node = &broadphase->nodes[proxy->node];
+            node->box.min = CLITERAL(rl_Vector3){ box.min.x - margin, box.min.y - margin, box.min.z - margin };
+            node->box.max = CLITERAL(rl_Vector3){ box.max.x + margin, box.max.y + margin, box.max.z + margin };
+
+            InsertBroadphaseLeaf(broadphase, proxy->node);
+        }
+    }
+}
+
+// Update rectangle proxy bounds
+void rl_MoveBroadphaseRec(rl_Broadphase *broadphase, int id, rl_Rectangle rec)
+{
+    rl_BoundingBox box = { { rec.x, rec.y, 0.0f }, { rec.x + rec.width, rec.y + rec.height, 0.0f } };
+
+    rl_MoveBroadphaseBox(broadphase, id, box);
+}
+
+// Remove proxy, its id can be reused by new proxies
+void rl_RemoveBroadphaseProxy(rl_Broadphase *broadphase, int id)
+{
+    if ((broadphase == NULL) || (id < 0) || (id >= broadphase->proxyCapacity) || !broadphase->proxies[id].active) return;
+
+    BroadphaseProxy *proxy = &broadphase->proxies[id];
+
+    if (broadphase->type == BROADPHASE_UNIFORM_GRID) RemoveBroadphaseCells(broadphase, id);
+    else
+    {
+        RemoveBroadphaseLeaf(broadphase, proxy->node);
+        FreeBroadphaseNode(broadphase, proxy->node);
+        proxy->node = RBROADPHASE_NULL;
+    }
+
+    proxy->active = false;
+    proxy->next = broadphase->freeProxy;
+    broadphase->freeProxy = id;
+    broadphase->proxyCount--;
+}
+
+// Get overlapping proxies pairs, returns total pairs (can exceed maxPairs)
+// NOTE: Every pair is reported once, with proxyA < proxyB
+int rl_GetBroadphasePairs(rl_Broadphase *broadphase, rl_BroadphasePair *pairs, int maxPairs)
+{
+    int count = 0;
+
+    if (broadphase == NULL) return count;
+
+    if (broadphase->type == BROADPHASE_UNIFORM_GRID)
+    {
+        for (int c = 0; c < broadphase->cellCapacity; c++)
+        {
+            BroadphaseCell *cell = &broadphase->cells[c];
+            if (!cell->used) continue;
+
+            for (int i = 0; i < cell->count; i++)
+            {
+                for (int j = i + 1; j < cell->count; j++)
+                {
+                    const BroadphaseProxy *proxyA = &broadphase->proxies[cell->proxies[i]];
+                    const BroadphaseProxy *proxyB = &broadphase->proxies[cell->proxies[j]];
+
+                    if (!CheckBroadphaseBoxes(broadphase, proxyA->box, proxyB->box)) continue;
+
+                    // Pairs sharing several cells are only reported by the cell containing the overlap minimum corner
+                    rl_BoundingBox overlap = { 0 };
+                    overlap.min.x = (proxyA->box.min.x > proxyB->box.min.x)? proxyA->box.min.x : proxyB->box.min.x;
+                    overlap.min.y = (proxyA->box.min.y > proxyB->box.min.y)? proxyA->box.min.y : proxyB->box.min.y;
+                    overlap.min.z = (proxyA->box.min.z > proxyB->box.min.z)? proxyA->box.min.z : proxyB->box.min.z;
+                    overlap.max = overlap.min;
+
+                    int cellMin[3] = { 0 };
+                    int cellMax[3] = { 0 };
+                    GetBroadphaseCellRange(broadphase, overlap, cellMin, cellMax);
+
+                    // Cells clamped for huge proxies could miss the overlap corner, then the first shared cell reports it
+                    for (int k = 0; k < 3; k++)
+                    {
+                        int first = (proxyA->cellMin[k] > proxyB->cellMin[k])? proxyA->cellMin[k] : proxyB->cellMin[k];
+                        int last = (proxyA->cellMax[k] < proxyB->cellMax[k])? proxyA->cellMax[k] : proxyB->cellMax[k];
+                        if ((cellMin[k] < first) || (cellMin[k] > last)) cellMin[k] = first;
+                    }
+
+                    if ((cellMin[0] != cell->x) || (cellMin[1] != cell->y) || (cellMin[2] != cell->z)) continue;
+
+                    if (count < maxPairs)
+                    {
+                        int idA = cell->proxies[i];
+                        int idB = cell->proxies[j];
+                        pairs[count].proxyA = (idA < idB)? idA : idB;
+                        pairs[count].proxyB = (idA < idB)? idB : idA;
+                    }
+                    count++;
+                }
+            }
+        }
+    }
+    else if (broadphase->root != RBROADPHASE_NULL)
+    {
+        // Every proxy queries the tree, pairs are reported by the proxy with smaller id
+        for (int id = 0; id < broadphase->proxyCapacity; id++)
+        {
+            const BroadphaseProxy *proxy = &broadphase->proxies[id];
+            if (!proxy->active) continue;
+
+            rl_BoundingBox box = proxy->box;
+            int stackCount = 0;
+            PushBroadphaseStack(broadphase, &stackCount, broadphase->root);
+
+            while (stackCount > 0)
+            {
+                const BroadphaseNode *node = &broadphase->nodes[broadphase->stack[--stackCount]];
+
+                if (node->child1 == RBROADPHASE_NULL)
+                {
+                    if ((node->proxy <= id) || !CheckBroadphaseBoxes(broadphase, box, broadphase->proxies[node->proxy].box)) continue;
+
+                    if (count < maxPairs)
+                    {
+                        pairs[count].proxyA = id;
+                        pairs[count].proxyB = node->proxy;
+                    }
+                    count++;
+                }
+                else if (CheckBroadphaseBoxes(broadphase, box, node->box))
+                {
+                    int child1 = node->child1;
+                    int child2 = node->child2;
+                    PushBroadphaseStack(broadphase, &stackCount, child1);
+                    PushBroadphaseStack(broadphase, &stackCount, child2);
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+// Get proxies overlapping box, returns total proxies (can exceed maxIds)
+int rl_QueryBroadphaseBox(rl_Broadphase *broadphase, rl_BoundingBox box, int *ids, int maxIds)
+{
+    int count = 0;
+
+    if (broadphase == NULL) return count;
+
+    if (broadphase->type == BROADPHASE_UNIFORM_GRID)
+    {
+        int cellMin[3] = { 0 };
+        int cellMax[3] = { 0 };
+        GetBroadphaseCellRange(broadphase, box, cellMin, cellMax);
+
+        // Proxies covering several cells are only tested once per query
+        broadphase->stamp++;
+
+        for (int z = cellMin[2]; z <= cellMax[2]; z++)
+        {
+            for (int y = cellMin[1]; y <= cellMax[1]; y++)
+            {
+                for (int x = cellMin[0]; x <= cellMax[0]; x++)
+                {
+                    const BroadphaseCell *cell = GetBroadphaseCell(broadphase, x, y, z, false);
+                    if (cell == NULL) continue;
+
+                    for (int i = 0; i < cell->count; i++)
+                    {
+                        BroadphaseProxy *proxy = &broadphase->proxies[cell->proxies[i]];
+                        if (proxy->stamp == broadphase->stamp) continue;
+                        proxy->stamp = broadphase->stamp;
+
+                        if (CheckBroadphaseBoxes(broadphase, box, proxy->box))
+                        {
+                            if (count < maxIds) ids[count] = cell->proxies[i];
+                            count++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    else if (broadphase->root != RBROADPHASE_NULL)
+    {
+        int stackCount = 0;
+        PushBroadphaseStack(broadphase, &stackCount, broadphase->root);
+
+        while (stackCount > 0)
+        {
+            const BroadphaseNode *node = &broadphase->nodes[broadphase->stack[--stackCount]];
+
+            if (node->child1 == RBROADPHASE_NULL)
+            {
+                if (CheckBroadphaseBoxes(broadphase, box, broadphase->proxies[node->proxy].box))
+                {
+                    if (count < maxIds) ids[count] = node->proxy;
+                    count++;
+                }
+            }
+            else if (CheckBroadphaseBoxes(broadphase, box, node->box))
+            {
+                int child1 = node->child1;
+                int child2 = node->child2;
+                PushBroadphaseStack(broadphase, &stackCount, child1);
+                PushBroadphaseStack(broadphase, &stackCount, child2);
+            }
+        }
+    }
+
+    return count;
+}
+
+// Get proxies overlapping rectangle, returns total proxies (can exceed maxIds)
+int rl_QueryBroadphaseRec(rl_Broadphase *broadphase, rl_Rectangle rec, int *ids, int maxIds)
+{
+    rl_BoundingBox box = { { rec.x, rec.y, 0.0f }, { rec.x + rec.width, rec.y + rec.height, 0.0f } };
+
+    return rl_QueryBroadphaseBox(broadphase, box, ids, maxIds);
+}
+
+// Get number of proxies in broadphase
+int rl_GetBroadphaseProxyCount(const rl_Broadphase *broadphase)
+{
+    return (broadphase != NULL)? broadphase->proxyCount : 0;
+}
+
+// Get number of bounds overlap tests performed since last reset
+int rl_GetBroadphaseTestCount(const rl_Broadphase *broadphase)
+{
+    return (broadphase != NULL)? broadphase->testCount : 0;
+}
+
+// Reset bounds overlap tests counter
+void rl_ResetBroadphaseTestCount(rl_Broadphase *broadphase)
+{
+    if (broadphase != NULL) broadphase->testCount = 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Check bounds overlap, counting the test
+static bool CheckBroadphaseBoxes(rl_Broadphase *broadphase, rl_BoundingBox box1, rl_BoundingBox box2)
+{
+    broadphase->testCount++;
+
+    return ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x) &&
+            (box1.max.y >= box2.min.y) && (box1.min.y <= box2.max.y) &&
+            (box1.max.z >= box2.min.z) && (box1.min.z <= box2.max.z));
+}
+
+// Get bounds enclosing both bounds
+static rl_BoundingBox GetBroadphaseBoxUnion(rl_BoundingBox box1, rl_BoundingBox box2)
+{
+    rl_BoundingBox box = { 0 };
+
+    box.min.x = (box1.min.x < box2.min.x)? box1.min.x : box2.min.x;
+    box.min.y = (box1.min.y < box2.min.y)? box1.min.y : box2.min.y;
+    box.min.z = (box1.min.z < box2.min.z)? box1.min.z : box2.min.z;
+    box.max.x = (box1.max.x > box2.max.x)? box1.max.x : box2.max.x;
+    box.max.y = (box1.max.y > box2.max.y)? box1.max.y : box2.max.y;
+    box.max.z = (box1.max.z > box2.max.z)? box1.max.z : box2.max.z;
+
+    return box;
+}
+
+// Get bounds surface area (tree insertion cost)
+// NOTE: Edges length is added so flat (2d) and degenerated bounds still have a meaningful cost
+static float GetBroadphaseBoxArea(rl_BoundingBox box)
+{
+    float width = box.max.x - box.min.x;
+    float height = box.max.y - box.min.y;
+    float length = box.max.z - box.min.z;
+
+    return (2.0f*(width*height + height*length + length*width) + (width + height + length));
+}
+
+// Push value into traversal stack
+static void PushBroadphaseStack(rl_Broadphase *broadphase, int *count, int value)
+{
+    if (*count >= broadphase->stackCapacity)
+    {
+        int capacity = (broadphase->stackCapacity > 0)? broadphase->stackCapacity*2 : 64;
+        broadphase->stack = (int *)RL_REALLOC(broadphase->stack, capacity*sizeof(int));
+        broadphase->stackCapacity = capacity;
+    }
+
+    broadphase->stack[(*count)++] = value;
+}
+
+// Tree: allocate node
+// NOTE: Nodes array can be reallocated, node pointers must be fetched again after calling it
+static int AllocBroadphaseNode(rl_Broadphase *broadphase)
+{
+    if (broadphase->freeNode == RBROADPHASE_NULL)
+    {
+        int capacity = (broadphase->nodeCapacity > 0)? broadphase->nodeCapacity*2 : 128;
+        broadphase->nodes = (BroadphaseNode *)RL_REALLOC(broadphase->nodes, capacity*sizeof(BroadphaseNode));
+
+        for (int i = broadphase->nodeCapacity; i < capacity; i++)
+        {
+            broadphase->nodes[i].parent = ((i + 1) < capacity)? (i + 1) : RBROADPHASE_NULL;
+            broadphase->nodes[i].height = -1;
+        }
+
+        broadphase->freeNode = broadphase->nodeCapacity;
+        broadphase->nodeCapacity = capacity;
+    }
+
+    int index = broadphase->freeNode;
+    BroadphaseNode *node = &broadphase->nodes[index];
+
+    broadphase->freeNode = node->parent;
+    node->parent = RBROADPHASE_NULL;
+    node->child1 = RBROADPHASE_NULL;
+    node->child2 = RBROADPHASE_NULL;
+    node->height = 0;
+    node->proxy = RBROADPHASE_NULL;
+
+    return index;
+}
+
+// Tree: free node
+static void FreeBroadphaseNode(rl_Broadphase *broadphase, int node)
+{
+    broadphase->nodes[node].parent = broadphase->freeNode;
+    broadphase->nodes[node].height = -1;
+    broadphase->freeNode = node;
+}
+
+// Tree: insert leaf, choosing sibling with lowest cost
+// NOTE: Cost is the new parent area plus the area increase of all ancestors (surface area heuristic)
+static void InsertBroadphaseLeaf(rl_Broadphase *broadphase, int leaf)
+{
+    if (broadphase->root == RBROADPHASE_NULL)
+    {
+        broadphase->root = leaf;
+        broadphase->nodes[leaf].parent = RBROADPHASE_NULL;
+        return;
+    }
+
+    // Find best sibling for leaf
+    rl_BoundingBox leafBox = broadphase->nodes[leaf].box;
+    int index = broadphase->root;
+
+    while (broadphase->nodes[index].child1 != RBROADPHASE_NULL)
+    {
+        const BroadphaseNode *node = &broadphase->nodes[index];
+        int child1 = node->child1;
+        int child2 = node->child2;
+
+        float area = GetBroadphaseBoxArea(node->box);
+        float combinedArea = GetBroadphaseBoxArea(GetBroadphaseBoxUnion(node->box, leafBox));
+
+        float cost = 2.0f*combinedArea;                         // Cost of creating a new parent for this node and leaf
+        float inheritanceCost = 2.0f*(combinedArea - area);     // Minimum cost of pushing leaf further down
+
+        float cost1 = GetBroadphaseBoxArea(GetBroadphaseBoxUnion(leafBox, broadphase->nodes[child1].box)) + inheritanceCost;
+        if (broadphase->nodes[child1].child1 != RBROADPHASE_NULL) cost1 -= GetBroadphaseBoxArea(broadphase->nodes[child1].box);
+
+        float cost2 = GetBroadphaseBoxArea(GetBroadphaseBoxUnion(leafBox, broadphase->nodes[child2].box)) + inheritanceCost;
+        if (broadphase->nodes[child2].child1 != RBROADPHASE_NULL) cost2 -= GetBroadphaseBoxArea(broadphase->nodes[child2].box);
+
+        if ((cost < cost1) && (cost < cost2)) break;
+
+        index = (cost1 < cost2)? child1 : child2;
+    }
+
+    int sibling = index;
+
+    // Create new parent for sibling and leaf
+    int oldParent = broadphase->nodes[sibling].parent;
+    int newParent = AllocBroadphaseNode(broadphase);
+    BroadphaseNode *nodes = broadphase->nodes;
+
+    nodes[newParent].parent = oldParent;
+    nodes[newParent].box = GetBroadphaseBoxUnion(leafBox, nodes[sibling].box);
+    nodes[newParent].height = nodes[sibling].height + 1;
+    nodes[newParent].child1 = sibling;
+    nodes[newParent].child2 = leaf;
+    nodes[sibling].parent = newParent;
+    nodes[leaf].parent = newParent;
+
+    if (oldParent != RBROADPHASE_NULL)
+    {
+        if (nodes[oldParent].child1 == sibling) nodes[oldParent].child1 = newParent;
+        else nodes[oldParent].child2 = newParent;
+    }
+    else broadphase->root = newParent;
+
+    RefitBroadphaseAncestors(broadphase, oldParent);
+}
+
+// Tree: remove leaf
+// NOTE: Leaf node is not freed, it can be inserted again
+static void RemoveBroadphaseLeaf(rl_Broadphase *broadphase, int leaf)
+{
+    BroadphaseNode *nodes = broadphase->nodes;
+
+    if (leaf == broadphase->root)
+    {
+        broadphase->root = RBROADPHASE_NULL;
+        return;
+    }
+
+    int parent = nodes[leaf].parent;
+    int grandParent = nodes[parent].parent;
+    int sibling = (nodes[parent].child1 == leaf)? nodes[parent].child2 : nodes[parent].child1;
+
+    if (grandParent != RBROADPHASE_NULL)
+    {
+        // Replace parent by sibling
+        if (nodes[grandParent].child1 == parent) nodes[grandParent].child1 = sibling;
+        else nodes[grandParent].child2 = sibling;
+
+        nodes[sibling].parent = grandParent;
+        FreeBroadphaseNode(broadphase, parent);
+
+        RefitBroadphaseAncestors(broadphase, grandParent);
+    }
+    else
+    {
+        broadphase->root = sibling;
+        nodes[sibling].parent = RBROADPHASE_NULL;
+        FreeBroadphaseNode(broadphase, parent);
+    }
+
+    nodes[leaf].parent = RBROADPHASE_NULL;
+}
+
+// Tree: rotate node if unbalanced, returns the new subtree root
+// NOTE: Based on Box2D dynamic tree balancing, the higher child is rotated up
+static int BalanceBroadphaseNode(rl_Broadphase *broadphase, int iA)
+{
+    BroadphaseNode *nodes = broadphase->nodes;
+    BroadphaseNode *A = &nodes[iA];
+
+    if ((A->child1 == RBROADPHASE_NULL) || (A->height < 2)) return iA;
+
+    int iB = A->child1;
+    int iC = A->child2;
+    BroadphaseNode *B = &nodes[iB];
+    BroadphaseNode *C = &nodes[iC];
+
+    int balance = C->height - B->height;
+
+    if (balance > 1)
+    {
+        // Rotate C up
+        int iF = C->child1;
+        int iG = C->child2;
+        BroadphaseNode *F = &nodes[iF];
+        BroadphaseNode *G = &nodes[iG];
+
+        C->child1 = iA;
+        C->parent = A->parent;
+        A->parent = iC;
+
+        if (C->parent != RBROADPHASE_NULL)
+        {
+            if (nodes[C->parent].child1 == iA) nodes[C->parent].child1 = iC;
+            else nodes[C->parent].child2 = iC;
+        }
+        else broadphase->root = iC;
+
+        if (F->height > G->height)
+        {
+            C->child2 = iF;
+            A->child2 = iG;
+            G->parent = iA;
+            A->box = GetBroadphaseBoxUnion(B->box, G->box);
+            C->box = GetBroadphaseBoxUnion(A->box, F->box);
+            A->height = 1 + ((B->height > G->height)? B->height : G->height);
+            C->height = 1 + ((A->height > F->height)? A->height : F->height);
+        }
+        else
+        {
+            C->child2 = iG;
+            A->child2 = iF;
+            F->parent = iA;
+            A->box = GetBroadphaseBoxUnion(B->box, F->box);
+            C->box = GetBroadphaseBoxUnion(A->box, G->box);
+            A->height = 1 + ((B->height > F->height)? B->height : F->height);
+            C->height = 1 + ((A->height > G->height)? A->height : G->height);
+        }
+
+        return iC;
+    }
+
+    if (balance < -1)
+    {
+        // Rotate B up
+        int iD = B->child1;
+        int iE = B->child2;
+        BroadphaseNode *D = &nodes[iD];
+        BroadphaseNode *E = &nodes[iE];
+
+        B->child1 = iA;
+        B->parent = A->parent;
+        A->parent = iB;
+
+        if (B->parent != RBROADPHASE_NULL)
+        {
+            if (nodes[B->parent].child1 == iA) nodes[B->parent].child1 = iB;
+            else nodes[B->parent].child2 = iB;
+        }
+        else broadphase->root = iB;
+
+        if (D->height > E->height)
+        {
+            B->child2 = iD;
+            A->child1 = iE;
+            E->parent = iA;
+            A->box = GetBroadphaseBoxUnion(C->box, E->box);
+            B->box = GetBroadphaseBoxUnion(A->box, D->box);
+            A->height = 1 + ((C->height > E->height)? C->height : E->height);
+            B->height = 1 + ((A->height > D->height)? A->height : D->height);
+        }
+        else
+        {
+            B->child2 = iE;
+            A->child1 = iD;
+            D->parent = iA;
+            A->box = GetBroadphaseBoxUnion(C->box, D->box);
+            B->box = GetBroadphaseBoxUnion(A->box, E->box);
+            A->height = 1 + ((C->height > D->height)? C->height : D->height);
+            B->height = 1 + ((A->height > E->height)? A->height : E->height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
+
+// Tree: balance and refit bounds up to the root
+static void RefitBroadphaseAncestors(rl_Broadphase *broadphase, int node)
+{
+    int index = node;
+
+    while (index != RBROADPHASE_NULL)
+    {
+        index = BalanceBroadphaseNode(broadphase, index);
+
+        BroadphaseNode *current = &broadphase->nodes[index];
+        const BroadphaseNode *child1 = &broadphase->nodes[current->child1];
+        const BroadphaseNode *child2 = &broadphase->nodes[current->child2];
+
+        current->height = 1 + ((child1->height > child2->height)? child1->height : child2->height);
+        current->box = GetBroadphaseBoxUnion(child1->box, child2->box);
+
+        index = current->parent;
+    }
+}
+
+// Grid: get cells covered by bounds
+// NOTE: Cells range is clamped to RBROADPHASE_GRID_MAX_CELLS per axis to limit huge proxies cost
+static void GetBroadphaseCellRange(const rl_Broadphase *broadphase, rl_BoundingBox box, int *cellMin, int *cellMax)
+{
+    const float *min = &box.min.x;
+    const float *max = &box.max.x;
+
+    for (int i = 0; i < 3; i++)
+    {
+        cellMin[i] = (int)floorf(min[i]/broadphase->size);
+        cellMax[i] = (int)floorf(max[i]/broadphase->size);
+
+        if (cellMax[i] < cellMin[i]) cellMax[i] = cellMin[i];
+        if ((cellMax[i] - cellMin[i]) >= RBROADPHASE_GRID_MAX_CELLS) cellMax[i] = cellMin[i] + RBROADPHASE_GRID_MAX_CELLS - 1;
+    }
+}
+
+// Grid: find cell, creating it if required
+// NOTE: Cells are never removed from hash table, empty cells are reused when proxies enter them again
+static BroadphaseCell *GetBroadphaseCell(rl_Broadphase *broadphase, int x, int y, int z, bool create)
+{
+    // Grow hash table to keep load factor under 0.5
+    if (create && (((broadphase->cellCount + 1)*2) > broadphase->cellCapacity))
+    {
+        int capacity = (broadphase->cellCapacity > 0)? broadphase->cellCapacity*2 : 1024;
+        BroadphaseCell *cells = (BroadphaseCell *)RL_CALLOC(capacity, sizeof(BroadphaseCell));
+
+        for (int i = 0; i < broadphase->cellCapacity; i++)
+        {
+            const BroadphaseCell *cell = &broadphase->cells[i];
+            if (!cell->used) continue;
+
+            unsigned int hash = ((unsigned int)cell->x*73856093u) ^ ((unsigned int)cell->y*19349663u) ^ ((unsigned int)cell->z*83492791u);
+            unsigned int slot = hash & (capacity - 1);
+            while (cells[slot].used) slot = (slot + 1) & (capacity - 1);
+            cells[slot] = *cell;
+        }
+
+        RL_FREE(broadphase->cells);
+        broadphase->cells = cells;
+        broadphase->cellCapacity = capacity;
+    }
+
+    if (broadphase->cellCapacity == 0) return NULL;
+
+    unsigned int hash = ((unsigned int)x*73856093u) ^ ((unsigned int)y*19349663u) ^ ((unsigned int)z*83492791u);
+    unsigned int slot = hash & (broadphase->cellCapacity - 1);
+
+    while (broadphase->cells[slot].used)
+    {
+        BroadphaseCell *cell = &broadphase->cells[slot];
+        if ((cell->x == x) && (cell->y == y) && (cell->z == z)) return cell;
+        slot = (slot + 1) & (broadphase->cellCapacity - 1);
+    }
+
+    if (!create) return NULL;
+
+    BroadphaseCell *cell = &broadphase->cells[slot];
+    cell->x = x;
+    cell->y = y;
+    cell->z = z;
+    cell->used = true;
+    cell->count = 0;
+    broadphase->cellCount++;
+
+    return cell;
+}
+
+// Grid: add proxy to covered cells
+static void InsertBroadphaseCells(rl_Broadphase *broadphase, int id)
+{
+    BroadphaseProxy *proxy = &broadphase->proxies[id];
+    GetBroadphaseCellRange(broadphase, proxy->box, proxy->cellMin, proxy->cellMax);
+
+    for (int z = proxy->cellMin[2]; z <= proxy->cellMax[2]; z++)
+    {
+        for (int y = proxy->cellMin[1]; y <= proxy->cellMax[1]; y++)
+        {
+            for (int x = proxy->cellMin[0]; x <= proxy->cellMax[0]; x++)
+            {
+                BroadphaseCell *cell = GetBroadphaseCell(broadphase, x, y, z, true);
+
+                if (cell->count >= cell->capacity)
+                {
+                    int capacity = (cell->capacity > 0)? cell->capacity*2 : 8;
+                    cell->proxies = (int *)RL_REALLOC(cell->proxies, capacity*sizeof(int));
+                    cell->capacity = capacity;
+                }
+
+                cell->proxies[cell->count++] = id;
+            }
+        }
+    }
+}
+
+// Grid: remove proxy from covered cells
+static void RemoveBroadphaseCells(rl_Broadphase *broadphase, int id)
+{
+    const BroadphaseProxy *proxy = &broadphase->proxies[id];
+
+    for (int z = proxy->cellMin[2]; z <= proxy->cellMax[2]; z++)
+    {
+        for (int y = proxy->cellMin[1]; y <= proxy->cellMax[1]; y++)
+        {
+            for (int x = proxy->cellMin[0]; x <= proxy->cellMax[0]; x++)
+            {
+                BroadphaseCell *cell = GetBroadphaseCell(broadphase, x, y, z, false);
+                if (cell == NULL) continue;
+
+                for (int i = 0; i < cell->count; i++)
+                {
+                    if (cell->proxies[i] == id)
+                    {
+                        cell->proxies[i] = cell->proxies[cell->count - 1];
+                        cell->count--;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif // RBROADPHASE_IMPLEMENTATION
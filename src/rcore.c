@@ -30,6 +30,8 @@
 *           - Windows (Win32, Win64)
 *       > PLATFORM_MEMORY
 *           - Memory framebuffer output, using software renderer, no OS required
+*       > PLATFORM_HEADLESS
+*           - Linux offscreen rendering, using EGL device/surfaceless platforms, no display server required
 *   CONFIGURATION:
 *       #define SUPPORT_DEFAULT_FONT (default)
 *           Default font is loaded on window initialization to be available for the user to render simple text
@@ -62,6 +64,10 @@
 *       #define SUPPORT_AUTOMATION_EVENTS
 *           Support automatic events recording and playing, useful for automated testing systems or AI based game playing
 *
+*       #define SUPPORT_PERF_RUN
+*           Support performance runs set by environment variables (RAYLIB_PERF_RUN), programs run unmodified for a number
+*           of frames replaying recorded input, frame times, draw calls and allocations are exported as JSON
+*
 *   DEPENDENCIES:
 *       raymath  - 3D math functionality (rl_Vector2, rl_Vector3, rl_Matrix, rl_Quaternion)
 *       camera   - Multiple 3D camera modes (free, orbital, 1st person, 3rd person)
@@ -97,9 +103,9 @@
     #define _XOPEN_SOURCE 500       // Required for: readlink if compiled with c99 without GNU extensions
 #endif
 
-#if (defined(__linux__) || defined(PLATFORM_WEB) || defined(PLATFORM_WEB_RGFW)) && (_POSIX_C_SOURCE < 199309L)
+#if (defined(__linux__) || defined(PLATFORM_WEB) || defined(PLATFORM_WEB_RGFW)) && (_POSIX_C_SOURCE < 200112L)
     #undef _POSIX_C_SOURCE
-    #define _POSIX_C_SOURCE 199309L // Required for: CLOCK_MONOTONIC if compiled with c99 without GNU extensions
+    #define _POSIX_C_SOURCE 200112L // Required for: CLOCK_MONOTONIC, clock_nanosleep() if compiled with c99 without GNU extensions
 #endif
 
 #include "raylib.h"                 // Declares module functions
@@ -109,20 +115,86 @@
     #include "config.h"             // Defines module configuration flags
 #endif
 
+#define RL_MEMORY_MODULE MEMORY_MODULE_CORE      // Memory tracking allocations module
 #include "utils.h"                  // Required for: TRACELOG() macros
 
 #include <stdlib.h>                 // Required for: srand(), rand(), atexit()
 #include <stdio.h>                  // Required for: sprintf() [Used in rl_OpenURL()]
 #include <string.h>                 // Required for: strlen(), strncpy(), strcmp(), strrchr(), memset()
-#include <time.h>                   // Required for: time() [Used in InitTimer()]
+#include <time.h>                   // Required for: time() [Used in InitTimer()], clock_nanosleep() [Used in rl_WaitTime()]
+#include <errno.h>                  // Required for: EINTR [Used in rl_WaitTime()]
 #include <math.h>                   // Required for: tan() [Used in rl_BeginMode3D()], atan2f() [Used in rl_LoadVrStereoConfig()]
 
 #if defined(PLATFORM_MEMORY) || defined(PLATFORM_WEB)
     #define SW_GL_FRAMEBUFFER_COPY_BGRA false
 #endif
+// Render thread is only supported on GLFW desktop platform with POSIX threads
+#if defined(SUPPORT_RENDER_THREAD)
+    #if !(defined(PLATFORM_DESKTOP) || defined(PLATFORM_DESKTOP_GLFW)) || (defined(_WIN32) && !defined(__MINGW32__))
+        #undef SUPPORT_RENDER_THREAD
+    #elif !defined(RLGL_ENABLE_COMMAND_BUFFERS)
+        #define RLGL_ENABLE_COMMAND_BUFFERS     // Render thread replays frames recorded on main thread
+    #endif
+#endif
+
+// Multiple windows are only supported on GLFW and SDL desktop platforms
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+    #if !(defined(PLATFORM_DESKTOP) || defined(PLATFORM_DESKTOP_GLFW) || defined(PLATFORM_DESKTOP_SDL))
+        #undef SUPPORT_MULTIPLE_WINDOWS
+    #endif
+#endif
+
+// Thread contexts are only supported on headless platform, windowing systems are not thread safe
+#if defined(RLGL_ENABLE_THREAD_CONTEXTS) && !defined(PLATFORM_HEADLESS)
+    #undef RLGL_ENABLE_THREAD_CONTEXTS
+#endif
+
+// Render batch flushes measured by CPU profiler
+#if defined(SUPPORT_CPU_PROFILER)
+    #define RL_PROFILE_ZONE_BEGIN(name) PROFILE_ZONE_BEGIN(name)
+    #define RL_PROFILE_ZONE_END() PROFILE_ZONE_END()
+#endif
+
 #define RLGL_IMPLEMENTATION
 #include "rlgl.h"                   // OpenGL abstraction layer to OpenGL 1.1, 3.3+ or ES2
 
+#if defined(SUPPORT_RENDER_THREAD) && !defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    #undef SUPPORT_RENDER_THREAD        // Command buffers not available (OpenGL 1.1)
+#endif
+#if defined(SUPPORT_MULTIPLE_WINDOWS) && !(defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3))
+    #undef SUPPORT_MULTIPLE_WINDOWS     // Framebuffer blit not available, required to present secondary windows
+#endif
+#if defined(SUPPORT_DIRECTORY_SCAN_THREADS)
+    #if defined(PLATFORM_WEB) || (defined(_WIN32) && !defined(__MINGW32__))
+        #undef SUPPORT_DIRECTORY_SCAN_THREADS
+    #endif
+#endif
+#if defined(SUPPORT_COMPRESSION_THREADS)
+    #if !defined(SUPPORT_COMPRESSION_API) || defined(PLATFORM_WEB) || (defined(_WIN32) && !defined(__MINGW32__))
+        #undef SUPPORT_COMPRESSION_THREADS
+    #endif
+#endif
+#if defined(SUPPORT_RENDER_THREAD) || defined(SUPPORT_DIRECTORY_SCAN_THREADS) || defined(SUPPORT_COMPRESSION_THREADS)
+    #include <pthread.h>                // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*()
+#endif
+
+// Hardware accelerated hashing, enabled when supported by compiler target architecture
+// NOTE: Requires compiler flags, i.e. x86: -mpclmul -msse4.1 -msha, ARM: -march=armv8-a+crc+crypto
+#if defined(__PCLMUL__) && defined(__SSE4_1__)
+    #include <immintrin.h>              // Required for: PCLMULQDQ and SSE4.1 intrinsics [Used in UpdateCRC32()]
+    #define RCORE_CRC32_PCLMUL_ENABLED
+#elif defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>               // Required for: __crc32d() [Used in UpdateCRC32()]
+    #define RCORE_CRC32_ARM_ENABLED
+#endif
+#if defined(__SHA__) && defined(__SSE4_1__)
+    #include <immintrin.h>              // Required for: SHA extensions intrinsics [Used in ProcessBlocksSHA1(), ProcessBlocksSHA256()]
+    #define RCORE_SHA_NI_ENABLED
+#elif defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO)
+    #include <arm_neon.h>               // Required for: ARMv8 cryptography extensions intrinsics [Used in ProcessBlocksSHA1(), ProcessBlocksSHA256()]
+    #define RCORE_SHA_ARM_ENABLED
+#endif
+
 #define RAYMATH_IMPLEMENTATION
 #include "raymath.h"                // rl_Vector2, rl_Vector3, rl_Quaternion and rl_Matrix functionality
 
@@ -183,6 +255,11 @@
     #include <mach-o/dyld.h>
 #endif // OSs
 
+#if defined(SUPPORT_ASSETS_HOT_RELOAD) && defined(__linux__)
+    #include <sys/inotify.h>        // Required for: inotify_init1(), inotify_add_watch() [Used in WatchAssetFile()]
+    #include <unistd.h>             // Required for: read(), close() [Used in UpdateAssetsWatcher()]
+#endif
+
 #define _CRT_INTERNAL_NONSTDC_NAMES  1
 #include <sys/stat.h>               // Required for: stat(), S_ISREG [Used in rl_GetFileModTime(), IsFilePath()]
 
@@ -218,7 +295,19 @@
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_FILEPATH_CAPACITY
-    #define MAX_FILEPATH_CAPACITY       8192        // Maximum capacity for filepath
+    #define MAX_FILEPATH_CAPACITY       8192        // Initial capacity for filepaths scanning, grows as required
+#endif
+#ifndef MAX_DIRECTORY_SCAN_THREADS
+    #define MAX_DIRECTORY_SCAN_THREADS     4        // Maximum number of threads scanning subdirectories (caller thread included)
+#endif
+#ifndef COMPRESSION_BLOCK_SIZE
+    #define COMPRESSION_BLOCK_SIZE    262144        // Compressed blocks stream block size (bytes), blocks are compressed independently
+#endif
+#ifndef MAX_COMPRESSION_THREADS
+    #define MAX_COMPRESSION_THREADS        8        // Maximum number of threads processing compressed blocks (caller thread included)
+#endif
+#ifndef FILE_HASH_CHUNK_SIZE
+    #define FILE_HASH_CHUNK_SIZE       65536        // File data chunk size read on file hash computation (bytes)
 #endif
 #ifndef MAX_FILEPATH_LENGTH
     #if defined(_WIN32)
@@ -228,6 +317,36 @@
     #endif
 #endif
 
+#ifndef SHADER_CACHE_DIRECTORY
+    #define SHADER_CACHE_DIRECTORY  "shadercache"   // Shader program binary cache directory, relative to storage base path
+#endif
+
+#ifndef MAX_RENDER_THREAD_FRAMES
+    #define MAX_RENDER_THREAD_FRAMES       4        // Maximum number of frames queued for render thread
+#endif
+
+#ifndef MAX_SECONDARY_WINDOWS
+    #define MAX_SECONDARY_WINDOWS          8        // Maximum number of secondary windows opened at once
+#endif
+
+#ifndef FRAME_PACING_HISTOGRAM_STEP
+    #define FRAME_PACING_HISTOGRAM_STEP  0.5f       // Frame times histogram bin size (in milliseconds)
+#endif
+#define FRAME_PACING_HISTOGRAM_BINS       64        // Frame times histogram bins (rl_FramePacingStats)
+
+#ifndef PERF_RUN_DEFAULT_FRAMES
+    #define PERF_RUN_DEFAULT_FRAMES      600        // Performance run measured frames, if not set by RAYLIB_PERF_FRAMES
+#endif
+#ifndef PERF_RUN_WARMUP_FRAMES
+    #define PERF_RUN_WARMUP_FRAMES        10        // Performance run first frames not measured (shaders compilation, resources upload)
+#endif
+#ifndef PERF_RUN_FRAME_TIME
+    #define PERF_RUN_FRAME_TIME  (1.0f/60.0f)       // Performance run fixed frame time returned by rl_GetFrameTime()
+#endif
+#ifndef PERF_RUN_RANDOM_SEED
+    #define PERF_RUN_RANDOM_SEED    20260101        // Performance run random seed, same generated values on every run
+#endif
+
 #ifndef MAX_KEYBOARD_KEYS
     #define MAX_KEYBOARD_KEYS            512        // Maximum number of keyboard keys supported
 #endif
@@ -264,12 +383,16 @@
 #endif
 
 #ifndef MAX_AUTOMATION_EVENTS
-    #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
+    #define MAX_AUTOMATION_EVENTS      16384        // Initial capacity of automation events list (grows as required)
+#endif
+
+#ifndef MAX_INPUT_EVENTS_QUEUE
+    #define MAX_INPUT_EVENTS_QUEUE      1024        // Maximum number of input events queued, must be a power of two
 #endif
 
 #ifndef DIRECTORY_FILTER_TAG
     #define DIRECTORY_FILTER_TAG       "DIR"        // Name tag used to request directory inclusion on directory scan
-#endif                                              // NOTE: Used in ScanDirectoryFiles(), ScanDirectoryFilesRecursively() and rl_LoadDirectoryFilesEx()
+#endif                                              // NOTE: Used in IsDirectoryEntryIncluded() for rl_LoadDirectoryFilesEx() and rl_ScanDirectoryFiles()
 
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
@@ -277,6 +400,28 @@
 #define FLAG_TOGGLE(n, f) ((n) ^= (f))
 #define FLAG_IS_SET(n, f) (((n) & (f)) == (f))
 
+// Little-endian 32bit values read/write macros, used by compressed blocks stream
+#define READ_U32_LE(ptr) ((unsigned int)(ptr)[0] | ((unsigned int)(ptr)[1] << 8) | ((unsigned int)(ptr)[2] << 16) | ((unsigned int)(ptr)[3] << 24))
+#define WRITE_U32_LE(ptr, value) do { unsigned int v = (unsigned int)(value); \
+    (ptr)[0] = (unsigned char)v; (ptr)[1] = (unsigned char)(v >> 8); (ptr)[2] = (unsigned char)(v >> 16); (ptr)[3] = (unsigned char)(v >> 24); } while (0)
+
+#if defined(SUPPORT_INPUT_EVENTS)
+// Atomic operations on 32bit values, used by input events queue
+// NOTE: Load/store with acquire/release semantics, compare-exchange returns true on success
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+    #define ATOMIC_LOAD(ptr) ((unsigned int)_InterlockedOr((volatile long *)(ptr), 0))
+    #define ATOMIC_STORE(ptr, value) _InterlockedExchange((volatile long *)(ptr), (long)(value))
+    #define ATOMIC_CAS(ptr, expected, desired) (_InterlockedCompareExchange((volatile long *)(ptr), (long)(desired), (long)(expected)) == (long)(expected))
+    #define ATOMIC_INCREMENT(ptr) _InterlockedExchangeAdd((volatile long *)(ptr), 1)
+#else
+    #define ATOMIC_LOAD(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+    #define ATOMIC_STORE(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+    #define ATOMIC_CAS(ptr, expected, desired) __sync_bool_compare_and_swap((ptr), (expected), (desired))
+    #define ATOMIC_INCREMENT(ptr) __atomic_fetch_add((ptr), 1, __ATOMIC_RELAXED)
+#endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -292,6 +437,8 @@ typedef struct CoreData {
         bool shouldClose;                   // Check if window set for closing
         bool resizedLastFrame;              // Check if window has been resized last frame
         bool eventWaiting;                  // Wait for events before ending frame
+        double eventWaitingTimeout;         // Events waiting timeout in seconds (0: wait indefinitely)
+        bool skipSwap;                      // Skip buffers swap on current frame (screen content unchanged)
         bool usingFbo;                      // Using FBO (rl_RenderTexture) for rendering instead of default framebuffer
 
         Size display;                       // Display width and height (monitor, device-screen, LCD, ...)
@@ -302,6 +449,7 @@ typedef struct CoreData {
         Size render;                        // Screen framebuffer width and height
         Point renderOffset;                 // Screen framebuffer render offset (Not required anymore?)
         Size currentFbo;                    // Current framebuffer render width and height (depends on active render texture)
+        unsigned int currentFboId;          // Current framebuffer id (0 for default framebuffer)
         Size screenMin;                     // Screen minimum width and height (for resizable window)
         Size screenMax;                     // Screen maximum width and height (for resizable window)
         rl_Matrix screenScale;                 // rl_Matrix to scale screen (framebuffer rendering)
@@ -314,6 +462,10 @@ typedef struct CoreData {
         const char *basePath;               // Base path for data storage
 
     } Storage;
+    struct {
+        double origin[3];                   // Render origin in world coordinates, drawn at (0, 0, 0) (camera-relative rendering)
+
+    } World;
     struct {
         struct {
             int exitKey;                    // Default exit key
@@ -367,6 +519,27 @@ typedef struct CoreData {
             float axisState[MAX_GAMEPADS][MAX_GAMEPAD_AXES];                // Gamepad axes state
 
         } Gamepad;
+#if defined(SUPPORT_INPUT_EVENTS)
+        struct {
+            // NOTE: Bounded multi-producer single-consumer queue, every slot sequence number tells
+            // if the slot is free to write (sequence == tail) or ready to read (sequence == head + 1)
+            struct {
+                volatile unsigned int sequence;     // Slot sequence number
+                rl_InputEvent event;                // Slot event data
+            } slots[MAX_INPUT_EVENTS_QUEUE];
+            volatile unsigned int tail;             // Next write position (producers)
+            unsigned int head;                      // Next read position (consumer)
+            volatile unsigned int dropped;          // Events dropped because queue was full
+
+            bool gamepadReady[MAX_GAMEPADS];        // Gamepad ready state on previous poll
+            float gamepadAxis[MAX_GAMEPADS][MAX_GAMEPAD_AXES]; // Gamepad axes state on previous poll
+    #if defined(SUPPORT_GESTURES_SYSTEM)
+            GestureTouchEvent touchEvents[MAX_GESTURE_TOUCH_EVENTS]; // Touch events batch for multi-touch gestures (main thread)
+            int touchEventCount;                    // Touch events batch count
+    #endif
+
+        } Events;
+#endif
     } Input;
     struct {
         double current;                     // Current time measure
@@ -386,10 +559,10 @@ typedef struct CoreData {
 //----------------------------------------------------------------------------------
 rl_RLAPI const char *raylib_version = rl_RAYLIB_VERSION;  // raylib version exported symbol, required for some bindings
 
-CoreData CORE = { 0 };                      // Global CORE state context
+RL_CONTEXT_LOCAL CoreData CORE = { 0 };     // Global CORE state context (per thread, RLGL_ENABLE_THREAD_CONTEXTS)
 
 #if defined(SUPPORT_SCREEN_CAPTURE)
-static int screenshotCounter = 0;           // Screenshots counter
+static RL_CONTEXT_LOCAL int screenshotCounter = 0;  // Screenshots counter
 #endif
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
@@ -474,9 +647,221 @@ struct rl_AutomationEvent {
 };
 */
 
-static rl_AutomationEventList *currentEventList = NULL;        // Current automation events list, set by user, keep internal pointer
-static bool automationEventRecording = false;               // Recording automation events flag
+static RL_CONTEXT_LOCAL rl_AutomationEventList *currentEventList = NULL;   // Current automation events list, set by user, keep internal pointer
+static RL_CONTEXT_LOCAL bool automationEventRecording = false;             // Recording automation events flag
 //static short automationEventEnabled = 0b0000001111111111; // TODO: Automation events enabled for recording/playing
+
+// Automation events binary format
+//   Header (8 bytes): 'rAEB' | version (u8) | flags (u8) | reserved (u16)
+//   Event: frame delta (zigzag varint) | type (u8) | params mask (u8) | params deltas (zigzag varints, one per mask bit)
+// NOTE: Params deltas are relative to previous event of same type,
+// events data is a compressed blocks stream if AUTOMATION_BINARY_COMPRESSED flag is set
+#define AUTOMATION_BINARY_VERSION       1
+#define AUTOMATION_BINARY_HEADER_SIZE   8
+#define AUTOMATION_BINARY_COMPRESSED    0x01
+#define AUTOMATION_EVENT_MAX_SIZE      27       // Maximum encoded event size: 5 + 1 + 1 + 4*5 bytes
+#define AUTOMATION_EVENT_TYPES         32       // Maximum event types supported by binary format
+
+// Automation events delta coding state
+typedef struct AutomationEventCoder {
+    unsigned int frame;                 // Previous event frame
+    int params[AUTOMATION_EVENT_TYPES][4]; // Previous event params, per event type
+} AutomationEventCoder;
+
+// Automation events stream, streamed recording to file or streamed playback from file
+struct rl_AutomationEventStream {
+    FILE *file;                         // Events file
+    AutomationEventCoder coder;         // Events delta coding state
+    rl_CompressionStream *compression;  // Events data compression stream (NULL if not compressed)
+    unsigned char *buffer;              // Events data (encoded) pending to be written or read
+    int bufferSize;                     // Events data size
+    int bufferCapacity;                 // Events data buffer capacity
+    int bufferOffset;                   // Events data read offset (playback)
+    rl_AutomationEventList list;        // Frame events recorded (recording)
+    rl_AutomationEventList *previousList; // Events list set before recording started (recording)
+    bool end;                           // File end reached (playback)
+    bool failed;                        // Stream read/write failed
+};
+
+static RL_CONTEXT_LOCAL rl_AutomationEventStream *automationEventStream = NULL; // Automation events recording stream
+#endif
+//-----------------------------------------------------------------------------------
+
+#if defined(SUPPORT_RENDER_THREAD)
+// Render thread data
+// NOTE: Main thread records frames into command buffers, render thread replays them and swaps buffers
+typedef struct RenderThreadData {
+    pthread_t thread;                   // Render thread handle
+    pthread_mutex_t mutex;              // Frames queue mutex
+    pthread_cond_t cond;                // Frames queue condition (frame queued/released)
+    rlCommandBuffer frames[MAX_RENDER_THREAD_FRAMES];  // Frames command buffers (ring)
+    int depth;                          // Frames queue depth (max frames in flight)
+    int head;                           // Next frame to be rendered
+    int count;                          // Frames queued, pending to be rendered
+    bool active;                        // Render thread running
+    bool quit;                          // Render thread quit request
+    bool skipSwap[MAX_RENDER_THREAD_FRAMES];    // Frames skipping buffers swap (rl_SkipScreenBufferSwap())
+} RenderThreadData;
+
+static RenderThreadData renderThread = { 0 };
+#endif
+
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+// Secondary window data
+// NOTE: Drawing is done on main graphics context into window render target (resources are shared),
+// render target is presented to window by platform on drawing end
+typedef struct SecondaryWindowData {
+    rl_RenderTexture2D target;          // Window render target, sized to window framebuffer
+    bool ready;                         // Window initialized
+} SecondaryWindowData;
+
+static SecondaryWindowData secondaryWindows[MAX_SECONDARY_WINDOWS] = { 0 };
+static int currentSecondaryWindow = 0;  // Secondary window being drawn (0: none)
+#endif
+
+// Frame pacing data
+typedef struct FramePacingData {
+    int mode;                           // Frame pacing mode (rl_FramePacingMode)
+    double target;                      // Target time used for current deadline
+    double deadline;                    // Current frame deadline (0.0: resync on next frame)
+    double refreshPeriod;               // Monitor refresh period (FRAME_PACING_VSYNC)
+    double overshoot;                   // Sleep overshoot estimate, busy waited at sleep end
+    double spin;                        // Last frame busy wait time
+    double frameTimeSum;                // Frame times sum (stats average)
+    double frameJitterSum;              // Frame times deviations sum (stats jitter)
+    rl_FramePacingStats stats;          // Frame pacing stats
+#if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
+    void *timer;                        // High resolution waitable timer (HANDLE)
+    bool timerChecked;                  // High resolution waitable timer creation tried
+#endif
+} FramePacingData;
+
+static RL_CONTEXT_LOCAL FramePacingData framePacing = { 0 };
+static rl_StartupStats startupStats = { 0 };    // rl_InitWindow() phases timings
+
+#if defined(SUPPORT_PERF_RUN)
+// Performance run data
+// NOTE: Set by environment variables on rl_InitWindow():
+//   RAYLIB_PERF_RUN=<file>       Results JSON file, performance run is enabled if defined
+//   RAYLIB_PERF_FRAMES=<count>   Measured frames, warmup frames not included (PERF_RUN_DEFAULT_FRAMES)
+//   RAYLIB_PERF_EVENTS=<file>    Automation events file replayed as input (text or binary)
+//   RAYLIB_PERF_RECORD=<file>    Automation events binary file to record input to (to be replayed on next runs)
+typedef struct PerfRunData {
+    bool active;                        // Performance run enabled
+    char fileName[MAX_FILEPATH_LENGTH]; // Results JSON file
+    int frameCount;                     // Measured frames required
+    int frame;                          // Frames drawn since performance run start
+    int measured;                       // Measured frames
+    bool exported;                      // Results exported
+    float *frameTimes;                  // Measured frame times (update + draw, milliseconds)
+    long long drawCalls;                // Draw calls submitted on measured frames
+    long long vertices;                 // Vertices submitted on measured frames
+    long long allocations;              // Tagged memory allocations on measured frames
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    rl_AutomationEventList events;      // Automation events replayed
+    int eventIndex;                     // Next automation event to replay
+    bool recording;                     // Recording input to automation events file
+#endif
+} PerfRunData;
+
+static PerfRunData perfRun = { 0 };
+#endif
+
+#if defined(SUPPORT_COMPRESSION_API)
+// Compressed blocks stream format
+//   Header (12 bytes): 'rCMP' | version (u8) | codec (u8) | reserved (u16) | block size (u32)
+//   Block (8 bytes + data): raw size (u32) | compressed size (u32, COMPRESSED_BLOCK_STORED if data is stored) | data
+//   End (8 bytes): raw size = 0 (u32) | CRC32 of uncompressed data (u32)
+// NOTE: All values are little-endian, blocks are compressed independently (parallel and streamed processing)
+#define COMPRESSED_STREAM_VERSION       1
+#define COMPRESSED_STREAM_HEADER_SIZE  12
+#define COMPRESSED_BLOCK_HEADER_SIZE    8
+#define COMPRESSED_BLOCK_STORED        0x80000000u
+
+// Compression block, processed by compression workers
+typedef struct CompressionBlock {
+    const unsigned char *input;         // Block input data
+    int inputSize;                      // Block input data size
+    unsigned char *output;              // Block output data (compression: allocated, decompression: final data location)
+    int outputSize;                     // Block output data size
+    bool stored;                        // Block compressed data is stored (not compressible)
+    bool success;                       // Block processed successfully
+} CompressionBlock;
+
+// Compression work, blocks are picked by workers until none is left
+typedef struct CompressionWork {
+    CompressionBlock *blocks;           // Blocks to process
+    int blockCount;                     // Blocks count
+    int nextBlock;                      // Next block to be processed
+    int codec;                          // Compression codec (rl_CompressionCodec)
+    bool decompress;                    // Work type: decompression or compression
+#if defined(SUPPORT_COMPRESSION_THREADS)
+    pthread_mutex_t mutex;              // Next block mutex
+#endif
+} CompressionWork;
+
+// Compression stream state
+struct rl_CompressionStream {
+    int codec;                          // Compression codec (rl_CompressionCodec)
+    bool decompress;                    // Stream type: decompression or compression
+    CompressionStreamCallback callback; // Output data callback
+    void *userData;                     // Output data callback user data
+    unsigned char *buffer;              // Input data pending to be processed
+    int bufferSize;                     // Input data pending size
+    int bufferCapacity;                 // Input data buffer capacity
+    unsigned char *output;              // Block output data
+    unsigned int blockSize;             // Stream block size
+    unsigned int crc;                   // Uncompressed data CRC32 (not inverted)
+    struct sdefl *sdefl;                // Deflate compressor state
+    bool header;                        // Stream header processed
+    bool finished;                      // Stream end processed (decompression)
+    bool failed;                        // Stream failed, further data is ignored
+};
+#endif
+
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+// Shader loaded from files, program is reloaded in place when any of its files changes
+typedef struct ShaderFilesEntry {
+    unsigned int id;                    // Shader program id
+    int *locs;                          // Shader locations array, shared with user shader copies
+    char *vsFileName;                   // Vertex shader file name (NULL if default)
+    char *fsFileName;                   // Fragment shader file name (NULL if default)
+} ShaderFilesEntry;
+
+// Watched asset file
+typedef struct WatchedAssetFile {
+    char *fileName;                     // File name, as provided on asset load
+    long modTime;                       // File modification time
+    int directory;                      // Watched directory index (-1 if file is polled)
+    bool changed;                       // File changed, pending reload
+} WatchedAssetFile;
+
+#if defined(__linux__)
+// Watched directory, file system events are received for all its files
+typedef struct WatchedDirectory {
+    int wd;                             // inotify watch descriptor
+    char *path;                         // Directory path
+} WatchedDirectory;
+#endif
+
+// Assets watcher, changed files are reloaded by rl_BeginDrawing()
+static struct {
+    ShaderFilesEntry *shaders;          // Shaders loaded from files
+    int shaderCount;                    // Shaders count
+    int shaderCapacity;                 // Shaders allocated
+    WatchedAssetFile *files;            // Watched files
+    int fileCount;                      // Watched files count
+    int fileCapacity;                   // Watched files allocated
+    int nextPollFile;                   // Next file to poll, files without file system events
+    AssetReloadedCallback callback;     // Asset reloaded callback
+#if defined(__linux__)
+    bool initialized;                   // File system events initialization attempted
+    int fd;                             // inotify instance (-1 if not available)
+    WatchedDirectory *directories;      // Watched directories
+    int directoryCount;                 // Watched directories count
+    int directoryCapacity;              // Watched directories allocated
+#endif
+} assetsWatcher = { 0 };
 #endif
 //-----------------------------------------------------------------------------------
 
@@ -489,23 +874,140 @@ static bool automationEventRecording = false;               // Recording automat
 extern void LoadFontDefault(void);      // [Module: text] Loads default font on rl_InitWindow()
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_MODULE_RSHAPES)
+extern void UnloadShapesShaders(void);  // [Module: shapes] Unloads SDF and instanced shapes shaders
+#endif
+#if defined(SUPPORT_MODULE_RTEXT)
+extern void UnloadTextShaders(void);    // [Module: text] Unloads SDF fonts shaders
+extern void UnloadTextShapingCache(void); // [Module: text] Unloads shaped text layouts cache
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+extern void UpdateRenderTexturePool(bool unloadIdle);   // [Module: textures] Recycle render textures handed out for current frame
+extern void UnloadRenderTexturePool(void);              // [Module: textures] Unload all pooled render textures
+extern void BeginRenderTexturePoolPass(unsigned int id); // [Module: textures] Invalidate pooled render texture contents on first pass
+extern void EndRenderTexturePoolPass(unsigned int id);  // [Module: textures] Invalidate pooled render texture depth at pass end
+extern void CloseImageWorkerThreads(void);              // [Module: textures] Close image filters worker threads
+extern void UnloadImageShaders(void);                   // [Module: textures] Unload render texture processing shaders
+extern void UpdateTextureStreams(void);                 // [Module: textures] Update texture streams, stream in requested levels and evict over budget
+extern void UnloadTextureStreams(void);                 // [Module: textures] Unload all texture streams
+#if defined(SUPPORT_SHARED_TEXTURES)
+extern void UnloadSharedTextures(void);                 // [Module: textures] Unload shared textures registry
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+extern bool ReloadSharedTextureFile(const char *fileName); // [Module: textures] Reload shared texture by resource file
+#endif
+#endif
+#endif
 
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
+#if defined(SUPPORT_RENDER_THREAD)
+extern void SetGraphicsContextCurrent(bool current); // Set graphics context current on calling thread (or release it)
+#endif
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+extern bool InitPlatformSecondaryWindow(int index, int width, int height, const char *title); // Initialize platform secondary window, sharing main graphics context resources
+extern void ClosePlatformSecondaryWindow(int index);        // Close platform secondary window
+extern bool IsPlatformSecondaryWindowCloseRequested(int index); // Check if platform secondary window close has been requested
+extern void GetPlatformSecondaryWindowSize(int index, int *width, int *height); // Get platform secondary window framebuffer size
+extern void PresentPlatformSecondaryWindow(int index, unsigned int fboId, unsigned int textureId, int width, int height); // Present render target to platform secondary window
+#endif
 
 static void InitTimer(void);                                // Initialize timer, hi-resolution if available (required by InitPlatform())
+static void SleepPrecise(double seconds);                   // Sleep for some time, using high resolution timers when available
+static void WaitUntilTime(double time);                     // Wait until some time, busy waiting only measured sleep overshoot
+static void WaitFramePacing(void);                          // Wait for next frame deadline and register frame time stats
+#if defined(SUPPORT_PERF_RUN)
+static void InitPerfRun(void);                              // Initialize performance run, if requested by environment variables
+static void UpdatePerfRun(void);                            // Measure frame and replay next frame events, results exported on last frame
+static void PlayPerfRunEvents(void);                        // Play automation events up to current frame
+static void ClosePerfRun(void);                             // Close performance run, results exported if not done yet
+static bool ExportPerfRunResults(void);                     // Export performance run results as JSON
+static int ComparePerfRunFrameTimes(const void *a, const void *b); // Compare frame times, used to sort measured frames
+#endif
+static double GetStartupClock(void);                        // Get system clock time in seconds, available before InitTimer()
 static void SetupViewport(int width, int height);           // Set viewport for a provided width and height
+static void SetShaderDefaultLocations(rl_Shader *shader);     // Set shader default locations, located by default names
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+static void RegisterShaderFiles(rl_Shader shader, const char *vsFileName, const char *fsFileName); // Register shader loaded from files for hot reload
+static void UnregisterShaderFiles(unsigned int id);         // Unregister shader loaded from files
+static void ReloadAssetFile(const char *fileName);          // Reload changed asset file (shaders and shared textures)
+static void UpdateAssetsWatcher(void);                      // Update assets watcher, changed watched files are reloaded
+static void CloseAssetsWatcher(void);                       // Close assets watcher
+#endif
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+static rl_RenderTexture2D LoadSecondaryWindowTarget(int width, int height); // Load secondary window render target (color + depth)
+static void UnloadSecondaryWindowTarget(rl_RenderTexture2D target);     // Unload secondary window render target
+static SecondaryWindowData *GetSecondaryWindow(int window);         // Get secondary window data, NULL if not valid
+#endif
+#if defined(SUPPORT_SHADER_CACHE)
+static unsigned int LoadShaderCodeCached(const char *vsCode, const char *fsCode); // Load shader code using program binary cache
+#endif
+#if defined(SUPPORT_MODULE_RTEXTURES)
+static void ScreenshotCallback(unsigned char *data, int width, int height, void *userData); // Export screenshot on async readback completion
+#endif
 
-static void ScanDirectoryFiles(const char *basePath, rl_FilePathList *list, const char *filter);   // Scan all files and directories in a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, rl_FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
+static int GetDirectoryEntryType(const struct dirent *entry, const char *path); // Get directory entry type (0-other, 1-file, 2-directory), avoiding stat() when possible
+static bool IsDirectoryEntryIncluded(const char *path, int type, const char *filter, bool scanSubdirs); // Check if scanned entry is included in results (filter)
+static bool ScanDirectory(const char *basePath, const char *filter, bool scanSubdirs, DirectoryFileCallback callback, void *userData, int *count, rl_FilePathList *subdirs); // Scan directory paths, streamed to callback (recursively if requested)
+static bool AddFilePathListEntry(const char *path, bool isDirectory, void *userData); // Add path to file path list, capacity grows as required
+#if defined(SUPPORT_COMPRESSION_API)
+static int GetCompressBlockBound(int dataSize); // Get compressed block data maximum size, valid for all codecs
+static void WriteCompressedStreamHeader(unsigned char *header, int codec, unsigned int blockSize); // Write compressed blocks stream header
+static bool ReadCompressedStreamHeader(const unsigned char *header, int size, int *codec, unsigned int *blockSize); // Read compressed blocks stream header
+static int CompressBlock(int codec, const unsigned char *data, int dataSize, unsigned char *compData, struct sdefl *sdefl, bool *stored); // Compress block data with codec
+static bool DecompressBlock(int codec, const unsigned char *compData, int compDataSize, bool stored, unsigned char *data, int dataSize); // Decompress block data with codec
+static int CompressBlockLZ4(const unsigned char *data, int dataSize, unsigned char *compData); // Compress block data with LZ4 block format
+static int DecompressBlockLZ4(const unsigned char *compData, int compDataSize, unsigned char *data, int dataSize); // Decompress block data with LZ4 block format
+static void ProcessCompressionWork(CompressionWork *work); // Process compression work blocks until none is left
+static void RunCompressionWork(CompressionWork *work, int threads); // Run compression work, blocks processed by several threads
+static bool WriteCompressionStreamBlock(rl_CompressionStream *stream, const unsigned char *data, int dataSize); // Write compression stream block to callback
+static int ReadCompressionStreamBlocks(rl_CompressionStream *stream, const unsigned char *data, int dataSize); // Read compression stream blocks, decompressed to callback
+#endif
+static unsigned int UpdateCRC32(unsigned int crc, const unsigned char *data, int dataSize); // Update CRC32 value with data
+static void ProcessHashBlocks(int hashType, unsigned int *digest, const unsigned char *data, int blockCount); // Process hash data blocks (64 bytes each)
+static void ProcessBlocksMD5(unsigned int *digest, const unsigned char *data, int blockCount); // Process MD5 data blocks
+static void ProcessBlocksSHA1(unsigned int *digest, const unsigned char *data, int blockCount); // Process SHA-1 data blocks
+static void ProcessBlocksSHA256(unsigned int *digest, const unsigned char *data, int blockCount); // Process SHA-256 data blocks
+#if defined(SUPPORT_DIRECTORY_SCAN_THREADS)
+static void ScanDirectoryParallel(const char *basePath, const char *filter, rl_FilePathList *files); // Scan directory recursively, subdirectories scanned by several threads
+static void *DirectoryScanThreadLoop(void *arg); // Directory scan thread loop, queued subdirectories are scanned until none is left
+static bool MoveFilePathListEntries(rl_FilePathList *dst, rl_FilePathList *src); // Move path entries between file path lists, source list count is reset
+#endif
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
 static void RecordAutomationEvent(void); // Record frame events (to internal events array)
+static bool GrowAutomationEventList(rl_AutomationEventList *list); // Grow automation events list capacity (doubled)
+static int EncodeAutomationEvent(AutomationEventCoder *coder, const rl_AutomationEvent *event, unsigned char *data); // Encode automation event (binary format)
+static int DecodeAutomationEvent(AutomationEventCoder *coder, const unsigned char *data, int dataSize, rl_AutomationEvent *event); // Decode automation event (binary format)
+static bool IsAutomationEventsBinaryFile(const char *fileName); // Check if file is an automation events binary file
+static void LoadAutomationEventsBinary(const char *fileName, rl_AutomationEventList *list); // Load automation events binary file into events list
+static bool WriteAutomationEventStreamData(const unsigned char *data, int dataSize, void *userData); // Write automation events stream data to file
+static bool ReadAutomationEventStreamData(const unsigned char *data, int dataSize, void *userData); // Append automation events stream data pending to be decoded
+static void FlushAutomationEventStream(rl_AutomationEventStream *stream); // Flush automation events recorded to stream file
+#endif
+
+#if defined(SUPPORT_INPUT_EVENTS)
+static void InitInputEvents(void);                          // Initialize input events queue slots
+static void PushGamepadInputEvents(void);                   // Push gamepad events for changes since previous poll
+static void PushInputEvent(int type, int device, int code, float x, float y); // Push timestamped input event into queue (called from platform)
+static void ProcessGestureTouchInputEvents(void);           // Process touch events batch for multi-touch gestures
+#else
+    #define PushInputEvent(type, device, code, x, y) ((void)0)
+#endif
+
+#if defined(SUPPORT_RENDER_THREAD)
+static void *RenderThreadLoop(void *arg); // Render thread main loop, replays queued frames and swaps buffers
 #endif
 
 #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 __declspec(dllimport) void __stdcall Sleep(unsigned long msTimeout); // Required for: rl_WaitTime()
+__declspec(dllimport) void *__stdcall CreateWaitableTimerExW(void *timerAttributes, const wchar_t *timerName, unsigned long flags, unsigned long desiredAccess);
+__declspec(dllimport) int __stdcall SetWaitableTimer(void *timer, const long long *dueTime, long period, void *completionRoutine, void *completionArg, int resume);
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION   0x00000002
+#define TIMER_ALL_ACCESS                        0x001f0003
 #endif
 
 #if !defined(SUPPORT_MODULE_RTEXT)
@@ -543,13 +1045,19 @@ const char *rl_TextFormat(const char *text, ...); // Formatting of text with var
 #elif defined(PLATFORM_DESKTOP_WIN32)
     #include "platforms/rcore_desktop_win32.c"
 #elif defined(PLATFORM_WEB)
-    #include "platforms/rcore_web.c"
+    #if defined(SUPPORT_WEB_RENDER_WORKER)
+        #include "platforms/rcore_web_emscripten.c" // HTML5 API backend, no GLFW (its browser library requires main thread)
+    #else
+        #include "platforms/rcore_web.c"
+    #endif
 #elif defined(PLATFORM_DRM)
     #include "platforms/rcore_drm.c"
 #elif defined(PLATFORM_ANDROID)
     #include "platforms/rcore_android.c"
 #elif defined(PLATFORM_MEMORY)
     #include "platforms/rcore_memory.c"
+#elif defined(PLATFORM_HEADLESS)
+    #include "platforms/rcore_headless.c"
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -581,6 +1089,7 @@ const char *rl_TextFormat(const char *text, ...); // Formatting of text with var
 //void rl_SetWindowSize(int width, int height)
 //void rl_SetWindowOpacity(float opacity)
 //void rl_SetWindowFocused(void)
+//void rl_SetWindowFramebuffer(void *pixels)
 //void *rl_GetWindowHandle(void)
 //rl_Vector2 rl_GetWindowPosition(void)
 //rl_Vector2 rl_GetWindowScaleDPI(void)
@@ -608,6 +1117,11 @@ void rl_InitWindow(int width, int height, const char *title)
 {
     TRACELOG(LOG_INFO, "Initializing raylib %s", rl_RAYLIB_VERSION);
 
+    // Startup trace, phases timings measured with system clock (platform timer not initialized yet)
+    memset(&startupStats, 0, sizeof(rl_StartupStats));
+    double startupTime = GetStartupClock();
+    double phaseTime = startupTime;
+
 #if defined(PLATFORM_DESKTOP_GLFW)
     TRACELOG(LOG_INFO, "Platform backend: DESKTOP (GLFW)");
 #elif defined(PLATFORM_DESKTOP_SDL)
@@ -618,6 +1132,8 @@ void rl_InitWindow(int width, int height, const char *title)
     TRACELOG(LOG_INFO, "Platform backend: DESKTOP (WIN32)");
 #elif defined(PLATFORM_WEB_RGFW)
     TRACELOG(LOG_INFO, "Platform backend: WEB (RGFW) (HTML5)");
+#elif defined(PLATFORM_WEB) && defined(SUPPORT_WEB_RENDER_WORKER)
+    TRACELOG(LOG_INFO, "Platform backend: WEB (HTML5) (Render worker)");
 #elif defined(PLATFORM_WEB)
     TRACELOG(LOG_INFO, "Platform backend: WEB (HTML5)");
 #elif defined(PLATFORM_DRM)
@@ -626,6 +1142,8 @@ void rl_InitWindow(int width, int height, const char *title)
     TRACELOG(LOG_INFO, "Platform backend: ANDROID");
 #elif defined(PLATFORM_MEMORY)
     TRACELOG(LOG_INFO, "Platform backend: MEMORY (No OS)");
+#elif defined(PLATFORM_HEADLESS)
+    TRACELOG(LOG_INFO, "Platform backend: HEADLESS (EGL)");
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -668,6 +1186,7 @@ void rl_InitWindow(int width, int height, const char *title)
     CORE.Window.currentFbo.height = CORE.Window.screen.height;
 
     CORE.Window.eventWaiting = false;
+    CORE.Window.eventWaitingTimeout = 0.0;
     CORE.Window.screenScale = MatrixIdentity(); // No draw scaling required by default
     if ((title != NULL) && (title[0] != 0)) CORE.Window.title = title;
 
@@ -677,6 +1196,9 @@ void rl_InitWindow(int width, int height, const char *title)
     CORE.Input.Mouse.scale = (rl_Vector2){ 1.0f, 1.0f };
     CORE.Input.Mouse.cursor = MOUSE_CURSOR_ARROW;
     CORE.Input.Gamepad.lastButtonPressed = GAMEPAD_BUTTON_UNKNOWN;
+#if defined(SUPPORT_INPUT_EVENTS)
+    InitInputEvents();
+#endif
 
     // Initialize platform
     //--------------------------------------------------------------
@@ -689,6 +1211,9 @@ void rl_InitWindow(int width, int height, const char *title)
     }
     //--------------------------------------------------------------
 
+    startupStats.platformTime = (float)((GetStartupClock() - phaseTime)*1000.0);
+    phaseTime = GetStartupClock();
+
     // Initialize rlgl default data (buffers and shaders)
     // NOTE: Current fbo size stored as globals in rlgl for convenience
     rlglInit(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
@@ -696,7 +1221,10 @@ void rl_InitWindow(int width, int height, const char *title)
     // Setup default viewport
     SetupViewport(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
 
-#if defined(SUPPORT_MODULE_RTEXT)
+    startupStats.graphicsTime = (float)((GetStartupClock() - phaseTime)*1000.0);
+    phaseTime = GetStartupClock();
+
+#if defined(SUPPORT_MODULE_RTEXT) && !defined(SUPPORT_LAZY_DEFAULT_FONT)
     #if defined(SUPPORT_DEFAULT_FONT)
         // Load default font
         // WARNING: External function: Module required: rtext
@@ -726,21 +1254,67 @@ void rl_InitWindow(int width, int height, const char *title)
     #endif
 #endif
 
+    startupStats.fontTime = (float)((GetStartupClock() - phaseTime)*1000.0);
+
     CORE.Time.frameCounter = 0;
     CORE.Window.shouldClose = false;
 
     // Initialize random seed
     rl_SetRandomSeed((unsigned int)time(NULL));
 
+#if defined(SUPPORT_PERF_RUN)
+    InitPerfRun();              // Initialize performance run (RAYLIB_PERF_RUN), fixed random seed
+#endif
+
     TRACELOG(LOG_INFO, "SYSTEM: Working Directory: %s", rl_GetWorkingDirectory());
+
+    startupStats.totalTime = (float)((GetStartupClock() - startupTime)*1000.0);
+
+    TRACELOG(LOG_DEBUG, "SYSTEM: Startup time: %.2f ms", startupStats.totalTime);
+    TRACELOG(LOG_DEBUG, "    > Platform:  %.2f ms (window, graphics context, extensions)", startupStats.platformTime);
+    TRACELOG(LOG_DEBUG, "    > Graphics:  %.2f ms (rlgl default data, viewport)", startupStats.graphicsTime);
+    TRACELOG(LOG_DEBUG, "    > Font:      %.2f ms (default font, shapes texture)", startupStats.fontTime);
 }
 
 // Close window and unload OpenGL context
 void rl_CloseWindow(void)
 {
+    rl_DisableRenderThread();   // Render thread must release graphics context before unloading
+
+#if defined(SUPPORT_PERF_RUN)
+    ClosePerfRun();             // Export performance run results, if program closed before last frame
+#endif
+
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+    for (int i = 0; i < MAX_SECONDARY_WINDOWS; i++) rl_CloseSecondaryWindow(i + 1);
+#endif
+
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
+#if defined(SUPPORT_MODULE_RSHAPES)
+    UnloadShapesShaders();      // Unload SDF and instanced shapes shaders
+#endif
+#if defined(SUPPORT_MODULE_RTEXT)
+    UnloadTextShaders();        // Unload SDF fonts shaders
+    UnloadTextShapingCache();   // Unload shaped text layouts
+#endif
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    UnloadRenderTexturePool();  // Unload transient render textures
+    UnloadTextureStreams();     // Unload streamed textures
+#if defined(SUPPORT_SHARED_TEXTURES)
+    UnloadSharedTextures();     // Unload shared textures registry
+#endif
+    CloseImageWorkerThreads();  // Close image filters worker threads
+    UnloadImageShaders();       // Unload render texture processing shaders
+#endif
+    CloseJobWorkers();          // Close job system worker threads
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+    CloseAssetsWatcher();       // Close assets hot reload watcher
+#endif
+    CloseFileWorkerThreads();   // Close file I/O worker threads
+    UnloadMemoryFrameArena();   // Unload frame arena memory
+    UnloadProfileZones();       // Unload CPU profiler zones
 
     rlglClose();                // De-init rlgl
 
@@ -749,6 +1323,11 @@ void rl_CloseWindow(void)
     ClosePlatform();
     //--------------------------------------------------------------
 
+#if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
+    if (framePacing.timer != NULL) CloseHandle(framePacing.timer);
+#endif
+    memset(&framePacing, 0, sizeof(FramePacingData));
+
     CORE.Window.ready = false;
     TRACELOG(LOG_INFO, "Window closed successfully");
 }
@@ -759,6 +1338,146 @@ bool rl_IsWindowReady(void)
     return CORE.Window.ready;
 }
 
+// Initialize secondary window sharing main window graphics resources, returns window id (0 on failure)
+// NOTE: Resources loaded (textures, meshes, shaders) can be drawn on any window,
+// secondary windows do not receive input events
+int rl_InitSecondaryWindow(int width, int height, const char *title)
+{
+    int window = 0;
+
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+    if (!CORE.Window.ready)
+    {
+        TRACELOG(LOG_WARNING, "WINDOW: Main window must be initialized before secondary windows");
+        return 0;
+    }
+
+    if (rl_IsRenderThreadEnabled())
+    {
+        TRACELOG(LOG_WARNING, "WINDOW: Secondary windows not supported while render thread is enabled");
+        return 0;
+    }
+
+    int index = 0;
+    while ((index < MAX_SECONDARY_WINDOWS) && secondaryWindows[index].ready) index++;
+
+    if (index == MAX_SECONDARY_WINDOWS)
+    {
+        TRACELOG(LOG_WARNING, "WINDOW: Maximum number of secondary windows reached (%i)", MAX_SECONDARY_WINDOWS);
+        return 0;
+    }
+
+    if (!InitPlatformSecondaryWindow(index, width, height, title)) return 0;
+
+    int fbWidth = 0, fbHeight = 0;
+    GetPlatformSecondaryWindowSize(index, &fbWidth, &fbHeight);
+
+    secondaryWindows[index].target = LoadSecondaryWindowTarget(fbWidth, fbHeight);
+    secondaryWindows[index].ready = true;
+    window = index + 1;
+
+    TRACELOG(LOG_INFO, "WINDOW: [ID %i] Secondary window initialized successfully (%i x %i)", window, fbWidth, fbHeight);
+#else
+    TRACELOG(LOG_WARNING, "WINDOW: Secondary windows not supported, requires SUPPORT_MULTIPLE_WINDOWS");
+#endif
+
+    return window;
+}
+
+// Close secondary window
+void rl_CloseSecondaryWindow(int window)
+{
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+    SecondaryWindowData *data = GetSecondaryWindow(window);
+    if (data == NULL) return;
+
+    if (currentSecondaryWindow == window) rl_EndSecondaryWindowDrawing();
+
+    UnloadSecondaryWindowTarget(data->target);
+    ClosePlatformSecondaryWindow(window - 1);
+    memset(data, 0, sizeof(SecondaryWindowData));
+
+    TRACELOG(LOG_INFO, "WINDOW: [ID %i] Secondary window closed successfully", window);
+#endif
+}
+
+// Check if secondary window close icon has been clicked
+bool rl_SecondaryWindowShouldClose(int window)
+{
+    bool result = false;
+
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+    if (GetSecondaryWindow(window) != NULL) result = IsPlatformSecondaryWindowCloseRequested(window - 1);
+#endif
+
+    return result;
+}
+
+// Get secondary window render width
+int rl_GetSecondaryWindowWidth(int window)
+{
+    int width = 0;
+
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+    if (GetSecondaryWindow(window) != NULL) GetPlatformSecondaryWindowSize(window - 1, &width, NULL);
+#endif
+
+    return width;
+}
+
+// Get secondary window render height
+int rl_GetSecondaryWindowHeight(int window)
+{
+    int height = 0;
+
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+    if (GetSecondaryWindow(window) != NULL) GetPlatformSecondaryWindowSize(window - 1, NULL, &height);
+#endif
+
+    return height;
+}
+
+// Begin drawing to secondary window
+// NOTE: Drawing is recorded into window render target on main graphics context, same as rl_BeginTextureMode()
+void rl_BeginSecondaryWindowDrawing(int window)
+{
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+    SecondaryWindowData *data = GetSecondaryWindow(window);
+    if ((data == NULL) || (currentSecondaryWindow != 0)) return;
+
+    // Render target follows window framebuffer size (resized or minimized window)
+    int width = 0, height = 0;
+    GetPlatformSecondaryWindowSize(window - 1, &width, &height);
+    if (width < 1) width = 1;
+    if (height < 1) height = 1;
+
+    if ((width != data->target.texture.width) || (height != data->target.texture.height))
+    {
+        rlDrawRenderBatchActive();      // Draw pending batch, it could reference previous render target
+        UnloadSecondaryWindowTarget(data->target);
+        data->target = LoadSecondaryWindowTarget(width, height);
+    }
+
+    rl_BeginTextureMode(data->target);
+    currentSecondaryWindow = window;
+#endif
+}
+
+// End drawing to secondary window and present it
+void rl_EndSecondaryWindowDrawing(void)
+{
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+    if (currentSecondaryWindow == 0) return;
+
+    SecondaryWindowData *data = &secondaryWindows[currentSecondaryWindow - 1];
+
+    rl_EndTextureMode();
+    PresentPlatformSecondaryWindow(currentSecondaryWindow - 1, data->target.id, data->target.texture.id, data->target.texture.width, data->target.texture.height);
+
+    currentSecondaryWindow = 0;
+#endif
+}
+
 // Check if window is currently fullscreen
 bool rl_IsWindowFullscreen(void)
 {
@@ -847,6 +1566,13 @@ void rl_DisableEventWaiting(void)
     CORE.Window.eventWaiting = false;
 }
 
+// Set events waiting timeout, frame ends without events after timeout (0: wait indefinitely)
+// NOTE: Timeout lets time based content progress while idle (i.e. text cursor blinking, delayed tooltips)
+void rl_SetEventWaitingTimeout(double seconds)
+{
+    CORE.Window.eventWaitingTimeout = (seconds > 0.0)? seconds : 0.0;
+}
+
 // Check if cursor is not visible
 bool rl_IsCursorHidden(void)
 {
@@ -876,28 +1602,138 @@ void rl_BeginDrawing(void)
     // WARNING: Previously to rl_BeginDrawing() other render textures drawing could happen,
     // consequently the measure for update vs draw is not accurate (only the total frame time is accurate)
 
+    PROFILE_ZONE_BEGIN("rl_BeginDrawing");
+
     CORE.Time.current = rl_GetTime();      // Number of elapsed seconds since InitTimer()
     CORE.Time.update = CORE.Time.current - CORE.Time.previous;
     CORE.Time.previous = CORE.Time.current;
 
+    rl_MemFrameReset();                 // Release frame arena allocations, start frame memory stats
+    rl_UpdateJobs();                    // Call completed jobs callbacks
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+    UpdateAssetsWatcher();              // Reload changed watched assets files
+#endif
+
+#if defined(SUPPORT_RENDER_THREAD)
+    if (renderThread.active)
+    {
+        // Wait for a free frame slot, it limits latency to queue depth
+        pthread_mutex_lock(&renderThread.mutex);
+        while (renderThread.count >= renderThread.depth) pthread_cond_wait(&renderThread.cond, &renderThread.mutex);
+        rlCommandBuffer *frame = &renderThread.frames[(renderThread.head + renderThread.count)%renderThread.depth];
+        pthread_mutex_unlock(&renderThread.mutex);
+
+        // NOTE: Render statistics and GPU profiler frame are managed by render thread
+        rlResetCommandBuffer(frame);
+        rlBeginCommandRecording(frame);
+    }
+    else
+#endif
+    {
+        rlResetRenderStats();           // Reset render statistics for current frame
+
+#if defined(RLGL_ENABLE_GPU_PROFILER)
+        rlProfilerBeginFrame();         // Begin GPU profiler frame (whole frame pass)
+#endif
+    }
+
     rlLoadIdentity();                   // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling
+    rlUpdateCameraBlock();              // Update camera uniform block (shared by shaders)
 
     //rlTranslatef(0.375, 0.375, 0);    // HACK to have 2D pixel-perfect drawing on OpenGL 1.1
                                         // NOTE: Not required with OpenGL 3.3+
+
+    PROFILE_ZONE_END();
 }
 
 // End canvas drawing and swap buffers (double buffering)
 void rl_EndDrawing(void)
 {
+    PROFILE_ZONE_BEGIN("rl_EndDrawing");
+
+#if defined(SUPPORT_RENDER_THREAD)
+    if (renderThread.active)
+    {
+        rlDrawRenderBatchActive();      // Recorded, batch is drawn by render thread
+        rlEndCommandRecording();
+
+        // Queue recorded frame for render thread
+        pthread_mutex_lock(&renderThread.mutex);
+        renderThread.skipSwap[(renderThread.head + renderThread.count)%renderThread.depth] = CORE.Window.skipSwap;
+        renderThread.count++;
+        pthread_cond_broadcast(&renderThread.cond);
+        pthread_mutex_unlock(&renderThread.mutex);
+
+    #if defined(SUPPORT_AUTOMATION_EVENTS)
+        if (automationEventRecording) RecordAutomationEvent();    // Event recording
+        if (automationEventStream != NULL) FlushAutomationEventStream(automationEventStream); // Events streamed to file
+    #endif
+
+        // Frame time control system
+        // NOTE: Draw time only measures the frame recording, swap happens on render thread
+        CORE.Time.current = rl_GetTime();
+        CORE.Time.draw = CORE.Time.current - CORE.Time.previous;
+        CORE.Time.previous = CORE.Time.current;
+
+        CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
+
+        PROFILE_ZONE_BEGIN("WaitFramePacing");
+        WaitFramePacing();      // Wait for next frame deadline (if target time defined)
+        PROFILE_ZONE_END();
+
+        PROFILE_ZONE_BEGIN("rl_PollInputEvents");
+        rl_PollInputEvents();           // Poll user events (before next frame update)
+        PROFILE_ZONE_END();
+    #if defined(SUPPORT_INPUT_EVENTS)
+        PushGamepadInputEvents();       // Register gamepad changes as input events
+        ProcessGestureTouchInputEvents(); // Process frame touch events for multi-touch gestures
+    #endif
+
+    #if defined(SUPPORT_MODULE_RTEXTURES)
+        UpdateRenderTexturePool(false); // Recycle transient render textures, graphics context owned by render thread
+    #endif
+
+        // NOTE: Screen capture (F12) not supported with render thread, framebuffer is owned by render thread
+
+        CORE.Window.skipSwap = false;
+        CORE.Time.frameCounter++;
+
+    #if defined(SUPPORT_PERF_RUN)
+        if (perfRun.active) UpdatePerfRun();
+    #endif
+        PROFILE_ZONE_END();
+        return;
+    }
+#endif
+
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    rlExecuteCommandBuffers();      // Replay command buffers submitted for current frame
+#endif
     rlDrawRenderBatchActive();      // Update and draw internal render batch
 
+#if defined(RLGL_ENABLE_GPU_PROFILER)
+    rlProfilerEndFrame();           // End GPU profiler frame, previous frames results read back if available
+#endif
+    rlUpdateReadbacks(false);       // Deliver completed async screen readbacks (previous frames)
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    UpdateRenderTexturePool(true);  // Recycle transient render textures, unload idle ones
+    UpdateTextureStreams();         // Stream in requested texture levels, evict levels over budget
+#endif
+
 #if defined(SUPPORT_AUTOMATION_EVENTS)
     if (automationEventRecording) RecordAutomationEvent();    // Event recording
+    if (automationEventStream != NULL) FlushAutomationEventStream(automationEventStream); // Events streamed to file
 #endif
 
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
-    rl_SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
+    if (!CORE.Window.skipSwap)
+    {
+        PROFILE_ZONE_BEGIN("rl_SwapScreenBuffer");
+        rl_SwapScreenBuffer();  // Copy back buffer to front buffer (screen)
+        PROFILE_ZONE_END();
+    }
 
     // Frame time control system
     CORE.Time.current = rl_GetTime();
@@ -906,19 +1742,17 @@ void rl_EndDrawing(void)
 
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
-    // Wait for some milliseconds...
-    if (CORE.Time.frame < CORE.Time.target)
-    {
-        rl_WaitTime(CORE.Time.target - CORE.Time.frame);
-
-        CORE.Time.current = rl_GetTime();
-        double waitTime = CORE.Time.current - CORE.Time.previous;
-        CORE.Time.previous = CORE.Time.current;
-
-        CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
-    }
+    PROFILE_ZONE_BEGIN("WaitFramePacing");
+    WaitFramePacing();      // Wait for next frame deadline (if target time defined)
+    PROFILE_ZONE_END();
 
+    PROFILE_ZONE_BEGIN("rl_PollInputEvents");
     rl_PollInputEvents();      // Poll user events (before next frame update)
+    PROFILE_ZONE_END();
+#if defined(SUPPORT_INPUT_EVENTS)
+    PushGamepadInputEvents();  // Register gamepad changes as input events
+    ProcessGestureTouchInputEvents(); // Process frame touch events for multi-touch gestures
+#endif
 #endif
 
 #if defined(SUPPORT_SCREEN_CAPTURE)
@@ -929,34 +1763,133 @@ void rl_EndDrawing(void)
     }
 #endif  // SUPPORT_SCREEN_CAPTURE
 
+    CORE.Window.skipSwap = false;
     CORE.Time.frameCounter++;
+
+#if defined(SUPPORT_PERF_RUN)
+    if (perfRun.active) UpdatePerfRun();    // Measure frame, replay next frame input events
+#endif
+
+    PROFILE_ZONE_END();
 }
 
-// Initialize 2D mode with custom camera (2D)
-void rl_BeginMode2D(rl_Camera2D camera)
+// Skip buffers swap on current frame rl_EndDrawing(), screen keeps previous frame
+// NOTE: Useful when nothing changed since last frame (i.e. idle tools UI), frame is not drawn by GPU,
+// frame timing and input events polling are done as usual
+void rl_SkipScreenBufferSwap(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    CORE.Window.skipSwap = true;
+}
+
+// Enable render thread, frames are recorded on main thread and submitted + swapped on a dedicated thread
+// NOTE: Graphics context is moved to render thread, resources must be loaded/unloaded while render thread is disabled
+// and only rlgl calls supporting command recording are allowed between rl_BeginDrawing() and rl_EndDrawing()
+void rl_EnableRenderThread(int queueDepth)
+{
+#if defined(SUPPORT_RENDER_THREAD)
+    if (renderThread.active) return;
+
+    if (queueDepth < 1) queueDepth = 1;
+    if (queueDepth > MAX_RENDER_THREAD_FRAMES) queueDepth = MAX_RENDER_THREAD_FRAMES;
+
+#if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_LAZY_DEFAULT_FONT)
+    rl_GetFontDefault();    // Default font must be loaded while graphics context is owned by main thread
+#endif
+
+    for (int i = 0; i < queueDepth; i++) renderThread.frames[i] = rlLoadCommandBuffer(0);
+
+    renderThread.depth = queueDepth;
+    renderThread.head = 0;
+    renderThread.count = 0;
+    renderThread.quit = false;
+
+    pthread_mutex_init(&renderThread.mutex, NULL);
+    pthread_cond_init(&renderThread.cond, NULL);
+
+    rlDrawRenderBatchActive();          // Draw pending batch before moving context
+    SetGraphicsContextCurrent(false);   // Release graphics context, render thread makes it current
+
+    if (pthread_create(&renderThread.thread, NULL, RenderThreadLoop, NULL) != 0)
+    {
+        SetGraphicsContextCurrent(true);
+        pthread_cond_destroy(&renderThread.cond);
+        pthread_mutex_destroy(&renderThread.mutex);
+        for (int i = 0; i < queueDepth; i++) rlUnloadCommandBuffer(renderThread.frames[i]);
+
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to create render thread");
+        return;
+    }
+
+    renderThread.active = true;
+    TRACELOG(LOG_INFO, "SYSTEM: Render thread enabled (queue depth: %i)", queueDepth);
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: Render thread not supported, requires SUPPORT_RENDER_THREAD");
+#endif
+}
+
+// Disable render thread, waits for queued frames and returns graphics context to main thread
+void rl_DisableRenderThread(void)
+{
+#if defined(SUPPORT_RENDER_THREAD)
+    if (!renderThread.active) return;
+
+    pthread_mutex_lock(&renderThread.mutex);
+    renderThread.quit = true;
+    pthread_cond_broadcast(&renderThread.cond);
+    pthread_mutex_unlock(&renderThread.mutex);
+
+    pthread_join(renderThread.thread, NULL); // NOTE: Render thread releases graphics context on exit
+    SetGraphicsContextCurrent(true);
+
+    pthread_cond_destroy(&renderThread.cond);
+    pthread_mutex_destroy(&renderThread.mutex);
+
+    for (int i = 0; i < renderThread.depth; i++) rlUnloadCommandBuffer(renderThread.frames[i]);
+
+    renderThread.active = false;
+    TRACELOG(LOG_INFO, "SYSTEM: Render thread disabled");
+#endif
+}
+
+// Check if render thread is enabled
+bool rl_IsRenderThreadEnabled(void)
+{
+#if defined(SUPPORT_RENDER_THREAD)
+    return renderThread.active;
+#else
+    return false;
+#endif
+}
+
+// Initialize 2D mode with custom camera (2D)
+void rl_BeginMode2D(rl_Camera2D camera)
+{
+    rlFlushRenderBatch(RL_BATCH_FLUSH_RENDER_MODE); // Update and draw internal render batch
 
     rlLoadIdentity();               // Reset current matrix (modelview)
 
     // Apply 2d camera transformation to modelview
     rlMultMatrixf(MatrixToFloat(rl_GetCameraMatrix2D(camera)));
+
+    rlUpdateCameraBlock();          // Update camera uniform block (shared by shaders)
 }
 
 // Ends 2D mode with custom camera
 void rl_EndMode2D(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlFlushRenderBatch(RL_BATCH_FLUSH_RENDER_MODE); // Update and draw internal render batch
 
     rlLoadIdentity();               // Reset current matrix (modelview)
 
     if (rlGetActiveFramebuffer() == 0) rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling if required
+
+    rlUpdateCameraBlock();          // Update camera uniform block (shared by shaders)
 }
 
 // Initializes 3D mode with custom camera (3D)
 void rl_BeginMode3D(rl_Camera camera)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlFlushRenderBatch(RL_BATCH_FLUSH_RENDER_MODE); // Update and draw internal render batch
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
     rlPushMatrix();                 // Save previous matrix, which contains the settings for the 2d ortho projection
@@ -989,13 +1922,15 @@ void rl_BeginMode3D(rl_Camera camera)
     rl_Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
     rlMultMatrixf(MatrixToFloat(matView));      // Multiply modelview matrix by view matrix (camera)
 
+    rlUpdateCameraBlock();          // Update camera uniform block (shared by shaders)
+
     rlEnableDepthTest();            // Enable DEPTH_TEST for 3D
 }
 
 // Ends 3D mode and returns to default 2D orthographic mode
 void rl_EndMode3D(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlFlushRenderBatch(RL_BATCH_FLUSH_RENDER_MODE); // Update and draw internal render batch
 
     rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
     rlPopMatrix();                  // Restore previous matrix (projection) from matrix stack
@@ -1005,15 +1940,22 @@ void rl_EndMode3D(void)
 
     if (rlGetActiveFramebuffer() == 0) rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling if required
 
+    rlUpdateCameraBlock();          // Update camera uniform block (shared by shaders)
+
     rlDisableDepthTest();           // Disable DEPTH_TEST for 2D
 }
 
 // Initializes render texture for drawing
 void rl_BeginTextureMode(rl_RenderTexture2D target)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlFlushRenderBatch(RL_BATCH_FLUSH_RENDER_MODE); // Update and draw internal render batch
 
     rlEnableFramebuffer(target.id); // Enable render target
+    CORE.Window.currentFboId = target.id;
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    BeginRenderTexturePoolPass(target.id);  // Skip loading previous contents of transient render texture
+#endif
 
     // Set viewport and RLGL internal framebuffer size
     rlViewport(0, 0, target.texture.width, target.texture.height);
@@ -1032,6 +1974,8 @@ void rl_BeginTextureMode(rl_RenderTexture2D target)
 
     //rlScalef(0.0f, -1.0f, 0.0f);  // Flip Y-drawing (?)
 
+    rlUpdateCameraBlock();          // Update camera uniform block (shared by shaders)
+
     // Setup current width/height for proper aspect ratio
     // calculation when using rl_BeginTextureMode()
     CORE.Window.currentFbo.width = target.texture.width;
@@ -1042,9 +1986,14 @@ void rl_BeginTextureMode(rl_RenderTexture2D target)
 // Ends drawing to render texture
 void rl_EndTextureMode(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlFlushRenderBatch(RL_BATCH_FLUSH_RENDER_MODE); // Update and draw internal render batch
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+    EndRenderTexturePoolPass(CORE.Window.currentFboId); // Skip storing depth of transient render texture
+#endif
 
     rlDisableFramebuffer();         // Disable render target (fbo)
+    CORE.Window.currentFboId = 0;
 
     // Set viewport to default framebuffer size
     SetupViewport(CORE.Window.render.width, CORE.Window.render.height);
@@ -1053,6 +2002,7 @@ void rl_EndTextureMode(void)
     rlMatrixMode(RL_MODELVIEW);     // Switch back to modelview matrix
     rlLoadIdentity();               // Reset current matrix (modelview)
     rlMultMatrixf(MatrixToFloat(CORE.Window.screenScale)); // Apply screen scaling if required
+    rlUpdateCameraBlock();          // Update camera uniform block (shared by shaders)
 
     // Reset current fbo to screen size
     CORE.Window.currentFbo.width = CORE.Window.render.width;
@@ -1089,7 +2039,7 @@ void rl_EndBlendMode(void)
 // NOTE: Scissor rec refers to bottom-left corner, we change it to upper-left
 void rl_BeginScissorMode(int x, int y, int width, int height)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlFlushRenderBatch(RL_BATCH_FLUSH_RENDER_MODE); // Update and draw internal render batch
 
     rlEnableScissorTest();
 
@@ -1115,10 +2065,61 @@ void rl_BeginScissorMode(int x, int y, int width, int height)
 // End scissor mode
 void rl_EndScissorMode(void)
 {
-    rlDrawRenderBatchActive();      // Update and draw internal render batch
+    rlFlushRenderBatch(RL_BATCH_FLUSH_RENDER_MODE); // Update and draw internal render batch
     rlDisableScissorTest();
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Drawing Lists
+//----------------------------------------------------------------------------------
+
+// Begin recording draws into a drawing list
+// NOTE: Shapes, textures and text draws go through render batch, its vertex data is recorded
+// instead of drawn, current camera/modelview is not recorded and is applied on drawing
+void rl_BeginDrawingList(void)
+{
+    rlBeginDrawingList();
+}
+
+// End recording draws, recorded vertex data is loaded in GPU memory
+rl_DrawingList rl_EndDrawingList(void)
+{
+    rlDrawingList recorded = rlEndDrawingList();
+    rl_DrawingList list = { 0 };
+
+    list.vertexCount = recorded.vertexCount;
+    list.drawCount = recorded.drawCount;
+    list.vaoId = recorded.vaoId;
+    for (int i = 0; i < 4; i++) list.vboId[i] = recorded.vboId[i];
+    list.draws = recorded.draws;
+
+    return list;
+}
+
+// Check if a drawing list is valid (loaded in GPU)
+bool rl_IsDrawingListValid(rl_DrawingList list)
+{
+    return ((list.vertexCount > 0) && (list.vboId[0] > 0) && (list.draws != NULL));
+}
+
+// Draw a drawing list with a transform applied
+// NOTE: Drawing list is drawn with current shader, blending and camera, textures used on
+// recording must be kept loaded
+void rl_DrawDrawingList(rl_DrawingList list, rl_Matrix transform)
+{
+    rlDrawingList drawList = { list.vertexCount, list.drawCount, list.vaoId, { list.vboId[0], list.vboId[1], list.vboId[2], list.vboId[3] }, list.draws };
+
+    rlDrawDrawingList(drawList, transform);
+}
+
+// Unload drawing list from GPU memory (VRAM)
+void rl_UnloadDrawingList(rl_DrawingList list)
+{
+    rlDrawingList drawList = { list.vertexCount, list.drawCount, list.vaoId, { list.vboId[0], list.vboId[1], list.vboId[2], list.vboId[3] }, list.draws };
+
+    rlUnloadDrawingList(drawList);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: VR Stereo Rendering
 //----------------------------------------------------------------------------------
@@ -1229,6 +2230,8 @@ rl_Shader rl_LoadShader(const char *vsFileName, const char *fsFileName)
 {
     rl_Shader shader = { 0 };
 
+    PROFILE_ZONE_BEGIN("rl_LoadShader");
+
     char *vShaderStr = NULL;
     char *fShaderStr = NULL;
 
@@ -1239,9 +2242,16 @@ rl_Shader rl_LoadShader(const char *vsFileName, const char *fsFileName)
 
     shader = rl_LoadShaderFromMemory(vShaderStr, fShaderStr);
 
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+    // NOTE: Shaders failing to load get default shader id, they can not be reloaded in place
+    if ((shader.id > 0) && (shader.id != rlGetShaderIdDefault())) RegisterShaderFiles(shader, (vShaderStr != NULL)? vsFileName : NULL, (fShaderStr != NULL)? fsFileName : NULL);
+#endif
+
     rl_UnloadFileText(vShaderStr);
     rl_UnloadFileText(fShaderStr);
 
+    PROFILE_ZONE_END();
+
     return shader;
 }
 
@@ -1250,7 +2260,11 @@ rl_Shader rl_LoadShaderFromMemory(const char *vsCode, const char *fsCode)
 {
     rl_Shader shader = { 0 };
 
+#if defined(SUPPORT_SHADER_CACHE)
+    shader.id = LoadShaderCodeCached(vsCode, fsCode);
+#else
     shader.id = rlLoadShaderCode(vsCode, fsCode);
+#endif
 
     if (shader.id == 0)
     {
@@ -1262,53 +2276,56 @@ rl_Shader rl_LoadShaderFromMemory(const char *vsCode, const char *fsCode)
     else if (shader.id == rlGetShaderIdDefault()) shader.locs = rlGetShaderLocsDefault();
     else if (shader.id > 0)
     {
-        // After custom shader loading, we TRY to set default location names
-        // Default shader attribute locations have been binded before linking:
-        //  - vertex position location    = 0
-        //  - vertex texcoord location    = 1
-        //  - vertex normal location      = 2
-        //  - vertex color location       = 3
-        //  - vertex tangent location     = 4
-        //  - vertex texcoord2 location   = 5
-        //  - vertex boneIds location     = 6
-        //  - vertex boneWeights location = 7
-
-        // NOTE: If any location is not found, loc point becomes -1
-
         // Load shader locations array
         // NOTE: All locations set to -1 (no location)
         shader.locs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
         for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
 
-        // Get handles to GLSL input attribute locations
-        shader.locs[SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-        shader.locs[SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-        shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
-        shader.locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
-        shader.locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
-        shader.locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
-        shader.locs[SHADER_LOC_VERTEX_BONEIDS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
-        shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
-        shader.locs[SHADER_LOC_VERTEX_INSTANCE_TX] = rlGetLocationAttrib(shader.id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX);
-
-        // Get handles to GLSL uniform locations (vertex shader)
-        shader.locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
-        shader.locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
-        shader.locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
-        shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
-        shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
-        shader.locs[SHADER_LOC_BONE_MATRICES] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES);
-
-        // Get handles to GLSL uniform locations (fragment shader)
-        shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
-        shader.locs[rl_SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);  // SHADER_LOC_MAP_ALBEDO
-        shader.locs[rl_SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1); // SHADER_LOC_MAP_METALNESS
-        shader.locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
+        SetShaderDefaultLocations(&shader);
+    }
+
+    return shader;
+}
+
+// Load shader from code strings asynchronously
+// NOTE: Compile and link run in background on drivers supporting it (GL_KHR_parallel_shader_compile),
+// shader must be checked with rl_IsShaderReady() before use, it binds default locations on completion
+rl_Shader rl_LoadShaderFromMemoryAsync(const char *vsCode, const char *fsCode)
+{
+    rl_Shader shader = { 0 };
+
+    shader.id = rlLoadShaderCodeAsync(vsCode, fsCode);
+
+    if (shader.id == rlGetShaderIdDefault()) shader.locs = rlGetShaderLocsDefault();
+    else
+    {
+        // NOTE: All locations set to -1 (no location) until shader is completed
+        shader.locs = (int *)RL_CALLOC(RL_MAX_SHADER_LOCATIONS, sizeof(int));
+        for (int i = 0; i < RL_MAX_SHADER_LOCATIONS; i++) shader.locs[i] = -1;
     }
 
     return shader;
 }
 
+// Check if an async shader has been built
+// NOTE: When ready, shader is completed: default locations are bound or default shader is assigned on failure
+bool rl_IsShaderReady(rl_Shader *shader)
+{
+    if (!rlIsShaderProgramPending(shader->id)) return true;
+    if (!rlIsShaderProgramReady(shader->id)) return false;
+
+    shader->id = rlCompleteShaderProgram(shader->id);
+
+    if (shader->id == rlGetShaderIdDefault())
+    {
+        RL_FREE(shader->locs);
+        shader->locs = rlGetShaderLocsDefault();
+    }
+    else SetShaderDefaultLocations(shader);
+
+    return true;
+}
+
 // Check if a shader is valid (loaded on GPU)
 bool rl_IsShaderValid(rl_Shader shader)
 {
@@ -1346,6 +2363,9 @@ void rl_UnloadShader(rl_Shader shader)
 {
     if (shader.id != rlGetShaderIdDefault())
     {
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+        UnregisterShaderFiles(shader.id);
+#endif
         rlUnloadShaderProgram(shader.id);
 
         // NOTE: If shader loading failed, it should be 0
@@ -1353,6 +2373,15 @@ void rl_UnloadShader(rl_Shader shader)
     }
 }
 
+// Set assets hot reload callback, called when a watched shader or texture file is reloaded
+// NOTE: Shader custom uniform locations could change on reload, they can be requested again on callback
+void rl_SetAssetReloadedCallback(AssetReloadedCallback callback)
+{
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+    assetsWatcher.callback = callback;
+#endif
+}
+
 // Get shader uniform location
 int rl_GetShaderLocation(rl_Shader shader, const char *uniformName)
 {
@@ -1404,6 +2433,26 @@ void rl_SetShaderValueTexture(rl_Shader shader, int locIndex, rl_Texture2D textu
     }
 }
 
+// Set shader uniform value for texture array
+void rl_SetShaderValueTextureArray(rl_Shader shader, int locIndex, rl_TextureArray texture)
+{
+    if (locIndex > -1)
+    {
+        rlEnableShader(shader.id);
+        rlSetUniformSamplerEx(locIndex, texture.id, RL_TEXTURE_2D_ARRAY);
+    }
+}
+
+// Set shader uniform value for 3D texture
+void rl_SetShaderValueTexture3D(rl_Shader shader, int locIndex, rl_Texture3D texture)
+{
+    if (locIndex > -1)
+    {
+        rlEnableShader(shader.id);
+        rlSetUniformSamplerEx(locIndex, texture.id, RL_TEXTURE_3D);
+    }
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Screen-space Queries
 //----------------------------------------------------------------------------------
@@ -1576,6 +2625,59 @@ rl_Vector2 rl_GetScreenToWorld2D(rl_Vector2 position, rl_Camera2D camera)
     return (rl_Vector2){ transform.x, transform.y };
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Large Worlds
+//----------------------------------------------------------------------------------
+
+// Set render origin, world position drawn at (0, 0, 0)
+// NOTE: Float positions lose precision far from origin (~1mm at 10 km, ~8mm at 100 km), camera and models
+// jitter when view and model translations are combined, world positions should be kept in double precision
+// and drawn relative to render origin, placed at camera position
+void rl_SetRenderOrigin(double x, double y, double z)
+{
+    CORE.World.origin[0] = x;
+    CORE.World.origin[1] = y;
+    CORE.World.origin[2] = z;
+}
+
+// Get render position for a world position, relative to render origin
+// NOTE: Subtraction is computed in double precision, result is small and precise near render origin
+rl_Vector3 rl_GetRenderPosition(double x, double y, double z)
+{
+    rl_Vector3 position = {
+        (float)(x - CORE.World.origin[0]),
+        (float)(y - CORE.World.origin[1]),
+        (float)(z - CORE.World.origin[2])
+    };
+
+    return position;
+}
+
+// Get world position for a render position (i.e. rl_GetScreenToWorldRay() hit points), in double precision
+void rl_GetWorldPosition(rl_Vector3 position, double *x, double *y, double *z)
+{
+    if (x != NULL) *x = CORE.World.origin[0] + (double)position.x;
+    if (y != NULL) *y = CORE.World.origin[1] + (double)position.y;
+    if (z != NULL) *z = CORE.World.origin[2] + (double)position.z;
+}
+
+// Move render origin to camera position, camera is shifted to (0, 0, 0)
+// NOTE: Call it after updating camera (i.e. rl_UpdateCamera()) and before rl_BeginMode3D(),
+// camera movement is accumulated into render origin in double precision
+void rl_UpdateRenderOrigin(rl_Camera *camera)
+{
+    if (camera == NULL) return;
+
+    rl_Vector3 offset = camera->position;
+
+    CORE.World.origin[0] += (double)offset.x;
+    CORE.World.origin[1] += (double)offset.y;
+    CORE.World.origin[2] += (double)offset.z;
+
+    camera->position = (rl_Vector3){ 0.0f, 0.0f, 0.0f };
+    camera->target = Vector3Subtract(camera->target, offset);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Timming
 //----------------------------------------------------------------------------------
@@ -1603,9 +2705,9 @@ int rl_GetFPS(void)
     #define FPS_AVERAGE_TIME_SECONDS   0.5f     // 500 milliseconds
     #define FPS_STEP (FPS_AVERAGE_TIME_SECONDS/FPS_CAPTURE_FRAMES_COUNT)
 
-    static int index = 0;
-    static float history[FPS_CAPTURE_FRAMES_COUNT] = { 0 };
-    static float average = 0, last = 0;
+    static RL_CONTEXT_LOCAL int index = 0;
+    static RL_CONTEXT_LOCAL float history[FPS_CAPTURE_FRAMES_COUNT] = { 0 };
+    static RL_CONTEXT_LOCAL float average = 0, last = 0;
     float fpsFrame = rl_GetFrameTime();
 
     // if we reset the window, reset the FPS info
@@ -1636,11 +2738,22 @@ int rl_GetFPS(void)
 }
 
 // Get time in seconds for last frame drawn (delta time)
+// NOTE: On performance runs a fixed frame time is returned, simulation is the same on every run
 float rl_GetFrameTime(void)
 {
+#if defined(SUPPORT_PERF_RUN)
+    if (perfRun.active) return PERF_RUN_FRAME_TIME;
+#endif
     return (float)CORE.Time.frame;
 }
 
+// Get number of frames drawn since rl_InitWindow()
+// NOTE: Incremented by rl_EndDrawing(), set to event frame on automation events playback
+unsigned int rl_GetFrameCount(void)
+{
+    return CORE.Time.frameCounter;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Custom frame control
 //----------------------------------------------------------------------------------
@@ -1658,41 +2771,125 @@ void rl_WaitTime(double seconds)
 {
     if (seconds < 0) return;    // Security check
 
-#if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-    double destinationTime = rl_GetTime() + seconds;
-#endif
+    PROFILE_ZONE_BEGIN("rl_WaitTime");
 
 #if defined(SUPPORT_BUSY_WAIT_LOOP)
+    double destinationTime = rl_GetTime() + seconds;
     while (rl_GetTime() < destinationTime) { }
+#elif defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
+    // NOTE: Busy waiting is limited to measured sleep overshoot
+    WaitUntilTime(rl_GetTime() + seconds);
 #else
-    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-        double sleepSeconds = seconds - seconds*0.05;  // NOTE: We reserve a percentage of the time for busy waiting
-    #else
-        double sleepSeconds = seconds;
-    #endif
+    SleepPrecise(seconds);
+#endif
 
-    // System halt functions
-    #if defined(_WIN32)
-        Sleep((unsigned long)(sleepSeconds*1000.0));
-    #endif
-    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
-        struct timespec req = { 0 };
-        time_t sec = sleepSeconds;
-        long nsec = (sleepSeconds - sec)*1000000000L;
-        req.tv_sec = sec;
-        req.tv_nsec = nsec;
-
-        // NOTE: Use nanosleep() on Unix platforms... usleep() it's deprecated
-        while (nanosleep(&req, &req) == -1) continue;
-    #endif
-    #if defined(__APPLE__)
-        usleep(sleepSeconds*1000000.0);
-    #endif
+    PROFILE_ZONE_END();
+}
 
-    #if defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
-        while (rl_GetTime() < destinationTime) { }
-    #endif
+// Set frame pacing mode, how rl_EndDrawing() waits for target frame time
+// NOTE: FRAME_PACING_VSYNC enables FLAG_VSYNC_HINT, buffers swap waits for display vblank
+void rl_SetFramePacingMode(int mode)
+{
+    framePacing.mode = mode;
+    framePacing.deadline = 0.0;
+    framePacing.refreshPeriod = 0.0;
+
+    if (mode == FRAME_PACING_VSYNC)
+    {
+        if (!rl_IsWindowState(FLAG_VSYNC_HINT)) rl_SetWindowState(FLAG_VSYNC_HINT);
+
+        int refreshRate = rl_GetMonitorRefreshRate(rl_GetCurrentMonitor());
+        if (refreshRate > 0) framePacing.refreshPeriod = 1.0/(double)refreshRate;
+        else TRACELOG(LOG_WARNING, "TIMER: Monitor refresh rate not available, frames paced to target time");
+    }
+}
+
+// Get frame pacing stats, frame times histogram and sleep accuracy
+rl_FramePacingStats rl_GetFramePacingStats(void)
+{
+    return framePacing.stats;
+}
+
+// Reset frame pacing stats
+void rl_ResetFramePacingStats(void)
+{
+    memset(&framePacing.stats, 0, sizeof(rl_FramePacingStats));
+    framePacing.stats.histogramStep = FRAME_PACING_HISTOGRAM_STEP;
+    framePacing.frameTimeSum = 0.0;
+    framePacing.frameJitterSum = 0.0;
+}
+
+// Get rl_InitWindow() phases timings (startup trace)
+// NOTE: Also logged at LOG_DEBUG level on initialization
+rl_StartupStats rl_GetStartupStats(void)
+{
+    return startupStats;
+}
+
+// Get GPU memory stats by resource type (rl_GpuMemoryType), use -1 to accumulate all types
+rl_MemoryStats rl_GetGpuMemoryStats(int type)
+{
+    rlGpuMemoryStats gpuStats = rlGetGpuMemoryStats(type);
+    rl_MemoryStats stats = { 0 };
+
+    stats.liveBytes = gpuStats.liveBytes;
+    stats.peakBytes = gpuStats.peakBytes;
+    stats.liveCount = gpuStats.liveCount;
+    stats.totalCount = gpuStats.totalCount;
+
+    return stats;
+}
+
+// Export memory report as text file (GPU by resource type, CPU by module, audio buffers), NULL to log it
+// NOTE: CPU memory by module requires SUPPORT_MEMORY_TRACKING, only tagged allocations are reported otherwise
+bool rl_ExportMemoryReport(const char *fileName)
+{
+    #define MEMORY_REPORT_SIZE  4096
+
+    static const char *gpuTypeNames[] = { "textures", "render targets", "vertex buffers", "index buffers", "shader buffers" };
+    static const char *moduleNames[] = { "user", "rcore", "rshapes", "rtextures", "rtext", "rmodels", "raudio", "utils" };
+
+    char *report = (char *)RL_CALLOC(MEMORY_REPORT_SIZE, 1);
+    int length = 0;
+    bool result = false;
+
+    if (report == NULL) return result;
+
+    #define REPORT_LINE(name, stats) \
+        if (length < MEMORY_REPORT_SIZE) length += snprintf(report + length, MEMORY_REPORT_SIZE - length, "    %-16s %12.2f KB live | %12.2f KB peak | %8i live | %10u total\n", \
+            (name), (stats).liveBytes/1024.0, (stats).peakBytes/1024.0, (stats).liveCount, (stats).totalCount)
+
+    length += snprintf(report + length, MEMORY_REPORT_SIZE - length, "GPU memory (estimated):\n");
+    for (int i = 0; i < GPU_MEMORY_SHADER_BUFFER + 1; i++) REPORT_LINE(gpuTypeNames[i], rl_GetGpuMemoryStats(i));
+    REPORT_LINE("total", rl_GetGpuMemoryStats(-1));
+
+    if (length < MEMORY_REPORT_SIZE) length += snprintf(report + length, MEMORY_REPORT_SIZE - length, "CPU memory (tagged allocations):\n");
+    for (int i = 0; i < MEMORY_MODULE_UTILS + 1; i++) REPORT_LINE(moduleNames[i], rl_GetMemoryStats(i, -1));
+    REPORT_LINE("total", rl_GetMemoryStats(-1, -1));
+
+#if defined(SUPPORT_MODULE_RAUDIO)
+    if (length < MEMORY_REPORT_SIZE) length += snprintf(report + length, MEMORY_REPORT_SIZE - length, "Audio buffers memory:\n");
+    REPORT_LINE("buffers", rl_GetAudioMemoryStats());
 #endif
+
+    #undef REPORT_LINE
+
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_INFO, "MEMORY: Memory report:\n%s", report);
+        result = true;
+    }
+    else
+    {
+        result = rl_SaveFileText(fileName, report);
+
+        if (result) TRACELOG(LOG_INFO, "FILEIO: [%s] Memory report exported successfully", fileName);
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export memory report", fileName);
+    }
+
+    RL_FREE(report);
+
+    return result;
 }
 
 //----------------------------------------------------------------------------------
@@ -1827,17 +3024,12 @@ void rl_TakeScreenshot(const char *fileName)
     rl_Vector2 scale = { 1.0f, 1.0f };
     if (FLAG_IS_SET(CORE.Window.flags, FLAG_WINDOW_HIGHDPI)) scale = rl_GetWindowScaleDPI();
 
-    unsigned char *imgData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-    rl_Image image = { imgData, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
-
-    char path[MAX_FILEPATH_LENGTH] = { 0 };
+    // NOTE: Screen is read back asynchronously to avoid stalling the pipeline,
+    // screenshot file is exported on readback completion (usually 1-2 frames later)
+    char *path = (char *)RL_CALLOC(MAX_FILEPATH_LENGTH, sizeof(char));
     strncpy(path, rl_TextFormat("%s/%s", CORE.Storage.basePath, fileName), MAX_FILEPATH_LENGTH - 1);
 
-    rl_ExportImage(image, path); // WARNING: Module required: rtextures
-    RL_FREE(imgData);
-
-    if (rl_FileExists(path)) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
-    else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot could not be saved", path);
+    rlReadScreenPixelsAsync((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y), ScreenshotCallback, path);
 #else
     TRACELOG(LOG_WARNING,"IMAGE: rl_ExportImage() requires module: rtextures");
 #endif
@@ -1975,6 +3167,7 @@ bool rl_FileExists(const char *fileName)
     bool result = false;
 
     if (ACCESS(fileName) != -1) result = true;
+    else if (IsArchiveFile(fileName)) result = true;    // File available in a mounted archive
 
     // NOTE: Alternatively, stat() can be used instead of access()
     //#include <sys/stat.h>
@@ -2239,6 +3432,99 @@ const char *rl_GetPrevDirectoryPath(const char *dirPath)
     return prevDirPath;
 }
 
+// Get storage base path, used by modules to store cache files
+// NOTE: Required by text module font atlas cache
+const char *GetStorageBasePath(void)
+{
+    return CORE.Storage.basePath;
+}
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+// Watch asset file for changes, changed files are reloaded by rl_BeginDrawing()
+// NOTE: Required by textures module for shared textures files, called from main thread
+void WatchAssetFile(const char *fileName)
+{
+    for (int i = 0; i < assetsWatcher.fileCount; i++)
+    {
+        if (strcmp(assetsWatcher.files[i].fileName, fileName) == 0) return;
+    }
+
+    if (assetsWatcher.fileCount >= assetsWatcher.fileCapacity)
+    {
+        int capacity = (assetsWatcher.fileCapacity > 0)? assetsWatcher.fileCapacity*2 : 32;
+        WatchedAssetFile *files = (WatchedAssetFile *)RL_REALLOC(assetsWatcher.files, capacity*sizeof(WatchedAssetFile));
+        if (files == NULL) return;
+
+        assetsWatcher.files = files;
+        assetsWatcher.fileCapacity = capacity;
+    }
+
+    WatchedAssetFile *file = &assetsWatcher.files[assetsWatcher.fileCount];
+    int length = (int)strlen(fileName);
+
+    file->fileName = (char *)RL_MALLOC(length + 1);
+    if (file->fileName == NULL) return;
+    memcpy(file->fileName, fileName, length + 1);
+
+    file->modTime = rl_GetFileModTime(fileName);
+    file->directory = -1;
+    file->changed = false;
+
+#if defined(__linux__)
+    if (!assetsWatcher.initialized)
+    {
+        assetsWatcher.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        assetsWatcher.initialized = true;
+
+        if (assetsWatcher.fd < 0) TRACELOG(LOG_WARNING, "FILEIO: Failed to initialize file system events, watched files are polled");
+    }
+
+    if (assetsWatcher.fd >= 0)
+    {
+        // File directory is watched, editors usually save files replacing them (moved to directory)
+        const char *dirPath = rl_GetDirectoryPath(fileName);
+
+        for (int i = 0; i < assetsWatcher.directoryCount; i++)
+        {
+            if (strcmp(assetsWatcher.directories[i].path, dirPath) == 0) { file->directory = i; break; }
+        }
+
+        if (file->directory < 0)
+        {
+            int wd = inotify_add_watch(assetsWatcher.fd, dirPath, IN_CLOSE_WRITE | IN_MOVED_TO);
+
+            if ((wd >= 0) && (assetsWatcher.directoryCount >= assetsWatcher.directoryCapacity))
+            {
+                int capacity = (assetsWatcher.directoryCapacity > 0)? assetsWatcher.directoryCapacity*2 : 8;
+                WatchedDirectory *directories = (WatchedDirectory *)RL_REALLOC(assetsWatcher.directories, capacity*sizeof(WatchedDirectory));
+
+                if (directories != NULL)
+                {
+                    assetsWatcher.directories = directories;
+                    assetsWatcher.directoryCapacity = capacity;
+                }
+            }
+
+            if ((wd >= 0) && (assetsWatcher.directoryCount < assetsWatcher.directoryCapacity))
+            {
+                WatchedDirectory *directory = &assetsWatcher.directories[assetsWatcher.directoryCount];
+                int pathLength = (int)strlen(dirPath);
+
+                directory->wd = wd;
+                directory->path = (char *)RL_MALLOC(pathLength + 1);
+                memcpy(directory->path, dirPath, pathLength + 1);
+
+                file->directory = assetsWatcher.directoryCount;
+                assetsWatcher.directoryCount++;
+            }
+        }
+    }
+#endif
+
+    assetsWatcher.fileCount++;
+}
+#endif
+
+
 // Get current working directory
 const char *rl_GetWorkingDirectory(void)
 {
@@ -2355,62 +3641,55 @@ const char *rl_GetApplicationDirectory(void)
 }
 
 // Load directory filepaths
-// NOTE: Base path is prepended to the scanned filepaths
-// WARNING: Directory is scanned twice, first time to get files count
+// NOTE: Base path is prepended to the scanned filepaths, directory paths are also registered
 // No recursive scanning is done!
 rl_FilePathList rl_LoadDirectoryFiles(const char *dirPath)
 {
     rl_FilePathList files = { 0 };
-    unsigned int fileCounter = 0;
 
-    struct dirent *entity;
-    DIR *dir = opendir(dirPath);
-
-    if (dir != NULL) // It's a directory
-    {
-        // SCAN 1: Count files
-        while ((entity = readdir(dir)) != NULL)
-        {
-            // NOTE: We skip '.' (current dir) and '..' (parent dir) filepaths
-            if ((strcmp(entity->d_name, ".") != 0) && (strcmp(entity->d_name, "..") != 0)) fileCounter++;
-        }
-
-        // Memory allocation for dirFileCount
-        files.capacity = fileCounter;
-        files.paths = (char **)RL_CALLOC(files.capacity, sizeof(char *));
-        for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_CALLOC(MAX_FILEPATH_LENGTH, sizeof(char));
-
-        closedir(dir);
-
-        // SCAN 2: Read filepaths
-        // NOTE: Directory paths are also registered
-        ScanDirectoryFiles(dirPath, &files, NULL);
-
-        // Security check: read files.count should match fileCounter
-        if (files.count != files.capacity) TRACELOG(LOG_WARNING, "FILEIO: Read files count do not match capacity allocated");
-    }
-    else TRACELOG(LOG_WARNING, "FILEIO: Failed to open requested directory");  // Maybe it's a file...
+    int count = 0;
+    ScanDirectory(dirPath, NULL, false, AddFilePathListEntry, &files, &count, NULL);
 
     return files;
 }
 
 // Load directory filepaths with extension filtering and recursive directory scan
-// NOTE: On recursive loading we do not pre-scan for file count, we use MAX_FILEPATH_CAPACITY
+// NOTE: Paths list capacity grows as required (starting with MAX_FILEPATH_CAPACITY entries),
+// on recursive loading subdirectories are scanned in parallel (if supported), paths order is not sorted
 rl_FilePathList rl_LoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs)
 {
     rl_FilePathList files = { 0 };
 
     files.capacity = MAX_FILEPATH_CAPACITY;
     files.paths = (char **)RL_CALLOC(files.capacity, sizeof(char *));
-    for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_CALLOC(MAX_FILEPATH_LENGTH, sizeof(char));
 
     // WARNING: basePath is always prepended to scanned paths
-    if (scanSubdirs) ScanDirectoryFilesRecursively(basePath, &files, filter);
-    else ScanDirectoryFiles(basePath, &files, filter);
+#if defined(SUPPORT_DIRECTORY_SCAN_THREADS)
+    if (scanSubdirs) ScanDirectoryParallel(basePath, filter, &files);
+    else
+#endif
+    {
+        int count = 0;
+        ScanDirectory(basePath, filter, scanSubdirs, AddFilePathListEntry, &files, &count, NULL);
+    }
 
     return files;
 }
 
+// Scan directory filepaths, streamed to callback with no paths list allocated
+// NOTE: Same filtering as rl_LoadDirectoryFilesEx(), callback is called on caller thread,
+// scanning stops if callback returns false, returns number of paths passed to callback
+int rl_ScanDirectoryFiles(const char *basePath, const char *filter, bool scanSubdirs, DirectoryFileCallback callback, void *userData)
+{
+    int count = 0;
+
+    if ((basePath == NULL) || (callback == NULL)) return 0;
+
+    ScanDirectory(basePath, filter, scanSubdirs, callback, userData, &count, NULL);
+
+    return count;
+}
+
 // Unload directory filepaths
 // WARNING: files.count is not reseted to 0 after unloading
 void rl_UnloadDirectoryFiles(rl_FilePathList files)
@@ -2625,6 +3904,325 @@ unsigned char *rl_DecompressData(const unsigned char *compData, int compDataSize
     return data;
 }
 
+// Compress data into compressed blocks stream, blocks compressed in parallel
+// NOTE: Data is split into COMPRESSION_BLOCK_SIZE blocks compressed independently, up to threads
+// workers are used (if supported), output can be decompressed with rl_DecompressDataEx() or a stream
+unsigned char *rl_CompressDataEx(const unsigned char *data, int dataSize, int *compDataSize, int codec, int threads)
+{
+    unsigned char *compData = NULL;
+    *compDataSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if ((data == NULL) && (dataSize > 0)) return NULL;
+    if ((codec != COMPRESSION_DEFLATE) && (codec != COMPRESSION_LZ4))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Compression codec not supported (%i)", codec);
+        return NULL;
+    }
+
+    CompressionWork work = { 0 };
+    work.blockCount = (dataSize + COMPRESSION_BLOCK_SIZE - 1)/COMPRESSION_BLOCK_SIZE;
+    work.codec = codec;
+    work.decompress = false;
+
+    if (work.blockCount > 0) work.blocks = (CompressionBlock *)RL_CALLOC(work.blockCount, sizeof(CompressionBlock));
+
+    for (int i = 0; i < work.blockCount; i++)
+    {
+        work.blocks[i].input = data + i*COMPRESSION_BLOCK_SIZE;
+        work.blocks[i].inputSize = ((dataSize - i*COMPRESSION_BLOCK_SIZE) < COMPRESSION_BLOCK_SIZE)? (dataSize - i*COMPRESSION_BLOCK_SIZE) : COMPRESSION_BLOCK_SIZE;
+    }
+
+    RunCompressionWork(&work, threads);
+
+    // Compute compressed stream size and check blocks
+    bool success = true;
+    int size = COMPRESSED_STREAM_HEADER_SIZE + COMPRESSED_BLOCK_HEADER_SIZE;
+    for (int i = 0; i < work.blockCount; i++)
+    {
+        if (!work.blocks[i].success) success = false;
+        else size += COMPRESSED_BLOCK_HEADER_SIZE + work.blocks[i].outputSize;
+    }
+
+    if (success) compData = (unsigned char *)RL_MALLOC(size);
+
+    if (compData != NULL)
+    {
+        unsigned char *ptr = compData;
+        WriteCompressedStreamHeader(ptr, codec, COMPRESSION_BLOCK_SIZE);
+        ptr += COMPRESSED_STREAM_HEADER_SIZE;
+
+        for (int i = 0; i < work.blockCount; i++)
+        {
+            WRITE_U32_LE(ptr, work.blocks[i].inputSize);
+            WRITE_U32_LE(ptr + 4, work.blocks[i].outputSize | (work.blocks[i].stored? COMPRESSED_BLOCK_STORED : 0));
+            memcpy(ptr + COMPRESSED_BLOCK_HEADER_SIZE, work.blocks[i].output, work.blocks[i].outputSize);
+            ptr += COMPRESSED_BLOCK_HEADER_SIZE + work.blocks[i].outputSize;
+        }
+
+        WRITE_U32_LE(ptr, 0);
+        WRITE_U32_LE(ptr + 4, ~UpdateCRC32(~0u, data, dataSize));
+
+        *compDataSize = size;
+        TRACELOG(LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i (%i blocks)", dataSize, size, work.blockCount);
+    }
+    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to compress data");
+
+    for (int i = 0; i < work.blockCount; i++) RL_FREE(work.blocks[i].output);
+    RL_FREE(work.blocks);
+#endif
+
+    return compData;
+}
+
+// Decompress compressed blocks stream data, blocks decompressed in parallel
+// NOTE: Uncompressed size is known from blocks headers, no MAX_DECOMPRESSION_SIZE limit applies
+unsigned char *rl_DecompressDataEx(const unsigned char *compData, int compDataSize, int *dataSize, int threads)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    int codec = 0;
+    unsigned int blockSize = 0;
+
+    if ((compData == NULL) || !ReadCompressedStreamHeader(compData, compDataSize, &codec, &blockSize))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Decompress data: Data is not a valid compressed stream");
+        return NULL;
+    }
+
+    // Validate blocks headers, computing total uncompressed size
+    CompressionWork work = { 0 };
+    work.codec = codec;
+    work.decompress = true;
+
+    long long size = 0;
+    int offset = COMPRESSED_STREAM_HEADER_SIZE;
+    bool valid = false;
+
+    while ((compDataSize - offset) >= COMPRESSED_BLOCK_HEADER_SIZE)
+    {
+        unsigned int rawSize = READ_U32_LE(compData + offset);
+        unsigned int packedSize = READ_U32_LE(compData + offset + 4) & ~COMPRESSED_BLOCK_STORED;
+        offset += COMPRESSED_BLOCK_HEADER_SIZE;
+
+        if (rawSize == 0) { valid = true; break; }  // End of stream
+        if ((rawSize > blockSize) || (packedSize > (unsigned int)(compDataSize - offset))) break;
+
+        size += rawSize;
+        offset += (int)packedSize;
+        work.blockCount++;
+    }
+
+    if (!valid || (size > 0x7fffffff))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Decompress data: Compressed stream is not valid or truncated");
+        return NULL;
+    }
+
+    data = (unsigned char *)RL_MALLOC((size > 0)? (size_t)size : 1);
+    if (work.blockCount > 0) work.blocks = (CompressionBlock *)RL_CALLOC(work.blockCount, sizeof(CompressionBlock));
+
+    // Setup blocks, output is decompressed directly into final location
+    offset = COMPRESSED_STREAM_HEADER_SIZE;
+    int dataOffset = 0;
+    for (int i = 0; i < work.blockCount; i++)
+    {
+        unsigned int packedSize = READ_U32_LE(compData + offset + 4);
+
+        work.blocks[i].outputSize = (int)READ_U32_LE(compData + offset);
+        work.blocks[i].inputSize = (int)(packedSize & ~COMPRESSED_BLOCK_STORED);
+        work.blocks[i].stored = ((packedSize & COMPRESSED_BLOCK_STORED) != 0);
+        work.blocks[i].input = compData + offset + COMPRESSED_BLOCK_HEADER_SIZE;
+        work.blocks[i].output = data + dataOffset;
+
+        offset += COMPRESSED_BLOCK_HEADER_SIZE + work.blocks[i].inputSize;
+        dataOffset += work.blocks[i].outputSize;
+    }
+
+    RunCompressionWork(&work, threads);
+
+    bool success = true;
+    for (int i = 0; i < work.blockCount; i++) if (!work.blocks[i].success) success = false;
+
+    unsigned int crc = READ_U32_LE(compData + offset + 4);
+    if (success && (crc != ~UpdateCRC32(~0u, data, (int)size))) success = false;
+
+    RL_FREE(work.blocks);
+
+    if (success)
+    {
+        *dataSize = (int)size;
+        TRACELOG(LOG_INFO, "SYSTEM: Decompress data: Comp. size: %i -> Original size: %i", compDataSize, *dataSize);
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Decompress data: Compressed stream data is corrupted");
+        RL_FREE(data);
+        data = NULL;
+    }
+#endif
+
+    return data;
+}
+
+// Init compression stream, output data is streamed to callback
+// NOTE: Compression stream outputs a compressed blocks stream (same format as rl_CompressDataEx()),
+// decompression stream reads the codec from stream header (codec parameter is ignored)
+rl_CompressionStream *rl_InitCompressionStream(int codec, bool decompress, CompressionStreamCallback callback, void *userData)
+{
+    rl_CompressionStream *stream = NULL;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (callback == NULL) return NULL;
+    if (!decompress && (codec != COMPRESSION_DEFLATE) && (codec != COMPRESSION_LZ4))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Compression codec not supported (%i)", codec);
+        return NULL;
+    }
+
+    stream = (rl_CompressionStream *)RL_CALLOC(1, sizeof(rl_CompressionStream));
+    stream->codec = codec;
+    stream->decompress = decompress;
+    stream->callback = callback;
+    stream->userData = userData;
+    stream->crc = ~0u;
+
+    if (!decompress)
+    {
+        // Compressed block is generated after block header, header is written first
+        unsigned char header[COMPRESSED_STREAM_HEADER_SIZE] = { 0 };
+
+        stream->blockSize = COMPRESSION_BLOCK_SIZE;
+        stream->bufferCapacity = COMPRESSION_BLOCK_SIZE;
+        stream->buffer = (unsigned char *)RL_MALLOC(stream->bufferCapacity);
+        stream->output = (unsigned char *)RL_MALLOC(COMPRESSED_BLOCK_HEADER_SIZE + GetCompressBlockBound(COMPRESSION_BLOCK_SIZE));
+        if (codec == COMPRESSION_DEFLATE) stream->sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));
+
+        WriteCompressedStreamHeader(header, codec, COMPRESSION_BLOCK_SIZE);
+        stream->header = true;
+        if (!callback(header, COMPRESSED_STREAM_HEADER_SIZE, userData)) stream->failed = true;
+    }
+#endif
+
+    return stream;
+}
+
+// Update compression stream with input data chunk
+// NOTE: Output is generated on every completed block, returns false if stream failed
+bool rl_UpdateCompressionStream(rl_CompressionStream *stream, const unsigned char *data, int dataSize)
+{
+    if (stream == NULL) return false;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (stream->failed || (data == NULL) || (dataSize <= 0)) return !stream->failed;
+
+    if (!stream->decompress)
+    {
+        stream->crc = UpdateCRC32(stream->crc, data, dataSize);
+
+        while (!stream->failed && (dataSize > 0))
+        {
+            // Complete blocks are processed directly from input data
+            if ((stream->bufferSize == 0) && (dataSize >= (int)stream->blockSize))
+            {
+                if (!WriteCompressionStreamBlock(stream, data, stream->blockSize)) stream->failed = true;
+                data += stream->blockSize;
+                dataSize -= stream->blockSize;
+                continue;
+            }
+
+            int copySize = stream->blockSize - stream->bufferSize;
+            if (copySize > dataSize) copySize = dataSize;
+
+            memcpy(stream->buffer + stream->bufferSize, data, copySize);
+            stream->bufferSize += copySize;
+            data += copySize;
+            dataSize -= copySize;
+
+            if (stream->bufferSize == (int)stream->blockSize)
+            {
+                if (!WriteCompressionStreamBlock(stream, stream->buffer, stream->bufferSize)) stream->failed = true;
+                stream->bufferSize = 0;
+            }
+        }
+    }
+    else
+    {
+        if (stream->finished)
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Compression stream: Data found after stream end, ignored");
+            return true;
+        }
+
+        // Input data is accumulated until a full block is available
+        if ((stream->bufferSize + dataSize) > stream->bufferCapacity)
+        {
+            int capacity = (stream->bufferCapacity > 0)? stream->bufferCapacity : 4096;
+            while (capacity < (stream->bufferSize + dataSize)) capacity *= 2;
+
+            unsigned char *buffer = (unsigned char *)RL_REALLOC(stream->buffer, capacity);
+            if (buffer == NULL) { stream->failed = true; return false; }
+
+            stream->buffer = buffer;
+            stream->bufferCapacity = capacity;
+        }
+
+        memcpy(stream->buffer + stream->bufferSize, data, dataSize);
+        stream->bufferSize += dataSize;
+
+        int offset = ReadCompressionStreamBlocks(stream, stream->buffer, stream->bufferSize);
+
+        stream->bufferSize -= offset;
+        if ((offset > 0) && (stream->bufferSize > 0)) memmove(stream->buffer, stream->buffer + offset, stream->bufferSize);
+    }
+
+    return !stream->failed;
+#else
+    return false;
+#endif
+}
+
+// Close compression stream, remaining data is flushed
+// NOTE: Returns false if stream failed or decompressed stream is truncated
+bool rl_CloseCompressionStream(rl_CompressionStream *stream)
+{
+    if (stream == NULL) return false;
+
+    bool success = false;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (!stream->decompress && !stream->failed)
+    {
+        // Flush pending block and write stream end
+        if ((stream->bufferSize > 0) && !WriteCompressionStreamBlock(stream, stream->buffer, stream->bufferSize)) stream->failed = true;
+
+        if (!stream->failed)
+        {
+            unsigned char end[COMPRESSED_BLOCK_HEADER_SIZE] = { 0 };
+            WRITE_U32_LE(end + 4, ~stream->crc);
+            if (!stream->callback(end, COMPRESSED_BLOCK_HEADER_SIZE, stream->userData)) stream->failed = true;
+        }
+    }
+    else if (stream->decompress && !stream->failed && !stream->finished)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Compression stream: Compressed stream is truncated");
+        stream->failed = true;
+    }
+
+    success = !stream->failed;
+
+    RL_FREE(stream->buffer);
+    RL_FREE(stream->output);
+    RL_FREE(stream->sdefl);
+#endif
+
+    RL_FREE(stream);
+
+    return success;
+}
+
 // Encode data to Base64 string
 // NOTE: Returned string includes NULL terminator, considered on outputSize
 char *rl_EncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
@@ -2753,377 +4351,205 @@ unsigned char *rl_DecodeDataBase64(const char *text, int *outputSize)
 // Compute CRC32 hash code
 unsigned int rl_ComputeCRC32(unsigned char *data, int dataSize)
 {
-    static unsigned int crcTable[256] = {
-        0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
-        0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
-        0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
-        0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
-        0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
-        0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
-        0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
-        0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
-        0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
-        0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
-        0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
-        0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
-        0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
-        0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
-        0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
-        0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
-        0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
-        0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
-        0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
-        0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
-        0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
-        0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
-        0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
-        0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
-        0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
-        0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
-        0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
-        0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
-        0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
-        0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
-        0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
-        0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
-    };
-
-    unsigned int crc = ~0u;
-
-    for (int i = 0; i < dataSize; i++) crc = (crc >> 8) ^ crcTable[data[i] ^ (crc & 0xff)];
+    rl_HashState state = rl_InitHash(HASH_CRC32);
+    rl_UpdateHash(&state, data, dataSize);
 
-    return ~crc;
+    return rl_FinishHash(&state)[0];
 }
 
 // Compute MD5 hash code
 // NOTE: Returns a static int[4] array (16 bytes)
 unsigned int *rl_ComputeMD5(unsigned char *data, int dataSize)
 {
-    #define ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
-
     static unsigned int hash[4] = { 0 };  // Hash to be returned
 
-    // WARNING: All variables are unsigned 32 bit and wrap modulo 2^32 when calculating
+    rl_HashState state = rl_InitHash(HASH_MD5);
+    rl_UpdateHash(&state, data, dataSize);
+    memcpy(hash, rl_FinishHash(&state), 4*sizeof(unsigned int));
 
-    // NOTE: r specifies the per-round shift amounts
-    unsigned int r[] = {
-        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
-        5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
-        4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
-        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
-    };
+    return hash;
+}
 
-    // Using binary integer part of the sines of integers (in radians) as constants
-    unsigned int k[] = {
-        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
-        0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
-        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
-        0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
-        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
-        0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
-        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
-        0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
-        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
-        0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
-        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
-        0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
-        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
-        0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
-        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
-        0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
-    };
+// Compute SHA-1 hash code
+// NOTE: Returns a static int[5] array (20 bytes)
+unsigned int *rl_ComputeSHA1(unsigned char *data, int dataSize)
+{
+    static unsigned int hash[5] = { 0 };  // Hash to be returned
 
-    hash[0] = 0x67452301;
-    hash[1] = 0xefcdab89;
-    hash[2] = 0x98badcfe;
-    hash[3] = 0x10325476;
+    rl_HashState state = rl_InitHash(HASH_SHA1);
+    rl_UpdateHash(&state, data, dataSize);
+    memcpy(hash, rl_FinishHash(&state), 5*sizeof(unsigned int));
 
-    // Pre-processing: adding a single 1 bit
-    // Append '1' bit to message
-    // NOTE: The input bytes are considered as bits strings,
-    // where the first bit is the most significant bit of the byte
+    return hash;
+}
 
-    // Pre-processing: padding with zeros
-    // Append '0' bit until message length in bit 448 (mod 512)
-    // Append length mod (2 pow 64) to message
+// Compute SHA-256 hash code
+// NOTE: Returns a static int[8] array (32 bytes)
+unsigned int *rl_ComputeSHA256(unsigned char *data, int dataSize)
+{
+    static unsigned int hash[8] = { 0 };  // Hash to be returned
 
-    int newDataSize = ((((dataSize + 8)/64) + 1)*64) - 8;
+    rl_HashState state = rl_InitHash(HASH_SHA256);
+    rl_UpdateHash(&state, data, dataSize);
+    memcpy(hash, rl_FinishHash(&state), 8*sizeof(unsigned int));
 
-    unsigned char *msg = (unsigned char *)RL_CALLOC(newDataSize + 64, 1); // Initialize with '0' bits, allocating 64 extra bytes
-    memcpy(msg, data, dataSize);
-    msg[dataSize] = 128; // Write the '1' bit
+    return hash;
+}
 
-    unsigned int bitsLen = 8*dataSize;
-    memcpy(msg + newDataSize, &bitsLen, 4); // Append the len in bits at the end of the buffer
+// Init hash state for streaming hash computation
+rl_HashState rl_InitHash(int hashType)
+{
+    rl_HashState state = { 0 };
+    state.type = hashType;
 
-    // Process the message in successive 512-bit chunks for each 512-bit chunk of message
-    for (int offset = 0; offset < newDataSize; offset += (512/8))
+    switch (hashType)
     {
-        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
-        unsigned int *w = (unsigned int *)(msg + offset);
+        case HASH_CRC32: state.digest[0] = ~0u; break;
+        case HASH_MD5:
+        {
+            state.digest[0] = 0x67452301;
+            state.digest[1] = 0xefcdab89;
+            state.digest[2] = 0x98badcfe;
+            state.digest[3] = 0x10325476;
+        } break;
+        case HASH_SHA1:
+        {
+            state.digest[0] = 0x67452301;
+            state.digest[1] = 0xefcdab89;
+            state.digest[2] = 0x98badcfe;
+            state.digest[3] = 0x10325476;
+            state.digest[4] = 0xc3d2e1f0;
+        } break;
+        case HASH_SHA256:
+        {
+            state.digest[0] = 0x6a09e667;
+            state.digest[1] = 0xbb67ae85;
+            state.digest[2] = 0x3c6ef372;
+            state.digest[3] = 0xa54ff53a;
+            state.digest[4] = 0x510e527f;
+            state.digest[5] = 0x9b05688c;
+            state.digest[6] = 0x1f83d9ab;
+            state.digest[7] = 0x5be0cd19;
+        } break;
+        default: TRACELOG(LOG_WARNING, "HASH: Hash type not supported (%i)", hashType); break;
+    }
 
-        // Initialize hash value for this chunk
-        unsigned int a = hash[0];
-        unsigned int b = hash[1];
-        unsigned int c = hash[2];
-        unsigned int d = hash[3];
+    return state;
+}
 
-        for (int i = 0; i < 64; i++)
-        {
-            unsigned int f = 0;
-            unsigned int g = 0;
+// Update hash state with new data chunk
+// NOTE: Data is processed in 64 bytes blocks, remaining data is kept in state until next update
+void rl_UpdateHash(rl_HashState *state, const unsigned char *data, int dataSize)
+{
+    if ((state == NULL) || (data == NULL) || (dataSize <= 0)) return;
 
-            if (i < 16)
-            {
-                f = (b & c) | ((~b) & d);
-                g = i;
-            }
-            else if (i < 32)
-            {
-                f = (d & b) | ((~d) & c);
-                g = (5*i + 1)%16;
-            }
-            else if (i < 48)
-            {
-                f = b ^ c ^ d;
-                g = (3*i + 5)%16;
-            }
-            else
-            {
-                f = c ^ (b | (~d));
-                g = (7*i)%16;
-            }
-
-            unsigned int temp = d;
-            d = c;
-            c = b;
-            b = b + ROTATE_LEFT((a + f + k[i] + w[g]), r[i]);
-            a = temp;
-        }
+    state->size += dataSize;
 
-        // Add chunk's hash to result so far
-        hash[0] += a;
-        hash[1] += b;
-        hash[2] += c;
-        hash[3] += d;
+    if (state->type == HASH_CRC32)
+    {
+        state->digest[0] = UpdateCRC32(state->digest[0], data, dataSize);
+        return;
     }
 
-    RL_FREE(msg);
+    // Complete pending block data first
+    if (state->blockSize > 0)
+    {
+        int copySize = 64 - state->blockSize;
+        if (copySize > dataSize) copySize = dataSize;
 
-    return hash;
-}
+        memcpy(state->block + state->blockSize, data, copySize);
+        state->blockSize += copySize;
+        data += copySize;
+        dataSize -= copySize;
 
-// Compute SHA-1 hash code
-// NOTE: Returns a static int[5] array (20 bytes)
-unsigned int *rl_ComputeSHA1(unsigned char *data, int dataSize)
-{
-    #define SHA1_ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
+        if (state->blockSize < 64) return;
 
-    static unsigned int hash[5] = { 0 };  // Hash to be returned
+        ProcessHashBlocks(state->type, state->digest, state->block, 1);
+        state->blockSize = 0;
+    }
 
-    // Initialize hash values
-    hash[0] = 0x67452301;
-    hash[1] = 0xEFCDAB89;
-    hash[2] = 0x98BADCFE;
-    hash[3] = 0x10325476;
-    hash[4] = 0xC3D2E1F0;
-
-    // Pre-processing: adding a single 1 bit
-    // Append '1' bit to message
-    // NOTE: The input bytes are considered as bits strings,
-    // where the first bit is the most significant bit of the byte
-
-    // Pre-processing: padding with zeros
-    // Append '0' bit until message length in bit 448 (mod 512)
-    // Append length mod (2 pow 64) to message
-
-    int newDataSize = ((((dataSize + 8)/64) + 1)*64);
-
-    unsigned char *msg = (unsigned char *)RL_CALLOC(newDataSize, 1); // Initialize with '0' bits
-    memcpy(msg, data, dataSize);
-    msg[dataSize] = 128; // Write the '1' bit
-
-    unsigned long long bitsLen = 8ULL * dataSize;
-    msg[newDataSize-1] = (unsigned char)(bitsLen);
-    msg[newDataSize-2] = (unsigned char)(bitsLen >> 8);
-    msg[newDataSize-3] = (unsigned char)(bitsLen >> 16);
-    msg[newDataSize-4] = (unsigned char)(bitsLen >> 24);
-    msg[newDataSize-5] = (unsigned char)(bitsLen >> 32);
-    msg[newDataSize-6] = (unsigned char)(bitsLen >> 40);
-    msg[newDataSize-7] = (unsigned char)(bitsLen >> 48);
-    msg[newDataSize-8] = (unsigned char)(bitsLen >> 56);
-
-    // Process the message in successive 512-bit chunks
-    for (int offset = 0; offset < newDataSize; offset += (512/8))
-    {
-        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
-        unsigned int w[80] = { 0 };
-        for (int i = 0; i < 16; i++)
-        {
-            w[i] = (msg[offset + (i*4) + 0] << 24) |
-                   (msg[offset + (i*4) + 1] << 16) |
-                   (msg[offset + (i*4) + 2] << 8) |
-                   (msg[offset + (i*4) + 3]);
-        }
+    // Process full blocks directly from data
+    int blockCount = dataSize/64;
+    if (blockCount > 0) ProcessHashBlocks(state->type, state->digest, data, blockCount);
 
-        // Message schedule: extend the sixteen 32-bit words into eighty 32-bit words:
-        for (int i = 16; i < 80; i++) w[i] = SHA1_ROTATE_LEFT(w[i-3] ^ w[i-8] ^ w[i-14] ^ w[i-16], 1);
+    // Keep remaining data for next update
+    state->blockSize = dataSize - blockCount*64;
+    if (state->blockSize > 0) memcpy(state->block, data + blockCount*64, state->blockSize);
+}
 
-        // Initialize hash value for this chunk
-        unsigned int a = hash[0];
-        unsigned int b = hash[1];
-        unsigned int c = hash[2];
-        unsigned int d = hash[3];
-        unsigned int e = hash[4];
+// Finish hash computation, returns state digest
+// NOTE: Returned digest size depends on hash type: CRC32: int[1], MD5: int[4], SHA1: int[5], SHA256: int[8]
+// WARNING: Hash state can not be updated after finishing
+unsigned int *rl_FinishHash(rl_HashState *state)
+{
+    if (state == NULL) return NULL;
 
-        for (int i = 0; i < 80; i++)
-        {
-            unsigned int f = 0;
-            unsigned int k = 0;
+    if (state->type == HASH_CRC32)
+    {
+        state->digest[0] = ~state->digest[0];
+        return state->digest;
+    }
 
-            if (i < 20)
-            {
-                f = (b & c) | ((~b) & d);
-                k = 0x5A827999;
-            }
-            else if (i < 40)
-            {
-                f = b ^ c ^ d;
-                k = 0x6ED9EBA1;
-            }
-            else if (i < 60)
-            {
-                f = (b & c) | (b & d) | (c & d);
-                k = 0x8F1BBCDC;
-            }
-            else
-            {
-                f = b ^ c ^ d;
-                k = 0xCA62C1D6;
-            }
+    // Pre-processing: adding a single 1 bit and padding with zeros
+    // until message length in bits is 448 (mod 512), length in bits is appended
+    // NOTE: MD5 appends length in little-endian, SHA in big-endian
+    unsigned long long bitsLength = state->size*8;
 
-            unsigned int temp = SHA1_ROTATE_LEFT(a, 5) + f + e + k + w[i];
-            e = d;
-            d = c;
-            c = SHA1_ROTATE_LEFT(b, 30);
-            b = a;
-            a = temp;
-        }
+    state->block[state->blockSize++] = 0x80;
+    if (state->blockSize > 56)
+    {
+        memset(state->block + state->blockSize, 0, 64 - state->blockSize);
+        ProcessHashBlocks(state->type, state->digest, state->block, 1);
+        state->blockSize = 0;
+    }
 
-        // Add this chunk's hash to result so far
-        hash[0] += a;
-        hash[1] += b;
-        hash[2] += c;
-        hash[3] += d;
-        hash[4] += e;
+    memset(state->block + state->blockSize, 0, 56 - state->blockSize);
+    for (int i = 0; i < 8; i++)
+    {
+        if (state->type == HASH_MD5) state->block[56 + i] = (unsigned char)(bitsLength >> (8*i));
+        else state->block[63 - i] = (unsigned char)(bitsLength >> (8*i));
     }
 
-    RL_FREE(msg);
+    ProcessHashBlocks(state->type, state->digest, state->block, 1);
+    state->blockSize = 0;
 
-    return hash;
+    return state->digest;
 }
 
-// Compute SHA-256 hash code
-// NOTE: Returns a static int[8] array (32 bytes)
-unsigned int *rl_ComputeSHA256(unsigned char *data, int dataSize)
+// Compute file hash code, file data is streamed in chunks (file is not fully loaded into memory)
+// NOTE: Returns a static int[8] array, valid values depend on hash type, NULL if file can not be read
+unsigned int *rl_ComputeFileHash(const char *fileName, int hashType)
 {
-    #define SHA256_ROTATE_RIGHT(x, c) ((x >> c) | (x << ((sizeof(unsigned int)*8) - c)))
-    #define SHA256_A0(x) (SHA256_ROTATE_RIGHT(x, 7) ^ SHA256_ROTATE_RIGHT(x, 18) ^ (x >> 3))
-    #define SHA256_A1(x) (SHA256_ROTATE_RIGHT(x, 17) ^ SHA256_ROTATE_RIGHT(x, 19) ^ (x >> 10))
-
-    static const unsigned int k[64] = {
-        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
-        0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
-        0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-        0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
-        0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
-        0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-    };
+    static unsigned int hash[8] = { 0 };  // Hash to be returned
 
-    static unsigned int hash[8] = { 0 };
-    hash[0] = 0x6A09e667;
-    hash[1] = 0xbb67ae85;
-    hash[2] = 0x3c6ef372;
-    hash[3] = 0xa54ff53a;
-    hash[4] = 0x510e527f;
-    hash[5] = 0x9b05688c;
-    hash[6] = 0x1f83d9ab;
-    hash[7] = 0x5be0cd19;
+    if (fileName == NULL) return NULL;
 
-    const unsigned long long int bitLen = ((unsigned long long int)dataSize)*8;
-    unsigned long long int paddedSize = dataSize + sizeof(dataSize);
-    paddedSize += (64 - (paddedSize%64));
-    unsigned char *buffer = (unsigned char *)RL_CALLOC(paddedSize, sizeof(unsigned char));
+    FILE *file = fopen(fileName, "rb");
 
-    memcpy(buffer, data, dataSize);
-    buffer[dataSize] = 0x80;
-    for (int i = 1; i <= sizeof(bitLen); i++)
+    if (file == NULL)
     {
-        buffer[(paddedSize - sizeof(bitLen)) + (i - 1)] = (bitLen >> (8*(sizeof(bitLen) - i))) & 0xFF;
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+        return NULL;
     }
 
-    for (unsigned long long int blockN = 0; blockN < paddedSize/64; blockN++)
-    {
-        unsigned int a = hash[0];
-        unsigned int b = hash[1];
-        unsigned int c = hash[2];
-        unsigned int d = hash[3];
-        unsigned int e = hash[4];
-        unsigned int f = hash[5];
-        unsigned int g = hash[6];
-        unsigned int h = hash[7];
+    unsigned char *buffer = (unsigned char *)RL_MALLOC(FILE_HASH_CHUNK_SIZE);
+    rl_HashState state = rl_InitHash(hashType);
 
-        unsigned char *block = buffer + (blockN*64);
-        unsigned int w[64] = { 0 };
-        for (int i = 0; i < 16; i++)
-        {
-            w[i] = ((unsigned int)block[i*4 + 0] << 24) |
-                   ((unsigned int)block[i*4 + 1] << 16) |
-                   ((unsigned int)block[i*4 + 2] << 8)  |
-                   ((unsigned int)block[i*4 + 3]);
-        }
-        for (int t = 16; t < 64; t++) w[t] = SHA256_A1(w[t - 2]) + w[t - 7] + SHA256_A0(w[t - 15]) + w[t - 16];
+    size_t readSize = 0;
+    while ((readSize = fread(buffer, 1, FILE_HASH_CHUNK_SIZE, file)) > 0) rl_UpdateHash(&state, buffer, (int)readSize);
 
-        for (unsigned long long int t = 0; t < 64; t++)
-        {
-            unsigned int e1 = (SHA256_ROTATE_RIGHT(e, 6) ^ SHA256_ROTATE_RIGHT(e, 11) ^ SHA256_ROTATE_RIGHT(e, 25));
-            unsigned int ch = ((e & f) ^ (~e & g));
-            unsigned int t1 = (h + e1 + ch + k[t] + w[t]);
-            unsigned int e0 = (SHA256_ROTATE_RIGHT(a, 2) ^ SHA256_ROTATE_RIGHT(a, 13) ^ SHA256_ROTATE_RIGHT(a, 22));
-            unsigned int maj = ((a & b) ^ (a & c) ^ (b & c));
-            unsigned int t2 = e0 + maj;
+    bool failed = (ferror(file) != 0);
 
-            h = g;
-            g = f;
-            f = e;
-            e = d + t1;
-            d = c;
-            c = b;
-            b = a;
-            a = t1 + t2;
-        }
+    fclose(file);
+    RL_FREE(buffer);
 
-        hash[0] += a;
-        hash[1] += b;
-        hash[2] += c;
-        hash[3] += d;
-        hash[4] += e;
-        hash[5] += f;
-        hash[6] += g;
-        hash[7] += h;
+    if (failed)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+        return NULL;
     }
 
-    RL_FREE(buffer);
+    memcpy(hash, rl_FinishHash(&state), 8*sizeof(unsigned int));
 
     return hash;
 }
@@ -3132,7 +4558,8 @@ unsigned int *rl_ComputeSHA256(unsigned char *data, int dataSize)
 // Module Functions Definition: Automation Events Recording and Playing
 //----------------------------------------------------------------------------------
 
-// Load automation events list from file, NULL for empty list, capacity = MAX_AUTOMATION_EVENTS
+// Load automation events list from file, NULL for empty list, initial capacity = MAX_AUTOMATION_EVENTS
+// NOTE: Text and binary events files supported, list capacity grows as required
 rl_AutomationEventList rl_LoadAutomationEventList(const char *fileName)
 {
     rl_AutomationEventList list = { 0 };
@@ -3143,28 +4570,9 @@ rl_AutomationEventList rl_LoadAutomationEventList(const char *fileName)
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
     if (fileName == NULL) TRACELOG(LOG_INFO, "AUTOMATION: New empty events list loaded successfully");
+    else if (IsAutomationEventsBinaryFile(fileName)) LoadAutomationEventsBinary(fileName, &list);
     else
     {
-        // Load automation events file (binary)
-        /*
-        //int dataSize = 0;
-        //unsigned char *data = rl_LoadFileData(fileName, &dataSize);
-
-        FILE *raeFile = fopen(fileName, "rb");
-        unsigned char fileId[4] = { 0 };
-
-        fread(fileId, 1, 4, raeFile);
-
-        if ((fileId[0] == 'r') && (fileId[1] == 'A') && (fileId[2] == 'E') && (fileId[1] == ' '))
-        {
-            fread(&eventCount, sizeof(int), 1, raeFile);
-            TRACELOG(LOG_WARNING, "Events loaded: %i\n", eventCount);
-            fread(events, sizeof(rl_AutomationEvent), eventCount, raeFile);
-        }
-
-        fclose(raeFile);
-        */
-
         // Load events file (text)
         //unsigned char *buffer = rl_LoadFileText(fileName);
         FILE *raeFile = fopen(fileName, "rt");
@@ -3185,6 +4593,8 @@ rl_AutomationEventList rl_LoadAutomationEventList(const char *fileName)
                     case 'c': sscanf(buffer, "c %i", &list.count); break;
                     case 'e':
                     {
+                        if ((counter == list.capacity) && !GrowAutomationEventList(&list)) break;
+
                         sscanf(buffer, "e %d %d %d %d %d %d %[^\n]s", &list.events[counter].frame, &list.events[counter].type,
                                &list.events[counter].params[0], &list.events[counter].params[1], &list.events[counter].params[2], &list.events[counter].params[3], eventDesc);
 
@@ -3222,6 +4632,175 @@ void rl_UnloadAutomationEventList(rl_AutomationEventList list)
 #endif
 }
 
+// Export automation events list as binary file
+// NOTE: Compact delta encoded events, optionally compressed (compressed blocks stream, DEFLATE codec)
+bool rl_ExportAutomationEventListBinary(rl_AutomationEventList list, const char *fileName, bool compress)
+{
+    bool success = false;
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    AutomationEventCoder coder = { 0 };
+    unsigned char *data = (unsigned char *)RL_MALLOC(AUTOMATION_BINARY_HEADER_SIZE + list.count*AUTOMATION_EVENT_MAX_SIZE);
+    int dataSize = AUTOMATION_BINARY_HEADER_SIZE;
+
+    for (unsigned int i = 0; i < list.count; i++) dataSize += EncodeAutomationEvent(&coder, &list.events[i], data + dataSize);
+
+#if !defined(SUPPORT_COMPRESSION_API)
+    if (compress) TRACELOG(LOG_WARNING, "AUTOMATION: Compression not supported, events file is not compressed");
+    compress = false;
+#endif
+
+    unsigned char header[AUTOMATION_BINARY_HEADER_SIZE] = { 'r', 'A', 'E', 'B', AUTOMATION_BINARY_VERSION, compress? AUTOMATION_BINARY_COMPRESSED : 0, 0, 0 };
+    memcpy(data, header, AUTOMATION_BINARY_HEADER_SIZE);
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (compress)
+    {
+        int compDataSize = 0;
+        unsigned char *compData = rl_CompressDataEx(data + AUTOMATION_BINARY_HEADER_SIZE, dataSize - AUTOMATION_BINARY_HEADER_SIZE, &compDataSize, COMPRESSION_DEFLATE, MAX_COMPRESSION_THREADS);
+
+        if (compData != NULL)
+        {
+            unsigned char *fileData = (unsigned char *)RL_MALLOC(AUTOMATION_BINARY_HEADER_SIZE + compDataSize);
+            memcpy(fileData, header, AUTOMATION_BINARY_HEADER_SIZE);
+            memcpy(fileData + AUTOMATION_BINARY_HEADER_SIZE, compData, compDataSize);
+
+            RL_FREE(data);
+            RL_FREE(compData);
+            data = fileData;
+            dataSize = AUTOMATION_BINARY_HEADER_SIZE + compDataSize;
+        }
+        else dataSize = 0;
+    }
+#endif
+
+    if (dataSize > 0) success = rl_SaveFileData(fileName, data, dataSize);
+
+    RL_FREE(data);
+
+    if (success) TRACELOG(LOG_INFO, "AUTOMATION: [%s] Events exported to binary file: %i", fileName, list.count);
+#endif
+
+    return success;
+}
+
+// Load automation events binary file for streamed playback
+// NOTE: Events are decoded on read, file data is loaded in chunks (no full events list is loaded)
+rl_AutomationEventStream *rl_LoadAutomationEventStream(const char *fileName)
+{
+    rl_AutomationEventStream *stream = NULL;
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    FILE *file = fopen(fileName, "rb");
+
+    if (file == NULL)
+    {
+        TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Failed to open events file", fileName);
+        return NULL;
+    }
+
+    unsigned char header[AUTOMATION_BINARY_HEADER_SIZE] = { 0 };
+
+    if ((fread(header, 1, AUTOMATION_BINARY_HEADER_SIZE, file) != AUTOMATION_BINARY_HEADER_SIZE) ||
+        (memcmp(header, "rAEB", 4) != 0) || (header[4] != AUTOMATION_BINARY_VERSION))
+    {
+        TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Events file is not a valid binary events file", fileName);
+        fclose(file);
+        return NULL;
+    }
+
+#if !defined(SUPPORT_COMPRESSION_API)
+    if (header[5] & AUTOMATION_BINARY_COMPRESSED)
+    {
+        TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Compressed events file not supported", fileName);
+        fclose(file);
+        return NULL;
+    }
+#endif
+
+    stream = (rl_AutomationEventStream *)RL_CALLOC(1, sizeof(rl_AutomationEventStream));
+    stream->file = file;
+
+    if (header[5] & AUTOMATION_BINARY_COMPRESSED) stream->compression = rl_InitCompressionStream(0, true, ReadAutomationEventStreamData, stream);
+#endif
+
+    return stream;
+}
+
+// Read next automation event from stream, returns false on stream end
+bool rl_ReadAutomationEvent(rl_AutomationEventStream *stream, rl_AutomationEvent *event)
+{
+    bool success = false;
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    if ((stream == NULL) || (event == NULL)) return false;
+
+    while (!stream->failed)
+    {
+        int size = DecodeAutomationEvent(&stream->coder, stream->buffer + stream->bufferOffset, stream->bufferSize - stream->bufferOffset, event);
+
+        if (size > 0)
+        {
+            stream->bufferOffset += size;
+            success = true;
+            break;
+        }
+        else if (size < 0)
+        {
+            TRACELOG(LOG_WARNING, "AUTOMATION: Events file data is corrupted");
+            stream->failed = true;
+        }
+        else if (stream->end)
+        {
+            if (stream->bufferOffset < stream->bufferSize) TRACELOG(LOG_WARNING, "AUTOMATION: Events file is truncated");
+            break;
+        }
+        else
+        {
+            // Discard decoded events data and read next file data chunk
+            stream->bufferSize -= stream->bufferOffset;
+            if (stream->bufferSize > 0) memmove(stream->buffer, stream->buffer + stream->bufferOffset, stream->bufferSize);
+            stream->bufferOffset = 0;
+
+            unsigned char chunk[4096] = { 0 };
+            int chunkSize = (int)fread(chunk, 1, sizeof(chunk), stream->file);
+
+            if (stream->compression != NULL)
+            {
+                if ((chunkSize > 0) && !rl_UpdateCompressionStream(stream->compression, chunk, chunkSize)) stream->failed = true;
+            }
+            else if (chunkSize > 0) ReadAutomationEventStreamData(chunk, chunkSize, stream);
+
+            if (chunkSize < (int)sizeof(chunk))
+            {
+                stream->end = true;
+
+                if (stream->compression != NULL)
+                {
+                    if (!rl_CloseCompressionStream(stream->compression)) stream->failed = true;
+                    stream->compression = NULL;
+                }
+            }
+        }
+    }
+#endif
+
+    return success;
+}
+
+// Unload automation events stream
+void rl_UnloadAutomationEventStream(rl_AutomationEventStream *stream)
+{
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    if (stream == NULL) return;
+
+    if (stream->compression != NULL) rl_CloseCompressionStream(stream->compression);
+    fclose(stream->file);
+    RL_FREE(stream->buffer);
+    RL_FREE(stream);
+#endif
+}
+
 // Export automation events list as text file
 bool rl_ExportAutomationEventList(rl_AutomationEventList list, const char *fileName)
 {
@@ -3296,11 +4875,73 @@ void rl_StartAutomationEventRecording(void)
 }
 
 // Stop recording automation events
+// NOTE: Recording to file is finished, pending events are written and file is closed
 void rl_StopAutomationEventRecording(void)
 {
 #if defined(SUPPORT_AUTOMATION_EVENTS)
     automationEventRecording = false;
+
+    if (automationEventStream != NULL)
+    {
+        rl_AutomationEventStream *stream = automationEventStream;
+
+        FlushAutomationEventStream(stream);
+        if ((stream->compression != NULL) && !rl_CloseCompressionStream(stream->compression)) stream->failed = true;
+        fclose(stream->file);
+
+        if (stream->failed) TRACELOG(LOG_WARNING, "AUTOMATION: Failed to write events file");
+        else TRACELOG(LOG_INFO, "AUTOMATION: Events file recording finished successfully");
+
+        currentEventList = stream->previousList;
+        RL_FREE(stream->list.events);
+        RL_FREE(stream->buffer);
+        RL_FREE(stream);
+        automationEventStream = NULL;
+    }
+#endif
+}
+
+// Start recording automation events streamed to binary file
+// NOTE: Events are written every frame, no events list is required (events list set is not used while recording)
+bool rl_StartAutomationEventRecordingToFile(const char *fileName, bool compress)
+{
+    bool success = false;
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    if (automationEventRecording) rl_StopAutomationEventRecording();
+
+    FILE *file = fopen(fileName, "wb");
+
+    if (file == NULL)
+    {
+        TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Failed to open events file for recording", fileName);
+        return false;
+    }
+
+    rl_AutomationEventStream *stream = (rl_AutomationEventStream *)RL_CALLOC(1, sizeof(rl_AutomationEventStream));
+    stream->file = file;
+
+#if !defined(SUPPORT_COMPRESSION_API)
+    if (compress) TRACELOG(LOG_WARNING, "AUTOMATION: Compression not supported, events file is not compressed");
+    compress = false;
+#endif
+
+    unsigned char header[AUTOMATION_BINARY_HEADER_SIZE] = { 'r', 'A', 'E', 'B', AUTOMATION_BINARY_VERSION, compress? AUTOMATION_BINARY_COMPRESSED : 0, 0, 0 };
+    if (fwrite(header, 1, AUTOMATION_BINARY_HEADER_SIZE, file) != AUTOMATION_BINARY_HEADER_SIZE) stream->failed = true;
+
+    // NOTE: LZ4 codec used for streamed recording, minimal compression cost per frame
+    if (compress) stream->compression = rl_InitCompressionStream(COMPRESSION_LZ4, false, WriteAutomationEventStreamData, stream);
+
+    stream->previousList = currentEventList;
+    currentEventList = &stream->list;
+    automationEventStream = stream;
+    automationEventRecording = true;
+
+    success = !stream->failed;
+    if (success) TRACELOG(LOG_INFO, "AUTOMATION: [%s] Events file recording started", fileName);
 #endif
+
+    return success;
 }
 
 // Play a recorded automation event
@@ -3495,16 +5136,54 @@ int rl_GetCharPressed(void)
     return value;
 }
 
-// Set a custom key to exit program
-// NOTE: default exitKey is set to ESCAPE
-void rl_SetExitKey(int key)
+// Get next input event from queue, returns false when the queue is empty
+// NOTE: Events are timestamped by platform callbacks on arrival (rl_GetTime()),
+// same events stream is available independently of frame rate, call it multiple times per frame
+bool rl_GetInputEvent(rl_InputEvent *event)
 {
-    CORE.Input.Keyboard.exitKey = key;
-}
+    bool result = false;
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition: Input Handling: Gamepad
-//----------------------------------------------------------------------------------
+#if defined(SUPPORT_INPUT_EVENTS)
+    unsigned int position = CORE.Input.Events.head;
+    unsigned int sequence = ATOMIC_LOAD(&CORE.Input.Events.slots[position & (MAX_INPUT_EVENTS_QUEUE - 1)].sequence);
+
+    // Slot is ready to read when producer published it (sequence == position + 1)
+    if ((int)(sequence - (position + 1)) >= 0)
+    {
+        if (event != NULL) *event = CORE.Input.Events.slots[position & (MAX_INPUT_EVENTS_QUEUE - 1)].event;
+
+        // Release slot for producers, one lap ahead
+        ATOMIC_STORE(&CORE.Input.Events.slots[position & (MAX_INPUT_EVENTS_QUEUE - 1)].sequence, position + MAX_INPUT_EVENTS_QUEUE);
+        CORE.Input.Events.head = position + 1;
+        result = true;
+    }
+#endif
+
+    return result;
+}
+
+// Get number of input events dropped because queue was full
+unsigned int rl_GetInputEventsDropped(void)
+{
+    unsigned int dropped = 0;
+
+#if defined(SUPPORT_INPUT_EVENTS)
+    dropped = ATOMIC_LOAD(&CORE.Input.Events.dropped);
+#endif
+
+    return dropped;
+}
+
+// Set a custom key to exit program
+// NOTE: default exitKey is set to ESCAPE
+void rl_SetExitKey(int key)
+{
+    CORE.Input.Keyboard.exitKey = key;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Input Handling: Gamepad
+//----------------------------------------------------------------------------------
 
 // NOTE: Functions with a platform-specific implementation on rcore_<platform>.c
 //int rl_SetGamepadMappings(const char *mappings)
@@ -3780,317 +5459,2123 @@ int rl_GetTouchPointCount(void)
 //int InitPlatform(void)
 //void ClosePlatform(void)
 
-// Initialize hi-resolution timer
-void InitTimer(void)
+#if defined(SUPPORT_RENDER_THREAD)
+// Render thread main loop, replays queued frames and swaps buffers
+// NOTE: Queued frames are always rendered before quitting
+static void *RenderThreadLoop(void *arg)
 {
-    // Setting a higher resolution can improve the accuracy of time-out intervals in wait functions
-    // However, it can also reduce overall system performance, because the thread scheduler switches tasks more often
-    // High resolutions can also prevent the CPU power management system from entering power-saving modes
-    // Setting a higher resolution does not improve the accuracy of the high-resolution performance counter
-#if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP) && !defined(PLATFORM_DESKTOP_SDL)
-    timeBeginPeriod(1); // Setup high-resolution timer to 1ms (granularity of 1-2 ms)
-#endif
-
-#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
-    struct timespec now = { 0 };
+    SetGraphicsContextCurrent(true);
 
-    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0) // Success
+    while (true)
     {
-        CORE.Time.base = (unsigned long long int)now.tv_sec*1000000000LLU + (unsigned long long int)now.tv_nsec;
+        pthread_mutex_lock(&renderThread.mutex);
+        while ((renderThread.count == 0) && !renderThread.quit) pthread_cond_wait(&renderThread.cond, &renderThread.mutex);
+        if (renderThread.count == 0)
+        {
+            pthread_mutex_unlock(&renderThread.mutex);
+            break;
+        }
+        rlCommandBuffer *frame = &renderThread.frames[renderThread.head];
+        bool skipSwap = renderThread.skipSwap[renderThread.head];
+        pthread_mutex_unlock(&renderThread.mutex);
+
+        rlResetRenderStats();           // Reset render statistics for current frame
+    #if defined(RLGL_ENABLE_GPU_PROFILER)
+        rlProfilerBeginFrame();
+    #endif
+        rlReplayCommandBuffer(frame);   // Replay frame recorded on main thread
+        rlExecuteCommandBuffers();      // Replay command buffers submitted for current frame
+        rlDrawRenderBatchActive();      // Update and draw internal render batch
+    #if defined(RLGL_ENABLE_GPU_PROFILER)
+        rlProfilerEndFrame();
+    #endif
+        rlUpdateReadbacks(false);       // Deliver completed async screen readbacks (previous frames)
+        if (!skipSwap)
+        {
+            PROFILE_ZONE_BEGIN("rl_SwapScreenBuffer");
+            rl_SwapScreenBuffer();      // Copy back buffer to front buffer (screen)
+            PROFILE_ZONE_END();
+        }
+
+        // Release frame slot
+        pthread_mutex_lock(&renderThread.mutex);
+        renderThread.head = (renderThread.head + 1)%renderThread.depth;
+        renderThread.count--;
+        pthread_cond_broadcast(&renderThread.cond);
+        pthread_mutex_unlock(&renderThread.mutex);
     }
-    else TRACELOG(LOG_WARNING, "TIMER: Hi-resolution timer not available");
-#endif
 
-    CORE.Time.previous = rl_GetTime(); // Get time as double
+    SetGraphicsContextCurrent(false);
+
+    return NULL;
 }
+#endif
 
-// Set viewport for a provided width and height
-void SetupViewport(int width, int height)
-{
-    CORE.Window.render.width = width;
-    CORE.Window.render.height = height;
+// Set shader default locations, located by default names
+static void SetShaderDefaultLocations(rl_Shader *shader)
+{
+    // After custom shader loading, we TRY to set default location names
+    // Default shader attribute locations have been binded before linking:
+    //  - vertex position location    = 0
+    //  - vertex texcoord location    = 1
+    //  - vertex normal location      = 2
+    //  - vertex color location       = 3
+    //  - vertex tangent location     = 4
+    //  - vertex texcoord2 location   = 5
+    //  - vertex boneIds location     = 6
+    //  - vertex boneWeights location = 7
+
+    // NOTE: If any location is not found, loc point becomes -1
+
+    // Get handles to GLSL input attribute locations
+    shader->locs[SHADER_LOC_VERTEX_POSITION] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+    shader->locs[SHADER_LOC_VERTEX_TEXCOORD01] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+    shader->locs[SHADER_LOC_VERTEX_TEXCOORD02] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    shader->locs[SHADER_LOC_VERTEX_NORMAL] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_NORMAL);
+    shader->locs[SHADER_LOC_VERTEX_TANGENT] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
+    shader->locs[SHADER_LOC_VERTEX_COLOR] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    shader->locs[SHADER_LOC_VERTEX_BONEIDS] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
+    shader->locs[SHADER_LOC_VERTEX_BONEWEIGHTS] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
+    shader->locs[SHADER_LOC_VERTEX_INSTANCE_TX] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX);
+    shader->locs[SHADER_LOC_VERTEX_INSTANCE_PALETTE] = rlGetLocationAttrib(shader->id, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_PALETTE);
+
+    // Get handles to GLSL uniform locations (vertex shader)
+    shader->locs[SHADER_LOC_MATRIX_MVP] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
+    shader->locs[SHADER_LOC_MATRIX_VIEW] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW);
+    shader->locs[SHADER_LOC_MATRIX_PROJECTION] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION);
+    shader->locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
+    shader->locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
+    shader->locs[SHADER_LOC_BONE_MATRICES] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES);
+    shader->locs[SHADER_LOC_BONE_PALETTE] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_PALETTE);
+    shader->locs[SHADER_LOC_BONE_DUALQUATS] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_DUALQUATS);
+
+    // Get handles to GLSL uniform locations (fragment shader)
+    shader->locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
+    shader->locs[rl_SHADER_LOC_MAP_DIFFUSE] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);  // SHADER_LOC_MAP_ALBEDO
+    shader->locs[rl_SHADER_LOC_MAP_SPECULAR] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1); // SHADER_LOC_MAP_METALNESS
+    shader->locs[SHADER_LOC_MAP_NORMAL] = rlGetLocationUniform(shader->id, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2);
+}
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+// Register shader loaded from files, shader is reloaded in place when any of its files changes
+static void RegisterShaderFiles(rl_Shader shader, const char *vsFileName, const char *fsFileName)
+{
+    if (assetsWatcher.shaderCount >= assetsWatcher.shaderCapacity)
+    {
+        int capacity = (assetsWatcher.shaderCapacity > 0)? assetsWatcher.shaderCapacity*2 : 16;
+        ShaderFilesEntry *shaders = (ShaderFilesEntry *)RL_REALLOC(assetsWatcher.shaders, capacity*sizeof(ShaderFilesEntry));
+        if (shaders == NULL) return;
 
-    // Set viewport width and height
-    rlViewport(CORE.Window.renderOffset.x/2, CORE.Window.renderOffset.y/2, CORE.Window.render.width, CORE.Window.render.height);
+        assetsWatcher.shaders = shaders;
+        assetsWatcher.shaderCapacity = capacity;
+    }
 
-    rlMatrixMode(RL_PROJECTION);        // Switch to projection matrix
-    rlLoadIdentity();                   // Reset current matrix (projection)
+    ShaderFilesEntry *entry = &assetsWatcher.shaders[assetsWatcher.shaderCount];
+    entry->id = shader.id;
+    entry->locs = shader.locs;
+    entry->vsFileName = NULL;
+    entry->fsFileName = NULL;
 
-    // Set orthographic projection to current framebuffer size
-    // NOTE: Configured top-left corner as (0, 0)
-    rlOrtho(0, CORE.Window.render.width, CORE.Window.render.height, 0, 0.0f, 1.0f);
+    if (vsFileName != NULL)
+    {
+        int length = (int)strlen(vsFileName);
+        entry->vsFileName = (char *)RL_MALLOC(length + 1);
+        memcpy(entry->vsFileName, vsFileName, length + 1);
+        WatchAssetFile(vsFileName);
+    }
 
-    rlMatrixMode(RL_MODELVIEW);         // Switch back to modelview matrix
-    rlLoadIdentity();                   // Reset current matrix (modelview)
+    if (fsFileName != NULL)
+    {
+        int length = (int)strlen(fsFileName);
+        entry->fsFileName = (char *)RL_MALLOC(length + 1);
+        memcpy(entry->fsFileName, fsFileName, length + 1);
+        WatchAssetFile(fsFileName);
+    }
+
+    assetsWatcher.shaderCount++;
 }
 
-// Scan all files and directories in a base path
-// WARNING: files.paths[] must be previously allocated and
-// contain enough space to store all required paths
-static void ScanDirectoryFiles(const char *basePath, rl_FilePathList *files, const char *filter)
+// Unregister shader loaded from files, its files are still watched
+static void UnregisterShaderFiles(unsigned int id)
 {
-    static char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
+    for (int i = 0; i < assetsWatcher.shaderCount; i++)
+    {
+        if (assetsWatcher.shaders[i].id != id) continue;
 
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+        RL_FREE(assetsWatcher.shaders[i].vsFileName);
+        RL_FREE(assetsWatcher.shaders[i].fsFileName);
 
-    if (dir != NULL)
+        assetsWatcher.shaders[i] = assetsWatcher.shaders[assetsWatcher.shaderCount - 1];
+        assetsWatcher.shaderCount--;
+        break;
+    }
+}
+
+// Reload changed asset file: shaders using it and shared texture loaded from it
+static void ReloadAssetFile(const char *fileName)
+{
+    bool reloaded = false;
+
+    for (int i = 0; i < assetsWatcher.shaderCount; i++)
     {
-        while ((dp = readdir(dir)) != NULL)
+        ShaderFilesEntry *entry = &assetsWatcher.shaders[i];
+
+        if (((entry->vsFileName == NULL) || (strcmp(entry->vsFileName, fileName) != 0)) &&
+            ((entry->fsFileName == NULL) || (strcmp(entry->fsFileName, fileName) != 0))) continue;
+
+        char *vShaderStr = (entry->vsFileName != NULL)? rl_LoadFileText(entry->vsFileName) : NULL;
+        char *fShaderStr = (entry->fsFileName != NULL)? rl_LoadFileText(entry->fsFileName) : NULL;
+
+        // NOTE: Missing code would fall back to default shader code, shader is kept until files are valid
+        if (((entry->vsFileName == NULL) || (vShaderStr != NULL)) &&
+            ((entry->fsFileName == NULL) || (fShaderStr != NULL)) &&
+            rlReloadShaderProgram(entry->id, vShaderStr, fShaderStr))
         {
-            if ((strcmp(dp->d_name, ".") != 0) &&
-                (strcmp(dp->d_name, "..") != 0))
-            {
-                // Construct new path from our base path
-            #if defined(_WIN32)
-                int pathLength = snprintf(path, MAX_FILEPATH_LENGTH - 1, "%s\\%s", basePath, dp->d_name);
-            #else
-                int pathLength = snprintf(path, MAX_FILEPATH_LENGTH - 1, "%s/%s", basePath, dp->d_name);
-            #endif
-
-                if ((pathLength < 0) || (pathLength >= MAX_FILEPATH_LENGTH))
-                {
-                    TRACELOG(LOG_WARNING, "FILEIO: Path longer than %d characters (%s...)", MAX_FILEPATH_LENGTH, basePath);
-                }
-                else if (filter != NULL)
-                {
-                    if (rl_IsPathFile(path))
-                    {
-                        if (rl_IsFileExtension(path, filter))
-                        {
-                            strncpy(files->paths[files->count], path, MAX_FILEPATH_LENGTH - 1);
-                            files->count++;
-                        }
-                    }
-                    else
-                    {
-                        if (strstr(filter, DIRECTORY_FILTER_TAG) != NULL)
-                        {
-                            strncpy(files->paths[files->count], path, MAX_FILEPATH_LENGTH - 1);
-                            files->count++;
-                        }
-                    }
-                }
-                else
-                {
-                    strncpy(files->paths[files->count], path, MAX_FILEPATH_LENGTH - 1);
-                    files->count++;
-                }
-            }
+            // Locations array is shared with user shader copies, default locations are located again
+            rl_Shader shader = { entry->id, entry->locs };
+            for (int k = 0; k < RL_MAX_SHADER_LOCATIONS; k++) shader.locs[k] = -1;
+            SetShaderDefaultLocations(&shader);
+
+            reloaded = true;
         }
 
-        closedir(dir);
+        rl_UnloadFileText(vShaderStr);
+        rl_UnloadFileText(fShaderStr);
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+
+#if defined(SUPPORT_MODULE_RTEXTURES) && defined(SUPPORT_SHARED_TEXTURES)
+    if (ReloadSharedTextureFile(fileName)) reloaded = true;
+#endif
+
+    if (reloaded && (assetsWatcher.callback != NULL)) assetsWatcher.callback(fileName);
 }
 
-// Scan all files and directories recursively from a base path
-static void ScanDirectoryFilesRecursively(const char *basePath, rl_FilePathList *files, const char *filter)
+// Update assets watcher, changed watched files are reloaded
+// NOTE: File system events are read if available, otherwise a limited number of files is polled per frame
+static void UpdateAssetsWatcher(void)
 {
-    // WARNING: Path can not be static or it will be reused between recursive function calls!
-    char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
-
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+    if (assetsWatcher.fileCount == 0) return;
 
-    if (dir != NULL)
+#if defined(__linux__)
+    if (assetsWatcher.fd >= 0)
     {
-        while (((dp = readdir(dir)) != NULL) && (files->count < files->capacity))
+        union {
+            struct inotify_event event;     // Required for events alignment
+            char data[4096];                // Events data
+        } buffer;
+
+        ssize_t length = 0;
+
+        while ((length = read(assetsWatcher.fd, buffer.data, sizeof(buffer.data))) > 0)
         {
-            if ((strcmp(dp->d_name, ".") != 0) && (strcmp(dp->d_name, "..") != 0))
+            for (char *ptr = buffer.data; ptr < (buffer.data + length); )
             {
-                // Construct new path from our base path
-            #if defined(_WIN32)
-                int pathLength = snprintf(path, MAX_FILEPATH_LENGTH - 1, "%s\\%s", basePath, dp->d_name);
-            #else
-                int pathLength = snprintf(path, MAX_FILEPATH_LENGTH - 1, "%s/%s", basePath, dp->d_name);
-            #endif
-
-                if ((pathLength < 0) || (pathLength >= MAX_FILEPATH_LENGTH))
-                {
-                    TRACELOG(LOG_WARNING, "FILEIO: Path longer than %d characters (%s...)", MAX_FILEPATH_LENGTH, basePath);
-                }
-                else if (rl_IsPathFile(path))
-                {
-                    if (filter != NULL)
-                    {
-                        if (rl_IsFileExtension(path, filter))
-                        {
-                            strncpy(files->paths[files->count], path, MAX_FILEPATH_LENGTH - 1);
-                            files->count++;
-                        }
-                    }
-                    else
-                    {
-                        strncpy(files->paths[files->count], path, MAX_FILEPATH_LENGTH - 1);
-                        files->count++;
-                    }
+                const struct inotify_event *event = (const struct inotify_event *)ptr;
 
-                    if (files->count >= files->capacity)
-                    {
-                        TRACELOG(LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
-                        break;
-                    }
-                }
-                else
+                for (int i = 0; (event->len > 0) && (i < assetsWatcher.fileCount); i++)
                 {
-                    if ((filter != NULL) && (strstr(filter, DIRECTORY_FILTER_TAG) != NULL))
-                    {
-                        strncpy(files->paths[files->count], path, MAX_FILEPATH_LENGTH - 1);
-                        files->count++;
-                    }
-
-                    if (files->count >= files->capacity)
-                    {
-                        TRACELOG(LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
-                        break;
-                    }
+                    WatchedAssetFile *file = &assetsWatcher.files[i];
 
-                    ScanDirectoryFilesRecursively(path, files, filter);
+                    if ((file->directory >= 0) && (assetsWatcher.directories[file->directory].wd == event->wd) &&
+                        (strcmp(rl_GetFileName(file->fileName), event->name) == 0)) file->changed = true;
                 }
+
+                ptr += sizeof(struct inotify_event) + event->len;
             }
         }
-
-        closedir(dir);
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
-}
+#endif
 
-#if defined(SUPPORT_AUTOMATION_EVENTS)
-// Automation event recording
-// Checking events in current frame and save them into currentEventList
-// NOTE: Recording is by default done at rl_EndDrawing(), before rl_PollInputEvents()
-static void RecordAutomationEvent(void)
-{
-    if (currentEventList->count == currentEventList->capacity) return;
+    // Files without file system events are polled, checking a limited number of files per frame
+    int visited = 0;
 
-    // Keyboard input events recording
-    //-------------------------------------------------------------------------------------
-    for (int key = 0; key < MAX_KEYBOARD_KEYS; key++)
+    for (int polled = 0; (visited < assetsWatcher.fileCount) && (polled < ASSETS_HOT_RELOAD_POLL_FILES); visited++)
     {
-        // Event type: INPUT_KEY_UP (only saved once)
-        if (CORE.Input.Keyboard.previousKeyState[key] && !CORE.Input.Keyboard.currentKeyState[key])
-        {
-            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-            currentEventList->events[currentEventList->count].type = INPUT_KEY_UP;
-            currentEventList->events[currentEventList->count].params[0] = key;
-            currentEventList->events[currentEventList->count].params[1] = 0;
-            currentEventList->events[currentEventList->count].params[2] = 0;
+        WatchedAssetFile *file = &assetsWatcher.files[(assetsWatcher.nextPollFile + visited)%assetsWatcher.fileCount];
+        if (file->directory >= 0) continue;
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_KEY_UP | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-            currentEventList->count++;
-        }
+        long modTime = rl_GetFileModTime(file->fileName);
+        if ((modTime != 0) && (modTime != file->modTime)) file->changed = true;
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        polled++;
+    }
 
-        // Event type: INPUT_KEY_DOWN
-        if (CORE.Input.Keyboard.currentKeyState[key])
-        {
-            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-            currentEventList->events[currentEventList->count].type = INPUT_KEY_DOWN;
-            currentEventList->events[currentEventList->count].params[0] = key;
-            currentEventList->events[currentEventList->count].params[1] = 0;
-            currentEventList->events[currentEventList->count].params[2] = 0;
+    assetsWatcher.nextPollFile = (assetsWatcher.nextPollFile + visited)%assetsWatcher.fileCount;
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_KEY_DOWN | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-            currentEventList->count++;
-        }
+    for (int i = 0; i < assetsWatcher.fileCount; i++)
+    {
+        WatchedAssetFile *file = &assetsWatcher.files[i];
+        if (!file->changed) continue;
+
+        file->changed = false;
+        file->modTime = rl_GetFileModTime(file->fileName);
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        TRACELOG(LOG_INFO, "FILEIO: [%s] Watched file changed, reloading", file->fileName);
+        ReloadAssetFile(file->fileName);
     }
-    //-------------------------------------------------------------------------------------
+}
 
-    // Mouse input currentEventList->events recording
-    //-------------------------------------------------------------------------------------
-    for (int button = 0; button < MAX_MOUSE_BUTTONS; button++)
+// Close assets watcher, watched files and shaders registry are released
+static void CloseAssetsWatcher(void)
+{
+    for (int i = 0; i < assetsWatcher.shaderCount; i++)
     {
-        // Event type: INPUT_MOUSE_BUTTON_UP
-        if (CORE.Input.Mouse.previousButtonState[button] && !CORE.Input.Mouse.currentButtonState[button])
-        {
-            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-            currentEventList->events[currentEventList->count].type = INPUT_MOUSE_BUTTON_UP;
-            currentEventList->events[currentEventList->count].params[0] = button;
-            currentEventList->events[currentEventList->count].params[1] = 0;
-            currentEventList->events[currentEventList->count].params[2] = 0;
+        RL_FREE(assetsWatcher.shaders[i].vsFileName);
+        RL_FREE(assetsWatcher.shaders[i].fsFileName);
+    }
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_BUTTON_UP | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-            currentEventList->count++;
-        }
+    for (int i = 0; i < assetsWatcher.fileCount; i++) RL_FREE(assetsWatcher.files[i].fileName);
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+#if defined(__linux__)
+    for (int i = 0; i < assetsWatcher.directoryCount; i++) RL_FREE(assetsWatcher.directories[i].path);
+    RL_FREE(assetsWatcher.directories);
 
-        // Event type: INPUT_MOUSE_BUTTON_DOWN
-        if (CORE.Input.Mouse.currentButtonState[button])
-        {
-            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-            currentEventList->events[currentEventList->count].type = INPUT_MOUSE_BUTTON_DOWN;
-            currentEventList->events[currentEventList->count].params[0] = button;
-            currentEventList->events[currentEventList->count].params[1] = 0;
-            currentEventList->events[currentEventList->count].params[2] = 0;
+    if (assetsWatcher.fd >= 0) close(assetsWatcher.fd);
+#endif
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_BUTTON_DOWN | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-            currentEventList->count++;
-        }
+    RL_FREE(assetsWatcher.shaders);
+    RL_FREE(assetsWatcher.files);
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
-    }
+    AssetReloadedCallback callback = assetsWatcher.callback;
+    memset(&assetsWatcher, 0, sizeof(assetsWatcher));
+    assetsWatcher.callback = callback;
+}
+#endif
 
-    // Event type: INPUT_MOUSE_POSITION (only saved if changed)
-    if (((int)CORE.Input.Mouse.currentPosition.x != (int)CORE.Input.Mouse.previousPosition.x) ||
-        ((int)CORE.Input.Mouse.currentPosition.y != (int)CORE.Input.Mouse.previousPosition.y))
+
+#if defined(SUPPORT_MULTIPLE_WINDOWS)
+// Load secondary window render target (color + depth)
+static rl_RenderTexture2D LoadSecondaryWindowTarget(int width, int height)
+{
+    rl_RenderTexture2D target = { 0 };
+
+    target.id = rlLoadFramebuffer();
+
+    if (target.id > 0)
     {
-        currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-        currentEventList->events[currentEventList->count].type = INPUT_MOUSE_POSITION;
-        currentEventList->events[currentEventList->count].params[0] = (int)CORE.Input.Mouse.currentPosition.x;
-        currentEventList->events[currentEventList->count].params[1] = (int)CORE.Input.Mouse.currentPosition.y;
-        currentEventList->events[currentEventList->count].params[2] = 0;
+        rlEnableFramebuffer(target.id);
 
-        TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_POSITION | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-        currentEventList->count++;
+        target.texture.id = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        target.texture.width = width;
+        target.texture.height = height;
+        target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        target.texture.mipmaps = 1;
+        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+
+        target.depth.id = rlLoadTextureDepth(width, height, true);
+        target.depth.width = width;
+        target.depth.height = height;
+        target.depth.mipmaps = 1;
+        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if (!rlFramebufferComplete(target.id)) TRACELOG(LOG_WARNING, "WINDOW: Secondary window render target is not complete");
+
+        rlDisableFramebuffer();
     }
+    else TRACELOG(LOG_WARNING, "WINDOW: Secondary window render target can not be created");
 
-    // Event type: INPUT_MOUSE_WHEEL_MOTION
-    if (((int)CORE.Input.Mouse.currentWheelMove.x != (int)CORE.Input.Mouse.previousWheelMove.x) ||
-        ((int)CORE.Input.Mouse.currentWheelMove.y != (int)CORE.Input.Mouse.previousWheelMove.y))
+    return target;
+}
+
+// Unload secondary window render target
+// NOTE: Depth renderbuffer is queried and deleted with framebuffer
+static void UnloadSecondaryWindowTarget(rl_RenderTexture2D target)
+{
+    if (target.id > 0)
     {
-        currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-        currentEventList->events[currentEventList->count].type = INPUT_MOUSE_WHEEL_MOTION;
-        currentEventList->events[currentEventList->count].params[0] = (int)CORE.Input.Mouse.currentWheelMove.x;
-        currentEventList->events[currentEventList->count].params[1] = (int)CORE.Input.Mouse.currentWheelMove.y;
-        currentEventList->events[currentEventList->count].params[2] = 0;
+        if (target.texture.id > 0) rlUnloadTexture(target.texture.id);
+        rlUnloadFramebuffer(target.id);
+    }
+}
 
-        TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_WHEEL_MOTION | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-        currentEventList->count++;
+// Get secondary window data, NULL if not valid
+static SecondaryWindowData *GetSecondaryWindow(int window)
+{
+    if ((window < 1) || (window > MAX_SECONDARY_WINDOWS) || !secondaryWindows[window - 1].ready) return NULL;
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
-    }
-    //-------------------------------------------------------------------------------------
+    return &secondaryWindows[window - 1];
+}
+#endif
 
-    // Touch input currentEventList->events recording
-    //-------------------------------------------------------------------------------------
-    for (int id = 0; id < MAX_TOUCH_POINTS; id++)
+#if defined(SUPPORT_SHADER_CACHE)
+// Shader program binary cache file header
+typedef struct ShaderCacheHeader {
+    char id[4];                 // File identifier: "rSHB"
+    int version;                // Cache file version
+    int format;                 // Program binary format (driver specific)
+    int size;                   // Program binary size in bytes
+} ShaderCacheHeader;
+
+// Load shader code using program binary cache
+// NOTE: Cache entries are keyed by SHA256 of shaders code and driver info, on any mismatch
+// (missing file, driver update rejecting the binary) shader is compiled from source and cache entry is rewritten
+static unsigned int LoadShaderCodeCached(const char *vsCode, const char *fsCode)
+{
+    if (((vsCode == NULL) && (fsCode == NULL)) || !rlIsShaderProgramBinarySupported()) return rlLoadShaderCode(vsCode, fsCode);
+
+    // Compute cache key: shaders code + driver info (NULL shaders are marked to use default ones)
+    const char *driverInfo = rlGetDriverInfo();
+    int vsLength = (vsCode != NULL)? (int)strlen(vsCode) : 0;
+    int fsLength = (fsCode != NULL)? (int)strlen(fsCode) : 0;
+    int driverLength = (int)strlen(driverInfo);
+    int keySize = 2 + vsLength + fsLength + driverLength;
+
+    unsigned char *keyData = (unsigned char *)RL_MALLOC(keySize);
+    keyData[0] = (vsCode != NULL)? 1 : 0;
+    keyData[1] = (fsCode != NULL)? 1 : 0;
+    if (vsLength > 0) memcpy(keyData + 2, vsCode, vsLength);
+    if (fsLength > 0) memcpy(keyData + 2 + vsLength, fsCode, fsLength);
+    memcpy(keyData + 2 + vsLength + fsLength, driverInfo, driverLength);
+
+    unsigned int *hash = rl_ComputeSHA256(keyData, keySize);
+    RL_FREE(keyData);
+
+    char cacheDir[MAX_FILEPATH_LENGTH] = { 0 };
+    char cachePath[MAX_FILEPATH_LENGTH] = { 0 };
+    strncpy(cacheDir, rl_TextFormat("%s/%s", CORE.Storage.basePath, SHADER_CACHE_DIRECTORY), MAX_FILEPATH_LENGTH - 1);
+    strncpy(cachePath, rl_TextFormat("%s/%08x%08x%08x%08x%08x%08x%08x%08x.bin", cacheDir,
+        hash[0], hash[1], hash[2], hash[3], hash[4], hash[5], hash[6], hash[7]), MAX_FILEPATH_LENGTH - 1);
+
+    unsigned int id = 0;
+
+    // Try loading program binary from cache
+    if (rl_FileExists(cachePath))
     {
-        // Event type: INPUT_TOUCH_UP
-        if (CORE.Input.Touch.previousTouchState[id] && !CORE.Input.Touch.currentTouchState[id])
+        int dataSize = 0;
+        unsigned char *fileData = rl_LoadFileData(cachePath, &dataSize);
+
+        if (fileData != NULL)
         {
-            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
-            currentEventList->events[currentEventList->count].type = INPUT_TOUCH_UP;
-            currentEventList->events[currentEventList->count].params[0] = id;
-            currentEventList->events[currentEventList->count].params[1] = 0;
-            currentEventList->events[currentEventList->count].params[2] = 0;
+            ShaderCacheHeader *header = (ShaderCacheHeader *)fileData;
 
-            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_TOUCH_UP | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
-            currentEventList->count++;
+            if ((dataSize > (int)sizeof(ShaderCacheHeader)) && (memcmp(header->id, "rSHB", 4) == 0) &&
+                (header->version == 1) && (header->size == (dataSize - (int)sizeof(ShaderCacheHeader))))
+            {
+                id = rlLoadShaderProgramBinary(fileData + sizeof(ShaderCacheHeader), header->size, header->format);
+            }
+            else TRACELOG(LOG_WARNING, "SHADER: [%s] Shader cache file not valid", cachePath);
+
+            rl_UnloadFileData(fileData);
         }
+    }
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+    if (id > 0) return id;
 
-        // Event type: INPUT_TOUCH_DOWN
-        if (CORE.Input.Touch.currentTouchState[id])
+    // Compile shader from source and store program binary in cache
+    id = rlLoadShaderCode(vsCode, fsCode);
+
+    if ((id > 0) && (id != rlGetShaderIdDefault()))
+    {
+        int binarySize = 0;
+        int binaryFormat = 0;
+        unsigned char *binary = rlGetShaderProgramBinary(id, &binarySize, &binaryFormat);
+
+        if (binary != NULL)
+        {
+            if (!rl_DirectoryExists(cacheDir)) rl_MakeDirectory(cacheDir);
+
+            int fileSize = (int)sizeof(ShaderCacheHeader) + binarySize;
+            unsigned char *fileData = (unsigned char *)RL_MALLOC(fileSize);
+
+            ShaderCacheHeader header = { { 'r', 'S', 'H', 'B' }, 1, binaryFormat, binarySize };
+            memcpy(fileData, &header, sizeof(ShaderCacheHeader));
+            memcpy(fileData + sizeof(ShaderCacheHeader), binary, binarySize);
+
+            if (!rl_SaveFileData(cachePath, fileData, fileSize)) TRACELOG(LOG_WARNING, "SHADER: [%s] Failed to save shader cache file", cachePath);
+
+            RL_FREE(fileData);
+            RL_FREE(binary);
+        }
+    }
+
+    return id;
+}
+#endif
+
+#if defined(SUPPORT_MODULE_RTEXTURES)
+// Export screenshot on async readback completion
+// NOTE: Screenshot is encoded and saved on image export thread, use .qoi or .raw extensions for faster captures
+static void ScreenshotCallback(unsigned char *data, int width, int height, void *userData)
+{
+    char *path = (char *)userData;
+    rl_Image image = { data, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+
+    // WARNING: Module required: rtextures
+    if (rl_ExportImageAsync(image, path)) TRACELOG(LOG_INFO, "SYSTEM: [%s] Screenshot taken successfully", path);
+    else TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screenshot could not be saved", path);
+
+    RL_FREE(path);
+}
+#endif
+
+// Initialize hi-resolution timer
+void InitTimer(void)
+{
+    // Setting a higher resolution can improve the accuracy of time-out intervals in wait functions
+    // However, it can also reduce overall system performance, because the thread scheduler switches tasks more often
+    // High resolutions can also prevent the CPU power management system from entering power-saving modes
+    // Setting a higher resolution does not improve the accuracy of the high-resolution performance counter
+#if defined(_WIN32) && defined(SUPPORT_WINMM_HIGHRES_TIMER) && !defined(SUPPORT_BUSY_WAIT_LOOP) && !defined(PLATFORM_DESKTOP_SDL)
+    timeBeginPeriod(1); // Setup high-resolution timer to 1ms (granularity of 1-2 ms)
+#endif
+
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
+    struct timespec now = { 0 };
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0) // Success
+    {
+        CORE.Time.base = (unsigned long long int)now.tv_sec*1000000000LLU + (unsigned long long int)now.tv_nsec;
+    }
+    else TRACELOG(LOG_WARNING, "TIMER: Hi-resolution timer not available");
+#endif
+
+    CORE.Time.previous = rl_GetTime(); // Get time as double
+
+#if defined(SUPPORT_BUSY_WAIT_LOOP)
+    framePacing.mode = FRAME_PACING_BUSY;
+#endif
+    framePacing.overshoot = 0.001;  // Initial sleep overshoot estimate, measured on every sleep
+    framePacing.stats.histogramStep = FRAME_PACING_HISTOGRAM_STEP;
+}
+
+// Get system clock time in seconds, available before InitTimer()
+// NOTE: Only used for startup trace, platform timer is initialized by InitPlatform()
+static double GetStartupClock(void)
+{
+    struct timespec now = { 0 };
+#if defined(_WIN32)
+    timespec_get(&now, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+}
+
+// Sleep for some time, using high resolution timers when available
+static void SleepPrecise(double seconds)
+{
+    if (seconds <= 0.0) return;
+
+#if defined(_WIN32)
+    #if !defined(PLATFORM_DESKTOP_RGFW)
+    // High resolution waitable timer is not bound to system timer resolution (Windows 10 1803 or later)
+    if (!framePacing.timerChecked)
+    {
+        framePacing.timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        framePacing.timerChecked = true;
+
+        if (framePacing.timer == NULL) TRACELOG(LOG_DEBUG, "TIMER: High resolution waitable timer not available, using Sleep()");
+    }
+
+    if (framePacing.timer != NULL)
+    {
+        long long dueTime = -(long long)(seconds*10000000.0);   // Relative time, in 100 nanoseconds units
+
+        if (SetWaitableTimer(framePacing.timer, &dueTime, 0, NULL, NULL, 0))
+        {
+            WaitForSingleObject(framePacing.timer, 0xffffffff);
+            return;
+        }
+    }
+    #endif
+    Sleep((unsigned long)(seconds*1000.0));
+#endif
+#if defined(__linux__) || defined(__FreeBSD__)
+    // NOTE: Absolute monotonic deadline, sleep resumed on signals interruption without drift
+    struct timespec deadline = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    long long nsec = (long long)deadline.tv_nsec + (long long)(seconds*1000000000.0);
+    deadline.tv_sec += (time_t)(nsec/1000000000LL);
+    deadline.tv_nsec = (long)(nsec%1000000000LL);
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) continue;
+#endif
+#if defined(__OpenBSD__) || defined(__EMSCRIPTEN__)
+    struct timespec req = { 0 };
+    req.tv_sec = (time_t)seconds;
+    req.tv_nsec = (long)((seconds - (double)req.tv_sec)*1000000000.0);
+
+    while (nanosleep(&req, &req) == -1) continue;
+#endif
+#if defined(__APPLE__)
+    usleep(seconds*1000000.0);
+#endif
+}
+
+// Wait until some time, sleeping most of the time and busy waiting the measured sleep overshoot
+// NOTE: Overshoot estimate rises fast and decays slowly, late wake ups are worse than short busy waits
+static void WaitUntilTime(double time)
+{
+    double remaining = time - rl_GetTime();
+
+    if (remaining > framePacing.overshoot)
+    {
+        double request = remaining - framePacing.overshoot;
+        double start = rl_GetTime();
+
+        SleepPrecise(request);
+
+        double error = (rl_GetTime() - start) - request;
+        if (error < 0.0) error = 0.0;
+
+        framePacing.overshoot += (error - framePacing.overshoot)*((error > framePacing.overshoot)? 0.5 : 0.02);
+    }
+
+    double spinStart = rl_GetTime();
+    while (rl_GetTime() < time) { }
+
+    framePacing.spin += rl_GetTime() - spinStart;
+}
+
+// Wait for next frame deadline and register frame time stats
+// NOTE: Deadlines advance by target time, average frame rate is kept without drift,
+// they are resynced to frame start when target changes or a frame is late more than one frame
+static void WaitFramePacing(void)
+{
+    double target = CORE.Time.target;
+#if defined(SUPPORT_PERF_RUN)
+    if (perfRun.active) target = 0.0;   // Frames not paced on performance runs
+#endif
+    double frameStart = CORE.Time.current - CORE.Time.frame;
+
+    framePacing.spin = 0.0;
+
+    if (target > 0.0)
+    {
+        double deadline = framePacing.deadline + target;
+
+        if ((framePacing.deadline <= 0.0) || (framePacing.target != target) || (deadline < (CORE.Time.current - target))) deadline = frameStart + target;
+
+        framePacing.deadline = deadline;
+        framePacing.target = target;
+
+        if (CORE.Time.current > deadline) framePacing.stats.missedFrames++;
+
+        // Display vblank paces frames on buffers swap, software wait only required for lower frame rates,
+        // waiting half a refresh period less lets next swap match the expected vblank
+        if (framePacing.mode == FRAME_PACING_VSYNC)
+        {
+            if ((framePacing.refreshPeriod > 0.0) && (target < 1.5*framePacing.refreshPeriod)) deadline = 0.0;
+            else deadline -= 0.5*framePacing.refreshPeriod;
+        }
+
+        if (CORE.Time.current < deadline)
+        {
+            if (framePacing.mode == FRAME_PACING_BUSY)
+            {
+                while (rl_GetTime() < deadline) { }
+                framePacing.spin = rl_GetTime() - CORE.Time.current;
+            }
+            else WaitUntilTime(deadline);
+
+            CORE.Time.current = rl_GetTime();
+            double waitTime = CORE.Time.current - CORE.Time.previous;
+            CORE.Time.previous = CORE.Time.current;
+
+            CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
+        }
+    }
+    else framePacing.deadline = 0.0;
+
+    // Register frame time stats, measured between frame starts (in milliseconds)
+    // NOTE: Jitter is measured against target time, or frame time average if no target is set
+    rl_FramePacingStats *stats = &framePacing.stats;
+    float frameTime = (float)(CORE.Time.frame*1000.0);
+
+    stats->frameCount++;
+    stats->frameTime = frameTime;
+    framePacing.frameTimeSum += frameTime;
+    stats->frameTimeAverage = (float)(framePacing.frameTimeSum/stats->frameCount);
+    if ((stats->frameCount == 1) || (frameTime < stats->frameTimeMin)) stats->frameTimeMin = frameTime;
+    if (frameTime > stats->frameTimeMax) stats->frameTimeMax = frameTime;
+
+    float expected = (target > 0.0)? (float)(target*1000.0) : stats->frameTimeAverage;
+    framePacing.frameJitterSum += fabsf(frameTime - expected);
+    stats->frameJitter = (float)(framePacing.frameJitterSum/stats->frameCount);
+
+    stats->sleepOvershoot = (float)(framePacing.overshoot*1000.0);
+    stats->spinTime = (float)(framePacing.spin*1000.0);
+    stats->histogramStep = FRAME_PACING_HISTOGRAM_STEP;
+
+    int bin = (int)(frameTime/FRAME_PACING_HISTOGRAM_STEP);
+    if (bin >= FRAME_PACING_HISTOGRAM_BINS) bin = FRAME_PACING_HISTOGRAM_BINS - 1;
+    stats->histogram[bin]++;
+}
+
+#if defined(SUPPORT_PERF_RUN)
+// Initialize performance run, if requested by environment variables
+// NOTE: Random seed is fixed and input replayed from automation events file, same frames are drawn on every run
+static void InitPerfRun(void)
+{
+    const char *fileName = getenv("RAYLIB_PERF_RUN");
+    if ((fileName == NULL) || (fileName[0] == '\0')) return;
+
+    memset(&perfRun, 0, sizeof(PerfRunData));
+    snprintf(perfRun.fileName, MAX_FILEPATH_LENGTH, "%s", fileName);
+
+    const char *frames = getenv("RAYLIB_PERF_FRAMES");
+    perfRun.frameCount = (frames != NULL)? atoi(frames) : 0;
+    if (perfRun.frameCount <= 0) perfRun.frameCount = PERF_RUN_DEFAULT_FRAMES;
+
+    perfRun.frameTimes = (float *)RL_CALLOC(perfRun.frameCount, sizeof(float));
+    if (perfRun.frameTimes == NULL)
+    {
+        TRACELOG(LOG_WARNING, "PERF: Failed to allocate frame times for %i frames", perfRun.frameCount);
+        return;
+    }
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    const char *eventsFileName = getenv("RAYLIB_PERF_EVENTS");
+    if ((eventsFileName != NULL) && (eventsFileName[0] != '\0'))
+    {
+        if (rl_FileExists(eventsFileName))
+        {
+            perfRun.events = rl_LoadAutomationEventList(eventsFileName);
+            TRACELOG(LOG_INFO, "PERF: Replaying %i automation events from: %s", perfRun.events.count, eventsFileName);
+        }
+        else TRACELOG(LOG_WARNING, "PERF: [%s] Automation events file not found", eventsFileName);
+    }
+
+    // NOTE: Automation events are not played while recording, input is only recorded
+    const char *recordFileName = getenv("RAYLIB_PERF_RECORD");
+    if ((recordFileName != NULL) && (recordFileName[0] != '\0')) perfRun.recording = rl_StartAutomationEventRecordingToFile(recordFileName, true);
+#else
+    if (getenv("RAYLIB_PERF_EVENTS") != NULL) TRACELOG(LOG_WARNING, "PERF: Automation events not supported, input is not replayed");
+#endif
+
+    rl_SetRandomSeed(PERF_RUN_RANDOM_SEED);
+    perfRun.active = true;
+
+    TRACELOG(LOG_INFO, "PERF: Performance run started: %i frames (%i warmup), results: %s", perfRun.frameCount, PERF_RUN_WARMUP_FRAMES, perfRun.fileName);
+
+    PlayPerfRunEvents();        // First frame events
+}
+
+// Measure frame and replay next frame events, results exported on last frame
+// NOTE: Called at rl_EndDrawing() end, render and memory stats are reset by rl_BeginDrawing()
+static void UpdatePerfRun(void)
+{
+    perfRun.frame++;
+
+    if ((perfRun.frame > PERF_RUN_WARMUP_FRAMES) && (perfRun.measured < perfRun.frameCount))
+    {
+        rlRenderStats renderStats = rlGetRenderStats();
+
+        // NOTE: Frame time is update + draw time, frames are not paced on performance runs
+        perfRun.frameTimes[perfRun.measured] = (float)(CORE.Time.frame*1000.0);
+        perfRun.drawCalls += renderStats.drawCalls;
+        perfRun.vertices += renderStats.vertices;
+        perfRun.allocations += rl_GetMemoryStats(-1, -1).frameCount;
+        perfRun.measured++;
+
+        if (perfRun.measured == perfRun.frameCount)
+        {
+            perfRun.exported = ExportPerfRunResults();
+            CORE.Window.shouldClose = true;     // Program exits its main loop
+        }
+    }
+
+    PlayPerfRunEvents();        // Next frame events
+}
+
+// Play automation events up to current frame
+static void PlayPerfRunEvents(void)
+{
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    while ((perfRun.eventIndex < (int)perfRun.events.count) && (perfRun.events.events[perfRun.eventIndex].frame <= CORE.Time.frameCounter))
+    {
+        rl_PlayAutomationEvent(perfRun.events.events[perfRun.eventIndex]);
+        perfRun.eventIndex++;
+    }
+#endif
+}
+
+// Close performance run, results exported if not done yet
+static void ClosePerfRun(void)
+{
+    if (!perfRun.active) return;
+
+    if (!perfRun.exported)
+    {
+        TRACELOG(LOG_WARNING, "PERF: Program closed after %i of %i measured frames", perfRun.measured, perfRun.frameCount);
+        ExportPerfRunResults();
+    }
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+    if (perfRun.recording) rl_StopAutomationEventRecording();
+    rl_UnloadAutomationEventList(perfRun.events);
+#endif
+
+    RL_FREE(perfRun.frameTimes);
+    memset(&perfRun, 0, sizeof(PerfRunData));
+}
+
+// Export performance run results as JSON
+// NOTE: Frame times percentiles are nearest-rank, draw calls, vertices and allocations are per frame averages,
+// CPU memory peak requires SUPPORT_MEMORY_TRACKING
+static bool ExportPerfRunResults(void)
+{
+    int count = perfRun.measured;
+    double mean = 0.0;
+    float percentiles[4] = { 0 };       // p50, p90, p99, max
+
+    if (count > 0)
+    {
+        qsort(perfRun.frameTimes, count, sizeof(float), ComparePerfRunFrameTimes);
+
+        for (int i = 0; i < count; i++) mean += perfRun.frameTimes[i];
+        mean /= count;
+
+        const float ranks[4] = { 0.50f, 0.90f, 0.99f, 1.0f };
+        for (int i = 0; i < 4; i++)
+        {
+            int index = (int)ceilf(ranks[i]*count) - 1;
+            percentiles[i] = perfRun.frameTimes[(index < 0)? 0 : index];
+        }
+    }
+
+    double frames = (count > 0)? (double)count : 1.0;
+    char text[1024] = { 0 };
+
+    snprintf(text, sizeof(text),
+        "{\n"
+        "  \"raylib\": \"%s\",\n"
+        "  \"frames\": %i,\n"
+        "  \"frame_mean_ms\": %.4f,\n"
+        "  \"frame_p50_ms\": %.4f,\n"
+        "  \"frame_p90_ms\": %.4f,\n"
+        "  \"frame_p99_ms\": %.4f,\n"
+        "  \"frame_max_ms\": %.4f,\n"
+        "  \"draw_calls\": %.2f,\n"
+        "  \"vertices\": %.2f,\n"
+        "  \"allocations\": %.2f,\n"
+        "  \"cpu_peak_bytes\": %lld,\n"
+        "  \"gpu_peak_bytes\": %lld\n"
+        "}\n",
+        rl_RAYLIB_VERSION, count, mean, percentiles[0], percentiles[1], percentiles[2], percentiles[3],
+        perfRun.drawCalls/frames, perfRun.vertices/frames, perfRun.allocations/frames,
+        rl_GetMemoryStats(-1, -1).peakBytes, rlGetGpuMemoryStats(-1).peakBytes);
+
+    bool success = rl_SaveFileText(perfRun.fileName, text);
+
+    if (success) TRACELOG(LOG_INFO, "PERF: Results exported: %i frames, %.3f ms mean, %.3f ms p99", count, mean, percentiles[2]);
+
+    return success;
+}
+
+// Compare frame times, used to sort measured frames
+static int ComparePerfRunFrameTimes(const void *a, const void *b)
+{
+    float fa = *(const float *)a;
+    float fb = *(const float *)b;
+
+    return (fa > fb) - (fa < fb);
+}
+#endif
+
+// Set viewport for a provided width and height
+void SetupViewport(int width, int height)
+{
+    CORE.Window.render.width = width;
+    CORE.Window.render.height = height;
+
+    // Set viewport width and height
+    rlViewport(CORE.Window.renderOffset.x/2, CORE.Window.renderOffset.y/2, CORE.Window.render.width, CORE.Window.render.height);
+
+    rlMatrixMode(RL_PROJECTION);        // Switch to projection matrix
+    rlLoadIdentity();                   // Reset current matrix (projection)
+
+    // Set orthographic projection to current framebuffer size
+    // NOTE: Configured top-left corner as (0, 0)
+    rlOrtho(0, CORE.Window.render.width, CORE.Window.render.height, 0, 0.0f, 1.0f);
+
+    rlMatrixMode(RL_MODELVIEW);         // Switch back to modelview matrix
+    rlLoadIdentity();                   // Reset current matrix (modelview)
+}
+
+// Get directory entry type (0-other, 1-file, 2-directory), avoiding stat() when possible
+// NOTE: Entry type is provided by most file systems on directory read (d_type),
+// stat() is only required for unknown types and symbolic links (followed)
+static int GetDirectoryEntryType(const struct dirent *entry, const char *path)
+{
+    int type = 0;
+
+#if defined(DT_REG) && defined(DT_DIR)
+    if (entry->d_type == DT_REG) type = 1;
+    else if (entry->d_type == DT_DIR) type = 2;
+    else
+#endif
+    {
+        struct stat result = { 0 };
+
+        if (stat(path, &result) == 0)
+        {
+            if (S_ISREG(result.st_mode)) type = 1;
+            else if (S_ISDIR(result.st_mode)) type = 2;
+        }
+    }
+
+    return type;
+}
+
+// Check if scanned entry is included in results (filter)
+// NOTE: No filter includes all entries on single directory scan but only files on recursive scan,
+// directories are included with filter only if DIRECTORY_FILTER_TAG is requested
+static bool IsDirectoryEntryIncluded(const char *path, int type, const char *filter, bool scanSubdirs)
+{
+    bool included = false;
+
+    if (filter != NULL)
+    {
+        if (type == 1) included = rl_IsFileExtension(path, filter);
+        else included = (strstr(filter, DIRECTORY_FILTER_TAG) != NULL);
+    }
+    else included = !scanSubdirs || (type == 1);
+
+    return included;
+}
+
+// Scan directory paths, streamed to callback (recursively if requested)
+// NOTE: If subdirs list is provided, subdirectories are registered into it instead of scanned,
+// returns false if scanning was stopped by callback
+static bool ScanDirectory(const char *basePath, const char *filter, bool scanSubdirs, DirectoryFileCallback callback, void *userData, int *count, rl_FilePathList *subdirs)
+{
+    bool scanning = true;
+
+    // WARNING: Path can not be static or it will be reused between recursive function calls!
+    char path[MAX_FILEPATH_LENGTH] = { 0 };
+
+    int baseLength = (int)strlen(basePath);
+    if (baseLength >= (MAX_FILEPATH_LENGTH - 1))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: Path longer than %d characters (%s...)", MAX_FILEPATH_LENGTH, basePath);
+        return scanning;
+    }
+
+    // Base path is copied once, entry names are appended to it
+    memcpy(path, basePath, baseLength);
+#if defined(_WIN32)
+    path[baseLength] = '\\';
+#else
+    path[baseLength] = '/';
+#endif
+    baseLength++;
+
+    struct dirent *dp = NULL;
+    DIR *dir = opendir(basePath);
+
+    if (dir != NULL)
+    {
+        while (scanning && ((dp = readdir(dir)) != NULL))
+        {
+            // NOTE: We skip '.' (current dir) and '..' (parent dir) filepaths
+            if ((strcmp(dp->d_name, ".") == 0) || (strcmp(dp->d_name, "..") == 0)) continue;
+
+            int nameLength = (int)strlen(dp->d_name);
+            if ((baseLength + nameLength) >= MAX_FILEPATH_LENGTH)
+            {
+                TRACELOG(LOG_WARNING, "FILEIO: Path longer than %d characters (%s...)", MAX_FILEPATH_LENGTH, basePath);
+                continue;
+            }
+
+            memcpy(path + baseLength, dp->d_name, nameLength + 1);
+
+            int type = GetDirectoryEntryType(dp, path);
+
+            if (IsDirectoryEntryIncluded(path, type, filter, scanSubdirs))
+            {
+                scanning = callback(path, (type != 1), userData);
+                (*count)++;
+            }
+
+            if (scanning && scanSubdirs && (type == 2))
+            {
+                if (subdirs != NULL) scanning = AddFilePathListEntry(path, true, subdirs);
+                else scanning = ScanDirectory(path, filter, scanSubdirs, callback, userData, count, NULL);
+            }
+        }
+
+        closedir(dir);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+
+    return scanning;
+}
+
+// Add path to file path list, capacity grows as required
+// NOTE: Path string is allocated with exact size, new list entries are zeroed for rl_UnloadDirectoryFiles()
+static bool AddFilePathListEntry(const char *path, bool isDirectory, void *userData)
+{
+    rl_FilePathList *files = (rl_FilePathList *)userData;
+
+    if (files->count >= files->capacity)
+    {
+        unsigned int capacity = (files->capacity == 0)? 32 : files->capacity*2;
+        char **paths = (char **)RL_REALLOC(files->paths, capacity*sizeof(char *));
+
+        if (paths == NULL)
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: Failed to grow filepath scan capacity (%i files)", files->capacity);
+            return false;
+        }
+
+        memset(paths + files->capacity, 0, (capacity - files->capacity)*sizeof(char *));
+        files->paths = paths;
+        files->capacity = capacity;
+    }
+
+    int length = (int)strlen(path);
+    files->paths[files->count] = (char *)RL_MALLOC(length + 1);
+    if (files->paths[files->count] == NULL) return false;
+
+    memcpy(files->paths[files->count], path, length + 1);
+    files->count++;
+
+    return true;
+}
+
+#if defined(SUPPORT_DIRECTORY_SCAN_THREADS)
+// Directory scan shared state, subdirectories pending to be scanned are queued
+typedef struct DirectoryScanState {
+    pthread_mutex_t mutex;              // Mutex protecting shared state
+    pthread_cond_t cond;                // Condition signaled on queue changes and scan end
+    rl_FilePathList queue;              // Subdirectories pending to be scanned
+    int activeCount;                    // Number of threads currently scanning a directory
+    const char *filter;                 // Scan filter
+    rl_FilePathList *files;             // Scanned paths results
+} DirectoryScanState;
+
+// Move path entries between file path lists, source list count is reset
+static bool MoveFilePathListEntries(rl_FilePathList *dst, rl_FilePathList *src)
+{
+    if ((dst->count + src->count) > dst->capacity)
+    {
+        unsigned int capacity = (dst->capacity == 0)? 32 : dst->capacity;
+        while (capacity < (dst->count + src->count)) capacity *= 2;
+
+        char **paths = (char **)RL_REALLOC(dst->paths, capacity*sizeof(char *));
+        if (paths == NULL)
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: Failed to grow filepath scan capacity (%i files)", dst->capacity);
+            for (unsigned int i = 0; i < src->count; i++) RL_FREE(src->paths[i]);
+            src->count = 0;
+            return false;
+        }
+
+        memset(paths + dst->capacity, 0, (capacity - dst->capacity)*sizeof(char *));
+        dst->paths = paths;
+        dst->capacity = capacity;
+    }
+
+    memcpy(dst->paths + dst->count, src->paths, src->count*sizeof(char *));
+    memset(src->paths, 0, src->count*sizeof(char *));
+    dst->count += src->count;
+    src->count = 0;
+
+    return true;
+}
+
+// Directory scan thread loop, queued subdirectories are scanned until none is left
+// NOTE: Every directory is scanned into thread local lists, merged into shared state after scan
+static void *DirectoryScanThreadLoop(void *arg)
+{
+    DirectoryScanState *state = (DirectoryScanState *)arg;
+    rl_FilePathList files = { 0 };
+    rl_FilePathList subdirs = { 0 };
+
+    pthread_mutex_lock(&state->mutex);
+
+    while (true)
+    {
+        while ((state->queue.count == 0) && (state->activeCount > 0)) pthread_cond_wait(&state->cond, &state->mutex);
+
+        // No directories left and no thread scanning, scan is done
+        if (state->queue.count == 0) break;
+
+        state->queue.count--;
+        char *dirPath = state->queue.paths[state->queue.count];
+        state->queue.paths[state->queue.count] = NULL;
+        state->activeCount++;
+
+        pthread_mutex_unlock(&state->mutex);
+
+        int count = 0;
+        ScanDirectory(dirPath, state->filter, true, AddFilePathListEntry, &files, &count, &subdirs);
+        RL_FREE(dirPath);
+
+        pthread_mutex_lock(&state->mutex);
+
+        MoveFilePathListEntries(state->files, &files);
+        MoveFilePathListEntries(&state->queue, &subdirs);
+        state->activeCount--;
+
+        pthread_cond_broadcast(&state->cond);
+    }
+
+    pthread_mutex_unlock(&state->mutex);
+
+    RL_FREE(files.paths);
+    RL_FREE(subdirs.paths);
+
+    return NULL;
+}
+
+// Scan directory recursively, subdirectories scanned by several threads
+// NOTE: Caller thread also scans directories, results order depends on threads scheduling
+static void ScanDirectoryParallel(const char *basePath, const char *filter, rl_FilePathList *files)
+{
+    DirectoryScanState state = { 0 };
+    pthread_mutex_init(&state.mutex, NULL);
+    pthread_cond_init(&state.cond, NULL);
+    state.filter = filter;
+    state.files = files;
+
+    AddFilePathListEntry(basePath, true, &state.queue);
+
+    pthread_t threads[MAX_DIRECTORY_SCAN_THREADS] = { 0 };
+    int threadCount = 0;
+
+    for (int i = 0; i < (MAX_DIRECTORY_SCAN_THREADS - 1); i++)
+    {
+        if (pthread_create(&threads[threadCount], NULL, DirectoryScanThreadLoop, &state) == 0) threadCount++;
+    }
+
+    DirectoryScanThreadLoop(&state);
+
+    for (int i = 0; i < threadCount; i++) pthread_join(threads[i], NULL);
+
+    rl_UnloadDirectoryFiles(state.queue);
+    pthread_cond_destroy(&state.cond);
+    pthread_mutex_destroy(&state.mutex);
+}
+#endif
+
+#if defined(SUPPORT_COMPRESSION_API)
+// Get compressed block data maximum size, valid for all codecs
+static int GetCompressBlockBound(int dataSize)
+{
+    int deflateBound = sdefl_bound(dataSize);
+    int lz4Bound = dataSize + dataSize/255 + 16;
+
+    return (deflateBound > lz4Bound)? deflateBound : lz4Bound;
+}
+
+// Write compressed blocks stream header
+static void WriteCompressedStreamHeader(unsigned char *header, int codec, unsigned int blockSize)
+{
+    memcpy(header, "rCMP", 4);
+    header[4] = COMPRESSED_STREAM_VERSION;
+    header[5] = (unsigned char)codec;
+    header[6] = 0;
+    header[7] = 0;
+    WRITE_U32_LE(header + 8, blockSize);
+}
+
+// Read compressed blocks stream header, returns false if header is not valid
+static bool ReadCompressedStreamHeader(const unsigned char *header, int size, int *codec, unsigned int *blockSize)
+{
+    if ((size < COMPRESSED_STREAM_HEADER_SIZE) || (memcmp(header, "rCMP", 4) != 0) || (header[4] != COMPRESSED_STREAM_VERSION)) return false;
+
+    *codec = header[5];
+    *blockSize = READ_U32_LE(header + 8);
+
+    // NOTE: Block size is limited to MAX_DECOMPRESSION_SIZE, avoiding huge allocations on invalid data
+    return (((*codec == COMPRESSION_DEFLATE) || (*codec == COMPRESSION_LZ4)) &&
+            (*blockSize > 0) && (*blockSize <= (MAX_DECOMPRESSION_SIZE*1024*1024)));
+}
+
+// Compress block data with codec, returns compressed size
+// NOTE: Data is stored (copied) if not compressible, compData size must be GetCompressBlockBound()
+static int CompressBlock(int codec, const unsigned char *data, int dataSize, unsigned char *compData, struct sdefl *sdefl, bool *stored)
+{
+    #define COMPRESSION_QUALITY_DEFLATE  8
+
+    int compSize = 0;
+
+    if (codec == COMPRESSION_DEFLATE) compSize = sdeflate(sdefl, compData, data, dataSize, COMPRESSION_QUALITY_DEFLATE);
+    else compSize = CompressBlockLZ4(data, dataSize, compData);
+
+    *stored = (compSize <= 0) || (compSize >= dataSize);
+    if (*stored)
+    {
+        memcpy(compData, data, dataSize);
+        compSize = dataSize;
+    }
+
+    return compSize;
+}
+
+// Decompress block data with codec, returns false if data is corrupted
+static bool DecompressBlock(int codec, const unsigned char *compData, int compDataSize, bool stored, unsigned char *data, int dataSize)
+{
+    int size = 0;
+
+    if (stored)
+    {
+        if (compDataSize != dataSize) return false;
+
+        memcpy(data, compData, dataSize);
+        size = dataSize;
+    }
+    else if (codec == COMPRESSION_DEFLATE) size = sinflate(data, dataSize, compData, compDataSize);
+    else size = DecompressBlockLZ4(compData, compDataSize, data, dataSize);
+
+    return (size == dataSize);
+}
+
+// Compress block data with LZ4 block format, returns compressed size
+// NOTE: Greedy matching with a single entry hash table, matches limited to 64KB distance,
+// last 5 bytes are always literals and last match starts 12 bytes before block end (LZ4 specification)
+static int CompressBlockLZ4(const unsigned char *data, int dataSize, unsigned char *compData)
+{
+    #define LZ4_HASH_BITS       14
+    #define LZ4_MIN_MATCH        4
+    #define LZ4_MATCH_LIMIT     12
+    #define LZ4_LAST_LITERALS    5
+    #define LZ4_HASH(v) (((v)*2654435761u) >> (32 - LZ4_HASH_BITS))
+
+    unsigned char *op = compData;
+    int anchor = 0;
+
+    if (dataSize > LZ4_MATCH_LIMIT)
+    {
+        // NOTE: Positions are stored +1, 0 means no position registered
+        int *table = (int *)RL_CALLOC(1 << LZ4_HASH_BITS, sizeof(int));
+        int ip = 0;
+        int limit = dataSize - LZ4_MATCH_LIMIT;
+        int matchLimit = dataSize - LZ4_LAST_LITERALS;
+
+        while (ip < limit)
+        {
+            unsigned int sequence = 0;
+            memcpy(&sequence, data + ip, 4);
+
+            unsigned int hash = LZ4_HASH(sequence);
+            int ref = table[hash] - 1;
+            table[hash] = ip + 1;
+
+            unsigned int refSequence = 0;
+            if ((ref >= 0) && ((ip - ref) <= 0xffff)) memcpy(&refSequence, data + ref, 4);
+
+            if ((ref < 0) || ((ip - ref) > 0xffff) || (refSequence != sequence))
+            {
+                ip += 1 + ((ip - anchor) >> 6);     // Skip faster on incompressible data
+                continue;
+            }
+
+            int matchLength = LZ4_MIN_MATCH;
+            while (((ip + matchLength) < matchLimit) && (data[ref + matchLength] == data[ip + matchLength])) matchLength++;
+
+            // Sequence: token, literals length, literals, offset, match length
+            int literalLength = ip - anchor;
+            unsigned char *token = op++;
+            *token = (unsigned char)(((literalLength < 15)? literalLength : 15) << 4);
+
+            if (literalLength >= 15)
+            {
+                int length = literalLength - 15;
+                for (; length >= 255; length -= 255) *op++ = 255;
+                *op++ = (unsigned char)length;
+            }
+
+            memcpy(op, data + anchor, literalLength);
+            op += literalLength;
+
+            *op++ = (unsigned char)((ip - ref) & 0xff);
+            *op++ = (unsigned char)((ip - ref) >> 8);
+
+            int length = matchLength - LZ4_MIN_MATCH;
+            *token |= (unsigned char)((length < 15)? length : 15);
+            if (length >= 15)
+            {
+                for (length -= 15; length >= 255; length -= 255) *op++ = 255;
+                *op++ = (unsigned char)length;
+            }
+
+            ip += matchLength;
+            anchor = ip;
+        }
+
+        RL_FREE(table);
+    }
+
+    // Last literals
+    int literalLength = dataSize - anchor;
+    *op++ = (unsigned char)(((literalLength < 15)? literalLength : 15) << 4);
+    if (literalLength >= 15)
+    {
+        int length = literalLength - 15;
+        for (; length >= 255; length -= 255) *op++ = 255;
+        *op++ = (unsigned char)length;
+    }
+
+    memcpy(op, data + anchor, literalLength);
+    op += literalLength;
+
+    return (int)(op - compData);
+}
+
+// Decompress block data with LZ4 block format, returns decompressed size (-1 on corrupted data)
+static int DecompressBlockLZ4(const unsigned char *compData, int compDataSize, unsigned char *data, int dataSize)
+{
+    const unsigned char *ip = compData;
+    const unsigned char *ipEnd = compData + compDataSize;
+    unsigned char *op = data;
+    unsigned char *opEnd = data + dataSize;
+
+    while (ip < ipEnd)
+    {
+        unsigned int token = *ip++;
+
+        // Literals
+        size_t literalLength = token >> 4;
+        if (literalLength == 15)
+        {
+            unsigned int value = 255;
+            while ((value == 255) && (ip < ipEnd)) { value = *ip++; literalLength += value; }
+        }
+
+        if ((literalLength > (size_t)(ipEnd - ip)) || (literalLength > (size_t)(opEnd - op))) return -1;
+
+        memcpy(op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        if (ip == ipEnd) break;     // Last sequence has no match
+
+        // Match
+        if ((ipEnd - ip) < 2) return -1;
+
+        size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+
+        if ((offset == 0) || (offset > (size_t)(op - data))) return -1;
+
+        size_t matchLength = (token & 15) + LZ4_MIN_MATCH;
+        if ((token & 15) == 15)
+        {
+            unsigned int value = 255;
+            while ((value == 255) && (ip < ipEnd)) { value = *ip++; matchLength += value; }
+        }
+
+        if (matchLength > (size_t)(opEnd - op)) return -1;
+
+        const unsigned char *match = op - offset;
+        if (offset >= matchLength)
+        {
+            memcpy(op, match, matchLength);
+            op += matchLength;
+        }
+        else for (size_t i = 0; i < matchLength; i++) *op++ = *match++;     // Overlapped match (repeated data)
+    }
+
+    return (int)(op - data);
+}
+
+// Process compression work blocks until none is left
+// NOTE: Called by all workers, deflate compressor state is allocated per worker
+static void ProcessCompressionWork(CompressionWork *work)
+{
+    struct sdefl *sdefl = NULL;     // WARNING: struct sdefl is almost 1MB, allocated on heap
+
+    while (true)
+    {
+    #if defined(SUPPORT_COMPRESSION_THREADS)
+        pthread_mutex_lock(&work->mutex);
+    #endif
+        int index = work->nextBlock;
+        if (index < work->blockCount) work->nextBlock++;
+    #if defined(SUPPORT_COMPRESSION_THREADS)
+        pthread_mutex_unlock(&work->mutex);
+    #endif
+
+        if (index >= work->blockCount) break;
+
+        CompressionBlock *block = &work->blocks[index];
+
+        if (work->decompress) block->success = DecompressBlock(work->codec, block->input, block->inputSize, block->stored, block->output, block->outputSize);
+        else
+        {
+            if ((work->codec == COMPRESSION_DEFLATE) && (sdefl == NULL)) sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));
+
+            block->output = (unsigned char *)RL_MALLOC(GetCompressBlockBound(block->inputSize));
+            block->outputSize = CompressBlock(work->codec, block->input, block->inputSize, block->output, sdefl, &block->stored);
+            block->success = true;
+        }
+    }
+
+    RL_FREE(sdefl);
+}
+
+#if defined(SUPPORT_COMPRESSION_THREADS)
+// Compression thread loop, processing work blocks
+static void *CompressionThreadLoop(void *arg)
+{
+    ProcessCompressionWork((CompressionWork *)arg);
+
+    return NULL;
+}
+#endif
+
+// Run compression work, blocks are processed by up to threads workers (caller thread included)
+static void RunCompressionWork(CompressionWork *work, int threads)
+{
+#if defined(SUPPORT_COMPRESSION_THREADS)
+    if (threads > MAX_COMPRESSION_THREADS) threads = MAX_COMPRESSION_THREADS;
+    if (threads > work->blockCount) threads = work->blockCount;
+
+    pthread_t workers[MAX_COMPRESSION_THREADS] = { 0 };
+    int workerCount = 0;
+
+    pthread_mutex_init(&work->mutex, NULL);
+
+    for (int i = 1; i < threads; i++)
+    {
+        if (pthread_create(&workers[workerCount], NULL, CompressionThreadLoop, work) == 0) workerCount++;
+    }
+
+    ProcessCompressionWork(work);
+
+    for (int i = 0; i < workerCount; i++) pthread_join(workers[i], NULL);
+
+    pthread_mutex_destroy(&work->mutex);
+#else
+    (void)threads;
+    ProcessCompressionWork(work);
+#endif
+}
+
+// Write compression stream block, compressed block is sent to stream callback
+static bool WriteCompressionStreamBlock(rl_CompressionStream *stream, const unsigned char *data, int dataSize)
+{
+    bool stored = false;
+    int compSize = CompressBlock(stream->codec, data, dataSize, stream->output + COMPRESSED_BLOCK_HEADER_SIZE, stream->sdefl, &stored);
+
+    WRITE_U32_LE(stream->output, dataSize);
+    WRITE_U32_LE(stream->output + 4, (unsigned int)compSize | (stored? COMPRESSED_BLOCK_STORED : 0));
+
+    return stream->callback(stream->output, COMPRESSED_BLOCK_HEADER_SIZE + compSize, stream->userData);
+}
+
+// Read compression stream blocks available in data, decompressed blocks are sent to stream callback
+// NOTE: Returns data size processed, incomplete block data must be provided again with more data
+static int ReadCompressionStreamBlocks(rl_CompressionStream *stream, const unsigned char *data, int dataSize)
+{
+    int offset = 0;
+
+    if (!stream->header)
+    {
+        if (dataSize < COMPRESSED_STREAM_HEADER_SIZE) return 0;
+
+        if (!ReadCompressedStreamHeader(data, dataSize, &stream->codec, &stream->blockSize))
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Compression stream: Data is not a valid compressed stream");
+            stream->failed = true;
+            return dataSize;
+        }
+
+        stream->output = (unsigned char *)RL_MALLOC(stream->blockSize);
+        stream->header = true;
+        offset += COMPRESSED_STREAM_HEADER_SIZE;
+    }
+
+    while (!stream->failed && !stream->finished && ((dataSize - offset) >= COMPRESSED_BLOCK_HEADER_SIZE))
+    {
+        unsigned int rawSize = READ_U32_LE(data + offset);
+        unsigned int packedSize = READ_U32_LE(data + offset + 4);
+
+        if (rawSize == 0)
+        {
+            // Stream end, uncompressed data checksum is verified
+            if (packedSize != ~stream->crc)
+            {
+                TRACELOG(LOG_WARNING, "SYSTEM: Compression stream: Compressed stream data is corrupted");
+                stream->failed = true;
+            }
+
+            stream->finished = true;
+            offset += COMPRESSED_BLOCK_HEADER_SIZE;
+            break;
+        }
+
+        bool stored = ((packedSize & COMPRESSED_BLOCK_STORED) != 0);
+        packedSize &= ~COMPRESSED_BLOCK_STORED;
+
+        if ((rawSize > stream->blockSize) || (packedSize > (unsigned int)GetCompressBlockBound(stream->blockSize)))
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Compression stream: Compressed stream data is corrupted");
+            stream->failed = true;
+            break;
+        }
+
+        if ((unsigned int)(dataSize - offset - COMPRESSED_BLOCK_HEADER_SIZE) < packedSize) break;     // Block data not available yet
+
+        if (!DecompressBlock(stream->codec, data + offset + COMPRESSED_BLOCK_HEADER_SIZE, (int)packedSize, stored, stream->output, (int)rawSize))
+        {
+            TRACELOG(LOG_WARNING, "SYSTEM: Compression stream: Compressed stream data is corrupted");
+            stream->failed = true;
+            break;
+        }
+
+        stream->crc = UpdateCRC32(stream->crc, stream->output, (int)rawSize);
+        if (!stream->callback(stream->output, (int)rawSize, stream->userData)) stream->failed = true;
+
+        offset += COMPRESSED_BLOCK_HEADER_SIZE + (int)packedSize;
+    }
+
+    return offset;
+}
+#endif
+
+// Update CRC32 value with data (IEEE 802.3 polynomial, reflected)
+// NOTE: CRC value is not inverted, inversion is done on hash init and finish
+// Hardware acceleration: carry-less multiplication folding (PCLMULQDQ) or ARMv8 CRC32 instructions
+static unsigned int UpdateCRC32(unsigned int crc, const unsigned char *data, int dataSize)
+{
+    static const unsigned int crcTable[256] = {
+        0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
+        0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
+        0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+        0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
+        0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
+        0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+        0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
+        0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
+        0x76dc4190, 0x01db7106, 0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+        0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 0x91646c97, 0xe6635c01,
+        0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
+        0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+        0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
+        0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
+        0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+        0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
+        0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683,
+        0xe3630b12, 0x94643b84, 0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+        0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
+        0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
+        0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+        0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
+        0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
+        0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+        0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 0x72076785, 0x05005713,
+        0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21,
+        0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+        0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
+        0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
+        0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+        0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
+        0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
+    };
+
+#if defined(RCORE_CRC32_PCLMUL_ENABLED)
+    // Fold 64 bytes blocks in parallel into 128 bits and reduce to 32 bits (Barrett reduction)
+    // REF: Intel: Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction
+    if (dataSize >= 64)
+    {
+        static const unsigned long long k1k2[2] = { 0x0154442bd4ULL, 0x01c6e41596ULL };
+        static const unsigned long long k3k4[2] = { 0x01751997d0ULL, 0x00ccaa009eULL };
+        static const unsigned long long k5k0[2] = { 0x0163cd6124ULL, 0x0000000000ULL };
+        static const unsigned long long poly[2] = { 0x01db710641ULL, 0x01f7011641ULL };
+
+        __m128i x0 = _mm_loadu_si128((const __m128i *)k1k2);
+        __m128i x1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + 0)), _mm_cvtsi32_si128((int)crc));
+        __m128i x2 = _mm_loadu_si128((const __m128i *)(data + 16));
+        __m128i x3 = _mm_loadu_si128((const __m128i *)(data + 32));
+        __m128i x4 = _mm_loadu_si128((const __m128i *)(data + 48));
+        __m128i x5 = { 0 };
+        data += 64;
+        dataSize -= 64;
+
+        // Parallel fold 64 bytes blocks
+        while (dataSize >= 64)
+        {
+            x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+            __m128i x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+            __m128i x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+            __m128i x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+            x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, x0, 0x11), x5), _mm_loadu_si128((const __m128i *)(data + 0)));
+            x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, x0, 0x11), x6), _mm_loadu_si128((const __m128i *)(data + 16)));
+            x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, x0, 0x11), x7), _mm_loadu_si128((const __m128i *)(data + 32)));
+            x4 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x4, x0, 0x11), x8), _mm_loadu_si128((const __m128i *)(data + 48)));
+            data += 64;
+            dataSize -= 64;
+        }
+
+        // Fold into 128 bits
+        x0 = _mm_loadu_si128((const __m128i *)k3k4);
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, x0, 0x11), x2), x5);
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, x0, 0x11), x3), x5);
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, x0, 0x11), x4), x5);
+
+        // Single fold 16 bytes blocks
+        while (dataSize >= 16)
+        {
+            x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+            x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, x0, 0x11), _mm_loadu_si128((const __m128i *)data)), x5);
+            data += 16;
+            dataSize -= 16;
+        }
+
+        // Fold 128 bits to 64 bits
+        __m128i mask = _mm_setr_epi32(~0, 0, ~0, 0);
+        x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+        x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+        x0 = _mm_loadl_epi64((const __m128i *)k5k0);
+        x2 = _mm_srli_si128(x1, 4);
+        x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask), x0, 0x00), x2);
+
+        // Barrett reduction to 32 bits
+        x0 = _mm_loadu_si128((const __m128i *)poly);
+        x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask), x0, 0x10);
+        x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask), x0, 0x00);
+        crc = (unsigned int)_mm_extract_epi32(_mm_xor_si128(x1, x2), 1);
+    }
+#elif defined(RCORE_CRC32_ARM_ENABLED)
+    while (dataSize >= 8)
+    {
+        unsigned long long value = 0;
+        memcpy(&value, data, 8);
+        crc = __crc32d(crc, value);
+        data += 8;
+        dataSize -= 8;
+    }
+#endif
+
+    // Remaining data (or no hardware acceleration available)
+    for (int i = 0; i < dataSize; i++) crc = (crc >> 8) ^ crcTable[data[i] ^ (crc & 0xff)];
+
+    return crc;
+}
+
+// Process hash data blocks (64 bytes each), digest state is updated
+static void ProcessHashBlocks(int hashType, unsigned int *digest, const unsigned char *data, int blockCount)
+{
+    switch (hashType)
+    {
+        case HASH_MD5: ProcessBlocksMD5(digest, data, blockCount); break;
+        case HASH_SHA1: ProcessBlocksSHA1(digest, data, blockCount); break;
+        case HASH_SHA256: ProcessBlocksSHA256(digest, data, blockCount); break;
+        default: break;
+    }
+}
+
+// Process MD5 data blocks (64 bytes each, 16 little-endian 32-bit words)
+static void ProcessBlocksMD5(unsigned int *digest, const unsigned char *data, int blockCount)
+{
+    #define MD5_ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
+
+    // NOTE: r specifies the per-round shift amounts
+    static const unsigned int r[64] = {
+        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
+        5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
+        4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21
+    };
+
+    // Using binary integer part of the sines of integers (in radians) as constants
+    static const unsigned int k[64] = {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+        0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+        0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+        0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+        0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+        0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+        0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+        0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+        0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391
+    };
+
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
+        unsigned int w[16] = { 0 };
+        for (int i = 0; i < 16; i++)
+        {
+            w[i] = ((unsigned int)data[i*4 + 0]) |
+                   ((unsigned int)data[i*4 + 1] << 8) |
+                   ((unsigned int)data[i*4 + 2] << 16) |
+                   ((unsigned int)data[i*4 + 3] << 24);
+        }
+
+        // Initialize hash value for this chunk
+        unsigned int a = digest[0];
+        unsigned int b = digest[1];
+        unsigned int c = digest[2];
+        unsigned int d = digest[3];
+
+        for (int i = 0; i < 64; i++)
+        {
+            unsigned int f = 0;
+            unsigned int g = 0;
+
+            if (i < 16)
+            {
+                f = (b & c) | ((~b) & d);
+                g = i;
+            }
+            else if (i < 32)
+            {
+                f = (d & b) | ((~d) & c);
+                g = (5*i + 1)%16;
+            }
+            else if (i < 48)
+            {
+                f = b ^ c ^ d;
+                g = (3*i + 5)%16;
+            }
+            else
+            {
+                f = c ^ (b | (~d));
+                g = (7*i)%16;
+            }
+
+            unsigned int temp = d;
+            d = c;
+            c = b;
+            b = b + MD5_ROTATE_LEFT((a + f + k[i] + w[g]), r[i]);
+            a = temp;
+        }
+
+        // Add chunk's hash to result so far
+        digest[0] += a;
+        digest[1] += b;
+        digest[2] += c;
+        digest[3] += d;
+    }
+}
+
+// Process SHA-1 data blocks (64 bytes each, 16 big-endian 32-bit words)
+// Hardware acceleration: Intel SHA extensions or ARMv8 cryptography extensions
+static void ProcessBlocksSHA1(unsigned int *digest, const unsigned char *data, int blockCount)
+{
+    #define SHA1_ROTATE_LEFT(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
+
+#if defined(RCORE_SHA_NI_ENABLED)
+    const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+    __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)digest), 0x1b);
+    __m128i e0 = _mm_set_epi32((int)digest[4], 0, 0, 0);
+
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        __m128i abcdSave = abcd;
+        __m128i e0Save = e0;
+        __m128i msg[4] = { 0 };
+        for (int i = 0; i < 4; i++) msg[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + i*16)), mask);
+
+        // 20 groups of 4 rounds, e value is computed from previous abcd value
+        for (int i = 0; i < 20; i++)
+        {
+            __m128i e1 = (i == 0)? _mm_add_epi32(e0, msg[0]) : _mm_sha1nexte_epu32(e0, msg[i%4]);
+            e0 = abcd;
+
+            if (i < 5) abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+            else if (i < 10) abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+            else if (i < 15) abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+            else abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+            // Message schedule: next 4 words from previous 16 words
+            if (i < 16) msg[i%4] = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg[i%4], msg[(i + 1)%4]), msg[(i + 2)%4]), msg[(i + 3)%4]);
+        }
+
+        e0 = _mm_sha1nexte_epu32(e0, e0Save);
+        abcd = _mm_add_epi32(abcd, abcdSave);
+    }
+
+    _mm_storeu_si128((__m128i *)digest, _mm_shuffle_epi32(abcd, 0x1b));
+    digest[4] = (unsigned int)_mm_extract_epi32(e0, 3);
+#elif defined(RCORE_SHA_ARM_ENABLED)
+    static const unsigned int k[4] = { 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc, 0xca62c1d6 };
+
+    uint32x4_t abcd = vld1q_u32(digest);
+    uint32_t e0 = digest[4];
+
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        uint32x4_t abcdSave = abcd;
+        uint32_t e0Save = e0;
+        uint32x4_t msg[4];
+        for (int i = 0; i < 4; i++) msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + i*16)));
+
+        // 20 groups of 4 rounds, e value is computed from previous abcd value
+        for (int i = 0; i < 20; i++)
+        {
+            uint32x4_t wk = vaddq_u32(msg[i%4], vdupq_n_u32(k[i/5]));
+            uint32_t e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+
+            if (i < 5) abcd = vsha1cq_u32(abcd, e0, wk);
+            else if ((i < 10) || (i >= 15)) abcd = vsha1pq_u32(abcd, e0, wk);
+            else abcd = vsha1mq_u32(abcd, e0, wk);
+
+            e0 = e1;
+
+            // Message schedule: next 4 words from previous 16 words
+            if (i < 16) msg[i%4] = vsha1su1q_u32(vsha1su0q_u32(msg[i%4], msg[(i + 1)%4], msg[(i + 2)%4]), msg[(i + 3)%4]);
+        }
+
+        abcd = vaddq_u32(abcd, abcdSave);
+        e0 += e0Save;
+    }
+
+    vst1q_u32(digest, abcd);
+    digest[4] = e0;
+#else
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        // Break chunk into sixteen 32-bit words w[j], 0 <= j <= 15
+        unsigned int w[80] = { 0 };
+        for (int i = 0; i < 16; i++)
+        {
+            w[i] = ((unsigned int)data[i*4 + 0] << 24) |
+                   ((unsigned int)data[i*4 + 1] << 16) |
+                   ((unsigned int)data[i*4 + 2] << 8) |
+                   ((unsigned int)data[i*4 + 3]);
+        }
+
+        // Message schedule: extend the sixteen 32-bit words into eighty 32-bit words:
+        for (int i = 16; i < 80; i++) w[i] = SHA1_ROTATE_LEFT(w[i-3] ^ w[i-8] ^ w[i-14] ^ w[i-16], 1);
+
+        // Initialize hash value for this chunk
+        unsigned int a = digest[0];
+        unsigned int b = digest[1];
+        unsigned int c = digest[2];
+        unsigned int d = digest[3];
+        unsigned int e = digest[4];
+
+        for (int i = 0; i < 80; i++)
+        {
+            unsigned int f = 0;
+            unsigned int k = 0;
+
+            if (i < 20)
+            {
+                f = (b & c) | ((~b) & d);
+                k = 0x5A827999;
+            }
+            else if (i < 40)
+            {
+                f = b ^ c ^ d;
+                k = 0x6ED9EBA1;
+            }
+            else if (i < 60)
+            {
+                f = (b & c) | (b & d) | (c & d);
+                k = 0x8F1BBCDC;
+            }
+            else
+            {
+                f = b ^ c ^ d;
+                k = 0xCA62C1D6;
+            }
+
+            unsigned int temp = SHA1_ROTATE_LEFT(a, 5) + f + e + k + w[i];
+            e = d;
+            d = c;
+            c = SHA1_ROTATE_LEFT(b, 30);
+            b = a;
+            a = temp;
+        }
+
+        // Add this chunk's hash to result so far
+        digest[0] += a;
+        digest[1] += b;
+        digest[2] += c;
+        digest[3] += d;
+        digest[4] += e;
+    }
+#endif
+}
+
+// Process SHA-256 data blocks (64 bytes each, 16 big-endian 32-bit words)
+// Hardware acceleration: Intel SHA extensions or ARMv8 cryptography extensions
+static void ProcessBlocksSHA256(unsigned int *digest, const unsigned char *data, int blockCount)
+{
+    #define SHA256_ROTATE_RIGHT(x, c) (((x) >> (c)) | ((x) << (32 - (c))))
+    #define SHA256_A0(x) (SHA256_ROTATE_RIGHT(x, 7) ^ SHA256_ROTATE_RIGHT(x, 18) ^ ((x) >> 3))
+    #define SHA256_A1(x) (SHA256_ROTATE_RIGHT(x, 17) ^ SHA256_ROTATE_RIGHT(x, 19) ^ ((x) >> 10))
+
+    static const unsigned int k[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+        0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+        0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+        0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+        0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+        0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+#if defined(RCORE_SHA_NI_ENABLED)
+    const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // Digest state is reordered as required by instructions: ABEF and CDGH
+    __m128i temp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&digest[0]), 0xb1);  // CDAB
+    __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&digest[4]), 0x1b); // EFGH
+    __m128i state0 = _mm_alignr_epi8(temp, state1, 8);      // ABEF
+    state1 = _mm_blend_epi16(state1, temp, 0xf0);           // CDGH
+
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        __m128i state0Save = state0;
+        __m128i state1Save = state1;
+        __m128i msg[4] = { 0 };
+        for (int i = 0; i < 4; i++) msg[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + i*16)), mask);
+
+        // 16 groups of 4 rounds
+        for (int i = 0; i < 16; i++)
+        {
+            __m128i wk = _mm_add_epi32(msg[i%4], _mm_loadu_si128((const __m128i *)&k[i*4]));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, wk);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(wk, 0x0e));
+
+            // Message schedule: next 4 words from previous 16 words
+            if (i < 12)
+            {
+                __m128i w = _mm_add_epi32(_mm_sha256msg1_epu32(msg[i%4], msg[(i + 1)%4]), _mm_alignr_epi8(msg[(i + 3)%4], msg[(i + 2)%4], 4));
+                msg[i%4] = _mm_sha256msg2_epu32(w, msg[(i + 3)%4]);
+            }
+        }
+
+        state0 = _mm_add_epi32(state0, state0Save);
+        state1 = _mm_add_epi32(state1, state1Save);
+    }
+
+    temp = _mm_shuffle_epi32(state0, 0x1b);                 // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xb1);               // DCHG
+    _mm_storeu_si128((__m128i *)&digest[0], _mm_blend_epi16(temp, state1, 0xf0));  // DCBA
+    _mm_storeu_si128((__m128i *)&digest[4], _mm_alignr_epi8(state1, temp, 8));     // HGFE
+#elif defined(RCORE_SHA_ARM_ENABLED)
+    uint32x4_t state0 = vld1q_u32(&digest[0]);  // ABCD
+    uint32x4_t state1 = vld1q_u32(&digest[4]);  // EFGH
+
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        uint32x4_t state0Save = state0;
+        uint32x4_t state1Save = state1;
+        uint32x4_t msg[4];
+        for (int i = 0; i < 4; i++) msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + i*16)));
+
+        // 16 groups of 4 rounds
+        for (int i = 0; i < 16; i++)
+        {
+            uint32x4_t wk = vaddq_u32(msg[i%4], vld1q_u32(&k[i*4]));
+            uint32x4_t abcd = state0;
+            state0 = vsha256hq_u32(state0, state1, wk);
+            state1 = vsha256h2q_u32(state1, abcd, wk);
+
+            // Message schedule: next 4 words from previous 16 words
+            if (i < 12) msg[i%4] = vsha256su1q_u32(vsha256su0q_u32(msg[i%4], msg[(i + 1)%4]), msg[(i + 2)%4], msg[(i + 3)%4]);
+        }
+
+        state0 = vaddq_u32(state0, state0Save);
+        state1 = vaddq_u32(state1, state1Save);
+    }
+
+    vst1q_u32(&digest[0], state0);
+    vst1q_u32(&digest[4], state1);
+#else
+    for (int block = 0; block < blockCount; block++, data += 64)
+    {
+        unsigned int w[64] = { 0 };
+        for (int i = 0; i < 16; i++)
+        {
+            w[i] = ((unsigned int)data[i*4 + 0] << 24) |
+                   ((unsigned int)data[i*4 + 1] << 16) |
+                   ((unsigned int)data[i*4 + 2] << 8)  |
+                   ((unsigned int)data[i*4 + 3]);
+        }
+        for (int t = 16; t < 64; t++) w[t] = SHA256_A1(w[t - 2]) + w[t - 7] + SHA256_A0(w[t - 15]) + w[t - 16];
+
+        unsigned int a = digest[0];
+        unsigned int b = digest[1];
+        unsigned int c = digest[2];
+        unsigned int d = digest[3];
+        unsigned int e = digest[4];
+        unsigned int f = digest[5];
+        unsigned int g = digest[6];
+        unsigned int h = digest[7];
+
+        for (int t = 0; t < 64; t++)
+        {
+            unsigned int e1 = (SHA256_ROTATE_RIGHT(e, 6) ^ SHA256_ROTATE_RIGHT(e, 11) ^ SHA256_ROTATE_RIGHT(e, 25));
+            unsigned int ch = ((e & f) ^ (~e & g));
+            unsigned int t1 = (h + e1 + ch + k[t] + w[t]);
+            unsigned int e0 = (SHA256_ROTATE_RIGHT(a, 2) ^ SHA256_ROTATE_RIGHT(a, 13) ^ SHA256_ROTATE_RIGHT(a, 22));
+            unsigned int maj = ((a & b) ^ (a & c) ^ (b & c));
+            unsigned int t2 = e0 + maj;
+
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        digest[0] += a;
+        digest[1] += b;
+        digest[2] += c;
+        digest[3] += d;
+        digest[4] += e;
+        digest[5] += f;
+        digest[6] += g;
+        digest[7] += h;
+    }
+#endif
+}
+
+#if defined(SUPPORT_AUTOMATION_EVENTS)
+// Automation event recording
+// Checking events in current frame and save them into currentEventList
+// NOTE: Recording is by default done at rl_EndDrawing(), before rl_PollInputEvents()
+static void RecordAutomationEvent(void)
+{
+    if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;
+
+    // Keyboard input events recording
+    //-------------------------------------------------------------------------------------
+    for (int key = 0; key < MAX_KEYBOARD_KEYS; key++)
+    {
+        // Event type: INPUT_KEY_UP (only saved once)
+        if (CORE.Input.Keyboard.previousKeyState[key] && !CORE.Input.Keyboard.currentKeyState[key])
+        {
+            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
+            currentEventList->events[currentEventList->count].type = INPUT_KEY_UP;
+            currentEventList->events[currentEventList->count].params[0] = key;
+            currentEventList->events[currentEventList->count].params[1] = 0;
+            currentEventList->events[currentEventList->count].params[2] = 0;
+
+            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_KEY_UP | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
+            currentEventList->count++;
+        }
+
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
+
+        // Event type: INPUT_KEY_DOWN
+        if (CORE.Input.Keyboard.currentKeyState[key])
+        {
+            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
+            currentEventList->events[currentEventList->count].type = INPUT_KEY_DOWN;
+            currentEventList->events[currentEventList->count].params[0] = key;
+            currentEventList->events[currentEventList->count].params[1] = 0;
+            currentEventList->events[currentEventList->count].params[2] = 0;
+
+            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_KEY_DOWN | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
+            currentEventList->count++;
+        }
+
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
+    }
+    //-------------------------------------------------------------------------------------
+
+    // Mouse input currentEventList->events recording
+    //-------------------------------------------------------------------------------------
+    for (int button = 0; button < MAX_MOUSE_BUTTONS; button++)
+    {
+        // Event type: INPUT_MOUSE_BUTTON_UP
+        if (CORE.Input.Mouse.previousButtonState[button] && !CORE.Input.Mouse.currentButtonState[button])
+        {
+            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
+            currentEventList->events[currentEventList->count].type = INPUT_MOUSE_BUTTON_UP;
+            currentEventList->events[currentEventList->count].params[0] = button;
+            currentEventList->events[currentEventList->count].params[1] = 0;
+            currentEventList->events[currentEventList->count].params[2] = 0;
+
+            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_BUTTON_UP | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
+            currentEventList->count++;
+        }
+
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
+
+        // Event type: INPUT_MOUSE_BUTTON_DOWN
+        if (CORE.Input.Mouse.currentButtonState[button])
+        {
+            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
+            currentEventList->events[currentEventList->count].type = INPUT_MOUSE_BUTTON_DOWN;
+            currentEventList->events[currentEventList->count].params[0] = button;
+            currentEventList->events[currentEventList->count].params[1] = 0;
+            currentEventList->events[currentEventList->count].params[2] = 0;
+
+            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_BUTTON_DOWN | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
+            currentEventList->count++;
+        }
+
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
+    }
+
+    // Event type: INPUT_MOUSE_POSITION (only saved if changed)
+    if (((int)CORE.Input.Mouse.currentPosition.x != (int)CORE.Input.Mouse.previousPosition.x) ||
+        ((int)CORE.Input.Mouse.currentPosition.y != (int)CORE.Input.Mouse.previousPosition.y))
+    {
+        currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
+        currentEventList->events[currentEventList->count].type = INPUT_MOUSE_POSITION;
+        currentEventList->events[currentEventList->count].params[0] = (int)CORE.Input.Mouse.currentPosition.x;
+        currentEventList->events[currentEventList->count].params[1] = (int)CORE.Input.Mouse.currentPosition.y;
+        currentEventList->events[currentEventList->count].params[2] = 0;
+
+        TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_POSITION | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
+        currentEventList->count++;
+
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
+    }
+
+    // Event type: INPUT_MOUSE_WHEEL_MOTION
+    if (((int)CORE.Input.Mouse.currentWheelMove.x != (int)CORE.Input.Mouse.previousWheelMove.x) ||
+        ((int)CORE.Input.Mouse.currentWheelMove.y != (int)CORE.Input.Mouse.previousWheelMove.y))
+    {
+        currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
+        currentEventList->events[currentEventList->count].type = INPUT_MOUSE_WHEEL_MOTION;
+        currentEventList->events[currentEventList->count].params[0] = (int)CORE.Input.Mouse.currentWheelMove.x;
+        currentEventList->events[currentEventList->count].params[1] = (int)CORE.Input.Mouse.currentWheelMove.y;
+        currentEventList->events[currentEventList->count].params[2] = 0;
+
+        TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_MOUSE_WHEEL_MOTION | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
+        currentEventList->count++;
+
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
+    }
+    //-------------------------------------------------------------------------------------
+
+    // Touch input currentEventList->events recording
+    //-------------------------------------------------------------------------------------
+    for (int id = 0; id < MAX_TOUCH_POINTS; id++)
+    {
+        // Event type: INPUT_TOUCH_UP
+        if (CORE.Input.Touch.previousTouchState[id] && !CORE.Input.Touch.currentTouchState[id])
+        {
+            currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
+            currentEventList->events[currentEventList->count].type = INPUT_TOUCH_UP;
+            currentEventList->events[currentEventList->count].params[0] = id;
+            currentEventList->events[currentEventList->count].params[1] = 0;
+            currentEventList->events[currentEventList->count].params[2] = 0;
+
+            TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_TOUCH_UP | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
+            currentEventList->count++;
+        }
+
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
+
+        // Event type: INPUT_TOUCH_DOWN
+        if (CORE.Input.Touch.currentTouchState[id])
         {
             currentEventList->events[currentEventList->count].frame = CORE.Time.frameCounter;
             currentEventList->events[currentEventList->count].type = INPUT_TOUCH_DOWN;
@@ -4102,7 +7587,7 @@ static void RecordAutomationEvent(void)
             currentEventList->count++;
         }
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
 
         // Event type: INPUT_TOUCH_POSITION
         // TODO: It requires the id!
@@ -4121,7 +7606,7 @@ static void RecordAutomationEvent(void)
         }
         */
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
     }
     //-------------------------------------------------------------------------------------
 
@@ -4162,7 +7647,7 @@ static void RecordAutomationEvent(void)
                 currentEventList->count++;
             }
 
-            if (currentEventList->count == currentEventList->capacity) return;    // Security check
+            if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
 
             // Event type: INPUT_GAMEPAD_BUTTON_DOWN
             if (CORE.Input.Gamepad.currentButtonState[gamepad][button])
@@ -4177,7 +7662,7 @@ static void RecordAutomationEvent(void)
                 currentEventList->count++;
             }
 
-            if (currentEventList->count == currentEventList->capacity) return;    // Security check
+            if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
         }
 
         for (int axis = 0; axis < MAX_GAMEPAD_AXES; axis++)
@@ -4196,7 +7681,7 @@ static void RecordAutomationEvent(void)
                 currentEventList->count++;
             }
 
-            if (currentEventList->count == currentEventList->capacity) return;    // Security check
+            if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
         }
     }
     //-------------------------------------------------------------------------------------
@@ -4216,11 +7701,386 @@ static void RecordAutomationEvent(void)
         TRACELOG(LOG_INFO, "AUTOMATION: Frame: %i | Event type: INPUT_GESTURE | Event parameters: %i, %i, %i", currentEventList->events[currentEventList->count].frame, currentEventList->events[currentEventList->count].params[0], currentEventList->events[currentEventList->count].params[1], currentEventList->events[currentEventList->count].params[2]);
         currentEventList->count++;
 
-        if (currentEventList->count == currentEventList->capacity) return;    // Security check
+        if ((currentEventList->count == currentEventList->capacity) && !GrowAutomationEventList(currentEventList)) return;    // Security check
     }
     //-------------------------------------------------------------------------------------
 #endif
 }
+
+// Grow automation events list capacity (doubled), new events entries zero initialized
+static bool GrowAutomationEventList(rl_AutomationEventList *list)
+{
+    unsigned int capacity = (list->capacity > 0)? list->capacity*2 : MAX_AUTOMATION_EVENTS;
+    rl_AutomationEvent *events = (rl_AutomationEvent *)RL_REALLOC(list->events, capacity*sizeof(rl_AutomationEvent));
+
+    if (events == NULL)
+    {
+        TRACELOG(LOG_WARNING, "AUTOMATION: Failed to grow events list, event not recorded");
+        return false;
+    }
+
+    memset(events + list->capacity, 0, (capacity - list->capacity)*sizeof(rl_AutomationEvent));
+    list->events = events;
+    list->capacity = capacity;
+
+    return true;
+}
+
+// Encode automation event (binary format), returns encoded data size
+// NOTE: Provided data must fit AUTOMATION_EVENT_MAX_SIZE bytes
+static int EncodeAutomationEvent(AutomationEventCoder *coder, const rl_AutomationEvent *event, unsigned char *data)
+{
+    int size = 0;
+    int values[5] = { (int)(event->frame - coder->frame), 0 };
+    int valueCount = 1;
+    int *params = coder->params[event->type & (AUTOMATION_EVENT_TYPES - 1)];
+    unsigned char mask = 0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        int delta = (int)((unsigned int)event->params[i] - (unsigned int)params[i]);
+
+        if (delta != 0)
+        {
+            mask |= (1 << i);
+            values[valueCount++] = delta;
+        }
+
+        params[i] = event->params[i];
+    }
+
+    coder->frame = event->frame;
+
+    for (int i = 0; i < valueCount; i++)
+    {
+        // Zigzag varint: sign moved to low bit, 7 bits per byte, high bit set if more bytes follow
+        unsigned int value = ((unsigned int)values[i] << 1) ^ (unsigned int)(values[i] >> 31);
+
+        while (value >= 0x80)
+        {
+            data[size++] = (unsigned char)(value | 0x80);
+            value >>= 7;
+        }
+
+        data[size++] = (unsigned char)value;
+
+        // NOTE: Event type and params mask are placed after frame delta
+        if (i == 0)
+        {
+            data[size++] = (unsigned char)event->type;
+            data[size++] = mask;
+        }
+    }
+
+    return size;
+}
+
+// Decode automation event (binary format), returns decoded data size
+// NOTE: Returns 0 if provided data does not contain a full event, -1 if data is not valid
+static int DecodeAutomationEvent(AutomationEventCoder *coder, const unsigned char *data, int dataSize, rl_AutomationEvent *event)
+{
+    int size = 0;
+    int values[5] = { 0 };
+    int valueCount = 1;
+    unsigned char type = 0;
+    unsigned char mask = 0;
+
+    for (int i = 0; i < valueCount; i++)
+    {
+        unsigned int value = 0;
+        int shift = 0;
+
+        while (true)
+        {
+            if (size >= dataSize) return 0;
+            if (shift > 28) return -1;
+
+            unsigned char byte = data[size++];
+            value |= (unsigned int)(byte & 0x7f) << shift;
+            shift += 7;
+
+            if (!(byte & 0x80)) break;
+        }
+
+        values[i] = (int)((value >> 1) ^ (0u - (value & 1)));
+
+        if (i == 0)
+        {
+            if ((size + 2) > dataSize) return 0;
+
+            type = data[size++];
+            mask = data[size++];
+
+            if (mask > 0x0f) return -1;
+            for (int k = 0; k < 4; k++) if (mask & (1 << k)) valueCount++;
+        }
+    }
+
+    int *params = coder->params[type & (AUTOMATION_EVENT_TYPES - 1)];
+
+    for (int i = 0, k = 1; i < 4; i++)
+    {
+        if (mask & (1 << i)) params[i] = (int)((unsigned int)params[i] + (unsigned int)values[k++]);
+    }
+
+    coder->frame += (unsigned int)values[0];
+
+    event->frame = coder->frame;
+    event->type = type;
+    for (int i = 0; i < 4; i++) event->params[i] = params[i];
+
+    return size;
+}
+
+// Check if file is an automation events binary file
+static bool IsAutomationEventsBinaryFile(const char *fileName)
+{
+    bool result = false;
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        unsigned char fileId[4] = { 0 };
+        if ((fread(fileId, 1, 4, file) == 4) && (memcmp(fileId, "rAEB", 4) == 0)) result = true;
+        fclose(file);
+    }
+
+    return result;
+}
+
+// Load automation events binary file into events list, list capacity grows as required
+static void LoadAutomationEventsBinary(const char *fileName, rl_AutomationEventList *list)
+{
+    int fileSize = 0;
+    unsigned char *fileData = rl_LoadFileData(fileName, &fileSize);
+
+    if ((fileData == NULL) || (fileSize < AUTOMATION_BINARY_HEADER_SIZE) || (fileData[4] != AUTOMATION_BINARY_VERSION))
+    {
+        TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Events file is not a valid binary events file", fileName);
+        rl_UnloadFileData(fileData);
+        return;
+    }
+
+    unsigned char *data = fileData + AUTOMATION_BINARY_HEADER_SIZE;
+    int dataSize = fileSize - AUTOMATION_BINARY_HEADER_SIZE;
+    unsigned char *decompData = NULL;
+
+    if (fileData[5] & AUTOMATION_BINARY_COMPRESSED)
+    {
+#if defined(SUPPORT_COMPRESSION_API)
+        decompData = rl_DecompressDataEx(data, dataSize, &dataSize, MAX_COMPRESSION_THREADS);
+#endif
+        data = decompData;
+
+        if (data == NULL)
+        {
+            TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Failed to decompress events file", fileName);
+            rl_UnloadFileData(fileData);
+            return;
+        }
+    }
+
+    AutomationEventCoder coder = { 0 };
+    int offset = 0;
+
+    while (offset < dataSize)
+    {
+        if ((list->count == list->capacity) && !GrowAutomationEventList(list)) break;
+
+        int size = DecodeAutomationEvent(&coder, data + offset, dataSize - offset, &list->events[list->count]);
+
+        if (size <= 0)
+        {
+            TRACELOG(LOG_WARNING, "AUTOMATION: [%s] Events file data is corrupted", fileName);
+            break;
+        }
+
+        offset += size;
+        list->count++;
+    }
+
+    RL_FREE(decompData);
+    rl_UnloadFileData(fileData);
+
+    TRACELOG(LOG_INFO, "AUTOMATION: [%s] Events file loaded successfully", fileName);
+    TRACELOG(LOG_INFO, "    > Total number of events: %i", list->count);
+}
+
+// Write automation events stream data to file (compression stream callback)
+static bool WriteAutomationEventStreamData(const unsigned char *data, int dataSize, void *userData)
+{
+    rl_AutomationEventStream *stream = (rl_AutomationEventStream *)userData;
+
+    if (fwrite(data, 1, dataSize, stream->file) != (size_t)dataSize) stream->failed = true;
+
+    return !stream->failed;
+}
+
+// Append automation events stream data pending to be decoded (decompression stream callback)
+static bool ReadAutomationEventStreamData(const unsigned char *data, int dataSize, void *userData)
+{
+    rl_AutomationEventStream *stream = (rl_AutomationEventStream *)userData;
+
+    if ((stream->bufferSize + dataSize) > stream->bufferCapacity)
+    {
+        int capacity = (stream->bufferCapacity > 0)? stream->bufferCapacity : 4096;
+        while (capacity < (stream->bufferSize + dataSize)) capacity *= 2;
+
+        unsigned char *buffer = (unsigned char *)RL_REALLOC(stream->buffer, capacity);
+
+        if (buffer == NULL)
+        {
+            stream->failed = true;
+            return false;
+        }
+
+        stream->buffer = buffer;
+        stream->bufferCapacity = capacity;
+    }
+
+    memcpy(stream->buffer + stream->bufferSize, data, dataSize);
+    stream->bufferSize += dataSize;
+
+    return true;
+}
+
+// Flush automation events recorded to stream file, events list is reset
+static void FlushAutomationEventStream(rl_AutomationEventStream *stream)
+{
+    if ((stream->list.count == 0) || stream->failed) return;
+
+    int requiredSize = stream->list.count*AUTOMATION_EVENT_MAX_SIZE;
+
+    if (requiredSize > stream->bufferCapacity)
+    {
+        RL_FREE(stream->buffer);
+        stream->buffer = (unsigned char *)RL_MALLOC(requiredSize);
+        stream->bufferCapacity = requiredSize;
+    }
+
+    stream->bufferSize = 0;
+    for (unsigned int i = 0; i < stream->list.count; i++) stream->bufferSize += EncodeAutomationEvent(&stream->coder, &stream->list.events[i], stream->buffer + stream->bufferSize);
+
+    if (stream->compression != NULL)
+    {
+        if (!rl_UpdateCompressionStream(stream->compression, stream->buffer, stream->bufferSize)) stream->failed = true;
+    }
+    else WriteAutomationEventStreamData(stream->buffer, stream->bufferSize, stream);
+
+    stream->list.count = 0;
+}
+#endif
+
+#if defined(SUPPORT_INPUT_EVENTS)
+// Initialize input events queue slots
+static void InitInputEvents(void)
+{
+    for (unsigned int i = 0; i < MAX_INPUT_EVENTS_QUEUE; i++) CORE.Input.Events.slots[i].sequence = i;
+
+    CORE.Input.Events.tail = 0;
+    CORE.Input.Events.head = 0;
+    CORE.Input.Events.dropped = 0;
+}
+
+// Push gamepad events for changes since previous poll
+// NOTE: Gamepads are polled by platforms, events are registered with poll time
+static void PushGamepadInputEvents(void)
+{
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        if (CORE.Input.Gamepad.ready[i] != CORE.Input.Events.gamepadReady[i])
+        {
+            PushInputEvent(CORE.Input.Gamepad.ready[i]? INPUT_EVENT_GAMEPAD_CONNECTED : INPUT_EVENT_GAMEPAD_DISCONNECTED, i, 0, 0.0f, 0.0f);
+            CORE.Input.Events.gamepadReady[i] = CORE.Input.Gamepad.ready[i];
+        }
+
+        if (!CORE.Input.Gamepad.ready[i]) continue;
+
+        for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++)
+        {
+            if (CORE.Input.Gamepad.currentButtonState[i][k] != CORE.Input.Gamepad.previousButtonState[i][k])
+            {
+                PushInputEvent(CORE.Input.Gamepad.currentButtonState[i][k]? INPUT_EVENT_GAMEPAD_BUTTON_PRESSED : INPUT_EVENT_GAMEPAD_BUTTON_RELEASED, i, k, 0.0f, 0.0f);
+            }
+        }
+
+        for (int k = 0; k < MAX_GAMEPAD_AXES; k++)
+        {
+            if (CORE.Input.Gamepad.axisState[i][k] != CORE.Input.Events.gamepadAxis[i][k])
+            {
+                PushInputEvent(INPUT_EVENT_GAMEPAD_AXIS, i, k, CORE.Input.Gamepad.axisState[i][k], 0.0f);
+                CORE.Input.Events.gamepadAxis[i][k] = CORE.Input.Gamepad.axisState[i][k];
+            }
+        }
+    }
+}
+
+// Push timestamped input event into queue
+// NOTE: Lock-free and safe to be called from any thread, event is dropped if queue is full
+static void PushInputEvent(int type, int device, int code, float x, float y)
+{
+    double time = rl_GetTime();
+
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    // Register touch events for multi-touch gestures, batch is processed after input polling
+    // NOTE: Touch events are pushed by platforms input polling/callbacks, always on main thread
+    if ((type == INPUT_EVENT_TOUCH_DOWN) || (type == INPUT_EVENT_TOUCH_UP) || (type == INPUT_EVENT_TOUCH_MOVE))
+    {
+        if (CORE.Input.Events.touchEventCount == MAX_GESTURE_TOUCH_EVENTS) ProcessGestureTouchInputEvents();
+
+        GestureTouchEvent *touchEvent = &CORE.Input.Events.touchEvents[CORE.Input.Events.touchEventCount];
+        touchEvent->time = time;
+        touchEvent->touchAction = (type == INPUT_EVENT_TOUCH_DOWN)? TOUCH_ACTION_DOWN : ((type == INPUT_EVENT_TOUCH_UP)? TOUCH_ACTION_UP : TOUCH_ACTION_MOVE);
+        touchEvent->pointId = device;
+        touchEvent->position = (rl_Vector2){ x/(float)CORE.Window.screen.width, y/(float)CORE.Window.screen.height };
+        CORE.Input.Events.touchEventCount++;
+    }
+#endif
+
+    unsigned int position = ATOMIC_LOAD(&CORE.Input.Events.tail);
+    unsigned int index = 0;
+
+    while (true)
+    {
+        index = position & (MAX_INPUT_EVENTS_QUEUE - 1);
+        unsigned int sequence = ATOMIC_LOAD(&CORE.Input.Events.slots[index].sequence);
+        int diff = (int)(sequence - position);
+
+        if (diff == 0)
+        {
+            // Slot is free, claim it moving tail forward
+            if (ATOMIC_CAS(&CORE.Input.Events.tail, position, position + 1)) break;
+        }
+        else if (diff < 0)
+        {
+            // Queue is full, slot not released by consumer yet
+            ATOMIC_INCREMENT(&CORE.Input.Events.dropped);
+            return;
+        }
+
+        position = ATOMIC_LOAD(&CORE.Input.Events.tail);
+    }
+
+    rl_InputEvent *event = &CORE.Input.Events.slots[index].event;
+    event->time = time;
+    event->type = type;
+    event->device = device;
+    event->code = code;
+    event->value = (rl_Vector2){ x, y };
+
+    // Publish slot for consumer
+    ATOMIC_STORE(&CORE.Input.Events.slots[index].sequence, position + 1);
+}
+
+// Process touch events batch for multi-touch gestures
+// NOTE: Called once per frame after input polling, or earlier if batch is full
+static void ProcessGestureTouchInputEvents(void)
+{
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    ProcessGestureTouchEvents(CORE.Input.Events.touchEvents, CORE.Input.Events.touchEventCount);
+    CORE.Input.Events.touchEventCount = 0;
+#endif
+}
 #endif
 
 #if !defined(SUPPORT_MODULE_RTEXT)
@@ -4236,8 +8096,8 @@ const char *rl_TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    static RL_CONTEXT_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_CONTEXT_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
     memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
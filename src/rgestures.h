@@ -12,6 +12,11 @@
 *           If defined, the library can be used as standalone to process gesture events with
 *           no external dependencies.
 *
+*   FEATURES:
+*       - Single gestures detection (tap, double tap, hold, drag, swipe, pinch) from touch events (ProcessGestureEvent())
+*       - Multi-touch gestures detection, per touch point state for up to MAX_TOUCH_POINTS concurrent touches,
+*         touch events processed in batches with event timestamps (ProcessGestureTouchEvents())
+*
 *   CONTRIBUTORS:
 *       Marc Palau:         Initial implementation (2014)
 *       Albert Martos:      Complete redesign and testing (2015)
@@ -53,6 +58,9 @@
 #ifndef MAX_TOUCH_POINTS
     #define MAX_TOUCH_POINTS        8        // Maximum number of touch points supported
 #endif
+#ifndef MAX_GESTURE_TOUCH_EVENTS
+    #define MAX_GESTURE_TOUCH_EVENTS   64    // Maximum number of touch events batched per frame for multi-touch gestures
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -89,6 +97,16 @@ typedef enum {
     GESTURE_PINCH_IN    = 256,
     GESTURE_PINCH_OUT   = 512
 } rl_Gesture;
+
+// Gesture touch point, multi-touch gestures state for one touch point
+typedef struct rl_GestureTouch {
+    int id;                         // Touch point id
+    int gesture;                    // Gesture detected for this touch point (rl_Gesture)
+    rl_Vector2 position;            // Touch current position (normalized screen units)
+    rl_Vector2 downPosition;        // Touch down position (normalized screen units)
+    rl_Vector2 velocity;            // Touch velocity (normalized screen units per second)
+    float duration;                 // Time since touch down (in seconds)
+} rl_GestureTouch;
 #endif
 
 typedef enum {
@@ -106,6 +124,14 @@ typedef struct {
     rl_Vector2 position[MAX_TOUCH_POINTS];
 } GestureEvent;
 
+// Gesture touch event, one touch point change
+typedef struct {
+    double time;                    // Event time (in seconds)
+    int touchAction;                // Touch action (TouchAction)
+    int pointId;                    // Touch point id
+    rl_Vector2 position;            // Touch position (normalized screen units)
+} GestureTouchEvent;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -121,10 +147,11 @@ extern "C" {            // Prevents name mangling of functions
 
 void ProcessGestureEvent(GestureEvent event);           // Process gesture event and translate it into gestures
 void UpdateGestures(void);                              // Update gestures detected (must be called every frame)
+void ProcessGestureTouchEvents(const GestureTouchEvent *events, int count); // Process a batch of touch events, multi-touch gestures per touch point
 
 #if defined(RGESTURES_STANDALONE)
 void rl_SetGesturesEnabled(unsigned int flags);            // Enable a set of gestures using flags
-bool rl_IsGestureDetected(int gesture);                    // Check if a gesture have been detected
+bool rl_IsGestureDetected(unsigned int gesture);           // Check if a gesture have been detected
 int rl_GetGestureDetected(void);                           // Get latest detected gesture
 
 float rl_GetGestureHoldDuration(void);                     // Get gesture hold time in seconds
@@ -132,6 +159,9 @@ rl_Vector2 rl_GetGestureDragVector(void);                     // Get gesture dra
 float rl_GetGestureDragAngle(void);                        // Get gesture drag angle
 rl_Vector2 rl_GetGesturePinchVector(void);                    // Get gesture pinch delta
 float rl_GetGesturePinchAngle(void);                       // Get gesture pinch angle
+
+int rl_GetGestureTouchCount(void);                         // Get number of touch points tracked by multi-touch gestures
+rl_GestureTouch rl_GetGestureTouch(int index);             // Get multi-touch gestures state for a tracked touch point
 #endif
 
 #if defined(__cplusplus)
@@ -178,13 +208,28 @@ float rl_GetGesturePinchAngle(void);                       // Get gesture pinch
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#define FORCE_TO_SWIPE      0.2f        // Swipe force, measured in normalized screen units/time
-#define MINIMUM_DRAG        0.015f      // Drag minimum force, measured in normalized screen units (0.0f to 1.0f)
-#define DRAG_TIMEOUT        0.3f        // Drag minimum time for web, measured in seconds
-#define MINIMUM_PINCH       0.005f      // Pinch minimum force, measured in normalized screen units (0.0f to 1.0f)
-#define TAP_TIMEOUT         0.3f        // Tap minimum time, measured in seconds
-#define PINCH_TIMEOUT       0.3f        // Pinch minimum time, measured in seconds
-#define DOUBLETAP_RANGE     0.03f       // DoubleTap range, measured in normalized screen units (0.0f to 1.0f)
+// NOTE: Thresholds can be redefined before including the implementation (i.e. large touch tables)
+#ifndef FORCE_TO_SWIPE
+    #define FORCE_TO_SWIPE      0.2f        // Swipe force, measured in normalized screen units/time
+#endif
+#ifndef MINIMUM_DRAG
+    #define MINIMUM_DRAG        0.015f      // Drag minimum force, measured in normalized screen units (0.0f to 1.0f)
+#endif
+#ifndef DRAG_TIMEOUT
+    #define DRAG_TIMEOUT        0.3f        // Drag minimum time for web, measured in seconds
+#endif
+#ifndef MINIMUM_PINCH
+    #define MINIMUM_PINCH       0.005f      // Pinch minimum force, measured in normalized screen units (0.0f to 1.0f)
+#endif
+#ifndef TAP_TIMEOUT
+    #define TAP_TIMEOUT         0.3f        // Tap minimum time, measured in seconds
+#endif
+#ifndef PINCH_TIMEOUT
+    #define PINCH_TIMEOUT       0.3f        // Pinch minimum time, measured in seconds
+#endif
+#ifndef DOUBLETAP_RANGE
+    #define DOUBLETAP_RANGE     0.03f       // DoubleTap range, measured in normalized screen units (0.0f to 1.0f)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -228,6 +273,30 @@ typedef struct {
     } Pinch;
 } GesturesData;
 
+// Gesture touch point state, multi-touch gestures
+typedef struct {
+    bool active;                        // Touch point slot in use
+    int id;                             // Touch point id
+    int gesture;                        // Gesture detected for this touch point
+    bool released;                      // Touch point released, slot freed on next frame
+    double downTime;                    // Time stamp on touch down
+    double eventTime;                   // Time stamp of last touch event
+    rl_Vector2 downPosition;            // Touch down position
+    rl_Vector2 position;                // Touch current position
+    rl_Vector2 velocity;                // Touch velocity, smoothed (units per second)
+} GestureTouchPoint;
+
+// Multi-touch gestures state context
+typedef struct {
+    GestureTouchPoint points[MAX_TOUCH_POINTS]; // Touch points state, slots reused on touch down
+    int pointCount;                     // Touch points tracked (including released this frame)
+    struct {
+        double time;                    // Tap time stamp
+        rl_Vector2 position;            // Tap position
+    } taps[MAX_TOUCH_POINTS];           // Recent taps, required to detect double taps per touch
+    int tapIndex;                       // Next tap slot to be overwritten
+} GesturesTouchData;
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -237,12 +306,16 @@ static GesturesData GESTURES = {
     .enabledFlags = 0b0000001111111111  // All gestures supported by default
 };
 
+static GesturesTouchData GESTURES_TOUCH = { 0 };   // Multi-touch gestures state
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
 static float rgVector2Angle(rl_Vector2 initialPosition, rl_Vector2 finalPosition);
 static float rgVector2Distance(rl_Vector2 v1, rl_Vector2 v2);
 static double rgGetCurrentTime(void);
+static int rgGetSwipeGesture(rl_Vector2 downPosition, rl_Vector2 upPosition);
+static GestureTouchPoint *rgGetTouchPoint(int id, bool create);
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -425,6 +498,106 @@ void UpdateGestures(void)
     {
         GESTURES.current = GESTURE_NONE;
     }
+
+    // Update multi-touch gestures, touch points released on previous frame are freed
+    for (int i = 0; i < MAX_TOUCH_POINTS; i++)
+    {
+        GestureTouchPoint *point = &GESTURES_TOUCH.points[i];
+
+        if (!point->active) continue;
+
+        if (point->released)
+        {
+            point->active = false;
+            GESTURES_TOUCH.pointCount--;
+        }
+        else if ((point->gesture == GESTURE_TAP) || (point->gesture == GESTURE_DOUBLETAP)) point->gesture = GESTURE_HOLD;
+    }
+}
+
+// Process a batch of touch events, multi-touch gestures per touch point
+// NOTE: Events must be sorted by time, every touch point is tracked independently,
+// gestures detected are kept per touch point: tap, double tap, hold, drag and swipes
+void ProcessGestureTouchEvents(const GestureTouchEvent *events, int count)
+{
+    if (events == NULL) return;
+
+    for (int i = 0; i < count; i++)
+    {
+        const GestureTouchEvent *event = &events[i];
+        GestureTouchPoint *point = rgGetTouchPoint(event->pointId, (event->touchAction == TOUCH_ACTION_DOWN));
+
+        if (point == NULL) continue;    // Touch point not tracked (all slots in use or down event missed)
+
+        if (event->touchAction == TOUCH_ACTION_DOWN)
+        {
+            point->gesture = GESTURE_TAP;
+            point->released = false;
+            point->downTime = event->time;
+            point->eventTime = event->time;
+            point->downPosition = event->position;
+            point->position = event->position;
+            point->velocity = (rl_Vector2){ 0.0f, 0.0f };
+
+            // Detect GESTURE_DOUBLETAP, recent tap close to touch down position
+            for (int t = 0; t < MAX_TOUCH_POINTS; t++)
+            {
+                if ((GESTURES_TOUCH.taps[t].time > 0.0) && ((event->time - GESTURES_TOUCH.taps[t].time) < TAP_TIMEOUT) && (rgVector2Distance(GESTURES_TOUCH.taps[t].position, event->position) < DOUBLETAP_RANGE))
+                {
+                    point->gesture = GESTURE_DOUBLETAP;
+                    GESTURES_TOUCH.taps[t].time = 0.0;
+                    break;
+                }
+            }
+        }
+        else if (event->touchAction == TOUCH_ACTION_MOVE)
+        {
+            if (point->released) continue;
+
+            // Velocity smoothed over events, move events timing depends on device
+            double delta = event->time - point->eventTime;
+            if (delta > 0.0)
+            {
+                point->velocity.x = 0.5f*point->velocity.x + 0.5f*(event->position.x - point->position.x)/(float)delta;
+                point->velocity.y = 0.5f*point->velocity.y + 0.5f*(event->position.y - point->position.y)/(float)delta;
+            }
+
+            point->position = event->position;
+            point->eventTime = event->time;
+
+            // Detect GESTURE_DRAG
+            if ((point->gesture != GESTURE_DRAG) && ((event->time - point->downTime) > DRAG_TIMEOUT) &&
+                (rgVector2Distance(point->downPosition, point->position) >= MINIMUM_DRAG)) point->gesture = GESTURE_DRAG;
+        }
+        else    // TOUCH_ACTION_UP, TOUCH_ACTION_CANCEL
+        {
+            point->position = event->position;
+            point->eventTime = event->time;
+            point->released = true;
+
+            float distance = rgVector2Distance(point->downPosition, point->position);
+            double duration = event->time - point->downTime;
+
+            if (event->touchAction == TOUCH_ACTION_CANCEL) point->gesture = GESTURE_NONE;
+            else if ((point->gesture != GESTURE_DRAG) && (duration > 0.0) && ((distance/(float)duration) > FORCE_TO_SWIPE))
+            {
+                // Detect GESTURE_SWIPE
+                point->gesture = rgGetSwipeGesture(point->downPosition, point->position);
+            }
+            else
+            {
+                // Register tap, required to detect double taps
+                if ((duration < TAP_TIMEOUT) && (distance < DOUBLETAP_RANGE))
+                {
+                    GESTURES_TOUCH.taps[GESTURES_TOUCH.tapIndex].time = event->time;
+                    GESTURES_TOUCH.taps[GESTURES_TOUCH.tapIndex].position = point->position;
+                    GESTURES_TOUCH.tapIndex = (GESTURES_TOUCH.tapIndex + 1)%MAX_TOUCH_POINTS;
+                }
+
+                point->gesture = GESTURE_NONE;
+            }
+        }
+    }
 }
 
 // Get latest detected gesture
@@ -480,6 +653,42 @@ float rl_GetGesturePinchAngle(void)
     return GESTURES.Pinch.angle;
 }
 
+// Get number of touch points tracked by multi-touch gestures
+// NOTE: Touch points released on current frame are included, their last gesture (i.e. swipe) is available
+int rl_GetGestureTouchCount(void)
+{
+    return GESTURES_TOUCH.pointCount;
+}
+
+// Get multi-touch gestures state for a tracked touch point
+rl_GestureTouch rl_GetGestureTouch(int index)
+{
+    rl_GestureTouch touch = { 0 };
+    touch.id = -1;
+
+    for (int i = 0, k = 0; i < MAX_TOUCH_POINTS; i++)
+    {
+        const GestureTouchPoint *point = &GESTURES_TOUCH.points[i];
+
+        if (!point->active) continue;
+
+        if (k == index)
+        {
+            touch.id = point->id;
+            touch.gesture = (GESTURES.enabledFlags & point->gesture);
+            touch.position = point->position;
+            touch.downPosition = point->downPosition;
+            touch.velocity = point->velocity;
+            touch.duration = (float)((point->released? point->eventTime : rgGetCurrentTime()) - point->downTime);
+            break;
+        }
+
+        k++;
+    }
+
+    return touch;
+}
+
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
@@ -506,6 +715,56 @@ static float rgVector2Distance(rl_Vector2 v1, rl_Vector2 v2)
     return result;
 }
 
+// Get swipe gesture from touch down to touch up positions direction
+static int rgGetSwipeGesture(rl_Vector2 downPosition, rl_Vector2 upPosition)
+{
+    int gesture = GESTURE_NONE;
+
+    // NOTE: Angle should be inverted in Y
+    float angle = 360.0f - rgVector2Angle(downPosition, upPosition);
+
+    if ((angle < 30) || (angle > 330)) gesture = GESTURE_SWIPE_RIGHT;
+    else if ((angle >= 30) && (angle <= 150)) gesture = GESTURE_SWIPE_UP;
+    else if ((angle > 150) && (angle < 210)) gesture = GESTURE_SWIPE_LEFT;
+    else if ((angle >= 210) && (angle <= 330)) gesture = GESTURE_SWIPE_DOWN;
+
+    return gesture;
+}
+
+// Get touch point state for a touch id, a free slot is taken if required
+// NOTE: Lookup is bounded by MAX_TOUCH_POINTS, constant cost per event
+static GestureTouchPoint *rgGetTouchPoint(int id, bool create)
+{
+    GestureTouchPoint *point = NULL;
+    GestureTouchPoint *freePoint = NULL;
+
+    for (int i = 0; i < MAX_TOUCH_POINTS; i++)
+    {
+        GestureTouchPoint *current = &GESTURES_TOUCH.points[i];
+
+        if (!current->active)
+        {
+            if (freePoint == NULL) freePoint = current;
+        }
+        else if ((current->id == id) && (!current->released || create))
+        {
+            // NOTE: Touch id reused on touch down while previous touch is released this frame, previous touch state is replaced
+            point = current;
+            break;
+        }
+    }
+
+    if ((point == NULL) && create && (freePoint != NULL))
+    {
+        point = freePoint;
+        point->active = true;
+        point->id = id;
+        GESTURES_TOUCH.pointCount++;
+    }
+
+    return point;
+}
+
 // Time measure returned are seconds
 static double rgGetCurrentTime(void)
 {
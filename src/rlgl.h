@@ -47,16 +47,66 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_ENABLE_PERSISTENT_BATCH_BUFFERS
+*           Use persistently mapped vertex buffers for render batches (GL_ARB_buffer_storage), vertex data
+*           is written directly into GPU-visible memory and buffers are reused once their fence is signaled
+*           If not supported, batch buffers are orphaned before every update to avoid driver stalls
+*
+*       #define RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS
+*           Use an interleaved vertex layout for render batches (rlBatchVertex, 32 bytes per vertex),
+*           position, texcoord, packed normal and color are stored together in a single VBO,
+*           reducing memory traffic on vertex definition and buffer binds on batch drawing
+*
+*       #define RLGL_ENABLE_MULTITEXTURE_BATCH
+*           Let render batch draw calls reference up to RL_DEFAULT_BATCH_DRAW_TEXTURES textures when using the
+*           default shader, texture is selected per-vertex by a texture slot, so rlSetTexture() does not
+*           require a new draw call while slots are available (requires RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+*
+*       #define RLGL_ENABLE_GPU_PROFILER
+*           Enable GPU frame profiler, named passes are measured with GPU timestamp queries (GL_TIMESTAMP),
+*           results are read back asynchronously RL_PROFILER_FRAME_LATENCY frames later (no pipeline stalls)
+*           NOTE: When not defined, profiler functions are empty and no queries or counters are used
+*
+*       #define RLGL_ENABLE_COMMAND_BUFFERS
+*           Enable command buffers recording, any thread can record immediate-mode rlgl calls (rlBegin(), rlVertex*(),
+*           rlSetTexture(), matrix operations...) into its own rlCommandBuffer while GL context thread replays
+*           submitted buffers in submission order (by default on rl_EndDrawing())
+*
+*       #define RLGL_ENABLE_STATE_CACHE
+*           Keep a shadow copy of GL state (bound program, VAO, textures per unit, blending, depth/cull/scissor
+*           toggles, viewport) and skip redundant GL calls, useful on WebGL where every GL call is expensive
+*           NOTE: Call rlResetStateCache() after modifying GL state outside rlgl (only OpenGL 3.3+ and ES2)
+*
+*       #define RLGL_ENABLE_THREAD_CONTEXTS
+*           Store rlgl state in thread local storage (RL_CONTEXT_LOCAL), every thread with its own GL context
+*           current gets an independent rlgl context, initialized with rlglInit() and closed with rlglClose()
+*           NOTE: Extensions function pointers are shared, all contexts must be created on the same GL driver
+*
+*       #define RL_PROFILE_ZONE_BEGIN(name)
+*       #define RL_PROFILE_ZONE_END()
+*           CPU profiler zones hooks, render batch flushes (rlDrawRenderBatch()) are measured as named zones,
+*           raylib maps them to its CPU profiler (SUPPORT_CPU_PROFILER), not defined by default (no zones)
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
 *       #define RL_DEFAULT_BATCH_BUFFER_ELEMENTS   8192    // Default internal render batch elements limits
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
+*       #define RL_DEFAULT_BATCH_PERSISTENT_BUFFERS   3    // Default number of batch buffers when using persistent mapping (ring buffering)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (rl_SetShaderValueTexture())
+*       #define RL_DEFAULT_BATCH_DRAW_TEXTURES        4    // Maximum number of textures referenced by a single draw call (RLGL_ENABLE_MULTITEXTURE_BATCH, minimum 2)
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal rl_Matrix stack
-*       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_SHADER_LOCATIONS              40    // Maximum number of shader locations supported
+*       #define RL_MAX_STATE_CACHE_TEXTURE_UNITS     16    // Maximum number of texture units tracked by GL state cache
+*       #define RL_MAX_COMMAND_BUFFER_SUBMITS        64    // Maximum number of command buffers submitted per replay (RLGL_ENABLE_COMMAND_BUFFERS)
+*       #define RL_ASYNC_UPLOAD_BUFFER_SIZE    16777216    // Async texture upload staging ring size in bytes (PBO, 16 MB)
+*       #define RL_MAX_ASYNC_UPLOADS                 64    // Maximum number of async texture uploads in flight
+*       #define RL_MAX_ASYNC_READBACKS                3    // Maximum number of async screen readbacks in flight (PBO)
+*       #define RL_MAX_ASYNC_SHADERS                256    // Maximum number of shader programs compiling asynchronously
+*       #define RL_MAX_PROFILER_PASSES               32    // Maximum number of GPU profiler passes per frame (RLGL_ENABLE_GPU_PROFILER)
+*       #define RL_PROFILER_FRAME_LATENCY             3    // Number of frames GPU profiler queries are kept in flight before read back
 *       #define RL_CULL_DISTANCE_NEAR              0.05    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             4000.0    // Default projection matrix far cull distance
 *
@@ -71,6 +121,7 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_PALETTE "instancePalette" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCE_PALETTE
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
@@ -78,9 +129,12 @@
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL      "matNormal"         // normal matrix (transpose(inverse(matModelView)))
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES  "boneMatrices"   // bone matrices
+*       #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_PALETTE   "bonePalette"    // bone palette texture (instances bone matrices)
+*       #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_DUALQUATS "boneDualQuats"  // bone dual quaternions (2 vec4 per bone: rotation, translation)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1  "texture1"          // texture1 (texture slot active 1)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
+*       #define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA  "rlCamera"        // camera uniform block (bound to RL_DEFAULT_UNIFORM_BLOCK_BINDING_CAMERA)
 *
 *   DEPENDENCIES:
 *      - OpenGL libraries (depending on platform and OpenGL version selected)
@@ -197,6 +251,42 @@
     #define GRAPHICS_API_OPENGL_ES2
 #endif
 
+// GL state cache and GPU profiler are only used with programmable pipeline (OpenGL 3.3+, ES2)
+#if !defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_ES2)
+    #if defined(RLGL_ENABLE_STATE_CACHE)
+        #undef RLGL_ENABLE_STATE_CACHE
+    #endif
+    #if defined(RLGL_ENABLE_GPU_PROFILER)
+        #undef RLGL_ENABLE_GPU_PROFILER
+    #endif
+    #if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+        #undef RLGL_ENABLE_COMMAND_BUFFERS
+    #endif
+#endif
+
+// Thread local storage, required by command buffers recording and thread contexts
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS) || defined(RLGL_ENABLE_THREAD_CONTEXTS)
+    #if defined(_MSC_VER)
+        #define RL_THREAD_LOCAL __declspec(thread)
+    #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+        #define RL_THREAD_LOCAL _Thread_local
+    #else
+        #define RL_THREAD_LOCAL __thread
+    #endif
+#endif
+
+// Context state storage, thread local with thread contexts (one independent context per thread)
+#if defined(RLGL_ENABLE_THREAD_CONTEXTS)
+    #define RL_CONTEXT_LOCAL RL_THREAD_LOCAL
+#else
+    #define RL_CONTEXT_LOCAL
+#endif
+
+// Multi-texture batching stores the texture slot in the interleaved vertex padding
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH) && !defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+    #define RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS
+#endif
+
 // Support framebuffer objects by default
 // NOTE: Some driver implementation do not support it, despite they should
 #define RLGL_RENDER_TEXTURES_HINT
@@ -222,12 +312,18 @@
 #ifndef RL_DEFAULT_BATCH_BUFFERS
     #define RL_DEFAULT_BATCH_BUFFERS                 1      // Default number of batch buffers (multi-buffering)
 #endif
+#ifndef RL_DEFAULT_BATCH_PERSISTENT_BUFFERS
+    #define RL_DEFAULT_BATCH_PERSISTENT_BUFFERS      3      // Default number of batch buffers when using persistent mapping (ring buffering)
+#endif
 #ifndef RL_DEFAULT_BATCH_DRAWCALLS
     #define RL_DEFAULT_BATCH_DRAWCALLS             256      // Default number of batch draw calls (by state changes: mode, texture)
 #endif
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (rl_SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_DRAW_TEXTURES
+    #define RL_DEFAULT_BATCH_DRAW_TEXTURES           4      // Maximum number of textures referenced by a single draw call (RLGL_ENABLE_MULTITEXTURE_BATCH, minimum 2)
+#endif
 
 // Internal rl_Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -236,7 +332,39 @@
 
 // rl_Shader limits
 #ifndef RL_MAX_SHADER_LOCATIONS
-    #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
+    #define RL_MAX_SHADER_LOCATIONS                 40      // Maximum number of shader locations supported
+#endif
+
+// GL state cache limits
+#ifndef RL_MAX_STATE_CACHE_TEXTURE_UNITS
+    #define RL_MAX_STATE_CACHE_TEXTURE_UNITS        16      // Maximum number of texture units tracked by GL state cache
+#endif
+
+// Command buffers limits
+#ifndef RL_MAX_COMMAND_BUFFER_SUBMITS
+    #define RL_MAX_COMMAND_BUFFER_SUBMITS           64      // Maximum number of command buffers submitted per replay
+#endif
+
+// Async texture upload limits
+#ifndef RL_ASYNC_UPLOAD_BUFFER_SIZE
+    #define RL_ASYNC_UPLOAD_BUFFER_SIZE       16777216      // Async texture upload staging ring size in bytes (PBO, 16 MB)
+#endif
+#ifndef RL_MAX_ASYNC_UPLOADS
+    #define RL_MAX_ASYNC_UPLOADS                    64      // Maximum number of async texture uploads in flight
+#endif
+#ifndef RL_MAX_ASYNC_READBACKS
+    #define RL_MAX_ASYNC_READBACKS                   3      // Maximum number of async screen readbacks in flight (PBO)
+#endif
+#ifndef RL_MAX_ASYNC_SHADERS
+    #define RL_MAX_ASYNC_SHADERS                   256      // Maximum number of shader programs compiling asynchronously
+#endif
+
+// GPU profiler limits
+#ifndef RL_MAX_PROFILER_PASSES
+    #define RL_MAX_PROFILER_PASSES                  32      // Maximum number of GPU profiler passes per frame (including frame pass)
+#endif
+#ifndef RL_PROFILER_FRAME_LATENCY
+    #define RL_PROFILER_FRAME_LATENCY                3      // Number of frames GPU profiler queries are kept in flight before read back
 #endif
 
 // Projection matrix culling
@@ -250,6 +378,7 @@
 // rl_Texture parameters (equivalent to OpenGL defines)
 #define RL_TEXTURE_WRAP_S                       0x2802      // GL_TEXTURE_WRAP_S
 #define RL_TEXTURE_WRAP_T                       0x2803      // GL_TEXTURE_WRAP_T
+#define RL_TEXTURE_WRAP_R                       0x8072      // GL_TEXTURE_WRAP_R
 #define RL_TEXTURE_MAG_FILTER                   0x2800      // GL_TEXTURE_MAG_FILTER
 #define RL_TEXTURE_MIN_FILTER                   0x2801      // GL_TEXTURE_MIN_FILTER
 
@@ -267,6 +396,12 @@
 #define RL_TEXTURE_WRAP_MIRROR_REPEAT           0x8370      // GL_MIRRORED_REPEAT
 #define RL_TEXTURE_WRAP_MIRROR_CLAMP            0x8742      // GL_MIRROR_CLAMP_EXT
 
+// rl_Texture targets (equivalent to OpenGL defines)
+#define RL_TEXTURE_2D                           0x0DE1      // GL_TEXTURE_2D
+#define RL_TEXTURE_CUBE_MAP                     0x8513      // GL_TEXTURE_CUBE_MAP
+#define RL_TEXTURE_2D_ARRAY                     0x8C1A      // GL_TEXTURE_2D_ARRAY
+#define RL_TEXTURE_3D                           0x806F      // GL_TEXTURE_3D
+
 // rl_Matrix modes (equivalent to OpenGL)
 #define RL_MODELVIEW                            0x1700      // GL_MODELVIEW
 #define RL_PROJECTION                           0x1701      // GL_PROJECTION
@@ -278,8 +413,11 @@
 #define RL_QUADS                                0x0007      // GL_QUADS
 
 // GL equivalent data types
+#define RL_BYTE                                 0x1400      // GL_BYTE
 #define RL_UNSIGNED_BYTE                        0x1401      // GL_UNSIGNED_BYTE
+#define RL_UNSIGNED_SHORT                       0x1403      // GL_UNSIGNED_SHORT
 #define RL_FLOAT                                0x1406      // GL_FLOAT
+#define RL_HALF_FLOAT                           0x140B      // GL_HALF_FLOAT
 
 // GL buffer usage hint
 #define RL_STREAM_DRAW                          0x88E0      // GL_STREAM_DRAW
@@ -331,6 +469,7 @@
 
 #define RL_READ_FRAMEBUFFER                     0x8CA8      // GL_READ_FRAMEBUFFER
 #define RL_DRAW_FRAMEBUFFER                     0x8CA9      // GL_DRAW_FRAMEBUFFER
+#define RL_COLOR_BUFFER_BIT                     0x00004000  // GL_COLOR_BUFFER_BIT
 
 // Default shader vertex attribute locations
 #ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION
@@ -365,6 +504,14 @@
 #ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCE_TX
     #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCE_TX 9
 #endif
+#ifdef RL_SUPPORT_MESH_GPU_SKINNING
+#ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCE_PALETTE
+    #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCE_PALETTE 13   // NOTE: Locations 9..12 used by instances transform (mat4)
+#endif
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXINDEX
+    #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXINDEX    6     // NOTE: Shared with INDICES, that one is not a shader attribute
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -387,10 +534,19 @@ typedef struct rl_Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
+// Interleaved vertex data for render batch (32 bytes), used with RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS
+typedef struct rlBatchVertex {
+    float position[3];          // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
+    float texcoord[2];          // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
+    short normal[4];            // Vertex normal (XYZ - 3 normalized short components + 1 padding/texture slot) (shader-location = 2)
+    unsigned char color[4];     // Vertex colors (RGBA - 4 components per vertex) (shader-location = 3)
+} rlBatchVertex;
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
 
+    rlBatchVertex *data;        // Interleaved vertex data (only used with RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS) (shader-locations = 0, 1, 2, 3)
     float *vertices;            // Vertex position (XYZ - 3 components per vertex) (shader-location = 0)
     float *texcoords;           // Vertex texture coordinates (UV - 2 components per vertex) (shader-location = 1)
     float *normals;             // Vertex normal (XYZ - 3 components per vertex) (shader-location = 2)
@@ -403,6 +559,9 @@ typedef struct rlVertexBuffer {
 #endif
     unsigned int vaoId;         // OpenGL Vertex Array Object id
     unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
+
+    bool persistent;            // Vertex data arrays point to persistently mapped GPU memory
+    void *syncFence;            // GPU fence to check buffer is not in use anymore (GLsync, persistent mapping only)
 } rlVertexBuffer;
 
 // Draw call type
@@ -416,6 +575,11 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // rl_Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // rl_Texture id to be used on the draw -> Use to create new draw call if changes
+    int layer;                  // Draw layer, primary key for draw calls sorting (only used with batch sorting enabled)
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+    unsigned int textureIds[RL_DEFAULT_BATCH_DRAW_TEXTURES];    // Textures referenced by the draw, selected per-vertex by slot (textureIds[0] = textureId)
+    int textureCount;           // Number of textures referenced by the draw (0 means only textureId is used)
+#endif
 
     //rl_Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //rl_Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -432,6 +596,89 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// Command buffer, recorded rlgl calls to be replayed on GL context thread
+typedef struct rlCommandBuffer {
+    unsigned char *data;        // Recorded commands data (command header + parameters)
+    int size;                   // Recorded data size in bytes
+    int capacity;               // Allocated data size in bytes
+    int commandCount;           // Number of recorded commands
+} rlCommandBuffer;
+
+// Drawing list, render batch draws recorded into static vertex buffers, replayed as a whole
+typedef struct rlDrawingList {
+    int vertexCount;            // Number of vertices recorded (quads converted to triangles)
+    int drawCount;              // Number of draws recorded (primitive mode or texture changes)
+    unsigned int vaoId;         // OpenGL Vertex Array Object id
+    unsigned int vboId[4];      // OpenGL Vertex Buffer Objects id (position, texcoord, normal, color)
+    unsigned int *draws;        // Draws data, 4 values per draw: mode, first vertex, vertex count, texture id
+} rlDrawingList;
+
+// Render batch flush reasons (render stats)
+typedef enum {
+    RL_BATCH_FLUSH_EXPLICIT = 0,        // Render batch drawn on request (rlDrawRenderBatch(), rlDrawRenderBatchActive(), frame end)
+    RL_BATCH_FLUSH_BUFFER_LIMIT,        // Vertex buffer limit reached (rlCheckRenderBatchLimit())
+    RL_BATCH_FLUSH_DRAWCALL_LIMIT,      // Draw calls limit reached on primitive mode or layer change (RL_DEFAULT_BATCH_DRAWCALLS)
+    RL_BATCH_FLUSH_TEXTURE,             // Draw calls limit reached on texture change (rlSetTexture())
+    RL_BATCH_FLUSH_SHADER,              // Shader change (rlSetShader())
+    RL_BATCH_FLUSH_BLEND,               // Blend mode change (rlSetBlendMode())
+    RL_BATCH_FLUSH_RENDER_MODE,         // Matrix or render target change (2D/3D, texture and scissor modes)
+    RL_BATCH_FLUSH_REASON_COUNT         // Number of flush reasons
+} rlBatchFlushReason;
+
+// Render statistics, accumulated since last rlResetRenderStats() (reset every frame by rl_BeginDrawing())
+typedef struct rlRenderStats {
+    int drawCalls;              // Number of draw calls submitted to GPU (render batch and vertex arrays)
+    int vertices;               // Number of vertices submitted to GPU
+    int batchFlushes;           // Number of render batch draws with vertex data
+    int flushReasons[RL_BATCH_FLUSH_REASON_COUNT];  // Number of render batch draws by reason (rlBatchFlushReason)
+    int textureChanges;         // Number of render batch texture changes requiring a new draw call
+    int shaderChanges;          // Number of shader changes
+    int blendModeChanges;       // Number of blend mode changes
+    int culledMeshes;           // Number of meshes skipped by culling (frustum, occlusion)
+    int lodSavedTriangles;      // Number of triangles skipped by meshes levels of detail selection
+} rlRenderStats;
+
+// GPU profiler pass, measured between rlProfilerBeginPass() and rlProfilerEndPass()
+typedef struct rlProfilerPass {
+    char name[32];              // Pass name
+    int depth;                  // Pass nesting depth (0 for frame pass)
+    float gpuTime;              // GPU time in milliseconds (0.0f if timer queries not supported)
+    int drawCalls;              // Number of draw calls submitted to GPU
+    int vertices;               // Number of vertices submitted to GPU
+    int batchFlushes;           // Number of render batch draws (rlDrawRenderBatch() with vertex data)
+} rlProfilerPass;
+
+// GPU memory resource types (GPU memory stats)
+typedef enum {
+    RL_GPU_MEMORY_TEXTURE = 0,          // Textures: 2d, cubemap, array and 3d textures (mipmaps included)
+    RL_GPU_MEMORY_RENDER_TARGET,        // Render targets: depth textures and renderbuffers, G-buffer attachments
+    RL_GPU_MEMORY_VERTEX_BUFFER,        // Vertex buffers: meshes, render batch and drawing lists
+    RL_GPU_MEMORY_INDEX_BUFFER,         // Index buffers: meshes and render batch
+    RL_GPU_MEMORY_SHADER_BUFFER,        // Shader storage and uniform buffers
+    RL_GPU_MEMORY_TYPE_COUNT            // Number of GPU memory resource types
+} rlGpuMemoryType;
+
+// GPU memory stats, estimated from resources size and format (driver padding and alignment not included)
+typedef struct rlGpuMemoryStats {
+    long long liveBytes;        // GPU memory currently used (in bytes)
+    long long peakBytes;        // Maximum GPU memory used at the same time (in bytes)
+    int liveCount;              // Resources currently loaded
+    unsigned int totalCount;    // Resources loaded since rlgl initialization
+} rlGpuMemoryStats;
+
+// G-buffer, deferred rendering geometry buffer (compact formats, position reconstructed from depth)
+typedef struct rlGBuffer {
+    unsigned int id;            // Framebuffer id
+    unsigned int albedo;        // Albedo (rgb) and specular strength (a) texture id, RGBA8 (color attachment 0)
+    unsigned int normal;        // World normal octahedral encoded (rg) texture id, RGB10_A2 (color attachment 1)
+    unsigned int depth;         // Depth texture id, DEPTH_COMPONENT24
+    int width;                  // G-buffer width
+    int height;                 // G-buffer height
+} rlGBuffer;
+
+// Async readback callback, pixel data (RGBA, top-left origin) is only valid during callback
+typedef void (*rlReadbackCallback)(unsigned char *data, int width, int height, void *userData);
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11_SOFTWARE = 0,  // Software rendering
@@ -482,7 +729,9 @@ typedef enum {
     RL_PIXELFORMAT_COMPRESSED_PVRT_RGB,            // 4 bpp
     RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA,           // 4 bpp
     RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA,       // 8 bpp
-    RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA        // 2 bpp
+    RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA,       // 2 bpp
+    RL_PIXELFORMAT_COMPRESSED_BC7_RGBA,            // 8 bpp
+    RL_PIXELFORMAT_COMPRESSED_BC4_R                // 4 bpp
 } rlPixelFormat;
 
 // rl_Texture parameters: filter mode
@@ -631,6 +880,8 @@ rl_RLAPI void rlEnd(void);                                 // Finish vertex prov
 rl_RLAPI void rlVertex2i(int x, int y);                    // Define one vertex (position) - 2 int
 rl_RLAPI void rlVertex2f(float x, float y);                // Define one vertex (position) - 2 float
 rl_RLAPI void rlVertex3f(float x, float y, float z);       // Define one vertex (position) - 3 float
+rl_RLAPI void rlVertices2f(const float *vertices, int count); // Define multiple vertices (position) - 2 float per vertex
+rl_RLAPI void rlVertices3f(const float *vertices, int count); // Define multiple vertices (position) - 3 float per vertex
 rl_RLAPI void rlTexCoord2f(float x, float y);              // Define one vertex (texture coordinate) - 2 float
 rl_RLAPI void rlNormal3f(float x, float y, float z);       // Define one vertex (normal) - 3 float
 rl_RLAPI void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Define one vertex (color) - 4 byte
@@ -661,8 +912,15 @@ rl_RLAPI void rlEnableTexture(unsigned int id);            // Enable texture
 rl_RLAPI void rlDisableTexture(void);                      // Disable texture
 rl_RLAPI void rlEnableTextureCubemap(unsigned int id);     // Enable texture cubemap
 rl_RLAPI void rlDisableTextureCubemap(void);               // Disable texture cubemap
+rl_RLAPI void rlEnableTextureArray(unsigned int id);       // Enable texture array
+rl_RLAPI void rlDisableTextureArray(void);                 // Disable texture array
+rl_RLAPI void rlEnableTexture3D(unsigned int id);          // Enable 3D texture
+rl_RLAPI void rlDisableTexture3D(void);                    // Disable 3D texture
 rl_RLAPI void rlTextureParameters(unsigned int id, int param, int value); // Set texture parameters (filter, wrap)
+rl_RLAPI bool rlTextureSwizzleAlpha(unsigned int id);      // Set single channel texture swizzle, red channel sampled as alpha of white color (1, 1, 1, r)
 rl_RLAPI void rlCubemapParameters(unsigned int id, int param, int value); // Set cubemap parameters (filter, wrap)
+rl_RLAPI void rlTextureArrayParameters(unsigned int id, int param, int value); // Set texture array parameters (filter, wrap)
+rl_RLAPI void rlTexture3DParameters(unsigned int id, int param, int value); // Set 3D texture parameters (filter, wrap)
 
 // rl_Shader state
 rl_RLAPI void rlEnableShader(unsigned int id);             // Enable shader program
@@ -672,7 +930,7 @@ rl_RLAPI void rlDisableShader(void);                       // Disable shader pro
 rl_RLAPI void rlEnableFramebuffer(unsigned int id);        // Enable render texture (fbo)
 rl_RLAPI void rlDisableFramebuffer(void);                  // Disable render texture (fbo), return to default framebuffer
 rl_RLAPI unsigned int rlGetActiveFramebuffer(void);        // Get the currently active render texture (fbo), 0 for default framebuffer
-rl_RLAPI void rlActiveDrawBuffers(int count);              // Activate multiple draw color buffers
+rl_RLAPI void rlActiveDrawBuffers(int count);              // Activate multiple draw color buffers (0: no color buffer, depth only rendering)
 rl_RLAPI void rlBlitFramebuffer(int srcX, int srcY, int srcWidth, int srcHeight, int dstX, int dstY, int dstWidth, int dstHeight, int bufferMask); // Blit active framebuffer to main framebuffer
 rl_RLAPI void rlBindFramebuffer(unsigned int target, unsigned int framebuffer); // Bind framebuffer (FBO)
 
@@ -690,6 +948,9 @@ rl_RLAPI void rlSetCullFace(int mode);                     // Set face culling m
 rl_RLAPI void rlEnableScissorTest(void);                   // Enable scissor test
 rl_RLAPI void rlDisableScissorTest(void);                  // Disable scissor test
 rl_RLAPI void rlScissor(int x, int y, int width, int height); // Scissor test
+rl_RLAPI void rlResetStateCache(void);                     // Reset GL state cache, required after modifying GL state outside rlgl (RLGL_ENABLE_STATE_CACHE)
+rl_RLAPI unsigned int rlGetStateCacheElidedCalls(void);    // Get number of redundant GL calls skipped by GL state cache
+rl_RLAPI void rlResetStateCacheElidedCalls(void);          // Reset counter of redundant GL calls skipped by GL state cache
 rl_RLAPI void rlEnablePointMode(void);                     // Enable point mode
 rl_RLAPI void rlDisablePointMode(void);                    // Disable point mode
 rl_RLAPI void rlSetPointSize(float size);                  // Set the point drawing size
@@ -720,6 +981,7 @@ rl_RLAPI void rlglClose(void);                             // De-initialize rlgl
 rl_RLAPI void rlLoadExtensions(void *loader);              // Load OpenGL extensions (loader function required)
 rl_RLAPI void *rlGetProcAddress(const char *procName);     // Get OpenGL procedure address
 rl_RLAPI int rlGetVersion(void);                           // Get current OpenGL version
+rl_RLAPI const char *rlGetDriverInfo(void);                // Get OpenGL driver info string (vendor, renderer, version)
 rl_RLAPI void rlSetFramebufferWidth(int width);            // Set current framebuffer width
 rl_RLAPI int rlGetFramebufferWidth(void);                  // Get default framebuffer width
 rl_RLAPI void rlSetFramebufferHeight(int height);          // Set current framebuffer height
@@ -738,9 +1000,63 @@ rl_RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch
 rl_RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
 rl_RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
 rl_RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
+rl_RLAPI void rlFlushRenderBatch(int reason);              // Update and draw internal render batch, recording flush reason on render stats (rlBatchFlushReason)
 
 rl_RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
+// Render batch draw calls sorting
+// NOTE: When enabled, draw calls are reordered by layer, texture and mode on batch drawing and
+// draws sharing state are merged, drawing order is only preserved between different layers
+rl_RLAPI void rlEnableBatchSorting(void);                  // Enable render batch draw calls sorting (order-independent draws)
+rl_RLAPI void rlDisableBatchSorting(void);                 // Disable render batch draw calls sorting
+rl_RLAPI bool rlIsBatchSortingEnabled(void);               // Check if render batch draw calls sorting is enabled
+rl_RLAPI void rlSetBatchLayer(int layer);                  // Set layer for next draws, lower layers are drawn first (sorting key)
+
+// Drawing lists management
+// NOTE: Render batch vertex data is recorded instead of drawn and stored in GPU memory, state changes
+// (shader, blending, render target) and vertex arrays drawing (meshes) are not recorded
+rl_RLAPI void rlBeginDrawingList(void);                    // Begin recording render batch draws into a drawing list
+rl_RLAPI rlDrawingList rlEndDrawingList(void);             // End recording render batch draws, returns drawing list loaded in GPU
+rl_RLAPI bool rlIsDrawingListRecording(void);              // Check if drawing list recording is active
+rl_RLAPI void rlDrawDrawingList(rlDrawingList list, rl_Matrix transform); // Draw drawing list with a transform, using current shader and matrices
+rl_RLAPI void rlUnloadDrawingList(rlDrawingList list);     // Unload drawing list from GPU memory (VRAM)
+
+// Command buffers management (RLGL_ENABLE_COMMAND_BUFFERS)
+// NOTE: Recording only uses CPU memory, so buffers can be recorded from any thread (one buffer per thread at a time);
+// recorded: rlBegin(), rlEnd(), rlVertex*(), rlTexCoord2f(), rlNormal3f(), rlColor*(), rlSetTexture(), matrix operations,
+// rlSetShader(), rlSetBlendMode(), render batch flushes, framebuffer/viewport/scissor/depth test setup, buffers clear,
+// camera block update, command buffers submission and user callbacks, other rlgl calls must be done on GL thread
+rl_RLAPI rlCommandBuffer rlLoadCommandBuffer(int capacity); // Load command buffer with initial capacity in bytes (grows as required)
+rl_RLAPI void rlUnloadCommandBuffer(rlCommandBuffer buffer); // Unload command buffer
+rl_RLAPI void rlResetCommandBuffer(rlCommandBuffer *buffer); // Reset command buffer recorded commands (memory is kept)
+rl_RLAPI void rlBeginCommandRecording(rlCommandBuffer *buffer); // Begin recording rlgl calls of calling thread into command buffer
+rl_RLAPI void rlEndCommandRecording(void);                 // End recording rlgl calls of calling thread
+rl_RLAPI void rlRecordCallback(void (*callback)(void *userData), void *userData); // Record a user callback, called on replay (GL thread), i.e. meshes drawing
+rl_RLAPI void rlSubmitCommandBuffer(rlCommandBuffer *buffer); // Submit command buffer for replay, buffer must be kept until replayed (GL thread only)
+rl_RLAPI void rlExecuteCommandBuffers(void);               // Replay submitted command buffers in submission order (GL thread only, called by rl_EndDrawing())
+rl_RLAPI void rlReplayCommandBuffer(const rlCommandBuffer *buffer); // Replay command buffer recorded commands (GL thread only)
+
+// Render statistics
+rl_RLAPI rlRenderStats rlGetRenderStats(void);             // Get render statistics (draw calls, vertices, batch flushes by reason, state changes, culled meshes, LOD saved triangles)
+rl_RLAPI void rlResetRenderStats(void);                    // Reset render statistics
+rl_RLAPI void rlAddCulledMeshes(int count);                // Add meshes skipped by culling to render statistics
+rl_RLAPI void rlAddLodSavedTriangles(int count);           // Add triangles skipped by levels of detail selection to render statistics
+
+// GPU memory stats
+// NOTE: Resources loaded through rlgl are tracked (textures, render targets, vertex/index/shader buffers),
+// with RLGL_ENABLE_THREAD_CONTEXTS every context tracks the resources loaded on it
+rl_RLAPI rlGpuMemoryStats rlGetGpuMemoryStats(int type);   // Get GPU memory stats by resource type (rlGpuMemoryType), use -1 to accumulate all types
+
+// GPU profiler (RLGL_ENABLE_GPU_PROFILER)
+// NOTE: Passes can be nested, render batch is drawn on pass begin/end so measures are not mixed,
+// results are available for the last frame with all GPU queries resolved (some frames behind)
+rl_RLAPI void rlProfilerBeginFrame(void);                  // Begin GPU profiler frame, opens frame pass (called by rl_BeginDrawing())
+rl_RLAPI void rlProfilerEndFrame(void);                    // End GPU profiler frame, closes frame pass and reads back available results (called by rl_EndDrawing())
+rl_RLAPI void rlProfilerBeginPass(const char *name);       // Begin named GPU profiler pass
+rl_RLAPI void rlProfilerEndPass(void);                     // End current GPU profiler pass
+rl_RLAPI int rlGetProfilerPassCount(void);                 // Get number of passes measured on last resolved frame
+rl_RLAPI rlProfilerPass rlGetProfilerPass(int index);      // Get pass measures of last resolved frame (index 0 is whole frame)
+
 //------------------------------------------------------------------------------------------------------------------------
 
 // Vertex buffers management
@@ -749,6 +1065,7 @@ rl_RLAPI unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dyna
 rl_RLAPI unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic); // Load vertex buffer elements object
 rl_RLAPI void rlUpdateVertexBuffer(unsigned int bufferId, const void *data, int dataSize, int offset); // Update vertex buffer object data on GPU buffer
 rl_RLAPI void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset); // Update vertex buffer elements data on GPU buffer
+rl_RLAPI void rlCopyVertexBuffer(unsigned int destId, unsigned int srcId, int destOffset, int srcOffset, int dataSize); // Copy vertex buffer data on GPU, no CPU synchronization required
 rl_RLAPI void rlUnloadVertexArray(unsigned int vaoId);     // Unload vertex array (vao)
 rl_RLAPI void rlUnloadVertexBuffer(unsigned int vboId);    // Unload vertex buffer object
 rl_RLAPI void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, int offset); // Set vertex attribute data configuration
@@ -756,46 +1073,79 @@ rl_RLAPI void rlSetVertexAttributeDivisor(unsigned int index, int divisor); // S
 rl_RLAPI void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType, int count); // Set vertex attribute default value, when attribute to provided
 rl_RLAPI void rlDrawVertexArray(int offset, int count);    // Draw vertex array (currently active vao)
 rl_RLAPI void rlDrawVertexArrayElements(int offset, int count, const void *buffer); // Draw vertex array elements
+rl_RLAPI bool rlIsInstancingSupported(void);                // Check if instanced drawing is supported
 rl_RLAPI void rlDrawVertexArrayInstanced(int offset, int count, int instances); // Draw vertex array (currently active vao) with instancing
 rl_RLAPI void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffer, int instances); // Draw vertex array elements with instancing
+rl_RLAPI void rlDrawVertexArrayIndirect(unsigned int bufferId, int offset, int drawCount); // Draw vertex array with draw commands read from GPU buffer (offset in bytes)
+rl_RLAPI void rlDrawVertexArrayElementsIndirect(unsigned int bufferId, int offset, int drawCount); // Draw vertex array elements with draw commands read from GPU buffer (offset in bytes)
 
 // Textures management
 rl_RLAPI unsigned int rlLoadTexture(const void *data, int width, int height, int format, int mipmapCount); // Load texture data
 rl_RLAPI unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer); // Load depth texture/renderbuffer (to be attached to fbo)
+rl_RLAPI unsigned int rlLoadTextureDepthArray(int width, int height, int layers); // Load depth texture array, layers attached to fbo and sampled with depth comparison (shadow maps)
 rl_RLAPI unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mipmapCount); // Load texture cubemap data
+rl_RLAPI unsigned int rlLoadTextureArray(const void *data, int width, int height, int layers, int format, int mipmapCount); // Load texture array data (layers of same size and format)
+rl_RLAPI unsigned int rlLoadTexture3D(const void *data, int width, int height, int depth, int format, int mipmapCount); // Load 3D texture data
 rl_RLAPI void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update texture with new data on GPU
+rl_RLAPI void rlUpdateTextureMipmaps(unsigned int id, int width, int height, int format, const void *data, int mipmapCount); // Update texture with new mipmap levels data on GPU (base level included)
+rl_RLAPI void rlUpdateTextureArray(unsigned int id, int layer, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update texture array layer with new data on GPU
+rl_RLAPI void rlUpdateTexture3D(unsigned int id, int offsetX, int offsetY, int offsetZ, int width, int height, int depth, int format, const void *data); // Update 3D texture with new data on GPU
+rl_RLAPI unsigned int rlLoadTextureAsync(const void *data, int width, int height, int format, int mipmapCount); // Load texture data asynchronously (PBO staging, data can be freed on return)
+rl_RLAPI void rlUpdateTextureAsync(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data); // Update texture asynchronously (PBO staging, data can be freed on return)
+rl_RLAPI bool rlIsTextureUploadReady(unsigned int id);                       // Check if texture async uploads have completed on GPU
+rl_RLAPI void rlSyncTextureUploads(void);                                    // Wait for all async texture uploads to complete
 rl_RLAPI void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType); // Get OpenGL internal formats
 rl_RLAPI const char *rlGetPixelFormatName(unsigned int format);              // Get name string for pixel format
 rl_RLAPI void rlUnloadTexture(unsigned int id);                              // Unload texture from GPU memory
 rl_RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 rl_RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format); // Read texture pixel data
 rl_RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+rl_RLAPI void rlReadScreenPixelsAsync(int width, int height, rlReadbackCallback callback, void *userData); // Read screen pixel data asynchronously, callback is called when data is available
+rl_RLAPI void rlReadDepthPixelsAsync(int width, int height, rlReadbackCallback callback, void *userData); // Read depth buffer data asynchronously (float per pixel, bottom-left origin), callback is called when data is available
+rl_RLAPI void rlUpdateReadbacks(bool wait);                                 // Deliver completed async readbacks (called by rl_EndDrawing()), wait for all if requested
 
 // Framebuffer management (fbo)
 rl_RLAPI unsigned int rlLoadFramebuffer(void);                               // Load an empty framebuffer
 rl_RLAPI void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel); // Attach texture/renderbuffer to a framebuffer
+rl_RLAPI void rlFramebufferAttachLayer(unsigned int fboId, unsigned int texId, int attachType, int layer, int mipLevel); // Attach texture array layer to a framebuffer
 rl_RLAPI bool rlFramebufferComplete(unsigned int id);                        // Verify framebuffer is complete
 rl_RLAPI void rlUnloadFramebuffer(unsigned int id);                          // Delete framebuffer from GPU
+rl_RLAPI rlGBuffer rlLoadGBuffer(int width, int height);                      // Load G-buffer framebuffer: albedo-specular, octahedral normals and depth textures
+rl_RLAPI void rlUnloadGBuffer(rlGBuffer gbuffer);                             // Unload G-buffer framebuffer and textures from GPU
+rl_RLAPI void rlInvalidateFramebuffer(bool color, bool depth);               // Invalidate current framebuffer attachments contents, not required anymore (tile-based GPUs skip load/store)
 // WARNING: Copy and resize framebuffer functionality only defined for software backend
 rl_RLAPI void rlCopyFramebuffer(int x, int y, int width, int height, int format, void *pixels); // Copy framebuffer pixel data to internal buffer
 rl_RLAPI void rlResizeFramebuffer(int width, int height);                    // Resize internal framebuffer
+rl_RLAPI bool rlSetFramebufferMemory(void *pixels, int pitch);               // Set memory to render framebuffer color into (native format, pitch in bytes), NULL for internal buffer
+rl_RLAPI void rlCopyFramebufferRegion(int x, int y, int width, int height, int format, void *pixels, int pitch); // Copy framebuffer region pixel data at the same position of pixels (pitch in bytes)
+rl_RLAPI bool rlGetFramebufferDirtyRegion(int *x, int *y, int *width, int *height, bool reset); // Get framebuffer region modified since last reset, false if unmodified
 
 // Shaders management
 rl_RLAPI unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode);    // Load shader from code strings
+rl_RLAPI unsigned int rlLoadShaderCodeAsync(const char *vsCode, const char *fsCode); // Load shader from code strings, compile and link run in background (GL_KHR_parallel_shader_compile)
+rl_RLAPI bool rlIsShaderProgramPending(unsigned int id);                           // Check if shader program was loaded async and not completed yet
+rl_RLAPI bool rlIsShaderProgramReady(unsigned int id);                             // Check if shader program compile and link has finished (non-blocking)
+rl_RLAPI unsigned int rlCompleteShaderProgram(unsigned int id);                    // Complete async shader program (blocks if not ready), returns default shader id on failure
 rl_RLAPI unsigned int rlCompileShader(const char *shaderCode, int type);           // Compile custom shader and return shader id (type: RL_VERTEX_SHADER, RL_FRAGMENT_SHADER, RL_COMPUTE_SHADER)
 rl_RLAPI unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId); // Load custom shader program
 rl_RLAPI void rlUnloadShaderProgram(unsigned int id);                              // Unload shader program
+rl_RLAPI bool rlReloadShaderProgram(unsigned int id, const char *vsCode, const char *fsCode); // Reload shader program code, program id is kept (not modified if code fails to build)
+rl_RLAPI bool rlIsShaderProgramBinarySupported(void);                              // Check if shader program binaries are supported (load/retrieve)
+rl_RLAPI unsigned char *rlGetShaderProgramBinary(unsigned int id, int *size, int *format); // Get shader program binary data, must be freed (RL_FREE)
+rl_RLAPI unsigned int rlLoadShaderProgramBinary(const unsigned char *data, int size, int format); // Load shader program from binary data, returns 0 if rejected by driver
 rl_RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName); // Get shader location uniform, requires shader program id
 rl_RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute, requires shader program id
 rl_RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count); // Set shader value uniform
 rl_RLAPI void rlSetUniformMatrix(int locIndex, rl_Matrix mat);                        // Set shader value matrix
 rl_RLAPI void rlSetUniformMatrices(int locIndex, const rl_Matrix *mat, int count);    // Set shader value matrices
 rl_RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
+rl_RLAPI void rlSetUniformSamplerEx(int locIndex, unsigned int textureId, int target); // Set shader value sampler for texture target (RL_TEXTURE_2D, RL_TEXTURE_2D_ARRAY...)
 rl_RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
 
 // Compute shader management
 rl_RLAPI unsigned int rlLoadComputeShaderProgram(unsigned int shaderId);           // Load compute shader program
 rl_RLAPI void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned int groupZ); // Dispatch compute shader (equivalent to *draw* for graphics pipeline)
+rl_RLAPI void rlComputeShaderBarrier(void);                                         // Wait for compute shader buffers writes to be visible for following draws and dispatches
 
 // rl_Shader buffer storage object management (ssbo)
 rl_RLAPI unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint); // Load shader storage buffer object (SSBO)
@@ -806,6 +1156,14 @@ rl_RLAPI void rlReadShaderBuffer(unsigned int id, void *dest, unsigned int count
 rl_RLAPI void rlCopyShaderBuffer(unsigned int destId, unsigned int srcId, unsigned int destOffset, unsigned int srcOffset, unsigned int count); // Copy SSBO data between buffers
 rl_RLAPI unsigned int rlGetShaderBufferSize(unsigned int id);                      // Get SSBO buffer size
 
+// Uniform buffer object management (ubo, std140 layout)
+rl_RLAPI unsigned int rlLoadUniformBuffer(unsigned int size, const void *data, int usageHint); // Load uniform buffer object (UBO)
+rl_RLAPI void rlUnloadUniformBuffer(unsigned int uboId);                           // Unload uniform buffer object (UBO)
+rl_RLAPI void rlUpdateUniformBuffer(unsigned int id, const void *data, unsigned int dataSize, unsigned int offset); // Update UBO buffer data
+rl_RLAPI void rlBindUniformBuffer(unsigned int id, unsigned int index);            // Bind UBO buffer to uniform block binding point
+rl_RLAPI bool rlBindUniformBlock(unsigned int shaderId, const char *blockName, unsigned int index); // Bind shader uniform block to binding point
+rl_RLAPI void rlUpdateCameraBlock(void);                                            // Update default camera uniform block with current modelview and projection matrices
+
 // Buffer management
 rl_RLAPI void rlBindImageTexture(unsigned int id, unsigned int index, int format, bool readonly);  // Bind image texture
 
@@ -851,6 +1209,72 @@ rl_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
         #define SW_REALLOC(ptr, newSz) RL_REALLOC(ptr, newSz)
         #define SW_FREE(ptr) RL_FREE(ptr)
         #include "external/rlsw.h"          // OpenGL 1.1 software implementation
+
+        // Software render batch must be drawn before any rlsw state change,
+        // vertex data provided by rlVertex3f() is accumulated and drawn in bulk (swDrawArrays)
+        // NOTE: Texture enable/bind is applied lazily by rlDrawSoftwareBatch(), so it is not batch-breaking
+        #undef glReadPixels
+        #undef glFinish
+        #undef glEnable
+        #undef glDisable
+        #undef glViewport
+        #undef glScissor
+        #undef glClear
+        #undef glBlendFunc
+        #undef glPolygonMode
+        #undef glCullFace
+        #undef glPointSize
+        #undef glLineWidth
+        #undef glPopMatrix
+        #undef glLoadIdentity
+        #undef glTranslatef
+        #undef glRotatef
+        #undef glScalef
+        #undef glMultMatrixf
+        #undef glFrustum
+        #undef glOrtho
+        #undef glDisableClientState
+        #undef glVertexPointer
+        #undef glTexCoordPointer
+        #undef glColorPointer
+        #undef glDrawArrays
+        #undef glDrawElements
+        #undef glDeleteTextures
+        #undef glTexImage2D
+        #undef glGenerateMipmap
+        #undef glTexParameteri
+        #undef glBindTexture
+        #define glReadPixels(x, y, w, h, f, t, p)           (rlDrawSoftwareBatch(), swCopyFramebuffer((x), (y), (w), (h), (f), (t), (p)))
+        #define glFinish()                                  (rlDrawSoftwareBatch(), swFinish())
+        #define glEnable(state)                             (rlDrawSoftwareBatch(), swEnable((state)))
+        #define glDisable(state)                            (rlDrawSoftwareBatch(), swDisable((state)))
+        #define glViewport(x, y, w, h)                      (rlDrawSoftwareBatch(), swViewport((x), (y), (w), (h)))
+        #define glScissor(x, y, w, h)                       (rlDrawSoftwareBatch(), swScissor((x), (y), (w), (h)))
+        #define glClear(bitmask)                            (rlDrawSoftwareBatch(), swClear((bitmask)))
+        #define glBlendFunc(sfactor, dfactor)               (rlDrawSoftwareBatch(), swBlendFunc((sfactor), (dfactor)))
+        #define glPolygonMode(face, mode)                   (rlDrawSoftwareBatch(), swPolygonMode((mode)))
+        #define glCullFace(face)                            (rlDrawSoftwareBatch(), swCullFace((face)))
+        #define glPointSize(size)                           (rlDrawSoftwareBatch(), swPointSize((size)))
+        #define glLineWidth(width)                          (rlDrawSoftwareBatch(), swLineWidth((width)))
+        #define glPopMatrix()                               (rlDrawSoftwareBatch(), swPopMatrix())
+        #define glLoadIdentity()                            (rlDrawSoftwareBatch(), swLoadIdentity())
+        #define glTranslatef(x, y, z)                       (rlDrawSoftwareBatch(), swTranslatef((x), (y), (z)))
+        #define glRotatef(a, x, y, z)                       (rlDrawSoftwareBatch(), swRotatef((a), (x), (y), (z)))
+        #define glScalef(x, y, z)                           (rlDrawSoftwareBatch(), swScalef((x), (y), (z)))
+        #define glMultMatrixf(v)                            (rlDrawSoftwareBatch(), swMultMatrixf((v)))
+        #define glFrustum(l, r, b, t, n, f)                 (rlDrawSoftwareBatch(), swFrustum((l), (r), (b), (t), (n), (f)))
+        #define glOrtho(l, r, b, t, n, f)                   (rlDrawSoftwareBatch(), swOrtho((l), (r), (b), (t), (n), (f)))
+        #define glDisableClientState(t)                     (rlDrawSoftwareBatch(), swBindArray((t), 0))
+        #define glVertexPointer(sz, t, s, p)                (rlDrawSoftwareBatch(), swBindArray(SW_VERTEX_ARRAY, (p)))
+        #define glTexCoordPointer(sz, t, s, p)              (rlDrawSoftwareBatch(), swBindArray(SW_TEXTURE_COORD_ARRAY, (p)))
+        #define glColorPointer(sz, t, s, p)                 (rlDrawSoftwareBatch(), swBindArray(SW_COLOR_ARRAY, (p)))
+        #define glDrawArrays(m, o, c)                       (rlDrawSoftwareBatch(), swDrawArrays((m), (o), (c)))
+        #define glDrawElements(m, c, t, i)                  (rlDrawSoftwareBatch(), swDrawElements((m), (c), (t), (i)))
+        #define glDeleteTextures(c, v)                      (rlDrawSoftwareBatch(), swDeleteTextures((c), (v)))
+        #define glTexImage2D(tr, l, if, w, h, b, f, t, p)   (rlDrawSoftwareBatch(), swTexImage2DLevel((l), (w), (h), (f), (t), (p)))
+        #define glGenerateMipmap(tr)                        (rlDrawSoftwareBatch(), swGenerateMipmap())
+        #define glTexParameteri(tr, pname, param)           (rlDrawSoftwareBatch(), swTexParameteri((pname), (param)))
+        #define glBindTexture(tr, id)                       rlBindSoftwareTexture((id))
     #else
         #if defined(__APPLE__)
             #include <OpenGL/gl.h>          // OpenGL 1.1 library for OSX
@@ -911,8 +1335,12 @@ rl_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #endif
 
 #include <stdlib.h>                     // Required for: calloc(), free()
-#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
+#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading], memset()
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
+#include <stddef.h>                     // Required for: offsetof() [Used in rlSetBatchVertexAttributes()]
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+    #include <stdio.h>                  // Required for: snprintf() [Used in rlLoadShaderDefault()]
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -927,6 +1355,14 @@ rl_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define rl_RAD2DEG (180.0f/rl_PI)
 #endif
 
+// CPU profiler zones, render batch flushes are measured if defined before library inclusion
+#ifndef RL_PROFILE_ZONE_BEGIN
+    #define RL_PROFILE_ZONE_BEGIN(name)     (void)0
+#endif
+#ifndef RL_PROFILE_ZONE_END
+    #define RL_PROFILE_ZONE_END()           (void)0
+#endif
+
 #ifndef GL_SHADING_LANGUAGE_VERSION
     #define GL_SHADING_LANGUAGE_VERSION         0x8B8C
 #endif
@@ -964,6 +1400,12 @@ rl_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef GL_COMPRESSED_RGBA_ASTC_8x8_KHR
     #define GL_COMPRESSED_RGBA_ASTC_8x8_KHR     0x93b7
 #endif
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+    #define GL_COMPRESSED_RGBA_BPTC_UNORM       0x8E8C
+#endif
+#ifndef GL_COMPRESSED_RED_RGTC1
+    #define GL_COMPRESSED_RED_RGTC1             0x8DBB
+#endif
 
 #ifndef GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT
     #define GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT   0x84FF
@@ -1027,6 +1469,12 @@ rl_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX  "instanceTransform" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_PALETTE
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_PALETTE "instancePalette" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCE_PALETTE
+#endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX     "vertexTexIndex"    // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXINDEX (RLGL_ENABLE_MULTITEXTURE_BATCH)
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -1049,6 +1497,12 @@ rl_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES  "boneMatrices"   // bone matrices
 #endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_PALETTE
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_PALETTE   "bonePalette"    // bone palette texture (instances bone matrices)
+#endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_DUALQUATS
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_DUALQUATS "boneDualQuats"  // bone dual quaternions (2 vec4 per bone: rotation, translation)
+#endif
 #ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 #endif
@@ -1059,6 +1513,15 @@ rl_RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
 #endif
 
+// Default camera uniform block, std140 layout:
+// layout(std140) uniform rlCamera { mat4 cameraView; mat4 cameraProjection; mat4 cameraViewProjection; };
+#ifndef RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA
+    #define RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA  "rlCamera"        // camera uniform block (view, projection and view-projection matrices)
+#endif
+#ifndef RL_DEFAULT_UNIFORM_BLOCK_BINDING_CAMERA
+    #define RL_DEFAULT_UNIFORM_BLOCK_BINDING_CAMERA   0     // Default camera uniform block binding point
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Types and Structures Definition
 //----------------------------------------------------------------------------------
@@ -1076,6 +1539,9 @@ typedef struct rlglData {
         int vertexCounter;                  // Current active render batch vertex counter (generic, used for all batches)
         float texcoordx, texcoordy;         // Current active texture coordinate (added on glVertex*())
         float normalx, normaly, normalz;    // Current active normal (added on glVertex*())
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+        short normalPacked[3];              // Current active normal, packed to normalized short (added on glVertex*())
+#endif
         unsigned char colorr, colorg, colorb, colora;   // Current active color (added on glVertex*())
 
         int currentMatrixMode;              // Current matrix mode
@@ -1088,8 +1554,12 @@ typedef struct rlglData {
         int stackCounter;                   // rl_Matrix stack counter
 
         unsigned int currentTextureId;      // Current texture id to be used on glBegin
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+        int currentTextureSlot;             // Current texture slot in current draw call (added on glVertex*())
+#endif
         unsigned int defaultTextureId;      // Default texture used on shapes/poly drawing (required by shader)
         unsigned int activeTextureId[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS];    // Active texture ids to be enabled on batch drawing (0 active by default)
+        int activeTextureTarget[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS]; // Active textures targets (GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY...)
         unsigned int defaultVShaderId;      // Default vertex shader id (used by default shader program)
         unsigned int defaultFShaderId;      // Default fragment shader id (used by default shader program)
         unsigned int defaultShaderId;       // Default shader program id, supports vertex color and diffuse texture
@@ -1117,6 +1587,23 @@ typedef struct rlglData {
         int framebufferWidth;               // Current framebuffer width
         int framebufferHeight;              // Current framebuffer height
 
+        int flushReason;                    // Reason recorded for next render batch draw (rlBatchFlushReason)
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+        rlCommandBuffer *submittedBuffers[RL_MAX_COMMAND_BUFFER_SUBMITS];  // Command buffers submitted for replay
+        int submittedBufferCount;           // Number of command buffers submitted for replay
+#endif
+        bool batchSorting;                  // Render batch draw calls sorting enabled
+        int currentLayer;                   // Current draw layer for render batch sorting
+        unsigned int cameraBlockId;         // Default camera uniform block buffer id (UBO, shared by all shaders)
+        void *sortBuffer;                   // Scratch buffer to reorder vertex data on batch sorting
+        struct {
+            unsigned int programId;         // Shader program id
+            unsigned int vShaderId;         // Vertex shader id
+            unsigned int fShaderId;         // Fragment shader id
+        } pendingPrograms[RL_MAX_ASYNC_SHADERS];    // Shader programs compiling asynchronously
+        int pendingProgramCount;            // Number of shader programs compiling asynchronously
+        int sortBufferSize;                 // Scratch buffer size in bytes
+
     } State;            // Renderer state
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
@@ -1131,29 +1618,215 @@ typedef struct rlglData {
         bool texCompETC2;                   // ETC2/EAC texture compression support (GL_ARB_ES3_compatibility)
         bool texCompPVRT;                   // PVR texture compression support (GL_IMG_texture_compression_pvrtc)
         bool texCompASTC;                   // ASTC texture compression support (GL_KHR_texture_compression_astc_hdr, GL_KHR_texture_compression_astc_ldr)
+        bool texCompBPTC;                   // BPTC (BC7) texture compression support (GL_ARB_texture_compression_bptc, GL_EXT_texture_compression_bptc)
+        bool texCompRGTC;                   // RGTC (BC4) texture compression support (GL_ARB_texture_compression_rgtc, GL_EXT_texture_compression_rgtc)
         bool texMirrorClamp;                // Clamp mirror wrap mode supported (GL_EXT_texture_mirror_clamp)
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // rl_Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Immutable buffer storage and persistent mapping support (GL_ARB_buffer_storage)
+        bool programBinary;                 // Shader program binaries retrieval and loading support (GL_ARB_get_program_binary)
+        bool parallelShaderCompile;         // Shader compile and link completion can be polled (GL_KHR_parallel_shader_compile)
+        bool invalidateFramebuffer;         // Framebuffer attachments contents can be invalidated (GL_ARB_invalidate_subdata, GL_EXT_discard_framebuffer)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
 
     } ExtSupported;     // Extensions supported flags
+    struct {
+        unsigned int programId;             // Shader program currently bound
+        unsigned int vaoId;                 // Vertex array object currently bound
+        int activeTextureSlot;              // Texture unit currently active
+        unsigned int textureId[RL_MAX_STATE_CACHE_TEXTURE_UNITS];   // 2D texture currently bound per texture unit
+        int blendSrcFactor;                 // Blending source factor (glBlendFunc)
+        int blendDstFactor;                 // Blending destination factor (glBlendFunc)
+        int blendEquation;                  // Blending equation (glBlendEquation)
+        int colorBlend;                     // GL_BLEND state
+        int depthTest;                      // GL_DEPTH_TEST state
+        int depthMask;                      // Depth write state
+        int cullFace;                       // GL_CULL_FACE state
+        int scissorTest;                    // GL_SCISSOR_TEST state
+        int viewport[4];                    // Viewport area
+        int scissor[4];                     // Scissor area
+        unsigned int elidedCalls;           // Number of redundant GL calls skipped
+
+    } Cache;            // GL state cache (RLGL_ENABLE_STATE_CACHE), unknown values are -1
+    rlRenderStats Stats;                    // Render statistics
+    struct {
+        unsigned int bufferId;              // Staging ring pixel buffer id (GL_PIXEL_UNPACK_BUFFER)
+        int head;                           // Staging ring next write offset
+        struct {
+            unsigned int textureId;         // Texture being updated
+            void *fence;                    // Upload completion fence (GLsync)
+            int offset;                     // Staging ring region offset
+            int size;                       // Staging ring region size
+        } pending[RL_MAX_ASYNC_UPLOADS];    // Uploads in flight (ring, completed in order)
+        int first;                          // Oldest upload in flight
+        int count;                          // Number of uploads in flight
+
+    } Upload;           // Async texture upload data
+    struct {
+        bool recording;                     // Render batch draws are recorded instead of drawn
+        float *vertices;                    // Recorded vertex positions
+        float *texcoords;                   // Recorded vertex texture coordinates
+        float *normals;                     // Recorded vertex normals
+        unsigned char *colors;              // Recorded vertex colors
+        int vertexCount;                    // Recorded vertices count
+        int vertexCapacity;                 // Recording vertex arrays capacity
+        unsigned int *draws;                // Recorded draws data: mode, first vertex, vertex count, texture id
+        int drawCount;                      // Recorded draws count
+        int drawCapacity;                   // Recording draws array capacity
+    } DrawingList;      // Drawing list recording data
+    struct {
+        unsigned int bufferIds[RL_MAX_ASYNC_READBACKS];   // Readback pixel buffers ids (GL_PIXEL_PACK_BUFFER)
+        int bufferSizes[RL_MAX_ASYNC_READBACKS];          // Readback pixel buffers allocated sizes
+        struct {
+            void *fence;                    // Readback completion fence (GLsync)
+            int width;                      // Readback area width
+            int height;                     // Readback area height
+            bool depth;                     // Readback of depth buffer (float data, not flipped)
+            rlReadbackCallback callback;    // Readback delivery callback
+            void *userData;                 // Readback callback user data
+        } pending[RL_MAX_ASYNC_READBACKS];  // Readbacks in flight (ring, completed in order)
+        int first;                          // Oldest readback in flight
+        int count;                          // Number of readbacks in flight
+
+    } Readback;         // Async screen readback data
+#if defined(RLGL_ENABLE_GPU_PROFILER)
+    struct {
+        unsigned int queryIds[RL_PROFILER_FRAME_LATENCY][RL_MAX_PROFILER_PASSES*2];  // Timestamp queries per frame slot (pass begin, pass end)
+        rlProfilerPass passes[RL_PROFILER_FRAME_LATENCY][RL_MAX_PROFILER_PASSES];   // Passes recorded per frame slot, waiting for queries results
+        int passCount[RL_PROFILER_FRAME_LATENCY];   // Number of passes recorded per frame slot
+        bool pending[RL_PROFILER_FRAME_LATENCY];    // Frame slot waiting for queries results
+        int currentSlot;                    // Frame slot being recorded
+        bool frameActive;                   // Frame being recorded (between rlProfilerBeginFrame() and rlProfilerEndFrame())
+
+        int stack[RL_MAX_PROFILER_PASSES];  // Open passes indices
+        int stackCounter;                   // Open passes counter
+        int passStart[RL_MAX_PROFILER_PASSES][3];   // Render stats on pass begin: draw calls, vertices, batch flushes
+
+        rlProfilerPass results[RL_MAX_PROFILER_PASSES];  // Passes of last resolved frame
+        int resultCount;                    // Number of passes of last resolved frame
+        bool timerQuery;                    // GPU timestamp queries supported
+
+    } Profiler;         // GPU profiler data
+#endif
 } rlglData;
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+// Software render batch, vertex data accumulated on CPU arrays and drawn with swDrawArrays()
+// NOTE: Vertex are accumulated while drawing mode and texture do not change, any other
+// rlsw state change draws the batch first (OpenGL bindings redefined on rlsw inclusion)
+typedef struct rlSoftwareBatch {
+    int elementCount;                   // Number of vertex that can be stored in batch arrays
+    int vertexCounter;                  // Number of vertex accumulated
+    int vertexStart;                    // First vertex of current rlBegin()/rlEnd() block
+    int mode;                           // Drawing mode of accumulated vertex (RL_LINES, RL_TRIANGLES, RL_QUADS)
+    int modeVertexCount;                // Number of vertex per primitive for drawing mode, 0 if not supported
+
+    float *vertices;                    // Vertex position (XYZ - 3 components per vertex)
+    float *texcoords;                   // Vertex texture coordinates (UV - 2 components per vertex)
+    unsigned char *colors;              // Vertex colors (RGBA - 4 components per vertex)
+
+    float texcoordx, texcoordy;         // Current active texture coordinate (added on rlVertex3f())
+    unsigned char colorr, colorg, colorb, colora;   // Current active color (added on rlVertex3f())
+
+    unsigned int textureId;             // Texture requested by rlEnableTexture(), 0 if texturing disabled
+    unsigned int currentTextureId;      // Texture applied on rlsw, RL_SOFTWARE_TEXTURE_UNKNOWN if binding modified
+} rlSoftwareBatch;
+
+#define RL_SOFTWARE_TEXTURE_UNKNOWN     0xFFFFFFFF  // Software batch applied texture is unknown, must be set again
+#endif
+
+// GPU memory tracked resource, hashed by object namespace and id
+typedef struct rlGpuMemoryEntry {
+    unsigned long long key;             // Object namespace (high 32 bits) and GL object id (low 32 bits), 0 if entry is empty
+    long long size;                     // Resource size (in bytes)
+    int type;                           // Resource type (rlGpuMemoryType)
+} rlGpuMemoryEntry;
+
+// GPU memory tracker, open addressing hash table (linear probing)
+typedef struct rlGpuMemoryTracker {
+    rlGpuMemoryEntry *entries;          // Tracked resources
+    int capacity;                       // Hash table capacity (power of two)
+    int count;                          // Tracked resources count
+    rlGpuMemoryStats stats[RL_GPU_MEMORY_TYPE_COUNT + 1];  // Stats per resource type, last one accumulates all types
+} rlGpuMemoryTracker;
+
+// GPU objects namespaces, GL object ids are only unique per namespace
+#define RL_GPU_OBJECT_TEXTURE           1   // Textures (glGenTextures)
+#define RL_GPU_OBJECT_RENDERBUFFER      2   // Renderbuffers (glGenRenderbuffers)
+#define RL_GPU_OBJECT_BUFFER            3   // Buffers (glGenBuffers)
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-static double rlCullDistanceNear = RL_CULL_DISTANCE_NEAR;
-static double rlCullDistanceFar = RL_CULL_DISTANCE_FAR;
+static RL_CONTEXT_LOCAL double rlCullDistanceNear = RL_CULL_DISTANCE_NEAR;
+static RL_CONTEXT_LOCAL double rlCullDistanceFar = RL_CULL_DISTANCE_FAR;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-static rlglData RLGL = { 0 };
+static RL_CONTEXT_LOCAL rlglData RLGL = { 0 };
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
-static bool isGpuReady = false;
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+static RL_CONTEXT_LOCAL rlSoftwareBatch softwareBatch = { 0 };
+#endif
+static RL_CONTEXT_LOCAL bool isGpuReady = false;
+static RL_CONTEXT_LOCAL rlGpuMemoryTracker gpuMemory = { 0 };
+
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+// Command buffer types and data
+typedef enum {
+    RL_COMMAND_BEGIN = 0,
+    RL_COMMAND_END,
+    RL_COMMAND_VERTEX2F,
+    RL_COMMAND_VERTEX3F,
+    RL_COMMAND_TEXCOORD2F,
+    RL_COMMAND_NORMAL3F,
+    RL_COMMAND_COLOR4UB,
+    RL_COMMAND_SET_TEXTURE,
+    RL_COMMAND_MATRIX_MODE,
+    RL_COMMAND_PUSH_MATRIX,
+    RL_COMMAND_POP_MATRIX,
+    RL_COMMAND_LOAD_IDENTITY,
+    RL_COMMAND_TRANSLATE,
+    RL_COMMAND_ROTATE,
+    RL_COMMAND_SCALE,
+    RL_COMMAND_MULT_MATRIX,
+    RL_COMMAND_FRUSTUM,
+    RL_COMMAND_ORTHO,
+    RL_COMMAND_SET_SHADER,
+    RL_COMMAND_SET_BLEND_MODE,
+    RL_COMMAND_FLUSH,
+    RL_COMMAND_CALLBACK,
+    RL_COMMAND_CALL,                    // Call rlgl function without parameters
+    RL_COMMAND_VIEWPORT,
+    RL_COMMAND_SCISSOR,
+    RL_COMMAND_CLEAR_COLOR,
+    RL_COMMAND_ENABLE_FRAMEBUFFER,
+    RL_COMMAND_FRAMEBUFFER_WIDTH,
+    RL_COMMAND_FRAMEBUFFER_HEIGHT,
+    RL_COMMAND_INVALIDATE_FRAMEBUFFER,
+    RL_COMMAND_REPLAY_BUFFER
+} rlCommandType;
+
+// Command parameters, recorded after command header (type, size)
+typedef union rlCommandData {
+    float f[16];
+    double d[6];
+    int i[4];
+    unsigned int ui[4];
+    unsigned char ub[4];
+    struct { unsigned int id; int *locs; } shader;
+    struct { void (*callback)(void *userData); void *userData; } call;
+    void (*proc)(void);
+    const rlCommandBuffer *buffer;
+} rlCommandData;
+
+static RL_THREAD_LOCAL rlCommandBuffer *rlRecordingBuffer = NULL;  // Command buffer recording calls of current thread
+static RL_THREAD_LOCAL unsigned int rlRecordingFramebuffer = 0;     // Framebuffer enabled by recorded calls of current thread
+#endif
 
 #if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
 // NOTE: VAO functionality is exposed through extensions (OES)
@@ -1165,6 +1838,9 @@ static PFNGLDELETEVERTEXARRAYSOESPROC glDeleteVertexArrays = NULL;
 static PFNGLDRAWARRAYSINSTANCEDEXTPROC glDrawArraysInstanced = NULL;
 static PFNGLDRAWELEMENTSINSTANCEDEXTPROC glDrawElementsInstanced = NULL;
 static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
+
+// NOTE: Framebuffer invalidation is exposed through extension (EXT)
+static PFNGLDISCARDFRAMEBUFFEREXTPROC glDiscardFramebuffer = NULL;
 #endif
 
 //----------------------------------------------------------------------------------
@@ -1173,12 +1849,66 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlSortRenderBatch(rlRenderBatch *batch);    // Sort render batch draw calls and merge draws sharing state
+static bool rlDrawCallsShareState(const rlDrawCall *a, const rlDrawCall *b);    // Check if two draw calls can be merged
+static void rlRecordDrawingList(rlRenderBatch *batch);    // Record render batch draws into current drawing list
+static bool rlCheckShaderCompile(unsigned int shaderId, int type);  // Check shader compilation status, errors are logged
+static void rlPrepareShaderProgram(unsigned int programId, unsigned int vShaderId, unsigned int fShaderId); // Attach shaders and bind default attribute locations
+static bool rlCheckShaderProgramLink(unsigned int programId);       // Check shader program link status, errors are logged
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+static int rlGetDrawTextureSlot(rlDrawCall *draw, unsigned int id);    // Get draw texture slot for a texture, added if required (-1 if no slot available)
+static unsigned int rlGetDrawCurrentTexture(const rlDrawCall *draw);   // Get texture of draw current slot
+#endif
+#if defined(RLGL_ENABLE_PERSISTENT_BATCH_BUFFERS) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+static void *rlMapPersistentBuffer(unsigned int *vboId, int size);   // Load a persistently mapped vertex buffer, returns mapped pointer
+static void rlUnloadPersistentBuffers(rlVertexBuffer *buffer);      // Unmap and delete batch persistently mapped vertex buffers
+static void rlWaitBufferFence(rlVertexBuffer *buffer);              // Wait for buffer fence to be signaled by GPU (buffer not in use)
+#endif
+static void rlLoadBatchVertexArrays(rlVertexBuffer *buffer);        // Load batch vertex data arrays in CPU (RAM)
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+static void rlSetBatchVertexAttributes(void);   // Set interleaved batch vertex attributes for current shader (VBO must be bound)
+#endif
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
+static unsigned int rlLoadTextureLayers(unsigned int target, const void *data, int width, int height, int depth, int format, int mipmapCount); // Load layered texture (array or 3D) mipmap levels
+static void rlTextureTargetParameters(unsigned int target, unsigned int id, int param, int value); // Set texture parameters for non-2D texture target
+
+// GPU memory tracking functions, size of a tracked object is replaced on tracking again
+static void rlTrackGpuMemory(int object, unsigned int id, int type, long long size);   // Track GPU object memory by resource type
+static void rlUntrackGpuMemory(int object, unsigned int id);    // Untrack GPU object memory (if tracked)
+static void rlUpdateGpuMemoryStats(int type, long long size, int count); // Update GPU memory stats of a resource type and accumulated stats
+static int rlGetGpuMemorySlot(unsigned long long key);          // Get GPU memory tracker hash table slot for an object key
+static void rlUnloadGpuMemoryTracker(void);                     // Unload GPU memory tracker, tracked resources are forgotten
+static long long rlGetTextureMipmapsSize(int width, int height, int format, int mipmapCount); // Get texture mipmap chain size in bytes
+
+// GL state cache functions, GL call is skipped if state is already set (RLGL_ENABLE_STATE_CACHE)
+static void rlCacheInvalidate(void);                            // Set all cached GL state to unknown
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void rlCacheUseProgram(unsigned int id);                 // Bind shader program (glUseProgram)
+static void rlCacheBindVertexArray(unsigned int id);            // Bind vertex array object (glBindVertexArray)
+static void rlCacheActiveTexture(unsigned int texture);         // Set active texture unit (glActiveTexture)
+static void rlCacheBlendFunc(int srcFactor, int dstFactor);     // Set blending factors (glBlendFunc)
+static void rlCacheBlendEquation(int equation);                 // Set blending equation (glBlendEquation)
+#endif
+static void rlCacheBindTexture(unsigned int id);                // Bind 2D texture to active texture unit (glBindTexture)
+static void rlCacheSetCapability(int capability, bool enabled);  // Enable/disable GL capability (glEnable/glDisable)
+static void rlCacheForgetTexture(unsigned int id);              // Clear a deleted texture from cached bindings
+
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+// Software render batch functions, vertex data is submitted to rlsw as arrays
+static void rlLoadSoftwareBatch(int numElements);               // Load software render batch arrays
+static void rlUnloadSoftwareBatch(void);                        // Unload software render batch arrays
+static void rlDrawSoftwareBatch(void);                          // Draw accumulated vertex data and apply requested texture
+static void rlBindSoftwareTexture(unsigned int id);             // Bind texture on rlsw (glBindTexture), drawing batch first
+#endif
+
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+static void rlRecordCommand(int type, const void *data, int size);  // Record command into current thread command buffer
+#endif
 
 static rl_Matrix rlMatrixIdentity(void);                       // Get identity matrix
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
@@ -1231,6 +1961,13 @@ void rlMultMatrixf(const float *matf) { glMultMatrixf(matf); }
 // Choose the current matrix to be transformed
 void rlMatrixMode(int mode)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordCommand(RL_COMMAND_MATRIX_MODE, &mode, sizeof(int));
+        return;
+    }
+#endif
     if (mode == RL_PROJECTION) RLGL.State.currentMatrix = &RLGL.State.projection;
     else if (mode == RL_MODELVIEW) RLGL.State.currentMatrix = &RLGL.State.modelview;
     //else if (mode == RL_TEXTURE) // Not supported
@@ -1241,6 +1978,13 @@ void rlMatrixMode(int mode)
 // Push the current matrix into RLGL.State.stack
 void rlPushMatrix(void)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordCommand(RL_COMMAND_PUSH_MATRIX, NULL, 0);
+        return;
+    }
+#endif
     if (RLGL.State.stackCounter >= RL_MAX_MATRIX_STACK_SIZE) TRACELOG(RL_LOG_ERROR, "RLGL: rl_Matrix stack overflow (RL_MAX_MATRIX_STACK_SIZE)");
 
     if (RLGL.State.currentMatrixMode == RL_MODELVIEW)
@@ -1256,6 +2000,13 @@ void rlPushMatrix(void)
 // Pop latest inserted matrix from RLGL.State.stack
 void rlPopMatrix(void)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordCommand(RL_COMMAND_POP_MATRIX, NULL, 0);
+        return;
+    }
+#endif
     if (RLGL.State.stackCounter > 0)
     {
         rl_Matrix mat = RLGL.State.stack[RLGL.State.stackCounter - 1];
@@ -1273,12 +2024,27 @@ void rlPopMatrix(void)
 // Reset current matrix to identity matrix
 void rlLoadIdentity(void)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordCommand(RL_COMMAND_LOAD_IDENTITY, NULL, 0);
+        return;
+    }
+#endif
     *RLGL.State.currentMatrix = rlMatrixIdentity();
 }
 
 // Multiply the current matrix by a translation matrix
 void rlTranslatef(float x, float y, float z)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        float data[3] = { x, y, z };
+        rlRecordCommand(RL_COMMAND_TRANSLATE, data, sizeof(data));
+        return;
+    }
+#endif
     rl_Matrix matTranslation = {
         1.0f, 0.0f, 0.0f, x,
         0.0f, 1.0f, 0.0f, y,
@@ -1294,6 +2060,14 @@ void rlTranslatef(float x, float y, float z)
 // NOTE: The provided angle must be in degrees
 void rlRotatef(float angle, float x, float y, float z)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        float data[4] = { angle, x, y, z };
+        rlRecordCommand(RL_COMMAND_ROTATE, data, sizeof(data));
+        return;
+    }
+#endif
     rl_Matrix matRotation = rlMatrixIdentity();
 
     // Axis vector (x, y, z) normalization
@@ -1338,6 +2112,14 @@ void rlRotatef(float angle, float x, float y, float z)
 // Multiply the current matrix by a scaling matrix
 void rlScalef(float x, float y, float z)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        float data[3] = { x, y, z };
+        rlRecordCommand(RL_COMMAND_SCALE, data, sizeof(data));
+        return;
+    }
+#endif
     rl_Matrix matScale = {
         x, 0.0f, 0.0f, 0.0f,
         0.0f, y, 0.0f, 0.0f,
@@ -1352,6 +2134,13 @@ void rlScalef(float x, float y, float z)
 // Multiply the current matrix by another matrix
 void rlMultMatrixf(const float *matf)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordCommand(RL_COMMAND_MULT_MATRIX, matf, 16*sizeof(float));
+        return;
+    }
+#endif
     // rl_Matrix creation from array
     rl_Matrix mat = { matf[0], matf[4], matf[8], matf[12],
                    matf[1], matf[5], matf[9], matf[13],
@@ -1364,6 +2153,14 @@ void rlMultMatrixf(const float *matf)
 // Multiply the current matrix by a perspective matrix generated by parameters
 void rlFrustum(double left, double right, double bottom, double top, double znear, double zfar)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        double data[6] = { left, right, bottom, top, znear, zfar };
+        rlRecordCommand(RL_COMMAND_FRUSTUM, data, sizeof(data));
+        return;
+    }
+#endif
     rl_Matrix matFrustum = { 0 };
 
     float rl = (float)(right - left);
@@ -1396,6 +2193,14 @@ void rlFrustum(double left, double right, double bottom, double top, double znea
 // Multiply the current matrix by an orthographic matrix generated by parameters
 void rlOrtho(double left, double right, double bottom, double top, double znear, double zfar)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        double data[6] = { left, right, bottom, top, znear, zfar };
+        rlRecordCommand(RL_COMMAND_ORTHO, data, sizeof(data));
+        return;
+    }
+#endif
     // NOTE: If left-right and top-botton values are equal it could create a division by zero,
     // response to it is platform/compiler dependant
     rl_Matrix matOrtho = { 0 };
@@ -1429,7 +2234,28 @@ void rlOrtho(double left, double right, double bottom, double top, double znear,
 // NOTE: We store current viewport dimensions
 void rlViewport(int x, int y, int width, int height)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        int data[4] = { x, y, width, height };
+        rlRecordCommand(RL_COMMAND_VIEWPORT, data, sizeof(data));
+        return;
+    }
+#endif
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if ((RLGL.Cache.viewport[0] == x) && (RLGL.Cache.viewport[1] == y) &&
+        (RLGL.Cache.viewport[2] == width) && (RLGL.Cache.viewport[3] == height)) RLGL.Cache.elidedCalls++;
+    else
+    {
+        RLGL.Cache.viewport[0] = x;
+        RLGL.Cache.viewport[1] = y;
+        RLGL.Cache.viewport[2] = width;
+        RLGL.Cache.viewport[3] = height;
+        glViewport(x, y, width, height);
+    }
+#else
     glViewport(x, y, width, height);
+#endif
 }
 
 // Set clip planes distances
@@ -1454,7 +2280,107 @@ double rlGetCullDistanceFar(void)
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Vertex level operations
 //----------------------------------------------------------------------------------
-#if defined(GRAPHICS_API_OPENGL_11)
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+// Software render batch, vertex data accumulated and drawn by rlDrawSoftwareBatch()
+//---------------------------------------
+void rlBegin(int mode)
+{
+    // Accumulated vertex are drawn if drawing mode or requested texture changes
+    if ((mode != softwareBatch.mode) || (softwareBatch.textureId != softwareBatch.currentTextureId))
+    {
+        rlDrawSoftwareBatch();
+
+        softwareBatch.mode = mode;
+        switch (mode)
+        {
+            case RL_LINES: softwareBatch.modeVertexCount = 2; break;
+            case RL_TRIANGLES: softwareBatch.modeVertexCount = 3; break;
+            case RL_QUADS: softwareBatch.modeVertexCount = 4; break;
+            default: softwareBatch.modeVertexCount = 0; break;
+        }
+    }
+
+    softwareBatch.vertexStart = softwareBatch.vertexCounter;
+}
+
+void rlEnd(void)
+{
+    // Incomplete primitive vertex are discarded (as done by swEnd())
+    int count = softwareBatch.vertexCounter - softwareBatch.vertexStart;
+
+    if (softwareBatch.modeVertexCount > 0) softwareBatch.vertexCounter -= count%softwareBatch.modeVertexCount;
+    else softwareBatch.vertexCounter = softwareBatch.vertexStart;
+
+    softwareBatch.vertexStart = softwareBatch.vertexCounter;
+}
+
+void rlVertex3f(float x, float y, float z)
+{
+    if (softwareBatch.vertexCounter >= softwareBatch.elementCount)
+    {
+        // Batch arrays are full, completed primitives are drawn and
+        // vertex of current primitive are moved to arrays start
+        int partial = 0;
+        if (softwareBatch.modeVertexCount > 0) partial = (softwareBatch.vertexCounter - softwareBatch.vertexStart)%softwareBatch.modeVertexCount;
+        int first = softwareBatch.vertexCounter - partial;
+
+        softwareBatch.vertexCounter = first;
+        rlDrawSoftwareBatch();
+
+        memmove(softwareBatch.vertices, softwareBatch.vertices + 3*first, 3*partial*sizeof(float));
+        memmove(softwareBatch.texcoords, softwareBatch.texcoords + 2*first, 2*partial*sizeof(float));
+        memmove(softwareBatch.colors, softwareBatch.colors + 4*first, 4*partial*sizeof(unsigned char));
+        softwareBatch.vertexCounter = partial;
+    }
+
+    int i = softwareBatch.vertexCounter;
+
+    softwareBatch.vertices[3*i] = x;
+    softwareBatch.vertices[3*i + 1] = y;
+    softwareBatch.vertices[3*i + 2] = z;
+
+    softwareBatch.texcoords[2*i] = softwareBatch.texcoordx;
+    softwareBatch.texcoords[2*i + 1] = softwareBatch.texcoordy;
+
+    softwareBatch.colors[4*i] = softwareBatch.colorr;
+    softwareBatch.colors[4*i + 1] = softwareBatch.colorg;
+    softwareBatch.colors[4*i + 2] = softwareBatch.colorb;
+    softwareBatch.colors[4*i + 3] = softwareBatch.colora;
+
+    softwareBatch.vertexCounter++;
+}
+
+void rlVertex2i(int x, int y) { rlVertex3f((float)x, (float)y, 0.0f); }
+void rlVertex2f(float x, float y) { rlVertex3f(x, y, 0.0f); }
+void rlVertices2f(const float *vertices, int count) { for (int i = 0; i < count; i++) rlVertex3f(vertices[2*i], vertices[2*i + 1], 0.0f); }
+void rlVertices3f(const float *vertices, int count) { for (int i = 0; i < count; i++) rlVertex3f(vertices[3*i], vertices[3*i + 1], vertices[3*i + 2]); }
+
+void rlTexCoord2f(float x, float y)
+{
+    softwareBatch.texcoordx = x;
+    softwareBatch.texcoordy = y;
+}
+
+void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
+
+void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
+{
+    softwareBatch.colorr = r;
+    softwareBatch.colorg = g;
+    softwareBatch.colorb = b;
+    softwareBatch.colora = a;
+}
+
+void rlColor3f(float x, float y, float z)
+{
+    rlColor4ub((unsigned char)(x*255), (unsigned char)(y*255), (unsigned char)(z*255), 255);
+}
+
+void rlColor4f(float x, float y, float z, float w)
+{
+    rlColor4ub((unsigned char)(x*255), (unsigned char)(y*255), (unsigned char)(z*255), (unsigned char)(w*255));
+}
+#elif defined(GRAPHICS_API_OPENGL_11)
 // Fallback to OpenGL 1.1 function calls
 //---------------------------------------
 void rlBegin(int mode)
@@ -1472,6 +2398,8 @@ void rlEnd(void) { glEnd(); }
 void rlVertex2i(int x, int y) { glVertex2i(x, y); }
 void rlVertex2f(float x, float y) { glVertex2f(x, y); }
 void rlVertex3f(float x, float y, float z) { glVertex3f(x, y, z); }
+void rlVertices2f(const float *vertices, int count) { for (int i = 0; i < count; i++) glVertex2f(vertices[2*i], vertices[2*i + 1]); }
+void rlVertices3f(const float *vertices, int count) { for (int i = 0; i < count; i++) glVertex3f(vertices[3*i], vertices[3*i + 1], vertices[3*i + 2]); }
 void rlTexCoord2f(float x, float y) { glTexCoord2f(x, y); }
 void rlNormal3f(float x, float y, float z) { glNormal3f(x, y, z); }
 void rlColor4ub(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { glColor4ub(r, g, b, a); }
@@ -1482,6 +2410,13 @@ void rlColor4f(float x, float y, float z, float w) { glColor4f(x, y, z, w); }
 // Initialize drawing mode (how to organize vertex)
 void rlBegin(int mode)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordCommand(RL_COMMAND_BEGIN, &mode, sizeof(int));
+        return;
+    }
+#endif
     // Draw mode can be RL_LINES, RL_TRIANGLES and RL_QUADS
     // NOTE: In all three cases, vertex are accumulated over default internal vertex buffer
     if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode != mode)
@@ -1504,10 +2439,15 @@ void rlBegin(int mode)
             }
         }
 
-        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+        if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlFlushRenderBatch(RL_BATCH_FLUSH_DRAWCALL_LIMIT);
 
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.currentTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.currentLayer;
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = 0;
+        RLGL.State.currentTextureSlot = 0;
+#endif
         RLGL.State.currentTextureId = RLGL.State.defaultTextureId;
     }
 }
@@ -1515,27 +2455,90 @@ void rlBegin(int mode)
 // Finish vertex providing
 void rlEnd(void)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordCommand(RL_COMMAND_END, NULL, 0);
+        return;
+    }
+#endif
     // NOTE: Depth increment is dependant on rlOrtho(): z-near and z-far values,
     // as well as depth buffer bit-depth (16bit or 24bit or 32bit)
     // Correct increment formula would be: depthInc = (zfar - znear)/pow(2, bits)
     RLGL.currentBatch->currentDepth += (1.0f/20000.0f);
 }
 
+// Batch vertex kernels, specialized at compile time for the batch buffers layout
+// NOTE: Shared by single vertex definition and bulk vertex definition, transform and batch
+// limits are checked by the caller, once per vertex or once per run of vertices
+#define RL_TRANSFORM_VERTEX(x, y, z, tx, ty, tz) \
+    { \
+        tx = RLGL.State.transform.m0*(x) + RLGL.State.transform.m4*(y) + RLGL.State.transform.m8*(z) + RLGL.State.transform.m12; \
+        ty = RLGL.State.transform.m1*(x) + RLGL.State.transform.m5*(y) + RLGL.State.transform.m9*(z) + RLGL.State.transform.m13; \
+        tz = RLGL.State.transform.m2*(x) + RLGL.State.transform.m6*(y) + RLGL.State.transform.m10*(z) + RLGL.State.transform.m14; \
+    }
+
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+    #define RL_BATCH_VERTEX_TEXTURE_SLOT(vertex) (vertex)->normal[3] = (short)RLGL.State.currentTextureSlot
+#else
+    #define RL_BATCH_VERTEX_TEXTURE_SLOT(vertex)
+#endif
+// Add vertex with current texcoord, normal and color, all attributes are contiguous in memory
+#define RL_BATCH_WRITE_VERTEX(buffer, index, x, y, z) \
+    { \
+        rlBatchVertex *vertex = &(buffer)->data[index]; \
+        vertex->position[0] = (x); \
+        vertex->position[1] = (y); \
+        vertex->position[2] = (z); \
+        vertex->texcoord[0] = RLGL.State.texcoordx; \
+        vertex->texcoord[1] = RLGL.State.texcoordy; \
+        vertex->normal[0] = RLGL.State.normalPacked[0]; \
+        vertex->normal[1] = RLGL.State.normalPacked[1]; \
+        vertex->normal[2] = RLGL.State.normalPacked[2]; \
+        RL_BATCH_VERTEX_TEXTURE_SLOT(vertex); \
+        vertex->color[0] = RLGL.State.colorr; \
+        vertex->color[1] = RLGL.State.colorg; \
+        vertex->color[2] = RLGL.State.colorb; \
+        vertex->color[3] = RLGL.State.colora; \
+    }
+#else
+// Add vertex with current texcoord, normal and color, one array per attribute
+#define RL_BATCH_WRITE_VERTEX(buffer, index, x, y, z) \
+    { \
+        (buffer)->vertices[3*(index)] = (x); \
+        (buffer)->vertices[3*(index) + 1] = (y); \
+        (buffer)->vertices[3*(index) + 2] = (z); \
+        (buffer)->texcoords[2*(index)] = RLGL.State.texcoordx; \
+        (buffer)->texcoords[2*(index) + 1] = RLGL.State.texcoordy; \
+        (buffer)->normals[3*(index)] = RLGL.State.normalx; \
+        (buffer)->normals[3*(index) + 1] = RLGL.State.normaly; \
+        (buffer)->normals[3*(index) + 2] = RLGL.State.normalz; \
+        (buffer)->colors[4*(index)] = RLGL.State.colorr; \
+        (buffer)->colors[4*(index) + 1] = RLGL.State.colorg; \
+        (buffer)->colors[4*(index) + 2] = RLGL.State.colorb; \
+        (buffer)->colors[4*(index) + 3] = RLGL.State.colora; \
+    }
+#endif
+
 // Define one vertex (position)
 // NOTE: Vertex position data is the basic information required for drawing
 void rlVertex3f(float x, float y, float z)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        float data[3] = { x, y, z };
+        rlRecordCommand(RL_COMMAND_VERTEX3F, data, sizeof(data));
+        return;
+    }
+#endif
     float tx = x;
     float ty = y;
     float tz = z;
 
     // rl_Transform provided vector if required
-    if (RLGL.State.transformRequired)
-    {
-        tx = RLGL.State.transform.m0*x + RLGL.State.transform.m4*y + RLGL.State.transform.m8*z + RLGL.State.transform.m12;
-        ty = RLGL.State.transform.m1*x + RLGL.State.transform.m5*y + RLGL.State.transform.m9*z + RLGL.State.transform.m13;
-        tz = RLGL.State.transform.m2*x + RLGL.State.transform.m6*y + RLGL.State.transform.m10*z + RLGL.State.transform.m14;
-    }
+    if (RLGL.State.transformRequired) RL_TRANSFORM_VERTEX(x, y, z, tx, ty, tz);
 
     // WARNING: We can't break primitives when launching a new batch
     // RL_LINES comes in pairs, RL_TRIANGLES come in groups of 3 vertices and RL_QUADS come in groups of 4 vertices
@@ -1562,39 +2565,114 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
-    // Add vertices
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 2] = tz;
+    RL_BATCH_WRITE_VERTEX(&RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer], RLGL.State.vertexCounter, tx, ty, tz);
 
-    // Add current texcoord
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter] = RLGL.State.texcoordx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].texcoords[2*RLGL.State.vertexCounter + 1] = RLGL.State.texcoordy;
+    RLGL.State.vertexCounter++;
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
+}
 
-    // Add current normal
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter] = RLGL.State.normalx;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter + 1] = RLGL.State.normaly;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].normals[3*RLGL.State.vertexCounter + 2] = RLGL.State.normalz;
+// Define multiple vertices (position), components: 2 (XY, current depth used) or 3 (XYZ)
+// NOTE: Transform and batch limits are checked once per run of vertices fitting the batch,
+// vertex that could require a new batch are defined one by one by rlVertex3f()
+static void rlBatchVertices(const float *vertices, int components, int count)
+{
+    int i = 0;
 
-    // Add current color
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter] = RLGL.State.colorr;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 1] = RLGL.State.colorg;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
-    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
+    while (i < count)
+    {
+        rlVertexBuffer *buffer = &RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer];
+        int available = (buffer->elementCount*4 - 4) - RLGL.State.vertexCounter + 1;
 
-    RLGL.State.vertexCounter++;
-    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
+        if (available <= 0)
+        {
+            const float *v = vertices + components*i;
+            rlVertex3f(v[0], v[1], (components == 3)? v[2] : RLGL.currentBatch->currentDepth);
+            i++;
+            continue;
+        }
+
+        int n = ((count - i) < available)? (count - i) : available;
+        int index = RLGL.State.vertexCounter;
+        float depth = RLGL.currentBatch->currentDepth;
+
+        if (RLGL.State.transformRequired)
+        {
+            for (int k = 0; k < n; k++, index++)
+            {
+                const float *v = vertices + components*(i + k);
+                float z = (components == 3)? v[2] : depth;
+                float tx, ty, tz;
+
+                RL_TRANSFORM_VERTEX(v[0], v[1], z, tx, ty, tz);
+                RL_BATCH_WRITE_VERTEX(buffer, index, tx, ty, tz);
+            }
+        }
+        else
+        {
+            for (int k = 0; k < n; k++, index++)
+            {
+                const float *v = vertices + components*(i + k);
+                RL_BATCH_WRITE_VERTEX(buffer, index, v[0], v[1], (components == 3)? v[2] : depth);
+            }
+        }
+
+        RLGL.State.vertexCounter += n;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount += n;
+        i += n;
+    }
+}
+
+// Define multiple vertices (position) - 2 float per vertex
+void rlVertices2f(const float *vertices, int count)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        for (int i = 0; i < count; i++) rlVertex2f(vertices[2*i], vertices[2*i + 1]);
+        return;
+    }
+#endif
+    rlBatchVertices(vertices, 2, count);
+}
+
+// Define multiple vertices (position) - 3 float per vertex
+void rlVertices3f(const float *vertices, int count)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        for (int i = 0; i < count; i++) rlVertex3f(vertices[3*i], vertices[3*i + 1], vertices[3*i + 2]);
+        return;
+    }
+#endif
+    rlBatchVertices(vertices, 3, count);
 }
 
 // Define one vertex (position)
 void rlVertex2f(float x, float y)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        float data[2] = { x, y };     // NOTE: Depth is set on replay
+        rlRecordCommand(RL_COMMAND_VERTEX2F, data, sizeof(data));
+        return;
+    }
+#endif
     rlVertex3f(x, y, RLGL.currentBatch->currentDepth);
 }
 
 // Define one vertex (position)
 void rlVertex2i(int x, int y)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        float data[2] = { (float)x, (float)y };
+        rlRecordCommand(RL_COMMAND_VERTEX2F, data, sizeof(data));
+        return;
+    }
+#endif
     rlVertex3f((float)x, (float)y, RLGL.currentBatch->currentDepth);
 }
 
@@ -1602,6 +2680,14 @@ void rlVertex2i(int x, int y)
 // NOTE: rl_Texture coordinates are limited to QUADS only
 void rlTexCoord2f(float x, float y)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        float data[2] = { x, y };
+        rlRecordCommand(RL_COMMAND_TEXCOORD2F, data, sizeof(data));
+        return;
+    }
+#endif
     RLGL.State.texcoordx = x;
     RLGL.State.texcoordy = y;
 }
@@ -1610,6 +2696,14 @@ void rlTexCoord2f(float x, float y)
 // NOTE: Normals limited to TRIANGLES only?
 void rlNormal3f(float x, float y, float z)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        float data[3] = { x, y, z };
+        rlRecordCommand(RL_COMMAND_NORMAL3F, data, sizeof(data));
+        return;
+    }
+#endif
     float normalx = x;
     float normaly = y;
     float normalz = z;
@@ -1630,11 +2724,25 @@ void rlNormal3f(float x, float y, float z)
     RLGL.State.normalx = normalx;
     RLGL.State.normaly = normaly;
     RLGL.State.normalz = normalz;
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+    // Normal is already normalized, map [-1.0..1.0] to [-32767..32767]
+    RLGL.State.normalPacked[0] = (short)(normalx*32767.0f);
+    RLGL.State.normalPacked[1] = (short)(normaly*32767.0f);
+    RLGL.State.normalPacked[2] = (short)(normalz*32767.0f);
+#endif
 }
 
 // Define one vertex (color)
 void rlColor4ub(unsigned char x, unsigned char y, unsigned char z, unsigned char w)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        unsigned char data[4] = { x, y, z, w };
+        rlRecordCommand(RL_COMMAND_COLOR4UB, data, sizeof(data));
+        return;
+    }
+#endif
     RLGL.State.colorr = x;
     RLGL.State.colorg = y;
     RLGL.State.colorb = z;
@@ -1662,6 +2770,13 @@ void rlColor3f(float x, float y, float z)
 // Set current texture to use
 void rlSetTexture(unsigned int id)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordCommand(RL_COMMAND_SET_TEXTURE, &id, sizeof(unsigned int));
+        return;
+    }
+#endif
     if (id == 0)
     {
 #if defined(GRAPHICS_API_OPENGL_11)
@@ -1671,7 +2786,7 @@ void rlSetTexture(unsigned int id)
         if (RLGL.State.vertexCounter >=
             RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4)
         {
-            rlDrawRenderBatch(RLGL.currentBatch);
+            rlFlushRenderBatch(RL_BATCH_FLUSH_BUFFER_LIMIT);
         }
         RLGL.State.currentTextureId = RLGL.State.defaultTextureId;
 #endif
@@ -1682,10 +2797,30 @@ void rlSetTexture(unsigned int id)
         rlEnableTexture(id);
 #else
         RLGL.State.currentTextureId = id;
-        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+        // Default shader can sample multiple textures in one draw call, a texture slot
+        // is selected for next vertices instead of closing current draw (if slots available)
+        // NOTE: Drawing lists only record one texture per draw, slots are not used while recording
+        if ((RLGL.State.currentShaderId == RLGL.State.defaultShaderId) && !RLGL.DrawingList.recording &&
+            (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0))
+        {
+            int slot = rlGetDrawTextureSlot(&RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1], id);
+
+            if (slot >= 0)
+            {
+                RLGL.State.currentTextureSlot = slot;
+                return;
+            }
+        }
+
+        RLGL.State.currentTextureSlot = 0;
+#endif
+        if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
         {
             if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
             {
+                RLGL.Stats.textureChanges++;
+
                 // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
                 // that way, following QUADS drawing will keep aligned with index processing
                 // It implies adding some extra alignment vertex at the end of the draw,
@@ -1706,39 +2841,362 @@ void rlSetTexture(unsigned int id)
                 }
             }
 
-            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlDrawRenderBatch(RLGL.currentBatch);
+            if (RLGL.currentBatch->drawCounter >= RL_DEFAULT_BATCH_DRAWCALLS) rlFlushRenderBatch(RL_BATCH_FLUSH_TEXTURE);
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.currentLayer;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = 0;
+#endif
+        }
+#endif
+    }
+}
+
+// Enable render batch draw calls sorting
+// NOTE: Current batch is drawn first, sorting is only applied to new draws
+void rlEnableBatchSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.batchSorting)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.batchSorting = true;
+    }
+#endif
+}
+
+// Disable render batch draw calls sorting
+void rlDisableBatchSorting(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.batchSorting)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);   // Draw pending sorted draws
+        RLGL.State.batchSorting = false;
+        RLGL.State.currentLayer = 0;
+    }
+#endif
+}
+
+// Check if render batch draw calls sorting is enabled
+bool rlIsBatchSortingEnabled(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.State.batchSorting;
+#else
+    return false;
+#endif
+}
+
+// Set layer for next draws
+// NOTE: Layer is only considered with batch sorting enabled, draws from lower layers are drawn first
+void rlSetBatchLayer(int layer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.currentLayer == layer) return;
+    RLGL.State.currentLayer = layer;
+
+    rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+
+    if (draw->vertexCount > 0)
+    {
+        // A new draw call is required for the new layer, keeping mode and texture of current one
+        if (draw->mode == RL_LINES) draw->vertexAlignment = ((draw->vertexCount < 4)? draw->vertexCount : draw->vertexCount%4);
+        else if (draw->mode == RL_TRIANGLES) draw->vertexAlignment = ((draw->vertexCount < 4)? 1 : (4 - (draw->vertexCount%4)));
+        else draw->vertexAlignment = 0;
+
+        if (!rlCheckRenderBatchLimit(draw->vertexAlignment))
+        {
+            RLGL.State.vertexCounter += draw->vertexAlignment;
+
+            if ((RLGL.currentBatch->drawCounter + 1) >= RL_DEFAULT_BATCH_DRAWCALLS)
+            {
+                int mode = draw->mode;
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+                unsigned int textureId = rlGetDrawCurrentTexture(draw);
+#else
+                unsigned int textureId = draw->textureId;
+#endif
+
+                rlFlushRenderBatch(RL_BATCH_FLUSH_DRAWCALL_LIMIT);
+
+                RLGL.currentBatch->draws[0].mode = mode;
+                RLGL.currentBatch->draws[0].textureId = textureId;
+            }
+            else
+            {
+                RLGL.currentBatch->drawCounter++;
+                RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = draw->mode;
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+                RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = rlGetDrawCurrentTexture(draw);
+                RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = 0;
+#else
+                RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = draw->textureId;
+#endif
+            }
+        }
+    }
+
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+    RLGL.State.currentTextureSlot = 0;
+#endif
+
+    RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = layer;
+#endif
+}
+
+// Begin recording render batch draws into a drawing list
+// NOTE: Current batch is drawn first, following batch draws are recorded instead of drawn
+void rlBeginDrawingList(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.DrawingList.recording) return;
+
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    RLGL.DrawingList.recording = true;
+    RLGL.DrawingList.vertexCount = 0;
+    RLGL.DrawingList.drawCount = 0;
+#else
+    TRACELOG(RL_LOG_WARNING, "RLGL: Drawing lists not supported, draws are not recorded");
+#endif
+}
+
+// End recording render batch draws, recorded vertex data is uploaded to GPU
+rlDrawingList rlEndDrawingList(void)
+{
+    rlDrawingList list = { 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.DrawingList.recording) return list;
+
+    rlDrawRenderBatch(RLGL.currentBatch);   // Record pending batch draws
+    RLGL.DrawingList.recording = false;
+
+    if (RLGL.DrawingList.vertexCount > 0)
+    {
+        int vertexCount = RLGL.DrawingList.vertexCount;
+        int *locs = RLGL.State.defaultShaderLocs;
+
+        if (RLGL.ExtSupported.vao)
+        {
+            glGenVertexArrays(1, &list.vaoId);
+            rlCacheBindVertexArray(list.vaoId);
+        }
+
+        // NOTE: Vertex attributes are configured for default shader locations, also used by custom shaders
+        glGenBuffers(4, list.vboId);
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*3*sizeof(float), RLGL.DrawingList.vertices, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[1]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*2*sizeof(float), RLGL.DrawingList.texcoords, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[2]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*3*sizeof(float), RLGL.DrawingList.normals, GL_STATIC_DRAW);
+        if (locs[RL_SHADER_LOC_VERTEX_NORMAL] != -1)
+        {
+            glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_NORMAL]);
+            glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[3]);
+        glBufferData(GL_ARRAY_BUFFER, vertexCount*4*sizeof(unsigned char), RLGL.DrawingList.colors, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+
+        const int vertexSizes[4] = { 3*sizeof(float), 2*sizeof(float), 3*sizeof(float), 4*sizeof(unsigned char) };
+        for (int i = 0; i < 4; i++) rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, list.vboId[i], RL_GPU_MEMORY_VERTEX_BUFFER, (long long)vertexCount*vertexSizes[i]);
+
+        if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        list.vertexCount = vertexCount;
+        list.drawCount = RLGL.DrawingList.drawCount;
+        list.draws = (unsigned int *)RL_MALLOC(list.drawCount*4*sizeof(unsigned int));
+        memcpy(list.draws, RLGL.DrawingList.draws, list.drawCount*4*sizeof(unsigned int));
+
+        TRACELOG(RL_LOG_INFO, "RLGL: Drawing list recorded successfully (%i vertices | %i draws)", list.vertexCount, list.drawCount);
+    }
+
+    // Recording arrays are released, drawing lists are usually recorded once
+    RL_FREE(RLGL.DrawingList.vertices);
+    RL_FREE(RLGL.DrawingList.texcoords);
+    RL_FREE(RLGL.DrawingList.normals);
+    RL_FREE(RLGL.DrawingList.colors);
+    RL_FREE(RLGL.DrawingList.draws);
+    memset(&RLGL.DrawingList, 0, sizeof(RLGL.DrawingList));
+#endif
+
+    return list;
+}
+
+// Check if drawing list recording is active
+bool rlIsDrawingListRecording(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.DrawingList.recording;
+#else
+    return false;
+#endif
+}
+
+// Draw drawing list with a transform applied over current matrices
+// NOTE: Current shader, blending and render target are used, current batch is drawn first to keep drawing order
+void rlDrawDrawingList(rlDrawingList list, rl_Matrix transform)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((list.vertexCount == 0) || (list.draws == NULL)) return;
+    if (RLGL.DrawingList.recording)
+    {
+        TRACELOG(RL_LOG_WARNING, "RLGL: Drawing list can not be drawn while recording a drawing list");
+        return;
+    }
+
+    rlDrawRenderBatch(RLGL.currentBatch);
+
+    rl_Matrix matModel = RLGL.State.transformRequired? rlMatrixMultiply(transform, RLGL.State.transform) : transform;
+    rl_Matrix matView = RLGL.State.modelview;
+    rl_Matrix matProjection = RLGL.State.projection;
+    int *locs = RLGL.State.currentShaderLocs;
+
+    rlCacheUseProgram(RLGL.State.currentShaderId);
+
+    glUniform4f(locs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
+    glUniform1i(locs[RL_SHADER_LOC_MAP_DIFFUSE], 0);
+    if (locs[RL_SHADER_LOC_MATRIX_MODEL] != -1) glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(matModel));
+    if (locs[RL_SHADER_LOC_MATRIX_NORMAL] != -1) glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(matModel))));
+
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(list.vaoId);
+    else
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[0]);
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[1]);
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+        if (locs[RL_SHADER_LOC_VERTEX_NORMAL] != -1)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, list.vboId[2]);
+            glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+            glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_NORMAL]);
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, list.vboId[3]);
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+    }
+
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+    // Drawing list vertices always sample texture slot 0, per-draw textures are bound to texture0
+    if (RLGL.State.currentShaderId == RLGL.State.defaultShaderId) glVertexAttrib1f(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXINDEX, 0.0f);
+#endif
+
+    rlCacheActiveTexture(GL_TEXTURE0);
+
+    int eyeCount = 1;
+    if (RLGL.State.stereoRender) eyeCount = 2;
+
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        if (eyeCount == 2)
+        {
+            // Setup current eye viewport (half screen width) and matrices
+            rlViewport(eye*RLGL.State.framebufferWidth/2, 0, RLGL.State.framebufferWidth/2, RLGL.State.framebufferHeight);
+            matView = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.viewOffsetStereo[eye]);
+            matProjection = RLGL.State.projectionStereo[eye];
         }
+
+        rl_Matrix matMVP = rlMatrixMultiply(rlMatrixMultiply(matModel, matView), matProjection);
+        glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
+        if (locs[RL_SHADER_LOC_MATRIX_VIEW] != -1) glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(matView));
+        if (locs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1) glUniformMatrix4fv(locs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(matProjection));
+
+        // Draws data: mode, first vertex, vertex count and texture id
+        for (int i = 0; i < list.drawCount; i++)
+        {
+            const unsigned int *draw = &list.draws[i*4];
+
+            rlCacheBindTexture(draw[3]);
+            glDrawArrays(draw[0], draw[1], draw[2]);
+
+            RLGL.Stats.drawCalls++;
+            RLGL.Stats.vertices += draw[2];
+        }
+    }
+
+    if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
+    else glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    rlCacheBindTexture(0);
+    rlCacheUseProgram(0);
 #endif
+}
+
+// Unload drawing list from GPU memory (VRAM)
+void rlUnloadDrawingList(rlDrawingList list)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (list.vaoId > 0)
+    {
+        rlCacheBindVertexArray(0);
+        glDeleteVertexArrays(1, &list.vaoId);
     }
+
+    for (int i = 0; i < 4; i++)
+    {
+        rlUntrackGpuMemory(RL_GPU_OBJECT_BUFFER, list.vboId[i]);
+        if (list.vboId[i] > 0) glDeleteBuffers(1, &list.vboId[i]);
+    }
+
+    if (list.vertexCount > 0) TRACELOG(RL_LOG_INFO, "RLGL: Drawing list unloaded successfully from VRAM (GPU)");
+#endif
+    RL_FREE(list.draws);
 }
 
 // Select and active a texture slot
 void rlActiveTextureSlot(int slot)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    rlCacheActiveTexture(GL_TEXTURE0 + slot);
 #endif
 }
 
 // Enable texture
 void rlEnableTexture(unsigned int id)
 {
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    softwareBatch.textureId = id;   // Applied on next software batch draw
+#else
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(id);
+#endif
 }
 
 // Disable texture
 void rlDisableTexture(void)
 {
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    softwareBatch.textureId = 0;    // Applied on next software batch draw
+#else
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(0);
+#endif
 }
 
 // Enable texture cubemap
@@ -1757,10 +3215,42 @@ void rlDisableTextureCubemap(void)
 #endif
 }
 
+// Enable texture array
+void rlEnableTextureArray(unsigned int id)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+#endif
+}
+
+// Disable texture array
+void rlDisableTextureArray(void)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+#endif
+}
+
+// Enable 3D texture
+void rlEnableTexture3D(unsigned int id)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindTexture(GL_TEXTURE_3D, id);
+#endif
+}
+
+// Disable 3D texture
+void rlDisableTexture3D(void)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindTexture(GL_TEXTURE_3D, 0);
+#endif
+}
+
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(id);
 
     switch (param)
     {
@@ -1799,7 +3289,34 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(0);
+}
+
+// Set single channel texture swizzle, red channel sampled as alpha of white color
+// NOTE: Single channel coverage textures (fonts atlas) can be drawn with default shader,
+// returns false if texture swizzle is not supported (OpenGL 1.1, OpenGL ES 2.0)
+bool rlTextureSwizzleAlpha(unsigned int id)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    rlCacheBindTexture(id);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    GLint swizzleMask[] = { GL_ONE, GL_ONE, GL_ONE, GL_RED };
+    glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+#else
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED);
+#endif
+
+    rlCacheBindTexture(0);
+    result = true;
+#endif
+
+    return result;
 }
 
 // Set cubemap parameters (wrap mode/filter mode)
@@ -1845,11 +3362,23 @@ void rlCubemapParameters(unsigned int id, int param, int value)
 #endif
 }
 
+// Set texture array parameters (wrap mode/filter mode)
+void rlTextureArrayParameters(unsigned int id, int param, int value)
+{
+    rlTextureTargetParameters(RL_TEXTURE_2D_ARRAY, id, param, value);
+}
+
+// Set 3D texture parameters (wrap mode/filter mode)
+void rlTexture3DParameters(unsigned int id, int param, int value)
+{
+    rlTextureTargetParameters(RL_TEXTURE_3D, id, param, value);
+}
+
 // Enable shader program
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    rlCacheUseProgram(id);
 #endif
 }
 
@@ -1857,13 +3386,21 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    rlCacheUseProgram(0);
 #endif
 }
 
 // Enable rendering to texture (fbo)
 void rlEnableFramebuffer(unsigned int id)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordingFramebuffer = id;
+        rlRecordCommand(RL_COMMAND_ENABLE_FRAMEBUFFER, &id, sizeof(unsigned int));
+        return;
+    }
+#endif
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(GL_FRAMEBUFFER, id);
 #endif
@@ -1873,6 +3410,10 @@ void rlEnableFramebuffer(unsigned int id)
 unsigned int rlGetActiveFramebuffer(void)
 {
     GLint fboId = 0;
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    // NOTE: Recording threads could not access GL context, active framebuffer is tracked by recorded calls
+    if (rlRecordingBuffer != NULL) return rlRecordingFramebuffer;
+#endif
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &fboId);
 #endif
@@ -1882,6 +3423,15 @@ unsigned int rlGetActiveFramebuffer(void)
 // Disable rendering to texture
 void rlDisableFramebuffer(void)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        void (*proc)(void) = rlDisableFramebuffer;
+        rlRecordingFramebuffer = 0;
+        rlRecordCommand(RL_COMMAND_CALL, &proc, sizeof(proc));
+        return;
+    }
+#endif
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 #endif
@@ -1932,7 +3482,13 @@ void rlActiveDrawBuffers(int count)
             glDrawBuffers(count, buffers);
         }
     }
-    else TRACELOG(RL_LOG_WARNING, "GL: One color buffer active by default");
+    else
+    {
+        // No color buffer, required by depth only framebuffers to be complete
+        unsigned int buffer = GL_NONE;
+        glDrawBuffers(1, &buffer);
+        glReadBuffer(GL_NONE);
+    }
 #endif
 }
 
@@ -1941,28 +3497,74 @@ void rlActiveDrawBuffers(int count)
 //----------------------------------------------------------------------------------
 
 // Enable color blending
-void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
+void rlEnableColorBlend(void) { rlCacheSetCapability(GL_BLEND, true); }
 
 // Disable color blending
-void rlDisableColorBlend(void) { glDisable(GL_BLEND); }
+void rlDisableColorBlend(void) { rlCacheSetCapability(GL_BLEND, false); }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        void (*proc)(void) = rlEnableDepthTest;
+        rlRecordCommand(RL_COMMAND_CALL, &proc, sizeof(proc));
+        return;
+    }
+#endif
+    rlCacheSetCapability(GL_DEPTH_TEST, true);
+}
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        void (*proc)(void) = rlDisableDepthTest;
+        rlRecordCommand(RL_COMMAND_CALL, &proc, sizeof(proc));
+        return;
+    }
+#endif
+    rlCacheSetCapability(GL_DEPTH_TEST, false);
+}
 
 // Enable depth write
-void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
+void rlEnableDepthMask(void)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if (RLGL.Cache.depthMask == 1) RLGL.Cache.elidedCalls++;
+    else
+    {
+        RLGL.Cache.depthMask = 1;
+        glDepthMask(GL_TRUE);
+    }
+#else
+    glDepthMask(GL_TRUE);
+#endif
+}
 
 // Disable depth write
-void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); }
+void rlDisableDepthMask(void)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if (RLGL.Cache.depthMask == 0) RLGL.Cache.elidedCalls++;
+    else
+    {
+        RLGL.Cache.depthMask = 0;
+        glDepthMask(GL_FALSE);
+    }
+#else
+    glDepthMask(GL_FALSE);
+#endif
+}
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { rlCacheSetCapability(GL_CULL_FACE, true); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { rlCacheSetCapability(GL_CULL_FACE, false); }
 
 // Set color mask active for screen read/draw
 void rlColorMask(bool r, bool g, bool b, bool a) { glColorMask(r, g, b, a); }
@@ -1979,33 +3581,104 @@ void rlSetCullFace(int mode)
 }
 
 // Enable scissor test
-void rlEnableScissorTest(void) { glEnable(GL_SCISSOR_TEST); }
-
-// Disable scissor test
-void rlDisableScissorTest(void) { glDisable(GL_SCISSOR_TEST); }
-
-// Scissor test
-void rlScissor(int x, int y, int width, int height) { glScissor(x, y, width, height); }
-
-// Enable wire mode
-void rlEnableWireMode(void)
+void rlEnableScissorTest(void)
 {
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    // NOTE: glPolygonMode() not available on OpenGL ES
-    glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        void (*proc)(void) = rlEnableScissorTest;
+        rlRecordCommand(RL_COMMAND_CALL, &proc, sizeof(proc));
+        return;
+    }
 #endif
+    rlCacheSetCapability(GL_SCISSOR_TEST, true);
 }
 
-// Disable wire mode
-void rlDisableWireMode(void)
+// Disable scissor test
+void rlDisableScissorTest(void)
 {
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    // NOTE: glPolygonMode() not available on OpenGL ES
-    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        void (*proc)(void) = rlDisableScissorTest;
+        rlRecordCommand(RL_COMMAND_CALL, &proc, sizeof(proc));
+        return;
+    }
 #endif
+    rlCacheSetCapability(GL_SCISSOR_TEST, false);
 }
 
-// Enable point mode
+// Scissor test
+void rlScissor(int x, int y, int width, int height)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        int data[4] = { x, y, width, height };
+        rlRecordCommand(RL_COMMAND_SCISSOR, data, sizeof(data));
+        return;
+    }
+#endif
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if ((RLGL.Cache.scissor[0] == x) && (RLGL.Cache.scissor[1] == y) &&
+        (RLGL.Cache.scissor[2] == width) && (RLGL.Cache.scissor[3] == height)) RLGL.Cache.elidedCalls++;
+    else
+    {
+        RLGL.Cache.scissor[0] = x;
+        RLGL.Cache.scissor[1] = y;
+        RLGL.Cache.scissor[2] = width;
+        RLGL.Cache.scissor[3] = height;
+        glScissor(x, y, width, height);
+    }
+#else
+    glScissor(x, y, width, height);
+#endif
+}
+
+// Reset GL state cache
+// NOTE: Required if GL state is modified outside rlgl, next state changes are not skipped
+void rlResetStateCache(void)
+{
+    rlCacheInvalidate();
+}
+
+// Get number of redundant GL calls skipped by GL state cache
+unsigned int rlGetStateCacheElidedCalls(void)
+{
+    unsigned int count = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    count = RLGL.Cache.elidedCalls;
+#endif
+    return count;
+}
+
+// Reset counter of redundant GL calls skipped by GL state cache
+void rlResetStateCacheElidedCalls(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Cache.elidedCalls = 0;
+#endif
+}
+
+// Enable wire mode
+void rlEnableWireMode(void)
+{
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: glPolygonMode() not available on OpenGL ES
+    glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
+#endif
+}
+
+// Disable wire mode
+void rlDisableWireMode(void)
+{
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    // NOTE: glPolygonMode() not available on OpenGL ES
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+#endif
+}
+
+// Enable point mode
 void rlEnablePointMode(void)
 {
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
@@ -2099,6 +3772,14 @@ bool rlIsStereoRenderEnabled(void)
 // Clear color buffer with color
 void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        unsigned char data[4] = { r, g, b, a };
+        rlRecordCommand(RL_COMMAND_CLEAR_COLOR, data, sizeof(data));
+        return;
+    }
+#endif
     // rl_Color values clamp to 0.0f(0) and 1.0f(255)
     float cr = (float)r/255;
     float cg = (float)g/255;
@@ -2111,6 +3792,14 @@ void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned ch
 // Clear used screen buffers (color and depth)
 void rlClearScreenBuffers(void)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        void (*proc)(void) = rlClearScreenBuffers;
+        rlRecordCommand(RL_COMMAND_CALL, &proc, sizeof(proc));
+        return;
+    }
+#endif
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);     // Clear used buffers: rl_Color and Depth (Depth is used for 3D)
     //glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);     // Stencil buffer not used...
 }
@@ -2142,29 +3831,42 @@ void rlCheckErrors(void)
 // Set blend mode
 void rlSetBlendMode(int mode)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordCommand(RL_COMMAND_SET_BLEND_MODE, &mode, sizeof(int));
+        return;
+    }
+#endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((RLGL.State.currentBlendMode != mode) || ((mode == RL_BLEND_CUSTOM || mode == RL_BLEND_CUSTOM_SEPARATE) && RLGL.State.glCustomBlendModeModified))
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
+        rlFlushRenderBatch(RL_BATCH_FLUSH_BLEND);
+        RLGL.Stats.blendModeChanges++;
 
         switch (mode)
         {
-            case RL_BLEND_ALPHA: glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADDITIVE: glBlendFunc(GL_SRC_ALPHA, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_MULTIPLIED: glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_ADD_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_ADD); break;
-            case RL_BLEND_SUBTRACT_COLORS: glBlendFunc(GL_ONE, GL_ONE); glBlendEquation(GL_FUNC_SUBTRACT); break;
-            case RL_BLEND_ALPHA_PREMULTIPLY: glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); glBlendEquation(GL_FUNC_ADD); break;
+            case RL_BLEND_ALPHA: rlCacheBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); rlCacheBlendEquation(GL_FUNC_ADD); break;
+            case RL_BLEND_ADDITIVE: rlCacheBlendFunc(GL_SRC_ALPHA, GL_ONE); rlCacheBlendEquation(GL_FUNC_ADD); break;
+            case RL_BLEND_MULTIPLIED: rlCacheBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA); rlCacheBlendEquation(GL_FUNC_ADD); break;
+            case RL_BLEND_ADD_COLORS: rlCacheBlendFunc(GL_ONE, GL_ONE); rlCacheBlendEquation(GL_FUNC_ADD); break;
+            case RL_BLEND_SUBTRACT_COLORS: rlCacheBlendFunc(GL_ONE, GL_ONE); rlCacheBlendEquation(GL_FUNC_SUBTRACT); break;
+            case RL_BLEND_ALPHA_PREMULTIPLY: rlCacheBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA); rlCacheBlendEquation(GL_FUNC_ADD); break;
             case RL_BLEND_CUSTOM:
             {
                 // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactors()
-                glBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); glBlendEquation(RLGL.State.glBlendEquation);
+                rlCacheBlendFunc(RLGL.State.glBlendSrcFactor, RLGL.State.glBlendDstFactor); rlCacheBlendEquation(RLGL.State.glBlendEquation);
             } break;
             case RL_BLEND_CUSTOM_SEPARATE:
             {
                 // NOTE: Using GL blend src/dst factors and GL equation configured with rlSetBlendFactorsSeparate()
                 glBlendFuncSeparate(RLGL.State.glBlendSrcFactorRGB, RLGL.State.glBlendDestFactorRGB, RLGL.State.glBlendSrcFactorAlpha, RLGL.State.glBlendDestFactorAlpha);
                 glBlendEquationSeparate(RLGL.State.glBlendEquationRGB, RLGL.State.glBlendEquationAlpha);
+
+                // Separate blending factors are not tracked, cached blending must be set again
+                RLGL.Cache.blendSrcFactor = -1;
+                RLGL.Cache.blendDstFactor = -1;
+                RLGL.Cache.blendEquation = -1;
             } break;
             default: break;
         }
@@ -2215,6 +3917,308 @@ void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int g
 #endif
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Command buffers
+//----------------------------------------------------------------------------------
+
+// Load command buffer
+// NOTE: Memory grows on recording if required, initial capacity avoids reallocations
+rlCommandBuffer rlLoadCommandBuffer(int capacity)
+{
+    rlCommandBuffer buffer = { 0 };
+
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (capacity > 0)
+    {
+        buffer.data = (unsigned char *)RL_MALLOC(capacity);
+        if (buffer.data != NULL) buffer.capacity = capacity;
+    }
+#endif
+
+    return buffer;
+}
+
+// Unload command buffer
+void rlUnloadCommandBuffer(rlCommandBuffer buffer)
+{
+    RL_FREE(buffer.data);
+}
+
+// Reset command buffer recorded commands, allocated memory is kept
+void rlResetCommandBuffer(rlCommandBuffer *buffer)
+{
+    buffer->size = 0;
+    buffer->commandCount = 0;
+}
+
+// Begin recording rlgl calls of calling thread into command buffer
+// NOTE: Recorded calls do not access GL context or rlgl state, they are executed on replay
+void rlBeginCommandRecording(rlCommandBuffer *buffer)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    rlRecordingBuffer = buffer;
+    rlRecordingFramebuffer = 0;     // Recording starts on default framebuffer
+#endif
+}
+
+// End recording rlgl calls of calling thread
+void rlEndCommandRecording(void)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    rlRecordingBuffer = NULL;
+#endif
+}
+
+// Record a user callback, called on replay on GL context thread
+// NOTE: Useful for drawing functions not supported by recording, i.e. rl_DrawMesh()
+void rlRecordCallback(void (*callback)(void *userData), void *userData)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    rlCommandData data = { 0 };
+    data.call.callback = callback;
+    data.call.userData = userData;
+
+    if (rlRecordingBuffer != NULL) rlRecordCommand(RL_COMMAND_CALLBACK, &data.call, sizeof(data.call));
+    else if (callback != NULL) callback(userData);    // Not recording, called immediately
+#endif
+}
+
+// Submit command buffer for replay
+// NOTE: Not thread-safe, buffers must be submitted from GL context thread, in the order they should be drawn
+void rlSubmitCommandBuffer(rlCommandBuffer *buffer)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        // Submitted while recording, buffer is replayed when recorded commands are replayed
+        rlRecordCommand(RL_COMMAND_REPLAY_BUFFER, &buffer, sizeof(rlCommandBuffer *));
+        return;
+    }
+
+    if (RLGL.State.submittedBufferCount >= RL_MAX_COMMAND_BUFFER_SUBMITS) rlExecuteCommandBuffers();
+
+    RLGL.State.submittedBuffers[RLGL.State.submittedBufferCount] = buffer;
+    RLGL.State.submittedBufferCount++;
+#endif
+}
+
+// Replay submitted command buffers in submission order
+// NOTE: Submitted buffers are not reset, they can be replayed again if submitted
+void rlExecuteCommandBuffers(void)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    for (int i = 0; i < RLGL.State.submittedBufferCount; i++) rlReplayCommandBuffer(RLGL.State.submittedBuffers[i]);
+
+    RLGL.State.submittedBufferCount = 0;
+#endif
+}
+
+// Replay command buffer recorded commands
+void rlReplayCommandBuffer(const rlCommandBuffer *buffer)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if ((buffer == NULL) || (buffer->data == NULL)) return;
+
+    // Replayed commands must be executed, not recorded, in case GL thread is recording
+    rlCommandBuffer *recordingBuffer = rlRecordingBuffer;
+    rlRecordingBuffer = NULL;
+
+    int offset = 0;
+    int header[2] = { 0 };      // Command type, parameters size
+
+    while ((offset + (int)sizeof(header)) <= buffer->size)
+    {
+        rlCommandData data = { 0 };
+
+        memcpy(header, buffer->data + offset, sizeof(header));
+        offset += sizeof(header);
+        memcpy(&data, buffer->data + offset, header[1]);
+        offset += header[1];
+
+        switch (header[0])
+        {
+            case RL_COMMAND_BEGIN: rlBegin(data.i[0]); break;
+            case RL_COMMAND_END: rlEnd(); break;
+            case RL_COMMAND_VERTEX2F: rlVertex2f(data.f[0], data.f[1]); break;
+            case RL_COMMAND_VERTEX3F: rlVertex3f(data.f[0], data.f[1], data.f[2]); break;
+            case RL_COMMAND_TEXCOORD2F: rlTexCoord2f(data.f[0], data.f[1]); break;
+            case RL_COMMAND_NORMAL3F: rlNormal3f(data.f[0], data.f[1], data.f[2]); break;
+            case RL_COMMAND_COLOR4UB: rlColor4ub(data.ub[0], data.ub[1], data.ub[2], data.ub[3]); break;
+            case RL_COMMAND_SET_TEXTURE: rlSetTexture(data.ui[0]); break;
+            case RL_COMMAND_MATRIX_MODE: rlMatrixMode(data.i[0]); break;
+            case RL_COMMAND_PUSH_MATRIX: rlPushMatrix(); break;
+            case RL_COMMAND_POP_MATRIX: rlPopMatrix(); break;
+            case RL_COMMAND_LOAD_IDENTITY: rlLoadIdentity(); break;
+            case RL_COMMAND_TRANSLATE: rlTranslatef(data.f[0], data.f[1], data.f[2]); break;
+            case RL_COMMAND_ROTATE: rlRotatef(data.f[0], data.f[1], data.f[2], data.f[3]); break;
+            case RL_COMMAND_SCALE: rlScalef(data.f[0], data.f[1], data.f[2]); break;
+            case RL_COMMAND_MULT_MATRIX: rlMultMatrixf(data.f); break;
+            case RL_COMMAND_FRUSTUM: rlFrustum(data.d[0], data.d[1], data.d[2], data.d[3], data.d[4], data.d[5]); break;
+            case RL_COMMAND_ORTHO: rlOrtho(data.d[0], data.d[1], data.d[2], data.d[3], data.d[4], data.d[5]); break;
+            case RL_COMMAND_SET_SHADER: rlSetShader(data.shader.id, data.shader.locs); break;
+            case RL_COMMAND_SET_BLEND_MODE: rlSetBlendMode(data.i[0]); break;
+            case RL_COMMAND_FLUSH: rlFlushRenderBatch(data.i[0]); break;
+            case RL_COMMAND_CALLBACK: if (data.call.callback != NULL) data.call.callback(data.call.userData); break;
+            case RL_COMMAND_CALL: data.proc(); break;
+            case RL_COMMAND_VIEWPORT: rlViewport(data.i[0], data.i[1], data.i[2], data.i[3]); break;
+            case RL_COMMAND_SCISSOR: rlScissor(data.i[0], data.i[1], data.i[2], data.i[3]); break;
+            case RL_COMMAND_CLEAR_COLOR: rlClearColor(data.ub[0], data.ub[1], data.ub[2], data.ub[3]); break;
+            case RL_COMMAND_ENABLE_FRAMEBUFFER: rlEnableFramebuffer(data.ui[0]); break;
+            case RL_COMMAND_FRAMEBUFFER_WIDTH: rlSetFramebufferWidth(data.i[0]); break;
+            case RL_COMMAND_FRAMEBUFFER_HEIGHT: rlSetFramebufferHeight(data.i[0]); break;
+            case RL_COMMAND_INVALIDATE_FRAMEBUFFER: rlInvalidateFramebuffer(data.i[0] != 0, data.i[1] != 0); break;
+            case RL_COMMAND_REPLAY_BUFFER: if (data.buffer != recordingBuffer) rlReplayCommandBuffer(data.buffer); break;
+            default: break;
+        }
+    }
+
+    rlRecordingBuffer = recordingBuffer;
+#endif
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - GPU profiler
+//----------------------------------------------------------------------------------
+
+// Begin GPU profiler frame
+// NOTE: Frame slot is reused after RL_PROFILER_FRAME_LATENCY frames,
+// if its queries are still not resolved, results are dropped instead of waiting for GPU
+void rlProfilerBeginFrame(void)
+{
+#if defined(RLGL_ENABLE_GPU_PROFILER)
+    if (RLGL.Profiler.frameActive) rlProfilerEndFrame();
+
+    RLGL.Profiler.currentSlot = (RLGL.Profiler.currentSlot + 1)%RL_PROFILER_FRAME_LATENCY;
+    RLGL.Profiler.pending[RLGL.Profiler.currentSlot] = false;
+    RLGL.Profiler.passCount[RLGL.Profiler.currentSlot] = 0;
+    RLGL.Profiler.stackCounter = 0;
+    RLGL.Profiler.frameActive = true;
+
+    rlProfilerBeginPass("frame");
+#endif
+}
+
+// End GPU profiler frame
+void rlProfilerEndFrame(void)
+{
+#if defined(RLGL_ENABLE_GPU_PROFILER)
+    if (!RLGL.Profiler.frameActive) return;
+
+    // Close frame pass and any pass left open
+    while (RLGL.Profiler.stackCounter > 0) rlProfilerEndPass();
+
+    RLGL.Profiler.frameActive = false;
+    RLGL.Profiler.pending[RLGL.Profiler.currentSlot] = true;
+
+    // Read back oldest frames first, stop on first frame with queries not available yet
+    for (int i = 1; i <= RL_PROFILER_FRAME_LATENCY; i++)
+    {
+        int slot = (RLGL.Profiler.currentSlot + i)%RL_PROFILER_FRAME_LATENCY;
+        if (!RLGL.Profiler.pending[slot]) continue;
+
+        int passCount = RLGL.Profiler.passCount[slot];
+
+    #if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+        if (RLGL.Profiler.timerQuery)
+        {
+            // NOTE: Queries complete in order, checking last query issued is enough
+            GLint available = 0;
+            glGetQueryObjectiv(RLGL.Profiler.queryIds[slot][passCount*2 - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) break;
+
+            for (int p = 0; p < passCount; p++)
+            {
+                GLuint64 timeBegin = 0;
+                GLuint64 timeEnd = 0;
+                glGetQueryObjectui64v(RLGL.Profiler.queryIds[slot][p*2], GL_QUERY_RESULT, &timeBegin);
+                glGetQueryObjectui64v(RLGL.Profiler.queryIds[slot][p*2 + 1], GL_QUERY_RESULT, &timeEnd);
+
+                RLGL.Profiler.passes[slot][p].gpuTime = (float)((double)(timeEnd - timeBegin)/1000000.0);
+            }
+        }
+    #endif
+
+        for (int p = 0; p < passCount; p++) RLGL.Profiler.results[p] = RLGL.Profiler.passes[slot][p];
+        RLGL.Profiler.resultCount = passCount;
+        RLGL.Profiler.pending[slot] = false;
+    }
+#endif
+}
+
+// Begin named GPU profiler pass
+// NOTE: Passes over RL_MAX_PROFILER_PASSES per frame are ignored
+void rlProfilerBeginPass(const char *name)
+{
+#if defined(RLGL_ENABLE_GPU_PROFILER)
+    int slot = RLGL.Profiler.currentSlot;
+    int index = RLGL.Profiler.passCount[slot];
+
+    if (!RLGL.Profiler.frameActive || (index >= RL_MAX_PROFILER_PASSES)) return;
+
+    rlDrawRenderBatch(RLGL.currentBatch);   // Previous draws are not measured in this pass
+
+    rlProfilerPass *pass = &RLGL.Profiler.passes[slot][index];
+    memset(pass, 0, sizeof(rlProfilerPass));
+    if (name != NULL) strncpy(pass->name, name, sizeof(pass->name) - 1);
+    pass->depth = RLGL.Profiler.stackCounter;
+
+    RLGL.Profiler.passStart[index][0] = RLGL.Stats.drawCalls;
+    RLGL.Profiler.passStart[index][1] = RLGL.Stats.vertices;
+    RLGL.Profiler.passStart[index][2] = RLGL.Stats.batchFlushes;
+
+    #if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if (RLGL.Profiler.timerQuery) glQueryCounter(RLGL.Profiler.queryIds[slot][index*2], GL_TIMESTAMP);
+    #endif
+
+    RLGL.Profiler.stack[RLGL.Profiler.stackCounter] = index;
+    RLGL.Profiler.stackCounter++;
+    RLGL.Profiler.passCount[slot]++;
+#endif
+}
+
+// End current GPU profiler pass
+void rlProfilerEndPass(void)
+{
+#if defined(RLGL_ENABLE_GPU_PROFILER)
+    if (RLGL.Profiler.stackCounter <= 0) return;
+
+    rlDrawRenderBatch(RLGL.currentBatch);   // Pass draws are submitted before measure ends
+
+    int slot = RLGL.Profiler.currentSlot;
+    RLGL.Profiler.stackCounter--;
+    int index = RLGL.Profiler.stack[RLGL.Profiler.stackCounter];
+
+    #if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if (RLGL.Profiler.timerQuery) glQueryCounter(RLGL.Profiler.queryIds[slot][index*2 + 1], GL_TIMESTAMP);
+    #endif
+
+    rlProfilerPass *pass = &RLGL.Profiler.passes[slot][index];
+    pass->drawCalls = RLGL.Stats.drawCalls - RLGL.Profiler.passStart[index][0];
+    pass->vertices = RLGL.Stats.vertices - RLGL.Profiler.passStart[index][1];
+    pass->batchFlushes = RLGL.Stats.batchFlushes - RLGL.Profiler.passStart[index][2];
+#endif
+}
+
+// Get number of passes measured on last resolved frame
+int rlGetProfilerPassCount(void)
+{
+    int count = 0;
+#if defined(RLGL_ENABLE_GPU_PROFILER)
+    count = RLGL.Profiler.resultCount;
+#endif
+    return count;
+}
+
+// Get pass measures of last resolved frame
+rlProfilerPass rlGetProfilerPass(int index)
+{
+    rlProfilerPass pass = { 0 };
+#if defined(RLGL_ENABLE_GPU_PROFILER)
+    if ((index >= 0) && (index < RLGL.Profiler.resultCount)) pass = RLGL.Profiler.results[index];
+#endif
+    return pass;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - OpenGL Debug
 //----------------------------------------------------------------------------------
@@ -2284,6 +4288,8 @@ void rlglInit(int width, int height)
 {
     isGpuReady = true;
 
+    rlCacheInvalidate();    // GL state is unknown until first set
+
     // Enable OpenGL debug context if required
 #if defined(RLGL_ENABLE_OPENGL_DEBUG_CONTEXT) && defined(GRAPHICS_API_OPENGL_43)
     if ((glDebugMessageCallback != NULL) && (glDebugMessageControl != NULL))
@@ -2321,6 +4327,23 @@ void rlglInit(int width, int height)
     RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = -1;
     RLGL.currentBatch = &RLGL.defaultBatch;
 
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    // Init default camera uniform block, kept bound to its binding point,
+    // shaders declaring the block read camera matrices without per-draw uniforms upload
+    RLGL.State.cameraBlockId = rlLoadUniformBuffer(3*sizeof(float16), NULL, RL_DYNAMIC_DRAW);
+    rlBindUniformBuffer(RLGL.State.cameraBlockId, RL_DEFAULT_UNIFORM_BLOCK_BINDING_CAMERA);
+#endif
+
+#if defined(RLGL_ENABLE_GPU_PROFILER) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // Init GPU profiler timestamp queries (GL_ARB_timer_query, core on OpenGL 3.3)
+    if ((glQueryCounter != NULL) && (glGetQueryObjectui64v != NULL))
+    {
+        glGenQueries(RL_PROFILER_FRAME_LATENCY*RL_MAX_PROFILER_PASSES*2, &RLGL.Profiler.queryIds[0][0]);
+        RLGL.Profiler.timerQuery = true;
+    }
+    else TRACELOG(RL_LOG_WARNING, "GL: GPU profiler timestamp queries not supported, only counters available");
+#endif
+
     // Init stack matrices (emulating OpenGL 1.1)
     for (int i = 0; i < RL_MAX_MATRIX_STACK_SIZE; i++) RLGL.State.stack[i] = rlMatrixIdentity();
 
@@ -2339,6 +4362,9 @@ void rlglInit(int width, int height)
         TRACELOG(RL_LOG_ERROR, "RLSW: Software renderer initialization failed!");
         exit(-1);
     }
+
+    // Init software render batch, vertex data is submitted to rlsw as arrays
+    rlLoadSoftwareBatch(RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
 #endif
 
     // Initialize OpenGL default states
@@ -2389,13 +4415,47 @@ void rlglClose(void)
 
     rlUnloadShaderDefault(); // Unload default shader
 
-    glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
+    RL_FREE(RLGL.State.sortBuffer);   // Unload batch sorting scratch buffer
+    RL_FREE(RLGL.DrawingList.vertices);    // Unload drawing list recording arrays (recording not ended)
+    RL_FREE(RLGL.DrawingList.texcoords);
+    RL_FREE(RLGL.DrawingList.normals);
+    RL_FREE(RLGL.DrawingList.colors);
+    RL_FREE(RLGL.DrawingList.draws);
+    memset(&RLGL.DrawingList, 0, sizeof(RLGL.DrawingList));
+    RLGL.State.sortBuffer = NULL;
+    RLGL.State.sortBufferSize = 0;
+
+    rlUnloadUniformBuffer(RLGL.State.cameraBlockId);    // Unload default camera uniform block
+    RLGL.State.cameraBlockId = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    rlSyncTextureUploads();                             // Unload async texture uploads staging buffer
+    if (RLGL.Upload.bufferId != 0) glDeleteBuffers(1, &RLGL.Upload.bufferId);
+    RLGL.Upload.bufferId = 0;
+
+    rlUpdateReadbacks(true);                            // Deliver pending async readbacks and unload their buffers
+    for (int i = 0; i < RL_MAX_ASYNC_READBACKS; i++)
+    {
+        if (RLGL.Readback.bufferIds[i] != 0) glDeleteBuffers(1, &RLGL.Readback.bufferIds[i]);
+        RLGL.Readback.bufferIds[i] = 0;
+        RLGL.Readback.bufferSizes[i] = 0;
+    }
+#endif
+
+#if defined(RLGL_ENABLE_GPU_PROFILER) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if (RLGL.Profiler.timerQuery) glDeleteQueries(RL_PROFILER_FRAME_LATENCY*RL_MAX_PROFILER_PASSES*2, &RLGL.Profiler.queryIds[0][0]);
+    RLGL.Profiler.timerQuery = false;
+#endif
+
+    rlUnloadTexture(RLGL.State.defaultTextureId);      // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    rlUnloadSoftwareBatch();
     swClose(); // Unload sofware renderer resources
 #endif
+    rlUnloadGpuMemoryTracker();
     isGpuReady = false;
 }
 
@@ -2450,6 +4510,22 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.texCompASTC = GLAD_GL_KHR_texture_compression_astc_hdr && GLAD_GL_KHR_texture_compression_astc_ldr;
     RLGL.ExtSupported.texCompDXT = GLAD_GL_EXT_texture_compression_s3tc;  // rl_Texture compression: DXT
     RLGL.ExtSupported.texCompETC2 = GLAD_GL_ARB_ES3_compatibility;        // rl_Texture compression: ETC2/EAC
+    RLGL.ExtSupported.texCompBPTC = GLAD_GL_VERSION_4_2;                  // rl_Texture compression: BPTC (core in OpenGL 4.2)
+    RLGL.ExtSupported.texCompRGTC = GLAD_GL_VERSION_3_0;                  // rl_Texture compression: RGTC (core in OpenGL 3.0)
+    #if !defined(GRAPHICS_API_OPENGL_21)
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage;         // Persistent mapped buffers (core in OpenGL 4.4)
+    RLGL.ExtSupported.programBinary = (glGetProgramBinary != NULL) && (glProgramBinary != NULL) && (glProgramParameteri != NULL); // Core in OpenGL 4.1
+    RLGL.ExtSupported.invalidateFramebuffer = (glInvalidateFramebuffer != NULL);  // Core in OpenGL 4.3
+
+    // NOTE: Parallel shader compile is not loaded by GLAD, it's checked on extensions list
+    for (int i = 0; i < numExt; i++)
+    {
+        const char *extName = (const char *)glGetStringi(GL_EXTENSIONS, i);
+        if ((strcmp(extName, "GL_KHR_parallel_shader_compile") == 0) || (strcmp(extName, "GL_ARB_parallel_shader_compile") == 0)) RLGL.ExtSupported.parallelShaderCompile = true;
+        if (strcmp(extName, "GL_ARB_texture_compression_bptc") == 0) RLGL.ExtSupported.texCompBPTC = true;
+        if (strcmp(extName, "GL_ARB_texture_compression_rgtc") == 0) RLGL.ExtSupported.texCompRGTC = true;
+    }
+    #endif
     #if defined(GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
@@ -2470,6 +4546,18 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.maxDepthBits = 24;
     RLGL.ExtSupported.texAnisoFilter = true;
     RLGL.ExtSupported.texMirrorClamp = true;
+    RLGL.ExtSupported.programBinary = true;
+    RLGL.ExtSupported.invalidateFramebuffer = true;
+
+    GLint numExt = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &numExt);
+    for (int i = 0; i < numExt; i++)
+    {
+        const char *extName = (const char *)glGetStringi(GL_EXTENSIONS, i);
+        if (strcmp(extName, "GL_KHR_parallel_shader_compile") == 0) RLGL.ExtSupported.parallelShaderCompile = true;
+        if (strcmp(extName, "GL_EXT_texture_compression_bptc") == 0) RLGL.ExtSupported.texCompBPTC = true;
+        if (strcmp(extName, "GL_EXT_texture_compression_rgtc") == 0) RLGL.ExtSupported.texCompRGTC = true;
+    }
     // TODO: Check for additional OpenGL ES 3.0 supported extensions:
     //RLGL.ExtSupported.texCompDXT = true;
     //RLGL.ExtSupported.texCompETC1 = true;
@@ -2611,11 +4699,27 @@ void rlLoadExtensions(void *loader)
         // Check texture compression support: ASTC
         if (strcmp(extList[i], (const char *)"GL_KHR_texture_compression_astc_hdr") == 0) RLGL.ExtSupported.texCompASTC = true;
 
+        // Check texture compression support: BPTC
+        if (strcmp(extList[i], (const char *)"GL_EXT_texture_compression_bptc") == 0) RLGL.ExtSupported.texCompBPTC = true;
+
+        // Check texture compression support: RGTC
+        if (strcmp(extList[i], (const char *)"GL_EXT_texture_compression_rgtc") == 0) RLGL.ExtSupported.texCompRGTC = true;
+
         // Check anisotropic texture filter support
         if (strcmp(extList[i], (const char *)"GL_EXT_texture_filter_anisotropic") == 0) RLGL.ExtSupported.texAnisoFilter = true;
 
         // Check clamp mirror wrap mode support
         if (strcmp(extList[i], (const char *)"GL_EXT_texture_mirror_clamp") == 0) RLGL.ExtSupported.texMirrorClamp = true;
+
+        // Parallel shader compile support
+        if (strcmp(extList[i], (const char *)"GL_KHR_parallel_shader_compile") == 0) RLGL.ExtSupported.parallelShaderCompile = true;
+
+        // Framebuffer invalidation support
+        if (strcmp(extList[i], (const char *)"GL_EXT_discard_framebuffer") == 0)
+        {
+            glDiscardFramebuffer = (PFNGLDISCARDFRAMEBUFFEREXTPROC)((rlglLoadProc)loader)("glDiscardFramebufferEXT");
+            if (glDiscardFramebuffer != NULL) RLGL.ExtSupported.invalidateFramebuffer = true;
+        }
     }
 
     // Free extensions pointers
@@ -2641,6 +4745,24 @@ void rlLoadExtensions(void *loader)
     #endif
     glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &RLGL.ExtSupported.maxAnisotropyLevel);
 
+    // Let driver use as many background threads as possible for shader compilation
+    if (RLGL.ExtSupported.parallelShaderCompile && (loader != NULL))
+    {
+        void (*maxShaderCompilerThreads)(GLuint count) = (void (*)(GLuint))((rlglLoadProc)loader)("glMaxShaderCompilerThreadsKHR");
+        if (maxShaderCompilerThreads == NULL) maxShaderCompilerThreads = (void (*)(GLuint))((rlglLoadProc)loader)("glMaxShaderCompilerThreadsARB");
+        if (maxShaderCompilerThreads != NULL) maxShaderCompilerThreads(0xffffffff);
+    }
+
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    // NOTE: Some drivers expose program binary functions with no binary format supported
+    if (RLGL.ExtSupported.programBinary)
+    {
+        GLint binaryFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+        RLGL.ExtSupported.programBinary = (binaryFormats > 0);
+    }
+#endif
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
     // Show some OpenGL GPU capabilities
     TRACELOG(RL_LOG_INFO, "GL: OpenGL capabilities:");
@@ -2685,8 +4807,14 @@ void rlLoadExtensions(void *loader)
     if (RLGL.ExtSupported.texCompETC2) TRACELOG(RL_LOG_INFO, "GL: ETC2/EAC compressed textures supported");
     if (RLGL.ExtSupported.texCompPVRT) TRACELOG(RL_LOG_INFO, "GL: PVRT compressed textures supported");
     if (RLGL.ExtSupported.texCompASTC) TRACELOG(RL_LOG_INFO, "GL: ASTC compressed textures supported");
+    if (RLGL.ExtSupported.texCompBPTC) TRACELOG(RL_LOG_INFO, "GL: BPTC compressed textures supported");
+    if (RLGL.ExtSupported.texCompRGTC) TRACELOG(RL_LOG_INFO, "GL: RGTC compressed textures supported");
     if (RLGL.ExtSupported.computeShader) TRACELOG(RL_LOG_INFO, "GL: Compute shaders supported");
     if (RLGL.ExtSupported.ssbo) TRACELOG(RL_LOG_INFO, "GL: rl_Shader storage buffer objects supported");
+    if (RLGL.ExtSupported.bufferStorage) TRACELOG(RL_LOG_INFO, "GL: Persistent mapped buffers supported");
+    if (RLGL.ExtSupported.programBinary) TRACELOG(RL_LOG_INFO, "GL: Shader program binaries supported");
+    if (RLGL.ExtSupported.parallelShaderCompile) TRACELOG(RL_LOG_INFO, "GL: Parallel shader compile supported");
+    if (RLGL.ExtSupported.invalidateFramebuffer) TRACELOG(RL_LOG_INFO, "GL: Framebuffer invalidation supported");
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
@@ -2728,9 +4856,33 @@ int rlGetVersion(void)
     return glVersion;
 }
 
+// Get OpenGL driver info string (vendor, renderer, version)
+// NOTE: Useful to identify driver-dependant data, i.e. shader program binaries
+const char *rlGetDriverInfo(void)
+{
+    static RL_CONTEXT_LOCAL char info[512] = { 0 };
+    info[0] = '\0';
+
+    const char *strings[3] = { (const char *)glGetString(GL_VENDOR), (const char *)glGetString(GL_RENDERER), (const char *)glGetString(GL_VERSION) };
+    for (int i = 0; i < 3; i++)
+    {
+        if (i > 0) strncat(info, " | ", sizeof(info) - strlen(info) - 1);
+        if (strings[i] != NULL) strncat(info, strings[i], sizeof(info) - strlen(info) - 1);
+    }
+
+    return info;
+}
+
 // Set current framebuffer width
 void rlSetFramebufferWidth(int width)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordCommand(RL_COMMAND_FRAMEBUFFER_WIDTH, &width, sizeof(int));
+        return;
+    }
+#endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     RLGL.State.framebufferWidth = width;
 #endif
@@ -2739,6 +4891,13 @@ void rlSetFramebufferWidth(int width)
 // Set current framebuffer height
 void rlSetFramebufferHeight(int height)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordCommand(RL_COMMAND_FRAMEBUFFER_HEIGHT, &height, sizeof(int));
+        return;
+    }
+#endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     RLGL.State.framebufferHeight = height;
 #endif
@@ -2804,18 +4963,27 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return batch; }
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    bool persistent = false;
+#if defined(RLGL_ENABLE_PERSISTENT_BATCH_BUFFERS) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // NOTE: Persistent mapping requires VAO support, vertex attributes are configured only once
+    persistent = RLGL.ExtSupported.bufferStorage && RLGL.ExtSupported.vao;
+
+    // Persistent buffers are reused in a ring, a minimum number of buffers is required
+    // to let the CPU fill one buffer while the GPU is still reading the previous ones
+    if (persistent && (numBuffers < RL_DEFAULT_BATCH_PERSISTENT_BUFFERS)) numBuffers = RL_DEFAULT_BATCH_PERSISTENT_BUFFERS;
+#endif
+
     // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
+    // NOTE: In case of persistent mapping, vertex data arrays are mapped later from GPU memory
     //--------------------------------------------------------------------------------------------
     batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(numBuffers, sizeof(rlVertexBuffer));
 
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
+        batch.vertexBuffer[i].persistent = persistent;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));     // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_CALLOC(bufferElements*2*4, sizeof(float));    // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].normals = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));      // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_CALLOC(bufferElements*4*4, sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+        if (!persistent) rlLoadBatchVertexArrays(&batch.vertexBuffer[i]);
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_CALLOC(bufferElements*6, sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2823,11 +4991,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_CALLOC(bufferElements*6, sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2851,20 +5014,83 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 
     // Upload to GPU (VRAM) vertex data and initialize VAOs/VBOs
     //--------------------------------------------------------------------------------------------
+    int mappedCount = 0;
+
     for (int i = 0; i < numBuffers; i++)
     {
         if (RLGL.ExtSupported.vao)
         {
             // Initialize Quads VAO
             glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlCacheBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
+#if defined(RLGL_ENABLE_PERSISTENT_BATCH_BUFFERS) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+        if (batch.vertexBuffer[i].persistent)
+        {
+            bool mapped = false;
+    #if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+            // Quads - Persistently mapped interleaved vertex buffer, CPU writes go directly to GPU-visible memory
+            batch.vertexBuffer[i].data = (rlBatchVertex *)rlMapPersistentBuffer(&batch.vertexBuffer[i].vboId[0], bufferElements*4*sizeof(rlBatchVertex));
+            rlSetBatchVertexAttributes();
+
+            mapped = (batch.vertexBuffer[i].data != NULL);
+    #else
+            // Quads - Persistently mapped vertex buffers, CPU writes go directly to GPU-visible memory
+            batch.vertexBuffer[i].vertices = (float *)rlMapPersistentBuffer(&batch.vertexBuffer[i].vboId[0], bufferElements*3*4*sizeof(float));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+
+            batch.vertexBuffer[i].texcoords = (float *)rlMapPersistentBuffer(&batch.vertexBuffer[i].vboId[1], bufferElements*2*4*sizeof(float));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+            batch.vertexBuffer[i].normals = (float *)rlMapPersistentBuffer(&batch.vertexBuffer[i].vboId[2], bufferElements*3*4*sizeof(float));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+
+            batch.vertexBuffer[i].colors = (unsigned char *)rlMapPersistentBuffer(&batch.vertexBuffer[i].vboId[3], bufferElements*4*4*sizeof(unsigned char));
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+
+            mapped = (batch.vertexBuffer[i].vertices != NULL) && (batch.vertexBuffer[i].texcoords != NULL) &&
+                (batch.vertexBuffer[i].normals != NULL) && (batch.vertexBuffer[i].colors != NULL);
+    #endif
+
+            if (mapped)
+            {
+                // Fill index buffer
+                glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+                glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(int), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
+                rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[4], RL_GPU_MEMORY_INDEX_BUFFER, (long long)bufferElements*6*sizeof(int));
+
+                mappedCount++;
+                continue;
+            }
+
+            // Persistent mapping failed, buffers are deleted and vertex data is kept in CPU arrays,
+            // uploaded on every draw to orphaned buffers like without persistent mapping support
+            TRACELOG(RL_LOG_WARNING, "RLGL: Render batch buffer %i could not be mapped, using CPU (RAM) vertex data", i);
+            rlUnloadPersistentBuffers(&batch.vertexBuffer[i]);
+            batch.vertexBuffer[i].persistent = false;
+            rlLoadBatchVertexArrays(&batch.vertexBuffer[i]);
+        }
+#endif
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+        // Quads - Interleaved vertex buffer binding and attributes enable (shader-locations = 0, 1, 2, 3)
+        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(rlBatchVertex), batch.vertexBuffer[i].data, GL_DYNAMIC_DRAW);
+        rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[0], RL_GPU_MEMORY_VERTEX_BUFFER, (long long)bufferElements*4*sizeof(rlBatchVertex));
+        rlSetBatchVertexAttributes();
+#else
         // Quads - Vertex buffers binding and attributes enable
         // Vertex position buffer (shader-location = 0)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
         glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+        rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[0], RL_GPU_MEMORY_VERTEX_BUFFER, (long long)bufferElements*3*4*sizeof(float));
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
 
@@ -2872,6 +5098,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
         glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+        rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[1], RL_GPU_MEMORY_VERTEX_BUFFER, (long long)bufferElements*2*4*sizeof(float));
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
 
@@ -2879,6 +5106,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
         glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
+        rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[2], RL_GPU_MEMORY_VERTEX_BUFFER, (long long)bufferElements*3*4*sizeof(float));
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
 
@@ -2886,24 +5114,29 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
         glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
         glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+        rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[3], RL_GPU_MEMORY_VERTEX_BUFFER, (long long)bufferElements*4*4*sizeof(unsigned char));
         glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
         glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+#endif
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[4]);
 #if defined(GRAPHICS_API_OPENGL_33)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(int), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
+        rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[4], RL_GPU_MEMORY_INDEX_BUFFER, (long long)bufferElements*6*sizeof(int));
 #endif
 #if defined(GRAPHICS_API_OPENGL_ES2)
         glBufferData(GL_ELEMENT_ARRAY_BUFFER, bufferElements*6*sizeof(short), batch.vertexBuffer[i].indices, GL_STATIC_DRAW);
+        rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[4], RL_GPU_MEMORY_INDEX_BUFFER, (long long)bufferElements*6*sizeof(short));
 #endif
     }
 
-    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+    if (mappedCount > 0) TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers mapped successfully in VRAM (GPU) [%i/%i buffers]", mappedCount, numBuffers);
+    else TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
     //--------------------------------------------------------------------------------------------
 
     // Init draw calls tracking system
@@ -2945,15 +5178,41 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Unbind VAO attribs data
         if (RLGL.ExtSupported.vao)
         {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlCacheBindVertexArray(batch.vertexBuffer[i].vaoId);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
-            glBindVertexArray(0);
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXINDEX);
+#endif
+            rlCacheBindVertexArray(0);
         }
 
+#if defined(RLGL_ENABLE_PERSISTENT_BATCH_BUFFERS) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+        if (batch.vertexBuffer[i].persistent)
+        {
+            // Make sure GPU is done with the buffer before unmapping it
+            rlWaitBufferFence(&batch.vertexBuffer[i]);
+
+            for (int j = 0; j < 4; j++)
+            {
+                if (batch.vertexBuffer[i].vboId[j] == 0) continue;  // Interleaved layout only uses first VBO
+                glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[j]);
+                glUnmapBuffer(GL_ARRAY_BUFFER);
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+            // Mapped memory is not owned by the CPU, avoid freeing it
+            batch.vertexBuffer[i].data = NULL;
+            batch.vertexBuffer[i].vertices = NULL;
+            batch.vertexBuffer[i].texcoords = NULL;
+            batch.vertexBuffer[i].normals = NULL;
+            batch.vertexBuffer[i].colors = NULL;
+        }
+#endif
         // Delete VBOs from GPU (VRAM)
+        for (int k = 0; k < 5; k++) rlUntrackGpuMemory(RL_GPU_OBJECT_BUFFER, batch.vertexBuffer[i].vboId[k]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
@@ -2961,9 +5220,14 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
 
         // Delete VAOs from GPU (VRAM)
-        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        if (RLGL.ExtSupported.vao)
+        {
+            if (RLGL.Cache.vaoId == batch.vertexBuffer[i].vaoId) RLGL.Cache.vaoId = -1;
+            glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        }
 
         // Free vertex arrays memory from CPU (RAM)
+        RL_FREE(batch.vertexBuffer[i].data);
         RL_FREE(batch.vertexBuffer[i].vertices);
         RL_FREE(batch.vertexBuffer[i].texcoords);
         RL_FREE(batch.vertexBuffer[i].normals);
@@ -2981,16 +5245,52 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 // NOTE: We require a pointer to reset batch and increase current buffer (multi-buffer)
 void rlDrawRenderBatch(rlRenderBatch *batch)
 {
+    RL_PROFILE_ZONE_BEGIN("rlDrawRenderBatch");
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Update batch vertex buffers
-    //------------------------------------------------------------------------------------------------------------
-    // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
+    // Reorder draw calls (and vertex data) by state if sorting is enabled
+    if (RLGL.State.batchSorting && (batch->drawCounter > 1)) rlSortRenderBatch(batch);
+
+    // Record batch draws into drawing list instead of drawing them, batch is just reset
+    if (RLGL.DrawingList.recording && (RLGL.State.vertexCounter > 0))
+    {
+        rlRecordDrawingList(batch);
+        RLGL.State.vertexCounter = 0;
+    }
+
+    // Update batch vertex buffers
+    //------------------------------------------------------------------------------------------------------------
+    // NOTE: If there is not vertex data, buffers doesn't need to be updated (vertexCount > 0)
     // TODO: If no data changed on the CPU arrays there is no need to re-upload data to GPU,
     // a flag can be used to detect changes but it would imply keeping a copy buffer and memcmp() both, does it worth it?
-    if (RLGL.State.vertexCounter > 0)
+    // NOTE: Persistently mapped buffers already contain the data written by rlVertex3f(), no upload required
+    if ((RLGL.State.vertexCounter > 0) && !batch->vertexBuffer[batch->currentBuffer].persistent)
     {
         // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+        // Interleaved vertex buffer, all vertex attributes uploaded at once
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+    #if defined(RLGL_ENABLE_PERSISTENT_BATCH_BUFFERS)
+        // Persistent mapping not supported, orphan buffer storage before updating it (no stall)
+        glBufferData(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].elementCount*4*sizeof(rlBatchVertex), NULL, GL_DYNAMIC_DRAW);
+    #endif
+        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(rlBatchVertex), batch->vertexBuffer[batch->currentBuffer].data);
+#else
+    #if defined(RLGL_ENABLE_PERSISTENT_BATCH_BUFFERS)
+        // Persistent mapping not supported, orphan buffers storage before updating them,
+        // driver provides a new memory block and GPU keeps reading the previous one (no stall)
+        int elementCount = batch->vertexBuffer[batch->currentBuffer].elementCount;
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+        glBufferData(GL_ARRAY_BUFFER, elementCount*3*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+        glBufferData(GL_ARRAY_BUFFER, elementCount*2*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+        glBufferData(GL_ARRAY_BUFFER, elementCount*3*4*sizeof(float), NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+        glBufferData(GL_ARRAY_BUFFER, elementCount*4*4*sizeof(unsigned char), NULL, GL_DYNAMIC_DRAW);
+    #endif
 
         // Vertex positions buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
@@ -3011,6 +5311,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
         glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
         //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+#endif
 
         // NOTE: glMapBuffer() causes sync issue
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job
@@ -3028,7 +5329,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // glUnmapBuffer(GL_ARRAY_BUFFER);
 
         // Unbind the current VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+        if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -3037,6 +5338,13 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     rl_Matrix matProjection = RLGL.State.projection;
     rl_Matrix matModelView = RLGL.State.modelview;
 
+    // Update render stats, stereo rendering draws are counted once
+    if (RLGL.State.vertexCounter > 0)
+    {
+        RLGL.Stats.batchFlushes++;
+        RLGL.Stats.flushReasons[RLGL.State.flushReason]++;
+    }
+
     int eyeCount = 1;
     if (RLGL.State.stereoRender) eyeCount = 2;
 
@@ -3057,7 +5365,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.State.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            rlCacheUseProgram(RLGL.State.currentShaderId);
 
             // Create modelview-projection matrix and upload to shader
             rl_Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
@@ -3086,9 +5394,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
             }
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+                // Bind vertex attribs: position, texcoord, normal, color (shader-locations = 0, 1, 2, 3)
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                rlSetBatchVertexAttributes();
+#else
                 // Bind vertex attrib: position (shader-location = 0)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
@@ -3108,6 +5421,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
                 glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
                 glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+#endif
 
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
             }
@@ -3122,19 +5436,36 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlCacheActiveTexture(GL_TEXTURE0 + 1 + i);
+
+                    // NOTE: Only 2D textures bindings are tracked by state cache
+                    if (RLGL.State.activeTextureTarget[i] == GL_TEXTURE_2D) rlCacheBindTexture(RLGL.State.activeTextureId[i]);
+                    else glBindTexture(RLGL.State.activeTextureTarget[i], RLGL.State.activeTextureId[i]);
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+            rlCacheActiveTexture(GL_TEXTURE0);
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
                 // Bind current draw call texture, activated as GL_TEXTURE0 and bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                rlCacheBindTexture(batch->draws[i].textureId);
+
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+                // Bind additional draw call textures, placed after additional sampler textures units
+                if (batch->draws[i].textureCount > 1)
+                {
+                    for (int t = 1; t < batch->draws[i].textureCount; t++)
+                    {
+                        rlCacheActiveTexture(GL_TEXTURE0 + RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + t);
+                        rlCacheBindTexture(batch->draws[i].textureIds[t]);
+                    }
+
+                    rlCacheActiveTexture(GL_TEXTURE0);
+                }
+#endif
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -3150,6 +5481,9 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     #endif
                 }
 
+                RLGL.Stats.drawCalls++;
+                RLGL.Stats.vertices += batch->draws[i].vertexCount;
+
                 vertexOffset += (batch->draws[i].vertexCount + batch->draws[i].vertexAlignment);
             }
 
@@ -3159,22 +5493,33 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
 
-            glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+            rlCacheBindTexture(0);    // Unbind textures
         }
 
-        if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
+        if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0); // Unbind VAO
 
-        glUseProgram(0);    // Unbind shader program
+        rlCacheUseProgram(0);    // Unbind shader program
     }
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+#if defined(RLGL_ENABLE_PERSISTENT_BATCH_BUFFERS) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // Insert a fence after the draw calls reading current buffer,
+    // it will be checked before the CPU writes again into this buffer
+    if (batch->vertexBuffer[batch->currentBuffer].persistent && (RLGL.State.vertexCounter > 0))
+    {
+        if (batch->vertexBuffer[batch->currentBuffer].syncFence != NULL) glDeleteSync((GLsync)batch->vertexBuffer[batch->currentBuffer].syncFence);
+        batch->vertexBuffer[batch->currentBuffer].syncFence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
     //------------------------------------------------------------------------------------------------------------
     // Reset vertex counter for next frame
     RLGL.State.vertexCounter = 0;
+    RLGL.State.flushReason = RL_BATCH_FLUSH_EXPLICIT;
 
     // Reset depth for next draw
     batch->currentDepth = -1.0f;
@@ -3188,7 +5533,12 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     {
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
+        batch->draws[i].vertexAlignment = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].layer = RLGL.State.currentLayer;
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+        batch->draws[i].textureCount = 0;
+#endif
     }
 
     // Reset active texture units for next batch
@@ -3201,7 +5551,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(RLGL_ENABLE_PERSISTENT_BATCH_BUFFERS) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // Next buffer could still be in use by the GPU, wait for it before writing new vertex data
+    // NOTE: With enough buffers in the ring the fence is usually already signaled
+    if (batch->vertexBuffer[batch->currentBuffer].persistent) rlWaitBufferFence(&batch->vertexBuffer[batch->currentBuffer]);
+#endif
 #endif
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    // NOTE: Software backend accumulates vertex data on its own batch arrays
+    rlDrawSoftwareBatch();
+#endif
+
+    RL_PROFILE_ZONE_END();
 }
 
 // Set the active render batch for rlgl
@@ -3218,9 +5580,82 @@ void rlSetRenderBatchActive(rlRenderBatch *batch)
 // Update and draw internal render batch
 void rlDrawRenderBatchActive(void)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        int reason = RL_BATCH_FLUSH_EXPLICIT;
+        rlRecordCommand(RL_COMMAND_FLUSH, &reason, sizeof(int));
+        return;
+    }
+#endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
 #endif
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    rlDrawSoftwareBatch();
+    swFinish();     // Rasterize binned primitives (SW_RASTER_THREADS), framebuffer could be consumed next
+#endif
+}
+
+// Update and draw internal render batch, recording flush reason on render stats
+void rlFlushRenderBatch(int reason)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlRecordCommand(RL_COMMAND_FLUSH, &reason, sizeof(int));
+        return;
+    }
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((reason >= 0) && (reason < RL_BATCH_FLUSH_REASON_COUNT)) RLGL.State.flushReason = reason;
+    rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Flush reason is reset after drawing
+#endif
+}
+
+// Get render statistics
+rlRenderStats rlGetRenderStats(void)
+{
+    rlRenderStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.Stats;
+#endif
+    return stats;
+}
+
+// Reset render statistics
+void rlResetRenderStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    memset(&RLGL.Stats, 0, sizeof(rlRenderStats));
+#endif
+}
+
+// Add meshes skipped by culling to render statistics
+// NOTE: Culling is done by higher level modules (rmodels), rlgl only keeps the counter
+void rlAddCulledMeshes(int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.culledMeshes += count;
+#endif
+}
+
+// Add triangles skipped by meshes levels of detail selection to render statistics
+void rlAddLodSavedTriangles(int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.lodSavedTriangles += count;
+#endif
+}
+
+// Get GPU memory stats by resource type (rlGpuMemoryType), use -1 to accumulate all types
+rlGpuMemoryStats rlGetGpuMemoryStats(int type)
+{
+    rlGpuMemoryStats stats = { 0 };
+
+    if ((type >= -1) && (type < RL_GPU_MEMORY_TYPE_COUNT)) stats = gpuMemory.stats[(type == -1)? RL_GPU_MEMORY_TYPE_COUNT : type];
+
+    return stats;
 }
 
 // Check internal buffer overflow for a given number of vertex
@@ -3229,6 +5664,10 @@ bool rlCheckRenderBatchLimit(int vCount)
 {
     bool overflow = false;
 
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL) return overflow;   // Limits are checked on replay
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if ((RLGL.State.vertexCounter + vCount) >=
         (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].elementCount*4))
@@ -3237,13 +5676,26 @@ bool rlCheckRenderBatchLimit(int vCount)
 
         // Store current primitive drawing mode and texture id
         int currentMode = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode;
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+        unsigned int currentTexture = rlGetDrawCurrentTexture(&RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1]);
+        RLGL.State.currentTextureSlot = 0;
+#else
         int currentTexture = RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId;
+#endif
 
-        rlDrawRenderBatch(RLGL.currentBatch);    // NOTE: Stereo rendering is checked inside
+        rlFlushRenderBatch(RL_BATCH_FLUSH_BUFFER_LIMIT);    // NOTE: Stereo rendering is checked inside
 
         // Restore state of last batch so we can continue adding vertices
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].layer = RLGL.State.currentLayer;
+    }
+#endif
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    if ((softwareBatch.vertexCounter + vCount) >= softwareBatch.elementCount)
+    {
+        overflow = true;
+        rlDrawSoftwareBatch();      // NOTE: Drawing mode is kept, vertex can continue to be added
     }
 #endif
 
@@ -3258,7 +5710,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     unsigned int id = 0;
     if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return id; }
 
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    rlCacheBindTexture(0);    // Free any old binding
 
     // Check texture format support by OpenGL 1.1 (compressed textures not supported)
 #if defined(GRAPHICS_API_OPENGL_11)
@@ -3298,6 +5750,18 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
         TRACELOG(RL_LOG_WARNING, "GL: ASTC compressed texture format not supported");
         return id;
     }
+
+    if ((!RLGL.ExtSupported.texCompBPTC) && (format == RL_PIXELFORMAT_COMPRESSED_BC7_RGBA))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: BPTC compressed texture format not supported");
+        return id;
+    }
+
+    if ((!RLGL.ExtSupported.texCompRGTC) && (format == RL_PIXELFORMAT_COMPRESSED_BC4_R))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: RGTC compressed texture format not supported");
+        return id;
+    }
 #endif
 #endif  // GRAPHICS_API_OPENGL_11
 
@@ -3305,12 +5769,11 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 
     glGenTextures(1, &id);              // Generate texture id
 
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(id);
 
     int mipWidth = width;
     int mipHeight = height;
-    int mipOffset = 0;          // Mipmap data offset, only used for tracelog
-    (void)mipOffset;            // Used to avoid gcc warnings about unused variable
+    int mipOffset = 0;          // Mipmap data offset, total size after loading all levels (GPU memory stats)
 
     // NOTE: Added pointer math separately from function to avoid UBSAN complaining
     unsigned char *dataPtr = NULL;
@@ -3408,7 +5871,9 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     // NOTE: If mipmaps were not in data, they are not generated automatically
 
     // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(0);
+
+    rlTrackGpuMemory(RL_GPU_OBJECT_TEXTURE, id, RL_GPU_MEMORY_TEXTURE, mipOffset);
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] rl_Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
@@ -3445,7 +5910,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
     if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
     {
         glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
+        rlCacheBindTexture(id);
         glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -3453,7 +5918,9 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+        rlCacheBindTexture(0);
+
+        rlTrackGpuMemory(RL_GPU_OBJECT_TEXTURE, id, RL_GPU_MEMORY_RENDER_TARGET, (long long)width*height*((RLGL.ExtSupported.maxDepthBits >= 24)? 4 : 2));
 
         TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
     }
@@ -3467,6 +5934,8 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
 
         glBindRenderbuffer(GL_RENDERBUFFER, 0);
 
+        rlTrackGpuMemory(RL_GPU_OBJECT_RENDERBUFFER, id, RL_GPU_MEMORY_RENDER_TARGET, (long long)width*height*((RLGL.ExtSupported.maxDepthBits >= 24)? 4 : 2));
+
         TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth renderbuffer loaded successfully (%i bits)", id, (RLGL.ExtSupported.maxDepthBits >= 24)? RLGL.ExtSupported.maxDepthBits : 16);
     }
 #endif
@@ -3474,6 +5943,38 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
     return id;
 }
 
+// Load depth texture array, one depth layer per array layer
+// NOTE: Depth comparison enabled (GL_COMPARE_REF_TO_TEXTURE), layers are sampled with sampler2DArrayShadow
+// and linear filtering gets hardware percentage-closer filtering, requires OpenGL 3.3 or OpenGL ES 3.0
+unsigned int rlLoadTextureDepthArray(int width, int height, int layers)
+{
+    unsigned int id = 0;
+    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return id; }
+
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glGenTextures(1, &id);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT24, width, height, layers, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+
+    rlTrackGpuMemory(RL_GPU_OBJECT_TEXTURE, id, RL_GPU_MEMORY_RENDER_TARGET, (long long)width*height*layers*4);
+
+    TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Depth texture array loaded successfully (%ix%i, %i layers)", id, width, height, layers);
+#else
+    TRACELOG(RL_LOG_WARNING, "TEXTURE: Depth texture arrays not supported, requires OpenGL 3.3 or OpenGL ES 3.0");
+#endif
+
+    return id;
+}
+
 // Load texture cubemap
 // NOTE: Cubemap data is expected to be 6 images in a single data array (one after the other),
 // expected the following convention: +X, -X, +Y, -Y, +Z, -Z
@@ -3564,6 +6065,8 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
 #endif
 
     glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+
+    rlTrackGpuMemory(RL_GPU_OBJECT_TEXTURE, id, RL_GPU_MEMORY_TEXTURE, rlGetTextureMipmapsSize(size, size, format, mipmapCount)*6);
 #endif
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
@@ -3572,11 +6075,26 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
     return id;
 }
 
+// Load texture array (GL_TEXTURE_2D_ARRAY), all layers share size and format
+// NOTE: Data is expected as mipmap levels one after the other, every level containing all layers (one after the other)
+unsigned int rlLoadTextureArray(const void *data, int width, int height, int layers, int format, int mipmapCount)
+{
+    return rlLoadTextureLayers(RL_TEXTURE_2D_ARRAY, data, width, height, layers, format, mipmapCount);
+}
+
+// Load 3D texture (GL_TEXTURE_3D)
+// NOTE: Data is expected as mipmap levels one after the other, every level containing all depth slices (one after the other),
+// mipmap levels halve depth as well as width and height
+unsigned int rlLoadTexture3D(const void *data, int width, int height, int depth, int format, int mipmapCount)
+{
+    return rlLoadTextureLayers(RL_TEXTURE_3D, data, width, height, depth, format, mipmapCount);
+}
+
 // Update already loaded texture in GPU with new data
 // NOTE: We don't know safely if internal texture format is the expected one...
 void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3588,430 +6106,1057 @@ void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int h
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 }
 
-// Get OpenGL internal formats and data type from raylib rl_PixelFormat
-void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
+// Update already loaded texture in GPU with new mipmap levels data (base level included)
+// NOTE: Used to upload mipmaps generated on CPU when GPU mipmap generation is not available
+void rlUpdateTextureMipmaps(unsigned int id, int width, int height, int format, const void *data, int mipmapCount)
 {
-    *glInternalFormat = 0;
-    *glFormat = 0;
-    *glType = 0;
-
-    switch (format)
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Mipmaps not supported by software renderer", id);
+#else
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: OpenGL ES 2.0 with no GL_OES_texture_npot support can not use mipmaps on NPOT textures
+    if (!RLGL.ExtSupported.texNPOT && (((width & (width - 1)) != 0) || ((height & (height - 1)) != 0)))
     {
-    #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
-        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        #if !defined(GRAPHICS_API_OPENGL_11)
-        #if defined(GRAPHICS_API_OPENGL_ES3)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F_EXT; *glFormat = GL_RED_EXT; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F_EXT; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F_EXT; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_R16F_EXT; *glFormat = GL_RED_EXT; *glType = GL_HALF_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB16F_EXT; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA16F_EXT; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT; break;
-        #else
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;            // NOTE: Requires extension OES_texture_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;                  // NOTE: Requires extension OES_texture_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;             // NOTE: Requires extension OES_texture_float
-        #if defined(GRAPHICS_API_OPENGL_21)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_HALF_FLOAT_ARB; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT_ARB; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT_ARB; break;
-        #else // defined(GRAPHICS_API_OPENGL_ES2)
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_HALF_FLOAT_OES; break;   // NOTE: Requires extension OES_texture_half_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT_OES; break;         // NOTE: Requires extension OES_texture_half_float
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT_OES; break;    // NOTE: Requires extension OES_texture_half_float
-        #endif
-        #endif
-        #endif
-    #elif defined(GRAPHICS_API_OPENGL_33)
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_R16F; *glFormat = GL_RED; *glType = GL_HALF_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB16F; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT; break;
-        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA16F; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT; break;
-    #endif
-    #if !defined(GRAPHICS_API_OPENGL_11)
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
-        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: if (RLGL.ExtSupported.texCompETC1) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
-    #endif
-        default: TRACELOG(RL_LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Mipmaps not supported for NPOT textures", id);
+        return;
     }
-}
-
-// Unload texture from GPU memory
-void rlUnloadTexture(unsigned int id)
-{
-    glDeleteTextures(1, &id);
-}
+#endif
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-// Generate mipmap data for selected texture
-// NOTE: Only supports GPU mipmap generation
-void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_2D, id);
+    if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        rlCacheBindTexture(id);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-    // Check if texture is power-of-two (POT)
-    bool texIsPOT = false;
+        const unsigned char *dataPtr = (const unsigned char *)data;
+        int mipWidth = width;
+        int mipHeight = height;
 
-    if (((width > 0) && ((width & (width - 1)) == 0)) &&
-        ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
+        for (int i = 0; i < mipmapCount; i++)
+        {
+            glTexImage2D(GL_TEXTURE_2D, i, glInternalFormat, mipWidth, mipHeight, 0, glFormat, glType, dataPtr);
+            dataPtr += rlGetPixelDataSize(mipWidth, mipHeight, format);
 
-    if ((texIsPOT) || (RLGL.ExtSupported.texNPOT))
-    {
-        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorithm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
-        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
+            mipWidth = (mipWidth/2 < 1)? 1 : mipWidth/2;
+            mipHeight = (mipHeight/2 < 1)? 1 : mipHeight/2;
+        }
 
-        #define MIN(a,b) (((a)<(b))? (a):(b))
-        #define MAX(a,b) (((a)>(b))? (a):(b))
+        rlCacheBindTexture(0);
 
-        *mipmaps = 1 + (int)floor(log(MAX(width, height))/log(2));
-        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
+        rlTrackGpuMemory(RL_GPU_OBJECT_TEXTURE, id, RL_GPU_MEMORY_TEXTURE, rlGetTextureMipmapsSize(width, height, format, mipmapCount));
     }
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
-
-    glBindTexture(GL_TEXTURE_2D, 0);
-#else
-    TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update mipmaps for current texture format (%i)", id, format);
 #endif
 }
 
-// Read texture pixel data
-void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
+// Update already loaded texture array layer in GPU with new data
+void rlUpdateTextureArray(unsigned int id, int layer, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    void *pixels = NULL;
-
-#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
-
-    // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
-    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
-    //int width, height, format;
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
-    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
-
-    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding
-    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting
-    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
-    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
-    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindTexture(GL_TEXTURE_2D_ARRAY, id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
-    unsigned int size = rlGetPixelDataSize(width, height, format);
 
     if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
     {
-        pixels = RL_CALLOC(size, 1);
-        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, offsetX, offsetY, layer, width, height, 1, glFormat, glType, data);
     }
-    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
 #endif
-
-#if defined(GRAPHICS_API_OPENGL_ES2)
-    // glGetTexImage() is not available on OpenGL ES 2.0
-    // rl_Texture width and height are required on OpenGL ES 2.0, there is no way to get it from texture id
-    // Two possible Options:
-    // 1 - Bind texture to color fbo attachment and glReadPixels()
-    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
-    // We are using Option 1, just need to care for texture format on retrieval
-    // NOTE: This behaviour could be conditioned by graphic driver...
-    unsigned int fboId = rlLoadFramebuffer();
-
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
-
-    // Attach our texture to FBO
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
-
-    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
-    pixels = RL_CALLOC(rlGetPixelDataSize(width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8), 1);
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
-
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-    // Clean up temporal fbo
-    rlUnloadFramebuffer(fboId);
-#endif
-
-    return pixels;
 }
 
-// Copy framebuffer pixel data to internal buffer
-void rlCopyFramebuffer(int x, int y, int width, int height, int format, void *pixels)
+// Update already loaded 3D texture in GPU with new data
+void rlUpdateTexture3D(unsigned int id, int offsetX, int offsetY, int offsetZ, int width, int height, int depth, int format, const void *data)
 {
-#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindTexture(GL_TEXTURE_3D, id);
+
     unsigned int glInternalFormat, glFormat, glType;
-    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType); // Get OpenGL texture format
-    swCopyFramebuffer(x, y, width, height, glFormat, glType, pixels);
-#endif
-}
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-// Resize internal framebuffer
-void rlResizeFramebuffer(int width, int height)
-{
-#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
-    swResizeFramebuffer(width, height);
+    if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        glTexSubImage3D(GL_TEXTURE_3D, 0, offsetX, offsetY, offsetZ, width, height, depth, glFormat, glType, data);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to update for current texture format (%i)", id, format);
+
+    glBindTexture(GL_TEXTURE_3D, 0);
 #endif
 }
 
-// Read screen pixel data (color buffer)
-unsigned char *rlReadScreenPixels(int width, int height)
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+// Retire oldest async upload, waiting for its fence if required
+static bool rlRetireTextureUpload(bool wait)
 {
-    unsigned char *imgData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+    if (RLGL.Upload.count == 0) return false;
 
-    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
-    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
-    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, imgData);
+    GLsync fence = (GLsync)RLGL.Upload.pending[RLGL.Upload.first].fence;
+    GLenum result = glClientWaitSync(fence, wait? GL_SYNC_FLUSH_COMMANDS_BIT : 0, wait? 1000000000 : 0);   // Timeout: 1 second
 
-    // Flip image vertically!
-    // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
-    for (int y = height - 1; y >= height/2; y--)
+    if ((result == GL_TIMEOUT_EXPIRED) || (result == GL_WAIT_FAILED))
     {
-        for (int x = 0; x < (width*4); x += 4)
-        {
-            unsigned int s = ((height - 1) - y)*width*4 + x;
-            unsigned int e = y*width*4 + x;
-
-            unsigned char r = imgData[s];
-            unsigned char g = imgData[s+1];
-            unsigned char b = imgData[s+2];
-
-            imgData[s] = imgData[e];
-            imgData[s+1] = imgData[e+1];
-            imgData[s+2] = imgData[e+2];
-            imgData[s+3] = 255; // Set alpha component value to 255 (no trasparent image retrieval)
-
-            imgData[e] = r;
-            imgData[e+1] = g;
-            imgData[e+2] = b;
-            imgData[e+3] = 255; // Ditto
-        }
+        if (!wait) return false;
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Async upload fence wait failed", RLGL.Upload.pending[RLGL.Upload.first].textureId);
     }
 
-    return imgData;     // NOTE: image data should be freed
-}
-
-// Framebuffer management (fbo)
-//-----------------------------------------------------------------------------------------
-// Load a framebuffer to be used for rendering
-// NOTE: No textures attached
-unsigned int rlLoadFramebuffer(void)
-{
-    unsigned int fboId = 0;
-    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return fboId; }
-
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
-#endif
+    glDeleteSync(fence);
+    RLGL.Upload.first = (RLGL.Upload.first + 1)%RL_MAX_ASYNC_UPLOADS;
+    RLGL.Upload.count--;
 
-    return fboId;
+    return true;
 }
 
-// Attach color buffer texture to an fbo (unloads previous attachment)
-// NOTE: Attach type: 0-rl_Color, 1-Depth renderbuffer, 2-Depth texture
-void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
+// Allocate staging ring region, waiting for uploads in flight to release space if required
+// NOTE: Regions are released in order, free space is [head, tail) with wrap-around
+static int rlAllocTextureUpload(int size)
 {
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    size = (size + 15) & ~15;     // Keep regions 16 bytes aligned
 
-    switch (attachType)
+    while (true)
     {
-        case RL_ATTACHMENT_COLOR_CHANNEL0:
-        case RL_ATTACHMENT_COLOR_CHANNEL1:
-        case RL_ATTACHMENT_COLOR_CHANNEL2:
-        case RL_ATTACHMENT_COLOR_CHANNEL3:
-        case RL_ATTACHMENT_COLOR_CHANNEL4:
-        case RL_ATTACHMENT_COLOR_CHANNEL5:
-        case RL_ATTACHMENT_COLOR_CHANNEL6:
-        case RL_ATTACHMENT_COLOR_CHANNEL7:
-        {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_RENDERBUFFER, texId);
-            else if (texType >= RL_ATTACHMENT_CUBEMAP_POSITIVE_X) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_CUBE_MAP_POSITIVE_X + texType, texId, mipLevel);
-        } break;
-        case RL_ATTACHMENT_DEPTH:
+        if (RLGL.Upload.count == 0)
         {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, texId);
-        } break;
-        case RL_ATTACHMENT_STENCIL:
+            RLGL.Upload.head = size;
+            return 0;
+        }
+
+        if (RLGL.Upload.count < RL_MAX_ASYNC_UPLOADS)
         {
-            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
-            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, texId);
-        } break;
-        default: break;
-    }
+            int tail = RLGL.Upload.pending[RLGL.Upload.first].offset;
+            int head = RLGL.Upload.head;
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-#endif
+            if (head > tail)
+            {
+                if ((RL_ASYNC_UPLOAD_BUFFER_SIZE - head) >= size) { RLGL.Upload.head = head + size; return head; }
+                if (tail >= size) { RLGL.Upload.head = size; return 0; }
+            }
+            else if ((head < tail) && ((tail - head) >= size)) { RLGL.Upload.head = head + size; return head; }
+        }
+
+        rlRetireTextureUpload(true);
+    }
 }
 
-// Verify render texture is complete
-bool rlFramebufferComplete(unsigned int id)
+// Upload texture data through staging ring (all mipmap levels), completion is tracked with a fence
+static void rlUploadTextureAsync(unsigned int id, int offsetX, int offsetY, int width, int height, int format, int mipmapCount, const void *data)
 {
-    bool result = false;
-
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    glBindFramebuffer(GL_FRAMEBUFFER, id);
-
-    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-    if (status != GL_FRAMEBUFFER_COMPLETE)
+    int size = 0;
+    for (int i = 0, mipWidth = width, mipHeight = height; i < mipmapCount; i++)
     {
-        switch (status)
-        {
-            case GL_FRAMEBUFFER_UNSUPPORTED: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
-            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
-#if defined(GRAPHICS_API_OPENGL_ES2)
-            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete dimensions", id); break;
-#endif
-            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
-            default: break;
-        }
+        size += rlGetPixelDataSize(mipWidth, mipHeight, format);
+        mipWidth = (mipWidth/2 < 1)? 1 : mipWidth/2;
+        mipHeight = (mipHeight/2 < 1)? 1 : mipHeight/2;
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-    result = (status == GL_FRAMEBUFFER_COMPLETE);
-#endif
+    if (RLGL.Upload.bufferId == 0)
+    {
+        glGenBuffers(1, &RLGL.Upload.bufferId);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, RLGL.Upload.bufferId);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, RL_ASYNC_UPLOAD_BUFFER_SIZE, NULL, GL_STREAM_DRAW);
+        TRACELOG(RL_LOG_INFO, "TEXTURE: Async upload staging buffer loaded successfully (%i KB)", RL_ASYNC_UPLOAD_BUFFER_SIZE/1024);
+    }
+    else glBindBuffer(GL_PIXEL_UNPACK_BUFFER, RLGL.Upload.bufferId);
 
-    return result;
-}
+    int offset = rlAllocTextureUpload(size);
 
-// Unload framebuffer from GPU memory
-// NOTE: All attached textures/cubemaps/renderbuffers are also deleted
-void rlUnloadFramebuffer(unsigned int id)
-{
-#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
-    // Query depth attachment to automatically delete texture/renderbuffer
-    int depthType = 0, depthId = 0;
-    glBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
-    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
+    // NOTE: Unsynchronized mapping, region is guaranteed not to be in use by GPU
+    void *mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (mapped != NULL)
+    {
+        memcpy(mapped, data, size);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+    else
+    {
+        // Staging buffer not available, upload from client memory
+        TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to map async upload staging buffer, uploading synchronously", id);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
 
-    // TODO: Review warning retrieving object name in WebGL
-    // WARNING: WebGL: INVALID_ENUM: getFramebufferAttachmentParameter: invalid parameter name
-    // REF: https://registry.khronos.org/webgl/specs/latest/1.0/
-    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    rlCacheBindTexture(id);
 
-    unsigned int depthIdU = (unsigned int)depthId;
-    if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    // NOTE: Pixels are sourced from bound pixel buffer, data pointer is an offset into it
+    const unsigned char *source = (mapped != NULL)? NULL : (const unsigned char *)data;
+    int mipOffset = (mapped != NULL)? offset : 0;
+    for (int i = 0, mipWidth = width, mipHeight = height; i < mipmapCount; i++)
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, i, offsetX, offsetY, mipWidth, mipHeight, glFormat, glType, (source != NULL)? (const void *)(source + mipOffset) : (const void *)(size_t)mipOffset);
 
-    // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
-    // the texture image is automatically detached from the currently bound framebuffer
+        mipOffset += rlGetPixelDataSize(mipWidth, mipHeight, format);
+        mipWidth = (mipWidth/2 < 1)? 1 : mipWidth/2;
+        mipHeight = (mipHeight/2 < 1)? 1 : mipHeight/2;
+        offsetX /= 2;
+        offsetY /= 2;
+    }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glDeleteFramebuffers(1, &id);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
-    TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
-#endif
+    int index = (RLGL.Upload.first + RLGL.Upload.count)%RL_MAX_ASYNC_UPLOADS;
+    RLGL.Upload.pending[index].textureId = id;
+    RLGL.Upload.pending[index].fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    RLGL.Upload.pending[index].offset = offset;
+    RLGL.Upload.pending[index].size = size;
+    RLGL.Upload.count++;
 }
 
-// Vertex data management
-//-----------------------------------------------------------------------------------------
-// Load a new attributes buffer
-unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
+// Check if async upload can be done through staging ring
+static bool rlCanUploadTextureAsync(int width, int height, int format, int mipmapCount)
 {
-    unsigned int id = 0;
-    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return id; }
+    if (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) return false;     // Compressed formats uploaded synchronously
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
-#endif
+    int size = 0;
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        size += rlGetPixelDataSize(width, height, format);
+        width = (width/2 < 1)? 1 : width/2;
+        height = (height/2 < 1)? 1 : height/2;
+    }
 
-    return id;
+    return ((size + 15) <= RL_ASYNC_UPLOAD_BUFFER_SIZE);
 }
+#endif
 
-// Load a new attributes element buffer
-unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic)
+// Load texture data asynchronously
+// NOTE: Texture storage is allocated immediately and data is copied into a staging ring (PBO),
+// transfer to texture completes later on GPU, use rlIsTextureUploadReady() to check it
+// WARNING: Only supported on OpenGL 3.3 for uncompressed formats, data is uploaded synchronously otherwise
+unsigned int rlLoadTextureAsync(const void *data, int width, int height, int format, int mipmapCount)
 {
-    unsigned int id = 0;
-    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return id; }
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    if ((data != NULL) && rlCanUploadTextureAsync(width, height, format, mipmapCount))
+    {
+        unsigned int id = rlLoadTexture(NULL, width, height, format, mipmapCount);
+        if (id != 0) rlUploadTextureAsync(id, 0, 0, width, height, format, mipmapCount, data);
 
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glGenBuffers(1, &id);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+        return id;
+    }
 #endif
-
-    return id;
+    return rlLoadTexture(data, width, height, format, mipmapCount);
 }
 
-// Enable vertex buffer (VBO)
-void rlEnableVertexBuffer(unsigned int id)
+// Update texture with new data asynchronously
+// NOTE: Data is copied into staging ring (PBO) and can be freed on return
+void rlUpdateTextureAsync(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-#endif
-}
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
 
-// Disable vertex buffer (VBO)
-void rlDisableVertexBuffer(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    if ((glInternalFormat != 0) && rlCanUploadTextureAsync(width, height, format, 1))
+    {
+        rlUploadTextureAsync(id, offsetX, offsetY, width, height, format, 1, data);
+        return;
+    }
 #endif
+    rlUpdateTexture(id, offsetX, offsetY, width, height, format, data);
 }
 
-// Enable vertex buffer element (VBO element)
-void rlEnableVertexBufferElement(unsigned int id)
+// Check if texture async uploads have completed on GPU
+// NOTE: Completed uploads are retired in order, a texture is ready when none of its uploads is in flight
+bool rlIsTextureUploadReady(unsigned int id)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
-#endif
-}
+    bool ready = true;
 
-// Disable vertex buffer element (VBO element)
-void rlDisableVertexBufferElement(void)
-{
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    while (rlRetireTextureUpload(false)) { }
+
+    for (int i = 0; i < RLGL.Upload.count; i++)
+    {
+        if (RLGL.Upload.pending[(RLGL.Upload.first + i)%RL_MAX_ASYNC_UPLOADS].textureId == id) { ready = false; break; }
+    }
 #endif
+
+    return ready;
 }
 
-// Update vertex buffer with new data
-// NOTE: dataSize and offset must be provided in bytes
-void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int offset)
+// Wait for all async texture uploads to complete
+void rlSyncTextureUploads(void)
 {
-#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindBuffer(GL_ARRAY_BUFFER, id);
-    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    while (rlRetireTextureUpload(true)) { }
 #endif
 }
 
-// Update vertex buffer elements with new data
-// NOTE: dataSize and offset must be provided in bytes
-void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset)
+// Get OpenGL internal formats and data type from raylib rl_PixelFormat
+void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned int *glFormat, unsigned int *glType)
+{
+    *glInternalFormat = 0;
+    *glFormat = 0;
+    *glType = 0;
+
+    switch (format)
+    {
+    #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_21) || defined(GRAPHICS_API_OPENGL_ES2)
+        // NOTE: on OpenGL ES 2.0 (WebGL), internalFormat must match format and options allowed are: GL_LUMINANCE, GL_RGB, GL_RGBA
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_LUMINANCE_ALPHA; *glFormat = GL_LUMINANCE_ALPHA; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        #if !defined(GRAPHICS_API_OPENGL_11)
+        #if defined(GRAPHICS_API_OPENGL_ES3)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F_EXT; *glFormat = GL_RED_EXT; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F_EXT; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F_EXT; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_R16F_EXT; *glFormat = GL_RED_EXT; *glType = GL_HALF_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB16F_EXT; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA16F_EXT; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT; break;
+        #else
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_FLOAT; break;            // NOTE: Requires extension OES_texture_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_FLOAT; break;                  // NOTE: Requires extension OES_texture_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;             // NOTE: Requires extension OES_texture_float
+        #if defined(GRAPHICS_API_OPENGL_21)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_HALF_FLOAT_ARB; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT_ARB; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT_ARB; break;
+        #else // defined(GRAPHICS_API_OPENGL_ES2)
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_LUMINANCE; *glFormat = GL_LUMINANCE; *glType = GL_HALF_FLOAT_OES; break;   // NOTE: Requires extension OES_texture_half_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT_OES; break;         // NOTE: Requires extension OES_texture_half_float
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT_OES; break;    // NOTE: Requires extension OES_texture_half_float
+        #endif
+        #endif
+        #endif
+    #elif defined(GRAPHICS_API_OPENGL_33)
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *glInternalFormat = GL_R8; *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *glInternalFormat = GL_RG8; *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G6B5: *glInternalFormat = GL_RGB565; *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8: *glInternalFormat = GL_RGB8; *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R5G5B5A1: *glInternalFormat = GL_RGB5_A1; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: *glInternalFormat = GL_RGBA4; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *glInternalFormat = GL_RGBA8; *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_R32F; *glFormat = GL_RED; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGB32F; *glFormat = GL_RGB; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: if (RLGL.ExtSupported.texFloat32) *glInternalFormat = GL_RGBA32F; *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_R16F; *glFormat = GL_RED; *glType = GL_HALF_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGB16F; *glFormat = GL_RGB; *glType = GL_HALF_FLOAT; break;
+        case RL_PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: if (RLGL.ExtSupported.texFloat16) *glInternalFormat = GL_RGBA16F; *glFormat = GL_RGBA; *glType = GL_HALF_FLOAT; break;
+    #endif
+    #if !defined(GRAPHICS_API_OPENGL_11)
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGB: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT1_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA: if (RLGL.ExtSupported.texCompDXT) *glInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+        case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB: if (RLGL.ExtSupported.texCompETC1) *glInternalFormat = GL_ETC1_RGB8_OES; break;                      // NOTE: Requires OpenGL ES 2.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGB8_ETC2; break;               // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: if (RLGL.ExtSupported.texCompETC2) *glInternalFormat = GL_COMPRESSED_RGBA8_ETC2_EAC; break;     // NOTE: Requires OpenGL ES 3.0 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG; break;    // NOTE: Requires PowerVR GPU
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: if (RLGL.ExtSupported.texCompPVRT) *glInternalFormat = GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG; break;  // NOTE: Requires PowerVR GPU
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_4x4_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: if (RLGL.ExtSupported.texCompASTC) *glInternalFormat = GL_COMPRESSED_RGBA_ASTC_8x8_KHR; break;  // NOTE: Requires OpenGL ES 3.1 or OpenGL 4.3
+        case RL_PIXELFORMAT_COMPRESSED_BC7_RGBA: if (RLGL.ExtSupported.texCompBPTC) *glInternalFormat = GL_COMPRESSED_RGBA_BPTC_UNORM; break;         // NOTE: Requires OpenGL 4.2
+        case RL_PIXELFORMAT_COMPRESSED_BC4_R: if (RLGL.ExtSupported.texCompRGTC) *glInternalFormat = GL_COMPRESSED_RED_RGTC1; break;                  // NOTE: Requires OpenGL 3.0
+    #endif
+        default: TRACELOG(RL_LOG_WARNING, "TEXTURE: Current format not supported (%i)", format); break;
+    }
+}
+
+// Unload texture from GPU memory
+void rlUnloadTexture(unsigned int id)
+{
+    rlUntrackGpuMemory(RL_GPU_OBJECT_TEXTURE, id);
+    rlCacheForgetTexture(id);
+    glDeleteTextures(1, &id);
+}
+
+// Generate mipmap data for selected texture
+// NOTE: Only supports GPU mipmap generation (or software renderer)
+void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlCacheBindTexture(id);
+
+    // Check if texture is power-of-two (POT)
+    bool texIsPOT = false;
+
+    if (((width > 0) && ((width & (width - 1)) == 0)) &&
+        ((height > 0) && ((height & (height - 1)) == 0))) texIsPOT = true;
+
+    if ((texIsPOT) || (RLGL.ExtSupported.texNPOT))
+    {
+        //glHint(GL_GENERATE_MIPMAP_HINT, GL_DONT_CARE);   // Hint for mipmaps generation algorithm: GL_FASTEST, GL_NICEST, GL_DONT_CARE
+        glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps automatically
+
+        #define MIN(a,b) (((a)<(b))? (a):(b))
+        #define MAX(a,b) (((a)>(b))? (a):(b))
+
+        *mipmaps = 1 + (int)floor(log(MAX(width, height))/log(2));
+        rlTrackGpuMemory(RL_GPU_OBJECT_TEXTURE, id, RL_GPU_MEMORY_TEXTURE, rlGetTextureMipmapsSize(width, height, format, *mipmaps));
+        TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated automatically, total: %i", id, *mipmaps);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
+
+    rlCacheBindTexture(0);
+#elif defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    rlCacheBindTexture(id);
+
+    glGenerateMipmap(GL_TEXTURE_2D);    // Generate mipmaps in software renderer
+
+    *mipmaps = 1 + (int)floor(log((width > height)? width : height)/log(2));
+    rlTrackGpuMemory(RL_GPU_OBJECT_TEXTURE, id, RL_GPU_MEMORY_TEXTURE, rlGetTextureMipmapsSize(width, height, format, *mipmaps));
+    TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated by software renderer, total: %i", id, *mipmaps);
+
+    rlCacheBindTexture(0);
+#else
+    TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
+#endif
+}
+
+// Read texture pixel data
+void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
+{
+    void *pixels = NULL;
+
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
+    rlCacheBindTexture(id);
+
+    // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
+    // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
+    //int width, height, format;
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    //glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+
+    // NOTE: Each row written to or read from by OpenGL pixel operations like glGetTexImage are aligned to a 4 byte boundary by default, which may add some padding
+    // Use glPixelStorei to modify padding with the GL_[UN]PACK_ALIGNMENT setting
+    // GL_PACK_ALIGNMENT affects operations that read from OpenGL memory (glReadPixels, glGetTexImage, etc.)
+    // GL_UNPACK_ALIGNMENT affects operations that write to OpenGL memory (glTexImage, etc.)
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+    unsigned int size = rlGetPixelDataSize(width, height, format);
+
+    if ((glInternalFormat != 0) && (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        pixels = RL_CALLOC(size, 1);
+        glGetTexImage(GL_TEXTURE_2D, 0, glFormat, glType, pixels);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
+
+    rlCacheBindTexture(0);
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES2)
+    // glGetTexImage() is not available on OpenGL ES 2.0
+    // rl_Texture width and height are required on OpenGL ES 2.0, there is no way to get it from texture id
+    // Two possible Options:
+    // 1 - Bind texture to color fbo attachment and glReadPixels()
+    // 2 - Create an fbo, activate it, render quad with texture, glReadPixels()
+    // We are using Option 1, just need to care for texture format on retrieval
+    // NOTE: This behaviour could be conditioned by graphic driver...
+    unsigned int fboId = rlLoadFramebuffer();
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+    rlCacheBindTexture(0);
+
+    // Attach our texture to FBO
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
+
+    // We read data as RGBA because FBO texture is configured as RGBA, despite binding another texture format
+    pixels = RL_CALLOC(rlGetPixelDataSize(width, height, RL_PIXELFORMAT_UNCOMPRESSED_R8G8B8A8), 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Clean up temporal fbo
+    rlUnloadFramebuffer(fboId);
+#endif
+
+    return pixels;
+}
+
+// Copy framebuffer pixel data to internal buffer
+void rlCopyFramebuffer(int x, int y, int width, int height, int format, void *pixels)
+{
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType); // Get OpenGL texture format
+    rlDrawSoftwareBatch();
+    swCopyFramebuffer(x, y, width, height, glFormat, glType, pixels);
+#endif
+}
+
+// Copy framebuffer region pixel data at the same position of pixels, rows are pitch bytes apart
+void rlCopyFramebufferRegion(int x, int y, int width, int height, int format, void *pixels, int pitch)
+{
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType); // Get OpenGL texture format
+    rlDrawSoftwareBatch();
+    swCopyFramebufferRegion(x, y, width, height, glFormat, glType, pixels, pitch);
+#endif
+}
+
+// Get framebuffer region modified since last reset, false if unmodified
+// NOTE: Platforms copy and present only this region, reset once presented
+bool rlGetFramebufferDirtyRegion(int *x, int *y, int *width, int *height, bool reset)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    rlDrawSoftwareBatch();
+    result = swGetDirtyRegion(x, y, width, height);
+    if (reset) swResetDirtyRegion();
+#endif
+
+    return result;
+}
+
+// Resize internal framebuffer
+void rlResizeFramebuffer(int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    rlDrawSoftwareBatch();
+    swResizeFramebuffer(width, height);
+#endif
+}
+
+// Set memory to render framebuffer color into, NULL restores internal buffer
+// NOTE: Memory must fit framebuffer size with software renderer color format, no copy required to present it
+bool rlSetFramebufferMemory(void *pixels, int pitch)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    rlDrawSoftwareBatch();
+    result = swSetColorBuffer(pixels, pitch);
+#endif
+
+    return result;
+}
+
+// Flip screen pixel data vertically and set alpha to 255
+// NOTE: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
+static void rlFlipScreenPixels(unsigned char *imgData, int width, int height)
+{
+    // Flip image vertically!
+    // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+    for (int y = height - 1; y >= height/2; y--)
+    {
+        for (int x = 0; x < (width*4); x += 4)
+        {
+            unsigned int s = ((height - 1) - y)*width*4 + x;
+            unsigned int e = y*width*4 + x;
+
+            unsigned char r = imgData[s];
+            unsigned char g = imgData[s+1];
+            unsigned char b = imgData[s+2];
+
+            imgData[s] = imgData[e];
+            imgData[s+1] = imgData[e+1];
+            imgData[s+2] = imgData[e+2];
+            imgData[s+3] = 255; // Set alpha component value to 255 (no trasparent image retrieval)
+
+            imgData[e] = r;
+            imgData[e+1] = g;
+            imgData[e+2] = b;
+            imgData[e+3] = 255; // Ditto
+        }
+    }
+}
+
+// Read screen pixel data (color buffer)
+unsigned char *rlReadScreenPixels(int width, int height)
+{
+    unsigned char *imgData = (unsigned char *)RL_CALLOC(width*height*4, sizeof(unsigned char));
+
+    // NOTE 1: glReadPixels returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
+    // NOTE 2: We are getting alpha channel! Be careful, it can be transparent if not cleared properly!
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, imgData);
+
+    rlFlipScreenPixels(imgData, width, height);
+
+    return imgData;     // NOTE: image data should be freed
+}
+
+// Read screen pixel data asynchronously (color buffer)
+// NOTE: Pixels are read into a pixel buffer (PBO) and delivered to callback once the GPU has completed
+// the transfer (usually 1-2 frames later), avoiding the pipeline stall of glReadPixels() into client memory
+// WARNING: Only supported on OpenGL 3.3, data is read synchronously and callback is called immediately otherwise
+void rlReadScreenPixelsAsync(int width, int height, rlReadbackCallback callback, void *userData)
+{
+    if (callback == NULL) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // Make space for new readback, waiting for oldest one to complete
+    if (RLGL.Readback.count == RL_MAX_ASYNC_READBACKS) rlUpdateReadbacks(false);
+    while (RLGL.Readback.count == RL_MAX_ASYNC_READBACKS)
+    {
+        glClientWaitSync((GLsync)RLGL.Readback.pending[RLGL.Readback.first].fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);   // Timeout: 1 second
+        rlUpdateReadbacks(false);
+    }
+
+    int index = (RLGL.Readback.first + RLGL.Readback.count)%RL_MAX_ASYNC_READBACKS;
+    int size = width*height*4;
+
+    if (RLGL.Readback.bufferIds[index] == 0) glGenBuffers(1, &RLGL.Readback.bufferIds[index]);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, RLGL.Readback.bufferIds[index]);
+    if (RLGL.Readback.bufferSizes[index] < size)
+    {
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+        RLGL.Readback.bufferSizes[index] = size;
+    }
+
+    // NOTE: Data pointer is an offset into bound pixel buffer, returns immediately
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    RLGL.Readback.pending[index].fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    RLGL.Readback.pending[index].width = width;
+    RLGL.Readback.pending[index].height = height;
+    RLGL.Readback.pending[index].depth = false;
+    RLGL.Readback.pending[index].callback = callback;
+    RLGL.Readback.pending[index].userData = userData;
+    RLGL.Readback.count++;
+#else
+    unsigned char *imgData = rlReadScreenPixels(width, height);
+    callback(imgData, width, height, userData);
+    RL_FREE(imgData);
+#endif
+}
+
+// Read depth buffer data asynchronously from current framebuffer
+// NOTE: Data delivered to callback is one float per pixel in [0..1] range, rows are kept in
+// framebuffer order (bottom-left origin), callback receives it as (unsigned char *) buffer
+// WARNING: Only supported on OpenGL 3.3, request is ignored otherwise
+void rlReadDepthPixelsAsync(int width, int height, rlReadbackCallback callback, void *userData)
+{
+    if (callback == NULL) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    // Make space for new readback, waiting for oldest one to complete
+    if (RLGL.Readback.count == RL_MAX_ASYNC_READBACKS) rlUpdateReadbacks(false);
+    while (RLGL.Readback.count == RL_MAX_ASYNC_READBACKS)
+    {
+        glClientWaitSync((GLsync)RLGL.Readback.pending[RLGL.Readback.first].fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);   // Timeout: 1 second
+        rlUpdateReadbacks(false);
+    }
+
+    int index = (RLGL.Readback.first + RLGL.Readback.count)%RL_MAX_ASYNC_READBACKS;
+    int size = width*height*sizeof(float);
+
+    if (RLGL.Readback.bufferIds[index] == 0) glGenBuffers(1, &RLGL.Readback.bufferIds[index]);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, RLGL.Readback.bufferIds[index]);
+    if (RLGL.Readback.bufferSizes[index] < size)
+    {
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+        RLGL.Readback.bufferSizes[index] = size;
+    }
+
+    glReadPixels(0, 0, width, height, GL_DEPTH_COMPONENT, GL_FLOAT, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    RLGL.Readback.pending[index].fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    RLGL.Readback.pending[index].width = width;
+    RLGL.Readback.pending[index].height = height;
+    RLGL.Readback.pending[index].depth = true;
+    RLGL.Readback.pending[index].callback = callback;
+    RLGL.Readback.pending[index].userData = userData;
+    RLGL.Readback.count++;
+#else
+    TRACELOG(RL_LOG_WARNING, "GL: Async depth readback requires OpenGL 3.3");
+#endif
+}
+
+// Deliver completed async readbacks to their callbacks, in request order
+void rlUpdateReadbacks(bool wait)
+{
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    while (RLGL.Readback.count > 0)
+    {
+        int index = RLGL.Readback.first;
+        GLsync fence = (GLsync)RLGL.Readback.pending[index].fence;
+        GLenum result = glClientWaitSync(fence, wait? GL_SYNC_FLUSH_COMMANDS_BIT : 0, wait? 1000000000 : 0);
+
+        if (!wait && ((result == GL_TIMEOUT_EXPIRED) || (result == GL_WAIT_FAILED))) break;
+        glDeleteSync(fence);
+
+        int width = RLGL.Readback.pending[index].width;
+        int height = RLGL.Readback.pending[index].height;
+        unsigned char *imgData = (unsigned char *)RL_MALLOC(width*height*4);
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, RLGL.Readback.bufferIds[index]);
+        void *mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, width*height*4, GL_MAP_READ_BIT);
+        if (mapped != NULL)
+        {
+            memcpy(imgData, mapped, width*height*4);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        else
+        {
+            TRACELOG(RL_LOG_WARNING, "GL: Failed to map async readback buffer");
+            memset(imgData, 0, width*height*4);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        // NOTE: Slot is released before callback, so callback can request a new readback
+        RLGL.Readback.first = (RLGL.Readback.first + 1)%RL_MAX_ASYNC_READBACKS;
+        RLGL.Readback.count--;
+
+        if (!RLGL.Readback.pending[index].depth) rlFlipScreenPixels(imgData, width, height);
+        RLGL.Readback.pending[index].callback(imgData, width, height, RLGL.Readback.pending[index].userData);
+        RL_FREE(imgData);
+    }
+#endif
+}
+
+// Framebuffer management (fbo)
+//-----------------------------------------------------------------------------------------
+// Load a framebuffer to be used for rendering
+// NOTE: No textures attached
+unsigned int rlLoadFramebuffer(void)
+{
+    unsigned int fboId = 0;
+    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return fboId; }
+
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glGenFramebuffers(1, &fboId);       // Create the framebuffer object
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);   // Unbind any framebuffer
+#endif
+
+    return fboId;
+}
+
+// Attach color buffer texture to an fbo (unloads previous attachment)
+// NOTE: Attach type: 0-rl_Color, 1-Depth renderbuffer, 2-Depth texture
+void rlFramebufferAttach(unsigned int fboId, unsigned int texId, int attachType, int texType, int mipLevel)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+
+    switch (attachType)
+    {
+        case RL_ATTACHMENT_COLOR_CHANNEL0:
+        case RL_ATTACHMENT_COLOR_CHANNEL1:
+        case RL_ATTACHMENT_COLOR_CHANNEL2:
+        case RL_ATTACHMENT_COLOR_CHANNEL3:
+        case RL_ATTACHMENT_COLOR_CHANNEL4:
+        case RL_ATTACHMENT_COLOR_CHANNEL5:
+        case RL_ATTACHMENT_COLOR_CHANNEL6:
+        case RL_ATTACHMENT_COLOR_CHANNEL7:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER) glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_RENDERBUFFER, texId);
+            else if (texType >= RL_ATTACHMENT_CUBEMAP_POSITIVE_X) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, GL_TEXTURE_CUBE_MAP_POSITIVE_X + texType, texId, mipLevel);
+        } break;
+        case RL_ATTACHMENT_DEPTH:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, texId);
+        } break;
+        case RL_ATTACHMENT_STENCIL:
+        {
+            if (texType == RL_ATTACHMENT_TEXTURE2D) glFramebufferTexture2D(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, texId, mipLevel);
+            else if (texType == RL_ATTACHMENT_RENDERBUFFER)  glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_RENDERBUFFER, texId);
+        } break;
+        default: break;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#endif
+}
+
+// Attach texture array layer to an fbo (unloads previous attachment)
+// NOTE: Attach type: RL_ATTACHMENT_COLOR_CHANNEL0..7 or RL_ATTACHMENT_DEPTH
+void rlFramebufferAttachLayer(unsigned int fboId, unsigned int texId, int attachType, int layer, int mipLevel)
+{
+#if ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glBindFramebuffer(GL_FRAMEBUFFER, fboId);
+
+    if (attachType == RL_ATTACHMENT_DEPTH) glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, texId, mipLevel, layer);
+    else if ((attachType >= RL_ATTACHMENT_COLOR_CHANNEL0) && (attachType <= RL_ATTACHMENT_COLOR_CHANNEL7))
+    {
+        glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + attachType, texId, mipLevel, layer);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+#endif
+}
+
+// Verify render texture is complete
+bool rlFramebufferComplete(unsigned int id)
+{
+    bool result = false;
+
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    glBindFramebuffer(GL_FRAMEBUFFER, id);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        switch (status)
+        {
+            case GL_FRAMEBUFFER_UNSUPPORTED: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer is unsupported", id); break;
+            case GL_FRAMEBUFFER_INCOMPLETE_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete attachment", id); break;
+#if defined(GRAPHICS_API_OPENGL_ES2)
+            case GL_FRAMEBUFFER_INCOMPLETE_DIMENSIONS: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has incomplete dimensions", id); break;
+#endif
+            case GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT: TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] Framebuffer has a missing attachment", id); break;
+            default: break;
+        }
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    result = (status == GL_FRAMEBUFFER_COMPLETE);
+#endif
+
+    return result;
+}
+
+// Unload framebuffer from GPU memory
+// NOTE: All attached textures/cubemaps/renderbuffers are also deleted
+void rlUnloadFramebuffer(unsigned int id)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    // Query depth attachment to automatically delete texture/renderbuffer
+    int depthType = 0, depthId = 0;
+    glBindFramebuffer(GL_FRAMEBUFFER, id);   // Bind framebuffer to query depth texture type
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE, &depthType);
+
+    // TODO: Review warning retrieving object name in WebGL
+    // WARNING: WebGL: INVALID_ENUM: getFramebufferAttachmentParameter: invalid parameter name
+    // REF: https://registry.khronos.org/webgl/specs/latest/1.0/
+    glGetFramebufferAttachmentParameteriv(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME, &depthId);
+
+    unsigned int depthIdU = (unsigned int)depthId;
+    if (depthType == GL_RENDERBUFFER)
+    {
+        rlUntrackGpuMemory(RL_GPU_OBJECT_RENDERBUFFER, depthIdU);
+        glDeleteRenderbuffers(1, &depthIdU);
+    }
+    else if (depthType == GL_TEXTURE)
+    {
+        rlUntrackGpuMemory(RL_GPU_OBJECT_TEXTURE, depthIdU);
+        rlCacheForgetTexture(depthIdU);
+        glDeleteTextures(1, &depthIdU);
+    }
+
+    // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
+    // the texture image is automatically detached from the currently bound framebuffer
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &id);
+
+    TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded framebuffer from VRAM (GPU)", id);
+#endif
+}
+
+// Invalidate current framebuffer attachments contents
+// Load G-buffer framebuffer, 8 bytes per pixel color data plus depth
+// NOTE: Normals are octahedral encoded in 10 bit channels, world position is reconstructed
+// from depth texture and inverse view-projection matrix on lighting pass
+rlGBuffer rlLoadGBuffer(int width, int height)
+{
+    rlGBuffer gbuffer = { 0 };
+    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return gbuffer; }
+
+#if ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    unsigned int textures[3] = { 0 };
+    glGenTextures(3, textures);
+
+    rlCacheBindTexture(textures[0]);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    rlCacheBindTexture(textures[1]);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB10_A2, width, height, 0, GL_RGBA, GL_UNSIGNED_INT_2_10_10_10_REV, NULL);
+    rlCacheBindTexture(textures[2]);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+
+    // G-buffer texels are fetched 1:1 on lighting pass, no filtering
+    for (int i = 0; i < 3; i++)
+    {
+        rlCacheBindTexture(textures[i]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+
+    rlCacheBindTexture(0);
+
+    glGenFramebuffers(1, &gbuffer.id);
+    glBindFramebuffer(GL_FRAMEBUFFER, gbuffer.id);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textures[0], 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, textures[1], 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, textures[2], 0);
+
+    GLenum buffers[2] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+    glDrawBuffers(2, buffers);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // NOTE: Every G-buffer texture uses 4 bytes per pixel (RGBA8, RGB10_A2 and DEPTH_COMPONENT24)
+    for (int i = 0; i < 3; i++) rlTrackGpuMemory(RL_GPU_OBJECT_TEXTURE, textures[i], RL_GPU_MEMORY_RENDER_TARGET, (long long)width*height*4);
+
+    gbuffer.albedo = textures[0];
+    gbuffer.normal = textures[1];
+    gbuffer.depth = textures[2];
+    gbuffer.width = width;
+    gbuffer.height = height;
+
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        TRACELOG(RL_LOG_WARNING, "FBO: [ID %i] G-buffer framebuffer is not complete (0x%x)", gbuffer.id, status);
+        rlUnloadGBuffer(gbuffer);
+        gbuffer = (rlGBuffer){ 0 };
+    }
+    else TRACELOG(RL_LOG_INFO, "FBO: [ID %i] G-buffer loaded successfully (%ix%i)", gbuffer.id, width, height);
+#else
+    TRACELOG(RL_LOG_WARNING, "FBO: G-buffer not supported, requires OpenGL 3.3 or OpenGL ES 3.0");
+#endif
+
+    return gbuffer;
+}
+
+// Unload G-buffer framebuffer and textures from GPU
+void rlUnloadGBuffer(rlGBuffer gbuffer)
+{
+#if ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    unsigned int textures[3] = { gbuffer.albedo, gbuffer.normal, gbuffer.depth };
+
+    for (int i = 0; i < 3; i++)
+    {
+        rlUntrackGpuMemory(RL_GPU_OBJECT_TEXTURE, textures[i]);
+        rlCacheForgetTexture(textures[i]);
+    }
+    glDeleteTextures(3, textures);
+    if (gbuffer.id > 0) glDeleteFramebuffers(1, &gbuffer.id);
+
+    TRACELOG(RL_LOG_INFO, "FBO: [ID %i] Unloaded G-buffer from VRAM (GPU)", gbuffer.id);
+#endif
+}
+
+// NOTE: Contents are undefined after invalidation, tile-based GPUs can skip loading them on
+// next pass (invalidate after binding) or storing them to memory (invalidate before unbinding)
+void rlInvalidateFramebuffer(bool color, bool depth)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        int data[2] = { color, depth };
+        rlRecordCommand(RL_COMMAND_INVALIDATE_FRAMEBUFFER, data, sizeof(data));
+        return;
+    }
+#endif
+#if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)) && defined(RLGL_RENDER_TEXTURES_HINT)
+    if (!RLGL.ExtSupported.invalidateFramebuffer || (!color && !depth)) return;
+
+    GLint fboId = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &fboId);
+
+    // NOTE: Default framebuffer attachments use different names
+    #ifndef GL_COLOR
+        #define GL_COLOR    0x1800
+    #endif
+    #ifndef GL_DEPTH
+        #define GL_DEPTH    0x1801
+    #endif
+    GLenum attachments[2] = { 0 };
+    int count = 0;
+    if (color) attachments[count++] = (fboId == 0)? GL_COLOR : GL_COLOR_ATTACHMENT0;
+    if (depth) attachments[count++] = (fboId == 0)? GL_DEPTH : GL_DEPTH_ATTACHMENT;
+
+    #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glInvalidateFramebuffer(GL_FRAMEBUFFER, count, attachments);
+    #else
+    glDiscardFramebuffer(GL_FRAMEBUFFER, count, attachments);
+    #endif
+#endif
+}
+
+// Vertex data management
+//-----------------------------------------------------------------------------------------
+// Load a new attributes buffer
+unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic)
+{
+    unsigned int id = 0;
+    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return id; }
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+
+    rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, id, RL_GPU_MEMORY_VERTEX_BUFFER, size);
+#endif
+
+    return id;
+}
+
+// Load a new attributes element buffer
+unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic)
+{
+    unsigned int id = 0;
+    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return id; }
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, buffer, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+
+    rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, id, RL_GPU_MEMORY_INDEX_BUFFER, size);
+#endif
+
+    return id;
+}
+
+// Enable vertex buffer (VBO)
+void rlEnableVertexBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+#endif
+}
+
+// Disable vertex buffer (VBO)
+void rlDisableVertexBuffer(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+#endif
+}
+
+// Enable vertex buffer element (VBO element)
+void rlEnableVertexBufferElement(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
+#endif
+}
+
+// Disable vertex buffer element (VBO element)
+void rlDisableVertexBufferElement(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+#endif
+}
+
+// Update vertex buffer with new data
+// NOTE: dataSize and offset must be provided in bytes
+void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int offset)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+#endif
+}
+
+// Update vertex buffer elements with new data
+// NOTE: dataSize and offset must be provided in bytes
+void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
@@ -4019,6 +7164,17 @@ void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSiz
 #endif
 }
 
+// Copy vertex buffer data to another vertex buffer, copy is done on GPU
+// NOTE: Requires OpenGL 3.3 or OpenGL ES 3.0, dataSize and offsets must be provided in bytes
+void rlCopyVertexBuffer(unsigned int destId, unsigned int srcId, int destOffset, int srcOffset, int dataSize)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBuffer(GL_COPY_READ_BUFFER, srcId);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, destId);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, srcOffset, destOffset, dataSize);
+#endif
+}
+
 // Enable vertex array object (VAO)
 bool rlEnableVertexArray(unsigned int vaoId)
 {
@@ -4026,7 +7182,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(vaoId);
+        rlCacheBindVertexArray(vaoId);
         result = true;
     }
 #endif
@@ -4037,7 +7193,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 void rlDisableVertexArray(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
 #endif
 }
 
@@ -4061,6 +7217,10 @@ void rlDisableVertexAttribute(unsigned int index)
 void rlDrawVertexArray(int offset, int count)
 {
     glDrawArrays(GL_TRIANGLES, offset, count);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.drawCalls++;
+    RLGL.Stats.vertices += count;
+#endif
 }
 
 // Draw vertex array elements
@@ -4071,6 +7231,20 @@ void rlDrawVertexArrayElements(int offset, int count, const void *buffer)
     if (offset > 0) bufferPtr += offset;
 
     glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Stats.drawCalls++;
+    RLGL.Stats.vertices += count;
+#endif
+}
+
+// Check if instanced drawing is supported
+bool rlIsInstancingSupported(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return RLGL.ExtSupported.instancing;
+#else
+    return false;
+#endif
 }
 
 // Draw vertex array instanced
@@ -4078,6 +7252,9 @@ void rlDrawVertexArrayInstanced(int offset, int count, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDrawArraysInstanced(GL_TRIANGLES, offset, count, instances);
+
+    RLGL.Stats.drawCalls++;
+    RLGL.Stats.vertices += count*instances;
 #endif
 }
 
@@ -4090,6 +7267,45 @@ void rlDrawVertexArrayElementsInstanced(int offset, int count, const void *buffe
     if (offset > 0) bufferPtr += offset;
 
     glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_SHORT, (const unsigned short *)bufferPtr, instances);
+
+    RLGL.Stats.drawCalls++;
+    RLGL.Stats.vertices += count*instances;
+#endif
+}
+
+// Draw vertex array with draw commands read from GPU buffer
+// NOTE: Every command is 4 unsigned int: count, instanceCount, first, baseInstance
+void rlDrawVertexArrayIndirect(unsigned int bufferId, int offset, int drawCount)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    // NOTE: Added pointer math separately from function to avoid UBSAN complaining
+    unsigned char *offsetPtr = NULL;
+    if (offset > 0) offsetPtr += offset;
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, bufferId);
+    glMultiDrawArraysIndirect(GL_TRIANGLES, (const void *)offsetPtr, drawCount, 0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    RLGL.Stats.drawCalls += drawCount;  // NOTE: Vertex count is only known by GPU
+#else
+    TRACELOG(RL_LOG_WARNING, "VAO: Indirect drawing not enabled. Define GRAPHICS_API_OPENGL_43");
+#endif
+}
+
+// Draw vertex array elements with draw commands read from GPU buffer
+// NOTE: Every command is 5 unsigned int: count, instanceCount, firstIndex, baseVertex, baseInstance
+void rlDrawVertexArrayElementsIndirect(unsigned int bufferId, int offset, int drawCount)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    // NOTE: Added pointer math separately from function to avoid UBSAN complaining
+    unsigned char *offsetPtr = NULL;
+    if (offset > 0) offsetPtr += offset;
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, bufferId);
+    glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_SHORT, (const void *)offsetPtr, drawCount, 0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    RLGL.Stats.drawCalls += drawCount;  // NOTE: Vertex count is only known by GPU
+#else
+    TRACELOG(RL_LOG_WARNING, "VAO: Indirect drawing not enabled. Define GRAPHICS_API_OPENGL_43");
 #endif
 }
 
@@ -4159,7 +7375,7 @@ void rlUnloadVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(0);
+        rlCacheBindVertexArray(0);
         glDeleteVertexArrays(1, &vaoId);
         TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
     }
@@ -4170,6 +7386,7 @@ void rlUnloadVertexArray(unsigned int vaoId)
 void rlUnloadVertexBuffer(unsigned int vboId)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlUntrackGpuMemory(RL_GPU_OBJECT_BUFFER, vboId);
     glDeleteBuffers(1, &vboId);
     //TRACELOG(RL_LOG_INFO, "VBO: Unloaded vertex data from VRAM (GPU)");
 #endif
@@ -4256,17 +7473,148 @@ unsigned int rlLoadShaderCode(const char *vsCode, const char *fsCode)
     return id;
 }
 
-// Compile custom shader and return shader id
-unsigned int rlCompileShader(const char *shaderCode, int type)
+// Load shader from code strings asynchronously
+// NOTE: Compile and link are started and not checked, so drivers supporting background compilation
+// can build multiple programs in parallel, use rlIsShaderProgramReady() to poll completion and
+// rlCompleteShaderProgram() to get final program id, uniform/attrib locations can be requested after it
+unsigned int rlLoadShaderCodeAsync(const char *vsCode, const char *fsCode)
 {
-    unsigned int shaderId = 0;
+    unsigned int id = 0;
+    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return id; }
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    shaderId = glCreateShader(type);
-    glShaderSource(shaderId, 1, &shaderCode, NULL);
+    if ((vsCode == NULL) && (fsCode == NULL)) return RLGL.State.defaultShaderId;
+
+    if (RLGL.State.pendingProgramCount >= RL_MAX_ASYNC_SHADERS)
+    {
+        TRACELOG(RL_LOG_WARNING, "SHADER: Maximum async shader programs reached (%i), loading synchronously", RL_MAX_ASYNC_SHADERS);
+        return rlLoadShaderCode(vsCode, fsCode);
+    }
+
+    unsigned int vertexShaderId = RLGL.State.defaultVShaderId;
+    unsigned int fragmentShaderId = RLGL.State.defaultFShaderId;
+
+    if (vsCode != NULL)
+    {
+        vertexShaderId = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(vertexShaderId, 1, &vsCode, NULL);
+        glCompileShader(vertexShaderId);
+    }
+
+    if (fsCode != NULL)
+    {
+        fragmentShaderId = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(fragmentShaderId, 1, &fsCode, NULL);
+        glCompileShader(fragmentShaderId);
+    }
+
+    // NOTE: Program linking waits for shaders compilation on driver side, no need to check them here
+    id = glCreateProgram();
+    rlPrepareShaderProgram(id, vertexShaderId, fragmentShaderId);
+    glLinkProgram(id);
 
+    int index = RLGL.State.pendingProgramCount;
+    RLGL.State.pendingPrograms[index].programId = id;
+    RLGL.State.pendingPrograms[index].vShaderId = vertexShaderId;
+    RLGL.State.pendingPrograms[index].fShaderId = fragmentShaderId;
+    RLGL.State.pendingProgramCount++;
+#endif
+
+    return id;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Get pending async shader program index, -1 if not pending
+static int rlGetPendingShaderProgram(unsigned int id)
+{
+    for (int i = 0; i < RLGL.State.pendingProgramCount; i++)
+    {
+        if (RLGL.State.pendingPrograms[i].programId == id) return i;
+    }
+
+    return -1;
+}
+
+// Release pending async shader program entry, shaders are detached and deleted
+static void rlReleasePendingShaderProgram(int index)
+{
+    unsigned int id = RLGL.State.pendingPrograms[index].programId;
+    unsigned int vertexShaderId = RLGL.State.pendingPrograms[index].vShaderId;
+    unsigned int fragmentShaderId = RLGL.State.pendingPrograms[index].fShaderId;
+
+    if (vertexShaderId != RLGL.State.defaultVShaderId) { glDetachShader(id, vertexShaderId); glDeleteShader(vertexShaderId); }
+    if (fragmentShaderId != RLGL.State.defaultFShaderId) { glDetachShader(id, fragmentShaderId); glDeleteShader(fragmentShaderId); }
+
+    RLGL.State.pendingProgramCount--;
+    RLGL.State.pendingPrograms[index] = RLGL.State.pendingPrograms[RLGL.State.pendingProgramCount];
+}
+#endif
+
+// Check if shader program was loaded async and not completed yet
+bool rlIsShaderProgramPending(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    return (rlGetPendingShaderProgram(id) >= 0);
+#else
+    return false;
+#endif
+}
+
+// Check if shader program compile and link has finished (non-blocking)
+// NOTE: Without GL_KHR_parallel_shader_compile it always returns true, completion blocks
+bool rlIsShaderProgramReady(unsigned int id)
+{
+    bool ready = true;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    #ifndef GL_COMPLETION_STATUS_KHR
+        #define GL_COMPLETION_STATUS_KHR 0x91B1
+    #endif
+
+    if (RLGL.ExtSupported.parallelShaderCompile && (rlGetPendingShaderProgram(id) >= 0))
+    {
+        GLint completed = GL_TRUE;
+        glGetProgramiv(id, GL_COMPLETION_STATUS_KHR, &completed);
+        ready = (completed == GL_TRUE);
+    }
+#endif
+
+    return ready;
+}
+
+// Complete async shader program, compile and link status are checked (blocking if not ready)
+// NOTE: On failure program is unloaded and default shader id returned, same as rlLoadShaderCode()
+unsigned int rlCompleteShaderProgram(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int index = rlGetPendingShaderProgram(id);
+    if (index < 0) return id;
+
+    bool success = true;
+    if (RLGL.State.pendingPrograms[index].vShaderId != RLGL.State.defaultVShaderId) success = rlCheckShaderCompile(RLGL.State.pendingPrograms[index].vShaderId, GL_VERTEX_SHADER) && success;
+    if (RLGL.State.pendingPrograms[index].fShaderId != RLGL.State.defaultFShaderId) success = rlCheckShaderCompile(RLGL.State.pendingPrograms[index].fShaderId, GL_FRAGMENT_SHADER) && success;
+    if (success) success = rlCheckShaderProgramLink(id);
+
+    rlReleasePendingShaderProgram(index);
+
+    if (!success)
+    {
+        glDeleteProgram(id);
+
+        TRACELOG(RL_LOG_WARNING, "SHADER: Failed to load custom shader code, using default shader");
+        id = RLGL.State.defaultShaderId;
+    }
+#endif
+
+    return id;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Check shader compilation status, compilation errors are logged
+// NOTE: It waits for compilation to complete if still running
+static bool rlCheckShaderCompile(unsigned int shaderId, int type)
+{
     GLint success = 0;
-    glCompileShader(shaderId);
     glGetShaderiv(shaderId, GL_COMPILE_STATUS, &success);
 
     if (success == GL_FALSE)
@@ -4295,11 +7643,6 @@ unsigned int rlCompileShader(const char *shaderCode, int type)
             TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Compile error: %s", shaderId, log);
             RL_FREE(log);
         }
-
-        // Unload object allocated by glCreateShader(),
-        // despite failing in the compilation process
-        glDeleteShader(shaderId);
-        shaderId = 0;
     }
     else
     {
@@ -4316,21 +7659,37 @@ unsigned int rlCompileShader(const char *shaderCode, int type)
             default: break;
         }
     }
-#endif
 
-    return shaderId;
+    return (success != GL_FALSE);
 }
+#endif
 
-// Load custom shader strings and return program id
-unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+// Compile custom shader and return shader id
+unsigned int rlCompileShader(const char *shaderCode, int type)
 {
-    unsigned int programId = 0;
-    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return programId; }
+    unsigned int shaderId = 0;
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    GLint success = 0;
-    programId = glCreateProgram();
+    shaderId = glCreateShader(type);
+    glShaderSource(shaderId, 1, &shaderCode, NULL);
+    glCompileShader(shaderId);
+
+    if (!rlCheckShaderCompile(shaderId, type))
+    {
+        // Unload object allocated by glCreateShader(),
+        // despite failing in the compilation process
+        glDeleteShader(shaderId);
+        shaderId = 0;
+    }
+#endif
 
+    return shaderId;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Attach shaders and bind default attribute locations, program ready to be linked
+static void rlPrepareShaderProgram(unsigned int programId, unsigned int vShaderId, unsigned int fShaderId)
+{
     glAttachShader(programId, vShaderId);
     glAttachShader(programId, fShaderId);
 
@@ -4342,18 +7701,29 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
     glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
     glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCE_TX, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_TX);
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXINDEX, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX);
+#endif
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
     glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
     glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS);
+    glBindAttribLocation(programId, RL_DEFAULT_SHADER_ATTRIB_LOCATION_INSTANCE_PALETTE, RL_DEFAULT_SHADER_ATTRIB_NAME_INSTANCE_PALETTE);
 #endif
 
     // NOTE: If some attrib name is no found on the shader, it locations becomes -1
 
-    glLinkProgram(programId);
-
-    // NOTE: All uniform variables are intitialised to 0 when a program links
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    // Allow program binary retrieval after linking (shader binary cache)
+    if (RLGL.ExtSupported.programBinary) glProgramParameteri(programId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+}
 
+// Check shader program link status, link errors are logged
+// NOTE: It waits for linking to complete if still running
+static bool rlCheckShaderProgramLink(unsigned int programId)
+{
+    GLint success = 0;
     glGetProgramiv(programId, GL_LINK_STATUS, &success);
 
     if (success == GL_FALSE)
@@ -4371,10 +7741,6 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
             TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Link error: %s", programId, log);
             RL_FREE(log);
         }
-
-        glDeleteProgram(programId);
-
-        programId = 0;
     }
     else
     {
@@ -4384,6 +7750,37 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
         //glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
 
         TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully", programId);
+
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+        // Bind default camera uniform block (if declared by the shader)
+        GLuint blockIndex = glGetUniformBlockIndex(programId, RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA);
+        if (blockIndex != GL_INVALID_INDEX) glUniformBlockBinding(programId, blockIndex, RL_DEFAULT_UNIFORM_BLOCK_BINDING_CAMERA);
+#endif
+    }
+
+    return (success != GL_FALSE);
+}
+#endif
+
+// Load custom shader strings and return program id
+unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
+{
+    unsigned int programId = 0;
+    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return programId; }
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    programId = glCreateProgram();
+
+    rlPrepareShaderProgram(programId, vShaderId, fShaderId);
+
+    glLinkProgram(programId);
+
+    // NOTE: All uniform variables are intitialised to 0 when a program links
+
+    if (!rlCheckShaderProgramLink(programId))
+    {
+        glDeleteProgram(programId);
+        programId = 0;
     }
 #endif
     return programId;
@@ -4393,12 +7790,150 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
 void rlUnloadShaderProgram(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.Cache.programId == id) RLGL.Cache.programId = -1;
+
+    int pendingIndex = rlGetPendingShaderProgram(id);
+    if (pendingIndex >= 0) rlReleasePendingShaderProgram(pendingIndex);
+
     glDeleteProgram(id);
 
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
 #endif
 }
 
+// Reload shader program code, program id is kept and linked again with new shaders
+// NOTE: New code is validated on a temporary program first, a failed link would discard current program executable,
+// uniform locations could change and uniform values are reset to 0
+bool rlReloadShaderProgram(unsigned int id, const char *vsCode, const char *fsCode)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((id == 0) || (id == RLGL.State.defaultShaderId) || (rlGetPendingShaderProgram(id) >= 0)) return result;
+
+    unsigned int vertexShaderId = (vsCode != NULL)? rlCompileShader(vsCode, GL_VERTEX_SHADER) : RLGL.State.defaultVShaderId;
+    unsigned int fragmentShaderId = (fsCode != NULL)? rlCompileShader(fsCode, GL_FRAGMENT_SHADER) : RLGL.State.defaultFShaderId;
+
+    if ((vertexShaderId > 0) && (fragmentShaderId > 0))
+    {
+        unsigned int validationId = rlLoadShaderProgram(vertexShaderId, fragmentShaderId);
+
+        if (validationId > 0)
+        {
+            glDetachShader(validationId, vertexShaderId);
+            glDetachShader(validationId, fragmentShaderId);
+            glDeleteProgram(validationId);
+
+            rlPrepareShaderProgram(id, vertexShaderId, fragmentShaderId);
+            glLinkProgram(id);
+            result = rlCheckShaderProgramLink(id);
+
+            glDetachShader(id, vertexShaderId);
+            glDetachShader(id, fragmentShaderId);
+
+            // Program must be bound again to use the new executable
+            if (RLGL.Cache.programId == id) RLGL.Cache.programId = -1;
+        }
+    }
+
+    if ((vertexShaderId > 0) && (vertexShaderId != RLGL.State.defaultVShaderId)) glDeleteShader(vertexShaderId);
+    if ((fragmentShaderId > 0) && (fragmentShaderId != RLGL.State.defaultFShaderId)) glDeleteShader(fragmentShaderId);
+
+    if (result) TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program reloaded successfully", id);
+    else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to reload program, previous code is kept", id);
+#endif
+
+    return result;
+}
+
+// Check if shader program binaries are supported (load/retrieve)
+bool rlIsShaderProgramBinarySupported(void)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    return RLGL.ExtSupported.programBinary;
+#else
+    return false;
+#endif
+}
+
+// Get shader program binary data
+// NOTE: Binary format is driver specific, it can only be loaded back on same driver (and version)
+unsigned char *rlGetShaderProgramBinary(unsigned int id, int *size, int *format)
+{
+    unsigned char *data = NULL;
+    *size = 0;
+    *format = 0;
+
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    if (!RLGL.ExtSupported.programBinary || (id == 0)) return data;
+
+    GLint binarySize = 0;
+    glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &binarySize);
+
+    if (binarySize > 0)
+    {
+        data = (unsigned char *)RL_MALLOC(binarySize);
+
+        GLsizei length = 0;
+        GLenum binaryFormat = 0;
+        glGetProgramBinary(id, binarySize, &length, &binaryFormat, data);
+
+        if (length > 0)
+        {
+            *size = length;
+            *format = (int)binaryFormat;
+        }
+        else
+        {
+            RL_FREE(data);
+            data = NULL;
+        }
+    }
+
+    if (data == NULL) TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to retrieve program binary", id);
+#endif
+
+    return data;
+}
+
+// Load shader program from binary data
+// NOTE: Driver can reject the binary (i.e. after a driver update), in that case 0 is returned
+// and shader program must be loaded from source code
+unsigned int rlLoadShaderProgramBinary(const unsigned char *data, int size, int format)
+{
+    unsigned int programId = 0;
+
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return programId; }
+    if (!RLGL.ExtSupported.programBinary || (data == NULL) || (size <= 0)) return programId;
+
+    programId = glCreateProgram();
+    glProgramParameteri(programId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glProgramBinary(programId, (GLenum)format, data, size);
+
+    GLint success = 0;
+    glGetProgramiv(programId, GL_LINK_STATUS, &success);
+
+    if (success == GL_FALSE)
+    {
+        TRACELOG(RL_LOG_INFO, "SHADER: Program binary rejected by driver, it requires recompilation");
+        glDeleteProgram(programId);
+        programId = 0;
+    }
+    else
+    {
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Program shader loaded successfully from binary", programId);
+
+        // Bind default camera uniform block (if declared by the shader)
+        // NOTE: Uniform block bindings are not part of program binary
+        GLuint blockIndex = glGetUniformBlockIndex(programId, RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA);
+        if (blockIndex != GL_INVALID_INDEX) glUniformBlockBinding(programId, blockIndex, RL_DEFAULT_UNIFORM_BLOCK_BINDING_CAMERA);
+    }
+#endif
+
+    return programId;
+}
+
 // Get shader location uniform
 // NOTE: First parameter refers to shader program id
 int rlGetLocationUniform(unsigned int shaderId, const char *uniformName)
@@ -4496,6 +8031,13 @@ void rlSetUniformMatrices(int locIndex, const rl_Matrix *matrices, int count)
 
 // Set shader value uniform sampler
 void rlSetUniformSampler(int locIndex, unsigned int textureId)
+{
+    rlSetUniformSamplerEx(locIndex, textureId, RL_TEXTURE_2D);
+}
+
+// Set shader value uniform sampler for texture target
+// NOTE: Texture is bound to its target on batch drawing, sampler type in shader must match target
+void rlSetUniformSamplerEx(int locIndex, unsigned int textureId, int target)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Check if texture is already active
@@ -4516,6 +8058,7 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
         {
             glUniform1i(locIndex, 1 + i);              // Activate new texture unit
             RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
+            RLGL.State.activeTextureTarget[i] = target; // Save texture target for binding on drawing
             break;
         }
     }
@@ -4525,10 +8068,21 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
 // Set shader currently active (id and locations)
 void rlSetShader(unsigned int id, int *locs)
 {
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        rlCommandData data = { 0 };
+        data.shader.id = id;
+        data.shader.locs = locs;
+        rlRecordCommand(RL_COMMAND_SET_SHADER, &data.shader, sizeof(data.shader));
+        return;
+    }
+#endif
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.State.currentShaderId != id)
     {
-        rlDrawRenderBatch(RLGL.currentBatch);
+        rlFlushRenderBatch(RL_BATCH_FLUSH_SHADER);
+        RLGL.Stats.shaderChanges++;
         RLGL.State.currentShaderId = id;
         RLGL.State.currentShaderLocs = locs;
     }
@@ -4594,6 +8148,15 @@ void rlComputeShaderDispatch(unsigned int groupX, unsigned int groupY, unsigned
 #endif
 }
 
+// Wait for compute shader buffers writes to be visible for following draws and dispatches
+// NOTE: Covers buffers used as SSBO, vertex attributes and indirect draw commands
+void rlComputeShaderBarrier(void)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+#endif
+}
+
 // Load shader storage buffer object (SSBO)
 unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHint)
 {
@@ -4605,6 +8168,8 @@ unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHi
     glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, usageHint? usageHint : RL_STREAM_COPY);
     if (data == NULL) glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R8UI, GL_RED_INTEGER, GL_UNSIGNED_BYTE, NULL);    // Clear buffer data to 0
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, ssbo, RL_GPU_MEMORY_SHADER_BUFFER, size);
 #else
     TRACELOG(RL_LOG_WARNING, "SSBO: SSBO not enabled. Define GRAPHICS_API_OPENGL_43");
 #endif
@@ -4616,6 +8181,7 @@ unsigned int rlLoadShaderBuffer(unsigned int size, const void *data, int usageHi
 void rlUnloadShaderBuffer(unsigned int ssboId)
 {
 #if defined(GRAPHICS_API_OPENGL_43)
+    rlUntrackGpuMemory(RL_GPU_OBJECT_BUFFER, ssboId);
     glDeleteBuffers(1, &ssboId);
 #else
     TRACELOG(RL_LOG_WARNING, "SSBO: SSBO not enabled. Define GRAPHICS_API_OPENGL_43");
@@ -4672,6 +8238,97 @@ void rlCopyShaderBuffer(unsigned int destId, unsigned int srcId, unsigned int de
 #endif
 }
 
+// Load uniform buffer object (UBO)
+unsigned int rlLoadUniformBuffer(unsigned int size, const void *data, int usageHint)
+{
+    unsigned int ubo = 0;
+
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glGenBuffers(1, &ubo);
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+    glBufferData(GL_UNIFORM_BUFFER, size, data, usageHint? usageHint : RL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, ubo, RL_GPU_MEMORY_SHADER_BUFFER, size);
+#else
+    TRACELOG(RL_LOG_WARNING, "UBO: UBO not supported. Define GRAPHICS_API_OPENGL_33 or GRAPHICS_API_OPENGL_ES3");
+#endif
+
+    return ubo;
+}
+
+// Unload uniform buffer object (UBO)
+void rlUnloadUniformBuffer(unsigned int uboId)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    rlUntrackGpuMemory(RL_GPU_OBJECT_BUFFER, uboId);
+    if (uboId > 0) glDeleteBuffers(1, &uboId);
+#endif
+}
+
+// Update uniform buffer object data
+void rlUpdateUniformBuffer(unsigned int id, const void *data, unsigned int dataSize, unsigned int offset)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBuffer(GL_UNIFORM_BUFFER, id);
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, dataSize, data);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+#endif
+}
+
+// Bind uniform buffer object to uniform block binding point
+void rlBindUniformBuffer(unsigned int id, unsigned int index)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBufferBase(GL_UNIFORM_BUFFER, index, id);
+#endif
+}
+
+// Bind shader uniform block to binding point
+// NOTE: Shaders declaring RL_DEFAULT_SHADER_UNIFORM_BLOCK_NAME_CAMERA are bound automatically on loading
+bool rlBindUniformBlock(unsigned int shaderId, const char *blockName, unsigned int index)
+{
+    bool result = false;
+
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    GLuint blockIndex = glGetUniformBlockIndex(shaderId, blockName);
+
+    if (blockIndex != GL_INVALID_INDEX)
+    {
+        glUniformBlockBinding(shaderId, blockIndex, index);
+        result = true;
+    }
+    else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to find uniform block: %s", shaderId, blockName);
+#endif
+
+    return result;
+}
+
+// Update default camera uniform block with current modelview and projection matrices
+// NOTE: Expected to be called once per camera setup (i.e. rl_BeginMode3D()), not per draw
+void rlUpdateCameraBlock(void)
+{
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+    if (rlRecordingBuffer != NULL)
+    {
+        void (*proc)(void) = rlUpdateCameraBlock;
+        rlRecordCommand(RL_COMMAND_CALL, &proc, sizeof(proc));
+        return;
+    }
+#endif
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    if (RLGL.State.cameraBlockId == 0) return;
+
+    float16 block[3] = {
+        rlMatrixToFloatV(RLGL.State.modelview),
+        rlMatrixToFloatV(RLGL.State.projection),
+        rlMatrixToFloatV(rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection))
+    };
+
+    rlUpdateUniformBuffer(RLGL.State.cameraBlockId, block, sizeof(block), 0);
+#endif
+}
+
 // Bind image texture
 void rlBindImageTexture(unsigned int id, unsigned int index, int format, bool readonly)
 {
@@ -4830,7 +8487,7 @@ void rlLoadDrawQuad(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
+    rlCacheBindVertexArray(quadVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &quadVBO);
@@ -4844,9 +8501,9 @@ void rlLoadDrawQuad(void)
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
 
     // Draw quad
-    glBindVertexArray(quadVAO);
+    rlCacheBindVertexArray(quadVAO);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+    rlCacheBindVertexArray(0);
 
     // Delete buffers (VBO and VAO)
     glDeleteBuffers(1, &quadVBO);
@@ -4903,7 +8560,7 @@ void rlLoadDrawCube(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+    rlCacheBindVertexArray(cubeVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &cubeVBO);
@@ -4911,7 +8568,7 @@ void rlLoadDrawCube(void)
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
+    rlCacheBindVertexArray(cubeVAO);
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
@@ -4919,12 +8576,12 @@ void rlLoadDrawCube(void)
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    rlCacheBindVertexArray(0);
 
     // Draw cube
-    glBindVertexArray(cubeVAO);
+    rlCacheBindVertexArray(cubeVAO);
     glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+    rlCacheBindVertexArray(0);
 
     // Delete VBO and VAO
     glDeleteBuffers(1, &cubeVBO);
@@ -4961,6 +8618,8 @@ const char *rlGetPixelFormatName(unsigned int format)
         case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: return "PVRT_RGBA"; break;           // 4 bpp
         case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: return "ASTC_4x4_RGBA"; break;   // 8 bpp
         case RL_PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: return "ASTC_8x8_RGBA"; break;   // 2 bpp
+        case RL_PIXELFORMAT_COMPRESSED_BC7_RGBA: return "BC7_RGBA"; break;             // 8 bpp
+        case RL_PIXELFORMAT_COMPRESSED_BC4_R: return "BC4_R"; break;                   // 4 bpp
         default: return "UNKNOWN"; break;
     }
 }
@@ -5077,6 +8736,74 @@ static void rlLoadShaderDefault(void)
     "}                                  \n";
 #endif
 
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+    // Multi-texture default shader: texture sampled is selected by per-vertex texture slot,
+    // slot 0 uses texture0 and the rest of slots use batchTextures[] samplers
+    // NOTE: Samplers are only indexed with constant expressions, as required by GLSL ES 1.00
+#if defined(GRAPHICS_API_OPENGL_21)
+    const char *glslHeader = "#version 120\n";
+    const char *glslVertexIn = "attribute";
+    const char *glslVertexOut = "varying";
+    const char *glslFragmentIn = "varying";
+    const char *glslFragmentOut = "#define finalColor gl_FragColor\n";
+    const char *glslTexture = "texture2D";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    const char *glslHeader = "#version 330\n";
+    const char *glslVertexIn = "in";
+    const char *glslVertexOut = "out";
+    const char *glslFragmentIn = "in";
+    const char *glslFragmentOut = "out vec4 finalColor;\n";
+    const char *glslTexture = "texture";
+#endif
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    const char *glslHeader = "#version 300 es\nprecision mediump float;\n";
+    const char *glslVertexIn = "in";
+    const char *glslVertexOut = "out";
+    const char *glslFragmentIn = "in";
+    const char *glslFragmentOut = "out vec4 finalColor;\n";
+    const char *glslTexture = "texture";
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    const char *glslHeader = "#version 100\nprecision mediump float;\n";
+    const char *glslVertexIn = "attribute";
+    const char *glslVertexOut = "varying";
+    const char *glslFragmentIn = "varying";
+    const char *glslFragmentOut = "#define finalColor gl_FragColor\n";
+    const char *glslTexture = "texture2D";
+#endif
+
+    char multiVShaderCode[1024] = { 0 };
+    char multiFShaderCode[2048] = { 0 };
+
+    snprintf(multiVShaderCode, sizeof(multiVShaderCode),
+        "%s%s vec3 vertexPosition;\n%s vec2 vertexTexCoord;\n%s vec4 vertexColor;\n%s float %s;\n"
+        "%s vec2 fragTexCoord;\n%s vec4 fragColor;\n%s float fragTexIndex;\n"
+        "uniform mat4 mvp;\n"
+        "void main()\n{\n"
+        "    fragTexCoord = vertexTexCoord;\n    fragColor = vertexColor;\n    fragTexIndex = %s;\n"
+        "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n}\n",
+        glslHeader, glslVertexIn, glslVertexIn, glslVertexIn, glslVertexIn, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX,
+        glslVertexOut, glslVertexOut, glslVertexOut, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXINDEX);
+
+    int length = snprintf(multiFShaderCode, sizeof(multiFShaderCode),
+        "%s%s vec2 fragTexCoord;\n%s vec4 fragColor;\n%s float fragTexIndex;\n%s"
+        "uniform sampler2D texture0;\nuniform sampler2D batchTextures[%i];\nuniform vec4 colDiffuse;\n"
+        "void main()\n{\n"
+        "    vec4 texelColor = vec4(1.0);\n"
+        "    if (fragTexIndex < 0.5) texelColor = %s(texture0, fragTexCoord);\n",
+        glslHeader, glslFragmentIn, glslFragmentIn, glslFragmentIn, glslFragmentOut, RL_DEFAULT_BATCH_DRAW_TEXTURES - 1, glslTexture);
+
+    for (int i = 1; i < RL_DEFAULT_BATCH_DRAW_TEXTURES; i++)
+    {
+        length += snprintf(multiFShaderCode + length, sizeof(multiFShaderCode) - length,
+            "    else if (fragTexIndex < %i.5) texelColor = %s(batchTextures[%i], fragTexCoord);\n", i, glslTexture, i - 1);
+    }
+
+    snprintf(multiFShaderCode + length, sizeof(multiFShaderCode) - length, "    finalColor = texelColor*colDiffuse*fragColor;\n}\n");
+
+    defaultVShaderCode = multiVShaderCode;
+    defaultFShaderCode = multiFShaderCode;
+#endif
+
     // NOTE: Compiled vertex/fragment shaders are not deleted,
     // they are kept for re-use as default shaders in case some shader loading fails
     RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
@@ -5097,6 +8824,26 @@ static void rlLoadShaderDefault(void)
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);
+
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+        // Set draw textures samplers units, placed after additional sampler textures units
+        // NOTE: Sampler units are kept by the program, only required to be set once
+        int maxTextureUnits = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureUnits);
+        if ((1 + RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + RL_DEFAULT_BATCH_DRAW_TEXTURES - 1) > maxTextureUnits)
+        {
+            TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Draw textures exceed GPU texture units (%i), reduce RL_DEFAULT_BATCH_DRAW_TEXTURES", RLGL.State.defaultShaderId, maxTextureUnits);
+        }
+
+        rlCacheUseProgram(RLGL.State.defaultShaderId);
+        for (int i = 1; i < RL_DEFAULT_BATCH_DRAW_TEXTURES; i++)
+        {
+            char samplerName[32] = { 0 };
+            snprintf(samplerName, sizeof(samplerName), "batchTextures[%i]", i - 1);
+            glUniform1i(glGetUniformLocation(RLGL.State.defaultShaderId, samplerName), RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS + i);
+        }
+        rlCacheUseProgram(0);
+#endif
     }
     else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
 }
@@ -5105,7 +8852,7 @@ static void rlLoadShaderDefault(void)
 // NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
 static void rlUnloadShaderDefault(void)
 {
-    glUseProgram(0);
+    rlCacheUseProgram(0);
 
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
@@ -5119,6 +8866,415 @@ static void rlUnloadShaderDefault(void)
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader unloaded successfully", RLGL.State.defaultShaderId);
 }
 
+// Sort render batch draw calls by layer, texture and mode, merging draws sharing state
+// NOTE: Vertex data of current buffer is reordered so merged draws are contiguous,
+// sorting is stable, so relative order of draws sharing the same key is preserved
+static void rlSortRenderBatch(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+    rlDrawCall *draws = batch->draws;
+
+    int order[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };      // Draw calls order (only draws with vertex data)
+    int offsets[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };    // Draw calls original vertex offset
+    int count = 0;
+
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        if (draws[i].vertexCount > 0)
+        {
+            order[count] = i;
+            offsets[count] = vertexOffset;
+            count++;
+        }
+
+        vertexOffset += (draws[i].vertexCount + draws[i].vertexAlignment);
+    }
+
+    if (count < 2) return;
+
+    // Stable insertion sort by key: layer -> texture -> mode
+    // NOTE: Draw calls number is small (RL_DEFAULT_BATCH_DRAWCALLS) and usually partially sorted
+    for (int i = 1; i < count; i++)
+    {
+        int index = order[i];
+        int offset = offsets[i];
+        int j = i - 1;
+
+        while (j >= 0)
+        {
+            rlDrawCall *a = &draws[order[j]];
+            rlDrawCall *b = &draws[index];
+
+            bool greater = (a->layer > b->layer) ||
+                ((a->layer == b->layer) && (a->textureId > b->textureId)) ||
+                ((a->layer == b->layer) && (a->textureId == b->textureId) && (a->mode > b->mode));
+
+            if (!greater) break;
+
+            order[j + 1] = order[j];
+            offsets[j + 1] = offsets[j];
+            j--;
+        }
+
+        order[j + 1] = index;
+        offsets[j + 1] = offset;
+    }
+
+    // Compute merged draws layout, every merged draw starts aligned to 4 vertex (required by QUADS indexing)
+    rlDrawCall merged[RL_DEFAULT_BATCH_DRAWCALLS] = { 0 };
+    int mergedCount = 0;
+    int vertexTotal = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        rlDrawCall *draw = &draws[order[i]];
+
+        if ((mergedCount == 0) || !rlDrawCallsShareState(&merged[mergedCount - 1], draw))
+        {
+            if (mergedCount > 0)
+            {
+                merged[mergedCount - 1].vertexAlignment = (4 - vertexTotal%4)%4;
+                vertexTotal += merged[mergedCount - 1].vertexAlignment;
+            }
+
+            merged[mergedCount] = *draw;
+            merged[mergedCount].vertexCount = 0;
+            merged[mergedCount].vertexAlignment = 0;
+            mergedCount++;
+        }
+
+        merged[mergedCount - 1].vertexCount += draw->vertexCount;
+        vertexTotal += draw->vertexCount;
+    }
+
+    // Nothing to gain or new layout does not fit the buffer, keep original order
+    if ((mergedCount == batch->drawCounter) || (vertexTotal > buffer->elementCount*4)) return;
+
+    // Reorder vertex data using scratch buffer
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+    int vertexSize = sizeof(rlBatchVertex);
+#else
+    int vertexSize = 3*sizeof(float) + 2*sizeof(float) + 3*sizeof(float) + 4*sizeof(unsigned char);
+#endif
+    int requiredSize = vertexTotal*vertexSize;
+
+    if (RLGL.State.sortBufferSize < requiredSize)
+    {
+        void *sortBuffer = RL_REALLOC(RLGL.State.sortBuffer, requiredSize);
+        if (sortBuffer == NULL) return;
+
+        RLGL.State.sortBuffer = sortBuffer;
+        RLGL.State.sortBufferSize = requiredSize;
+    }
+
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+    rlBatchVertex *data = (rlBatchVertex *)RLGL.State.sortBuffer;
+#else
+    float *vertices = (float *)RLGL.State.sortBuffer;
+    float *texcoords = vertices + 3*vertexTotal;
+    float *normals = texcoords + 2*vertexTotal;
+    unsigned char *colors = (unsigned char *)(normals + 3*vertexTotal);
+#endif
+
+    for (int i = 0, m = -1, position = 0; i < count; i++)
+    {
+        rlDrawCall *draw = &draws[order[i]];
+
+        // Move write position to next merged draw start when state changes
+        if ((m < 0) || !rlDrawCallsShareState(&merged[m], draw))
+        {
+            if (m >= 0) position += merged[m].vertexAlignment;
+            m++;
+        }
+
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+        memcpy(&data[position], &buffer->data[offsets[i]], draw->vertexCount*sizeof(rlBatchVertex));
+#else
+        memcpy(&vertices[3*position], &buffer->vertices[3*offsets[i]], draw->vertexCount*3*sizeof(float));
+        memcpy(&texcoords[2*position], &buffer->texcoords[2*offsets[i]], draw->vertexCount*2*sizeof(float));
+        memcpy(&normals[3*position], &buffer->normals[3*offsets[i]], draw->vertexCount*3*sizeof(float));
+        memcpy(&colors[4*position], &buffer->colors[4*offsets[i]], draw->vertexCount*4*sizeof(unsigned char));
+#endif
+        position += draw->vertexCount;
+    }
+
+    // Copy reordered vertex data back to batch buffer
+    // NOTE: Padding vertex are also copied but they are never processed
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+    memcpy(buffer->data, data, vertexTotal*sizeof(rlBatchVertex));
+#else
+    memcpy(buffer->vertices, vertices, vertexTotal*3*sizeof(float));
+    memcpy(buffer->texcoords, texcoords, vertexTotal*2*sizeof(float));
+    memcpy(buffer->normals, normals, vertexTotal*3*sizeof(float));
+    memcpy(buffer->colors, colors, vertexTotal*4*sizeof(unsigned char));
+#endif
+
+    for (int i = 0; i < mergedCount; i++) draws[i] = merged[i];
+    for (int i = mergedCount; i < batch->drawCounter; i++) draws[i].vertexCount = 0;
+
+    batch->drawCounter = mergedCount;
+    RLGL.State.vertexCounter = vertexTotal;
+}
+
+// Check if two draw calls share the same state (layer, mode and textures), so they can be merged
+static bool rlDrawCallsShareState(const rlDrawCall *a, const rlDrawCall *b)
+{
+    bool share = (a->layer == b->layer) && (a->mode == b->mode) && (a->textureId == b->textureId);
+
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+    // Vertex texture slots are only valid for their own draw textures
+    int countA = (a->textureCount > 0)? a->textureCount : 1;
+    int countB = (b->textureCount > 0)? b->textureCount : 1;
+
+    if (share && (countA == countB))
+    {
+        for (int i = 1; i < countA; i++)
+        {
+            if (a->textureIds[i] != b->textureIds[i]) { share = false; break; }
+        }
+    }
+    else share = false;
+#endif
+
+    return share;
+}
+
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+// Get draw texture slot for a texture, texture is added to the draw if not referenced yet
+// NOTE: Returns -1 if all draw slots are in use, a new draw call is required
+static int rlGetDrawTextureSlot(rlDrawCall *draw, unsigned int id)
+{
+    if (draw->textureCount == 0)
+    {
+        draw->textureIds[0] = draw->textureId;
+        draw->textureCount = 1;
+    }
+
+    for (int i = 0; i < draw->textureCount; i++)
+    {
+        if (draw->textureIds[i] == id) return i;
+    }
+
+    if (draw->textureCount < RL_DEFAULT_BATCH_DRAW_TEXTURES)
+    {
+        draw->textureIds[draw->textureCount] = id;
+        draw->textureCount++;
+
+        return draw->textureCount - 1;
+    }
+
+    return -1;
+}
+
+// Get texture of draw current slot, texture to be used by next vertices
+static unsigned int rlGetDrawCurrentTexture(const rlDrawCall *draw)
+{
+    if ((draw->textureCount > 0) && (RLGL.State.currentTextureSlot < draw->textureCount)) return draw->textureIds[RLGL.State.currentTextureSlot];
+    else return draw->textureId;
+}
+#endif
+
+// Record render batch draws into current drawing list
+// NOTE: Quads are converted to triangles, consecutive draws sharing mode and texture are merged
+static void rlRecordDrawingList(rlRenderBatch *batch)
+{
+    rlVertexBuffer *buffer = &batch->vertexBuffer[batch->currentBuffer];
+
+    // Required vertex capacity, quads are converted to two triangles (6 vertices)
+    int required = RLGL.DrawingList.vertexCount;
+    for (int i = 0; i < batch->drawCounter; i++)
+    {
+        if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) required += batch->draws[i].vertexCount;
+        else required += batch->draws[i].vertexCount/4*6;
+    }
+
+    if (required > RLGL.DrawingList.vertexCapacity)
+    {
+        int capacity = (RLGL.DrawingList.vertexCapacity > 0)? RLGL.DrawingList.vertexCapacity : 1024;
+        while (capacity < required) capacity *= 2;
+
+        RLGL.DrawingList.vertices = (float *)RL_REALLOC(RLGL.DrawingList.vertices, capacity*3*sizeof(float));
+        RLGL.DrawingList.texcoords = (float *)RL_REALLOC(RLGL.DrawingList.texcoords, capacity*2*sizeof(float));
+        RLGL.DrawingList.normals = (float *)RL_REALLOC(RLGL.DrawingList.normals, capacity*3*sizeof(float));
+        RLGL.DrawingList.colors = (unsigned char *)RL_REALLOC(RLGL.DrawingList.colors, capacity*4*sizeof(unsigned char));
+        RLGL.DrawingList.vertexCapacity = capacity;
+    }
+
+    if ((RLGL.DrawingList.drawCount + batch->drawCounter) > RLGL.DrawingList.drawCapacity)
+    {
+        int capacity = (RLGL.DrawingList.drawCapacity > 0)? RLGL.DrawingList.drawCapacity : 64;
+        while (capacity < (RLGL.DrawingList.drawCount + batch->drawCounter)) capacity *= 2;
+
+        RLGL.DrawingList.draws = (unsigned int *)RL_REALLOC(RLGL.DrawingList.draws, capacity*4*sizeof(unsigned int));
+        RLGL.DrawingList.drawCapacity = capacity;
+    }
+
+    static const int quadIndices[6] = { 0, 1, 2, 0, 2, 3 };
+
+    for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
+    {
+        const rlDrawCall *draw = &batch->draws[i];
+        bool quads = (draw->mode != RL_LINES) && (draw->mode != RL_TRIANGLES);
+        int count = quads? draw->vertexCount/4*6 : draw->vertexCount;
+
+        if (count > 0)
+        {
+            unsigned int mode = (draw->mode == RL_LINES)? RL_LINES : RL_TRIANGLES;
+            unsigned int *last = (RLGL.DrawingList.drawCount > 0)? &RLGL.DrawingList.draws[(RLGL.DrawingList.drawCount - 1)*4] : NULL;
+
+            if ((last != NULL) && (last[0] == mode) && (last[3] == draw->textureId)) last[2] += count;
+            else
+            {
+                unsigned int *next = &RLGL.DrawingList.draws[RLGL.DrawingList.drawCount*4];
+                next[0] = mode;
+                next[1] = RLGL.DrawingList.vertexCount;
+                next[2] = count;
+                next[3] = draw->textureId;
+                RLGL.DrawingList.drawCount++;
+            }
+
+            for (int k = 0; k < count; k++)
+            {
+                int src = vertexOffset + (quads? (k/6*4 + quadIndices[k%6]) : k);
+                int dst = RLGL.DrawingList.vertexCount;
+
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+                const rlBatchVertex *vertex = &buffer->data[src];
+                memcpy(&RLGL.DrawingList.vertices[dst*3], vertex->position, 3*sizeof(float));
+                memcpy(&RLGL.DrawingList.texcoords[dst*2], vertex->texcoord, 2*sizeof(float));
+                for (int c = 0; c < 3; c++) RLGL.DrawingList.normals[dst*3 + c] = (float)vertex->normal[c]/32767.0f;
+                memcpy(&RLGL.DrawingList.colors[dst*4], vertex->color, 4*sizeof(unsigned char));
+#else
+                memcpy(&RLGL.DrawingList.vertices[dst*3], &buffer->vertices[src*3], 3*sizeof(float));
+                memcpy(&RLGL.DrawingList.texcoords[dst*2], &buffer->texcoords[src*2], 2*sizeof(float));
+                memcpy(&RLGL.DrawingList.normals[dst*3], &buffer->normals[src*3], 3*sizeof(float));
+                memcpy(&RLGL.DrawingList.colors[dst*4], &buffer->colors[src*4], 4*sizeof(unsigned char));
+#endif
+                RLGL.DrawingList.vertexCount++;
+            }
+        }
+
+        vertexOffset += (draw->vertexCount + draw->vertexAlignment);
+    }
+}
+
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+// Set interleaved batch vertex attributes for current shader
+// NOTE: Interleaved vertex buffer must be bound to GL_ARRAY_BUFFER
+static void rlSetBatchVertexAttributes(void)
+{
+    int *locs = RLGL.State.currentShaderLocs;
+
+    glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_POSITION]);
+    glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, GL_FALSE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, position));
+    glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+    glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, GL_FALSE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, texcoord));
+
+    // NOTE: Default shader does not use normals, location is only available on batch loading
+    if (locs[RL_SHADER_LOC_VERTEX_NORMAL] != -1)
+    {
+        glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_NORMAL]);
+        glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_SHORT, GL_TRUE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, normal));
+    }
+
+    glEnableVertexAttribArray(locs[RL_SHADER_LOC_VERTEX_COLOR]);
+    glVertexAttribPointer(locs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)offsetof(rlBatchVertex, color));
+
+#if defined(RLGL_ENABLE_MULTITEXTURE_BATCH)
+    // Texture slot is stored in normal padding component, only used by default shader
+    if (RLGL.State.currentShaderId == RLGL.State.defaultShaderId)
+    {
+        glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXINDEX);
+        glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXINDEX, 1, GL_SHORT, GL_FALSE, sizeof(rlBatchVertex), (void *)(offsetof(rlBatchVertex, normal) + 3*sizeof(short)));
+    }
+    else glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXINDEX);
+#endif
+}
+#endif
+
+// Load batch vertex data arrays in CPU (RAM), uploaded to GPU on every batch draw
+static void rlLoadBatchVertexArrays(rlVertexBuffer *buffer)
+{
+    int bufferElements = buffer->elementCount;
+
+#if defined(RLGL_ENABLE_INTERLEAVED_BATCH_BUFFERS)
+    buffer->data = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));    // 4 vertex by quad
+#else
+    buffer->vertices = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));     // 3 float by vertex, 4 vertex by quad
+    buffer->texcoords = (float *)RL_CALLOC(bufferElements*2*4, sizeof(float));    // 2 float by texcoord, 4 texcoord by quad
+    buffer->normals = (float *)RL_CALLOC(bufferElements*3*4, sizeof(float));      // 3 float by vertex, 4 vertex by quad
+    buffer->colors = (unsigned char *)RL_CALLOC(bufferElements*4*4, sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+
+    for (int j = 0; j < (3*4*bufferElements); j++) buffer->vertices[j] = 0.0f;
+    for (int j = 0; j < (2*4*bufferElements); j++) buffer->texcoords[j] = 0.0f;
+    for (int j = 0; j < (3*4*bufferElements); j++) buffer->normals[j] = 0.0f;
+    for (int j = 0; j < (4*4*bufferElements); j++) buffer->colors[j] = 0;
+#endif
+}
+
+#if defined(RLGL_ENABLE_PERSISTENT_BATCH_BUFFERS) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+// Load a persistently mapped vertex buffer, returns mapped pointer
+// NOTE: Buffer is kept bound to GL_ARRAY_BUFFER, useful to configure vertex attributes
+static void *rlMapPersistentBuffer(unsigned int *vboId, int size)
+{
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    glGenBuffers(1, vboId);
+    glBindBuffer(GL_ARRAY_BUFFER, *vboId);
+    glBufferStorage(GL_ARRAY_BUFFER, size, NULL, flags);
+    rlTrackGpuMemory(RL_GPU_OBJECT_BUFFER, *vboId, RL_GPU_MEMORY_VERTEX_BUFFER, size);
+
+    void *data = glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+    if (data != NULL) memset(data, 0, size);
+    else TRACELOG(RL_LOG_WARNING, "VBO: [ID %i] Failed to map persistent buffer", *vboId);
+
+    return data;
+}
+
+// Unmap and delete batch persistently mapped vertex buffers, vertex data pointers are reset
+// NOTE: Used when mapping fails, buffers can not be reallocated (immutable storage)
+static void rlUnloadPersistentBuffers(rlVertexBuffer *buffer)
+{
+    for (int j = 0; j < 4; j++)
+    {
+        if (buffer->vboId[j] == 0) continue;  // Interleaved layout only uses first VBO
+
+        glBindBuffer(GL_ARRAY_BUFFER, buffer->vboId[j]);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        rlUntrackGpuMemory(RL_GPU_OBJECT_BUFFER, buffer->vboId[j]);
+        glDeleteBuffers(1, &buffer->vboId[j]);
+        buffer->vboId[j] = 0;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    buffer->data = NULL;
+    buffer->vertices = NULL;
+    buffer->texcoords = NULL;
+    buffer->normals = NULL;
+    buffer->colors = NULL;
+}
+
+// Wait for buffer fence to be signaled by GPU (buffer not in use)
+static void rlWaitBufferFence(rlVertexBuffer *buffer)
+{
+    if (buffer->syncFence != NULL)
+    {
+        GLenum result = GL_TIMEOUT_EXPIRED;
+        GLbitfield waitFlags = 0;
+
+        // Flush pending commands only if fence is not already signaled
+        while ((result != GL_ALREADY_SIGNALED) && (result != GL_CONDITION_SATISFIED) && (result != GL_WAIT_FAILED))
+        {
+            result = glClientWaitSync((GLsync)buffer->syncFence, waitFlags, 1000000);  // Timeout: 1 ms (in nanoseconds)
+            waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        }
+
+        glDeleteSync((GLsync)buffer->syncFence);
+        buffer->syncFence = NULL;
+    }
+}
+#endif
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 // Get compressed format official GL identifier name
 static const char *rlGetCompressedFormatName(int format)
@@ -5193,9 +9349,160 @@ static const char *rlGetCompressedFormatName(int format)
         default: return "GL_COMPRESSED_UNKNOWN"; break;
     }
 }
-#endif  // RLGL_SHOW_GL_DETAILS_INFO
+#endif  // RLGL_SHOW_GL_DETAILS_INFO
+
+#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+
+// Load layered texture (array or 3D) mipmap levels
+// NOTE: Texture arrays keep layers count on every level, 3D textures halve depth on every level
+static unsigned int rlLoadTextureLayers(unsigned int target, const void *data, int width, int height, int depth, int format, int mipmapCount)
+{
+    unsigned int id = 0;
+    if (!isGpuReady) { TRACELOG(RL_LOG_WARNING, "GL: GPU is not ready to load data, trying to load before rl_InitWindow()?"); return id; }
+
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    if ((target == GL_TEXTURE_3D) && (format >= RL_PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: 3D textures do not support compressed formats");
+        return id;
+    }
+
+    unsigned int glInternalFormat, glFormat, glType;
+    rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
+
+    if (glInternalFormat == 0)
+    {
+        TRACELOG(RL_LOG_WARNING, "GL: Texture format not supported for layered textures (%i)", format);
+        return id;
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    glGenTextures(1, &id);
+    glBindTexture(target, id);
+
+    int mipWidth = width;
+    int mipHeight = height;
+    int mipDepth = depth;
+    long long textureSize = 0;  // Size of all mipmap levels (GPU memory stats)
+
+    // NOTE: Added pointer math separately from function to avoid UBSAN complaining
+    unsigned char *dataPtr = NULL;
+    if (data != NULL) dataPtr = (unsigned char *)data;
+
+    // Load the different mipmap levels, all layers at once
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        unsigned int mipSize = rlGetPixelDataSize(mipWidth, mipHeight, format)*mipDepth;
+
+        if (format < RL_PIXELFORMAT_COMPRESSED_DXT1_RGB) glTexImage3D(target, i, glInternalFormat, mipWidth, mipHeight, mipDepth, 0, glFormat, glType, dataPtr);
+        else glCompressedTexImage3D(target, i, glInternalFormat, mipWidth, mipHeight, mipDepth, 0, mipSize, dataPtr);
+        textureSize += mipSize;
+
+        mipWidth /= 2;
+        mipHeight /= 2;
+        if (target == GL_TEXTURE_3D) mipDepth /= 2;
+        if (data != NULL) dataPtr += mipSize; // Increment data pointer to next mipmap
+
+        // Security check for NPOT textures
+        if (mipWidth < 1) mipWidth = 1;
+        if (mipHeight < 1) mipHeight = 1;
+        if (mipDepth < 1) mipDepth = 1;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+    {
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+        glTexParameteriv(target, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+    }
+    else if (format == RL_PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)
+    {
+        GLint swizzleMask[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+        glTexParameteriv(target, GL_TEXTURE_SWIZZLE_RGBA, swizzleMask);
+    }
+#endif
+
+    // Same default parameters as 2D textures, layers are sampled independently (no bleeding between them)
+    glTexParameteri(target, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(target, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    if (target == GL_TEXTURE_3D) glTexParameteri(target, GL_TEXTURE_WRAP_R, GL_REPEAT);
+
+    if (mipmapCount > 1)
+    {
+        // Activate trilinear filtering if mipmaps are available
+        glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    }
+    else
+    {
+        glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    }
+
+    glTexParameteri(target, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, mipmapCount - 1);
+
+    glBindTexture(target, 0);
+
+    rlTrackGpuMemory(RL_GPU_OBJECT_TEXTURE, id, RL_GPU_MEMORY_TEXTURE, textureSize);
+
+    if (id > 0)
+    {
+        if (target == GL_TEXTURE_3D) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] 3D texture loaded successfully (%ix%ix%i | %s | %i mipmaps)", id, width, height, depth, rlGetPixelFormatName(format), mipmapCount);
+        else TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Array texture loaded successfully (%ix%i | %i layers | %s | %i mipmaps)", id, width, height, depth, rlGetPixelFormatName(format), mipmapCount);
+    }
+    else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load layered texture");
+#else
+    TRACELOG(RL_LOG_WARNING, "GL: Texture arrays and 3D textures require OpenGL 3.3 or OpenGL ES 3.0");
+#endif
+
+    return id;
+}
 
-#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+// Set texture parameters (wrap mode/filter mode) for non-2D texture target
+static void rlTextureTargetParameters(unsigned int target, unsigned int id, int param, int value)
+{
+#if (defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindTexture(target, id);
+
+    switch (param)
+    {
+        case RL_TEXTURE_WRAP_S:
+        case RL_TEXTURE_WRAP_T:
+        case RL_TEXTURE_WRAP_R:
+        {
+            if (value == RL_TEXTURE_WRAP_MIRROR_CLAMP)
+            {
+                if (RLGL.ExtSupported.texMirrorClamp) glTexParameteri(target, param, value);
+                else TRACELOG(RL_LOG_WARNING, "GL: Clamp mirror wrap mode not supported (GL_MIRROR_CLAMP_EXT)");
+            }
+            else glTexParameteri(target, param, value);
+        } break;
+        case RL_TEXTURE_MAG_FILTER:
+        case RL_TEXTURE_MIN_FILTER: glTexParameteri(target, param, value); break;
+        case RL_TEXTURE_FILTER_ANISOTROPIC:
+        {
+            // Reset anisotropy filter, in case it was set
+            glTexParameterf(target, GL_TEXTURE_MAX_ANISOTROPY_EXT, 1.0f);
+
+            if (value <= RLGL.ExtSupported.maxAnisotropyLevel) glTexParameterf(target, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)value);
+            else if (RLGL.ExtSupported.maxAnisotropyLevel > 0.0f)
+            {
+                TRACELOG(RL_LOG_WARNING, "GL: Maximum anisotropic filter level supported is %iX", (int)RLGL.ExtSupported.maxAnisotropyLevel);
+                glTexParameterf(target, GL_TEXTURE_MAX_ANISOTROPY_EXT, (float)value);
+            }
+            else TRACELOG(RL_LOG_WARNING, "GL: Anisotropic filtering not supported");
+        } break;
+#if defined(GRAPHICS_API_OPENGL_33)
+        case RL_TEXTURE_MIPMAP_BIAS_RATIO: glTexParameterf(target, GL_TEXTURE_LOD_BIAS, value/100.0f); break;
+#endif
+        default: break;
+    }
+
+    glBindTexture(target, 0);
+#endif
+}
 
 // Get pixel data size in bytes (image or texture)
 // NOTE: Size depends on pixel format
@@ -5224,7 +9531,8 @@ static int rlGetPixelDataSize(int width, int height, int format)
         case RL_PIXELFORMAT_COMPRESSED_ETC1_RGB:
         case RL_PIXELFORMAT_COMPRESSED_ETC2_RGB:
         case RL_PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA: // 8 bytes per each 4x4 block
+        case RL_PIXELFORMAT_COMPRESSED_PVRT_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_BC4_R: // 8 bytes per each 4x4 block
         {
             int blockWidth = (width + 3)/4;
             int blockHeight = (height + 3)/4;
@@ -5233,7 +9541,8 @@ static int rlGetPixelDataSize(int width, int height, int format)
         case RL_PIXELFORMAT_COMPRESSED_DXT3_RGBA:
         case RL_PIXELFORMAT_COMPRESSED_DXT5_RGBA:
         case RL_PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: // 16 bytes per each 4x4 block
+        case RL_PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA:
+        case RL_PIXELFORMAT_COMPRESSED_BC7_RGBA: // 16 bytes per each 4x4 block
         {
             int blockWidth = (width + 3)/4;
             int blockHeight = (height + 3)/4;
@@ -5259,6 +9568,410 @@ static int rlGetPixelDataSize(int width, int height, int format)
     return dataSize;
 }
 
+// Update GPU memory stats of a resource type and accumulated stats
+static void rlUpdateGpuMemoryStats(int type, long long size, int count)
+{
+    rlGpuMemoryStats *stats[2] = { &gpuMemory.stats[type], &gpuMemory.stats[RL_GPU_MEMORY_TYPE_COUNT] };
+
+    for (int i = 0; i < 2; i++)
+    {
+        stats[i]->liveBytes += size;
+        stats[i]->liveCount += count;
+        if (count > 0) stats[i]->totalCount += count;
+        if (stats[i]->liveBytes > stats[i]->peakBytes) stats[i]->peakBytes = stats[i]->liveBytes;
+    }
+}
+
+// Get GPU memory tracker hash table slot for an object key
+static int rlGetGpuMemorySlot(unsigned long long key)
+{
+    // NOTE: Fibonacci hashing spreads sequential GL ids over table
+    int slot = (int)((key*11400714819323198485ull) >> 32) & (gpuMemory.capacity - 1);
+
+    while ((gpuMemory.entries[slot].key != 0) && (gpuMemory.entries[slot].key != key)) slot = (slot + 1) & (gpuMemory.capacity - 1);
+
+    return slot;
+}
+
+// Track GPU object memory by resource type
+// NOTE: Tracking an already tracked object replaces its size and type (i.e. storage reallocated)
+static void rlTrackGpuMemory(int object, unsigned int id, int type, long long size)
+{
+    if ((id == 0) || (type < 0) || (type >= RL_GPU_MEMORY_TYPE_COUNT)) return;
+
+    // Grow hash table on 75% load, all entries are rehashed
+    if ((gpuMemory.count + 1)*4 > gpuMemory.capacity*3)
+    {
+        rlGpuMemoryEntry *entries = gpuMemory.entries;
+        int capacity = gpuMemory.capacity;
+        int newCapacity = (capacity > 0)? capacity*2 : 256;
+
+        rlGpuMemoryEntry *newEntries = (rlGpuMemoryEntry *)RL_CALLOC(newCapacity, sizeof(rlGpuMemoryEntry));
+        if (newEntries == NULL) return;
+
+        gpuMemory.entries = newEntries;
+        gpuMemory.capacity = newCapacity;
+
+        for (int i = 0; i < capacity; i++)
+        {
+            if (entries[i].key != 0) gpuMemory.entries[rlGetGpuMemorySlot(entries[i].key)] = entries[i];
+        }
+
+        RL_FREE(entries);
+    }
+
+    unsigned long long key = ((unsigned long long)object << 32) | id;
+    rlGpuMemoryEntry *entry = &gpuMemory.entries[rlGetGpuMemorySlot(key)];
+
+    if (entry->key == key) rlUpdateGpuMemoryStats(entry->type, -entry->size, -1);
+    else gpuMemory.count++;
+
+    entry->key = key;
+    entry->size = size;
+    entry->type = type;
+    rlUpdateGpuMemoryStats(type, size, 1);
+}
+
+// Untrack GPU object memory (if tracked)
+static void rlUntrackGpuMemory(int object, unsigned int id)
+{
+    if ((id == 0) || (gpuMemory.count == 0)) return;
+
+    unsigned long long key = ((unsigned long long)object << 32) | id;
+    int slot = rlGetGpuMemorySlot(key);
+
+    if (gpuMemory.entries[slot].key != key) return;
+
+    rlUpdateGpuMemoryStats(gpuMemory.entries[slot].type, -gpuMemory.entries[slot].size, -1);
+    gpuMemory.entries[slot].key = 0;
+    gpuMemory.count--;
+
+    // Move back following entries of probing sequence, table keeps no deleted entries markers
+    int mask = gpuMemory.capacity - 1;
+
+    for (int next = (slot + 1) & mask; gpuMemory.entries[next].key != 0; next = (next + 1) & mask)
+    {
+        rlGpuMemoryEntry entry = gpuMemory.entries[next];
+        gpuMemory.entries[next].key = 0;
+        gpuMemory.entries[rlGetGpuMemorySlot(entry.key)] = entry;
+    }
+}
+
+// Unload GPU memory tracker, tracked resources are forgotten
+static void rlUnloadGpuMemoryTracker(void)
+{
+    if (gpuMemory.count > 0) TRACELOG(RL_LOG_WARNING, "RLGL: %i GPU resources not unloaded (%lli bytes)", gpuMemory.count, gpuMemory.stats[RL_GPU_MEMORY_TYPE_COUNT].liveBytes);
+
+    RL_FREE(gpuMemory.entries);
+    memset(&gpuMemory, 0, sizeof(rlGpuMemoryTracker));
+}
+
+// Get texture mipmap chain size in bytes
+static long long rlGetTextureMipmapsSize(int width, int height, int format, int mipmapCount)
+{
+    long long size = 0;
+
+    for (int i = 0; i < mipmapCount; i++)
+    {
+        size += rlGetPixelDataSize(width, height, format);
+
+        width = (width/2 < 1)? 1 : width/2;
+        height = (height/2 < 1)? 1 : height/2;
+    }
+
+    return size;
+}
+
+// Set all cached GL state to unknown
+// NOTE: Cache is only used with RLGL_ENABLE_STATE_CACHE, elided calls counter is preserved
+static void rlCacheInvalidate(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    RLGL.Cache.programId = -1;
+    RLGL.Cache.vaoId = -1;
+    RLGL.Cache.activeTextureSlot = -1;
+    for (int i = 0; i < RL_MAX_STATE_CACHE_TEXTURE_UNITS; i++) RLGL.Cache.textureId[i] = -1;
+
+    RLGL.Cache.blendSrcFactor = -1;
+    RLGL.Cache.blendDstFactor = -1;
+    RLGL.Cache.blendEquation = -1;
+    RLGL.Cache.colorBlend = -1;
+    RLGL.Cache.depthTest = -1;
+    RLGL.Cache.depthMask = -1;
+    RLGL.Cache.cullFace = -1;
+    RLGL.Cache.scissorTest = -1;
+
+    for (int i = 0; i < 4; i++)
+    {
+        RLGL.Cache.viewport[i] = -1;
+        RLGL.Cache.scissor[i] = -1;
+    }
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Bind shader program, skipped if already bound
+static void rlCacheUseProgram(unsigned int id)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if (RLGL.Cache.programId == id) RLGL.Cache.elidedCalls++;
+    else
+    {
+        RLGL.Cache.programId = id;
+        glUseProgram(id);
+    }
+#else
+    glUseProgram(id);
+#endif
+}
+
+// Bind vertex array object, skipped if already bound
+static void rlCacheBindVertexArray(unsigned int id)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if (RLGL.Cache.vaoId == id) RLGL.Cache.elidedCalls++;
+    else
+    {
+        RLGL.Cache.vaoId = id;
+        glBindVertexArray(id);
+    }
+#else
+    glBindVertexArray(id);
+#endif
+}
+
+// Set active texture unit, skipped if already active
+static void rlCacheActiveTexture(unsigned int texture)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    int slot = (int)(texture - GL_TEXTURE0);
+
+    if (RLGL.Cache.activeTextureSlot == slot) RLGL.Cache.elidedCalls++;
+    else
+    {
+        RLGL.Cache.activeTextureSlot = slot;
+        glActiveTexture(texture);
+    }
+#else
+    glActiveTexture(texture);
+#endif
+}
+
+// Set blending factors, skipped if already set
+static void rlCacheBlendFunc(int srcFactor, int dstFactor)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if ((RLGL.Cache.blendSrcFactor == srcFactor) && (RLGL.Cache.blendDstFactor == dstFactor)) RLGL.Cache.elidedCalls++;
+    else
+    {
+        RLGL.Cache.blendSrcFactor = srcFactor;
+        RLGL.Cache.blendDstFactor = dstFactor;
+        glBlendFunc(srcFactor, dstFactor);
+    }
+#else
+    glBlendFunc(srcFactor, dstFactor);
+#endif
+}
+
+// Set blending equation, skipped if already set
+static void rlCacheBlendEquation(int equation)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if (RLGL.Cache.blendEquation == equation) RLGL.Cache.elidedCalls++;
+    else
+    {
+        RLGL.Cache.blendEquation = equation;
+        glBlendEquation(equation);
+    }
+#else
+    glBlendEquation(equation);
+#endif
+}
+#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+
+// Bind 2D texture to active texture unit, skipped if already bound
+// NOTE: Texture units over RL_MAX_STATE_CACHE_TEXTURE_UNITS are not tracked
+static void rlCacheBindTexture(unsigned int id)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    int slot = RLGL.Cache.activeTextureSlot;
+
+    if ((slot >= 0) && (slot < RL_MAX_STATE_CACHE_TEXTURE_UNITS) && (RLGL.Cache.textureId[slot] == id)) RLGL.Cache.elidedCalls++;
+    else
+    {
+        if ((slot >= 0) && (slot < RL_MAX_STATE_CACHE_TEXTURE_UNITS)) RLGL.Cache.textureId[slot] = id;
+        glBindTexture(GL_TEXTURE_2D, id);
+    }
+#else
+    glBindTexture(GL_TEXTURE_2D, id);
+#endif
+}
+
+// Enable/disable GL capability, skipped if already in requested state
+// NOTE: Only GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE and GL_SCISSOR_TEST are tracked
+static void rlCacheSetCapability(int capability, bool enabled)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    int *state = NULL;
+
+    switch (capability)
+    {
+        case GL_BLEND: state = &RLGL.Cache.colorBlend; break;
+        case GL_DEPTH_TEST: state = &RLGL.Cache.depthTest; break;
+        case GL_CULL_FACE: state = &RLGL.Cache.cullFace; break;
+        case GL_SCISSOR_TEST: state = &RLGL.Cache.scissorTest; break;
+        default: break;
+    }
+
+    if ((state != NULL) && (*state == (int)enabled)) RLGL.Cache.elidedCalls++;
+    else
+    {
+        if (state != NULL) *state = (int)enabled;
+        if (enabled) glEnable(capability);
+        else glDisable(capability);
+    }
+#else
+    if (enabled) glEnable(capability);
+    else glDisable(capability);
+#endif
+}
+
+// Clear a texture from cached bindings before deleting it
+// NOTE: GL unbinds deleted textures and their ids can be reused by new textures
+static void rlCacheForgetTexture(unsigned int id)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    for (int i = 0; i < RL_MAX_STATE_CACHE_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.Cache.textureId[i] == id) RLGL.Cache.textureId[i] = -1;
+    }
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+// Load software render batch arrays
+// NOTE: numElements is the number of quads that can be stored, same as default render batch
+static void rlLoadSoftwareBatch(int numElements)
+{
+    softwareBatch.elementCount = numElements*4;
+    softwareBatch.vertexCounter = 0;
+    softwareBatch.vertexStart = 0;
+    softwareBatch.mode = 0;
+    softwareBatch.modeVertexCount = 0;
+
+    softwareBatch.vertices = (float *)RL_MALLOC(softwareBatch.elementCount*3*sizeof(float));
+    softwareBatch.texcoords = (float *)RL_MALLOC(softwareBatch.elementCount*2*sizeof(float));
+    softwareBatch.colors = (unsigned char *)RL_MALLOC(softwareBatch.elementCount*4*sizeof(unsigned char));
+
+    softwareBatch.texcoordx = 0.0f;
+    softwareBatch.texcoordy = 0.0f;
+    softwareBatch.colorr = 255;
+    softwareBatch.colorg = 255;
+    softwareBatch.colorb = 255;
+    softwareBatch.colora = 255;
+
+    softwareBatch.textureId = 0;
+    softwareBatch.currentTextureId = RL_SOFTWARE_TEXTURE_UNKNOWN;
+
+    TRACELOG(RL_LOG_INFO, "RLSW: Software render batch loaded successfully (%i vertex)", softwareBatch.elementCount);
+}
+
+// Unload software render batch arrays
+static void rlUnloadSoftwareBatch(void)
+{
+    RL_FREE(softwareBatch.vertices);
+    RL_FREE(softwareBatch.texcoords);
+    RL_FREE(softwareBatch.colors);
+
+    softwareBatch = (rlSoftwareBatch){ 0 };
+}
+
+// Draw accumulated vertex data with one swDrawArrays() call and apply requested texture
+// NOTE: Called before any rlsw state change, vertex are drawn with the state they were provided with
+static void rlDrawSoftwareBatch(void)
+{
+    if (softwareBatch.vertexCounter > 0)
+    {
+        // Vertex colors are multiplied by rlsw current color
+        swColor4ub(255, 255, 255, 255);
+
+        swBindArray(SW_VERTEX_ARRAY, softwareBatch.vertices);
+        swBindArray(SW_TEXTURE_COORD_ARRAY, softwareBatch.texcoords);
+        swBindArray(SW_COLOR_ARRAY, softwareBatch.colors);
+
+        swDrawArrays((SWdraw)softwareBatch.mode, 0, softwareBatch.vertexCounter);
+
+        // Arrays are unbound, vertex state pointers are disabled by default
+        swBindArray(SW_VERTEX_ARRAY, NULL);
+        swBindArray(SW_TEXTURE_COORD_ARRAY, NULL);
+        swBindArray(SW_COLOR_ARRAY, NULL);
+
+        softwareBatch.vertexCounter = 0;
+    }
+
+    softwareBatch.vertexStart = 0;
+
+    // Apply texture requested by rlEnableTexture()/rlDisableTexture()
+    if (softwareBatch.textureId != softwareBatch.currentTextureId)
+    {
+        if (softwareBatch.textureId == 0) swDisable(SW_TEXTURE_2D);
+        else
+        {
+            swEnable(SW_TEXTURE_2D);
+            swBindTexture(softwareBatch.textureId);
+        }
+
+        softwareBatch.currentTextureId = softwareBatch.textureId;
+    }
+
+    // Current color is used by vertex arrays drawing (rlDrawVertexArray())
+    swColor4ub(softwareBatch.colorr, softwareBatch.colorg, softwareBatch.colorb, softwareBatch.colora);
+}
+
+// Bind texture on rlsw (glBindTexture), drawing batch first
+// NOTE: Used to load and configure textures, texture requested for drawing must be applied again
+static void rlBindSoftwareTexture(unsigned int id)
+{
+    rlDrawSoftwareBatch();
+    swBindTexture(id);
+
+    softwareBatch.currentTextureId = RL_SOFTWARE_TEXTURE_UNKNOWN;
+}
+#endif
+
+#if defined(RLGL_ENABLE_COMMAND_BUFFERS)
+// Record command into current thread command buffer
+// NOTE: Command is stored as header (type, parameters size) followed by parameters data
+static void rlRecordCommand(int type, const void *data, int size)
+{
+    rlCommandBuffer *buffer = rlRecordingBuffer;
+    int header[2] = { type, size };
+    int requiredSize = buffer->size + (int)sizeof(header) + size;
+
+    if (requiredSize > buffer->capacity)
+    {
+        int capacity = (buffer->capacity > 0)? buffer->capacity*2 : 4096;
+        while (capacity < requiredSize) capacity *= 2;
+
+        unsigned char *newData = (unsigned char *)RL_REALLOC(buffer->data, capacity);
+
+        if (newData == NULL)
+        {
+            TRACELOG(RL_LOG_WARNING, "RLGL: Failed to grow command buffer, command not recorded");
+            return;
+        }
+
+        buffer->data = newData;
+        buffer->capacity = capacity;
+    }
+
+    memcpy(buffer->data + buffer->size, header, sizeof(header));
+    if (size > 0) memcpy(buffer->data + buffer->size + sizeof(header), data, size);
+    buffer->size = requiredSize;
+    buffer->commandCount++;
+}
+#endif
+
 // Auxiliar math functions
 //-------------------------------------------------------------------------------
 // Get identity matrix
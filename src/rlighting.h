@@ -0,0 +1,547 @@
+/**********************************************************************************************
+*
+*   rlighting - Clustered forward lighting, light binning on GPU using compute shaders
+*
+*   DESCRIPTION:
+*       Lights are stored in a shader storage buffer and binned every frame into a screen-space
+*       cluster grid (tiles x depth slices) by a compute shader. Material shaders read the cluster
+*       buffers to shade only the lights affecting the fragment, so thousands of point/spot lights
+*       can be used without any per-light draw cost
+*
+*   CONFIGURATION:
+*       #define RLIGHTING_IMPLEMENTATION
+*           Generates the implementation of the library into the included file.
+*           If not defined, the library is in header only mode and can be included in other headers
+*           or source files without problems. But only ONE file should hold the implementation.
+*
+*   DEPENDENCIES:
+*       raylib.h    - rl_Camera, rl_Shader and shader uniforms setting
+*       rlgl.h      - Compute shaders and shader storage buffers (requires GRAPHICS_API_OPENGL_43)
+*       raymath.h   - Camera matrices computation
+*
+*   USAGE:
+*       rl_InitLighting(0);                         // Init lighting system with default capacity
+*       rl_AddLight((rl_ClusterLight){ ... });      // Add lights, can be updated with rl_UpdateLight()
+*
+*       // Material fragment shader must include the code returned by rl_GetLightingShaderCode()
+*       // after the #version 430 line and call GetClusteredLighting() to compute light contribution
+*
+*       rl_UpdateLighting(camera, rl_GetRenderWidth(), rl_GetRenderHeight());   // Bin lights, once per frame
+*       rl_SetShaderLighting(shader);               // Bind cluster buffers to material shader
+*       rl_BeginMode3D(camera); ... rl_EndMode3D();
+*
+*   NOTE: Cluster buffers are bound to fixed RLIGHTING_BINDING_* indices and must not be overridden
+*   by other shader storage buffers until the draw calls using them have been flushed
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RLIGHTING_H
+#define RLIGHTING_H
+
+// Function specifiers in case library is build/used as a shared library (Windows)
+// NOTE: Microsoft specifiers to tell compiler that symbols are imported/exported from a .dll
+#if defined(_WIN32)
+    #if defined(BUILD_LIBTYPE_SHARED)
+        #define rl_RLAPI __declspec(dllexport)     // We are building raylib as a Win32 shared library (.dll)
+    #elif defined(USE_LIBTYPE_SHARED)
+        #define rl_RLAPI __declspec(dllimport)     // We are using raylib as a Win32 shared library (.dll)
+    #endif
+#endif
+
+// Function specifiers definition
+#ifndef rl_RLAPI
+    #define rl_RLAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef RLIGHTING_MAX_LIGHTS
+    #define RLIGHTING_MAX_LIGHTS                4096    // Default maximum number of lights
+#endif
+#ifndef RLIGHTING_CLUSTER_X
+    #define RLIGHTING_CLUSTER_X                   16    // Cluster grid horizontal tiles
+#endif
+#ifndef RLIGHTING_CLUSTER_Y
+    #define RLIGHTING_CLUSTER_Y                    9    // Cluster grid vertical tiles
+#endif
+#ifndef RLIGHTING_CLUSTER_Z
+    #define RLIGHTING_CLUSTER_Z                   24    // Cluster grid depth slices (exponential)
+#endif
+#ifndef RLIGHTING_MAX_LIGHTS_PER_CLUSTER
+    #define RLIGHTING_MAX_LIGHTS_PER_CLUSTER     128    // Maximum lights stored per cluster, exceeding lights are dropped
+#endif
+
+// Shader storage buffer binding indices used by the lighting system
+#ifndef RLIGHTING_BINDING_LIGHTS
+    #define RLIGHTING_BINDING_LIGHTS               4
+#endif
+#ifndef RLIGHTING_BINDING_CLUSTER_COUNTS
+    #define RLIGHTING_BINDING_CLUSTER_COUNTS       5
+#endif
+#ifndef RLIGHTING_BINDING_CLUSTER_INDICES
+    #define RLIGHTING_BINDING_CLUSTER_INDICES      6
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Cluster light type
+typedef enum {
+    CLUSTER_LIGHT_POINT = 0,            // Omnidirectional light
+    CLUSTER_LIGHT_SPOT                  // Cone light, uses direction and angles
+} rl_ClusterLightType;
+
+// Cluster light data
+typedef struct rl_ClusterLight {
+    int type;                   // Light type (rl_ClusterLightType)
+    rl_Vector3 position;        // Light position (world space)
+    rl_Vector3 direction;       // Light direction (spot lights)
+    rl_Color color;             // Light color
+    float intensity;            // Light intensity multiplier
+    float range;                // Light influence radius, no contribution beyond it
+    float innerAngle;           // Spot light full intensity cone half-angle (degrees)
+    float outerAngle;           // Spot light cutoff cone half-angle (degrees)
+} rl_ClusterLight;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+rl_RLAPI bool rl_InitLighting(int maxLights);                           // Init lighting system, maxLights = 0 uses RLIGHTING_MAX_LIGHTS
+rl_RLAPI void rl_CloseLighting(void);                                   // Close lighting system, unload buffers and compute program
+rl_RLAPI bool rl_IsLightingReady(void);                                 // Check if lighting system is initialized
+rl_RLAPI int rl_AddLight(rl_ClusterLight light);                        // Add light, returns light index or -1 if full
+rl_RLAPI void rl_UpdateLight(int index, rl_ClusterLight light);         // Update light data
+rl_RLAPI void rl_ClearLights(void);                                     // Remove all lights
+rl_RLAPI int rl_GetLightCount(void);                                    // Get current number of lights
+rl_RLAPI void rl_UpdateLighting(rl_Camera camera, int width, int height); // Bin lights into clusters for camera view, call once per frame
+rl_RLAPI void rl_SetShaderLighting(rl_Shader shader);                   // Bind cluster buffers and set cluster uniforms for material shader
+rl_RLAPI const char *rl_GetLightingShaderCode(void);                    // Get GLSL code to be included in material fragment shaders
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RLIGHTING_H
+
+/***********************************************************************************
+*
+*   RLIGHTING IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RLIGHTING_IMPLEMENTATION)
+
+#include "rlgl.h"
+#include "raymath.h"
+
+#include <stdlib.h>         // Required for: RL_CALLOC(), RL_FREE()
+#include <math.h>           // Required for: cosf(), logf()
+
+#ifndef RL_CALLOC
+    #define RL_CALLOC(n,sz)     calloc(n,sz)
+#endif
+#ifndef RL_FREE
+    #define RL_FREE(p)          free(p)
+#endif
+#ifndef TRACELOG
+    #define TRACELOG(level, ...) rl_TraceLog(level, __VA_ARGS__)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RLIGHTING_CLUSTER_COUNT     (RLIGHTING_CLUSTER_X*RLIGHTING_CLUSTER_Y*RLIGHTING_CLUSTER_Z)
+#define RLIGHTING_WORKGROUP_SIZE    128         // Compute shader local size, clusters per workgroup
+
+#define RLIGHTING_STR(x)            #x
+#define RLIGHTING_XSTR(x)           RLIGHTING_STR(x)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Light data as stored in shader storage buffer (std430 layout, 4 x vec4)
+typedef struct LightGPU {
+    float position[4];          // xyz: world position, w: range
+    float direction[4];         // xyz: direction, w: cosine of outer angle
+    float color[4];             // rgb: color, a: intensity
+    float params[4];            // x: type, y: cosine of inner angle
+} LightGPU;
+
+// Lighting system state
+typedef struct {
+    bool ready;                 // Lighting system initialized
+    bool dirty;                 // Lights data requires upload
+    int maxLights;              // Lights buffer capacity
+    int lightCount;             // Lights currently in use
+    LightGPU *lights;           // Lights data (CPU copy)
+
+    unsigned int lightsBuffer;          // Lights SSBO
+    unsigned int clusterCountsBuffer;   // Lights count per cluster SSBO
+    unsigned int clusterIndicesBuffer;  // Light indices per cluster SSBO
+    unsigned int cullProgram;           // Light binning compute program
+
+    int locView;                // Compute uniform location: view matrix
+    int locInvProjection;       // Compute uniform location: inverse projection matrix
+    int locDepthRange;          // Compute uniform location: near/far planes
+    int locLightCount;          // Compute uniform location: light count
+
+    float screenSize[2];        // Screen size used on last update
+    float depthRange[2];        // Near/far planes used on last update
+} LightingData;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static LightingData LIGHTING = { 0 };
+
+// Light binning compute shader
+// NOTE: One invocation per cluster, lights are transformed to view space in batches
+// through shared memory and tested against cluster view space AABB
+static const char *lightingCullShaderCode =
+"#version 430\n"
+"#define CLUSTER_X " RLIGHTING_XSTR(RLIGHTING_CLUSTER_X) "\n"
+"#define CLUSTER_Y " RLIGHTING_XSTR(RLIGHTING_CLUSTER_Y) "\n"
+"#define CLUSTER_Z " RLIGHTING_XSTR(RLIGHTING_CLUSTER_Z) "\n"
+"#define MAX_LIGHTS_PER_CLUSTER " RLIGHTING_XSTR(RLIGHTING_MAX_LIGHTS_PER_CLUSTER) "\n"
+"#define WORKGROUP_SIZE " RLIGHTING_XSTR(RLIGHTING_WORKGROUP_SIZE) "\n"
+"layout(local_size_x = WORKGROUP_SIZE) in;\n"
+"struct ClusterLight { vec4 position; vec4 direction; vec4 color; vec4 params; };\n"
+"layout(std430, binding = " RLIGHTING_XSTR(RLIGHTING_BINDING_LIGHTS) ") readonly buffer LightsBuffer { ClusterLight lights[]; };\n"
+"layout(std430, binding = " RLIGHTING_XSTR(RLIGHTING_BINDING_CLUSTER_COUNTS) ") writeonly buffer ClusterCountsBuffer { uint clusterCounts[]; };\n"
+"layout(std430, binding = " RLIGHTING_XSTR(RLIGHTING_BINDING_CLUSTER_INDICES) ") writeonly buffer ClusterIndicesBuffer { uint clusterIndices[]; };\n"
+"uniform mat4 view;\n"
+"uniform mat4 invProjection;\n"
+"uniform vec2 depthRange;\n"
+"uniform int lightCount;\n"
+"shared vec4 sharedLights[WORKGROUP_SIZE];\n"
+"vec3 UnprojectNear(vec2 ndc) { vec4 p = invProjection*vec4(ndc, -1.0, 1.0); return p.xyz/p.w; }\n"
+"vec3 LineToDepth(vec3 p, float depth) { return p*(depth/-p.z); }\n"
+"void main()\n"
+"{\n"
+"    uint clusterIndex = gl_GlobalInvocationID.x;\n"
+"    bool active = (clusterIndex < uint(CLUSTER_X*CLUSTER_Y*CLUSTER_Z));\n"
+"    uint x = clusterIndex%uint(CLUSTER_X);\n"
+"    uint y = (clusterIndex/uint(CLUSTER_X))%uint(CLUSTER_Y);\n"
+"    uint z = clusterIndex/uint(CLUSTER_X*CLUSTER_Y);\n"
+"    vec2 tileMin = vec2(x, y)/vec2(CLUSTER_X, CLUSTER_Y)*2.0 - 1.0;\n"
+"    vec2 tileMax = vec2(x + 1u, y + 1u)/vec2(CLUSTER_X, CLUSTER_Y)*2.0 - 1.0;\n"
+"    float sliceNear = depthRange.x*pow(depthRange.y/depthRange.x, float(z)/float(CLUSTER_Z));\n"
+"    float sliceFar = depthRange.x*pow(depthRange.y/depthRange.x, float(z + 1u)/float(CLUSTER_Z));\n"
+"    vec3 pMin = UnprojectNear(tileMin);\n"
+"    vec3 pMax = UnprojectNear(tileMax);\n"
+"    vec3 a = LineToDepth(pMin, sliceNear);\n"
+"    vec3 b = LineToDepth(pMin, sliceFar);\n"
+"    vec3 c = LineToDepth(pMax, sliceNear);\n"
+"    vec3 d = LineToDepth(pMax, sliceFar);\n"
+"    vec3 aabbMin = min(min(a, b), min(c, d));\n"
+"    vec3 aabbMax = max(max(a, b), max(c, d));\n"
+"    uint count = 0u;\n"
+"    for (int batch = 0; batch < lightCount; batch += WORKGROUP_SIZE)\n"
+"    {\n"
+"        int lightIndex = batch + int(gl_LocalInvocationID.x);\n"
+"        if (lightIndex < lightCount) sharedLights[gl_LocalInvocationID.x] = vec4((view*vec4(lights[lightIndex].position.xyz, 1.0)).xyz, lights[lightIndex].position.w);\n"
+"        barrier();\n"
+"        int batchCount = min(WORKGROUP_SIZE, lightCount - batch);\n"
+"        for (int i = 0; active && (i < batchCount); i++)\n"
+"        {\n"
+"            vec4 light = sharedLights[i];\n"
+"            vec3 closest = clamp(light.xyz, aabbMin, aabbMax) - light.xyz;\n"
+"            if ((dot(closest, closest) <= light.w*light.w) && (count < uint(MAX_LIGHTS_PER_CLUSTER)))\n"
+"            {\n"
+"                clusterIndices[clusterIndex*uint(MAX_LIGHTS_PER_CLUSTER) + count] = uint(batch + i);\n"
+"                count++;\n"
+"            }\n"
+"        }\n"
+"        barrier();\n"
+"    }\n"
+"    if (active) clusterCounts[clusterIndex] = count;\n"
+"}\n";
+
+// Material fragment shader lighting code
+// NOTE: Cluster is computed from fragment screen position and linearized depth,
+// light contribution uses Blinn-Phong with smooth range attenuation
+static const char *lightingFragmentShaderCode =
+"#define CLUSTER_X " RLIGHTING_XSTR(RLIGHTING_CLUSTER_X) "\n"
+"#define CLUSTER_Y " RLIGHTING_XSTR(RLIGHTING_CLUSTER_Y) "\n"
+"#define CLUSTER_Z " RLIGHTING_XSTR(RLIGHTING_CLUSTER_Z) "\n"
+"#define MAX_LIGHTS_PER_CLUSTER " RLIGHTING_XSTR(RLIGHTING_MAX_LIGHTS_PER_CLUSTER) "\n"
+"struct ClusterLight { vec4 position; vec4 direction; vec4 color; vec4 params; };\n"
+"layout(std430, binding = " RLIGHTING_XSTR(RLIGHTING_BINDING_LIGHTS) ") readonly buffer LightsBuffer { ClusterLight lights[]; };\n"
+"layout(std430, binding = " RLIGHTING_XSTR(RLIGHTING_BINDING_CLUSTER_COUNTS) ") readonly buffer ClusterCountsBuffer { uint clusterCounts[]; };\n"
+"layout(std430, binding = " RLIGHTING_XSTR(RLIGHTING_BINDING_CLUSTER_INDICES) ") readonly buffer ClusterIndicesBuffer { uint clusterIndices[]; };\n"
+"uniform vec2 clusterScreenSize;\n"
+"uniform vec2 clusterDepthRange;\n"
+"vec3 GetClusteredLighting(vec3 fragPosition, vec3 normal, vec3 viewPos, float shininess)\n"
+"{\n"
+"    float ndcDepth = gl_FragCoord.z*2.0 - 1.0;\n"
+"    float near = clusterDepthRange.x;\n"
+"    float far = clusterDepthRange.y;\n"
+"    float linearDepth = 2.0*near*far/(far + near - ndcDepth*(far - near));\n"
+"    uvec2 tile = uvec2(clamp(gl_FragCoord.xy/clusterScreenSize, 0.0, 0.999)*vec2(CLUSTER_X, CLUSTER_Y));\n"
+"    uint slice = uint(clamp(log(linearDepth/near)/log(far/near), 0.0, 0.999)*float(CLUSTER_Z));\n"
+"    uint cluster = tile.x + tile.y*uint(CLUSTER_X) + slice*uint(CLUSTER_X*CLUSTER_Y);\n"
+"    uint count = clusterCounts[cluster];\n"
+"    vec3 n = normalize(normal);\n"
+"    vec3 v = normalize(viewPos - fragPosition);\n"
+"    vec3 result = vec3(0.0);\n"
+"    for (uint i = 0u; i < count; i++)\n"
+"    {\n"
+"        ClusterLight light = lights[clusterIndices[cluster*uint(MAX_LIGHTS_PER_CLUSTER) + i]];\n"
+"        vec3 toLight = light.position.xyz - fragPosition;\n"
+"        float dist = length(toLight);\n"
+"        vec3 l = toLight/max(dist, 0.0001);\n"
+"        float att = clamp(1.0 - dist/light.position.w, 0.0, 1.0);\n"
+"        att *= att;\n"
+"        if (light.params.x > 0.5) att *= smoothstep(light.direction.w, light.params.y, dot(-l, normalize(light.direction.xyz)));\n"
+"        float diffuse = max(dot(n, l), 0.0);\n"
+"        float specular = (diffuse > 0.0)? pow(max(dot(n, normalize(l + v)), 0.0), shininess) : 0.0;\n"
+"        result += light.color.rgb*light.color.a*att*(diffuse + specular);\n"
+"    }\n"
+"    return result;\n"
+"}\n";
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static LightGPU PackClusterLight(rl_ClusterLight light);    // Convert light to shader storage layout
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Init lighting system
+// NOTE: Requires compute shaders and shader storage buffers (OpenGL 4.3)
+bool rl_InitLighting(int maxLights)
+{
+    if (LIGHTING.ready) return true;
+
+    if (rlGetVersion() != RL_OPENGL_43)
+    {
+        TRACELOG(LOG_WARNING, "LIGHTING: Clustered lighting requires OpenGL 4.3 (compute shaders and SSBOs)");
+        return false;
+    }
+
+    if (maxLights <= 0) maxLights = RLIGHTING_MAX_LIGHTS;
+
+    unsigned int shaderId = rlCompileShader(lightingCullShaderCode, RL_COMPUTE_SHADER);
+    if (shaderId == 0) return false;
+
+    LIGHTING.cullProgram = rlLoadComputeShaderProgram(shaderId);
+    if (LIGHTING.cullProgram == 0)
+    {
+        TRACELOG(LOG_WARNING, "LIGHTING: Failed to load light binning compute program");
+        return false;
+    }
+
+    LIGHTING.locView = rlGetLocationUniform(LIGHTING.cullProgram, "view");
+    LIGHTING.locInvProjection = rlGetLocationUniform(LIGHTING.cullProgram, "invProjection");
+    LIGHTING.locDepthRange = rlGetLocationUniform(LIGHTING.cullProgram, "depthRange");
+    LIGHTING.locLightCount = rlGetLocationUniform(LIGHTING.cullProgram, "lightCount");
+
+    LIGHTING.lights = (LightGPU *)RL_CALLOC(maxLights, sizeof(LightGPU));
+    LIGHTING.lightsBuffer = rlLoadShaderBuffer(maxLights*sizeof(LightGPU), NULL, RL_DYNAMIC_DRAW);
+    LIGHTING.clusterCountsBuffer = rlLoadShaderBuffer(RLIGHTING_CLUSTER_COUNT*sizeof(unsigned int), NULL, RL_DYNAMIC_COPY);
+    LIGHTING.clusterIndicesBuffer = rlLoadShaderBuffer(RLIGHTING_CLUSTER_COUNT*RLIGHTING_MAX_LIGHTS_PER_CLUSTER*sizeof(unsigned int), NULL, RL_DYNAMIC_COPY);
+
+    if ((LIGHTING.lightsBuffer == 0) || (LIGHTING.clusterCountsBuffer == 0) || (LIGHTING.clusterIndicesBuffer == 0))
+    {
+        TRACELOG(LOG_WARNING, "LIGHTING: Failed to load cluster buffers");
+        LIGHTING.ready = true;
+        rl_CloseLighting();
+        return false;
+    }
+
+    LIGHTING.maxLights = maxLights;
+    LIGHTING.lightCount = 0;
+    LIGHTING.dirty = false;
+    LIGHTING.ready = true;
+
+    TRACELOG(LOG_INFO, "LIGHTING: Clustered lighting initialized (%ix%ix%i clusters | %i lights max)",
+        RLIGHTING_CLUSTER_X, RLIGHTING_CLUSTER_Y, RLIGHTING_CLUSTER_Z, maxLights);
+
+    return true;
+}
+
+// Close lighting system
+void rl_CloseLighting(void)
+{
+    if (!LIGHTING.ready) return;
+
+    if (LIGHTING.lightsBuffer != 0) rlUnloadShaderBuffer(LIGHTING.lightsBuffer);
+    if (LIGHTING.clusterCountsBuffer != 0) rlUnloadShaderBuffer(LIGHTING.clusterCountsBuffer);
+    if (LIGHTING.clusterIndicesBuffer != 0) rlUnloadShaderBuffer(LIGHTING.clusterIndicesBuffer);
+    if (LIGHTING.cullProgram != 0) rlUnloadShaderProgram(LIGHTING.cullProgram);
+
+    RL_FREE(LIGHTING.lights);
+
+    LightingData empty = { 0 };
+    LIGHTING = empty;
+}
+
+// Check if lighting system is initialized
+bool rl_IsLightingReady(void)
+{
+    return LIGHTING.ready;
+}
+
+// Add light, returns light index or -1 if lights buffer is full
+int rl_AddLight(rl_ClusterLight light)
+{
+    if (!LIGHTING.ready) return -1;
+
+    if (LIGHTING.lightCount >= LIGHTING.maxLights)
+    {
+        TRACELOG(LOG_WARNING, "LIGHTING: Maximum number of lights reached (%i)", LIGHTING.maxLights);
+        return -1;
+    }
+
+    int index = LIGHTING.lightCount;
+    LIGHTING.lights[index] = PackClusterLight(light);
+    LIGHTING.lightCount++;
+    LIGHTING.dirty = true;
+
+    return index;
+}
+
+// Update light data
+void rl_UpdateLight(int index, rl_ClusterLight light)
+{
+    if (!LIGHTING.ready || (index < 0) || (index >= LIGHTING.lightCount)) return;
+
+    LIGHTING.lights[index] = PackClusterLight(light);
+    LIGHTING.dirty = true;
+}
+
+// Remove all lights
+void rl_ClearLights(void)
+{
+    LIGHTING.lightCount = 0;
+    LIGHTING.dirty = true;
+}
+
+// Get current number of lights
+int rl_GetLightCount(void)
+{
+    return LIGHTING.lightCount;
+}
+
+// Bin lights into clusters for camera view
+// NOTE: Only perspective cameras are supported, cluster depth slices are exponential between
+// RL_CULL_DISTANCE_NEAR and RL_CULL_DISTANCE_FAR, matching rl_BeginMode3D() projection
+void rl_UpdateLighting(rl_Camera camera, int width, int height)
+{
+    if (!LIGHTING.ready || (width <= 0) || (height <= 0)) return;
+
+    if (LIGHTING.dirty && (LIGHTING.lightCount > 0))
+    {
+        rlUpdateShaderBuffer(LIGHTING.lightsBuffer, LIGHTING.lights, LIGHTING.lightCount*sizeof(LightGPU), 0);
+    }
+    LIGHTING.dirty = false;
+
+    float nearPlane = (float)rlGetCullDistanceNear();
+    float farPlane = (float)rlGetCullDistanceFar();
+    float aspect = (float)width/(float)height;
+
+    rl_Matrix view = rl_GetCameraMatrix(camera);
+    rl_Matrix projection = MatrixPerspective(camera.fovy*rl_DEG2RAD, aspect, nearPlane, farPlane);
+    rl_Matrix invProjection = MatrixInvert(projection);
+    float depthRange[2] = { nearPlane, farPlane };
+
+    LIGHTING.screenSize[0] = (float)width;
+    LIGHTING.screenSize[1] = (float)height;
+    LIGHTING.depthRange[0] = nearPlane;
+    LIGHTING.depthRange[1] = farPlane;
+
+    rlEnableShader(LIGHTING.cullProgram);
+    rlSetUniformMatrix(LIGHTING.locView, view);
+    rlSetUniformMatrix(LIGHTING.locInvProjection, invProjection);
+    rlSetUniform(LIGHTING.locDepthRange, depthRange, RL_SHADER_UNIFORM_VEC2, 1);
+    rlSetUniform(LIGHTING.locLightCount, &LIGHTING.lightCount, RL_SHADER_UNIFORM_INT, 1);
+
+    rlBindShaderBuffer(LIGHTING.lightsBuffer, RLIGHTING_BINDING_LIGHTS);
+    rlBindShaderBuffer(LIGHTING.clusterCountsBuffer, RLIGHTING_BINDING_CLUSTER_COUNTS);
+    rlBindShaderBuffer(LIGHTING.clusterIndicesBuffer, RLIGHTING_BINDING_CLUSTER_INDICES);
+
+    rlComputeShaderDispatch((RLIGHTING_CLUSTER_COUNT + RLIGHTING_WORKGROUP_SIZE - 1)/RLIGHTING_WORKGROUP_SIZE, 1, 1);
+    rlComputeShaderBarrier();
+    rlDisableShader();
+}
+
+// Bind cluster buffers and set cluster uniforms for material shader
+// NOTE: Shader must include rl_GetLightingShaderCode(), uniforms not found are skipped
+void rl_SetShaderLighting(rl_Shader shader)
+{
+    if (!LIGHTING.ready) return;
+
+    int locScreenSize = rl_GetShaderLocation(shader, "clusterScreenSize");
+    int locDepthRange = rl_GetShaderLocation(shader, "clusterDepthRange");
+
+    if (locScreenSize != -1) rl_SetShaderValue(shader, locScreenSize, LIGHTING.screenSize, SHADER_UNIFORM_VEC2);
+    if (locDepthRange != -1) rl_SetShaderValue(shader, locDepthRange, LIGHTING.depthRange, SHADER_UNIFORM_VEC2);
+
+    rlBindShaderBuffer(LIGHTING.lightsBuffer, RLIGHTING_BINDING_LIGHTS);
+    rlBindShaderBuffer(LIGHTING.clusterCountsBuffer, RLIGHTING_BINDING_CLUSTER_COUNTS);
+    rlBindShaderBuffer(LIGHTING.clusterIndicesBuffer, RLIGHTING_BINDING_CLUSTER_INDICES);
+}
+
+// Get GLSL code to be included in material fragment shaders
+// NOTE: Provides GetClusteredLighting(fragPosition, normal, viewPos, shininess), requires #version 430
+const char *rl_GetLightingShaderCode(void)
+{
+    return lightingFragmentShaderCode;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Convert light to shader storage layout
+static LightGPU PackClusterLight(rl_ClusterLight light)
+{
+    LightGPU result = { 0 };
+
+    result.position[0] = light.position.x;
+    result.position[1] = light.position.y;
+    result.position[2] = light.position.z;
+    result.position[3] = light.range;
+
+    result.direction[0] = light.direction.x;
+    result.direction[1] = light.direction.y;
+    result.direction[2] = light.direction.z;
+    result.direction[3] = cosf(light.outerAngle*rl_DEG2RAD);
+
+    result.color[0] = (float)light.color.r/255.0f;
+    result.color[1] = (float)light.color.g/255.0f;
+    result.color[2] = (float)light.color.b/255.0f;
+    result.color[3] = light.intensity;
+
+    result.params[0] = (float)light.type;
+    result.params[1] = cosf(light.innerAngle*rl_DEG2RAD);
+
+    return result;
+}
+
+#endif // RLIGHTING_IMPLEMENTATION
@@ -49,6 +49,7 @@
 
 #if defined(SUPPORT_MODULE_RMODELS)
 
+#define RL_MEMORY_MODULE MEMORY_MODULE_MODELS    // Memory tracking allocations module
 #include "utils.h"          // Required for: TRACELOG(), rl_LoadFileData(), rl_LoadFileText(), rl_SaveFileText()
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
 #include "raymath.h"        // Required for: rl_Vector3, rl_Quaternion and rl_Matrix functionality
@@ -57,6 +58,8 @@
 #include <stdlib.h>         // Required for: malloc(), calloc(), free()
 #include <string.h>         // Required for: memcmp(), strlen(), strncpy()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <float.h>          // Required for: FLT_MAX
+#include <limits.h>         // Required for: INT_MAX
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -115,12 +118,22 @@
     #endif
 #endif
 
-#if defined(_WIN32)
-    #include <direct.h>     // Required for: _chdir() [Used in LoadOBJ()]
-    #define CHDIR _chdir
-#else
-    #include <unistd.h>     // Required for: chdir() (POSIX) [Used in LoadOBJ()]
-    #define CHDIR chdir
+// Models worker threads (ray batches, CPU skinning) are only supported with POSIX threads
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+    #if defined(PLATFORM_WEB) || (defined(_WIN32) && !defined(__MINGW32__))
+        #undef SUPPORT_MODELS_WORKER_THREADS
+    #endif
+#endif
+#if defined(SUPPORT_FILEFORMAT_RMDL) && (defined(__unix__) || defined(__APPLE__))
+    #include <sys/mman.h>   // Required for: mmap(), munmap() [Used in LoadFileDataMapped()]
+    #include <sys/stat.h>   // Required for: fstat() [Used in LoadFileDataMapped()]
+    #include <fcntl.h>      // Required for: open() [Used in LoadFileDataMapped()]
+    #include <unistd.h>     // Required for: close() [Used in LoadFileDataMapped()]
+    #define SUPPORT_FILE_MAPPING
+#endif
+
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+    #include <pthread.h>    // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*()
 #endif
 
 //----------------------------------------------------------------------------------
@@ -132,25 +145,859 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  9      // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef MAX_SHADOW_MAP_CASCADES
+    #define MAX_SHADOW_MAP_CASCADES  4      // Maximum shadow map cascades (shader shadowMatrices array size)
+#endif
+#ifndef MAX_DRAWLIST_TRACKED_CHANGES
+    #define MAX_DRAWLIST_TRACKED_CHANGES  128   // Draw list changes kept to find out cached shadow map cascades still valid
+#endif
+#ifndef SHADOW_MAP_SPLIT_LAMBDA
+    #define SHADOW_MAP_SPLIT_LAMBDA  0.75f  // Shadow map cascades splits blend between uniform (0.0) and logarithmic (1.0) distribution
+#endif
 #ifndef MAX_FILEPATH_LENGTH
     #define MAX_FILEPATH_LENGTH   4096      // Maximum length for filepaths (Linux PATH_MAX default value)
 #endif
+#ifndef OCCLUSION_DEPTH_TILE_SIZE
+    #define OCCLUSION_DEPTH_TILE_SIZE  8    // Occlusion depth pyramid base level tile size (pixels)
+#endif
+#ifndef OCCLUSION_DEPTH_MAX_LEVELS
+    #define OCCLUSION_DEPTH_MAX_LEVELS 16   // Occlusion depth pyramid maximum number of levels
+#endif
+#ifndef MESH_BVH_SAH_BINS
+    #define MESH_BVH_SAH_BINS         12    // Mesh BVH number of bins for surface area heuristic evaluation
+#endif
+#ifndef MESH_BVH_MAX_LEAF_TRIANGLES
+    #define MESH_BVH_MAX_LEAF_TRIANGLES 4   // Mesh BVH maximum triangles per leaf node (larger leaves split even if not cheaper)
+#endif
+#ifndef MESH_BVH_MAX_DEPTH
+    #define MESH_BVH_MAX_DEPTH        64    // Mesh BVH maximum tree depth (also traversal stack size)
+#endif
+#ifndef MESH_OPTIMIZE_CACHE_SIZE
+    #define MESH_OPTIMIZE_CACHE_SIZE  32    // Mesh optimization simulated LRU vertex cache size
+#endif
+#ifndef MESH_VERTEX_CACHE_SIZE
+    #define MESH_VERTEX_CACHE_SIZE    16    // Mesh ACMR simulated FIFO vertex cache size
+#endif
+#ifndef MESH_OPTIMIZE_OVERDRAW_THRESHOLD
+    #define MESH_OPTIMIZE_OVERDRAW_THRESHOLD  1.05f // Mesh overdraw optimization maximum ACMR increase
+#endif
+#ifndef MAX_MESH_LOD_LEVELS
+    #define MAX_MESH_LOD_LEVELS        8    // Maximum mesh levels of detail (full detail level not included)
+#endif
+#ifndef MAX_MESH_STREAM_BUFFERS
+    #define MAX_MESH_STREAM_BUFFERS    3    // Maximum vertex buffers per attribute on streamed meshes
+#endif
+#ifndef MESH_LOD_PIXEL_ERROR
+    #define MESH_LOD_PIXEL_ERROR    1.0f    // Mesh LOD selection maximum projected simplification error (pixels)
+#endif
+#ifndef MESH_LOD_HYSTERESIS
+    #define MESH_LOD_HYSTERESIS    0.25f    // Mesh LOD selection hysteresis, coarser level requires error below threshold by this factor
+#endif
+#ifndef MESH_LOD_MAX_ERROR
+    #define MESH_LOD_MAX_ERROR     0.05f    // Mesh LOD generation maximum simplification error (relative to mesh bounding sphere radius)
+#endif
+#ifndef MESH_LOD_MIN_REDUCTION
+    #define MESH_LOD_MIN_REDUCTION 0.95f    // Mesh LOD generation stops when a level keeps more indices than this factor
+#endif
+#ifndef MESH_QUANTIZE_POSITION_ERROR
+    #define MESH_QUANTIZE_POSITION_ERROR  0.001f    // Mesh half float positions maximum error (relative to mesh size)
+#endif
+#ifndef MAX_STATIC_BATCH_MESH_VERTICES
+    #define MAX_STATIC_BATCH_MESH_VERTICES  65536   // Static batch merged mesh maximum vertices (16 bit indices)
+#endif
+#ifndef TERRAIN_CHUNK_QUADS
+    #define TERRAIN_CHUNK_QUADS               64    // Terrain chunk grid quads per side (power of two, up to 128)
+#endif
+#ifndef TERRAIN_STREAM_LOADS_PER_UPDATE
+    #define TERRAIN_STREAM_LOADS_PER_UPDATE    2    // Terrain height tiles loaded per rl_UpdateTerrain() call
+#endif
+#ifndef TERRAIN_STREAM_UNLOAD_FACTOR
+    #define TERRAIN_STREAM_UNLOAD_FACTOR   1.25f    // Terrain tiles unloaded beyond view distance scaled by factor
+#endif
+#ifndef VOXEL_CHUNK_SIZE
+    #define VOXEL_CHUNK_SIZE                  16    // Voxel chunk voxels per side (up to 16, worst case mesh fits 16 bit indices)
+#endif
+#ifndef VOXEL_REMESH_CHUNKS_PER_UPDATE
+    #define VOXEL_REMESH_CHUNKS_PER_UPDATE    32    // Voxel chunks re-meshed per rl_UpdateVoxelWorld() call
+#endif
+#ifndef MODEL_ASYNC_UPLOADS_PER_UPDATE
+    #define MODEL_ASYNC_UPLOADS_PER_UPDATE  4   // Maximum GPU uploads (textures, meshes) per rl_UpdateModelAsync() call
+#endif
+#ifndef RAY_BATCH_CHUNK_SIZE
+    #define RAY_BATCH_CHUNK_SIZE     256    // Rays processed by a thread at once, smaller batches run on caller thread
+#endif
+#ifndef MESH_TANGENTS_CHUNK_SIZE
+    #define MESH_TANGENTS_CHUNK_SIZE    8192    // Triangles or vertices processed by a thread at once for tangents generation
+#endif
+#ifndef MESH_TANGENTS_EPSILON
+    #define MESH_TANGENTS_EPSILON      1e-10f   // Tangents generation degenerated texcoords area and length threshold
+#endif
+#ifndef BILLBOARD_SORT_CHUNK_SIZE
+    #define BILLBOARD_SORT_CHUNK_SIZE  16384    // Billboards processed by a thread at once for depth sorting
+#endif
+#ifndef SKINNING_CHUNK_SIZE
+    #define SKINNING_CHUNK_SIZE     2048    // Vertices skinned by a thread at once, smaller meshes run on caller thread
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Mesh BVH node, nodes are stored depth-first in a flat array
+// NOTE: Inner nodes children are consecutive (left at start, right at start + 1),
+// bounds are followed by an integer so every corner can be loaded as four floats
+typedef struct MeshBVHNode {
+    rl_Vector3 min;             // Node bounds minimum corner (mesh space)
+    int start;                  // Leaf: first triangle in BVH triangles list, inner: left child node index
+    rl_Vector3 max;             // Node bounds maximum corner (mesh space)
+    int count;                  // Leaf: number of triangles, inner: 0
+} MeshBVHNode;
+
+// Mesh bounding volume hierarchy (opaque struct declared in raylib.h)
+struct rl_MeshBVH {
+    int nodeCount;              // Number of nodes
+    MeshBVHNode *nodes;         // Nodes array, root is the first node
+    int triangleCount;          // Number of mesh triangles
+    int *triangles;             // Mesh triangles indices, reordered to leaf nodes order
+};
+
+// Ray batch job, rays are split in chunks processed by caller and worker threads
+typedef struct RayBatchJob {
+    const rl_Ray *rays;             // Rays to test
+    rl_RayCollision *collisions;    // Collisions results, one per ray
+    int count;                      // Number of rays
+    bool mesh;                      // Test rays against mesh (true) or box (false)
+    rl_Mesh target;                 // Mesh to test
+    rl_Matrix transform;            // Mesh transform
+    rl_BoundingBox box;             // Box to test
+} RayBatchJob;
+
+// Mesh skinning job, vertices are split in chunks processed by caller and worker threads
+typedef struct SkinningJob {
+    rl_Mesh mesh;                   // Mesh to skin, bone matrices already updated
+    bool normals;                   // Animate normals, mesh has base and animated normals
+    const rl_Matrix3x4 *normalMatrices; // Bones normal matrices (inverse transpose), linear blend skinning
+    const float *dualQuats;         // Bones dual quaternions (rotation, translation: 8 floats per bone), SUPPORT_MESH_DUAL_QUATERNION_SKINNING
+    int *changedStart;              // Chunks first changed vertex
+    int *changedEnd;                // Chunks last changed vertex + 1 (no change if not greater than start)
+} SkinningJob;
+
+// Mesh tangents job, triangles tangents are computed first, then gathered by vertices
+typedef struct TangentsJob {
+    rl_Mesh *mesh;                  // Mesh to compute tangents, tangents array already allocated
+    float *triangleTangents;        // Triangles tangents (normalized) and texcoords orientation, 4 floats per triangle
+    const int *cornerOffsets;       // Vertices first corner in corners array (vertexCount + 1)
+    const int *corners;             // Triangles corners (triangle*3 + corner) sorted by vertex
+} TangentsJob;
+
+// Mesh triangles cluster, used by mesh overdraw optimization
+typedef struct MeshCluster {
+    int start;                      // First triangle
+    int count;                      // Number of triangles
+    rl_Vector3 centroid;            // Area weighted centroid
+    rl_Vector3 normal;              // Area weighted normal (normalized)
+    float sortKey;                  // Sort key, clusters facing outwards first
+} MeshCluster;
+
+// Mesh levels of detail (opaque struct declared in raylib.h)
+// NOTE: Levels indices are stored after full detail indices, in mesh indices and index buffer
+struct rl_MeshLOD {
+    int levelCount;                 // Number of simplified levels (full detail level not included)
+    int triangleCounts[MAX_MESH_LOD_LEVELS]; // Levels number of triangles
+    int indexOffsets[MAX_MESH_LOD_LEVELS];   // Levels first index in mesh indices
+    float errors[MAX_MESH_LOD_LEVELS];       // Levels simplification error (mesh space distance)
+    rl_Vector3 center;              // Mesh bounding sphere center (mesh space)
+    float radius;                   // Mesh bounding sphere radius (mesh space)
+    int currentLevel;               // Last selected level, 0 for full detail
+};
+
+// Mesh streamed vertex buffers (opaque struct declared in raylib.h)
+// NOTE: Current buffer of every attribute is kept in mesh vboId, so drawing code is not aware of streaming
+struct rl_MeshStream {
+    int bufferCount;                // Buffers per streamed attribute
+    int dataSize[MAX_MESH_VERTEX_BUFFERS];      // Attribute buffers size in bytes, 0 for attributes not streamed
+    int current[MAX_MESH_VERTEX_BUFFERS];       // Attribute current buffer index
+    unsigned int frame[MAX_MESH_VERTEX_BUFFERS]; // Attribute last written frame (rl_GetFrameCount())
+    unsigned int vboIds[MAX_MESH_VERTEX_BUFFERS][MAX_MESH_STREAM_BUFFERS]; // Attribute buffers ring
+};
+
+// Static batch piece, mesh added to a static batch, stored as a sub-range of a merged mesh
+typedef struct StaticBatchPiece {
+    int meshIndex;                  // Merged mesh index
+    int vertexOffset;               // First vertex in merged mesh
+    int vertexCount;                // Number of vertices
+    int indexOffset;                // First index in merged mesh indices
+    int indexCount;                 // Number of indices
+    bool visible;                   // Piece visibility (hidden pieces indices are degenerated)
+} StaticBatchPiece;
+
+// Static batch merged mesh, pieces sharing material and spatial chunk
+typedef struct StaticBatchMesh {
+    rl_Mesh mesh;                   // Merged mesh, pre-transformed vertex data (world space)
+    int materialIndex;              // Static batch material index
+    int chunk[3];                   // Spatial chunk coordinates (chunk size units)
+    int vertexCapacity;             // Allocated vertices
+    int indexCapacity;              // Allocated indices
+    unsigned short *sourceIndices;  // Merged indices copy, allocated once pieces are hidden, required to show them again
+} StaticBatchMesh;
+
+// Static batch, static meshes merged by material and spatial chunk (opaque struct declared in raylib.h)
+struct rl_StaticBatch {
+    float chunkSize;                // Spatial chunk size, 0.0f for a single chunk
+    bool built;                     // Merged meshes uploaded to GPU, no more pieces can be added
+    rl_Material *materials;         // Batch materials (shallow copies, maps and shader are referenced)
+    int materialCount;              // Number of materials
+    StaticBatchMesh *meshes;        // Merged meshes
+    int meshCount;                  // Number of merged meshes
+    StaticBatchPiece *pieces;       // Pieces added to batch
+    int pieceCount;                 // Number of pieces
+};
+
+// Draw list model, model meshes added as draw list items
+typedef struct DrawListModel {
+    rl_Matrix transform;            // rl_Model transform (model.transform)
+    int firstItem;                  // First draw list item
+    int itemCount;                  // Number of items (model meshes)
+    bool visible;                   // rl_Model visibility
+    bool placed;                    // rl_Model world transform set at least once (bounds valid)
+    rl_BoundingBox bounds;          // rl_Model world bounds, all meshes (unbounded if any mesh bounds are empty)
+} DrawListModel;
+
+// Draw list change, world region affected by a model added, moved or hidden
+typedef struct DrawListChange {
+    unsigned int version;           // Draw list version after change
+    rl_BoundingBox bounds;          // World bounds affected by change
+} DrawListChange;
+
+// Draw list item, model mesh with cached world and normal matrices
+typedef struct DrawListItem {
+    rl_Mesh mesh;                   // Mesh (referenced, vertex data and buffers are not copied)
+    int materialIndex;              // Draw list material index
+    int modelIndex;                 // Draw list model index
+    rl_Matrix world;                // World matrix, model transform combined with draw list transform
+    rl_Matrix normal;               // Normal matrix, world matrix inverse transposed
+} DrawListItem;
+
+// Draw list command, item sort key (shader, material, mesh)
+typedef struct DrawListCommand {
+    unsigned int shaderId;          // Material shader id
+    int materialIndex;              // Draw list material index
+    unsigned int meshId;            // Mesh vertex array id (or vertex buffer id)
+    int item;                       // Draw list item index
+} DrawListCommand;
+
+// Draw list, models meshes sorted by shader and material (opaque struct declared in raylib.h)
+struct rl_DrawList {
+    rl_Material *materials;         // Draw list materials (shallow copies, maps and shader are referenced)
+    int materialCount;              // Number of materials
+    DrawListModel *models;          // Models added to draw list
+    int modelCount;                 // Number of models
+    DrawListItem *items;            // Items, one per model mesh
+    DrawListCommand *commands;      // Items draw order
+    int itemCount;                  // Number of items (and commands)
+    bool sorted;                    // Commands sorted, cleared when models are added
+    unsigned int version;           // Changes counter, increased when models are added, moved or hidden
+    DrawListChange changes[MAX_DRAWLIST_TRACKED_CHANGES];  // Latest changes (ring buffer, indexed by version)
+};
+
+// Shadow map cascade, light view-projection fitted to a camera view frustum slice
+typedef struct ShadowCascade {
+    rl_Matrix viewProj;             // Light view-projection matrix (cascade texture space before bias)
+    float splitFar;                 // Camera view distance where cascade ends
+    bool valid;                     // Cascade drawn with current matrix and casters
+    const rl_DrawList *casters;     // Draw list used to draw cascade
+    unsigned int version;           // Casters draw list version when cascade was drawn
+} ShadowCascade;
+
+// Shadow map, directional light cascaded shadow maps (opaque struct declared in raylib.h)
+// NOTE: Cascades are drawn only when their matrix changes or a caster moves inside them,
+// matrices are stable while camera moves: fixed light rotation, bounding sphere and texel snapping
+struct rl_ShadowMap {
+    unsigned int fboId;             // Framebuffer id, cascade depth layer attached before drawing
+    rl_TextureArray depth;          // Depth texture array, one layer per cascade (compare mode enabled)
+    int cascadeCount;               // Number of cascades
+    float distance;                 // Shadows maximum distance from camera
+    rl_Vector3 direction;           // Light direction (normalized)
+    ShadowCascade cascades[MAX_SHADOW_MAP_CASCADES];    // Cascades data
+};
+
+// Deferred light instance, light volume data uploaded to GPU instances buffer
+typedef struct DeferredLightInstance {
+    rl_Vector4 position;            // Light position (xyz) and radius (w)
+    rl_Vector3 color;               // Light color multiplied by intensity
+} DeferredLightInstance;
+
+// Deferred renderer, G-buffer pass and light volumes lighting pass (opaque struct declared in raylib.h)
+// NOTE: Point lights are drawn as instanced spheres (back faces, additive blending), every light only
+// shades the pixels its volume covers, cost scales with lights screen area instead of lights count
+struct rl_DeferredRenderer {
+    rlGBuffer gbuffer;              // G-buffer (albedo-specular, normals, depth)
+    rl_Matrix viewProj;             // G-buffer pass view-projection matrix
+    rl_Vector3 viewPosition;        // G-buffer pass camera position
+    unsigned int volumeVaoId;       // Light volume vertex array (sphere circumscribed polyhedron)
+    unsigned int volumeVboId;       // Light volume vertex buffer
+    int volumeVertexCount;          // Light volume number of vertices (triangles, not indexed)
+    unsigned int lightsVboId;       // Lights instances buffer
+    DeferredLightInstance *lights;  // Lights instances data (CPU copy)
+    int lightsCapacity;             // Lights instances buffer capacity
+    unsigned int screenVaoId;       // Full screen triangle vertex array (no attributes, vertex id based)
+};
+
+// Billboard batch, billboards instances drawn with one instanced draw call (opaque struct declared in raylib.h)
+// NOTE: Quads are expanded in vertex shader from instance data, sorting by depth is done on worker threads
+struct rl_BillboardBatch {
+    rl_BillboardInstance *instances; // Billboards instances (CPU), order provided by user
+    rl_BillboardInstance *sorted;   // Billboards instances sorted by depth, uploaded when sorting
+    unsigned int *keys;             // Sort keys, two buffers (ping-pong between radix passes)
+    int *indices;                   // Sort instances indices, two buffers (ping-pong between radix passes)
+    int *histograms;                // Radix sort digits counts per sort chunk (256 per chunk)
+    int capacity;                   // Maximum number of instances
+    int count;                      // Number of instances
+    bool uploaded;                  // Instances buffer contains instances (unsorted)
+    unsigned int vaoId;             // Quad vertex array id (0 if not supported)
+    unsigned int vboId;             // Quad corners vertex buffer id
+    unsigned int eboId;             // Quad indices buffer id
+    unsigned int instancesVboId;    // Instances vertex buffer id
+};
+
+// Billboard batch sorting job, processed by worker threads
+typedef struct BillboardSortJob {
+    rl_BillboardBatch *batch;       // Billboard batch to sort
+    rl_Vector3 viewPosition;        // View position (camera)
+    rl_Vector3 viewForward;         // View forward direction (normalized)
+    int source;                     // Keys and indices source buffer for current pass (0 or 1)
+    int shift;                      // Radix digit shift for current pass
+} BillboardSortJob;
+
+// Terrain chunk state
+typedef enum {
+    TERRAIN_CHUNK_UNLOADED = 0,     // Chunk heights not loaded
+    TERRAIN_CHUNK_LOADED,           // Chunk heights loaded and mesh uploaded
+    TERRAIN_CHUNK_FAILED            // Chunk height tile could not be loaded, not retried
+} TerrainChunkState;
+
+// Terrain chunk, indexed grid with skirts, coarser levels (geomipmaps) stored as mesh levels of detail
+typedef struct TerrainChunk {
+    rl_Mesh mesh;                   // Chunk mesh, vertex positions in world space
+    float *heights;                 // Chunk heights, (TERRAIN_CHUNK_QUADS + 1)^2 samples (world space)
+    int state;                      // Chunk state (TerrainChunkState)
+} TerrainChunk;
+
+// Terrain, heightmap split in chunks (opaque struct declared in raylib.h)
+struct rl_Terrain {
+    char fileName[MAX_FILEPATH_LENGTH]; // Height tiles file name format (tile x and z), empty if not streamed
+    int chunksX;                    // Number of chunks along x
+    int chunksZ;                    // Number of chunks along z
+    rl_Vector3 chunkSize;           // Chunk size (x, z) and maximum height (y)
+    TerrainChunk *chunks;           // Chunks (chunksX*chunksZ), row major
+};
+
+// Voxel world chunk, greedy meshed faces of chunk voxels
+typedef struct VoxelChunk {
+    rl_Mesh mesh;                   // Chunk mesh, world space positions, vertex data allocated for capacity
+    int vertexCapacity;             // Mesh vertex data capacity (CPU)
+    int uploadedCapacity;           // Mesh buffers capacity (GPU), 0 if not uploaded
+    bool dirty;                     // Chunk voxels changed, re-meshing required
+} VoxelChunk;
+
+// Voxel world, voxel types grid split in chunks (opaque struct declared in raylib.h)
+struct rl_VoxelWorld {
+    int chunksX;                    // Number of chunks along x
+    int chunksY;                    // Number of chunks along y
+    int chunksZ;                    // Number of chunks along z
+    float voxelSize;                // Voxel size (world units)
+    unsigned char *voxels;          // Voxel types, 0 for empty voxel
+    rl_Color colors[256];           // Voxel types colors, used as vertex colors
+    VoxelChunk *chunks;             // Chunks (chunksX*chunksY*chunksZ)
+};
+
+// Voxel chunks meshing job, processed by worker threads
+typedef struct VoxelMeshJob {
+    rl_VoxelWorld *world;           // Voxel world, voxels are not modified while meshing
+    const int *chunks;              // Chunks indices to mesh
+} VoxelMeshJob;
+
+// Mesh vertex quadric, planes squared distances sum, weighted by triangles area
+typedef struct MeshQuadric {
+    float a00, a11, a22;            // Planes normals products (diagonal)
+    float a01, a02, a12;            // Planes normals products (off-diagonal)
+    float b0, b1, b2;               // Planes normals by distance products
+    float c;                        // Planes squared distances
+    float weight;                   // Planes accumulated weight (area)
+} MeshQuadric;
+
+// Mesh edge collapse candidate, vertex moved into an adjacent vertex
+typedef struct MeshCollapse {
+    float cost;                     // Collapse error (squared distance)
+    int from;                       // Vertex removed
+    int to;                         // Vertex kept
+} MeshCollapse;
+
+// Async model loader, decoded on a worker thread and uploaded to GPU on caller thread
+// NOTE: Material textures images are kept while decoding, materials maps reference them
+// with placeholder textures (id = 0, mipmaps = -(image index + 1)) until uploaded
+struct rl_ModelLoader {
+    char fileName[MAX_FILEPATH_LENGTH]; // Model file name
+    rl_Model model;                 // Model data, GPU data is not valid until uploaded
+    rl_Image *images;               // Material textures images pending upload
+    int imageCount;                 // Number of images
+    int imageCapacity;              // Allocated images
+#if defined(SUPPORT_SHARED_TEXTURES)
+    char **imageKeys;               // Shared textures resource keys, image is stored by textures module (NULL if not shared)
+#endif
+    int uploadCount;                // Uploads completed (textures first, then meshes)
+    bool decoded;                   // Model decoding completed
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+    pthread_t thread;               // Decoding thread
+    bool threadActive;              // Decoding thread requires joining
+#endif
+};
+
+// Compressed animation channel type
+typedef enum {
+    ANIMATION_CHANNEL_TRANSLATION = 0,
+    ANIMATION_CHANNEL_ROTATION,
+    ANIMATION_CHANNEL_SCALE
+} AnimationChannelType;
+
+// Compressed animation channel (bone translation, rotation or scale keys)
+// NOTE: Channel keys are stored as frame indices followed by quantized values (3 per key)
+typedef struct AnimationChannel {
+    unsigned int keyOffset;         // First key offset in keys data (unsigned short elements)
+    int keyCount;                   // Number of keys
+    float rangeMin[3];              // Values range minimum (translation and scale)
+    float rangeSize[3];             // Values range size (translation and scale)
+} AnimationChannel;
+
+// Model cache (RMDL) file header
+// NOTE: File data sections are aligned to 16 bytes, vertex data is stored in GPU-ready layout
+typedef struct ModelCacheHeader {
+    char id[4];                     // Identifier: "rMDL"
+    int version;                    // File format version
+    int meshCount;                  // Number of meshes
+    int materialCount;              // Number of materials
+    int textureCount;               // Number of textures (shared by materials maps)
+    int boneCount;                  // Number of bones
+    int animCount;                  // Number of animations
+    int reserved;                   // Reserved for future use
+} ModelCacheHeader;
+
+// Model cache mesh, followed by available vertex attributes arrays
+typedef struct ModelCacheMesh {
+    int vertexCount;                // Number of vertices
+    int triangleCount;              // Number of triangles
+    int boneCount;                  // Number of bones
+    unsigned int attributes;        // Available vertex attributes (ModelCacheMeshAttribute flags)
+    int materialId;                 // Material index
+    int lodCount;                   // Number of LOD levels, followed by levels triangle counts, errors and indices
+    int reserved[2];                // Reserved for future use
+} ModelCacheMesh;
+
+// Model cache mesh vertex attributes flags
+typedef enum {
+    MODEL_CACHE_VERTICES    = 1 << 0,
+    MODEL_CACHE_TEXCOORDS   = 1 << 1,
+    MODEL_CACHE_TEXCOORDS2  = 1 << 2,
+    MODEL_CACHE_NORMALS     = 1 << 3,
+    MODEL_CACHE_TANGENTS    = 1 << 4,
+    MODEL_CACHE_COLORS      = 1 << 5,
+    MODEL_CACHE_INDICES     = 1 << 6,
+    MODEL_CACHE_BONEIDS     = 1 << 7,
+    MODEL_CACHE_BONEWEIGHTS = 1 << 8
+} ModelCacheMeshAttribute;
+
+// Model cache material map
+typedef struct ModelCacheMaterialMap {
+    rl_Color color;                 // Map color
+    float value;                    // Map value
+    int textureId;                  // Map texture index, -1 if default texture
+} ModelCacheMaterialMap;
+
+// Model cache material
+typedef struct ModelCacheMaterial {
+    float params[4];                // Material generic parameters
+    ModelCacheMaterialMap maps[MAX_MATERIAL_MAPS]; // Material maps
+} ModelCacheMaterial;
+
+// Model cache texture, followed by pixel data
+typedef struct ModelCacheTexture {
+    int width;                      // Texture width
+    int height;                     // Texture height
+    int format;                     // Pixel data format (PixelFormat type)
+    int dataSize;                   // Pixel data size in bytes
+} ModelCacheTexture;
+
+// Model cache animation, followed by bones and frame poses
+typedef struct ModelCacheAnimation {
+    int boneCount;                  // Number of bones
+    int frameCount;                 // Number of animation frames
+    char name[32];                  // Animation name
+} ModelCacheAnimation;
+
+// Model cache writing buffer
+typedef struct ModelCacheBuffer {
+    unsigned char *data;            // Buffer data
+    int size;                       // Buffer used size
+    int capacity;                   // Buffer allocated size
+} ModelCacheBuffer;
+
+// Compressed animation file header
+typedef struct CompressedAnimationHeader {
+    char id[4];                     // Identifier: "rCAN"
+    int version;                    // File format version
+    int boneCount;                  // Number of bones
+    int frameCount;                 // Number of animation frames
+    int dataSize;                   // Compressed data size in bytes
+    char name[32];                  // Animation name
+} CompressedAnimationHeader;
+
+// Worker job, process function is called for chunks of the [0, count) range
+typedef void (*WorkerJobFunc)(const void *data, int start, int end);
+typedef struct WorkerJob {
+    WorkerJobFunc process;          // Range processing function
+    const void *data;               // Job data, passed to process function
+    int count;                      // Range size
+    int chunkSize;                  // Range processed by a thread at once
+} WorkerJob;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+#if defined(GRAPHICS_API_OPENGL_43)
+// Mesh instances culling compute shader
+// NOTE: Frustum planes are extracted from mvp*transform, so the bounding sphere
+// is tested in mesh space and the test is valid for any instance scaling
+static const char *instancesCullShaderCode =
+    "#version 430\n"
+    "layout(local_size_x = 64) in;\n"
+    "layout(std430, binding = 0) readonly buffer InstanceTransforms { mat4 transforms[]; };\n"
+    "layout(std430, binding = 1) writeonly buffer VisibleTransforms { mat4 visible[]; };\n"
+    "layout(std430, binding = 2) buffer DrawCommand { uint command[5]; };\n"
+    "uniform mat4 mvp;\n"
+    "uniform vec4 bounds;\n"
+    "uniform uint instanceCount;\n"
+    "void main()\n"
+    "{\n"
+    "    uint index = gl_GlobalInvocationID.x;\n"
+    "    if (index >= instanceCount) return;\n"
+    "    mat4 transform = transforms[index];\n"
+    "    mat4 matrix = mvp*transform;\n"
+    "    vec4 rowX = vec4(matrix[0][0], matrix[1][0], matrix[2][0], matrix[3][0]);\n"
+    "    vec4 rowY = vec4(matrix[0][1], matrix[1][1], matrix[2][1], matrix[3][1]);\n"
+    "    vec4 rowZ = vec4(matrix[0][2], matrix[1][2], matrix[2][2], matrix[3][2]);\n"
+    "    vec4 rowW = vec4(matrix[0][3], matrix[1][3], matrix[2][3], matrix[3][3]);\n"
+    "    vec4 planes[6] = vec4[6](rowW + rowX, rowW - rowX, rowW + rowY, rowW - rowY, rowW + rowZ, rowW - rowZ);\n"
+    "    for (int i = 0; i < 6; i++)\n"
+    "    {\n"
+    "        if ((dot(planes[i].xyz, bounds.xyz) + planes[i].w) < -bounds.w*length(planes[i].xyz)) return;\n"
+    "    }\n"
+    "    uint slot = atomicAdd(command[1], 1u);\n"
+    "    visible[slot] = transform;\n"
+    "}\n";
+
+static struct {
+    unsigned int id;                // Compute shader program id
+    int mvpLoc;                     // Location: view frustum matrix (model-view-projection)
+    int boundsLoc;                  // Location: mesh bounding sphere
+    int countLoc;                   // Location: number of instances
+    int users;                      // Number of mesh instances using the shader
+} instancesCullShader = { 0 };
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Billboard batch shader, quad corners expanded on view plane from instance data
+// NOTE: Instance position.w is billboard rotation (degrees), source rectangle is normalized
+#if defined(GRAPHICS_API_OPENGL_21)
+    #define BILLBOARD_SHADER_HEADER     "#version 120\n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    #define BILLBOARD_SHADER_HEADER     "#version 330\n"
+#elif defined(GRAPHICS_API_OPENGL_ES3)
+    #define BILLBOARD_SHADER_HEADER     "#version 300 es\nprecision mediump float;\n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    #define BILLBOARD_SHADER_HEADER     "#version 100\nprecision mediump float;\n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_21) || (defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3))
+    #define BILLBOARD_SHADER_ATTRIBUTE  "attribute"
+    #define BILLBOARD_SHADER_VARYING_VS "varying"
+    #define BILLBOARD_SHADER_VARYING_FS "varying"
+    #define BILLBOARD_SHADER_OUTPUT     ""
+    #define BILLBOARD_SHADER_FRAGCOLOR  "gl_FragColor"
+    #define BILLBOARD_SHADER_TEXTURE    "texture2D"
+#else
+    #define BILLBOARD_SHADER_ATTRIBUTE  "in"
+    #define BILLBOARD_SHADER_VARYING_VS "out"
+    #define BILLBOARD_SHADER_VARYING_FS "in"
+    #define BILLBOARD_SHADER_OUTPUT     "out vec4 finalColor;\n"
+    #define BILLBOARD_SHADER_FRAGCOLOR  "finalColor"
+    #define BILLBOARD_SHADER_TEXTURE    "texture"
+#endif
+
+static const char *billboardShaderVsCode = BILLBOARD_SHADER_HEADER
+    BILLBOARD_SHADER_ATTRIBUTE " vec2 vertexPosition;\n"
+    BILLBOARD_SHADER_ATTRIBUTE " vec4 instancePosition;\n"
+    BILLBOARD_SHADER_ATTRIBUTE " vec2 instanceSize;\n"
+    BILLBOARD_SHADER_ATTRIBUTE " vec4 instanceColor;\n"
+    BILLBOARD_SHADER_VARYING_VS " vec2 fragTexCoord;\n"
+    BILLBOARD_SHADER_VARYING_VS " vec4 fragColor;\n"
+    "uniform mat4 mvp;\n"
+    "uniform vec3 viewRight;\n"
+    "uniform vec3 viewUp;\n"
+    "uniform vec4 source;\n"
+    "void main()\n"
+    "{\n"
+    "    float angle = radians(instancePosition.w);\n"
+    "    vec2 corner = vertexPosition*instanceSize;\n"
+    "    vec2 rotated = vec2(corner.x*cos(angle) - corner.y*sin(angle), corner.x*sin(angle) + corner.y*cos(angle));\n"
+    "    fragTexCoord = source.xy + vec2(vertexPosition.x + 0.5, 0.5 - vertexPosition.y)*source.zw;\n"
+    "    fragColor = instanceColor;\n"
+    "    gl_Position = mvp*vec4(instancePosition.xyz + viewRight*rotated.x + viewUp*rotated.y, 1.0);\n"
+    "}\n";
+
+static const char *billboardShaderFsCode = BILLBOARD_SHADER_HEADER
+    BILLBOARD_SHADER_VARYING_FS " vec2 fragTexCoord;\n"
+    BILLBOARD_SHADER_VARYING_FS " vec4 fragColor;\n"
+    BILLBOARD_SHADER_OUTPUT
+    "uniform sampler2D texture0;\n"
+    "void main()\n"
+    "{\n"
+    "    " BILLBOARD_SHADER_FRAGCOLOR " = " BILLBOARD_SHADER_TEXTURE "(texture0, fragTexCoord)*fragColor;\n"
+    "}\n";
+
+static struct {
+    unsigned int id;                // Shader program id
+    int mvpLoc;                     // Location: model-view-projection matrix
+    int rightLoc;                   // Location: view right direction
+    int upLoc;                      // Location: view up direction
+    int sourceLoc;                  // Location: texture source rectangle (normalized)
+    int textureLoc;                 // Location: texture sampler
+    int cornerLoc;                  // Location attribute: quad corner
+    int positionLoc;                // Location attribute: instance position and rotation
+    int sizeLoc;                    // Location attribute: instance size
+    int colorLoc;                   // Location attribute: instance color
+    int users;                      // Number of billboard batches using the shader
+} billboardShader = { 0 };
+#endif
+
+#if defined(SUPPORT_SHADOW_MAPS) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+// Shadow map depth shader, only vertex position is transformed
+// NOTE: Depth is clamped to near plane (pancaking), casters behind cascade sphere are kept
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    #define SHADOW_SHADER_HEADER        "#version 300 es\nprecision mediump float;\n"
+#else
+    #define SHADOW_SHADER_HEADER        "#version 330\n"
+#endif
+
+static const char *shadowShaderVsCode = SHADOW_SHADER_HEADER
+    "in vec3 vertexPosition;\n"
+    "uniform mat4 mvp;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+    "    gl_Position.z = max(gl_Position.z, -gl_Position.w);\n"
+    "}\n";
+
+static const char *shadowShaderFsCode = SHADOW_SHADER_HEADER
+    "void main()\n"
+    "{\n"
+    "}\n";
+
+static struct {
+    unsigned int id;                // Shader program id
+    int mvpLoc;                     // Location: model-view-projection matrix
+    int users;                      // Number of shadow maps using the shader
+} shadowShader = { 0 };
+#endif
+
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+// Deferred rendering shaders: G-buffer material shader, ambient pass and light volumes pass
+// NOTE: Normals are octahedral encoded, world positions reconstructed from depth
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    #define DEFERRED_SHADER_HEADER      "#version 300 es\nprecision highp float;\n"
+#else
+    #define DEFERRED_SHADER_HEADER      "#version 330\n"
+#endif
+
+static const char *deferredGeometryVsCode = DEFERRED_SHADER_HEADER
+    "in vec3 vertexPosition;\n"
+    "in vec2 vertexTexCoord;\n"
+    "in vec3 vertexNormal;\n"
+    "in vec4 vertexColor;\n"
+    "uniform mat4 mvp;\n"
+    "uniform mat4 matNormal;\n"
+    "out vec2 fragTexCoord;\n"
+    "out vec4 fragColor;\n"
+    "out vec3 fragNormal;\n"
+    "void main()\n"
+    "{\n"
+    "    fragTexCoord = vertexTexCoord;\n"
+    "    fragColor = vertexColor;\n"
+    "    fragNormal = vec3(matNormal*vec4(vertexNormal, 0.0));\n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+    "}\n";
+
+static const char *deferredGeometryFsCode = DEFERRED_SHADER_HEADER
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragColor;\n"
+    "in vec3 fragNormal;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "uniform vec4 colSpecular;\n"
+    "layout(location = 0) out vec4 gAlbedoSpec;\n"
+    "layout(location = 1) out vec4 gNormal;\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 albedo = texture(texture0, fragTexCoord)*colDiffuse*fragColor;\n"
+    "    if (albedo.a < 0.5) discard;\n"
+    "    vec3 n = normalize(fragNormal);\n"
+    "    n /= abs(n.x) + abs(n.y) + abs(n.z);\n"
+    "    vec2 oct = (n.z >= 0.0)? n.xy : (1.0 - abs(n.yx))*vec2((n.x >= 0.0)? 1.0 : -1.0, (n.y >= 0.0)? 1.0 : -1.0);\n"
+    "    gAlbedoSpec = vec4(albedo.rgb, dot(colSpecular.rgb, vec3(0.299, 0.587, 0.114)));\n"
+    "    gNormal = vec4(oct*0.5 + 0.5, 0.0, 1.0);\n"
+    "}\n";
+
+static const char *deferredAmbientVsCode = DEFERRED_SHADER_HEADER
+    "void main()\n"
+    "{\n"
+    "    vec2 position = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));\n"
+    "    gl_Position = vec4(position*2.0 - 1.0, 0.0, 1.0);\n"
+    "}\n";
+
+static const char *deferredAmbientFsCode = DEFERRED_SHADER_HEADER
+    "uniform sampler2D gAlbedoSpec;\n"
+    "uniform sampler2D gDepth;\n"
+    "uniform vec3 ambient;\n"
+    "out vec4 finalColor;\n"
+    "void main()\n"
+    "{\n"
+    "    ivec2 texel = ivec2(gl_FragCoord.xy);\n"
+    "    float depth = texelFetch(gDepth, texel, 0).r;\n"
+    "    if (depth >= 1.0) discard;\n"
+    "    gl_FragDepth = depth;\n"
+    "    finalColor = vec4(texelFetch(gAlbedoSpec, texel, 0).rgb*ambient, 1.0);\n"
+    "}\n";
+
+static const char *deferredLightVsCode = DEFERRED_SHADER_HEADER
+    "in vec3 vertexPosition;\n"
+    "in vec4 lightPosition;\n"
+    "in vec3 lightColor;\n"
+    "uniform mat4 viewProj;\n"
+    "flat out vec4 fragLightPosition;\n"
+    "flat out vec3 fragLightColor;\n"
+    "void main()\n"
+    "{\n"
+    "    fragLightPosition = lightPosition;\n"
+    "    fragLightColor = lightColor;\n"
+    "    gl_Position = viewProj*vec4(lightPosition.xyz + vertexPosition*lightPosition.w, 1.0);\n"
+    "}\n";
+
+static const char *deferredLightFsCode = DEFERRED_SHADER_HEADER
+    "flat in vec4 fragLightPosition;\n"
+    "flat in vec3 fragLightColor;\n"
+    "uniform sampler2D gAlbedoSpec;\n"
+    "uniform sampler2D gNormal;\n"
+    "uniform sampler2D gDepth;\n"
+    "uniform mat4 invViewProj;\n"
+    "uniform vec3 viewPosition;\n"
+    "uniform vec2 screenSize;\n"
+    "out vec4 finalColor;\n"
+    "void main()\n"
+    "{\n"
+    "    ivec2 texel = ivec2(gl_FragCoord.xy);\n"
+    "    float depth = texelFetch(gDepth, texel, 0).r;\n"
+    "    if (depth >= 1.0) discard;\n"
+    "    vec4 position = invViewProj*vec4(vec3(gl_FragCoord.xy/screenSize, depth)*2.0 - 1.0, 1.0);\n"
+    "    vec3 toLight = fragLightPosition.xyz - position.xyz/position.w;\n"
+    "    float lightDistance = length(toLight);\n"
+    "    if (lightDistance >= fragLightPosition.w) discard;\n"
+    "    vec2 oct = texelFetch(gNormal, texel, 0).xy*2.0 - 1.0;\n"
+    "    vec3 n = vec3(oct, 1.0 - abs(oct.x) - abs(oct.y));\n"
+    "    if (n.z < 0.0) n.xy = (1.0 - abs(n.yx))*vec2((n.x >= 0.0)? 1.0 : -1.0, (n.y >= 0.0)? 1.0 : -1.0);\n"
+    "    n = normalize(n);\n"
+    "    vec4 albedoSpec = texelFetch(gAlbedoSpec, texel, 0);\n"
+    "    vec3 l = toLight/lightDistance;\n"
+    "    vec3 h = normalize(l + normalize(viewPosition - position.xyz/position.w));\n"
+    "    float window = clamp(1.0 - pow(lightDistance/fragLightPosition.w, 4.0), 0.0, 1.0);\n"
+    "    float attenuation = window*window/(lightDistance*lightDistance + 1.0);\n"
+    "    float diffuse = max(dot(n, l), 0.0);\n"
+    "    float specular = (diffuse > 0.0)? pow(max(dot(n, h), 0.0), 32.0)*albedoSpec.a : 0.0;\n"
+    "    finalColor = vec4(fragLightColor*attenuation*(albedoSpec.rgb*diffuse + specular), 1.0);\n"
+    "}\n";
+
+static struct {
+    rl_Shader geometry;             // G-buffer pass material shader
+    unsigned int ambientId;         // Ambient pass shader program id
+    int ambientLocs[3];             // Ambient pass locations: albedo-specular, depth, ambient color
+    unsigned int lightId;           // Light volumes pass shader program id
+    int lightLocs[7];               // Light volumes pass locations: albedo-specular, normal, depth, view-projection, inverse view-projection, view position, screen size
+    int users;                      // Number of deferred renderers using the shaders
+} deferredShaders = { 0 };
+
+static RL_CONTEXT_LOCAL rl_DeferredRenderer *deferredActive = NULL;  // Deferred renderer inside rl_BeginDeferredMode()
+#endif
+
+static RL_CONTEXT_LOCAL bool frustumCulling = false;     // Frustum culling enabled for rl_DrawMesh()
+static RL_CONTEXT_LOCAL unsigned int meshQuantization = 0;   // Vertex attributes quantization for rl_UploadMesh() (rl_MeshQuantization flags)
+
+#if defined(SUPPORT_OCCLUSION_CULLING)
+// Occlusion depth pyramid (hierarchical-z), built on CPU from async depth readbacks
+// NOTE: Every level stores the farthest depth of the texels it covers, level 0 stores
+// the farthest depth of every OCCLUSION_DEPTH_TILE_SIZE*OCCLUSION_DEPTH_TILE_SIZE pixels tile
+static struct {
+    bool enabled;                   // Occlusion culling enabled
+    bool ready;                     // Depth pyramid available
+    rl_Matrix viewProj;             // View-projection matrix of depth pyramid frame
+    int levelCount;                 // Number of pyramid levels
+    int widths[OCCLUSION_DEPTH_MAX_LEVELS];     // Levels width (texels)
+    int heights[OCCLUSION_DEPTH_MAX_LEVELS];    // Levels height (texels)
+    float *levels[OCCLUSION_DEPTH_MAX_LEVELS];  // Levels depth data, bottom-left origin
+    int capacity;                   // Allocated texels for all levels
+    int pending;                    // Depth readbacks in flight
+} occlusion = { 0 };
+#endif
+
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+// Async model loaders, models are decoded on their own thread
+static pthread_mutex_t modelLoadersLock = PTHREAD_MUTEX_INITIALIZER;    // Protects loaders decoding state
+static pthread_once_t modelLoaderKeyOnce = PTHREAD_ONCE_INIT;           // Thread key initialization
+static pthread_key_t modelLoaderKey;                                    // Loader decoded on current thread
+#else
+static rl_ModelLoader *modelLoaderContext = NULL;                       // Loader decoded on caller thread
+#endif
+
+#if defined(SUPPORT_SHARED_TEXTURES)
+//----------------------------------------------------------------------------------
+// Other Modules Functions Declaration (required by models)
+//----------------------------------------------------------------------------------
+extern bool AcquireSharedTexture(const char *key, rl_Texture2D *texture); // [Module: textures] Acquire shared texture by resource key
+extern rl_Texture2D StoreSharedTexture(const char *key, rl_Image image, bool upload); // [Module: textures] Store shared texture image, completing resource loading
+extern rl_Texture2D UploadSharedTexture(const char *key); // [Module: textures] Upload shared texture image stored by a deferred load
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
+static rl_Model LoadModelData(const char *fileName);   // Load model data from file, meshes are not uploaded to GPU
+static rl_ModelLoader *GetModelLoaderContext(void);  // Get async model loader decoding on current thread
+static int ReserveModelLoaderUpload(rl_ModelLoader *loader); // Reserve async model loader texture upload slot
+static rl_Texture2D DeferMaterialTexture(rl_ModelLoader *loader, rl_Image image); // Defer material texture upload to async model loader
+static rl_Texture2D LoadMaterialTexture(rl_Image image); // Load material texture from image (deferred if loading asynchronously)
+static rl_Texture2D LoadMaterialTextureFile(const char *dirPath, const char *fileName); // Load material texture from file relative to model directory (deferred if loading asynchronously)
+static void GetModelDirectoryPath(const char *fileName, char *dirPath); // Get model file directory path (thread-safe)
+static bool GetModelFilePath(const char *dirPath, const char *fileName, char *filePath); // Get model resource file path relative to model directory
+#if defined(SUPPORT_SHARED_TEXTURES)
+static rl_Texture2D DeferSharedMaterialTexture(rl_ModelLoader *loader, const char *key, rl_Texture2D texture); // Defer shared material texture upload to async model loader
+static bool AcquireMaterialTexture(const char *key, rl_Texture2D *texture); // Acquire shared material texture by resource key
+static rl_Texture2D StoreMaterialTexture(const char *key, rl_Image image); // Store shared material texture image (deferred if loading asynchronously)
+static bool GetMaterialTextureFileKey(const char *fileName, char *key); // Get material texture file resource key
+#endif
+static void *ModelLoaderThread(void *data);         // Decode async model loader data
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+static void InitModelLoaderKey(void);               // Init async model loader thread key
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 static rl_Model LoadOBJ(const char *fileName);     // Load OBJ mesh data
+static char *ResolveMaterialLibraryOBJ(const char *fileText, const char *dirPath); // Resolve OBJ material library paths from model directory
+static const char *GetMaterialLibraryNameOBJ(const char *line); // Get OBJ line relative material library name
 #endif
 #if defined(SUPPORT_FILEFORMAT_IQM)
 static rl_Model LoadIQM(const char *fileName);     // Load IQM mesh data
@@ -167,8 +1014,125 @@ static rl_Model LoadVOX(const char *filename);     // Load VOX mesh data
 static rl_Model LoadM3D(const char *filename);     // Load M3D mesh data
 static rl_ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCount);   // Load M3D animation data
 #endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+static rl_Model LoadRMDL(const char *fileName);    // Load model cache data (RMDL)
+static rl_ModelAnimation *LoadModelAnimationsRMDL(const char *fileName, int *animCount);  // Load model cache animation data (RMDL)
+static unsigned char *LoadFileDataMapped(const char *fileName, int *dataSize); // Load file data mapped into memory (read-only)
+static void UnloadFileDataMapped(unsigned char *data, int dataSize); // Unload file data mapped into memory
+static void WriteModelCacheData(ModelCacheBuffer *buffer, const void *data, int size); // Write data to model cache buffer (16 bytes aligned)
+static const void *ReadModelCacheData(const unsigned char *fileData, int fileSize, int *offset, int count, int size); // Read data from model cache file data
+static void *ReadModelCacheArray(const unsigned char *fileData, int fileSize, int *offset, int count, int size); // Read model cache array into a new allocated array
+static bool LoadModelCacheHeader(const unsigned char *fileData, int fileSize, ModelCacheHeader *header); // Load model cache header, returns false if not valid
+#endif
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
-static void ProcessMaterialsOBJ(rl_Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
+static void ProcessMaterialsOBJ(rl_Material *rayMaterials, tinyobj_material_t *materials, int materialCount, const char *dirPath);  // Process obj materials
+#endif
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void DrawMeshInstancesBuffer(rl_Mesh mesh, rl_Material material, unsigned int instancesVboId, int instances, unsigned int indirectId, unsigned int paletteId, unsigned int palettesVboId); // Draw mesh instances with transforms from GPU buffer
+#endif
+static bool IsMeshCulled(rl_Mesh mesh, rl_Matrix transform); // Check if mesh is culled (frustum, occlusion) for current view
+static void GetMeshTriangle(rl_Mesh mesh, int index, rl_Vector3 *a, rl_Vector3 *b, rl_Vector3 *c); // Get mesh triangle vertices (mesh space)
+static rl_Matrix GetTransformMatrix(rl_Transform transform); // Get transform matrix (scale, rotation, translation)
+static rl_Matrix GetTransformMatrixInverse(rl_Transform transform); // Get transform inverse matrix
+static rl_Matrix GetNormalMatrix(rl_Matrix mat); // Get normal matrix (inverse transpose) of transform matrix
+#if (defined(RL_SUPPORT_MESH_GPU_SKINNING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))) || defined(SUPPORT_MESH_DUAL_QUATERNION_SKINNING)
+static void GetBoneDualQuaternion(rl_Matrix mat, float *dualQuat); // Get bone dual quaternion from bone matrix (8 floats: rotation, translation)
+#endif
+#if defined(RL_SUPPORT_MESH_GPU_SKINNING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+static void SetShaderBoneUniforms(rl_Shader shader, rl_Mesh mesh); // Set shader bone uniforms from mesh bone matrices (matrices or dual quaternions)
+#endif
+static rl_Matrix GetModelBoneMatrix(rl_Model model, int boneId, rl_Transform transform); // Get model bone skinning matrix for bone transform
+static void UpdateModelBoneMatrices(rl_Model model, const rl_Transform *pose, int boneCount); // Update model mesh bone matrices from pose
+static rl_Quaternion GetAnimationChannelValue(rl_ModelAnimation anim, int frame, int boneId, int channelType); // Get animation channel value at frame
+static rl_Quaternion InterpolateAnimationChannelValue(int channelType, rl_Quaternion a, rl_Quaternion b, float amount); // Interpolate animation channel values
+static float GetAnimationChannelError(int channelType, rl_Quaternion a, rl_Quaternion b); // Get animation channel values error
+static int ReduceAnimationChannel(rl_ModelAnimation anim, int boneId, int channelType, float tolerance, int *keyFrames); // Reduce animation channel keys, returns kept keys frames
+static void EncodeAnimationChannelValue(const AnimationChannel *channel, int channelType, rl_Quaternion value, unsigned short *encoded); // Encode animation channel value into 3 quantized values
+static rl_Quaternion DecodeAnimationChannelValue(const AnimationChannel *channel, int channelType, const unsigned short *encoded); // Decode animation channel value from 3 quantized values
+static void BuildMeshBVHNode(rl_MeshBVH *bvh, int nodeIndex, int start, int count, const rl_BoundingBox *bounds, const rl_Vector3 *centroids, int depth); // Build mesh BVH node, splitting it recursively
+static float GetIndicesACMR(const unsigned int *indices, int indexCount, int vertexCount); // Get indices average cache miss ratio (FIFO cache)
+static float GetVertexCacheScore(int cachePosition, int remainingTriangles); // Get vertex score for vertex cache optimization
+static void OptimizeIndicesCache(unsigned int *indices, int indexCount, int vertexCount); // Optimize indices triangles order for vertex cache
+static void OptimizeIndicesOverdraw(unsigned int *indices, int indexCount, const float *vertices, int vertexCount); // Optimize indices triangles clusters order for overdraw
+static int CompareMeshClusters(const void *a, const void *b); // Compare mesh clusters sort key (descending)
+static int GetMeshIndexCount(rl_Mesh mesh);             // Get mesh indices count, including levels of detail indices
+static int GetMeshLODLevel(rl_Mesh mesh, rl_Matrix transform); // Get mesh level of detail for current view
+static int GetMeshDrawIndexCount(rl_Mesh mesh, rl_Matrix transform, int *indexOffset); // Get mesh indices count to draw for current view (level of detail)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void EnableMeshVertexBuffers(rl_Mesh mesh, rl_Shader shader); // Enable mesh vertex buffers and shader vertex attributes (no vertex array object)
+#endif
+static void AddMeshQuadric(MeshQuadric *quadric, const MeshQuadric *other); // Add quadric to mesh vertex quadric
+static float GetMeshQuadricError(const MeshQuadric *quadric, const float *p); // Get mesh quadric squared distance error for position
+static int SimplifyMeshIndices(unsigned int *indices, int indexCount, const float *vertices, int vertexCount, MeshQuadric *quadrics, int targetCount, float maxError, float *error); // Simplify mesh indices collapsing edges
+static int CompareMeshCollapses(const void *a, const void *b); // Compare mesh edge collapses cost (ascending)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static unsigned int GetMeshQuantization(rl_Mesh mesh, bool dynamic); // Get mesh vertex buffers quantization for upload
+#endif
+static void *LoadMeshVertexBufferData(rl_Mesh mesh, int attribute, const void *data, int *dataSize); // Load mesh vertex attribute data for GPU vertex buffer (quantized)
+static void SetMeshVertexAttribute(rl_Mesh mesh, int attribute, unsigned int location); // Set mesh vertex attribute format, considering mesh quantization
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static unsigned int LoadMeshVertexBuffer(rl_Mesh mesh, int attribute, const void *data, bool dynamic); // Load mesh vertex buffer for attribute
+#endif
+static unsigned short FloatToHalf(float x);         // Convert float to half float
+static int FindMaterialIndex(rl_Material **materials, int *materialCount, rl_Material material); // Find material in materials list, added if not found
+static void AppendStaticBatchMesh(StaticBatchMesh *target, rl_Mesh mesh, rl_Matrix transform, StaticBatchPiece *piece); // Append mesh to static batch merged mesh (transformed)
+static int CompareDrawListCommands(const void *a, const void *b); // Compare draw list commands sort key (shader, material, mesh)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void SetDrawListMaterial(const rl_Material *material, const rl_Material *previous); // Set draw list material, previous material maps not used are unbound
+#endif
+static rl_BoundingBox GetDrawListModelBounds(const rl_DrawList *list, int index); // Get draw list model world bounds (all meshes)
+static void TrackDrawListChange(rl_DrawList *list, rl_BoundingBox bounds); // Track draw list change, world bounds affected
+#if defined(SUPPORT_SHADOW_MAPS) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+static rl_Frustum GetShadowCascadeFrustum(rl_Matrix viewProj); // Get shadow cascade frustum, near plane disabled (casters toward light)
+static bool IsShadowCascadeCached(const ShadowCascade *cascade, const rl_DrawList *casters, rl_Matrix viewProj); // Check if shadow cascade drawn data is still valid
+static void DrawShadowCascade(rl_ShadowMap *shadowMap, int index, const rl_DrawList *casters); // Draw casters into shadow cascade depth layer
+#endif
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+static rl_Shader GetDeferredShader(rl_Shader shader);   // Get material shader for current pass (G-buffer shader replaces default shader)
+static float *GenLightVolumeVertices(int *vertexCount); // Generate light volume vertices (unit sphere circumscribed polyhedron)
+#endif
+static void SortBillboardBatch(rl_BillboardBatch *batch, rl_Vector3 viewPosition, rl_Vector3 viewForward); // Sort billboard batch instances by view depth (back to front)
+static float *LoadTerrainImageHeights(rl_Image image); // Load terrain image heights, normalized [0.0f..1.0f]
+static float SampleTerrainImage(const float *values, int width, int height, float u, float v); // Sample terrain image heights (bilinear)
+static float GetTerrainCellHeight(const float *heights, int x, int z, int step, float tx, float tz); // Get terrain chunk grid cell height (interpolated)
+static float GetTerrainChunkSample(const rl_Terrain *terrain, int cx, int cz, int x, int z); // Get terrain chunk height at grid sample (neighbours aware)
+static float GetTerrainChunkDistance(const rl_Terrain *terrain, int cx, int cz, rl_Vector3 position); // Get terrain chunk distance to view position (horizontal)
+static int AppendTerrainLevelIndices(unsigned short *indices, int step); // Append terrain chunk level indices, returns indices count
+static void LoadTerrainChunkMesh(rl_Terrain *terrain, int cx, int cz); // Load terrain chunk mesh from chunk heights (levels of detail and skirts)
+static void LoadTerrainChunkTile(rl_Terrain *terrain, int cx, int cz); // Load terrain chunk height tile from file
+static void UnloadTerrainChunk(TerrainChunk *chunk);   // Unload terrain chunk heights and mesh
+static unsigned char GetVoxelWorldVoxel(const rl_VoxelWorld *world, int x, int y, int z); // Get voxel world voxel type (0 out of world)
+static void ProcessVoxelMeshRange(const void *data, int start, int end); // Process voxel chunks meshing range on current thread
+static void MeshVoxelChunk(rl_VoxelWorld *world, int index); // Mesh voxel chunk with greedy faces merging (CPU only)
+static void UploadVoxelChunk(VoxelChunk *chunk);       // Upload voxel chunk mesh, buffers updated if capacity is enough
+static bool GetRayCollisionMeshBVHNode(const MeshBVHNode *node, const float *origin, const float *invDirection, float maxDistance, float *distance); // Get ray entry distance into mesh BVH node bounds
+static rl_BoundingBox GetMeshBVHNodeBounds(const MeshBVHNode *node, rl_Matrix transform); // Get mesh BVH node bounds with transform applied
+static bool CheckCollisionMeshVolume(rl_Mesh mesh, rl_Matrix transform, rl_BoundingBox bounds, const rl_Vector3 *center, float radius); // Check collision between mesh and sphere (center not NULL) or box
+static bool CheckCollisionTriangleSphere(rl_Vector3 a, rl_Vector3 b, rl_Vector3 c, rl_Vector3 center, float radius); // Check collision between triangle and sphere
+static bool CheckCollisionTriangleBox(rl_Vector3 a, rl_Vector3 b, rl_Vector3 c, rl_BoundingBox box); // Check collision between triangle and box
+static rl_Ray GetMeshSpaceRay(rl_Ray ray, rl_Matrix invTransform); // Get ray in mesh space, direction is not normalized
+static rl_RayCollision GetRayCollisionMeshTriangle(rl_Ray ray, rl_Mesh mesh, rl_Matrix transform, int triangle, float distance); // Get collision info for mesh triangle hit
+static rl_RayCollision GetRayCollisionBoxResult(rl_Ray ray, rl_BoundingBox box, float tNear, float tFar, bool insideBox); // Get collision info from ray-box slabs distances
+static void ProcessRayBatch(const RayBatchJob *job); // Process ray batch, splitting it across worker threads
+static void ProcessRayBatchRange(const void *data, int start, int end); // Process ray batch range on current thread
+static void ProcessSkinningRange(const void *data, int start, int end); // Process mesh skinning vertex range on current thread
+static void ProcessTangentsTriangleRange(const void *data, int start, int end); // Process mesh tangents triangles range on current thread
+static void ProcessTangentsVertexRange(const void *data, int start, int end); // Process mesh tangents vertices range on current thread
+static void ProcessBillboardKeysRange(const void *data, int start, int end); // Process billboard batch sort keys range on current thread
+static void ProcessBillboardHistogramRange(const void *data, int start, int end); // Process billboard batch sort digits counts range on current thread
+static void ProcessBillboardScatterRange(const void *data, int start, int end); // Process billboard batch sort scatter range on current thread
+static void ProcessBillboardGatherRange(const void *data, int start, int end); // Process billboard batch sorted instances gathering range on current thread
+static void RunWorkerJob(const WorkerJob *job); // Run job, splitting its range in chunks processed by worker threads
+#if defined(RAYMATH_SSE_ENABLED)
+static void GetRayCollisionBoxPacket(const rl_Ray *rays, rl_BoundingBox box, rl_RayCollision *collisions); // Get collision info between 4 rays and box
+static void GetRayCollisionMeshPacket(const rl_Ray *rays, rl_Mesh mesh, rl_Matrix transform, rl_RayCollision *collisions); // Get collision info between 4 rays and mesh BVH
+static int GetRayPacketCollisionMeshBVHNode(const MeshBVHNode *node, const __m128 *origin, const __m128 *invDirection, const __m128 *maxDistance, __m128 *distance); // Get 4 rays entry distances into mesh BVH node bounds
+#endif
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+static void ProcessWorkerJobRange(void *userData, int start, int end); // Process worker job range (job system callback)
+#endif
+#if defined(SUPPORT_OCCLUSION_CULLING) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+static void BuildOcclusionDepth(unsigned char *data, int width, int height, void *userData); // Build occlusion depth pyramid from depth readback
 #endif
 
 //----------------------------------------------------------------------------------
@@ -1098,44 +2062,138 @@ void rl_DrawGrid(int slices, float spacing)
 // Load model from files (mesh and material)
 rl_Model rl_LoadModel(const char *fileName)
 {
-    rl_Model model = { 0 };
+    PROFILE_ZONE_BEGIN("rl_LoadModel");
 
-#if defined(SUPPORT_FILEFORMAT_OBJ)
-    if (rl_IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_IQM)
-    if (rl_IsFileExtension(fileName, ".iqm")) model = LoadIQM(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_GLTF)
-    if (rl_IsFileExtension(fileName, ".gltf") || rl_IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_VOX)
-    if (rl_IsFileExtension(fileName, ".vox")) model = LoadVOX(fileName);
-#endif
-#if defined(SUPPORT_FILEFORMAT_M3D)
-    if (rl_IsFileExtension(fileName, ".m3d")) model = LoadM3D(fileName);
+    rl_Model model = LoadModelData(fileName);
+
+    // Upload vertex data to GPU (static meshes)
+    for (int i = 0; i < model.meshCount; i++) rl_UploadMesh(&model.meshes[i], false);
+
+    PROFILE_ZONE_END();
+
+    return model;
+}
+
+// Load model asynchronously, file reading and decoding is done on a worker thread
+// NOTE: GPU data (meshes and textures) is uploaded by rl_UpdateModelAsync(), called from the main thread
+rl_ModelLoader *rl_LoadModelAsync(const char *fileName)
+{
+    rl_ModelLoader *loader = (rl_ModelLoader *)RL_CALLOC(1, sizeof(rl_ModelLoader));
+    strncpy(loader->fileName, fileName, MAX_FILEPATH_LENGTH - 1);
+
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+    pthread_once(&modelLoaderKeyOnce, InitModelLoaderKey);
+
+    if (pthread_create(&loader->thread, NULL, ModelLoaderThread, loader) == 0) loader->threadActive = true;
+    else
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to create loading thread, model decoded on main thread", fileName);
+        ModelLoaderThread(loader);
+    }
+#else
+    // No threads available, model is decoded on caller thread but uploads are still spread over updates
+    modelLoaderContext = loader;
+    ModelLoaderThread(loader);
+    modelLoaderContext = NULL;
 #endif
 
-    // Make sure model transform is set to identity matrix!
-    model.transform = MatrixIdentity();
+    return loader;
+}
 
-    if ((model.meshCount != 0) && (model.meshes != NULL))
+// Update async model loading, uploads to GPU a limited number of textures and meshes once decoded
+// NOTE: Returns loading progress [0.0f..1.0f], model is ready to be retrieved when 1.0f
+float rl_UpdateModelAsync(rl_ModelLoader *loader)
+{
+    if (loader == NULL) return 0.0f;
+
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+    pthread_mutex_lock(&modelLoadersLock);
+    bool decoded = loader->decoded;
+    pthread_mutex_unlock(&modelLoadersLock);
+
+    if (!decoded) return 0.0f;
+
+    if (loader->threadActive)
     {
-        // Upload vertex data to GPU (static meshes)
-        for (int i = 0; i < model.meshCount; i++) rl_UploadMesh(&model.meshes[i], false);
+        pthread_join(loader->thread, NULL);
+        loader->threadActive = false;
     }
-    else TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
+#endif
 
-    if (model.materialCount == 0)
+    int uploadTotal = loader->imageCount + loader->model.meshCount;
+
+    for (int uploads = 0; (loader->uploadCount < uploadTotal) && (uploads < MODEL_ASYNC_UPLOADS_PER_UPDATE); uploads++)
     {
-        TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to load model material data, default to white material", fileName);
+        if (loader->uploadCount < loader->imageCount)
+        {
+            // Upload texture and replace materials maps placeholders
+            int index = loader->uploadCount;
+            rl_Texture2D texture = { 0 };
+            bool shared = false;
 
-        model.materialCount = 1;
-        model.materials = (rl_Material *)RL_CALLOC(model.materialCount, sizeof(rl_Material));
-        model.materials[0] = rl_LoadMaterialDefault();
+#if defined(SUPPORT_SHARED_TEXTURES)
+            if (loader->imageKeys[index] != NULL)
+            {
+                // Shared texture could be uploaded already by another load of the same resource
+                texture = UploadSharedTexture(loader->imageKeys[index]);
+                RL_FREE(loader->imageKeys[index]);
+                loader->imageKeys[index] = NULL;
+                shared = true;
+            }
+            else
+#endif
+            texture = rl_LoadTextureFromImageAsync(loader->images[index]);
 
-        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+            bool used = false;
+
+            for (int i = 0; i < loader->model.materialCount; i++)
+            {
+                for (int m = 0; m < MAX_MATERIAL_MAPS; m++)
+                {
+                    rl_Texture2D *mapTexture = &loader->model.materials[i].maps[m].texture;
+                    if ((mapTexture->id == 0) && (mapTexture->mipmaps == -(index + 1))) { *mapTexture = texture; used = true; }
+                }
+            }
+
+            // Texture not referenced by any material (i.e. model data rejected) is not kept
+            if (!used && !shared && (texture.id > 0)) rl_UnloadTexture(texture);
+
+            rl_UnloadImage(loader->images[index]);
+            loader->images[index] = CLITERAL(rl_Image){ 0 };
+        }
+        else rl_UploadMesh(&loader->model.meshes[loader->uploadCount - loader->imageCount], false);
+
+        loader->uploadCount++;
+    }
+
+    return (float)(1 + loader->uploadCount)/(float)(1 + uploadTotal);
+}
+
+// Finish async model loading, waits for decoding and uploads remaining data
+// NOTE: Loader is freed, returned model must be unloaded with rl_UnloadModel()
+rl_Model rl_FinishModelAsync(rl_ModelLoader *loader)
+{
+    rl_Model model = { 0 };
+
+    if (loader == NULL) return model;
+
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+    if (loader->threadActive)
+    {
+        pthread_join(loader->thread, NULL);
+        loader->threadActive = false;
     }
+#endif
+
+    while (rl_UpdateModelAsync(loader) < 1.0f) { }
+
+    model = loader->model;
+
+    RL_FREE(loader->images);
+#if defined(SUPPORT_SHARED_TEXTURES)
+    RL_FREE(loader->imageKeys);
+#endif
+    RL_FREE(loader);
 
     return model;
 }
@@ -1164,6 +2222,31 @@ rl_Model rl_LoadModelFromMesh(rl_Mesh mesh)
     return model;
 }
 
+// Load model from model cache file (.rmdl), exported with rl_ExportModel()
+// NOTE: File is memory mapped and meshes are uploaded to GPU with no data conversion
+rl_Model rl_LoadModelFromCache(const char *fileName)
+{
+    rl_Model model = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    model = LoadRMDL(fileName);
+    model.transform = MatrixIdentity();
+
+    if ((model.meshCount != 0) && (model.meshes != NULL))
+    {
+        // Upload vertex data to GPU (static meshes)
+        for (int i = 0; i < model.meshCount; i++) rl_UploadMesh(&model.meshes[i], false);
+
+        TRACELOG(LOG_INFO, "MODEL: [%s] Model cache loaded successfully (%i meshes, %i materials)", fileName, model.meshCount, model.materialCount);
+    }
+    else TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model cache mesh(es) data", fileName);
+#else
+    TRACELOG(LOG_WARNING, "MODEL: [%s] Model cache loading not supported (SUPPORT_FILEFORMAT_RMDL)", fileName);
+#endif
+
+    return model;
+}
+
 // Check if a model is valid (loaded in GPU, VAO/VBOs)
 bool rl_IsModelValid(rl_Model model)
 {
@@ -1218,6 +2301,7 @@ void rl_UnloadModel(rl_Model model)
     // Unload animation data
     RL_FREE(model.bones);
     RL_FREE(model.bindPose);
+    RL_FREE(model.bindInverse);
 
     TRACELOG(LOG_INFO, "MODEL: Unloaded model (and meshes) from RAM and VRAM");
 }
@@ -1257,6 +2341,14 @@ rl_BoundingBox rl_GetModelBoundingBox(rl_Model model)
     return bounds;
 }
 
+// Generate model meshes levels of detail, see rl_GenMeshLOD()
+void rl_GenModelLOD(rl_Model *model, int levelCount, float reduction)
+{
+    if (model == NULL) return;
+
+    for (int i = 0; i < model->meshCount; i++) rl_GenMeshLOD(&model->meshes[i], levelCount, reduction);
+}
+
 // Upload vertex data into a VAO (if supported) and VBO
 void rl_UploadMesh(rl_Mesh *mesh, bool dynamic)
 {
@@ -1269,6 +2361,12 @@ void rl_UploadMesh(rl_Mesh *mesh, bool dynamic)
 
     mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
 
+    // Keep mesh bounds for culling, avoids iterating vertex data on every draw
+    // NOTE: Bounds are not updated by rl_UpdateMeshBuffer(), they must be set by user if required
+    rl_BoundingBox bounds = rl_GetMeshBoundingBox(*mesh);
+    mesh->boundsMin = bounds.min;
+    mesh->boundsMax = bounds.max;
+
     mesh->vaoId = 0;        // Vertex Array Object
     mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION] = 0;     // Vertex buffer: positions
     mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD] = 0;     // Vertex buffer: texcoords
@@ -1289,20 +2387,21 @@ void rl_UploadMesh(rl_Mesh *mesh, bool dynamic)
 
     rlEnableVertexArray(mesh->vaoId);
 
+    // Select vertex attributes quantization, requested by rl_SetMeshQuantization()
+    mesh->quantization = GetMeshQuantization(*mesh, dynamic);
+
     // NOTE: Vertex attributes must be uploaded considering default locations points and available vertex data
 
     // Enable vertex attributes: position (shader-location = 0)
     void *vertices = (mesh->animVertices != NULL)? mesh->animVertices : mesh->vertices;
-    mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION] = rlLoadVertexBuffer(vertices, mesh->vertexCount*3*sizeof(float), dynamic);
-    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_FLOAT, 0, 0, 0);
+    mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION] = LoadMeshVertexBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, vertices, dynamic);
     rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
 
     // Enable vertex attributes: texcoords (shader-location = 1)
 
     if (mesh->texcoords != NULL)
     {
-        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD] = rlLoadVertexBuffer(mesh->texcoords, mesh->vertexCount*2*sizeof(float), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, RL_FLOAT, 0, 0, 0);
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD] = LoadMeshVertexBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, mesh->texcoords, dynamic);
         rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
     }
     else
@@ -1318,8 +2417,7 @@ void rl_UploadMesh(rl_Mesh *mesh, bool dynamic)
     {
         // Enable vertex attributes: normals (shader-location = 2)
         void *normals = (mesh->animNormals != NULL)? mesh->animNormals : mesh->normals;
-        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL] = rlLoadVertexBuffer(normals, mesh->vertexCount*3*sizeof(float), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, 3, RL_FLOAT, 0, 0, 0);
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL] = LoadMeshVertexBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, normals, dynamic);
         rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
     }
     else
@@ -1350,8 +2448,7 @@ void rl_UploadMesh(rl_Mesh *mesh, bool dynamic)
     if (mesh->tangents != NULL)
     {
         // Enable vertex attribute: tangent (shader-location = 4)
-        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT] = rlLoadVertexBuffer(mesh->tangents, mesh->vertexCount*4*sizeof(float), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, 4, RL_FLOAT, 0, 0, 0);
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT] = LoadMeshVertexBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, mesh->tangents, dynamic);
         rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
     }
     else
@@ -1366,8 +2463,7 @@ void rl_UploadMesh(rl_Mesh *mesh, bool dynamic)
     if (mesh->texcoords2 != NULL)
     {
         // Enable vertex attribute: texcoord2 (shader-location = 5)
-        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2] = rlLoadVertexBuffer(mesh->texcoords2, mesh->vertexCount*2*sizeof(float), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, 2, RL_FLOAT, 0, 0, 0);
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2] = LoadMeshVertexBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, mesh->texcoords2, dynamic);
         rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
     }
     else
@@ -1399,8 +2495,7 @@ void rl_UploadMesh(rl_Mesh *mesh, bool dynamic)
     if (mesh->boneWeights != NULL)
     {
         // Enable vertex attribute: boneWeights (shader-location = 8)
-        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS] = rlLoadVertexBuffer(mesh->boneWeights, mesh->vertexCount*4*sizeof(float), dynamic);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, 4, RL_FLOAT, 0, 0, 0);
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS] = LoadMeshVertexBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, mesh->boneWeights, dynamic);
         rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS);
     }
     else
@@ -1415,7 +2510,7 @@ void rl_UploadMesh(rl_Mesh *mesh, bool dynamic)
 
     if (mesh->indices != NULL)
     {
-        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), dynamic);
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] = rlLoadVertexBufferElement(mesh->indices, GetMeshIndexCount(*mesh)*sizeof(unsigned short), dynamic);
     }
 
     if (mesh->vaoId > 0) TRACELOG(LOG_INFO, "VAO: [ID %i] rl_Mesh uploaded successfully to VRAM (GPU)", mesh->vaoId);
@@ -1425,15 +2520,125 @@ void rl_UploadMesh(rl_Mesh *mesh, bool dynamic)
 #endif
 }
 
+// Set vertex attributes quantization for next uploaded meshes, reduces GPU memory and vertex bandwidth
+// NOTE: Quantized attributes are decoded by GPU (half floats and normalized integers), shaders inputs are not changed,
+// attributes are only quantized when precision is enough and mesh is not dynamic or animated on CPU
+void rl_SetMeshQuantization(unsigned int flags)
+{
+    meshQuantization = flags;
+}
+
+// Upload mesh vertex data into GPU with multiple buffers per vertex attribute (streamed mesh)
+// NOTE: First rl_UpdateMeshBuffer() on a frame moves attribute to next buffer of the ring, so updates never
+// write a buffer the GPU could still be reading from previous frames (no implicit synchronization),
+// useful for meshes deformed every frame on CPU (cloth, CPU skinning), indices and bones data are not streamed
+void rl_UploadMeshStreamed(rl_Mesh *mesh, int bufferCount)
+{
+    if (bufferCount > MAX_MESH_STREAM_BUFFERS) bufferCount = MAX_MESH_STREAM_BUFFERS;
+
+    rl_UploadMesh(mesh, true);
+
+    if ((bufferCount < 2) || (mesh->vboId == NULL) || (mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION] == 0)) return;
+
+    rl_MeshStream *stream = (rl_MeshStream *)RL_CALLOC(1, sizeof(rl_MeshStream));
+    stream->bufferCount = bufferCount;
+
+    for (int i = 0; i <= RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2; i++)
+    {
+        if (mesh->vboId[i] == 0) continue;
+
+        const void *data = NULL;
+        int dataSize = 0;
+
+        switch (i)
+        {
+            case RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION: data = (mesh->animVertices != NULL)? mesh->animVertices : mesh->vertices; break;
+            case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD: data = mesh->texcoords; break;
+            case RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL: data = (mesh->animNormals != NULL)? mesh->animNormals : mesh->normals; break;
+            case RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR: data = mesh->colors; dataSize = mesh->vertexCount*4*sizeof(unsigned char); break;
+            case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT: data = mesh->tangents; break;
+            case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2: data = mesh->texcoords2; break;
+            default: break;
+        }
+
+        void *bufferData = (void *)data;
+        if (i != RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR) bufferData = LoadMeshVertexBufferData(*mesh, i, data, &dataSize);
+
+        stream->dataSize[i] = dataSize;
+        stream->frame[i] = rl_GetFrameCount();
+        stream->vboIds[i][0] = mesh->vboId[i];
+        for (int b = 1; b < bufferCount; b++) stream->vboIds[i][b] = rlLoadVertexBuffer(bufferData, dataSize, true);
+
+        if (bufferData != data) RL_FREE(bufferData);
+    }
+
+    mesh->stream = stream;
+
+    TRACELOG(LOG_INFO, "VAO: [ID %i] rl_Mesh vertex buffers streamed (%i buffers per attribute)", mesh->vaoId, bufferCount);
+}
+
 // Update mesh vertex data in GPU for a specific buffer index
+// NOTE: Data must match buffer format, quantized buffers (see rl_SetMeshQuantization()) expect quantized data
 void rl_UpdateMeshBuffer(rl_Mesh mesh, int index, const void *data, int dataSize, int offset)
 {
+    rl_MeshStream *stream = mesh.stream;
+    unsigned int frame = rl_GetFrameCount();
+
+    // Streamed mesh: first update on frame moves attribute to next buffer
+    if ((stream != NULL) && (index >= 0) && (index < MAX_MESH_VERTEX_BUFFERS) &&
+        (stream->dataSize[index] > 0) && (stream->frame[index] != frame))
+    {
+        bool fullUpdate = ((offset == 0) && (dataSize >= stream->dataSize[index]));
+        bool rotate = true;
+
+#if !((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+        rotate = fullUpdate;    // Buffers copy not supported, partial updates are done in place
+#endif
+        if (rotate)
+        {
+            int previous = stream->current[index];
+            int next = (previous + 1)%stream->bufferCount;
+
+            // Partial update, data not updated is copied from previous buffer (copied on GPU, no synchronization)
+            if (!fullUpdate) rlCopyVertexBuffer(stream->vboIds[index][next], stream->vboIds[index][previous], 0, 0, stream->dataSize[index]);
+
+            stream->current[index] = next;
+            mesh.vboId[index] = stream->vboIds[index][next];
+
+            // Point mesh VAO attribute to new buffer, drawing without VAO binds mesh vboId directly
+            if (rlEnableVertexArray(mesh.vaoId))
+            {
+                rlEnableVertexBuffer(mesh.vboId[index]);
+                SetMeshVertexAttribute(mesh, index, index);
+                rlDisableVertexArray();
+            }
+        }
+
+        stream->frame[index] = frame;
+    }
+
     rlUpdateVertexBuffer(mesh.vboId[index], data, dataSize, offset);
 }
 
 // Draw a 3d mesh with material and transform
 void rl_DrawMesh(rl_Mesh mesh, rl_Material material, rl_Matrix transform)
 {
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    // Default shader materials write G-buffer inside rl_BeginDeferredMode()
+    material.shader = GetDeferredShader(material.shader);
+#endif
+
+    // Skip meshes outside current view or hidden in occlusion depth pyramid
+    if (IsMeshCulled(mesh, transform))
+    {
+        rlAddCulledMeshes(1);
+        return;
+    }
+
+    // Select mesh level of detail for current view, levels share mesh vertex data
+    int indexOffset = 0;
+    int indexCount = GetMeshDrawIndexCount(mesh, transform, &indexOffset);
+
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
     #define GL_VERTEX_ARRAY         0x8074
     #define GL_NORMAL_ARRAY         0x8075
@@ -1459,7 +2664,7 @@ void rl_DrawMesh(rl_Mesh mesh, rl_Material material, rl_Matrix transform)
                    material.maps[rl_MATERIAL_MAP_DIFFUSE].color.b,
                    material.maps[rl_MATERIAL_MAP_DIFFUSE].color.a);
 
-        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, mesh.indices);
+        if (mesh.indices != NULL) rlDrawVertexArrayElements(indexOffset, indexCount, mesh.indices);
         else rlDrawVertexArray(0, mesh.vertexCount);
     rlPopMatrix();
 
@@ -1531,14 +2736,11 @@ void rl_DrawMesh(rl_Mesh mesh, rl_Material material, rl_Matrix transform)
     matModelView = MatrixMultiply(matModel, matView);
 
     // Upload model normal matrix (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], GetNormalMatrix(matModel));
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
     // Upload Bone Transforms
-    if ((material.shader.locs[SHADER_LOC_BONE_MATRICES] != -1) && mesh.boneMatrices)
-    {
-        rlSetUniformMatrices(material.shader.locs[SHADER_LOC_BONE_MATRICES], mesh.boneMatrices, mesh.boneCount);
-    }
+    SetShaderBoneUniforms(material.shader, mesh);
 #endif
     //-----------------------------------------------------
 
@@ -1564,102 +2766,28 @@ void rl_DrawMesh(rl_Mesh mesh, rl_Material material, rl_Matrix transform)
     // WARNING: rl_UploadMesh() enables all vertex attributes available in mesh and sets default attribute values
     // for shader expected vertex attributes that are not provided by the mesh (i.e. colors)
     // This could be a dangerous approach because different meshes with different shaders can enable/disable some attributes
-    if (!rlEnableVertexArray(mesh.vaoId))
-    {
-        // Bind mesh VBO data: vertex position (shader-location = 0)
-        rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
+    if (!rlEnableVertexArray(mesh.vaoId)) EnableMeshVertexBuffers(mesh, material.shader);
 
-        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
-        rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
 
-        if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        // Calculate model-view-projection matrix (MVP)
+        rl_Matrix matModelViewProjection = MatrixIdentity();
+        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+        else
         {
-            // Bind mesh VBO data: vertex normals (shader-location = 2)
-            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
-        }
-
-        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_COLOR] != -1)
-        {
-            if (mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR] != 0)
-            {
-                rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR]);
-                rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, 0);
-                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
-            }
-            else
-            {
-                // Set default value for defined vertex attribute in shader but not provided by mesh
-                // WARNING: It could result in GPU undefined behaviour
-                float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-                rlSetVertexAttributeDefault(material.shader.locs[SHADER_LOC_VERTEX_COLOR], value, SHADER_ATTRIB_VEC4, 4);
-                rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
-            }
-        }
-
-        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
-        {
-            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
-        }
-
-        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
-        {
-            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02], 2, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
-        }
-
-#ifdef RL_SUPPORT_MESH_GPU_SKINNING
-        // Bind mesh VBO data: vertex bone ids (shader-location = 6, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_BONEIDS] != -1)
-        {
-            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS], 4, RL_UNSIGNED_BYTE, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS]);
-        }
-
-        // Bind mesh VBO data: vertex bone weights (shader-location = 7, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1)
-        {
-            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], 4, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
-        }
-#endif
-
-        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
-    }
-
-    int eyeCount = 1;
-    if (rlIsStereoRenderEnabled()) eyeCount = 2;
-
-    for (int eye = 0; eye < eyeCount; eye++)
-    {
-        // Calculate model-view-projection matrix (MVP)
-        rl_Matrix matModelViewProjection = MatrixIdentity();
-        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
-        else
-        {
-            // Setup current eye viewport (half screen width)
-            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
-            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+            // Setup current eye viewport (half screen width)
+            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
         }
 
         // Send combined model-view-projection matrix to shader
         rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
         // Draw mesh
-        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
+        if (mesh.indices != NULL) rlDrawVertexArrayElements(indexOffset, indexCount, 0);
         else rlDrawVertexArray(0, mesh.vertexCount);
     }
 
@@ -1697,253 +2825,471 @@ void rl_DrawMesh(rl_Mesh mesh, rl_Material material, rl_Matrix transform)
 void rl_DrawMeshInstanced(rl_Mesh mesh, rl_Material material, const rl_Matrix *transforms, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Instancing required variables
-    rl_float16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
-
-    // Bind shader program
-    rlEnableShader(material.shader.id);
-
-    // Send required data to shader (matrices, values)
-    //-----------------------------------------------------
-    // Upload to shader material.colDiffuse
-    if (material.shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1)
-    {
-        float values[4] = {
-            (float)material.maps[rl_MATERIAL_MAP_DIFFUSE].color.r/255.0f,
-            (float)material.maps[rl_MATERIAL_MAP_DIFFUSE].color.g/255.0f,
-            (float)material.maps[rl_MATERIAL_MAP_DIFFUSE].color.b/255.0f,
-            (float)material.maps[rl_MATERIAL_MAP_DIFFUSE].color.a/255.0f
-        };
-
-        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
-    }
-
-    // Upload to shader material.colSpecular (if location available)
-    if (material.shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1)
-    {
-        float values[4] = {
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.r/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.g/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.b/255.0f,
-            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.a/255.0f
-        };
-
-        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
-    }
-
-    // Get a copy of current matrices to work with,
-    // just in case stereo render is required, and we need to modify them
-    // NOTE: At this point the modelview matrix just contains the view matrix (camera)
-    // That's because rl_BeginMode3D() sets it and there is no model-drawing function
-    // that modifies it, all use rlPushMatrix() and rlPopMatrix()
-    rl_Matrix matModel = MatrixIdentity();
-    rl_Matrix matView = rlGetMatrixModelview();
-    rl_Matrix matModelView = MatrixIdentity();
-    rl_Matrix matProjection = rlGetMatrixProjection();
-
-    // Upload view and projection matrices (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
-    if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
-
     // Create instances buffer
-    instanceTransforms = (rl_float16 *)RL_MALLOC(instances*sizeof(rl_float16));
+    // NOTE: Buffer is temporary, allocated from frame arena and released on return
+    MemoryFrameMark mark = GetMemoryFrameMark();
+    rl_float16 *instanceTransforms = (rl_float16 *)rl_MemFrameAlloc(instances*sizeof(rl_float16));
 
     // Fill buffer with instances transformations as rl_float16 arrays
     for (int i = 0; i < instances; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
 
-    // Enable mesh VAO to attach new buffer
-    rlEnableVertexArray(mesh.vaoId);
-
     // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData()
     // It isn't clear which would be reliably faster in all cases and on all platforms,
     // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
     // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(rl_float16), false);
+    unsigned int instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(rl_float16), false);
 
-    // Instances transformation matrices are sent to shader attribute location: SHADER_LOC_VERTEX_INSTANCE_TX
-    for (unsigned int i = 0; i < 4; i++)
-    {
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_INSTANCE_TX] + i);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_INSTANCE_TX] + i, 4, RL_FLOAT, 0, sizeof(rl_Matrix), i*sizeof(rl_Vector4));
-        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_VERTEX_INSTANCE_TX] + i, 1);
-    }
+    DrawMeshInstancesBuffer(mesh, material, instancesVboId, instances, 0, 0, 0);
 
-    rlDisableVertexBuffer();
-    rlDisableVertexArray();
+    // Remove instance transforms buffer
+    rlUnloadVertexBuffer(instancesVboId);
+    ReleaseMemoryFrame(mark);
+#endif
+}
 
-    // Accumulate internal matrix transform (push/pop) and view matrix
-    // NOTE: In this case, model instance transformation must be computed in the shader
-    matModelView = MatrixMultiply(rlGetMatrixTransform(), matView);
+// Draw multiple skinned mesh instances with material, different transforms and bone palettes
+// NOTE: Instances palette indices are optional (instance i uses palette i if NULL), shader is expected to
+// fetch bone matrices from sampler2D "bonePalette" at texel (boneId*4 + column, int(instancePalette))
+void rl_DrawMeshInstancedSkinned(rl_Mesh mesh, rl_Material material, const rl_Matrix *transforms, const int *paletteIds, int instances, rl_BonePalette palette)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((palette.id == 0) || (instances <= 0)) return;
 
-    // Upload model normal matrix (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+    MemoryFrameMark mark = GetMemoryFrameMark();
+    rl_float16 *instanceTransforms = (rl_float16 *)rl_MemFrameAlloc(instances*sizeof(rl_float16));
+    float *instancePalettes = (float *)rl_MemFrameAlloc(instances*sizeof(float));
 
-#ifdef RL_SUPPORT_MESH_GPU_SKINNING
-    // Upload Bone Transforms
-    if ((material.shader.locs[SHADER_LOC_BONE_MATRICES] != -1) && mesh.boneMatrices)
+    for (int i = 0; i < instances; i++)
     {
-        rlSetUniformMatrices(material.shader.locs[SHADER_LOC_BONE_MATRICES], mesh.boneMatrices, mesh.boneCount);
+        instanceTransforms[i] = MatrixToFloatV(transforms[i]);
+        instancePalettes[i] = (float)((paletteIds != NULL)? paletteIds[i] : i%palette.paletteCount);
     }
+
+    unsigned int instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(rl_float16), false);
+    unsigned int palettesVboId = rlLoadVertexBuffer(instancePalettes, instances*sizeof(float), false);
+
+    DrawMeshInstancesBuffer(mesh, material, instancesVboId, instances, 0, palette.id, palettesVboId);
+
+    rlUnloadVertexBuffer(palettesVboId);
+    rlUnloadVertexBuffer(instancesVboId);
+    ReleaseMemoryFrame(mark);
 #endif
+}
 
-    //-----------------------------------------------------
+// Load instance buffer, instances transforms stored in GPU memory and reused across frames
+// NOTE: If transforms is NULL, buffer is allocated but not initialized
+rl_InstanceBuffer rl_LoadInstanceBuffer(const rl_Matrix *transforms, int count, bool dynamic)
+{
+    rl_InstanceBuffer buffer = { 0 };
 
-    // Bind active texture maps (if available)
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-    {
-        if (material.maps[i].texture.id > 0)
-        {
-            // Select current shader texture slot
-            rlActiveTextureSlot(i);
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (count <= 0) return buffer;
 
-            // Enable texture for active slot
-            if ((i == MATERIAL_MAP_IRRADIANCE) ||
-                (i == MATERIAL_MAP_PREFILTER) ||
-                (i == MATERIAL_MAP_CUBEMAP)) rlEnableTextureCubemap(material.maps[i].texture.id);
-            else rlEnableTexture(material.maps[i].texture.id);
+    buffer.vboId = rlLoadVertexBuffer(NULL, count*sizeof(rl_float16), dynamic);
 
-            rlSetUniform(material.shader.locs[rl_SHADER_LOC_MAP_DIFFUSE + i], &i, SHADER_UNIFORM_INT, 1);
-        }
+    if (buffer.vboId > 0)
+    {
+        buffer.count = count;
+        if (transforms != NULL) rl_UpdateInstanceBuffer(buffer, transforms, 0, count);
+
+        TRACELOG(LOG_INFO, "MESH: [ID %i] Instance buffer loaded successfully (%i instances)", buffer.vboId, count);
     }
+    else TRACELOG(LOG_WARNING, "MESH: Failed to load instance buffer");
+#endif
 
-    // Try binding vertex array objects (VAO)
-    // or use VBOs if not possible
-    if (!rlEnableVertexArray(mesh.vaoId))
+    return buffer;
+}
+
+// Update instance buffer transforms (range)
+// NOTE: Transforms are converted in chunks on stack memory, no allocations required
+void rl_UpdateInstanceBuffer(rl_InstanceBuffer buffer, const rl_Matrix *transforms, int offset, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((buffer.vboId == 0) || (offset < 0) || (count <= 0) || ((offset + count) > buffer.count))
     {
-        // Bind mesh VBO data: vertex position (shader-location = 0)
-        rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
+        TRACELOG(LOG_WARNING, "MESH: Failed to update instance buffer, range out of bounds");
+        return;
+    }
 
-        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
-        rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD]);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01], 2, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+    rl_float16 chunk[64] = { 0 };
 
-        if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
-        {
-            // Bind mesh VBO data: vertex normals (shader-location = 2)
-            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL], 3, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
-        }
+    for (int i = 0; i < count; i += 64)
+    {
+        int chunkCount = ((count - i) < 64)? (count - i) : 64;
 
-        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_COLOR] != -1)
-        {
-            if (mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR] != 0)
-            {
-                rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR]);
-                rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, 0);
-                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
-            }
-            else
-            {
-                // Set default value for unused attribute
-                // NOTE: Required when using default shader and no VAO support
-                float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
-                rlSetVertexAttributeDefault(material.shader.locs[SHADER_LOC_VERTEX_COLOR], value, SHADER_ATTRIB_VEC4, 4);
-                rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
-            }
-        }
+        for (int j = 0; j < chunkCount; j++) chunk[j] = MatrixToFloatV(transforms[i + j]);
 
-        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
-        {
-            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT], 4, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
-        }
+        rlUpdateVertexBuffer(buffer.vboId, chunk, chunkCount*sizeof(rl_float16), (offset + i)*sizeof(rl_float16));
+    }
+#endif
+}
 
-        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
-        {
-            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02], 2, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
-        }
+// Unload instance buffer from GPU memory
+void rl_UnloadInstanceBuffer(rl_InstanceBuffer buffer)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (buffer.vboId > 0)
+    {
+        rlUnloadVertexBuffer(buffer.vboId);
+        TRACELOG(LOG_INFO, "MESH: [ID %i] Instance buffer unloaded successfully", buffer.vboId);
+    }
+#endif
+}
 
-#ifdef RL_SUPPORT_MESH_GPU_SKINNING
-        // Bind mesh VBO data: vertex bone ids (shader-location = 6, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_BONEIDS] != -1)
-        {
-            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS], 4, RL_UNSIGNED_BYTE, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS]);
-        }
+// Draw multiple mesh instances with material, transforms read from instance buffer
+// NOTE: Only the first instances of the buffer are drawn
+void rl_DrawMeshInstanceBuffer(rl_Mesh mesh, rl_Material material, rl_InstanceBuffer buffer, int instances)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (buffer.vboId == 0) return;
+    if (instances > buffer.count) instances = buffer.count;
 
-        // Bind mesh VBO data: vertex bone weights (shader-location = 7, if available)
-        if (material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1)
-        {
-            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS]);
-            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS], 4, RL_FLOAT, 0, 0, 0);
-            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
-        }
+    if (instances > 0) DrawMeshInstancesBuffer(mesh, material, buffer.vboId, instances, 0, 0, 0);
 #endif
+}
 
-        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
-    }
+// Load mesh instances transforms into GPU buffers, to be culled and drawn on GPU
+// NOTE: Transforms are uploaded once and kept in GPU memory (SSBO), requires OpenGL 4.3
+rl_MeshInstances rl_LoadMeshInstances(rl_Mesh mesh, const rl_Matrix *transforms, int count)
+{
+    rl_MeshInstances instances = { 0 };
 
-    int eyeCount = 1;
-    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (count <= 0) return instances;
 
-    for (int eye = 0; eye < eyeCount; eye++)
+    // Load culling compute shader, shared by all mesh instances
+    if (instancesCullShader.id == 0)
     {
-        // Calculate model-view-projection matrix (MVP)
-        rl_Matrix matModelViewProjection = MatrixIdentity();
-        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
-        else
-        {
-            // Setup current eye viewport (half screen width)
-            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
-            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
-        }
+        unsigned int shaderId = rlCompileShader(instancesCullShaderCode, RL_COMPUTE_SHADER);
+        instancesCullShader.id = rlLoadComputeShaderProgram(shaderId);
 
-        // Send combined model-view-projection matrix to shader
-        rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+        if (instancesCullShader.id == 0) return instances;
 
-        // Draw mesh instanced
-        if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
-        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
+        instancesCullShader.mvpLoc = rlGetLocationUniform(instancesCullShader.id, "mvp");
+        instancesCullShader.boundsLoc = rlGetLocationUniform(instancesCullShader.id, "bounds");
+        instancesCullShader.countLoc = rlGetLocationUniform(instancesCullShader.id, "instanceCount");
     }
 
-    // Unbind all bound texture maps
-    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
-    {
-        if (material.maps[i].texture.id > 0)
-        {
-            // Select current shader texture slot
-            rlActiveTextureSlot(i);
+    instancesCullShader.users++;
 
-            // Disable texture for active slot
-            if ((i == MATERIAL_MAP_IRRADIANCE) ||
-                (i == MATERIAL_MAP_PREFILTER) ||
-                (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
-            else rlDisableTexture();
-        }
+    // Compute mesh bounding sphere, tested against view frustum for every instance
+    rl_BoundingBox bounds = rl_GetMeshBoundingBox(mesh);
+    instances.boundsCenter = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+    instances.boundsRadius = Vector3Distance(bounds.max, instances.boundsCenter);
+
+    // Load instances transforms buffers
+    // NOTE: Visible transforms buffer is reused every frame, it is filled by the culling pass
+    rl_float16 *instanceTransforms = (rl_float16 *)RL_MALLOC(count*sizeof(rl_float16));
+    for (int i = 0; i < count; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
+
+    instances.count = count;
+    instances.transformsId = rlLoadShaderBuffer(count*sizeof(rl_float16), instanceTransforms, RL_STATIC_DRAW);
+    instances.visibleId = rlLoadShaderBuffer(count*sizeof(rl_float16), NULL, RL_DYNAMIC_COPY);
+    instances.commandId = rlLoadShaderBuffer(5*sizeof(unsigned int), NULL, RL_DYNAMIC_COPY);
+
+    RL_FREE(instanceTransforms);
+
+    TRACELOG(LOG_INFO, "MESH: Mesh instances loaded successfully (%i instances)", count);
+#else
+    TRACELOG(LOG_WARNING, "MESH: Mesh instances GPU culling requires OpenGL 4.3");
+#endif
+
+    return instances;
+}
+
+// Update mesh instances transforms (range)
+void rl_UpdateMeshInstances(rl_MeshInstances instances, const rl_Matrix *transforms, int offset, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if ((offset < 0) || (count <= 0) || ((offset + count) > instances.count))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to update mesh instances, range out of bounds");
+        return;
     }
 
-    // Disable all possible vertex array objects (or VBOs)
-    rlDisableVertexArray();
-    rlDisableVertexBuffer();
-    rlDisableVertexBufferElement();
+    MemoryFrameMark mark = GetMemoryFrameMark();
+    rl_float16 *instanceTransforms = (rl_float16 *)rl_MemFrameAlloc(count*sizeof(rl_float16));
+    for (int i = 0; i < count; i++) instanceTransforms[i] = MatrixToFloatV(transforms[i]);
 
-    // Disable shader program
+    rlUpdateShaderBuffer(instances.transformsId, instanceTransforms, count*sizeof(rl_float16), offset*sizeof(rl_float16));
+
+    ReleaseMemoryFrame(mark);
+#endif
+}
+
+// Unload mesh instances from GPU memory
+void rl_UnloadMeshInstances(rl_MeshInstances instances)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if (instances.transformsId == 0) return;
+
+    rlUnloadShaderBuffer(instances.transformsId);
+    rlUnloadShaderBuffer(instances.visibleId);
+    rlUnloadShaderBuffer(instances.commandId);
+
+    // Unload culling compute shader once no mesh instances use it
+    instancesCullShader.users--;
+    if ((instancesCullShader.users <= 0) && (instancesCullShader.id > 0))
+    {
+        rlUnloadShaderProgram(instancesCullShader.id);
+        instancesCullShader.id = 0;
+        instancesCullShader.users = 0;
+    }
+#endif
+}
+
+// Draw mesh instances visible in current view
+// NOTE: A compute pass culls instances bounding spheres against the view frustum and writes
+// visible transforms and instances count to GPU buffers, drawing is done with an indirect command
+void rl_DrawMeshInstancesCulled(rl_Mesh mesh, rl_Material material, rl_MeshInstances instances)
+{
+#if defined(GRAPHICS_API_OPENGL_43)
+    if ((instances.transformsId == 0) || (instancesCullShader.id == 0)) return;
+
+    // Reset indirect draw command, instances count is increased by the culling pass
+    // NOTE: Non-indexed meshes use the 4 first values: count, instanceCount, first, baseInstance
+    unsigned int command[5] = { (mesh.indices != NULL)? (unsigned int)mesh.triangleCount*3 : (unsigned int)mesh.vertexCount, 0, 0, 0, 0 };
+    rlUpdateShaderBuffer(instances.commandId, command, sizeof(command), 0);
+
+    // Culling is done with main view, combined with internal transform (push/pop)
+    // NOTE: Stereo rendering eyes share the main view frustum
+    rl_Matrix matModelViewProjection = MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection());
+    float bounds[4] = { instances.boundsCenter.x, instances.boundsCenter.y, instances.boundsCenter.z, instances.boundsRadius };
+    unsigned int count = (unsigned int)instances.count;
+
+    rlEnableShader(instancesCullShader.id);
+    rlSetUniformMatrix(instancesCullShader.mvpLoc, matModelViewProjection);
+    rlSetUniform(instancesCullShader.boundsLoc, bounds, RL_SHADER_UNIFORM_VEC4, 1);
+    rlSetUniform(instancesCullShader.countLoc, &count, RL_SHADER_UNIFORM_UINT, 1);
+
+    rlBindShaderBuffer(instances.transformsId, 0);
+    rlBindShaderBuffer(instances.visibleId, 1);
+    rlBindShaderBuffer(instances.commandId, 2);
+
+    rlComputeShaderDispatch((count + 63)/64, 1, 1);
     rlDisableShader();
 
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
+    // Make culling results visible as vertex attributes and draw command
+    rlComputeShaderBarrier();
+
+    DrawMeshInstancesBuffer(mesh, material, instances.visibleId, instances.count, instances.commandId, 0, 0);
 #endif
 }
 
+// Load static batch, meshes added are merged by material and spatial chunk
+// NOTE: Merged meshes are culled per chunk by rl_DrawMesh() (frustum and occlusion culling),
+// a chunk size of 0.0f merges all meshes sharing a material
+rl_StaticBatch *rl_LoadStaticBatch(float chunkSize)
+{
+    rl_StaticBatch *batch = (rl_StaticBatch *)RL_CALLOC(1, sizeof(rl_StaticBatch));
+    batch->chunkSize = (chunkSize > 0.0f)? chunkSize : 0.0f;
+
+    return batch;
+}
+
+// Add mesh to static batch, vertex data is copied and transformed (world space), returns piece index
+// NOTE: Materials are referenced (maps and shader), they must be valid while the batch is drawn,
+// animated meshes and meshes with more than 65536 vertices are not supported and return -1
+int rl_AddStaticBatchMesh(rl_StaticBatch *batch, rl_Mesh mesh, rl_Material material, rl_Matrix transform)
+{
+    if (batch == NULL) return -1;
+
+    if (batch->built)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Static batch already built, no more meshes can be added");
+        return -1;
+    }
+
+    if ((mesh.vertices == NULL) || (mesh.vertexCount == 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Static batch mesh has no vertex data available on CPU");
+        return -1;
+    }
+
+    if ((mesh.boneCount > 0) || (mesh.vertexCount > MAX_STATIC_BATCH_MESH_VERTICES))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Static batch mesh not supported (animated or more than %i vertices)", MAX_STATIC_BATCH_MESH_VERTICES);
+        return -1;
+    }
+
+    int materialIndex = FindMaterialIndex(&batch->materials, &batch->materialCount, material);
+
+    // Spatial chunk from transformed mesh bounds center
+    int chunk[3] = { 0 };
+
+    if (batch->chunkSize > 0.0f)
+    {
+        rl_BoundingBox bounds = rl_GetMeshBoundingBox(mesh);
+        rl_Vector3 center = Vector3Transform(Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f), transform);
+
+        chunk[0] = (int)floorf(center.x/batch->chunkSize);
+        chunk[1] = (int)floorf(center.y/batch->chunkSize);
+        chunk[2] = (int)floorf(center.z/batch->chunkSize);
+    }
+
+    // Find merged mesh for material and chunk with enough vertices available, indices are 16 bit
+    int meshIndex = -1;
+
+    for (int i = batch->meshCount - 1; i >= 0; i--)
+    {
+        StaticBatchMesh *target = &batch->meshes[i];
+
+        if ((target->materialIndex == materialIndex) && (target->chunk[0] == chunk[0]) && (target->chunk[1] == chunk[1]) &&
+            (target->chunk[2] == chunk[2]) && ((target->mesh.vertexCount + mesh.vertexCount) <= MAX_STATIC_BATCH_MESH_VERTICES))
+        {
+            meshIndex = i;
+            break;
+        }
+    }
+
+    if (meshIndex == -1)
+    {
+        batch->meshes = (StaticBatchMesh *)RL_REALLOC(batch->meshes, (batch->meshCount + 1)*sizeof(StaticBatchMesh));
+        meshIndex = batch->meshCount;
+        batch->meshCount++;
+
+        StaticBatchMesh *target = &batch->meshes[meshIndex];
+        memset(target, 0, sizeof(StaticBatchMesh));
+        target->materialIndex = materialIndex;
+        for (int k = 0; k < 3; k++) target->chunk[k] = chunk[k];
+    }
+
+    batch->pieces = (StaticBatchPiece *)RL_REALLOC(batch->pieces, (batch->pieceCount + 1)*sizeof(StaticBatchPiece));
+    StaticBatchPiece *piece = &batch->pieces[batch->pieceCount];
+
+    piece->meshIndex = meshIndex;
+    piece->visible = true;
+    AppendStaticBatchMesh(&batch->meshes[meshIndex], mesh, transform, piece);
+
+    batch->pieceCount++;
+
+    return batch->pieceCount - 1;
+}
+
+// Add model meshes to static batch, returns first piece index (one piece per model mesh)
+// NOTE: rl_Model transform is applied before provided transform
+int rl_AddStaticBatchModel(rl_StaticBatch *batch, rl_Model model, rl_Matrix transform)
+{
+    int firstPiece = -1;
+    rl_Matrix matModel = MatrixMultiply(model.transform, transform);
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        int piece = rl_AddStaticBatchMesh(batch, model.meshes[i], model.materials[model.meshMaterial[i]], matModel);
+        if (firstPiece == -1) firstPiece = piece;
+    }
+
+    return firstPiece;
+}
+
+// Build static batch, merged meshes are uploaded to GPU
+void rl_BuildStaticBatch(rl_StaticBatch *batch)
+{
+    if ((batch == NULL) || batch->built) return;
+
+    for (int i = 0; i < batch->meshCount; i++)
+    {
+        rl_Mesh *mesh = &batch->meshes[i].mesh;
+        int vertexCount = mesh->vertexCount;
+
+        // Shrink merged data to actual size
+        mesh->vertices = (float *)RL_REALLOC(mesh->vertices, vertexCount*3*sizeof(float));
+        if (mesh->texcoords != NULL) mesh->texcoords = (float *)RL_REALLOC(mesh->texcoords, vertexCount*2*sizeof(float));
+        if (mesh->texcoords2 != NULL) mesh->texcoords2 = (float *)RL_REALLOC(mesh->texcoords2, vertexCount*2*sizeof(float));
+        if (mesh->normals != NULL) mesh->normals = (float *)RL_REALLOC(mesh->normals, vertexCount*3*sizeof(float));
+        if (mesh->tangents != NULL) mesh->tangents = (float *)RL_REALLOC(mesh->tangents, vertexCount*4*sizeof(float));
+        if (mesh->colors != NULL) mesh->colors = (unsigned char *)RL_REALLOC(mesh->colors, vertexCount*4*sizeof(unsigned char));
+        mesh->indices = (unsigned short *)RL_REALLOC(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short));
+
+        batch->meshes[i].vertexCapacity = vertexCount;
+        batch->meshes[i].indexCapacity = mesh->triangleCount*3;
+
+        rl_UploadMesh(mesh, false);
+    }
+
+    batch->built = true;
+
+    TRACELOG(LOG_INFO, "MESH: Static batch built: %i pieces merged into %i meshes (%i materials)", batch->pieceCount, batch->meshCount, batch->materialCount);
+}
+
+// Set static batch piece visibility, hidden pieces triangles are degenerated in merged mesh indices
+void rl_SetStaticBatchPieceVisible(rl_StaticBatch *batch, int piece, bool visible)
+{
+    if ((batch == NULL) || (piece < 0) || (piece >= batch->pieceCount)) return;
+
+    StaticBatchPiece *batchPiece = &batch->pieces[piece];
+    if (batchPiece->visible == visible) return;
+
+    StaticBatchMesh *target = &batch->meshes[batchPiece->meshIndex];
+    unsigned short *indices = target->mesh.indices + batchPiece->indexOffset;
+
+    if (target->sourceIndices == NULL)
+    {
+        target->sourceIndices = (unsigned short *)RL_MALLOC(target->indexCapacity*sizeof(unsigned short));
+        memcpy(target->sourceIndices, target->mesh.indices, target->indexCapacity*sizeof(unsigned short));
+    }
+
+    if (visible) memcpy(indices, target->sourceIndices + batchPiece->indexOffset, batchPiece->indexCount*sizeof(unsigned short));
+    else for (int i = 0; i < batchPiece->indexCount; i++) indices[i] = (unsigned short)batchPiece->vertexOffset;
+
+    if ((target->mesh.vboId != NULL) && (target->mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] > 0))
+    {
+        rlUpdateVertexBufferElements(target->mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES], indices,
+            batchPiece->indexCount*sizeof(unsigned short), batchPiece->indexOffset*sizeof(unsigned short));
+    }
+
+    batchPiece->visible = visible;
+}
+
+// Draw static batch merged meshes, one draw call per visible chunk and material
+void rl_DrawStaticBatch(rl_StaticBatch *batch)
+{
+    if ((batch == NULL) || !batch->built) return;
+
+    for (int i = 0; i < batch->meshCount; i++)
+    {
+        rl_DrawMesh(batch->meshes[i].mesh, batch->materials[batch->meshes[i].materialIndex], MatrixIdentity());
+    }
+}
+
+// Unload static batch merged meshes from memory (RAM and VRAM)
+// NOTE: Batch materials are referenced, they are not unloaded
+void rl_UnloadStaticBatch(rl_StaticBatch *batch)
+{
+    if (batch == NULL) return;
+
+    for (int i = 0; i < batch->meshCount; i++)
+    {
+        rl_UnloadMesh(batch->meshes[i].mesh);
+        RL_FREE(batch->meshes[i].sourceIndices);
+    }
+
+    RL_FREE(batch->meshes);
+    RL_FREE(batch->materials);
+    RL_FREE(batch->pieces);
+    RL_FREE(batch);
+}
+
 // Unload mesh from memory (RAM and VRAM)
 void rl_UnloadMesh(rl_Mesh mesh)
 {
     // Unload rlgl mesh vboId data
     rlUnloadVertexArray(mesh.vaoId);
 
+    if (mesh.stream != NULL)
+    {
+        // Streamed attributes buffers, current buffer included
+        for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++)
+        {
+            if (mesh.stream->dataSize[i] == 0) continue;
+
+            for (int b = 0; b < mesh.stream->bufferCount; b++) rlUnloadVertexBuffer(mesh.stream->vboIds[i][b]);
+            mesh.vboId[i] = 0;
+        }
+
+        RL_FREE(mesh.stream);
+    }
+
     if (mesh.vboId != NULL) for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh.vboId[i]);
     RL_FREE(mesh.vboId);
 
@@ -1960,6 +3306,9 @@ void rl_UnloadMesh(rl_Mesh mesh)
     RL_FREE(mesh.boneWeights);
     RL_FREE(mesh.boneIds);
     RL_FREE(mesh.boneMatrices);
+
+    rl_UnloadMeshBVH(&mesh);
+    rl_UnloadMeshLOD(&mesh);
 }
 
 // Export mesh data to file
@@ -2138,9 +3487,174 @@ bool rl_ExportMeshAsCode(rl_Mesh mesh, const char *fileName)
     return success;
 }
 
+// Export model (meshes, materials, textures and animations) as raylib model cache file (.rmdl)
+// NOTE: Data is stored in GPU-ready layout, textures data is retrieved from GPU (uncompressed formats only)
+bool rl_ExportModel(rl_Model model, const rl_ModelAnimation *animations, int animCount, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if ((model.meshCount <= 0) || (model.meshes == NULL)) return success;
+
+    ModelCacheBuffer buffer = { 0 };
+
+    // Get textures used by materials, shared textures are only stored once
+    // NOTE: Default texture and cubemaps are not stored
+    unsigned int *textureIds = (unsigned int *)RL_CALLOC(model.materialCount*MAX_MATERIAL_MAPS + 1, sizeof(unsigned int));
+    rl_Texture2D *textures = (rl_Texture2D *)RL_CALLOC(model.materialCount*MAX_MATERIAL_MAPS + 1, sizeof(rl_Texture2D));
+    ModelCacheMaterial *materials = (ModelCacheMaterial *)RL_CALLOC(model.materialCount + 1, sizeof(ModelCacheMaterial));
+    int textureCount = 0;
+
+    for (int i = 0; i < model.materialCount; i++)
+    {
+        memcpy(materials[i].params, model.materials[i].params, 4*sizeof(float));
+
+        for (int m = 0; m < MAX_MATERIAL_MAPS; m++)
+        {
+            rl_MaterialMap map = model.materials[i].maps[m];
+            materials[i].maps[m].color = map.color;
+            materials[i].maps[m].value = map.value;
+            materials[i].maps[m].textureId = -1;
+
+            if ((map.texture.id == 0) || (map.texture.id == rlGetTextureIdDefault()) ||
+                (m == MATERIAL_MAP_IRRADIANCE) || (m == MATERIAL_MAP_PREFILTER) || (m == MATERIAL_MAP_CUBEMAP)) continue;
+
+            int textureId = -1;
+            for (int t = 0; t < textureCount; t++) if (textureIds[t] == map.texture.id) { textureId = t; break; }
+
+            if (textureId == -1)
+            {
+                textureId = textureCount;
+                textureIds[textureCount] = map.texture.id;
+                textures[textureCount] = map.texture;
+                textureCount++;
+            }
+
+            materials[i].maps[m].textureId = textureId;
+        }
+    }
+
+    ModelCacheHeader header = { 0 };
+    memcpy(header.id, "rMDL", 4);
+    header.version = 1;
+    header.meshCount = model.meshCount;
+    header.materialCount = model.materialCount;
+    header.textureCount = textureCount;
+    header.boneCount = ((model.bones != NULL) && (model.bindPose != NULL))? model.boneCount : 0;
+    header.animCount = (animations != NULL)? animCount : 0;
+    WriteModelCacheData(&buffer, &header, sizeof(ModelCacheHeader));
+
+    // Write meshes data
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        rl_Mesh mesh = model.meshes[i];
+        ModelCacheMesh cacheMesh = { 0 };
+
+        cacheMesh.vertexCount = mesh.vertexCount;
+        cacheMesh.triangleCount = mesh.triangleCount;
+        cacheMesh.boneCount = mesh.boneCount;
+        cacheMesh.materialId = (model.meshMaterial != NULL)? model.meshMaterial[i] : 0;
+        if (mesh.vertices != NULL) cacheMesh.attributes |= MODEL_CACHE_VERTICES;
+        if (mesh.texcoords != NULL) cacheMesh.attributes |= MODEL_CACHE_TEXCOORDS;
+        if (mesh.texcoords2 != NULL) cacheMesh.attributes |= MODEL_CACHE_TEXCOORDS2;
+        if (mesh.normals != NULL) cacheMesh.attributes |= MODEL_CACHE_NORMALS;
+        if (mesh.tangents != NULL) cacheMesh.attributes |= MODEL_CACHE_TANGENTS;
+        if (mesh.colors != NULL) cacheMesh.attributes |= MODEL_CACHE_COLORS;
+        if (mesh.indices != NULL) cacheMesh.attributes |= MODEL_CACHE_INDICES;
+        if (mesh.boneIds != NULL) cacheMesh.attributes |= MODEL_CACHE_BONEIDS;
+        if (mesh.boneWeights != NULL) cacheMesh.attributes |= MODEL_CACHE_BONEWEIGHTS;
+        if ((mesh.lod != NULL) && (mesh.indices != NULL)) cacheMesh.lodCount = mesh.lod->levelCount;
+        WriteModelCacheData(&buffer, &cacheMesh, sizeof(ModelCacheMesh));
+
+        if (mesh.vertices != NULL) WriteModelCacheData(&buffer, mesh.vertices, mesh.vertexCount*3*sizeof(float));
+        if (mesh.texcoords != NULL) WriteModelCacheData(&buffer, mesh.texcoords, mesh.vertexCount*2*sizeof(float));
+        if (mesh.texcoords2 != NULL) WriteModelCacheData(&buffer, mesh.texcoords2, mesh.vertexCount*2*sizeof(float));
+        if (mesh.normals != NULL) WriteModelCacheData(&buffer, mesh.normals, mesh.vertexCount*3*sizeof(float));
+        if (mesh.tangents != NULL) WriteModelCacheData(&buffer, mesh.tangents, mesh.vertexCount*4*sizeof(float));
+        if (mesh.colors != NULL) WriteModelCacheData(&buffer, mesh.colors, mesh.vertexCount*4*sizeof(unsigned char));
+        if (mesh.indices != NULL) WriteModelCacheData(&buffer, mesh.indices, mesh.triangleCount*3*sizeof(unsigned short));
+        if (mesh.boneIds != NULL) WriteModelCacheData(&buffer, mesh.boneIds, mesh.vertexCount*4*sizeof(unsigned char));
+        if (mesh.boneWeights != NULL) WriteModelCacheData(&buffer, mesh.boneWeights, mesh.vertexCount*4*sizeof(float));
+
+        if (cacheMesh.lodCount > 0)
+        {
+            WriteModelCacheData(&buffer, mesh.lod->triangleCounts, cacheMesh.lodCount*sizeof(int));
+            WriteModelCacheData(&buffer, mesh.lod->errors, cacheMesh.lodCount*sizeof(float));
+            WriteModelCacheData(&buffer, mesh.indices + mesh.triangleCount*3, (GetMeshIndexCount(mesh) - mesh.triangleCount*3)*sizeof(unsigned short));
+        }
+    }
+
+    // Write materials and textures data
+    WriteModelCacheData(&buffer, materials, model.materialCount*sizeof(ModelCacheMaterial));
+
+    for (int i = 0; i < textureCount; i++)
+    {
+        rl_Image image = rl_LoadImageFromTexture(textures[i]);
+        ModelCacheTexture cacheTexture = { 0 };
+
+        if (image.data != NULL)
+        {
+            cacheTexture.width = image.width;
+            cacheTexture.height = image.height;
+            cacheTexture.format = image.format;
+            cacheTexture.dataSize = rl_GetPixelDataSize(image.width, image.height, image.format);
+        }
+
+        WriteModelCacheData(&buffer, &cacheTexture, sizeof(ModelCacheTexture));
+        if (cacheTexture.dataSize > 0) WriteModelCacheData(&buffer, image.data, cacheTexture.dataSize);
+
+        rl_UnloadImage(image);
+    }
+
+    // Write skeleton data, inverse bind matrices are computed if not available
+    if (header.boneCount > 0)
+    {
+        WriteModelCacheData(&buffer, model.bones, model.boneCount*sizeof(rl_BoneInfo));
+        WriteModelCacheData(&buffer, model.bindPose, model.boneCount*sizeof(rl_Transform));
+
+        if (model.bindInverse != NULL) WriteModelCacheData(&buffer, model.bindInverse, model.boneCount*sizeof(rl_Matrix));
+        else
+        {
+            rl_Matrix *bindInverse = (rl_Matrix *)RL_MALLOC(model.boneCount*sizeof(rl_Matrix));
+            for (int i = 0; i < model.boneCount; i++) bindInverse[i] = GetTransformMatrixInverse(model.bindPose[i]);
+            WriteModelCacheData(&buffer, bindInverse, model.boneCount*sizeof(rl_Matrix));
+            RL_FREE(bindInverse);
+        }
+    }
+
+    // Write animations data, frame poses are stored contiguous
+    for (int i = 0; i < header.animCount; i++)
+    {
+        ModelCacheAnimation cacheAnim = { 0 };
+        cacheAnim.boneCount = animations[i].boneCount;
+        cacheAnim.frameCount = animations[i].frameCount;
+        memcpy(cacheAnim.name, animations[i].name, sizeof(cacheAnim.name));
+        WriteModelCacheData(&buffer, &cacheAnim, sizeof(ModelCacheAnimation));
+
+        WriteModelCacheData(&buffer, animations[i].bones, cacheAnim.boneCount*sizeof(rl_BoneInfo));
+
+        rl_Transform *framePoses = (rl_Transform *)RL_MALLOC((size_t)cacheAnim.frameCount*cacheAnim.boneCount*sizeof(rl_Transform));
+        for (int f = 0; f < cacheAnim.frameCount; f++) memcpy(framePoses + f*cacheAnim.boneCount, animations[i].framePoses[f], cacheAnim.boneCount*sizeof(rl_Transform));
+        WriteModelCacheData(&buffer, framePoses, cacheAnim.frameCount*cacheAnim.boneCount*sizeof(rl_Transform));
+        RL_FREE(framePoses);
+    }
+
+    success = rl_SaveFileData(fileName, buffer.data, buffer.size);
+
+    RL_FREE(buffer.data);
+    RL_FREE(materials);
+    RL_FREE(textures);
+    RL_FREE(textureIds);
+#else
+    TRACELOG(LOG_WARNING, "MODEL: [%s] Model cache export not supported (SUPPORT_FILEFORMAT_RMDL)", fileName);
+#endif
+
+    return success;
+}
+
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
-// Process obj materials
-static void ProcessMaterialsOBJ(rl_Material *materials, tinyobj_material_t *mats, int materialCount)
+// Process obj materials, textures paths are relative to provided directory (NULL: working directory)
+static void ProcessMaterialsOBJ(rl_Material *materials, tinyobj_material_t *mats, int materialCount, const char *dirPath)
 {
     // Init model mats
     for (int m = 0; m < materialCount; m++)
@@ -2155,21 +3669,21 @@ static void ProcessMaterialsOBJ(rl_Material *materials, tinyobj_material_t *mats
         // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
         materials[m].maps[rl_MATERIAL_MAP_DIFFUSE].texture = (rl_Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-        if (mats[m].diffuse_texname != NULL) materials[m].maps[rl_MATERIAL_MAP_DIFFUSE].texture = rl_LoadTexture(mats[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+        if (mats[m].diffuse_texname != NULL) materials[m].maps[rl_MATERIAL_MAP_DIFFUSE].texture = LoadMaterialTextureFile(dirPath, mats[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
         else materials[m].maps[rl_MATERIAL_MAP_DIFFUSE].color = (rl_Color){ (unsigned char)(mats[m].diffuse[0]*255.0f), (unsigned char)(mats[m].diffuse[1]*255.0f), (unsigned char)(mats[m].diffuse[2]*255.0f), 255 }; //float diffuse[3];
         materials[m].maps[rl_MATERIAL_MAP_DIFFUSE].value = 0.0f;
 
-        if (mats[m].specular_texname != NULL) materials[m].maps[rl_MATERIAL_MAP_SPECULAR].texture = rl_LoadTexture(mats[m].specular_texname);  //char *specular_texname; // map_Ks
+        if (mats[m].specular_texname != NULL) materials[m].maps[rl_MATERIAL_MAP_SPECULAR].texture = LoadMaterialTextureFile(dirPath, mats[m].specular_texname);  //char *specular_texname; // map_Ks
         materials[m].maps[rl_MATERIAL_MAP_SPECULAR].color = (rl_Color){ (unsigned char)(mats[m].specular[0]*255.0f), (unsigned char)(mats[m].specular[1]*255.0f), (unsigned char)(mats[m].specular[2]*255.0f), 255 }; //float specular[3];
         materials[m].maps[rl_MATERIAL_MAP_SPECULAR].value = 0.0f;
 
-        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = rl_LoadTexture(mats[m].bump_texname);  //char *bump_texname; // map_bump, bump
+        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadMaterialTextureFile(dirPath, mats[m].bump_texname);  //char *bump_texname; // map_bump, bump
         materials[m].maps[MATERIAL_MAP_NORMAL].color = rl_WHITE;
         materials[m].maps[MATERIAL_MAP_NORMAL].value = mats[m].shininess;
 
         materials[m].maps[MATERIAL_MAP_EMISSION].color = (rl_Color){ (unsigned char)(mats[m].emission[0]*255.0f), (unsigned char)(mats[m].emission[1]*255.0f), (unsigned char)(mats[m].emission[2]*255.0f), 255 }; //float emission[3];
 
-        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = rl_LoadTexture(mats[m].displacement_texname);  //char *displacement_texname; // disp
+        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadMaterialTextureFile(dirPath, mats[m].displacement_texname);  //char *displacement_texname; // disp
     }
 }
 #endif
@@ -2191,7 +3705,7 @@ rl_Material *rl_LoadMaterials(const char *fileName, int *materialCount)
         if (result != TINYOBJ_SUCCESS) TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to parse materials file", fileName);
 
         materials = (rl_Material *)RL_MALLOC(count*sizeof(rl_Material));
-        ProcessMaterialsOBJ(materials, mats, count);
+        ProcessMaterialsOBJ(materials, mats, count, NULL);
 
         tinyobj_materials_free(mats, count);
     }
@@ -2248,7 +3762,7 @@ void rl_UnloadMaterial(rl_Material material)
     {
         for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
         {
-            if (material.maps[i].texture.id != rlGetTextureIdDefault()) rlUnloadTexture(material.maps[i].texture.id);
+            if (material.maps[i].texture.id != rlGetTextureIdDefault()) rl_UnloadTexture(material.maps[i].texture);
         }
     }
 
@@ -2284,6 +3798,9 @@ rl_ModelAnimation *rl_LoadModelAnimations(const char *fileName, int *animCount)
 #if defined(SUPPORT_FILEFORMAT_GLTF)
     if (rl_IsFileExtension(fileName, ".gltf;.glb")) animations = LoadModelAnimationsGLTF(fileName, animCount);
 #endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (rl_IsFileExtension(fileName, ".rmdl")) animations = LoadModelAnimationsRMDL(fileName, animCount);
+#endif
 
     return animations;
 }
@@ -2297,53 +3814,7 @@ void rl_UpdateModelAnimationBones(rl_Model model, rl_ModelAnimation anim, int fr
     {
         if (frame >= anim.frameCount) frame = frame%anim.frameCount;
 
-        // Get first mesh which have bones
-        int firstMeshWithBones = -1;
-
-        for (int i = 0; i < model.meshCount; i++)
-        {
-            if (model.meshes[i].boneMatrices)
-            {
-                if (firstMeshWithBones == -1)
-                {
-                    firstMeshWithBones = i;
-                    break;
-                }
-            }
-        }
-
-        if (firstMeshWithBones != -1)
-        {
-            // Update all bones and boneMatrices of first mesh with bones
-            for (int boneId = 0; boneId < anim.boneCount; boneId++)
-            {
-                rl_Transform *bindTransform = &model.bindPose[boneId];
-                rl_Matrix bindMatrix = MatrixMultiply(MatrixMultiply(
-                    MatrixScale(bindTransform->scale.x, bindTransform->scale.y, bindTransform->scale.z),
-                    QuaternionToMatrix(bindTransform->rotation)),
-                    MatrixTranslate(bindTransform->translation.x, bindTransform->translation.y, bindTransform->translation.z));
-
-                rl_Transform *targetTransform = &anim.framePoses[frame][boneId];
-                rl_Matrix targetMatrix = MatrixMultiply(MatrixMultiply(
-                    MatrixScale(targetTransform->scale.x, targetTransform->scale.y, targetTransform->scale.z),
-                    QuaternionToMatrix(targetTransform->rotation)),
-                    MatrixTranslate(targetTransform->translation.x, targetTransform->translation.y, targetTransform->translation.z));
-
-                model.meshes[firstMeshWithBones].boneMatrices[boneId] = MatrixMultiply(MatrixInvert(bindMatrix), targetMatrix);
-            }
-
-            // Update remaining meshes with bones
-            // NOTE: Using deep copy because shallow copy results in double free with 'rl_UnloadModel()'
-            for (int i = firstMeshWithBones + 1; i < model.meshCount; i++)
-            {
-                if (model.meshes[i].boneMatrices)
-                {
-                    memcpy(model.meshes[i].boneMatrices,
-                        model.meshes[firstMeshWithBones].boneMatrices,
-                        model.meshes[i].boneCount*sizeof(model.meshes[i].boneMatrices[0]));
-                }
-            }
-        }
+        UpdateModelBoneMatrices(model, anim.framePoses[frame], anim.boneCount);
     }
 }
 
@@ -2353,66 +3824,128 @@ void rl_UpdateModelAnimationBones(rl_Model model, rl_ModelAnimation anim, int fr
 void rl_UpdateModelAnimation(rl_Model model, rl_ModelAnimation anim, int frame)
 {
     rl_UpdateModelAnimationBones(model,anim,frame);
+    rl_UpdateModelSkinning(model);
+}
+
+// Sample animation pose at fractional frame
+// NOTE: Frame is wrapped (looping animation), bones transforms are interpolated between
+// the two nearest frames, pose must have space for anim.boneCount transforms
+void rl_SampleModelAnimation(rl_ModelAnimation anim, float frame, rl_Transform *pose)
+{
+    if ((pose == NULL) || (anim.frameCount <= 0) || (anim.framePoses == NULL)) return;
+
+    float time = fmodf(frame, (float)anim.frameCount);
+    if (time < 0.0f) time += (float)anim.frameCount;
+
+    int frame0 = (int)time;
+    if (frame0 >= anim.frameCount) frame0 = anim.frameCount - 1;
+    int frame1 = (frame0 + 1)%anim.frameCount;
+    float amount = time - (float)frame0;
+
+    const rl_Transform *pose0 = anim.framePoses[frame0];
+    const rl_Transform *pose1 = anim.framePoses[frame1];
+
+    for (int i = 0; i < anim.boneCount; i++)
+    {
+        pose[i].translation = Vector3Lerp(pose0[i].translation, pose1[i].translation, amount);
+        pose[i].rotation = QuaternionSlerp(pose0[i].rotation, pose1[i].rotation, amount);
+        pose[i].scale = Vector3Lerp(pose0[i].scale, pose1[i].scale, amount);
+    }
+}
+
+// Blend poses, weight 0.0f returns poseA and 1.0f returns poseB
+// NOTE: Optional boneWeights scale weight per bone for layered blending (i.e. upper body only),
+// result can point to poseA or poseB
+void rl_BlendModelPoses(const rl_Transform *poseA, const rl_Transform *poseB, int boneCount, float weight, const float *boneWeights, rl_Transform *result)
+{
+    if ((poseA == NULL) || (poseB == NULL) || (result == NULL)) return;
+
+    for (int i = 0; i < boneCount; i++)
+    {
+        float amount = (boneWeights != NULL)? weight*boneWeights[i] : weight;
+
+        result[i].translation = Vector3Lerp(poseA[i].translation, poseB[i].translation, amount);
+        result[i].rotation = QuaternionSlerp(poseA[i].rotation, poseB[i].rotation, amount);
+        result[i].scale = Vector3Lerp(poseA[i].scale, poseB[i].scale, amount);
+    }
+}
+
+// Update model mesh bone matrices from pose
+// NOTE: Pose must have model.boneCount transforms, use rl_UpdateModelSkinning() for CPU skinning
+void rl_UpdateModelPose(rl_Model model, const rl_Transform *pose)
+{
+    if (pose != NULL) UpdateModelBoneMatrices(model, pose, model.boneCount);
+}
 
+// Update model animated vertex data (positions and normals) from current mesh bone matrices
+// NOTE: Updated data is uploaded to GPU
+void rl_UpdateModelSkinning(rl_Model model)
+{
     for (int m = 0; m < model.meshCount; m++)
     {
         rl_Mesh mesh = model.meshes[m];
-        rl_Vector3 animVertex = { 0 };
-        rl_Vector3 animNormal = { 0 };
-        int boneId = 0;
-        int boneCounter = 0;
-        float boneWeight = 0.0;
-        bool updated = false; // Flag to check when anim vertex information is updated
-        const int vValues = mesh.vertexCount*3;
 
         // Skip if missing bone data, causes segfault without on some models
-        if ((mesh.boneWeights == NULL) || (mesh.boneIds == NULL)) continue;
-
-        for (int vCounter = 0; vCounter < vValues; vCounter += 3)
+        if ((mesh.boneWeights == NULL) || (mesh.boneIds == NULL) || (mesh.animVertices == NULL) || (mesh.boneMatrices == NULL) || (mesh.vertexCount <= 0)) continue;
+
+        // Normals processing
+        // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals),
+        // bones normal matrices (inverse transpose) are computed once per mesh
+        bool normals = (mesh.normals != NULL) && (mesh.animNormals != NULL);
+        rl_Matrix3x4 *normalMatrices = NULL;
+        float *dualQuats = NULL;
+
+#if defined(SUPPORT_MESH_DUAL_QUATERNION_SKINNING)
+        // Bones converted once per mesh, dual quaternions rotation also transforms normals
+        dualQuats = (float *)RL_MALLOC(mesh.boneCount*8*sizeof(float));
+        for (int i = 0; i < mesh.boneCount; i++) GetBoneDualQuaternion(mesh.boneMatrices[i], &dualQuats[i*8]);
+#else
+        if (normals)
         {
-            mesh.animVertices[vCounter] = 0;
-            mesh.animVertices[vCounter + 1] = 0;
-            mesh.animVertices[vCounter + 2] = 0;
-            if (mesh.animNormals != NULL)
-            {
-                mesh.animNormals[vCounter] = 0;
-                mesh.animNormals[vCounter + 1] = 0;
-                mesh.animNormals[vCounter + 2] = 0;
-            }
+            normalMatrices = (rl_Matrix3x4 *)RL_MALLOC(mesh.boneCount*sizeof(rl_Matrix3x4));
+            for (int i = 0; i < mesh.boneCount; i++) normalMatrices[i] = Matrix3x4Normal(Matrix3x4FromMatrix(mesh.boneMatrices[i]));
+        }
+#endif
 
-            // Iterates over 4 bones per vertex
-            for (int j = 0; j < 4; j++, boneCounter++)
-            {
-                boneWeight = mesh.boneWeights[boneCounter];
-                boneId = mesh.boneIds[boneCounter];
+        // Vertices are skinned in chunks split across worker threads
+        int chunkCount = (mesh.vertexCount + SKINNING_CHUNK_SIZE - 1)/SKINNING_CHUNK_SIZE;
 
-                // Early stop when no transformation will be applied
-                if (boneWeight == 0.0f) continue;
-                animVertex = (rl_Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                animVertex = Vector3Transform(animVertex,model.meshes[m].boneMatrices[boneId]);
-                mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                mesh.animVertices[vCounter+1] += animVertex.y*boneWeight;
-                mesh.animVertices[vCounter+2] += animVertex.z*boneWeight;
-                updated = true;
+        SkinningJob job = { 0 };
+        job.mesh = mesh;
+        job.normals = normals;
+        job.normalMatrices = normalMatrices;
+        job.dualQuats = dualQuats;
+        job.changedStart = (int *)RL_MALLOC(chunkCount*2*sizeof(int));
+        job.changedEnd = job.changedStart + chunkCount;
 
-                // Normals processing
-                // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                if ((mesh.normals != NULL) && (mesh.animNormals != NULL ))
-                {
-                    animNormal = (rl_Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                    animNormal = Vector3Transform(animNormal, MatrixTranspose(MatrixInvert(model.meshes[m].boneMatrices[boneId])));
-                    mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                    mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                    mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                }
-            }
+        WorkerJob workerJob = { 0 };
+        workerJob.process = ProcessSkinningRange;
+        workerJob.data = &job;
+        workerJob.count = mesh.vertexCount;
+        workerJob.chunkSize = SKINNING_CHUNK_SIZE;
+
+        RunWorkerJob(&workerJob);
+
+        // Upload only the changed vertices range
+        int first = mesh.vertexCount;
+        int last = 0;
+
+        for (int i = 0; i < chunkCount; i++)
+        {
+            if (job.changedStart[i] >= job.changedEnd[i]) continue;
+            if (job.changedStart[i] < first) first = job.changedStart[i];
+            if (job.changedEnd[i] > last) last = job.changedEnd[i];
         }
 
-        if (updated)
+        if ((first < last) && (mesh.vboId != NULL))
         {
-            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-            if (mesh.normals != NULL) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0); // Update vertex normals
+            rl_UpdateMeshBuffer(mesh, 0, mesh.animVertices + first*3, (int)((last - first)*3*sizeof(float)), (int)(first*3*sizeof(float))); // Update vertex position
+            if (normals) rl_UpdateMeshBuffer(mesh, 2, mesh.animNormals + first*3, (int)((last - first)*3*sizeof(float)), (int)(first*3*sizeof(float))); // Update vertex normals
         }
+
+        RL_FREE(job.changedStart);
+        RL_FREE(normalMatrices);
+        RL_FREE(dualQuats);
     }
 }
 
@@ -2450,25 +3983,328 @@ bool rl_IsModelAnimationValid(rl_Model model, rl_ModelAnimation anim)
     return result;
 }
 
-#if defined(SUPPORT_MESH_GENERATION)
-// Generate polygonal mesh
-rl_Mesh rl_GenMeshPoly(int sides, float radius)
+// Load bone palette, bone matrices of many skeleton instances stored in a float texture
+// NOTE: Every palette is a texture row, every bone matrix uses 4 texels (columns)
+rl_BonePalette rl_LoadBonePalette(int boneCount, int paletteCount)
 {
-    rl_Mesh mesh = { 0 };
-
-    if (sides < 3) return mesh; // Security check
+    rl_BonePalette palette = { 0 };
 
-    int vertexCount = sides*3;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((boneCount <= 0) || (paletteCount <= 0)) return palette;
 
-    // Vertices definition
-    rl_Vector3 *vertices = (rl_Vector3 *)RL_MALLOC(vertexCount*sizeof(rl_Vector3));
+    palette.id = rlLoadTexture(NULL, boneCount*4, paletteCount, RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
 
-    float d = 0.0f, dStep = 360.0f/sides;
-    for (int v = 0; v < vertexCount - 2; v += 3)
+    if (palette.id > 0)
     {
-        vertices[v] = (rl_Vector3){ 0.0f, 0.0f, 0.0f };
-        vertices[v + 1] = (rl_Vector3){ sinf(rl_DEG2RAD*d)*radius, 0.0f, cosf(rl_DEG2RAD*d)*radius };
-        vertices[v + 2] = (rl_Vector3){ sinf(rl_DEG2RAD*(d+dStep))*radius, 0.0f, cosf(rl_DEG2RAD*(d+dStep))*radius };
+        palette.boneCount = boneCount;
+        palette.paletteCount = paletteCount;
+
+        TRACELOG(LOG_INFO, "MODEL: [ID %i] Bone palette loaded successfully (%i bones, %i palettes)", palette.id, boneCount, paletteCount);
+    }
+    else TRACELOG(LOG_WARNING, "MODEL: Failed to load bone palette, float textures required");
+#endif
+
+    return palette;
+}
+
+// Update bone palette with bone matrices (i.e. mesh.boneMatrices)
+// NOTE: Matrices are converted in chunks on stack memory, no allocations required
+void rl_UpdateBonePalette(rl_BonePalette palette, int index, const rl_Matrix *boneMatrices)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((palette.id == 0) || (index < 0) || (index >= palette.paletteCount) || (boneMatrices == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Failed to update bone palette, index out of bounds");
+        return;
+    }
+
+    rl_float16 chunk[64] = { 0 };
+
+    for (int i = 0; i < palette.boneCount; i += 64)
+    {
+        int chunkCount = ((palette.boneCount - i) < 64)? (palette.boneCount - i) : 64;
+
+        for (int j = 0; j < chunkCount; j++) chunk[j] = MatrixToFloatV(boneMatrices[i + j]);
+
+        rlUpdateTexture(palette.id, i*4, index, chunkCount*4, 1, RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, chunk);
+    }
+#endif
+}
+
+// Update bone palette from model pose (i.e. sampled or blended animation pose)
+// NOTE: Bone matrices are computed directly into the palette, model meshes are not updated
+void rl_UpdateBonePalettePose(rl_BonePalette palette, int index, rl_Model model, const rl_Transform *pose)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((palette.id == 0) || (index < 0) || (index >= palette.paletteCount) || (pose == NULL) || (model.bindPose == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Failed to update bone palette, index out of bounds");
+        return;
+    }
+
+    int boneCount = (model.boneCount < palette.boneCount)? model.boneCount : palette.boneCount;
+    rl_float16 chunk[64] = { 0 };
+
+    for (int i = 0; i < boneCount; i += 64)
+    {
+        int chunkCount = ((boneCount - i) < 64)? (boneCount - i) : 64;
+
+        for (int j = 0; j < chunkCount; j++) chunk[j] = MatrixToFloatV(GetModelBoneMatrix(model, i + j, pose[i + j]));
+
+        rlUpdateTexture(palette.id, i*4, index, chunkCount*4, 1, RL_PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, chunk);
+    }
+#endif
+}
+
+// Unload bone palette from GPU memory
+void rl_UnloadBonePalette(rl_BonePalette palette)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (palette.id > 0)
+    {
+        rlUnloadTexture(palette.id);
+        TRACELOG(LOG_INFO, "MODEL: [ID %i] Bone palette unloaded successfully", palette.id);
+    }
+#endif
+}
+
+// Compress model animation, bones channels keys are reduced and quantized
+// NOTE: Frames interpolated from neighbour keys within tolerance are removed,
+// tolerance is measured in world units for translation and scale, radians for rotation
+rl_CompressedAnimation rl_CompressModelAnimation(rl_ModelAnimation anim, float tolerance)
+{
+    rl_CompressedAnimation result = { 0 };
+
+    if ((anim.boneCount <= 0) || (anim.frameCount <= 0) || (anim.framePoses == NULL)) return result;
+    if (anim.frameCount > 65535)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to compress animation, too many frames (%i)", anim.name, anim.frameCount);
+        return result;
+    }
+
+    int channelCount = anim.boneCount*3;
+    AnimationChannel *channels = (AnimationChannel *)RL_CALLOC(channelCount, sizeof(AnimationChannel));
+    int *keyFrames = (int *)RL_MALLOC(anim.frameCount*sizeof(int));
+
+    // Worst case, every frame is a key: frame index and 3 values per key
+    unsigned short *keys = (unsigned short *)RL_MALLOC((size_t)channelCount*anim.frameCount*4*sizeof(unsigned short));
+    unsigned int keysSize = 0;
+
+    for (int c = 0; c < channelCount; c++)
+    {
+        int boneId = c/3;
+        int channelType = c%3;
+        AnimationChannel *channel = &channels[c];
+
+        channel->keyCount = ReduceAnimationChannel(anim, boneId, channelType, tolerance, keyFrames);
+        channel->keyOffset = keysSize;
+
+        // Translation and scale values are quantized in the keys range
+        if (channelType != ANIMATION_CHANNEL_ROTATION)
+        {
+            rl_Quaternion min = GetAnimationChannelValue(anim, keyFrames[0], boneId, channelType);
+            rl_Quaternion max = min;
+
+            for (int k = 1; k < channel->keyCount; k++)
+            {
+                rl_Quaternion value = GetAnimationChannelValue(anim, keyFrames[k], boneId, channelType);
+
+                min.x = fminf(min.x, value.x); max.x = fmaxf(max.x, value.x);
+                min.y = fminf(min.y, value.y); max.y = fmaxf(max.y, value.y);
+                min.z = fminf(min.z, value.z); max.z = fmaxf(max.z, value.z);
+            }
+
+            channel->rangeMin[0] = min.x; channel->rangeSize[0] = max.x - min.x;
+            channel->rangeMin[1] = min.y; channel->rangeSize[1] = max.y - min.y;
+            channel->rangeMin[2] = min.z; channel->rangeSize[2] = max.z - min.z;
+        }
+
+        unsigned short *frames = keys + keysSize;
+        unsigned short *values = frames + channel->keyCount;
+
+        for (int k = 0; k < channel->keyCount; k++)
+        {
+            frames[k] = (unsigned short)keyFrames[k];
+            EncodeAnimationChannelValue(channel, channelType, GetAnimationChannelValue(anim, keyFrames[k], boneId, channelType), values + k*3);
+        }
+
+        keysSize += channel->keyCount*4;
+    }
+
+    result.boneCount = anim.boneCount;
+    result.frameCount = anim.frameCount;
+    result.dataSize = channelCount*(int)sizeof(AnimationChannel) + keysSize*(int)sizeof(unsigned short);
+    result.data = (unsigned char *)RL_MALLOC(result.dataSize);
+    memcpy(result.data, channels, channelCount*sizeof(AnimationChannel));
+    memcpy(result.data + channelCount*sizeof(AnimationChannel), keys, keysSize*sizeof(unsigned short));
+
+    if (anim.bones != NULL)
+    {
+        result.bones = (rl_BoneInfo *)RL_MALLOC(anim.boneCount*sizeof(rl_BoneInfo));
+        memcpy(result.bones, anim.bones, anim.boneCount*sizeof(rl_BoneInfo));
+    }
+
+    memcpy(result.name, anim.name, sizeof(result.name));
+
+    RL_FREE(keys);
+    RL_FREE(keyFrames);
+    RL_FREE(channels);
+
+    TRACELOG(LOG_INFO, "MODEL: [%s] Animation compressed successfully (%i KB -> %i KB)", anim.name,
+        (int)((size_t)anim.boneCount*anim.frameCount*sizeof(rl_Transform)/1024), result.dataSize/1024);
+
+    return result;
+}
+
+// Sample compressed animation pose at fractional frame
+// NOTE: Frame is wrapped (looping animation), pose must have space for anim.boneCount transforms
+void rl_SampleCompressedAnimation(rl_CompressedAnimation anim, float frame, rl_Transform *pose)
+{
+    if ((pose == NULL) || (anim.frameCount <= 0) || (anim.data == NULL)) return;
+
+    float time = fmodf(frame, (float)anim.frameCount);
+    if (time < 0.0f) time += (float)anim.frameCount;
+
+    const AnimationChannel *channels = (const AnimationChannel *)anim.data;
+    const unsigned short *keys = (const unsigned short *)(anim.data + anim.boneCount*3*sizeof(AnimationChannel));
+
+    for (int boneId = 0; boneId < anim.boneCount; boneId++)
+    {
+        for (int channelType = 0; channelType < 3; channelType++)
+        {
+            const AnimationChannel *channel = &channels[boneId*3 + channelType];
+            const unsigned short *frames = keys + channel->keyOffset;
+            const unsigned short *values = frames + channel->keyCount;
+
+            // Find last key not after time (binary search)
+            int key0 = 0;
+            int low = 0;
+            int high = channel->keyCount - 1;
+
+            while (low <= high)
+            {
+                int mid = (low + high)/2;
+
+                if ((float)frames[mid] <= time) { key0 = mid; low = mid + 1; }
+                else high = mid - 1;
+            }
+
+            // Last key interpolates to first one, looping animation
+            int key1 = (key0 + 1 < channel->keyCount)? key0 + 1 : 0;
+            float span = (key1 > key0)? (float)(frames[key1] - frames[key0]) : (float)(anim.frameCount - frames[key0]);
+            float amount = (time - (float)frames[key0])/span;
+
+            rl_Quaternion value = DecodeAnimationChannelValue(channel, channelType, values + key0*3);
+
+            if (key1 != key0)
+            {
+                rl_Quaternion next = DecodeAnimationChannelValue(channel, channelType, values + key1*3);
+                value = InterpolateAnimationChannelValue(channelType, value, next, amount);
+            }
+
+            if (channelType == ANIMATION_CHANNEL_TRANSLATION) pose[boneId].translation = CLITERAL(rl_Vector3){ value.x, value.y, value.z };
+            else if (channelType == ANIMATION_CHANNEL_ROTATION) pose[boneId].rotation = value;
+            else pose[boneId].scale = CLITERAL(rl_Vector3){ value.x, value.y, value.z };
+        }
+    }
+}
+
+// Unload compressed animation data
+void rl_UnloadCompressedAnimation(rl_CompressedAnimation anim)
+{
+    RL_FREE(anim.bones);
+    RL_FREE(anim.data);
+}
+
+// Load compressed animation from file, one clip per file
+// NOTE: Useful to stream animation clips from disk when required
+rl_CompressedAnimation rl_LoadCompressedAnimation(const char *fileName)
+{
+    rl_CompressedAnimation anim = { 0 };
+
+    int fileSize = 0;
+    unsigned char *fileData = rl_LoadFileData(fileName, &fileSize);
+
+    if (fileData == NULL) return anim;
+
+    CompressedAnimationHeader header = { 0 };
+    if (fileSize >= (int)sizeof(CompressedAnimationHeader)) memcpy(&header, fileData, sizeof(CompressedAnimationHeader));
+
+    if ((strncmp(header.id, "rCAN", 4) != 0) || (header.version != 1) || (header.boneCount <= 0) || (header.dataSize <= 0) ||
+        (fileSize != (int)(sizeof(CompressedAnimationHeader) + header.boneCount*sizeof(rl_BoneInfo)) + header.dataSize))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Compressed animation file not valid", fileName);
+    }
+    else
+    {
+        anim.boneCount = header.boneCount;
+        anim.frameCount = header.frameCount;
+        anim.dataSize = header.dataSize;
+        memcpy(anim.name, header.name, sizeof(anim.name));
+        anim.name[sizeof(anim.name) - 1] = '\0';
+
+        anim.bones = (rl_BoneInfo *)RL_MALLOC(anim.boneCount*sizeof(rl_BoneInfo));
+        memcpy(anim.bones, fileData + sizeof(CompressedAnimationHeader), anim.boneCount*sizeof(rl_BoneInfo));
+
+        anim.data = (unsigned char *)RL_MALLOC(anim.dataSize);
+        memcpy(anim.data, fileData + sizeof(CompressedAnimationHeader) + anim.boneCount*sizeof(rl_BoneInfo), anim.dataSize);
+
+        TRACELOG(LOG_INFO, "MODEL: [%s] Compressed animation loaded successfully (%i bones, %i frames)", fileName, anim.boneCount, anim.frameCount);
+    }
+
+    rl_UnloadFileData(fileData);
+
+    return anim;
+}
+
+// Export compressed animation to file
+bool rl_ExportCompressedAnimation(rl_CompressedAnimation anim, const char *fileName)
+{
+    bool success = false;
+
+    if ((anim.data == NULL) || (anim.bones == NULL)) return success;
+
+    CompressedAnimationHeader header = { 0 };
+    memcpy(header.id, "rCAN", 4);
+    header.version = 1;
+    header.boneCount = anim.boneCount;
+    header.frameCount = anim.frameCount;
+    header.dataSize = anim.dataSize;
+    memcpy(header.name, anim.name, sizeof(header.name));
+
+    int fileSize = (int)(sizeof(CompressedAnimationHeader) + anim.boneCount*sizeof(rl_BoneInfo)) + anim.dataSize;
+    unsigned char *fileData = (unsigned char *)RL_MALLOC(fileSize);
+
+    memcpy(fileData, &header, sizeof(CompressedAnimationHeader));
+    memcpy(fileData + sizeof(CompressedAnimationHeader), anim.bones, anim.boneCount*sizeof(rl_BoneInfo));
+    memcpy(fileData + sizeof(CompressedAnimationHeader) + anim.boneCount*sizeof(rl_BoneInfo), anim.data, anim.dataSize);
+
+    success = rl_SaveFileData(fileName, fileData, fileSize);
+
+    RL_FREE(fileData);
+
+    return success;
+}
+
+#if defined(SUPPORT_MESH_GENERATION)
+// Generate polygonal mesh
+rl_Mesh rl_GenMeshPoly(int sides, float radius)
+{
+    rl_Mesh mesh = { 0 };
+
+    if (sides < 3) return mesh; // Security check
+
+    int vertexCount = sides*3;
+
+    // Vertices definition
+    rl_Vector3 *vertices = (rl_Vector3 *)RL_MALLOC(vertexCount*sizeof(rl_Vector3));
+
+    float d = 0.0f, dStep = 360.0f/sides;
+    for (int v = 0; v < vertexCount - 2; v += 3)
+    {
+        vertices[v] = (rl_Vector3){ 0.0f, 0.0f, 0.0f };
+        vertices[v + 1] = (rl_Vector3){ sinf(rl_DEG2RAD*d)*radius, 0.0f, cosf(rl_DEG2RAD*d)*radius };
+        vertices[v + 2] = (rl_Vector3){ sinf(rl_DEG2RAD*(d+dStep))*radius, 0.0f, cosf(rl_DEG2RAD*(d+dStep))*radius };
         d += dStep;
     }
 
@@ -3595,700 +5431,6651 @@ rl_Mesh rl_GenMeshCubicmap(rl_Image cubicmap, rl_Vector3 cubeSize)
 }
 #endif      // SUPPORT_MESH_GENERATION
 
-// Compute mesh bounding box limits
-// NOTE: minVertex and maxVertex should be transformed by model transform matrix
-rl_BoundingBox rl_GetMeshBoundingBox(rl_Mesh mesh)
+// Load chunked terrain from heightmap image, size defines terrain extent (x, z) and maximum height (y)
+// NOTE: Heightmap is resampled to chunks grids, every chunk is loaded and uploaded to GPU
+rl_Terrain *rl_LoadTerrain(rl_Image heightmap, rl_Vector3 size)
 {
-    // Get min and max vertex to construct bounds (AABB)
-    rl_Vector3 minVertex = { 0 };
-    rl_Vector3 maxVertex = { 0 };
-
-    if (mesh.vertices != NULL)
+    if ((heightmap.data == NULL) || (heightmap.width < 2) || (heightmap.height < 2))
     {
-        minVertex = (rl_Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
-        maxVertex = (rl_Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        TRACELOG(LOG_WARNING, "TERRAIN: Failed to load terrain, heightmap image not valid");
+        return NULL;
+    }
 
-        for (int i = 1; i < mesh.vertexCount; i++)
+    rl_Terrain *terrain = (rl_Terrain *)RL_CALLOC(1, sizeof(rl_Terrain));
+
+    // One vertex per heightmap pixel, rounded up to complete chunks
+    terrain->chunksX = (heightmap.width - 1 + TERRAIN_CHUNK_QUADS - 1)/TERRAIN_CHUNK_QUADS;
+    terrain->chunksZ = (heightmap.height - 1 + TERRAIN_CHUNK_QUADS - 1)/TERRAIN_CHUNK_QUADS;
+    terrain->chunkSize = (rl_Vector3){ size.x/terrain->chunksX, size.y, size.z/terrain->chunksZ };
+    terrain->chunks = (TerrainChunk *)RL_CALLOC(terrain->chunksX*terrain->chunksZ, sizeof(TerrainChunk));
+
+    float *values = LoadTerrainImageHeights(heightmap);
+    const int samples = TERRAIN_CHUNK_QUADS + 1;
+
+    for (int cz = 0; cz < terrain->chunksZ; cz++)
+    {
+        for (int cx = 0; cx < terrain->chunksX; cx++)
         {
-            minVertex = Vector3Min(minVertex, (rl_Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
-            maxVertex = Vector3Max(maxVertex, (rl_Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+            TerrainChunk *chunk = &terrain->chunks[cz*terrain->chunksX + cx];
+            chunk->heights = (float *)RL_MALLOC(samples*samples*sizeof(float));
+
+            for (int z = 0; z < samples; z++)
+            {
+                for (int x = 0; x < samples; x++)
+                {
+                    float u = (float)(cx*TERRAIN_CHUNK_QUADS + x)/(terrain->chunksX*TERRAIN_CHUNK_QUADS);
+                    float v = (float)(cz*TERRAIN_CHUNK_QUADS + z)/(terrain->chunksZ*TERRAIN_CHUNK_QUADS);
+
+                    chunk->heights[z*samples + x] = SampleTerrainImage(values, heightmap.width, heightmap.height, u, v)*size.y;
+                }
+            }
         }
     }
 
-    // Create the bounding box
-    rl_BoundingBox box = { 0 };
-    box.min = minVertex;
-    box.max = maxVertex;
+    RL_FREE(values);
 
-    return box;
+    // Chunk meshes are built once all heights are available, border normals use neighbour chunks
+    for (int i = 0; i < terrain->chunksX*terrain->chunksZ; i++) LoadTerrainChunkMesh(terrain, i%terrain->chunksX, i/terrain->chunksX);
+
+    TRACELOG(LOG_INFO, "TERRAIN: Terrain loaded successfully (%i x %i chunks)", terrain->chunksX, terrain->chunksZ);
+
+    return terrain;
 }
 
-// Compute mesh tangents
-void rl_GenMeshTangents(rl_Mesh *mesh)
+// Load streamed terrain from height tiles files, one tile per chunk, loaded on demand by rl_UpdateTerrain()
+// NOTE: File name must contain two integer formats for tile x and z (i.e. "terrain_%02i_%02i.png"),
+// neighbour tiles must share their border pixels for a continuous terrain
+rl_Terrain *rl_LoadTerrainTiles(const char *fileName, int tilesX, int tilesZ, rl_Vector3 tileSize)
 {
-    // Check if input mesh data is useful
-    if ((mesh == NULL) || (mesh->vertices == NULL) || (mesh->texcoords == NULL) || (mesh->normals == NULL))
+    if ((fileName == NULL) || (tilesX <= 0) || (tilesZ <= 0))
     {
-        TRACELOG(LOG_WARNING, "MESH: Tangents generation requires vertices, texcoords and normals vertex attribute data");
-        return;
+        TRACELOG(LOG_WARNING, "TERRAIN: Failed to load terrain tiles, parameters not valid");
+        return NULL;
     }
 
-    // Allocate or reallocate tangents data
-    if (mesh->tangents == NULL) mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
-    else
-    {
-        RL_FREE(mesh->tangents);
-        mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
-    }
+    rl_Terrain *terrain = (rl_Terrain *)RL_CALLOC(1, sizeof(rl_Terrain));
 
-    // Allocate temporary arrays for tangents calculation
-    rl_Vector3 *tan1 = (rl_Vector3 *)RL_CALLOC(mesh->vertexCount, sizeof(rl_Vector3));
-    rl_Vector3 *tan2 = (rl_Vector3 *)RL_CALLOC(mesh->vertexCount, sizeof(rl_Vector3));
+    strncpy(terrain->fileName, fileName, MAX_FILEPATH_LENGTH - 1);
+    terrain->chunksX = tilesX;
+    terrain->chunksZ = tilesZ;
+    terrain->chunkSize = tileSize;
+    terrain->chunks = (TerrainChunk *)RL_CALLOC(tilesX*tilesZ, sizeof(TerrainChunk));
 
-    if (tan1 == NULL || tan2 == NULL)
-    {
-        TRACELOG(LOG_WARNING, "MESH: Failed to allocate temporary memory for tangent calculation");
-        if (tan1) RL_FREE(tan1);
-        if (tan2) RL_FREE(tan2);
-        return;
-    }
+    return terrain;
+}
+
+// Update terrain streaming, tiles in view distance are loaded (nearest first), far tiles are unloaded
+// NOTE: Up to TERRAIN_STREAM_LOADS_PER_UPDATE tiles are loaded per call to keep frame time stable
+void rl_UpdateTerrain(rl_Terrain *terrain, rl_Vector3 viewPosition, float viewDistance)
+{
+    if ((terrain == NULL) || (terrain->fileName[0] == '\0')) return;
 
-    // Process all triangles of the mesh
-    // 'triangleCount' must be always valid
-    for (int t = 0; t < mesh->triangleCount; t++)
+    for (int loads = 0; loads < TERRAIN_STREAM_LOADS_PER_UPDATE; loads++)
     {
-        // Get triangle vertex indices
-        int i0 = 0, i1 = 0, i2 = 0;
+        int nearest = -1;
+        float nearestDistance = viewDistance;
 
-        if (mesh->indices != NULL)
+        for (int i = 0; i < terrain->chunksX*terrain->chunksZ; i++)
         {
-            // Use indices if available
-            i0 = mesh->indices[t*3 + 0];
-            i1 = mesh->indices[t*3 + 1];
-            i2 = mesh->indices[t*3 + 2];
-        }
-        else
-        {
-            // Sequential access for non-indexed mesh
-            i0 = t*3 + 0;
-            i1 = t*3 + 1;
-            i2 = t*3 + 2;
-        }
+            float distance = GetTerrainChunkDistance(terrain, i%terrain->chunksX, i/terrain->chunksX, viewPosition);
 
-        // Get triangle vertices position
-        rl_Vector3 v1 = { mesh->vertices[i0*3 + 0], mesh->vertices[i0*3 + 1], mesh->vertices[i0*3 + 2] };
-        rl_Vector3 v2 = { mesh->vertices[i1*3 + 0], mesh->vertices[i1*3 + 1], mesh->vertices[i1*3 + 2] };
-        rl_Vector3 v3 = { mesh->vertices[i2*3 + 0], mesh->vertices[i2*3 + 1], mesh->vertices[i2*3 + 2] };
+            if (terrain->chunks[i].state == TERRAIN_CHUNK_LOADED)
+            {
+                // Unload far chunks, margin avoids reloading chunks at view distance border
+                if ((loads == 0) && (distance > viewDistance*TERRAIN_STREAM_UNLOAD_FACTOR)) UnloadTerrainChunk(&terrain->chunks[i]);
+            }
+            else if ((terrain->chunks[i].state == TERRAIN_CHUNK_UNLOADED) && (distance <= nearestDistance))
+            {
+                nearest = i;
+                nearestDistance = distance;
+            }
+        }
 
-        // Get triangle texcoords
-        rl_Vector2 uv1 = { mesh->texcoords[i0*2 + 0], mesh->texcoords[i0*2 + 1] };
-        rl_Vector2 uv2 = { mesh->texcoords[i1*2 + 0], mesh->texcoords[i1*2 + 1] };
-        rl_Vector2 uv3 = { mesh->texcoords[i2*2 + 0], mesh->texcoords[i2*2 + 1] };
+        if (nearest == -1) break;
 
-        // Calculate triangle edges
-        float x1 = v2.x - v1.x;
-        float y1 = v2.y - v1.y;
-        float z1 = v2.z - v1.z;
-        float x2 = v3.x - v1.x;
-        float y2 = v3.y - v1.y;
-        float z2 = v3.z - v1.z;
+        LoadTerrainChunkTile(terrain, nearest%terrain->chunksX, nearest/terrain->chunksX);
+    }
+}
 
-        // Calculate texture coordinate differences
-        float s1 = uv2.x - uv1.x;
-        float t1 = uv2.y - uv1.y;
-        float s2 = uv3.x - uv1.x;
-        float t2 = uv3.y - uv1.y;
+// Draw terrain chunks visible in current view, chunks levels of detail are selected by projected error
+void rl_DrawTerrain(rl_Terrain *terrain, rl_Material material)
+{
+    if (terrain == NULL) return;
 
-        // Calculate denominator and check for degenerate UV
-        float div = s1*t2 - s2*t1;
-        float r = (fabsf(div) < 0.0001f)? 0.0f : 1.0f/div;
+    rl_Matrix mvp = MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection());
+    rl_Frustum frustum = FrustumFromMatrix(mvp);
 
-        // Calculate tangent and bitangent directions
-        rl_Vector3 sdir = { (t2*x1 - t1*x2)*r, (t2*y1 - t1*y2)*r, (t2*z1 - t1*z2)*r };
-        rl_Vector3 tdir = { (s1*x2 - s2*x1)*r, (s1*y2 - s2*y1)*r, (s1*z2 - s2*z1)*r };
+    for (int i = 0; i < terrain->chunksX*terrain->chunksZ; i++)
+    {
+        TerrainChunk *chunk = &terrain->chunks[i];
+        if (chunk->state != TERRAIN_CHUNK_LOADED) continue;
 
-        // Accumulate tangents and bitangents for each vertex of the triangle
-        tan1[i0] = Vector3Add(tan1[i0], sdir);
-        tan1[i1] = Vector3Add(tan1[i1], sdir);
-        tan1[i2] = Vector3Add(tan1[i2], sdir);
+        if (!FrustumCheckBox(frustum, chunk->mesh.boundsMin, chunk->mesh.boundsMax))
+        {
+            rlAddCulledMeshes(1);
+            continue;
+        }
 
-        tan2[i0] = Vector3Add(tan2[i0], tdir);
-        tan2[i1] = Vector3Add(tan2[i1], tdir);
-        tan2[i2] = Vector3Add(tan2[i2], tdir);
+        rl_DrawMesh(chunk->mesh, material, MatrixIdentity());
     }
+}
 
-    // Calculate final tangents for each vertex
-    for (int i = 0; i < mesh->vertexCount; i++)
-    {
-        rl_Vector3 normal = { mesh->normals[i*3 + 0], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] };
-        rl_Vector3 tangent = tan1[i];
+// Get terrain height at world position (x, z), returns 0.0f if position chunk is not loaded
+float rl_GetTerrainHeight(rl_Terrain *terrain, float x, float z)
+{
+    if (terrain == NULL) return 0.0f;
 
-        // Handle zero tangent (can happen with degenerate UVs)
-        if (Vector3Length(tangent) < 0.0001f)
-        {
-            // Create a tangent perpendicular to the normal
-            if (fabsf(normal.z) > 0.707f) tangent = (rl_Vector3){ 1.0f, 0.0f, 0.0f };
-            else tangent = Vector3Normalize((rl_Vector3){ -normal.y, normal.x, 0.0f });
+    float fx = x/terrain->chunkSize.x*TERRAIN_CHUNK_QUADS;
+    float fz = z/terrain->chunkSize.z*TERRAIN_CHUNK_QUADS;
 
-            mesh->tangents[i*4 + 0] = tangent.x;
-            mesh->tangents[i*4 + 1] = tangent.y;
-            mesh->tangents[i*4 + 2] = tangent.z;
-            mesh->tangents[i*4 + 3] = 1.0f;
-            continue;
-        }
+    if ((fx < 0.0f) || (fz < 0.0f) || (fx > terrain->chunksX*TERRAIN_CHUNK_QUADS) || (fz > terrain->chunksZ*TERRAIN_CHUNK_QUADS)) return 0.0f;
 
-        // Gram-Schmidt orthogonalization to make tangent orthogonal to normal
-        // T_prime = T - N*dot(N, T)
-        rl_Vector3 orthogonalized = Vector3Subtract(tangent, Vector3Scale(normal, Vector3DotProduct(normal, tangent)));
+    int cx = (int)fminf(fx/TERRAIN_CHUNK_QUADS, (float)(terrain->chunksX - 1));
+    int cz = (int)fminf(fz/TERRAIN_CHUNK_QUADS, (float)(terrain->chunksZ - 1));
 
-        // Handle cases where orthogonalized vector is too small
-        if (Vector3Length(orthogonalized) < 0.0001f)
-        {
-            // Create a tangent perpendicular to the normal
-            if (fabsf(normal.z) > 0.707f) orthogonalized = (rl_Vector3){ 1.0f, 0.0f, 0.0f };
-            else orthogonalized = Vector3Normalize((rl_Vector3){ -normal.y, normal.x, 0.0f });
-        }
-        else
-        {
-            // Normalize the orthogonalized tangent
-            orthogonalized = Vector3Normalize(orthogonalized);
-        }
+    TerrainChunk *chunk = &terrain->chunks[cz*terrain->chunksX + cx];
+    if (chunk->state != TERRAIN_CHUNK_LOADED) return 0.0f;
 
-        // Store the calculated tangent
-        mesh->tangents[i*4 + 0] = orthogonalized.x;
-        mesh->tangents[i*4 + 1] = orthogonalized.y;
-        mesh->tangents[i*4 + 2] = orthogonalized.z;
+    // Chunk local grid position, interpolated on grid cell triangles
+    fx -= (float)(cx*TERRAIN_CHUNK_QUADS);
+    fz -= (float)(cz*TERRAIN_CHUNK_QUADS);
 
-        // Calculate the handedness (w component)
-        mesh->tangents[i*4 + 3] = (Vector3DotProduct(Vector3CrossProduct(normal, orthogonalized), tan2[i]) < 0.0f)? -1.0f : 1.0f;
-    }
+    int gx = (int)fminf(fx, TERRAIN_CHUNK_QUADS - 1);
+    int gz = (int)fminf(fz, TERRAIN_CHUNK_QUADS - 1);
 
-    // Free temporary arrays
-    RL_FREE(tan1);
-    RL_FREE(tan2);
+    return GetTerrainCellHeight(chunk->heights, gx, gz, 1, fx - gx, fz - gz);
+}
 
-    // Update vertex buffers if available
-    if (mesh->vboId != NULL)
+// Get terrain bounding box (loaded chunks)
+rl_BoundingBox rl_GetTerrainBoundingBox(rl_Terrain *terrain)
+{
+    rl_BoundingBox bounds = { 0 };
+    bool first = true;
+
+    if (terrain == NULL) return bounds;
+
+    for (int i = 0; i < terrain->chunksX*terrain->chunksZ; i++)
     {
-        if (mesh->vboId[SHADER_LOC_VERTEX_TANGENT] != 0)
+        TerrainChunk *chunk = &terrain->chunks[i];
+        if (chunk->state != TERRAIN_CHUNK_LOADED) continue;
+
+        if (first)
         {
-            // Update existing tangent vertex buffer
-            rlUpdateVertexBuffer(mesh->vboId[SHADER_LOC_VERTEX_TANGENT], mesh->tangents, mesh->vertexCount*4*sizeof(float), 0);
+            bounds = (rl_BoundingBox){ chunk->mesh.boundsMin, chunk->mesh.boundsMax };
+            first = false;
         }
         else
         {
-            // Create new tangent vertex buffer
-            mesh->vboId[SHADER_LOC_VERTEX_TANGENT] = rlLoadVertexBuffer(mesh->tangents, mesh->vertexCount*4*sizeof(float), false);
+            bounds.min = Vector3Min(bounds.min, chunk->mesh.boundsMin);
+            bounds.max = Vector3Max(bounds.max, chunk->mesh.boundsMax);
         }
-
-        // Set up vertex attributes for shader
-        rlEnableVertexArray(mesh->vaoId);
-        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, 4, RL_FLOAT, 0, 0, 0);
-        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
-        rlDisableVertexArray();
     }
 
-    TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
+    return bounds;
 }
 
-// Draw a model (with texture if set)
-void rl_DrawModel(rl_Model model, rl_Vector3 position, float scale, rl_Color tint)
+// Unload terrain from memory (RAM and VRAM)
+void rl_UnloadTerrain(rl_Terrain *terrain)
 {
-    rl_Vector3 vScale = { scale, scale, scale };
-    rl_Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
+    if (terrain == NULL) return;
 
-    rl_DrawModelEx(model, position, rotationAxis, 0.0f, vScale, tint);
+    for (int i = 0; i < terrain->chunksX*terrain->chunksZ; i++) UnloadTerrainChunk(&terrain->chunks[i]);
+
+    RL_FREE(terrain->chunks);
+    RL_FREE(terrain);
 }
 
-// Draw a model with extended parameters
-void rl_DrawModelEx(rl_Model model, rl_Vector3 position, rl_Vector3 rotationAxis, float rotationAngle, rl_Vector3 scale, rl_Color tint)
+// Load voxel world, chunksX*chunksY*chunksZ chunks of VOXEL_CHUNK_SIZE voxels per side (all voxels empty)
+rl_VoxelWorld *rl_LoadVoxelWorld(int chunksX, int chunksY, int chunksZ, float voxelSize)
 {
-    // Calculate transformation matrix from function parameters
-    // Get transform matrix (rotation -> scale -> translation)
-    rl_Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
-    rl_Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*rl_DEG2RAD);
-    rl_Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+    if ((chunksX <= 0) || (chunksY <= 0) || (chunksZ <= 0))
+    {
+        TRACELOG(LOG_WARNING, "VOXEL: Failed to load voxel world, chunks count not valid");
+        return NULL;
+    }
 
-    rl_Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+    rl_VoxelWorld *world = (rl_VoxelWorld *)RL_CALLOC(1, sizeof(rl_VoxelWorld));
 
-    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
-    model.transform = MatrixMultiply(model.transform, matTransform);
+    world->chunksX = chunksX;
+    world->chunksY = chunksY;
+    world->chunksZ = chunksZ;
+    world->voxelSize = voxelSize;
+    world->voxels = (unsigned char *)RL_CALLOC(chunksX*chunksY*chunksZ*VOXEL_CHUNK_SIZE*VOXEL_CHUNK_SIZE*VOXEL_CHUNK_SIZE, sizeof(unsigned char));
+    world->chunks = (VoxelChunk *)RL_CALLOC(chunksX*chunksY*chunksZ, sizeof(VoxelChunk));
 
-    for (int i = 0; i < model.meshCount; i++)
+    for (int i = 0; i < 256; i++) world->colors[i] = rl_WHITE;
+
+    return world;
+}
+
+// Set voxel type at voxel coordinates, 0 for empty voxel
+// NOTE: Voxel chunk is re-meshed on next rl_UpdateVoxelWorld(), neighbour chunks too if voxel is on chunk border
+void rl_SetVoxel(rl_VoxelWorld *world, int x, int y, int z, unsigned char type)
+{
+    if (world == NULL) return;
+
+    int sizeX = world->chunksX*VOXEL_CHUNK_SIZE;
+    int sizeY = world->chunksY*VOXEL_CHUNK_SIZE;
+    int sizeZ = world->chunksZ*VOXEL_CHUNK_SIZE;
+
+    if ((x < 0) || (y < 0) || (z < 0) || (x >= sizeX) || (y >= sizeY) || (z >= sizeZ)) return;
+
+    unsigned char *voxel = &world->voxels[(z*sizeY + y)*sizeX + x];
+    if (*voxel == type) return;
+
+    *voxel = type;
+
+    int position[3] = { x, y, z };
+    int chunk[3] = { x/VOXEL_CHUNK_SIZE, y/VOXEL_CHUNK_SIZE, z/VOXEL_CHUNK_SIZE };
+    int counts[3] = { world->chunksX, world->chunksY, world->chunksZ };
+
+    world->chunks[(chunk[2]*world->chunksY + chunk[1])*world->chunksX + chunk[0]].dirty = true;
+
+    // Neighbour chunks faces depend on border voxels (hidden faces culling)
+    for (int d = 0; d < 3; d++)
     {
-        rl_Color color = model.materials[model.meshMaterial[i]].maps[rl_MATERIAL_MAP_DIFFUSE].color;
+        int local = position[d]%VOXEL_CHUNK_SIZE;
+        int neighbour[3] = { chunk[0], chunk[1], chunk[2] };
 
-        rl_Color colorTint = rl_WHITE;
-        colorTint.r = (unsigned char)(((int)color.r*(int)tint.r)/255);
-        colorTint.g = (unsigned char)(((int)color.g*(int)tint.g)/255);
-        colorTint.b = (unsigned char)(((int)color.b*(int)tint.b)/255);
-        colorTint.a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+        if ((local == 0) && (chunk[d] > 0)) neighbour[d]--;
+        else if ((local == (VOXEL_CHUNK_SIZE - 1)) && (chunk[d] < (counts[d] - 1))) neighbour[d]++;
+        else continue;
 
-        model.materials[model.meshMaterial[i]].maps[rl_MATERIAL_MAP_DIFFUSE].color = colorTint;
-        rl_DrawMesh(model.meshes[i], model.materials[model.meshMaterial[i]], model.transform);
-        model.materials[model.meshMaterial[i]].maps[rl_MATERIAL_MAP_DIFFUSE].color = color;
+        world->chunks[(neighbour[2]*world->chunksY + neighbour[1])*world->chunksX + neighbour[0]].dirty = true;
     }
 }
 
-// Draw a model wires (with texture if set)
-void rl_DrawModelWires(rl_Model model, rl_Vector3 position, float scale, rl_Color tint)
+// Get voxel type at voxel coordinates, 0 for empty or out of world voxels
+unsigned char rl_GetVoxel(const rl_VoxelWorld *world, int x, int y, int z)
 {
-    rlEnableWireMode();
+    if (world == NULL) return 0;
 
-    rl_DrawModel(model, position, scale, tint);
-
-    rlDisableWireMode();
+    return GetVoxelWorldVoxel(world, x, y, z);
 }
 
-// Draw a model wires (with texture if set) with extended parameters
-void rl_DrawModelWiresEx(rl_Model model, rl_Vector3 position, rl_Vector3 rotationAxis, float rotationAngle, rl_Vector3 scale, rl_Color tint)
+// Set voxel type color, used as vertex color for voxel faces
+void rl_SetVoxelColor(rl_VoxelWorld *world, unsigned char type, rl_Color color)
 {
-    rlEnableWireMode();
+    if (world == NULL) return;
 
-    rl_DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+    world->colors[type] = color;
 
-    rlDisableWireMode();
+    // Every chunk could use the voxel type
+    for (int i = 0; i < world->chunksX*world->chunksY*world->chunksZ; i++) world->chunks[i].dirty = true;
 }
 
-// Draw a model points
-// WARNING: OpenGL ES 2.0 does not support point mode drawing
-void rl_DrawModelPoints(rl_Model model, rl_Vector3 position, float scale, rl_Color tint)
+// Update voxel world, changed chunks are re-meshed on worker threads and uploaded to GPU, returns chunks updated
+// NOTE: Up to VOXEL_REMESH_CHUNKS_PER_UPDATE chunks are re-meshed per call, remaining chunks on next calls.
+// Chunk buffers are updated with rl_UpdateMeshBuffer(), only reallocated when meshed vertices exceed their capacity
+int rl_UpdateVoxelWorld(rl_VoxelWorld *world)
 {
-    rlEnablePointMode();
-    rlDisableBackfaceCulling();
+    if (world == NULL) return 0;
 
-    rl_DrawModel(model, position, scale, tint);
+    int chunks[VOXEL_REMESH_CHUNKS_PER_UPDATE] = { 0 };
+    int count = 0;
 
-    rlEnableBackfaceCulling();
-    rlDisablePointMode();
-}
+    for (int i = 0; (i < world->chunksX*world->chunksY*world->chunksZ) && (count < VOXEL_REMESH_CHUNKS_PER_UPDATE); i++)
+    {
+        if (world->chunks[i].dirty)
+        {
+            world->chunks[i].dirty = false;
+            chunks[count++] = i;
+        }
+    }
 
-// Draw a model points
-// WARNING: OpenGL ES 2.0 does not support point mode drawing
-void rl_DrawModelPointsEx(rl_Model model, rl_Vector3 position, rl_Vector3 rotationAxis, float rotationAngle, rl_Vector3 scale, rl_Color tint)
-{
-    rlEnablePointMode();
-    rlDisableBackfaceCulling();
+    if (count == 0) return 0;
 
-    rl_DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+    VoxelMeshJob job = { 0 };
+    job.world = world;
+    job.chunks = chunks;
 
-    rlEnableBackfaceCulling();
-    rlDisablePointMode();
+    WorkerJob workerJob = { 0 };
+    workerJob.process = ProcessVoxelMeshRange;
+    workerJob.data = &job;
+    workerJob.count = count;
+    workerJob.chunkSize = 1;
+
+    RunWorkerJob(&workerJob);
+
+    // Upload meshed chunks on caller thread
+    for (int i = 0; i < count; i++) UploadVoxelChunk(&world->chunks[chunks[i]]);
+
+    return count;
 }
 
-// Draw a billboard
-void rl_DrawBillboard(rl_Camera camera, rl_Texture2D texture, rl_Vector3 position, float scale, rl_Color tint)
+// Draw voxel world chunks visible in current view
+void rl_DrawVoxelWorld(rl_VoxelWorld *world, rl_Material material)
 {
-    rl_Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    if (world == NULL) return;
 
-    rl_DrawBillboardRec(camera, texture, source, position, (rl_Vector2){ scale*fabsf((float)source.width/source.height), scale }, tint);
+    rl_Matrix mvp = MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection());
+    rl_Frustum frustum = FrustumFromMatrix(mvp);
+
+    for (int i = 0; i < world->chunksX*world->chunksY*world->chunksZ; i++)
+    {
+        VoxelChunk *chunk = &world->chunks[i];
+        if ((chunk->uploadedCapacity == 0) || (chunk->mesh.triangleCount == 0)) continue;
+
+        if (!FrustumCheckBox(frustum, chunk->mesh.boundsMin, chunk->mesh.boundsMax))
+        {
+            rlAddCulledMeshes(1);
+            continue;
+        }
+
+        rl_DrawMesh(chunk->mesh, material, MatrixIdentity());
+    }
 }
 
-// Draw a billboard (part of a texture defined by a rectangle)
-void rl_DrawBillboardRec(rl_Camera camera, rl_Texture2D texture, rl_Rectangle source, rl_Vector3 position, rl_Vector2 size, rl_Color tint)
+// Unload voxel world from memory (RAM and VRAM)
+void rl_UnloadVoxelWorld(rl_VoxelWorld *world)
 {
-    // NOTE: Billboard locked on axis-Y
-    rl_Vector3 up = { 0.0f, 1.0f, 0.0f };
+    if (world == NULL) return;
 
-    rl_DrawBillboardPro(camera, texture, source, position, up, size, Vector2Scale(size, 0.5), 0.0f, tint);
+    for (int i = 0; i < world->chunksX*world->chunksY*world->chunksZ; i++)
+    {
+        VoxelChunk *chunk = &world->chunks[i];
+
+        if (chunk->uploadedCapacity > 0) rl_UnloadMesh(chunk->mesh);
+        else
+        {
+            RL_FREE(chunk->mesh.vertices);
+            RL_FREE(chunk->mesh.texcoords);
+            RL_FREE(chunk->mesh.normals);
+            RL_FREE(chunk->mesh.colors);
+            RL_FREE(chunk->mesh.indices);
+        }
+    }
+
+    RL_FREE(world->chunks);
+    RL_FREE(world->voxels);
+    RL_FREE(world);
 }
 
-// Draw a billboard with additional parameters
-void rl_DrawBillboardPro(rl_Camera camera, rl_Texture2D texture, rl_Rectangle source, rl_Vector3 position, rl_Vector3 up, rl_Vector2 size, rl_Vector2 origin, float rotation, rl_Color tint)
+// Compute mesh bounding box limits
+// NOTE: minVertex and maxVertex should be transformed by model transform matrix
+rl_BoundingBox rl_GetMeshBoundingBox(rl_Mesh mesh)
 {
-    // Compute the up vector and the right vector
-    rl_Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
-    rl_Vector3 right = { matView.m0, matView.m4, matView.m8 };
-    right = Vector3Scale(right, size.x);
-    up = Vector3Scale(up, size.y);
+    // Get min and max vertex to construct bounds (AABB)
+    rl_Vector3 minVertex = { 0 };
+    rl_Vector3 maxVertex = { 0 };
 
-    // Flip the content of the billboard while maintaining the counterclockwise edge rendering order
-    if (size.x < 0.0f)
+    if (mesh.vertices != NULL)
     {
-        source.x -= size.x;
-        source.width *= -1.0;
-        right = Vector3Negate(right);
-        origin.x *= -1.0f;
+        minVertex = (rl_Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+        maxVertex = (rl_Vector3){ mesh.vertices[0], mesh.vertices[1], mesh.vertices[2] };
+
+        for (int i = 1; i < mesh.vertexCount; i++)
+        {
+            minVertex = Vector3Min(minVertex, (rl_Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+            maxVertex = Vector3Max(maxVertex, (rl_Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
+        }
     }
-    if (size.y < 0.0f)
+
+    // Create the bounding box
+    rl_BoundingBox box = { 0 };
+    box.min = minVertex;
+    box.max = maxVertex;
+
+    return box;
+}
+
+// Generate mesh bounding volume hierarchy, used by mesh collision functions
+// NOTE: Built from mesh vertex data on CPU, it must be generated again if vertex data changes
+void rl_GenMeshBVH(rl_Mesh *mesh)
+{
+    if ((mesh == NULL) || (mesh->vertices == NULL) || (mesh->triangleCount <= 0))
     {
-        source.y -= size.y;
-        source.height *= -1.0;
-        up = Vector3Negate(up);
-        origin.y *= -1.0f;
+        TRACELOG(LOG_WARNING, "MESH: BVH generation requires mesh vertex data on CPU");
+        return;
     }
 
-    // Draw the texture region described by source on the following rectangle in 3D space:
-    //
-    //                size.x          <--.
-    //  3 ^---------------------------+ 2 \ rotation
-    //    |                           |   /
-    //    |                           |
-    //    |   origin.x   position     |
-    // up |..............             | size.y
-    //    |             .             |
-    //    |             . origin.y    |
-    //    |             .             |
-    //  0 +---------------------------> 1
-    //                right
-    rl_Vector3 forward;
-    if (rotation != 0.0) forward = Vector3CrossProduct(right, up);
+    rl_UnloadMeshBVH(mesh);
 
-    rl_Vector3 origin3D = Vector3Add(Vector3Scale(Vector3Normalize(right), origin.x), Vector3Scale(Vector3Normalize(up), origin.y));
+    int triangleCount = mesh->triangleCount;
 
-    rl_Vector3 points[4];
-    points[0] = Vector3Zero();
-    points[1] = right;
-    points[2] = Vector3Add(up, right);
-    points[3] = up;
+    rl_MeshBVH *bvh = (rl_MeshBVH *)RL_CALLOC(1, sizeof(rl_MeshBVH));
+    bvh->triangleCount = triangleCount;
+    bvh->triangles = (int *)RL_MALLOC(triangleCount*sizeof(int));
+    bvh->nodes = (MeshBVHNode *)RL_MALLOC((2*triangleCount - 1)*sizeof(MeshBVHNode));   // Maximum nodes for a binary tree with triangleCount leaves
 
-    for (int i = 0; i < 4; i++)
+    // Triangles bounds and centroids, only required while building
+    rl_BoundingBox *bounds = (rl_BoundingBox *)RL_MALLOC(triangleCount*sizeof(rl_BoundingBox));
+    rl_Vector3 *centroids = (rl_Vector3 *)RL_MALLOC(triangleCount*sizeof(rl_Vector3));
+
+    for (int i = 0; i < triangleCount; i++)
     {
-        points[i] = Vector3Subtract(points[i], origin3D);
-        if (rotation != 0.0) points[i] = Vector3RotateByAxisAngle(points[i], forward, rotation*rl_DEG2RAD);
-        points[i] = Vector3Add(points[i], position);
+        rl_Vector3 a = { 0 };
+        rl_Vector3 b = { 0 };
+        rl_Vector3 c = { 0 };
+        GetMeshTriangle(*mesh, i, &a, &b, &c);
+
+        bounds[i].min = Vector3Min(Vector3Min(a, b), c);
+        bounds[i].max = Vector3Max(Vector3Max(a, b), c);
+        centroids[i] = Vector3Scale(Vector3Add(bounds[i].min, bounds[i].max), 0.5f);
+        bvh->triangles[i] = i;
     }
 
-    rl_Vector2 texcoords[4];
-    texcoords[0] = (rl_Vector2){ (float)source.x/texture.width, (float)(source.y + source.height)/texture.height };
-    texcoords[1] = (rl_Vector2){ (float)(source.x + source.width)/texture.width, (float)(source.y + source.height)/texture.height };
-    texcoords[2] = (rl_Vector2){ (float)(source.x + source.width)/texture.width, (float)source.y/texture.height };
-    texcoords[3] = (rl_Vector2){ (float)source.x/texture.width, (float)source.y/texture.height };
+    bvh->nodeCount = 1;
+    BuildMeshBVHNode(bvh, 0, 0, triangleCount, bounds, centroids, 0);
 
-    rlSetTexture(texture.id);
-    rlBegin(RL_QUADS);
+    RL_FREE(bounds);
+    RL_FREE(centroids);
 
-        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-        for (int i = 0; i < 4; i++)
-        {
-            rlTexCoord2f(texcoords[i].x, texcoords[i].y);
-            rlVertex3f(points[i].x, points[i].y, points[i].z);
-        }
+    mesh->bvh = bvh;
 
-    rlEnd();
-    rlSetTexture(0);
+    TRACELOG(LOG_INFO, "MESH: BVH generated successfully (%i triangles | %i nodes)", triangleCount, bvh->nodeCount);
 }
 
-// Draw a bounding box with wires
-void rl_DrawBoundingBox(rl_BoundingBox box, rl_Color color)
+// Unload mesh bounding volume hierarchy
+void rl_UnloadMeshBVH(rl_Mesh *mesh)
 {
-    rl_Vector3 size = { 0 };
-
-    size.x = fabsf(box.max.x - box.min.x);
-    size.y = fabsf(box.max.y - box.min.y);
-    size.z = fabsf(box.max.z - box.min.z);
-
-    rl_Vector3 center = { box.min.x + size.x/2.0f, box.min.y + size.y/2.0f, box.min.z + size.z/2.0f };
+    if ((mesh == NULL) || (mesh->bvh == NULL)) return;
 
-    rl_DrawCubeWires(center, size.x, size.y, size.z, color);
+    RL_FREE(mesh->bvh->nodes);
+    RL_FREE(mesh->bvh->triangles);
+    RL_FREE(mesh->bvh);
+    mesh->bvh = NULL;
 }
 
-// Check collision between two spheres
-bool rl_CheckCollisionSpheres(rl_Vector3 center1, float radius1, rl_Vector3 center2, float radius2)
+// Generate mesh levels of detail, simplified with quadric error metrics
+// NOTE: Every level targets previous level triangles multiplied by reduction,
+// levels indices are stored after full detail indices and share mesh vertex data
+void rl_GenMeshLOD(rl_Mesh *mesh, int levelCount, float reduction)
 {
-    bool collision = false;
+    if ((mesh == NULL) || (mesh->vertices == NULL) || (mesh->indices == NULL) || (mesh->triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: LOD generation requires indexed mesh vertex data on CPU (see rl_OptimizeMesh())");
+        return;
+    }
 
-    // Simple way to check for collision, just checking distance between two points
-    // Unfortunately, sqrtf() is a costly operation, so we avoid it with following solution
-    /*
-    float dx = center1.x - center2.x;      // X distance between centers
-    float dy = center1.y - center2.y;      // Y distance between centers
-    float dz = center1.z - center2.z;      // Z distance between centers
+    if ((reduction <= 0.0f) || (reduction >= 1.0f))
+    {
+        TRACELOG(LOG_WARNING, "MESH: LOD reduction must be in range (0.0f..1.0f)");
+        return;
+    }
 
-    float distance = sqrtf(dx*dx + dy*dy + dz*dz);  // Distance between centers
+    if (levelCount > MAX_MESH_LOD_LEVELS) levelCount = MAX_MESH_LOD_LEVELS;
 
-    if (distance <= (radius1 + radius2)) collision = true;
-    */
+    rl_UnloadMeshLOD(mesh);
 
-    // Check for distances squared to avoid sqrtf()
-    if (Vector3DotProduct(Vector3Subtract(center2, center1), Vector3Subtract(center2, center1)) <= (radius1 + radius2)*(radius1 + radius2)) collision = true;
+    int vertexCount = mesh->vertexCount;
+    int indexCount = mesh->triangleCount*3;
+    unsigned int *indices = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+    for (int i = 0; i < indexCount; i++) indices[i] = mesh->indices[i];
 
-    return collision;
-}
+    // Init vertices quadrics with their triangles planes, weighted by triangles area
+    MeshQuadric *quadrics = (MeshQuadric *)RL_CALLOC(vertexCount, sizeof(MeshQuadric));
 
-// Check collision between two boxes
-// NOTE: Boxes are defined by two points minimum and maximum
-bool rl_CheckCollisionBoxes(rl_BoundingBox box1, rl_BoundingBox box2)
-{
-    bool collision = true;
+    for (int i = 0; i < indexCount; i += 3)
+    {
+        const float *a = &mesh->vertices[indices[i]*3];
+        const float *b = &mesh->vertices[indices[i + 1]*3];
+        const float *c = &mesh->vertices[indices[i + 2]*3];
+
+        rl_Vector3 p0 = { a[0], a[1], a[2] };
+        rl_Vector3 normal = Vector3CrossProduct(Vector3Subtract((rl_Vector3){ b[0], b[1], b[2] }, p0), Vector3Subtract((rl_Vector3){ c[0], c[1], c[2] }, p0));
+        float area = Vector3Length(normal);
+        if (area <= 0.0f) continue;
+
+        normal = Vector3Scale(normal, 1.0f/area);
+        float d = -Vector3DotProduct(normal, p0);
+
+        MeshQuadric plane = {
+            area*normal.x*normal.x, area*normal.y*normal.y, area*normal.z*normal.z,
+            area*normal.x*normal.y, area*normal.x*normal.z, area*normal.y*normal.z,
+            area*normal.x*d, area*normal.y*d, area*normal.z*d, area*d*d, area
+        };
 
-    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
+        for (int k = 0; k < 3; k++) AddMeshQuadric(&quadrics[indices[i + k]], &plane);
+    }
+
+    rl_BoundingBox bounds = rl_GetMeshBoundingBox(*mesh);
+    rl_MeshLOD *lod = (rl_MeshLOD *)RL_CALLOC(1, sizeof(rl_MeshLOD));
+    lod->center = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+    lod->radius = Vector3Distance(bounds.min, bounds.max)*0.5f;
+
+    unsigned short *lodIndices = NULL;
+    int lodIndexCount = 0;
+    float error = 0.0f;
+
+    for (int level = 0; level < levelCount; level++)
     {
-        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
-        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+        int targetCount = (int)((float)(indexCount/3)*reduction)*3;
+        if (targetCount < 3) break;
+
+        int simplifiedCount = SimplifyMeshIndices(indices, indexCount, mesh->vertices, vertexCount, quadrics, targetCount, MESH_LOD_MAX_ERROR*lod->radius, &error);
+
+        // Stop when simplification can not reduce triangles significantly (error limit, borders and seams are locked)
+        if ((simplifiedCount == 0) || ((float)simplifiedCount > (float)indexCount*MESH_LOD_MIN_REDUCTION)) break;
+
+        lodIndices = (unsigned short *)RL_REALLOC(lodIndices, (lodIndexCount + simplifiedCount)*sizeof(unsigned short));
+        for (int i = 0; i < simplifiedCount; i++) lodIndices[lodIndexCount + i] = (unsigned short)indices[i];
+
+        lod->triangleCounts[level] = simplifiedCount/3;
+        lod->indexOffsets[level] = mesh->triangleCount*3 + lodIndexCount;
+        lod->errors[level] = error;
+        lod->levelCount++;
+
+        lodIndexCount += simplifiedCount;
+        indexCount = simplifiedCount;
     }
-    else collision = false;
 
-    return collision;
+    RL_FREE(indices);
+    RL_FREE(quadrics);
+
+    if (lod->levelCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to simplify mesh, LOD levels not generated");
+        RL_FREE(lod);
+        return;
+    }
+
+    // Append levels indices after full detail indices
+    mesh->indices = (unsigned short *)RL_REALLOC(mesh->indices, (mesh->triangleCount*3 + lodIndexCount)*sizeof(unsigned short));
+    memcpy(mesh->indices + mesh->triangleCount*3, lodIndices, lodIndexCount*sizeof(unsigned short));
+    RL_FREE(lodIndices);
+
+    mesh->lod = lod;
+
+    // Update index buffer if mesh is already uploaded
+    if ((mesh->vboId != NULL) && (mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] != 0))
+    {
+        rlEnableVertexArray(mesh->vaoId);
+        rlUnloadVertexBuffer(mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] = rlLoadVertexBufferElement(mesh->indices, GetMeshIndexCount(*mesh)*sizeof(unsigned short), false);
+        rlDisableVertexArray();
+    }
+
+    TRACELOG(LOG_INFO, "MESH: Generated %i LOD levels: %i -> %i triangles (error: %.4f)", lod->levelCount,
+        mesh->triangleCount, lod->triangleCounts[lod->levelCount - 1], lod->errors[lod->levelCount - 1]);
 }
 
-// Check collision between box and sphere
-bool rl_CheckCollisionBoxSphere(rl_BoundingBox box, rl_Vector3 center, float radius)
+// Unload mesh levels of detail
+// NOTE: Levels indices are not removed from mesh indices, they are ignored
+void rl_UnloadMeshLOD(rl_Mesh *mesh)
 {
-    bool collision = false;
-
-    float dmin = 0;
+    if ((mesh == NULL) || (mesh->lod == NULL)) return;
 
-    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
-    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
+    RL_FREE(mesh->lod);
+    mesh->lod = NULL;
+}
 
-    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
+// Compute mesh tangents
+// NOTE: Tangents are computed as MikkTSpace (normalized triangle tangents, projected on vertex normal plane,
+// weighted by corner angle), indexed meshes are processed without de-indexing, vertices are not split on
+// mirrored texcoords. Triangles and vertices are processed in parallel on worker threads
+void rl_GenMeshTangents(rl_Mesh *mesh)
+{
+    // Check if input mesh data is useful
+    if ((mesh == NULL) || (mesh->vertices == NULL) || (mesh->texcoords == NULL) || (mesh->normals == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Tangents generation requires vertices, texcoords and normals vertex attribute data");
+        return;
+    }
+
+    // Allocate or reallocate tangents data
+    if (mesh->tangents == NULL) mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
+    else
+    {
+        RL_FREE(mesh->tangents);
+        mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
+    }
+
+    // Allocate temporary arrays for tangents calculation
+    // NOTE: Vertices triangles corners are stored contiguously (offsets by vertex), so vertices
+    // gather their triangles tangents instead of triangles scattering them (no write conflicts between threads)
+    float *triangleTangents = (float *)RL_MALLOC(mesh->triangleCount*4*sizeof(float));
+    int *cornerOffsets = (int *)RL_CALLOC(mesh->vertexCount + 1, sizeof(int));
+    int *corners = (int *)RL_MALLOC(mesh->triangleCount*3*sizeof(int));
+
+    if ((triangleTangents == NULL) || (cornerOffsets == NULL) || (corners == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to allocate temporary memory for tangent calculation");
+        RL_FREE(triangleTangents);
+        RL_FREE(cornerOffsets);
+        RL_FREE(corners);
+        return;
+    }
+
+    // Get vertices corners, 'triangleCount' must be always valid
+    // NOTE: Offsets are accumulated as corners end, filling corners backwards leaves them as corners start
+    for (int c = 0; c < mesh->triangleCount*3; c++) cornerOffsets[(mesh->indices != NULL)? mesh->indices[c] : c]++;
+    for (int i = 1; i < mesh->vertexCount; i++) cornerOffsets[i] += cornerOffsets[i - 1];
+    cornerOffsets[mesh->vertexCount] = mesh->triangleCount*3;
+
+    for (int c = mesh->triangleCount*3 - 1; c >= 0; c--)
+    {
+        int vertex = (mesh->indices != NULL)? mesh->indices[c] : c;
+        corners[--cornerOffsets[vertex]] = c;
+    }
+
+    TangentsJob job = { 0 };
+    job.mesh = mesh;
+    job.triangleTangents = triangleTangents;
+    job.cornerOffsets = cornerOffsets;
+    job.corners = corners;
+
+    WorkerJob workerJob = { 0 };
+    workerJob.process = ProcessTangentsTriangleRange;
+    workerJob.data = &job;
+    workerJob.count = mesh->triangleCount;
+    workerJob.chunkSize = MESH_TANGENTS_CHUNK_SIZE;
+
+    RunWorkerJob(&workerJob);
+
+    workerJob.process = ProcessTangentsVertexRange;
+    workerJob.count = mesh->vertexCount;
+
+    RunWorkerJob(&workerJob);
+
+    // Free temporary arrays
+    RL_FREE(triangleTangents);
+    RL_FREE(cornerOffsets);
+    RL_FREE(corners);
+
+    // Update vertex buffers if available
+    if (mesh->vboId != NULL)
+    {
+        // NOTE: Tangents are quantized as uploaded mesh normals
+        int dataSize = 0;
+        void *data = LoadMeshVertexBufferData(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, mesh->tangents, &dataSize);
+
+        if (mesh->vboId[SHADER_LOC_VERTEX_TANGENT] != 0)
+        {
+            // Update existing tangent vertex buffer
+            rlUpdateVertexBuffer(mesh->vboId[SHADER_LOC_VERTEX_TANGENT], data, dataSize, 0);
+        }
+        else
+        {
+            // Create new tangent vertex buffer
+            mesh->vboId[SHADER_LOC_VERTEX_TANGENT] = rlLoadVertexBuffer(data, dataSize, false);
+        }
+
+        if (data != mesh->tangents) RL_FREE(data);
+
+        // Set up vertex attributes for shader
+        rlEnableVertexArray(mesh->vaoId);
+        rlEnableVertexBuffer(mesh->vboId[SHADER_LOC_VERTEX_TANGENT]);
+        SetMeshVertexAttribute(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+        rlDisableVertexArray();
+    }
+
+    TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
+}
+
+// Optimize mesh for GPU rendering, welding duplicated vertices into indices and
+// reordering triangles (vertex cache, overdraw) and vertices (fetch locality)
+// NOTE: Mesh must not be uploaded yet, vertex count may change
+void rl_OptimizeMesh(rl_Mesh *mesh)
+{
+    if ((mesh == NULL) || (mesh->vertices == NULL) || (mesh->triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Optimization requires mesh vertex data on CPU");
+        return;
+    }
+
+    if (mesh->vaoId > 0)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Optimization requires mesh not uploaded to GPU, optimize before rl_UploadMesh()");
+        return;
+    }
+
+    // Vertex attributes to weld and reorder
+    void **attribs[10] = {
+        (void **)&mesh->vertices, (void **)&mesh->texcoords, (void **)&mesh->texcoords2, (void **)&mesh->normals,
+        (void **)&mesh->tangents, (void **)&mesh->colors, (void **)&mesh->boneIds, (void **)&mesh->boneWeights,
+        (void **)&mesh->animVertices, (void **)&mesh->animNormals
+    };
+    const int attribSizes[10] = {
+        3*sizeof(float), 2*sizeof(float), 2*sizeof(float), 3*sizeof(float),
+        4*sizeof(float), 4*sizeof(unsigned char), 4*sizeof(unsigned char), 4*sizeof(float),
+        3*sizeof(float), 3*sizeof(float)
+    };
+
+    int vertexCount = mesh->vertexCount;
+    int indexCount = mesh->triangleCount*3;
+    unsigned int *indices = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+
+    for (int i = 0; i < indexCount; i++) indices[i] = (mesh->indices != NULL)? mesh->indices[i] : (unsigned int)i;
+
+    float acmrBefore = GetIndicesACMR(indices, indexCount, vertexCount);
+
+    // Weld vertices with equal attributes, indices reference first equal vertex
+    int tableSize = 1;
+    while (tableSize < 2*vertexCount) tableSize *= 2;
+
+    int *table = (int *)RL_MALLOC(tableSize*sizeof(int));
+    int *remap = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    for (int i = 0; i < tableSize; i++) table[i] = -1;
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        // FNV-1a hash of vertex attributes data
+        unsigned int hash = 2166136261u;
+        for (int a = 0; a < 10; a++)
+        {
+            if (*attribs[a] == NULL) continue;
+
+            const unsigned char *data = (const unsigned char *)(*attribs[a]) + v*attribSizes[a];
+            for (int k = 0; k < attribSizes[a]; k++) hash = (hash ^ data[k])*16777619u;
+        }
+
+        unsigned int slot = hash & (tableSize - 1);
+        remap[v] = v;
+
+        while (table[slot] >= 0)
+        {
+            int other = table[slot];
+            bool equal = true;
+
+            for (int a = 0; (a < 10) && equal; a++)
+            {
+                if (*attribs[a] == NULL) continue;
+
+                const unsigned char *data = (const unsigned char *)(*attribs[a]);
+                equal = (memcmp(data + v*attribSizes[a], data + other*attribSizes[a], attribSizes[a]) == 0);
+            }
+
+            if (equal) { remap[v] = other; break; }
+            slot = (slot + 1) & (tableSize - 1);
+        }
+
+        if (remap[v] == v) table[slot] = v;
+    }
+
+    for (int i = 0; i < indexCount; i++) indices[i] = remap[indices[i]];
+
+    RL_FREE(table);
+
+    // Reorder triangles for vertex cache, then clusters for overdraw if vertex cache efficiency is kept
+    OptimizeIndicesCache(indices, indexCount, vertexCount);
+
+    unsigned int *overdrawIndices = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+    memcpy(overdrawIndices, indices, indexCount*sizeof(unsigned int));
+    OptimizeIndicesOverdraw(overdrawIndices, indexCount, mesh->vertices, vertexCount);
+
+    if (GetIndicesACMR(overdrawIndices, indexCount, vertexCount) <= GetIndicesACMR(indices, indexCount, vertexCount)*MESH_OPTIMIZE_OVERDRAW_THRESHOLD)
+    {
+        RL_FREE(indices);
+        indices = overdrawIndices;
+    }
+    else RL_FREE(overdrawIndices);
+
+    // Reorder vertices in first use order for fetch locality, unused vertices are removed
+    int optimizedCount = 0;
+    for (int v = 0; v < vertexCount; v++) remap[v] = -1;
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        if (remap[indices[i]] < 0) remap[indices[i]] = optimizedCount++;
+    }
+
+    if (optimizedCount > 65536)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Optimized mesh requires more vertices (%i) than supported by 16 bit indices", optimizedCount);
+        RL_FREE(indices);
+        RL_FREE(remap);
+        return;
+    }
+
+    for (int a = 0; a < 10; a++)
+    {
+        if (*attribs[a] == NULL) continue;
+
+        const unsigned char *data = (const unsigned char *)(*attribs[a]);
+        unsigned char *optimized = (unsigned char *)RL_MALLOC(optimizedCount*attribSizes[a]);
+
+        for (int v = 0; v < vertexCount; v++)
+        {
+            if (remap[v] >= 0) memcpy(optimized + remap[v]*attribSizes[a], data + v*attribSizes[a], attribSizes[a]);
+        }
+
+        RL_FREE(*attribs[a]);
+        *attribs[a] = optimized;
+    }
+
+    RL_FREE(mesh->indices);
+    mesh->indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+    for (int i = 0; i < indexCount; i++) mesh->indices[i] = (unsigned short)remap[indices[i]];
+    mesh->vertexCount = optimizedCount;
+
+    RL_FREE(indices);
+    RL_FREE(remap);
+
+    // Triangles order changed, BVH must be regenerated and levels of detail are not valid
+    if (mesh->bvh != NULL) rl_GenMeshBVH(mesh);
+    rl_UnloadMeshLOD(mesh);
+
+    TRACELOG(LOG_INFO, "MESH: Mesh optimized: %i -> %i vertices, ACMR %.3f -> %.3f", vertexCount, optimizedCount, acmrBefore, rl_GetMeshACMR(*mesh));
+}
+
+// Get mesh average cache miss ratio (ACMR), transformed vertices per triangle
+// NOTE: A FIFO post-transform vertex cache is simulated, ratio ranges from 0.5 (best) to 3.0 (worst)
+float rl_GetMeshACMR(rl_Mesh mesh)
+{
+    if (mesh.triangleCount <= 0) return 0.0f;
+
+    int indexCount = mesh.triangleCount*3;
+    unsigned int *indices = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+
+    for (int i = 0; i < indexCount; i++) indices[i] = (mesh.indices != NULL)? mesh.indices[i] : (unsigned int)i;
+
+    float acmr = GetIndicesACMR(indices, indexCount, mesh.vertexCount);
+
+    RL_FREE(indices);
+
+    return acmr;
+}
+
+// Draw a model (with texture if set)
+void rl_DrawModel(rl_Model model, rl_Vector3 position, float scale, rl_Color tint)
+{
+    rl_Vector3 vScale = { scale, scale, scale };
+    rl_Vector3 rotationAxis = { 0.0f, 1.0f, 0.0f };
+
+    rl_DrawModelEx(model, position, rotationAxis, 0.0f, vScale, tint);
+}
+
+// Draw a model with extended parameters
+void rl_DrawModelEx(rl_Model model, rl_Vector3 position, rl_Vector3 rotationAxis, float rotationAngle, rl_Vector3 scale, rl_Color tint)
+{
+    // Calculate transformation matrix from function parameters
+    // Get transform matrix (rotation -> scale -> translation)
+    rl_Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
+    rl_Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle*rl_DEG2RAD);
+    rl_Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+
+    rl_Matrix matTransform = MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+
+    // Combine model transformation matrix (model.transform) with matrix generated by function parameters (matTransform)
+    model.transform = MatrixMultiply(model.transform, matTransform);
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        rl_Color color = model.materials[model.meshMaterial[i]].maps[rl_MATERIAL_MAP_DIFFUSE].color;
+
+        rl_Color colorTint = rl_WHITE;
+        colorTint.r = (unsigned char)(((int)color.r*(int)tint.r)/255);
+        colorTint.g = (unsigned char)(((int)color.g*(int)tint.g)/255);
+        colorTint.b = (unsigned char)(((int)color.b*(int)tint.b)/255);
+        colorTint.a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+
+        model.materials[model.meshMaterial[i]].maps[rl_MATERIAL_MAP_DIFFUSE].color = colorTint;
+        rl_DrawMesh(model.meshes[i], model.materials[model.meshMaterial[i]], model.transform);
+        model.materials[model.meshMaterial[i]].maps[rl_MATERIAL_MAP_DIFFUSE].color = color;
+    }
+}
+
+// Draw a model wires (with texture if set)
+void rl_DrawModelWires(rl_Model model, rl_Vector3 position, float scale, rl_Color tint)
+{
+    rlEnableWireMode();
+
+    rl_DrawModel(model, position, scale, tint);
+
+    rlDisableWireMode();
+}
+
+// Draw a model wires (with texture if set) with extended parameters
+void rl_DrawModelWiresEx(rl_Model model, rl_Vector3 position, rl_Vector3 rotationAxis, float rotationAngle, rl_Vector3 scale, rl_Color tint)
+{
+    rlEnableWireMode();
+
+    rl_DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+
+    rlDisableWireMode();
+}
+
+// Draw a model points
+// WARNING: OpenGL ES 2.0 does not support point mode drawing
+void rl_DrawModelPoints(rl_Model model, rl_Vector3 position, float scale, rl_Color tint)
+{
+    rlEnablePointMode();
+    rlDisableBackfaceCulling();
+
+    rl_DrawModel(model, position, scale, tint);
+
+    rlEnableBackfaceCulling();
+    rlDisablePointMode();
+}
+
+// Draw a model points
+// WARNING: OpenGL ES 2.0 does not support point mode drawing
+void rl_DrawModelPointsEx(rl_Model model, rl_Vector3 position, rl_Vector3 rotationAxis, float rotationAngle, rl_Vector3 scale, rl_Color tint)
+{
+    rlEnablePointMode();
+    rlDisableBackfaceCulling();
+
+    rl_DrawModelEx(model, position, rotationAxis, rotationAngle, scale, tint);
+
+    rlEnableBackfaceCulling();
+    rlDisablePointMode();
+}
+
+// Load draw list, models meshes are drawn sorted by shader and material
+rl_DrawList *rl_LoadDrawList(void)
+{
+    rl_DrawList *list = (rl_DrawList *)RL_CALLOC(1, sizeof(rl_DrawList));
+
+    return list;
+}
+
+// Add model to draw list, returns draw list model index
+// NOTE: Meshes and materials are referenced, they must be valid while the list is drawn,
+// rl_Model transform is applied before provided transform
+int rl_AddDrawListModel(rl_DrawList *list, rl_Model model, rl_Matrix transform)
+{
+    if ((list == NULL) || (model.meshCount == 0)) return -1;
+
+    list->models = (DrawListModel *)RL_REALLOC(list->models, (list->modelCount + 1)*sizeof(DrawListModel));
+    list->items = (DrawListItem *)RL_REALLOC(list->items, (list->itemCount + model.meshCount)*sizeof(DrawListItem));
+    list->commands = (DrawListCommand *)RL_REALLOC(list->commands, (list->itemCount + model.meshCount)*sizeof(DrawListCommand));
+
+    DrawListModel *entry = &list->models[list->modelCount];
+    entry->transform = model.transform;
+    entry->firstItem = list->itemCount;
+    entry->itemCount = model.meshCount;
+    entry->visible = true;
+    entry->placed = false;
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        DrawListItem *item = &list->items[list->itemCount];
+        rl_Material material = model.materials[model.meshMaterial[i]];
+
+        item->mesh = model.meshes[i];
+        item->materialIndex = FindMaterialIndex(&list->materials, &list->materialCount, material);
+        item->modelIndex = list->modelCount;
+
+        DrawListCommand *command = &list->commands[list->itemCount];
+        command->shaderId = material.shader.id;
+        command->materialIndex = item->materialIndex;
+        command->meshId = (item->mesh.vaoId > 0)? item->mesh.vaoId : ((item->mesh.vboId != NULL)? item->mesh.vboId[0] : 0);
+        command->item = list->itemCount;
+
+        list->itemCount++;
+    }
+
+    list->modelCount++;
+    list->sorted = false;
+
+    rl_SetDrawListModelTransform(list, list->modelCount - 1, transform);
+
+    return list->modelCount - 1;
+}
+
+// Set draw list model transform, model meshes world and normal matrices are updated
+// NOTE: Previous and new world bounds are tracked as changes (shadow map cascades redrawn)
+void rl_SetDrawListModelTransform(rl_DrawList *list, int index, rl_Matrix transform)
+{
+    if ((list == NULL) || (index < 0) || (index >= list->modelCount)) return;
+
+    DrawListModel *entry = &list->models[index];
+    rl_Matrix matWorld = MatrixMultiply(entry->transform, transform);
+    rl_Matrix matNormal = GetNormalMatrix(matWorld);
+
+    if (entry->placed && entry->visible) TrackDrawListChange(list, entry->bounds);
+
+    for (int i = entry->firstItem; i < (entry->firstItem + entry->itemCount); i++)
+    {
+        list->items[i].world = matWorld;
+        list->items[i].normal = matNormal;
+    }
+
+    entry->bounds = GetDrawListModelBounds(list, index);
+    entry->placed = true;
+
+    if (entry->visible) TrackDrawListChange(list, entry->bounds);
+}
+
+// Set draw list model visibility
+void rl_SetDrawListModelVisible(rl_DrawList *list, int index, bool visible)
+{
+    if ((list == NULL) || (index < 0) || (index >= list->modelCount)) return;
+
+    if (list->models[index].visible != visible) TrackDrawListChange(list, list->models[index].bounds);
+
+    list->models[index].visible = visible;
+}
+
+// Draw list models meshes, shader and material state is only changed between different consecutive items
+// NOTE: Meshes are culled (frustum and occlusion) and levels of detail selected as rl_DrawMesh()
+void rl_SubmitDrawList(rl_DrawList *list)
+{
+    if ((list == NULL) || (list->itemCount == 0)) return;
+
+    if (!list->sorted)
+    {
+        qsort(list->commands, list->itemCount, sizeof(DrawListCommand), CompareDrawListCommands);
+        list->sorted = true;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    for (int i = 0; i < list->itemCount; i++)
+    {
+        const DrawListItem *item = &list->items[list->commands[i].item];
+
+        if (list->models[item->modelIndex].visible) rl_DrawMesh(item->mesh, list->materials[item->materialIndex], item->world);
+    }
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // NOTE: At this point the modelview matrix just contains the view matrix (camera)
+    rl_Matrix matView = rlGetMatrixModelview();
+    rl_Matrix matProjection = rlGetMatrixProjection();
+    rl_Matrix matTransform = rlGetMatrixTransform();
+
+    // Cached normal matrices are only valid with no rlgl internal transform (push/pop)
+    rl_Matrix matIdentity = MatrixIdentity();
+    bool transformIdentity = (memcmp(&matTransform, &matIdentity, sizeof(rl_Matrix)) == 0);
+
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    // Default shader materials write G-buffer inside rl_BeginDeferredMode(), restored after drawing
+    rl_Shader *listShaders = NULL;
+    if (deferredActive != NULL)
+    {
+        listShaders = (rl_Shader *)RL_MALLOC(list->materialCount*sizeof(rl_Shader));
+
+        for (int i = 0; i < list->materialCount; i++)
+        {
+            listShaders[i] = list->materials[i].shader;
+            list->materials[i].shader = GetDeferredShader(list->materials[i].shader);
+        }
+    }
+#endif
+
+    const rl_Material *current = NULL;
+    int currentMaterial = -1;
+    unsigned int currentMesh = 0;
+    int culledCount = 0;
+
+    for (int i = 0; i < list->itemCount; i++)
+    {
+        const DrawListCommand *command = &list->commands[i];
+        const DrawListItem *item = &list->items[command->item];
+        const rl_Material *material = &list->materials[item->materialIndex];
+
+        if (!list->models[item->modelIndex].visible || (material->shader.locs == NULL)) continue;
+
+        // Skip meshes outside current view or hidden in occlusion depth pyramid
+        if (IsMeshCulled(item->mesh, item->world))
+        {
+            culledCount++;
+            continue;
+        }
+
+        // Bind shader program and upload view and projection matrices on shader change
+        if ((current == NULL) || (current->shader.id != material->shader.id))
+        {
+            if (current != NULL) SetDrawListMaterial(NULL, current);
+
+            rlEnableShader(material->shader.id);
+
+            if (material->shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material->shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
+            if (material->shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material->shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
+
+            current = NULL;
+            currentMesh = 0;
+        }
+
+        // Bind material maps and upload material colors on material change
+        if ((current == NULL) || (item->materialIndex != currentMaterial))
+        {
+            SetDrawListMaterial(material, current);
+            current = material;
+            currentMaterial = item->materialIndex;
+        }
+
+        rl_Matrix matModel = transformIdentity? item->world : MatrixMultiply(item->world, matTransform);
+        rl_Matrix matModelView = MatrixMultiply(matModel, matView);
+
+        if (material->shader.locs[SHADER_LOC_MATRIX_MODEL] != -1) rlSetUniformMatrix(material->shader.locs[SHADER_LOC_MATRIX_MODEL], matModel);
+        if (material->shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1)
+        {
+            rlSetUniformMatrix(material->shader.locs[SHADER_LOC_MATRIX_NORMAL], transformIdentity? item->normal : GetNormalMatrix(matModel));
+        }
+
+#ifdef RL_SUPPORT_MESH_GPU_SKINNING
+        SetShaderBoneUniforms(material->shader, item->mesh);
+#endif
+
+        // Bind mesh vertex array (or vertex buffers) on mesh change
+        if ((command->meshId == 0) || (command->meshId != currentMesh))
+        {
+            if (!rlEnableVertexArray(item->mesh.vaoId)) EnableMeshVertexBuffers(item->mesh, material->shader);
+            currentMesh = command->meshId;
+        }
+
+        // Select mesh level of detail for current view
+        int indexOffset = 0;
+        int indexCount = GetMeshDrawIndexCount(item->mesh, item->world, &indexOffset);
+
+        for (int eye = 0; eye < eyeCount; eye++)
+        {
+            rl_Matrix matModelViewProjection = MatrixIdentity();
+            if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+            else
+            {
+                // Setup current eye viewport (half screen width)
+                rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+                matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+            }
+
+            rlSetUniformMatrix(material->shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+
+            if (item->mesh.indices != NULL) rlDrawVertexArrayElements(indexOffset, indexCount, 0);
+            else rlDrawVertexArray(0, item->mesh.vertexCount);
+        }
+    }
+
+    if (culledCount > 0) rlAddCulledMeshes(culledCount);
+
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    if (listShaders != NULL)
+    {
+        for (int i = 0; i < list->materialCount; i++) list->materials[i].shader = listShaders[i];
+        RL_FREE(listShaders);
+    }
+#endif
+
+    if (current != NULL)
+    {
+        SetDrawListMaterial(NULL, current);
+
+        // Disable all possible vertex array objects (or VBOs)
+        rlDisableVertexArray();
+        rlDisableVertexBuffer();
+        rlDisableVertexBufferElement();
+
+        rlDisableShader();
+    }
+
+    // Restore rlgl internal modelview and projection matrices
+    rlSetMatrixModelview(matView);
+    rlSetMatrixProjection(matProjection);
+#endif
+}
+
+// Unload draw list from memory
+// NOTE: Draw list meshes and materials are referenced, they are not unloaded
+void rl_UnloadDrawList(rl_DrawList *list)
+{
+    if (list == NULL) return;
+
+    RL_FREE(list->materials);
+    RL_FREE(list->models);
+    RL_FREE(list->items);
+    RL_FREE(list->commands);
+    RL_FREE(list);
+}
+
+// Enable frustum culling
+// NOTE: Meshes are tested using bounds computed by rl_UploadMesh()
+void rl_EnableFrustumCulling(void)
+{
+    frustumCulling = true;
+}
+
+// Disable frustum culling
+void rl_DisableFrustumCulling(void)
+{
+    frustumCulling = false;
+}
+
+// Enable occlusion culling
+// NOTE: Depth pyramid must be updated every frame with rl_UpdateOcclusionDepth()
+void rl_EnableOcclusionCulling(void)
+{
+#if defined(SUPPORT_OCCLUSION_CULLING)
+    occlusion.enabled = true;
+#endif
+}
+
+// Disable occlusion culling
+void rl_DisableOcclusionCulling(void)
+{
+#if defined(SUPPORT_OCCLUSION_CULLING)
+    // Deliver depth readbacks in flight, they reference occlusion data
+    if (occlusion.pending > 0) rlUpdateReadbacks(true);
+
+    RL_FREE(occlusion.levels[0]);
+    for (int i = 0; i < OCCLUSION_DEPTH_MAX_LEVELS; i++) occlusion.levels[i] = NULL;
+
+    occlusion.enabled = false;
+    occlusion.ready = false;
+    occlusion.levelCount = 0;
+    occlusion.capacity = 0;
+#endif
+}
+
+// Request target depth readback to build occlusion depth pyramid
+// NOTE: Must be called inside rl_BeginTextureMode(target) and rl_BeginMode3D(), after occluders are drawn,
+// current view-projection matrix is kept with the depth data, pyramid is available 1-2 frames later
+void rl_UpdateOcclusionDepth(rl_RenderTexture2D target)
+{
+#if defined(SUPPORT_OCCLUSION_CULLING)
+    if (!occlusion.enabled || (target.depth.id == 0)) return;
+
+    // Limit readbacks in flight, keeping one slot for other readback users (screenshots)
+    if (occlusion.pending >= 2) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+    rl_Matrix *viewProj = (rl_Matrix *)RL_MALLOC(sizeof(rl_Matrix));
+    *viewProj = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+    occlusion.pending++;
+    rlReadDepthPixelsAsync(target.texture.width, target.texture.height, BuildOcclusionDepth, viewProj);
+#else
+    TRACELOG(LOG_WARNING, "MODEL: Occlusion culling requires OpenGL 3.3 depth readback");
+    occlusion.enabled = false;
+#endif
+#endif
+}
+
+// Check if transformed bounding box is hidden in occlusion depth pyramid
+// NOTE: Box is projected with depth pyramid view-projection matrix and its nearest depth
+// is compared with the farthest depth of the pyramid texels covering its screen rectangle
+bool rl_IsBoundingBoxOccluded(rl_BoundingBox box, rl_Matrix transform)
+{
+    bool occluded = false;
+
+#if defined(SUPPORT_OCCLUSION_CULLING)
+    if (!occlusion.ready) return false;
+
+    // Empty bounds (not computed) are never occluded
+    if (Vector3Equals(box.min, box.max)) return false;
+
+    rl_Matrix matrix = MatrixMultiply(transform, occlusion.viewProj);
+    float minX = 1.0f, minY = 1.0f, maxX = -1.0f, maxY = -1.0f;
+    float minZ = 1.0f;
+
+    // Box corners transformed to clip space at once
+    float clipX[8] = { 0 };
+    float clipY[8] = { 0 };
+    float clipZ[8] = { 0 };
+    float clipW[8] = { 0 };
+
+    for (int i = 0; i < 8; i++)
+    {
+        clipX[i] = (i & 1)? box.max.x : box.min.x;
+        clipY[i] = (i & 2)? box.max.y : box.min.y;
+        clipZ[i] = (i & 4)? box.max.z : box.min.z;
+    }
+
+    Vector3TransformBatch(clipX, clipY, clipZ, clipW, 8, matrix);
+
+    for (int i = 0; i < 8; i++)
+    {
+        // Box crossing near plane is considered visible
+        if (clipW[i] <= 0.0001f) return false;
+
+        float ndcX = clipX[i]/clipW[i];
+        float ndcY = clipY[i]/clipW[i];
+        float ndcZ = clipZ[i]/clipW[i];
+
+        if (ndcX < minX) minX = ndcX;
+        if (ndcX > maxX) maxX = ndcX;
+        if (ndcY < minY) minY = ndcY;
+        if (ndcY > maxY) maxY = ndcY;
+        if (ndcZ < minZ) minZ = ndcZ;
+    }
+
+    // Box outside the view is not tested (frustum culling case)
+    if ((maxX < -1.0f) || (minX > 1.0f) || (maxY < -1.0f) || (minY > 1.0f)) return false;
+
+    // Get box rectangle in base level texels
+    float baseWidth = (float)occlusion.widths[0];
+    float baseHeight = (float)occlusion.heights[0];
+    float x0 = Clamp((minX*0.5f + 0.5f)*baseWidth, 0.0f, baseWidth - 1.0f);
+    float x1 = Clamp((maxX*0.5f + 0.5f)*baseWidth, 0.0f, baseWidth - 1.0f);
+    float y0 = Clamp((minY*0.5f + 0.5f)*baseHeight, 0.0f, baseHeight - 1.0f);
+    float y1 = Clamp((maxY*0.5f + 0.5f)*baseHeight, 0.0f, baseHeight - 1.0f);
+
+    // Select level where rectangle covers at most 2x2 texels
+    int level = 0;
+    float size = fmaxf(x1 - x0, y1 - y0);
+    while ((size > 1.0f) && (level < (occlusion.levelCount - 1))) { size *= 0.5f; level++; }
+
+    int tx0 = (int)x0 >> level;
+    int tx1 = (int)x1 >> level;
+    int ty0 = (int)y0 >> level;
+    int ty1 = (int)y1 >> level;
+    if (tx1 >= occlusion.widths[level]) tx1 = occlusion.widths[level] - 1;
+    if (ty1 >= occlusion.heights[level]) ty1 = occlusion.heights[level] - 1;
+
+    float farDepth = 0.0f;
+    for (int y = ty0; y <= ty1; y++)
+    {
+        for (int x = tx0; x <= tx1; x++)
+        {
+            float depth = occlusion.levels[level][y*occlusion.widths[level] + x];
+            if (depth > farDepth) farDepth = depth;
+        }
+    }
+
+    occluded = ((minZ*0.5f + 0.5f) > farDepth);
+#endif
+
+    return occluded;
+}
+
+// Load cascaded shadow map, depth texture array with one layer per cascade
+// NOTE: Cascades split camera view from near cull distance up to provided distance
+rl_ShadowMap *rl_LoadShadowMap(int size, int cascadeCount, float distance)
+{
+    rl_ShadowMap *shadowMap = NULL;
+
+#if defined(SUPPORT_SHADOW_MAPS) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    if ((size <= 0) || (cascadeCount <= 0) || (distance <= 0.0f)) return NULL;
+
+    if (cascadeCount > MAX_SHADOW_MAP_CASCADES)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Shadow map cascades limited to %i (MAX_SHADOW_MAP_CASCADES)", MAX_SHADOW_MAP_CASCADES);
+        cascadeCount = MAX_SHADOW_MAP_CASCADES;
+    }
+
+    // Load shadow depth shader, shared by all shadow maps
+    if (shadowShader.id == 0)
+    {
+        unsigned int shaderId = rlLoadShaderCode(shadowShaderVsCode, shadowShaderFsCode);
+
+        if ((shaderId > 0) && (shaderId != rlGetShaderIdDefault()))
+        {
+            shadowShader.id = shaderId;
+            shadowShader.mvpLoc = rlGetLocationUniform(shaderId, "mvp");
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "MODEL: Failed to load shadow map shader");
+            return NULL;
+        }
+    }
+
+    shadowMap = (rl_ShadowMap *)RL_CALLOC(1, sizeof(rl_ShadowMap));
+    shadowMap->depth.id = rlLoadTextureDepthArray(size, size, cascadeCount);
+    shadowMap->depth.width = size;
+    shadowMap->depth.height = size;
+    shadowMap->depth.layers = cascadeCount;
+    shadowMap->depth.mipmaps = 1;
+    shadowMap->depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+    shadowMap->cascadeCount = cascadeCount;
+    shadowMap->distance = distance;
+    shadowMap->direction = (rl_Vector3){ 0.0f, -1.0f, 0.0f };
+
+    // Depth only framebuffer, first layer attached to check completeness
+    shadowMap->fboId = rlLoadFramebuffer();
+    rlFramebufferAttachLayer(shadowMap->fboId, shadowMap->depth.id, RL_ATTACHMENT_DEPTH, 0, 0);
+    rlEnableFramebuffer(shadowMap->fboId);
+    rlActiveDrawBuffers(0);
+    rlDisableFramebuffer();
+
+    if ((shadowMap->depth.id == 0) || !rlFramebufferComplete(shadowMap->fboId))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Failed to load shadow map framebuffer");
+        if (shadowMap->fboId > 0) rlUnloadFramebuffer(shadowMap->fboId);
+        else rlUnloadTexture(shadowMap->depth.id);
+        RL_FREE(shadowMap);
+
+        if (shadowShader.users == 0)
+        {
+            rlUnloadShaderProgram(shadowShader.id);
+            shadowShader.id = 0;
+        }
+
+        return NULL;
+    }
+
+    shadowShader.users++;
+
+    TRACELOG(LOG_INFO, "MODEL: [ID %i] Shadow map loaded successfully (%ix%i, %i cascades)", shadowMap->fboId, size, size, cascadeCount);
+#else
+    TRACELOG(LOG_WARNING, "MODEL: Shadow maps require OpenGL 3.3 or OpenGL ES 3.0 (SUPPORT_SHADOW_MAPS)");
+#endif
+
+    return shadowMap;
+}
+
+// Set shadow map directional light direction
+// NOTE: All cascades are redrawn on next update when direction changes
+void rl_SetShadowMapLight(rl_ShadowMap *shadowMap, rl_Vector3 direction)
+{
+    if ((shadowMap == NULL) || (Vector3LengthSqr(direction) == 0.0f)) return;
+
+    direction = Vector3Normalize(direction);
+
+    if (!Vector3Equals(direction, shadowMap->direction))
+    {
+        shadowMap->direction = direction;
+        for (int i = 0; i < shadowMap->cascadeCount; i++) shadowMap->cascades[i].valid = false;
+    }
+}
+
+// Update shadow map cascades for camera view, returns number of cascades drawn
+// NOTE: Cascades are only drawn when their matrix changed or a casters draw list model was added,
+// moved or hidden inside them; must be called out of rl_BeginTextureMode() and rl_BeginMode3D(),
+// camera aspect ratio is taken from default framebuffer, skinned meshes do not cast shadows
+int rl_UpdateShadowMap(rl_ShadowMap *shadowMap, rl_Camera camera, const rl_DrawList *casters)
+{
+    int drawn = 0;
+
+#if defined(SUPPORT_SHADOW_MAPS) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    if ((shadowMap == NULL) || (shadowMap->fboId == 0)) return 0;
+
+    float aspect = (float)rlGetFramebufferWidth()/(float)rlGetFramebufferHeight();
+    float nearDistance = (float)rlGetCullDistanceNear();
+    float farDistance = fmaxf(shadowMap->distance, nearDistance*2.0f);
+
+    rl_Vector3 forward = Vector3Normalize(Vector3Subtract(camera.target, camera.position));
+    rl_Vector3 right = Vector3Normalize(Vector3CrossProduct(forward, camera.up));
+    rl_Vector3 up = Vector3CrossProduct(right, forward);
+
+    // Light view rotation is fixed, cascades only move in light view plane (no shimmering on camera rotation)
+    rl_Vector3 lightUp = (fabsf(shadowMap->direction.y) > 0.99f)? (rl_Vector3){ 1.0f, 0.0f, 0.0f } : (rl_Vector3){ 0.0f, 1.0f, 0.0f };
+    rl_Matrix matLightView = MatrixLookAt(Vector3Zero(), shadowMap->direction, lightUp);
+
+    float splitNear = nearDistance;
+
+    for (int i = 0; i < shadowMap->cascadeCount; i++)
+    {
+        ShadowCascade *cascade = &shadowMap->cascades[i];
+
+        // Practical split scheme, logarithmic and uniform distributions blended
+        float p = (float)(i + 1)/(float)shadowMap->cascadeCount;
+        float splitLog = nearDistance*powf(farDistance/nearDistance, p);
+        float splitUniform = nearDistance + (farDistance - nearDistance)*p;
+        float splitFar = SHADOW_MAP_SPLIT_LAMBDA*splitLog + (1.0f - SHADOW_MAP_SPLIT_LAMBDA)*splitUniform;
+
+        // View frustum slice corners, bounding sphere fitted (radius rounded to keep it constant)
+        rl_Vector3 corners[8] = { 0 };
+        rl_Vector3 center = { 0 };
+
+        for (int j = 0; j < 8; j++)
+        {
+            float d = (j < 4)? splitNear : splitFar;
+            float h = (camera.projection == CAMERA_PERSPECTIVE)? d*tanf(camera.fovy*0.5f*rl_DEG2RAD) : camera.fovy*0.5f;
+            float w = h*aspect;
+            rl_Vector3 point = Vector3Add(camera.position, Vector3Scale(forward, d));
+            point = Vector3Add(point, Vector3Scale(right, (j & 1)? w : -w));
+            corners[j] = Vector3Add(point, Vector3Scale(up, (j & 2)? h : -h));
+            center = Vector3Add(center, corners[j]);
+        }
+
+        center = Vector3Scale(center, 1.0f/8.0f);
+
+        float radius = 0.0f;
+        for (int j = 0; j < 8; j++) radius = fmaxf(radius, Vector3Distance(center, corners[j]));
+        radius = ceilf(radius*16.0f)/16.0f;
+
+        // Sphere center snapped to shadow map texels in light view space
+        float texelSize = 2.0f*radius/(float)shadowMap->depth.width;
+        rl_Vector3 lightCenter = Vector3Transform(center, matLightView);
+        lightCenter.x = floorf(lightCenter.x/texelSize)*texelSize;
+        lightCenter.y = floorf(lightCenter.y/texelSize)*texelSize;
+        lightCenter.z = floorf(lightCenter.z/texelSize)*texelSize;
+
+        rl_Matrix matLightProj = MatrixOrtho(lightCenter.x - radius, lightCenter.x + radius, lightCenter.y - radius, lightCenter.y + radius,
+                                             -lightCenter.z - radius, -lightCenter.z + radius);
+        rl_Matrix viewProj = MatrixMultiply(matLightView, matLightProj);
+
+        cascade->splitFar = splitFar;
+        splitNear = splitFar;
+
+        if (IsShadowCascadeCached(cascade, casters, viewProj)) continue;
+
+        if (drawn == 0)
+        {
+            rlDrawRenderBatchActive();      // Update and draw internal render batch
+            rlEnableDepthTest();
+            rlEnableDepthMask();
+        }
+
+        cascade->viewProj = viewProj;
+        DrawShadowCascade(shadowMap, i, casters);
+
+        cascade->valid = true;
+        cascade->casters = casters;
+        cascade->version = (casters != NULL)? casters->version : 0;
+        drawn++;
+    }
+
+    if (drawn > 0)
+    {
+        rlDisableVertexArray();
+        rlDisableShader();
+        rlDisableFramebuffer();
+        rlViewport(0, 0, rlGetFramebufferWidth(), rlGetFramebufferHeight());
+        rlDisableDepthTest();
+    }
+#endif
+
+    return drawn;
+}
+
+// Set shader shadow map uniforms
+// NOTE: Expected uniforms: sampler2DArrayShadow shadowMap, mat4 shadowMatrices[], float shadowSplits[] (camera view depth
+// where every cascade ends) and int shadowCascadeCount; shadowMatrices transform world positions to cascade clip space,
+// depth texture array stays bound to texture slot MAX_MATERIAL_MAPS + 1 (not used by materials)
+void rl_SetShaderShadowMap(rl_Shader shader, const rl_ShadowMap *shadowMap)
+{
+#if defined(SUPPORT_SHADOW_MAPS) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    if ((shadowMap == NULL) || (shadowMap->fboId == 0)) return;
+
+    rl_Matrix matrices[MAX_SHADOW_MAP_CASCADES] = { 0 };
+    float splits[MAX_SHADOW_MAP_CASCADES] = { 0 };
+
+    for (int i = 0; i < shadowMap->cascadeCount; i++)
+    {
+        matrices[i] = shadowMap->cascades[i].viewProj;
+        splits[i] = shadowMap->cascades[i].splitFar;
+    }
+
+    rlEnableShader(shader.id);
+
+    int locIndex = rlGetLocationUniform(shader.id, "shadowMatrices");
+    if (locIndex > -1) rlSetUniformMatrices(locIndex, matrices, shadowMap->cascadeCount);
+
+    locIndex = rlGetLocationUniform(shader.id, "shadowSplits");
+    if (locIndex > -1) rlSetUniform(locIndex, splits, RL_SHADER_UNIFORM_FLOAT, shadowMap->cascadeCount);
+
+    locIndex = rlGetLocationUniform(shader.id, "shadowCascadeCount");
+    if (locIndex > -1) rlSetUniform(locIndex, &shadowMap->cascadeCount, RL_SHADER_UNIFORM_INT, 1);
+
+    // Bind depth texture array, after material maps and bone palette texture slots
+    locIndex = rlGetLocationUniform(shader.id, "shadowMap");
+    if (locIndex > -1)
+    {
+        int slot = MAX_MATERIAL_MAPS + 1;
+
+        rlActiveTextureSlot(slot);
+        rlEnableTextureArray(shadowMap->depth.id);
+        rlSetUniform(locIndex, &slot, RL_SHADER_UNIFORM_INT, 1);
+        rlActiveTextureSlot(0);
+    }
+#endif
+}
+
+// Get shadow map cascades depth texture array
+rl_TextureArray rl_GetShadowMapTexture(const rl_ShadowMap *shadowMap)
+{
+    rl_TextureArray texture = { 0 };
+
+    if (shadowMap != NULL) texture = shadowMap->depth;
+
+    return texture;
+}
+
+// Unload shadow map from memory (RAM and VRAM)
+// NOTE: Depth texture array attached to framebuffer is unloaded with it
+void rl_UnloadShadowMap(rl_ShadowMap *shadowMap)
+{
+    if (shadowMap == NULL) return;
+
+#if defined(SUPPORT_SHADOW_MAPS) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    rlUnloadFramebuffer(shadowMap->fboId);
+
+    shadowShader.users--;
+    if ((shadowShader.users <= 0) && (shadowShader.id > 0))
+    {
+        rlUnloadShaderProgram(shadowShader.id);
+        shadowShader.id = 0;
+        shadowShader.users = 0;
+    }
+#endif
+
+    RL_FREE(shadowMap);
+}
+
+// Load deferred renderer, G-buffer and lighting pass resources
+// NOTE: G-buffer size should match the target size lighting is drawn into (screen or render texture)
+rl_DeferredRenderer *rl_LoadDeferredRenderer(int width, int height)
+{
+    rl_DeferredRenderer *renderer = NULL;
+
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    if ((width <= 0) || (height <= 0)) return NULL;
+
+    // Load deferred shaders, shared by all deferred renderers
+    if (deferredShaders.users == 0)
+    {
+        deferredShaders.geometry = rl_LoadShaderFromMemory(deferredGeometryVsCode, deferredGeometryFsCode);
+        deferredShaders.ambientId = rlLoadShaderCode(deferredAmbientVsCode, deferredAmbientFsCode);
+        deferredShaders.lightId = rlLoadShaderCode(deferredLightVsCode, deferredLightFsCode);
+
+        unsigned int defaultId = rlGetShaderIdDefault();
+        if ((deferredShaders.geometry.id == defaultId) || (deferredShaders.ambientId == defaultId) || (deferredShaders.lightId == defaultId))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: Failed to load deferred rendering shaders");
+            if (deferredShaders.geometry.id != defaultId) rl_UnloadShader(deferredShaders.geometry);
+            if (deferredShaders.ambientId != defaultId) rlUnloadShaderProgram(deferredShaders.ambientId);
+            if (deferredShaders.lightId != defaultId) rlUnloadShaderProgram(deferredShaders.lightId);
+            deferredShaders.geometry = (rl_Shader){ 0 };
+            deferredShaders.ambientId = 0;
+            deferredShaders.lightId = 0;
+
+            return NULL;
+        }
+
+        deferredShaders.ambientLocs[0] = rlGetLocationUniform(deferredShaders.ambientId, "gAlbedoSpec");
+        deferredShaders.ambientLocs[1] = rlGetLocationUniform(deferredShaders.ambientId, "gDepth");
+        deferredShaders.ambientLocs[2] = rlGetLocationUniform(deferredShaders.ambientId, "ambient");
+        deferredShaders.lightLocs[0] = rlGetLocationUniform(deferredShaders.lightId, "gAlbedoSpec");
+        deferredShaders.lightLocs[1] = rlGetLocationUniform(deferredShaders.lightId, "gNormal");
+        deferredShaders.lightLocs[2] = rlGetLocationUniform(deferredShaders.lightId, "gDepth");
+        deferredShaders.lightLocs[3] = rlGetLocationUniform(deferredShaders.lightId, "viewProj");
+        deferredShaders.lightLocs[4] = rlGetLocationUniform(deferredShaders.lightId, "invViewProj");
+        deferredShaders.lightLocs[5] = rlGetLocationUniform(deferredShaders.lightId, "viewPosition");
+        deferredShaders.lightLocs[6] = rlGetLocationUniform(deferredShaders.lightId, "screenSize");
+    }
+
+    rlGBuffer gbuffer = rlLoadGBuffer(width, height);
+    if (gbuffer.id == 0)
+    {
+        if (deferredShaders.users == 0)
+        {
+            rl_UnloadShader(deferredShaders.geometry);
+            rlUnloadShaderProgram(deferredShaders.ambientId);
+            rlUnloadShaderProgram(deferredShaders.lightId);
+            deferredShaders.geometry = (rl_Shader){ 0 };
+            deferredShaders.ambientId = 0;
+            deferredShaders.lightId = 0;
+        }
+
+        return NULL;
+    }
+
+    renderer = (rl_DeferredRenderer *)RL_CALLOC(1, sizeof(rl_DeferredRenderer));
+    renderer->gbuffer = gbuffer;
+
+    // Light volume, unit sphere circumscribed polyhedron, instances attributes advance once per light
+    float *vertices = GenLightVolumeVertices(&renderer->volumeVertexCount);
+    int positionLoc = rlGetLocationAttrib(deferredShaders.lightId, "vertexPosition");
+    int lightPositionLoc = rlGetLocationAttrib(deferredShaders.lightId, "lightPosition");
+    int lightColorLoc = rlGetLocationAttrib(deferredShaders.lightId, "lightColor");
+    int stride = sizeof(DeferredLightInstance);
+
+    renderer->volumeVaoId = rlLoadVertexArray();
+    rlEnableVertexArray(renderer->volumeVaoId);
+    renderer->volumeVboId = rlLoadVertexBuffer(vertices, renderer->volumeVertexCount*3*sizeof(float), false);
+    rlSetVertexAttribute(positionLoc, 3, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(positionLoc);
+
+    renderer->lightsCapacity = 64;
+    renderer->lights = (DeferredLightInstance *)RL_MALLOC(renderer->lightsCapacity*sizeof(DeferredLightInstance));
+    renderer->lightsVboId = rlLoadVertexBuffer(NULL, renderer->lightsCapacity*stride, true);
+    rlSetVertexAttribute(lightPositionLoc, 4, RL_FLOAT, false, stride, 0);
+    rlSetVertexAttribute(lightColorLoc, 3, RL_FLOAT, false, stride, 4*sizeof(float));
+    rlEnableVertexAttribute(lightPositionLoc);
+    rlEnableVertexAttribute(lightColorLoc);
+    rlSetVertexAttributeDivisor(lightPositionLoc, 1);
+    rlSetVertexAttributeDivisor(lightColorLoc, 1);
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+
+    RL_FREE(vertices);
+
+    renderer->screenVaoId = rlLoadVertexArray();
+
+    deferredShaders.users++;
+
+    TRACELOG(LOG_INFO, "MODEL: [ID %i] Deferred renderer loaded successfully (%ix%i)", gbuffer.id, width, height);
+#else
+    TRACELOG(LOG_WARNING, "MODEL: Deferred rendering requires OpenGL 3.3 or OpenGL ES 3.0 (SUPPORT_DEFERRED_RENDERING)");
+#endif
+
+    return renderer;
+}
+
+// Begin G-buffer pass, 3D mode with camera into renderer G-buffer
+// NOTE: Meshes drawn with default shader materials (rl_DrawMesh(), models, draw lists) use G-buffer shader,
+// custom material shaders must write G-buffer outputs (see rl_GetDeferredShader()), color blending is disabled
+void rl_BeginDeferredMode(rl_DeferredRenderer *renderer, rl_Camera camera)
+{
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    if ((renderer == NULL) || (renderer->gbuffer.id == 0)) return;
+
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+    rlEnableFramebuffer(renderer->gbuffer.id);
+    rlViewport(0, 0, renderer->gbuffer.width, renderer->gbuffer.height);
+    rlClearColor(0, 0, 0, 0);
+    rlClearScreenBuffers();
+
+    rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
+    rlPushMatrix();                 // Save previous matrix (projection)
+    rlLoadIdentity();               // Reset current matrix (projection)
+
+    double aspect = (double)renderer->gbuffer.width/(double)renderer->gbuffer.height;
+    double top = (camera.projection == CAMERA_PERSPECTIVE)? rlGetCullDistanceNear()*tan(camera.fovy*0.5*rl_DEG2RAD) : camera.fovy/2.0;
+    double right = top*aspect;
+
+    if (camera.projection == CAMERA_PERSPECTIVE) rlFrustum(-right, right, -top, top, rlGetCullDistanceNear(), rlGetCullDistanceFar());
+    else rlOrtho(-right, right, -top, top, rlGetCullDistanceNear(), rlGetCullDistanceFar());
+
+    rlMatrixMode(RL_MODELVIEW);     // Switch back to modelview matrix
+    rlLoadIdentity();               // Reset current matrix (modelview)
+
+    rl_Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+    rlMultMatrixf(MatrixToFloat(matView));
+
+    rlUpdateCameraBlock();          // Update camera uniform block (shared by shaders)
+
+    rlEnableDepthTest();
+    rlDisableColorBlend();
+
+    renderer->viewProj = MatrixMultiply(matView, rlGetMatrixProjection());
+    renderer->viewPosition = camera.position;
+    deferredActive = renderer;
+#endif
+}
+
+// End G-buffer pass, default framebuffer and 2D projection restored
+void rl_EndDeferredMode(void)
+{
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    if (deferredActive == NULL) return;
+
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+    rlMatrixMode(RL_PROJECTION);    // Switch to projection matrix
+    rlPopMatrix();                  // Restore previous matrix (projection) from matrix stack
+    rlMatrixMode(RL_MODELVIEW);     // Switch back to modelview matrix
+    rlLoadIdentity();               // Reset current matrix (modelview)
+
+    rlUpdateCameraBlock();          // Update camera uniform block (shared by shaders)
+
+    rlDisableDepthTest();
+    rlEnableColorBlend();
+
+    rlDisableFramebuffer();
+    rlViewport(0, 0, rlGetFramebufferWidth(), rlGetFramebufferHeight());
+
+    deferredActive = NULL;
+#endif
+}
+
+// Draw lit scene into current target: ambient pass and point lights volumes
+// NOTE: Scene depth is written to current target, forward rendered objects (transparent, unlit) can be
+// drawn after it with same camera; background pixels (nothing drawn in G-buffer) are not modified
+void rl_DrawDeferredLighting(rl_DeferredRenderer *renderer, const rl_DeferredLight *lights, int count, rl_Color ambient)
+{
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    if ((renderer == NULL) || (renderer->gbuffer.id == 0)) return;
+
+    rlDrawRenderBatchActive();      // Update and draw internal render batch
+
+    // Bind G-buffer textures to first texture slots
+    unsigned int textures[3] = { renderer->gbuffer.albedo, renderer->gbuffer.normal, renderer->gbuffer.depth };
+    int slots[3] = { 0, 1, 2 };
+
+    for (int i = 0; i < 3; i++)
+    {
+        rlActiveTextureSlot(i);
+        rlEnableTexture(textures[i]);
+    }
+
+    // Ambient pass, full screen triangle writing scene depth
+    rlEnableDepthTest();
+    rlEnableDepthMask();
+    rlDisableColorBlend();
+
+    float ambientColor[3] = { (float)ambient.r/255.0f, (float)ambient.g/255.0f, (float)ambient.b/255.0f };
+
+    rlEnableShader(deferredShaders.ambientId);
+    rlSetUniform(deferredShaders.ambientLocs[0], &slots[0], RL_SHADER_UNIFORM_INT, 1);
+    rlSetUniform(deferredShaders.ambientLocs[1], &slots[2], RL_SHADER_UNIFORM_INT, 1);
+    rlSetUniform(deferredShaders.ambientLocs[2], ambientColor, RL_SHADER_UNIFORM_VEC3, 1);
+    rlEnableVertexArray(renderer->screenVaoId);
+    rlDrawVertexArray(0, 3);
+
+    // Lights pass, volumes back faces drawn without depth test (camera can be inside volumes)
+    if ((lights != NULL) && (count > 0))
+    {
+        if (count > renderer->lightsCapacity)
+        {
+            while (renderer->lightsCapacity < count) renderer->lightsCapacity *= 2;
+
+            renderer->lights = (DeferredLightInstance *)RL_REALLOC(renderer->lights, renderer->lightsCapacity*sizeof(DeferredLightInstance));
+            rlEnableVertexArray(renderer->volumeVaoId);
+            rlUnloadVertexBuffer(renderer->lightsVboId);
+            renderer->lightsVboId = rlLoadVertexBuffer(NULL, renderer->lightsCapacity*sizeof(DeferredLightInstance), true);
+
+            int stride = sizeof(DeferredLightInstance);
+            int lightPositionLoc = rlGetLocationAttrib(deferredShaders.lightId, "lightPosition");
+            int lightColorLoc = rlGetLocationAttrib(deferredShaders.lightId, "lightColor");
+            rlSetVertexAttribute(lightPositionLoc, 4, RL_FLOAT, false, stride, 0);
+            rlSetVertexAttribute(lightColorLoc, 3, RL_FLOAT, false, stride, 4*sizeof(float));
+        }
+
+        int lightCount = 0;
+        for (int i = 0; i < count; i++)
+        {
+            if ((lights[i].radius <= 0.0f) || (lights[i].intensity <= 0.0f)) continue;
+
+            float intensity = lights[i].intensity/255.0f;
+            DeferredLightInstance *instance = &renderer->lights[lightCount];
+            instance->position = (rl_Vector4){ lights[i].position.x, lights[i].position.y, lights[i].position.z, lights[i].radius };
+            instance->color = (rl_Vector3){ lights[i].color.r*intensity, lights[i].color.g*intensity, lights[i].color.b*intensity };
+            lightCount++;
+        }
+
+        if (lightCount > 0)
+        {
+            rl_Matrix invViewProj = MatrixInvert(renderer->viewProj);
+            float screenSize[2] = { (float)renderer->gbuffer.width, (float)renderer->gbuffer.height };
+
+            rlUpdateVertexBuffer(renderer->lightsVboId, renderer->lights, lightCount*sizeof(DeferredLightInstance), 0);
+
+            rlDisableDepthTest();
+            rlEnableColorBlend();
+            rlSetBlendMode(RL_BLEND_ADDITIVE);
+            rlSetCullFace(RL_CULL_FACE_FRONT);
+
+            rlEnableShader(deferredShaders.lightId);
+            for (int i = 0; i < 3; i++) rlSetUniform(deferredShaders.lightLocs[i], &slots[i], RL_SHADER_UNIFORM_INT, 1);
+            rlSetUniformMatrix(deferredShaders.lightLocs[3], renderer->viewProj);
+            rlSetUniformMatrix(deferredShaders.lightLocs[4], invViewProj);
+            rlSetUniform(deferredShaders.lightLocs[5], &renderer->viewPosition, RL_SHADER_UNIFORM_VEC3, 1);
+            rlSetUniform(deferredShaders.lightLocs[6], screenSize, RL_SHADER_UNIFORM_VEC2, 1);
+
+            rlEnableVertexArray(renderer->volumeVaoId);
+            rlDrawVertexArrayInstanced(0, renderer->volumeVertexCount, lightCount);
+
+            rlSetCullFace(RL_CULL_FACE_BACK);
+            rlSetBlendMode(RL_BLEND_ALPHA);
+        }
+    }
+
+    for (int i = 2; i >= 0; i--)
+    {
+        rlActiveTextureSlot(i);
+        rlDisableTexture();
+    }
+
+    rlDisableVertexArray();
+    rlDisableShader();
+    rlDisableDepthTest();
+    rlEnableColorBlend();
+#endif
+}
+
+// Get G-buffer pass material shader
+// NOTE: Custom G-buffer shaders must write albedo and specular strength to output location 0,
+// octahedral encoded world normal (rg, 0..1 range) to output location 1
+rl_Shader rl_GetDeferredShader(void)
+{
+    rl_Shader shader = { 0 };
+
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    shader = deferredShaders.geometry;
+#endif
+
+    return shader;
+}
+
+// Get G-buffer texture: 0-albedo/specular, 1-normals (octahedral), 2-depth
+rl_Texture2D rl_GetDeferredTexture(const rl_DeferredRenderer *renderer, int index)
+{
+    rl_Texture2D texture = { 0 };
+
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    if ((renderer == NULL) || (index < 0) || (index > 2)) return texture;
+
+    unsigned int ids[3] = { renderer->gbuffer.albedo, renderer->gbuffer.normal, renderer->gbuffer.depth };
+
+    texture.id = ids[index];
+    texture.width = renderer->gbuffer.width;
+    texture.height = renderer->gbuffer.height;
+    texture.mipmaps = 1;
+    texture.format = (index == 2)? 19 : PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;     //DEPTH_COMPONENT_24BIT?
+#endif
+
+    return texture;
+}
+
+// Unload deferred renderer from memory (RAM and VRAM)
+void rl_UnloadDeferredRenderer(rl_DeferredRenderer *renderer)
+{
+    if (renderer == NULL) return;
+
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+    if (deferredActive == renderer) rl_EndDeferredMode();
+
+    rlUnloadGBuffer(renderer->gbuffer);
+    rlUnloadVertexArray(renderer->volumeVaoId);
+    rlUnloadVertexArray(renderer->screenVaoId);
+    rlUnloadVertexBuffer(renderer->volumeVboId);
+    rlUnloadVertexBuffer(renderer->lightsVboId);
+    RL_FREE(renderer->lights);
+
+    deferredShaders.users--;
+    if (deferredShaders.users <= 0)
+    {
+        rl_UnloadShader(deferredShaders.geometry);
+        rlUnloadShaderProgram(deferredShaders.ambientId);
+        rlUnloadShaderProgram(deferredShaders.lightId);
+        deferredShaders.geometry = (rl_Shader){ 0 };
+        deferredShaders.ambientId = 0;
+        deferredShaders.lightId = 0;
+        deferredShaders.users = 0;
+    }
+#endif
+
+    RL_FREE(renderer);
+}
+
+// Draw a billboard
+void rl_DrawBillboard(rl_Camera camera, rl_Texture2D texture, rl_Vector3 position, float scale, rl_Color tint)
+{
+    rl_Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+    rl_DrawBillboardRec(camera, texture, source, position, (rl_Vector2){ scale*fabsf((float)source.width/source.height), scale }, tint);
+}
+
+// Draw a billboard (part of a texture defined by a rectangle)
+void rl_DrawBillboardRec(rl_Camera camera, rl_Texture2D texture, rl_Rectangle source, rl_Vector3 position, rl_Vector2 size, rl_Color tint)
+{
+    // NOTE: Billboard locked on axis-Y
+    rl_Vector3 up = { 0.0f, 1.0f, 0.0f };
+
+    rl_DrawBillboardPro(camera, texture, source, position, up, size, Vector2Scale(size, 0.5), 0.0f, tint);
+}
+
+// Draw a billboard with additional parameters
+void rl_DrawBillboardPro(rl_Camera camera, rl_Texture2D texture, rl_Rectangle source, rl_Vector3 position, rl_Vector3 up, rl_Vector2 size, rl_Vector2 origin, float rotation, rl_Color tint)
+{
+    // Compute the up vector and the right vector
+    rl_Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+    rl_Vector3 right = { matView.m0, matView.m4, matView.m8 };
+    right = Vector3Scale(right, size.x);
+    up = Vector3Scale(up, size.y);
+
+    // Flip the content of the billboard while maintaining the counterclockwise edge rendering order
+    if (size.x < 0.0f)
+    {
+        source.x -= size.x;
+        source.width *= -1.0;
+        right = Vector3Negate(right);
+        origin.x *= -1.0f;
+    }
+    if (size.y < 0.0f)
+    {
+        source.y -= size.y;
+        source.height *= -1.0;
+        up = Vector3Negate(up);
+        origin.y *= -1.0f;
+    }
+
+    // Draw the texture region described by source on the following rectangle in 3D space:
+    //
+    //                size.x          <--.
+    //  3 ^---------------------------+ 2 \ rotation
+    //    |                           |   /
+    //    |                           |
+    //    |   origin.x   position     |
+    // up |..............             | size.y
+    //    |             .             |
+    //    |             . origin.y    |
+    //    |             .             |
+    //  0 +---------------------------> 1
+    //                right
+    rl_Vector3 forward;
+    if (rotation != 0.0) forward = Vector3CrossProduct(right, up);
+
+    rl_Vector3 origin3D = Vector3Add(Vector3Scale(Vector3Normalize(right), origin.x), Vector3Scale(Vector3Normalize(up), origin.y));
+
+    rl_Vector3 points[4];
+    points[0] = Vector3Zero();
+    points[1] = right;
+    points[2] = Vector3Add(up, right);
+    points[3] = up;
+
+    for (int i = 0; i < 4; i++)
+    {
+        points[i] = Vector3Subtract(points[i], origin3D);
+        if (rotation != 0.0) points[i] = Vector3RotateByAxisAngle(points[i], forward, rotation*rl_DEG2RAD);
+        points[i] = Vector3Add(points[i], position);
+    }
+
+    rl_Vector2 texcoords[4];
+    texcoords[0] = (rl_Vector2){ (float)source.x/texture.width, (float)(source.y + source.height)/texture.height };
+    texcoords[1] = (rl_Vector2){ (float)(source.x + source.width)/texture.width, (float)(source.y + source.height)/texture.height };
+    texcoords[2] = (rl_Vector2){ (float)(source.x + source.width)/texture.width, (float)source.y/texture.height };
+    texcoords[3] = (rl_Vector2){ (float)source.x/texture.width, (float)source.y/texture.height };
+
+    rlSetTexture(texture.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        for (int i = 0; i < 4; i++)
+        {
+            rlTexCoord2f(texcoords[i].x, texcoords[i].y);
+            rlVertex3f(points[i].x, points[i].y, points[i].z);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Load billboard batch, billboards are drawn with instancing (quads expanded on GPU)
+rl_BillboardBatch *rl_LoadBillboardBatch(int capacity)
+{
+    if (capacity <= 0) return NULL;
+
+    rl_BillboardBatch *batch = (rl_BillboardBatch *)RL_CALLOC(1, sizeof(rl_BillboardBatch));
+    int chunkCount = (capacity + BILLBOARD_SORT_CHUNK_SIZE - 1)/BILLBOARD_SORT_CHUNK_SIZE;
+
+    batch->instances = (rl_BillboardInstance *)RL_MALLOC(capacity*sizeof(rl_BillboardInstance));
+    batch->sorted = (rl_BillboardInstance *)RL_MALLOC(capacity*sizeof(rl_BillboardInstance));
+    batch->keys = (unsigned int *)RL_MALLOC(2*capacity*sizeof(unsigned int));
+    batch->indices = (int *)RL_MALLOC(2*capacity*sizeof(int));
+    batch->histograms = (int *)RL_MALLOC(chunkCount*256*sizeof(int));
+    batch->capacity = capacity;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Load billboard shader, shared by all billboard batches
+    if (billboardShader.id == 0)
+    {
+        unsigned int shaderId = rlLoadShaderCode(billboardShaderVsCode, billboardShaderFsCode);
+
+        if ((shaderId > 0) && (shaderId != rlGetShaderIdDefault()))
+        {
+            billboardShader.id = shaderId;
+            billboardShader.mvpLoc = rlGetLocationUniform(shaderId, "mvp");
+            billboardShader.rightLoc = rlGetLocationUniform(shaderId, "viewRight");
+            billboardShader.upLoc = rlGetLocationUniform(shaderId, "viewUp");
+            billboardShader.sourceLoc = rlGetLocationUniform(shaderId, "source");
+            billboardShader.textureLoc = rlGetLocationUniform(shaderId, "texture0");
+            billboardShader.cornerLoc = rlGetLocationAttrib(shaderId, "vertexPosition");
+            billboardShader.positionLoc = rlGetLocationAttrib(shaderId, "instancePosition");
+            billboardShader.sizeLoc = rlGetLocationAttrib(shaderId, "instanceSize");
+            billboardShader.colorLoc = rlGetLocationAttrib(shaderId, "instanceColor");
+        }
+        else TRACELOG(LOG_WARNING, "MODEL: Failed to load billboard batch shader");
+    }
+
+    if (billboardShader.id > 0)
+    {
+        // Quad corners, centered at billboard position (counter-clockwise)
+        float corners[8] = { -0.5f, -0.5f, 0.5f, -0.5f, 0.5f, 0.5f, -0.5f, 0.5f };
+        unsigned short indices[6] = { 0, 1, 2, 0, 2, 3 };
+
+        batch->vaoId = rlLoadVertexArray();
+        rlEnableVertexArray(batch->vaoId);
+        batch->vboId = rlLoadVertexBuffer(corners, sizeof(corners), false);
+        batch->eboId = rlLoadVertexBufferElement(indices, sizeof(indices), false);
+        batch->instancesVboId = rlLoadVertexBuffer(NULL, capacity*sizeof(rl_BillboardInstance), true);
+        rlDisableVertexArray();
+
+        billboardShader.users++;
+
+        TRACELOG(LOG_INFO, "MODEL: [ID %i] Billboard batch loaded successfully (%i billboards)", batch->instancesVboId, capacity);
+    }
+#endif
+
+    return batch;
+}
+
+// Update billboard batch instances, data is copied (uploaded to GPU on draw)
+void rl_UpdateBillboardBatch(rl_BillboardBatch *batch, const rl_BillboardInstance *instances, int count)
+{
+    if ((batch == NULL) || (instances == NULL) || (count < 0)) return;
+
+    if (count > batch->capacity)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: Billboard batch capacity exceeded, only %i billboards updated", batch->capacity);
+        count = batch->capacity;
+    }
+
+    memcpy(batch->instances, instances, count*sizeof(rl_BillboardInstance));
+    batch->count = count;
+    batch->uploaded = false;
+}
+
+// Draw billboard batch, billboards facing camera with texture region defined by source
+// NOTE: Sorting by depth (back to front) is required for alpha blended billboards,
+// instances are sorted on worker threads every draw and uploaded in sorted order
+void rl_DrawBillboardBatch(rl_BillboardBatch *batch, rl_Camera camera, rl_Texture2D texture, rl_Rectangle source, bool sortByDepth)
+{
+    if ((batch == NULL) || (batch->count == 0)) return;
+
+    rl_Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+    rl_Vector3 up = { matView.m1, matView.m5, matView.m9 };
+    const rl_BillboardInstance *instances = batch->instances;
+
+    if (sortByDepth)
+    {
+        rl_Vector3 forward = { -matView.m2, -matView.m6, -matView.m10 };
+        SortBillboardBatch(batch, camera.position, forward);
+        instances = batch->sorted;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_11_SOFTWARE)
+    // No instancing available, billboards quads computed on CPU
+    for (int i = 0; i < batch->count; i++)
+    {
+        const rl_BillboardInstance *billboard = &instances[i];
+        rl_DrawBillboardPro(camera, texture, source, billboard->position, up, billboard->size, Vector2Scale(billboard->size, 0.5f), billboard->rotation, billboard->color);
+    }
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((batch->instancesVboId == 0) || (billboardShader.id == 0)) return;
+
+    // Sorted instances are uploaded every draw, unsorted instances only when updated
+    if (sortByDepth || !batch->uploaded)
+    {
+        rlUpdateVertexBuffer(batch->instancesVboId, instances, batch->count*sizeof(rl_BillboardInstance), 0);
+        batch->uploaded = !sortByDepth;
+    }
+
+    rl_Vector3 right = { matView.m0, matView.m4, matView.m8 };
+
+    rlEnableShader(billboardShader.id);
+    rlSetUniform(billboardShader.rightLoc, &right, SHADER_UNIFORM_VEC3, 1);
+    rlSetUniform(billboardShader.upLoc, &up, SHADER_UNIFORM_VEC3, 1);
+
+    float sourceRec[4] = { source.x/texture.width, source.y/texture.height, source.width/texture.width, source.height/texture.height };
+    rlSetUniform(billboardShader.sourceLoc, sourceRec, SHADER_UNIFORM_VEC4, 1);
+
+    int textureSlot = 0;
+    rlActiveTextureSlot(0);
+    rlEnableTexture(texture.id);
+    rlSetUniform(billboardShader.textureLoc, &textureSlot, SHADER_UNIFORM_INT, 1);
+
+    // Bind quad corners and instances attributes, instances attributes advance once per instance
+    int stride = sizeof(rl_BillboardInstance);
+
+    rlEnableVertexArray(batch->vaoId);
+    rlEnableVertexBuffer(batch->vboId);
+    rlSetVertexAttribute(billboardShader.cornerLoc, 2, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(billboardShader.cornerLoc);
+
+    rlEnableVertexBuffer(batch->instancesVboId);
+    rlSetVertexAttribute(billboardShader.positionLoc, 4, RL_FLOAT, false, stride, 0);
+    rlSetVertexAttribute(billboardShader.sizeLoc, 2, RL_FLOAT, false, stride, 4*sizeof(float));
+    rlSetVertexAttribute(billboardShader.colorLoc, 4, RL_UNSIGNED_BYTE, true, stride, 6*sizeof(float));
+    rlEnableVertexAttribute(billboardShader.positionLoc);
+    rlEnableVertexAttribute(billboardShader.sizeLoc);
+    rlEnableVertexAttribute(billboardShader.colorLoc);
+    rlSetVertexAttributeDivisor(billboardShader.positionLoc, 1);
+    rlSetVertexAttributeDivisor(billboardShader.sizeLoc, 1);
+    rlSetVertexAttributeDivisor(billboardShader.colorLoc, 1);
+
+    rlEnableVertexBufferElement(batch->eboId);
+
+    rl_Matrix matModelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    rl_Matrix matProjection = rlGetMatrixProjection();
+
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        rl_Matrix matModelViewProjection = MatrixIdentity();
+        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+        else
+        {
+            // Setup current eye viewport (half screen width)
+            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+        }
+
+        rlSetUniformMatrix(billboardShader.mvpLoc, matModelViewProjection);
+        rlDrawVertexArrayElementsInstanced(0, 6, 0, batch->count);
+    }
+
+    // Reset instances attributes, they could be used by other draws without vertex array objects
+    rlSetVertexAttributeDivisor(billboardShader.positionLoc, 0);
+    rlSetVertexAttributeDivisor(billboardShader.sizeLoc, 0);
+    rlSetVertexAttributeDivisor(billboardShader.colorLoc, 0);
+    rlDisableVertexAttribute(billboardShader.cornerLoc);
+    rlDisableVertexAttribute(billboardShader.positionLoc);
+    rlDisableVertexAttribute(billboardShader.sizeLoc);
+    rlDisableVertexAttribute(billboardShader.colorLoc);
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+    rlDisableTexture();
+    rlDisableShader();
+#endif
+}
+
+// Unload billboard batch from memory (RAM and VRAM)
+void rl_UnloadBillboardBatch(rl_BillboardBatch *batch)
+{
+    if (batch == NULL) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (batch->instancesVboId > 0)
+    {
+        rlUnloadVertexArray(batch->vaoId);
+        rlUnloadVertexBuffer(batch->vboId);
+        rlUnloadVertexBuffer(batch->eboId);
+        rlUnloadVertexBuffer(batch->instancesVboId);
+
+        // Unload billboard shader once no billboard batches use it
+        billboardShader.users--;
+        if ((billboardShader.users <= 0) && (billboardShader.id > 0))
+        {
+            rlUnloadShaderProgram(billboardShader.id);
+            billboardShader.id = 0;
+            billboardShader.users = 0;
+        }
+    }
+#endif
+
+    RL_FREE(batch->instances);
+    RL_FREE(batch->sorted);
+    RL_FREE(batch->keys);
+    RL_FREE(batch->indices);
+    RL_FREE(batch->histograms);
+    RL_FREE(batch);
+}
+
+// Draw a bounding box with wires
+void rl_DrawBoundingBox(rl_BoundingBox box, rl_Color color)
+{
+    rl_Vector3 size = { 0 };
+
+    size.x = fabsf(box.max.x - box.min.x);
+    size.y = fabsf(box.max.y - box.min.y);
+    size.z = fabsf(box.max.z - box.min.z);
+
+    rl_Vector3 center = { box.min.x + size.x/2.0f, box.min.y + size.y/2.0f, box.min.z + size.z/2.0f };
+
+    rl_DrawCubeWires(center, size.x, size.y, size.z, color);
+}
+
+// Check collision between two spheres
+bool rl_CheckCollisionSpheres(rl_Vector3 center1, float radius1, rl_Vector3 center2, float radius2)
+{
+    bool collision = false;
+
+    // Simple way to check for collision, just checking distance between two points
+    // Unfortunately, sqrtf() is a costly operation, so we avoid it with following solution
+    /*
+    float dx = center1.x - center2.x;      // X distance between centers
+    float dy = center1.y - center2.y;      // Y distance between centers
+    float dz = center1.z - center2.z;      // Z distance between centers
+
+    float distance = sqrtf(dx*dx + dy*dy + dz*dz);  // Distance between centers
+
+    if (distance <= (radius1 + radius2)) collision = true;
+    */
+
+    // Check for distances squared to avoid sqrtf()
+    if (Vector3DotProduct(Vector3Subtract(center2, center1), Vector3Subtract(center2, center1)) <= (radius1 + radius2)*(radius1 + radius2)) collision = true;
+
+    return collision;
+}
+
+// Check collision between two boxes
+// NOTE: Boxes are defined by two points minimum and maximum
+bool rl_CheckCollisionBoxes(rl_BoundingBox box1, rl_BoundingBox box2)
+{
+    bool collision = true;
+
+    if ((box1.max.x >= box2.min.x) && (box1.min.x <= box2.max.x))
+    {
+        if ((box1.max.y < box2.min.y) || (box1.min.y > box2.max.y)) collision = false;
+        if ((box1.max.z < box2.min.z) || (box1.min.z > box2.max.z)) collision = false;
+    }
+    else collision = false;
+
+    return collision;
+}
+
+// Check collision between box and sphere
+bool rl_CheckCollisionBoxSphere(rl_BoundingBox box, rl_Vector3 center, float radius)
+{
+    bool collision = false;
+
+    float dmin = 0;
+
+    if (center.x < box.min.x) dmin += powf(center.x - box.min.x, 2);
+    else if (center.x > box.max.x) dmin += powf(center.x - box.max.x, 2);
+
+    if (center.y < box.min.y) dmin += powf(center.y - box.min.y, 2);
     else if (center.y > box.max.y) dmin += powf(center.y - box.max.y, 2);
 
-    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
-    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+    if (center.z < box.min.z) dmin += powf(center.z - box.min.z, 2);
+    else if (center.z > box.max.z) dmin += powf(center.z - box.max.z, 2);
+
+    if (dmin <= (radius*radius)) collision = true;
+
+    return collision;
+}
+
+// Get collision info between ray and sphere
+rl_RayCollision rl_GetRayCollisionSphere(rl_Ray ray, rl_Vector3 center, float radius)
+{
+    rl_RayCollision collision = { 0 };
+
+    rl_Vector3 raySpherePos = Vector3Subtract(center, ray.position);
+    float vector = Vector3DotProduct(raySpherePos, ray.direction);
+    float distance = Vector3Length(raySpherePos);
+    float d = radius*radius - (distance*distance - vector*vector);
+
+    collision.hit = d >= 0.0f;
+
+    // Check if ray origin is inside the sphere to calculate the correct collision point
+    if (distance < radius)
+    {
+        collision.distance = vector + sqrtf(d);
+
+        // Calculate collision point
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+        // Calculate collision normal (pointing outwards)
+        collision.normal = Vector3Negate(Vector3Normalize(Vector3Subtract(collision.point, center)));
+    }
+    else
+    {
+        collision.distance = vector - sqrtf(d);
+
+        // Calculate collision point
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+        // Calculate collision normal (pointing inwards)
+        collision.normal = Vector3Normalize(Vector3Subtract(collision.point, center));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and box
+rl_RayCollision rl_GetRayCollisionBox(rl_Ray ray, rl_BoundingBox box)
+{
+    rl_RayCollision collision = { 0 };
+
+    // Note: If ray.position is inside the box, the distance is negative (as if the ray was reversed)
+    // Reversing ray.direction will give use the correct result
+    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
+                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
+                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+
+    if (insideBox) ray.direction = Vector3Negate(ray.direction);
+
+    float t[11] = { 0 };
+
+    t[8] = 1.0f/ray.direction.x;
+    t[9] = 1.0f/ray.direction.y;
+    t[10] = 1.0f/ray.direction.z;
+
+    t[0] = (box.min.x - ray.position.x)*t[8];
+    t[1] = (box.max.x - ray.position.x)*t[8];
+    t[2] = (box.min.y - ray.position.y)*t[9];
+    t[3] = (box.max.y - ray.position.y)*t[9];
+    t[4] = (box.min.z - ray.position.z)*t[10];
+    t[5] = (box.max.z - ray.position.z)*t[10];
+    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
+    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+
+    // Hit point and normal from slabs distances, also fixes result if ray.position is inside the box
+    collision = GetRayCollisionBoxResult(ray, box, t[6], t[7], insideBox);
+
+    return collision;
+}
+
+// Get collision info between ray and mesh
+rl_RayCollision rl_GetRayCollisionMesh(rl_Ray ray, rl_Mesh mesh, rl_Matrix transform)
+{
+    rl_RayCollision collision = { 0 };
+
+    // Use mesh bounding volume hierarchy if available
+    // NOTE: Ray is transformed to mesh space without normalizing its direction,
+    // so triangles hit distances match the ray distances in world space
+    if ((mesh.vertices != NULL) && (mesh.bvh != NULL))
+    {
+        const rl_MeshBVH *bvh = mesh.bvh;
+        rl_Matrix invTransform = MatrixInvert(transform);
+
+        rl_Ray localRay = GetMeshSpaceRay(ray, invTransform);
+
+        // NOTE: Zero direction components produce infinite inverse values, handled by slab tests
+        float origin[4] = { localRay.position.x, localRay.position.y, localRay.position.z, 0.0f };
+        float invDirection[4] = { 1.0f/localRay.direction.x, 1.0f/localRay.direction.y, 1.0f/localRay.direction.z, 0.0f };
+
+        int stack[MESH_BVH_MAX_DEPTH*2] = { 0 };
+        float stackDistances[MESH_BVH_MAX_DEPTH*2] = { 0 };
+        int stackSize = 0;
+        float closestDistance = FLT_MAX;
+        int closestTriangle = -1;
+        float distance = 0.0f;
+
+        if (GetRayCollisionMeshBVHNode(&bvh->nodes[0], origin, invDirection, closestDistance, &distance))
+        {
+            stack[0] = 0;
+            stackDistances[0] = distance;
+            stackSize = 1;
+        }
+
+        while (stackSize > 0)
+        {
+            stackSize--;
+            if (stackDistances[stackSize] >= closestDistance) continue;     // Node farther than closest hit
+
+            const MeshBVHNode *node = &bvh->nodes[stack[stackSize]];
+
+            if (node->count > 0)
+            {
+                for (int i = node->start; i < (node->start + node->count); i++)
+                {
+                    rl_Vector3 a = { 0 };
+                    rl_Vector3 b = { 0 };
+                    rl_Vector3 c = { 0 };
+                    GetMeshTriangle(mesh, bvh->triangles[i], &a, &b, &c);
+
+                    rl_RayCollision triHitInfo = rl_GetRayCollisionTriangle(localRay, a, b, c);
+
+                    if (triHitInfo.hit && (triHitInfo.distance < closestDistance))
+                    {
+                        closestDistance = triHitInfo.distance;
+                        closestTriangle = bvh->triangles[i];
+                    }
+                }
+            }
+            else
+            {
+                // Push farthest child first, so nearest child is visited first
+                float leftDistance = 0.0f;
+                float rightDistance = 0.0f;
+                bool hitLeft = GetRayCollisionMeshBVHNode(&bvh->nodes[node->start], origin, invDirection, closestDistance, &leftDistance);
+                bool hitRight = GetRayCollisionMeshBVHNode(&bvh->nodes[node->start + 1], origin, invDirection, closestDistance, &rightDistance);
+
+                if (hitLeft && hitRight && (leftDistance <= rightDistance))
+                {
+                    stack[stackSize] = node->start + 1; stackDistances[stackSize++] = rightDistance;
+                    stack[stackSize] = node->start; stackDistances[stackSize++] = leftDistance;
+                }
+                else if (hitLeft && hitRight)
+                {
+                    stack[stackSize] = node->start; stackDistances[stackSize++] = leftDistance;
+                    stack[stackSize] = node->start + 1; stackDistances[stackSize++] = rightDistance;
+                }
+                else if (hitLeft) { stack[stackSize] = node->start; stackDistances[stackSize++] = leftDistance; }
+                else if (hitRight) { stack[stackSize] = node->start + 1; stackDistances[stackSize++] = rightDistance; }
+            }
+        }
+
+        if (closestTriangle >= 0) collision = GetRayCollisionMeshTriangle(ray, mesh, transform, closestTriangle, closestDistance);
+
+        return collision;
+    }
+
+    // Check if mesh vertex data on CPU for testing
+    if (mesh.vertices != NULL)
+    {
+        int triangleCount = mesh.triangleCount;
+
+        // Test against all triangles in mesh
+        for (int i = 0; i < triangleCount; i++)
+        {
+            rl_Vector3 a = { 0 };
+            rl_Vector3 b = { 0 };
+            rl_Vector3 c = { 0 };
+            rl_Vector3 *vertdata = (rl_Vector3 *)mesh.vertices;
+
+            if (mesh.indices)
+            {
+                a = vertdata[mesh.indices[i*3 + 0]];
+                b = vertdata[mesh.indices[i*3 + 1]];
+                c = vertdata[mesh.indices[i*3 + 2]];
+            }
+            else
+            {
+                a = vertdata[i*3 + 0];
+                b = vertdata[i*3 + 1];
+                c = vertdata[i*3 + 2];
+            }
+
+            a = Vector3Transform(a, transform);
+            b = Vector3Transform(b, transform);
+            c = Vector3Transform(c, transform);
+
+            rl_RayCollision triHitInfo = rl_GetRayCollisionTriangle(ray, a, b, c);
+
+            if (triHitInfo.hit)
+            {
+                // Save the closest hit triangle
+                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+            }
+        }
+    }
+
+    return collision;
+}
+
+// Check collision between mesh and sphere
+// NOTE: Uses mesh bounding volume hierarchy if available, see rl_GenMeshBVH()
+bool rl_CheckCollisionMeshSphere(rl_Mesh mesh, rl_Matrix transform, rl_Vector3 center, float radius)
+{
+    rl_BoundingBox bounds = { 0 };
+    bounds.min = Vector3SubtractValue(center, radius);
+    bounds.max = Vector3AddValue(center, radius);
+
+    return CheckCollisionMeshVolume(mesh, transform, bounds, &center, radius);
+}
+
+// Check collision between mesh and box
+// NOTE: Uses mesh bounding volume hierarchy if available, see rl_GenMeshBVH()
+bool rl_CheckCollisionMeshBox(rl_Mesh mesh, rl_Matrix transform, rl_BoundingBox box)
+{
+    return CheckCollisionMeshVolume(mesh, transform, box, NULL, 0.0f);
+}
+
+// Get collision info between rays and mesh
+// NOTE: Rays are processed in SIMD packets (mesh BVH required) and split across worker threads
+void rl_GetRayCollisionMeshBatch(const rl_Ray *rays, int count, rl_Mesh mesh, rl_Matrix transform, rl_RayCollision *collisions)
+{
+    if ((rays == NULL) || (collisions == NULL) || (count <= 0)) return;
+
+    RayBatchJob job = { 0 };
+    job.rays = rays;
+    job.collisions = collisions;
+    job.count = count;
+    job.mesh = true;
+    job.target = mesh;
+    job.transform = transform;
+
+    ProcessRayBatch(&job);
+}
+
+// Get collision info between rays and box
+// NOTE: Rays are processed in SIMD packets and split across worker threads
+void rl_GetRayCollisionBoxBatch(const rl_Ray *rays, int count, rl_BoundingBox box, rl_RayCollision *collisions)
+{
+    if ((rays == NULL) || (collisions == NULL) || (count <= 0)) return;
+
+    RayBatchJob job = { 0 };
+    job.rays = rays;
+    job.collisions = collisions;
+    job.count = count;
+    job.mesh = false;
+    job.box = box;
+
+    ProcessRayBatch(&job);
+}
+
+// Get collision info between ray and triangle
+// NOTE: The points are expected to be in counter-clockwise winding
+// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
+rl_RayCollision rl_GetRayCollisionTriangle(rl_Ray ray, rl_Vector3 p1, rl_Vector3 p2, rl_Vector3 p3)
+{
+    #define rl_EPSILON 0.000001f        // A small number
+
+    rl_RayCollision collision = { 0 };
+    rl_Vector3 edge1 = { 0 };
+    rl_Vector3 edge2 = { 0 };
+    rl_Vector3 p = { 0 };
+    rl_Vector3 q = { 0 };
+    rl_Vector3 tv = { 0 };
+    float det = 0.0f, invDet = 0.0f, u = 0.0f, v = 0.0f, t = 0.0f;
+
+    // Find vectors for two edges sharing V1
+    edge1 = Vector3Subtract(p2, p1);
+    edge2 = Vector3Subtract(p3, p1);
+
+    // Begin calculating determinant - also used to calculate u parameter
+    p = Vector3CrossProduct(ray.direction, edge2);
+
+    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
+    det = Vector3DotProduct(edge1, p);
+
+    // Avoid culling!
+    if ((det > -rl_EPSILON) && (det < rl_EPSILON)) return collision;
+
+    invDet = 1.0f/det;
+
+    // Calculate distance from V1 to ray origin
+    tv = Vector3Subtract(ray.position, p1);
+
+    // Calculate u parameter and test bound
+    u = Vector3DotProduct(tv, p)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((u < 0.0f) || (u > 1.0f)) return collision;
+
+    // Prepare to test v parameter
+    q = Vector3CrossProduct(tv, edge1);
+
+    // Calculate V parameter and test bound
+    v = Vector3DotProduct(ray.direction, q)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+
+    t = Vector3DotProduct(edge2, q)*invDet;
+
+    if (t > rl_EPSILON)
+    {
+        // rl_Ray hit, get hit point and normal
+        collision.hit = true;
+        collision.distance = t;
+        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
+        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and quad
+// NOTE: The points are expected to be in counter-clockwise winding
+rl_RayCollision rl_GetRayCollisionQuad(rl_Ray ray, rl_Vector3 p1, rl_Vector3 p2, rl_Vector3 p3, rl_Vector3 p4)
+{
+    rl_RayCollision collision = { 0 };
+
+    collision = rl_GetRayCollisionTriangle(ray, p1, p2, p4);
+
+    if (!collision.hit) collision = rl_GetRayCollisionTriangle(ray, p2, p3, p4);
+
+    return collision;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Load model data from file, GPU data (meshes) is not uploaded
+// NOTE: Material textures are uploaded unless loading asynchronously
+static rl_Model LoadModelData(const char *fileName)
+{
+    rl_Model model = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+    if (rl_IsFileExtension(fileName, ".obj")) model = LoadOBJ(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_IQM)
+    if (rl_IsFileExtension(fileName, ".iqm")) model = LoadIQM(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+    if (rl_IsFileExtension(fileName, ".gltf") || rl_IsFileExtension(fileName, ".glb")) model = LoadGLTF(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_VOX)
+    if (rl_IsFileExtension(fileName, ".vox")) model = LoadVOX(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_M3D)
+    if (rl_IsFileExtension(fileName, ".m3d")) model = LoadM3D(fileName);
+#endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (rl_IsFileExtension(fileName, ".rmdl")) model = LoadRMDL(fileName);
+#endif
+
+    // Make sure model transform is set to identity matrix!
+    model.transform = MatrixIdentity();
+
+    if ((model.meshCount == 0) || (model.meshes == NULL)) TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
+
+    if (model.materialCount == 0)
+    {
+        TRACELOG(LOG_WARNING, "MATERIAL: [%s] Failed to load model material data, default to white material", fileName);
+
+        model.materialCount = 1;
+        model.materials = (rl_Material *)RL_CALLOC(model.materialCount, sizeof(rl_Material));
+        model.materials[0] = rl_LoadMaterialDefault();
+
+        if (model.meshMaterial == NULL) model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+    }
+
+    // Generate missing tangents for normal mapped meshes, done on worker thread when loading asynchronously
+    // NOTE: Deferred material textures are not loaded yet, they are identified by negative mipmaps
+    for (int i = 0; (model.meshMaterial != NULL) && (i < model.meshCount); i++)
+    {
+        rl_Texture2D normalMap = model.materials[model.meshMaterial[i]].maps[MATERIAL_MAP_NORMAL].texture;
+
+        if ((model.meshes[i].tangents == NULL) && ((normalMap.id > 0) || (normalMap.mipmaps < 0))) rl_GenMeshTangents(&model.meshes[i]);
+    }
+
+    // Cache bones inverse bind matrices, bind pose does not change once loaded
+    // NOTE: Model cache files already provide them
+    if ((model.boneCount > 0) && (model.bindPose != NULL) && (model.bindInverse == NULL))
+    {
+        model.bindInverse = (rl_Matrix *)RL_MALLOC(model.boneCount*sizeof(rl_Matrix));
+        for (int i = 0; i < model.boneCount; i++) model.bindInverse[i] = GetTransformMatrixInverse(model.bindPose[i]);
+    }
+
+    return model;
+}
+
+// Get async model loader decoding on current thread, NULL if not loading asynchronously
+static rl_ModelLoader *GetModelLoaderContext(void)
+{
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+    pthread_once(&modelLoaderKeyOnce, InitModelLoaderKey);
+    return (rl_ModelLoader *)pthread_getspecific(modelLoaderKey);
+#else
+    return modelLoaderContext;
+#endif
+}
+
+// Reserve async model loader texture upload slot, returns slot index
+static int ReserveModelLoaderUpload(rl_ModelLoader *loader)
+{
+    if (loader->imageCount >= loader->imageCapacity)
+    {
+        loader->imageCapacity = (loader->imageCapacity > 0)? loader->imageCapacity*2 : 8;
+        loader->images = (rl_Image *)RL_REALLOC(loader->images, loader->imageCapacity*sizeof(rl_Image));
+#if defined(SUPPORT_SHARED_TEXTURES)
+        loader->imageKeys = (char **)RL_REALLOC(loader->imageKeys, loader->imageCapacity*sizeof(char *));
+#endif
+    }
+
+    int index = loader->imageCount;
+    loader->images[index] = CLITERAL(rl_Image){ 0 };
+#if defined(SUPPORT_SHARED_TEXTURES)
+    loader->imageKeys[index] = NULL;
+#endif
+    loader->imageCount++;
+
+    return index;
+}
+
+// Defer material texture upload, image is owned by loader until uploaded
+// NOTE: Returned placeholder texture is replaced on upload, see rl_UpdateModelAsync()
+static rl_Texture2D DeferMaterialTexture(rl_ModelLoader *loader, rl_Image image)
+{
+    rl_Texture2D texture = { 0 };
+
+    if (image.data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
+        return texture;
+    }
+
+    int index = ReserveModelLoaderUpload(loader);
+    loader->images[index] = image;
+
+    texture.width = image.width;
+    texture.height = image.height;
+    texture.mipmaps = -(index + 1);
+    texture.format = image.format;
+
+    return texture;
+}
+
+// Load material texture from image, upload is deferred when loading asynchronously
+// NOTE: Image is not unloaded, it is copied if upload is deferred
+static rl_Texture2D LoadMaterialTexture(rl_Image image)
+{
+    rl_ModelLoader *loader = GetModelLoaderContext();
+
+    if (loader != NULL) return DeferMaterialTexture(loader, rl_ImageCopy(image));
+    else return rl_LoadTextureFromImage(image);
+}
+
+// Load material texture from file relative to model directory, upload is deferred when loading asynchronously
+// NOTE: With SUPPORT_SHARED_TEXTURES, texture is shared with other loads of the same file
+static rl_Texture2D LoadMaterialTextureFile(const char *dirPath, const char *fileName)
+{
+    char path[MAX_FILEPATH_LENGTH] = { 0 };
+
+    if (!GetModelFilePath(dirPath, fileName, path))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to resolve material texture path", fileName);
+        return (rl_Texture2D){ 0 };
+    }
+
+    fileName = path;
+
+#if defined(SUPPORT_SHARED_TEXTURES)
+    rl_Texture2D texture = { 0 };
+    char key[MAX_FILEPATH_LENGTH] = { 0 };
+
+    if (GetMaterialTextureFileKey(fileName, key))
+    {
+        if (AcquireMaterialTexture(key, &texture)) return texture;
+
+        return StoreMaterialTexture(key, rl_LoadImage(fileName));
+    }
+#endif
+    rl_ModelLoader *loader = GetModelLoaderContext();
+
+    if (loader != NULL) return DeferMaterialTexture(loader, rl_LoadImage(fileName));
+    else return rl_LoadTexture(fileName);
+}
+
+// Get model file directory path, model resources (materials, textures) are relative to it
+// NOTE: Unlike rl_GetDirectoryPath(), no static buffer is used, it is called from async loading threads
+static void GetModelDirectoryPath(const char *fileName, char *dirPath)
+{
+    const char *lastSlash = NULL;
+
+    for (const char *c = fileName; *c != '\0'; c++) if ((*c == '/') || (*c == '\\')) lastSlash = c;
+
+    int length = (lastSlash == NULL)? 0 : (int)(lastSlash - fileName);
+    if ((lastSlash == fileName) || ((length == 2) && (fileName[1] == ':'))) length++;   // Keep root directory separator
+
+    if (length == 0) { dirPath[0] = '.'; dirPath[1] = '\0'; }
+    else if (length < MAX_FILEPATH_LENGTH) { memcpy(dirPath, fileName, length); dirPath[length] = '\0'; }
+    else dirPath[0] = '\0';    // Directory path does not fit, resources can not be resolved
+}
+
+// Get model resource file path, relative paths are resolved from model directory
+// NOTE: Returns false if resulting path does not fit in MAX_FILEPATH_LENGTH, no directory (NULL) uses path as provided
+static bool GetModelFilePath(const char *dirPath, const char *fileName, char *filePath)
+{
+    bool absolute = (fileName[0] == '/') || (fileName[0] == '\\') || ((fileName[0] != '\0') && (fileName[1] == ':'));
+    int length = 0;
+
+    if (absolute || (dirPath == NULL)) length = snprintf(filePath, MAX_FILEPATH_LENGTH, "%s", fileName);
+    else if (dirPath[0] == '\0') return false;
+    else length = snprintf(filePath, MAX_FILEPATH_LENGTH, "%s/%s", dirPath, fileName);
+
+    return ((length >= 0) && (length < MAX_FILEPATH_LENGTH));
+}
+
+#if defined(SUPPORT_SHARED_TEXTURES)
+// Defer shared material texture upload, image is stored by textures module until uploaded
+// NOTE: Returned placeholder texture is replaced on upload, see rl_UpdateModelAsync()
+static rl_Texture2D DeferSharedMaterialTexture(rl_ModelLoader *loader, const char *key, rl_Texture2D texture)
+{
+    int index = ReserveModelLoaderUpload(loader);
+    int length = (int)strlen(key);
+
+    loader->imageKeys[index] = (char *)RL_MALLOC(length + 1);
+    memcpy(loader->imageKeys[index], key, length + 1);
+
+    texture.id = 0;
+    texture.mipmaps = -(index + 1);
+
+    return texture;
+}
+
+// Acquire shared material texture by resource key, returns false if resource must be loaded by caller
+// NOTE: On false return, resource loading must be completed with StoreMaterialTexture()
+static bool AcquireMaterialTexture(const char *key, rl_Texture2D *texture)
+{
+    if (!AcquireSharedTexture(key, texture)) return false;
+
+    // Texture upload pending, image decoded by an async model loader
+    if (texture->id == 0)
+    {
+        rl_ModelLoader *loader = GetModelLoaderContext();
+
+        if (loader != NULL) *texture = DeferSharedMaterialTexture(loader, key, *texture);
+        else *texture = UploadSharedTexture(key);
+    }
+
+    return true;
+}
+
+// Store shared material texture image, upload is deferred when loading asynchronously
+// NOTE: Image is unloaded, it is owned by textures module until uploaded
+static rl_Texture2D StoreMaterialTexture(const char *key, rl_Image image)
+{
+    rl_ModelLoader *loader = GetModelLoaderContext();
+    rl_Texture2D texture = StoreSharedTexture(key, image, (loader == NULL));
+
+    if ((loader != NULL) && (texture.width > 0)) texture = DeferSharedMaterialTexture(loader, key, texture);
+
+    return texture;
+}
+
+// Get material texture file resource key, built from file path resolved from model directory (see GetModelFilePath())
+// NOTE: Returns false if key does not fit in MAX_FILEPATH_LENGTH, texture must not be shared in that case
+static bool GetMaterialTextureFileKey(const char *fileName, char *key)
+{
+    int length = snprintf(key, MAX_FILEPATH_LENGTH, "%s", fileName);
+
+    return ((length >= 0) && (length < MAX_FILEPATH_LENGTH));
+}
+#endif
+
+// Decode async model loader data
+// NOTE: Runs on loader thread, no GPU calls are allowed
+static void *ModelLoaderThread(void *data)
+{
+    rl_ModelLoader *loader = (rl_ModelLoader *)data;
+
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+    pthread_setspecific(modelLoaderKey, loader);
+#endif
+
+    rl_Model model = LoadModelData(loader->fileName);
+
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+    pthread_setspecific(modelLoaderKey, NULL);
+    pthread_mutex_lock(&modelLoadersLock);
+#endif
+
+    loader->model = model;
+    loader->decoded = true;
+
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+    pthread_mutex_unlock(&modelLoadersLock);
+#endif
+
+    return NULL;
+}
+
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+// Init async model loader thread key
+static void InitModelLoaderKey(void)
+{
+    pthread_key_create(&modelLoaderKey, NULL);
+}
+#endif
+
+// Check if mesh is culled (frustum, occlusion) for current view
+// NOTE: Skinned meshes are not culled, bind pose bounds do not enclose animated vertices
+static bool IsMeshCulled(rl_Mesh mesh, rl_Matrix transform)
+{
+    bool culled = false;
+
+#if defined(SUPPORT_OCCLUSION_CULLING)
+    bool occlusionCulling = (occlusion.enabled && occlusion.ready);
+#else
+    bool occlusionCulling = false;
+#endif
+
+    if ((!frustumCulling && !occlusionCulling) || (mesh.boneCount > 0)) return false;
+
+    // Empty bounds (not computed) are never culled
+    if (Vector3Equals(mesh.boundsMin, mesh.boundsMax)) return false;
+
+    rl_Matrix matModel = MatrixMultiply(transform, rlGetMatrixTransform());
+
+    if (frustumCulling)
+    {
+        // Frustum planes in mesh space, so the bounding box is tested with the mesh transform applied
+        rl_Matrix mvp = MatrixMultiply(MatrixMultiply(matModel, rlGetMatrixModelview()), rlGetMatrixProjection());
+        culled = !FrustumCheckBox(FrustumFromMatrix(mvp), mesh.boundsMin, mesh.boundsMax);
+    }
+
+#if defined(SUPPORT_OCCLUSION_CULLING)
+    if (!culled && occlusionCulling)
+    {
+        rl_BoundingBox bounds = { mesh.boundsMin, mesh.boundsMax };
+        culled = rl_IsBoundingBoxOccluded(bounds, matModel);
+    }
+#endif
+
+    return culled;
+}
+
+#if defined(SUPPORT_OCCLUSION_CULLING) && defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)
+// Build occlusion depth pyramid from depth readback
+// NOTE: Called by rlUpdateReadbacks() once depth data is available, userData is the view-projection matrix
+static void BuildOcclusionDepth(unsigned char *data, int width, int height, void *userData)
+{
+    rl_Matrix *viewProj = (rl_Matrix *)userData;
+    const float *depth = (const float *)data;
+
+    occlusion.pending--;
+
+    if (occlusion.enabled && (width > 0) && (height > 0))
+    {
+        // Compute levels size, all levels are allocated in a single block
+        int widths[OCCLUSION_DEPTH_MAX_LEVELS] = { 0 };
+        int heights[OCCLUSION_DEPTH_MAX_LEVELS] = { 0 };
+        int levelCount = 0;
+        int texelCount = 0;
+
+        widths[0] = (width + OCCLUSION_DEPTH_TILE_SIZE - 1)/OCCLUSION_DEPTH_TILE_SIZE;
+        heights[0] = (height + OCCLUSION_DEPTH_TILE_SIZE - 1)/OCCLUSION_DEPTH_TILE_SIZE;
+
+        while (levelCount < OCCLUSION_DEPTH_MAX_LEVELS)
+        {
+            if (levelCount > 0)
+            {
+                widths[levelCount] = (widths[levelCount - 1] + 1)/2;
+                heights[levelCount] = (heights[levelCount - 1] + 1)/2;
+            }
+
+            texelCount += widths[levelCount]*heights[levelCount];
+            levelCount++;
+
+            if ((widths[levelCount - 1] == 1) && (heights[levelCount - 1] == 1)) break;
+        }
+
+        if (texelCount > occlusion.capacity)
+        {
+            RL_FREE(occlusion.levels[0]);
+            occlusion.levels[0] = (float *)RL_MALLOC(texelCount*sizeof(float));
+            occlusion.capacity = texelCount;
+        }
+
+        for (int i = 1; i < levelCount; i++) occlusion.levels[i] = occlusion.levels[i - 1] + widths[i - 1]*heights[i - 1];
+
+        // Level 0: farthest depth of every tile
+        float *base = occlusion.levels[0];
+        for (int ty = 0; ty < heights[0]; ty++)
+        {
+            for (int tx = 0; tx < widths[0]; tx++)
+            {
+                int x1 = (tx + 1)*OCCLUSION_DEPTH_TILE_SIZE;
+                int y1 = (ty + 1)*OCCLUSION_DEPTH_TILE_SIZE;
+                if (x1 > width) x1 = width;
+                if (y1 > height) y1 = height;
+
+                float farDepth = 0.0f;
+                for (int y = ty*OCCLUSION_DEPTH_TILE_SIZE; y < y1; y++)
+                {
+                    for (int x = tx*OCCLUSION_DEPTH_TILE_SIZE; x < x1; x++)
+                    {
+                        if (depth[y*width + x] > farDepth) farDepth = depth[y*width + x];
+                    }
+                }
+
+                base[ty*widths[0] + tx] = farDepth;
+            }
+        }
+
+        // Next levels: farthest depth of 2x2 texels of previous level
+        for (int i = 1; i < levelCount; i++)
+        {
+            const float *src = occlusion.levels[i - 1];
+            float *dst = occlusion.levels[i];
+
+            for (int y = 0; y < heights[i]; y++)
+            {
+                for (int x = 0; x < widths[i]; x++)
+                {
+                    int sx0 = x*2;
+                    int sy0 = y*2;
+                    int sx1 = ((sx0 + 1) < widths[i - 1])? sx0 + 1 : sx0;
+                    int sy1 = ((sy0 + 1) < heights[i - 1])? sy0 + 1 : sy0;
+
+                    float farDepth = src[sy0*widths[i - 1] + sx0];
+                    farDepth = fmaxf(farDepth, src[sy0*widths[i - 1] + sx1]);
+                    farDepth = fmaxf(farDepth, src[sy1*widths[i - 1] + sx0]);
+                    farDepth = fmaxf(farDepth, src[sy1*widths[i - 1] + sx1]);
+
+                    dst[y*widths[i] + x] = farDepth;
+                }
+            }
+        }
+
+        for (int i = 0; i < levelCount; i++)
+        {
+            occlusion.widths[i] = widths[i];
+            occlusion.heights[i] = heights[i];
+        }
+
+        occlusion.levelCount = levelCount;
+        occlusion.viewProj = *viewProj;
+        occlusion.ready = true;
+    }
+
+    RL_FREE(viewProj);
+}
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Draw mesh instances with transforms read from a GPU buffer
+// NOTE: If indirectId is provided, instances count is read from the indirect draw command buffer,
+// if paletteId is provided, instances bone palette indices are read from palettesVboId
+static void DrawMeshInstancesBuffer(rl_Mesh mesh, rl_Material material, unsigned int instancesVboId, int instances, unsigned int indirectId, unsigned int paletteId, unsigned int palettesVboId)
+{
+    // Bind shader program
+    rlEnableShader(material.shader.id);
+
+    // Send required data to shader (matrices, values)
+    //-----------------------------------------------------
+    // Upload to shader material.colDiffuse
+    if (material.shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1)
+    {
+        float values[4] = {
+            (float)material.maps[rl_MATERIAL_MAP_DIFFUSE].color.r/255.0f,
+            (float)material.maps[rl_MATERIAL_MAP_DIFFUSE].color.g/255.0f,
+            (float)material.maps[rl_MATERIAL_MAP_DIFFUSE].color.b/255.0f,
+            (float)material.maps[rl_MATERIAL_MAP_DIFFUSE].color.a/255.0f
+        };
+
+        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
+    }
+
+    // Upload to shader material.colSpecular (if location available)
+    if (material.shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1)
+    {
+        float values[4] = {
+            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.r/255.0f,
+            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.g/255.0f,
+            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.b/255.0f,
+            (float)material.maps[SHADER_LOC_COLOR_SPECULAR].color.a/255.0f
+        };
+
+        rlSetUniform(material.shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
+    }
+
+    // Get a copy of current matrices to work with,
+    // just in case stereo render is required, and we need to modify them
+    // NOTE: At this point the modelview matrix just contains the view matrix (camera)
+    // That's because rl_BeginMode3D() sets it and there is no model-drawing function
+    // that modifies it, all use rlPushMatrix() and rlPopMatrix()
+    rl_Matrix matModel = MatrixIdentity();
+    rl_Matrix matView = rlGetMatrixModelview();
+    rl_Matrix matModelView = MatrixIdentity();
+    rl_Matrix matProjection = rlGetMatrixProjection();
+
+    // Upload view and projection matrices (if locations available)
+    if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
+    if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
+
+    // Enable mesh VAO to attach instances buffer
+    rlEnableVertexArray(mesh.vaoId);
+    rlEnableVertexBuffer(instancesVboId);
+
+    // Instances transformation matrices are sent to shader attribute location: SHADER_LOC_VERTEX_INSTANCE_TX
+    for (unsigned int i = 0; i < 4; i++)
+    {
+        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_INSTANCE_TX] + i);
+        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_INSTANCE_TX] + i, 4, RL_FLOAT, 0, sizeof(rl_Matrix), i*sizeof(rl_Vector4));
+        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_VERTEX_INSTANCE_TX] + i, 1);
+    }
+
+#ifdef RL_SUPPORT_MESH_GPU_SKINNING
+    // Instances bone palette indices are sent to shader attribute location: SHADER_LOC_VERTEX_INSTANCE_PALETTE
+    // NOTE: Attribute is disabled when not provided, VAO could keep it pointing to a previous (deleted) buffer
+    if (material.shader.locs[SHADER_LOC_VERTEX_INSTANCE_PALETTE] != -1)
+    {
+        if (palettesVboId > 0)
+        {
+            rlEnableVertexBuffer(palettesVboId);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_INSTANCE_PALETTE]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_INSTANCE_PALETTE], 1, RL_FLOAT, 0, sizeof(float), 0);
+            rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_VERTEX_INSTANCE_PALETTE], 1);
+        }
+        else rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_INSTANCE_PALETTE]);
+    }
+#endif
+
+    rlDisableVertexBuffer();
+    rlDisableVertexArray();
+
+    // Accumulate internal matrix transform (push/pop) and view matrix
+    // NOTE: In this case, model instance transformation must be computed in the shader
+    matModelView = MatrixMultiply(rlGetMatrixTransform(), matView);
+
+    // Upload model normal matrix (if locations available)
+    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], GetNormalMatrix(matModel));
+
+#ifdef RL_SUPPORT_MESH_GPU_SKINNING
+    // Upload Bone Transforms
+    SetShaderBoneUniforms(material.shader, mesh);
+
+    // Bind instances bone palette texture, after material maps texture slots
+    if ((paletteId > 0) && (material.shader.locs[SHADER_LOC_BONE_PALETTE] != -1))
+    {
+        int slot = MAX_MATERIAL_MAPS;
+
+        rlActiveTextureSlot(slot);
+        rlEnableTexture(paletteId);
+        rlSetUniform(material.shader.locs[SHADER_LOC_BONE_PALETTE], &slot, SHADER_UNIFORM_INT, 1);
+    }
+#endif
+
+    //-----------------------------------------------------
+
+    // Bind active texture maps (if available)
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        if (material.maps[i].texture.id > 0)
+        {
+            // Select current shader texture slot
+            rlActiveTextureSlot(i);
+
+            // Enable texture for active slot
+            if ((i == MATERIAL_MAP_IRRADIANCE) ||
+                (i == MATERIAL_MAP_PREFILTER) ||
+                (i == MATERIAL_MAP_CUBEMAP)) rlEnableTextureCubemap(material.maps[i].texture.id);
+            else rlEnableTexture(material.maps[i].texture.id);
+
+            rlSetUniform(material.shader.locs[rl_SHADER_LOC_MAP_DIFFUSE + i], &i, SHADER_UNIFORM_INT, 1);
+        }
+    }
+
+    // Try binding vertex array objects (VAO)
+    // or use VBOs if not possible
+    if (!rlEnableVertexArray(mesh.vaoId))
+    {
+        // Bind mesh VBO data: vertex position (shader-location = 0)
+        rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION]);
+        SetMeshVertexAttribute(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
+        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_POSITION]);
+
+        // Bind mesh VBO data: vertex texcoords (shader-location = 1)
+        rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD]);
+        SetMeshVertexAttribute(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+
+        if (material.shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
+        {
+            // Bind mesh VBO data: vertex normals (shader-location = 2)
+            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL]);
+            SetMeshVertexAttribute(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_NORMAL]);
+        }
+
+        // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
+        if (material.shader.locs[SHADER_LOC_VERTEX_COLOR] != -1)
+        {
+            if (mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR] != 0)
+            {
+                rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR]);
+                rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+                rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
+            }
+            else
+            {
+                // Set default value for unused attribute
+                // NOTE: Required when using default shader and no VAO support
+                float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+                rlSetVertexAttributeDefault(material.shader.locs[SHADER_LOC_VERTEX_COLOR], value, SHADER_ATTRIB_VEC4, 4);
+                rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_COLOR]);
+            }
+        }
+
+        // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
+        if (material.shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
+        {
+            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT]);
+            SetMeshVertexAttribute(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TANGENT]);
+        }
+
+        // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
+        if (material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
+        {
+            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2]);
+            SetMeshVertexAttribute(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
+        }
+
+#ifdef RL_SUPPORT_MESH_GPU_SKINNING
+        // Bind mesh VBO data: vertex bone ids (shader-location = 6, if available)
+        if (material.shader.locs[SHADER_LOC_VERTEX_BONEIDS] != -1)
+        {
+            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS]);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS], 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEIDS]);
+        }
+
+        // Bind mesh VBO data: vertex bone weights (shader-location = 7, if available)
+        if (material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1)
+        {
+            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS]);
+            SetMeshVertexAttribute(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
+        }
+#endif
+
+        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
+    }
+
+    int eyeCount = 1;
+    if (rlIsStereoRenderEnabled()) eyeCount = 2;
+
+    for (int eye = 0; eye < eyeCount; eye++)
+    {
+        // Calculate model-view-projection matrix (MVP)
+        rl_Matrix matModelViewProjection = MatrixIdentity();
+        if (eyeCount == 1) matModelViewProjection = MatrixMultiply(matModelView, matProjection);
+        else
+        {
+            // Setup current eye viewport (half screen width)
+            rlViewport(eye*rlGetFramebufferWidth()/2, 0, rlGetFramebufferWidth()/2, rlGetFramebufferHeight());
+            matModelViewProjection = MatrixMultiply(MatrixMultiply(matModelView, rlGetMatrixViewOffsetStereo(eye)), rlGetMatrixProjectionStereo(eye));
+        }
+
+        // Send combined model-view-projection matrix to shader
+        rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
+
+        // Draw mesh instanced
+        if (indirectId > 0)
+        {
+            // Instances count is provided by the indirect command (i.e. written by a GPU culling pass)
+            if (mesh.indices != NULL) rlDrawVertexArrayElementsIndirect(indirectId, 0, 1);
+            else rlDrawVertexArrayIndirect(indirectId, 0, 1);
+        }
+        else if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
+        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
+    }
+
+    // Unbind all bound texture maps
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        if (material.maps[i].texture.id > 0)
+        {
+            // Select current shader texture slot
+            rlActiveTextureSlot(i);
+
+            // Disable texture for active slot
+            if ((i == MATERIAL_MAP_IRRADIANCE) ||
+                (i == MATERIAL_MAP_PREFILTER) ||
+                (i == MATERIAL_MAP_CUBEMAP)) rlDisableTextureCubemap();
+            else rlDisableTexture();
+        }
+    }
+
+#ifdef RL_SUPPORT_MESH_GPU_SKINNING
+    // Unbind instances bone palette texture
+    if ((paletteId > 0) && (material.shader.locs[SHADER_LOC_BONE_PALETTE] != -1))
+    {
+        rlActiveTextureSlot(MAX_MATERIAL_MAPS);
+        rlDisableTexture();
+    }
+#endif
+
+    // Disable all possible vertex array objects (or VBOs)
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+
+    // Disable shader program
+    rlDisableShader();
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
+// Build pose from parent joints
+// NOTE: Required for animations loading (required by IQM and GLTF)
+static void BuildPoseFromParentJoints(rl_BoneInfo *bones, int boneCount, rl_Transform *transforms)
+{
+    for (int i = 0; i < boneCount; i++)
+    {
+        if (bones[i].parent >= 0)
+        {
+            if (bones[i].parent > i)
+            {
+                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
+                continue;
+            }
+            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
+            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
+            transforms[i].translation = Vector3Multiply(transforms[i].translation, transforms[bones[i].parent].scale);
+            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
+            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
+        }
+    }
+}
+#endif
+
+// Get transform matrix (scale, rotation, translation)
+// NOTE: Same result as scale, rotation and translation matrices multiplied, composed directly:
+// rotation matrix columns are scaled and translation is set
+static rl_Matrix GetTransformMatrix(rl_Transform transform)
+{
+    rl_Matrix result = QuaternionToMatrix(transform.rotation);
+
+    result.m0 *= transform.scale.x;
+    result.m1 *= transform.scale.x;
+    result.m2 *= transform.scale.x;
+    result.m4 *= transform.scale.y;
+    result.m5 *= transform.scale.y;
+    result.m6 *= transform.scale.y;
+    result.m8 *= transform.scale.z;
+    result.m9 *= transform.scale.z;
+    result.m10 *= transform.scale.z;
+    result.m12 = transform.translation.x;
+    result.m13 = transform.translation.y;
+    result.m14 = transform.translation.z;
+
+    return result;
+}
+
+// Get transform inverse matrix
+// NOTE: Transform matrices are affine, rigid transforms (unit scale and rotation)
+// are inverted transposing rotation and negating translation
+static rl_Matrix GetTransformMatrixInverse(rl_Transform transform)
+{
+    rl_Matrix3x4 mat = Matrix3x4FromMatrix(GetTransformMatrix(transform));
+    rl_Quaternion q = transform.rotation;
+    bool rigid = (transform.scale.x == 1.0f) && (transform.scale.y == 1.0f) && (transform.scale.z == 1.0f) &&
+        (fabsf(q.x*q.x + q.y*q.y + q.z*q.z + q.w*q.w - 1.0f) <= rl_EPSILON);
+
+    return Matrix3x4ToMatrix(rigid? Matrix3x4InvertRigid(mat) : Matrix3x4Invert(mat));
+}
+
+// Get normal matrix (inverse transpose) of transform matrix
+// NOTE: Affine matrices (most model transforms) avoid the general 4x4 inversion
+static rl_Matrix GetNormalMatrix(rl_Matrix mat)
+{
+    rl_Matrix result = { 0 };
+
+    if ((mat.m3 == 0.0f) && (mat.m7 == 0.0f) && (mat.m11 == 0.0f) && (mat.m15 == 1.0f))
+    {
+        result = MatrixTranspose(Matrix3x4ToMatrix(Matrix3x4Invert(Matrix3x4FromMatrix(mat))));
+    }
+    else result = MatrixTranspose(MatrixInvert(mat));
+
+    return result;
+}
+
+#if (defined(RL_SUPPORT_MESH_GPU_SKINNING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))) || defined(SUPPORT_MESH_DUAL_QUATERNION_SKINNING)
+// Get bone dual quaternion from bone matrix (8 floats: rotation, translation)
+// NOTE: Dual quaternions only represent rigid transforms, bone matrix scale is removed
+static void GetBoneDualQuaternion(rl_Matrix mat, float *dualQuat)
+{
+    // Rotation matrix columns normalized, scale removed
+    float scaleX = sqrtf(mat.m0*mat.m0 + mat.m1*mat.m1 + mat.m2*mat.m2);
+    float scaleY = sqrtf(mat.m4*mat.m4 + mat.m5*mat.m5 + mat.m6*mat.m6);
+    float scaleZ = sqrtf(mat.m8*mat.m8 + mat.m9*mat.m9 + mat.m10*mat.m10);
+
+    if (scaleX > 0.0f) { mat.m0 /= scaleX; mat.m1 /= scaleX; mat.m2 /= scaleX; }
+    if (scaleY > 0.0f) { mat.m4 /= scaleY; mat.m5 /= scaleY; mat.m6 /= scaleY; }
+    if (scaleZ > 0.0f) { mat.m8 /= scaleZ; mat.m9 /= scaleZ; mat.m10 /= scaleZ; }
+
+    rl_Quaternion q = QuaternionFromMatrix(mat);
+    float x = mat.m12;
+    float y = mat.m13;
+    float z = mat.m14;
+
+    dualQuat[0] = q.x;
+    dualQuat[1] = q.y;
+    dualQuat[2] = q.z;
+    dualQuat[3] = q.w;
+
+    // Dual part, 0.5*translation*rotation (translation as pure quaternion)
+    dualQuat[4] = 0.5f*(x*q.w + y*q.z - z*q.y);
+    dualQuat[5] = 0.5f*(-x*q.z + y*q.w + z*q.x);
+    dualQuat[6] = 0.5f*(x*q.y - y*q.x + z*q.w);
+    dualQuat[7] = -0.5f*(x*q.x + y*q.y + z*q.z);
+}
+#endif
+
+#if defined(RL_SUPPORT_MESH_GPU_SKINNING) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+// Set shader bone uniforms from mesh bone matrices (matrices or dual quaternions)
+// NOTE: Dual quaternions (2 vec4 per bone) halve uploaded data and uniform space required by bones
+static void SetShaderBoneUniforms(rl_Shader shader, rl_Mesh mesh)
+{
+    if (mesh.boneMatrices == NULL) return;
+
+    if (shader.locs[SHADER_LOC_BONE_MATRICES] != -1) rlSetUniformMatrices(shader.locs[SHADER_LOC_BONE_MATRICES], mesh.boneMatrices, mesh.boneCount);
+
+    if (shader.locs[SHADER_LOC_BONE_DUALQUATS] != -1)
+    {
+        float dualQuats[256*8] = { 0 };     // Vertex bone ids are limited to 256 bones
+        int boneCount = (mesh.boneCount < 256)? mesh.boneCount : 256;
+
+        for (int i = 0; i < boneCount; i++) GetBoneDualQuaternion(mesh.boneMatrices[i], &dualQuats[i*8]);
+        rlSetUniform(shader.locs[SHADER_LOC_BONE_DUALQUATS], dualQuats, SHADER_UNIFORM_VEC4, boneCount*2);
+    }
+}
+#endif
+
+// Get model bone skinning matrix for bone transform
+// NOTE: Inverse bind matrix is computed if not cached at model loading
+static rl_Matrix GetModelBoneMatrix(rl_Model model, int boneId, rl_Transform transform)
+{
+    rl_Matrix bindInverse = (model.bindInverse != NULL)? model.bindInverse[boneId] : GetTransformMatrixInverse(model.bindPose[boneId]);
+
+    return Matrix3x4ToMatrix(Matrix3x4Multiply(Matrix3x4FromMatrix(bindInverse), Matrix3x4FromMatrix(GetTransformMatrix(transform))));
+}
+
+// Update model mesh bone matrices from pose
+// NOTE: Inverse bind matrices are cached at model loading, computed per bone if not available
+static void UpdateModelBoneMatrices(rl_Model model, const rl_Transform *pose, int boneCount)
+{
+    // Get first mesh which have bones
+    int firstMeshWithBones = -1;
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        if (model.meshes[i].boneMatrices)
+        {
+            firstMeshWithBones = i;
+            break;
+        }
+    }
+
+    if (firstMeshWithBones == -1) return;
+
+    // Update all bones and boneMatrices of first mesh with bones
+    rl_Matrix *boneMatrices = model.meshes[firstMeshWithBones].boneMatrices;
+
+    if (model.bindInverse != NULL)
+    {
+        // Pose matrices multiplied by the cached inverse bind matrices in a single batch
+        for (int boneId = 0; boneId < boneCount; boneId++) boneMatrices[boneId] = GetTransformMatrix(pose[boneId]);
+        MatrixMultiplyBatch(model.bindInverse, boneMatrices, boneMatrices, boneCount);
+    }
+    else
+    {
+        for (int boneId = 0; boneId < boneCount; boneId++) boneMatrices[boneId] = GetModelBoneMatrix(model, boneId, pose[boneId]);
+    }
+
+    // Update remaining meshes with bones
+    // NOTE: Using deep copy because shallow copy results in double free with 'rl_UnloadModel()'
+    for (int i = firstMeshWithBones + 1; i < model.meshCount; i++)
+    {
+        if (model.meshes[i].boneMatrices)
+        {
+            memcpy(model.meshes[i].boneMatrices, boneMatrices, model.meshes[i].boneCount*sizeof(model.meshes[i].boneMatrices[0]));
+        }
+    }
+}
+
+// Get animation channel value at frame (translation and scale use quaternion xyz)
+static rl_Quaternion GetAnimationChannelValue(rl_ModelAnimation anim, int frame, int boneId, int channelType)
+{
+    const rl_Transform *transform = &anim.framePoses[frame][boneId];
+    rl_Quaternion value = { 0 };
+
+    if (channelType == ANIMATION_CHANNEL_TRANSLATION) value = CLITERAL(rl_Quaternion){ transform->translation.x, transform->translation.y, transform->translation.z, 0.0f };
+    else if (channelType == ANIMATION_CHANNEL_ROTATION) value = QuaternionNormalize(transform->rotation);
+    else value = CLITERAL(rl_Quaternion){ transform->scale.x, transform->scale.y, transform->scale.z, 0.0f };
+
+    return value;
+}
+
+// Interpolate animation channel values
+static rl_Quaternion InterpolateAnimationChannelValue(int channelType, rl_Quaternion a, rl_Quaternion b, float amount)
+{
+    rl_Quaternion result = { 0 };
+
+    if (channelType == ANIMATION_CHANNEL_ROTATION) result = QuaternionSlerp(a, b, amount);
+    else
+    {
+        result.x = a.x + amount*(b.x - a.x);
+        result.y = a.y + amount*(b.y - a.y);
+        result.z = a.z + amount*(b.z - a.z);
+    }
+
+    return result;
+}
+
+// Get animation channel values error, world units for translation and scale, radians for rotation
+static float GetAnimationChannelError(int channelType, rl_Quaternion a, rl_Quaternion b)
+{
+    float result = 0.0f;
+
+    if (channelType == ANIMATION_CHANNEL_ROTATION)
+    {
+        float dot = fabsf(a.x*b.x + a.y*b.y + a.z*b.z + a.w*b.w);
+        result = 2.0f*acosf(fminf(dot, 1.0f));
+    }
+    else result = sqrtf((a.x - b.x)*(a.x - b.x) + (a.y - b.y)*(a.y - b.y) + (a.z - b.z)*(a.z - b.z));
+
+    return result;
+}
+
+// Reduce animation channel keys, returns kept keys frames
+// NOTE: Keys are removed while every skipped frame can be interpolated from segment keys within tolerance,
+// first and last frames are always kept unless channel is constant
+static int ReduceAnimationChannel(rl_ModelAnimation anim, int boneId, int channelType, float tolerance, int *keyFrames)
+{
+    int last = anim.frameCount - 1;
+    int keyCount = 0;
+    int start = 0;
+
+    keyFrames[keyCount++] = 0;
+
+    while (start < last)
+    {
+        rl_Quaternion startValue = GetAnimationChannelValue(anim, start, boneId, channelType);
+        int end = start + 1;
+
+        // Extend segment while skipped frames stay within tolerance
+        while (end < last)
+        {
+            int next = end + 1;
+            rl_Quaternion nextValue = GetAnimationChannelValue(anim, next, boneId, channelType);
+            bool valid = true;
+
+            for (int f = start + 1; f < next; f++)
+            {
+                rl_Quaternion value = InterpolateAnimationChannelValue(channelType, startValue, nextValue, (float)(f - start)/(float)(next - start));
+
+                if (GetAnimationChannelError(channelType, value, GetAnimationChannelValue(anim, f, boneId, channelType)) > tolerance) { valid = false; break; }
+            }
+
+            if (!valid) break;
+            end = next;
+        }
+
+        keyFrames[keyCount++] = end;
+        start = end;
+    }
+
+    // Check constant channel, a single key is required
+    rl_Quaternion firstValue = GetAnimationChannelValue(anim, 0, boneId, channelType);
+    bool constant = true;
+
+    for (int f = 1; f <= last; f++)
+    {
+        if (GetAnimationChannelError(channelType, firstValue, GetAnimationChannelValue(anim, f, boneId, channelType)) > tolerance) { constant = false; break; }
+    }
+
+    if (constant) keyCount = 1;
+
+    return keyCount;
+}
+
+// Encode animation channel value into 3 quantized values
+// NOTE: Rotations use smallest three components encoding (15 bit each), largest component index
+// is stored in the two values high bits, translation and scale are quantized in channel range (16 bit)
+static void EncodeAnimationChannelValue(const AnimationChannel *channel, int channelType, rl_Quaternion value, unsigned short *encoded)
+{
+    if (channelType == ANIMATION_CHANNEL_ROTATION)
+    {
+        float q[4] = { value.x, value.y, value.z, value.w };
+        int largest = 0;
+
+        for (int i = 1; i < 4; i++) if (fabsf(q[i]) > fabsf(q[largest])) largest = i;
+
+        // Largest component is recomputed on decoding, it is kept positive (q and -q are the same rotation)
+        float sign = (q[largest] < 0.0f)? -1.0f : 1.0f;
+
+        for (int i = 0, k = 0; i < 4; i++)
+        {
+            if (i == largest) continue;
+
+            float normalized = (sign*q[i]*0.70710678f) + 0.5f; // Components range: [-1/sqrt(2), 1/sqrt(2)]
+            if (normalized < 0.0f) normalized = 0.0f;
+            else if (normalized > 1.0f) normalized = 1.0f;
+
+            encoded[k++] = (unsigned short)(normalized*32767.0f + 0.5f);
+        }
+
+        encoded[0] |= (unsigned short)((largest & 1) << 15);
+        encoded[1] |= (unsigned short)((largest >> 1) << 15);
+    }
+    else
+    {
+        float v[3] = { value.x, value.y, value.z };
+
+        for (int i = 0; i < 3; i++)
+        {
+            float normalized = (channel->rangeSize[i] > 0.0f)? (v[i] - channel->rangeMin[i])/channel->rangeSize[i] : 0.0f;
+            if (normalized < 0.0f) normalized = 0.0f;
+            else if (normalized > 1.0f) normalized = 1.0f;
+
+            encoded[i] = (unsigned short)(normalized*65535.0f + 0.5f);
+        }
+    }
+}
+
+// Decode animation channel value from 3 quantized values
+static rl_Quaternion DecodeAnimationChannelValue(const AnimationChannel *channel, int channelType, const unsigned short *encoded)
+{
+    rl_Quaternion result = { 0 };
+
+    if (channelType == ANIMATION_CHANNEL_ROTATION)
+    {
+        int largest = ((encoded[0] >> 15) & 1) | (((encoded[1] >> 15) & 1) << 1);
+        float q[4] = { 0 };
+        float sum = 0.0f;
+
+        for (int i = 0, k = 0; i < 4; i++)
+        {
+            if (i == largest) continue;
+
+            q[i] = (((float)(encoded[k++] & 0x7fff)/32767.0f) - 0.5f)*1.41421356f;
+            sum += q[i]*q[i];
+        }
+
+        q[largest] = sqrtf(fmaxf(1.0f - sum, 0.0f));
+
+        result = CLITERAL(rl_Quaternion){ q[0], q[1], q[2], q[3] };
+    }
+    else
+    {
+        result.x = channel->rangeMin[0] + channel->rangeSize[0]*((float)encoded[0]/65535.0f);
+        result.y = channel->rangeMin[1] + channel->rangeSize[1]*((float)encoded[1]/65535.0f);
+        result.z = channel->rangeMin[2] + channel->rangeSize[2]*((float)encoded[2]/65535.0f);
+    }
+
+    return result;
+}
+
+// Get mesh triangle vertices (mesh space)
+static void GetMeshTriangle(rl_Mesh mesh, int index, rl_Vector3 *a, rl_Vector3 *b, rl_Vector3 *c)
+{
+    rl_Vector3 *vertdata = (rl_Vector3 *)mesh.vertices;
+
+    if (mesh.indices)
+    {
+        *a = vertdata[mesh.indices[index*3 + 0]];
+        *b = vertdata[mesh.indices[index*3 + 1]];
+        *c = vertdata[mesh.indices[index*3 + 2]];
+    }
+    else
+    {
+        *a = vertdata[index*3 + 0];
+        *b = vertdata[index*3 + 1];
+        *c = vertdata[index*3 + 2];
+    }
+}
+
+// Build mesh BVH node, splitting it recursively
+// NOTE: Split is chosen with binned surface area heuristic (SAH) along the three axis,
+// a node becomes a leaf when splitting is not cheaper than testing all its triangles
+static void BuildMeshBVHNode(rl_MeshBVH *bvh, int nodeIndex, int start, int count, const rl_BoundingBox *bounds, const rl_Vector3 *centroids, int depth)
+{
+    MeshBVHNode *node = &bvh->nodes[nodeIndex];
+    int *triangles = bvh->triangles;
+
+    // Compute node bounds and triangles centroids bounds
+    rl_Vector3 nodeMin = bounds[triangles[start]].min;
+    rl_Vector3 nodeMax = bounds[triangles[start]].max;
+    rl_Vector3 centroidMin = centroids[triangles[start]];
+    rl_Vector3 centroidMax = centroids[triangles[start]];
+
+    for (int i = start + 1; i < (start + count); i++)
+    {
+        nodeMin = Vector3Min(nodeMin, bounds[triangles[i]].min);
+        nodeMax = Vector3Max(nodeMax, bounds[triangles[i]].max);
+        centroidMin = Vector3Min(centroidMin, centroids[triangles[i]]);
+        centroidMax = Vector3Max(centroidMax, centroids[triangles[i]]);
+    }
+
+    node->min = nodeMin;
+    node->max = nodeMax;
+    node->start = start;
+    node->count = count;
+
+    if ((count <= 2) || (depth >= (MESH_BVH_MAX_DEPTH - 1))) return;
+
+    // Evaluate binned SAH split cost along every axis
+    // NOTE: Cost is proportional to children surface area times children triangles count
+    float bestCost = FLT_MAX;
+    int bestAxis = -1;
+    int bestSplit = 0;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        float axisMin = ((float *)&centroidMin)[axis];
+        float axisMax = ((float *)&centroidMax)[axis];
+        if (axisMax <= axisMin) continue;
+
+        rl_BoundingBox binBounds[MESH_BVH_SAH_BINS] = { 0 };
+        int binCounts[MESH_BVH_SAH_BINS] = { 0 };
+        float scale = (float)MESH_BVH_SAH_BINS/(axisMax - axisMin);
+
+        for (int i = start; i < (start + count); i++)
+        {
+            int bin = (int)((((float *)&centroids[triangles[i]])[axis] - axisMin)*scale);
+            if (bin >= MESH_BVH_SAH_BINS) bin = MESH_BVH_SAH_BINS - 1;
+
+            if (binCounts[bin] == 0) binBounds[bin] = bounds[triangles[i]];
+            else
+            {
+                binBounds[bin].min = Vector3Min(binBounds[bin].min, bounds[triangles[i]].min);
+                binBounds[bin].max = Vector3Max(binBounds[bin].max, bounds[triangles[i]].max);
+            }
+            binCounts[bin]++;
+        }
+
+        // Sweep bins from both sides, splits are placed after every bin but the last one
+        float leftCosts[MESH_BVH_SAH_BINS - 1] = { 0 };
+        rl_BoundingBox sweep = { 0 };
+        int sweepCount = 0;
+
+        for (int i = 0; i < (MESH_BVH_SAH_BINS - 1); i++)
+        {
+            if (binCounts[i] > 0)
+            {
+                if (sweepCount == 0) sweep = binBounds[i];
+                else
+                {
+                    sweep.min = Vector3Min(sweep.min, binBounds[i].min);
+                    sweep.max = Vector3Max(sweep.max, binBounds[i].max);
+                }
+                sweepCount += binCounts[i];
+            }
+
+            rl_Vector3 size = Vector3Subtract(sweep.max, sweep.min);
+            leftCosts[i] = (sweepCount > 0)? sweepCount*(size.x*size.y + size.y*size.z + size.z*size.x) : 0.0f;
+        }
+
+        sweepCount = 0;
+
+        for (int i = MESH_BVH_SAH_BINS - 1; i > 0; i--)
+        {
+            if (binCounts[i] > 0)
+            {
+                if (sweepCount == 0) sweep = binBounds[i];
+                else
+                {
+                    sweep.min = Vector3Min(sweep.min, binBounds[i].min);
+                    sweep.max = Vector3Max(sweep.max, binBounds[i].max);
+                }
+                sweepCount += binCounts[i];
+            }
+
+            if ((sweepCount == 0) || (sweepCount == count)) continue;   // Empty side, not a valid split
+
+            rl_Vector3 size = Vector3Subtract(sweep.max, sweep.min);
+            float cost = leftCosts[i - 1] + sweepCount*(size.x*size.y + size.y*size.z + size.z*size.x);
+
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = i;
+            }
+        }
+    }
+
+    // All centroids at the same position, triangles can not be split
+    if (bestAxis < 0) return;
+
+    // Compare against leaf cost, traversal cost is considered equal to one triangle test
+    rl_Vector3 nodeSize = Vector3Subtract(nodeMax, nodeMin);
+    float nodeArea = nodeSize.x*nodeSize.y + nodeSize.y*nodeSize.z + nodeSize.z*nodeSize.x;
+    if (((nodeArea + bestCost) >= (count*nodeArea)) && (count <= MESH_BVH_MAX_LEAF_TRIANGLES)) return;
+
+    // Partition triangles, bins before split go to left child
+    float axisMin = ((float *)&centroidMin)[bestAxis];
+    float scale = (float)MESH_BVH_SAH_BINS/(((float *)&centroidMax)[bestAxis] - axisMin);
+    int i = start;
+    int j = start + count - 1;
+
+    while (i <= j)
+    {
+        int bin = (int)((((float *)&centroids[triangles[i]])[bestAxis] - axisMin)*scale);
+        if (bin >= MESH_BVH_SAH_BINS) bin = MESH_BVH_SAH_BINS - 1;
+
+        if (bin < bestSplit) i++;
+        else
+        {
+            int temp = triangles[i];
+            triangles[i] = triangles[j];
+            triangles[j] = temp;
+            j--;
+        }
+    }
+
+    int leftCount = i - start;
+    if ((leftCount == 0) || (leftCount == count)) return;
+
+    int leftIndex = bvh->nodeCount;
+    bvh->nodeCount += 2;
+
+    node->start = leftIndex;
+    node->count = 0;
+
+    BuildMeshBVHNode(bvh, leftIndex, start, leftCount, bounds, centroids, depth + 1);
+    BuildMeshBVHNode(bvh, leftIndex + 1, i, count - leftCount, bounds, centroids, depth + 1);
+}
+
+// Get mesh indices count, including levels of detail indices
+static int GetMeshIndexCount(rl_Mesh mesh)
+{
+    int indexCount = mesh.triangleCount*3;
+
+    if (mesh.lod != NULL)
+    {
+        int last = mesh.lod->levelCount - 1;
+        indexCount = mesh.lod->indexOffsets[last] + mesh.lod->triangleCounts[last]*3;
+    }
+
+    return indexCount;
+}
+
+// Get mesh level of detail for current view, projected simplification error must not exceed MESH_LOD_PIXEL_ERROR
+// NOTE: Selected level is kept in mesh LOD data, a coarser level is selected only
+// when its error is below threshold by MESH_LOD_HYSTERESIS, to avoid popping between levels
+static int GetMeshLODLevel(rl_Mesh mesh, rl_Matrix transform)
+{
+    rl_MeshLOD *lod = mesh.lod;
+    rl_Matrix matModelView = MatrixMultiply(MatrixMultiply(transform, rlGetMatrixTransform()), rlGetMatrixModelview());
+    rl_Matrix matProjection = rlGetMatrixProjection();
+
+    // Mesh to view space scale, largest axis scale
+    float scale = sqrtf(fmaxf(fmaxf(matModelView.m0*matModelView.m0 + matModelView.m1*matModelView.m1 + matModelView.m2*matModelView.m2,
+        matModelView.m4*matModelView.m4 + matModelView.m5*matModelView.m5 + matModelView.m6*matModelView.m6),
+        matModelView.m8*matModelView.m8 + matModelView.m9*matModelView.m9 + matModelView.m10*matModelView.m10));
+
+    // Pixels per mesh unit, at bounding sphere nearest distance for perspective projection
+    float pixels = scale*matProjection.m5*0.5f*(float)rlGetFramebufferHeight();
+
+    if (matProjection.m15 == 0.0f)
+    {
+        rl_Vector3 center = Vector3Transform(lod->center, matModelView);
+        float distance = -center.z - lod->radius*scale;
+
+        if (distance <= 0.0f)
+        {
+            lod->currentLevel = 0;
+            return 0;
+        }
+
+        pixels /= distance;
+    }
+
+    int level = (lod->currentLevel <= lod->levelCount)? lod->currentLevel : lod->levelCount;
+
+    while ((level > 0) && (lod->errors[level - 1]*pixels > MESH_LOD_PIXEL_ERROR)) level--;
+    while ((level < lod->levelCount) && (lod->errors[level]*pixels <= MESH_LOD_PIXEL_ERROR*(1.0f - MESH_LOD_HYSTERESIS))) level++;
+
+    lod->currentLevel = level;
+
+    return level;
+}
+
+// Get mesh indices count to draw for current view, level of detail indices offset is returned
+static int GetMeshDrawIndexCount(rl_Mesh mesh, rl_Matrix transform, int *indexOffset)
+{
+    int indexCount = mesh.triangleCount*3;
+    *indexOffset = 0;
+
+    if ((mesh.lod != NULL) && (mesh.indices != NULL))
+    {
+        int level = GetMeshLODLevel(mesh, transform);
+
+        if (level > 0)
+        {
+            *indexOffset = mesh.lod->indexOffsets[level - 1];
+            indexCount = mesh.lod->triangleCounts[level - 1]*3;
+            rlAddLodSavedTriangles(mesh.triangleCount - mesh.lod->triangleCounts[level - 1]);
+        }
+    }
+
+    return indexCount;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Enable mesh vertex buffers and shader vertex attributes, used when vertex array objects are not available
+static void EnableMeshVertexBuffers(rl_Mesh mesh, rl_Shader shader)
+{
+    // Bind mesh VBO data: vertex position (shader-location = 0)
+    rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION]);
+    SetMeshVertexAttribute(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, shader.locs[SHADER_LOC_VERTEX_POSITION]);
+    rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_POSITION]);
+
+    // Bind mesh VBO data: vertex texcoords (shader-location = 1)
+    rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD]);
+    SetMeshVertexAttribute(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+    rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_TEXCOORD01]);
+
+    if (shader.locs[SHADER_LOC_VERTEX_NORMAL] != -1)
+    {
+        // Bind mesh VBO data: vertex normals (shader-location = 2)
+        rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL]);
+        SetMeshVertexAttribute(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, shader.locs[SHADER_LOC_VERTEX_NORMAL]);
+        rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_NORMAL]);
+    }
+
+    // Bind mesh VBO data: vertex colors (shader-location = 3, if available)
+    if (shader.locs[SHADER_LOC_VERTEX_COLOR] != -1)
+    {
+        if (mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR] != 0)
+        {
+            rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR]);
+            rlSetVertexAttribute(shader.locs[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+            rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_COLOR]);
+        }
+        else
+        {
+            // Set default value for defined vertex attribute in shader but not provided by mesh
+            // WARNING: It could result in GPU undefined behaviour
+            float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            rlSetVertexAttributeDefault(shader.locs[SHADER_LOC_VERTEX_COLOR], value, SHADER_ATTRIB_VEC4, 4);
+            rlDisableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_COLOR]);
+        }
+    }
+
+    // Bind mesh VBO data: vertex tangents (shader-location = 4, if available)
+    if (shader.locs[SHADER_LOC_VERTEX_TANGENT] != -1)
+    {
+        rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT]);
+        SetMeshVertexAttribute(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, shader.locs[SHADER_LOC_VERTEX_TANGENT]);
+        rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_TANGENT]);
+    }
+
+    // Bind mesh VBO data: vertex texcoords2 (shader-location = 5, if available)
+    if (shader.locs[SHADER_LOC_VERTEX_TEXCOORD02] != -1)
+    {
+        rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2]);
+        SetMeshVertexAttribute(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
+        rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_TEXCOORD02]);
+    }
+
+#ifdef RL_SUPPORT_MESH_GPU_SKINNING
+    // Bind mesh VBO data: vertex bone ids (shader-location = 6, if available)
+    if (shader.locs[SHADER_LOC_VERTEX_BONEIDS] != -1)
+    {
+        rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS]);
+        rlSetVertexAttribute(shader.locs[SHADER_LOC_VERTEX_BONEIDS], 4, RL_UNSIGNED_BYTE, 0, 0, 0);
+        rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_BONEIDS]);
+    }
+
+    // Bind mesh VBO data: vertex bone weights (shader-location = 7, if available)
+    if (shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS] != -1)
+    {
+        rlEnableVertexBuffer(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS]);
+        SetMeshVertexAttribute(mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
+        rlEnableVertexAttribute(shader.locs[SHADER_LOC_VERTEX_BONEWEIGHTS]);
+    }
+#endif
+
+    if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
+}
+#endif
+
+// Add quadric to mesh vertex quadric
+static void AddMeshQuadric(MeshQuadric *quadric, const MeshQuadric *other)
+{
+    quadric->a00 += other->a00;
+    quadric->a11 += other->a11;
+    quadric->a22 += other->a22;
+    quadric->a01 += other->a01;
+    quadric->a02 += other->a02;
+    quadric->a12 += other->a12;
+    quadric->b0 += other->b0;
+    quadric->b1 += other->b1;
+    quadric->b2 += other->b2;
+    quadric->c += other->c;
+    quadric->weight += other->weight;
+}
+
+// Get mesh quadric squared distance error for position
+static float GetMeshQuadricError(const MeshQuadric *quadric, const float *p)
+{
+    float error = quadric->a00*p[0]*p[0] + quadric->a11*p[1]*p[1] + quadric->a22*p[2]*p[2] +
+        2.0f*(quadric->a01*p[0]*p[1] + quadric->a02*p[0]*p[2] + quadric->a12*p[1]*p[2]) +
+        2.0f*(quadric->b0*p[0] + quadric->b1*p[1] + quadric->b2*p[2]) + quadric->c;
+
+    return fabsf(error);
+}
+
+// Simplify mesh indices collapsing edges into existing vertices, returns simplified indices count
+// NOTE: Cheapest independent collapses are applied in passes until target or maximum error is reached,
+// vertices on borders (including attribute seams) are locked and collapses flipping triangles are rejected
+static int SimplifyMeshIndices(unsigned int *indices, int indexCount, const float *vertices, int vertexCount, MeshQuadric *quadrics, int targetCount, float maxError, float *error)
+{
+    int *offsets = (int *)RL_MALLOC((vertexCount + 1)*sizeof(int));
+    int *adjacency = (int *)RL_MALLOC(indexCount*sizeof(int));
+    int *remap = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    int *marks = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    int *counts = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    bool *border = (bool *)RL_MALLOC(vertexCount*sizeof(bool));
+    bool *touched = (bool *)RL_MALLOC(vertexCount*sizeof(bool));
+    MeshCollapse *collapses = (MeshCollapse *)RL_MALLOC(indexCount*2*sizeof(MeshCollapse));
+    int mark = 0;
+
+    while (indexCount > targetCount)
+    {
+        // Build vertices triangles adjacency
+        for (int v = 0; v <= vertexCount; v++) offsets[v] = 0;
+        for (int i = 0; i < indexCount; i++) offsets[indices[i] + 1]++;
+        for (int v = 0; v < vertexCount; v++) offsets[v + 1] += offsets[v];
+        for (int v = 0; v < vertexCount; v++) counts[v] = 0;
+        for (int i = 0; i < indexCount; i++) adjacency[offsets[indices[i]] + counts[indices[i]]++] = i/3;
+
+        // Find border vertices, with an edge used by a single triangle
+        for (int v = 0; v < vertexCount; v++)
+        {
+            border[v] = false;
+            mark++;
+
+            for (int j = offsets[v]; j < offsets[v + 1]; j++)
+            {
+                for (int k = 0; k < 3; k++)
+                {
+                    int w = indices[adjacency[j]*3 + k];
+                    if (marks[w] != mark) { marks[w] = mark; counts[w] = 0; }
+                    if (w != v) counts[w]++;
+                }
+            }
+
+            for (int j = offsets[v]; (j < offsets[v + 1]) && !border[v]; j++)
+            {
+                for (int k = 0; k < 3; k++)
+                {
+                    int w = indices[adjacency[j]*3 + k];
+                    if ((w != v) && (counts[w] == 1)) border[v] = true;
+                }
+            }
+        }
+
+        // Get collapse candidates from triangles edges, both directions
+        int collapseCount = 0;
+
+        for (int i = 0; i < indexCount; i++)
+        {
+            int from = indices[i];
+            int to = indices[(i%3 == 2)? i - 2 : i + 1];
+
+            for (int d = 0; d < 2; d++)
+            {
+                if (!border[from])
+                {
+                    MeshQuadric quadric = quadrics[from];
+                    AddMeshQuadric(&quadric, &quadrics[to]);
+
+                    collapses[collapseCount].cost = GetMeshQuadricError(&quadric, &vertices[to*3])/fmaxf(quadric.weight, 1e-12f);
+                    collapses[collapseCount].from = from;
+                    collapses[collapseCount].to = to;
+                    collapseCount++;
+                }
+
+                int temp = from;
+                from = to;
+                to = temp;
+            }
+        }
+
+        if (collapseCount == 0) break;
+
+        qsort(collapses, collapseCount, sizeof(MeshCollapse), CompareMeshCollapses);
+
+        for (int v = 0; v < vertexCount; v++)
+        {
+            remap[v] = v;
+            touched[v] = false;
+        }
+
+        int removedCount = 0;
+        int collapsedCount = 0;
+
+        for (int c = 0; (c < collapseCount) && ((indexCount - removedCount) > targetCount); c++)
+        {
+            int from = collapses[c].from;
+            int to = collapses[c].to;
+
+            if (collapses[c].cost > maxError*maxError) break;
+
+            if (touched[from] || touched[to]) continue;
+
+            // Check triangles flips and link condition (common neighbors must be shared triangles vertices)
+            const float *target = &vertices[to*3];
+            int shared = 0;
+            bool valid = true;
+            mark++;
+
+            for (int j = offsets[from]; (j < offsets[from + 1]) && valid; j++)
+            {
+                const unsigned int *triangle = &indices[adjacency[j]*3];
+
+                if ((triangle[0] == (unsigned int)to) || (triangle[1] == (unsigned int)to) || (triangle[2] == (unsigned int)to)) shared++;
+                else
+                {
+                    const float *p[3] = { &vertices[triangle[0]*3], &vertices[triangle[1]*3], &vertices[triangle[2]*3] };
+                    rl_Vector3 before = Vector3CrossProduct(Vector3Subtract((rl_Vector3){ p[1][0], p[1][1], p[1][2] }, (rl_Vector3){ p[0][0], p[0][1], p[0][2] }),
+                        Vector3Subtract((rl_Vector3){ p[2][0], p[2][1], p[2][2] }, (rl_Vector3){ p[0][0], p[0][1], p[0][2] }));
+
+                    for (int k = 0; k < 3; k++) if (triangle[k] == (unsigned int)from) p[k] = target;
+
+                    rl_Vector3 after = Vector3CrossProduct(Vector3Subtract((rl_Vector3){ p[1][0], p[1][1], p[1][2] }, (rl_Vector3){ p[0][0], p[0][1], p[0][2] }),
+                        Vector3Subtract((rl_Vector3){ p[2][0], p[2][1], p[2][2] }, (rl_Vector3){ p[0][0], p[0][1], p[0][2] }));
+
+                    if (Vector3DotProduct(before, after) < 0.2f*Vector3Length(before)*Vector3Length(after)) valid = false;
+                }
+
+                for (int k = 0; k < 3; k++) marks[triangle[k]] = mark;
+            }
+
+            if (!valid) continue;
+
+            int common = 0;
+            int visited = ++mark;
+
+            for (int j = offsets[to]; j < offsets[to + 1]; j++)
+            {
+                const unsigned int *triangle = &indices[adjacency[j]*3];
+
+                for (int k = 0; k < 3; k++)
+                {
+                    int w = triangle[k];
+                    if ((w == from) || (w == to)) continue;
+                    if (marks[w] == (visited - 1)) { common++; marks[w] = visited; }
+                }
+            }
+
+            if (common != shared) continue;
+
+            // Collapse edge, vertices of changed triangles can not be moved again in this pass
+            remap[from] = to;
+            AddMeshQuadric(&quadrics[to], &quadrics[from]);
+            removedCount += shared*3;
+            collapsedCount++;
+
+            for (int j = offsets[from]; j < offsets[from + 1]; j++)
+            {
+                for (int k = 0; k < 3; k++) touched[indices[adjacency[j]*3 + k]] = true;
+            }
+
+            float collapseError = sqrtf(collapses[c].cost);
+            if (collapseError > *error) *error = collapseError;
+        }
+
+        if (collapsedCount == 0) break;
+
+        // Apply collapses, removing degenerated triangles
+        int count = 0;
+
+        for (int i = 0; i < indexCount; i += 3)
+        {
+            unsigned int a = remap[indices[i]];
+            unsigned int b = remap[indices[i + 1]];
+            unsigned int c = remap[indices[i + 2]];
+
+            if ((a != b) && (b != c) && (a != c))
+            {
+                indices[count] = a;
+                indices[count + 1] = b;
+                indices[count + 2] = c;
+                count += 3;
+            }
+        }
+
+        indexCount = count;
+    }
+
+    RL_FREE(offsets);
+    RL_FREE(adjacency);
+    RL_FREE(remap);
+    RL_FREE(marks);
+    RL_FREE(counts);
+    RL_FREE(border);
+    RL_FREE(touched);
+    RL_FREE(collapses);
+
+    return indexCount;
+}
+
+// Compare mesh edge collapses cost (ascending), used by qsort()
+static int CompareMeshCollapses(const void *a, const void *b)
+{
+    float costA = ((const MeshCollapse *)a)->cost;
+    float costB = ((const MeshCollapse *)b)->cost;
+
+    return (costA > costB) - (costA < costB);
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Get mesh vertex buffers quantization for upload, from requested quantization flags
+// NOTE: Dynamic and CPU animated attributes are kept as floats, they are updated with float data
+static unsigned int GetMeshQuantization(rl_Mesh mesh, bool dynamic)
+{
+    unsigned int quantization = 0;
+
+    if (dynamic) return quantization;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    // Half float positions, only if precision is enough for mesh size and distance to origin
+    if ((meshQuantization & MESH_QUANTIZE_POSITIONS) && (mesh.animVertices == NULL))
+    {
+        rl_BoundingBox bounds = rl_GetMeshBoundingBox(mesh);
+        float size = Vector3Distance(bounds.min, bounds.max);
+        float maxCoord = fmaxf(Vector3Length(bounds.min), Vector3Length(bounds.max));
+
+        if ((maxCoord < 65504.0f) && ((maxCoord/2048.0f) <= size*MESH_QUANTIZE_POSITION_ERROR)) quantization |= MESH_QUANTIZE_POSITIONS;
+    }
+#endif
+
+    if ((meshQuantization & MESH_QUANTIZE_NORMALS) && (mesh.animNormals == NULL)) quantization |= MESH_QUANTIZE_NORMALS;
+
+    // Normalized texcoords, only if all texcoords are in [0..1] range
+    if (meshQuantization & MESH_QUANTIZE_TEXCOORDS)
+    {
+        bool normalized = true;
+
+        for (int i = 0; (i < mesh.vertexCount*2) && normalized; i++)
+        {
+            if ((mesh.texcoords != NULL) && ((mesh.texcoords[i] < 0.0f) || (mesh.texcoords[i] > 1.0f))) normalized = false;
+            if ((mesh.texcoords2 != NULL) && ((mesh.texcoords2[i] < 0.0f) || (mesh.texcoords2[i] > 1.0f))) normalized = false;
+        }
+
+        if (normalized) quantization |= MESH_QUANTIZE_TEXCOORDS;
+    }
+
+    if (meshQuantization & MESH_QUANTIZE_BONEWEIGHTS) quantization |= MESH_QUANTIZE_BONEWEIGHTS;
+
+    return quantization;
+}
+#endif
+
+// Load mesh vertex attribute data for GPU vertex buffer, quantized as required by mesh quantization
+// NOTE: Returned data must be freed with RL_FREE() when it is not the provided data
+static void *LoadMeshVertexBufferData(rl_Mesh mesh, int attribute, const void *data, int *dataSize)
+{
+    const float *values = (const float *)data;
+    int count = mesh.vertexCount;
+    void *result = (void *)data;
+
+    switch (attribute)
+    {
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION:
+        {
+            *dataSize = count*3*sizeof(float);
+
+            if (mesh.quantization & MESH_QUANTIZE_POSITIONS)
+            {
+                // Half floats, padded to 4 components for vertex alignment
+                unsigned short *positions = (unsigned short *)RL_MALLOC(count*4*sizeof(unsigned short));
+
+                for (int i = 0; i < count; i++)
+                {
+                    for (int k = 0; k < 3; k++) positions[i*4 + k] = FloatToHalf(values[i*3 + k]);
+                    positions[i*4 + 3] = 0x3c00;    // 1.0f
+                }
+
+                result = positions;
+                *dataSize = count*4*sizeof(unsigned short);
+            }
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD:
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2:
+        {
+            *dataSize = count*2*sizeof(float);
+
+            if (mesh.quantization & MESH_QUANTIZE_TEXCOORDS)
+            {
+                // Unsigned normalized 16 bit
+                unsigned short *texcoords = (unsigned short *)RL_MALLOC(count*2*sizeof(unsigned short));
+                for (int i = 0; i < count*2; i++) texcoords[i] = (unsigned short)(Clamp(values[i], 0.0f, 1.0f)*65535.0f + 0.5f);
+
+                result = texcoords;
+                *dataSize = count*2*sizeof(unsigned short);
+            }
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL:
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT:
+        {
+            int components = (attribute == RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL)? 3 : 4;
+            *dataSize = count*components*sizeof(float);
+
+            if (mesh.quantization & MESH_QUANTIZE_NORMALS)
+            {
+                // Signed normalized 8 bit, normals padded to 4 components for vertex alignment
+                signed char *directions = (signed char *)RL_CALLOC(count*4, sizeof(signed char));
+
+                for (int i = 0; i < count; i++)
+                {
+                    for (int k = 0; k < components; k++) directions[i*4 + k] = (signed char)roundf(Clamp(values[i*components + k], -1.0f, 1.0f)*127.0f);
+                }
+
+                result = directions;
+                *dataSize = count*4*sizeof(signed char);
+            }
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS:
+        {
+            *dataSize = count*4*sizeof(float);
+
+            if (mesh.quantization & MESH_QUANTIZE_BONEWEIGHTS)
+            {
+                // Unsigned normalized 8 bit, largest weight is adjusted so weights still add up to 1.0f
+                unsigned char *weights = (unsigned char *)RL_CALLOC(count*4, sizeof(unsigned char));
+
+                for (int i = 0; i < count; i++)
+                {
+                    int sum = 0;
+                    int largest = 0;
+
+                    for (int k = 0; k < 4; k++)
+                    {
+                        weights[i*4 + k] = (unsigned char)(Clamp(values[i*4 + k], 0.0f, 1.0f)*255.0f + 0.5f);
+                        sum += weights[i*4 + k];
+                        if (weights[i*4 + k] > weights[i*4 + largest]) largest = k;
+                    }
+
+                    if (sum > 0) weights[i*4 + largest] = (unsigned char)Clamp((float)(weights[i*4 + largest] + 255 - sum), 0.0f, 255.0f);
+                }
+
+                result = weights;
+                *dataSize = count*4*sizeof(unsigned char);
+            }
+        } break;
+        default: break;
+    }
+
+    return result;
+}
+
+// Set mesh vertex attribute format for current vertex buffer, considering mesh quantization
+static void SetMeshVertexAttribute(rl_Mesh mesh, int attribute, unsigned int location)
+{
+    switch (attribute)
+    {
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION:
+        {
+            if (mesh.quantization & MESH_QUANTIZE_POSITIONS) rlSetVertexAttribute(location, 3, RL_HALF_FLOAT, 0, 4*sizeof(unsigned short), 0);
+            else rlSetVertexAttribute(location, 3, RL_FLOAT, 0, 0, 0);
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD:
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2:
+        {
+            if (mesh.quantization & MESH_QUANTIZE_TEXCOORDS) rlSetVertexAttribute(location, 2, RL_UNSIGNED_SHORT, 1, 0, 0);
+            else rlSetVertexAttribute(location, 2, RL_FLOAT, 0, 0, 0);
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL:
+        {
+            if (mesh.quantization & MESH_QUANTIZE_NORMALS) rlSetVertexAttribute(location, 3, RL_BYTE, 1, 4*sizeof(signed char), 0);
+            else rlSetVertexAttribute(location, 3, RL_FLOAT, 0, 0, 0);
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR: rlSetVertexAttribute(location, 4, RL_UNSIGNED_BYTE, 1, 0, 0); break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT:
+        {
+            if (mesh.quantization & MESH_QUANTIZE_NORMALS) rlSetVertexAttribute(location, 4, RL_BYTE, 1, 0, 0);
+            else rlSetVertexAttribute(location, 4, RL_FLOAT, 0, 0, 0);
+        } break;
+        case RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS:
+        {
+            if (mesh.quantization & MESH_QUANTIZE_BONEWEIGHTS) rlSetVertexAttribute(location, 4, RL_UNSIGNED_BYTE, 1, 0, 0);
+            else rlSetVertexAttribute(location, 4, RL_FLOAT, 0, 0, 0);
+        } break;
+        default: break;
+    }
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Load mesh vertex buffer for attribute, format is set for attribute default location
+static unsigned int LoadMeshVertexBuffer(rl_Mesh mesh, int attribute, const void *data, bool dynamic)
+{
+    int dataSize = 0;
+    void *bufferData = LoadMeshVertexBufferData(mesh, attribute, data, &dataSize);
+
+    unsigned int vboId = rlLoadVertexBuffer(bufferData, dataSize, dynamic);
+    SetMeshVertexAttribute(mesh, attribute, attribute);
+
+    if (bufferData != data) RL_FREE(bufferData);
+
+    return vboId;
+}
+#endif
+
+// Convert float to half float (IEEE 754 binary16), round to nearest
+static unsigned short FloatToHalf(float x)
+{
+    unsigned short result = 0;
+
+    union {
+        float fm;
+        unsigned int ui;
+    } uni;
+    uni.fm = x;
+
+    const unsigned int b = uni.ui + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
+    const unsigned int e = (b & 0x7f800000) >> 23; // Exponent
+    const unsigned int m = b & 0x007fffff; // Mantissa; in line below: 0x007ff000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+
+    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7c00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007ff000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7fff; // sign : normalized : denormalized : saturate
+
+    return result;
+}
+
+// Find material in materials list, new material is added if not found
+// NOTE: Materials are shared if they use same shader and same maps (textures, colors and values)
+static int FindMaterialIndex(rl_Material **materials, int *materialCount, rl_Material material)
+{
+    for (int i = 0; i < *materialCount; i++)
+    {
+        rl_Material *current = &(*materials)[i];
+
+        if ((current->shader.id != material.shader.id) || (memcmp(current->params, material.params, sizeof(material.params)) != 0)) continue;
+
+        bool equal = (current->maps == material.maps);
+
+        if (!equal && (current->maps != NULL) && (material.maps != NULL))
+        {
+            equal = true;
+
+            for (int m = 0; (m < MAX_MATERIAL_MAPS) && equal; m++)
+            {
+                if ((current->maps[m].texture.id != material.maps[m].texture.id) ||
+                    (current->maps[m].value != material.maps[m].value) ||
+                    (memcmp(&current->maps[m].color, &material.maps[m].color, sizeof(rl_Color)) != 0)) equal = false;
+            }
+        }
+
+        if (equal) return i;
+    }
+
+    *materials = (rl_Material *)RL_REALLOC(*materials, (*materialCount + 1)*sizeof(rl_Material));
+    (*materials)[*materialCount] = material;
+    (*materialCount)++;
+
+    return *materialCount - 1;
+}
+
+// Append mesh to static batch merged mesh, vertex data is transformed
+// NOTE: Attributes missing in mesh or in merged mesh are filled with default values
+static void AppendStaticBatchMesh(StaticBatchMesh *target, rl_Mesh mesh, rl_Matrix transform, StaticBatchPiece *piece)
+{
+    rl_Mesh *merged = &target->mesh;
+    int vertexOffset = merged->vertexCount;
+    int vertexCount = vertexOffset + mesh.vertexCount;
+    int indexOffset = merged->triangleCount*3;
+    int indexCount = (mesh.indices != NULL)? mesh.triangleCount*3 : mesh.vertexCount;
+
+    // Grow merged vertex data, attributes not available in merged mesh are allocated once required
+    if ((vertexCount > target->vertexCapacity) || (merged->vertices == NULL))
+    {
+        int capacity = (target->vertexCapacity > 0)? target->vertexCapacity : 1024;
+        while (capacity < vertexCount) capacity *= 2;
+        if (capacity > MAX_STATIC_BATCH_MESH_VERTICES) capacity = MAX_STATIC_BATCH_MESH_VERTICES;
+
+        merged->vertices = (float *)RL_REALLOC(merged->vertices, capacity*3*sizeof(float));
+        if (merged->texcoords != NULL) merged->texcoords = (float *)RL_REALLOC(merged->texcoords, capacity*2*sizeof(float));
+        if (merged->texcoords2 != NULL) merged->texcoords2 = (float *)RL_REALLOC(merged->texcoords2, capacity*2*sizeof(float));
+        if (merged->normals != NULL) merged->normals = (float *)RL_REALLOC(merged->normals, capacity*3*sizeof(float));
+        if (merged->tangents != NULL) merged->tangents = (float *)RL_REALLOC(merged->tangents, capacity*4*sizeof(float));
+        if (merged->colors != NULL) merged->colors = (unsigned char *)RL_REALLOC(merged->colors, capacity*4*sizeof(unsigned char));
+
+        target->vertexCapacity = capacity;
+    }
+
+    if ((mesh.texcoords != NULL) && (merged->texcoords == NULL)) merged->texcoords = (float *)RL_CALLOC(target->vertexCapacity*2, sizeof(float));
+    if ((mesh.texcoords2 != NULL) && (merged->texcoords2 == NULL)) merged->texcoords2 = (float *)RL_CALLOC(target->vertexCapacity*2, sizeof(float));
+    if ((mesh.normals != NULL) && (merged->normals == NULL))
+    {
+        merged->normals = (float *)RL_CALLOC(target->vertexCapacity*3, sizeof(float));
+        for (int i = 0; i < vertexOffset; i++) merged->normals[i*3 + 1] = 1.0f;
+    }
+    if ((mesh.tangents != NULL) && (merged->tangents == NULL))
+    {
+        merged->tangents = (float *)RL_CALLOC(target->vertexCapacity*4, sizeof(float));
+        for (int i = 0; i < vertexOffset; i++) { merged->tangents[i*4] = 1.0f; merged->tangents[i*4 + 3] = 1.0f; }
+    }
+    if ((mesh.colors != NULL) && (merged->colors == NULL))
+    {
+        merged->colors = (unsigned char *)RL_MALLOC(target->vertexCapacity*4*sizeof(unsigned char));
+        memset(merged->colors, 255, vertexOffset*4*sizeof(unsigned char));
+    }
+
+    // Transform vertex data, normals use the inverse transpose of transform
+    rl_Matrix normalMatrix = GetNormalMatrix(transform);
+
+    for (int i = 0; i < mesh.vertexCount; i++)
+    {
+        int v = vertexOffset + i;
+
+        rl_Vector3 position = Vector3Transform((rl_Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] }, transform);
+        merged->vertices[v*3] = position.x;
+        merged->vertices[v*3 + 1] = position.y;
+        merged->vertices[v*3 + 2] = position.z;
+
+        if (merged->texcoords != NULL)
+        {
+            merged->texcoords[v*2] = (mesh.texcoords != NULL)? mesh.texcoords[i*2] : 0.0f;
+            merged->texcoords[v*2 + 1] = (mesh.texcoords != NULL)? mesh.texcoords[i*2 + 1] : 0.0f;
+        }
+
+        if (merged->texcoords2 != NULL)
+        {
+            merged->texcoords2[v*2] = (mesh.texcoords2 != NULL)? mesh.texcoords2[i*2] : 0.0f;
+            merged->texcoords2[v*2 + 1] = (mesh.texcoords2 != NULL)? mesh.texcoords2[i*2 + 1] : 0.0f;
+        }
+
+        if (merged->normals != NULL)
+        {
+            rl_Vector3 normal = { 0.0f, 1.0f, 0.0f };
+            if (mesh.normals != NULL) normal = Vector3Normalize(Vector3Transform((rl_Vector3){ mesh.normals[i*3], mesh.normals[i*3 + 1], mesh.normals[i*3 + 2] }, normalMatrix));
+
+            merged->normals[v*3] = normal.x;
+            merged->normals[v*3 + 1] = normal.y;
+            merged->normals[v*3 + 2] = normal.z;
+        }
+
+        if (merged->tangents != NULL)
+        {
+            rl_Vector4 tangent = { 1.0f, 0.0f, 0.0f, 1.0f };
+
+            if (mesh.tangents != NULL)
+            {
+                // Tangents are directions, translation is not applied
+                rl_Vector3 direction = { mesh.tangents[i*4], mesh.tangents[i*4 + 1], mesh.tangents[i*4 + 2] };
+                direction = Vector3Normalize(Vector3Subtract(Vector3Transform(direction, transform), Vector3Transform(Vector3Zero(), transform)));
+                tangent = (rl_Vector4){ direction.x, direction.y, direction.z, mesh.tangents[i*4 + 3] };
+            }
+
+            merged->tangents[v*4] = tangent.x;
+            merged->tangents[v*4 + 1] = tangent.y;
+            merged->tangents[v*4 + 2] = tangent.z;
+            merged->tangents[v*4 + 3] = tangent.w;
+        }
+
+        if (merged->colors != NULL)
+        {
+            if (mesh.colors != NULL) memcpy(&merged->colors[v*4], &mesh.colors[i*4], 4*sizeof(unsigned char));
+            else memset(&merged->colors[v*4], 255, 4*sizeof(unsigned char));
+        }
+    }
+
+    // Append indices, non-indexed meshes are indexed sequentially
+    if ((indexOffset + indexCount) > target->indexCapacity)
+    {
+        int capacity = (target->indexCapacity > 0)? target->indexCapacity : 3072;
+        while (capacity < (indexOffset + indexCount)) capacity *= 2;
+
+        merged->indices = (unsigned short *)RL_REALLOC(merged->indices, capacity*sizeof(unsigned short));
+        target->indexCapacity = capacity;
+    }
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        merged->indices[indexOffset + i] = (unsigned short)(vertexOffset + ((mesh.indices != NULL)? mesh.indices[i] : i));
+    }
+
+    merged->vertexCount = vertexCount;
+    merged->triangleCount += indexCount/3;
+
+    piece->vertexOffset = vertexOffset;
+    piece->vertexCount = mesh.vertexCount;
+    piece->indexOffset = indexOffset;
+    piece->indexCount = indexCount;
+}
+
+// Compare draw list commands sort key (shader, material, mesh)
+static int CompareDrawListCommands(const void *a, const void *b)
+{
+    const DrawListCommand *commandA = (const DrawListCommand *)a;
+    const DrawListCommand *commandB = (const DrawListCommand *)b;
+
+    if (commandA->shaderId != commandB->shaderId) return (commandA->shaderId < commandB->shaderId)? -1 : 1;
+    if (commandA->materialIndex != commandB->materialIndex) return (commandA->materialIndex < commandB->materialIndex)? -1 : 1;
+    if (commandA->meshId != commandB->meshId) return (commandA->meshId < commandB->meshId)? -1 : 1;
+
+    return commandA->item - commandB->item;
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Set draw list material, binding material maps and uploading material colors
+// NOTE: Previous material maps not used by material are unbound, material NULL unbinds all previous maps
+static void SetDrawListMaterial(const rl_Material *material, const rl_Material *previous)
+{
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
+    {
+        bool cubemap = ((i == MATERIAL_MAP_IRRADIANCE) || (i == MATERIAL_MAP_PREFILTER) || (i == MATERIAL_MAP_CUBEMAP));
+        unsigned int previousId = (previous != NULL)? previous->maps[i].texture.id : 0;
+        unsigned int textureId = (material != NULL)? material->maps[i].texture.id : 0;
+
+        if (textureId > 0)
+        {
+            if (textureId == previousId) continue;
+
+            // Select current shader texture slot and enable texture
+            rlActiveTextureSlot(i);
+            if (cubemap) rlEnableTextureCubemap(textureId);
+            else rlEnableTexture(textureId);
+
+            rlSetUniform(material->shader.locs[rl_SHADER_LOC_MAP_DIFFUSE + i], &i, SHADER_UNIFORM_INT, 1);
+        }
+        else if (previousId > 0)
+        {
+            rlActiveTextureSlot(i);
+            if (cubemap) rlDisableTextureCubemap();
+            else rlDisableTexture();
+        }
+    }
+
+    if (material == NULL) return;
+
+    // Upload to shader material.colDiffuse and material.colSpecular (if locations available)
+    if (material->shader.locs[SHADER_LOC_COLOR_DIFFUSE] != -1)
+    {
+        rl_Color color = material->maps[rl_MATERIAL_MAP_DIFFUSE].color;
+        float values[4] = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+        rlSetUniform(material->shader.locs[SHADER_LOC_COLOR_DIFFUSE], values, SHADER_UNIFORM_VEC4, 1);
+    }
+
+    if (material->shader.locs[SHADER_LOC_COLOR_SPECULAR] != -1)
+    {
+        rl_Color color = material->maps[rl_MATERIAL_MAP_SPECULAR].color;
+        float values[4] = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+        rlSetUniform(material->shader.locs[SHADER_LOC_COLOR_SPECULAR], values, SHADER_UNIFORM_VEC4, 1);
+    }
+}
+#endif
+
+// Get draw list model world bounds (all meshes)
+// NOTE: Models with any mesh bounds empty (not computed) are unbounded, they intersect any region
+static rl_BoundingBox GetDrawListModelBounds(const rl_DrawList *list, int index)
+{
+    const DrawListModel *entry = &list->models[index];
+    rl_BoundingBox bounds = { { FLT_MAX, FLT_MAX, FLT_MAX }, { -FLT_MAX, -FLT_MAX, -FLT_MAX } };
+
+    for (int i = entry->firstItem; i < (entry->firstItem + entry->itemCount); i++)
+    {
+        const DrawListItem *item = &list->items[i];
+        rl_Vector3 min = item->mesh.boundsMin;
+        rl_Vector3 max = item->mesh.boundsMax;
+
+        if (Vector3Equals(min, max))
+        {
+            bounds.min = (rl_Vector3){ -1e30f, -1e30f, -1e30f };
+            bounds.max = (rl_Vector3){ 1e30f, 1e30f, 1e30f };
+            break;
+        }
+
+        for (int j = 0; j < 8; j++)
+        {
+            rl_Vector3 corner = { (j & 1)? max.x : min.x, (j & 2)? max.y : min.y, (j & 4)? max.z : min.z };
+            corner = Vector3Transform(corner, item->world);
+            bounds.min = Vector3Min(bounds.min, corner);
+            bounds.max = Vector3Max(bounds.max, corner);
+        }
+    }
+
+    return bounds;
+}
+
+// Track draw list change, world bounds affected by a model added, moved or hidden
+static void TrackDrawListChange(rl_DrawList *list, rl_BoundingBox bounds)
+{
+    list->version++;
+
+    DrawListChange *change = &list->changes[list->version%MAX_DRAWLIST_TRACKED_CHANGES];
+    change->version = list->version;
+    change->bounds = bounds;
+}
+
+#if defined(SUPPORT_SHADOW_MAPS) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+// Get shadow cascade frustum, near plane disabled
+// NOTE: Casters between light and cascade sphere are drawn clamped to near plane (pancaking)
+static rl_Frustum GetShadowCascadeFrustum(rl_Matrix viewProj)
+{
+    rl_Frustum frustum = FrustumFromMatrix(viewProj);
+    frustum.planes[4] = (rl_Vector4){ 0.0f, 0.0f, 0.0f, 1.0f };
+
+    return frustum;
+}
+
+// Check if shadow cascade drawn data is still valid: same matrix and casters,
+// no casters draw list change inside cascade since it was drawn
+static bool IsShadowCascadeCached(const ShadowCascade *cascade, const rl_DrawList *casters, rl_Matrix viewProj)
+{
+    if (!cascade->valid || (cascade->casters != casters)) return false;
+    if (memcmp(&cascade->viewProj, &viewProj, sizeof(rl_Matrix)) != 0) return false;
+    if (casters == NULL) return true;
+
+    unsigned int changeCount = casters->version - cascade->version;
+    if (changeCount == 0) return true;
+    if (changeCount > MAX_DRAWLIST_TRACKED_CHANGES) return false;   // Changes lost, ring buffer overwritten
+
+    rl_Frustum frustum = GetShadowCascadeFrustum(viewProj);
+
+    for (unsigned int version = cascade->version + 1; version != (casters->version + 1); version++)
+    {
+        const DrawListChange *change = &casters->changes[version%MAX_DRAWLIST_TRACKED_CHANGES];
+        if (FrustumCheckBox(frustum, change->bounds.min, change->bounds.max)) return false;
+    }
+
+    return true;
+}
+
+// Draw casters into shadow cascade depth layer
+static void DrawShadowCascade(rl_ShadowMap *shadowMap, int index, const rl_DrawList *casters)
+{
+    rl_Matrix viewProj = shadowMap->cascades[index].viewProj;
+    int culled = 0;
+
+    rlFramebufferAttachLayer(shadowMap->fboId, shadowMap->depth.id, RL_ATTACHMENT_DEPTH, index, 0);
+    rlEnableFramebuffer(shadowMap->fboId);
+    rlViewport(0, 0, shadowMap->depth.width, shadowMap->depth.height);
+    rlClearScreenBuffers();
+
+    if (casters == NULL) return;
+
+    rlEnableShader(shadowShader.id);
+
+    for (int i = 0; i < casters->itemCount; i++)
+    {
+        const DrawListItem *item = &casters->items[i];
+        rl_Mesh mesh = item->mesh;
+
+        // Hidden models and skinned meshes (animated pose not available) do not cast shadows
+        if (!casters->models[item->modelIndex].visible || (mesh.boneCount > 0) || (mesh.vaoId == 0)) continue;
+
+        rl_Matrix mvp = MatrixMultiply(item->world, viewProj);
+
+        if (!Vector3Equals(mesh.boundsMin, mesh.boundsMax) && !FrustumCheckBox(GetShadowCascadeFrustum(mvp), mesh.boundsMin, mesh.boundsMax))
+        {
+            culled++;
+            continue;
+        }
+
+        rlSetUniformMatrix(shadowShader.mvpLoc, mvp);
+        rlEnableVertexArray(mesh.vaoId);
+
+        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
+        else rlDrawVertexArray(0, mesh.vertexCount);
+    }
+
+    if (culled > 0) rlAddCulledMeshes(culled);
+}
+#endif
+
+#if defined(SUPPORT_DEFERRED_RENDERING) && ((defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_21)) || defined(GRAPHICS_API_OPENGL_ES3))
+// Get material shader for current pass, default shader replaced by G-buffer shader inside rl_BeginDeferredMode()
+static rl_Shader GetDeferredShader(rl_Shader shader)
+{
+    if ((deferredActive != NULL) && (shader.id == rlGetShaderIdDefault())) shader = deferredShaders.geometry;
+
+    return shader;
+}
+
+// Generate light volume vertices, icosahedron subdivided once (80 triangles, not indexed)
+// NOTE: Vertices are scaled so the polyhedron circumscribes the unit sphere, lit pixels are never clipped
+static float *GenLightVolumeVertices(int *vertexCount)
+{
+    const float t = 1.618034f;      // Golden ratio
+    rl_Vector3 ico[12] = {
+        { -1, t, 0 }, { 1, t, 0 }, { -1, -t, 0 }, { 1, -t, 0 }, { 0, -1, t }, { 0, 1, t },
+        { 0, -1, -t }, { 0, 1, -t }, { t, 0, -1 }, { t, 0, 1 }, { -t, 0, -1 }, { -t, 0, 1 }
+    };
+    const unsigned char faces[20][3] = {
+        { 0, 11, 5 }, { 0, 5, 1 }, { 0, 1, 7 }, { 0, 7, 10 }, { 0, 10, 11 }, { 1, 5, 9 }, { 5, 11, 4 }, { 11, 10, 2 }, { 10, 7, 6 }, { 7, 1, 8 },
+        { 3, 9, 4 }, { 3, 4, 2 }, { 3, 2, 6 }, { 3, 6, 8 }, { 3, 8, 9 }, { 4, 9, 5 }, { 2, 4, 11 }, { 6, 2, 10 }, { 8, 6, 7 }, { 9, 8, 1 }
+    };
+
+    rl_Vector3 *triangles = (rl_Vector3 *)RL_MALLOC(80*3*sizeof(rl_Vector3));
+    int count = 0;
+
+    for (int i = 0; i < 20; i++)
+    {
+        rl_Vector3 a = Vector3Normalize(ico[faces[i][0]]);
+        rl_Vector3 b = Vector3Normalize(ico[faces[i][1]]);
+        rl_Vector3 c = Vector3Normalize(ico[faces[i][2]]);
+        rl_Vector3 ab = Vector3Normalize(Vector3Add(a, b));
+        rl_Vector3 bc = Vector3Normalize(Vector3Add(b, c));
+        rl_Vector3 ca = Vector3Normalize(Vector3Add(c, a));
+        rl_Vector3 split[12] = { a, ab, ca, ab, b, bc, ca, bc, c, ab, bc, ca };
+
+        for (int j = 0; j < 12; j++) triangles[count++] = split[j];
+    }
+
+    // Scale by inverse of nearest face plane distance
+    float inradius = 1.0f;
+    for (int i = 0; i < count; i += 3)
+    {
+        rl_Vector3 normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(triangles[i + 1], triangles[i]), Vector3Subtract(triangles[i + 2], triangles[i])));
+        inradius = fminf(inradius, fabsf(Vector3DotProduct(normal, triangles[i])));
+    }
+
+    float *vertices = (float *)RL_MALLOC(count*3*sizeof(float));
+    for (int i = 0; i < count; i++)
+    {
+        vertices[i*3 + 0] = triangles[i].x/inradius;
+        vertices[i*3 + 1] = triangles[i].y/inradius;
+        vertices[i*3 + 2] = triangles[i].z/inradius;
+    }
+
+    RL_FREE(triangles);
+
+    *vertexCount = count;
+    return vertices;
+}
+#endif
+
+
+// Sort billboard batch instances by view depth (back to front) into sorted instances
+// NOTE: Least significant digit radix sort, every 8 bit pass counts digits per chunk and scatters
+// chunks keys on worker threads, chunks offsets follow chunks order so the sort is stable
+static void SortBillboardBatch(rl_BillboardBatch *batch, rl_Vector3 viewPosition, rl_Vector3 viewForward)
+{
+    BillboardSortJob job = { 0 };
+    job.batch = batch;
+    job.viewPosition = viewPosition;
+    job.viewForward = viewForward;
+
+    WorkerJob workerJob = { 0 };
+    workerJob.data = &job;
+    workerJob.count = batch->count;
+    workerJob.chunkSize = BILLBOARD_SORT_CHUNK_SIZE;
+
+    workerJob.process = ProcessBillboardKeysRange;
+    RunWorkerJob(&workerJob);
+
+    int chunkCount = (batch->count + BILLBOARD_SORT_CHUNK_SIZE - 1)/BILLBOARD_SORT_CHUNK_SIZE;
+
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        job.shift = shift;
+        workerJob.process = ProcessBillboardHistogramRange;
+        RunWorkerJob(&workerJob);
+
+        // Pass is skipped if all keys share the same digit
+        bool skip = false;
+
+        for (int digit = 0; (digit < 256) && !skip; digit++)
+        {
+            int total = 0;
+            for (int c = 0; c < chunkCount; c++) total += batch->histograms[c*256 + digit];
+            if (total == batch->count) skip = true;
+        }
+
+        if (skip) continue;
+
+        // Digits counts converted to chunks scatter offsets
+        int offset = 0;
+
+        for (int digit = 0; digit < 256; digit++)
+        {
+            for (int c = 0; c < chunkCount; c++)
+            {
+                int digitCount = batch->histograms[c*256 + digit];
+                batch->histograms[c*256 + digit] = offset;
+                offset += digitCount;
+            }
+        }
+
+        workerJob.process = ProcessBillboardScatterRange;
+        RunWorkerJob(&workerJob);
+
+        job.source = 1 - job.source;
+    }
+
+    workerJob.process = ProcessBillboardGatherRange;
+    RunWorkerJob(&workerJob);
+}
+
+// Load terrain image heights, normalized [0.0f..1.0f]
+// NOTE: 32 bit float images are used directly, for higher precision than 8 bit grayscale
+static float *LoadTerrainImageHeights(rl_Image image)
+{
+    float *values = (float *)RL_MALLOC(image.width*image.height*sizeof(float));
+
+    if (image.format == PIXELFORMAT_UNCOMPRESSED_R32) memcpy(values, image.data, image.width*image.height*sizeof(float));
+    else
+    {
+        rl_Color *pixels = rl_LoadImageColors(image);
+        for (int i = 0; i < image.width*image.height; i++) values[i] = (float)(pixels[i].r + pixels[i].g + pixels[i].b)/(3.0f*255.0f);
+        rl_UnloadImageColors(pixels);
+    }
+
+    return values;
+}
+
+// Sample terrain image heights with bilinear filtering, u and v in [0.0f..1.0f] range
+static float SampleTerrainImage(const float *values, int width, int height, float u, float v)
+{
+    float px = Clamp(u, 0.0f, 1.0f)*(width - 1);
+    float pz = Clamp(v, 0.0f, 1.0f)*(height - 1);
+
+    int x0 = (int)px;
+    int z0 = (int)pz;
+    int x1 = (x0 < (width - 1))? x0 + 1 : x0;
+    int z1 = (z0 < (height - 1))? z0 + 1 : z0;
+    float tx = px - x0;
+    float tz = pz - z0;
+
+    float top = Lerp(values[z0*width + x0], values[z0*width + x1], tx);
+    float bottom = Lerp(values[z1*width + x0], values[z1*width + x1], tx);
+
+    return Lerp(top, bottom, tz);
+}
+
+// Get terrain chunk grid cell height, interpolated on cell triangles (split as chunk mesh indices)
+// NOTE: Cell origin (x, z) and cell size are in grid samples, tx and tz in [0.0f..1.0f] inside cell
+static float GetTerrainCellHeight(const float *heights, int x, int z, int step, float tx, float tz)
+{
+    const int samples = TERRAIN_CHUNK_QUADS + 1;
+
+    float h00 = heights[z*samples + x];
+    float h10 = heights[z*samples + x + step];
+    float h01 = heights[(z + step)*samples + x];
+    float h11 = heights[(z + step)*samples + x + step];
+
+    if ((tx + tz) <= 1.0f) return h00 + tx*(h10 - h00) + tz*(h01 - h00);
+    else return h11 + (1.0f - tx)*(h01 - h11) + (1.0f - tz)*(h10 - h11);
+}
+
+// Get terrain chunk height at grid sample, out of chunk samples are read from neighbour chunks (if heights available)
+static float GetTerrainChunkSample(const rl_Terrain *terrain, int cx, int cz, int x, int z)
+{
+    // Neighbour chunks share border samples, so sample -1 is neighbour sample TERRAIN_CHUNK_QUADS - 1
+    if ((x < 0) && (cx > 0) && (terrain->chunks[cz*terrain->chunksX + cx - 1].heights != NULL)) { cx--; x += TERRAIN_CHUNK_QUADS; }
+    else if ((x > TERRAIN_CHUNK_QUADS) && (cx < (terrain->chunksX - 1)) && (terrain->chunks[cz*terrain->chunksX + cx + 1].heights != NULL)) { cx++; x -= TERRAIN_CHUNK_QUADS; }
+
+    if ((z < 0) && (cz > 0) && (terrain->chunks[(cz - 1)*terrain->chunksX + cx].heights != NULL)) { cz--; z += TERRAIN_CHUNK_QUADS; }
+    else if ((z > TERRAIN_CHUNK_QUADS) && (cz < (terrain->chunksZ - 1)) && (terrain->chunks[(cz + 1)*terrain->chunksX + cx].heights != NULL)) { cz++; z -= TERRAIN_CHUNK_QUADS; }
+
+    const TerrainChunk *chunk = &terrain->chunks[cz*terrain->chunksX + cx];
+
+    x = (x < 0)? 0 : ((x > TERRAIN_CHUNK_QUADS)? TERRAIN_CHUNK_QUADS : x);
+    z = (z < 0)? 0 : ((z > TERRAIN_CHUNK_QUADS)? TERRAIN_CHUNK_QUADS : z);
+
+    return chunk->heights[z*(TERRAIN_CHUNK_QUADS + 1) + x];
+}
+
+// Get terrain chunk distance to view position, on horizontal plane
+static float GetTerrainChunkDistance(const rl_Terrain *terrain, int cx, int cz, rl_Vector3 position)
+{
+    float minX = cx*terrain->chunkSize.x;
+    float minZ = cz*terrain->chunkSize.z;
+
+    float dx = fmaxf(fmaxf(minX - position.x, position.x - (minX + terrain->chunkSize.x)), 0.0f);
+    float dz = fmaxf(fmaxf(minZ - position.z, position.z - (minZ + terrain->chunkSize.z)), 0.0f);
+
+    return sqrtf(dx*dx + dz*dz);
+}
+
+// Append terrain chunk level indices, grid cells and skirts for level cells step
+static int AppendTerrainLevelIndices(unsigned short *indices, int step)
+{
+    const int samples = TERRAIN_CHUNK_QUADS + 1;
+    const int skirt = samples*samples;      // First skirt vertex, per edge: z = 0, z = max, x = 0, x = max
+    int count = 0;
+
+    for (int z = 0; z < TERRAIN_CHUNK_QUADS; z += step)
+    {
+        for (int x = 0; x < TERRAIN_CHUNK_QUADS; x += step)
+        {
+            unsigned short v00 = (unsigned short)(z*samples + x);
+            unsigned short v10 = (unsigned short)(z*samples + x + step);
+            unsigned short v01 = (unsigned short)((z + step)*samples + x);
+            unsigned short v11 = (unsigned short)((z + step)*samples + x + step);
+
+            indices[count++] = v00; indices[count++] = v01; indices[count++] = v10;
+            indices[count++] = v10; indices[count++] = v01; indices[count++] = v11;
+        }
+    }
+
+    // Skirts hide cracks between chunks using different levels, triangles face outwards
+    for (int i = 0; i < TERRAIN_CHUNK_QUADS; i += step)
+    {
+        unsigned short a, b, sa, sb;
+
+        a = (unsigned short)i; b = (unsigned short)(i + step);
+        sa = (unsigned short)(skirt + i); sb = (unsigned short)(skirt + i + step);
+        indices[count++] = a; indices[count++] = b; indices[count++] = sa;
+        indices[count++] = b; indices[count++] = sb; indices[count++] = sa;
+
+        a = (unsigned short)(TERRAIN_CHUNK_QUADS*samples + i); b = (unsigned short)(TERRAIN_CHUNK_QUADS*samples + i + step);
+        sa = (unsigned short)(skirt + samples + i); sb = (unsigned short)(skirt + samples + i + step);
+        indices[count++] = a; indices[count++] = sa; indices[count++] = b;
+        indices[count++] = b; indices[count++] = sa; indices[count++] = sb;
+
+        a = (unsigned short)(i*samples); b = (unsigned short)((i + step)*samples);
+        sa = (unsigned short)(skirt + 2*samples + i); sb = (unsigned short)(skirt + 2*samples + i + step);
+        indices[count++] = a; indices[count++] = sa; indices[count++] = b;
+        indices[count++] = b; indices[count++] = sa; indices[count++] = sb;
+
+        a = (unsigned short)(i*samples + TERRAIN_CHUNK_QUADS); b = (unsigned short)((i + step)*samples + TERRAIN_CHUNK_QUADS);
+        sa = (unsigned short)(skirt + 3*samples + i); sb = (unsigned short)(skirt + 3*samples + i + step);
+        indices[count++] = a; indices[count++] = b; indices[count++] = sa;
+        indices[count++] = b; indices[count++] = sb; indices[count++] = sa;
+    }
+
+    return count;
+}
+
+// Load terrain chunk mesh from chunk heights: grid vertices, skirts and levels of detail (geomipmaps)
+// NOTE: Coarser levels skip grid samples, their error is the maximum height difference to full detail
+static void LoadTerrainChunkMesh(rl_Terrain *terrain, int cx, int cz)
+{
+    TerrainChunk *chunk = &terrain->chunks[cz*terrain->chunksX + cx];
+    const int samples = TERRAIN_CHUNK_QUADS + 1;
+    const float spacingX = terrain->chunkSize.x/TERRAIN_CHUNK_QUADS;
+    const float spacingZ = terrain->chunkSize.z/TERRAIN_CHUNK_QUADS;
+
+    rl_Mesh mesh = { 0 };
+    mesh.vertexCount = samples*samples + 4*samples;
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+
+    // Levels error, cells step doubles on every level
+    int levelCount = 0;
+    float errors[MAX_MESH_LOD_LEVELS] = { 0 };
+
+    for (int step = 2; (step <= TERRAIN_CHUNK_QUADS) && (levelCount < MAX_MESH_LOD_LEVELS); step *= 2)
+    {
+        float error = (levelCount > 0)? errors[levelCount - 1] : 0.0f;
+
+        for (int z = 0; z < samples; z++)
+        {
+            for (int x = 0; x < samples; x++)
+            {
+                int x0 = (x < TERRAIN_CHUNK_QUADS)? (x/step)*step : TERRAIN_CHUNK_QUADS - step;
+                int z0 = (z < TERRAIN_CHUNK_QUADS)? (z/step)*step : TERRAIN_CHUNK_QUADS - step;
+                float height = GetTerrainCellHeight(chunk->heights, x0, z0, step, (float)(x - x0)/step, (float)(z - z0)/step);
+
+                error = fmaxf(error, fabsf(height - chunk->heights[z*samples + x]));
+            }
+        }
+
+        errors[levelCount] = error;
+        levelCount++;
+    }
+
+    // Skirts depth covers the coarsest level error, the largest crack between neighbour chunks
+    float skirtDepth = ((levelCount > 0)? errors[levelCount - 1] : 0.0f) + terrain->chunkSize.y*0.01f + 0.01f;
+
+    for (int i = 0; i < mesh.vertexCount; i++)
+    {
+        int x, z;
+        float depth = 0.0f;
+
+        if (i < samples*samples) { x = i%samples; z = i/samples; }
+        else
+        {
+            // Skirt vertex, below grid border vertex
+            int edge = (i - samples*samples)/samples;
+            int k = (i - samples*samples)%samples;
+
+            if (edge == 0) { x = k; z = 0; }
+            else if (edge == 1) { x = k; z = TERRAIN_CHUNK_QUADS; }
+            else if (edge == 2) { x = 0; z = k; }
+            else { x = TERRAIN_CHUNK_QUADS; z = k; }
+
+            depth = skirtDepth;
+        }
+
+        mesh.vertices[i*3] = (cx*TERRAIN_CHUNK_QUADS + x)*spacingX;
+        mesh.vertices[i*3 + 1] = chunk->heights[z*samples + x] - depth;
+        mesh.vertices[i*3 + 2] = (cz*TERRAIN_CHUNK_QUADS + z)*spacingZ;
+
+        // Normals from central differences, borders use neighbour chunks samples if loaded
+        float dx = GetTerrainChunkSample(terrain, cx, cz, x + 1, z) - GetTerrainChunkSample(terrain, cx, cz, x - 1, z);
+        float dz = GetTerrainChunkSample(terrain, cx, cz, x, z + 1) - GetTerrainChunkSample(terrain, cx, cz, x, z - 1);
+        rl_Vector3 normal = Vector3Normalize((rl_Vector3){ -dx*spacingZ, 2.0f*spacingX*spacingZ, -dz*spacingX });
+
+        mesh.normals[i*3] = normal.x;
+        mesh.normals[i*3 + 1] = normal.y;
+        mesh.normals[i*3 + 2] = normal.z;
+
+        mesh.texcoords[i*2] = (float)(cx*TERRAIN_CHUNK_QUADS + x)/(terrain->chunksX*TERRAIN_CHUNK_QUADS);
+        mesh.texcoords[i*2 + 1] = (float)(cz*TERRAIN_CHUNK_QUADS + z)/(terrain->chunksZ*TERRAIN_CHUNK_QUADS);
+    }
+
+    // Full detail indices followed by levels indices, as generated by rl_GenMeshLOD()
+    int indexCount = 0;
+    for (int step = 1, level = 0; level <= levelCount; step *= 2, level++)
+    {
+        int cells = TERRAIN_CHUNK_QUADS/step;
+        indexCount += cells*cells*6 + 4*cells*6;
+    }
+
+    mesh.indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+    mesh.triangleCount = AppendTerrainLevelIndices(mesh.indices, 1)/3;
+
+    rl_MeshLOD *lod = (rl_MeshLOD *)RL_CALLOC(1, sizeof(rl_MeshLOD));
+    int offset = mesh.triangleCount*3;
+
+    for (int level = 0; level < levelCount; level++)
+    {
+        int count = AppendTerrainLevelIndices(mesh.indices + offset, 2 << level);
+
+        lod->indexOffsets[level] = offset;
+        lod->triangleCounts[level] = count/3;
+        lod->errors[level] = errors[level];
+        offset += count;
+    }
+
+    lod->levelCount = levelCount;
+    mesh.lod = lod;
+
+    rl_BoundingBox bounds = rl_GetMeshBoundingBox(mesh);
+    lod->center = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+    lod->radius = Vector3Distance(bounds.min, bounds.max)*0.5f;
+
+    rl_UploadMesh(&mesh, false);
+
+    chunk->mesh = mesh;
+    chunk->state = TERRAIN_CHUNK_LOADED;
+}
+
+// Load terrain chunk height tile from file, resampled to chunk grid
+static void LoadTerrainChunkTile(rl_Terrain *terrain, int cx, int cz)
+{
+    TerrainChunk *chunk = &terrain->chunks[cz*terrain->chunksX + cx];
+    rl_Image image = rl_LoadImage(rl_TextFormat(terrain->fileName, cx, cz));
+
+    if ((image.data == NULL) || (image.width < 2) || (image.height < 2))
+    {
+        TRACELOG(LOG_WARNING, "TERRAIN: [%i, %i] Failed to load height tile", cx, cz);
+        rl_UnloadImage(image);
+        chunk->state = TERRAIN_CHUNK_FAILED;
+        return;
+    }
+
+    const int samples = TERRAIN_CHUNK_QUADS + 1;
+    float *values = LoadTerrainImageHeights(image);
+    chunk->heights = (float *)RL_MALLOC(samples*samples*sizeof(float));
+
+    for (int z = 0; z < samples; z++)
+    {
+        for (int x = 0; x < samples; x++)
+        {
+            chunk->heights[z*samples + x] = SampleTerrainImage(values, image.width, image.height,
+                (float)x/TERRAIN_CHUNK_QUADS, (float)z/TERRAIN_CHUNK_QUADS)*terrain->chunkSize.y;
+        }
+    }
+
+    RL_FREE(values);
+    rl_UnloadImage(image);
+
+    LoadTerrainChunkMesh(terrain, cx, cz);
+}
+
+// Unload terrain chunk heights and mesh, chunk can be loaded again
+static void UnloadTerrainChunk(TerrainChunk *chunk)
+{
+    if (chunk->state == TERRAIN_CHUNK_LOADED) rl_UnloadMesh(chunk->mesh);
+
+    RL_FREE(chunk->heights);
+    memset(chunk, 0, sizeof(TerrainChunk));
+}
+
+// Get voxel world voxel type, 0 for out of world voxels
+static unsigned char GetVoxelWorldVoxel(const rl_VoxelWorld *world, int x, int y, int z)
+{
+    int sizeX = world->chunksX*VOXEL_CHUNK_SIZE;
+    int sizeY = world->chunksY*VOXEL_CHUNK_SIZE;
+    int sizeZ = world->chunksZ*VOXEL_CHUNK_SIZE;
+
+    if ((x < 0) || (y < 0) || (z < 0) || (x >= sizeX) || (y >= sizeY) || (z >= sizeZ)) return 0;
+
+    return world->voxels[(z*sizeY + y)*sizeX + x];
+}
+
+// Process voxel chunks meshing range on current thread
+static void ProcessVoxelMeshRange(const void *data, int start, int end)
+{
+    const VoxelMeshJob *job = (const VoxelMeshJob *)data;
+
+    for (int i = start; i < end; i++) MeshVoxelChunk(job->world, job->chunks[i]);
+}
+
+// Mesh voxel chunk with greedy faces merging, faces between solid voxels are culled
+// NOTE: Voxels out of chunk are read from world (neighbour chunks), so faces are culled across chunks borders,
+// every face is meshed by the chunk containing its voxel. Chunk GPU buffers are not accessed
+static void MeshVoxelChunk(rl_VoxelWorld *world, int index)
+{
+    VoxelChunk *chunk = &world->chunks[index];
+    rl_Mesh *mesh = &chunk->mesh;
+
+    int origin[3] = {
+        (index%world->chunksX)*VOXEL_CHUNK_SIZE,
+        ((index/world->chunksX)%world->chunksY)*VOXEL_CHUNK_SIZE,
+        (index/(world->chunksX*world->chunksY))*VOXEL_CHUNK_SIZE
+    };
+
+    int mask[VOXEL_CHUNK_SIZE*VOXEL_CHUNK_SIZE] = { 0 };
+    int quadCount = 0;
+    rl_Vector3 boundsMin = { FLT_MAX, FLT_MAX, FLT_MAX };
+    rl_Vector3 boundsMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+    for (int d = 0; d < 3; d++)
+    {
+        int u = (d + 1)%3;
+        int v = (d + 2)%3;
+
+        // Faces planes along axis, plane p is between voxels p - 1 and p
+        for (int p = 0; p <= VOXEL_CHUNK_SIZE; p++)
+        {
+            for (int j = 0; j < VOXEL_CHUNK_SIZE; j++)
+            {
+                for (int i = 0; i < VOXEL_CHUNK_SIZE; i++)
+                {
+                    int b[3] = { 0 };
+                    b[d] = origin[d] + p;
+                    b[u] = origin[u] + i;
+                    b[v] = origin[v] + j;
+
+                    int a[3] = { b[0], b[1], b[2] };
+                    a[d]--;
+
+                    unsigned char typeA = GetVoxelWorldVoxel(world, a[0], a[1], a[2]);
+                    unsigned char typeB = GetVoxelWorldVoxel(world, b[0], b[1], b[2]);
+                    int face = 0;
+
+                    // Positive faces belong to voxel before plane, negative faces to voxel after plane
+                    if ((typeA != 0) && (typeB == 0) && (p > 0)) face = typeA;
+                    else if ((typeB != 0) && (typeA == 0) && (p < VOXEL_CHUNK_SIZE)) face = -typeB;
+
+                    mask[j*VOXEL_CHUNK_SIZE + i] = face;
+                }
+            }
+
+            // Merge faces with same type and direction in rectangles, widest first
+            for (int j = 0; j < VOXEL_CHUNK_SIZE; j++)
+            {
+                for (int i = 0; i < VOXEL_CHUNK_SIZE;)
+                {
+                    int face = mask[j*VOXEL_CHUNK_SIZE + i];
+
+                    if (face == 0)
+                    {
+                        i++;
+                        continue;
+                    }
+
+                    int width = 1;
+                    while (((i + width) < VOXEL_CHUNK_SIZE) && (mask[j*VOXEL_CHUNK_SIZE + i + width] == face)) width++;
+
+                    int height = 1;
+                    for (bool merge = true; merge && ((j + height) < VOXEL_CHUNK_SIZE);)
+                    {
+                        for (int k = 0; k < width; k++)
+                        {
+                            if (mask[(j + height)*VOXEL_CHUNK_SIZE + i + k] != face) { merge = false; break; }
+                        }
+
+                        if (merge) height++;
+                    }
+
+                    for (int l = 0; l < height; l++) memset(&mask[(j + l)*VOXEL_CHUNK_SIZE + i], 0, width*sizeof(int));
+
+                    // Grow chunk vertex data, indices are the same for every quad
+                    if ((quadCount + 1)*4 > chunk->vertexCapacity)
+                    {
+                        int capacity = (chunk->vertexCapacity > 0)? chunk->vertexCapacity*2 : 1024;
+
+                        mesh->vertices = (float *)RL_REALLOC(mesh->vertices, capacity*3*sizeof(float));
+                        mesh->texcoords = (float *)RL_REALLOC(mesh->texcoords, capacity*2*sizeof(float));
+                        mesh->normals = (float *)RL_REALLOC(mesh->normals, capacity*3*sizeof(float));
+                        mesh->colors = (unsigned char *)RL_REALLOC(mesh->colors, capacity*4*sizeof(unsigned char));
+                        mesh->indices = (unsigned short *)RL_REALLOC(mesh->indices, capacity/4*6*sizeof(unsigned short));
+
+                        for (int q = chunk->vertexCapacity/4; q < capacity/4; q++)
+                        {
+                            mesh->indices[q*6] = (unsigned short)(q*4);
+                            mesh->indices[q*6 + 1] = (unsigned short)(q*4 + 1);
+                            mesh->indices[q*6 + 2] = (unsigned short)(q*4 + 2);
+                            mesh->indices[q*6 + 3] = (unsigned short)(q*4);
+                            mesh->indices[q*6 + 4] = (unsigned short)(q*4 + 2);
+                            mesh->indices[q*6 + 5] = (unsigned short)(q*4 + 3);
+                        }
+
+                        chunk->vertexCapacity = capacity;
+                    }
+
+                    // Quad corners, counter-clockwise when seen from face normal side
+                    int corners[4][2] = { { 0, 0 }, { width, 0 }, { width, height }, { 0, height } };
+                    if (face < 0)
+                    {
+                        corners[1][0] = 0; corners[1][1] = height;
+                        corners[3][0] = width; corners[3][1] = 0;
+                    }
+
+                    rl_Color color = world->colors[(face > 0)? face : -face];
+
+                    for (int c = 0; c < 4; c++)
+                    {
+                        int vertex = quadCount*4 + c;
+                        float position[3] = { 0 };
+                        float normal[3] = { 0 };
+
+                        position[d] = (float)(origin[d] + p)*world->voxelSize;
+                        position[u] = (float)(origin[u] + i + corners[c][0])*world->voxelSize;
+                        position[v] = (float)(origin[v] + j + corners[c][1])*world->voxelSize;
+                        normal[d] = (face > 0)? 1.0f : -1.0f;
+
+                        for (int k = 0; k < 3; k++)
+                        {
+                            mesh->vertices[vertex*3 + k] = position[k];
+                            mesh->normals[vertex*3 + k] = normal[k];
+                        }
+
+                        // Texture coordinates in voxels units, textures repeat on merged faces
+                        mesh->texcoords[vertex*2] = (float)corners[c][0];
+                        mesh->texcoords[vertex*2 + 1] = (float)corners[c][1];
+
+                        mesh->colors[vertex*4] = color.r;
+                        mesh->colors[vertex*4 + 1] = color.g;
+                        mesh->colors[vertex*4 + 2] = color.b;
+                        mesh->colors[vertex*4 + 3] = color.a;
+
+                        boundsMin = Vector3Min(boundsMin, (rl_Vector3){ position[0], position[1], position[2] });
+                        boundsMax = Vector3Max(boundsMax, (rl_Vector3){ position[0], position[1], position[2] });
+                    }
+
+                    quadCount++;
+                    i += width;
+                }
+            }
+        }
+    }
+
+    mesh->vertexCount = quadCount*4;
+    mesh->triangleCount = quadCount*2;
+    mesh->boundsMin = (quadCount > 0)? boundsMin : Vector3Zero();
+    mesh->boundsMax = (quadCount > 0)? boundsMax : Vector3Zero();
+}
+
+// Upload voxel chunk mesh, buffers are updated if meshed vertices fit their capacity
+static void UploadVoxelChunk(VoxelChunk *chunk)
+{
+    rl_Mesh *mesh = &chunk->mesh;
+    if (mesh->vertexCount == 0) return;
+
+    if (chunk->uploadedCapacity >= mesh->vertexCount)
+    {
+        rl_UpdateMeshBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, mesh->vertices, mesh->vertexCount*3*sizeof(float), 0);
+        rl_UpdateMeshBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, mesh->texcoords, mesh->vertexCount*2*sizeof(float), 0);
+        rl_UpdateMeshBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, mesh->normals, mesh->vertexCount*3*sizeof(float), 0);
+        rl_UpdateMeshBuffer(*mesh, RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, mesh->colors, mesh->vertexCount*4*sizeof(unsigned char), 0);
+        return;
+    }
+
+    // Reallocate GPU buffers for full chunk capacity, so next re-meshes only update them
+    if (chunk->uploadedCapacity > 0)
+    {
+        rlUnloadVertexArray(mesh->vaoId);
+        for (int i = 0; i < MAX_MESH_VERTEX_BUFFERS; i++) rlUnloadVertexBuffer(mesh->vboId[i]);
+        RL_FREE(mesh->vboId);
+
+        mesh->vaoId = 0;
+        mesh->vboId = NULL;
+    }
+
+    int vertexCount = mesh->vertexCount;
+    int triangleCount = mesh->triangleCount;
+    rl_Vector3 boundsMin = mesh->boundsMin;
+    rl_Vector3 boundsMax = mesh->boundsMax;
+
+    mesh->vertexCount = chunk->vertexCapacity;
+    mesh->triangleCount = chunk->vertexCapacity/2;
+
+    rl_UploadMesh(mesh, true);
+
+    mesh->vertexCount = vertexCount;
+    mesh->triangleCount = triangleCount;
+    mesh->boundsMin = boundsMin;
+    mesh->boundsMax = boundsMax;
+    chunk->uploadedCapacity = chunk->vertexCapacity;
+}
+
+// Get indices average cache miss ratio, simulating a FIFO vertex cache
+static float GetIndicesACMR(const unsigned int *indices, int indexCount, int vertexCount)
+{
+    // NOTE: Vertex is in cache when less than cache size misses happened since it was loaded
+    int *cacheTime = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    int time = MESH_VERTEX_CACHE_SIZE + 1;
+    int misses = 0;
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        if ((time - cacheTime[indices[i]]) > MESH_VERTEX_CACHE_SIZE)
+        {
+            cacheTime[indices[i]] = time;
+            time++;
+            misses++;
+        }
+    }
+
+    RL_FREE(cacheTime);
+
+    return (float)misses/(float)(indexCount/3);
+}
+
+// Get vertex score for vertex cache optimization (Tom Forsyth algorithm)
+static float GetVertexCacheScore(int cachePosition, int remainingTriangles)
+{
+    if (remainingTriangles == 0) return -1.0f;
+
+    float score = 0.0f;
+
+    if (cachePosition >= 0)
+    {
+        // Vertices of last triangle get a fixed score, so it is not reused immediately
+        if (cachePosition < 3) score = 0.75f;
+        else score = powf(1.0f - (float)(cachePosition - 3)/(float)(MESH_OPTIMIZE_CACHE_SIZE - 3), 1.5f);
+    }
+
+    // Boost vertices with few remaining triangles, to get rid of them
+    score += 2.0f/sqrtf((float)remainingTriangles);
+
+    return score;
+}
+
+// Optimize indices triangles order for vertex cache (Tom Forsyth linear-speed algorithm)
+// NOTE: A LRU cache is simulated, best scored triangle using cached vertices is emitted next
+static void OptimizeIndicesCache(unsigned int *indices, int indexCount, int vertexCount)
+{
+    int triangleCount = indexCount/3;
+
+    // Vertices triangles adjacency, live triangles are kept first on every vertex list
+    int *offsets = (int *)RL_CALLOC(vertexCount + 1, sizeof(int));
+    int *remaining = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    int *adjacency = (int *)RL_MALLOC(indexCount*sizeof(int));
+
+    for (int i = 0; i < indexCount; i++) remaining[indices[i]]++;
+    for (int v = 0; v < vertexCount; v++) offsets[v + 1] = offsets[v] + remaining[v];
+    for (int v = 0; v < vertexCount; v++) remaining[v] = 0;
+    for (int i = 0; i < indexCount; i++) adjacency[offsets[indices[i]] + remaining[indices[i]]++] = i/3;
+
+    int *cachePosition = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    float *vertexScore = (float *)RL_MALLOC(vertexCount*sizeof(float));
+    bool *emitted = (bool *)RL_CALLOC(triangleCount, sizeof(bool));
+    unsigned int *optimized = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        cachePosition[v] = -1;
+        vertexScore[v] = GetVertexCacheScore(-1, remaining[v]);
+    }
+
+    int cache[MESH_OPTIMIZE_CACHE_SIZE + 3] = { 0 };
+    int cacheCount = 0;
+    int scanTriangle = 0;
+
+    // First triangle is the best scored one
+    int bestTriangle = 0;
+    float bestScore = -1.0f;
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        float score = vertexScore[indices[t*3]] + vertexScore[indices[t*3 + 1]] + vertexScore[indices[t*3 + 2]];
+        if (score > bestScore) { bestScore = score; bestTriangle = t; }
+    }
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        // No cached vertex has live triangles, continue with next triangle not emitted
+        if (bestTriangle < 0)
+        {
+            while (emitted[scanTriangle]) scanTriangle++;
+            bestTriangle = scanTriangle;
+        }
+
+        const unsigned int *triangle = &indices[bestTriangle*3];
+        memcpy(&optimized[t*3], triangle, 3*sizeof(unsigned int));
+        emitted[bestTriangle] = true;
+
+        // Remove triangle from its vertices live triangles
+        for (int k = 0; k < 3; k++)
+        {
+            int *list = &adjacency[offsets[triangle[k]]];
+            int count = remaining[triangle[k]];
+
+            for (int j = 0; j < count; j++)
+            {
+                if (list[j] == bestTriangle)
+                {
+                    list[j] = list[count - 1];
+                    list[count - 1] = bestTriangle;
+                    remaining[triangle[k]]--;
+                    break;
+                }
+            }
+        }
+
+        // Update cache, triangle vertices are moved to front
+        int newCache[MESH_OPTIMIZE_CACHE_SIZE + 3] = { (int)triangle[0], (int)triangle[1], (int)triangle[2] };
+        int newCount = 3;
+
+        for (int i = 0; i < cacheCount; i++)
+        {
+            int v = cache[i];
+            if ((v != (int)triangle[0]) && (v != (int)triangle[1]) && (v != (int)triangle[2])) newCache[newCount++] = v;
+        }
+
+        for (int i = 0; i < newCount; i++)
+        {
+            int v = newCache[i];
+            cachePosition[v] = (i < MESH_OPTIMIZE_CACHE_SIZE)? i : -1;
+            vertexScore[v] = GetVertexCacheScore(cachePosition[v], remaining[v]);
+        }
+
+        cacheCount = (newCount < MESH_OPTIMIZE_CACHE_SIZE)? newCount : MESH_OPTIMIZE_CACHE_SIZE;
+        memcpy(cache, newCache, cacheCount*sizeof(int));
+
+        // Find best scored triangle using cached vertices
+        bestTriangle = -1;
+        bestScore = -1.0f;
+
+        for (int i = 0; i < cacheCount; i++)
+        {
+            const int *list = &adjacency[offsets[cache[i]]];
+
+            for (int j = 0; j < remaining[cache[i]]; j++)
+            {
+                const unsigned int *other = &indices[list[j]*3];
+                float score = vertexScore[other[0]] + vertexScore[other[1]] + vertexScore[other[2]];
+                if (score > bestScore) { bestScore = score; bestTriangle = list[j]; }
+            }
+        }
+    }
+
+    memcpy(indices, optimized, indexCount*sizeof(unsigned int));
+
+    RL_FREE(offsets);
+    RL_FREE(remaining);
+    RL_FREE(adjacency);
+    RL_FREE(cachePosition);
+    RL_FREE(vertexScore);
+    RL_FREE(emitted);
+    RL_FREE(optimized);
+}
+
+// Optimize indices triangles clusters order for overdraw
+// NOTE: Clusters are split where vertex cache restarts, outward facing clusters are drawn first
+static void OptimizeIndicesOverdraw(unsigned int *indices, int indexCount, const float *vertices, int vertexCount)
+{
+    int triangleCount = indexCount/3;
+    MeshCluster *clusters = (MeshCluster *)RL_MALLOC(triangleCount*sizeof(MeshCluster));
+    int clusterCount = 0;
+
+    // Split clusters on triangles missing all their vertices in cache
+    int *cacheTime = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    int time = MESH_VERTEX_CACHE_SIZE + 1;
+
+    for (int t = 0; t < triangleCount; t++)
+    {
+        int misses = 0;
+
+        for (int k = 0; k < 3; k++)
+        {
+            unsigned int v = indices[t*3 + k];
+            if ((time - cacheTime[v]) > MESH_VERTEX_CACHE_SIZE) { cacheTime[v] = time; time++; misses++; }
+        }
+
+        if ((t == 0) || (misses == 3))
+        {
+            clusters[clusterCount].start = t;
+            clusters[clusterCount].count = 0;
+            clusterCount++;
+        }
+
+        clusters[clusterCount - 1].count++;
+    }
+
+    RL_FREE(cacheTime);
+
+    // Compute clusters area weighted centroid and normal
+    rl_Vector3 meshCentroid = { 0 };
+    float meshArea = 0.0f;
+
+    for (int c = 0; c < clusterCount; c++)
+    {
+        rl_Vector3 centroid = { 0 };
+        rl_Vector3 normal = { 0 };
+        float area = 0.0f;
+
+        for (int t = clusters[c].start; t < clusters[c].start + clusters[c].count; t++)
+        {
+            const float *a = &vertices[indices[t*3]*3];
+            const float *b = &vertices[indices[t*3 + 1]*3];
+            const float *d = &vertices[indices[t*3 + 2]*3];
+
+            rl_Vector3 p0 = { a[0], a[1], a[2] };
+            rl_Vector3 p1 = { b[0], b[1], b[2] };
+            rl_Vector3 p2 = { d[0], d[1], d[2] };
+            rl_Vector3 cross = Vector3CrossProduct(Vector3Subtract(p1, p0), Vector3Subtract(p2, p0));
+            float triangleArea = Vector3Length(cross);
+
+            centroid = Vector3Add(centroid, Vector3Scale(Vector3Add(Vector3Add(p0, p1), p2), triangleArea/3.0f));
+            normal = Vector3Add(normal, cross);
+            area += triangleArea;
+        }
+
+        meshCentroid = Vector3Add(meshCentroid, centroid);
+        meshArea += area;
+
+        clusters[c].centroid = (area > 0.0f)? Vector3Scale(centroid, 1.0f/area) : centroid;
+        clusters[c].normal = Vector3Normalize(normal);
+    }
+
+    if (meshArea > 0.0f) meshCentroid = Vector3Scale(meshCentroid, 1.0f/meshArea);
+
+    for (int c = 0; c < clusterCount; c++) clusters[c].sortKey = Vector3DotProduct(Vector3Subtract(clusters[c].centroid, meshCentroid), clusters[c].normal);
+
+    qsort(clusters, clusterCount, sizeof(MeshCluster), CompareMeshClusters);
+
+    // Write clusters triangles in sorted order
+    unsigned int *sorted = (unsigned int *)RL_MALLOC(indexCount*sizeof(unsigned int));
+    int offset = 0;
+
+    for (int c = 0; c < clusterCount; c++)
+    {
+        memcpy(&sorted[offset], &indices[clusters[c].start*3], clusters[c].count*3*sizeof(unsigned int));
+        offset += clusters[c].count*3;
+    }
+
+    memcpy(indices, sorted, indexCount*sizeof(unsigned int));
+
+    RL_FREE(sorted);
+    RL_FREE(clusters);
+}
+
+// Compare mesh clusters sort key (descending), used by qsort()
+static int CompareMeshClusters(const void *a, const void *b)
+{
+    float keyA = ((const MeshCluster *)a)->sortKey;
+    float keyB = ((const MeshCluster *)b)->sortKey;
+
+    return (keyA < keyB) - (keyA > keyB);
+}
+
+// Get ray entry distance into mesh BVH node bounds (slab test)
+// NOTE: Origin and inverse direction are four floats arrays, last component is ignored
+static bool GetRayCollisionMeshBVHNode(const MeshBVHNode *node, const float *origin, const float *invDirection, float maxDistance, float *distance)
+{
+    float tNear = 0.0f;
+    float tFar = 0.0f;
+
+#if defined(RAYMATH_SSE_ENABLED)
+    // NOTE: Fourth lane loads node start/count integer, its result is discarded
+    __m128 rayOrigin = _mm_loadu_ps(origin);
+    __m128 rayInvDirection = _mm_loadu_ps(invDirection);
+    __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&node->min.x), rayOrigin), rayInvDirection);
+    __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(&node->max.x), rayOrigin), rayInvDirection);
+    __m128 tMin = _mm_min_ps(t1, t2);
+    __m128 tMax = _mm_max_ps(t1, t2);
+
+    __m128 nearValue = _mm_max_ss(tMin, _mm_shuffle_ps(tMin, tMin, _MM_SHUFFLE(1, 1, 1, 1)));
+    nearValue = _mm_max_ss(nearValue, _mm_shuffle_ps(tMin, tMin, _MM_SHUFFLE(2, 2, 2, 2)));
+    __m128 farValue = _mm_min_ss(tMax, _mm_shuffle_ps(tMax, tMax, _MM_SHUFFLE(1, 1, 1, 1)));
+    farValue = _mm_min_ss(farValue, _mm_shuffle_ps(tMax, tMax, _MM_SHUFFLE(2, 2, 2, 2)));
+
+    tNear = _mm_cvtss_f32(nearValue);
+    tFar = _mm_cvtss_f32(farValue);
+#else
+    const float *nodeMin = &node->min.x;
+    const float *nodeMax = &node->max.x;
+
+    tNear = -FLT_MAX;
+    tFar = FLT_MAX;
+
+    for (int i = 0; i < 3; i++)
+    {
+        float t1 = (nodeMin[i] - origin[i])*invDirection[i];
+        float t2 = (nodeMax[i] - origin[i])*invDirection[i];
+
+        tNear = fmaxf(tNear, fminf(t1, t2));
+        tFar = fminf(tFar, fmaxf(t1, t2));
+    }
+#endif
+
+    if (tNear < 0.0f) tNear = 0.0f;     // Ray origin inside bounds
+    *distance = tNear;
+
+    return ((tFar >= tNear) && (tNear < maxDistance));
+}
+
+// Get mesh BVH node bounds with transform applied
+// NOTE: Transformed box encloses the transformed node box (it is axis aligned in world space)
+static rl_BoundingBox GetMeshBVHNodeBounds(const MeshBVHNode *node, rl_Matrix transform)
+{
+    rl_Vector3 center = Vector3Transform(Vector3Scale(Vector3Add(node->min, node->max), 0.5f), transform);
+    rl_Vector3 extent = Vector3Scale(Vector3Subtract(node->max, node->min), 0.5f);
+    rl_Vector3 worldExtent = { 0 };
+
+    worldExtent.x = fabsf(transform.m0)*extent.x + fabsf(transform.m4)*extent.y + fabsf(transform.m8)*extent.z;
+    worldExtent.y = fabsf(transform.m1)*extent.x + fabsf(transform.m5)*extent.y + fabsf(transform.m9)*extent.z;
+    worldExtent.z = fabsf(transform.m2)*extent.x + fabsf(transform.m6)*extent.y + fabsf(transform.m10)*extent.z;
+
+    rl_BoundingBox box = { 0 };
+    box.min = Vector3Subtract(center, worldExtent);
+    box.max = Vector3Add(center, worldExtent);
+
+    return box;
+}
+
+// Check collision between mesh and sphere (center not NULL) or box
+// NOTE: Bounds are the box to test or the sphere bounds, triangles are tested in world space
+static bool CheckCollisionMeshVolume(rl_Mesh mesh, rl_Matrix transform, rl_BoundingBox bounds, const rl_Vector3 *center, float radius)
+{
+    bool collision = false;
+
+    if (mesh.vertices == NULL) return collision;
+
+    const rl_MeshBVH *bvh = mesh.bvh;
+    int stack[MESH_BVH_MAX_DEPTH*2] = { 0 };
+    int stackSize = 0;
+
+    // Without BVH, all mesh triangles are tested
+    int start = 0;
+    int count = (bvh != NULL)? 0 : mesh.triangleCount;
+
+    if (bvh != NULL) stack[stackSize++] = 0;
+
+    do
+    {
+        for (int i = start; (i < (start + count)) && !collision; i++)
+        {
+            rl_Vector3 a = { 0 };
+            rl_Vector3 b = { 0 };
+            rl_Vector3 c = { 0 };
+            GetMeshTriangle(mesh, (bvh != NULL)? bvh->triangles[i] : i, &a, &b, &c);
+
+            a = Vector3Transform(a, transform);
+            b = Vector3Transform(b, transform);
+            c = Vector3Transform(c, transform);
+
+            if (center != NULL) collision = CheckCollisionTriangleSphere(a, b, c, *center, radius);
+            else collision = CheckCollisionTriangleBox(a, b, c, bounds);
+        }
+
+        count = 0;
+
+        // Find next leaf node overlapping bounds
+        while (!collision && (stackSize > 0) && (count == 0))
+        {
+            const MeshBVHNode *node = &bvh->nodes[stack[--stackSize]];
+
+            if (!rl_CheckCollisionBoxes(GetMeshBVHNodeBounds(node, transform), bounds)) continue;
+
+            if (node->count > 0)
+            {
+                start = node->start;
+                count = node->count;
+            }
+            else
+            {
+                stack[stackSize++] = node->start + 1;
+                stack[stackSize++] = node->start;
+            }
+        }
+
+    } while (!collision && (count > 0));
+
+    return collision;
+}
+
+// Check collision between triangle and sphere
+// NOTE: Based on closest point on triangle from Real-Time Collision Detection (Christer Ericson)
+static bool CheckCollisionTriangleSphere(rl_Vector3 a, rl_Vector3 b, rl_Vector3 c, rl_Vector3 center, float radius)
+{
+    rl_Vector3 ab = Vector3Subtract(b, a);
+    rl_Vector3 ac = Vector3Subtract(c, a);
+    rl_Vector3 ap = Vector3Subtract(center, a);
+    rl_Vector3 closest = { 0 };
+
+    float d1 = Vector3DotProduct(ab, ap);
+    float d2 = Vector3DotProduct(ac, ap);
+
+    rl_Vector3 bp = Vector3Subtract(center, b);
+    float d3 = Vector3DotProduct(ab, bp);
+    float d4 = Vector3DotProduct(ac, bp);
+
+    rl_Vector3 cp = Vector3Subtract(center, c);
+    float d5 = Vector3DotProduct(ab, cp);
+    float d6 = Vector3DotProduct(ac, cp);
+
+    float va = d3*d6 - d5*d4;
+    float vb = d5*d2 - d1*d6;
+    float vc = d1*d4 - d3*d2;
+
+    if ((d1 <= 0.0f) && (d2 <= 0.0f)) closest = a;                                  // Vertex region A
+    else if ((d3 >= 0.0f) && (d4 <= d3)) closest = b;                               // Vertex region B
+    else if ((d6 >= 0.0f) && (d5 <= d6)) closest = c;                               // Vertex region C
+    else if ((vc <= 0.0f) && (d1 >= 0.0f) && (d3 <= 0.0f)) closest = Vector3Add(a, Vector3Scale(ab, d1/(d1 - d3)));    // Edge region AB
+    else if ((vb <= 0.0f) && (d2 >= 0.0f) && (d6 <= 0.0f)) closest = Vector3Add(a, Vector3Scale(ac, d2/(d2 - d6)));    // Edge region AC
+    else if ((va <= 0.0f) && ((d4 - d3) >= 0.0f) && ((d5 - d6) >= 0.0f))            // Edge region BC
+    {
+        closest = Vector3Add(b, Vector3Scale(Vector3Subtract(c, b), (d4 - d3)/((d4 - d3) + (d5 - d6))));
+    }
+    else                                                                            // Face region
+    {
+        float denom = 1.0f/(va + vb + vc);
+        closest = Vector3Add(a, Vector3Add(Vector3Scale(ab, vb*denom), Vector3Scale(ac, vc*denom)));
+    }
+
+    return (Vector3DistanceSqr(closest, center) <= radius*radius);
+}
+
+// Check collision between triangle and box
+// NOTE: Separating axis test from Fast 3D Triangle-Box Overlap Testing (Tomas Akenine-Moller),
+// axis tested are box faces normals, triangle normal and the nine edges cross products
+static bool CheckCollisionTriangleBox(rl_Vector3 a, rl_Vector3 b, rl_Vector3 c, rl_BoundingBox box)
+{
+    rl_Vector3 center = Vector3Scale(Vector3Add(box.min, box.max), 0.5f);
+    rl_Vector3 extent = Vector3Scale(Vector3Subtract(box.max, box.min), 0.5f);
+
+    // Triangle vertices relative to box center
+    rl_Vector3 v0 = Vector3Subtract(a, center);
+    rl_Vector3 v1 = Vector3Subtract(b, center);
+    rl_Vector3 v2 = Vector3Subtract(c, center);
+
+    // Box faces normals, equivalent to triangle bounds against box
+    if ((fminf(v0.x, fminf(v1.x, v2.x)) > extent.x) || (fmaxf(v0.x, fmaxf(v1.x, v2.x)) < -extent.x)) return false;
+    if ((fminf(v0.y, fminf(v1.y, v2.y)) > extent.y) || (fmaxf(v0.y, fmaxf(v1.y, v2.y)) < -extent.y)) return false;
+    if ((fminf(v0.z, fminf(v1.z, v2.z)) > extent.z) || (fmaxf(v0.z, fmaxf(v1.z, v2.z)) < -extent.z)) return false;
+
+    rl_Vector3 edges[3] = { Vector3Subtract(v1, v0), Vector3Subtract(v2, v1), Vector3Subtract(v0, v2) };
+
+    // Triangle normal
+    rl_Vector3 normal = Vector3CrossProduct(edges[0], edges[1]);
+    float radius = extent.x*fabsf(normal.x) + extent.y*fabsf(normal.y) + extent.z*fabsf(normal.z);
+    if (fabsf(Vector3DotProduct(normal, v0)) > radius) return false;
+
+    // Box axis and triangle edges cross products
+    rl_Vector3 boxAxis[3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+
+    for (int i = 0; i < 3; i++)
+    {
+        for (int j = 0; j < 3; j++)
+        {
+            rl_Vector3 axis = Vector3CrossProduct(boxAxis[i], edges[j]);
+            float p0 = Vector3DotProduct(v0, axis);
+            float p1 = Vector3DotProduct(v1, axis);
+            float p2 = Vector3DotProduct(v2, axis);
+            radius = extent.x*fabsf(axis.x) + extent.y*fabsf(axis.y) + extent.z*fabsf(axis.z);
+
+            if ((fminf(p0, fminf(p1, p2)) > radius) || (fmaxf(p0, fmaxf(p1, p2)) < -radius)) return false;
+        }
+    }
+
+    return true;
+}
+
+// Get ray in mesh space, direction is not normalized
+// NOTE: Hit distances along mesh space ray match the distances along world space ray
+static rl_Ray GetMeshSpaceRay(rl_Ray ray, rl_Matrix invTransform)
+{
+    rl_Ray result = { 0 };
+
+    result.position = Vector3Transform(ray.position, invTransform);
+    result.direction.x = invTransform.m0*ray.direction.x + invTransform.m4*ray.direction.y + invTransform.m8*ray.direction.z;
+    result.direction.y = invTransform.m1*ray.direction.x + invTransform.m5*ray.direction.y + invTransform.m9*ray.direction.z;
+    result.direction.z = invTransform.m2*ray.direction.x + invTransform.m6*ray.direction.y + invTransform.m10*ray.direction.z;
+
+    return result;
+}
+
+// Get collision info for mesh triangle hit
+// NOTE: Hit point and normal computed in world space, same as brute force testing
+static rl_RayCollision GetRayCollisionMeshTriangle(rl_Ray ray, rl_Mesh mesh, rl_Matrix transform, int triangle, float distance)
+{
+    rl_RayCollision collision = { 0 };
+    rl_Vector3 a = { 0 };
+    rl_Vector3 b = { 0 };
+    rl_Vector3 c = { 0 };
+    GetMeshTriangle(mesh, triangle, &a, &b, &c);
+
+    a = Vector3Transform(a, transform);
+    b = Vector3Transform(b, transform);
+    c = Vector3Transform(c, transform);
+
+    collision.hit = true;
+    collision.distance = distance;
+    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, distance));
+    collision.normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(b, a), Vector3Subtract(c, a)));
+
+    return collision;
+}
+
+// Get collision info from ray-box slabs distances
+// NOTE: Ray direction is expected reversed if ray position is inside box
+static rl_RayCollision GetRayCollisionBoxResult(rl_Ray ray, rl_BoundingBox box, float tNear, float tFar, bool insideBox)
+{
+    rl_RayCollision collision = { 0 };
+
+    collision.hit = !((tFar < 0) || (tNear > tFar));
+    collision.distance = tNear;
+    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+
+    // Get box center point
+    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
+    // Get vector center point->hit point
+    collision.normal = Vector3Subtract(collision.point, collision.normal);
+    // Scale vector to unit cube
+    // NOTE: We use an additional .01 to fix numerical errors
+    collision.normal = Vector3Scale(collision.normal, 2.01f);
+    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
+    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
+    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
+    collision.normal.x = (float)((int)collision.normal.x);
+    collision.normal.y = (float)((int)collision.normal.y);
+    collision.normal.z = (float)((int)collision.normal.z);
+
+    collision.normal = Vector3Normalize(collision.normal);
+
+    if (insideBox)
+    {
+        // Fix result
+        collision.distance *= -1.0f;
+        collision.normal = Vector3Negate(collision.normal);
+    }
+
+    return collision;
+}
+
+// Process ray batch, splitting it across worker threads
+static void ProcessRayBatch(const RayBatchJob *job)
+{
+    WorkerJob workerJob = { 0 };
+    workerJob.process = ProcessRayBatchRange;
+    workerJob.data = job;
+    workerJob.count = job->count;
+    workerJob.chunkSize = RAY_BATCH_CHUNK_SIZE;
+
+    RunWorkerJob(&workerJob);
+}
+
+// Run job, splitting its range in chunks processed by job system worker threads
+// NOTE: Caller thread processes chunks too, function returns once the full range is processed
+static void RunWorkerJob(const WorkerJob *job)
+{
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+    rl_ParallelFor(ProcessWorkerJobRange, (void *)job, job->count, job->chunkSize);
+#else
+    job->process(job->data, 0, job->count);
+#endif
+}
+
+// Process ray batch range on current thread
+static void ProcessRayBatchRange(const void *data, int start, int end)
+{
+    const RayBatchJob *job = (const RayBatchJob *)data;
+    int i = start;
+
+#if defined(RAYMATH_SSE_ENABLED)
+    // Packets of 4 rays, mesh packets traversal requires mesh BVH
+    bool packets = !job->mesh || ((job->target.vertices != NULL) && (job->target.bvh != NULL));
+
+    if (packets)
+    {
+        for (; (i + 4) <= end; i += 4)
+        {
+            if (job->mesh) GetRayCollisionMeshPacket(&job->rays[i], job->target, job->transform, &job->collisions[i]);
+            else GetRayCollisionBoxPacket(&job->rays[i], job->box, &job->collisions[i]);
+        }
+    }
+#endif
+
+    for (; i < end; i++)
+    {
+        if (job->mesh) job->collisions[i] = rl_GetRayCollisionMesh(job->rays[i], job->target, job->transform);
+        else job->collisions[i] = rl_GetRayCollisionBox(job->rays[i], job->box);
+    }
+}
+
+#if defined(RAYMATH_SSE_ENABLED)
+// Get collision info between 4 rays and box
+// NOTE: Slabs are tested for the 4 rays at once, results match rl_GetRayCollisionBox()
+static void GetRayCollisionBoxPacket(const rl_Ray *rays, rl_BoundingBox box, rl_RayCollision *collisions)
+{
+    rl_Ray packet[4] = { 0 };
+    bool insideBox[4] = { 0 };
+    float position[3][4] = { 0 };
+    float direction[3][4] = { 0 };
+
+    for (int i = 0; i < 4; i++)
+    {
+        packet[i] = rays[i];
+
+        // Ray position inside the box is tested with reversed direction, see rl_GetRayCollisionBox()
+        insideBox[i] = (packet[i].position.x > box.min.x) && (packet[i].position.x < box.max.x) &&
+                       (packet[i].position.y > box.min.y) && (packet[i].position.y < box.max.y) &&
+                       (packet[i].position.z > box.min.z) && (packet[i].position.z < box.max.z);
+
+        if (insideBox[i]) packet[i].direction = Vector3Negate(packet[i].direction);
+
+        position[0][i] = packet[i].position.x;
+        position[1][i] = packet[i].position.y;
+        position[2][i] = packet[i].position.z;
+        direction[0][i] = packet[i].direction.x;
+        direction[1][i] = packet[i].direction.y;
+        direction[2][i] = packet[i].direction.z;
+    }
+
+    const float *boxMin = &box.min.x;
+    const float *boxMax = &box.max.x;
+    __m128 tNear = _mm_set1_ps(-FLT_MAX);
+    __m128 tFar = _mm_set1_ps(FLT_MAX);
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        __m128 invDirection = _mm_div_ps(_mm_set1_ps(1.0f), _mm_loadu_ps(direction[axis]));
+        __m128 origin = _mm_loadu_ps(position[axis]);
+        __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(boxMin[axis]), origin), invDirection);
+        __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(boxMax[axis]), origin), invDirection);
+
+        tNear = _mm_max_ps(tNear, _mm_min_ps(t1, t2));
+        tFar = _mm_min_ps(tFar, _mm_max_ps(t1, t2));
+    }
+
+    float nearDistances[4] = { 0 };
+    float farDistances[4] = { 0 };
+    _mm_storeu_ps(nearDistances, tNear);
+    _mm_storeu_ps(farDistances, tFar);
+
+    for (int i = 0; i < 4; i++) collisions[i] = GetRayCollisionBoxResult(packet[i], box, nearDistances[i], farDistances[i], insideBox[i]);
+}
+
+// Get collision info between 4 rays and mesh BVH
+// NOTE: Packet traverses nodes hit by any of the rays, triangles are only tested for rays hitting the leaf
+static void GetRayCollisionMeshPacket(const rl_Ray *rays, rl_Mesh mesh, rl_Matrix transform, rl_RayCollision *collisions)
+{
+    const rl_MeshBVH *bvh = mesh.bvh;
+    rl_Matrix invTransform = MatrixInvert(transform);
+
+    rl_Ray localRays[4] = { 0 };
+    float position[3][4] = { 0 };
+    float invDirection[3][4] = { 0 };
+    float closestDistances[4] = { FLT_MAX, FLT_MAX, FLT_MAX, FLT_MAX };
+    int closestTriangles[4] = { -1, -1, -1, -1 };
+
+    for (int i = 0; i < 4; i++)
+    {
+        localRays[i] = GetMeshSpaceRay(rays[i], invTransform);
+
+        position[0][i] = localRays[i].position.x;
+        position[1][i] = localRays[i].position.y;
+        position[2][i] = localRays[i].position.z;
+        invDirection[0][i] = 1.0f/localRays[i].direction.x;
+        invDirection[1][i] = 1.0f/localRays[i].direction.y;
+        invDirection[2][i] = 1.0f/localRays[i].direction.z;
+    }
+
+    __m128 origins[3] = { _mm_loadu_ps(position[0]), _mm_loadu_ps(position[1]), _mm_loadu_ps(position[2]) };
+    __m128 invDirections[3] = { _mm_loadu_ps(invDirection[0]), _mm_loadu_ps(invDirection[1]), _mm_loadu_ps(invDirection[2]) };
+    __m128 maxDistances = _mm_loadu_ps(closestDistances);
+    __m128 distances = _mm_setzero_ps();
+
+    // Traversal stack keeps the rays mask and entry distances at push time
+    int stack[MESH_BVH_MAX_DEPTH*2] = { 0 };
+    int stackMasks[MESH_BVH_MAX_DEPTH*2] = { 0 };
+    float stackDistances[MESH_BVH_MAX_DEPTH*2][4] = { 0 };
+    int stackSize = 0;
+
+    int mask = GetRayPacketCollisionMeshBVHNode(&bvh->nodes[0], origins, invDirections, &maxDistances, &distances);
+
+    if (mask != 0)
+    {
+        stack[0] = 0;
+        stackMasks[0] = mask;
+        _mm_storeu_ps(stackDistances[0], distances);
+        stackSize = 1;
+    }
+
+    while (stackSize > 0)
+    {
+        stackSize--;
+
+        // Discard rays with a closer hit found since node was pushed
+        mask = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            if ((stackMasks[stackSize] & (1 << i)) && (stackDistances[stackSize][i] < closestDistances[i])) mask |= (1 << i);
+        }
+        if (mask == 0) continue;
+
+        const MeshBVHNode *node = &bvh->nodes[stack[stackSize]];
+
+        if (node->count > 0)
+        {
+            for (int i = node->start; i < (node->start + node->count); i++)
+            {
+                rl_Vector3 a = { 0 };
+                rl_Vector3 b = { 0 };
+                rl_Vector3 c = { 0 };
+                GetMeshTriangle(mesh, bvh->triangles[i], &a, &b, &c);
+
+                for (int r = 0; r < 4; r++)
+                {
+                    if (!(mask & (1 << r))) continue;
+
+                    rl_RayCollision triHitInfo = rl_GetRayCollisionTriangle(localRays[r], a, b, c);
+
+                    if (triHitInfo.hit && (triHitInfo.distance < closestDistances[r]))
+                    {
+                        closestDistances[r] = triHitInfo.distance;
+                        closestTriangles[r] = bvh->triangles[i];
+                    }
+                }
+            }
+
+            maxDistances = _mm_loadu_ps(closestDistances);
+        }
+        else
+        {
+            __m128 leftDistances = _mm_setzero_ps();
+            __m128 rightDistances = _mm_setzero_ps();
+            int leftMask = GetRayPacketCollisionMeshBVHNode(&bvh->nodes[node->start], origins, invDirections, &maxDistances, &leftDistances) & mask;
+            int rightMask = GetRayPacketCollisionMeshBVHNode(&bvh->nodes[node->start + 1], origins, invDirections, &maxDistances, &rightDistances) & mask;
+
+            // Push farthest child first (for the first ray hitting both), so nearest child is visited first
+            bool leftFirst = true;
+            if ((leftMask & rightMask) != 0)
+            {
+                float left[4] = { 0 };
+                float right[4] = { 0 };
+                _mm_storeu_ps(left, leftDistances);
+                _mm_storeu_ps(right, rightDistances);
+
+                for (int i = 0; i < 4; i++)
+                {
+                    if ((leftMask & rightMask) & (1 << i)) { leftFirst = (left[i] <= right[i]); break; }
+                }
+            }
+
+            for (int k = 0; k < 2; k++)
+            {
+                bool pushLeft = (k == 0)? !leftFirst : leftFirst;
+                int childMask = pushLeft? leftMask : rightMask;
+                if (childMask == 0) continue;
+
+                stack[stackSize] = pushLeft? node->start : node->start + 1;
+                stackMasks[stackSize] = childMask;
+                _mm_storeu_ps(stackDistances[stackSize], pushLeft? leftDistances : rightDistances);
+                stackSize++;
+            }
+        }
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        if (closestTriangles[i] >= 0) collisions[i] = GetRayCollisionMeshTriangle(rays[i], mesh, transform, closestTriangles[i], closestDistances[i]);
+        else
+        {
+            rl_RayCollision collision = { 0 };
+            collisions[i] = collision;
+        }
+    }
+}
+
+// Get 4 rays entry distances into mesh BVH node bounds (slab test)
+// NOTE: Returns the mask of rays hitting the node before their max distance
+static int GetRayPacketCollisionMeshBVHNode(const MeshBVHNode *node, const __m128 *origin, const __m128 *invDirection, const __m128 *maxDistance, __m128 *distance)
+{
+    __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node->min.x), origin[0]), invDirection[0]);
+    __m128 t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node->max.x), origin[0]), invDirection[0]);
+    __m128 tNear = _mm_min_ps(t1, t2);
+    __m128 tFar = _mm_max_ps(t1, t2);
+
+    t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node->min.y), origin[1]), invDirection[1]);
+    t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node->max.y), origin[1]), invDirection[1]);
+    tNear = _mm_max_ps(tNear, _mm_min_ps(t1, t2));
+    tFar = _mm_min_ps(tFar, _mm_max_ps(t1, t2));
+
+    t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node->min.z), origin[2]), invDirection[2]);
+    t2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node->max.z), origin[2]), invDirection[2]);
+    tNear = _mm_max_ps(tNear, _mm_min_ps(t1, t2));
+    tFar = _mm_min_ps(tFar, _mm_max_ps(t1, t2));
+
+    tNear = _mm_max_ps(tNear, _mm_setzero_ps());     // Rays origin inside bounds
+    *distance = tNear;
 
-    if (dmin <= (radius*radius)) collision = true;
+    return _mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(tFar, tNear), _mm_cmplt_ps(tNear, *maxDistance)));
+}
+#endif
 
-    return collision;
+#if defined(SUPPORT_MODELS_WORKER_THREADS)
+// Process worker job range, called by job system threads
+static void ProcessWorkerJobRange(void *userData, int start, int end)
+{
+    const WorkerJob *job = (const WorkerJob *)userData;
+    job->process(job->data, start, end);
 }
+#endif
 
-// Get collision info between ray and sphere
-rl_RayCollision rl_GetRayCollisionSphere(rl_Ray ray, rl_Vector3 center, float radius)
+// Process mesh skinning vertex range on current thread
+// NOTE: The 4 bones matrices of every vertex are blended by weight before transforming it,
+// equivalent to blending the transformed vertices, changed vertices range is tracked per chunk
+// With SUPPORT_MESH_DUAL_QUATERNION_SKINNING, bones dual quaternions are blended instead
+static void ProcessSkinningRange(const void *data, int start, int end)
 {
-    rl_RayCollision collision = { 0 };
+    const SkinningJob *job = (const SkinningJob *)data;
+    const rl_Mesh *mesh = &job->mesh;
+    bool normals = job->normals;
+    int first = end;
+    int last = start - 1;
 
-    rl_Vector3 raySpherePos = Vector3Subtract(center, ray.position);
-    float vector = Vector3DotProduct(raySpherePos, ray.direction);
-    float distance = Vector3Length(raySpherePos);
-    float d = radius*radius - (distance*distance - vector*vector);
+    for (int v = start; v < end; v++)
+    {
+        const float *weights = &mesh->boneWeights[v*4];
+        const unsigned char *ids = &mesh->boneIds[v*4];
+        const float *vertex = &mesh->vertices[v*3];
+        float position[4] = { 0 };
+        float normal[4] = { 0 };
+
+#if defined(SUPPORT_MESH_DUAL_QUATERNION_SKINNING)
+        // Dual quaternions blended by weight, rotations flipped to the first bone hemisphere (shortest path)
+        float blend[8] = { 0 };
+        const float *pivot = NULL;
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;  // Early stop when no transformation will be applied
 
-    collision.hit = d >= 0.0f;
+            const float *dualQuat = &job->dualQuats[ids[j]*8];
+            float weight = weights[j];
 
-    // Check if ray origin is inside the sphere to calculate the correct collision point
-    if (distance < radius)
-    {
-        collision.distance = vector + sqrtf(d);
+            if (pivot == NULL) pivot = dualQuat;
+            else if ((dualQuat[0]*pivot[0] + dualQuat[1]*pivot[1] + dualQuat[2]*pivot[2] + dualQuat[3]*pivot[3]) < 0.0f) weight = -weight;
 
-        // Calculate collision point
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+            for (int k = 0; k < 8; k++) blend[k] += dualQuat[k]*weight;
+        }
 
-        // Calculate collision normal (pointing outwards)
-        collision.normal = Vector3Negate(Vector3Normalize(Vector3Subtract(collision.point, center)));
-    }
-    else
-    {
-        collision.distance = vector - sqrtf(d);
+        float length = sqrtf(blend[0]*blend[0] + blend[1]*blend[1] + blend[2]*blend[2] + blend[3]*blend[3]);
 
-        // Calculate collision point
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+        if (length > 0.0f)
+        {
+            float ilength = 1.0f/length;
+            rl_Vector3 axis = { blend[0]*ilength, blend[1]*ilength, blend[2]*ilength };
+            float w = blend[3]*ilength;
+            rl_Vector3 dual = { blend[4]*ilength, blend[5]*ilength, blend[6]*ilength };
+            float dualW = blend[7]*ilength;
+
+            // Position rotated, v + 2*cross(q.xyz, cross(q.xyz, v) + q.w*v), and translated, 2*dual*conjugate(real)
+            rl_Vector3 point = { vertex[0], vertex[1], vertex[2] };
+            rl_Vector3 t = Vector3Add(Vector3CrossProduct(axis, point), Vector3Scale(point, w));
+            rl_Vector3 translation = Vector3Add(Vector3Subtract(Vector3Scale(dual, w), Vector3Scale(axis, dualW)), Vector3CrossProduct(axis, dual));
+            point = Vector3Add(Vector3Add(point, Vector3Scale(Vector3CrossProduct(axis, t), 2.0f)), Vector3Scale(translation, 2.0f));
+            position[0] = point.x;
+            position[1] = point.y;
+            position[2] = point.z;
+
+            if (normals)
+            {
+                const float *baseNormal = &mesh->normals[v*3];
+                rl_Vector3 n = { baseNormal[0], baseNormal[1], baseNormal[2] };
+                t = Vector3Add(Vector3CrossProduct(axis, n), Vector3Scale(n, w));
+                n = Vector3Add(n, Vector3Scale(Vector3CrossProduct(axis, t), 2.0f));
+                normal[0] = n.x;
+                normal[1] = n.y;
+                normal[2] = n.z;
+            }
+        }
+#elif defined(RAYMATH_SSE_ENABLED)
+        // NOTE: Matrix rows are contiguous (m0, m4, m8, m12), only the first three rows are required
+        __m128 row0 = _mm_setzero_ps();
+        __m128 row1 = _mm_setzero_ps();
+        __m128 row2 = _mm_setzero_ps();
+        __m128 normalRow0 = _mm_setzero_ps();
+        __m128 normalRow1 = _mm_setzero_ps();
+        __m128 normalRow2 = _mm_setzero_ps();
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;  // Early stop when no transformation will be applied
 
-        // Calculate collision normal (pointing inwards)
-        collision.normal = Vector3Normalize(Vector3Subtract(collision.point, center));
-    }
+            __m128 weight = _mm_set1_ps(weights[j]);
+            const rl_Matrix *bone = &mesh->boneMatrices[ids[j]];
 
-    return collision;
-}
+            row0 = _mm_add_ps(row0, _mm_mul_ps(_mm_loadu_ps(&bone->m0), weight));
+            row1 = _mm_add_ps(row1, _mm_mul_ps(_mm_loadu_ps(&bone->m1), weight));
+            row2 = _mm_add_ps(row2, _mm_mul_ps(_mm_loadu_ps(&bone->m2), weight));
 
-// Get collision info between ray and box
-rl_RayCollision rl_GetRayCollisionBox(rl_Ray ray, rl_BoundingBox box)
-{
-    rl_RayCollision collision = { 0 };
+            if (normals)
+            {
+                const rl_Matrix3x4 *normalMatrix = &job->normalMatrices[ids[j]];
 
-    // Note: If ray.position is inside the box, the distance is negative (as if the ray was reversed)
-    // Reversing ray.direction will give use the correct result
-    bool insideBox = (ray.position.x > box.min.x) && (ray.position.x < box.max.x) &&
-                     (ray.position.y > box.min.y) && (ray.position.y < box.max.y) &&
-                     (ray.position.z > box.min.z) && (ray.position.z < box.max.z);
+                normalRow0 = _mm_add_ps(normalRow0, _mm_mul_ps(_mm_loadu_ps(&normalMatrix->m0), weight));
+                normalRow1 = _mm_add_ps(normalRow1, _mm_mul_ps(_mm_loadu_ps(&normalMatrix->m1), weight));
+                normalRow2 = _mm_add_ps(normalRow2, _mm_mul_ps(_mm_loadu_ps(&normalMatrix->m2), weight));
+            }
+        }
 
-    if (insideBox) ray.direction = Vector3Negate(ray.direction);
+        // Rows dot products, transposed to sum the products of every row at once
+        __m128 point = _mm_set_ps(1.0f, vertex[2], vertex[1], vertex[0]);
+        __m128 x = _mm_mul_ps(row0, point);
+        __m128 y = _mm_mul_ps(row1, point);
+        __m128 z = _mm_mul_ps(row2, point);
+        __m128 w = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+        _mm_storeu_ps(position, _mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, w)));
 
-    float t[11] = { 0 };
+        if (normals)
+        {
+            const float *baseNormal = &mesh->normals[v*3];
+            __m128 direction = _mm_set_ps(0.0f, baseNormal[2], baseNormal[1], baseNormal[0]);
+            x = _mm_mul_ps(normalRow0, direction);
+            y = _mm_mul_ps(normalRow1, direction);
+            z = _mm_mul_ps(normalRow2, direction);
+            w = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+            _mm_storeu_ps(normal, _mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, w)));
+        }
+#else
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;  // Early stop when no transformation will be applied
 
-    t[8] = 1.0f/ray.direction.x;
-    t[9] = 1.0f/ray.direction.y;
-    t[10] = 1.0f/ray.direction.z;
+            rl_Vector3 animVertex = Vector3Transform(CLITERAL(rl_Vector3){ vertex[0], vertex[1], vertex[2] }, mesh->boneMatrices[ids[j]]);
+            position[0] += animVertex.x*weights[j];
+            position[1] += animVertex.y*weights[j];
+            position[2] += animVertex.z*weights[j];
 
-    t[0] = (box.min.x - ray.position.x)*t[8];
-    t[1] = (box.max.x - ray.position.x)*t[8];
-    t[2] = (box.min.y - ray.position.y)*t[9];
-    t[3] = (box.max.y - ray.position.y)*t[9];
-    t[4] = (box.min.z - ray.position.z)*t[10];
-    t[5] = (box.max.z - ray.position.z)*t[10];
-    t[6] = (float)fmax(fmax(fmin(t[0], t[1]), fmin(t[2], t[3])), fmin(t[4], t[5]));
-    t[7] = (float)fmin(fmin(fmax(t[0], t[1]), fmax(t[2], t[3])), fmax(t[4], t[5]));
+            if (normals)
+            {
+                const float *baseNormal = &mesh->normals[v*3];
+                rl_Vector3 animNormal = Vector3TransformMatrix3x4(CLITERAL(rl_Vector3){ baseNormal[0], baseNormal[1], baseNormal[2] }, job->normalMatrices[ids[j]]);
+                normal[0] += animNormal.x*weights[j];
+                normal[1] += animNormal.y*weights[j];
+                normal[2] += animNormal.z*weights[j];
+            }
+        }
+#endif
 
-    collision.hit = !((t[7] < 0) || (t[6] > t[7]));
-    collision.distance = t[6];
-    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, collision.distance));
+        float *animVertex = &mesh->animVertices[v*3];
+        float *animNormal = normals? &mesh->animNormals[v*3] : NULL;
+        bool changed = (animVertex[0] != position[0]) || (animVertex[1] != position[1]) || (animVertex[2] != position[2]);
+        if (normals) changed = changed || (animNormal[0] != normal[0]) || (animNormal[1] != normal[1]) || (animNormal[2] != normal[2]);
 
-    // Get box center point
-    collision.normal = Vector3Lerp(box.min, box.max, 0.5f);
-    // Get vector center point->hit point
-    collision.normal = Vector3Subtract(collision.point, collision.normal);
-    // Scale vector to unit cube
-    // NOTE: We use an additional .01 to fix numerical errors
-    collision.normal = Vector3Scale(collision.normal, 2.01f);
-    collision.normal = Vector3Divide(collision.normal, Vector3Subtract(box.max, box.min));
-    // The relevant elements of the vector are now slightly larger than 1.0f (or smaller than -1.0f)
-    // and the others are somewhere between -1.0 and 1.0 casting to int is exactly our wanted normal!
-    collision.normal.x = (float)((int)collision.normal.x);
-    collision.normal.y = (float)((int)collision.normal.y);
-    collision.normal.z = (float)((int)collision.normal.z);
+        if (changed)
+        {
+            animVertex[0] = position[0];
+            animVertex[1] = position[1];
+            animVertex[2] = position[2];
 
-    collision.normal = Vector3Normalize(collision.normal);
+            if (normals)
+            {
+                animNormal[0] = normal[0];
+                animNormal[1] = normal[1];
+                animNormal[2] = normal[2];
+            }
 
-    if (insideBox)
-    {
-        // Reset ray.direction
-        ray.direction = Vector3Negate(ray.direction);
-        // Fix result
-        collision.distance *= -1.0f;
-        collision.normal = Vector3Negate(collision.normal);
+            if (v < first) first = v;
+            last = v;
+        }
     }
 
-    return collision;
+    int chunk = start/SKINNING_CHUNK_SIZE;
+    job->changedStart[chunk] = first;
+    job->changedEnd[chunk] = last + 1;
 }
 
-// Get collision info between ray and mesh
-rl_RayCollision rl_GetRayCollisionMesh(rl_Ray ray, rl_Mesh mesh, rl_Matrix transform)
+// Process mesh tangents triangles range on current thread
+// NOTE: Triangle tangent is stored normalized, followed by texcoords orientation (1.0f or -1.0f),
+// degenerated texcoords triangles store a zero tangent and do not contribute to vertices tangents
+static void ProcessTangentsTriangleRange(const void *data, int start, int end)
 {
-    rl_RayCollision collision = { 0 };
+    const TangentsJob *job = (const TangentsJob *)data;
+    const rl_Mesh *mesh = job->mesh;
+    int t = start;
 
-    // Check if mesh vertex data on CPU for testing
-    if (mesh.vertices != NULL)
+#if defined(RAYMATH_SSE_ENABLED)
+    // Process 4 triangles at once, triangles data is gathered in lanes
+    for (; (t + 4) <= end; t += 4)
     {
-        int triangleCount = mesh.triangleCount;
+        float e1[3][4], e2[3][4], uv[4][4];
 
-        // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
+        for (int k = 0; k < 4; k++)
         {
-            rl_Vector3 a = { 0 };
-            rl_Vector3 b = { 0 };
-            rl_Vector3 c = { 0 };
-            rl_Vector3 *vertdata = (rl_Vector3 *)mesh.vertices;
+            int i0 = (mesh->indices != NULL)? mesh->indices[(t + k)*3] : (t + k)*3;
+            int i1 = (mesh->indices != NULL)? mesh->indices[(t + k)*3 + 1] : (t + k)*3 + 1;
+            int i2 = (mesh->indices != NULL)? mesh->indices[(t + k)*3 + 2] : (t + k)*3 + 2;
 
-            if (mesh.indices)
-            {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
-            }
-            else
+            for (int a = 0; a < 3; a++)
             {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
+                e1[a][k] = mesh->vertices[i1*3 + a] - mesh->vertices[i0*3 + a];
+                e2[a][k] = mesh->vertices[i2*3 + a] - mesh->vertices[i0*3 + a];
             }
 
-            a = Vector3Transform(a, transform);
-            b = Vector3Transform(b, transform);
-            c = Vector3Transform(c, transform);
-
-            rl_RayCollision triHitInfo = rl_GetRayCollisionTriangle(ray, a, b, c);
+            uv[0][k] = mesh->texcoords[i1*2] - mesh->texcoords[i0*2];
+            uv[1][k] = mesh->texcoords[i1*2 + 1] - mesh->texcoords[i0*2 + 1];
+            uv[2][k] = mesh->texcoords[i2*2] - mesh->texcoords[i0*2];
+            uv[3][k] = mesh->texcoords[i2*2 + 1] - mesh->texcoords[i0*2 + 1];
+        }
 
-            if (triHitInfo.hit)
-            {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
-            }
+        __m128 s1 = _mm_loadu_ps(uv[0]);
+        __m128 t1 = _mm_loadu_ps(uv[1]);
+        __m128 s2 = _mm_loadu_ps(uv[2]);
+        __m128 t2 = _mm_loadu_ps(uv[3]);
+
+        __m128 x = _mm_sub_ps(_mm_mul_ps(t2, _mm_loadu_ps(e1[0])), _mm_mul_ps(t1, _mm_loadu_ps(e2[0])));
+        __m128 y = _mm_sub_ps(_mm_mul_ps(t2, _mm_loadu_ps(e1[1])), _mm_mul_ps(t1, _mm_loadu_ps(e2[1])));
+        __m128 z = _mm_sub_ps(_mm_mul_ps(t2, _mm_loadu_ps(e1[2])), _mm_mul_ps(t1, _mm_loadu_ps(e2[2])));
+
+        // Signed texcoords area, orientation and degenerated triangles
+        __m128 area = _mm_sub_ps(_mm_mul_ps(s1, t2), _mm_mul_ps(s2, t1));
+        __m128 orientation = _mm_or_ps(_mm_and_ps(area, _mm_set1_ps(-0.0f)), _mm_set1_ps(1.0f));
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+        __m128 valid = _mm_and_ps(_mm_cmpgt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), area), _mm_set1_ps(MESH_TANGENTS_EPSILON)),
+            _mm_cmpgt_ps(length, _mm_set1_ps(MESH_TANGENTS_EPSILON)));
+        __m128 scale = _mm_and_ps(valid, _mm_div_ps(orientation, _mm_max_ps(length, _mm_set1_ps(MESH_TANGENTS_EPSILON))));
+
+        float result[4][4];
+        _mm_storeu_ps(result[0], _mm_mul_ps(x, scale));
+        _mm_storeu_ps(result[1], _mm_mul_ps(y, scale));
+        _mm_storeu_ps(result[2], _mm_mul_ps(z, scale));
+        _mm_storeu_ps(result[3], orientation);
+
+        for (int k = 0; k < 4; k++)
+        {
+            for (int a = 0; a < 4; a++) job->triangleTangents[(t + k)*4 + a] = result[a][k];
         }
     }
+#endif
 
-    return collision;
+    for (; t < end; t++)
+    {
+        int i0 = (mesh->indices != NULL)? mesh->indices[t*3] : t*3;
+        int i1 = (mesh->indices != NULL)? mesh->indices[t*3 + 1] : t*3 + 1;
+        int i2 = (mesh->indices != NULL)? mesh->indices[t*3 + 2] : t*3 + 2;
+
+        rl_Vector3 v0 = { mesh->vertices[i0*3], mesh->vertices[i0*3 + 1], mesh->vertices[i0*3 + 2] };
+        rl_Vector3 e1 = Vector3Subtract((rl_Vector3){ mesh->vertices[i1*3], mesh->vertices[i1*3 + 1], mesh->vertices[i1*3 + 2] }, v0);
+        rl_Vector3 e2 = Vector3Subtract((rl_Vector3){ mesh->vertices[i2*3], mesh->vertices[i2*3 + 1], mesh->vertices[i2*3 + 2] }, v0);
+
+        float s1 = mesh->texcoords[i1*2] - mesh->texcoords[i0*2];
+        float t1 = mesh->texcoords[i1*2 + 1] - mesh->texcoords[i0*2 + 1];
+        float s2 = mesh->texcoords[i2*2] - mesh->texcoords[i0*2];
+        float t2 = mesh->texcoords[i2*2 + 1] - mesh->texcoords[i0*2 + 1];
+
+        float area = s1*t2 - s2*t1;
+        float orientation = (area < 0.0f)? -1.0f : 1.0f;
+        rl_Vector3 tangent = Vector3Subtract(Vector3Scale(e1, t2), Vector3Scale(e2, t1));
+        float length = Vector3Length(tangent);
+
+        if ((fabsf(area) > MESH_TANGENTS_EPSILON) && (length > MESH_TANGENTS_EPSILON)) tangent = Vector3Scale(tangent, orientation/length);
+        else tangent = Vector3Zero();
+
+        job->triangleTangents[t*4] = tangent.x;
+        job->triangleTangents[t*4 + 1] = tangent.y;
+        job->triangleTangents[t*4 + 2] = tangent.z;
+        job->triangleTangents[t*4 + 3] = orientation;
+    }
 }
 
-// Get collision info between ray and triangle
-// NOTE: The points are expected to be in counter-clockwise winding
-// NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
-rl_RayCollision rl_GetRayCollisionTriangle(rl_Ray ray, rl_Vector3 p1, rl_Vector3 p2, rl_Vector3 p3)
+// Process mesh tangents vertices range on current thread, vertex triangles tangents are gathered
+static void ProcessTangentsVertexRange(const void *data, int start, int end)
 {
-    #define rl_EPSILON 0.000001f        // A small number
+    const TangentsJob *job = (const TangentsJob *)data;
+    const rl_Mesh *mesh = job->mesh;
 
-    rl_RayCollision collision = { 0 };
-    rl_Vector3 edge1 = { 0 };
-    rl_Vector3 edge2 = { 0 };
-    rl_Vector3 p = { 0 };
-    rl_Vector3 q = { 0 };
-    rl_Vector3 tv = { 0 };
-    float det = 0.0f, invDet = 0.0f, u = 0.0f, v = 0.0f, t = 0.0f;
+    for (int i = start; i < end; i++)
+    {
+        rl_Vector3 position = { mesh->vertices[i*3], mesh->vertices[i*3 + 1], mesh->vertices[i*3 + 2] };
+        rl_Vector3 normal = Vector3Normalize((rl_Vector3){ mesh->normals[i*3], mesh->normals[i*3 + 1], mesh->normals[i*3 + 2] });
+        rl_Vector3 tangent = { 0 };
+        float orientation = 0.0f;
 
-    // Find vectors for two edges sharing V1
-    edge1 = Vector3Subtract(p2, p1);
-    edge2 = Vector3Subtract(p3, p1);
+        for (int k = job->cornerOffsets[i]; k < job->cornerOffsets[i + 1]; k++)
+        {
+            int corner = job->corners[k];
+            int triangle = corner/3;
+            const float *triangleTangent = &job->triangleTangents[triangle*4];
 
-    // Begin calculating determinant - also used to calculate u parameter
-    p = Vector3CrossProduct(ray.direction, edge2);
+            // Triangle tangent projected on vertex normal plane
+            rl_Vector3 projected = { triangleTangent[0], triangleTangent[1], triangleTangent[2] };
+            projected = Vector3Subtract(projected, Vector3Scale(normal, Vector3DotProduct(normal, projected)));
 
-    // If determinant is near zero, ray lies in plane of triangle or ray is parallel to plane of triangle
-    det = Vector3DotProduct(edge1, p);
+            float length = Vector3Length(projected);
+            if (length < MESH_TANGENTS_EPSILON) continue;
 
-    // Avoid culling!
-    if ((det > -rl_EPSILON) && (det < rl_EPSILON)) return collision;
+            // Triangle corner angle, edges projected on vertex normal plane
+            int next = triangle*3 + (corner + 1)%3;
+            int prev = triangle*3 + (corner + 2)%3;
+            if (mesh->indices != NULL) { next = mesh->indices[next]; prev = mesh->indices[prev]; }
 
-    invDet = 1.0f/det;
+            rl_Vector3 edge1 = Vector3Subtract((rl_Vector3){ mesh->vertices[next*3], mesh->vertices[next*3 + 1], mesh->vertices[next*3 + 2] }, position);
+            rl_Vector3 edge2 = Vector3Subtract((rl_Vector3){ mesh->vertices[prev*3], mesh->vertices[prev*3 + 1], mesh->vertices[prev*3 + 2] }, position);
+            edge1 = Vector3Normalize(Vector3Subtract(edge1, Vector3Scale(normal, Vector3DotProduct(normal, edge1))));
+            edge2 = Vector3Normalize(Vector3Subtract(edge2, Vector3Scale(normal, Vector3DotProduct(normal, edge2))));
 
-    // Calculate distance from V1 to ray origin
-    tv = Vector3Subtract(ray.position, p1);
+            float angle = acosf(Clamp(Vector3DotProduct(edge1, edge2), -1.0f, 1.0f));
 
-    // Calculate u parameter and test bound
-    u = Vector3DotProduct(tv, p)*invDet;
+            tangent = Vector3Add(tangent, Vector3Scale(projected, angle/length));
+            orientation += triangleTangent[3]*angle;
+        }
 
-    // The intersection lies outside the triangle
-    if ((u < 0.0f) || (u > 1.0f)) return collision;
+        // Handle zero tangent (can happen with degenerate UVs), tangent perpendicular to the normal
+        if (Vector3Length(tangent) < MESH_TANGENTS_EPSILON)
+        {
+            if (fabsf(normal.z) > 0.707f) tangent = (rl_Vector3){ 1.0f, 0.0f, 0.0f };
+            else tangent = Vector3Normalize((rl_Vector3){ -normal.y, normal.x, 0.0f });
+        }
+        else tangent = Vector3Normalize(tangent);
 
-    // Prepare to test v parameter
-    q = Vector3CrossProduct(tv, edge1);
+        mesh->tangents[i*4] = tangent.x;
+        mesh->tangents[i*4 + 1] = tangent.y;
+        mesh->tangents[i*4 + 2] = tangent.z;
+        mesh->tangents[i*4 + 3] = (orientation < 0.0f)? -1.0f : 1.0f;
+    }
+}
 
-    // Calculate V parameter and test bound
-    v = Vector3DotProduct(ray.direction, q)*invDet;
+// Process billboard batch sort keys range on current thread
+// NOTE: Depth float bits are mapped to unsigned integers with same order, then inverted (far first)
+static void ProcessBillboardKeysRange(const void *data, int start, int end)
+{
+    const BillboardSortJob *job = (const BillboardSortJob *)data;
+    rl_BillboardBatch *batch = job->batch;
 
-    // The intersection lies outside the triangle
-    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+    for (int i = start; i < end; i++)
+    {
+        float depth = Vector3DotProduct(Vector3Subtract(batch->instances[i].position, job->viewPosition), job->viewForward);
+        unsigned int bits = 0;
+        memcpy(&bits, &depth, sizeof(unsigned int));
 
-    t = Vector3DotProduct(edge2, q)*invDet;
+        bits = (bits & 0x80000000u)? ~bits : (bits | 0x80000000u);
 
-    if (t > rl_EPSILON)
-    {
-        // rl_Ray hit, get hit point and normal
-        collision.hit = true;
-        collision.distance = t;
-        collision.normal = Vector3Normalize(Vector3CrossProduct(edge1, edge2));
-        collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, t));
+        batch->keys[i] = ~bits;
+        batch->indices[i] = i;
     }
-
-    return collision;
 }
 
-// Get collision info between ray and quad
-// NOTE: The points are expected to be in counter-clockwise winding
-rl_RayCollision rl_GetRayCollisionQuad(rl_Ray ray, rl_Vector3 p1, rl_Vector3 p2, rl_Vector3 p3, rl_Vector3 p4)
+// Process billboard batch sort digits counts range on current thread, counts are stored per chunk
+static void ProcessBillboardHistogramRange(const void *data, int start, int end)
 {
-    rl_RayCollision collision = { 0 };
-
-    collision = rl_GetRayCollisionTriangle(ray, p1, p2, p4);
+    const BillboardSortJob *job = (const BillboardSortJob *)data;
+    rl_BillboardBatch *batch = job->batch;
+    const unsigned int *keys = batch->keys + job->source*batch->capacity;
 
-    if (!collision.hit) collision = rl_GetRayCollisionTriangle(ray, p2, p3, p4);
+    for (int chunk = start/BILLBOARD_SORT_CHUNK_SIZE; chunk*BILLBOARD_SORT_CHUNK_SIZE < end; chunk++)
+    {
+        int *histogram = batch->histograms + chunk*256;
+        int chunkEnd = ((chunk + 1)*BILLBOARD_SORT_CHUNK_SIZE < end)? (chunk + 1)*BILLBOARD_SORT_CHUNK_SIZE : end;
 
-    return collision;
+        memset(histogram, 0, 256*sizeof(int));
+        for (int i = chunk*BILLBOARD_SORT_CHUNK_SIZE; i < chunkEnd; i++) histogram[(keys[i] >> job->shift) & 0xff]++;
+    }
 }
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
-// Build pose from parent joints
-// NOTE: Required for animations loading (required by IQM and GLTF)
-static void BuildPoseFromParentJoints(rl_BoneInfo *bones, int boneCount, rl_Transform *transforms)
+// Process billboard batch sort scatter range on current thread, chunks scatter from their digits offsets
+static void ProcessBillboardScatterRange(const void *data, int start, int end)
 {
-    for (int i = 0; i < boneCount; i++)
+    const BillboardSortJob *job = (const BillboardSortJob *)data;
+    rl_BillboardBatch *batch = job->batch;
+    const unsigned int *keys = batch->keys + job->source*batch->capacity;
+    const int *indices = batch->indices + job->source*batch->capacity;
+    unsigned int *sortedKeys = batch->keys + (1 - job->source)*batch->capacity;
+    int *sortedIndices = batch->indices + (1 - job->source)*batch->capacity;
+
+    for (int chunk = start/BILLBOARD_SORT_CHUNK_SIZE; chunk*BILLBOARD_SORT_CHUNK_SIZE < end; chunk++)
     {
-        if (bones[i].parent >= 0)
+        int *offsets = batch->histograms + chunk*256;
+        int chunkEnd = ((chunk + 1)*BILLBOARD_SORT_CHUNK_SIZE < end)? (chunk + 1)*BILLBOARD_SORT_CHUNK_SIZE : end;
+
+        for (int i = chunk*BILLBOARD_SORT_CHUNK_SIZE; i < chunkEnd; i++)
         {
-            if (bones[i].parent > i)
-            {
-                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
-                continue;
-            }
-            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
-            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
-            transforms[i].translation = Vector3Multiply(transforms[i].translation, transforms[bones[i].parent].scale);
-            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
-            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
+            int slot = offsets[(keys[i] >> job->shift) & 0xff]++;
+            sortedKeys[slot] = keys[i];
+            sortedIndices[slot] = indices[i];
         }
     }
 }
-#endif
+
+// Process billboard batch sorted instances gathering range on current thread
+static void ProcessBillboardGatherRange(const void *data, int start, int end)
+{
+    const BillboardSortJob *job = (const BillboardSortJob *)data;
+    rl_BillboardBatch *batch = job->batch;
+    const int *indices = batch->indices + job->source*batch->capacity;
+
+    for (int i = start; i < end; i++) batch->sorted[i] = batch->instances[indices[i]];
+}
 
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 // Load OBJ mesh data
@@ -4317,10 +12104,18 @@ static rl_Model LoadOBJ(const char *fileName)
         return model;
     }
 
-    char currentDir[MAX_FILEPATH_LENGTH] = { 0 };
-    strncpy(currentDir, rl_GetWorkingDirectory(), MAX_FILEPATH_LENGTH - 1); // Save current working directory
-    const char *workingDir = rl_GetDirectoryPath(fileName); // Switch to OBJ directory for material path correctness
-    if (CHDIR(workingDir) != 0) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
+    // Material library and textures paths are relative to OBJ directory
+    // NOTE: Working directory is not changed, models can be loaded from multiple threads
+    char dirPath[MAX_FILEPATH_LENGTH] = { 0 };
+    GetModelDirectoryPath(fileName, dirPath);
+
+    char *resolvedText = ResolveMaterialLibraryOBJ(fileText, dirPath);
+
+    if (resolvedText != NULL)
+    {
+        rl_UnloadFileText(fileText);
+        fileText = resolvedText;
+    }
 
     unsigned int dataSize = (unsigned int)strlen(fileText);
 
@@ -4524,20 +12319,70 @@ static rl_Model LoadOBJ(const char *fileName)
         }
     }
 
-    if (objMaterialCount > 0) ProcessMaterialsOBJ(model.materials, objMaterials, objMaterialCount);
-    else model.materials[0] = rl_LoadMaterialDefault(); // Set default material for the mesh
+    if (objMaterialCount > 0) ProcessMaterialsOBJ(model.materials, objMaterials, objMaterialCount, dirPath);
+    else model.materials[0] = rl_LoadMaterialDefault(); // Set default material for the mesh
+
+    tinyobj_attrib_free(&objAttributes);
+    tinyobj_shapes_free(objShapes, objShapeCount);
+    tinyobj_materials_free(objMaterials, objMaterialCount);
+
+    return model;
+}
+
+// Resolve OBJ material library paths from model directory, tinyobj opens them relative to working directory
+// NOTE: Returns new text (to be freed with rl_UnloadFileText()) or NULL if no relative material library is referenced
+static char *ResolveMaterialLibraryOBJ(const char *fileText, const char *dirPath)
+{
+    int dirLength = (int)strlen(dirPath);
+    int textLength = (int)strlen(fileText);
+    int count = 0;
+
+    for (const char *line = fileText; line != NULL; line = strchr(line, '\n'))
+    {
+        if (*line == '\n') line++;
+        if (GetMaterialLibraryNameOBJ(line) != NULL) count++;
+    }
+
+    if (count == 0) return NULL;
+
+    char *text = (char *)RL_MALLOC(textLength + count*(dirLength + 1) + 1);
+    char *textPtr = text;
+    const char *copyStart = fileText;
+
+    for (const char *line = fileText; line != NULL; line = strchr(line, '\n'))
+    {
+        if (*line == '\n') line++;
+
+        const char *name = GetMaterialLibraryNameOBJ(line);
+        if (name == NULL) continue;
+
+        memcpy(textPtr, copyStart, name - copyStart);
+        textPtr += name - copyStart;
+        memcpy(textPtr, dirPath, dirLength);
+        textPtr += dirLength;
+        *textPtr++ = '/';
+        copyStart = name;
+    }
+
+    memcpy(textPtr, copyStart, textLength - (copyStart - fileText) + 1);
+
+    return text;
+}
+
+// Get OBJ line material library name, NULL if line is not a "mtllib" command or path is absolute
+static const char *GetMaterialLibraryNameOBJ(const char *line)
+{
+    while ((*line == ' ') || (*line == '\t')) line++;
 
-    tinyobj_attrib_free(&objAttributes);
-    tinyobj_shapes_free(objShapes, objShapeCount);
-    tinyobj_materials_free(objMaterials, objMaterialCount);
+    if ((strncmp(line, "mtllib", 6) != 0) || ((line[6] != ' ') && (line[6] != '\t'))) return NULL;
 
-    // Restore current working directory
-    if (CHDIR(currentDir) != 0)
-    {
-        TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", currentDir);
-    }
+    line += 7;
+    while ((*line == ' ') || (*line == '\t')) line++;
 
-    return model;
+    if ((line[0] == '\0') || (line[0] == '\r') || (line[0] == '\n')) return NULL;
+    if ((line[0] == '/') || (line[0] == '\\') || (line[1] == ':')) return NULL;
+
+    return line;
 }
 #endif
 
@@ -4656,7 +12501,8 @@ static rl_Model LoadIQM(const char *fileName)
     // In case file can not be read, return an empty model
     if (fileDataPtr == NULL) return model;
 
-    const char *basePath = rl_GetDirectoryPath(fileName);
+    char basePath[MAX_FILEPATH_LENGTH] = { 0 };
+    GetModelDirectoryPath(fileName, basePath);
 
     // Read IQM header
     IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
@@ -4704,7 +12550,7 @@ static rl_Model LoadIQM(const char *fileName)
         memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
 
         model.materials[i] = rl_LoadMaterialDefault();
-        model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture = rl_LoadTexture(rl_TextFormat("%s/%s", basePath, material));
+        model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture = LoadMaterialTextureFile(basePath, material);
 
         model.meshMaterial[i] = i;
 
@@ -5182,6 +13028,486 @@ static void ReleaseFileGLTFCallback(const struct cgltf_memory_options *memoryOpt
     rl_UnloadFileData((unsigned char *)data);
 }
 
+// Get glTF accessor data, decoded buffer view data is used if available (EXT_meshopt_compression)
+static const unsigned char *GetAccessorDataGLTF(const cgltf_accessor *accessor)
+{
+    if (accessor->buffer_view == NULL) return NULL;
+
+    const unsigned char *data = cgltf_buffer_view_data(accessor->buffer_view);
+
+    return (data != NULL)? data + accessor->offset : NULL;
+}
+
+// Get glTF sparse accessor element index
+static unsigned int GetSparseIndexGLTF(const cgltf_accessor_sparse *sparse, const unsigned char *indices, unsigned int index)
+{
+    unsigned int result = 0;
+
+    if (sparse->indices_component_type == cgltf_component_type_r_8u) result = indices[index];
+    else if (sparse->indices_component_type == cgltf_component_type_r_16u) result = ((const unsigned short *)indices)[index];
+    else if (sparse->indices_component_type == cgltf_component_type_r_32u) result = ((const unsigned int *)indices)[index];
+
+    return result;
+}
+
+// Decode meshopt variable length integer (7 bits per byte)
+static unsigned int DecodeMeshoptVByte(const unsigned char **data)
+{
+    const unsigned char *ptr = *data;
+    unsigned int lead = *ptr++;
+    unsigned int result = lead & 127;
+
+    if (lead >= 128)
+    {
+        for (int i = 0, shift = 7; i < 4; i++, shift += 7)
+        {
+            unsigned int group = *ptr++;
+            result |= (group & 127) << shift;
+
+            if (group < 128) break;
+        }
+    }
+
+    *data = ptr;
+
+    return result;
+}
+
+// Decode meshopt bytes groups, every group of 16 bytes is stored with 0, 2, 4 or 8 bits per byte
+static const unsigned char *DecodeMeshoptBytes(const unsigned char *data, const unsigned char *dataEnd, unsigned char *buffer, int bufferSize)
+{
+    int headerSize = (bufferSize/16 + 3)/4;
+    if ((dataEnd - data) < headerSize) return NULL;
+
+    const unsigned char *header = data;
+    data += headerSize;
+
+    for (int i = 0; i < bufferSize; i += 16)
+    {
+        // NOTE: Worst case group size is 24 bytes (2 bits header byte + 16 bytes sentinels)
+        if ((dataEnd - data) < 24) return NULL;
+
+        int group = i/16;
+        int bitsLog2 = (header[group/4] >> ((group%4)*2)) & 3;
+        unsigned char *output = buffer + i;
+
+        if (bitsLog2 == 0) memset(output, 0, 16);
+        else if (bitsLog2 == 3)
+        {
+            memcpy(output, data, 16);
+            data += 16;
+        }
+        else
+        {
+            // Values equal to all bits set are sentinels, actual byte read after packed bits
+            int bits = (bitsLog2 == 1)? 2 : 4;
+            int sentinel = (1 << bits) - 1;
+            const unsigned char *dataVar = data + bits*2;
+
+            for (int k = 0; k < 16; k++)
+            {
+                int value = (data[k*bits/8] >> (8 - bits - ((k*bits)%8))) & sentinel;
+
+                if (value == sentinel) output[k] = *dataVar++;
+                else output[k] = (unsigned char)value;
+            }
+
+            data = dataVar;
+        }
+    }
+
+    return data;
+}
+
+// Decode meshopt vertex buffer (EXT_meshopt_compression attributes mode, version 0)
+// NOTE: Vertex bytes are delta encoded per byte channel in blocks of up to 256 vertices
+static int DecodeMeshoptVertexBuffer(unsigned char *vertices, int vertexCount, int vertexSize, const unsigned char *data, int dataSize)
+{
+    if ((vertexSize <= 0) || (vertexSize > 256) || ((vertexSize%4) != 0)) return -1;
+    if (dataSize < (1 + vertexSize)) return -2;
+    if ((data[0] & 0xf0) != 0xa0) return -1;
+    if ((data[0] & 0x0f) > 0) return -1;        // Only version 0 supported
+
+    const unsigned char *dataEnd = data + dataSize;
+    unsigned char lastVertex[256] = { 0 };
+    unsigned char buffer[256] = { 0 };
+
+    // Last vertex of previous block initially set from data tail
+    memcpy(lastVertex, dataEnd - vertexSize, vertexSize);
+
+    int blockSize = (8192/vertexSize) & ~15;
+    if (blockSize > 256) blockSize = 256;
+
+    data++;
+
+    for (int offset = 0; offset < vertexCount; offset += blockSize)
+    {
+        int count = ((vertexCount - offset) < blockSize)? (vertexCount - offset) : blockSize;
+        int countAligned = (count + 15) & ~15;
+        unsigned char *block = vertices + offset*vertexSize;
+
+        for (int k = 0; k < vertexSize; k++)
+        {
+            data = DecodeMeshoptBytes(data, dataEnd, buffer, countAligned);
+            if (data == NULL) return -2;
+
+            unsigned char previous = lastVertex[k];
+
+            for (int i = 0; i < count; i++)
+            {
+                // Delta values are zigzag encoded
+                unsigned char delta = (unsigned char)((buffer[i] >> 1) ^ -(buffer[i] & 1));
+                previous = (unsigned char)(previous + delta);
+                block[i*vertexSize + k] = previous;
+            }
+
+            lastVertex[k] = previous;
+        }
+    }
+
+    int tailSize = (vertexSize < 32)? 32 : vertexSize;
+    if ((dataEnd - data) != tailSize) return -3;
+
+    return 0;
+}
+
+// Write decoded meshopt triangle indices
+static void WriteMeshoptTriangle(unsigned char *indices, int offset, int indexSize, unsigned int a, unsigned int b, unsigned int c)
+{
+    if (indexSize == 2)
+    {
+        ((unsigned short *)indices)[offset] = (unsigned short)a;
+        ((unsigned short *)indices)[offset + 1] = (unsigned short)b;
+        ((unsigned short *)indices)[offset + 2] = (unsigned short)c;
+    }
+    else
+    {
+        ((unsigned int *)indices)[offset] = a;
+        ((unsigned int *)indices)[offset + 1] = b;
+        ((unsigned int *)indices)[offset + 2] = c;
+    }
+}
+
+// Decode meshopt index buffer (EXT_meshopt_compression triangles mode, version 0 and 1)
+// NOTE: Triangles are encoded referencing recent edges and vertices (16 entries FIFOs)
+static int DecodeMeshoptIndexBuffer(unsigned char *indices, int indexCount, int indexSize, const unsigned char *data, int dataSize)
+{
+    if (((indexCount%3) != 0) || ((indexSize != 2) && (indexSize != 4))) return -1;
+    if (dataSize < (1 + indexCount/3 + 16)) return -2;
+    if ((data[0] & 0xf0) != 0xe0) return -1;
+
+    int version = data[0] & 0x0f;
+    if (version > 1) return -1;
+
+    unsigned int edgeFifo[16][2];
+    unsigned int vertexFifo[16];
+    memset(edgeFifo, 0xff, sizeof(edgeFifo));
+    memset(vertexFifo, 0xff, sizeof(vertexFifo));
+
+    int edgeOffset = 0;
+    int vertexOffset = 0;
+    unsigned int next = 0;
+    unsigned int last = 0;
+    int fecMax = (version >= 1)? 13 : 15;
+
+    const unsigned char *code = data + 1;
+    const unsigned char *dataSafeEnd = data + dataSize - 16;
+    const unsigned char *codeAuxTable = dataSafeEnd;
+    data = code + indexCount/3;
+
+    #define PUSH_EDGE(a, b) { edgeFifo[edgeOffset][0] = (a); edgeFifo[edgeOffset][1] = (b); edgeOffset = (edgeOffset + 1) & 15; }
+    #define PUSH_VERTEX(v, cond) { vertexFifo[vertexOffset] = (v); vertexOffset = (vertexOffset + (cond)) & 15; }
+
+    for (int i = 0; i < indexCount; i += 3)
+    {
+        if (data > dataSafeEnd) return -2;
+
+        unsigned int codeTri = *code++;
+
+        if (codeTri < 0xf0)
+        {
+            // Triangle reusing an edge from edges FIFO
+            int fe = codeTri >> 4;
+            unsigned int a = edgeFifo[(edgeOffset - 1 - fe) & 15][0];
+            unsigned int b = edgeFifo[(edgeOffset - 1 - fe) & 15][1];
+            int fec = codeTri & 15;
+            unsigned int c = 0;
+
+            if (fec < fecMax)
+            {
+                // Third vertex is next new vertex or reused from vertices FIFO
+                c = (fec == 0)? next : vertexFifo[(vertexOffset - 1 - fec) & 15];
+                next += (fec == 0);
+
+                PUSH_VERTEX(c, (fec == 0));
+            }
+            else
+            {
+                // Third vertex is delta encoded from last free index (13: -1, 14: +1)
+                if (fec != 15) c = last + (fec - (fec ^ 3));
+                else
+                {
+                    unsigned int v = DecodeMeshoptVByte(&data);
+                    c = last + ((v >> 1) ^ -(v & 1));
+                }
+
+                last = c;
+
+                PUSH_VERTEX(c, 1);
+            }
+
+            WriteMeshoptTriangle(indices, i, indexSize, a, b, c);
+
+            PUSH_EDGE(c, b);
+            PUSH_EDGE(a, c);
+        }
+        else
+        {
+            // Triangle not sharing edges, vertices encoded in auxiliary code
+            unsigned int codeAux = (codeTri < 0xfe)? codeAuxTable[codeTri & 15] : *data++;
+            int fea = (codeTri == 0xff)? 15 : 0;
+            int feb = codeAux >> 4;
+            int fec = codeAux & 15;
+
+            if ((codeTri >= 0xfe) && (codeAux == 0)) next = 0;   // Reset marker
+
+            unsigned int a = 0;
+            unsigned int b = 0;
+            unsigned int c = 0;
+
+            if (codeTri < 0xfe)
+            {
+                a = next++;
+                b = (feb == 0)? next : vertexFifo[(vertexOffset - feb) & 15];
+                next += (feb == 0);
+                c = (fec == 0)? next : vertexFifo[(vertexOffset - fec) & 15];
+                next += (fec == 0);
+            }
+            else
+            {
+                // NOTE: Next is incremented for all three vertices before decoding free indices
+                a = (fea == 0)? next++ : 0;
+                b = (feb == 0)? next++ : vertexFifo[(vertexOffset - feb) & 15];
+                c = (fec == 0)? next++ : vertexFifo[(vertexOffset - fec) & 15];
+
+                if (fea == 15) { unsigned int v = DecodeMeshoptVByte(&data); last = a = last + ((v >> 1) ^ -(v & 1)); }
+                if (feb == 15) { unsigned int v = DecodeMeshoptVByte(&data); last = b = last + ((v >> 1) ^ -(v & 1)); }
+                if (fec == 15) { unsigned int v = DecodeMeshoptVByte(&data); last = c = last + ((v >> 1) ^ -(v & 1)); }
+            }
+
+            WriteMeshoptTriangle(indices, i, indexSize, a, b, c);
+
+            PUSH_VERTEX(a, 1);
+            PUSH_VERTEX(b, (feb == 0) || (feb == 15));
+            PUSH_VERTEX(c, (fec == 0) || (fec == 15));
+
+            PUSH_EDGE(b, a);
+            PUSH_EDGE(c, b);
+            PUSH_EDGE(a, c);
+        }
+    }
+
+    #undef PUSH_EDGE
+    #undef PUSH_VERTEX
+
+    if (data != dataSafeEnd) return -3;
+
+    return 0;
+}
+
+// Decode meshopt index sequence (EXT_meshopt_compression indices mode)
+// NOTE: Indices are delta encoded against one of two previous indices
+static int DecodeMeshoptIndexSequence(unsigned char *indices, int indexCount, int indexSize, const unsigned char *data, int dataSize)
+{
+    if ((indexSize != 2) && (indexSize != 4)) return -1;
+    if (dataSize < (1 + indexCount + 4)) return -2;
+    if ((data[0] & 0xf0) != 0xd0) return -1;
+    if ((data[0] & 0x0f) > 1) return -1;
+
+    const unsigned char *dataSafeEnd = data + dataSize - 4;
+    unsigned int last[2] = { 0 };
+    data++;
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        // NOTE: Every index reads up to 5 bytes, data is followed by a 4 bytes tail
+        if (data >= dataSafeEnd) return -2;
+
+        unsigned int v = DecodeMeshoptVByte(&data);
+        unsigned int current = v & 1;
+        v >>= 1;
+
+        unsigned int index = last[current] + ((v >> 1) ^ -(v & 1));
+        last[current] = index;
+
+        if (indexSize == 2) ((unsigned short *)indices)[i] = (unsigned short)index;
+        else ((unsigned int *)indices)[i] = index;
+    }
+
+    if (data != dataSafeEnd) return -3;
+
+    return 0;
+}
+
+// Decode meshopt filter applied over decoded attributes data
+// NOTE: Octahedral filter for unit vectors (normals, tangents), quaternion filter for rotations,
+// exponential filter for floats stored with shared exponent
+static void DecodeMeshoptFilter(unsigned char *data, int count, int stride, cgltf_meshopt_compression_filter filter)
+{
+    if (filter == cgltf_meshopt_compression_filter_octahedral)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            float values[3] = { 0 };
+            float max = (stride == 4)? 127.0f : 32767.0f;
+
+            for (int k = 0; k < 3; k++) values[k] = (stride == 4)? (float)((signed char *)data)[i*4 + k] : (float)((short *)data)[i*4 + k];
+
+            // Reconstruct z and fix up octahedral coordinates for z < 0
+            float x = values[0];
+            float y = values[1];
+            float z = values[2] - fabsf(x) - fabsf(y);
+            float t = (z >= 0.0f)? 0.0f : z;
+
+            x += (x >= 0.0f)? t : -t;
+            y += (y >= 0.0f)? t : -t;
+
+            float s = max/sqrtf(x*x + y*y + z*z);
+            values[0] = x*s;
+            values[1] = y*s;
+            values[2] = z*s;
+
+            for (int k = 0; k < 3; k++)
+            {
+                int value = (int)(values[k] + ((values[k] >= 0.0f)? 0.5f : -0.5f));
+
+                if (stride == 4) ((signed char *)data)[i*4 + k] = (signed char)value;
+                else ((short *)data)[i*4 + k] = (short)value;
+            }
+        }
+    }
+    else if (filter == cgltf_meshopt_compression_filter_quaternion)
+    {
+        short *quaternions = (short *)data;
+
+        for (int i = 0; i < count; i++)
+        {
+            short *q = &quaternions[i*4];
+
+            // Scale recovered from high bits of last component, first two bits store max component index
+            float scale = (1.0f/sqrtf(2.0f))/(float)(q[3] | 3);
+            float x = (float)q[0]*scale;
+            float y = (float)q[1]*scale;
+            float z = (float)q[2]*scale;
+            float ww = 1.0f - x*x - y*y - z*z;
+            float w = sqrtf((ww >= 0.0f)? ww : 0.0f);
+            int maxComponent = q[3] & 3;
+
+            q[(maxComponent + 1) & 3] = (short)(x*32767.0f + ((x >= 0.0f)? 0.5f : -0.5f));
+            q[(maxComponent + 2) & 3] = (short)(y*32767.0f + ((y >= 0.0f)? 0.5f : -0.5f));
+            q[(maxComponent + 3) & 3] = (short)(z*32767.0f + ((z >= 0.0f)? 0.5f : -0.5f));
+            q[maxComponent] = (short)(w*32767.0f + 0.5f);
+        }
+    }
+    else if (filter == cgltf_meshopt_compression_filter_exponential)
+    {
+        unsigned int *values = (unsigned int *)data;
+
+        for (int i = 0; i < count*stride/4; i++)
+        {
+            // Signed 24 bit mantissa and signed 8 bit exponent
+            int mantissa = (int)(values[i] << 8) >> 8;
+            int exponent = (int)values[i] >> 24;
+            union { float f; unsigned int ui; } value = { 0 };
+
+            value.ui = (unsigned int)(exponent + 127) << 23;
+            value.f = value.f*(float)mantissa;
+            values[i] = value.ui;
+        }
+    }
+}
+
+// Check meshopt compressed buffer view mode, filter and stride are compatible (EXT_meshopt_compression spec)
+// NOTE: Filters decode data in place assuming the spec stride, any other stride overflows decoded data
+static bool IsMeshoptCompressionValid(const cgltf_meshopt_compression *compression)
+{
+    cgltf_size stride = compression->stride;
+    bool result = false;
+
+    switch (compression->mode)
+    {
+        case cgltf_meshopt_compression_mode_attributes: result = (stride > 0) && (stride <= 256) && ((stride%4) == 0); break;
+        case cgltf_meshopt_compression_mode_triangles: result = ((compression->count%3) == 0) && ((stride == 2) || (stride == 4)); break;
+        case cgltf_meshopt_compression_mode_indices: result = (stride == 2) || (stride == 4); break;
+        default: break;
+    }
+
+    switch (compression->filter)
+    {
+        case cgltf_meshopt_compression_filter_none: break;
+        case cgltf_meshopt_compression_filter_octahedral: result = result && (compression->mode == cgltf_meshopt_compression_mode_attributes) && ((stride == 4) || (stride == 8)); break;
+        case cgltf_meshopt_compression_filter_quaternion: result = result && (compression->mode == cgltf_meshopt_compression_mode_attributes) && (stride == 8); break;
+        case cgltf_meshopt_compression_filter_exponential: result = result && (compression->mode == cgltf_meshopt_compression_mode_attributes); break;
+        default: result = false; break;
+    }
+
+    // Decoders use int sizes
+    if (result && ((compression->count > (cgltf_size)INT_MAX/stride) || (compression->size > INT_MAX))) result = false;
+
+    return result;
+}
+
+// Decode glTF buffer views compressed with EXT_meshopt_compression
+// NOTE: Decoded data is stored in buffer_view->data (freed by cgltf_free()), read by accessors instead of buffer data
+static void DecodeMeshoptBuffersGLTF(cgltf_data *data, const char *fileName)
+{
+    for (unsigned int i = 0; i < data->buffer_views_count; i++)
+    {
+        cgltf_buffer_view *view = &data->buffer_views[i];
+
+        if (!view->has_meshopt_compression || (view->data != NULL)) continue;
+
+        const cgltf_meshopt_compression *compression = &view->meshopt_compression;
+
+        if ((compression->buffer == NULL) || (compression->buffer->data == NULL) ||
+            ((compression->offset + compression->size) > compression->buffer->size))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Compressed buffer view %i data not available", fileName, i);
+            continue;
+        }
+
+        if (!IsMeshoptCompressionValid(compression))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Compressed buffer view %i mode, filter or stride not valid", fileName, i);
+            continue;
+        }
+
+        const unsigned char *source = (const unsigned char *)compression->buffer->data + compression->offset;
+        cgltf_size size = compression->count*compression->stride;
+        unsigned char *decoded = (unsigned char *)RL_CALLOC((size > view->size)? size : view->size, 1);
+        int result = -1;
+
+        switch (compression->mode)
+        {
+            case cgltf_meshopt_compression_mode_attributes: result = DecodeMeshoptVertexBuffer(decoded, (int)compression->count, (int)compression->stride, source, (int)compression->size); break;
+            case cgltf_meshopt_compression_mode_triangles: result = DecodeMeshoptIndexBuffer(decoded, (int)compression->count, (int)compression->stride, source, (int)compression->size); break;
+            case cgltf_meshopt_compression_mode_indices: result = DecodeMeshoptIndexSequence(decoded, (int)compression->count, (int)compression->stride, source, (int)compression->size); break;
+            default: break;
+        }
+
+        if (result == 0)
+        {
+            DecodeMeshoptFilter(decoded, (int)compression->count, (int)compression->stride, compression->filter);
+            view->data = decoded;
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to decode meshopt compressed buffer view %i (error: %i)", fileName, i, result);
+            RL_FREE(decoded);
+        }
+    }
+}
+
 // Load image from different glTF provided methods (uri, path, buffer_view)
 static rl_Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath)
 {
@@ -5227,40 +13553,183 @@ static rl_Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *tex
         }
         else     // Check if image is provided as image path
         {
-            image = rl_LoadImage(rl_TextFormat("%s/%s", texPath, cgltfImage->uri));
+            char path[MAX_FILEPATH_LENGTH] = { 0 };
+
+            if (GetModelFilePath(texPath, cgltfImage->uri, path)) image = rl_LoadImage(path);
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to resolve glTF image path", cgltfImage->uri);
+        }
+    }
+    else if ((cgltfImage->buffer_view != NULL) && (cgltf_buffer_view_data(cgltfImage->buffer_view) != NULL))    // Check if image is provided as data buffer
+    {
+        // NOTE: rl_Image is decoded directly from buffer data, no copy required
+        const unsigned char *data = cgltf_buffer_view_data(cgltfImage->buffer_view);
+
+        // Check mime_type for image: (cgltfImage->mime_type == "image/png")
+        // NOTE: Detected that some models define mime_type as "image\\/png"
+        if ((strcmp(cgltfImage->mime_type, "image\\/png") == 0) || (strcmp(cgltfImage->mime_type, "image/png") == 0))
+        {
+            image = rl_LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
+        }
+        else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) || (strcmp(cgltfImage->mime_type, "image/jpeg") == 0))
+        {
+            image = rl_LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
+        }
+        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized");
+    }
+
+    return image;
+}
+#if defined(SUPPORT_SHARED_TEXTURES)
+// Get glTF image shared texture resource key, file path for uri images or data hash for embedded images
+// NOTE: Returns false if image provides no data or its path can not be used as key
+static bool GetCgltfImageKey(cgltf_image *cgltfImage, const char *texPath, char *key)
+{
+    if (cgltfImage == NULL) return false;
+
+    if (cgltfImage->uri != NULL)
+    {
+        if (strncmp(cgltfImage->uri, "data:", 5) == 0)
+        {
+            int size = (int)strlen(cgltfImage->uri);
+            snprintf(key, MAX_FILEPATH_LENGTH, "data:%08x:%i", rl_ComputeCRC32((unsigned char *)cgltfImage->uri, size), size);
+        }
+        else
+        {
+            char path[MAX_FILEPATH_LENGTH] = { 0 };
+
+            // Images with unresolved or truncated paths are not shared
+            if (!GetModelFilePath(texPath, cgltfImage->uri, path) || !GetMaterialTextureFileKey(path, key)) return false;
+        }
+
+        return true;
+    }
+    else if ((cgltfImage->buffer_view != NULL) && (cgltf_buffer_view_data(cgltfImage->buffer_view) != NULL))
+    {
+        int size = (int)cgltfImage->buffer_view->size;
+        snprintf(key, MAX_FILEPATH_LENGTH, "data:%08x:%i", rl_ComputeCRC32((unsigned char *)cgltf_buffer_view_data(cgltfImage->buffer_view), size), size);
+
+        return true;
+    }
+
+    return false;
+}
+#endif
+
+// Load material texture from glTF image, upload is deferred when loading asynchronously
+// NOTE: With SUPPORT_SHARED_TEXTURES, image is decoded once and texture shared by all materials and models using it,
+// returned texture width is 0 if image could not be loaded
+static rl_Texture2D LoadMaterialTextureGLTF(cgltf_image *cgltfImage, const char *texPath)
+{
+    rl_Texture2D texture = { 0 };
+
+#if defined(SUPPORT_SHARED_TEXTURES)
+    char key[MAX_FILEPATH_LENGTH] = { 0 };
+
+    if (GetCgltfImageKey(cgltfImage, texPath, key))
+    {
+        if (AcquireMaterialTexture(key, &texture)) return texture;
+
+        return StoreMaterialTexture(key, LoadImageFromCgltfImage(cgltfImage, texPath));
+    }
+#endif
+
+    rl_Image image = LoadImageFromCgltfImage(cgltfImage, texPath);
+
+    if (image.data != NULL)
+    {
+        texture = LoadMaterialTexture(image);
+        rl_UnloadImage(image);
+    }
+
+    return texture;
+}
+
+// Split glTF metallic/roughness image into roughness (green channel) and metallic (blue channel) images
+static void SplitMetallicRoughnessImageGLTF(rl_Image image, rl_Image *roughness, rl_Image *metallic)
+{
+    rl_Image imRoughness = { 0 };
+    rl_Image imMetallic = { 0 };
+
+    imMetallic.data = RL_MALLOC(image.width*image.height);
+    imRoughness.data = RL_MALLOC(image.width*image.height);
+
+    imMetallic.width = imRoughness.width = image.width;
+    imMetallic.height = imRoughness.height = image.height;
+
+    imMetallic.format = imRoughness.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    imMetallic.mipmaps = imRoughness.mipmaps = 1;
+
+    for (int x = 0; x < imRoughness.width; x++)
+    {
+        for (int y = 0; y < imRoughness.height; y++)
+        {
+            rl_Color color = rl_GetImageColor(image, x, y);
+
+            ((unsigned char *)imRoughness.data)[y*imRoughness.width + x] = color.g; // Roughness color channel
+            ((unsigned char *)imMetallic.data)[y*imMetallic.width + x] = color.b; // Metallic color channel
         }
     }
-    else if ((cgltfImage->buffer_view != NULL) && (cgltfImage->buffer_view->buffer->data != NULL))    // Check if image is provided as data buffer
+
+    *roughness = imRoughness;
+    *metallic = imMetallic;
+}
+
+// Load roughness and metallic material textures from glTF metallic/roughness image
+// NOTE: With SUPPORT_SHARED_TEXTURES, image is only decoded if any channel texture is not shared yet
+static void LoadMetallicRoughnessTexturesGLTF(cgltf_image *cgltfImage, const char *texPath, rl_Texture2D *roughness, rl_Texture2D *metallic)
+{
+    rl_Image imMetallicRoughness = { 0 };
+    rl_Image imRoughness = { 0 };
+    rl_Image imMetallic = { 0 };
+
+#if defined(SUPPORT_SHARED_TEXTURES)
+    char key[MAX_FILEPATH_LENGTH] = { 0 };
+
+    if (GetCgltfImageKey(cgltfImage, texPath, key))
     {
-        unsigned char *data = (unsigned char *)RL_MALLOC(cgltfImage->buffer_view->size);
-        int offset = (int)cgltfImage->buffer_view->offset;
-        int stride = (int)cgltfImage->buffer_view->stride? (int)cgltfImage->buffer_view->stride : 1;
+        // Channels textures are shared by resource key plus channel
+        char roughnessKey[MAX_FILEPATH_LENGTH + 4] = { 0 };
+        char metallicKey[MAX_FILEPATH_LENGTH + 4] = { 0 };
+        snprintf(roughnessKey, sizeof(roughnessKey), "%s#g", key);
+        snprintf(metallicKey, sizeof(metallicKey), "%s#b", key);
 
-        // Copy buffer data to memory for loading
-        for (unsigned int i = 0; i < cgltfImage->buffer_view->size; i++)
-        {
-            data[i] = ((unsigned char *)cgltfImage->buffer_view->buffer->data)[offset];
-            offset += stride;
-        }
+        bool roughnessShared = AcquireMaterialTexture(roughnessKey, roughness);
+        bool metallicShared = AcquireMaterialTexture(metallicKey, metallic);
 
-        // Check mime_type for image: (cgltfImage->mime_type == "image/png")
-        // NOTE: Detected that some models define mime_type as "image\\/png"
-        if ((strcmp(cgltfImage->mime_type, "image\\/png") == 0) || (strcmp(cgltfImage->mime_type, "image/png") == 0))
-        {
-            image = rl_LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
-        }
-        else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) || (strcmp(cgltfImage->mime_type, "image/jpeg") == 0))
+        if (!roughnessShared || !metallicShared)
         {
-            image = rl_LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
+            imMetallicRoughness = LoadImageFromCgltfImage(cgltfImage, texPath);
+            if (imMetallicRoughness.data != NULL) SplitMetallicRoughnessImageGLTF(imMetallicRoughness, &imRoughness, &imMetallic);
+            rl_UnloadImage(imMetallicRoughness);
+
+            // Resources registered as loading are always completed, invalid images remove them
+            if (!roughnessShared) *roughness = StoreMaterialTexture(roughnessKey, imRoughness);
+            else rl_UnloadImage(imRoughness);
+
+            if (!metallicShared) *metallic = StoreMaterialTexture(metallicKey, imMetallic);
+            else rl_UnloadImage(imMetallic);
         }
-        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", rl_TextFormat("%s/%s", texPath, cgltfImage->uri));
 
-        RL_FREE(data);
+        return;
     }
+#endif
 
-    return image;
+    imMetallicRoughness = LoadImageFromCgltfImage(cgltfImage, texPath);
+
+    if (imMetallicRoughness.data != NULL)
+    {
+        SplitMetallicRoughnessImageGLTF(imMetallicRoughness, &imRoughness, &imMetallic);
+
+        *roughness = LoadMaterialTexture(imRoughness);
+        *metallic = LoadMaterialTexture(imMetallic);
+
+        rl_UnloadImage(imRoughness);
+        rl_UnloadImage(imMetallic);
+        rl_UnloadImage(imMetallicRoughness);
+    }
 }
 
+
 // Load bone info from GLTF skin data
 static rl_BoneInfo *LoadBoneInfoGLTF(cgltf_skin skin, int *boneCount)
 {
@@ -5310,6 +13779,7 @@ static rl_Model LoadGLTF(const char *fileName)
             but the hierarchy is not kept (as it can't be represented)
           - rl_Mesh instances in the glTF file (i.e. same mesh linked from multiple nodes)
             are turned into separate raylib Meshes
+          - Supports sparse accessors and meshopt compressed buffers (EXT_meshopt_compression)
 
         RESTRICTIONS:
           - Only triangle meshes supported
@@ -5320,24 +13790,53 @@ static rl_Model LoadGLTF(const char *fileName)
               > Colors: vec4: u8, u16, f32 (normalized)
               > Indices: u16, u32 (truncated to u16)
           - Scenes defined in the glTF file are ignored. All nodes in the file are used
+          - Draco compressed primitives (KHR_draco_mesh_compression) are not supported
 
     ***********************************************************************************************/
 
-    // Macro to simplify attributes loading code
-    #define LOAD_ATTRIBUTE(accesor, numComp, srcType, dstPtr) LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, srcType)
+    // Macros to simplify attributes loading code
+    // NOTE: Tightly packed attributes already matching raylib data type are copied directly,
+    // strided or converted attributes are copied element by element, sparse values are applied on top
+    #define LOAD_ATTRIBUTE(accesor, numComp, srcType, dstPtr) \
+    { \
+        const unsigned char *source = GetAccessorDataGLTF(accesor); \
+        if ((source != NULL) && (accesor->stride == numComp*sizeof(srcType))) \
+        { \
+            memcpy(dstPtr, source, accesor->count*numComp*sizeof(srcType)); \
+            LOAD_ATTRIBUTE_SPARSE(accesor, numComp, srcType, dstPtr, srcType) \
+        } \
+        else LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, srcType) \
+    }
 
     #define LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, dstType) \
     { \
-        int n = 0; \
-        srcType *buffer = (srcType *)accesor->buffer_view->buffer->data + accesor->buffer_view->offset/sizeof(srcType) + accesor->offset/sizeof(srcType); \
+        const unsigned char *source = GetAccessorDataGLTF(accesor); \
         for (unsigned int k = 0; k < accesor->count; k++) \
         {\
+            const srcType *element = (source != NULL)? (const srcType *)(source + k*accesor->stride) : NULL; \
             for (int l = 0; l < numComp; l++) \
             {\
-                dstPtr[numComp*k + l] = (dstType)buffer[n + l];\
+                dstPtr[numComp*k + l] = (element != NULL)? (dstType)element[l] : (dstType)0;\
             }\
-            n += (int)(accesor->stride/sizeof(srcType));\
         }\
+        LOAD_ATTRIBUTE_SPARSE(accesor, numComp, srcType, dstPtr, dstType) \
+    }
+
+    #define LOAD_ATTRIBUTE_SPARSE(accesor, numComp, srcType, dstPtr, dstType) \
+    if (accesor->is_sparse) \
+    { \
+        const unsigned char *indices = cgltf_buffer_view_data(accesor->sparse.indices_buffer_view); \
+        const unsigned char *values = cgltf_buffer_view_data(accesor->sparse.values_buffer_view); \
+        if ((indices != NULL) && (values != NULL)) \
+        { \
+            const srcType *sparseValues = (const srcType *)(values + accesor->sparse.values_byte_offset); \
+            for (unsigned int k = 0; k < accesor->sparse.count; k++) \
+            {\
+                unsigned int index = GetSparseIndexGLTF(&accesor->sparse, indices + accesor->sparse.indices_byte_offset, k); \
+                if (index >= accesor->count) continue; \
+                for (int l = 0; l < numComp; l++) dstPtr[numComp*index + l] = (dstType)sparseValues[numComp*k + l]; \
+            }\
+        } \
     }
 
     rl_Model model = { 0 };
@@ -5372,6 +13871,9 @@ static rl_Model LoadGLTF(const char *fileName)
         result = cgltf_load_buffers(&options, data, fileName);
         if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load mesh/material buffers", fileName);
 
+        // Decode compressed buffer views (EXT_meshopt_compression), accessors read decoded data
+        DecodeMeshoptBuffersGLTF(data, fileName);
+
         int primitivesCount = 0;
 
         // NOTE: We will load every primitive in the glTF as a separate raylib rl_Mesh
@@ -5384,7 +13886,9 @@ static rl_Model LoadGLTF(const char *fileName)
 
             for (unsigned int p = 0; p < mesh->primitives_count; p++)
             {
-                if (mesh->primitives[p].type == cgltf_primitive_type_triangles) primitivesCount++;
+                // WARNING: KHR_draco_mesh_compression not supported, compressed primitives are skipped
+                if (mesh->primitives[p].has_draco_mesh_compression) TRACELOG(LOG_WARNING, "MODEL: [%s] Draco compressed primitives not supported", fileName);
+                else if (mesh->primitives[p].type == cgltf_primitive_type_triangles) primitivesCount++;
             }
         }
         TRACELOG(LOG_DEBUG, "    > Primitives (triangles only) count based on hierarchy : %i", primitivesCount);
@@ -5403,10 +13907,12 @@ static rl_Model LoadGLTF(const char *fileName)
 
         // Load materials data
         //----------------------------------------------------------------------------------------------------
+        char texPath[MAX_FILEPATH_LENGTH] = { 0 };
+        GetModelDirectoryPath(fileName, texPath);
+
         for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
         {
             model.materials[j] = rl_LoadMaterialDefault();
-            const char *texPath = rl_GetDirectoryPath(fileName);
 
             // Check glTF material flow: PBR metallic/roughness flow
             // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
@@ -5415,12 +13921,8 @@ static rl_Model LoadGLTF(const char *fileName)
                 // Load base color texture (albedo)
                 if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture)
                 {
-                    rl_Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
-                    if (imAlbedo.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = rl_LoadTextureFromImage(imAlbedo);
-                        rl_UnloadImage(imAlbedo);
-                    }
+                    rl_Texture2D texAlbedo = LoadMaterialTextureGLTF(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
+                    if (texAlbedo.width > 0) model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = texAlbedo;
                 }
                 // Load base color factor (tint)
                 model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
@@ -5431,39 +13933,11 @@ static rl_Model LoadGLTF(const char *fileName)
                 // Load metallic/roughness texture
                 if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
                 {
-                    rl_Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
-                    if (imMetallicRoughness.data != NULL)
-                    {
-                        rl_Image imMetallic = { 0 };
-                        rl_Image imRoughness = { 0 };
-
-                        imMetallic.data = RL_MALLOC(imMetallicRoughness.width*imMetallicRoughness.height);
-                        imRoughness.data = RL_MALLOC(imMetallicRoughness.width*imMetallicRoughness.height);
-
-                        imMetallic.width = imRoughness.width = imMetallicRoughness.width;
-                        imMetallic.height = imRoughness.height = imMetallicRoughness.height;
-
-                        imMetallic.format = imRoughness.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-                        imMetallic.mipmaps = imRoughness.mipmaps = 1;
-
-                        for (int x = 0; x < imRoughness.width; x++)
-                        {
-                            for (int y = 0; y < imRoughness.height; y++)
-                            {
-                                rl_Color color = rl_GetImageColor(imMetallicRoughness, x, y);
-
-                                ((unsigned char *)imRoughness.data)[y*imRoughness.width + x] = color.g; // Roughness color channel
-                                ((unsigned char *)imMetallic.data)[y*imMetallic.width + x] = color.b; // Metallic color channel
-                            }
-                        }
-
-                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = rl_LoadTextureFromImage(imRoughness);
-                        model.materials[j].maps[MATERIAL_MAP_METALNESS].texture = rl_LoadTextureFromImage(imMetallic);
-
-                        rl_UnloadImage(imRoughness);
-                        rl_UnloadImage(imMetallic);
-                        rl_UnloadImage(imMetallicRoughness);
-                    }
+                    rl_Texture2D texRoughness = { 0 };
+                    rl_Texture2D texMetallic = { 0 };
+                    LoadMetallicRoughnessTexturesGLTF(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath, &texRoughness, &texMetallic);
+                    if (texRoughness.width > 0) model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = texRoughness;
+                    if (texMetallic.width > 0) model.materials[j].maps[MATERIAL_MAP_METALNESS].texture = texMetallic;
 
                     // Load metallic/roughness material properties
                     float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
@@ -5476,34 +13950,22 @@ static rl_Model LoadGLTF(const char *fileName)
                 // Load normal texture
                 if (data->materials[i].normal_texture.texture)
                 {
-                    rl_Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
-                    if (imNormal.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = rl_LoadTextureFromImage(imNormal);
-                        rl_UnloadImage(imNormal);
-                    }
+                    rl_Texture2D texNormal = LoadMaterialTextureGLTF(data->materials[i].normal_texture.texture->image, texPath);
+                    if (texNormal.width > 0) model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = texNormal;
                 }
 
                 // Load ambient occlusion texture
                 if (data->materials[i].occlusion_texture.texture)
                 {
-                    rl_Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
-                    if (imOcclusion.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = rl_LoadTextureFromImage(imOcclusion);
-                        rl_UnloadImage(imOcclusion);
-                    }
+                    rl_Texture2D texOcclusion = LoadMaterialTextureGLTF(data->materials[i].occlusion_texture.texture->image, texPath);
+                    if (texOcclusion.width > 0) model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = texOcclusion;
                 }
 
                 // Load emissive texture
                 if (data->materials[i].emissive_texture.texture)
                 {
-                    rl_Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
-                    if (imEmissive.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = rl_LoadTextureFromImage(imEmissive);
-                        rl_UnloadImage(imEmissive);
-                    }
+                    rl_Texture2D texEmissive = LoadMaterialTextureGLTF(data->materials[i].emissive_texture.texture->image, texPath);
+                    if (texEmissive.width > 0) model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = texEmissive;
 
                     // Load emissive color factor
                     model.materials[j].maps[MATERIAL_MAP_EMISSION].color.r = (unsigned char)(data->materials[i].emissive_factor[0]*255);
@@ -5545,13 +14007,13 @@ static rl_Model LoadGLTF(const char *fileName)
                 worldTransform[3], worldTransform[7], worldTransform[11], worldTransform[15]
             };
 
-            rl_Matrix worldMatrixNormals = MatrixTranspose(MatrixInvert(worldMatrix));
+            rl_Matrix worldMatrixNormals = GetNormalMatrix(worldMatrix);
 
             for (unsigned int p = 0; p < mesh->primitives_count; p++)
             {
                 // NOTE: We only support primitives defined by triangles
                 // Other alternatives: points, lines, line_strip, triangle_strip
-                if (mesh->primitives[p].type != cgltf_primitive_type_triangles) continue;
+                if ((mesh->primitives[p].type != cgltf_primitive_type_triangles) || mesh->primitives[p].has_draco_mesh_compression) continue;
 
                 // NOTE: Attributes data could be provided in several data formats (8, 8u, 16u, 32...),
                 // Only some formats for each attribute type are supported, read info at the top of this function!
@@ -6049,7 +14511,7 @@ static rl_Model LoadGLTF(const char *fileName)
                 bool hasJoints = false;
 
                 // NOTE: We only support primitives defined by triangles
-                if (mesh->primitives[p].type != cgltf_primitive_type_triangles) continue;
+                if ((mesh->primitives[p].type != cgltf_primitive_type_triangles) || mesh->primitives[p].has_draco_mesh_compression) continue;
 
                 for (unsigned int j = 0; j < mesh->primitives[p].attributes_count; j++)
                 {
@@ -6379,6 +14841,7 @@ static rl_ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *ani
 
     result = cgltf_load_buffers(&options, data, fileName);
     if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load animation buffers", fileName);
+    else DecodeMeshoptBuffersGLTF(data, fileName);
 
     if (result == cgltf_result_success)
     {
@@ -6930,12 +15393,12 @@ static rl_Model LoadM3D(const char *fileName)
 
                             switch (prop->type)
                             {
-                                case m3dp_map_Kd: model.materials[i + 1].maps[rl_MATERIAL_MAP_DIFFUSE].texture = rl_LoadTextureFromImage(image); break;
-                                case m3dp_map_Ks: model.materials[i + 1].maps[rl_MATERIAL_MAP_SPECULAR].texture = rl_LoadTextureFromImage(image); break;
-                                case m3dp_map_Ke: model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].texture = rl_LoadTextureFromImage(image); break;
-                                case m3dp_map_Km: model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].texture = rl_LoadTextureFromImage(image); break;
-                                case m3dp_map_Ka: model.materials[i + 1].maps[MATERIAL_MAP_OCCLUSION].texture = rl_LoadTextureFromImage(image); break;
-                                case m3dp_map_Pm: model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].texture = rl_LoadTextureFromImage(image); break;
+                                case m3dp_map_Kd: model.materials[i + 1].maps[rl_MATERIAL_MAP_DIFFUSE].texture = LoadMaterialTexture(image); break;
+                                case m3dp_map_Ks: model.materials[i + 1].maps[rl_MATERIAL_MAP_SPECULAR].texture = LoadMaterialTexture(image); break;
+                                case m3dp_map_Ke: model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].texture = LoadMaterialTexture(image); break;
+                                case m3dp_map_Km: model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].texture = LoadMaterialTexture(image); break;
+                                case m3dp_map_Ka: model.materials[i + 1].maps[MATERIAL_MAP_OCCLUSION].texture = LoadMaterialTexture(image); break;
+                                case m3dp_map_Pm: model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadMaterialTexture(image); break;
                                 default: break;
                             }
                         }
@@ -7127,4 +15590,477 @@ static rl_ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *anim
 }
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+// Load file data mapped into memory (read-only), no copy is required
+// NOTE: Falls back to rl_LoadFileData() if memory mapping is not available
+static unsigned char *LoadFileDataMapped(const char *fileName, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+#if defined(SUPPORT_FILE_MAPPING)
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd != -1)
+    {
+        struct stat info = { 0 };
+
+        if ((fstat(fd, &info) == 0) && (info.st_size > 0) && (info.st_size <= INT_MAX))
+        {
+            void *mapped = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (mapped != MAP_FAILED)
+            {
+                data = (unsigned char *)mapped;
+                *dataSize = (int)info.st_size;
+            }
+        }
+
+        close(fd);
+    }
+
+    if (data != NULL) return data;
+#endif
+
+    data = rl_LoadFileData(fileName, dataSize);
+
+    return data;
+}
+
+// Unload file data mapped into memory
+static void UnloadFileDataMapped(unsigned char *data, int dataSize)
+{
+    if (data == NULL) return;
+
+#if defined(SUPPORT_FILE_MAPPING)
+    if (munmap(data, (size_t)dataSize) == 0) return;
+#endif
+
+    rl_UnloadFileData(data);
+}
+
+// Write data to model cache buffer, data is padded to 16 bytes alignment
+static void WriteModelCacheData(ModelCacheBuffer *buffer, const void *data, int size)
+{
+    int alignedSize = (size + 15) & ~15;
+
+    if ((buffer->size + alignedSize) > buffer->capacity)
+    {
+        int capacity = (buffer->capacity > 0)? buffer->capacity*2 : 4096;
+        while (capacity < (buffer->size + alignedSize)) capacity *= 2;
+
+        buffer->data = (unsigned char *)RL_REALLOC(buffer->data, capacity);
+        buffer->capacity = capacity;
+    }
+
+    if (size > 0) memcpy(buffer->data + buffer->size, data, size);
+    memset(buffer->data + buffer->size + size, 0, alignedSize - size);
+    buffer->size += alignedSize;
+}
+
+// Read count elements of size bytes from model cache file data, returns NULL if out of bounds
+// NOTE: Data size is checked against remaining file data before any int computation, counts are not trusted
+static const void *ReadModelCacheData(const unsigned char *fileData, int fileSize, int *offset, int count, int size)
+{
+    long long alignedSize = ((long long)count*size + 15) & ~15LL;
+
+    if ((count < 0) || (size < 0) || (alignedSize > ((long long)fileSize - *offset)))
+    {
+        // Following reads also fail, data after an invalid section is not trusted
+        *offset = INT_MAX;
+        return NULL;
+    }
+
+    const void *data = fileData + *offset;
+    *offset += (int)alignedSize;
+
+    return data;
+}
+
+// Read model cache array into a new allocated array
+static void *ReadModelCacheArray(const unsigned char *fileData, int fileSize, int *offset, int count, int size)
+{
+    const void *data = ReadModelCacheData(fileData, fileSize, offset, count, size);
+    void *result = NULL;
+
+    if ((data != NULL) && (count > 0) && (size > 0))
+    {
+        result = RL_MALLOC((size_t)count*size);
+        memcpy(result, data, (size_t)count*size);
+    }
+
+    return result;
+}
+
+// Load model cache header, returns false if not valid
+static bool LoadModelCacheHeader(const unsigned char *fileData, int fileSize, ModelCacheHeader *header)
+{
+    bool result = false;
+
+    if ((fileData != NULL) && (fileSize >= (int)sizeof(ModelCacheHeader)))
+    {
+        memcpy(header, fileData, sizeof(ModelCacheHeader));
+
+        // Counts are checked against file size, every element requires file data
+        result = (strncmp(header->id, "rMDL", 4) == 0) && (header->version == 1) &&
+            (header->meshCount >= 0) && (header->meshCount <= fileSize/(int)sizeof(ModelCacheMesh)) &&
+            (header->materialCount >= 0) && (header->materialCount <= fileSize/(int)sizeof(ModelCacheMaterial)) &&
+            (header->textureCount >= 0) && (header->textureCount <= fileSize/(int)sizeof(ModelCacheTexture)) &&
+            (header->boneCount >= 0) && (header->boneCount <= fileSize/(int)sizeof(rl_BoneInfo)) &&
+            (header->animCount >= 0) && (header->animCount <= fileSize/(int)sizeof(ModelCacheAnimation));
+    }
+
+    return result;
+}
+
+// Load model cache data (RMDL)
+// NOTE: File is memory mapped, meshes vertex data is copied as is (GPU-ready layout), no parsing is required
+static rl_Model LoadRMDL(const char *fileName)
+{
+    rl_Model model = { 0 };
+
+    int fileSize = 0;
+    unsigned char *fileData = LoadFileDataMapped(fileName, &fileSize);
+    ModelCacheHeader header = { 0 };
+
+    if (!LoadModelCacheHeader(fileData, fileSize, &header))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Model cache file not valid", fileName);
+        UnloadFileDataMapped(fileData, fileSize);
+        return model;
+    }
+
+    int offset = 0;
+    bool valid = (ReadModelCacheData(fileData, fileSize, &offset, 1, sizeof(ModelCacheHeader)) != NULL);
+
+    // Load meshes data
+    model.meshCount = header.meshCount;
+    model.meshes = (rl_Mesh *)RL_CALLOC(model.meshCount, sizeof(rl_Mesh));
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+    for (int i = 0; (i < model.meshCount) && valid; i++)
+    {
+        const ModelCacheMesh *cacheMesh = (const ModelCacheMesh *)ReadModelCacheData(fileData, fileSize, &offset, 1, sizeof(ModelCacheMesh));
+        if ((cacheMesh == NULL) || (cacheMesh->vertexCount < 0) || (cacheMesh->triangleCount < 0)) { valid = false; break; }
+
+        rl_Mesh *mesh = &model.meshes[i];
+        int vertexCount = cacheMesh->vertexCount;
+        unsigned int attributes = cacheMesh->attributes;
+
+        mesh->vertexCount = vertexCount;
+        mesh->triangleCount = cacheMesh->triangleCount;
+        model.meshMaterial[i] = cacheMesh->materialId;
+
+        if (attributes & MODEL_CACHE_VERTICES) mesh->vertices = (float *)ReadModelCacheArray(fileData, fileSize, &offset, vertexCount, 3*sizeof(float));
+        if (attributes & MODEL_CACHE_TEXCOORDS) mesh->texcoords = (float *)ReadModelCacheArray(fileData, fileSize, &offset, vertexCount, 2*sizeof(float));
+        if (attributes & MODEL_CACHE_TEXCOORDS2) mesh->texcoords2 = (float *)ReadModelCacheArray(fileData, fileSize, &offset, vertexCount, 2*sizeof(float));
+        if (attributes & MODEL_CACHE_NORMALS) mesh->normals = (float *)ReadModelCacheArray(fileData, fileSize, &offset, vertexCount, 3*sizeof(float));
+        if (attributes & MODEL_CACHE_TANGENTS) mesh->tangents = (float *)ReadModelCacheArray(fileData, fileSize, &offset, vertexCount, 4*sizeof(float));
+        if (attributes & MODEL_CACHE_COLORS) mesh->colors = (unsigned char *)ReadModelCacheArray(fileData, fileSize, &offset, vertexCount, 4*sizeof(unsigned char));
+        if (attributes & MODEL_CACHE_INDICES) mesh->indices = (unsigned short *)ReadModelCacheArray(fileData, fileSize, &offset, mesh->triangleCount, 3*sizeof(unsigned short));
+        if (attributes & MODEL_CACHE_BONEIDS) mesh->boneIds = (unsigned char *)ReadModelCacheArray(fileData, fileSize, &offset, vertexCount, 4*sizeof(unsigned char));
+        if (attributes & MODEL_CACHE_BONEWEIGHTS) mesh->boneWeights = (float *)ReadModelCacheArray(fileData, fileSize, &offset, vertexCount, 4*sizeof(float));
+
+        if (offset == INT_MAX) { valid = false; break; }
+        if ((vertexCount > 0) && (mesh->vertices == NULL)) { valid = false; break; }
+
+        // Check indices reference mesh vertices, non-indexed meshes require 3 vertices per triangle
+        if (mesh->indices != NULL)
+        {
+            for (int k = 0; (k < mesh->triangleCount*3) && valid; k++) if (mesh->indices[k] >= vertexCount) valid = false;
+        }
+        else if ((long long)mesh->triangleCount*3 > vertexCount) valid = false;
+
+        if (!valid) break;
+
+        // Load levels of detail, levels indices are appended to full detail indices
+        if ((cacheMesh->lodCount > 0) && (mesh->indices != NULL))
+        {
+            int levelCount = cacheMesh->lodCount;
+            if (levelCount > MAX_MESH_LOD_LEVELS) { valid = false; break; }
+
+            const int *triangleCounts = (const int *)ReadModelCacheData(fileData, fileSize, &offset, levelCount, sizeof(int));
+            const float *errors = (const float *)ReadModelCacheData(fileData, fileSize, &offset, levelCount, sizeof(float));
+            if ((triangleCounts == NULL) || (errors == NULL)) { valid = false; break; }
+
+            rl_MeshLOD *lod = (rl_MeshLOD *)RL_CALLOC(1, sizeof(rl_MeshLOD));
+            int lodIndexCount = 0;
+
+            for (int j = 0; (j < levelCount) && valid; j++)
+            {
+                // Levels indices count is limited by file size, it can not overflow
+                if ((triangleCounts[j] <= 0) || (triangleCounts[j] > mesh->triangleCount) ||
+                    (triangleCounts[j]*3 > (fileSize/(int)sizeof(unsigned short) - lodIndexCount))) { valid = false; break; }
+
+                lod->triangleCounts[j] = triangleCounts[j];
+                lod->indexOffsets[j] = mesh->triangleCount*3 + lodIndexCount;
+                lod->errors[j] = errors[j];
+                lodIndexCount += triangleCounts[j]*3;
+            }
+
+            const unsigned short *lodIndices = (const unsigned short *)(valid? ReadModelCacheData(fileData, fileSize, &offset, lodIndexCount, sizeof(unsigned short)) : NULL);
+
+            for (int k = 0; (lodIndices != NULL) && (k < lodIndexCount); k++)
+            {
+                if (lodIndices[k] >= vertexCount) { lodIndices = NULL; break; }
+            }
+
+            if (lodIndices == NULL) { RL_FREE(lod); valid = false; break; }
+
+            mesh->indices = (unsigned short *)RL_REALLOC(mesh->indices, ((size_t)mesh->triangleCount*3 + lodIndexCount)*sizeof(unsigned short));
+            memcpy(mesh->indices + mesh->triangleCount*3, lodIndices, lodIndexCount*sizeof(unsigned short));
+
+            rl_BoundingBox bounds = rl_GetMeshBoundingBox(*mesh);
+            lod->levelCount = levelCount;
+            lod->center = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+            lod->radius = Vector3Distance(bounds.min, bounds.max)*0.5f;
+            mesh->lod = lod;
+        }
+
+        // Init animation data, skinned vertices are computed from base vertices
+        if ((mesh->boneIds != NULL) && (mesh->boneWeights != NULL) && (cacheMesh->boneCount > 0))
+        {
+            // Mesh bones are model skeleton bones, bone ids must reference them
+            if (cacheMesh->boneCount > header.boneCount) { valid = false; break; }
+
+            for (int k = 0; (k < vertexCount*4) && valid; k++) if (mesh->boneIds[k] >= cacheMesh->boneCount) valid = false;
+            if (!valid) break;
+
+            mesh->boneCount = cacheMesh->boneCount;
+            mesh->animVertices = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+            memcpy(mesh->animVertices, mesh->vertices, vertexCount*3*sizeof(float));
+
+            if (mesh->normals != NULL)
+            {
+                mesh->animNormals = (float *)RL_MALLOC(vertexCount*3*sizeof(float));
+                memcpy(mesh->animNormals, mesh->normals, vertexCount*3*sizeof(float));
+            }
+
+            mesh->boneMatrices = (rl_Matrix *)RL_MALLOC(mesh->boneCount*sizeof(rl_Matrix));
+            for (int j = 0; j < mesh->boneCount; j++) mesh->boneMatrices[j] = MatrixIdentity();
+        }
+    }
+
+    // Load textures data, uploaded to GPU directly from file data (copied if loading asynchronously)
+    const ModelCacheMaterial *materials = (const ModelCacheMaterial *)(valid? ReadModelCacheData(fileData, fileSize, &offset, header.materialCount, sizeof(ModelCacheMaterial)) : NULL);
+    rl_Texture2D *textures = (rl_Texture2D *)RL_CALLOC(header.textureCount + 1, sizeof(rl_Texture2D));
+
+    if (materials == NULL) valid = false;
+
+    for (int i = 0; (i < header.textureCount) && valid; i++)
+    {
+        const ModelCacheTexture *cacheTexture = (const ModelCacheTexture *)ReadModelCacheData(fileData, fileSize, &offset, 1, sizeof(ModelCacheTexture));
+        if ((cacheTexture == NULL) || (cacheTexture->dataSize < 0)) { valid = false; break; }
+        if (cacheTexture->dataSize == 0) continue;
+
+        // Texture dimensions are checked against data size (at least 2 bits per pixel) before computing pixel data size
+        const void *pixels = ReadModelCacheData(fileData, fileSize, &offset, cacheTexture->dataSize, 1);
+        if ((pixels == NULL) || (cacheTexture->width <= 0) || (cacheTexture->height <= 0) ||
+            ((long long)cacheTexture->width*cacheTexture->height > (long long)cacheTexture->dataSize*4) ||
+            (cacheTexture->dataSize != rl_GetPixelDataSize(cacheTexture->width, cacheTexture->height, cacheTexture->format))) { valid = false; break; }
+
+        rl_Image image = { (void *)pixels, cacheTexture->width, cacheTexture->height, 1, cacheTexture->format };
+        textures[i] = LoadMaterialTexture(image);
+    }
+
+    // Load materials, default shader is used
+    if (valid)
+    {
+        model.materialCount = header.materialCount;
+        model.materials = (rl_Material *)RL_CALLOC(model.materialCount + 1, sizeof(rl_Material));
+
+        for (int i = 0; i < model.materialCount; i++)
+        {
+            model.materials[i] = rl_LoadMaterialDefault();
+            memcpy(model.materials[i].params, materials[i].params, 4*sizeof(float));
+
+            for (int m = 0; m < MAX_MATERIAL_MAPS; m++)
+            {
+                int textureId = materials[i].maps[m].textureId;
+
+                model.materials[i].maps[m].color = materials[i].maps[m].color;
+                model.materials[i].maps[m].value = materials[i].maps[m].value;
+                if ((textureId >= 0) && (textureId < header.textureCount) && (textures[textureId].width > 0)) model.materials[i].maps[m].texture = textures[textureId];
+            }
+        }
+
+        for (int i = 0; i < model.meshCount; i++)
+        {
+            if ((model.meshMaterial[i] < 0) || (model.meshMaterial[i] >= model.materialCount)) model.meshMaterial[i] = 0;
+        }
+    }
+
+    // Load skeleton data
+    if (valid && (header.boneCount > 0))
+    {
+        model.boneCount = header.boneCount;
+        model.bones = (rl_BoneInfo *)ReadModelCacheArray(fileData, fileSize, &offset, model.boneCount, sizeof(rl_BoneInfo));
+        model.bindPose = (rl_Transform *)ReadModelCacheArray(fileData, fileSize, &offset, model.boneCount, sizeof(rl_Transform));
+        model.bindInverse = (rl_Matrix *)ReadModelCacheArray(fileData, fileSize, &offset, model.boneCount, sizeof(rl_Matrix));
+
+        if ((model.bones == NULL) || (model.bindPose == NULL) || (model.bindInverse == NULL)) valid = false;
+
+        // Parent bones must be skeleton bones
+        for (int i = 0; valid && (i < model.boneCount); i++)
+        {
+            if ((model.bones[i].parent < -1) || (model.bones[i].parent >= model.boneCount)) valid = false;
+        }
+    }
+
+    // Unload uploaded textures not referenced by any material, all of them if data is not valid
+    // NOTE: Deferred textures (id 0) not referenced are released by async model loader once uploaded
+    for (int i = 0; i < header.textureCount; i++)
+    {
+        bool used = false;
+
+        for (int m = 0; valid && (m < model.materialCount) && !used; m++)
+        {
+            for (int k = 0; k < MAX_MATERIAL_MAPS; k++) if (model.materials[m].maps[k].texture.id == textures[i].id) used = true;
+        }
+
+        if (!used && (textures[i].id > 0)) rl_UnloadTexture(textures[i]);
+    }
+
+    RL_FREE(textures);
+    UnloadFileDataMapped(fileData, fileSize);
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Model cache file data corrupted", fileName);
+
+        // Materials textures are already unloaded, materials use default shader
+        for (int i = 0; i < model.meshCount; i++) rl_UnloadMesh(model.meshes[i]);
+        for (int i = 0; i < model.materialCount; i++) RL_FREE(model.materials[i].maps);
+        RL_FREE(model.meshes);
+        RL_FREE(model.materials);
+        RL_FREE(model.meshMaterial);
+        RL_FREE(model.bones);
+        RL_FREE(model.bindPose);
+        RL_FREE(model.bindInverse);
+
+        rl_Model empty = { 0 };
+        return empty;
+    }
+
+    return model;
+}
+
+// Load model animations from model cache data (RMDL)
+static rl_ModelAnimation *LoadModelAnimationsRMDL(const char *fileName, int *animCount)
+{
+    rl_ModelAnimation *animations = NULL;
+    *animCount = 0;
+
+    int fileSize = 0;
+    unsigned char *fileData = LoadFileDataMapped(fileName, &fileSize);
+    ModelCacheHeader header = { 0 };
+
+    if (!LoadModelCacheHeader(fileData, fileSize, &header))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Model cache file not valid", fileName);
+        UnloadFileDataMapped(fileData, fileSize);
+        return animations;
+    }
+
+    // Skip meshes, materials, textures and skeleton data
+    int offset = 0;
+    bool valid = (ReadModelCacheData(fileData, fileSize, &offset, 1, sizeof(ModelCacheHeader)) != NULL);
+
+    for (int i = 0; (i < header.meshCount) && valid; i++)
+    {
+        const ModelCacheMesh *cacheMesh = (const ModelCacheMesh *)ReadModelCacheData(fileData, fileSize, &offset, 1, sizeof(ModelCacheMesh));
+        if (cacheMesh == NULL) { valid = false; break; }
+
+        int counts[9] = { cacheMesh->vertexCount, cacheMesh->vertexCount, cacheMesh->vertexCount, cacheMesh->vertexCount, cacheMesh->vertexCount,
+            cacheMesh->vertexCount, cacheMesh->triangleCount, cacheMesh->vertexCount, cacheMesh->vertexCount };
+        int sizes[9] = { 3*4, 2*4, 2*4, 3*4, 4*4, 4, 3*2, 4, 4*4 };
+
+        for (int a = 0; (a < 9) && valid; a++)
+        {
+            if ((cacheMesh->attributes & (1u << a)) && (ReadModelCacheData(fileData, fileSize, &offset, counts[a], sizes[a]) == NULL)) valid = false;
+        }
+
+        // Skip levels of detail, stored only for indexed meshes
+        if (valid && (cacheMesh->lodCount > 0) && (cacheMesh->attributes & MODEL_CACHE_INDICES))
+        {
+            int levelCount = cacheMesh->lodCount;
+            const int *triangleCounts = (const int *)ReadModelCacheData(fileData, fileSize, &offset, levelCount, sizeof(int));
+            long long lodIndexCount = 0;
+
+            if ((levelCount > MAX_MESH_LOD_LEVELS) || (triangleCounts == NULL) ||
+                (ReadModelCacheData(fileData, fileSize, &offset, levelCount, sizeof(float)) == NULL)) { valid = false; break; }
+
+            for (int j = 0; j < levelCount; j++) lodIndexCount += (long long)triangleCounts[j]*3;
+
+            if ((lodIndexCount > fileSize) || (ReadModelCacheData(fileData, fileSize, &offset, (int)lodIndexCount, sizeof(unsigned short)) == NULL)) valid = false;
+        }
+    }
+
+    if (valid && (ReadModelCacheData(fileData, fileSize, &offset, header.materialCount, sizeof(ModelCacheMaterial)) == NULL)) valid = false;
+
+    for (int i = 0; (i < header.textureCount) && valid; i++)
+    {
+        const ModelCacheTexture *cacheTexture = (const ModelCacheTexture *)ReadModelCacheData(fileData, fileSize, &offset, 1, sizeof(ModelCacheTexture));
+        if ((cacheTexture == NULL) || ((cacheTexture->dataSize > 0) && (ReadModelCacheData(fileData, fileSize, &offset, cacheTexture->dataSize, 1) == NULL))) valid = false;
+    }
+
+    if (valid && (header.boneCount > 0))
+    {
+        if ((ReadModelCacheData(fileData, fileSize, &offset, header.boneCount, sizeof(rl_BoneInfo)) == NULL) ||
+            (ReadModelCacheData(fileData, fileSize, &offset, header.boneCount, sizeof(rl_Transform)) == NULL) ||
+            (ReadModelCacheData(fileData, fileSize, &offset, header.boneCount, sizeof(rl_Matrix)) == NULL)) valid = false;
+    }
+
+    // Load animations data
+    if (valid && (header.animCount > 0))
+    {
+        animations = (rl_ModelAnimation *)RL_CALLOC(header.animCount, sizeof(rl_ModelAnimation));
+
+        for (int i = 0; i < header.animCount; i++)
+        {
+            const ModelCacheAnimation *cacheAnim = (const ModelCacheAnimation *)ReadModelCacheData(fileData, fileSize, &offset, 1, sizeof(ModelCacheAnimation));
+            if ((cacheAnim == NULL) || (cacheAnim->boneCount <= 0) || (cacheAnim->frameCount <= 0)) { valid = false; break; }
+
+            // Frame poses count is checked against file size before computing it
+            const void *bones = ReadModelCacheData(fileData, fileSize, &offset, cacheAnim->boneCount, sizeof(rl_BoneInfo));
+            if ((bones == NULL) || ((long long)cacheAnim->frameCount*cacheAnim->boneCount > fileSize)) { valid = false; break; }
+
+            const rl_Transform *framePoses = (const rl_Transform *)ReadModelCacheData(fileData, fileSize, &offset, cacheAnim->frameCount*cacheAnim->boneCount, sizeof(rl_Transform));
+            if (framePoses == NULL) { valid = false; break; }
+
+            rl_ModelAnimation *anim = &animations[i];
+            anim->boneCount = cacheAnim->boneCount;
+            anim->frameCount = cacheAnim->frameCount;
+            memcpy(anim->name, cacheAnim->name, sizeof(anim->name));
+            anim->name[sizeof(anim->name) - 1] = '\0';
+
+            anim->bones = (rl_BoneInfo *)RL_MALLOC(anim->boneCount*sizeof(rl_BoneInfo));
+            memcpy(anim->bones, bones, anim->boneCount*sizeof(rl_BoneInfo));
+
+            anim->framePoses = (rl_Transform **)RL_MALLOC(anim->frameCount*sizeof(rl_Transform *));
+            for (int f = 0; f < anim->frameCount; f++)
+            {
+                anim->framePoses[f] = (rl_Transform *)RL_MALLOC(anim->boneCount*sizeof(rl_Transform));
+                memcpy(anim->framePoses[f], framePoses + f*anim->boneCount, anim->boneCount*sizeof(rl_Transform));
+            }
+
+            *animCount = i + 1;
+        }
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Model cache file data corrupted", fileName);
+
+        if (animations != NULL) rl_UnloadModelAnimations(animations, *animCount);
+        animations = NULL;
+        *animCount = 0;
+    }
+
+    UnloadFileDataMapped(fileData, fileSize);
+
+    return animations;
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RMODELS
@@ -0,0 +1,755 @@
+/**********************************************************************************************
+*
+*   rparticles - Particle systems simulated on GPU using compute shaders
+*
+*   DESCRIPTION:
+*       Particles are stored in shader storage buffers and simulated every frame by compute shaders
+*       in three passes: spawn (dead particles are re-initialized from emitter), update (alive
+*       particles are integrated and written to next alive list, expired ones returned to dead list)
+*       and compact (alive count is stored as indirect draw instances count). Particles are drawn
+*       with one instanced draw call, quads are expanded in vertex shader, no CPU-GPU sync required
+*
+*       When compute shaders are not available (OpenGL ES 2.0, OpenGL 3.3 or OpenGL 1.1), particles
+*       are simulated on CPU with the same passes and drawn with rl_BillboardBatch
+*
+*   CONFIGURATION:
+*       #define RPARTICLES_IMPLEMENTATION
+*           Generates the implementation of the library into the included file.
+*           If not defined, the library is in header only mode and can be included in other headers
+*           or source files without problems. But only ONE file should hold the implementation.
+*
+*   DEPENDENCIES:
+*       raylib.h    - rl_Camera, rl_Texture2D types and rl_BillboardBatch (CPU fallback drawing)
+*       rlgl.h      - Compute shaders, shader storage buffers and indirect drawing (GRAPHICS_API_OPENGL_43)
+*       raymath.h   - Camera matrices computation
+*
+*   USAGE:
+*       rl_ParticleSystem *particles = rl_LoadParticleSystem(1000000, emitter);   // Capacity and emitter
+*       rl_EmitParticles(particles, 500);               // Burst, spawned on next update
+*
+*       rl_UpdateParticleSystem(particles, rl_GetFrameTime());   // Spawn, update and compact passes
+*       rl_BeginMode3D(camera);
+*           rl_DrawParticleSystem(particles, camera, texture);
+*       rl_EndMode3D();
+*
+*       rl_UnloadParticleSystem(particles);
+*
+*   NOTE: Particles are not sorted by depth, additive blending (BLEND_ADDITIVE) is recommended.
+*   Particles buffers are bound to fixed RPARTICLES_BINDING_* indices while simulating and drawing
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2026 Ramon Santamaria (@raysan5)
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RPARTICLES_H
+#define RPARTICLES_H
+
+// Function specifiers in case library is build/used as a shared library (Windows)
+// NOTE: Microsoft specifiers to tell compiler that symbols are imported/exported from a .dll
+#if defined(_WIN32)
+    #if defined(BUILD_LIBTYPE_SHARED)
+        #define rl_RLAPI __declspec(dllexport)     // We are building raylib as a Win32 shared library (.dll)
+    #elif defined(USE_LIBTYPE_SHARED)
+        #define rl_RLAPI __declspec(dllimport)     // We are using raylib as a Win32 shared library (.dll)
+    #endif
+#endif
+
+// Function specifiers definition
+#ifndef rl_RLAPI
+    #define rl_RLAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// Shader storage buffer binding indices used by the particle systems
+#ifndef RPARTICLES_BINDING_PARTICLES
+    #define RPARTICLES_BINDING_PARTICLES           8
+#endif
+#ifndef RPARTICLES_BINDING_DEAD_LIST
+    #define RPARTICLES_BINDING_DEAD_LIST           9
+#endif
+#ifndef RPARTICLES_BINDING_ALIVE_LIST
+    #define RPARTICLES_BINDING_ALIVE_LIST         10
+#endif
+#ifndef RPARTICLES_BINDING_ALIVE_NEXT_LIST
+    #define RPARTICLES_BINDING_ALIVE_NEXT_LIST    11
+#endif
+#ifndef RPARTICLES_BINDING_COUNTERS
+    #define RPARTICLES_BINDING_COUNTERS           12
+#endif
+#ifndef RPARTICLES_BINDING_COMMAND
+    #define RPARTICLES_BINDING_COMMAND            13
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Particle emitter, particles spawn parameters and appearance over lifetime
+// NOTE: Size and color are interpolated by particle age, emitter changes affect alive particles appearance
+typedef struct rl_ParticleEmitter {
+    rl_Vector3 position;        // Emitter position (world space)
+    rl_Vector3 positionVariance; // Spawn position random offset (box half extents)
+    rl_Vector3 velocity;        // Spawn velocity
+    rl_Vector3 velocityVariance; // Spawn velocity random offset (per axis)
+    rl_Vector3 acceleration;    // Particles constant acceleration (i.e. gravity)
+    float emissionRate;         // Particles spawned per second
+    float lifetimeMin;          // Particle minimum lifetime (seconds)
+    float lifetimeMax;          // Particle maximum lifetime (seconds)
+    float sizeStart;            // Particle size at spawn
+    float sizeEnd;              // Particle size at end of lifetime
+    rl_Color colorStart;        // Particle color at spawn
+    rl_Color colorEnd;          // Particle color at end of lifetime
+} rl_ParticleEmitter;
+
+// Particle system, particles simulated on GPU or CPU (opaque)
+typedef struct rl_ParticleSystem rl_ParticleSystem;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+rl_RLAPI rl_ParticleSystem *rl_LoadParticleSystem(int maxParticles, rl_ParticleEmitter emitter); // Load particle system, GPU simulated if compute shaders available
+rl_RLAPI void rl_UnloadParticleSystem(rl_ParticleSystem *system);      // Unload particle system (RAM and VRAM)
+rl_RLAPI bool rl_IsParticleSystemGPU(const rl_ParticleSystem *system); // Check if particle system is simulated on GPU (compute shaders)
+rl_RLAPI void rl_SetParticleEmitter(rl_ParticleSystem *system, rl_ParticleEmitter emitter); // Set particle system emitter
+rl_RLAPI void rl_EmitParticles(rl_ParticleSystem *system, int count);  // Emit particles burst, spawned on next update
+rl_RLAPI void rl_UpdateParticleSystem(rl_ParticleSystem *system, float deltaTime); // Update particle system: spawn, update and compact passes
+rl_RLAPI void rl_DrawParticleSystem(rl_ParticleSystem *system, rl_Camera camera, rl_Texture2D texture); // Draw particle system alive particles (camera facing quads)
+rl_RLAPI int rl_GetParticleCount(const rl_ParticleSystem *system);     // Get alive particles count (GPU readback, stalls pipeline)
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RPARTICLES_H
+
+/***********************************************************************************
+*
+*   RPARTICLES IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RPARTICLES_IMPLEMENTATION)
+
+#include "rlgl.h"
+#include "raymath.h"
+
+#include <stdlib.h>         // Required for: RL_CALLOC(), RL_MALLOC(), RL_FREE()
+#include <string.h>         // Required for: memcpy()
+
+#ifndef RL_CALLOC
+    #define RL_CALLOC(n,sz)     calloc(n,sz)
+#endif
+#ifndef RL_MALLOC
+    #define RL_MALLOC(sz)       malloc(sz)
+#endif
+#ifndef RL_FREE
+    #define RL_FREE(p)          free(p)
+#endif
+#ifndef TRACELOG
+    #define TRACELOG(level, ...) rl_TraceLog(level, __VA_ARGS__)
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RPARTICLES_WORKGROUP_SIZE   256         // Compute shaders local size, particles per workgroup
+
+#define RPARTICLES_STR(x)           #x
+#define RPARTICLES_XSTR(x)          RPARTICLES_STR(x)
+
+// Compute shaders common code: particles layout, buffers and random generator (PCG hash)
+#define RPARTICLES_COMPUTE_HEADER \
+    "#version 430\n" \
+    "layout(local_size_x = " RPARTICLES_XSTR(RPARTICLES_WORKGROUP_SIZE) ") in;\n" \
+    "struct Particle { vec4 position; vec4 velocity; };\n" \
+    "layout(std430, binding = " RPARTICLES_XSTR(RPARTICLES_BINDING_PARTICLES) ") buffer ParticlesBuffer { Particle particles[]; };\n" \
+    "layout(std430, binding = " RPARTICLES_XSTR(RPARTICLES_BINDING_DEAD_LIST) ") buffer DeadBuffer { uint deadList[]; };\n" \
+    "layout(std430, binding = " RPARTICLES_XSTR(RPARTICLES_BINDING_ALIVE_LIST) ") buffer AliveBuffer { uint aliveList[]; };\n" \
+    "layout(std430, binding = " RPARTICLES_XSTR(RPARTICLES_BINDING_ALIVE_NEXT_LIST) ") buffer AliveNextBuffer { uint aliveNextList[]; };\n" \
+    "layout(std430, binding = " RPARTICLES_XSTR(RPARTICLES_BINDING_COUNTERS) ") buffer CountersBuffer { int deadCount; int aliveCount; int aliveNextCount; int reserved; };\n" \
+    "layout(std430, binding = " RPARTICLES_XSTR(RPARTICLES_BINDING_COMMAND) ") buffer CommandBuffer { uint command[4]; };\n" \
+    "float Random(inout uint state)\n" \
+    "{\n" \
+    "    state = state*747796405u + 2891336453u;\n" \
+    "    uint word = ((state >> ((state >> 28u) + 4u)) ^ state)*277803737u;\n" \
+    "    return float((word >> 22u) ^ word)/4294967295.0;\n" \
+    "}\n"
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Particle data, same layout on CPU and shader storage buffer (std430, 2 x vec4)
+typedef struct ParticleData {
+    rl_Vector3 position;        // Particle position (world space)
+    float age;                  // Particle age (seconds)
+    rl_Vector3 velocity;        // Particle velocity
+    float lifetime;             // Particle lifetime (seconds)
+} ParticleData;
+
+// Particle system (opaque struct declared in header)
+struct rl_ParticleSystem {
+    rl_ParticleEmitter emitter; // Particles emitter
+    int maxParticles;           // Maximum alive particles
+    float spawnAccumulator;     // Emission fractional particles carried to next update
+    int burstCount;             // Burst particles pending spawn
+    unsigned int seed;          // Random state (CPU), frame random seed (GPU)
+    bool gpu;                   // Particles simulated on GPU
+
+    // CPU simulation data
+    ParticleData *particles;    // Alive particles, compacted (CPU)
+    int particleCount;          // Alive particles count (CPU)
+    rl_BillboardInstance *instances; // Billboards instances for drawing (CPU)
+    rl_BillboardBatch *batch;   // Billboard batch for drawing (CPU)
+
+    // GPU simulation data
+    unsigned int particlesBuffer;   // Particles SSBO
+    unsigned int deadBuffer;        // Dead particles indices SSBO
+    unsigned int aliveBuffer;       // Alive particles indices SSBO (drawn)
+    unsigned int aliveNextBuffer;   // Alive particles indices SSBO (written by update pass)
+    unsigned int countersBuffer;    // Dead, alive and next alive counters SSBO
+    unsigned int commandBuffer;     // Indirect draw command SSBO (instances count written by compact pass)
+    unsigned int vaoId;             // Empty vertex array, quads corners from vertex index
+};
+
+// Particle shaders, shared by all particle systems simulated on GPU
+typedef struct ParticleShaders {
+    unsigned int spawnProgram;      // Spawn compute program
+    unsigned int updateProgram;     // Update compute program
+    unsigned int compactProgram;    // Compact compute program
+    unsigned int drawProgram;       // Draw program (vertex and fragment)
+
+    int locSpawnCount;              // Spawn uniform location: particles to spawn
+    int locSeed;                    // Spawn uniform location: random seed
+    int locPosition;                // Spawn uniform location: emitter position
+    int locPositionVariance;        // Spawn uniform location: emitter position variance
+    int locVelocity;                // Spawn uniform location: emitter velocity
+    int locVelocityVariance;        // Spawn uniform location: emitter velocity variance
+    int locLifetime;                // Spawn uniform location: lifetime range
+    int locDeltaTime;               // Update uniform location: frame time
+    int locAcceleration;            // Update uniform location: emitter acceleration
+    int locMvp;                     // Draw uniform location: model-view-projection matrix
+    int locViewRight;               // Draw uniform location: view right direction
+    int locViewUp;                  // Draw uniform location: view up direction
+    int locSize;                    // Draw uniform location: size range
+    int locColorStart;              // Draw uniform location: color at spawn
+    int locColorEnd;                // Draw uniform location: color at end of lifetime
+    int locTexture;                 // Draw uniform location: texture sampler
+
+    int users;                      // Number of particle systems using the shaders
+} ParticleShaders;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static ParticleShaders PARTICLES = { 0 };
+
+// Spawn pass, one invocation per particle to spawn
+// NOTE: Dead list is popped atomically, spawn stops when no dead particles are left
+static const char *particlesSpawnShaderCode = RPARTICLES_COMPUTE_HEADER
+"uniform int spawnCount;\n"
+"uniform uint seed;\n"
+"uniform vec3 emitterPosition;\n"
+"uniform vec3 positionVariance;\n"
+"uniform vec3 emitterVelocity;\n"
+"uniform vec3 velocityVariance;\n"
+"uniform vec2 lifetime;\n"
+"void main()\n"
+"{\n"
+"    uint index = gl_GlobalInvocationID.x;\n"
+"    if (index >= uint(spawnCount)) return;\n"
+"    int dead = atomicAdd(deadCount, -1);\n"
+"    if (dead <= 0) { atomicAdd(deadCount, 1); return; }\n"
+"    uint particle = deadList[dead - 1];\n"
+"    uint state = seed ^ (index*2654435769u);\n"
+"    vec3 offset = vec3(Random(state), Random(state), Random(state))*2.0 - 1.0;\n"
+"    vec3 velocity = vec3(Random(state), Random(state), Random(state))*2.0 - 1.0;\n"
+"    particles[particle].position = vec4(emitterPosition + offset*positionVariance, 0.0);\n"
+"    particles[particle].velocity = vec4(emitterVelocity + velocity*velocityVariance, mix(lifetime.x, lifetime.y, Random(state)));\n"
+"    aliveList[atomicAdd(aliveCount, 1)] = particle;\n"
+"}\n";
+
+// Update pass, one invocation per alive particle
+// NOTE: Surviving particles are compacted into next alive list, expired ones pushed to dead list
+static const char *particlesUpdateShaderCode = RPARTICLES_COMPUTE_HEADER
+"uniform float deltaTime;\n"
+"uniform vec3 acceleration;\n"
+"void main()\n"
+"{\n"
+"    uint index = gl_GlobalInvocationID.x;\n"
+"    if (index >= uint(aliveCount)) return;\n"
+"    uint particle = aliveList[index];\n"
+"    Particle p = particles[particle];\n"
+"    p.position.w += deltaTime;\n"
+"    if (p.position.w < p.velocity.w)\n"
+"    {\n"
+"        p.velocity.xyz += acceleration*deltaTime;\n"
+"        p.position.xyz += p.velocity.xyz*deltaTime;\n"
+"        particles[particle] = p;\n"
+"        aliveNextList[atomicAdd(aliveNextCount, 1)] = particle;\n"
+"    }\n"
+"    else deadList[atomicAdd(deadCount, 1)] = particle;\n"
+"}\n";
+
+// Compact pass, single invocation
+// NOTE: Next alive list becomes alive list (buffers swapped on CPU), alive count stored as draw instances
+static const char *particlesCompactShaderCode = RPARTICLES_COMPUTE_HEADER
+"void main()\n"
+"{\n"
+"    if (gl_GlobalInvocationID.x > 0u) return;\n"
+"    aliveCount = aliveNextCount;\n"
+"    aliveNextCount = 0;\n"
+"    command[1] = uint(aliveCount);\n"
+"}\n";
+
+// Draw vertex shader, 6 vertices per particle instance, quad corners from vertex index
+static const char *particlesDrawVsCode =
+"#version 430\n"
+"struct Particle { vec4 position; vec4 velocity; };\n"
+"layout(std430, binding = " RPARTICLES_XSTR(RPARTICLES_BINDING_PARTICLES) ") readonly buffer ParticlesBuffer { Particle particles[]; };\n"
+"layout(std430, binding = " RPARTICLES_XSTR(RPARTICLES_BINDING_ALIVE_LIST) ") readonly buffer AliveBuffer { uint aliveList[]; };\n"
+"uniform mat4 mvp;\n"
+"uniform vec3 viewRight;\n"
+"uniform vec3 viewUp;\n"
+"uniform vec2 size;\n"
+"uniform vec4 colorStart;\n"
+"uniform vec4 colorEnd;\n"
+"out vec2 fragTexCoord;\n"
+"out vec4 fragColor;\n"
+"const vec2 corners[6] = vec2[6](vec2(-0.5, -0.5), vec2(0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, -0.5), vec2(0.5, 0.5), vec2(-0.5, 0.5));\n"
+"void main()\n"
+"{\n"
+"    Particle p = particles[aliveList[gl_InstanceID]];\n"
+"    float t = clamp(p.position.w/p.velocity.w, 0.0, 1.0);\n"
+"    vec2 corner = corners[gl_VertexID];\n"
+"    fragTexCoord = vec2(corner.x + 0.5, 0.5 - corner.y);\n"
+"    fragColor = mix(colorStart, colorEnd, t);\n"
+"    gl_Position = mvp*vec4(p.position.xyz + (viewRight*corner.x + viewUp*corner.y)*mix(size.x, size.y, t), 1.0);\n"
+"}\n";
+
+// Draw fragment shader
+static const char *particlesDrawFsCode =
+"#version 430\n"
+"in vec2 fragTexCoord;\n"
+"in vec4 fragColor;\n"
+"out vec4 finalColor;\n"
+"uniform sampler2D texture0;\n"
+"void main()\n"
+"{\n"
+"    finalColor = texture(texture0, fragTexCoord)*fragColor;\n"
+"}\n";
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+static bool LoadParticleShaders(void);                      // Load particle shaders (compute and draw programs)
+static void UnloadParticleShaders(void);                    // Unload particle shaders
+static unsigned int LoadParticleComputeProgram(const char *code); // Load particle compute program from code
+static int GetParticleSpawnCount(rl_ParticleSystem *system, float deltaTime); // Get particles to spawn for update (emission and burst)
+static float GetParticleRandom(rl_ParticleSystem *system);  // Get random value [0.0f..1.0f] from particle system random state
+static void UpdateParticleSystemCPU(rl_ParticleSystem *system, int spawnCount, float deltaTime); // Update particle system on CPU (spawn, update, compact)
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Load particle system
+// NOTE: Particles are simulated on GPU if compute shaders are available (OpenGL 4.3), CPU otherwise
+rl_ParticleSystem *rl_LoadParticleSystem(int maxParticles, rl_ParticleEmitter emitter)
+{
+    if (maxParticles <= 0) return NULL;
+
+    rl_ParticleSystem *system = (rl_ParticleSystem *)RL_CALLOC(1, sizeof(rl_ParticleSystem));
+    system->emitter = emitter;
+    system->maxParticles = maxParticles;
+    system->seed = 0x9e3779b9u;
+
+    if ((rlGetVersion() == RL_OPENGL_43) && LoadParticleShaders())
+    {
+        // Dead list initially contains all particles
+        unsigned int *deadList = (unsigned int *)RL_MALLOC(maxParticles*sizeof(unsigned int));
+        for (int i = 0; i < maxParticles; i++) deadList[i] = (unsigned int)(maxParticles - 1 - i);
+
+        int counters[4] = { maxParticles, 0, 0, 0 };
+        unsigned int command[4] = { 6, 0, 0, 0 };
+
+        system->particlesBuffer = rlLoadShaderBuffer(maxParticles*sizeof(ParticleData), NULL, RL_DYNAMIC_COPY);
+        system->deadBuffer = rlLoadShaderBuffer(maxParticles*sizeof(unsigned int), deadList, RL_DYNAMIC_COPY);
+        system->aliveBuffer = rlLoadShaderBuffer(maxParticles*sizeof(unsigned int), NULL, RL_DYNAMIC_COPY);
+        system->aliveNextBuffer = rlLoadShaderBuffer(maxParticles*sizeof(unsigned int), NULL, RL_DYNAMIC_COPY);
+        system->countersBuffer = rlLoadShaderBuffer(sizeof(counters), counters, RL_DYNAMIC_COPY);
+        system->commandBuffer = rlLoadShaderBuffer(sizeof(command), command, RL_DYNAMIC_COPY);
+        system->vaoId = rlLoadVertexArray();
+
+        RL_FREE(deadList);
+
+        PARTICLES.users++;
+        system->gpu = true;
+
+        if ((system->particlesBuffer == 0) || (system->deadBuffer == 0) || (system->aliveBuffer == 0) ||
+            (system->aliveNextBuffer == 0) || (system->countersBuffer == 0) || (system->commandBuffer == 0))
+        {
+            TRACELOG(LOG_WARNING, "PARTICLES: Failed to load particles buffers");
+            rl_UnloadParticleSystem(system);
+            return NULL;
+        }
+
+        TRACELOG(LOG_INFO, "PARTICLES: Particle system loaded successfully (GPU | %i particles max)", maxParticles);
+    }
+    else
+    {
+        system->particles = (ParticleData *)RL_MALLOC(maxParticles*sizeof(ParticleData));
+        system->instances = (rl_BillboardInstance *)RL_MALLOC(maxParticles*sizeof(rl_BillboardInstance));
+        system->batch = rl_LoadBillboardBatch(maxParticles);
+
+        TRACELOG(LOG_INFO, "PARTICLES: Particle system loaded successfully (CPU | %i particles max)", maxParticles);
+    }
+
+    return system;
+}
+
+// Unload particle system
+void rl_UnloadParticleSystem(rl_ParticleSystem *system)
+{
+    if (system == NULL) return;
+
+    if (system->gpu)
+    {
+        if (system->particlesBuffer != 0) rlUnloadShaderBuffer(system->particlesBuffer);
+        if (system->deadBuffer != 0) rlUnloadShaderBuffer(system->deadBuffer);
+        if (system->aliveBuffer != 0) rlUnloadShaderBuffer(system->aliveBuffer);
+        if (system->aliveNextBuffer != 0) rlUnloadShaderBuffer(system->aliveNextBuffer);
+        if (system->countersBuffer != 0) rlUnloadShaderBuffer(system->countersBuffer);
+        if (system->commandBuffer != 0) rlUnloadShaderBuffer(system->commandBuffer);
+        rlUnloadVertexArray(system->vaoId);
+
+        // Unload shaders once no particle systems use them
+        PARTICLES.users--;
+        if (PARTICLES.users <= 0) UnloadParticleShaders();
+    }
+    else
+    {
+        rl_UnloadBillboardBatch(system->batch);
+        RL_FREE(system->particles);
+        RL_FREE(system->instances);
+    }
+
+    RL_FREE(system);
+}
+
+// Check if particle system is simulated on GPU
+bool rl_IsParticleSystemGPU(const rl_ParticleSystem *system)
+{
+    return ((system != NULL) && system->gpu);
+}
+
+// Set particle system emitter
+void rl_SetParticleEmitter(rl_ParticleSystem *system, rl_ParticleEmitter emitter)
+{
+    if (system != NULL) system->emitter = emitter;
+}
+
+// Emit particles burst, spawned on next update
+void rl_EmitParticles(rl_ParticleSystem *system, int count)
+{
+    if ((system != NULL) && (count > 0)) system->burstCount += count;
+}
+
+// Update particle system: spawn, update and compact passes
+void rl_UpdateParticleSystem(rl_ParticleSystem *system, float deltaTime)
+{
+    if ((system == NULL) || (deltaTime < 0.0f)) return;
+
+    int spawnCount = GetParticleSpawnCount(system, deltaTime);
+
+    if (!system->gpu)
+    {
+        UpdateParticleSystemCPU(system, spawnCount, deltaTime);
+        return;
+    }
+
+    rl_ParticleEmitter *emitter = &system->emitter;
+
+    rlBindShaderBuffer(system->particlesBuffer, RPARTICLES_BINDING_PARTICLES);
+    rlBindShaderBuffer(system->deadBuffer, RPARTICLES_BINDING_DEAD_LIST);
+    rlBindShaderBuffer(system->aliveBuffer, RPARTICLES_BINDING_ALIVE_LIST);
+    rlBindShaderBuffer(system->aliveNextBuffer, RPARTICLES_BINDING_ALIVE_NEXT_LIST);
+    rlBindShaderBuffer(system->countersBuffer, RPARTICLES_BINDING_COUNTERS);
+    rlBindShaderBuffer(system->commandBuffer, RPARTICLES_BINDING_COMMAND);
+
+    // Spawn pass, dead particles initialized from emitter
+    if (spawnCount > 0)
+    {
+        float lifetime[2] = { emitter->lifetimeMin, emitter->lifetimeMax };
+        system->seed = system->seed*1664525u + 1013904223u;
+
+        rlEnableShader(PARTICLES.spawnProgram);
+        rlSetUniform(PARTICLES.locSpawnCount, &spawnCount, RL_SHADER_UNIFORM_INT, 1);
+        rlSetUniform(PARTICLES.locSeed, &system->seed, RL_SHADER_UNIFORM_UINT, 1);
+        rlSetUniform(PARTICLES.locPosition, &emitter->position, RL_SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(PARTICLES.locPositionVariance, &emitter->positionVariance, RL_SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(PARTICLES.locVelocity, &emitter->velocity, RL_SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(PARTICLES.locVelocityVariance, &emitter->velocityVariance, RL_SHADER_UNIFORM_VEC3, 1);
+        rlSetUniform(PARTICLES.locLifetime, lifetime, RL_SHADER_UNIFORM_VEC2, 1);
+        rlComputeShaderDispatch((spawnCount + RPARTICLES_WORKGROUP_SIZE - 1)/RPARTICLES_WORKGROUP_SIZE, 1, 1);
+        rlComputeShaderBarrier();
+    }
+
+    // Update pass, alive count is only known by GPU so all particles capacity is dispatched
+    rlEnableShader(PARTICLES.updateProgram);
+    rlSetUniform(PARTICLES.locDeltaTime, &deltaTime, RL_SHADER_UNIFORM_FLOAT, 1);
+    rlSetUniform(PARTICLES.locAcceleration, &emitter->acceleration, RL_SHADER_UNIFORM_VEC3, 1);
+    rlComputeShaderDispatch((system->maxParticles + RPARTICLES_WORKGROUP_SIZE - 1)/RPARTICLES_WORKGROUP_SIZE, 1, 1);
+    rlComputeShaderBarrier();
+
+    // Compact pass, alive counters swapped and draw command updated
+    rlEnableShader(PARTICLES.compactProgram);
+    rlComputeShaderDispatch(1, 1, 1);
+    rlComputeShaderBarrier();
+    rlDisableShader();
+
+    unsigned int aliveBuffer = system->aliveBuffer;
+    system->aliveBuffer = system->aliveNextBuffer;
+    system->aliveNextBuffer = aliveBuffer;
+}
+
+// Draw particle system alive particles, camera facing quads sized and colored by particles age
+void rl_DrawParticleSystem(rl_ParticleSystem *system, rl_Camera camera, rl_Texture2D texture)
+{
+    if (system == NULL) return;
+
+    rl_ParticleEmitter *emitter = &system->emitter;
+    rl_Matrix matView = MatrixLookAt(camera.position, camera.target, camera.up);
+
+    if (!system->gpu)
+    {
+        if (system->batch == NULL) return;
+
+        // Billboards instances from particles age
+        for (int i = 0; i < system->particleCount; i++)
+        {
+            const ParticleData *particle = &system->particles[i];
+            rl_BillboardInstance *instance = &system->instances[i];
+            float t = (particle->lifetime > 0.0f)? Clamp(particle->age/particle->lifetime, 0.0f, 1.0f) : 1.0f;
+            float size = Lerp(emitter->sizeStart, emitter->sizeEnd, t);
+
+            instance->position = particle->position;
+            instance->rotation = 0.0f;
+            instance->size = (rl_Vector2){ size, size };
+            instance->color.r = (unsigned char)Lerp(emitter->colorStart.r, emitter->colorEnd.r, t);
+            instance->color.g = (unsigned char)Lerp(emitter->colorStart.g, emitter->colorEnd.g, t);
+            instance->color.b = (unsigned char)Lerp(emitter->colorStart.b, emitter->colorEnd.b, t);
+            instance->color.a = (unsigned char)Lerp(emitter->colorStart.a, emitter->colorEnd.a, t);
+        }
+
+        rl_Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+        rl_UpdateBillboardBatch(system->batch, system->instances, system->particleCount);
+        rl_DrawBillboardBatch(system->batch, camera, texture, source, false);
+        return;
+    }
+
+    // Flush immediate draws before drawing with external shader
+    rlDrawRenderBatchActive();
+
+    rl_Vector3 right = { matView.m0, matView.m4, matView.m8 };
+    rl_Vector3 up = { matView.m1, matView.m5, matView.m9 };
+    float size[2] = { emitter->sizeStart, emitter->sizeEnd };
+    float colorStart[4] = { emitter->colorStart.r/255.0f, emitter->colorStart.g/255.0f, emitter->colorStart.b/255.0f, emitter->colorStart.a/255.0f };
+    float colorEnd[4] = { emitter->colorEnd.r/255.0f, emitter->colorEnd.g/255.0f, emitter->colorEnd.b/255.0f, emitter->colorEnd.a/255.0f };
+    int textureSlot = 0;
+
+    rl_Matrix matModelViewProjection = MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection());
+
+    rlEnableShader(PARTICLES.drawProgram);
+    rlSetUniformMatrix(PARTICLES.locMvp, matModelViewProjection);
+    rlSetUniform(PARTICLES.locViewRight, &right, RL_SHADER_UNIFORM_VEC3, 1);
+    rlSetUniform(PARTICLES.locViewUp, &up, RL_SHADER_UNIFORM_VEC3, 1);
+    rlSetUniform(PARTICLES.locSize, size, RL_SHADER_UNIFORM_VEC2, 1);
+    rlSetUniform(PARTICLES.locColorStart, colorStart, RL_SHADER_UNIFORM_VEC4, 1);
+    rlSetUniform(PARTICLES.locColorEnd, colorEnd, RL_SHADER_UNIFORM_VEC4, 1);
+
+    rlActiveTextureSlot(0);
+    rlEnableTexture(texture.id);
+    rlSetUniform(PARTICLES.locTexture, &textureSlot, RL_SHADER_UNIFORM_INT, 1);
+
+    rlBindShaderBuffer(system->particlesBuffer, RPARTICLES_BINDING_PARTICLES);
+    rlBindShaderBuffer(system->aliveBuffer, RPARTICLES_BINDING_ALIVE_LIST);
+
+    rlEnableVertexArray(system->vaoId);
+    rlDrawVertexArrayIndirect(system->commandBuffer, 0, 1);
+    rlDisableVertexArray();
+
+    rlDisableTexture();
+    rlDisableShader();
+}
+
+// Get alive particles count
+// NOTE: GPU simulated particles count is read back from counters buffer, it stalls the pipeline
+int rl_GetParticleCount(const rl_ParticleSystem *system)
+{
+    if (system == NULL) return 0;
+    if (!system->gpu) return system->particleCount;
+
+    int counters[4] = { 0 };
+    rlReadShaderBuffer(system->countersBuffer, counters, sizeof(counters), 0);
+
+    return counters[1];
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Load particle shaders, shared by all GPU particle systems
+static bool LoadParticleShaders(void)
+{
+    if (PARTICLES.users > 0) return true;
+
+    PARTICLES.spawnProgram = LoadParticleComputeProgram(particlesSpawnShaderCode);
+    PARTICLES.updateProgram = LoadParticleComputeProgram(particlesUpdateShaderCode);
+    PARTICLES.compactProgram = LoadParticleComputeProgram(particlesCompactShaderCode);
+    PARTICLES.drawProgram = rlLoadShaderCode(particlesDrawVsCode, particlesDrawFsCode);
+
+    // NOTE: Failed draw program is replaced by default shader
+    if (PARTICLES.drawProgram == rlGetShaderIdDefault()) PARTICLES.drawProgram = 0;
+
+    if ((PARTICLES.spawnProgram == 0) || (PARTICLES.updateProgram == 0) || (PARTICLES.compactProgram == 0) || (PARTICLES.drawProgram == 0))
+    {
+        TRACELOG(LOG_WARNING, "PARTICLES: Failed to load particles shaders, using CPU simulation");
+        UnloadParticleShaders();
+        return false;
+    }
+
+    PARTICLES.locSpawnCount = rlGetLocationUniform(PARTICLES.spawnProgram, "spawnCount");
+    PARTICLES.locSeed = rlGetLocationUniform(PARTICLES.spawnProgram, "seed");
+    PARTICLES.locPosition = rlGetLocationUniform(PARTICLES.spawnProgram, "emitterPosition");
+    PARTICLES.locPositionVariance = rlGetLocationUniform(PARTICLES.spawnProgram, "positionVariance");
+    PARTICLES.locVelocity = rlGetLocationUniform(PARTICLES.spawnProgram, "emitterVelocity");
+    PARTICLES.locVelocityVariance = rlGetLocationUniform(PARTICLES.spawnProgram, "velocityVariance");
+    PARTICLES.locLifetime = rlGetLocationUniform(PARTICLES.spawnProgram, "lifetime");
+    PARTICLES.locDeltaTime = rlGetLocationUniform(PARTICLES.updateProgram, "deltaTime");
+    PARTICLES.locAcceleration = rlGetLocationUniform(PARTICLES.updateProgram, "acceleration");
+    PARTICLES.locMvp = rlGetLocationUniform(PARTICLES.drawProgram, "mvp");
+    PARTICLES.locViewRight = rlGetLocationUniform(PARTICLES.drawProgram, "viewRight");
+    PARTICLES.locViewUp = rlGetLocationUniform(PARTICLES.drawProgram, "viewUp");
+    PARTICLES.locSize = rlGetLocationUniform(PARTICLES.drawProgram, "size");
+    PARTICLES.locColorStart = rlGetLocationUniform(PARTICLES.drawProgram, "colorStart");
+    PARTICLES.locColorEnd = rlGetLocationUniform(PARTICLES.drawProgram, "colorEnd");
+    PARTICLES.locTexture = rlGetLocationUniform(PARTICLES.drawProgram, "texture0");
+
+    return true;
+}
+
+// Unload particle shaders
+static void UnloadParticleShaders(void)
+{
+    if (PARTICLES.spawnProgram != 0) rlUnloadShaderProgram(PARTICLES.spawnProgram);
+    if (PARTICLES.updateProgram != 0) rlUnloadShaderProgram(PARTICLES.updateProgram);
+    if (PARTICLES.compactProgram != 0) rlUnloadShaderProgram(PARTICLES.compactProgram);
+    if (PARTICLES.drawProgram != 0) rlUnloadShaderProgram(PARTICLES.drawProgram);
+
+    ParticleShaders empty = { 0 };
+    PARTICLES = empty;
+}
+
+// Load particle compute program from code
+static unsigned int LoadParticleComputeProgram(const char *code)
+{
+    unsigned int programId = 0;
+    unsigned int shaderId = rlCompileShader(code, RL_COMPUTE_SHADER);
+
+    if (shaderId != 0) programId = rlLoadComputeShaderProgram(shaderId);
+
+    return programId;
+}
+
+// Get particles to spawn for update, emission fractional particles are carried to next update
+static int GetParticleSpawnCount(rl_ParticleSystem *system, float deltaTime)
+{
+    system->spawnAccumulator += system->emitter.emissionRate*deltaTime;
+
+    int spawnCount = (int)system->spawnAccumulator;
+    system->spawnAccumulator -= (float)spawnCount;
+    spawnCount += system->burstCount;
+    system->burstCount = 0;
+
+    if (spawnCount > system->maxParticles) spawnCount = system->maxParticles;
+
+    return spawnCount;
+}
+
+// Get random value [0.0f..1.0f] from particle system random state (xorshift)
+static float GetParticleRandom(rl_ParticleSystem *system)
+{
+    system->seed ^= system->seed << 13;
+    system->seed ^= system->seed >> 17;
+    system->seed ^= system->seed << 5;
+
+    return (float)(system->seed >> 8)/16777215.0f;
+}
+
+// Update particle system on CPU, same passes as GPU simulation
+// NOTE: Alive particles are kept compacted in particles array, dead particles are the array tail
+static void UpdateParticleSystemCPU(rl_ParticleSystem *system, int spawnCount, float deltaTime)
+{
+    rl_ParticleEmitter *emitter = &system->emitter;
+
+    // Spawn pass
+    if (spawnCount > (system->maxParticles - system->particleCount)) spawnCount = system->maxParticles - system->particleCount;
+
+    for (int i = 0; i < spawnCount; i++)
+    {
+        ParticleData *particle = &system->particles[system->particleCount + i];
+        rl_Vector3 offset = { GetParticleRandom(system)*2.0f - 1.0f, GetParticleRandom(system)*2.0f - 1.0f, GetParticleRandom(system)*2.0f - 1.0f };
+        rl_Vector3 velocity = { GetParticleRandom(system)*2.0f - 1.0f, GetParticleRandom(system)*2.0f - 1.0f, GetParticleRandom(system)*2.0f - 1.0f };
+
+        particle->position = Vector3Add(emitter->position, Vector3Multiply(offset, emitter->positionVariance));
+        particle->age = 0.0f;
+        particle->velocity = Vector3Add(emitter->velocity, Vector3Multiply(velocity, emitter->velocityVariance));
+        particle->lifetime = Lerp(emitter->lifetimeMin, emitter->lifetimeMax, GetParticleRandom(system));
+    }
+
+    system->particleCount += spawnCount;
+
+    // Update and compact passes
+    int aliveCount = 0;
+
+    for (int i = 0; i < system->particleCount; i++)
+    {
+        ParticleData particle = system->particles[i];
+        particle.age += deltaTime;
+
+        if (particle.age < particle.lifetime)
+        {
+            particle.velocity = Vector3Add(particle.velocity, Vector3Scale(emitter->acceleration, deltaTime));
+            particle.position = Vector3Add(particle.position, Vector3Scale(particle.velocity, deltaTime));
+            system->particles[aliveCount] = particle;
+            aliveCount++;
+        }
+    }
+
+    system->particleCount = aliveCount;
+}
+
+#endif // RPARTICLES_IMPLEMENTATION
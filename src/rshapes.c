@@ -15,6 +15,14 @@
 *       white character of default font [rtext], this way, raylib text and shapes can be draw with
 *       a single draw call and it also allows users to configure it the same way with their own fonts
 *
+*       Circles, full rings and rounded rectangles can be drawn as one quad each between
+*       rl_BeginShapesSDFMode() and rl_EndShapesSDFMode(), coverage is evaluated by a distance field
+*       shader with antialiased edges (OpenGL 3.3 and ES2 only, triangles are used otherwise)
+*
+*       Lines, triangles, rectangles, polygons and circles are drawn with one pixel alpha fringes
+*       between rl_BeginShapesAAMode() and rl_EndShapesAAMode(), antialiased edges with no MSAA
+*       required, supported on all graphics APIs
+*
 *   CONFIGURATION:
 *       #define SUPPORT_MODULE_RSHAPES
 *           rshapes module is included in the build
@@ -53,11 +61,23 @@
 
 #if defined(SUPPORT_MODULE_RSHAPES)
 
+#define RL_MEMORY_MODULE MEMORY_MODULE_SHAPES    // Memory tracking allocations module
+#include "utils.h"      // Required for: TRACELOG()
 #include "rlgl.h"       // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2
+#include "raymath.h"    // Required for: MatrixMultiply()
 
 #include <math.h>       // Required for: sinf(), asinf(), cosf(), acosf(), sqrtf(), fabsf()
 #include <float.h>      // Required for: FLT_EPSILON
-#include <stdlib.h>     // Required for: RL_FREE
+#include <stdlib.h>     // Required for: RL_MALLOC(), RL_FREE
+#include <string.h>     // Required for: memmove(), memset(), memcpy()
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>  // Required for: SSE2 intrinsics [Used in collision batch queries]
+    #define RSHAPES_SSE2_ENABLED
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #include <arm_neon.h>   // Required for: NEON intrinsics [Used in collision batch queries]
+    #define RSHAPES_NEON_ENABLED
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -70,22 +90,274 @@
 #ifndef SPLINE_SEGMENT_DIVISIONS
     #define SPLINE_SEGMENT_DIVISIONS      24      // Spline segment divisions
 #endif
+#ifndef SPLINE_SEGMENT_DIVISIONS_MAX
+    #define SPLINE_SEGMENT_DIVISIONS_MAX 128      // Spline segment maximum divisions, divisions adapt to curve flatness
+#endif
+#ifndef LINE_STROKE_MITER_LIMIT
+    #define LINE_STROKE_MITER_LIMIT     4.0f      // Line strip stroke miter length limit relative to half thickness, bevel join used over it
+#endif
+#ifndef LINE_STROKE_BUFFER_SIZE
+    #define LINE_STROKE_BUFFER_SIZE      512      // Line strip stroke vertex drawn at once (must be even)
+#endif
+#if defined(SUPPORT_SPLINE_MITERS)
+    #define SPLINE_LINEAR_JOIN  LINE_JOIN_MITER
+#else
+    #define SPLINE_LINEAR_JOIN  LINE_JOIN_BEVEL
+#endif
+#if defined(SUPPORT_SPLINE_SEGMENT_CAPS)
+    #define SPLINE_LINEAR_CAP   LINE_CAP_ROUND
+#else
+    #define SPLINE_LINEAR_CAP   LINE_CAP_BUTT
+#endif
+#ifndef SPLINE_TESSELLATION_ERROR
+    #define SPLINE_TESSELLATION_ERROR  0.25f      // Spline maximum distance between tessellated and exact curve, in screen pixels
+#endif
+#define SHAPES_SDF_MARGIN               1.0f      // SDF shapes quads margin around shape, in local units, for edges antialiasing
+#define SHAPES_AA_MAX_POINTS             512      // Anti-aliased shapes maximum polygon points, larger polygons drawn with no fringes
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// SDF shapes shader, circles, rings and rounded rectangles coverage is evaluated per fragment
+// NOTE: Shape quads store corner position relative to shape center in texcoords and shape proportions
+// in normal (x: half width, y: half height, z: corner radius, negative for ring thickness), normal is
+// normalized by rlgl so sizes are recovered from texcoords, vertices with no shape are drawn as default shader
+// NOTE: Instanced shapes shader is also defined here, rectangles expanded from per-instance data
+#if defined(GRAPHICS_API_OPENGL_21)
+    #define SHAPES_SHADER_HEADER        "#version 120\n"
+    #define SHAPES_SHADER_HEADER_FS     SHAPES_SHADER_HEADER
+#elif defined(GRAPHICS_API_OPENGL_33)
+    #define SHAPES_SHADER_HEADER        "#version 330\n"
+    #define SHAPES_SHADER_HEADER_FS     SHAPES_SHADER_HEADER
+#elif defined(GRAPHICS_API_OPENGL_ES3)
+    #define SHAPES_SHADER_HEADER        "#version 300 es\nprecision highp float;\n"
+    #define SHAPES_SHADER_HEADER_FS     SHAPES_SHADER_HEADER
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    #define SHAPES_SHADER_HEADER        "#version 100\nprecision highp float;\n"
+    #define SHAPES_SHADER_HEADER_FS     "#version 100\n#extension GL_OES_standard_derivatives : enable\n" \
+                                        "#ifdef GL_FRAGMENT_PRECISION_HIGH\nprecision highp float;\n#else\nprecision mediump float;\n#endif\n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_21) || (defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3))
+    #define SHAPES_SHADER_ATTRIBUTE     "attribute"
+    #define SHAPES_SHADER_VARYING_OUT   "varying"
+    #define SHAPES_SHADER_VARYING_IN    "varying"
+    #define SHAPES_SHADER_OUTPUT        ""
+    #define SHAPES_SHADER_FRAGCOLOR     "gl_FragColor"
+    #define SHAPES_SHADER_TEXTURE       "texture2D"
+#else
+    #define SHAPES_SHADER_ATTRIBUTE     "in"
+    #define SHAPES_SHADER_VARYING_OUT   "out"
+    #define SHAPES_SHADER_VARYING_IN    "in"
+    #define SHAPES_SHADER_OUTPUT        "out vec4 finalColor;\n"
+    #define SHAPES_SHADER_FRAGCOLOR     "finalColor"
+    #define SHAPES_SHADER_TEXTURE       "texture"
+#endif
+
+#define SHAPES_SDF_MARGIN_STRING    "1.0"       // SHAPES_SDF_MARGIN as shader literal
+
+static const char *shapesSdfVertexShaderCode = SHAPES_SHADER_HEADER
+    SHAPES_SHADER_ATTRIBUTE " vec3 vertexPosition;\n"
+    SHAPES_SHADER_ATTRIBUTE " vec2 vertexTexCoord;\n"
+    SHAPES_SHADER_ATTRIBUTE " vec3 vertexNormal;\n"
+    SHAPES_SHADER_ATTRIBUTE " vec4 vertexColor;\n"
+    SHAPES_SHADER_VARYING_OUT " vec2 fragTexCoord;\n"
+    SHAPES_SHADER_VARYING_OUT " vec4 fragColor;\n"
+    SHAPES_SHADER_VARYING_OUT " vec3 fragShape;\n"
+    "uniform mat4 mvp;\n"
+    "void main()\n"
+    "{\n"
+    "    fragTexCoord = vertexTexCoord;\n"
+    "    fragColor = vertexColor;\n"
+    "    fragShape = vec3(0.0);\n"
+    "    if (vertexNormal.x > 0.0)\n"
+    "    {\n"
+    "        vec2 size = abs(vertexTexCoord) - " SHAPES_SDF_MARGIN_STRING ";\n"
+    "        fragShape = vec3(size, vertexNormal.z/vertexNormal.x*size.x);\n"
+    "    }\n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+    "}\n";
+
+static const char *shapesSdfFragmentShaderCode = SHAPES_SHADER_HEADER_FS
+    SHAPES_SHADER_VARYING_IN " vec2 fragTexCoord;\n"
+    SHAPES_SHADER_VARYING_IN " vec4 fragColor;\n"
+    SHAPES_SHADER_VARYING_IN " vec3 fragShape;\n"
+    SHAPES_SHADER_OUTPUT
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "void main()\n"
+    "{\n"
+    "    if (fragShape.x > 0.0)\n"
+    "    {\n"
+    "        float radius = (fragShape.z < 0.0)? min(fragShape.x, fragShape.y) : fragShape.z;\n"
+    "        vec2 q = abs(fragTexCoord) - fragShape.xy + radius;\n"
+    "        float dist = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - radius;\n"
+    "        if (fragShape.z < 0.0) dist = abs(dist - fragShape.z*0.5) + fragShape.z*0.5;\n"
+    "        float width = max(fwidth(dist), 0.0001);\n"
+    "        float alpha = clamp(0.5 - dist/width, 0.0, 1.0);\n"
+    "        " SHAPES_SHADER_FRAGCOLOR " = vec4(fragColor.rgb*colDiffuse.rgb, fragColor.a*colDiffuse.a*alpha);\n"
+    "    }\n"
+    "    else " SHAPES_SHADER_FRAGCOLOR " = " SHAPES_SHADER_TEXTURE "(texture0, fragTexCoord)*colDiffuse*fragColor;\n"
+    "}\n";
+
+// Instanced shapes shader, unit quad corner scaled by instance size and moved to instance position
+static const char *shapesInstancedVertexShaderCode = SHAPES_SHADER_HEADER
+    SHAPES_SHADER_ATTRIBUTE " vec2 vertexPosition;\n"
+    SHAPES_SHADER_ATTRIBUTE " vec2 instancePosition;\n"
+    SHAPES_SHADER_ATTRIBUTE " vec2 instanceSize;\n"
+    SHAPES_SHADER_ATTRIBUTE " vec4 instanceColor;\n"
+    SHAPES_SHADER_VARYING_OUT " vec4 fragColor;\n"
+    "uniform mat4 mvp;\n"
+    "void main()\n"
+    "{\n"
+    "    fragColor = instanceColor;\n"
+    "    gl_Position = mvp*vec4(instancePosition + vertexPosition*instanceSize, 0.0, 1.0);\n"
+    "}\n";
+
+static const char *shapesInstancedFragmentShaderCode = SHAPES_SHADER_HEADER_FS
+    SHAPES_SHADER_VARYING_IN " vec4 fragColor;\n"
+    SHAPES_SHADER_OUTPUT
+    "void main()\n"
+    "{\n"
+    "    " SHAPES_SHADER_FRAGCOLOR " = fragColor;\n"
+    "}\n";
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// Not here...
+// Unit circle points generator, points are advanced by incremental rotation
+// NOTE: Only start and step angles sine and cosine are evaluated, rotation is accumulated in double precision
+typedef struct CircleRotation {
+    double x, y;                // Current unit circle point
+    double cosStep, sinStep;    // Rotation between consecutive points
+} CircleRotation;
+
+// Line strip stroke triangle strip buffer, vertex are counted only if no buffer provided
+typedef struct StrokeBuffer {
+    rl_Vector2 *vertices;       // Strip vertices
+    int count;                  // Strip vertices added
+    int capacity;               // Strip vertices capacity
+    bool draw;                  // Draw strip when buffer is full
+    rl_Color color;             // Strip drawing color
+} StrokeBuffer;
+
+// Path flattened contours, polylines with curves tessellated
+typedef struct PathContours {
+    rl_Vector2 *points;         // Contours points
+    int pointCount;             // Contours points count
+    int pointCapacity;          // Contours points capacity
+    int *counts;                // Contour points count per contour
+    bool *closed;               // Contour closed flag per contour
+    int contourCount;           // Contours count
+    int contourCapacity;        // Contours capacity
+} PathContours;
+
+// Path fill edge, non horizontal contour edge from top (y0) to bottom (y1)
+typedef struct PathEdge {
+    float x0;                   // Top point x
+    float y0;                   // Top point y
+    float x1;                   // Bottom point x
+    float y1;                   // Bottom point y
+    int winding;                // Edge winding direction, +1 downwards and -1 upwards
+    int vertex;                 // Last fill vertex index on edge, -1 if none
+    float vertexY;              // Last fill vertex y on edge
+    float order;                // Edge order in scanline band, middle x
+} PathEdge;
+
+// Polygon triangulation vertex node, contours are circular linked lists
+typedef struct PolygonNode {
+    int index;                  // Polygon vertex index
+    float x;                    // Vertex position x
+    float y;                    // Vertex position y
+    struct PolygonNode *prev;   // Previous contour node
+    struct PolygonNode *next;   // Next contour node
+} PolygonNode;
+
+// Polygon triangulation nodes pool and generated triangles
+typedef struct PolygonTriangulator {
+    PolygonNode *nodes;         // Nodes pool, contours vertex and bridges/splits duplicated vertex
+    int nodeCount;              // Nodes used
+    int nodeCapacity;           // Nodes pool capacity
+    unsigned short *indices;    // Triangles vertex indices
+    int triangleCount;          // Triangles generated
+} PolygonTriangulator;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-static rl_Texture2D texShapes = { 1, 1, 1, 1, 7 };                // rl_Texture used on shapes drawing (white pixel loaded by rlgl)
-static rl_Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // rl_Texture source rectangle used on shapes drawing
+static RL_CONTEXT_LOCAL rl_Texture2D texShapes = { 1, 1, 1, 1, 7 };                // rl_Texture used on shapes drawing (white pixel loaded by rlgl)
+static RL_CONTEXT_LOCAL rl_Rectangle texShapesRec = { 0.0f, 0.0f, 1.0f, 1.0f };    // rl_Texture source rectangle used on shapes drawing
+
+// SDF shapes mode, shader loaded on first use
+static struct {
+    bool loaded;                    // Shader load attempted
+    bool ready;                     // Shader available
+    bool active;                    // SDF shapes mode enabled, shapes are drawn as quads
+    rl_Shader shader;               // SDF shapes shader
+} shapesSdf = { 0 };
+
+static RL_CONTEXT_LOCAL bool shapesAAActive = false;     // Anti-aliased shapes mode enabled, shapes edges drawn with alpha fringes
+
+// Instanced shapes drawing, shader and buffers loaded on first use, instances buffers grow as required
+static struct {
+    bool loaded;                    // Shader and buffers load attempted
+    unsigned int shaderId;          // Shader program id
+    int mvpLoc;                     // Location: model-view-projection matrix
+    int cornerLoc;                  // Location attribute: quad corner
+    int positionLoc;                // Location attribute: instance position
+    int sizeLoc;                    // Location attribute: instance size
+    int colorLoc;                   // Location attribute: instance color
+    unsigned int vaoId;             // Quad vertex array id
+    unsigned int vboId;             // Quad corners buffer id
+    unsigned int eboId;             // Quad indices buffer id
+    unsigned int instancesVboId;    // Instances rectangles or positions buffer id
+    unsigned int colorsVboId;       // Instances colors buffer id
+    int capacity;                   // Instances buffers capacity
+} shapesInstancing = { 0 };
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
 static float EaseCubicInOut(float t, float b, float c, float d);    // Cubic easing
+static float GetCircleSmoothSegments(float radius);                 // Get segments for a smooth full circle
+static CircleRotation InitCircleRotation(float startAngle, float stepLength); // Init unit circle points generator
+static rl_Vector2 NextCirclePoint(CircleRotation *rotation);        // Get unit circle point and rotate to next one
+static bool DrawShapeSDFQuad(rl_Vector2 center, float halfWidth, float halfHeight, float shape, rl_Color color); // Draw SDF shape quad, if SDF shapes mode enabled
+static bool DrawShapeAAPolygon(const rl_Vector2 *points, int pointCount, rl_Color color); // Draw convex polygon with alpha fringes, if anti-aliased shapes mode enabled
+static float GetSplineDrawScale(void);                              // Get current drawing scale, screen pixels per drawing unit
+static int GetSplineSegmentCount(int type, int pointCount);         // Get spline segments count for points count
+static void GetSplineSegmentBezier(int type, const rl_Vector2 *points, rl_Vector2 *bezier); // Get spline segment as cubic Bezier control points
+static int GetSplineSegmentDivisions(const rl_Vector2 *bezier, float scale); // Get cubic Bezier segment divisions for tessellation error
+static int GenSplineSegmentStrip(const rl_Vector2 *bezier, int divisions, float thick, rl_Vector2 *strip); // Generate cubic Bezier segment triangle strip
+static void DrawSplineSegmentBezier(const rl_Vector2 *bezier, float thick, rl_Color color); // Draw cubic Bezier segment, tessellated for current drawing scale
+static void AddStrokeVertex(StrokeBuffer *buffer, rl_Vector2 vertex); // Add stroke triangle strip vertex
+static void AddStrokePair(StrokeBuffer *buffer, rl_Vector2 inner, rl_Vector2 outer, float outerSide); // Add stroke vertex pair, ordered by strip side
+static void AddStrokeCap(StrokeBuffer *buffer, rl_Vector2 point, rl_Vector2 direction, float halfThick, int cap, bool begin); // Add stroke cap
+static void AddStrokeJoin(StrokeBuffer *buffer, rl_Vector2 point, rl_Vector2 d0, float length0, rl_Vector2 d1, float length1, float halfThick, int join); // Add stroke join
+static void GenLineStripStroke(const rl_Vector2 *points, int pointCount, float thick, int join, int cap, StrokeBuffer *buffer); // Generate line strip stroke triangle strip
+static bool DrawShapesInstanced(const void *instances, int stride, const rl_Color *colors, int count); // Draw rectangles or pixels instances, if instancing available
+static float GetPolygonArea(const PolygonNode *p, const PolygonNode *q, const PolygonNode *r); // Get polygon triangle signed area (doubled)
+static bool CheckPolygonPointTriangle(float ax, float ay, float bx, float by, float cx, float cy, float px, float py); // Check if point is inside triangle
+static bool CheckPolygonOnSegment(const PolygonNode *p, const PolygonNode *q, const PolygonNode *r); // Check if collinear point lies on segment
+static bool CheckPolygonSegments(const PolygonNode *p1, const PolygonNode *q1, const PolygonNode *p2, const PolygonNode *q2); // Check if segments intersect
+static bool CheckPolygonLocallyInside(const PolygonNode *a, const PolygonNode *b); // Check if diagonal is locally inside polygon
+static bool CheckPolygonDiagonal(const PolygonNode *a, const PolygonNode *b); // Check if diagonal is a valid triangulation diagonal
+static bool CheckPolygonEar(const PolygonNode *ear);                // Check if contour node is an ear
+static PolygonNode *LinkPolygonContour(PolygonTriangulator *tri, const rl_Vector2 *points, int start, int count, bool outer); // Link polygon contour nodes, outer and holes contours opposite winding
+static PolygonNode *FilterPolygonNodes(PolygonNode *start, PolygonNode *end); // Remove duplicated and collinear contour nodes
+static PolygonNode *SplitPolygonNodes(PolygonTriangulator *tri, PolygonNode *a, PolygonNode *b); // Split contour in two by diagonal a-b, NULL if no nodes available
+static PolygonNode *BridgePolygonHole(PolygonTriangulator *tri, PolygonNode *hole, PolygonNode *outer); // Connect hole to outer contour with a bridge
+static void ClipPolygonEars(PolygonTriangulator *tri, PolygonNode *ear, int pass); // Triangulate contour by ear clipping
+static int AddCollisionIndices(int *indices, int count, int base, int mask); // Add collision indices for 4 elements mask, returns collisions count
+static void AddPathData(rl_Path *path, int command, const rl_Vector2 *points, int pointCount); // Add path command and points
+static void AddPathContourPoint(PathContours *contours, rl_Vector2 point, bool begin); // Add path contour point, begin new contour if required
+static PathContours GenPathContours(rl_Path path, float scale);    // Generate path contours, curves tessellated for drawing scale
+static void UnloadPathContours(PathContours contours);              // Unload path contours data
+static int ComparePathFloat(const void *a, const void *b);          // Compare floats, used for sorting
+static int ComparePathEdge(const void *a, const void *b);           // Compare path edges pointers by order, used for sorting
+static int GetPathEdgeVertex(PathEdge *edge, float y, rl_Polygon *polygon, int *vertexCapacity); // Get path fill vertex on edge at y, vertex shared between bands
+static void GenPathStroke(const PathContours *contours, float thick, int join, int cap, StrokeBuffer *buffer); // Generate path contours stroke triangle strip
+#if defined(RSHAPES_NEON_ENABLED)
+static int GetCollisionMaskNeon(uint32x4_t cmp);                    // Get 4 elements mask from NEON comparison
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -122,6 +394,93 @@ rl_Rectangle rl_GetShapesTextureRectangle(void)
     return texShapesRec;
 }
 
+// Begin SDF shapes mode, circles, full rings and rounded rectangles are drawn as one quad each
+// NOTE: Any other 2d drawing can be batched within the mode, custom shaders and 3d drawing are not supported
+void rl_BeginShapesSDFMode(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!shapesSdf.loaded)
+    {
+        shapesSdf.loaded = true;
+        shapesSdf.shader = rl_LoadShaderFromMemory(shapesSdfVertexShaderCode, shapesSdfFragmentShaderCode);
+        shapesSdf.ready = (shapesSdf.shader.id > 0) && (shapesSdf.shader.id != rlGetShaderIdDefault());
+
+        if (!shapesSdf.ready) TRACELOG(LOG_WARNING, "SHAPES: Failed to load SDF shapes shader, shapes drawn with triangles");
+    }
+
+    if (shapesSdf.ready && !shapesSdf.active)
+    {
+        rl_BeginShaderMode(shapesSdf.shader);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+        shapesSdf.active = true;
+    }
+#else
+    if (!shapesSdf.loaded) TRACELOG(LOG_WARNING, "SHAPES: SDF shapes mode not supported, shapes drawn with triangles");
+    shapesSdf.loaded = true;
+#endif
+}
+
+// End SDF shapes mode
+void rl_EndShapesSDFMode(void)
+{
+    if (shapesSdf.active)
+    {
+        rl_EndShaderMode();
+        shapesSdf.active = false;
+    }
+}
+
+// Begin anti-aliased shapes mode, shapes edges are drawn with one pixel alpha fringes
+// NOTE: Fringe width is evaluated for current drawing scale, MSAA is not required
+void rl_BeginShapesAAMode(void)
+{
+    shapesAAActive = true;
+}
+
+// End anti-aliased shapes mode
+void rl_EndShapesAAMode(void)
+{
+    shapesAAActive = false;
+}
+
+// Unload SDF shapes shader and instanced shapes shader and buffers
+// NOTE: Called by rl_CloseWindow(), shaders are loaded again on next use
+extern void UnloadShapesShaders(void)
+{
+    if (shapesSdf.ready) rl_UnloadShader(shapesSdf.shader);
+
+    shapesSdf.loaded = false;
+    shapesSdf.ready = false;
+    shapesSdf.active = false;
+    shapesSdf.shader = (rl_Shader){ 0 };
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (shapesInstancing.shaderId > 0)
+    {
+        rlUnloadShaderProgram(shapesInstancing.shaderId);
+        rlUnloadVertexArray(shapesInstancing.vaoId);
+        rlUnloadVertexBuffer(shapesInstancing.vboId);
+        rlUnloadVertexBuffer(shapesInstancing.eboId);
+        rlUnloadVertexBuffer(shapesInstancing.instancesVboId);
+        rlUnloadVertexBuffer(shapesInstancing.colorsVboId);
+    }
+#endif
+
+    memset(&shapesInstancing, 0, sizeof(shapesInstancing));
+}
+
+// Draw multiple pixels, one color per pixel
+// NOTE: Pixels are drawn with instancing in one draw call, 12 bytes per pixel uploaded
+void rl_DrawPixels(const rl_Vector2 *positions, const rl_Color *colors, int count)
+{
+    if ((positions == NULL) || (colors == NULL) || (count <= 0)) return;
+
+    if (!DrawShapesInstanced(positions, sizeof(rl_Vector2), colors, count))
+    {
+        for (int i = 0; i < count; i++) rl_DrawPixelV(positions[i], colors[i]);
+    }
+}
+
 // Draw a pixel
 void rl_DrawPixel(int posX, int posY, rl_Color color)
 {
@@ -175,6 +534,12 @@ void rl_DrawPixelV(rl_Vector2 position, rl_Color color)
 // Draw a line (using gl lines)
 void rl_DrawLine(int startPosX, int startPosY, int endPosX, int endPosY, rl_Color color)
 {
+    if (shapesAAActive)
+    {
+        rl_DrawLineV((rl_Vector2){ (float)startPosX, (float)startPosY }, (rl_Vector2){ (float)endPosX, (float)endPosY }, color);
+        return;
+    }
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
         rlVertex2f((float)startPosX, (float)startPosY);
@@ -200,13 +565,26 @@ void rl_DrawLineEx(rl_Vector2 startPos, rl_Vector2 endPos, float thick, rl_Color
             { endPos.x + radius.x, endPos.y + radius.y }
         };
 
+        if (shapesAAActive)
+        {
+            rl_Vector2 quad[4] = { strip[0], strip[1], strip[3], strip[2] };
+            if (DrawShapeAAPolygon(quad, 4, color)) return;
+        }
+
         rl_DrawTriangleStrip(strip, 4, color);
     }
 }
 
 // Draw a line (using gl lines)
+// NOTE: Anti-aliased shapes mode draws line as one pixel thick quad
 void rl_DrawLineV(rl_Vector2 startPos, rl_Vector2 endPos, rl_Color color)
 {
+    if (shapesAAActive)
+    {
+        rl_DrawLineEx(startPos, endPos, 1.0f/GetSplineDrawScale(), color);
+        return;
+    }
+
     rlBegin(RL_LINES);
         rlColor4ub(color.r, color.g, color.b, color.a);
         rlVertex2f(startPos.x, startPos.y);
@@ -230,6 +608,20 @@ void rl_DrawLineStrip(const rl_Vector2 *points, int pointCount, rl_Color color)
     rlEnd();
 }
 
+// Draw lines sequence with thickness, stroked as a single triangle strip with joins and caps
+// NOTE: Strip is drawn in parts, no memory allocation required for any number of points
+void rl_DrawLineStripEx(const rl_Vector2 *points, int pointCount, float thick, int join, int cap, rl_Color color)
+{
+    if ((points == NULL) || (pointCount < 2) || (thick <= 0.0f)) return;
+
+    rl_Vector2 vertices[LINE_STROKE_BUFFER_SIZE] = { 0 };
+    StrokeBuffer buffer = { vertices, 0, LINE_STROKE_BUFFER_SIZE, true, color };
+
+    GenLineStripStroke(points, pointCount, thick, join, cap, &buffer);
+
+    if (buffer.count > 0) rl_DrawTriangleStrip(buffer.vertices, buffer.count, color);
+}
+
 // Draw line using cubic-bezier spline, in-out interpolation, no control points
 void rl_DrawLineBezier(rl_Vector2 startPos, rl_Vector2 endPos, float thick, rl_Color color)
 {
@@ -324,6 +716,8 @@ void rl_DrawCircle(int centerX, int centerY, float radius, rl_Color color)
 // NOTE: On OpenGL 3.3 and ES2 we use QUADS to avoid drawing order issues
 void rl_DrawCircleV(rl_Vector2 center, float radius, rl_Color color)
 {
+    if ((radius > 0.0f) && DrawShapeSDFQuad(center, radius, radius, radius, color)) return;
+
     rl_DrawCircleSector(center, radius, 0, 360, 36, color);
 }
 
@@ -347,14 +741,40 @@ void rl_DrawCircleSector(rl_Vector2 center, float radius, float startAngle, floa
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*rl_PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSmoothSegments(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    CircleRotation rotation = InitCircleRotation(startAngle, stepLength);
+    rl_Vector2 point = NextCirclePoint(&rotation);
+
+    // Anti-aliased sector is drawn as polygon, center included if not a full circle
+    if (shapesAAActive && ((segments + 2) <= SHAPES_AA_MAX_POINTS))
+    {
+        rl_Vector2 points[SHAPES_AA_MAX_POINTS] = { 0 };
+        int pointCount = 0;
+        bool full = ((endAngle - startAngle) >= 360.0f);
+
+        if (!full) points[pointCount++] = center;
+        points[pointCount++] = (rl_Vector2){ center.x + point.x*radius, center.y + point.y*radius };
+
+        for (int i = 0; i < (full? segments - 1 : segments); i++)
+        {
+            rl_Vector2 next = NextCirclePoint(&rotation);
+            points[pointCount++] = (rl_Vector2){ center.x + next.x*radius, center.y + next.y*radius };
+        }
+
+        // NOTE: Sectors over half circle are not convex, they are drawn with no fringes
+        if (((endAngle - startAngle) <= 180.0f) || full)
+        {
+            if (DrawShapeAAPolygon(points, pointCount, color)) return;
+        }
+
+        rotation = InitCircleRotation(startAngle, stepLength);
+        point = NextCirclePoint(&rotation);
+    }
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(rl_GetShapesTexture().id);
@@ -365,36 +785,41 @@ void rl_DrawCircleSector(rl_Vector2 center, float radius, float startAngle, floa
         // NOTE: Every QUAD actually represents two segments
         for (int i = 0; i < segments/2; i++)
         {
+            rl_Vector2 next = NextCirclePoint(&rotation);
+            rl_Vector2 last = NextCirclePoint(&rotation);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength*2.0f))*radius, center.y + sinf(rl_DEG2RAD*(angle + stepLength*2.0f))*radius);
+            rlVertex2f(center.x + last.x*radius, center.y + last.y*radius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*radius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + next.x*radius, center.y + next.y*radius);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*radius, center.y + sinf(rl_DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + point.x*radius, center.y + point.y*radius);
 
-            angle += (stepLength*2.0f);
+            point = last;
         }
 
         // NOTE: In case number of segments is odd, we add one last piece to the cake
         if ((((unsigned int)segments)%2) == 1)
         {
+            rl_Vector2 next = NextCirclePoint(&rotation);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
             rlVertex2f(center.x, center.y);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*radius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + next.x*radius, center.y + next.y*radius);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*radius, center.y + sinf(rl_DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + point.x*radius, center.y + point.y*radius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
             rlVertex2f(center.x, center.y);
@@ -409,11 +834,13 @@ void rl_DrawCircleSector(rl_Vector2 center, float radius, float startAngle, floa
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
 
+            rl_Vector2 next = NextCirclePoint(&rotation);
+
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*radius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*radius);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*radius, center.y + sinf(rl_DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + next.x*radius, center.y + next.y*radius);
+            rlVertex2f(center.x + point.x*radius, center.y + point.y*radius);
 
-            angle += stepLength;
+            point = next;
         }
     rlEnd();
 #endif
@@ -439,14 +866,14 @@ void rl_DrawCircleSectorLines(rl_Vector2 center, float radius, float startAngle,
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*rl_PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSmoothSegments(radius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    CircleRotation rotation = InitCircleRotation(startAngle, stepLength);
+    rl_Vector2 point = NextCirclePoint(&rotation);
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
@@ -454,24 +881,26 @@ void rl_DrawCircleSectorLines(rl_Vector2 center, float radius, float startAngle,
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*radius, center.y + sinf(rl_DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + point.x*radius, center.y + point.y*radius);
         }
 
         for (int i = 0; i < segments; i++)
         {
+            rl_Vector2 next = NextCirclePoint(&rotation);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*radius, center.y + sinf(rl_DEG2RAD*angle)*radius);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*radius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*radius);
+            rlVertex2f(center.x + point.x*radius, center.y + point.y*radius);
+            rlVertex2f(center.x + next.x*radius, center.y + next.y*radius);
 
-            angle += stepLength;
+            point = next;
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
             rlVertex2f(center.x, center.y);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*radius, center.y + sinf(rl_DEG2RAD*angle)*radius);
+            rlVertex2f(center.x + point.x*radius, center.y + point.y*radius);
         }
     rlEnd();
 }
@@ -581,12 +1010,18 @@ void rl_DrawRing(rl_Vector2 center, float innerRadius, float outerRadius, float
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*rl_PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSmoothSegments(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
 
+    // Full ring as SDF shape quad, if SDF shapes mode enabled
+    if ((endAngle - startAngle) >= 360.0f)
+    {
+        float shape = (innerRadius > 0.0f)? -(outerRadius - innerRadius) : outerRadius;
+        if (DrawShapeSDFQuad(center, outerRadius, outerRadius, shape, color)) return;
+    }
+
     // Not a ring
     if (innerRadius <= 0.0f)
     {
@@ -595,7 +1030,8 @@ void rl_DrawRing(rl_Vector2 center, float innerRadius, float outerRadius, float
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    CircleRotation rotation = InitCircleRotation(startAngle, stepLength);
+    rl_Vector2 point = NextCirclePoint(&rotation);
 
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(rl_GetShapesTexture().id);
@@ -604,21 +1040,23 @@ void rl_DrawRing(rl_Vector2 center, float innerRadius, float outerRadius, float
     rlBegin(RL_QUADS);
         for (int i = 0; i < segments; i++)
         {
+            rl_Vector2 next = NextCirclePoint(&rotation);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*outerRadius, center.y + sinf(rl_DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + point.x*outerRadius, center.y + point.y*outerRadius);
 
             rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*innerRadius, center.y + sinf(rl_DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + point.x*innerRadius, center.y + point.y*innerRadius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + next.x*innerRadius, center.y + next.y*innerRadius);
 
             rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + next.x*outerRadius, center.y + next.y*outerRadius);
 
-            angle += stepLength;
+            point = next;
         }
     rlEnd();
 
@@ -627,17 +1065,19 @@ void rl_DrawRing(rl_Vector2 center, float innerRadius, float outerRadius, float
     rlBegin(RL_TRIANGLES);
         for (int i = 0; i < segments; i++)
         {
+            rl_Vector2 next = NextCirclePoint(&rotation);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*innerRadius, center.y + sinf(rl_DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*outerRadius, center.y + sinf(rl_DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + point.x*innerRadius, center.y + point.y*innerRadius);
+            rlVertex2f(center.x + next.x*innerRadius, center.y + next.y*innerRadius);
+            rlVertex2f(center.x + point.x*outerRadius, center.y + point.y*outerRadius);
 
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*innerRadius);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*outerRadius);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*outerRadius, center.y + sinf(rl_DEG2RAD*angle)*outerRadius);
+            rlVertex2f(center.x + next.x*innerRadius, center.y + next.y*innerRadius);
+            rlVertex2f(center.x + next.x*outerRadius, center.y + next.y*outerRadius);
+            rlVertex2f(center.x + point.x*outerRadius, center.y + point.y*outerRadius);
 
-            angle += stepLength;
+            point = next;
         }
     rlEnd();
 #endif
@@ -672,8 +1112,7 @@ void rl_DrawRingLines(rl_Vector2 center, float innerRadius, float outerRadius, f
     if (segments < minSegments)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/outerRadius, 2) - 1);
-        segments = (int)((endAngle - startAngle)*ceilf(2*rl_PI/th)/360);
+        segments = (int)((endAngle - startAngle)*GetCircleSmoothSegments(outerRadius)/360);
 
         if (segments <= 0) segments = minSegments;
     }
@@ -685,35 +1124,38 @@ void rl_DrawRingLines(rl_Vector2 center, float innerRadius, float outerRadius, f
     }
 
     float stepLength = (endAngle - startAngle)/(float)segments;
-    float angle = startAngle;
+    CircleRotation rotation = InitCircleRotation(startAngle, stepLength);
+    rl_Vector2 point = NextCirclePoint(&rotation);
     bool showCapLines = true;
 
     rlBegin(RL_LINES);
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*outerRadius, center.y + sinf(rl_DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*innerRadius, center.y + sinf(rl_DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + point.x*outerRadius, center.y + point.y*outerRadius);
+            rlVertex2f(center.x + point.x*innerRadius, center.y + point.y*innerRadius);
         }
 
         for (int i = 0; i < segments; i++)
         {
+            rl_Vector2 next = NextCirclePoint(&rotation);
+
             rlColor4ub(color.r, color.g, color.b, color.a);
 
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*outerRadius, center.y + sinf(rl_DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*outerRadius);
+            rlVertex2f(center.x + point.x*outerRadius, center.y + point.y*outerRadius);
+            rlVertex2f(center.x + next.x*outerRadius, center.y + next.y*outerRadius);
 
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*innerRadius, center.y + sinf(rl_DEG2RAD*angle)*innerRadius);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*innerRadius);
+            rlVertex2f(center.x + point.x*innerRadius, center.y + point.y*innerRadius);
+            rlVertex2f(center.x + next.x*innerRadius, center.y + next.y*innerRadius);
 
-            angle += stepLength;
+            point = next;
         }
 
         if (showCapLines)
         {
             rlColor4ub(color.r, color.g, color.b, color.a);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*outerRadius, center.y + sinf(rl_DEG2RAD*angle)*outerRadius);
-            rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*innerRadius, center.y + sinf(rl_DEG2RAD*angle)*innerRadius);
+            rlVertex2f(center.x + point.x*outerRadius, center.y + point.y*outerRadius);
+            rlVertex2f(center.x + point.x*innerRadius, center.y + point.y*innerRadius);
         }
     rlEnd();
 }
@@ -737,6 +1179,18 @@ void rl_DrawRectangleRec(rl_Rectangle rec, rl_Color color)
     rl_DrawRectanglePro(rec, (rl_Vector2){ 0.0f, 0.0f }, 0.0f, color);
 }
 
+// Draw multiple color-filled rectangles, one color per rectangle
+// NOTE: Rectangles are drawn with instancing in one draw call, 20 bytes per rectangle uploaded
+void rl_DrawRectangles(const rl_Rectangle *recs, const rl_Color *colors, int count)
+{
+    if ((recs == NULL) || (colors == NULL) || (count <= 0)) return;
+
+    if (!DrawShapesInstanced(recs, sizeof(rl_Rectangle), colors, count))
+    {
+        for (int i = 0; i < count; i++) rl_DrawRectangleRec(recs[i], colors[i]);
+    }
+}
+
 // Draw a color-filled rectangle with pro parameters
 void rl_DrawRectanglePro(rl_Rectangle rec, rl_Vector2 origin, float rotation, rl_Color color)
 {
@@ -777,6 +1231,12 @@ void rl_DrawRectanglePro(rl_Rectangle rec, rl_Vector2 origin, float rotation, rl
         bottomRight.y = y + (dx + rec.width)*sinRotation + (dy + rec.height)*cosRotation;
     }
 
+    if (shapesAAActive)
+    {
+        rl_Vector2 quad[4] = { topLeft, bottomLeft, bottomRight, topRight };
+        if (DrawShapeAAPolygon(quad, 4, color)) return;
+    }
+
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(rl_GetShapesTexture().id);
     rl_Rectangle shapeRect = rl_GetShapesTextureRectangle();
@@ -958,12 +1418,14 @@ void rl_DrawRectangleRounded(rl_Rectangle rec, float roundness, int segments, rl
     float radius = (rec.width > rec.height)? (rec.height*roundness)/2 : (rec.width*roundness)/2;
     if (radius <= 0.0f) return;
 
+    rl_Vector2 center = { rec.x + rec.width/2.0f, rec.y + rec.height/2.0f };
+    if (DrawShapeSDFQuad(center, rec.width/2.0f, rec.height/2.0f, radius, color)) return;
+
     // Calculate number of segments to use for the corners
     if (segments < 4)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*rl_PI/th)/4.0f);
+        segments = (int)(GetCircleSmoothSegments(radius)/4.0f);
         if (segments <= 0) segments = 4;
     }
 
@@ -1005,40 +1467,46 @@ void rl_DrawRectangleRounded(rl_Rectangle rec, float roundness, int segments, rl
         // Draw all the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            CircleRotation rotation = InitCircleRotation(angles[k], stepLength);
+            rl_Vector2 point = NextCirclePoint(&rotation);
             const rl_Vector2 center = centers[k];
 
             // NOTE: Every QUAD actually represents two segments
             for (int i = 0; i < segments/2; i++)
             {
+                rl_Vector2 next = NextCirclePoint(&rotation);
+                rl_Vector2 last = NextCirclePoint(&rotation);
+
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
 
                 rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength*2))*radius, center.y + sinf(rl_DEG2RAD*(angle + stepLength*2))*radius);
+                rlVertex2f(center.x + last.x*radius, center.y + last.y*radius);
 
                 rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*radius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + next.x*radius, center.y + next.y*radius);
 
                 rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*radius, center.y + sinf(rl_DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + point.x*radius, center.y + point.y*radius);
 
-                angle += (stepLength*2);
+                point = last;
             }
 
             // NOTE: In case number of segments is odd, we add one last piece to the cake
             if (segments%2)
             {
+                rl_Vector2 next = NextCirclePoint(&rotation);
+
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
 
                 rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*radius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*radius);
+                rlVertex2f(center.x + next.x*radius, center.y + next.y*radius);
 
                 rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*radius, center.y + sinf(rl_DEG2RAD*angle)*radius);
+                rlVertex2f(center.x + point.x*radius, center.y + point.y*radius);
 
                 rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
                 rlVertex2f(center.x, center.y);
@@ -1108,15 +1576,18 @@ void rl_DrawRectangleRounded(rl_Rectangle rec, float roundness, int segments, rl
         // Draw all of the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
         for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
         {
-            float angle = angles[k];
+            CircleRotation rotation = InitCircleRotation(angles[k], stepLength);
+            rl_Vector2 point = NextCirclePoint(&rotation);
             const rl_Vector2 center = centers[k];
             for (int i = 0; i < segments; i++)
             {
+                rl_Vector2 next = NextCirclePoint(&rotation);
+
                 rlColor4ub(color.r, color.g, color.b, color.a);
                 rlVertex2f(center.x, center.y);
-                rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*radius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*radius);
-                rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*radius, center.y + sinf(rl_DEG2RAD*angle)*radius);
-                angle += stepLength;
+                rlVertex2f(center.x + next.x*radius, center.y + next.y*radius);
+                rlVertex2f(center.x + point.x*radius, center.y + point.y*radius);
+                point = next;
             }
         }
 
@@ -1197,8 +1668,7 @@ void rl_DrawRectangleRoundedLinesEx(rl_Rectangle rec, float roundness, int segme
     if (segments < 4)
     {
         // Calculate the maximum angle between segments based on the error rate (usually 0.5f)
-        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
-        segments = (int)(ceilf(2*rl_PI/th)/2.0f);
+        segments = (int)(GetCircleSmoothSegments(radius)/2.0f);
         if (segments <= 0) segments = 4;
     }
 
@@ -1260,25 +1730,28 @@ void rl_DrawRectangleRoundedLinesEx(rl_Rectangle rec, float roundness, int segme
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                CircleRotation rotation = InitCircleRotation(angles[k], stepLength);
+                rl_Vector2 point = NextCirclePoint(&rotation);
                 const rl_Vector2 center = centers[k];
                 for (int i = 0; i < segments; i++)
                 {
+                    rl_Vector2 next = NextCirclePoint(&rotation);
+
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
                     rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*innerRadius, center.y + sinf(rl_DEG2RAD*angle)*innerRadius);
+                    rlVertex2f(center.x + point.x*innerRadius, center.y + point.y*innerRadius);
 
                     rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-                    rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*innerRadius);
+                    rlVertex2f(center.x + next.x*innerRadius, center.y + next.y*innerRadius);
 
                     rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*outerRadius);
+                    rlVertex2f(center.x + next.x*outerRadius, center.y + next.y*outerRadius);
 
                     rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                    rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*outerRadius, center.y + sinf(rl_DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + point.x*outerRadius, center.y + point.y*outerRadius);
 
-                    angle += stepLength;
+                    point = next;
                 }
             }
 
@@ -1334,22 +1807,25 @@ void rl_DrawRectangleRoundedLinesEx(rl_Rectangle rec, float roundness, int segme
             // Draw all of the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                CircleRotation rotation = InitCircleRotation(angles[k], stepLength);
+                rl_Vector2 point = NextCirclePoint(&rotation);
                 const rl_Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
+                    rl_Vector2 next = NextCirclePoint(&rotation);
+
                     rlColor4ub(color.r, color.g, color.b, color.a);
 
-                    rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*innerRadius, center.y + sinf(rl_DEG2RAD*angle)*innerRadius);
-                    rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*outerRadius, center.y + sinf(rl_DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + point.x*innerRadius, center.y + point.y*innerRadius);
+                    rlVertex2f(center.x + next.x*innerRadius, center.y + next.y*innerRadius);
+                    rlVertex2f(center.x + point.x*outerRadius, center.y + point.y*outerRadius);
 
-                    rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*innerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*innerRadius);
-                    rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*outerRadius);
-                    rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*outerRadius, center.y + sinf(rl_DEG2RAD*angle)*outerRadius);
+                    rlVertex2f(center.x + next.x*innerRadius, center.y + next.y*innerRadius);
+                    rlVertex2f(center.x + next.x*outerRadius, center.y + next.y*outerRadius);
+                    rlVertex2f(center.x + point.x*outerRadius, center.y + point.y*outerRadius);
 
-                    angle += stepLength;
+                    point = next;
                 }
             }
 
@@ -1398,15 +1874,18 @@ void rl_DrawRectangleRoundedLinesEx(rl_Rectangle rec, float roundness, int segme
             // Draw all the 4 corners first: Upper Left Corner, Upper Right Corner, Lower Right Corner, Lower Left Corner
             for (int k = 0; k < 4; ++k) // Hope the compiler is smart enough to unroll this loop
             {
-                float angle = angles[k];
+                CircleRotation rotation = InitCircleRotation(angles[k], stepLength);
+                rl_Vector2 point = NextCirclePoint(&rotation);
                 const rl_Vector2 center = centers[k];
 
                 for (int i = 0; i < segments; i++)
                 {
+                    rl_Vector2 next = NextCirclePoint(&rotation);
+
                     rlColor4ub(color.r, color.g, color.b, color.a);
-                    rlVertex2f(center.x + cosf(rl_DEG2RAD*angle)*outerRadius, center.y + sinf(rl_DEG2RAD*angle)*outerRadius);
-                    rlVertex2f(center.x + cosf(rl_DEG2RAD*(angle + stepLength))*outerRadius, center.y + sinf(rl_DEG2RAD*(angle + stepLength))*outerRadius);
-                    angle += stepLength;
+                    rlVertex2f(center.x + point.x*outerRadius, center.y + point.y*outerRadius);
+                    rlVertex2f(center.x + next.x*outerRadius, center.y + next.y*outerRadius);
+                    point = next;
                 }
             }
 
@@ -1425,6 +1904,12 @@ void rl_DrawRectangleRoundedLinesEx(rl_Rectangle rec, float roundness, int segme
 // NOTE: Vertex must be provided in counter-clockwise order
 void rl_DrawTriangle(rl_Vector2 v1, rl_Vector2 v2, rl_Vector2 v3, rl_Color color)
 {
+    if (shapesAAActive)
+    {
+        rl_Vector2 triangle[3] = { v1, v2, v3 };
+        if (DrawShapeAAPolygon(triangle, 3, color)) return;
+    }
+
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(rl_GetShapesTexture().id);
     rl_Rectangle shapeRect = rl_GetShapesTextureRectangle();
@@ -1541,6 +2026,18 @@ void rl_DrawPoly(rl_Vector2 center, int sides, float radius, float rotation, rl_
     float centralAngle = rotation*rl_DEG2RAD;
     float angleStep = 360.0f/(float)sides*rl_DEG2RAD;
 
+    if (shapesAAActive && (sides <= SHAPES_AA_MAX_POINTS))
+    {
+        rl_Vector2 points[SHAPES_AA_MAX_POINTS] = { 0 };
+
+        for (int i = 0; i < sides; i++)
+        {
+            points[i] = (rl_Vector2){ center.x + cosf(centralAngle + i*angleStep)*radius, center.y + sinf(centralAngle + i*angleStep)*radius };
+        }
+
+        if (DrawShapeAAPolygon(points, sides, color)) return;
+    }
+
 #if defined(SUPPORT_QUADS_DRAW_MODE)
     rlSetTexture(rl_GetShapesTexture().id);
     rl_Rectangle shapeRect = rl_GetShapesTextureRectangle();
@@ -1657,280 +2154,429 @@ void rl_DrawPolyLinesEx(rl_Vector2 center, int sides, float radius, float rotati
 #endif
 }
 
-//----------------------------------------------------------------------------------
-// Module Functions Definition - Splines functions
-//----------------------------------------------------------------------------------
+// Load polygon triangulated for drawing, polygon could be concave
+// NOTE: Static polygons can be drawn every frame with no triangulation
+rl_Polygon rl_LoadPolygon(const rl_Vector2 *points, int pointCount)
+{
+    return rl_LoadPolygonEx(points, &pointCount, 1);
+}
 
-// Draw spline: linear, minimum 2 points
-void rl_DrawSplineLinear(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
+// Load polygon with holes triangulated for drawing, points are outer contour points followed by holes points
+// NOTE: Contours winding order is not required, holes must be inside outer contour
+rl_Polygon rl_LoadPolygonEx(const rl_Vector2 *points, const int *contourCounts, int contourCount)
 {
-    if (pointCount < 2) return;
+    rl_Polygon polygon = { 0 };
 
-#if defined(SUPPORT_SPLINE_MITERS)
-    rl_Vector2 prevNormal = (rl_Vector2){-(points[1].y - points[0].y), (points[1].x - points[0].x)};
-    float prevLength = sqrtf(prevNormal.x*prevNormal.x + prevNormal.y*prevNormal.y);
+    if ((points == NULL) || (contourCounts == NULL) || (contourCount <= 0) || (contourCounts[0] < 3)) return polygon;
 
-    if (prevLength > 0.0f)
-    {
-        prevNormal.x /= prevLength;
-        prevNormal.y /= prevLength;
-    }
-    else
+    int pointCount = 0;
+    for (int i = 0; i < contourCount; i++) pointCount += (contourCounts[i] > 0)? contourCounts[i] : 0;
+
+    if (pointCount > 65535)
     {
-        prevNormal.x = 0.0f;
-        prevNormal.y = 0.0f;
+        TRACELOG(LOG_WARNING, "SHAPES: Polygon vertex count exceeds 16-bit indices, polygon not loaded");
+        return polygon;
     }
 
-    rl_Vector2 prevRadius = { 0.5f*thick*prevNormal.x, 0.5f*thick*prevNormal.y };
+    // Nodes: contours vertex, two nodes per hole bridge and two nodes per diagonal split
+    PolygonTriangulator tri = { 0 };
+    tri.nodeCapacity = 3*(pointCount + 2*contourCount);
+    tri.nodes = (PolygonNode *)RL_CALLOC(tri.nodeCapacity, sizeof(PolygonNode));
+    tri.indices = (unsigned short *)RL_MALLOC(3*tri.nodeCapacity*sizeof(unsigned short));
+    polygon.vertices = (rl_Vector2 *)RL_MALLOC(pointCount*sizeof(rl_Vector2));
 
-    for (int i = 0; i < pointCount - 1; i++)
+    if ((tri.nodes != NULL) && (tri.indices != NULL) && (polygon.vertices != NULL))
     {
-        rl_Vector2 normal = { 0 };
+        memcpy(polygon.vertices, points, pointCount*sizeof(rl_Vector2));
+        polygon.vertexCount = pointCount;
 
-        if (i < pointCount - 2)
-        {
-            normal = (rl_Vector2){-(points[i + 2].y - points[i + 1].y), (points[i + 2].x - points[i + 1].x)};
-            float normalLength = sqrtf(normal.x*normal.x + normal.y*normal.y);
+        PolygonNode *outer = LinkPolygonContour(&tri, points, 0, contourCounts[0], true);
 
-            if (normalLength > 0.0f)
-            {
-                normal.x /= normalLength;
-                normal.y /= normalLength;
-            }
-            else
-            {
-                normal.x = 0.0f;
-                normal.y = 0.0f;
-            }
-        }
-        else
+        if ((outer != NULL) && (outer->next != outer->prev))
         {
-            normal = prevNormal;
-        }
+            // Holes are bridged to outer contour from leftmost to rightmost
+            PolygonNode **holes = (PolygonNode **)RL_MALLOC(contourCount*sizeof(PolygonNode *));
+            int holeCount = 0;
 
-        rl_Vector2 radius = { prevNormal.x + normal.x, prevNormal.y + normal.y };
-        float radiusLength = sqrtf(radius.x*radius.x + radius.y*radius.y);
+            for (int i = 1, start = contourCounts[0]; i < contourCount; start += (contourCounts[i] > 0)? contourCounts[i] : 0, i++)
+            {
+                PolygonNode *hole = (holes != NULL)? LinkPolygonContour(&tri, points, start, contourCounts[i], false) : NULL;
+                if (hole == NULL) continue;
 
-        if (radiusLength > 0.0f)
-        {
-            radius.x /= radiusLength;
-            radius.y /= radiusLength;
-        }
-        else
-        {
-            radius.x = 0.0f;
-            radius.y = 0.0f;
-        }
+                PolygonNode *leftmost = hole;
+                PolygonNode *p = hole;
+                do
+                {
+                    if ((p->x < leftmost->x) || ((p->x == leftmost->x) && (p->y < leftmost->y))) leftmost = p;
+                    p = p->next;
+                } while (p != hole);
 
-        float cosTheta = radius.x*normal.x + radius.y*normal.y;
+                int k = holeCount++;
+                for (; (k > 0) && (holes[k - 1]->x > leftmost->x); k--) holes[k] = holes[k - 1];
+                holes[k] = leftmost;
+            }
 
-        if (cosTheta != 0.0f)
-        {
-            radius.x *= (thick*0.5f/cosTheta);
-            radius.y *= (thick*0.5f/cosTheta);
-        }
-        else
-        {
-            radius.x = 0.0f;
-            radius.y = 0.0f;
-        }
+            for (int i = 0; i < holeCount; i++) outer = BridgePolygonHole(&tri, holes[i], outer);
 
-        rl_Vector2 strip[4] = {
-            { points[i].x - prevRadius.x, points[i].y - prevRadius.y },
-            { points[i].x + prevRadius.x, points[i].y + prevRadius.y },
-            { points[i + 1].x - radius.x, points[i + 1].y - radius.y },
-            { points[i + 1].x + radius.x, points[i + 1].y + radius.y }
-        };
+            RL_FREE(holes);
 
-        rl_DrawTriangleStrip(strip, 4, color);
+            ClipPolygonEars(&tri, outer, 0);
+        }
 
-        prevRadius = radius;
-        prevNormal = normal;
+        polygon.triangleCount = tri.triangleCount;
+        polygon.indices = (tri.triangleCount > 0)? (unsigned short *)RL_REALLOC(tri.indices, 3*tri.triangleCount*sizeof(unsigned short)) : NULL;
+        if ((polygon.indices == NULL) || (tri.triangleCount == 0)) RL_FREE(tri.indices);
+        if (polygon.indices == NULL) polygon.triangleCount = 0;
+    }
+    else
+    {
+        RL_FREE(tri.indices);
+        RL_FREE(polygon.vertices);
+        polygon.vertices = NULL;
     }
 
-#else   // !SUPPORT_SPLINE_MITERS
+    RL_FREE(tri.nodes);
 
-    rl_Vector2 delta = { 0 };
-    float length = 0.0f;
-    float scale = 0.0f;
+    return polygon;
+}
 
-    for (int i = 0; i < pointCount - 1; i++)
-    {
-        delta = (rl_Vector2){ points[i + 1].x - points[i].x, points[i + 1].y - points[i].y };
-        length = sqrtf(delta.x*delta.x + delta.y*delta.y);
+// Unload polygon vertex and triangles data
+void rl_UnloadPolygon(rl_Polygon polygon)
+{
+    RL_FREE(polygon.vertices);
+    RL_FREE(polygon.indices);
+}
 
-        if (length > 0) scale = thick/(2*length);
+// Draw polygon, triangulated on loading
+void rl_DrawPolygon(rl_Polygon polygon, rl_Color color)
+{
+    if (polygon.triangleCount <= 0) return;
 
-        rl_Vector2 radius = { -scale*delta.y, scale*delta.x };
-        rl_Vector2 strip[4] = {
-            { points[i].x - radius.x, points[i].y - radius.y },
-            { points[i].x + radius.x, points[i].y + radius.y },
-            { points[i + 1].x - radius.x, points[i + 1].y - radius.y },
-            { points[i + 1].x + radius.x, points[i + 1].y + radius.y }
-        };
+    rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
 
-        rl_DrawTriangleStrip(strip, 4, color);
-    }
-#endif
+        for (int i = 0; i < 3*polygon.triangleCount; i++)
+        {
+            rl_Vector2 vertex = polygon.vertices[polygon.indices[i]];
+            rlVertex2f(vertex.x, vertex.y);
+        }
+    rlEnd();
+}
 
-#if defined(SUPPORT_SPLINE_SEGMENT_CAPS)
-    // TODO: Add spline segment rounded caps at the begin/end of the spline
-#endif
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Paths functions
+//----------------------------------------------------------------------------------
+// Begin path subpath at point
+void rl_PathMoveTo(rl_Path *path, rl_Vector2 point)
+{
+    AddPathData(path, PATH_MOVE_TO, &point, 1);
 }
 
-// Draw spline: B-Spline, minimum 4 points
-void rl_DrawSplineBasis(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
+// Add line to path, from current point
+void rl_PathLineTo(rl_Path *path, rl_Vector2 point)
 {
-    if (pointCount < 4) return;
+    AddPathData(path, PATH_LINE_TO, &point, 1);
+}
 
-    float a[4] = { 0 };
-    float b[4] = { 0 };
-    float dy = 0.0f;
-    float dx = 0.0f;
-    float size = 0.0f;
+// Add quadratic Bezier curve to path, from current point
+void rl_PathQuadTo(rl_Path *path, rl_Vector2 control, rl_Vector2 point)
+{
+    rl_Vector2 points[2] = { control, point };
 
-    rl_Vector2 currentPoint = { 0 };
-    rl_Vector2 nextPoint = { 0 };
-    rl_Vector2 vertices[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
+    AddPathData(path, PATH_QUAD_TO, points, 2);
+}
 
-    for (int i = 0; i < (pointCount - 3); i++)
-    {
-        float t = 0.0f;
-        rl_Vector2 p1 = points[i], p2 = points[i + 1], p3 = points[i + 2], p4 = points[i + 3];
+// Add cubic Bezier curve to path, from current point
+void rl_PathCubicTo(rl_Path *path, rl_Vector2 control1, rl_Vector2 control2, rl_Vector2 point)
+{
+    rl_Vector2 points[3] = { control1, control2, point };
 
-        a[0] = (-p1.x + 3.0f*p2.x - 3.0f*p3.x + p4.x)/6.0f;
-        a[1] = (3.0f*p1.x - 6.0f*p2.x + 3.0f*p3.x)/6.0f;
-        a[2] = (-3.0f*p1.x + 3.0f*p3.x)/6.0f;
-        a[3] = (p1.x + 4.0f*p2.x + p3.x)/6.0f;
+    AddPathData(path, PATH_CUBIC_TO, points, 3);
+}
 
-        b[0] = (-p1.y + 3.0f*p2.y - 3.0f*p3.y + p4.y)/6.0f;
-        b[1] = (3.0f*p1.y - 6.0f*p2.y + 3.0f*p3.y)/6.0f;
-        b[2] = (-3.0f*p1.y + 3.0f*p3.y)/6.0f;
-        b[3] = (p1.y + 4.0f*p2.y + p3.y)/6.0f;
+// Close path current subpath, current point moves back to subpath begin
+void rl_PathClose(rl_Path *path)
+{
+    AddPathData(path, PATH_CLOSE, NULL, 0);
+}
 
-        currentPoint.x = a[3];
-        currentPoint.y = b[3];
+// Unload path commands and points data
+void rl_UnloadPath(rl_Path path)
+{
+    RL_FREE(path.commands);
+    RL_FREE(path.points);
+}
 
-        if (i == 0) rl_DrawCircleV(currentPoint, thick/2.0f, color);   // Draw init line circle-cap
+// Load path fill, flattened subpaths filled with non-zero or even-odd rule (rl_FillRule)
+// NOTE: Fill is decomposed in trapezoids between scanlines at vertex and edges intersections heights,
+// overlapping and self-intersecting subpaths are supported, static paths are drawn with no tessellation
+rl_Polygon rl_LoadPathFill(rl_Path path, int fillRule, float scale)
+{
+    rl_Polygon polygon = { 0 };
 
-        if (i > 0)
-        {
-            vertices[0].x = currentPoint.x + dy*size;
-            vertices[0].y = currentPoint.y - dx*size;
-            vertices[1].x = currentPoint.x - dy*size;
-            vertices[1].y = currentPoint.y + dx*size;
-        }
+    if (scale <= 0.0f) scale = GetSplineDrawScale();
 
-        for (int j = 1; j <= SPLINE_SEGMENT_DIVISIONS; j++)
-        {
-            t = ((float)j)/((float)SPLINE_SEGMENT_DIVISIONS);
+    PathContours contours = GenPathContours(path, scale);
 
-            nextPoint.x = a[3] + t*(a[2] + t*(a[1] + t*a[0]));
-            nextPoint.y = b[3] + t*(b[2] + t*(b[1] + t*b[0]));
+    // Non horizontal edges, all subpaths closed for filling
+    PathEdge *edges = (PathEdge *)RL_MALLOC((contours.pointCount + 1)*sizeof(PathEdge));
+    int edgeCount = 0;
 
-            dy = nextPoint.y - currentPoint.y;
-            dx = nextPoint.x - currentPoint.x;
-            size = 0.5f*thick/sqrtf(dx*dx+dy*dy);
+    for (int i = 0, start = 0; (edges != NULL) && (i < contours.contourCount); start += contours.counts[i], i++)
+    {
+        for (int k = 0; k < contours.counts[i]; k++)
+        {
+            rl_Vector2 a = contours.points[start + k];
+            rl_Vector2 b = contours.points[start + (k + 1)%contours.counts[i]];
 
-            if ((i == 0) && (j == 1))
-            {
-                vertices[0].x = currentPoint.x + dy*size;
-                vertices[0].y = currentPoint.y - dx*size;
-                vertices[1].x = currentPoint.x - dy*size;
-                vertices[1].y = currentPoint.y + dx*size;
-            }
+            if (a.y == b.y) continue;
 
-            vertices[2*j + 1].x = nextPoint.x - dy*size;
-            vertices[2*j + 1].y = nextPoint.y + dx*size;
-            vertices[2*j].x = nextPoint.x + dy*size;
-            vertices[2*j].y = nextPoint.y - dx*size;
+            PathEdge *edge = &edges[edgeCount++];
+            edge->winding = (b.y > a.y)? 1 : -1;
+            if (edge->winding < 0) { rl_Vector2 t = a; a = b; b = t; }
 
-            currentPoint = nextPoint;
+            edge->x0 = a.x;
+            edge->y0 = a.y;
+            edge->x1 = b.x;
+            edge->y1 = b.y;
+            edge->vertex = -1;
         }
+    }
 
-        rl_DrawTriangleStrip(vertices, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+    UnloadPathContours(contours);
+
+    if (edgeCount == 0)
+    {
+        RL_FREE(edges);
+        return polygon;
     }
 
-    // Cap circle drawing at the end of every segment
-    rl_DrawCircleV(currentPoint, thick/2.0f, color);
-}
+    // Scanlines heights: edges end points and edges intersections
+    int scanlineCount = 0;
+    int scanlineCapacity = 2*edgeCount;
+    float *scanlines = (float *)RL_MALLOC(scanlineCapacity*sizeof(float));
+    PathEdge **sorted = (PathEdge **)RL_MALLOC(edgeCount*sizeof(PathEdge *));
 
-// Draw spline: Catmull-Rom, minimum 4 points
-void rl_DrawSplineCatmullRom(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
-{
-    if (pointCount < 4) return;
+    if ((scanlines == NULL) || (sorted == NULL))
+    {
+        RL_FREE(scanlines);
+        RL_FREE(sorted);
+        RL_FREE(edges);
+        return polygon;
+    }
 
-    float dy = 0.0f;
-    float dx = 0.0f;
-    float size = 0.0f;
+    for (int i = 0; i < edgeCount; i++)
+    {
+        sorted[i] = &edges[i];
+        sorted[i]->order = sorted[i]->y0;
+    }
 
-    rl_Vector2 currentPoint = points[1];
-    rl_Vector2 nextPoint = { 0 };
-    rl_Vector2 vertices[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
+    qsort(sorted, edgeCount, sizeof(PathEdge *), ComparePathEdge);
 
-    rl_DrawCircleV(currentPoint, thick/2.0f, color);   // Draw init line circle-cap
+    for (int i = 0; i < edgeCount; i++)
+    {
+        scanlines[scanlineCount++] = edges[i].y0;
+        scanlines[scanlineCount++] = edges[i].y1;
+    }
 
-    for (int i = 0; i < (pointCount - 3); i++)
+    for (int i = 0; i < edgeCount; i++)
     {
-        float t = 0.0f;
-        rl_Vector2 p1 = points[i], p2 = points[i + 1], p3 = points[i + 2], p4 = points[i + 3];
+        PathEdge *a = sorted[i];
 
-        if (i > 0)
+        // Edges sorted by top, following edges starting under this edge bottom can not intersect
+        for (int j = i + 1; (j < edgeCount) && (sorted[j]->y0 < a->y1); j++)
         {
-            vertices[0].x = currentPoint.x + dy*size;
-            vertices[0].y = currentPoint.y - dx*size;
-            vertices[1].x = currentPoint.x - dy*size;
-            vertices[1].y = currentPoint.y + dx*size;
+            PathEdge *b = sorted[j];
+            float adx = a->x1 - a->x0;
+            float ady = a->y1 - a->y0;
+            float bdx = b->x1 - b->x0;
+            float bdy = b->y1 - b->y0;
+            float denominator = adx*bdy - ady*bdx;
+
+            if (denominator == 0.0f) continue;
+
+            float t = ((b->x0 - a->x0)*bdy - (b->y0 - a->y0)*bdx)/denominator;
+            float u = ((b->x0 - a->x0)*ady - (b->y0 - a->y0)*adx)/denominator;
+
+            if ((t > 0.0f) && (t < 1.0f) && (u > 0.0f) && (u < 1.0f))
+            {
+                if (scanlineCount == scanlineCapacity)
+                {
+                    float *resized = (float *)RL_REALLOC(scanlines, 2*scanlineCapacity*sizeof(float));
+                    if (resized == NULL) continue;
+                    scanlines = resized;
+                    scanlineCapacity *= 2;
+                }
+
+                scanlines[scanlineCount++] = a->y0 + t*ady;
+            }
         }
+    }
 
-        for (int j = 1; j <= SPLINE_SEGMENT_DIVISIONS; j++)
+    qsort(scanlines, scanlineCount, sizeof(float), ComparePathFloat);
+
+    // Sweep bands between scanlines, active edges cross full band with no intersections inside
+    int vertexCapacity = 0;
+    int indexCapacity = 0;
+    int next = 0;
+    bool failed = false;
+    int bandEdgeCount = 0;
+    PathEdge **bandEdges = (PathEdge **)RL_MALLOC(edgeCount*sizeof(PathEdge *));
+
+    for (int s = 0; (bandEdges != NULL) && !failed && (s < scanlineCount - 1); s++)
+    {
+        float y0 = scanlines[s];
+        float y1 = scanlines[s + 1];
+        if (y1 <= y0) continue;
+
+        // Update band edges, edges are sorted by top
+        int count = 0;
+        for (int i = 0; i < bandEdgeCount; i++) if (bandEdges[i]->y1 > y0) bandEdges[count++] = bandEdges[i];
+        while ((next < edgeCount) && (sorted[next]->y0 <= y0)) bandEdges[count++] = sorted[next++];
+        bandEdgeCount = count;
+
+        float middle = 0.5f*(y0 + y1);
+        for (int i = 0; i < bandEdgeCount; i++)
         {
-            t = ((float)j)/((float)SPLINE_SEGMENT_DIVISIONS);
+            PathEdge *edge = bandEdges[i];
+            edge->order = edge->x0 + (middle - edge->y0)*(edge->x1 - edge->x0)/(edge->y1 - edge->y0);
+        }
 
-            float q0 = (-1.0f*t*t*t) + (2.0f*t*t) + (-1.0f*t);
-            float q1 = (3.0f*t*t*t) + (-5.0f*t*t) + 2.0f;
-            float q2 = (-3.0f*t*t*t) + (4.0f*t*t) + t;
-            float q3 = t*t*t - t*t;
+        qsort(bandEdges, bandEdgeCount, sizeof(PathEdge *), ComparePathEdge);
 
-            nextPoint.x = 0.5f*((p1.x*q0) + (p2.x*q1) + (p3.x*q2) + (p4.x*q3));
-            nextPoint.y = 0.5f*((p1.y*q0) + (p2.y*q1) + (p3.y*q2) + (p4.y*q3));
+        int winding = 0;
+        PathEdge *left = NULL;
 
-            dy = nextPoint.y - currentPoint.y;
-            dx = nextPoint.x - currentPoint.x;
-            size = (0.5f*thick)/sqrtf(dx*dx + dy*dy);
+        for (int i = 0; i < bandEdgeCount; i++)
+        {
+            bool inside = (fillRule == FILL_RULE_EVENODD)? ((winding & 1) != 0) : (winding != 0);
+            winding += bandEdges[i]->winding;
+            bool nextInside = (fillRule == FILL_RULE_EVENODD)? ((winding & 1) != 0) : (winding != 0);
 
-            if ((i == 0) && (j == 1))
+            if (!inside && nextInside) left = bandEdges[i];
+            else if (inside && !nextInside)
             {
-                vertices[0].x = currentPoint.x + dy*size;
-                vertices[0].y = currentPoint.y - dx*size;
-                vertices[1].x = currentPoint.x - dy*size;
-                vertices[1].y = currentPoint.y + dx*size;
-            }
+                // Trapezoid between left and right edges, counter-clockwise triangles
+                int a = GetPathEdgeVertex(left, y0, &polygon, &vertexCapacity);
+                int b = GetPathEdgeVertex(left, y1, &polygon, &vertexCapacity);
+                int c = GetPathEdgeVertex(bandEdges[i], y1, &polygon, &vertexCapacity);
+                int d = GetPathEdgeVertex(bandEdges[i], y0, &polygon, &vertexCapacity);
 
-            vertices[2*j + 1].x = nextPoint.x - dy*size;
-            vertices[2*j + 1].y = nextPoint.y + dx*size;
-            vertices[2*j].x = nextPoint.x + dy*size;
-            vertices[2*j].y = nextPoint.y - dx*size;
+                if ((a < 0) || (b < 0) || (c < 0) || (d < 0)) { failed = true; break; }
+
+                if ((3*polygon.triangleCount + 6) > indexCapacity)
+                {
+                    int capacity = (indexCapacity > 0)? 2*indexCapacity : 6*edgeCount;
+                    unsigned short *resized = (unsigned short *)RL_REALLOC(polygon.indices, capacity*sizeof(unsigned short));
+                    if (resized == NULL) { failed = true; break; }
+                    polygon.indices = resized;
+                    indexCapacity = capacity;
+                }
 
-            currentPoint = nextPoint;
+                unsigned short *indices = polygon.indices + 3*polygon.triangleCount;
+                indices[0] = (unsigned short)a;
+                indices[1] = (unsigned short)b;
+                indices[2] = (unsigned short)c;
+                indices[3] = (unsigned short)a;
+                indices[4] = (unsigned short)c;
+                indices[5] = (unsigned short)d;
+                polygon.triangleCount += 2;
+            }
         }
+    }
 
-        rl_DrawTriangleStrip(vertices, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+    if (failed)
+    {
+        TRACELOG(LOG_WARNING, "SHAPES: Path fill vertex count exceeds 16-bit indices, path fill not loaded");
+        rl_UnloadPolygon(polygon);
+        polygon = (rl_Polygon){ 0 };
     }
 
-    // Cap circle drawing at the end of every segment
-    rl_DrawCircleV(currentPoint, thick/2.0f, color);
+    RL_FREE(bandEdges);
+    RL_FREE(scanlines);
+    RL_FREE(sorted);
+    RL_FREE(edges);
+
+    return polygon;
 }
 
-// Draw spline: Quadratic Bezier, minimum 3 points (1 control point): [p1, c2, p3, c4...]
-void rl_DrawSplineBezierQuadratic(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
+// Load path stroke with joins and caps, flattened subpaths stroked once as a triangle strip
+// NOTE: Closed subpaths are joined at begin point, stroke is drawn with rl_DrawSpline()
+rl_Spline rl_LoadPathStroke(rl_Path path, float thick, int join, int cap, float scale)
 {
-    if (pointCount >= 3)
-    {
-        for (int i = 0; i < pointCount - 2; i += 2) rl_DrawSplineSegmentBezierQuadratic(points[i], points[i + 1], points[i + 2], thick, color);
+    rl_Spline spline = { 0 };
 
-        // Cap circle drawing at the end of every segment
-        //for (int i = 2; i < pointCount - 2; i += 2) rl_DrawCircleV(points[i], thick/2.0f, color);
+    if (thick <= 0.0f) return spline;
+    if (scale <= 0.0f) scale = GetSplineDrawScale();
+
+    PathContours contours = GenPathContours(path, scale);
+
+    // First pass counts strip vertex, second pass generates them
+    StrokeBuffer buffer = { 0 };
+    GenPathStroke(&contours, thick, join, cap, &buffer);
+
+    if (buffer.count > 0) buffer.vertices = (rl_Vector2 *)RL_MALLOC(buffer.count*sizeof(rl_Vector2));
+
+    if (buffer.vertices != NULL)
+    {
+        buffer.capacity = buffer.count;
+        buffer.count = 0;
+        GenPathStroke(&contours, thick, join, cap, &buffer);
+
+        spline.vertices = buffer.vertices;
+        spline.vertexCount = buffer.count;
+        spline.thick = thick;
+    }
+
+    UnloadPathContours(contours);
+
+    return spline;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Splines functions
+//----------------------------------------------------------------------------------
+
+// Draw spline: linear, minimum 2 points
+// NOTE: Spline is stroked as a single triangle strip with miter (SUPPORT_SPLINE_MITERS) or bevel joins
+void rl_DrawSplineLinear(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
+{
+    rl_DrawLineStripEx(points, pointCount, thick, SPLINE_LINEAR_JOIN, SPLINE_LINEAR_CAP, color);
+}
+
+// Draw spline: B-Spline, minimum 4 points
+void rl_DrawSplineBasis(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
+{
+    if (pointCount < 4) return;
+
+    for (int i = 0; i < (pointCount - 3); i++) rl_DrawSplineSegmentBasis(points[i], points[i + 1], points[i + 2], points[i + 3], thick, color);
+
+    // Cap circle drawing at the begin and end of the spline
+    rl_DrawCircleV(rl_GetSplinePointBasis(points[0], points[1], points[2], points[3], 0.0f), thick/2.0f, color);
+    rl_DrawCircleV(rl_GetSplinePointBasis(points[pointCount - 4], points[pointCount - 3], points[pointCount - 2], points[pointCount - 1], 1.0f), thick/2.0f, color);
+}
+
+// Draw spline: Catmull-Rom, minimum 4 points
+void rl_DrawSplineCatmullRom(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
+{
+    if (pointCount < 4) return;
+
+    for (int i = 0; i < (pointCount - 3); i++) rl_DrawSplineSegmentCatmullRom(points[i], points[i + 1], points[i + 2], points[i + 3], thick, color);
+
+    // Cap circle drawing at the begin and end of the spline
+    rl_DrawCircleV(points[1], thick/2.0f, color);
+    rl_DrawCircleV(points[pointCount - 2], thick/2.0f, color);
+}
+
+// Draw spline: Quadratic Bezier, minimum 3 points (1 control point): [p1, c2, p3, c4...]
+void rl_DrawSplineBezierQuadratic(const rl_Vector2 *points, int pointCount, float thick, rl_Color color)
+{
+    if (pointCount >= 3)
+    {
+        for (int i = 0; i < pointCount - 2; i += 2) rl_DrawSplineSegmentBezierQuadratic(points[i], points[i + 1], points[i + 2], thick, color);
+
+        // Cap circle drawing at the end of every segment
+        //for (int i = 2; i < pointCount - 2; i += 2) rl_DrawCircleV(points[i], thick/2.0f, color);
     }
 }
 
@@ -1973,196 +2619,151 @@ void rl_DrawSplineSegmentLinear(rl_Vector2 p1, rl_Vector2 p2, float thick, rl_Co
 // Draw spline segment: B-Spline, 4 points
 void rl_DrawSplineSegmentBasis(rl_Vector2 p1, rl_Vector2 p2, rl_Vector2 p3, rl_Vector2 p4, float thick, rl_Color color)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
-
-    rl_Vector2 currentPoint = { 0 };
-    rl_Vector2 nextPoint = { 0 };
-    float t = 0.0f;
-
-    rl_Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    float a[4] = { 0 };
-    float b[4] = { 0 };
-
-    a[0] = (-p1.x + 3*p2.x - 3*p3.x + p4.x)/6.0f;
-    a[1] = (3*p1.x - 6*p2.x + 3*p3.x)/6.0f;
-    a[2] = (-3*p1.x + 3*p3.x)/6.0f;
-    a[3] = (p1.x + 4*p2.x + p3.x)/6.0f;
-
-    b[0] = (-p1.y + 3*p2.y - 3*p3.y + p4.y)/6.0f;
-    b[1] = (3*p1.y - 6*p2.y + 3*p3.y)/6.0f;
-    b[2] = (-3*p1.y + 3*p3.y)/6.0f;
-    b[3] = (p1.y + 4*p2.y + p3.y)/6.0f;
-
-    currentPoint.x = a[3];
-    currentPoint.y = b[3];
-
-    for (int i = 0; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
+    rl_Vector2 points[4] = { p1, p2, p3, p4 };
+    rl_Vector2 bezier[4] = { 0 };
 
-        nextPoint.x = a[3] + t*(a[2] + t*(a[1] + t*a[0]));
-        nextPoint.y = b[3] + t*(b[2] + t*(b[1] + t*b[0]));
-
-        float dy = nextPoint.y - currentPoint.y;
-        float dx = nextPoint.x - currentPoint.x;
-        float size = (0.5f*thick)/sqrtf(dx*dx + dy*dy);
-
-        if (i == 1)
-        {
-            points[0].x = currentPoint.x + dy*size;
-            points[0].y = currentPoint.y - dx*size;
-            points[1].x = currentPoint.x - dy*size;
-            points[1].y = currentPoint.y + dx*size;
-        }
-
-        points[2*i + 1].x = nextPoint.x - dy*size;
-        points[2*i + 1].y = nextPoint.y + dx*size;
-        points[2*i].x = nextPoint.x + dy*size;
-        points[2*i].y = nextPoint.y - dx*size;
-
-        currentPoint = nextPoint;
-    }
-
-    rl_DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS+2, color);
+    GetSplineSegmentBezier(SPLINE_BASIS, points, bezier);
+    DrawSplineSegmentBezier(bezier, thick, color);
 }
 
 // Draw spline segment: Catmull-Rom, 4 points
 void rl_DrawSplineSegmentCatmullRom(rl_Vector2 p1, rl_Vector2 p2, rl_Vector2 p3, rl_Vector2 p4, float thick, rl_Color color)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
-
-    rl_Vector2 currentPoint = p1;
-    rl_Vector2 nextPoint = { 0 };
-    float t = 0.0f;
-
-    rl_Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
-
-    for (int i = 0; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
-
-        float q0 = (-1*t*t*t) + (2*t*t) + (-1*t);
-        float q1 = (3*t*t*t) + (-5*t*t) + 2;
-        float q2 = (-3*t*t*t) + (4*t*t) + t;
-        float q3 = t*t*t - t*t;
-
-        nextPoint.x = 0.5f*((p1.x*q0) + (p2.x*q1) + (p3.x*q2) + (p4.x*q3));
-        nextPoint.y = 0.5f*((p1.y*q0) + (p2.y*q1) + (p3.y*q2) + (p4.y*q3));
+    rl_Vector2 points[4] = { p1, p2, p3, p4 };
+    rl_Vector2 bezier[4] = { 0 };
 
-        float dy = nextPoint.y - currentPoint.y;
-        float dx = nextPoint.x - currentPoint.x;
-        float size = (0.5f*thick)/sqrtf(dx*dx + dy*dy);
+    GetSplineSegmentBezier(SPLINE_CATMULLROM, points, bezier);
+    DrawSplineSegmentBezier(bezier, thick, color);
+}
 
-        if (i == 1)
-        {
-            points[0].x = currentPoint.x + dy*size;
-            points[0].y = currentPoint.y - dx*size;
-            points[1].x = currentPoint.x - dy*size;
-            points[1].y = currentPoint.y + dx*size;
-        }
+// Draw spline segment: Quadratic Bezier, 2 points, 1 control point
+void rl_DrawSplineSegmentBezierQuadratic(rl_Vector2 p1, rl_Vector2 c2, rl_Vector2 p3, float thick, rl_Color color)
+{
+    rl_Vector2 points[3] = { p1, c2, p3 };
+    rl_Vector2 bezier[4] = { 0 };
 
-        points[2*i + 1].x = nextPoint.x - dy*size;
-        points[2*i + 1].y = nextPoint.y + dx*size;
-        points[2*i].x = nextPoint.x + dy*size;
-        points[2*i].y = nextPoint.y - dx*size;
+    GetSplineSegmentBezier(SPLINE_BEZIER_QUADRATIC, points, bezier);
+    DrawSplineSegmentBezier(bezier, thick, color);
+}
 
-        currentPoint = nextPoint;
-    }
+// Draw spline segment: Cubic Bezier, 2 points, 2 control points
+void rl_DrawSplineSegmentBezierCubic(rl_Vector2 p1, rl_Vector2 c2, rl_Vector2 c3, rl_Vector2 p4, float thick, rl_Color color)
+{
+    rl_Vector2 bezier[4] = { p1, c2, c3, p4 };
 
-    rl_DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+    DrawSplineSegmentBezier(bezier, thick, color);
 }
 
-// Draw spline segment: Quadratic Bezier, 2 points, 1 control point
-void rl_DrawSplineSegmentBezierQuadratic(rl_Vector2 p1, rl_Vector2 c2, rl_Vector2 p3, float thick, rl_Color color)
+// Load spline, tessellated once as a triangle strip for drawing scales up to provided one
+// NOTE: Static splines can be drawn every frame with no tessellation, scale <= 0.0f uses current drawing scale
+rl_Spline rl_LoadSpline(int type, const rl_Vector2 *points, int pointCount, float thick, float scale)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
+    rl_Spline spline = { 0 };
 
-    rl_Vector2 previous = p1;
-    rl_Vector2 current = { 0 };
-    float t = 0.0f;
+    if (type == SPLINE_LINEAR) return rl_LoadLineStripStroke(points, pointCount, thick, SPLINE_LINEAR_JOIN, SPLINE_LINEAR_CAP);
 
-    rl_Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
+    int segmentCount = GetSplineSegmentCount(type, pointCount);
+    if ((points == NULL) || (segmentCount <= 0) || (thick <= 0.0f)) return spline;
 
-    for (int i = 1; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
+    if (scale <= 0.0f) scale = GetSplineDrawScale();
 
-        float a = powf(1.0f - t, 2);
-        float b = 2.0f*(1.0f - t)*t;
-        float c = powf(t, 2);
+    // Segments strips are joined with degenerate triangles, two vertex per join
+    int stride = (type == SPLINE_BEZIER_QUADRATIC)? 2 : (type == SPLINE_BEZIER_CUBIC)? 3 : 1;
+    int capacity = 0;
+    rl_Vector2 bezier[4] = { 0 };
 
-        // NOTE: The easing functions aren't suitable here because they don't take a control point
-        current.y = a*p1.y + b*c2.y + c*p3.y;
-        current.x = a*p1.x + b*c2.x + c*p3.x;
+    for (int i = 0; i < segmentCount; i++)
+    {
+        GetSplineSegmentBezier(type, points + i*stride, bezier);
+        capacity += 2*GetSplineSegmentDivisions(bezier, scale) + 2 + 2;
+    }
 
-        float dy = current.y - previous.y;
-        float dx = current.x - previous.x;
-        float size = 0.5f*thick/sqrtf(dx*dx+dy*dy);
+    spline.vertices = (rl_Vector2 *)RL_MALLOC(capacity*sizeof(rl_Vector2));
+    if (spline.vertices == NULL) return spline;
 
-        if (i == 1)
+    for (int i = 0; i < segmentCount; i++)
+    {
+        GetSplineSegmentBezier(type, points + i*stride, bezier);
+        rl_Vector2 *strip = spline.vertices + spline.vertexCount;
+        int count = GenSplineSegmentStrip(bezier, GetSplineSegmentDivisions(bezier, scale), thick, strip + 1);
+
+        if (i == 0)
         {
-            points[0].x = previous.x + dy*size;
-            points[0].y = previous.y - dx*size;
-            points[1].x = previous.x - dy*size;
-            points[1].y = previous.y + dx*size;
+            memmove(strip, strip + 1, count*sizeof(rl_Vector2));
+            spline.vertexCount = count;
+        }
+        else if ((strip[1].x == strip[-2].x) && (strip[1].y == strip[-2].y) && (strip[2].x == strip[-1].x) && (strip[2].y == strip[-1].y))
+        {
+            // Continuous segments share first vertex pair with previous segment last pair
+            memmove(strip, strip + 3, (count - 2)*sizeof(rl_Vector2));
+            spline.vertexCount += count - 2;
+        }
+        else
+        {
+            strip[0] = strip[-1];
+            memmove(strip + 2, strip + 1, count*sizeof(rl_Vector2));
+            strip[1] = strip[2];
+            spline.vertexCount += count + 2;
         }
+    }
 
-        points[2*i + 1].x = current.x - dy*size;
-        points[2*i + 1].y = current.y + dx*size;
-        points[2*i].x = current.x + dy*size;
-        points[2*i].y = current.y - dx*size;
+    spline.thick = thick;
 
-        previous = current;
+    // B-Spline and Catmull-Rom splines are drawn with circle caps
+    if ((type == SPLINE_BASIS) || (type == SPLINE_CATMULLROM))
+    {
+        rl_Vector2 first[4] = { 0 };
+        rl_Vector2 last[4] = { 0 };
+        GetSplineSegmentBezier(type, points, first);
+        GetSplineSegmentBezier(type, points + segmentCount - 1, last);
+
+        spline.capCount = 2;
+        spline.caps[0] = first[0];
+        spline.caps[1] = last[3];
     }
 
-    rl_DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+    return spline;
 }
 
-// Draw spline segment: Cubic Bezier, 2 points, 2 control points
-void rl_DrawSplineSegmentBezierCubic(rl_Vector2 p1, rl_Vector2 c2, rl_Vector2 c3, rl_Vector2 p4, float thick, rl_Color color)
+// Load line strip stroke with joins and caps, stroked once as a triangle strip
+// NOTE: Stroke is drawn with rl_DrawSpline(), static line strips are drawn with no stroking
+rl_Spline rl_LoadLineStripStroke(const rl_Vector2 *points, int pointCount, float thick, int join, int cap)
 {
-    const float step = 1.0f/SPLINE_SEGMENT_DIVISIONS;
-
-    rl_Vector2 previous = p1;
-    rl_Vector2 current = { 0 };
-    float t = 0.0f;
+    rl_Spline spline = { 0 };
 
-    rl_Vector2 points[2*SPLINE_SEGMENT_DIVISIONS + 2] = { 0 };
+    if ((points == NULL) || (pointCount < 2) || (thick <= 0.0f)) return spline;
 
-    for (int i = 1; i <= SPLINE_SEGMENT_DIVISIONS; i++)
-    {
-        t = step*(float)i;
+    // First pass counts strip vertex, second pass generates them
+    StrokeBuffer buffer = { 0 };
+    GenLineStripStroke(points, pointCount, thick, join, cap, &buffer);
+    if (buffer.count == 0) return spline;
 
-        float a = powf(1.0f - t, 3);
-        float b = 3.0f*powf(1.0f - t, 2)*t;
-        float c = 3.0f*(1.0f - t)*powf(t, 2);
-        float d = powf(t, 3);
+    buffer.vertices = (rl_Vector2 *)RL_MALLOC(buffer.count*sizeof(rl_Vector2));
+    if (buffer.vertices == NULL) return spline;
 
-        current.y = a*p1.y + b*c2.y + c*c3.y + d*p4.y;
-        current.x = a*p1.x + b*c2.x + c*c3.x + d*p4.x;
+    buffer.capacity = buffer.count;
+    buffer.count = 0;
+    GenLineStripStroke(points, pointCount, thick, join, cap, &buffer);
 
-        float dy = current.y - previous.y;
-        float dx = current.x - previous.x;
-        float size = 0.5f*thick/sqrtf(dx*dx+dy*dy);
+    spline.vertices = buffer.vertices;
+    spline.vertexCount = buffer.count;
+    spline.thick = thick;
 
-        if (i == 1)
-        {
-            points[0].x = previous.x + dy*size;
-            points[0].y = previous.y - dx*size;
-            points[1].x = previous.x - dy*size;
-            points[1].y = previous.y + dx*size;
-        }
+    return spline;
+}
 
-        points[2*i + 1].x = current.x - dy*size;
-        points[2*i + 1].y = current.y + dx*size;
-        points[2*i].x = current.x + dy*size;
-        points[2*i].y = current.y - dx*size;
+// Unload spline vertex data
+void rl_UnloadSpline(rl_Spline spline)
+{
+    RL_FREE(spline.vertices);
+}
 
-        previous = current;
-    }
+// Draw spline, tessellated on loading
+void rl_DrawSpline(rl_Spline spline, rl_Color color)
+{
+    rl_DrawTriangleStrip(spline.vertices, spline.vertexCount, color);
 
-    rl_DrawTriangleStrip(points, 2*SPLINE_SEGMENT_DIVISIONS + 2, color);
+    for (int i = 0; i < spline.capCount; i++) rl_DrawCircleV(spline.caps[i], spline.thick/2.0f, color);
 }
 
 // Get spline point for a given t [0.0f .. 1.0f], Linear
@@ -2312,124 +2913,401 @@ bool rl_CheckCollisionPointPoly(rl_Vector2 point, const rl_Vector2 *points, int
     return collision;
 }
 
-// Check collision between two rectangles
-bool rl_CheckCollisionRecs(rl_Rectangle rec1, rl_Rectangle rec2)
+// Check point against array of rectangles, collided rectangles indices are stored in indices (if not NULL)
+// NOTE: Same test as rl_CheckCollisionPointRec(), 4 rectangles at once with SIMD, returns collisions count
+int rl_CheckCollisionPointRecs(rl_Vector2 point, const rl_Rectangle *recs, int recCount, int *indices)
 {
-    bool collision = false;
+    int count = 0;
+    int i = 0;
 
-    if ((rec1.x < (rec2.x + rec2.width) && (rec1.x + rec1.width) > rec2.x) &&
-        (rec1.y < (rec2.y + rec2.height) && (rec1.y + rec1.height) > rec2.y)) collision = true;
+    if (recs == NULL) return 0;
 
-    return collision;
-}
+#if defined(RSHAPES_SSE2_ENABLED)
+    const __m128 px = _mm_set1_ps(point.x);
+    const __m128 py = _mm_set1_ps(point.y);
 
-// Check collision between two circles
-bool rl_CheckCollisionCircles(rl_Vector2 center1, float radius1, rl_Vector2 center2, float radius2)
-{
-    bool collision = false;
+    for (; (i + 4) <= recCount; i += 4)
+    {
+        // Rectangles transposed to x, y, width, height lanes
+        __m128 x = _mm_loadu_ps(&recs[i].x);
+        __m128 y = _mm_loadu_ps(&recs[i + 1].x);
+        __m128 width = _mm_loadu_ps(&recs[i + 2].x);
+        __m128 height = _mm_loadu_ps(&recs[i + 3].x);
+        _MM_TRANSPOSE4_PS(x, y, width, height);
 
-    float dx = center2.x - center1.x;      // X distance between centers
-    float dy = center2.y - center1.y;      // Y distance between centers
+        __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(px, x), _mm_cmplt_ps(px, _mm_add_ps(x, width))),
+                                   _mm_and_ps(_mm_cmpge_ps(py, y), _mm_cmplt_ps(py, _mm_add_ps(y, height))));
 
-    float distanceSquared = dx*dx + dy*dy; // Distance between centers squared
-    float radiusSum = radius1 + radius2;
+        count = AddCollisionIndices(indices, count, i, _mm_movemask_ps(inside));
+    }
+#elif defined(RSHAPES_NEON_ENABLED)
+    const float32x4_t px = vdupq_n_f32(point.x);
+    const float32x4_t py = vdupq_n_f32(point.y);
 
-    collision = (distanceSquared <= (radiusSum*radiusSum));
+    for (; (i + 4) <= recCount; i += 4)
+    {
+        // Rectangles deinterleaved to x, y, width, height lanes
+        float32x4x4_t rec = vld4q_f32(&recs[i].x);
 
-    return collision;
+        uint32x4_t inside = vandq_u32(vandq_u32(vcgeq_f32(px, rec.val[0]), vcltq_f32(px, vaddq_f32(rec.val[0], rec.val[2]))),
+                                      vandq_u32(vcgeq_f32(py, rec.val[1]), vcltq_f32(py, vaddq_f32(rec.val[1], rec.val[3]))));
+
+        count = AddCollisionIndices(indices, count, i, GetCollisionMaskNeon(inside));
+    }
+#endif
+
+    for (; i < recCount; i++)
+    {
+        if (rl_CheckCollisionPointRec(point, recs[i])) count = AddCollisionIndices(indices, count, i, 1);
+    }
+
+    return count;
 }
 
-// Check collision between circle and rectangle
-// NOTE: Reviewed version to take into account corner limit case
-bool rl_CheckCollisionCircleRec(rl_Vector2 center, float radius, rl_Rectangle rec)
+// Check point against arrays of circles centers and radius, collided circles indices are stored in indices (if not NULL)
+// NOTE: Same test as rl_CheckCollisionPointCircle(), 4 circles at once with SIMD, returns collisions count
+int rl_CheckCollisionPointCircles(rl_Vector2 point, const rl_Vector2 *centers, const float *radius, int circleCount, int *indices)
 {
-    bool collision = false;
+    int count = 0;
+    int i = 0;
 
-    float recCenterX = rec.x + rec.width/2.0f;
-    float recCenterY = rec.y + rec.height/2.0f;
+    if ((centers == NULL) || (radius == NULL)) return 0;
 
-    float dx = fabsf(center.x - recCenterX);
-    float dy = fabsf(center.y - recCenterY);
+#if defined(RSHAPES_SSE2_ENABLED)
+    const __m128 px = _mm_set1_ps(point.x);
+    const __m128 py = _mm_set1_ps(point.y);
 
-    if (dx > (rec.width/2.0f + radius)) { return false; }
-    if (dy > (rec.height/2.0f + radius)) { return false; }
+    for (; (i + 4) <= circleCount; i += 4)
+    {
+        __m128 c01 = _mm_loadu_ps(&centers[i].x);
+        __m128 c23 = _mm_loadu_ps(&centers[i + 2].x);
+        __m128 r = _mm_loadu_ps(radius + i);
 
-    if (dx <= (rec.width/2.0f)) { return true; }
-    if (dy <= (rec.height/2.0f)) { return true; }
+        __m128 dx = _mm_sub_ps(px, _mm_shuffle_ps(c01, c23, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128 dy = _mm_sub_ps(py, _mm_shuffle_ps(c01, c23, _MM_SHUFFLE(3, 1, 3, 1)));
+        __m128 inside = _mm_cmple_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(r, r));
 
-    float cornerDistanceSq = (dx - rec.width/2.0f)*(dx - rec.width/2.0f) +
-                             (dy - rec.height/2.0f)*(dy - rec.height/2.0f);
+        count = AddCollisionIndices(indices, count, i, _mm_movemask_ps(inside));
+    }
+#elif defined(RSHAPES_NEON_ENABLED)
+    const float32x4_t px = vdupq_n_f32(point.x);
+    const float32x4_t py = vdupq_n_f32(point.y);
 
-    collision = (cornerDistanceSq <= (radius*radius));
+    for (; (i + 4) <= circleCount; i += 4)
+    {
+        float32x4x2_t center = vld2q_f32(&centers[i].x);
+        float32x4_t r = vld1q_f32(radius + i);
 
-    return collision;
+        float32x4_t dx = vsubq_f32(px, center.val[0]);
+        float32x4_t dy = vsubq_f32(py, center.val[1]);
+        uint32x4_t inside = vcleq_f32(vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy)), vmulq_f32(r, r));
+
+        count = AddCollisionIndices(indices, count, i, GetCollisionMaskNeon(inside));
+    }
+#endif
+
+    for (; i < circleCount; i++)
+    {
+        if (rl_CheckCollisionPointCircle(point, centers[i], radius[i])) count = AddCollisionIndices(indices, count, i, 1);
+    }
+
+    return count;
 }
 
-// Check the collision between two lines defined by two points each, returns collision point by reference
-bool rl_CheckCollisionLines(rl_Vector2 startPos1, rl_Vector2 endPos1, rl_Vector2 startPos2, rl_Vector2 endPos2, rl_Vector2 *collisionPoint)
+// Check array of points against rectangle, collided points indices are stored in indices (if not NULL)
+// NOTE: Same test as rl_CheckCollisionPointRec(), 4 points at once with SIMD, returns collisions count
+int rl_CheckCollisionPointsRec(const rl_Vector2 *points, int pointCount, rl_Rectangle rec, int *indices)
 {
-    bool collision = false;
+    int count = 0;
+    int i = 0;
 
-    float div = (endPos2.y - startPos2.y)*(endPos1.x - startPos1.x) - (endPos2.x - startPos2.x)*(endPos1.y - startPos1.y);
+    if (points == NULL) return 0;
 
-    if (fabsf(div) >= FLT_EPSILON)
-    {
-        collision = true;
+#if defined(RSHAPES_SSE2_ENABLED)
+    const __m128 minX = _mm_set1_ps(rec.x);
+    const __m128 minY = _mm_set1_ps(rec.y);
+    const __m128 maxX = _mm_set1_ps(rec.x + rec.width);
+    const __m128 maxY = _mm_set1_ps(rec.y + rec.height);
 
-        float xi = ((startPos2.x - endPos2.x)*(startPos1.x*endPos1.y - startPos1.y*endPos1.x) - (startPos1.x - endPos1.x)*(startPos2.x*endPos2.y - startPos2.y*endPos2.x))/div;
-        float yi = ((startPos2.y - endPos2.y)*(startPos1.x*endPos1.y - startPos1.y*endPos1.x) - (startPos1.y - endPos1.y)*(startPos2.x*endPos2.y - startPos2.y*endPos2.x))/div;
+    for (; (i + 4) <= pointCount; i += 4)
+    {
+        __m128 p01 = _mm_loadu_ps(&points[i].x);
+        __m128 p23 = _mm_loadu_ps(&points[i + 2].x);
+        __m128 x = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 y = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1));
 
-        if (((fabsf(startPos1.x - endPos1.x) > FLT_EPSILON) && (xi < fminf(startPos1.x, endPos1.x) || (xi > fmaxf(startPos1.x, endPos1.x)))) ||
-            ((fabsf(startPos2.x - endPos2.x) > FLT_EPSILON) && (xi < fminf(startPos2.x, endPos2.x) || (xi > fmaxf(startPos2.x, endPos2.x)))) ||
-            ((fabsf(startPos1.y - endPos1.y) > FLT_EPSILON) && (yi < fminf(startPos1.y, endPos1.y) || (yi > fmaxf(startPos1.y, endPos1.y)))) ||
-            ((fabsf(startPos2.y - endPos2.y) > FLT_EPSILON) && (yi < fminf(startPos2.y, endPos2.y) || (yi > fmaxf(startPos2.y, endPos2.y))))) collision = false;
+        __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(x, minX), _mm_cmplt_ps(x, maxX)),
+                                   _mm_and_ps(_mm_cmpge_ps(y, minY), _mm_cmplt_ps(y, maxY)));
 
-        if (collision && (collisionPoint != 0))
-        {
-            collisionPoint->x = xi;
-            collisionPoint->y = yi;
-        }
+        count = AddCollisionIndices(indices, count, i, _mm_movemask_ps(inside));
     }
+#elif defined(RSHAPES_NEON_ENABLED)
+    const float32x4_t minX = vdupq_n_f32(rec.x);
+    const float32x4_t minY = vdupq_n_f32(rec.y);
+    const float32x4_t maxX = vdupq_n_f32(rec.x + rec.width);
+    const float32x4_t maxY = vdupq_n_f32(rec.y + rec.height);
 
-    return collision;
-}
+    for (; (i + 4) <= pointCount; i += 4)
+    {
+        float32x4x2_t point = vld2q_f32(&points[i].x);
 
-// Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]
-bool rl_CheckCollisionPointLine(rl_Vector2 point, rl_Vector2 p1, rl_Vector2 p2, int threshold)
-{
-    bool collision = false;
+        uint32x4_t inside = vandq_u32(vandq_u32(vcgeq_f32(point.val[0], minX), vcltq_f32(point.val[0], maxX)),
+                                      vandq_u32(vcgeq_f32(point.val[1], minY), vcltq_f32(point.val[1], maxY)));
 
-    float dxc = point.x - p1.x;
-    float dyc = point.y - p1.y;
-    float dxl = p2.x - p1.x;
-    float dyl = p2.y - p1.y;
-    float cross = dxc*dyl - dyc*dxl;
+        count = AddCollisionIndices(indices, count, i, GetCollisionMaskNeon(inside));
+    }
+#endif
 
-    if (fabsf(cross) < (threshold*fmaxf(fabsf(dxl), fabsf(dyl))))
+    for (; i < pointCount; i++)
     {
-        if (fabsf(dxl) >= fabsf(dyl)) collision = (dxl > 0)? ((p1.x <= point.x) && (point.x <= p2.x)) : ((p2.x <= point.x) && (point.x <= p1.x));
-        else collision = (dyl > 0)? ((p1.y <= point.y) && (point.y <= p2.y)) : ((p2.y <= point.y) && (point.y <= p1.y));
+        if (rl_CheckCollisionPointRec(points[i], rec)) count = AddCollisionIndices(indices, count, i, 1);
     }
 
-    return collision;
+    return count;
 }
 
-// Check if circle collides with a line created between two points [p1] and [p2]
-bool rl_CheckCollisionCircleLine(rl_Vector2 center, float radius, rl_Vector2 p1, rl_Vector2 p2)
+// Check array of points against circle, collided points indices are stored in indices (if not NULL)
+// NOTE: Same test as rl_CheckCollisionPointCircle(), 4 points at once with SIMD, returns collisions count
+int rl_CheckCollisionPointsCircle(const rl_Vector2 *points, int pointCount, rl_Vector2 center, float radius, int *indices)
 {
-    float dx = p1.x - p2.x;
-    float dy = p1.y - p2.y;
+    int count = 0;
+    int i = 0;
 
-    if ((fabsf(dx) + fabsf(dy)) <= FLT_EPSILON)
+    if (points == NULL) return 0;
+
+#if defined(RSHAPES_SSE2_ENABLED)
+    const __m128 cx = _mm_set1_ps(center.x);
+    const __m128 cy = _mm_set1_ps(center.y);
+    const __m128 radiusSquared = _mm_set1_ps(radius*radius);
+
+    for (; (i + 4) <= pointCount; i += 4)
     {
-        return rl_CheckCollisionCircles(p1, 0, center, radius);
-    }
+        __m128 p01 = _mm_loadu_ps(&points[i].x);
+        __m128 p23 = _mm_loadu_ps(&points[i + 2].x);
+        __m128 dx = _mm_sub_ps(_mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0)), cx);
+        __m128 dy = _mm_sub_ps(_mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1)), cy);
 
-    float lengthSQ = ((dx*dx) + (dy*dy));
-    float dotProduct = (((center.x - p1.x)*(p2.x - p1.x)) + ((center.y - p1.y)*(p2.y - p1.y)))/(lengthSQ);
+        __m128 inside = _mm_cmple_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), radiusSquared);
 
-    if (dotProduct > 1.0f) dotProduct = 1.0f;
-    else if (dotProduct < 0.0f) dotProduct = 0.0f;
+        count = AddCollisionIndices(indices, count, i, _mm_movemask_ps(inside));
+    }
+#elif defined(RSHAPES_NEON_ENABLED)
+    const float32x4_t cx = vdupq_n_f32(center.x);
+    const float32x4_t cy = vdupq_n_f32(center.y);
+    const float32x4_t radiusSquared = vdupq_n_f32(radius*radius);
+
+    for (; (i + 4) <= pointCount; i += 4)
+    {
+        float32x4x2_t point = vld2q_f32(&points[i].x);
+        float32x4_t dx = vsubq_f32(point.val[0], cx);
+        float32x4_t dy = vsubq_f32(point.val[1], cy);
+
+        uint32x4_t inside = vcleq_f32(vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy)), radiusSquared);
+
+        count = AddCollisionIndices(indices, count, i, GetCollisionMaskNeon(inside));
+    }
+#endif
+
+    for (; i < pointCount; i++)
+    {
+        if (rl_CheckCollisionPointCircle(points[i], center, radius)) count = AddCollisionIndices(indices, count, i, 1);
+    }
+
+    return count;
+}
+
+// Check array of points against polygon described by array of vertices, collided points indices are stored in indices (if not NULL)
+// NOTE: Same test as rl_CheckCollisionPointPoly(), 4 points at once with SIMD, returns collisions count
+int rl_CheckCollisionPointsPoly(const rl_Vector2 *points, int pointCount, const rl_Vector2 *polyPoints, int polyPointCount, int *indices)
+{
+    int count = 0;
+    int i = 0;
+
+    if ((points == NULL) || (polyPoints == NULL) || (polyPointCount <= 2)) return 0;
+
+#if defined(RSHAPES_SSE2_ENABLED)
+    for (; (i + 4) <= pointCount; i += 4)
+    {
+        __m128 p01 = _mm_loadu_ps(&points[i].x);
+        __m128 p23 = _mm_loadu_ps(&points[i + 2].x);
+        __m128 x = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 y = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1));
+        __m128 inside = _mm_setzero_ps();
+
+        // Crossings toggle lanes, horizontal edges division results are discarded by crossing test
+        for (int k = 0, j = polyPointCount - 1; k < polyPointCount; j = k++)
+        {
+            __m128 kx = _mm_set1_ps(polyPoints[k].x);
+            __m128 ky = _mm_set1_ps(polyPoints[k].y);
+
+            __m128 crossing = _mm_xor_ps(_mm_cmpgt_ps(ky, y), _mm_cmpgt_ps(_mm_set1_ps(polyPoints[j].y), y));
+            __m128 edgeX = _mm_add_ps(_mm_div_ps(_mm_mul_ps(_mm_set1_ps(polyPoints[j].x - polyPoints[k].x), _mm_sub_ps(y, ky)),
+                                                 _mm_set1_ps(polyPoints[j].y - polyPoints[k].y)), kx);
+
+            inside = _mm_xor_ps(inside, _mm_and_ps(crossing, _mm_cmplt_ps(x, edgeX)));
+        }
+
+        count = AddCollisionIndices(indices, count, i, _mm_movemask_ps(inside));
+    }
+#elif defined(RSHAPES_NEON_ENABLED)
+    for (; (i + 4) <= pointCount; i += 4)
+    {
+        float32x4x2_t point = vld2q_f32(&points[i].x);
+        uint32x4_t inside = vdupq_n_u32(0);
+
+        // Crossings toggle lanes, horizontal edges division results are discarded by crossing test
+        // NOTE: Division used instead of reciprocal estimate to keep same results as rl_CheckCollisionPointPoly()
+        for (int k = 0, j = polyPointCount - 1; k < polyPointCount; j = k++)
+        {
+            float32x4_t kx = vdupq_n_f32(polyPoints[k].x);
+            float32x4_t ky = vdupq_n_f32(polyPoints[k].y);
+
+            uint32x4_t crossing = veorq_u32(vcgtq_f32(ky, point.val[1]), vcgtq_f32(vdupq_n_f32(polyPoints[j].y), point.val[1]));
+            float32x4_t numerator = vmulq_f32(vdupq_n_f32(polyPoints[j].x - polyPoints[k].x), vsubq_f32(point.val[1], ky));
+            float denominator = polyPoints[j].y - polyPoints[k].y;
+            float32x4_t edgeX = kx;
+
+            if (denominator != 0.0f)
+            {
+                float quotient[4] = { 0 };
+                vst1q_f32(quotient, numerator);
+                for (int l = 0; l < 4; l++) quotient[l] /= denominator;
+                edgeX = vaddq_f32(vld1q_f32(quotient), kx);
+            }
+
+            inside = veorq_u32(inside, vandq_u32(crossing, vcltq_f32(point.val[0], edgeX)));
+        }
+
+        count = AddCollisionIndices(indices, count, i, GetCollisionMaskNeon(inside));
+    }
+#endif
+
+    for (; i < pointCount; i++)
+    {
+        if (rl_CheckCollisionPointPoly(points[i], polyPoints, polyPointCount)) count = AddCollisionIndices(indices, count, i, 1);
+    }
+
+    return count;
+}
+
+// Check collision between two rectangles
+bool rl_CheckCollisionRecs(rl_Rectangle rec1, rl_Rectangle rec2)
+{
+    bool collision = false;
+
+    if ((rec1.x < (rec2.x + rec2.width) && (rec1.x + rec1.width) > rec2.x) &&
+        (rec1.y < (rec2.y + rec2.height) && (rec1.y + rec1.height) > rec2.y)) collision = true;
+
+    return collision;
+}
+
+// Check collision between two circles
+bool rl_CheckCollisionCircles(rl_Vector2 center1, float radius1, rl_Vector2 center2, float radius2)
+{
+    bool collision = false;
+
+    float dx = center2.x - center1.x;      // X distance between centers
+    float dy = center2.y - center1.y;      // Y distance between centers
+
+    float distanceSquared = dx*dx + dy*dy; // Distance between centers squared
+    float radiusSum = radius1 + radius2;
+
+    collision = (distanceSquared <= (radiusSum*radiusSum));
+
+    return collision;
+}
+
+// Check collision between circle and rectangle
+// NOTE: Reviewed version to take into account corner limit case
+bool rl_CheckCollisionCircleRec(rl_Vector2 center, float radius, rl_Rectangle rec)
+{
+    bool collision = false;
+
+    float recCenterX = rec.x + rec.width/2.0f;
+    float recCenterY = rec.y + rec.height/2.0f;
+
+    float dx = fabsf(center.x - recCenterX);
+    float dy = fabsf(center.y - recCenterY);
+
+    if (dx > (rec.width/2.0f + radius)) { return false; }
+    if (dy > (rec.height/2.0f + radius)) { return false; }
+
+    if (dx <= (rec.width/2.0f)) { return true; }
+    if (dy <= (rec.height/2.0f)) { return true; }
+
+    float cornerDistanceSq = (dx - rec.width/2.0f)*(dx - rec.width/2.0f) +
+                             (dy - rec.height/2.0f)*(dy - rec.height/2.0f);
+
+    collision = (cornerDistanceSq <= (radius*radius));
+
+    return collision;
+}
+
+// Check the collision between two lines defined by two points each, returns collision point by reference
+bool rl_CheckCollisionLines(rl_Vector2 startPos1, rl_Vector2 endPos1, rl_Vector2 startPos2, rl_Vector2 endPos2, rl_Vector2 *collisionPoint)
+{
+    bool collision = false;
+
+    float div = (endPos2.y - startPos2.y)*(endPos1.x - startPos1.x) - (endPos2.x - startPos2.x)*(endPos1.y - startPos1.y);
+
+    if (fabsf(div) >= FLT_EPSILON)
+    {
+        collision = true;
+
+        float xi = ((startPos2.x - endPos2.x)*(startPos1.x*endPos1.y - startPos1.y*endPos1.x) - (startPos1.x - endPos1.x)*(startPos2.x*endPos2.y - startPos2.y*endPos2.x))/div;
+        float yi = ((startPos2.y - endPos2.y)*(startPos1.x*endPos1.y - startPos1.y*endPos1.x) - (startPos1.y - endPos1.y)*(startPos2.x*endPos2.y - startPos2.y*endPos2.x))/div;
+
+        if (((fabsf(startPos1.x - endPos1.x) > FLT_EPSILON) && (xi < fminf(startPos1.x, endPos1.x) || (xi > fmaxf(startPos1.x, endPos1.x)))) ||
+            ((fabsf(startPos2.x - endPos2.x) > FLT_EPSILON) && (xi < fminf(startPos2.x, endPos2.x) || (xi > fmaxf(startPos2.x, endPos2.x)))) ||
+            ((fabsf(startPos1.y - endPos1.y) > FLT_EPSILON) && (yi < fminf(startPos1.y, endPos1.y) || (yi > fmaxf(startPos1.y, endPos1.y)))) ||
+            ((fabsf(startPos2.y - endPos2.y) > FLT_EPSILON) && (yi < fminf(startPos2.y, endPos2.y) || (yi > fmaxf(startPos2.y, endPos2.y))))) collision = false;
+
+        if (collision && (collisionPoint != 0))
+        {
+            collisionPoint->x = xi;
+            collisionPoint->y = yi;
+        }
+    }
+
+    return collision;
+}
+
+// Check if point belongs to line created between two points [p1] and [p2] with defined margin in pixels [threshold]
+bool rl_CheckCollisionPointLine(rl_Vector2 point, rl_Vector2 p1, rl_Vector2 p2, int threshold)
+{
+    bool collision = false;
+
+    float dxc = point.x - p1.x;
+    float dyc = point.y - p1.y;
+    float dxl = p2.x - p1.x;
+    float dyl = p2.y - p1.y;
+    float cross = dxc*dyl - dyc*dxl;
+
+    if (fabsf(cross) < (threshold*fmaxf(fabsf(dxl), fabsf(dyl))))
+    {
+        if (fabsf(dxl) >= fabsf(dyl)) collision = (dxl > 0)? ((p1.x <= point.x) && (point.x <= p2.x)) : ((p2.x <= point.x) && (point.x <= p1.x));
+        else collision = (dyl > 0)? ((p1.y <= point.y) && (point.y <= p2.y)) : ((p2.y <= point.y) && (point.y <= p1.y));
+    }
+
+    return collision;
+}
+
+// Check if circle collides with a line created between two points [p1] and [p2]
+bool rl_CheckCollisionCircleLine(rl_Vector2 center, float radius, rl_Vector2 p1, rl_Vector2 p2)
+{
+    float dx = p1.x - p2.x;
+    float dy = p1.y - p2.y;
+
+    if ((fabsf(dx) + fabsf(dy)) <= FLT_EPSILON)
+    {
+        return rl_CheckCollisionCircles(p1, 0, center, radius);
+    }
+
+    float lengthSQ = ((dx*dx) + (dy*dy));
+    float dotProduct = (((center.x - p1.x)*(p2.x - p1.x)) + ((center.y - p1.y)*(p2.y - p1.y)))/(lengthSQ);
+
+    if (dotProduct > 1.0f) dotProduct = 1.0f;
+    else if (dotProduct < 0.0f) dotProduct = 0.0f;
 
     float dx2 = (p1.x - (dotProduct*(dx))) - center.x;
     float dy2 = (p1.y - (dotProduct*(dy))) - center.y;
@@ -2483,4 +3361,1251 @@ static float EaseCubicInOut(float t, float b, float c, float d)
     return result;
 }
 
+// Get number of segments to draw a smooth full circle, based on the error rate (usually 0.5f)
+// NOTE: Last radius result is kept, shapes of the same size are usually drawn repeatedly
+static float GetCircleSmoothSegments(float radius)
+{
+    static RL_CONTEXT_LOCAL float lastRadius = 0.0f;
+    static RL_CONTEXT_LOCAL float lastSegments = 0.0f;
+
+    if (radius != lastRadius)
+    {
+        // Calculate the maximum angle between segments based on the error rate
+        float th = acosf(2*powf(1 - SMOOTH_CIRCLE_ERROR_RATE/radius, 2) - 1);
+        lastSegments = ceilf(2*rl_PI/th);
+        lastRadius = radius;
+    }
+
+    return lastSegments;
+}
+
+// Init unit circle points generator, first point at start angle (in degrees)
+static CircleRotation InitCircleRotation(float startAngle, float stepLength)
+{
+    CircleRotation rotation = { 0 };
+
+    rotation.x = cos(rl_DEG2RAD*(double)startAngle);
+    rotation.y = sin(rl_DEG2RAD*(double)startAngle);
+    rotation.cosStep = cos(rl_DEG2RAD*(double)stepLength);
+    rotation.sinStep = sin(rl_DEG2RAD*(double)stepLength);
+
+    return rotation;
+}
+
+// Get unit circle point and rotate to next one
+static rl_Vector2 NextCirclePoint(CircleRotation *rotation)
+{
+    rl_Vector2 point = { (float)rotation->x, (float)rotation->y };
+
+    double x = rotation->x*rotation->cosStep - rotation->y*rotation->sinStep;
+    rotation->y = rotation->x*rotation->sinStep + rotation->y*rotation->cosStep;
+    rotation->x = x;
+
+    return point;
+}
+
+// Draw convex polygon with one pixel alpha fringes, if anti-aliased shapes mode enabled
+// NOTE: Polygon is shrunk half pixel and fringe extends half pixel out, coverage area is kept,
+// points could be provided in any winding order
+static bool DrawShapeAAPolygon(const rl_Vector2 *points, int pointCount, rl_Color color)
+{
+    if (!shapesAAActive || (pointCount < 3)) return false;
+
+    float area = 0.0f;
+    for (int i = 0, j = pointCount - 1; i < pointCount; j = i++) area += points[j].x*points[i].y - points[i].x*points[j].y;
+    if (area == 0.0f) return true;
+
+    // Polygon visited in counter-clockwise drawing order, negative area winding
+    bool reverse = (area > 0.0f);
+    float halfFringe = 0.5f/GetSplineDrawScale();
+
+    rl_Vector2 firstInner = { 0 };
+    rl_Vector2 firstOuter = { 0 };
+    rl_Vector2 prevInner = { 0 };
+    rl_Vector2 prevOuter = { 0 };
+
+    rlBegin(RL_TRIANGLES);
+
+        for (int k = 0; k <= pointCount; k++)
+        {
+            int i = reverse? (pointCount - 1 - k%pointCount) : k%pointCount;
+            int prev = reverse? (i + 1)%pointCount : (i + pointCount - 1)%pointCount;
+            int next = reverse? (i + pointCount - 1)%pointCount : (i + 1)%pointCount;
+
+            rl_Vector2 inner = firstInner;
+            rl_Vector2 outer = firstOuter;
+
+            if (k < pointCount)
+            {
+                // Vertex normal from adjacent edges outward normals, miter length limited
+                rl_Vector2 e0 = { points[i].x - points[prev].x, points[i].y - points[prev].y };
+                rl_Vector2 e1 = { points[next].x - points[i].x, points[next].y - points[i].y };
+                float l0 = sqrtf(e0.x*e0.x + e0.y*e0.y);
+                float l1 = sqrtf(e1.x*e1.x + e1.y*e1.y);
+                if (l0 > 0.0f) { e0.x /= l0; e0.y /= l0; }
+                if (l1 > 0.0f) { e1.x /= l1; e1.y /= l1; }
+
+                rl_Vector2 normal = { -0.5f*(e0.y + e1.y), 0.5f*(e0.x + e1.x) };
+                float lengthSquared = normal.x*normal.x + normal.y*normal.y;
+                float miter = (lengthSquared > 0.01f)? 1.0f/lengthSquared : 100.0f;
+
+                normal.x *= miter*halfFringe;
+                normal.y *= miter*halfFringe;
+
+                inner = (rl_Vector2){ points[i].x - normal.x, points[i].y - normal.y };
+                outer = (rl_Vector2){ points[i].x + normal.x, points[i].y + normal.y };
+            }
+
+            if (k == 0)
+            {
+                firstInner = inner;
+                firstOuter = outer;
+            }
+            else
+            {
+                // Inner polygon fan triangle
+                if (k >= 2)
+                {
+                    rlColor4ub(color.r, color.g, color.b, color.a);
+                    rlVertex2f(firstInner.x, firstInner.y);
+                    rlVertex2f(prevInner.x, prevInner.y);
+                    rlVertex2f(inner.x, inner.y);
+                }
+
+                // Edge fringe quad, alpha falloff to outer vertex
+                rlColor4ub(color.r, color.g, color.b, color.a);
+                rlVertex2f(prevInner.x, prevInner.y);
+                rlColor4ub(color.r, color.g, color.b, 0);
+                rlVertex2f(prevOuter.x, prevOuter.y);
+                rlVertex2f(outer.x, outer.y);
+
+                rlVertex2f(outer.x, outer.y);
+                rlColor4ub(color.r, color.g, color.b, color.a);
+                rlVertex2f(inner.x, inner.y);
+                rlVertex2f(prevInner.x, prevInner.y);
+            }
+
+            prevInner = inner;
+            prevOuter = outer;
+        }
+
+    rlEnd();
+
+    return true;
+}
+
+// Get current drawing scale, screen pixels per drawing unit, considering 2d camera zoom and current transform
+static float GetSplineDrawScale(void)
+{
+    rl_Matrix modelview = rlGetMatrixModelview();
+    rl_Matrix transform = rlGetMatrixTransform();
+
+    float modelviewScale = fmaxf(sqrtf(modelview.m0*modelview.m0 + modelview.m1*modelview.m1), sqrtf(modelview.m4*modelview.m4 + modelview.m5*modelview.m5));
+    float transformScale = fmaxf(sqrtf(transform.m0*transform.m0 + transform.m1*transform.m1), sqrtf(transform.m4*transform.m4 + transform.m5*transform.m5));
+
+    return modelviewScale*transformScale;
+}
+
+// Get spline segments count for points count
+static int GetSplineSegmentCount(int type, int pointCount)
+{
+    int count = 0;
+
+    switch (type)
+    {
+        case SPLINE_BASIS:
+        case SPLINE_CATMULLROM: count = pointCount - 3; break;
+        case SPLINE_BEZIER_QUADRATIC: count = (pointCount - 1)/2; break;
+        case SPLINE_BEZIER_CUBIC: count = (pointCount - 1)/3; break;
+        default: break;
+    }
+
+    return count;
+}
+
+// Get spline segment as cubic Bezier control points, from segment first point
+// NOTE: Curved splines segments are cubic (or lower degree) polynomials, linear splines are stroked
+static void GetSplineSegmentBezier(int type, const rl_Vector2 *points, rl_Vector2 *bezier)
+{
+    switch (type)
+    {
+        case SPLINE_BASIS:
+        {
+            bezier[0] = (rl_Vector2){ (points[0].x + 4.0f*points[1].x + points[2].x)/6.0f, (points[0].y + 4.0f*points[1].y + points[2].y)/6.0f };
+            bezier[1] = (rl_Vector2){ (2.0f*points[1].x + points[2].x)/3.0f, (2.0f*points[1].y + points[2].y)/3.0f };
+            bezier[2] = (rl_Vector2){ (points[1].x + 2.0f*points[2].x)/3.0f, (points[1].y + 2.0f*points[2].y)/3.0f };
+            bezier[3] = (rl_Vector2){ (points[1].x + 4.0f*points[2].x + points[3].x)/6.0f, (points[1].y + 4.0f*points[2].y + points[3].y)/6.0f };
+        } break;
+        case SPLINE_CATMULLROM:
+        {
+            bezier[0] = points[1];
+            bezier[1] = (rl_Vector2){ points[1].x + (points[2].x - points[0].x)/6.0f, points[1].y + (points[2].y - points[0].y)/6.0f };
+            bezier[2] = (rl_Vector2){ points[2].x - (points[3].x - points[1].x)/6.0f, points[2].y - (points[3].y - points[1].y)/6.0f };
+            bezier[3] = points[2];
+        } break;
+        case SPLINE_BEZIER_QUADRATIC:
+        {
+            bezier[0] = points[0];
+            bezier[1] = (rl_Vector2){ points[0].x + 2.0f*(points[1].x - points[0].x)/3.0f, points[0].y + 2.0f*(points[1].y - points[0].y)/3.0f };
+            bezier[2] = (rl_Vector2){ points[2].x + 2.0f*(points[1].x - points[2].x)/3.0f, points[2].y + 2.0f*(points[1].y - points[2].y)/3.0f };
+            bezier[3] = points[2];
+        } break;
+        case SPLINE_BEZIER_CUBIC:
+        {
+            for (int i = 0; i < 4; i++) bezier[i] = points[i];
+        } break;
+        default: break;
+    }
+}
+
+// Get cubic Bezier segment divisions keeping polyline distance to curve under tessellation error (Wang's formula)
+// NOTE: Distance is bounded by 3/4 of control polygon second differences maximum over divisions squared
+static int GetSplineSegmentDivisions(const rl_Vector2 *bezier, float scale)
+{
+    float ddx0 = bezier[0].x - 2.0f*bezier[1].x + bezier[2].x;
+    float ddy0 = bezier[0].y - 2.0f*bezier[1].y + bezier[2].y;
+    float ddx1 = bezier[1].x - 2.0f*bezier[2].x + bezier[3].x;
+    float ddy1 = bezier[1].y - 2.0f*bezier[2].y + bezier[3].y;
+    float dd = fmaxf(sqrtf(ddx0*ddx0 + ddy0*ddy0), sqrtf(ddx1*ddx1 + ddy1*ddy1));
+
+    float divisions = ceilf(sqrtf(0.75f*dd*scale/SPLINE_TESSELLATION_ERROR));
+
+    if (!(divisions >= 1.0f)) return 1;     // NOTE: Also catches NaN
+    if (divisions > SPLINE_SEGMENT_DIVISIONS_MAX) return SPLINE_SEGMENT_DIVISIONS_MAX;
+
+    return (int)divisions;
+}
+
+// Generate cubic Bezier segment triangle strip, vertex are offset along curve normal
+// NOTE: Normal is evaluated from curve derivative, continuous splines segments strips join with no gaps
+static int GenSplineSegmentStrip(const rl_Vector2 *bezier, int divisions, float thick, rl_Vector2 *strip)
+{
+    // Polynomial coefficients: point = ((a*t + b)*t + c)*t + d
+    rl_Vector2 a = { bezier[3].x - bezier[0].x + 3.0f*(bezier[1].x - bezier[2].x), bezier[3].y - bezier[0].y + 3.0f*(bezier[1].y - bezier[2].y) };
+    rl_Vector2 b = { 3.0f*(bezier[0].x - 2.0f*bezier[1].x + bezier[2].x), 3.0f*(bezier[0].y - 2.0f*bezier[1].y + bezier[2].y) };
+    rl_Vector2 c = { 3.0f*(bezier[1].x - bezier[0].x), 3.0f*(bezier[1].y - bezier[0].y) };
+    rl_Vector2 d = bezier[0];
+
+    // Degenerated derivatives (coincident control points) use previous normal, chord direction initially
+    rl_Vector2 normal = { -(bezier[3].y - bezier[0].y), bezier[3].x - bezier[0].x };
+    float length = sqrtf(normal.x*normal.x + normal.y*normal.y);
+    normal = (length > 0.0f)? (rl_Vector2){ normal.x/length, normal.y/length } : (rl_Vector2){ 0.0f, 0.0f };
+
+    for (int i = 0; i <= divisions; i++)
+    {
+        float t = (float)i/(float)divisions;
+
+        rl_Vector2 point = { ((a.x*t + b.x)*t + c.x)*t + d.x, ((a.y*t + b.y)*t + c.y)*t + d.y };
+        rl_Vector2 tangent = { (3.0f*a.x*t + 2.0f*b.x)*t + c.x, (3.0f*a.y*t + 2.0f*b.y)*t + c.y };
+
+        length = sqrtf(tangent.x*tangent.x + tangent.y*tangent.y);
+        if (length > FLT_EPSILON) normal = (rl_Vector2){ -tangent.y/length, tangent.x/length };
+
+        strip[2*i].x = point.x - normal.x*0.5f*thick;
+        strip[2*i].y = point.y - normal.y*0.5f*thick;
+        strip[2*i + 1].x = point.x + normal.x*0.5f*thick;
+        strip[2*i + 1].y = point.y + normal.y*0.5f*thick;
+    }
+
+    return 2*divisions + 2;
+}
+
+// Draw cubic Bezier segment, tessellated for current drawing scale
+static void DrawSplineSegmentBezier(const rl_Vector2 *bezier, float thick, rl_Color color)
+{
+    rl_Vector2 strip[2*SPLINE_SEGMENT_DIVISIONS_MAX + 2] = { 0 };
+
+    int count = GenSplineSegmentStrip(bezier, GetSplineSegmentDivisions(bezier, GetSplineDrawScale()), thick, strip);
+
+    rl_DrawTriangleStrip(strip, count, color);
+}
+
+// Draw SDF shape quad, shape is corner radius or negative ring thickness
+// NOTE: Returns false if SDF shapes mode is not enabled or current transform is not a translation,
+// shape proportions are stored as normal and rlgl transforms normals with current transform
+static bool DrawShapeSDFQuad(rl_Vector2 center, float halfWidth, float halfHeight, float shape, rl_Color color)
+{
+    if (!shapesSdf.active || (halfWidth <= 0.0f) || (halfHeight <= 0.0f)) return false;
+
+    rl_Matrix transform = rlGetMatrixTransform();
+    if ((transform.m0 != 1.0f) || (transform.m1 != 0.0f) || (transform.m2 != 0.0f) ||
+        (transform.m4 != 0.0f) || (transform.m5 != 1.0f) || (transform.m6 != 0.0f) ||
+        (transform.m8 != 0.0f) || (transform.m9 != 0.0f) || (transform.m10 != 1.0f)) return false;
+
+    float x = halfWidth + SHAPES_SDF_MARGIN;
+    float y = halfHeight + SHAPES_SDF_MARGIN;
+
+    rlSetTexture(texShapes.id);
+
+    rlBegin(RL_QUADS);
+
+        rlNormal3f(halfWidth, halfHeight, shape);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+
+        rlTexCoord2f(-x, -y);
+        rlVertex2f(center.x - x, center.y - y);
+
+        rlTexCoord2f(-x, y);
+        rlVertex2f(center.x - x, center.y + y);
+
+        rlTexCoord2f(x, y);
+        rlVertex2f(center.x + x, center.y + y);
+
+        rlTexCoord2f(x, -y);
+        rlVertex2f(center.x + x, center.y - y);
+
+        // Reset normal, following shapes are drawn with default coverage
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+    rlEnd();
+
+    rlSetTexture(0);
+
+    return true;
+}
+
+
+// Add stroke triangle strip vertex, strip is drawn when buffer is full if required
+// NOTE: Drawing continues with last vertex pair, even capacity keeps triangles winding
+static void AddStrokeVertex(StrokeBuffer *buffer, rl_Vector2 vertex)
+{
+    if (buffer->draw && (buffer->count == buffer->capacity))
+    {
+        rl_DrawTriangleStrip(buffer->vertices, buffer->count, buffer->color);
+
+        buffer->vertices[0] = buffer->vertices[buffer->count - 2];
+        buffer->vertices[1] = buffer->vertices[buffer->count - 1];
+        buffer->count = 2;
+    }
+
+    if (buffer->count < buffer->capacity) buffer->vertices[buffer->count] = vertex;
+    buffer->count++;
+}
+
+// Add stroke vertex pair, inner and outer vertex ordered by strip side
+static void AddStrokePair(StrokeBuffer *buffer, rl_Vector2 inner, rl_Vector2 outer, float outerSide)
+{
+    if (outerSide > 0.0f)
+    {
+        AddStrokeVertex(buffer, inner);
+        AddStrokeVertex(buffer, outer);
+    }
+    else
+    {
+        AddStrokeVertex(buffer, outer);
+        AddStrokeVertex(buffer, inner);
+    }
+}
+
+// Add stroke cap at line strip begin or end, direction is line strip direction at cap point
+// NOTE: Round caps use an odd number of divisions, arc vertex are added in pairs from both strip sides
+static void AddStrokeCap(StrokeBuffer *buffer, rl_Vector2 point, rl_Vector2 direction, float halfThick, int cap, bool begin)
+{
+    rl_Vector2 normal = { -direction.y*halfThick, direction.x*halfThick };
+    float sign = begin? -1.0f : 1.0f;
+    int divisions = 0;
+
+    if (cap == LINE_CAP_SQUARE)
+    {
+        point.x += sign*direction.x*halfThick;
+        point.y += sign*direction.y*halfThick;
+    }
+    else if (cap == LINE_CAP_ROUND)
+    {
+        float segments = GetCircleSmoothSegments(halfThick)/2.0f;
+        divisions = (segments > 3.0f)? (int)segments : 3;   // NOTE: Also catches NaN for small radius
+        if ((divisions%2) == 0) divisions++;
+    }
+
+    rl_Vector2 first = { point.x - normal.x, point.y - normal.y };
+    rl_Vector2 second = { point.x + normal.x, point.y + normal.y };
+
+    if (!begin)
+    {
+        AddStrokeVertex(buffer, first);
+        AddStrokeVertex(buffer, second);
+    }
+
+    // Arc vertex pairs, symmetric from strip sides, ordered from strip end towards cap tip
+    for (int k = 1; k <= divisions/2; k++)
+    {
+        int j = begin? (divisions/2 + 1 - k) : k;
+        float c = cosf(rl_PI*(float)j/(float)divisions);
+        float s = sign*sinf(rl_PI*(float)j/(float)divisions)*halfThick;
+
+        AddStrokeVertex(buffer, (rl_Vector2){ point.x - normal.x*c + direction.x*s, point.y - normal.y*c + direction.y*s });
+        AddStrokeVertex(buffer, (rl_Vector2){ point.x + normal.x*c + direction.x*s, point.y + normal.y*c + direction.y*s });
+    }
+
+    if (begin)
+    {
+        AddStrokeVertex(buffer, first);
+        AddStrokeVertex(buffer, second);
+    }
+}
+
+// Add stroke join between incoming and outgoing line strip directions at point
+// NOTE: Inner side vertex is the offset lines intersection when it lies within both segments,
+// otherwise join pivots on point and inner side overlaps segments
+static void AddStrokeJoin(StrokeBuffer *buffer, rl_Vector2 point, rl_Vector2 d0, float length0, rl_Vector2 d1, float length1, float halfThick, int join)
+{
+    rl_Vector2 n0 = { -d0.y, d0.x };
+    rl_Vector2 n1 = { -d1.y, d1.x };
+    float cross = d0.x*d1.y - d0.y*d1.x;
+    float dot = d0.x*d1.x + d0.y*d1.y;
+
+    // Straight line, no join required
+    if ((fabsf(cross) < 1e-6f) && (dot > 0.0f))
+    {
+        AddStrokeVertex(buffer, (rl_Vector2){ point.x - n0.x*halfThick, point.y - n0.y*halfThick });
+        AddStrokeVertex(buffer, (rl_Vector2){ point.x + n0.x*halfThick, point.y + n0.y*halfThick });
+        return;
+    }
+
+    // Outer side is opposite to turn direction: strip second side (+normal) for right turns
+    float side = (cross > 0.0f)? -1.0f : 1.0f;
+
+    rl_Vector2 bisector = { n0.x + n1.x, n0.y + n1.y };
+    float length = sqrtf(bisector.x*bisector.x + bisector.y*bisector.y);
+    float cosHalf = 0.0f;
+
+    if (length > 1e-6f)
+    {
+        bisector.x /= length;
+        bisector.y /= length;
+        cosHalf = bisector.x*n0.x + bisector.y*n0.y;
+    }
+
+    // Offset lines intersection distance along segments from point
+    float reach = (cosHalf > 1e-6f)? halfThick*sqrtf(1.0f - cosHalf*cosHalf)/cosHalf : FLT_MAX;
+    bool intersect = (reach <= length0) && (reach <= length1);
+
+    if (intersect && (join == LINE_JOIN_MITER) && (cosHalf*LINE_STROKE_MITER_LIMIT >= 1.0f))
+    {
+        float miter = halfThick/cosHalf;
+        AddStrokeVertex(buffer, (rl_Vector2){ point.x - bisector.x*miter, point.y - bisector.y*miter });
+        AddStrokeVertex(buffer, (rl_Vector2){ point.x + bisector.x*miter, point.y + bisector.y*miter });
+        return;
+    }
+
+    rl_Vector2 outer0 = { point.x + side*n0.x*halfThick, point.y + side*n0.y*halfThick };
+    rl_Vector2 outer1 = { point.x + side*n1.x*halfThick, point.y + side*n1.y*halfThick };
+    rl_Vector2 inner = point;
+
+    if (intersect) inner = (rl_Vector2){ point.x - side*bisector.x*halfThick/cosHalf, point.y - side*bisector.y*halfThick/cosHalf };
+    else AddStrokePair(buffer, (rl_Vector2){ point.x - side*n0.x*halfThick, point.y - side*n0.y*halfThick }, outer0, side);
+
+    AddStrokePair(buffer, inner, outer0, side);
+
+    // Round join arc, outer offset rotated from incoming to outgoing normal
+    if (join == LINE_JOIN_ROUND)
+    {
+        float angle = atan2f(cross, dot);
+        float segments = GetCircleSmoothSegments(halfThick)*fabsf(angle)/(2.0f*rl_PI);
+        int divisions = (segments > 1.0f)? (int)ceilf(segments) : 1;
+
+        for (int k = 1; k < divisions; k++)
+        {
+            float c = cosf(angle*(float)k/(float)divisions);
+            float s = sinf(angle*(float)k/(float)divisions);
+            rl_Vector2 offset = { side*(n0.x*c - n0.y*s)*halfThick, side*(n0.x*s + n0.y*c)*halfThick };
+
+            AddStrokePair(buffer, inner, (rl_Vector2){ point.x + offset.x, point.y + offset.y }, side);
+        }
+    }
+
+    AddStrokePair(buffer, inner, outer1, side);
+
+    if (!intersect) AddStrokePair(buffer, (rl_Vector2){ point.x - side*n1.x*halfThick, point.y - side*n1.y*halfThick }, outer1, side);
+}
+
+// Generate line strip stroke as a single triangle strip, coincident points are skipped
+static void GenLineStripStroke(const rl_Vector2 *points, int pointCount, float thick, int join, int cap, StrokeBuffer *buffer)
+{
+    float halfThick = 0.5f*thick;
+    int current = 0;
+    int next = 1;
+
+    while ((next < pointCount) && (points[next].x == points[current].x) && (points[next].y == points[current].y)) next++;
+    if (next >= pointCount) return;
+
+    rl_Vector2 direction = { points[next].x - points[current].x, points[next].y - points[current].y };
+    float length = sqrtf(direction.x*direction.x + direction.y*direction.y);
+    direction.x /= length;
+    direction.y /= length;
+
+    AddStrokeCap(buffer, points[current], direction, halfThick, cap, true);
+
+    while (true)
+    {
+        current = next;
+        next = current + 1;
+
+        while ((next < pointCount) && (points[next].x == points[current].x) && (points[next].y == points[current].y)) next++;
+        if (next >= pointCount) break;
+
+        rl_Vector2 nextDirection = { points[next].x - points[current].x, points[next].y - points[current].y };
+        float nextLength = sqrtf(nextDirection.x*nextDirection.x + nextDirection.y*nextDirection.y);
+        nextDirection.x /= nextLength;
+        nextDirection.y /= nextLength;
+
+        AddStrokeJoin(buffer, points[current], direction, length, nextDirection, nextLength, halfThick, join);
+
+        direction = nextDirection;
+        length = nextLength;
+    }
+
+    AddStrokeCap(buffer, points[current], direction, halfThick, cap, false);
+}
+
+// Draw rectangles or pixels instances, instances data is rectangles (stride 16) or positions (stride 8)
+// NOTE: Current batch is drawn first to keep drawing order, returns false if instancing not available
+static bool DrawShapesInstanced(const void *instances, int stride, const rl_Color *colors, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!shapesInstancing.loaded)
+    {
+        shapesInstancing.loaded = true;
+        if (!rlIsInstancingSupported()) return false;
+
+        unsigned int shaderId = rlLoadShaderCode(shapesInstancedVertexShaderCode, shapesInstancedFragmentShaderCode);
+        unsigned int vaoId = rlLoadVertexArray();
+
+        if ((shaderId > 0) && (shaderId != rlGetShaderIdDefault()) && (vaoId > 0))
+        {
+            shapesInstancing.shaderId = shaderId;
+            shapesInstancing.mvpLoc = rlGetLocationUniform(shaderId, "mvp");
+            shapesInstancing.cornerLoc = rlGetLocationAttrib(shaderId, "vertexPosition");
+            shapesInstancing.positionLoc = rlGetLocationAttrib(shaderId, "instancePosition");
+            shapesInstancing.sizeLoc = rlGetLocationAttrib(shaderId, "instanceSize");
+            shapesInstancing.colorLoc = rlGetLocationAttrib(shaderId, "instanceColor");
+
+            // Unit quad corners, same winding as batched quads
+            float corners[8] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f };
+            unsigned short indices[6] = { 0, 1, 2, 0, 2, 3 };
+
+            shapesInstancing.vaoId = vaoId;
+            rlEnableVertexArray(vaoId);
+            shapesInstancing.vboId = rlLoadVertexBuffer(corners, sizeof(corners), false);
+            shapesInstancing.eboId = rlLoadVertexBufferElement(indices, sizeof(indices), false);
+            rlDisableVertexArray();
+        }
+        else
+        {
+            if ((shaderId > 0) && (shaderId != rlGetShaderIdDefault())) rlUnloadShaderProgram(shaderId);
+            if (vaoId > 0) rlUnloadVertexArray(vaoId);
+
+            TRACELOG(LOG_WARNING, "SHAPES: Failed to load instanced shapes shader, shapes drawn with batched quads");
+        }
+    }
+
+    if (shapesInstancing.shaderId == 0) return false;
+
+    // Instances buffers grow to required instances, buffers are reused between draws
+    if (count > shapesInstancing.capacity)
+    {
+        int capacity = (shapesInstancing.capacity*2 > count)? shapesInstancing.capacity*2 : count;
+
+        rlUnloadVertexBuffer(shapesInstancing.instancesVboId);
+        rlUnloadVertexBuffer(shapesInstancing.colorsVboId);
+        shapesInstancing.instancesVboId = rlLoadVertexBuffer(NULL, capacity*sizeof(rl_Rectangle), true);
+        shapesInstancing.colorsVboId = rlLoadVertexBuffer(NULL, capacity*sizeof(rl_Color), true);
+        shapesInstancing.capacity = capacity;
+    }
+
+    rlDrawRenderBatchActive();
+
+    rlUpdateVertexBuffer(shapesInstancing.instancesVboId, instances, count*stride, 0);
+    rlUpdateVertexBuffer(shapesInstancing.colorsVboId, colors, count*sizeof(rl_Color), 0);
+
+    rlEnableShader(shapesInstancing.shaderId);
+    rlSetUniformMatrix(shapesInstancing.mvpLoc, MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection()));
+
+    // Bind quad corners and instances attributes, instances attributes advance once per instance
+    rlEnableVertexArray(shapesInstancing.vaoId);
+    rlEnableVertexBuffer(shapesInstancing.vboId);
+    rlSetVertexAttribute(shapesInstancing.cornerLoc, 2, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(shapesInstancing.cornerLoc);
+
+    rlEnableVertexBuffer(shapesInstancing.instancesVboId);
+    rlSetVertexAttribute(shapesInstancing.positionLoc, 2, RL_FLOAT, false, stride, 0);
+    rlEnableVertexAttribute(shapesInstancing.positionLoc);
+    rlSetVertexAttributeDivisor(shapesInstancing.positionLoc, 1);
+
+    if (stride == sizeof(rl_Rectangle))
+    {
+        rlSetVertexAttribute(shapesInstancing.sizeLoc, 2, RL_FLOAT, false, stride, 2*sizeof(float));
+        rlEnableVertexAttribute(shapesInstancing.sizeLoc);
+        rlSetVertexAttributeDivisor(shapesInstancing.sizeLoc, 1);
+    }
+    else
+    {
+        // Pixels size is provided as attribute default value
+        float size[2] = { 1.0f, 1.0f };
+        rlDisableVertexAttribute(shapesInstancing.sizeLoc);
+        rlSetVertexAttributeDefault(shapesInstancing.sizeLoc, size, SHADER_ATTRIB_VEC2, 2);
+    }
+
+    rlEnableVertexBuffer(shapesInstancing.colorsVboId);
+    rlSetVertexAttribute(shapesInstancing.colorLoc, 4, RL_UNSIGNED_BYTE, true, 0, 0);
+    rlEnableVertexAttribute(shapesInstancing.colorLoc);
+    rlSetVertexAttributeDivisor(shapesInstancing.colorLoc, 1);
+
+    rlEnableVertexBufferElement(shapesInstancing.eboId);
+    rlDrawVertexArrayElementsInstanced(0, 6, 0, count);
+
+    // Reset instances attributes, they could be used by other draws without vertex array objects
+    rlSetVertexAttributeDivisor(shapesInstancing.positionLoc, 0);
+    rlSetVertexAttributeDivisor(shapesInstancing.sizeLoc, 0);
+    rlSetVertexAttributeDivisor(shapesInstancing.colorLoc, 0);
+    rlDisableVertexAttribute(shapesInstancing.cornerLoc);
+    rlDisableVertexAttribute(shapesInstancing.positionLoc);
+    rlDisableVertexAttribute(shapesInstancing.sizeLoc);
+    rlDisableVertexAttribute(shapesInstancing.colorLoc);
+
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableVertexBufferElement();
+    rlDisableShader();
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Get polygon triangle signed area (doubled), negative for contour winding
+static float GetPolygonArea(const PolygonNode *p, const PolygonNode *q, const PolygonNode *r)
+{
+    return (q->y - p->y)*(r->x - q->x) - (q->x - p->x)*(r->y - q->y);
+}
+
+// Check if point is inside triangle, edges included
+static bool CheckPolygonPointTriangle(float ax, float ay, float bx, float by, float cx, float cy, float px, float py)
+{
+    return (((cx - px)*(ay - py) >= (ax - px)*(cy - py)) &&
+            ((ax - px)*(by - py) >= (bx - px)*(ay - py)) &&
+            ((bx - px)*(cy - py) >= (cx - px)*(by - py)));
+}
+
+// Check if point q lies on segment p-r bounding box, points collinear
+static bool CheckPolygonOnSegment(const PolygonNode *p, const PolygonNode *q, const PolygonNode *r)
+{
+    return ((q->x <= fmaxf(p->x, r->x)) && (q->x >= fminf(p->x, r->x)) && (q->y <= fmaxf(p->y, r->y)) && (q->y >= fminf(p->y, r->y)));
+}
+
+// Check if segments p1-q1 and p2-q2 intersect
+static bool CheckPolygonSegments(const PolygonNode *p1, const PolygonNode *q1, const PolygonNode *p2, const PolygonNode *q2)
+{
+    float a1 = GetPolygonArea(p1, q1, p2);
+    float a2 = GetPolygonArea(p1, q1, q2);
+    float a3 = GetPolygonArea(p2, q2, p1);
+    float a4 = GetPolygonArea(p2, q2, q1);
+    int o1 = (a1 > 0.0f) - (a1 < 0.0f);
+    int o2 = (a2 > 0.0f) - (a2 < 0.0f);
+    int o3 = (a3 > 0.0f) - (a3 < 0.0f);
+    int o4 = (a4 > 0.0f) - (a4 < 0.0f);
+
+    if ((o1 != o2) && (o3 != o4)) return true;
+
+    // Collinear cases
+    if ((o1 == 0) && CheckPolygonOnSegment(p1, p2, q1)) return true;
+    if ((o2 == 0) && CheckPolygonOnSegment(p1, q2, q1)) return true;
+    if ((o3 == 0) && CheckPolygonOnSegment(p2, p1, q2)) return true;
+    if ((o4 == 0) && CheckPolygonOnSegment(p2, q1, q2)) return true;
+
+    return false;
+}
+
+// Check if diagonal a-b is locally inside polygon at a
+static bool CheckPolygonLocallyInside(const PolygonNode *a, const PolygonNode *b)
+{
+    if (GetPolygonArea(a->prev, a, a->next) < 0.0f) return ((GetPolygonArea(a, b, a->next) >= 0.0f) && (GetPolygonArea(a, a->prev, b) >= 0.0f));
+    else return ((GetPolygonArea(a, b, a->prev) < 0.0f) || (GetPolygonArea(a, a->next, b) < 0.0f));
+}
+
+// Check if diagonal a-b is a valid triangulation diagonal: inside polygon and not crossing edges
+static bool CheckPolygonDiagonal(const PolygonNode *a, const PolygonNode *b)
+{
+    if ((a->next->index == b->index) || (a->prev->index == b->index)) return false;
+
+    // Diagonal crossing contour edges
+    const PolygonNode *p = a;
+    do
+    {
+        if ((p->index != a->index) && (p->next->index != a->index) && (p->index != b->index) && (p->next->index != b->index) &&
+            CheckPolygonSegments(p, p->next, a, b)) return false;
+        p = p->next;
+    } while (p != a);
+
+    // Diagonal middle point inside polygon
+    bool inside = false;
+    float mx = (a->x + b->x)/2.0f;
+    float my = (a->y + b->y)/2.0f;
+    p = a;
+    do
+    {
+        if (((p->y > my) != (p->next->y > my)) && (p->next->y != p->y) &&
+            (mx < (p->next->x - p->x)*(my - p->y)/(p->next->y - p->y) + p->x)) inside = !inside;
+        p = p->next;
+    } while (p != a);
+
+    bool equal = ((a->x == b->x) && (a->y == b->y));
+
+    return ((CheckPolygonLocallyInside(a, b) && CheckPolygonLocallyInside(b, a) && inside &&
+             ((GetPolygonArea(a->prev, a, b->prev) != 0.0f) || (GetPolygonArea(a, b->prev, b) != 0.0f))) ||
+            (equal && (GetPolygonArea(a->prev, a, a->next) > 0.0f) && (GetPolygonArea(b->prev, b, b->next) > 0.0f)));
+}
+
+// Check if contour node is an ear: convex and no other reflex node inside
+static bool CheckPolygonEar(const PolygonNode *ear)
+{
+    const PolygonNode *a = ear->prev;
+    const PolygonNode *b = ear;
+    const PolygonNode *c = ear->next;
+
+    if (GetPolygonArea(a, b, c) >= 0.0f) return false;
+
+    float minX = fminf(a->x, fminf(b->x, c->x));
+    float minY = fminf(a->y, fminf(b->y, c->y));
+    float maxX = fmaxf(a->x, fmaxf(b->x, c->x));
+    float maxY = fmaxf(a->y, fmaxf(b->y, c->y));
+
+    for (const PolygonNode *p = c->next; p != a; p = p->next)
+    {
+        if ((p->x >= minX) && (p->x <= maxX) && (p->y >= minY) && (p->y <= maxY) &&
+            !((p->x == a->x) && (p->y == a->y)) &&
+            CheckPolygonPointTriangle(a->x, a->y, b->x, b->y, c->x, c->y, p->x, p->y) &&
+            (GetPolygonArea(p->prev, p, p->next) >= 0.0f)) return false;
+    }
+
+    return true;
+}
+
+// Link polygon contour nodes, outer and holes contours opposite winding
+static PolygonNode *LinkPolygonContour(PolygonTriangulator *tri, const rl_Vector2 *points, int start, int count, bool outer)
+{
+    if (count <= 0) return NULL;
+
+    float area = 0.0f;
+    for (int i = start, j = start + count - 1; i < start + count; j = i, i++) area += (points[j].x - points[i].x)*(points[i].y + points[j].y);
+
+    PolygonNode *last = NULL;
+
+    for (int k = 0; k < count; k++)
+    {
+        int i = (outer == (area > 0.0f))? (start + k) : (start + count - 1 - k);
+        PolygonNode *node = &tri->nodes[tri->nodeCount++];
+
+        node->index = i;
+        node->x = points[i].x;
+        node->y = points[i].y;
+
+        if (last == NULL)
+        {
+            node->prev = node;
+            node->next = node;
+        }
+        else
+        {
+            node->next = last->next;
+            node->prev = last;
+            last->next->prev = node;
+            last->next = node;
+        }
+
+        last = node;
+    }
+
+    if ((last->x == last->next->x) && (last->y == last->next->y) && (last->next != last))
+    {
+        last->next->prev = last->prev;
+        last->prev->next = last->next;
+        last = last->next;
+    }
+
+    return last;
+}
+
+// Remove duplicated and collinear contour nodes
+static PolygonNode *FilterPolygonNodes(PolygonNode *start, PolygonNode *end)
+{
+    if (start == NULL) return NULL;
+    if (end == NULL) end = start;
+
+    PolygonNode *p = start;
+    bool again = false;
+
+    do
+    {
+        again = false;
+
+        if (((p->x == p->next->x) && (p->y == p->next->y)) || (GetPolygonArea(p->prev, p, p->next) == 0.0f))
+        {
+            p->next->prev = p->prev;
+            p->prev->next = p->next;
+            p = end = p->prev;
+
+            if (p == p->next) break;
+            again = true;
+        }
+        else p = p->next;
+    } while (again || (p != end));
+
+    return end;
+}
+
+// Split contour in two by diagonal a-b, NULL if no nodes available
+// NOTE: Returns b duplicate, first contour keeps a and second contour b duplicate
+static PolygonNode *SplitPolygonNodes(PolygonTriangulator *tri, PolygonNode *a, PolygonNode *b)
+{
+    if ((tri->nodeCount + 2) > tri->nodeCapacity) return NULL;
+
+    PolygonNode *a2 = &tri->nodes[tri->nodeCount++];
+    PolygonNode *b2 = &tri->nodes[tri->nodeCount++];
+    PolygonNode *an = a->next;
+    PolygonNode *bp = b->prev;
+
+    *a2 = *a;
+    *b2 = *b;
+
+    a->next = b;
+    b->prev = a;
+    a2->next = an;
+    an->prev = a2;
+    b2->next = a2;
+    a2->prev = b2;
+    bp->next = b2;
+    b2->prev = bp;
+
+    return b2;
+}
+
+// Connect hole to outer contour with a bridge from hole leftmost node
+// NOTE: Bridge goes to the outer node visible from hole node, found casting a ray to the left
+static PolygonNode *BridgePolygonHole(PolygonTriangulator *tri, PolygonNode *hole, PolygonNode *outer)
+{
+    PolygonNode *p = outer;
+    PolygonNode *m = NULL;
+    float hx = hole->x;
+    float hy = hole->y;
+    float qx = -INFINITY;
+
+    // Nearest outer edge intersected on the left of the hole node
+    do
+    {
+        if ((hy <= p->y) && (hy >= p->next->y) && (p->next->y != p->y))
+        {
+            float x = p->x + (hy - p->y)*(p->next->x - p->x)/(p->next->y - p->y);
+
+            if ((x <= hx) && (x > qx))
+            {
+                qx = x;
+                m = (p->x < p->next->x)? p : p->next;
+                if (x == hx) break;
+            }
+        }
+
+        p = p->next;
+    } while (p != outer);
+
+    if (m == NULL) return outer;
+
+    // Nodes inside triangle hole-intersection-m could block visibility, nearest angle node is used
+    if (qx != hx)
+    {
+        PolygonNode *stop = m;
+        float mx = m->x;
+        float my = m->y;
+        float tanMin = INFINITY;
+        p = m;
+
+        do
+        {
+            if ((hx >= p->x) && (p->x >= mx) && (hx != p->x) &&
+                CheckPolygonPointTriangle((hy < my)? hx : qx, hy, mx, my, (hy < my)? qx : hx, hy, p->x, p->y))
+            {
+                float tan = fabsf(hy - p->y)/(hx - p->x);
+
+                if (CheckPolygonLocallyInside(p, hole) &&
+                    ((tan < tanMin) || ((tan == tanMin) && ((p->x > m->x) || ((p->x == m->x) &&
+                    (GetPolygonArea(m->prev, m, p->prev) < 0.0f) && (GetPolygonArea(p->next, m, m->next) < 0.0f))))))
+                {
+                    m = p;
+                    tanMin = tan;
+                }
+            }
+
+            p = p->next;
+        } while (p != stop);
+    }
+
+    PolygonNode *bridge = SplitPolygonNodes(tri, m, hole);
+    if (bridge == NULL) return outer;
+
+    FilterPolygonNodes(bridge, bridge->next);
+
+    return FilterPolygonNodes(m, m->next);
+}
+
+// Triangulate contour by ear clipping
+// NOTE: Passes for degenerate contours: filter collinear nodes, cure local self-intersections, split by a valid diagonal
+static void ClipPolygonEars(PolygonTriangulator *tri, PolygonNode *ear, int pass)
+{
+    if (ear == NULL) return;
+
+    PolygonNode *stop = ear;
+
+    while (ear->prev != ear->next)
+    {
+        PolygonNode *prev = ear->prev;
+        PolygonNode *next = ear->next;
+
+        if (CheckPolygonEar(ear))
+        {
+            // Triangle in counter-clockwise order for drawing
+            tri->indices[3*tri->triangleCount] = (unsigned short)prev->index;
+            tri->indices[3*tri->triangleCount + 1] = (unsigned short)next->index;
+            tri->indices[3*tri->triangleCount + 2] = (unsigned short)ear->index;
+            tri->triangleCount++;
+
+            next->prev = prev;
+            prev->next = next;
+
+            ear = next->next;
+            stop = next->next;
+            continue;
+        }
+
+        ear = next;
+
+        if (ear == stop)
+        {
+            if (pass == 0) ClipPolygonEars(tri, FilterPolygonNodes(ear, NULL), 1);
+            else if (pass == 1)
+            {
+                // Cure local self-intersections, a-p-p.next-b crossing edges replaced by triangle a-p-b
+                PolygonNode *start = FilterPolygonNodes(ear, NULL);
+                PolygonNode *p = start;
+
+                do
+                {
+                    PolygonNode *a = p->prev;
+                    PolygonNode *b = p->next->next;
+
+                    if (!((a->x == b->x) && (a->y == b->y)) && CheckPolygonSegments(a, p, p->next, b) &&
+                        CheckPolygonLocallyInside(a, b) && CheckPolygonLocallyInside(b, a))
+                    {
+                        tri->indices[3*tri->triangleCount] = (unsigned short)a->index;
+                        tri->indices[3*tri->triangleCount + 1] = (unsigned short)b->index;
+                        tri->indices[3*tri->triangleCount + 2] = (unsigned short)p->index;
+                        tri->triangleCount++;
+
+                        // Remove p and p.next
+                        a->next = b;
+                        b->prev = a;
+                        p = start = b;
+                    }
+
+                    p = p->next;
+                } while (p != start);
+
+                ClipPolygonEars(tri, FilterPolygonNodes(p, NULL), 2);
+            }
+            else if (pass == 2)
+            {
+                // Split contour in two by a valid diagonal and triangulate both
+                PolygonNode *a = ear;
+
+                do
+                {
+                    for (PolygonNode *b = a->next->next; b != a->prev; b = b->next)
+                    {
+                        if ((a->index != b->index) && CheckPolygonDiagonal(a, b))
+                        {
+                            PolygonNode *c = SplitPolygonNodes(tri, a, b);
+                            if (c == NULL) return;
+
+                            a = FilterPolygonNodes(a, a->next);
+                            c = FilterPolygonNodes(c, c->next);
+
+                            ClipPolygonEars(tri, a, 0);
+                            ClipPolygonEars(tri, c, 0);
+                            return;
+                        }
+                    }
+
+                    a = a->next;
+                } while (a != ear);
+            }
+
+            break;
+        }
+    }
+}
+
+// Add collision indices for 4 elements mask, returns collisions count
+static int AddCollisionIndices(int *indices, int count, int base, int mask)
+{
+    for (int i = 0; mask != 0; i++, mask >>= 1)
+    {
+        if (mask & 1)
+        {
+            if (indices != NULL) indices[count] = base + i;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+#if defined(RSHAPES_NEON_ENABLED)
+// Get 4 elements mask from NEON comparison, bit per lane like _mm_movemask_ps()
+static int GetCollisionMaskNeon(uint32x4_t cmp)
+{
+    const uint32_t laneBits[4] = { 1, 2, 4, 8 };
+    uint32x4_t bits = vandq_u32(cmp, vld1q_u32(laneBits));
+    uint32x2_t sum = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+    sum = vpadd_u32(sum, sum);
+
+    return (int)vget_lane_u32(sum, 0);
+}
+#endif
+
+// Add path command and points, path arrays grow as required
+static void AddPathData(rl_Path *path, int command, const rl_Vector2 *points, int pointCount)
+{
+    if (path == NULL) return;
+
+    if (path->commandCount == path->commandCapacity)
+    {
+        int capacity = (path->commandCapacity > 0)? 2*path->commandCapacity : 16;
+        unsigned char *commands = (unsigned char *)RL_REALLOC(path->commands, capacity);
+        if (commands == NULL) return;
+
+        path->commands = commands;
+        path->commandCapacity = capacity;
+    }
+
+    if ((path->pointCount + pointCount) > path->pointCapacity)
+    {
+        int capacity = (path->pointCapacity > 0)? 2*path->pointCapacity : 32;
+        rl_Vector2 *resized = (rl_Vector2 *)RL_REALLOC(path->points, capacity*sizeof(rl_Vector2));
+        if (resized == NULL) return;
+
+        path->points = resized;
+        path->pointCapacity = capacity;
+    }
+
+    path->commands[path->commandCount++] = (unsigned char)command;
+    for (int i = 0; i < pointCount; i++) path->points[path->pointCount++] = points[i];
+}
+
+// Add path contour point, begin new contour if required, consecutive duplicated points skipped
+static void AddPathContourPoint(PathContours *contours, rl_Vector2 point, bool begin)
+{
+    if (begin)
+    {
+        if (contours->contourCount == contours->contourCapacity)
+        {
+            int capacity = (contours->contourCapacity > 0)? 2*contours->contourCapacity : 8;
+            int *counts = (int *)RL_REALLOC(contours->counts, capacity*sizeof(int));
+            if (counts != NULL) contours->counts = counts;
+            bool *closed = (bool *)RL_REALLOC(contours->closed, capacity*sizeof(bool));
+            if (closed != NULL) contours->closed = closed;
+            if ((counts == NULL) || (closed == NULL)) return;
+
+            contours->contourCapacity = capacity;
+        }
+
+        contours->counts[contours->contourCount] = 0;
+        contours->closed[contours->contourCount] = false;
+        contours->contourCount++;
+    }
+    else
+    {
+        rl_Vector2 last = contours->points[contours->pointCount - 1];
+        if ((last.x == point.x) && (last.y == point.y)) return;
+    }
+
+    if (contours->pointCount == contours->pointCapacity)
+    {
+        int capacity = (contours->pointCapacity > 0)? 2*contours->pointCapacity : 64;
+        rl_Vector2 *points = (rl_Vector2 *)RL_REALLOC(contours->points, capacity*sizeof(rl_Vector2));
+        if (points == NULL) return;
+
+        contours->points = points;
+        contours->pointCapacity = capacity;
+    }
+
+    contours->points[contours->pointCount++] = point;
+    contours->counts[contours->contourCount - 1]++;
+}
+
+// Generate path contours, curves tessellated for drawing scale
+// NOTE: Drawing commands with no current subpath begin a subpath at current point
+static PathContours GenPathContours(rl_Path path, float scale)
+{
+    PathContours contours = { 0 };
+    rl_Vector2 current = { 0 };
+    rl_Vector2 begin = { 0 };
+    bool open = false;
+
+    for (int i = 0, p = 0; i < path.commandCount; i++)
+    {
+        int command = path.commands[i];
+
+        if (command == PATH_CLOSE)
+        {
+            if (open) contours.closed[contours.contourCount - 1] = true;
+            current = begin;
+            open = false;
+            continue;
+        }
+
+        int pointCount = (command == PATH_QUAD_TO)? 2 : (command == PATH_CUBIC_TO)? 3 : 1;
+        if ((p + pointCount) > path.pointCount) break;
+
+        const rl_Vector2 *points = path.points + p;
+        p += pointCount;
+
+        if (command == PATH_MOVE_TO)
+        {
+            current = points[0];
+            begin = current;
+            open = false;
+            continue;
+        }
+
+        if (!open)
+        {
+            AddPathContourPoint(&contours, current, true);
+            begin = current;
+            open = true;
+        }
+
+        if (command == PATH_LINE_TO) AddPathContourPoint(&contours, points[0], false);
+        else
+        {
+            rl_Vector2 bezier[4] = { current, points[0], points[1], points[1] };
+
+            if (command == PATH_QUAD_TO)
+            {
+                rl_Vector2 quadratic[3] = { current, points[0], points[1] };
+                GetSplineSegmentBezier(SPLINE_BEZIER_QUADRATIC, quadratic, bezier);
+            }
+            else bezier[3] = points[2];
+
+            int divisions = GetSplineSegmentDivisions(bezier, scale);
+
+            for (int k = 1; k <= divisions; k++)
+            {
+                AddPathContourPoint(&contours, rl_GetSplinePointBezierCubic(bezier[0], bezier[1], bezier[2], bezier[3], (float)k/divisions), false);
+            }
+        }
+
+        current = points[pointCount - 1];
+    }
+
+    return contours;
+}
+
+// Unload path contours data
+static void UnloadPathContours(PathContours contours)
+{
+    RL_FREE(contours.points);
+    RL_FREE(contours.counts);
+    RL_FREE(contours.closed);
+}
+
+// Compare floats, used for sorting
+static int ComparePathFloat(const void *a, const void *b)
+{
+    float fa = *(const float *)a;
+    float fb = *(const float *)b;
+
+    return (fa > fb) - (fa < fb);
+}
+
+// Compare path edges pointers by order, used for sorting
+static int ComparePathEdge(const void *a, const void *b)
+{
+    float fa = (*(const PathEdge **)a)->order;
+    float fb = (*(const PathEdge **)b)->order;
+
+    return (fa > fb) - (fa < fb);
+}
+
+// Get path fill vertex on edge at y, vertex shared with previous band trapezoid on same edge
+// NOTE: Returns -1 if vertex could not be added (16-bit indices limit)
+static int GetPathEdgeVertex(PathEdge *edge, float y, rl_Polygon *polygon, int *vertexCapacity)
+{
+    if ((edge->vertex >= 0) && (edge->vertexY == y)) return edge->vertex;
+
+    if (polygon->vertexCount == *vertexCapacity)
+    {
+        if (*vertexCapacity >= 65536) return -1;
+
+        int capacity = (*vertexCapacity > 0)? 2**vertexCapacity : 64;
+        if (capacity > 65536) capacity = 65536;
+
+        rl_Vector2 *vertices = (rl_Vector2 *)RL_REALLOC(polygon->vertices, capacity*sizeof(rl_Vector2));
+        if (vertices == NULL) return -1;
+
+        polygon->vertices = vertices;
+        *vertexCapacity = capacity;
+    }
+
+    float x = edge->x0 + (y - edge->y0)*(edge->x1 - edge->x0)/(edge->y1 - edge->y0);
+    if (y == edge->y0) x = edge->x0;
+    else if (y == edge->y1) x = edge->x1;
+
+    polygon->vertices[polygon->vertexCount] = (rl_Vector2){ x, y };
+    edge->vertex = polygon->vertexCount++;
+    edge->vertexY = y;
+
+    return edge->vertex;
+}
+
+// Generate path contours stroke triangle strip, contours strips joined by degenerate triangles
+// NOTE: Closed contours begin and end at first edge middle point with butt caps, joined with no seam
+static void GenPathStroke(const PathContours *contours, float thick, int join, int cap, StrokeBuffer *buffer)
+{
+    for (int i = 0, start = 0; i < contours->contourCount; start += contours->counts[i], i++)
+    {
+        const rl_Vector2 *points = contours->points + start;
+        int count = contours->counts[i];
+        if (count < 2) continue;
+
+        // Degenerate triangles, next strip begins at even vertex to keep triangles winding
+        int first = 0;
+        if (buffer->count > 0)
+        {
+            rl_Vector2 last = (buffer->count <= buffer->capacity)? buffer->vertices[buffer->count - 1] : (rl_Vector2){ 0 };
+            AddStrokeVertex(buffer, last);
+            if ((buffer->count%2) == 0) AddStrokeVertex(buffer, last);
+
+            first = buffer->count;
+            AddStrokeVertex(buffer, last);
+        }
+
+        if (contours->closed[i] && (count > 2))
+        {
+            rl_Vector2 *loop = (rl_Vector2 *)RL_MALLOC((count + 2)*sizeof(rl_Vector2));
+            if (loop == NULL) continue;
+
+            loop[0] = (rl_Vector2){ 0.5f*(points[0].x + points[1].x), 0.5f*(points[0].y + points[1].y) };
+            for (int k = 1; k < count; k++) loop[k] = points[k];
+            loop[count] = points[0];
+            loop[count + 1] = loop[0];
+
+            GenLineStripStroke(loop, count + 2, thick, join, LINE_CAP_BUTT, buffer);
+            RL_FREE(loop);
+        }
+        else GenLineStripStroke(points, count, thick, join, cap, buffer);
+
+        if ((first > 0) && ((first + 1) < buffer->count) && ((first + 1) < buffer->capacity)) buffer->vertices[first] = buffer->vertices[first + 1];
+    }
+}
+
 #endif      // SUPPORT_MODULE_RSHAPES
@@ -10,17 +10,29 @@
 *           Load default raylib font on initialization to be used by rl_DrawText() and rl_MeasureText()
 *           If no default font loaded, rl_DrawTextEx() and rl_MeasureTextEx() are required
 *
+*       #define SUPPORT_LAZY_DEFAULT_FONT
+*           Default font is loaded on first use [rl_GetFontDefault()] instead of window initialization
+*
 *       #define SUPPORT_FILEFORMAT_FNT
 *       #define SUPPORT_FILEFORMAT_TTF
 *       #define SUPPORT_FILEFORMAT_BDF
 *           Selected desired fileformats to be supported for loading. Some of those formats are
 *           supported by default, to remove support, just comment unrequired #define in this module
 *
+*       #define SUPPORT_FILEFORMAT_RFNT
+*           Cooked font file format (.rfnt): glyphs metrics, kerning pairs and atlas image, as saved by
+*           rl_ExportFont(), loaded without glyphs rasterization or atlas packing
+*
 *       #define SUPPORT_FONT_ATLAS_WHITE_REC
 *           On font atlas image generation [rl_GenImageFontAtlas()], add a 3x3 pixels white rectangle
 *           at the bottom-right corner of the atlas. It can be useful to for shapes drawing, to allow
 *           drawing text and shapes with a single draw call [rl_SetShapesTexture()]
 *
+*       #define SUPPORT_FONT_SHAPES_TEXTURE
+*           Fonts atlas with white rectangle (default font, generated and dynamic fonts atlas) are set
+*           as shapes texture while drawing text with them, shapes and text are batched together,
+*           shapes texture provided by user with rl_SetShapesTexture() is not replaced
+*
 *       #define TEXTSPLIT_MAX_TEXT_BUFFER_LENGTH
 *           rl_TextSplit() function static buffer max size
 *
@@ -62,6 +74,7 @@
 
 #if defined(SUPPORT_MODULE_RTEXT)
 
+#define RL_MEMORY_MODULE MEMORY_MODULE_TEXT      // Memory tracking allocations module
 #include "utils.h"          // Required for: LoadFile*()
 #include "rlgl.h"           // OpenGL abstraction layer to OpenGL 1.1, 2.1, 3.3+ or ES2 -> Only rl_DrawTextPro()
 
@@ -70,6 +83,25 @@
 #include <string.h>         // Required for: strcmp(), strstr(), strncpy() [Used in rl_TextReplace()], sscanf() [Used in LoadBMFont()]
 #include <stdarg.h>         // Required for: va_list, va_start(), vsprintf(), va_end() [Used in rl_TextFormat()]
 #include <ctype.h>          // Required for: toupper(), tolower() [Used in rl_TextToUpper(), rl_TextToLower()]
+#include <limits.h>         // Required for: INT_MAX [Used in LoadFontCacheFromMemory()]
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in rl_LoadCodepoints(), rl_GetCodepointCount()]
+    #define RTEXT_SSE2_ENABLED
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #include <arm_neon.h>       // Required for: NEON intrinsics [Used in rl_LoadCodepoints(), rl_GetCodepointCount()]
+    #define RTEXT_NEON_ENABLED
+#endif
+
+// Font atlas cache only supported for generated TTF fonts
+#if defined(SUPPORT_FONT_ATLAS_CACHE) && !defined(SUPPORT_FILEFORMAT_TTF)
+    #undef SUPPORT_FONT_ATLAS_CACHE
+#endif
+
+// Font atlas file (rFNA) shared by font atlas cache and cooked fonts (.rfnt)
+#if defined(SUPPORT_FONT_ATLAS_CACHE) || defined(SUPPORT_FILEFORMAT_RFNT)
+    #define RTEXT_FONT_ATLAS_FILE_ENABLED
+#endif
 
 #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
     #if defined(__GNUC__) // GCC and Clang
@@ -81,6 +113,7 @@
     #include "external/stb_rect_pack.h"     // Required for: ttf/bdf font rectangles packaging
 
     #include <math.h>   // Required for: ttf/bdf font rectangles packaging
+    #include <float.h>  // Required for: FLT_MAX [Used in GenGlyphMSDF()]
 
     #if defined(__GNUC__) // GCC and Clang
         #pragma GCC diagnostic pop
@@ -118,11 +151,205 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: rl_TextSplit()
 #endif
+#ifndef FONT_GLYPH_LOOKUP_DIRECT_SIZE
+    #define FONT_GLYPH_LOOKUP_DIRECT_SIZE        256        // Codepoints indexed directly on font glyphs lookup, others are hashed
+#endif
+#ifndef FONT_DYNAMIC_ATLAS_SIZE
+    #define FONT_DYNAMIC_ATLAS_SIZE             1024        // Dynamic fonts default atlas texture size: rl_LoadFontDynamic()
+#endif
+
+// NOTE: Using some SDF generation default values,
+// trades off precision with ability to handle *smaller* sizes
+#ifndef FONT_SDF_CHAR_PADDING
+    #define FONT_SDF_CHAR_PADDING                  4        // SDF font generation char padding
+#endif
+#ifndef FONT_SDF_ON_EDGE_VALUE
+    #define FONT_SDF_ON_EDGE_VALUE               128        // SDF font generation on edge value
+#endif
+#ifndef FONT_SDF_PIXEL_DIST_SCALE
+    #define FONT_SDF_PIXEL_DIST_SCALE           64.0f       // SDF font generation pixel distance scale
+#endif
+#ifndef FONT_BITMAP_ALPHA_THRESHOLD
+    #define FONT_BITMAP_ALPHA_THRESHOLD           80        // Bitmap (B&W) font generation alpha threshold
+#endif
+#ifndef FONT_MSDF_CURVE_SEGMENTS
+    #define FONT_MSDF_CURVE_SEGMENTS               8        // MSDF font generation segments per glyph curve
+#endif
+#ifndef FONT_GLYPHS_CHUNK_SIZE
+    #define FONT_GLYPHS_CHUNK_SIZE                 8        // Font glyphs generated by a worker thread at once
+#endif
+#ifndef FONT_CACHE_DIRECTORY
+    #define FONT_CACHE_DIRECTORY         "fontcache"        // Font atlas cache directory, relative to storage base path
+#endif
+#ifndef MAX_FILEPATH_LENGTH
+    #if defined(_WIN32)
+        #define MAX_FILEPATH_LENGTH              256        // On Win32, MAX_PATH = 260 (limits.h)
+    #else
+        #define MAX_FILEPATH_LENGTH             4096        // On Linux, PATH_MAX = 4096 by default (limits.h)
+    #endif
+#endif
+
+#ifndef FONT_KERNING_MAX_GLYPHS
+    #define FONT_KERNING_MAX_GLYPHS              512        // Maximum number of font glyphs with all pairs kerning read on font loading
+#endif
+#ifndef TEXT_SHAPING_CACHE_SIZE
+    #define TEXT_SHAPING_CACHE_SIZE               64        // Maximum number of shaped texts layouts cached
+#endif
+#ifndef FONT_SHAPES_TEXTURES_MAX
+    #define FONT_SHAPES_TEXTURES_MAX              32        // Maximum number of fonts atlas used as shapes texture
+#endif
+
+#define FONT_CACHE_VERSION                         3        // Font atlas cache file version, cache keys include it
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Dynamic font data, glyphs rasterized on first use into atlas cells, least recently used glyphs evicted
+typedef struct DynamicFontData {
+    unsigned char *fileData;        // Font file data, required for glyphs rasterization (NULL for free slot)
+    stbtt_fontinfo fontInfo;        // Font info for glyphs rasterization
+    float scaleFactor;              // Font scale factor for font size
+    int ascent;                     // Font ascent scaled to font size (baseline)
+    rl_Font font;                   // Font with glyphs and recs allocated for all atlas cells
+    int cellWidth;                  // Atlas cell width (including padding)
+    int cellHeight;                 // Atlas cell height (including padding)
+    int columns;                    // Atlas cells per row
+    int usedCount;                  // Atlas cells used, free cells are used before evicting glyphs
+    int bucketMask;                 // Cached codepoints hash buckets mask
+    int *buckets;                   // Cached codepoints hash buckets, first cell (-1: empty)
+    int *chain;                     // Next cell on same hash bucket (-1: last)
+    int *prev;                      // Previous cell on use list, more recently used (-1: first)
+    int *next;                      // Next cell on use list, less recently used (-1: last)
+    int first;                      // Most recently used cell
+    int last;                       // Least recently used cell, evicted first
+    unsigned char *cellData;        // Cell upload buffer (GRAY_ALPHA)
+} DynamicFontData;
+
+// Font glyphs generation job, glyphs images generated in parallel
+typedef struct FontGlyphsJob {
+    const stbtt_fontinfo *fontInfo; // Font info for glyphs generation (read-only)
+    rl_GlyphInfo *glyphs;           // Glyphs to generate, codepoint values filled
+    int fontSize;                   // Font size for glyphs generation
+    int type;                       // Font type (rl_FontType)
+    float scaleFactor;              // Font scale factor for font size
+    int ascent;                     // Font ascent (unscaled)
+} FontGlyphsJob;
+
+// Font kerning job, glyphs pairs kerning read in parallel
+typedef struct FontKerningJob {
+    const stbtt_fontinfo *fontInfo; // Font info for kerning reading (read-only)
+    const int *glyphIndices;        // Glyphs indices in font data
+    int count;                      // Number of glyphs, count*count pairs
+    short *values;                  // Pairs kerning (unscaled)
+} FontKerningJob;
+
+// Glyph contour edge (line, quadratic or cubic curve), edges scaled to pixels
+typedef struct GlyphEdge {
+    float x[4];                     // Edge control points x
+    float y[4];                     // Edge control points y
+    int order;                      // Edge order: 1-line, 2-quadratic, 3-cubic
+    bool corner;                    // Edge start is a contour corner
+    int color;                      // Edge channels mask (1-red, 2-green, 4-blue)
+} GlyphEdge;
+
+// Glyph contour edge segment, edges flattened for distance computation
+typedef struct FontEdgeSegment {
+    float ax, ay;                   // Segment start
+    float bx, by;                   // Segment end
+    float invLength;                // Segment inverse length
+    int color;                      // Segment channels mask (from edge)
+    int ends;                       // Segment is edge start (1) and/or edge end (2), pseudo-distance used beyond
+} FontEdgeSegment;
+#endif
+
+// Text layout glyph, quad cached in layout coordinates
+typedef struct TextLayoutGlyph {
+    int codepoint;                  // Glyph codepoint
+    int index;                      // Glyph index in font (at layout load)
+    rl_Vector2 position;            // Glyph pen position in layout
+    rl_Rectangle quad;              // Glyph quad in layout, including glyph padding
+    rl_Rectangle texcoords;         // Glyph texture coordinates: top-left (x, y), bottom-right (width, height)
+    rl_Color color;                 // Glyph color (text span color)
+} TextLayoutGlyph;
+
+// Text layout line, line glyphs and line measures
+typedef struct TextLayoutLine {
+    int firstGlyph;                 // Line first glyph in layout glyphs
+    int glyphCount;                 // Line glyphs count
+    int codepointCount;             // Line codepoints count, including spaces (measured)
+    float textWidth;                // Line width (unscaled, as measured)
+    float width;                    // Line width, lines aligned by width
+} TextLayoutLine;
+
+// Text layout, glyphs positioned once for static texts drawing, text appended laying out last line only
+struct rl_TextLayout {
+    rl_Font font;                   // Layout font (shallow copy)
+    float fontSize;                 // Layout font size
+    float spacing;                  // Layout glyphs spacing
+    float wrapWidth;                // Layout wrap width (0: no wrapping)
+    int lineSpacing;                // Layout line spacing (at layout load)
+    int alignment;                  // Layout lines alignment (rl_TextAlignment)
+    rl_Vector2 size;                // Layout size, measured as rl_MeasureTextEx()
+    TextLayoutGlyph *glyphs;        // Layout glyphs, spaces and line breaks are not stored
+    int glyphCount;                 // Number of layout glyphs
+    int glyphCapacity;              // Layout glyphs allocated
+    TextLayoutLine *lines;          // Layout lines, wrapped lines included
+    int lineCount;                  // Number of layout lines
+    int lineCapacity;               // Layout lines allocated
+    int *tail;                      // Last line source codepoints, laid out again on text append
+    rl_Color *tailColors;           // Last line source codepoints colors
+    int tailCount;                  // Last line source codepoints count
+    int tailCapacity;               // Last line source codepoints allocated
+    float maxTextWidth;             // Completed lines maximum width (unscaled, as measured)
+    int maxLineCodepoints;          // Completed lines maximum codepoints count
+    bool kerning;                   // Layout glyphs kerning applied (text shaping at layout load)
+    bool dynamic;                   // Layout font is a dynamic font, glyphs resolved on drawing
+};
+
+// Shaped text cache entry, text layout shaped for text, font and size
+typedef struct ShapedTextEntry {
+    char *text;                     // Text copy (NULL: free entry)
+    unsigned int hash;              // Text hash
+    unsigned int fontId;            // Font atlas texture id
+    const rl_GlyphInfo *fontGlyphs; // Font glyphs, font identified with atlas texture id
+    float fontSize;                 // Text font size
+    float spacing;                  // Text glyphs spacing
+    int lineSpacing;                // Text line spacing
+    rl_TextLayout *layout;          // Shaped text layout
+    unsigned int lastUsed;          // Last use counter, least recently used entry replaced
+} ShapedTextEntry;
+
+// Font shapes texture entry, font atlas white rectangle used for shapes drawing
+typedef struct FontShapesEntry {
+    unsigned int textureId;         // Font atlas texture id (0: free entry)
+    rl_Rectangle rec;               // Font atlas white rectangle
+} FontShapesEntry;
+
+#if defined(RTEXT_FONT_ATLAS_FILE_ENABLED)
+// Font cache file header, followed by glyphs and atlas pixel data
+typedef struct FontCacheHeader {
+    char id[4];                     // File identifier: "rFNA"
+    int version;                    // Cache file version
+    int baseSize;                   // Font base size
+    int glyphCount;                 // Number of glyphs
+    int glyphPadding;               // Padding around the glyphs in atlas
+    int type;                       // Font type (rl_FontType)
+    int atlasWidth;                 // Atlas image width
+    int atlasHeight;                // Atlas image height
+    int atlasFormat;                // Atlas image pixel format
+    int kerningCount;               // Number of kerning pairs, after atlas pixel data
+} FontCacheHeader;
+
+// Font cache file glyph, glyph metrics and atlas rectangle
+typedef struct FontCacheGlyph {
+    int value;                      // Glyph codepoint
+    int offsetX;                    // Glyph drawing offset X
+    int offsetY;                    // Glyph drawing offset Y
+    int advanceX;                   // Glyph advance X
+    rl_Rectangle rec;               // Glyph rectangle in atlas
+} FontCacheGlyph;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -130,14 +357,111 @@
 #if defined(SUPPORT_DEFAULT_FONT)
 // Default font provided by raylib
 // NOTE: Default font is loaded on rl_InitWindow() and disposed on rl_CloseWindow() [module: core]
-static rl_Font defaultFont = { 0 };
+static RL_CONTEXT_LOCAL rl_Font defaultFont = { 0 };
+#endif
+static RL_CONTEXT_LOCAL int textLineSpacing = 2; // Text vertical line spacing in pixels (between lines)
+static RL_CONTEXT_LOCAL int fontAtlasFormat = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA; // Generated fonts atlas textures pixel format
+
+// Text shaping, shaped texts layouts are cached
+static struct {
+    bool enabled;                   // Text shaping enabled, kerning applied between glyphs
+    ShapedTextEntry entries[TEXT_SHAPING_CACHE_SIZE]; // Shaped texts cache
+    unsigned int useCounter;        // Cache use counter
+} textShaping = { 0 };
+
+#if defined(SUPPORT_FONT_SHAPES_TEXTURE) && defined(SUPPORT_MODULE_RSHAPES)
+// Fonts atlas white rectangles, shapes texture set to font atlas on text drawing
+static RL_CONTEXT_LOCAL FontShapesEntry fontShapes[FONT_SHAPES_TEXTURES_MAX] = { 0 };
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Dynamic fonts, array grows as required
+static struct {
+    DynamicFontData *fonts;         // Dynamic fonts data
+    int capacity;                   // Dynamic fonts allocated
+} dynamicFonts = { 0 };
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// SDF and MSDF fonts shaders, distance edge antialiased with its screen-space derivative
+// NOTE: Shaders use default vertex shader, distance smoothing adapts to any drawing scale
+#if defined(GRAPHICS_API_OPENGL_21)
+    #define TEXT_SHADER_HEADER          "#version 120\n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    #define TEXT_SHADER_HEADER          "#version 330\n"
+#elif defined(GRAPHICS_API_OPENGL_ES3)
+    #define TEXT_SHADER_HEADER          "#version 300 es\nprecision highp float;\n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    #define TEXT_SHADER_HEADER          "#version 100\n#extension GL_OES_standard_derivatives : enable\nprecision mediump float;\n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_21) || (defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3))
+    #define TEXT_SHADER_VARYING         "varying"
+    #define TEXT_SHADER_OUTPUT          ""
+    #define TEXT_SHADER_FRAGCOLOR       "gl_FragColor"
+    #define TEXT_SHADER_TEXTURE         "texture2D"
+#else
+    #define TEXT_SHADER_VARYING         "in"
+    #define TEXT_SHADER_OUTPUT          "out vec4 finalColor;\n"
+    #define TEXT_SHADER_FRAGCOLOR       "finalColor"
+    #define TEXT_SHADER_TEXTURE         "texture"
+#endif
+
+#define TEXT_SHADER_INPUTS TEXT_SHADER_HEADER \
+    TEXT_SHADER_VARYING " vec2 fragTexCoord;\n" \
+    TEXT_SHADER_VARYING " vec4 fragColor;\n" \
+    TEXT_SHADER_OUTPUT \
+    "uniform sampler2D texture0;\n" \
+    "uniform vec4 colDiffuse;\n"
+
+#define TEXT_SHADER_COVERAGE \
+    "    float width = max(fwidth(dist), 0.0001);\n" \
+    "    float alpha = clamp((dist - 128.0/255.0)/width + 0.5, 0.0, 1.0);\n" \
+    "    " TEXT_SHADER_FRAGCOLOR " = vec4(fragColor.rgb*colDiffuse.rgb, fragColor.a*colDiffuse.a*alpha);\n"
+
+// SDF font shader, distance stored in alpha channel (GRAY_ALPHA atlas)
+static const char *textSdfShaderCode = TEXT_SHADER_INPUTS
+    "void main()\n"
+    "{\n"
+    "    float dist = " TEXT_SHADER_TEXTURE "(texture0, fragTexCoord).a;\n"
+    TEXT_SHADER_COVERAGE
+    "}\n";
+
+// MSDF font shader, distance is RGB channels median (RGBA atlas)
+static const char *textMsdfShaderCode = TEXT_SHADER_INPUTS
+    "void main()\n"
+    "{\n"
+    "    vec3 texel = " TEXT_SHADER_TEXTURE "(texture0, fragTexCoord).rgb;\n"
+    "    float dist = max(min(texel.r, texel.g), min(max(texel.r, texel.g), texel.b));\n"
+    TEXT_SHADER_COVERAGE
+    "}\n";
+
+#if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
+// Single channel atlas font shader, glyph coverage stored in red channel (GRAYSCALE atlas)
+// NOTE: Only required without texture swizzle support, single channel atlas is drawn with default shader otherwise
+#define TEXT_SHADER_SINGLE_CHANNEL
+static const char *textSingleChannelShaderCode = TEXT_SHADER_INPUTS
+    "void main()\n"
+    "{\n"
+    "    float alpha = " TEXT_SHADER_TEXTURE "(texture0, fragTexCoord).r;\n"
+    "    " TEXT_SHADER_FRAGCOLOR " = vec4(fragColor.rgb*colDiffuse.rgb, fragColor.a*colDiffuse.a*alpha);\n"
+    "}\n";
+#endif
 #endif
-static int textLineSpacing = 2; // Text vertical line spacing in pixels (between lines)
+
+// SDF, MSDF and single channel atlas fonts shaders, loaded on first use
+static struct {
+    bool loaded[3];                 // Shaders load attempted (SDF, MSDF, single channel)
+    bool ready[3];                  // Shaders available (SDF, MSDF, single channel)
+    rl_Shader shaders[3];           // Shaders (SDF, MSDF, single channel)
+} textShaders = { 0 };
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
-//...
+extern void RunImageWorkerTasks(void (*process)(const void *data, int start, int end), const void *data, int count, int chunkSize); // [Module: textures] Run range tasks on image worker threads
+#if defined(SUPPORT_FONT_ATLAS_CACHE)
+extern const char *GetStorageBasePath(void); // [Module: core] Get storage base path, font cache directory is relative to it
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
@@ -148,11 +472,56 @@ static rl_Font LoadBMFont(const char *fileName);   // Load a BMFont file (AngelC
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static rl_GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, const int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static int *LoadGlyphLookup(const rl_GlyphInfo *glyphs, int glyphCount); // Load glyph index lookup for font glyphs (direct table and hash)
+static int *LoadKerningTable(const int *pairs, int pairCount); // Load kerning table for font glyphs pairs (hash)
+static float GetGlyphKerning(rl_Font font, int index, int codepoint, int nextIndex, int nextCodepoint); // Get kerning between two font glyphs
+static bool IsFontKerningAvailable(rl_Font font); // Check if font provides kerning
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static rl_Font LoadDynamicFontData(unsigned char *fileData, int fontSize, int atlasSize); // Load dynamic font data, file data is owned by dynamic font
+static void UnloadDynamicFontData(DynamicFontData *data); // Unload dynamic font data, font glyphs, atlas texture and file data
+static DynamicFontData *GetDynamicFontData(rl_Font font); // Get dynamic font data, NULL if font is not a dynamic font
+static int GetDynamicFontGlyphIndex(DynamicFontData *data, int codepoint); // Get dynamic font glyph index, glyph rasterized into atlas if not cached
+static void LoadDynamicFontGlyph(DynamicFontData *data, int cell, int codepoint); // Load dynamic font glyph into atlas cell
+static void ProcessFontGlyphsRange(const void *data, int start, int end); // Process font glyphs range, glyphs images generated (worker thread)
+static unsigned char *GenGlyphMSDF(const stbtt_fontinfo *fontInfo, float scale, int codepoint, int *width, int *height, int *offsetX, int *offsetY); // Generate glyph MSDF image (RGBA)
+static void ProcessFontKerningRange(const void *data, int start, int end); // Process font kerning range, glyphs pairs kerning read (worker thread)
+static int *LoadFontKerning(const unsigned char *fileData, int fontSize, const rl_GlyphInfo *glyphs, int glyphCount); // Load font kerning table from TTF font data
+#endif
+static rl_Font LoadFontFromMemoryType(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount, int type); // Load font from memory with font type
+static rl_Texture2D LoadFontAtlasTexture(rl_Image atlas, int type); // Load font atlas texture with fonts atlas pixel format
+static bool BeginFontShader(rl_Font font); // Begin font drawing shader for SDF, MSDF and single channel atlas fonts
+static void DrawFontGlyph(rl_Font font, int index, rl_Vector2 position, float fontSize, rl_Color tint); // Draw font glyph by index
+static void RegisterFontShapesTexture(rl_Texture2D texture, rl_Rectangle rec); // Register font atlas white rectangle for shapes drawing
+static void UnregisterFontShapesTexture(rl_Texture2D texture); // Unregister font atlas, shapes texture reset if font atlas is in use
+static void SetFontShapesTexture(rl_Font font); // Set font atlas as shapes texture, if registered and shapes texture is not user provided
+static void SetTextLayoutGlyphQuad(rl_TextLayout *layout, TextLayoutGlyph *glyph); // Set text layout glyph quad and texture coordinates
+static void AddTextLayoutLine(rl_TextLayout *layout, const int *codepoints, const rl_Color *colors, int count); // Add text layout line, line glyphs positioned
+#if defined(SUPPORT_TEXT_MANIPULATION)
+static int CopyTextToBuffer(char *buffer, int bufferSize, int position, const char *text, int length); // Copy text into buffer at position (truncated), returns next position
+static int CountTextCodepoints(const char *text, int length); // Count UTF-8 text codepoints (SIMD ASCII chunks)
+#endif
+static int DecodeTextCodepoints(const char *text, int length, int *codepoints); // Decode UTF-8 text codepoints (SIMD ASCII chunks)
+static inline int GetCodepointNextFast(const char *text, int *codepointSize); // Get next codepoint, ASCII fast path
+static rl_TextLayout *GetShapedTextLayout(rl_Font font, const char *text, float fontSize, float spacing); // Get shaped text layout from shaping cache
+static void UnloadShapedTextLayouts(rl_Font font); // Unload shaped text layouts for font
+#if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
+static void CopyGlyphToAtlas(rl_Image *atlas, rl_Image glyph, int posX, int posY, int bpp); // Copy glyph image into font atlas (clipped)
+#endif
+#if defined(SUPPORT_FONT_ATLAS_CACHE)
+static void GetFontCachePath(const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount, int type, char *cachePath); // Get font cache file path
+static bool LoadFontCache(const char *cachePath, rl_Font *font, rl_Image *atlas); // Load font glyphs metrics and atlas from font cache file
+#endif
+#if defined(RTEXT_FONT_ATLAS_FILE_ENABLED)
+static bool LoadFontCacheFromMemory(const unsigned char *fileData, int dataSize, rl_Font *font, rl_Image *atlas); // Load font glyphs metrics and atlas from font cache file data
+static bool SaveFontCache(const char *cachePath, rl_Font font, rl_Image atlas); // Save font glyphs metrics and atlas to font cache file
+#endif
 
 #if defined(SUPPORT_DEFAULT_FONT)
 extern void LoadFontDefault(void);
 extern void UnloadFontDefault(void);
 #endif
+extern void UnloadTextShaders(void);
+extern void UnloadTextShapingCache(void);
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -318,6 +687,11 @@ extern void LoadFontDefault(void)
     rl_UnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.glyphLookup = LoadGlyphLookup(defaultFont.glyphs, defaultFont.glyphCount);
+
+    // NOTE: Default font white character is used for shapes drawing, 1px padding avoids pixel bleeding
+    rl_Rectangle rec = defaultFont.recs[95];
+    RegisterFontShapesTexture(defaultFont.texture, (rl_Rectangle){ rec.x + 1, rec.y + 1, rec.width - 2, rec.height - 2 });
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -325,20 +699,53 @@ extern void LoadFontDefault(void)
 // Unload raylib default font
 extern void UnloadFontDefault(void)
 {
+    if (defaultFont.glyphs == NULL) return;     // Not loaded (lazy loading)
+
+    UnregisterFontShapesTexture(defaultFont.texture);
+
     for (int i = 0; i < defaultFont.glyphCount; i++) rl_UnloadImage(defaultFont.glyphs[i].image);
     rl_UnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    RL_FREE(defaultFont.glyphLookup);
     defaultFont.glyphCount = 0;
     defaultFont.glyphs = NULL;
     defaultFont.recs = NULL;
+    defaultFont.glyphLookup = NULL;
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
+// Unload SDF, MSDF and single channel atlas fonts shaders
+// NOTE: Called by rl_CloseWindow(), shaders are loaded again on next SDF font drawing
+extern void UnloadTextShaders(void)
+{
+    for (int i = 0; i < 3; i++) if (textShaders.ready[i]) rl_UnloadShader(textShaders.shaders[i]);
+
+    memset(&textShaders, 0, sizeof(textShaders));
+}
+
+// Unload shaped text layouts cache
+// NOTE: Called by rl_CloseWindow(), text shaping keeps enabled
+extern void UnloadTextShapingCache(void)
+{
+    for (int i = 0; i < TEXT_SHAPING_CACHE_SIZE; i++)
+    {
+        RL_FREE(textShaping.entries[i].text);
+        rl_UnloadTextLayout(textShaping.entries[i].layout);
+    }
+
+    memset(textShaping.entries, 0, sizeof(textShaping.entries));
+    textShaping.useCounter = 0;
+}
+
 // Get the default font, useful to be used with extended parameters
+// NOTE: Default font is loaded on first use if SUPPORT_LAZY_DEFAULT_FONT, graphics device required
 rl_Font rl_GetFontDefault()
 {
 #if defined(SUPPORT_DEFAULT_FONT)
+    #if defined(SUPPORT_LAZY_DEFAULT_FONT)
+    if ((defaultFont.glyphs == NULL) && rl_IsWindowReady()) LoadFontDefault();
+    #endif
     return defaultFont;
 #else
     rl_Font font = { 0 };
@@ -365,6 +772,8 @@ rl_Font rl_LoadFont(const char *fileName)
 
     rl_Font font = { 0 };
 
+    PROFILE_ZONE_BEGIN("rl_LoadFont");
+
 #if defined(SUPPORT_FILEFORMAT_TTF)
     if (rl_IsFileExtension(fileName, ".ttf") || rl_IsFileExtension(fileName, ".otf")) font = rl_LoadFontEx(fileName, FONT_TTF_DEFAULT_SIZE, NULL, FONT_TTF_DEFAULT_NUMCHARS);
     else
@@ -376,6 +785,10 @@ rl_Font rl_LoadFont(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_BDF)
     if (rl_IsFileExtension(fileName, ".bdf")) font = rl_LoadFontEx(fileName, FONT_TTF_DEFAULT_SIZE, NULL, FONT_TTF_DEFAULT_NUMCHARS);
     else
+#endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (rl_IsFileExtension(fileName, ".rfnt")) font = rl_LoadFontEx(fileName, 0, NULL, 0);
+    else
 #endif
     {
         rl_Image image = rl_LoadImage(fileName);
@@ -387,10 +800,13 @@ rl_Font rl_LoadFont(const char *fileName)
     if (font.texture.id == 0) TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load font texture -> Using default font", fileName);
     else
     {
-        rl_SetTextureFilter(font.texture, TEXTURE_FILTER_POINT); // By default, we set point filter (the best performance)
+        // NOTE: Distance fields fonts (cooked fonts) keep bilinear filter, required by distance field shader
+        if (font.type == FONT_DEFAULT) rl_SetTextureFilter(font.texture, TEXTURE_FILTER_POINT); // By default, we set point filter (the best performance)
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
     }
 
+    PROFILE_ZONE_END();
+
     return font;
 }
 
@@ -537,6 +953,7 @@ rl_Font rl_LoadFontFromImage(rl_Image image, rl_Color key, int firstChar)
     rl_UnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -544,55 +961,90 @@ rl_Font rl_LoadFontFromImage(rl_Image image, rl_Color key, int firstChar)
 // Load font from memory buffer, fileType refers to extension: i.e. ".ttf"
 rl_Font rl_LoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount)
 {
-    rl_Font font = { 0 };
-
-    char fileExtLower[16] = { 0 };
-    strncpy(fileExtLower, rl_TextToLower(fileType), 16 - 1);
+    return LoadFontFromMemoryType(fileType, fileData, dataSize, fontSize, codepoints, codepointCount, FONT_DEFAULT);
+}
 
-    font.baseSize = fontSize;
-    font.glyphPadding = 0;
+// Load SDF or MSDF font from file (.ttf/.otf), drawn with distance field shader
+// NOTE: Glyphs generated once at fontSize, distance field keeps edges sharp when drawn scaled
+rl_Font rl_LoadFontSDF(const char *fileName, int fontSize, const int *codepoints, int codepointCount, int type)
+{
+    rl_Font font = { 0 };
 
-#if defined(SUPPORT_FILEFORMAT_TTF)
-    if (rl_TextIsEqual(fileExtLower, ".ttf") ||
-        rl_TextIsEqual(fileExtLower, ".otf"))
+    if ((type != FONT_SDF) && (type != FONT_MSDF))
     {
-        font.glyphs = rl_LoadFontData(fileData, dataSize, font.baseSize, codepoints, (codepointCount > 0)? codepointCount : 95, FONT_DEFAULT, &font.glyphCount);
+        TRACELOG(LOG_WARNING, "FONT: [%s] Font type not supported for distance field font, using SDF", fileName);
+        type = FONT_SDF;
     }
-    else
+
+#if !defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_ES2)
+    TRACELOG(LOG_WARNING, "FONT: [%s] SDF fonts drawing requires OpenGL 3.3 or OpenGL ES 2.0", fileName);
 #endif
-#if defined(SUPPORT_FILEFORMAT_BDF)
-    if (rl_TextIsEqual(fileExtLower, ".bdf"))
+
+    // Loading file to memory
+    int dataSize = 0;
+    unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
     {
-        font.glyphs = LoadFontDataBDF(fileData, dataSize, codepoints, (codepointCount > 0)? codepointCount : 95, &font.baseSize);
-        font.glyphCount = (codepointCount > 0)? codepointCount : 95;
+        // Loading font from memory data
+        font = LoadFontFromMemoryType(rl_GetFileExtension(fileName), fileData, dataSize, fontSize, codepoints, codepointCount, type);
+
+        rl_UnloadFileData(fileData);
     }
-    else
-#endif
+    else font = rl_GetFontDefault();
+
+    return font;
+}
+
+// Load dynamic font from file, glyphs are rasterized on first use into font atlas
+// NOTE: Atlas is made of cells fitting any glyph, least recently used glyphs are evicted when atlas is full
+rl_Font rl_LoadFontDynamic(const char *fileName, int fontSize, int atlasSize)
+{
+    rl_Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    int dataSize = 0;
+    unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
+
+    // NOTE: File data is kept by dynamic font for glyphs rasterization
+    if (fileData != NULL) font = LoadDynamicFontData(fileData, fontSize, atlasSize);
+
+    if (font.texture.id == 0)
     {
-        font.glyphs = NULL;
+        TRACELOG(LOG_WARNING, "FONT: [%s] Failed to load dynamic font -> Using default font", fileName);
+        font = rl_GetFontDefault();
     }
+    else TRACELOG(LOG_INFO, "FONT: [%s] Dynamic font loaded successfully (%i pixel size | %i glyphs cached)", fileName, font.baseSize, font.glyphCount);
+#else
+    TRACELOG(LOG_WARNING, "FONT: [%s] Dynamic fonts require TTF support -> Using default font", fileName);
+    font = rl_GetFontDefault();
+#endif
 
-#if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
-    if (font.glyphs != NULL)
-    {
-        font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+    return font;
+}
 
-        rl_Image atlas = rl_GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
-        font.texture = rl_LoadTextureFromImage(atlas);
+// Load dynamic font from memory buffer (.ttf/.otf data), font data is copied
+rl_Font rl_LoadFontDynamicFromMemory(const unsigned char *fileData, int dataSize, int fontSize, int atlasSize)
+{
+    rl_Font font = { 0 };
 
-        // Update glyphs[i].image to use alpha, required to be used on rl_ImageDrawText()
-        for (int i = 0; i < font.glyphCount; i++)
-        {
-            rl_UnloadImage(font.glyphs[i].image);
-            font.glyphs[i].image = rl_ImageFromImage(atlas, font.recs[i]);
-        }
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    unsigned char *data = (fileData != NULL)? (unsigned char *)RL_MALLOC(dataSize) : NULL;
 
-        rl_UnloadImage(atlas);
+    if (data != NULL)
+    {
+        memcpy(data, fileData, dataSize);
+        font = LoadDynamicFontData(data, fontSize, atlasSize);
+    }
 
-        TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
+    if (font.texture.id == 0)
+    {
+        TRACELOG(LOG_WARNING, "FONT: Failed to load dynamic font -> Using default font");
+        font = rl_GetFontDefault();
     }
-    else font = rl_GetFontDefault();
+    else TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixel size | %i glyphs cached)", font.baseSize, font.glyphCount);
 #else
+    TRACELOG(LOG_WARNING, "FONT: Dynamic fonts require TTF support -> Using default font");
     font = rl_GetFontDefault();
 #endif
 
@@ -611,25 +1063,20 @@ bool rl_IsFontValid(rl_Font font)
     // NOTE: Further validations could be done to verify if recs and glyphs contain valid data (glyphs values, metrics...)
 }
 
+// Set pixel format for generated fonts atlas textures, applied to fonts loaded afterwards
+// NOTE: GRAYSCALE and COMPRESSED_BC4_R atlas store glyphs coverage in a single channel (1/2 and 1/4 of GRAY_ALPHA memory),
+// only default type fonts atlas are converted, SDF/MSDF fonts and dynamic fonts keep their atlas format
+void rl_SetFontAtlasFormat(int format)
+{
+    if ((format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) || (format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
+        (format == PIXELFORMAT_COMPRESSED_BC4_R)) fontAtlasFormat = format;
+    else TRACELOG(LOG_WARNING, "FONT: Atlas pixel format not supported (%i)", format);
+}
+
 // Load font data for further use
-// NOTE: Requires TTF font memory data and can generate SDF data
+// NOTE: Requires TTF font memory data and can generate SDF and MSDF data
 rl_GlyphInfo *rl_LoadFontData(const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount, int type, int *glyphCount)
 {
-    // NOTE: Using some SDF generation default values,
-    // trades off precision with ability to handle *smaller* sizes
-#ifndef FONT_SDF_CHAR_PADDING
-    #define FONT_SDF_CHAR_PADDING            4      // SDF font generation char padding
-#endif
-#ifndef FONT_SDF_ON_EDGE_VALUE
-    #define FONT_SDF_ON_EDGE_VALUE         128      // SDF font generation on edge value
-#endif
-#ifndef FONT_SDF_PIXEL_DIST_SCALE
-    #define FONT_SDF_PIXEL_DIST_SCALE     64.0f     // SDF font generation pixel distance scale
-#endif
-#ifndef FONT_BITMAP_ALPHA_THRESHOLD
-    #define FONT_BITMAP_ALPHA_THRESHOLD     80      // Bitmap (B&W) font generation alpha threshold
-#endif
-
     rl_GlyphInfo *glyphs = NULL;
     int glyphCounter = 0;
 
@@ -677,109 +1124,24 @@ rl_GlyphInfo *rl_LoadFontData(const unsigned char *fileData, int dataSize, int f
             glyphs = (rl_GlyphInfo *)RL_CALLOC(glyphCounter, sizeof(rl_GlyphInfo));
             glyphCounter = 0; // Reset to reuse
 
-            int k = 0;
+            // NOTE: Only storing glyphs for codepoints found in the font
             for (int i = 0; i < codepointCount; i++)
             {
-                int cpWidth = 0, cpHeight = 0;   // Codepoint width and height (on generation)
-                int cp = requiredCodepoints[i];  // Codepoint value to get info for
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                // Check if a glyph is available in the font
-                // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
-                int index = stbtt_FindGlyphIndex(&fontInfo, cp);
-
-                if (index > 0)
-                {
-                    // NOTE: Only storing glyphs for codepoints found in the font
-                    glyphs[k].value = cp;
-
-                    switch (type)
-                    {
-                        case FONT_DEFAULT:
-                        case FONT_BITMAP:
-                        {
-                            glyphs[k].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, cp,
-                                &cpWidth, &cpHeight, &glyphs[k].offsetX, &glyphs[k].offsetY);
-                        } break;
-                        case FONT_SDF:
-                        {
-                            if (cp != 32)
-                            {
-                                glyphs[k].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, cp,
-                                    FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE,
-                                    &cpWidth, &cpHeight, &glyphs[k].offsetX, &glyphs[k].offsetY);
-                            }
-                        } break;
-                        //case FONT_MSDF:
-                        default: break;
-                    }
-
-                    if (glyphs[k].image.data != NULL)    // Glyph data has been found in the font
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, cp, &glyphs[k].advanceX, NULL);
-                        glyphs[k].advanceX = (int)((float)glyphs[k].advanceX*scaleFactor);
-
-                        // WARNING: If requested SDF font, sdf-glyph height is definitely bigger than fontSize due to FONT_SDF_CHAR_PADDING
-                        if ((type != FONT_SDF) && (cpHeight > fontSize)) TRACELOG(LOG_WARNING, "FONT: [0x%04x] Glyph height is bigger than requested font size: %i > %i", cp, cpHeight, (int)fontSize);
-
-                        // Load glyph image
-                        glyphs[k].image.width = cpWidth;
-                        glyphs[k].image.height = cpHeight;
-                        glyphs[k].image.mipmaps = 1;
-                        glyphs[k].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                        glyphs[k].offsetY += (int)((float)ascent*scaleFactor);
-                    }
-                    //else TRACELOG(LOG_WARNING, "FONT: Glyph [0x%08x] has no image data available", cp); // Only reported for 0x20 and 0x3000
-
-                    // We create an empty image for Space character (0x20), useful for sprite font generation
-                    // NOTE: Another space to consider: 0x3000 (CJK - Ideographic Space)
-                    if ((cp == 0x20) || (cp == 0x3000))
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, cp, &glyphs[k].advanceX, NULL);
-                        glyphs[k].advanceX = (int)((float)glyphs[k].advanceX*scaleFactor);
-                        
-                        rl_Image imSpace = {
-                            .data = NULL,
-                            .width = glyphs[k].advanceX,
-                            .height = fontSize,
-                            .mipmaps = 1,
-                            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                        };
-
-                        // Only allocate space image if required
-                        if (glyphs[k].advanceX > 0) imSpace.data = RL_CALLOC(glyphs[k].advanceX*fontSize, 1);
-                        else glyphs[k].advanceX = 0;
-
-                        glyphs[k].image = imSpace;
-                    }
+                if (stbtt_FindGlyphIndex(&fontInfo, requiredCodepoints[i]) > 0) glyphs[glyphCounter++].value = requiredCodepoints[i];
+            }
 
-                    if (type == FONT_BITMAP)
-                    {
-                        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                        // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                        for (int p = 0; p < cpWidth*cpHeight; p++)
-                        {
-                            if (((unsigned char *)glyphs[k].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD)
-                                ((unsigned char *)glyphs[k].image.data)[p] = 0;
-                            else ((unsigned char *)glyphs[k].image.data)[p] = 255;
-                        }
-                    }
+            // Glyphs are generated on worker threads, SDF generation is expensive
+            FontGlyphsJob job = { 0 };
+            job.fontInfo = &fontInfo;
+            job.glyphs = glyphs;
+            job.fontSize = fontSize;
+            job.type = type;
+            job.scaleFactor = scaleFactor;
+            job.ascent = ascent;
 
-                    k++;
-                    glyphCounter++;
-                }
-                else
-                {
-                    // WARNING: Glyph not found on font, optionally use a fallback glyph
-                }
-            }
+            RunImageWorkerTasks(ProcessFontGlyphsRange, &job, glyphCounter, FONT_GLYPHS_CHUNK_SIZE);
 
-            if (glyphCounter < codepointCount) TRACELOG(LOG_WARNING, "FONT: Requested codepoints glyphs found: [%i/%i]", k, codepointCount);
+            if (glyphCounter < codepointCount) TRACELOG(LOG_WARNING, "FONT: Requested codepoints glyphs found: [%i/%i]", glyphCounter, codepointCount);
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
 
@@ -857,9 +1219,12 @@ rl_Image rl_GenImageFontAtlas(const rl_GlyphInfo *glyphs, rl_Rectangle **glyphRe
     }
 #endif
 
+    // NOTE: MSDF glyphs are RGBA, atlas keeps glyphs images format
+    int bpp = (glyphs[0].image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)? 4 : 1;
+
     int atlasDataSize = atlas.width*atlas.height; // Save total size for bounds checking
-    atlas.data = (unsigned char *)RL_CALLOC(atlasDataSize, 1); // Create a bitmap to store characters (8 bpp)
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+    atlas.data = (unsigned char *)RL_CALLOC(atlasDataSize, bpp); // Create a bitmap to store characters (8 bpp or 32 bpp)
+    atlas.format = (bpp == 4)? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
     atlas.mipmaps = 1;
 
     // DEBUG: We can see padding in the generated image setting a gray background...
@@ -873,8 +1238,14 @@ rl_Image rl_GenImageFontAtlas(const rl_GlyphInfo *glyphs, rl_Rectangle **glyphRe
         // NOTE: Using simple packaging, one char after another
         for (int i = 0; i < glyphCount; i++)
         {
+            bool whiteRec = false;
+        #if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+            // NOTE: Glyphs are not packed over bottom-right white rectangle
+            whiteRec = ((offsetX + glyphs[i].image.width + padding) > (atlas.width - 3)) && ((offsetY + glyphs[i].image.height + padding) > (atlas.height - 3));
+        #endif
+
             // Check remaining space for glyph
-            if (offsetX >= (atlas.width - glyphs[i].image.width - 2*padding))
+            if ((offsetX >= (atlas.width - glyphs[i].image.width - 2*padding)) || whiteRec)
             {
                 offsetX = padding;
 
@@ -899,21 +1270,7 @@ rl_Image rl_GenImageFontAtlas(const rl_GlyphInfo *glyphs, rl_Rectangle **glyphRe
             }
 
             // Copy pixel data from glyph image to atlas
-            for (int y = 0; y < glyphs[i].image.height; y++)
-            {
-                for (int x = 0; x < glyphs[i].image.width; x++)
-                {
-                    int destX = offsetX + x;
-                    int destY = offsetY + y;
-
-                    // Security: check both lower and upper bounds
-                    if ((destX >= 0) && (destX < atlas.width) && (destY >= 0) && (destY < atlas.height))
-                    {
-                        ((unsigned char *)atlas.data)[destY*atlas.width + destX] =
-                            ((unsigned char *)glyphs[i].image.data)[y*glyphs[i].image.width + x];
-                    }
-                }
-            }
+            CopyGlyphToAtlas(&atlas, glyphs[i].image, offsetX, offsetY, bpp);
 
             // Fill chars rectangles in atlas info
             recs[i].x = (float)offsetX;
@@ -927,11 +1284,13 @@ rl_Image rl_GenImageFontAtlas(const rl_GlyphInfo *glyphs, rl_Rectangle **glyphRe
     }
     else if (packMethod == 1)  // Use Skyline rect packing algorithm (stb_pack_rect)
     {
-        stbrp_context *context = (stbrp_context *)RL_MALLOC(sizeof(*context));
-        stbrp_node *nodes = (stbrp_node *)RL_MALLOC(glyphCount*sizeof(*nodes));
+        // NOTE: Packing buffers are temporary, allocated from frame arena and released on return
+        MemoryFrameMark mark = GetMemoryFrameMark();
+        stbrp_context *context = (stbrp_context *)rl_MemFrameAlloc(sizeof(*context));
+        stbrp_node *nodes = (stbrp_node *)rl_MemFrameAlloc(glyphCount*sizeof(*nodes));
 
         stbrp_init_target(context, atlas.width, atlas.height, nodes, glyphCount);
-        stbrp_rect *rects = (stbrp_rect *)RL_MALLOC(glyphCount*sizeof(stbrp_rect));
+        stbrp_rect *rects = (stbrp_rect *)rl_MemFrameAlloc(glyphCount*sizeof(stbrp_rect));
 
         // Fill rectangles for packaging
         for (int i = 0; i < glyphCount; i++)
@@ -944,6 +1303,19 @@ rl_Image rl_GenImageFontAtlas(const rl_GlyphInfo *glyphs, rl_Rectangle **glyphRe
         // Package rectangles into atlas
         stbrp_pack_rects(context, rects, glyphCount);
 
+    #if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+        // NOTE: Glyphs are not packed over bottom-right white rectangle, packaged again over reduced height if required
+        for (int i = 0; i < glyphCount; i++)
+        {
+            if (rects[i].was_packed && ((rects[i].x + rects[i].w) > (atlas.width - 3)) && ((rects[i].y + rects[i].h) > (atlas.height - 3)))
+            {
+                stbrp_init_target(context, atlas.width, atlas.height - 3, nodes, glyphCount);
+                stbrp_pack_rects(context, rects, glyphCount);
+                break;
+            }
+        }
+    #endif
+
         for (int i = 0; i < glyphCount; i++)
         {
             // It returns char rectangles in atlas
@@ -955,28 +1327,12 @@ rl_Image rl_GenImageFontAtlas(const rl_GlyphInfo *glyphs, rl_Rectangle **glyphRe
             if (rects[i].was_packed)
             {
                 // Copy pixel data from fc.data to atlas
-                for (int y = 0; y < glyphs[i].image.height; y++)
-                {
-                    for (int x = 0; x < glyphs[i].image.width; x++)
-                    {
-                        int destX = rects[i].x + padding + x;
-                        int destY = rects[i].y + padding + y;
-
-                        // Security fix: check both lower and upper bounds
-                        if (destX >= 0 && destX < atlas.width && destY >= 0 && destY < atlas.height)
-                        {
-                            ((unsigned char *)atlas.data)[destY * atlas.width + destX] =
-                                ((unsigned char *)glyphs[i].image.data)[y * glyphs[i].image.width + x];
-                        }
-                    }
-                }
+                CopyGlyphToAtlas(&atlas, glyphs[i].image, rects[i].x + padding, rects[i].y + padding, bpp);
             }
             else TRACELOG(LOG_WARNING, "FONT: Failed to package character (0x%02x)", glyphs[i].value);
         }
 
-        RL_FREE(rects);
-        RL_FREE(nodes);
-        RL_FREE(context);
+        ReleaseMemoryFrame(mark);
     }
 
 #if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
@@ -987,26 +1343,27 @@ rl_Image rl_GenImageFontAtlas(const rl_GlyphInfo *glyphs, rl_Rectangle **glyphRe
     {
         for (int i = 0, k = atlas.width*atlas.height - 1; i < 3; i++)
         {
-            ((unsigned char *)atlas.data)[k - 0] = 255;
-            ((unsigned char *)atlas.data)[k - 1] = 255;
-            ((unsigned char *)atlas.data)[k - 2] = 255;
+            memset((unsigned char *)atlas.data + (k - 2)*bpp, 255, 3*bpp);
             k -= atlas.width;
         }
     }
 #endif
 
     // Convert image data from GRAYSCALE to GRAY_ALPHA
-    unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
-
-    for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
+    if (bpp == 1)
     {
-        dataGrayAlpha[k] = 255;
-        dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
-    }
+        unsigned char *dataGrayAlpha = (unsigned char *)RL_MALLOC(atlas.width*atlas.height*sizeof(unsigned char)*2); // Two channels
 
-    RL_FREE(atlas.data);
-    atlas.data = dataGrayAlpha;
-    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+        for (int i = 0, k = 0; i < atlas.width*atlas.height; i++, k += 2)
+        {
+            dataGrayAlpha[k] = 255;
+            dataGrayAlpha[k + 1] = ((unsigned char *)atlas.data)[i];
+        }
+
+        RL_FREE(atlas.data);
+        atlas.data = dataGrayAlpha;
+        atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    }
 
     *glyphRecs = recs;
 
@@ -1028,54 +1385,148 @@ void rl_UnloadFontData(rl_GlyphInfo *glyphs, int glyphCount)
 // Unload rl_Font from GPU memory (VRAM)
 void rl_UnloadFont(rl_Font font)
 {
+    UnloadShapedTextLayouts(font);
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic fonts are unloaded with glyphs cache
+    DynamicFontData *data = GetDynamicFontData(font);
+
+    if (data != NULL)
+    {
+        UnloadDynamicFontData(data);
+        TRACELOGD("FONT: Unloaded dynamic font data from RAM and VRAM");
+        return;
+    }
+#endif
+
     // NOTE: Make sure font is not default font (fallback)
     if (font.texture.id != rl_GetFontDefault().texture.id)
     {
+        UnregisterFontShapesTexture(font.texture);
         rl_UnloadFontData(font.glyphs, font.glyphCount);
         rl_UnloadTexture(font.texture);
         RL_FREE(font.recs);
+        RL_FREE(font.glyphLookup);
+        RL_FREE(font.kerning);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
 }
 
-// Export font as code file, returns true on success
-bool rl_ExportFontAsCode(rl_Font font, const char *fileName)
+// Export font as cooked font file (.rfnt), returns true on success
+// NOTE: Atlas is rebuilt from glyphs images at font recs, cooked font is loaded without glyphs rasterization
+bool rl_ExportFont(rl_Font font, const char *fileName)
 {
     bool success = false;
 
-#ifndef TEXT_BYTES_PER_LINE
-    #define TEXT_BYTES_PER_LINE     20
-#endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if ((font.glyphs == NULL) || (font.recs == NULL) || (font.glyphCount <= 0) || (font.texture.width <= 0) || (font.texture.height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Font data not valid to be exported", fileName);
+        return success;
+    }
 
-    #define MAX_FONT_DATA_SIZE      1024*1024       // 1 MB
+    if (!rl_IsFileExtension(fileName, ".rfnt"))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] File format not supported for font export", fileName);
+        return success;
+    }
 
-    // Get file name from path
-    char fileNamePascal[256] = { 0 };
-    strncpy(fileNamePascal, rl_TextToPascal(rl_GetFileNameWithoutExt(fileName)), 256 - 1);
+    // NOTE: Glyphs images share the atlas pixel format, only uncompressed formats can be copied
+    int format = font.glyphs[0].image.format;
+    int bpp = rl_GetPixelDataSize(1, 1, format);
 
-    // NOTE: Text data buffer size is estimated considering image data size in bytes
-    // and requiring 6 char bytes for every byte: "0x00, "
-    char *txtData = (char *)RL_CALLOC(MAX_FONT_DATA_SIZE, sizeof(char));
+    if ((format == 0) || (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] Font glyphs images format not supported for export", fileName);
+        return success;
+    }
 
-    int byteCount = 0;
-    byteCount += sprintf(txtData + byteCount, "////////////////////////////////////////////////////////////////////////////////////////\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "// FontAsCode exporter v1.0 - rl_Font data exported as an array of bytes                 //\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "// more info and bugs-report:  github.com/raysan5/raylib                              //\n");
-    byteCount += sprintf(txtData + byteCount, "// feedback and support:       ray[at]raylib.com                                      //\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "// Copyright (c) 2018-2026 Ramon Santamaria (@raysan5)                                //\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "// ---------------------------------------------------------------------------------- //\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "// TODO: Fill the information and license of the exported font here:                  //\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
-    byteCount += sprintf(txtData + byteCount, "// rl_Font name:    ....                                                                 //\n");
-    byteCount += sprintf(txtData + byteCount, "// rl_Font creator: ....                                                                 //\n");
-    byteCount += sprintf(txtData + byteCount, "// rl_Font LICENSE: ....                                                                 //\n");
-    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    rl_Image atlas = { 0 };
+    atlas.width = font.texture.width;
+    atlas.height = font.texture.height;
+    atlas.mipmaps = 1;
+    atlas.format = format;
+    atlas.data = RL_CALLOC(rl_GetPixelDataSize(atlas.width, atlas.height, format), 1);
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        rl_Image glyph = font.glyphs[i].image;
+        int posX = (int)font.recs[i].x;
+        int posY = (int)font.recs[i].y;
+
+        if ((glyph.data == NULL) || (glyph.format != format)) continue;
+
+        // Glyph rows clipped to atlas bounds
+        int width = ((posX + glyph.width) > atlas.width)? (atlas.width - posX) : glyph.width;
+
+        for (int y = 0; (y < glyph.height) && ((posY + y) < atlas.height) && (width > 0) && (posX >= 0) && (posY >= 0); y++)
+        {
+            memcpy((unsigned char *)atlas.data + ((posY + y)*atlas.width + posX)*bpp, (unsigned char *)glyph.data + y*glyph.width*bpp, width*bpp);
+        }
+    }
+
+#if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+    // Bottom-right 3x3 white rectangle restored, not included in glyphs images
+    if ((atlas.width >= 3) && (atlas.height >= 3))
+    {
+        for (int i = 0, k = atlas.width*atlas.height - 1; i < 3; i++)
+        {
+            memset((unsigned char *)atlas.data + (k - 2)*bpp, 255, 3*bpp);
+            k -= atlas.width;
+        }
+    }
+#endif
+
+    success = SaveFontCache(fileName, font, atlas);
+
+    rl_UnloadImage(atlas);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Font exported successfully", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FONT: [%s] Cooked font file format not supported", fileName);
+#endif
+
+    return success;
+}
+
+// Export font as code file, returns true on success
+bool rl_ExportFontAsCode(rl_Font font, const char *fileName)
+{
+    bool success = false;
+
+#ifndef TEXT_BYTES_PER_LINE
+    #define TEXT_BYTES_PER_LINE     20
+#endif
+
+    #define MAX_FONT_DATA_SIZE      1024*1024       // 1 MB
+
+    // Get file name from path
+    char fileNamePascal[256] = { 0 };
+    strncpy(fileNamePascal, rl_TextToPascal(rl_GetFileNameWithoutExt(fileName)), 256 - 1);
+
+    // NOTE: Text data buffer size is estimated considering image data size in bytes
+    // and requiring 6 char bytes for every byte: "0x00, "
+    char *txtData = (char *)RL_CALLOC(MAX_FONT_DATA_SIZE, sizeof(char));
+
+    int byteCount = 0;
+    byteCount += sprintf(txtData + byteCount, "////////////////////////////////////////////////////////////////////////////////////////\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "// FontAsCode exporter v1.0 - rl_Font data exported as an array of bytes                 //\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "// more info and bugs-report:  github.com/raysan5/raylib                              //\n");
+    byteCount += sprintf(txtData + byteCount, "// feedback and support:       ray[at]raylib.com                                      //\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "// Copyright (c) 2018-2026 Ramon Santamaria (@raysan5)                                //\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "// ---------------------------------------------------------------------------------- //\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "// TODO: Fill the information and license of the exported font here:                  //\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
+    byteCount += sprintf(txtData + byteCount, "// rl_Font name:    ....                                                                 //\n");
+    byteCount += sprintf(txtData + byteCount, "// rl_Font creator: ....                                                                 //\n");
+    byteCount += sprintf(txtData + byteCount, "// rl_Font LICENSE: ....                                                                 //\n");
+    byteCount += sprintf(txtData + byteCount, "//                                                                                    //\n");
     byteCount += sprintf(txtData + byteCount, "////////////////////////////////////////////////////////////////////////////////////////\n\n");
 
     // Support font export and initialization
@@ -1230,6 +1681,13 @@ void rl_DrawTextEx(rl_Font font, const char *text, rl_Vector2 position, float fo
 {
     if (font.texture.id == 0) font = rl_GetFontDefault();  // Security check in case of not valid font
 
+    if (textShaping.enabled && IsFontKerningAvailable(font))
+    {
+        // Shaped texts are cached, repeated texts are drawn without shaping again
+        rl_DrawTextLayout(GetShapedTextLayout(font, text, fontSize, spacing), position, tint);
+        return;
+    }
+
     int size = rl_TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
     float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
@@ -1237,11 +1695,14 @@ void rl_DrawTextEx(rl_Font font, const char *text, rl_Vector2 position, float fo
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
 
+    SetFontShapesTexture(font);
+    bool fontShader = BeginFontShader(font);
+
     for (int i = 0; i < size;)
     {
         // Get next codepoint from byte string and glyph index in font
         int codepointByteCount = 0;
-        int codepoint = rl_GetCodepointNext(&text[i], &codepointByteCount);
+        int codepoint = GetCodepointNextFast(&text[i], &codepointByteCount);
         int index = rl_GetGlyphIndex(font, codepoint);
 
         if (codepoint == '\n')
@@ -1254,7 +1715,7 @@ void rl_DrawTextEx(rl_Font font, const char *text, rl_Vector2 position, float fo
         {
             if ((codepoint != ' ') && (codepoint != '\t'))
             {
-                rl_DrawTextCodepoint(font, codepoint, (rl_Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                DrawFontGlyph(font, index, (rl_Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
@@ -1263,6 +1724,8 @@ void rl_DrawTextEx(rl_Font font, const char *text, rl_Vector2 position, float fo
 
         i += codepointByteCount;   // Move text bytes counter to next codepoint
     }
+
+    if (fontShader) rl_EndShaderMode();
 }
 
 // Draw text using rl_Font and pro parameters (rotation)
@@ -1285,22 +1748,13 @@ void rl_DrawTextCodepoint(rl_Font font, int codepoint, rl_Vector2 position, floa
     // Character index position in sprite font
     // NOTE: In case a codepoint is not available in the font, index returned points to '?'
     int index = rl_GetGlyphIndex(font, codepoint);
-    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
 
-    // Character destination rectangle on screen
-    // NOTE: We consider glyphPadding on drawing
-    rl_Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
-                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
-                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
+    SetFontShapesTexture(font);
+    bool fontShader = BeginFontShader(font);
 
-    // Character source rectangle from font texture atlas
-    // NOTE: We consider glyphs padding when drawing, it could be required for outline/glow shader effects
-    rl_Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
-                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+    DrawFontGlyph(font, index, position, fontSize, tint);
 
-    // Draw the character texture on the screen
-    rl_DrawTexturePro(font.texture, srcRec, dstRec, (rl_Vector2){ 0, 0 }, 0.0f, tint);
+    if (fontShader) rl_EndShaderMode();
 }
 
 // Draw multiple character (codepoints)
@@ -1310,6 +1764,11 @@ void rl_DrawTextCodepoints(rl_Font font, const int *codepoints, int codepointCou
     float textOffsetX = 0.0f;       // Offset X to next character to draw
 
     float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    bool kerning = textShaping.enabled && IsFontKerningAvailable(font);
+    int prevIndex = -1;             // Previous glyph index on line, kerning applied between glyphs
+
+    SetFontShapesTexture(font);
+    bool fontShader = BeginFontShader(font);
 
     for (int i = 0; i < codepointCount; i++)
     {
@@ -1320,18 +1779,275 @@ void rl_DrawTextCodepoints(rl_Font font, const int *codepoints, int codepointCou
             // NOTE: Line spacing is a global variable, use rl_SetTextLineSpacing() to setup
             textOffsetY += (fontSize + textLineSpacing);
             textOffsetX = 0.0f;
+            prevIndex = -1;
         }
         else
         {
+            if (kerning && (prevIndex >= 0)) textOffsetX += GetGlyphKerning(font, prevIndex, codepoints[i - 1], index, codepoints[i])*scaleFactor;
+            prevIndex = index;
+
             if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
             {
-                rl_DrawTextCodepoint(font, codepoints[i], (rl_Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
+                DrawFontGlyph(font, index, (rl_Vector2){ position.x + textOffsetX, position.y + textOffsetY }, fontSize, tint);
             }
 
             if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
             else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
         }
     }
+
+    if (fontShader) rl_EndShaderMode();
+}
+
+// Text layout functions
+// NOTE: Text layout references font, font must be valid while layout is drawn
+rl_TextLayout *rl_LoadTextLayout(rl_Font font, const char *text, float fontSize, float spacing, float wrapWidth)
+{
+    if (font.texture.id == 0) font = rl_GetFontDefault();  // Security check in case of not valid font
+
+    rl_TextLayout *layout = (rl_TextLayout *)RL_CALLOC(1, sizeof(rl_TextLayout));
+    layout->font = font;
+    layout->fontSize = fontSize;
+    layout->spacing = spacing;
+    layout->wrapWidth = wrapWidth;
+    layout->lineSpacing = textLineSpacing;
+    layout->alignment = TEXT_ALIGN_LEFT;
+
+    if (!rl_IsFontValid(font)) return layout;
+
+    layout->kerning = textShaping.enabled && IsFontKerningAvailable(font);
+
+    // Quads cached, dynamic fonts glyphs can be evicted from atlas and are resolved on drawing
+    layout->dynamic = false;
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    layout->dynamic = (GetDynamicFontData(font) != NULL);
+#endif
+
+    rl_AppendTextLayout(layout, text, rl_WHITE);
+
+    return layout;
+}
+
+// Unload text layout
+void rl_UnloadTextLayout(rl_TextLayout *layout)
+{
+    if (layout == NULL) return;
+
+    RL_FREE(layout->glyphs);
+    RL_FREE(layout->lines);
+    RL_FREE(layout->tail);
+    RL_FREE(layout->tailColors);
+    RL_FREE(layout);
+}
+
+// Append text to text layout with text color (style span)
+// NOTE: Only last line is laid out again with appended text, previous lines are kept
+void rl_AppendTextLayout(rl_TextLayout *layout, const char *text, rl_Color color)
+{
+    if ((layout == NULL) || !rl_IsFontValid(layout->font)) return;
+
+    int size = rl_TextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
+    if ((size == 0) && (layout->lineCount == 0)) return;
+
+    // Last line source codepoints (including spaces) followed by appended codepoints
+    // NOTE: Codepoints count is lower or equal than bytes count
+    if ((layout->tailCount + size) > layout->tailCapacity)
+    {
+        layout->tailCapacity = (layout->tailCount + size)*2;
+        layout->tail = (int *)RL_REALLOC(layout->tail, layout->tailCapacity*sizeof(int));
+        layout->tailColors = (rl_Color *)RL_REALLOC(layout->tailColors, layout->tailCapacity*sizeof(rl_Color));
+    }
+
+    int codepointCount = DecodeTextCodepoints(text, size, layout->tail + layout->tailCount);
+    for (int i = 0; i < codepointCount; i++) layout->tailColors[layout->tailCount + i] = color;
+    layout->tailCount += codepointCount;
+
+    // Last line removed, its glyphs are the last layout glyphs
+    if (layout->lineCount > 0)
+    {
+        layout->lineCount--;
+        layout->glyphCount = layout->lines[layout->lineCount].firstGlyph;
+    }
+
+    // Lines broken at line breaks, at last space when wider than wrap width or inside words longer than wrap width
+    const rl_Font font = layout->font;
+    float scaleFactor = layout->fontSize/font.baseSize;
+    int lineStart = 0;              // First codepoint of current line
+
+    while (true)
+    {
+        int lineEnd = -1;           // Line end codepoint (excluded), -1 for last line
+        int nextStart = -1;         // Next line first codepoint
+        int lastSpace = -1;         // Last space codepoint on current line, wrapping point
+        float lineWidth = 0.0f;     // Current line width, including last glyph spacing
+        int prevIndex = -1;         // Previous glyph index on line, kerning applied between glyphs
+
+        for (int i = lineStart; i < layout->tailCount; i++)
+        {
+            int codepoint = layout->tail[i];
+
+            if (codepoint == '\n')
+            {
+                lineEnd = i;
+                nextStart = i + 1;
+                break;
+            }
+
+            int index = rl_GetGlyphIndex(font, codepoint);
+            float advance = (font.glyphs[index].advanceX == 0)? (float)font.recs[index].width*scaleFactor : (float)font.glyphs[index].advanceX*scaleFactor;
+            if (layout->kerning && (prevIndex >= 0)) advance += GetGlyphKerning(font, prevIndex, layout->tail[i - 1], index, codepoint)*scaleFactor;
+            prevIndex = index;
+
+            if ((layout->wrapWidth > 0.0f) && (codepoint != ' ') && (codepoint != '\t') && (i > lineStart) && ((lineWidth + advance) > layout->wrapWidth))
+            {
+                // Line broken at last space (space removed) or word longer than wrap width split at current codepoint
+                lineEnd = (lastSpace >= 0)? lastSpace : i;
+                nextStart = (lastSpace >= 0)? (lastSpace + 1) : i;
+                break;
+            }
+
+            lineWidth += (advance + layout->spacing);
+            if (codepoint == ' ') lastSpace = i;
+        }
+
+        if (lineEnd < 0)
+        {
+            AddTextLayoutLine(layout, layout->tail + lineStart, layout->tailColors + lineStart, layout->tailCount - lineStart);
+            break;
+        }
+
+        AddTextLayoutLine(layout, layout->tail + lineStart, layout->tailColors + lineStart, lineEnd - lineStart);
+
+        // Completed lines measures kept, only last line changes on append
+        const TextLayoutLine *line = &layout->lines[layout->lineCount - 1];
+        if (layout->maxTextWidth < line->textWidth) layout->maxTextWidth = line->textWidth;
+        if (layout->maxLineCodepoints < line->codepointCount) layout->maxLineCodepoints = line->codepointCount;
+
+        lineStart = nextStart;
+    }
+
+    // Completed lines source codepoints removed, last line source kept for next append
+    layout->tailCount -= lineStart;
+    memmove(layout->tail, layout->tail + lineStart, layout->tailCount*sizeof(int));
+    memmove(layout->tailColors, layout->tailColors + lineStart, layout->tailCount*sizeof(rl_Color));
+
+    // Layout size measured as rl_MeasureTextEx(), wrapping breaks measured as line breaks
+    const TextLayoutLine *lastLine = &layout->lines[layout->lineCount - 1];
+    float maxTextWidth = (layout->maxTextWidth < lastLine->textWidth)? lastLine->textWidth : layout->maxTextWidth;
+    int maxLineCodepoints = (layout->maxLineCodepoints < lastLine->codepointCount)? lastLine->codepointCount : layout->maxLineCodepoints;
+
+    layout->size.x = maxTextWidth*scaleFactor + (float)((maxLineCodepoints - 1)*layout->spacing);
+    layout->size.y = layout->fontSize + (layout->lineCount - 1)*(layout->fontSize + layout->lineSpacing);
+}
+
+// Set text layout lines alignment (rl_TextAlignment)
+// NOTE: Lines are aligned to wrap width, or to layout width if layout is not wrapped
+void rl_SetTextLayoutAlignment(rl_TextLayout *layout, int alignment)
+{
+    if (layout != NULL) layout->alignment = alignment;
+}
+
+// Get text layout lines count, including wrapped lines
+int rl_GetTextLayoutLineCount(const rl_TextLayout *layout)
+{
+    return (layout != NULL)? layout->lineCount : 0;
+}
+
+// Draw text layout, cached glyphs quads submitted at once
+void rl_DrawTextLayout(const rl_TextLayout *layout, rl_Vector2 position, rl_Color tint)
+{
+    if (layout != NULL) rl_DrawTextLayoutLines(layout, position, 0, layout->lineCount, tint);
+}
+
+// Draw text layout lines range, first line drawn at position
+// NOTE: Glyphs colors (text spans colors) are multiplied by tint
+void rl_DrawTextLayoutLines(const rl_TextLayout *layout, rl_Vector2 position, int firstLine, int lineCount, rl_Color tint)
+{
+    if ((layout == NULL) || (layout->glyphCount == 0)) return;
+
+    if (firstLine < 0)
+    {
+        lineCount += firstLine;
+        firstLine = 0;
+    }
+    if ((firstLine + lineCount) > layout->lineCount) lineCount = layout->lineCount - firstLine;
+    if (lineCount <= 0) return;
+
+    const rl_Font font = layout->font;
+    float alignWidth = (layout->wrapWidth > 0.0f)? layout->wrapWidth : layout->size.x;
+    float alignFactor = (layout->alignment == TEXT_ALIGN_CENTER)? 0.5f : (layout->alignment == TEXT_ALIGN_RIGHT)? 1.0f : 0.0f;
+
+    // Lines range drawn at position, lines vertical offset removed
+    position.y -= firstLine*(layout->fontSize + layout->lineSpacing);
+
+    SetFontShapesTexture(font);
+    bool fontShader = BeginFontShader(font);
+
+    if (!layout->dynamic)
+    {
+        rlSetTexture(font.texture.id);
+        rlBegin(RL_QUADS);
+
+        rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+    }
+
+    for (int l = firstLine; l < (firstLine + lineCount); l++)
+    {
+        const TextLayoutLine *line = &layout->lines[l];
+        float offsetX = position.x + (alignWidth - line->width)*alignFactor;
+
+        for (int i = line->firstGlyph; i < (line->firstGlyph + line->glyphCount); i++)
+        {
+            const TextLayoutGlyph *glyph = &layout->glyphs[i];
+            rl_Color color = { (unsigned char)(glyph->color.r*tint.r/255), (unsigned char)(glyph->color.g*tint.g/255),
+                               (unsigned char)(glyph->color.b*tint.b/255), (unsigned char)(glyph->color.a*tint.a/255) };
+
+            if (layout->dynamic)
+            {
+                // NOTE: Dynamic fonts glyphs rasterized on first use can evict other glyphs, drawn one by one
+                int index = rl_GetGlyphIndex(font, glyph->codepoint);
+
+                DrawFontGlyph(font, index, (rl_Vector2){ offsetX + glyph->position.x, position.y + glyph->position.y }, layout->fontSize, color);
+            }
+            else
+            {
+                float x0 = offsetX + glyph->quad.x;
+                float y0 = position.y + glyph->quad.y;
+                float x1 = x0 + glyph->quad.width;
+                float y1 = y0 + glyph->quad.height;
+
+                rlColor4ub(color.r, color.g, color.b, color.a);
+
+                // Top-left, bottom-left, bottom-right and top-right corners, as rl_DrawTexturePro()
+                rlTexCoord2f(glyph->texcoords.x, glyph->texcoords.y);
+                rlVertex2f(x0, y0);
+                rlTexCoord2f(glyph->texcoords.x, glyph->texcoords.height);
+                rlVertex2f(x0, y1);
+                rlTexCoord2f(glyph->texcoords.width, glyph->texcoords.height);
+                rlVertex2f(x1, y1);
+                rlTexCoord2f(glyph->texcoords.width, glyph->texcoords.y);
+                rlVertex2f(x1, y0);
+            }
+        }
+    }
+
+    if (!layout->dynamic)
+    {
+        rlEnd();
+        rlSetTexture(0);
+    }
+
+    if (fontShader) rl_EndShaderMode();
+}
+
+// Measure text layout size, same as rl_MeasureTextEx() for layout lines
+rl_Vector2 rl_MeasureTextLayout(const rl_TextLayout *layout)
+{
+    rl_Vector2 textSize = { 0 };
+
+    if (layout != NULL) textSize = layout->size;
+
+    return textSize;
 }
 
 // Set vertical line spacing when drawing with line-breaks
@@ -1340,6 +2056,13 @@ void rl_SetTextLineSpacing(int spacing)
     textLineSpacing = spacing;
 }
 
+// Set text shaping, kerning applied between glyphs for text drawing, measuring and layouts
+// NOTE: Only fonts with kerning are shaped, rl_DrawTextEx() texts layouts are cached by text, font and size
+void rl_SetTextShaping(bool enabled)
+{
+    textShaping.enabled = enabled;
+}
+
 // Measure string width for default font
 int rl_MeasureText(const char *text, int fontSize)
 {
@@ -1377,19 +2100,26 @@ rl_Vector2 rl_MeasureTextEx(rl_Font font, const char *text, float fontSize, floa
 
     int letter = 0;                 // Current character
     int index = 0;                  // Index position in sprite font
+    bool kerning = textShaping.enabled && IsFontKerningAvailable(font);
+    int prevLetter = 0;
+    int prevIndex = -1;             // Previous glyph index on line, kerning applied between glyphs
 
     for (int i = 0; i < size;)
     {
         byteCounter++;
 
         int codepointByteCount = 0;
-        letter = rl_GetCodepointNext(&text[i], &codepointByteCount);
+        letter = GetCodepointNextFast(&text[i], &codepointByteCount);
         index = rl_GetGlyphIndex(font, letter);
 
         i += codepointByteCount;
 
         if (letter != '\n')
         {
+            if (kerning && (prevIndex >= 0)) textWidth += GetGlyphKerning(font, prevIndex, prevLetter, index, letter);
+            prevIndex = index;
+            prevLetter = letter;
+
             if (font.glyphs[index].advanceX > 0) textWidth += font.glyphs[index].advanceX;
             else textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
         }
@@ -1398,6 +2128,7 @@ rl_Vector2 rl_MeasureTextEx(rl_Font font, const char *text, float fontSize, floa
             if (tempTextWidth < textWidth) tempTextWidth = textWidth;
             byteCounter = 0;
             textWidth = 0;
+            prevIndex = -1;
 
             // NOTE: Line spacing is a global variable, use rl_SetTextLineSpacing() to setup
             textHeight += (fontSize + textLineSpacing);
@@ -1414,8 +2145,19 @@ rl_Vector2 rl_MeasureTextEx(rl_Font font, const char *text, float fontSize, floa
     return textSize;
 }
 
+// Get kerning between two codepoints in font, in pixels at font base size
+// NOTE: Kerning is read from font kern and GPOS tables on TTF fonts loading, 0 for other fonts
+float rl_GetCodepointKerning(rl_Font font, int codepoint, int nextCodepoint)
+{
+    if (!rl_IsFontValid(font) || !IsFontKerningAvailable(font)) return 0.0f;
+
+    return GetGlyphKerning(font, rl_GetGlyphIndex(font, codepoint), codepoint, rl_GetGlyphIndex(font, nextCodepoint), nextCodepoint);
+}
+
 // Get index position for a unicode character on font
-// NOTE: If codepoint is not found in the font it fallbacks to '?'
+// NOTE: If codepoint is not found in the font it fallbacks to '?',
+// fonts loaded by raylib use glyphs lookup, other fonts glyphs are scanned,
+// dynamic fonts glyphs are rasterized into font atlas on first use
 int rl_GetGlyphIndex(rl_Font font, int codepoint)
 {
     int index = 0;
@@ -1423,6 +2165,31 @@ int rl_GetGlyphIndex(rl_Font font, int codepoint)
 
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
+    if (font.glyphLookup != NULL)
+    {
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        if (font.glyphLookup[0] < 0)
+        {
+            DynamicFontData *data = GetDynamicFontData(font);
+            return (data != NULL)? GetDynamicFontGlyphIndex(data, codepoint) : 0;
+        }
+#endif
+        // Codepoints indexed directly, others found on hash table
+        if ((codepoint >= 0) && (codepoint < FONT_GLYPH_LOOKUP_DIRECT_SIZE)) return font.glyphLookup[2 + codepoint];
+
+        const int *hashed = font.glyphLookup + 2 + FONT_GLYPH_LOOKUP_DIRECT_SIZE;
+        unsigned int mask = (unsigned int)font.glyphLookup[0];
+        unsigned int slot = ((unsigned int)codepoint*2654435761u) & mask;
+
+        while (hashed[slot*2 + 1] >= 0)
+        {
+            if (hashed[slot*2] == codepoint) return hashed[slot*2 + 1];
+            slot = (slot + 1) & mask;
+        }
+
+        return font.glyphLookup[1];
+    }
+
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
 
     // Look for character index in the unordered charset
@@ -1537,8 +2304,8 @@ const char *rl_TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    static RL_CONTEXT_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_CONTEXT_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
     memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH); // Clear buffer before using
@@ -1565,6 +2332,27 @@ const char *rl_TextFormat(const char *text, ...)
     return currentBuffer;
 }
 
+// Formatting of text with variables into provided buffer
+// NOTE: Text is truncated to (bufferSize - 1) bytes, returned length is the untruncated length (as vsnprintf()),
+// no static buffers are used, it can be called from any thread
+int rl_TextFormatBuffer(char *buffer, int bufferSize, const char *text, ...)
+{
+    int length = 0;
+    bool validBuffer = ((buffer != NULL) && (bufferSize > 0));
+
+    if (validBuffer) buffer[0] = '\0';
+
+    if (text != NULL)
+    {
+        va_list args;
+        va_start(args, text);
+        length = vsnprintf(validBuffer? buffer : NULL, validBuffer? bufferSize : 0, text, args);
+        va_end(args);
+    }
+
+    return length;
+}
+
 // Get integer value from text
 // NOTE: This function replaces atoi() [stdlib.h]
 int rl_TextToInteger(const char *text)
@@ -1683,6 +2471,23 @@ const char *rl_TextSubtext(const char *text, int position, int length)
     return buffer;
 }
 
+// Get a piece of a text string into provided buffer
+// NOTE: Text is truncated to (bufferSize - 1) bytes, returns untruncated piece length
+int rl_TextSubtextBuffer(char *buffer, int bufferSize, const char *text, int position, int length)
+{
+    int textLength = rl_TextLength(text);
+
+    if (position < 0) position = 0;
+    if (position >= textLength) length = 0;
+    else if (length > (textLength - position)) length = textLength - position;
+    if (length < 0) length = 0;
+
+    if ((buffer != NULL) && (bufferSize > 0)) buffer[0] = '\0';
+    if (length > 0) CopyTextToBuffer(buffer, bufferSize, 0, text + position, length);
+
+    return length;
+}
+
 // Remove text spaces, concat words
 const char *rl_TextRemoveSpaces(const char *text)
 {
@@ -1792,6 +2597,29 @@ char *rl_TextReplace(const char *text, const char *search, const char *replaceme
     return result;
 }
 
+// Replace text string into provided buffer
+// REQUIRES: strstr()
+// NOTE: Text is truncated to (bufferSize - 1) bytes, returns untruncated replaced text length,
+// pass a NULL buffer to get required length, -1 is returned if search text is not valid
+int rl_TextReplaceBuffer(char *buffer, int bufferSize, const char *text, const char *search, const char *replacement)
+{
+    if ((buffer != NULL) && (bufferSize > 0)) buffer[0] = '\0';
+    if ((text == NULL) || (search == NULL) || (search[0] == '\0')) return -1;
+
+    int searchLen = rl_TextLength(search);
+    int replaceLen = rl_TextLength(replacement);
+    int position = 0;
+
+    for (const char *found = strstr(text, search); found != NULL; found = strstr(text, search))
+    {
+        position = CopyTextToBuffer(buffer, bufferSize, position, text, (int)(found - text));
+        position = CopyTextToBuffer(buffer, bufferSize, position, replacement, replaceLen);
+        text = found + searchLen;
+    }
+
+    return CopyTextToBuffer(buffer, bufferSize, position, text, rl_TextLength(text));
+}
+
 // Replace text between two specific strings
 // REQUIRES: strncpy()
 // NOTE: If (replacement == NULL) remove "begin"[ ]"end" text
@@ -1885,6 +2713,24 @@ char *rl_TextJoin(char **textList, int count, const char *delimiter)
     return buffer;
 }
 
+// Join text strings with delimiter into provided buffer
+// NOTE: Text is truncated to (bufferSize - 1) bytes, returns untruncated joined text length
+int rl_TextJoinBuffer(char *buffer, int bufferSize, char **textList, int count, const char *delimiter)
+{
+    int delimiterLen = rl_TextLength(delimiter);
+    int position = 0;
+
+    if ((buffer != NULL) && (bufferSize > 0)) buffer[0] = '\0';
+
+    for (int i = 0; (textList != NULL) && (i < count); i++)
+    {
+        position = CopyTextToBuffer(buffer, bufferSize, position, textList[i], rl_TextLength(textList[i]));
+        if (i < (count - 1)) position = CopyTextToBuffer(buffer, bufferSize, position, delimiter, delimiterLen);
+    }
+
+    return position;
+}
+
 // Split string into multiple strings
 // REQUIRES: memset()
 char **rl_TextSplit(const char *text, char delimiter, int *count)
@@ -1926,13 +2772,41 @@ char **rl_TextSplit(const char *text, char delimiter, int *count)
     return buffers;
 }
 
-// Append text at specific position and move cursor
-// WARNING: It's up to the user to make sure appended text does not overflow the buffer!
-void rl_TextAppend(char *text, const char *append, int *position)
+// Split text into substrings offsets and lengths in text, string views not copied nor null-terminated
+// NOTE: First maxCount substrings stored, returned count includes all substrings (same as rl_TextSplit() count)
+int rl_TextSplitOffsets(const char *text, char delimiter, int *offsets, int *lengths, int maxCount)
 {
-    if ((text != NULL) && (append != NULL))
-    {
-        rl_TextCopy(text + *position, append);
+    int count = 0;
+
+    if (text == NULL) return count;
+
+    for (int i = 0, start = 0; ; i++)
+    {
+        if ((text[i] == delimiter) || (text[i] == '\0'))
+        {
+            if (count < maxCount)
+            {
+                if (offsets != NULL) offsets[count] = start;
+                if (lengths != NULL) lengths[count] = i - start;
+            }
+
+            count++;
+            start = i + 1;
+
+            if (text[i] == '\0') break;
+        }
+    }
+
+    return count;
+}
+
+// Append text at specific position and move cursor
+// WARNING: It's up to the user to make sure appended text does not overflow the buffer!
+void rl_TextAppend(char *text, const char *append, int *position)
+{
+    if ((text != NULL) && (append != NULL))
+    {
+        rl_TextCopy(text + *position, append);
         *position += rl_TextLength(append);
     }
 }
@@ -2123,23 +2997,12 @@ int *rl_LoadCodepoints(const char *text, int *count)
 
     if (text != NULL)
     {
-        int textLength = rl_TextLength(text);
-
-        // Allocate a big enough buffer to store as many codepoints as text bytes
-        codepoints = (int *)RL_CALLOC(textLength, sizeof(int));
+        int textLength = (int)strlen(text);
 
-        int codepointSize = 0;
-        for (int i = 0; i < textLength; codepointCount++)
-        {
-            codepoints[codepointCount] = rl_GetCodepointNext(text + i, &codepointSize);
-            i += codepointSize;
-        }
-
-        // Create second buffer and copy data manually to it
-        int *temp = (int *)RL_CALLOC(codepointCount, sizeof(int));
-        for (int i = 0; i < codepointCount; i++) temp[i] = codepoints[i];
-        RL_FREE(codepoints);
-        codepoints = temp;
+        // Codepoints counted first (SIMD ASCII chunks), buffer allocated once with required size
+        codepointCount = CountTextCodepoints(text, textLength);
+        codepoints = (int *)RL_MALLOC(codepointCount*sizeof(int));
+        codepointCount = DecodeTextCodepoints(text, textLength, codepoints);
     }
 
     *count = codepointCount;
@@ -2156,19 +3019,9 @@ void rl_UnloadCodepoints(int *codepoints)
 // NOTE: If an invalid UTF-8 sequence is encountered a '?'(0x3f) codepoint is counted instead
 int rl_GetCodepointCount(const char *text)
 {
-    unsigned int length = 0;
-    const char *ptr = text;
+    int length = 0;
 
-    if (ptr != NULL)
-    {
-        while (*ptr != '\0')
-        {
-            int next = 0;
-            rl_GetCodepointNext(ptr, &next);
-            ptr += next;
-            length++;
-        }
-    }
+    if (text != NULL) length = CountTextCodepoints(text, (int)strlen(text));
 
     return length;
 }
@@ -2387,184 +3240,1907 @@ int rl_GetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module Internal Functions Definition
 //----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
-// Read a line from memory
-// REQUIRES: memcpy()
-// NOTE: Returns the number of bytes read
-static int GetLine(const char *origin, char *buffer, int maxLength)
+// Load glyph index lookup for font glyphs, codepoints below FONT_GLYPH_LOOKUP_DIRECT_SIZE
+// are indexed directly and others are hashed (open addressing, power of two size)
+// NOTE: Lookup layout: [hash mask][fallback index][direct indices...][hash codepoint, index pairs...]
+// missing codepoints get fallback glyph '?' index, same as scanning glyphs
+static int *LoadGlyphLookup(const rl_GlyphInfo *glyphs, int glyphCount)
 {
-    int count = 0;
-    for (; count < maxLength - 1; count++) if (origin[count] == '\n') break;
-    memcpy(buffer, origin, count);
-    buffer[count] = '\0';
-    return count;
-}
-#endif
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
 
-#if defined(SUPPORT_FILEFORMAT_FNT)
-// Load a BMFont file (AngelCode font file)
-// REQUIRES: strstr(), sscanf(), strrchr(), memcpy()
-static rl_Font LoadBMFont(const char *fileName)
-{
-    #define MAX_BUFFER_SIZE       256
-    #define MAX_FONT_IMAGE_PAGES    8
+    int fallbackIndex = 0;
+    int hashedCount = 0;
 
-    rl_Font font = { 0 };
+    for (int i = 0; i < glyphCount; i++)
+    {
+        if (glyphs[i].value == 63) fallbackIndex = i;
+        if ((glyphs[i].value < 0) || (glyphs[i].value >= FONT_GLYPH_LOOKUP_DIRECT_SIZE)) hashedCount++;
+    }
 
-    char buffer[MAX_BUFFER_SIZE] = { 0 };
-    char *searchPoint = NULL;
+    // Hash table is kept at most half full
+    int hashSize = 1;
+    while (hashSize < hashedCount*2) hashSize *= 2;
 
-    int fontSize = 0;
-    int glyphCount = 0;
+    int *lookup = (int *)RL_MALLOC((2 + FONT_GLYPH_LOOKUP_DIRECT_SIZE + hashSize*2)*sizeof(int));
+    if (lookup == NULL) return NULL;
 
-    int imWidth = 0;
-    int imHeight = 0;
-    int pageCount = 1;
-    char imFileName[MAX_FONT_IMAGE_PAGES][129] = { 0 };
+    int *direct = lookup + 2;
+    int *hashed = direct + FONT_GLYPH_LOOKUP_DIRECT_SIZE;
 
-    int base = 0;       // Useless data
-    int readBytes = 0;  // Data bytes read
-    int readVars = 0;   // Variables filled by sscanf()
+    lookup[0] = hashSize - 1;
+    lookup[1] = fallbackIndex;
+    for (int i = 0; i < FONT_GLYPH_LOOKUP_DIRECT_SIZE; i++) direct[i] = -1;
+    for (int i = 0; i < hashSize; i++) hashed[i*2 + 1] = -1;
 
-    char *fileText = rl_LoadFileText(fileName);
+    // NOTE: First glyph with a codepoint is kept if codepoint is repeated
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int codepoint = glyphs[i].value;
 
-    if (fileText == NULL) return font;
+        if ((codepoint >= 0) && (codepoint < FONT_GLYPH_LOOKUP_DIRECT_SIZE))
+        {
+            if (direct[codepoint] < 0) direct[codepoint] = i;
+        }
+        else
+        {
+            unsigned int slot = ((unsigned int)codepoint*2654435761u) & (unsigned int)lookup[0];
 
-    char *fileTextPtr = fileText;
+            while ((hashed[slot*2 + 1] >= 0) && (hashed[slot*2] != codepoint)) slot = (slot + 1) & (unsigned int)lookup[0];
 
-    // NOTE: We skip first line, it contains no useful information
-    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    fileTextPtr += (readBytes + 1);
+            if (hashed[slot*2 + 1] < 0)
+            {
+                hashed[slot*2] = codepoint;
+                hashed[slot*2 + 1] = i;
+            }
+        }
+    }
 
-    // Read line data
-    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    searchPoint = strstr(buffer, "lineHeight");
-    readVars = sscanf(searchPoint, "lineHeight=%i base=%i scaleW=%i scaleH=%i pages=%i", &fontSize, &base, &imWidth, &imHeight, &pageCount);
-    fileTextPtr += (readBytes + 1);
+    for (int i = 0; i < FONT_GLYPH_LOOKUP_DIRECT_SIZE; i++) if (direct[i] < 0) direct[i] = fallbackIndex;
 
-    if (readVars < 4) { rl_UnloadFileText(fileText); return font; } // Some data not available, file malformed
+    return lookup;
+}
 
-    if (pageCount > MAX_FONT_IMAGE_PAGES)
+// Load kerning table for font glyphs pairs, advance values in 1/64 pixels at font base size
+// NOTE: Table layout: [hash mask][pairs count][hash first index, second index, advance triples...],
+// open addressing hash kept at most half full, empty slots first index is -1
+static int *LoadKerningTable(const int *pairs, int pairCount)
+{
+    if ((pairs == NULL) || (pairCount <= 0)) return NULL;
+
+    int hashSize = 1;
+    while (hashSize < pairCount*2) hashSize *= 2;
+
+    int *kerning = (int *)RL_MALLOC((2 + hashSize*3)*sizeof(int));
+    if (kerning == NULL) return NULL;
+
+    int *hashed = kerning + 2;
+
+    kerning[0] = hashSize - 1;
+    kerning[1] = 0;
+    for (int i = 0; i < hashSize; i++) hashed[i*3] = -1;
+
+    for (int i = 0; i < pairCount; i++)
     {
-        TRACELOG(LOG_WARNING, "FONT: [%s] rl_Font defines more pages than supported: %i/%i", fileName, pageCount, MAX_FONT_IMAGE_PAGES);
-        pageCount = MAX_FONT_IMAGE_PAGES;
+        int first = pairs[i*3];
+        int second = pairs[i*3 + 1];
+        unsigned int slot = ((unsigned int)first*2654435761u ^ (unsigned int)second*2246822519u) & (unsigned int)kerning[0];
+
+        while ((hashed[slot*3] >= 0) && ((hashed[slot*3] != first) || (hashed[slot*3 + 1] != second))) slot = (slot + 1) & (unsigned int)kerning[0];
+
+        // NOTE: First advance is kept if pair is repeated
+        if (hashed[slot*3] < 0)
+        {
+            hashed[slot*3] = first;
+            hashed[slot*3 + 1] = second;
+            hashed[slot*3 + 2] = pairs[i*3 + 2];
+            kerning[1]++;
+        }
     }
 
-    for (int i = 0; i < pageCount; i++)
+    return kerning;
+}
+
+// Get kerning between two font glyphs, in pixels at font base size
+// NOTE: Dynamic fonts kerning is read from font data by codepoints, glyphs indices change on eviction
+static float GetGlyphKerning(rl_Font font, int index, int codepoint, int nextIndex, int nextCodepoint)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    DynamicFontData *data = GetDynamicFontData(font);
+    if (data != NULL) return (float)stbtt_GetCodepointKernAdvance(&data->fontInfo, codepoint, nextCodepoint)*data->scaleFactor;
+#endif
+    if (font.kerning == NULL) return 0.0f;
+
+    const int *hashed = font.kerning + 2;
+    unsigned int mask = (unsigned int)font.kerning[0];
+    unsigned int slot = ((unsigned int)index*2654435761u ^ (unsigned int)nextIndex*2246822519u) & mask;
+
+    while (hashed[slot*3] >= 0)
     {
-        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-        searchPoint = strstr(buffer, "file");
-        readVars = sscanf(searchPoint, "file=\"%128[^\"]\"", imFileName[i]);
-        fileTextPtr += (readBytes + 1);
+        if ((hashed[slot*3] == index) && (hashed[slot*3 + 1] == nextIndex)) return (float)hashed[slot*3 + 2]/64.0f;
+        slot = (slot + 1) & mask;
+    }
 
-        if (readVars < 1) { rl_UnloadFileText(fileText); return font; } // No fileName read
+    return 0.0f;
+}
+
+// Check if font provides kerning, text shaping is only applied to fonts with kerning
+static bool IsFontKerningAvailable(rl_Font font)
+{
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    DynamicFontData *data = GetDynamicFontData(font);
+    if (data != NULL) return ((data->fontInfo.kern != 0) || (data->fontInfo.gpos != 0));
+#endif
+    return (font.kerning != NULL);
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Load dynamic font data, file data is owned by dynamic font (freed on failure)
+// NOTE: Font glyphs and recs are allocated for all atlas cells, mapped to cached codepoints,
+// font glyphs lookup header identifies dynamic font: [-1][dynamic font id]
+static rl_Font LoadDynamicFontData(unsigned char *fileData, int fontSize, int atlasSize)
+{
+    rl_Font font = { 0 };
+    DynamicFontData data = { 0 };
+
+    if (atlasSize <= 0) atlasSize = FONT_DYNAMIC_ATLAS_SIZE;
+
+    if ((fontSize <= 0) || !stbtt_InitFont(&data.fontInfo, fileData, 0))
+    {
+        RL_FREE(fileData);
+        return font;
     }
 
-    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    searchPoint = strstr(buffer, "count");
-    readVars = sscanf(searchPoint, "count=%i", &glyphCount);
-    fileTextPtr += (readBytes + 1);
+    data.fileData = fileData;
+    data.scaleFactor = stbtt_ScaleForPixelHeight(&data.fontInfo, (float)fontSize);
 
-    if (readVars < 1) { rl_UnloadFileText(fileText); return font; } // No glyphCount read
+    int ascent = 0;
+    int descent = 0;
+    int lineGap = 0;
+    stbtt_GetFontVMetrics(&data.fontInfo, &ascent, &descent, &lineGap);
+    data.ascent = (int)((float)ascent*data.scaleFactor);
 
-    // Load all required images for further compose
-    rl_Image *imFonts = (rl_Image *)RL_CALLOC(pageCount, sizeof(rl_Image)); // rl_Font atlases, multiple images
+    // Cells fit font bounding box, limited to line height and a margin for glyphs over ascent/descent
+    // NOTE: Font bounding box includes rare oversized glyphs on some fonts (CJK), those glyphs are clipped
+    int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    stbtt_GetFontBoundingBox(&data.fontInfo, &x0, &y0, &x1, &y1);
 
-    for (int i = 0; i < pageCount; i++)
+    int cellSize = (int)ceilf((float)(ascent - descent)*data.scaleFactor*1.25f);
+    int boxWidth = (int)ceilf((float)(x1 - x0)*data.scaleFactor) + 1;
+    int boxHeight = (int)ceilf((float)(y1 - y0)*data.scaleFactor) + 1;
+
+    font.baseSize = fontSize;
+    font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+
+    data.cellWidth = ((boxWidth < cellSize)? boxWidth : cellSize) + 2*font.glyphPadding;
+    data.cellHeight = ((boxHeight < cellSize)? boxHeight : cellSize) + 2*font.glyphPadding;
+    data.columns = atlasSize/data.cellWidth;
+    font.glyphCount = data.columns*(atlasSize/data.cellHeight);
+
+#if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+    // Bottom-right cell is reserved for atlas white rectangle if atlas has no margin for it
+    if (((atlasSize%data.cellWidth) < 3) && ((atlasSize%data.cellHeight) < 3)) font.glyphCount--;
+#endif
+
+    if (font.glyphCount <= 0)
     {
-        imFonts[i] = rl_LoadImage(rl_TextFormat("%s/%s", rl_GetDirectoryPath(fileName), imFileName[i]));
+        TRACELOG(LOG_WARNING, "FONT: Dynamic font atlas size is too small for font size (%i)", atlasSize);
+        RL_FREE(fileData);
+        return (rl_Font){ 0 };
+    }
 
-        if (imFonts[i].format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
-        {
-            // Convert image to GRAYSCALE + ALPHA, using the mask as the alpha channel
-            rl_Image imFontAlpha = {
-                .data = RL_CALLOC(imFonts[i].width*imFonts[i].height, 2),
-                .width = imFonts[i].width,
-                .height = imFonts[i].height,
-                .mipmaps = 1,
-                .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
-            };
+    int bucketCount = 1;
+    while (bucketCount < font.glyphCount) bucketCount *= 2;
+    data.bucketMask = bucketCount - 1;
 
-            for (int p = 0, pi = 0; p < (imFonts[i].width*imFonts[i].height*2); p += 2, pi++)
-            {
-                ((unsigned char *)(imFontAlpha.data))[p] = 0xff;
-                ((unsigned char *)(imFontAlpha.data))[p + 1] = ((unsigned char *)imFonts[i].data)[pi];
-            }
+    font.glyphs = (rl_GlyphInfo *)RL_CALLOC(font.glyphCount, sizeof(rl_GlyphInfo));
+    font.recs = (rl_Rectangle *)RL_CALLOC(font.glyphCount, sizeof(rl_Rectangle));
+    font.glyphLookup = (int *)RL_MALLOC(2*sizeof(int));
+    data.buckets = (int *)RL_MALLOC((bucketCount + 3*font.glyphCount)*sizeof(int));
+    data.cellData = (unsigned char *)RL_MALLOC(data.cellWidth*data.cellHeight*2);
 
-            rl_UnloadImage(imFonts[i]);
-            imFonts[i] = imFontAlpha;
-        }
+    // Atlas texture is cleared on load, cells are cleared when uploaded
+    // NOTE: Atlas texture is not compressed, it is updated with glyphs cells
+    unsigned char *atlasData = (unsigned char *)RL_CALLOC(atlasSize*atlasSize, 2);
+#if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+    // Add a 3x3 white rectangle at the bottom-right corner of the atlas, never used by glyphs cells
+    for (int y = atlasSize - 3; (atlasData != NULL) && (y < atlasSize); y++) memset(atlasData + (y*atlasSize + atlasSize - 3)*2, 255, 3*2);
+#endif
+    if (atlasData != NULL) font.texture.id = rlLoadTexture(atlasData, atlasSize, atlasSize, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, 1);
+    RL_FREE(atlasData);
+
+    if ((font.texture.id == 0) || (font.glyphs == NULL) || (font.recs == NULL) || (font.glyphLookup == NULL) || (data.buckets == NULL) || (data.cellData == NULL))
+    {
+        if (font.texture.id > 0) rlUnloadTexture(font.texture.id);
+        RL_FREE(font.glyphs);
+        RL_FREE(font.recs);
+        RL_FREE(font.glyphLookup);
+        RL_FREE(data.buckets);
+        RL_FREE(data.cellData);
+        RL_FREE(fileData);
+        return (rl_Font){ 0 };
     }
 
-    rl_Image fullFont = imFonts[0];
-    for (int i = 1; i < pageCount; i++) rl_UnloadImage(imFonts[i]);
+    font.texture.width = atlasSize;
+    font.texture.height = atlasSize;
+    font.texture.mipmaps = 1;
+    font.texture.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
 
-    // If multiple atlas, then merge atlas
-    // NOTE: WARNING: This process could be really slow!
-    if (pageCount > 1)
+    data.chain = data.buckets + bucketCount;
+    data.prev = data.chain + font.glyphCount;
+    data.next = data.prev + font.glyphCount;
+    data.first = -1;
+    data.last = -1;
+
+    for (int i = 0; i < bucketCount; i++) data.buckets[i] = -1;
+    for (int i = 0; i < font.glyphCount; i++) font.glyphs[i].value = -1;
+
+    int slot = 0;
+    for (; slot < dynamicFonts.capacity; slot++) if (dynamicFonts.fonts[slot].fileData == NULL) break;
+
+    if (slot == dynamicFonts.capacity)
     {
-        // Resize font atlas to draw additional images
-        rl_ImageResizeCanvas(&fullFont, imWidth, imHeight*pageCount, 0, 0, rl_BLACK);
+        int capacity = (dynamicFonts.capacity == 0)? 8 : dynamicFonts.capacity*2;
+        DynamicFontData *fonts = (DynamicFontData *)RL_REALLOC(dynamicFonts.fonts, capacity*sizeof(DynamicFontData));
 
-        for (int i = 1; i < pageCount; i++)
+        if (fonts == NULL)
         {
-            rl_Rectangle srcRec = { 0.0f, 0.0f, (float)imWidth, (float)imHeight };
-            rl_Rectangle destRec = { 0.0f, (float)imHeight*(float)i, (float)imWidth, (float)imHeight };
-            rl_ImageDraw(&fullFont, imFonts[i], srcRec, destRec, rl_WHITE);
+            data.font = font;
+            UnloadDynamicFontData(&data);
+            return (rl_Font){ 0 };
         }
+
+        memset(fonts + dynamicFonts.capacity, 0, (capacity - dynamicFonts.capacity)*sizeof(DynamicFontData));
+        dynamicFonts.fonts = fonts;
+        dynamicFonts.capacity = capacity;
     }
 
-    RL_FREE(imFonts);
+    font.glyphLookup[0] = -1;
+    font.glyphLookup[1] = slot + 1;
+    data.font = font;
+    dynamicFonts.fonts[slot] = data;
 
-    font.texture = rl_LoadTextureFromImage(fullFont);
+#if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+    RegisterFontShapesTexture(font.texture, (rl_Rectangle){ (float)atlasSize - 2, (float)atlasSize - 2, 1, 1 });
+#endif
 
-    // Fill font characters info data
-    font.baseSize = fontSize;
-    font.glyphCount = glyphCount;
-    font.glyphPadding = 0;
-    font.glyphs = (rl_GlyphInfo *)RL_MALLOC(glyphCount*sizeof(rl_GlyphInfo));
-    font.recs = (rl_Rectangle *)RL_MALLOC(glyphCount*sizeof(rl_Rectangle));
+    return font;
+}
 
-    int charId = 0;
-    int charX = 0;
-    int charY = 0;
-    int charWidth = 0;
-    int charHeight = 0;
-    int charOffsetX = 0;
-    int charOffsetY = 0;
-    int charAdvanceX = 0;
-    int pageID = 0;
+// Unload dynamic font data, font glyphs, atlas texture and file data
+static void UnloadDynamicFontData(DynamicFontData *data)
+{
+    UnregisterFontShapesTexture(data->font.texture);
+    rl_UnloadFontData(data->font.glyphs, data->font.glyphCount);
+    rlUnloadTexture(data->font.texture.id);
+    RL_FREE(data->font.recs);
+    RL_FREE(data->font.glyphLookup);
+    RL_FREE(data->buckets);
+    RL_FREE(data->cellData);
+    RL_FREE(data->fileData);
+
+    *data = (DynamicFontData){ 0 };
+}
 
-    for (int i = 0; i < glyphCount; i++)
-    {
-        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-        readVars = sscanf(buffer, "char id=%i x=%i y=%i width=%i height=%i xoffset=%i yoffset=%i xadvance=%i page=%i",
-                       &charId, &charX, &charY, &charWidth, &charHeight, &charOffsetX, &charOffsetY, &charAdvanceX, &pageID);
-        fileTextPtr += (readBytes + 1);
+// Get dynamic font data, NULL if font is not a dynamic font
+static DynamicFontData *GetDynamicFontData(rl_Font font)
+{
+    if ((font.glyphLookup == NULL) || (font.glyphLookup[0] >= 0)) return NULL;
 
-        if (readVars == 9)  // Make sure all char data has been properly read
-        {
-            // Get character rectangle in the font atlas texture
-            font.recs[i] = (rl_Rectangle){ (float)charX, (float)charY + (float)imHeight*pageID, (float)charWidth, (float)charHeight };
+    int id = font.glyphLookup[1];
+    if ((id <= 0) || (id > dynamicFonts.capacity)) return NULL;
 
-            // Save data properly in sprite font
-            font.glyphs[i].value = charId;
-            font.glyphs[i].offsetX = charOffsetX;
-            font.glyphs[i].offsetY = charOffsetY;
-            font.glyphs[i].advanceX = charAdvanceX;
+    DynamicFontData *data = &dynamicFonts.fonts[id - 1];
 
-            // Fill character image data from full font data
-            font.glyphs[i].image = rl_ImageFromImage(fullFont, font.recs[i]);
-        }
+    return (data->fileData != NULL)? data : NULL;
+}
+
+// Get dynamic font glyph index for codepoint, glyph is rasterized into atlas if not cached
+// NOTE: If codepoint is not found in the font it fallbacks to '?'
+static int GetDynamicFontGlyphIndex(DynamicFontData *data, int codepoint)
+{
+    unsigned int bucket = ((unsigned int)codepoint*2654435761u) & (unsigned int)data->bucketMask;
+    int cell = data->buckets[bucket];
+
+    while ((cell >= 0) && (data->font.glyphs[cell].value != codepoint)) cell = data->chain[cell];
+
+    if (cell < 0)
+    {
+        if (stbtt_FindGlyphIndex(&data->fontInfo, codepoint) == 0) return (codepoint != 63)? GetDynamicFontGlyphIndex(data, 63) : 0;
+
+        // Free cells are used first, least recently used glyph is evicted afterwards
+        if (data->usedCount < data->font.glyphCount) cell = data->usedCount++;
         else
         {
-            font.glyphs[i].image = rl_GenImageColor((int)font.recs[i].width, (int)font.recs[i].height, rl_BLACK);
-            TRACELOG(LOG_WARNING, "FONT: [%s] Some characters data not correctly provided", fileName);
+            cell = data->last;
+
+            // NOTE: Evicted glyph could be used by batched draws, batch is drawn before overwriting it
+            rlDrawRenderBatchActive();
+
+            int *link = &data->buckets[((unsigned int)data->font.glyphs[cell].value*2654435761u) & (unsigned int)data->bucketMask];
+            while (*link != cell) link = &data->chain[*link];
+            *link = data->chain[cell];
+
+            data->last = data->prev[cell];
+            if (data->last >= 0) data->next[data->last] = -1;
+            else data->first = -1;
+
+            rl_UnloadImage(data->font.glyphs[cell].image);
         }
+
+        LoadDynamicFontGlyph(data, cell, codepoint);
+
+        data->chain[cell] = data->buckets[bucket];
+        data->buckets[bucket] = cell;
+    }
+    else if (cell != data->first)
+    {
+        // Unlink used glyph, relinked as most recently used
+        data->next[data->prev[cell]] = data->next[cell];
+        if (data->next[cell] >= 0) data->prev[data->next[cell]] = data->prev[cell];
+        else data->last = data->prev[cell];
     }
+    else return cell;
 
-    rl_UnloadImage(fullFont);
-    rl_UnloadFileText(fileText);
+    data->prev[cell] = -1;
+    data->next[cell] = data->first;
+    if (data->first >= 0) data->prev[data->first] = cell;
+    data->first = cell;
+    if (data->last < 0) data->last = cell;
+
+    return cell;
+}
+
+// Load dynamic font glyph into atlas cell, glyph rasterized and cell uploaded to texture
+static void LoadDynamicFontGlyph(DynamicFontData *data, int cell, int codepoint)
+{
+    rl_GlyphInfo glyph = { 0 };
+    int padding = data->font.glyphPadding;
+    int bitmapWidth = 0;
+    int bitmapHeight = 0;
+
+    glyph.value = codepoint;
+
+    unsigned char *bitmap = stbtt_GetCodepointBitmap(&data->fontInfo, data->scaleFactor, data->scaleFactor, codepoint,
+        &bitmapWidth, &bitmapHeight, &glyph.offsetX, &glyph.offsetY);
+    stbtt_GetCodepointHMetrics(&data->fontInfo, codepoint, &glyph.advanceX, NULL);
+    glyph.advanceX = (int)((float)glyph.advanceX*data->scaleFactor);
+    glyph.offsetY += data->ascent;
+
+    // Empty glyph for space characters, same as rl_LoadFontData()
+    if ((codepoint == 0x20) || (codepoint == 0x3000))
+    {
+        RL_FREE(bitmap);
+        bitmap = NULL;
+        bitmapWidth = (glyph.advanceX > 0)? glyph.advanceX : 0;
+        bitmapHeight = data->font.baseSize;
+        glyph.offsetX = 0;
+        glyph.offsetY = 0;
+    }
+
+    // NOTE: Glyphs bigger than cells are clipped, it only happens for oversized glyphs
+    int width = ((bitmapWidth + 2*padding) > data->cellWidth)? data->cellWidth - 2*padding : bitmapWidth;
+    int height = ((bitmapHeight + 2*padding) > data->cellHeight)? data->cellHeight - 2*padding : bitmapHeight;
+
+    // Glyph image converted from GRAYSCALE to GRAY_ALPHA, same as font atlas
+    if ((width > 0) && (height > 0)) glyph.image.data = RL_MALLOC(width*height*2);
+
+    if (glyph.image.data != NULL)
+    {
+        glyph.image.width = width;
+        glyph.image.height = height;
+        glyph.image.mipmaps = 1;
+        glyph.image.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+        unsigned char *pixels = (unsigned char *)glyph.image.data;
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                pixels[(y*width + x)*2] = 255;
+                pixels[(y*width + x)*2 + 1] = (bitmap != NULL)? bitmap[y*bitmapWidth + x] : 0;
+            }
+        }
+    }
+    else
+    {
+        width = 0;
+        height = 0;
+    }
+
+    RL_FREE(bitmap);
+
+    // Full cell is uploaded, clearing evicted glyph and padding
+    int cellX = (cell%data->columns)*data->cellWidth;
+    int cellY = (cell/data->columns)*data->cellHeight;
+
+    memset(data->cellData, 0, data->cellWidth*data->cellHeight*2);
+    for (int y = 0; y < height; y++) memcpy(data->cellData + ((y + padding)*data->cellWidth + padding)*2, (unsigned char *)glyph.image.data + y*width*2, width*2);
+
+    rlUpdateTexture(data->font.texture.id, cellX, cellY, data->cellWidth, data->cellHeight, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, data->cellData);
+
+    data->font.glyphs[cell] = glyph;
+    data->font.recs[cell] = (rl_Rectangle){ (float)(cellX + padding), (float)(cellY + padding), (float)width, (float)height };
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Process font glyphs range on current thread, glyphs images generated for glyphs codepoints
+static void ProcessFontGlyphsRange(const void *data, int start, int end)
+{
+    const FontGlyphsJob *job = (const FontGlyphsJob *)data;
+    const stbtt_fontinfo *fontInfo = job->fontInfo;
+    float scaleFactor = job->scaleFactor;
+    int fontSize = job->fontSize;
+    int type = job->type;
+
+    for (int k = start; k < end; k++)
+    {
+        rl_GlyphInfo *glyph = &job->glyphs[k];
+        int cpWidth = 0, cpHeight = 0;   // Codepoint width and height (on generation)
+        int cp = glyph->value;           // Codepoint value to get info for
+
+        //  Render a unicode codepoint to a bitmap
+        //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
+        //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+        //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+        switch (type)
+        {
+            case FONT_DEFAULT:
+            case FONT_BITMAP:
+            {
+                glyph->image.data = stbtt_GetCodepointBitmap(fontInfo, scaleFactor, scaleFactor, cp,
+                    &cpWidth, &cpHeight, &glyph->offsetX, &glyph->offsetY);
+            } break;
+            case FONT_SDF:
+            {
+                if (cp != 32)
+                {
+                    glyph->image.data = stbtt_GetCodepointSDF(fontInfo, scaleFactor, cp,
+                        FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE,
+                        &cpWidth, &cpHeight, &glyph->offsetX, &glyph->offsetY);
+                }
+            } break;
+            case FONT_MSDF:
+            {
+                if (cp != 32) glyph->image.data = GenGlyphMSDF(fontInfo, scaleFactor, cp, &cpWidth, &cpHeight, &glyph->offsetX, &glyph->offsetY);
+            } break;
+            default: break;
+        }
+
+        int format = (type == FONT_MSDF)? PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 : PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+        if (glyph->image.data != NULL)    // Glyph data has been found in the font
+        {
+            stbtt_GetCodepointHMetrics(fontInfo, cp, &glyph->advanceX, NULL);
+            glyph->advanceX = (int)((float)glyph->advanceX*scaleFactor);
+
+            // WARNING: If requested SDF font, sdf-glyph height is definitely bigger than fontSize due to FONT_SDF_CHAR_PADDING
+            if ((type != FONT_SDF) && (type != FONT_MSDF) && (cpHeight > fontSize)) TRACELOG(LOG_WARNING, "FONT: [0x%04x] Glyph height is bigger than requested font size: %i > %i", cp, cpHeight, (int)fontSize);
+
+            // Load glyph image
+            glyph->image.width = cpWidth;
+            glyph->image.height = cpHeight;
+            glyph->image.mipmaps = 1;
+            glyph->image.format = format;
+
+            glyph->offsetY += (int)((float)job->ascent*scaleFactor);
+        }
+        //else TRACELOG(LOG_WARNING, "FONT: Glyph [0x%08x] has no image data available", cp); // Only reported for 0x20 and 0x3000
+
+        // We create an empty image for Space character (0x20), useful for sprite font generation
+        // NOTE: Another space to consider: 0x3000 (CJK - Ideographic Space)
+        if ((cp == 0x20) || (cp == 0x3000))
+        {
+            stbtt_GetCodepointHMetrics(fontInfo, cp, &glyph->advanceX, NULL);
+            glyph->advanceX = (int)((float)glyph->advanceX*scaleFactor);
+
+            rl_Image imSpace = {
+                .data = NULL,
+                .width = glyph->advanceX,
+                .height = fontSize,
+                .mipmaps = 1,
+                .format = format
+            };
+
+            // Only allocate space image if required
+            RL_FREE(glyph->image.data);
+            if (glyph->advanceX > 0) imSpace.data = RL_CALLOC(glyph->advanceX*fontSize, rl_GetPixelDataSize(1, 1, format));
+            else glyph->advanceX = 0;
+
+            glyph->image = imSpace;
+        }
+
+        if ((type == FONT_BITMAP) && (glyph->image.data != NULL))
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < cpWidth*cpHeight; p++)
+            {
+                if (((unsigned char *)glyph->image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD)
+                    ((unsigned char *)glyph->image.data)[p] = 0;
+                else ((unsigned char *)glyph->image.data)[p] = 255;
+            }
+        }
+    }
+}
+
+// Get glyph shape edge direction at edge start or end, first non-degenerated control polygon side
+static rl_Vector2 GetGlyphEdgeDirection(const GlyphEdge *edge, bool end)
+{
+    rl_Vector2 direction = { 0 };
+
+    for (int i = 1; i <= edge->order; i++)
+    {
+        direction = end? (rl_Vector2){ edge->x[edge->order] - edge->x[edge->order - i], edge->y[edge->order] - edge->y[edge->order - i] } :
+                         (rl_Vector2){ edge->x[i] - edge->x[0], edge->y[i] - edge->y[0] };
+
+        float length = sqrtf(direction.x*direction.x + direction.y*direction.y);
+
+        if (length > 0.0f) return (rl_Vector2){ direction.x/length, direction.y/length };
+    }
+
+    return direction;
+}
+
+// Generate glyph multi-channel signed distance field (RGBA, alpha is single-channel SDF)
+// NOTE: Glyph contours edges are split by corners and colored so each channel sees only some edges meeting
+// at a corner, channels median keeps corners sharp when scaled, same image layout as stbtt_GetCodepointSDF()
+static unsigned char *GenGlyphMSDF(const stbtt_fontinfo *fontInfo, float scale, int codepoint, int *width, int *height, int *offsetX, int *offsetY)
+{
+    int ix0 = 0, iy0 = 0, ix1 = 0, iy1 = 0;
+    stbtt_GetCodepointBitmapBox(fontInfo, codepoint, scale, scale, &ix0, &iy0, &ix1, &iy1);
+
+    if ((ix0 == ix1) || (iy0 == iy1)) return NULL;
+
+    stbtt_vertex *vertices = NULL;
+    int vertexCount = stbtt_GetCodepointShape(fontInfo, codepoint, &vertices);
+    if (vertexCount <= 0) return NULL;
+
+    // Load glyph contours edges, y axis inverted for y-downwards image
+    GlyphEdge *edges = (GlyphEdge *)RL_MALLOC((vertexCount + 1)*sizeof(GlyphEdge));
+    int *contourStarts = (int *)RL_MALLOC((vertexCount + 2)*sizeof(int));
+    int edgeCount = 0;
+    int contourCount = 0;
+    float px = 0.0f, py = 0.0f;
+    float startX = 0.0f, startY = 0.0f;
+
+    for (int i = 0; i <= vertexCount; i++)
+    {
+        float x = (i < vertexCount)? vertices[i].x*scale : startX;
+        float y = (i < vertexCount)? -vertices[i].y*scale : startY;
+        int type = (i < vertexCount)? vertices[i].type : STBTT_vmove;
+
+        if (type == STBTT_vmove)
+        {
+            // Previous contour is closed if required and finished
+            if ((edgeCount > ((contourCount > 0)? contourStarts[contourCount - 1] : 0)) && ((px != startX) || (py != startY)))
+            {
+                edges[edgeCount] = (GlyphEdge){ .x = { px, startX }, .y = { py, startY }, .order = 1 };
+                edgeCount++;
+            }
+
+            if ((contourCount > 0) && (edgeCount == contourStarts[contourCount - 1])) contourCount--;    // Empty contour dropped
+            if (i == vertexCount) break;
+
+            contourStarts[contourCount++] = edgeCount;
+            startX = x;
+            startY = y;
+        }
+        else
+        {
+            GlyphEdge edge = { .x = { px }, .y = { py } };
+
+            if (type == STBTT_vline) edge.order = 1;
+            else if (type == STBTT_vcurve)
+            {
+                edge.order = 2;
+                edge.x[1] = vertices[i].cx*scale;
+                edge.y[1] = -vertices[i].cy*scale;
+            }
+            else
+            {
+                edge.order = 3;
+                edge.x[1] = vertices[i].cx*scale;
+                edge.y[1] = -vertices[i].cy*scale;
+                edge.x[2] = vertices[i].cx1*scale;
+                edge.y[2] = -vertices[i].cy1*scale;
+            }
+
+            edge.x[edge.order] = x;
+            edge.y[edge.order] = y;
+
+            bool degenerated = true;
+            for (int j = 1; j <= edge.order; j++) if ((edge.x[j] != px) || (edge.y[j] != py)) degenerated = false;
+
+            if (!degenerated) edges[edgeCount++] = edge;
+        }
+
+        px = x;
+        py = y;
+    }
+
+    contourStarts[contourCount] = edgeCount;
+    stbtt_FreeShape(fontInfo, vertices);
+
+    // Edges colors: contours without corners use all channels, corners switch colors
+    // NOTE: Palette colors: cyan, magenta, yellow, two consecutive colors always share one channel
+    static const int palette[3] = { 6, 5, 3 };
+    const float crossThreshold = 0.1411f;   // sin(3 rad), corners sharper than ~8 degrees
+
+    int segmentCapacity = 0;
+    for (int i = 0; i < edgeCount; i++) segmentCapacity += (edges[i].order == 1)? 1 : FONT_MSDF_CURVE_SEGMENTS;
+
+    FontEdgeSegment *segments = (FontEdgeSegment *)RL_MALLOC((segmentCapacity + 1)*sizeof(FontEdgeSegment));
+    int segmentCount = 0;
+    float area = 0.0f;
+
+    for (int c = 0; c < contourCount; c++)
+    {
+        int first = contourStarts[c];
+        int count = contourStarts[c + 1] - first;
+        int cornerCount = 0;
+        int firstCorner = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            rl_Vector2 a = GetGlyphEdgeDirection(&edges[first + (i + count - 1)%count], true);
+            rl_Vector2 b = GetGlyphEdgeDirection(&edges[first + i], false);
+
+            edges[first + i].corner = (((a.x*b.x + a.y*b.y) <= 0.0f) || (fabsf(a.x*b.y - a.y*b.x) > crossThreshold));
+
+            if (edges[first + i].corner)
+            {
+                if (cornerCount == 0) firstCorner = i;
+                cornerCount++;
+            }
+        }
+
+        // Edges colored from first corner, last spline color must differ from first spline color
+        for (int i = 0, spline = 0; i < count; i++)
+        {
+            GlyphEdge *edge = &edges[first + (firstCorner + i)%count];
+
+            if (cornerCount < 2) edge->color = 7;
+            else
+            {
+                if ((i > 0) && edge->corner) spline++;
+
+                edge->color = palette[spline%3];
+                if ((spline == (cornerCount - 1)) && ((spline%3) == 0)) edge->color = palette[1];
+            }
+        }
+
+        // Edges flattened to segments, curves evaluated at regular parameter steps
+        int contourSegmentsStart = segmentCount;
+
+        for (int i = 0; i < count; i++)
+        {
+            const GlyphEdge *edge = &edges[first + (firstCorner + i)%count];
+            int steps = (edge->order == 1)? 1 : FONT_MSDF_CURVE_SEGMENTS;
+            float prevX = edge->x[0], prevY = edge->y[0];
+
+            for (int s = 1; s <= steps; s++)
+            {
+                float t = (float)s/(float)steps;
+                float u = 1.0f - t;
+                float x = edge->x[edge->order], y = edge->y[edge->order];
+
+                if (s < steps)
+                {
+                    if (edge->order == 2)
+                    {
+                        x = u*u*edge->x[0] + 2.0f*u*t*edge->x[1] + t*t*edge->x[2];
+                        y = u*u*edge->y[0] + 2.0f*u*t*edge->y[1] + t*t*edge->y[2];
+                    }
+                    else if (edge->order == 3)
+                    {
+                        x = u*u*u*edge->x[0] + 3.0f*u*u*t*edge->x[1] + 3.0f*u*t*t*edge->x[2] + t*t*t*edge->x[3];
+                        y = u*u*u*edge->y[0] + 3.0f*u*u*t*edge->y[1] + 3.0f*u*t*t*edge->y[2] + t*t*t*edge->y[3];
+                    }
+                }
+
+                if ((x != prevX) || (y != prevY))
+                {
+                    FontEdgeSegment *segment = &segments[segmentCount++];
+
+                    segment->ax = prevX;
+                    segment->ay = prevY;
+                    segment->bx = x;
+                    segment->by = y;
+                    segment->color = edge->color;
+                    segment->ends = 0;
+                    if (s == 1) segment->ends |= 1;
+                    if (s == steps) segment->ends |= 2;
+
+                    float dx = x - prevX, dy = y - prevY;
+                    segment->invLength = 1.0f/sqrtf(dx*dx + dy*dy);
+
+                    area += prevX*y - x*prevY;
+                }
+
+                prevX = x;
+                prevY = y;
+            }
+        }
+
+        // Contour with one corner (teardrop) split in three colors along its segments
+        if (cornerCount == 1)
+        {
+            int contourSegments = segmentCount - contourSegmentsStart;
+
+            for (int i = 0; i < contourSegments; i++)
+            {
+                segments[contourSegmentsStart + i].color = ((i*3) < contourSegments)? palette[0] : (((i*3) < 2*contourSegments)? 7 : palette[1]);
+            }
+        }
+    }
+
+    RL_FREE(edges);
+    RL_FREE(contourStarts);
+
+    // Signed distances positive inside, inside is on the left of segments for positive area contours
+    float orientation = (area >= 0.0f)? 1.0f : -1.0f;
+
+    ix0 -= FONT_SDF_CHAR_PADDING;
+    iy0 -= FONT_SDF_CHAR_PADDING;
+    ix1 += FONT_SDF_CHAR_PADDING;
+    iy1 += FONT_SDF_CHAR_PADDING;
+
+    int w = ix1 - ix0;
+    int h = iy1 - iy0;
+    unsigned char *pixels = (unsigned char *)RL_MALLOC(w*h*4);
+
+    for (int y = 0; y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            float sx = (float)(ix0 + x) + 0.5f;
+            float sy = (float)(iy0 + y) + 0.5f;
+
+            // Nearest segment per channel, ties at shared points resolved by orthogonality
+            int nearest[3] = { -1, -1, -1 };
+            float nearestDist[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+            float nearestOrtho[3] = { 0 };
+            float minDist = FLT_MAX;
+            int winding = 0;
+
+            for (int s = 0; s < segmentCount; s++)
+            {
+                const FontEdgeSegment *segment = &segments[s];
+                float abx = segment->bx - segment->ax, aby = segment->by - segment->ay;
+                float apx = sx - segment->ax, apy = sy - segment->ay;
+                float t = (apx*abx + apy*aby)*segment->invLength*segment->invLength;
+                float qx = segment->ax, qy = segment->ay;
+
+                if (t >= 1.0f) { qx = segment->bx; qy = segment->by; }
+                else if (t > 0.0f) { qx += abx*t; qy += aby*t; }
+
+                float dx = sx - qx, dy = sy - qy;
+                float dist = dx*dx + dy*dy;
+
+                if (dist < minDist) minDist = dist;
+
+                for (int ch = 0; ch < 3; ch++)
+                {
+                    if (!(segment->color & (1 << ch)) || (dist > nearestDist[ch])) continue;
+
+                    float ortho = (dist > 0.0f)? fabsf(abx*dy - aby*dx)*segment->invLength/sqrtf(dist) : 1.0f;
+
+                    if ((dist < nearestDist[ch]) || (ortho > nearestOrtho[ch]))
+                    {
+                        nearest[ch] = s;
+                        nearestDist[ch] = dist;
+                        nearestOrtho[ch] = ortho;
+                    }
+                }
+
+                // Non-zero winding, horizontal ray to the right
+                if ((segment->ay <= sy) != (segment->by <= sy))
+                {
+                    float crossX = segment->ax + (sy - segment->ay)*abx/aby;
+                    if (crossX > sx) winding += (segment->by > segment->ay)? 1 : -1;
+                }
+            }
+
+            bool inside = (winding != 0);
+            float trueDist = inside? sqrtf(minDist) : -sqrtf(minDist);
+            int values[4] = { 0 };
+
+            values[3] = (int)(FONT_SDF_ON_EDGE_VALUE + FONT_SDF_PIXEL_DIST_SCALE*trueDist);
+
+            for (int ch = 0; ch < 3; ch++)
+            {
+                float dist = trueDist;
+
+                if (nearest[ch] >= 0)
+                {
+                    const FontEdgeSegment *segment = &segments[nearest[ch]];
+                    float abx = segment->bx - segment->ax, aby = segment->by - segment->ay;
+                    float apx = sx - segment->ax, apy = sy - segment->ay;
+                    float t = (apx*abx + apy*aby)*segment->invLength*segment->invLength;
+                    float cross = (abx*apy - aby*apx)*segment->invLength*orientation;
+
+                    dist = (cross >= 0.0f)? sqrtf(nearestDist[ch]) : -sqrtf(nearestDist[ch]);
+
+                    // Pseudo-distance beyond edges ends, distance to edge line extension
+                    if (((t < 0.0f) && (segment->ends & 1)) || ((t > 1.0f) && (segment->ends & 2)))
+                    {
+                        if (fabsf(cross) <= fabsf(dist)) dist = cross;
+                    }
+                }
+
+                values[ch] = (int)(FONT_SDF_ON_EDGE_VALUE + FONT_SDF_PIXEL_DIST_SCALE*dist);
+            }
+
+            for (int ch = 0; ch < 4; ch++) values[ch] = (values[ch] < 0)? 0 : ((values[ch] > 255)? 255 : values[ch]);
+
+            // Channels median not matching inside test (edges coloring clash) fallback to single channel distance
+            int median = (values[0] > values[1])? ((values[1] > values[2])? values[1] : ((values[0] > values[2])? values[2] : values[0])) :
+                                                  ((values[0] > values[2])? values[0] : ((values[1] > values[2])? values[2] : values[1]));
+
+            if ((median >= FONT_SDF_ON_EDGE_VALUE) != inside) values[0] = values[1] = values[2] = values[3];
+
+            for (int ch = 0; ch < 4; ch++) pixels[(y*w + x)*4 + ch] = (unsigned char)values[ch];
+        }
+    }
+
+    RL_FREE(segments);
+
+    *width = w;
+    *height = h;
+    *offsetX = ix0;
+    *offsetY = iy0;
+
+    return pixels;
+}
+
+// Process font kerning range, glyphs pairs kerning read by rows (worker thread)
+static void ProcessFontKerningRange(const void *data, int start, int end)
+{
+    const FontKerningJob *job = (const FontKerningJob *)data;
+
+    for (int i = start; i < end; i++)
+    {
+        for (int j = 0; j < job->count; j++)
+        {
+            job->values[i*job->count + j] = (short)stbtt_GetGlyphKernAdvance(job->fontInfo, job->glyphIndices[i], job->glyphIndices[j]);
+        }
+    }
+}
+
+// Load font kerning table from TTF font data (kern and GPOS tables), font glyphs indices pairs
+// NOTE: All pairs are read for first FONT_KERNING_MAX_GLYPHS glyphs, pairs with other glyphs only from kern table
+static int *LoadFontKerning(const unsigned char *fileData, int fontSize, const rl_GlyphInfo *glyphs, int glyphCount)
+{
+    stbtt_fontinfo fontInfo = { 0 };
+
+    if ((glyphs == NULL) || (glyphCount <= 0) || !stbtt_InitFont(&fontInfo, (unsigned char *)fileData, 0)) return NULL;
+    if ((fontInfo.kern == 0) && (fontInfo.gpos == 0)) return NULL;
+
+    float scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
+    int count = (glyphCount < FONT_KERNING_MAX_GLYPHS)? glyphCount : FONT_KERNING_MAX_GLYPHS;
+
+    int *glyphIndices = (int *)RL_MALLOC(glyphCount*sizeof(int));
+    for (int i = 0; i < glyphCount; i++) glyphIndices[i] = stbtt_FindGlyphIndex(&fontInfo, glyphs[i].value);
+
+    // Pairs kerning read on worker threads, GPOS lookups are expensive
+    FontKerningJob job = { 0 };
+    job.fontInfo = &fontInfo;
+    job.glyphIndices = glyphIndices;
+    job.count = count;
+    job.values = (short *)RL_CALLOC(count*count, sizeof(short));
+
+    RunImageWorkerTasks(ProcessFontKerningRange, &job, count, FONT_GLYPHS_CHUNK_SIZE);
+
+    // Kern table pairs with glyphs beyond first glyphs, mapped to font glyphs indices
+    stbtt_kerningentry *entries = NULL;
+    int entryCount = 0;
+    int *fontIndices = NULL;
+
+    if ((glyphCount > count) && (fontInfo.kern != 0))
+    {
+        entryCount = stbtt_GetKerningTableLength(&fontInfo);
+        entries = (stbtt_kerningentry *)RL_MALLOC(entryCount*sizeof(stbtt_kerningentry));
+        entryCount = stbtt_GetKerningTable(&fontInfo, entries, entryCount);
+
+        fontIndices = (int *)RL_MALLOC(fontInfo.numGlyphs*sizeof(int));
+        for (int i = 0; i < fontInfo.numGlyphs; i++) fontIndices[i] = -1;
+        for (int i = glyphCount - 1; i >= 0; i--) if ((glyphIndices[i] > 0) && (glyphIndices[i] < fontInfo.numGlyphs)) fontIndices[glyphIndices[i]] = i;
+    }
+
+    int pairCount = 0;
+    for (int i = 0; i < count*count; i++) if (job.values[i] != 0) pairCount++;
+
+    int *pairs = (int *)RL_MALLOC((pairCount + entryCount + 1)*3*sizeof(int));
+    pairCount = 0;
+
+    for (int i = 0; i < count*count; i++)
+    {
+        int advance = (int)roundf(job.values[i]*scaleFactor*64.0f);
+        if (advance == 0) continue;
+
+        pairs[pairCount*3] = i/count;
+        pairs[pairCount*3 + 1] = i%count;
+        pairs[pairCount*3 + 2] = advance;
+        pairCount++;
+    }
+
+    for (int i = 0; i < entryCount; i++)
+    {
+        if ((entries[i].glyph1 >= fontInfo.numGlyphs) || (entries[i].glyph2 >= fontInfo.numGlyphs)) continue;
+
+        int first = fontIndices[entries[i].glyph1];
+        int second = fontIndices[entries[i].glyph2];
+        int advance = (int)roundf(entries[i].advance*scaleFactor*64.0f);
+
+        if ((first < 0) || (second < 0) || ((first < count) && (second < count)) || (advance == 0)) continue;
+
+        pairs[pairCount*3] = first;
+        pairs[pairCount*3 + 1] = second;
+        pairs[pairCount*3 + 2] = advance;
+        pairCount++;
+    }
+
+    int *kerning = LoadKerningTable(pairs, pairCount);
+
+    RL_FREE(pairs);
+    RL_FREE(fontIndices);
+    RL_FREE(entries);
+    RL_FREE(job.values);
+    RL_FREE(glyphIndices);
+
+    return kerning;
+}
+#endif
+
+// Load font from memory buffer with glyphs generation font type (rl_FontType)
+static rl_Font LoadFontFromMemoryType(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount, int type)
+{
+    rl_Font font = { 0 };
+    rl_Image atlas = { 0 };
+    bool cached = false;            // Font atlas and glyphs loaded from font cache
+#if defined(SUPPORT_FONT_ATLAS_CACHE)
+    char cachePath[MAX_FILEPATH_LENGTH] = { 0 };    // Font cache file path (TTF fonts only)
+#endif
+
+    char fileExtLower[16] = { 0 };
+    strncpy(fileExtLower, rl_TextToLower(fileType), 16 - 1);
+
+    font.baseSize = fontSize;
+    font.glyphPadding = 0;
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    if (rl_TextIsEqual(fileExtLower, ".ttf") ||
+        rl_TextIsEqual(fileExtLower, ".otf"))
+    {
+    #if defined(SUPPORT_FONT_ATLAS_CACHE)
+        // Font atlas and glyphs metrics loaded from cache if available, skipping glyphs rasterization
+        GetFontCachePath(fileData, dataSize, fontSize, codepoints, codepointCount, type, cachePath);
+        cached = LoadFontCache(cachePath, &font, &atlas);
+    #endif
+        if (!cached)
+        {
+            font.glyphs = rl_LoadFontData(fileData, dataSize, font.baseSize, codepoints, (codepointCount > 0)? codepointCount : 95, type, &font.glyphCount);
+            font.kerning = LoadFontKerning(fileData, font.baseSize, font.glyphs, font.glyphCount);
+            font.type = type;
+        }
+    }
+    else
+#endif
+#if defined(SUPPORT_FILEFORMAT_BDF)
+    if (rl_TextIsEqual(fileExtLower, ".bdf"))
+    {
+        if (type != FONT_DEFAULT) TRACELOG(LOG_WARNING, "FONT: BDF font type not supported, using default");
+
+        font.glyphs = LoadFontDataBDF(fileData, dataSize, codepoints, (codepointCount > 0)? codepointCount : 95, &font.baseSize);
+        font.glyphCount = (codepointCount > 0)? codepointCount : 95;
+    }
+    else
+#endif
+#if defined(SUPPORT_FILEFORMAT_RFNT)
+    if (rl_TextIsEqual(fileExtLower, ".rfnt"))
+    {
+        // NOTE: Cooked font provides its own size, type and atlas, generation parameters are ignored
+        cached = LoadFontCacheFromMemory(fileData, dataSize, &font, &atlas);
+        if (!cached) TRACELOG(LOG_WARNING, "FONT: Cooked font file data not valid");
+    }
+    else
+#endif
+    {
+        font.glyphs = NULL;
+    }
+
+#if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF) || defined(SUPPORT_FILEFORMAT_RFNT)
+    if (font.glyphs != NULL)
+    {
+        // NOTE: SDF glyphs are bigger than font size (distance padding), packed with skyline algorithm
+        bool distanceField = ((font.type == FONT_SDF) || (font.type == FONT_MSDF));
+
+    #if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
+        if (!cached)
+        {
+            font.glyphPadding = FONT_TTF_DEFAULT_CHARS_PADDING;
+            atlas = rl_GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, distanceField? 1 : 0);
+
+        #if defined(SUPPORT_FONT_ATLAS_CACHE)
+            if (cachePath[0] != '\0') SaveFontCache(cachePath, font, atlas);
+        #endif
+        }
+    #endif
+
+        font.texture = LoadFontAtlasTexture(atlas, font.type);
+
+        // Distance fields are interpolated, edges are computed by shader
+        if (distanceField) rl_SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+
+    #if defined(SUPPORT_FONT_ATLAS_WHITE_REC)
+        // NOTE: Atlas white rectangle center pixel is used for shapes drawing, avoiding pixel bleeding
+        if ((atlas.width >= 3) && (atlas.height >= 3)) RegisterFontShapesTexture(font.texture, (rl_Rectangle){ (float)atlas.width - 2, (float)atlas.height - 2, 1, 1 });
+    #endif
+
+        // Update glyphs[i].image to use alpha, required to be used on rl_ImageDrawText()
+        for (int i = 0; i < font.glyphCount; i++)
+        {
+            rl_UnloadImage(font.glyphs[i].image);
+            font.glyphs[i].image = rl_ImageFromImage(atlas, font.recs[i]);
+        }
+
+        rl_UnloadImage(atlas);
+
+        font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
+
+        TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs | %i kerning pairs%s)", font.baseSize, font.glyphCount,
+            (font.kerning != NULL)? font.kerning[1] : 0, cached? " | cached atlas" : "");
+    }
+    else font = rl_GetFontDefault();
+#else
+    font = rl_GetFontDefault();
+#endif
+
+    return font;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF) || defined(SUPPORT_FILEFORMAT_BDF)
+// Copy glyph image into font atlas, glyph rows clipped to atlas bounds
+static void CopyGlyphToAtlas(rl_Image *atlas, rl_Image glyph, int posX, int posY, int bpp)
+{
+    int x0 = (posX < 0)? -posX : 0;
+    int x1 = ((posX + glyph.width) > atlas->width)? (atlas->width - posX) : glyph.width;
+
+    if ((glyph.data == NULL) || (x1 <= x0)) return;
+
+    for (int y = 0; y < glyph.height; y++)
+    {
+        int destY = posY + y;
+
+        // Security: check both lower and upper bounds
+        if ((destY < 0) || (destY >= atlas->height)) continue;
+
+        memcpy((unsigned char *)atlas->data + (destY*atlas->width + posX + x0)*bpp,
+            (unsigned char *)glyph.data + (y*glyph.width + x0)*bpp, (x1 - x0)*bpp);
+    }
+}
+#endif
+
+#if defined(SUPPORT_FONT_ATLAS_CACHE)
+// Get font cache file path, cache entries are keyed by SHA256 of font data and generation parameters
+static void GetFontCachePath(const unsigned char *fileData, int dataSize, int fontSize, const int *codepoints, int codepointCount, int type, char *cachePath)
+{
+    // Compute cache key: font data hash + generation parameters + requested codepoints (NULL codepoints use default set)
+    // NOTE: Font data is identified by its tables directory, it contains all font tables checksums,
+    // hashing it instead of full font data avoids hashing several MB on every load for CJK fonts
+    codepointCount = (codepointCount > 0)? codepointCount : 95;
+    int codepointsSize = (codepoints != NULL)? codepointCount*(int)sizeof(int) : 0;
+    int keySize = 32 + 6*(int)sizeof(int) + codepointsSize;
+    int directorySize = dataSize;
+
+    if (dataSize >= 12)
+    {
+        int tableCount = (fileData[4] << 8) | fileData[5];
+        if ((12 + 16*tableCount) < dataSize) directorySize = 12 + 16*tableCount;
+    }
+
+    unsigned char *keyData = (unsigned char *)RL_MALLOC(keySize);
+    int params[6] = { FONT_CACHE_VERSION, dataSize, fontSize, type, codepointCount, FONT_TTF_DEFAULT_CHARS_PADDING };
+
+    memcpy(keyData, rl_ComputeSHA256((unsigned char *)fileData, directorySize), 32);
+    memcpy(keyData + 32, params, sizeof(params));
+    if (codepointsSize > 0) memcpy(keyData + 32 + sizeof(params), codepoints, codepointsSize);
+
+    unsigned int *hash = rl_ComputeSHA256(keyData, keySize);
+    RL_FREE(keyData);
+
+    strncpy(cachePath, rl_TextFormat("%s/%s/%08x%08x%08x%08x%08x%08x%08x%08x.bin", GetStorageBasePath(), FONT_CACHE_DIRECTORY,
+        hash[0], hash[1], hash[2], hash[3], hash[4], hash[5], hash[6], hash[7]), MAX_FILEPATH_LENGTH - 1);
+}
+
+// Load font glyphs metrics and atlas image from font cache file
+static bool LoadFontCache(const char *cachePath, rl_Font *font, rl_Image *atlas)
+{
+    bool success = false;
+
+    if (!rl_FileExists(cachePath)) return success;
+
+    int dataSize = 0;
+    unsigned char *fileData = rl_LoadFileData(cachePath, &dataSize);
+
+    if (fileData != NULL)
+    {
+        success = LoadFontCacheFromMemory(fileData, dataSize, font, atlas);
+        if (!success) TRACELOG(LOG_WARNING, "FONT: [%s] Font cache file not valid", cachePath);
+
+        rl_UnloadFileData(fileData);
+    }
+
+    return success;
+}
+#endif
+
+#if defined(RTEXT_FONT_ATLAS_FILE_ENABLED)
+// Load font glyphs metrics and atlas image from font cache file data
+// NOTE: Glyphs images are not loaded, they are extracted from atlas as generated fonts
+static bool LoadFontCacheFromMemory(const unsigned char *fileData, int dataSize, rl_Font *font, rl_Image *atlas)
+{
+    bool success = false;
+
+    FontCacheHeader header = { 0 };
+    if (dataSize >= (int)sizeof(FontCacheHeader)) memcpy(&header, fileData, sizeof(FontCacheHeader));
+
+    // Counts and atlas dimensions are checked against available data before computing sizes,
+    // atlas requires at least 2 bits per pixel (compressed formats)
+    int available = (dataSize >= (int)sizeof(FontCacheHeader))? (dataSize - (int)sizeof(FontCacheHeader)) : 0;
+    bool valid = (memcmp(header.id, "rFNA", 4) == 0) && (header.version == FONT_CACHE_VERSION) &&
+        (header.glyphCount > 0) && (header.glyphCount <= available/(int)sizeof(FontCacheGlyph)) &&
+        (header.kerningCount >= 0) && (header.kerningCount <= available/(3*(int)sizeof(int))) &&
+        (header.atlasWidth > 0) && (header.atlasHeight > 0) && ((long long)header.atlasWidth*header.atlasHeight <= (long long)available*4) &&
+        ((long long)header.atlasWidth*header.atlasHeight <= INT_MAX/16);
+
+    int glyphsSize = valid? header.glyphCount*(int)sizeof(FontCacheGlyph) : 0;
+    int atlasSize = valid? rl_GetPixelDataSize(header.atlasWidth, header.atlasHeight, header.atlasFormat) : 0;
+    int kerningSize = valid? header.kerningCount*3*(int)sizeof(int) : 0;
+
+    if (valid && (atlasSize > 0) && ((long long)dataSize == ((long long)sizeof(FontCacheHeader) + glyphsSize + atlasSize + kerningSize)))
+    {
+        const FontCacheGlyph *glyphs = (const FontCacheGlyph *)(fileData + sizeof(FontCacheHeader));
+
+        font->baseSize = header.baseSize;
+        font->glyphCount = header.glyphCount;
+        font->glyphPadding = header.glyphPadding;
+        font->type = header.type;
+        font->glyphs = (rl_GlyphInfo *)RL_CALLOC(header.glyphCount, sizeof(rl_GlyphInfo));
+        font->recs = (rl_Rectangle *)RL_MALLOC(header.glyphCount*sizeof(rl_Rectangle));
+
+        for (int i = 0; i < header.glyphCount; i++)
+        {
+            font->glyphs[i].value = glyphs[i].value;
+            font->glyphs[i].offsetX = glyphs[i].offsetX;
+            font->glyphs[i].offsetY = glyphs[i].offsetY;
+            font->glyphs[i].advanceX = glyphs[i].advanceX;
+            font->recs[i] = glyphs[i].rec;
+        }
+
+        atlas->data = RL_MALLOC(atlasSize);
+        memcpy(atlas->data, fileData + sizeof(FontCacheHeader) + glyphsSize, atlasSize);
+        atlas->width = header.atlasWidth;
+        atlas->height = header.atlasHeight;
+        atlas->mipmaps = 1;
+        atlas->format = header.atlasFormat;
+
+        // Kerning pairs stored as first index, second index, advance triples
+        if (header.kerningCount > 0)
+        {
+            int *pairs = (int *)RL_MALLOC(kerningSize);
+            memcpy(pairs, fileData + sizeof(FontCacheHeader) + glyphsSize + atlasSize, kerningSize);
+            font->kerning = LoadKerningTable(pairs, header.kerningCount);
+            RL_FREE(pairs);
+        }
+
+        success = true;
+    }
+
+    return success;
+}
+
+// Save font glyphs metrics and atlas image to font cache file
+static bool SaveFontCache(const char *cachePath, rl_Font font, rl_Image atlas)
+{
+    int glyphsSize = font.glyphCount*(int)sizeof(FontCacheGlyph);
+    int atlasSize = rl_GetPixelDataSize(atlas.width, atlas.height, atlas.format);
+    int kerningCount = (font.kerning != NULL)? font.kerning[1] : 0;
+    int fileSize = (int)sizeof(FontCacheHeader) + glyphsSize + atlasSize + kerningCount*3*(int)sizeof(int);
+    unsigned char *fileData = (unsigned char *)RL_CALLOC(fileSize, 1);
+
+    FontCacheHeader header = { { 'r', 'F', 'N', 'A' }, FONT_CACHE_VERSION, font.baseSize, font.glyphCount, font.glyphPadding, font.type, atlas.width, atlas.height, atlas.format, kerningCount };
+    memcpy(fileData, &header, sizeof(FontCacheHeader));
+
+    FontCacheGlyph *glyphs = (FontCacheGlyph *)(fileData + sizeof(FontCacheHeader));
+
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        glyphs[i].value = font.glyphs[i].value;
+        glyphs[i].offsetX = font.glyphs[i].offsetX;
+        glyphs[i].offsetY = font.glyphs[i].offsetY;
+        glyphs[i].advanceX = font.glyphs[i].advanceX;
+        glyphs[i].rec = font.recs[i];
+    }
+
+    memcpy(fileData + sizeof(FontCacheHeader) + glyphsSize, atlas.data, atlasSize);
+
+    // Kerning pairs copied from kerning table used slots
+    int *pairs = (int *)(fileData + sizeof(FontCacheHeader) + glyphsSize + atlasSize);
+
+    for (int i = 0, pairCount = 0; (kerningCount > 0) && (i <= font.kerning[0]); i++)
+    {
+        const int *slot = font.kerning + 2 + i*3;
+        if (slot[0] >= 0) memcpy(pairs + (pairCount++)*3, slot, 3*sizeof(int));
+    }
+
+    const char *cacheDir = rl_GetDirectoryPath(cachePath);
+    if (!rl_DirectoryExists(cacheDir)) rl_MakeDirectory(cacheDir);
+
+    bool success = rl_SaveFileData(cachePath, fileData, fileSize);
+    if (!success) TRACELOG(LOG_WARNING, "FONT: [%s] Failed to save font cache file", cachePath);
+
+    RL_FREE(fileData);
+
+    return success;
+}
+#endif
+
+// Load font atlas texture with fonts atlas pixel format, single channel atlas stores glyphs alpha coverage
+// NOTE: Single channel atlas is swizzled to white color with coverage alpha, white rectangle is still opaque white,
+// atlas is drawn with single channel shader if texture swizzle is not supported (OpenGL ES 2.0)
+static rl_Texture2D LoadFontAtlasTexture(rl_Image atlas, int type)
+{
+    int format = fontAtlasFormat;
+
+    // NOTE: Distance fields atlas formats are required by shaders, single channel atlas requires shaders support
+    if ((type != FONT_DEFAULT) || (atlas.format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA)) format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+#if !defined(GRAPHICS_API_OPENGL_33) && !defined(GRAPHICS_API_OPENGL_ES2)
+    format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+#endif
+
+    if (format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) return rl_LoadTextureFromImage(atlas);
+
+    // Glyphs coverage copied from atlas alpha channel
+    rl_Image coverage = { 0 };
+    coverage.data = RL_MALLOC(atlas.width*atlas.height);
+    coverage.width = atlas.width;
+    coverage.height = atlas.height;
+    coverage.mipmaps = 1;
+    coverage.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+    for (int i = 0; i < atlas.width*atlas.height; i++) ((unsigned char *)coverage.data)[i] = ((unsigned char *)atlas.data)[i*2 + 1];
+
+    if (format == PIXELFORMAT_COMPRESSED_BC4_R)
+    {
+        unsigned int glInternalFormat = 0;
+        unsigned int glFormat = 0;
+        unsigned int glType = 0;
+        rlGetGlTextureFormats(PIXELFORMAT_COMPRESSED_BC4_R, &glInternalFormat, &glFormat, &glType);
+    #if defined(TEXT_SHADER_SINGLE_CHANNEL)
+        glInternalFormat = 0;       // Red channel only texture can not be used without swizzle for shapes white rectangle
+    #endif
+
+        if ((glInternalFormat != 0) && ((atlas.width%4) == 0) && ((atlas.height%4) == 0)) rl_ImageCompress(&coverage, PIXELFORMAT_COMPRESSED_BC4_R);
+        else TRACELOG(LOG_WARNING, "FONT: BC4 compressed atlas not supported, using GRAYSCALE atlas");
+    }
+
+    // NOTE: Texture is loaded with atlas format, skipping textures compression option
+    rl_Texture2D texture = { 0 };
+    texture.id = rlLoadTexture(coverage.data, coverage.width, coverage.height, coverage.format, 1);
+
+    if (texture.id > 0)
+    {
+        texture.width = coverage.width;
+        texture.height = coverage.height;
+        texture.mipmaps = 1;
+        texture.format = coverage.format;
+
+        rlTextureSwizzleAlpha(texture.id);
+    }
+
+    rl_UnloadImage(coverage);
+
+    return texture;
+}
+
+// Begin font drawing shader, SDF and MSDF fonts are drawn with distance field shader
+// NOTE: Returns true if shader mode was set, must be ended after drawing font glyphs
+static bool BeginFontShader(rl_Font font)
+{
+#if defined(TEXT_SHADER_SINGLE_CHANNEL)
+    bool singleChannel = (font.type == FONT_DEFAULT) && (font.texture.format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE);
+    if ((font.type != FONT_SDF) && (font.type != FONT_MSDF) && !singleChannel) return false;
+#else
+    if ((font.type != FONT_SDF) && (font.type != FONT_MSDF)) return false;
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int index = (font.type == FONT_MSDF)? 1 : 0;
+    #if defined(TEXT_SHADER_SINGLE_CHANNEL)
+    if (singleChannel) index = 2;
+    #endif
+
+    if (!textShaders.loaded[index])
+    {
+        const char *code = (index == 0)? textSdfShaderCode : textMsdfShaderCode;
+    #if defined(TEXT_SHADER_SINGLE_CHANNEL)
+        if (index == 2) code = textSingleChannelShaderCode;
+    #endif
+
+        textShaders.loaded[index] = true;
+        textShaders.shaders[index] = rl_LoadShaderFromMemory(NULL, code);
+        textShaders.ready[index] = (textShaders.shaders[index].id > 0) && (textShaders.shaders[index].id != rlGetShaderIdDefault());
+
+        if (!textShaders.ready[index]) TRACELOG(LOG_WARNING, "FONT: Failed to load %s font shader", (index == 0)? "SDF" : (index == 1)? "MSDF" : "single channel");
+    }
+
+    if (textShaders.ready[index])
+    {
+        rl_BeginShaderMode(textShaders.shaders[index]);
+        return true;
+    }
+#endif
+
+    return false;
+}
+
+#if defined(SUPPORT_FONT_SHAPES_TEXTURE) && defined(SUPPORT_MODULE_RSHAPES)
+// Get font shapes texture entry for font atlas texture, NULL if not registered
+static FontShapesEntry *GetFontShapesEntry(unsigned int textureId)
+{
+    for (int i = 0; (textureId > 0) && (i < FONT_SHAPES_TEXTURES_MAX); i++)
+    {
+        if (fontShapes[i].textureId == textureId) return &fontShapes[i];
+    }
+
+    return NULL;
+}
+#endif
+
+// Register font atlas white rectangle for shapes drawing, font atlas is set as shapes texture on text drawing
+static void RegisterFontShapesTexture(rl_Texture2D texture, rl_Rectangle rec)
+{
+#if defined(SUPPORT_FONT_SHAPES_TEXTURE) && defined(SUPPORT_MODULE_RSHAPES)
+    if (texture.id == 0) return;
+
+    FontShapesEntry *entry = GetFontShapesEntry(texture.id);
+    for (int i = 0; (entry == NULL) && (i < FONT_SHAPES_TEXTURES_MAX); i++) if (fontShapes[i].textureId == 0) entry = &fontShapes[i];
+
+    if (entry != NULL)
+    {
+        entry->textureId = texture.id;
+        entry->rec = rec;
+    }
+    else TRACELOG(LOG_WARNING, "FONT: [ID %i] Font atlas not used as shapes texture, fonts limit reached (%i)", texture.id, FONT_SHAPES_TEXTURES_MAX);
+#endif
+}
+
+// Unregister font atlas white rectangle, shapes texture is reset to default font if font atlas is in use
+static void UnregisterFontShapesTexture(rl_Texture2D texture)
+{
+#if defined(SUPPORT_FONT_SHAPES_TEXTURE) && defined(SUPPORT_MODULE_RSHAPES)
+    FontShapesEntry *entry = GetFontShapesEntry(texture.id);
+    if (entry == NULL) return;
+
+    entry->textureId = 0;
+
+    if (rl_GetShapesTexture().id == texture.id)
+    {
+        rl_Texture2D defaultTexture = { 0 };
+        rl_Rectangle defaultRec = { 0 };
+    #if defined(SUPPORT_DEFAULT_FONT)
+        FontShapesEntry *defaultEntry = GetFontShapesEntry(defaultFont.texture.id);
+        if (defaultEntry != NULL)
+        {
+            defaultTexture = defaultFont.texture;
+            defaultRec = defaultEntry->rec;
+        }
+    #endif
+        rl_SetShapesTexture(defaultTexture, defaultRec);   // Shapes texture reset to default white pixel if no default font
+    }
+#endif
+}
+
+// Set font atlas as shapes texture, font atlas white rectangle used for shapes drawing
+// NOTE: Only default white pixel and fonts atlas shapes textures are replaced, any other texture
+// is considered user provided, current font atlas rectangle is kept (it could be set by user)
+static void SetFontShapesTexture(rl_Font font)
+{
+#if defined(SUPPORT_FONT_SHAPES_TEXTURE) && defined(SUPPORT_MODULE_RSHAPES)
+    rl_Texture2D current = rl_GetShapesTexture();
+    if (current.id == font.texture.id) return;
+
+    FontShapesEntry *entry = GetFontShapesEntry(font.texture.id);
+    if (entry == NULL) return;
+
+    FontShapesEntry *currentEntry = GetFontShapesEntry(current.id);
+    if ((currentEntry == NULL) && (current.id != rlGetTextureIdDefault())) return;
+
+    if (currentEntry != NULL) currentEntry->rec = rl_GetShapesTextureRectangle();
+
+    rl_SetShapesTexture(font.texture, entry->rec);
+#endif
+}
+
+// Draw font glyph by index
+static void DrawFontGlyph(rl_Font font, int index, rl_Vector2 position, float fontSize, rl_Color tint)
+{
+    float scaleFactor = fontSize/font.baseSize;     // Character quad scaling factor
+
+    // Character destination rectangle on screen
+    // NOTE: We consider glyphPadding on drawing
+    rl_Rectangle dstRec = { position.x + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      position.y + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                      (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
+                      (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
+
+    // Character source rectangle from font texture atlas
+    // NOTE: We consider glyphs padding when drawing, it could be required for outline/glow shader effects
+    rl_Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
+                         font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+
+    // Draw the character texture on the screen
+    rl_DrawTexturePro(font.texture, srcRec, dstRec, (rl_Vector2){ 0, 0 }, 0.0f, tint);
+}
+
+// Set text layout glyph quad and texture coordinates, as drawn by DrawFontGlyph()
+static void SetTextLayoutGlyphQuad(rl_TextLayout *layout, TextLayoutGlyph *glyph)
+{
+    const rl_Font *font = &layout->font;
+    float scaleFactor = layout->fontSize/font->baseSize;
+    int index = glyph->index;
+
+    glyph->quad = (rl_Rectangle){ glyph->position.x + font->glyphs[index].offsetX*scaleFactor - (float)font->glyphPadding*scaleFactor,
+                                  glyph->position.y + font->glyphs[index].offsetY*scaleFactor - (float)font->glyphPadding*scaleFactor,
+                                  (font->recs[index].width + 2.0f*font->glyphPadding)*scaleFactor,
+                                  (font->recs[index].height + 2.0f*font->glyphPadding)*scaleFactor };
+
+    // NOTE: Texture coordinates stored as top-left (x, y) and bottom-right (width, height) corners
+    float width = (float)font->texture.width;
+    float height = (float)font->texture.height;
+
+    glyph->texcoords = (rl_Rectangle){ (font->recs[index].x - (float)font->glyphPadding)/width,
+                                       (font->recs[index].y - (float)font->glyphPadding)/height,
+                                       (font->recs[index].x + font->recs[index].width + (float)font->glyphPadding)/width,
+                                       (font->recs[index].y + font->recs[index].height + (float)font->glyphPadding)/height };
+}
+
+// Add text layout line, line glyphs positioned as rl_DrawTextEx() and line measured as rl_MeasureTextEx()
+// NOTE: Line codepoints do not include line break, spaces and tabs advance but are not stored as glyphs
+static void AddTextLayoutLine(rl_TextLayout *layout, const int *codepoints, const rl_Color *colors, int count)
+{
+    if (layout->lineCount >= layout->lineCapacity)
+    {
+        layout->lineCapacity = (layout->lineCapacity > 0)? layout->lineCapacity*2 : 16;
+        layout->lines = (TextLayoutLine *)RL_REALLOC(layout->lines, layout->lineCapacity*sizeof(TextLayoutLine));
+    }
+
+    if ((layout->glyphCount + count) > layout->glyphCapacity)
+    {
+        layout->glyphCapacity = (layout->glyphCount + count)*2;
+        layout->glyphs = (TextLayoutGlyph *)RL_REALLOC(layout->glyphs, layout->glyphCapacity*sizeof(TextLayoutGlyph));
+    }
+
+    const rl_Font font = layout->font;
+    float scaleFactor = layout->fontSize/font.baseSize;
+
+    TextLayoutLine *line = &layout->lines[layout->lineCount];
+    line->firstGlyph = layout->glyphCount;
+    line->glyphCount = 0;
+    line->codepointCount = count;
+    line->textWidth = 0.0f;
+
+    float textOffsetY = layout->lineCount*(layout->fontSize + layout->lineSpacing);
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+    int prevIndex = -1;             // Previous glyph index on line, kerning applied between glyphs
+
+    for (int i = 0; i < count; i++)
+    {
+        int index = rl_GetGlyphIndex(font, codepoints[i]);
+
+        if (layout->kerning && (prevIndex >= 0))
+        {
+            float glyphKerning = GetGlyphKerning(font, prevIndex, codepoints[i - 1], index, codepoints[i]);
+            textOffsetX += glyphKerning*scaleFactor;
+            line->textWidth += glyphKerning;
+        }
+        prevIndex = index;
+
+        if ((codepoints[i] != ' ') && (codepoints[i] != '\t'))
+        {
+            TextLayoutGlyph *glyph = &layout->glyphs[layout->glyphCount++];
+            glyph->codepoint = codepoints[i];
+            glyph->index = index;
+            glyph->position = (rl_Vector2){ textOffsetX, textOffsetY };
+            glyph->color = colors[i];
+            SetTextLayoutGlyphQuad(layout, glyph);
+            line->glyphCount++;
+        }
+
+        if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + layout->spacing);
+        else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + layout->spacing);
+
+        if (font.glyphs[index].advanceX > 0) line->textWidth += font.glyphs[index].advanceX;
+        else line->textWidth += (font.recs[index].width + font.glyphs[index].offsetX);
+    }
+
+    line->width = (count > 0)? (line->textWidth*scaleFactor + (float)((count - 1)*layout->spacing)) : 0.0f;
+
+    layout->lineCount++;
+}
+
+// Get shaped text layout from shaping cache, text shaped and cached if not found
+// NOTE: Least recently used layout is replaced when cache is full
+static rl_TextLayout *GetShapedTextLayout(rl_Font font, const char *text, float fontSize, float spacing)
+{
+    if (text == NULL) return NULL;
+
+    int size = rl_TextLength(text);
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < size; i++) hash = (hash ^ (unsigned char)text[i])*16777619u;
+
+    int slot = 0;
+
+    for (int i = 0; i < TEXT_SHAPING_CACHE_SIZE; i++)
+    {
+        ShapedTextEntry *entry = &textShaping.entries[i];
+
+        if ((entry->text != NULL) && (entry->hash == hash) && (entry->fontId == font.texture.id) && (entry->fontGlyphs == font.glyphs) &&
+            (entry->fontSize == fontSize) && (entry->spacing == spacing) && (entry->lineSpacing == textLineSpacing) && (strcmp(entry->text, text) == 0))
+        {
+            entry->lastUsed = ++textShaping.useCounter;
+            return entry->layout;
+        }
+
+        if ((entry->text == NULL) || ((textShaping.entries[slot].text != NULL) && (entry->lastUsed < textShaping.entries[slot].lastUsed))) slot = i;
+    }
+
+    ShapedTextEntry *entry = &textShaping.entries[slot];
+
+    RL_FREE(entry->text);
+    rl_UnloadTextLayout(entry->layout);
+
+    entry->text = (char *)RL_MALLOC(size + 1);
+    memcpy(entry->text, text, size + 1);
+    entry->hash = hash;
+    entry->fontId = font.texture.id;
+    entry->fontGlyphs = font.glyphs;
+    entry->fontSize = fontSize;
+    entry->spacing = spacing;
+    entry->lineSpacing = textLineSpacing;
+    entry->layout = rl_LoadTextLayout(font, text, fontSize, spacing, 0.0f);
+    entry->lastUsed = ++textShaping.useCounter;
+
+    return entry->layout;
+}
+
+// Unload shaped text layouts for font, layouts reference font glyphs and atlas
+static void UnloadShapedTextLayouts(rl_Font font)
+{
+    for (int i = 0; i < TEXT_SHAPING_CACHE_SIZE; i++)
+    {
+        ShapedTextEntry *entry = &textShaping.entries[i];
+
+        if ((entry->text != NULL) && (entry->fontId == font.texture.id) && (entry->fontGlyphs == font.glyphs))
+        {
+            RL_FREE(entry->text);
+            rl_UnloadTextLayout(entry->layout);
+            memset(entry, 0, sizeof(ShapedTextEntry));
+        }
+    }
+}
+
+// Decode UTF-8 text codepoints, same decoding as rl_GetCodepointNext() (invalid bytes decoded as '?')
+// NOTE: ASCII chunks are decoded 16 bytes at once with SIMD, other bytes one codepoint at a time,
+// codepoints buffer must fit length codepoints, returns codepoints count
+static int DecodeTextCodepoints(const char *text, int length, int *codepoints)
+{
+    int count = 0;
+
+    for (int i = 0; i < length;)
+    {
+#if defined(RTEXT_SSE2_ENABLED)
+        // ASCII chunks: no byte with high bit set, bytes zero-extended to codepoints
+        const __m128i zero = _mm_setzero_si128();
+
+        while ((i + 16) <= length)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i *)(text + i));
+            if (_mm_movemask_epi8(bytes) != 0) break;
+
+            __m128i low = _mm_unpacklo_epi8(bytes, zero);
+            __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+            _mm_storeu_si128((__m128i *)(codepoints + count), _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128((__m128i *)(codepoints + count + 4), _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128((__m128i *)(codepoints + count + 8), _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128((__m128i *)(codepoints + count + 12), _mm_unpackhi_epi16(high, zero));
+
+            count += 16;
+            i += 16;
+        }
+#elif defined(RTEXT_NEON_ENABLED)
+        // ASCII chunks: no byte with high bit set, bytes zero-extended to codepoints
+        while ((i + 16) <= length)
+        {
+            uint8x16_t bytes = vld1q_u8((const uint8_t *)(text + i));
+            uint8x8_t bits = vorr_u8(vget_low_u8(bytes), vget_high_u8(bytes));
+            if (vget_lane_u64(vreinterpret_u64_u8(bits), 0) & 0x8080808080808080ULL) break;
+
+            uint16x8_t low = vmovl_u8(vget_low_u8(bytes));
+            uint16x8_t high = vmovl_u8(vget_high_u8(bytes));
+
+            vst1q_u32((uint32_t *)(codepoints + count), vmovl_u16(vget_low_u16(low)));
+            vst1q_u32((uint32_t *)(codepoints + count + 4), vmovl_u16(vget_high_u16(low)));
+            vst1q_u32((uint32_t *)(codepoints + count + 8), vmovl_u16(vget_low_u16(high)));
+            vst1q_u32((uint32_t *)(codepoints + count + 12), vmovl_u16(vget_high_u16(high)));
+
+            count += 16;
+            i += 16;
+        }
+#endif
+        // Chunk with non-ASCII bytes (or text end) decoded one codepoint at a time
+        for (int chunkEnd = i + 16; (i < length) && (i < chunkEnd); count++)
+        {
+            int codepointSize = 1;
+
+            if ((unsigned char)text[i] < 0x80) codepoints[count] = text[i];
+            else codepoints[count] = rl_GetCodepointNext(text + i, &codepointSize);
+
+            i += codepointSize;
+        }
+    }
+
+    return count;
+}
+
+// Get next codepoint in a byte sequence, ASCII bytes returned directly
+static inline int GetCodepointNextFast(const char *text, int *codepointSize)
+{
+    if ((unsigned char)text[0] >= 0x80) return rl_GetCodepointNext(text, codepointSize);
+
+    *codepointSize = 1;
+    return text[0];
+}
+
+#if defined(SUPPORT_TEXT_MANIPULATION)
+// Copy text into buffer at position, text truncated to buffer size (null-terminated)
+// NOTE: Returns next position as if text was not truncated, that way required buffer size is computed
+static int CopyTextToBuffer(char *buffer, int bufferSize, int position, const char *text, int length)
+{
+    if ((buffer != NULL) && (text != NULL) && (position < (bufferSize - 1)))
+    {
+        int copyLength = ((position + length) < (bufferSize - 1))? length : (bufferSize - 1 - position);
+
+        memcpy(buffer + position, text, copyLength);
+        buffer[position + copyLength] = '\0';
+    }
+
+    return position + length;
+}
+
+// Count UTF-8 text codepoints, same decoding as rl_GetCodepointNext() (invalid bytes counted as '?')
+// NOTE: ASCII chunks are counted 16 bytes at once with SIMD, other bytes one codepoint at a time
+static int CountTextCodepoints(const char *text, int length)
+{
+    int count = 0;
+
+    for (int i = 0; i < length;)
+    {
+#if defined(RTEXT_SSE2_ENABLED)
+        while (((i + 16) <= length) && (_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(text + i))) == 0))
+        {
+            count += 16;
+            i += 16;
+        }
+#elif defined(RTEXT_NEON_ENABLED)
+        while ((i + 16) <= length)
+        {
+            uint8x16_t bytes = vld1q_u8((const uint8_t *)(text + i));
+            uint8x8_t bits = vorr_u8(vget_low_u8(bytes), vget_high_u8(bytes));
+            if (vget_lane_u64(vreinterpret_u64_u8(bits), 0) & 0x8080808080808080ULL) break;
+
+            count += 16;
+            i += 16;
+        }
+#endif
+        for (int chunkEnd = i + 16; (i < length) && (i < chunkEnd); count++)
+        {
+            int codepointSize = 1;
+
+            if ((unsigned char)text[i] >= 0x80) rl_GetCodepointNext(text + i, &codepointSize);
+
+            i += codepointSize;
+        }
+    }
+
+    return count;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
+// Read a line from memory
+// REQUIRES: memcpy()
+// NOTE: Returns the number of bytes read
+static int GetLine(const char *origin, char *buffer, int maxLength)
+{
+    int count = 0;
+    for (; count < maxLength - 1; count++) if (origin[count] == '\n') break;
+    memcpy(buffer, origin, count);
+    buffer[count] = '\0';
+    return count;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_FNT)
+// Load a BMFont file (AngelCode font file)
+// REQUIRES: strstr(), sscanf(), strrchr(), memcpy()
+static rl_Font LoadBMFont(const char *fileName)
+{
+    #define MAX_BUFFER_SIZE       256
+    #define MAX_FONT_IMAGE_PAGES    8
+
+    rl_Font font = { 0 };
+
+    char buffer[MAX_BUFFER_SIZE] = { 0 };
+    char *searchPoint = NULL;
+
+    int fontSize = 0;
+    int glyphCount = 0;
+
+    int imWidth = 0;
+    int imHeight = 0;
+    int pageCount = 1;
+    char imFileName[MAX_FONT_IMAGE_PAGES][129] = { 0 };
+
+    int base = 0;       // Useless data
+    int readBytes = 0;  // Data bytes read
+    int readVars = 0;   // Variables filled by sscanf()
+
+    char *fileText = rl_LoadFileText(fileName);
+
+    if (fileText == NULL) return font;
+
+    char *fileTextPtr = fileText;
+
+    // NOTE: We skip first line, it contains no useful information
+    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    fileTextPtr += (readBytes + 1);
+
+    // Read line data
+    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    searchPoint = strstr(buffer, "lineHeight");
+    readVars = sscanf(searchPoint, "lineHeight=%i base=%i scaleW=%i scaleH=%i pages=%i", &fontSize, &base, &imWidth, &imHeight, &pageCount);
+    fileTextPtr += (readBytes + 1);
+
+    if (readVars < 4) { rl_UnloadFileText(fileText); return font; } // Some data not available, file malformed
+
+    if (pageCount > MAX_FONT_IMAGE_PAGES)
+    {
+        TRACELOG(LOG_WARNING, "FONT: [%s] rl_Font defines more pages than supported: %i/%i", fileName, pageCount, MAX_FONT_IMAGE_PAGES);
+        pageCount = MAX_FONT_IMAGE_PAGES;
+    }
+
+    for (int i = 0; i < pageCount; i++)
+    {
+        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+        searchPoint = strstr(buffer, "file");
+        readVars = sscanf(searchPoint, "file=\"%128[^\"]\"", imFileName[i]);
+        fileTextPtr += (readBytes + 1);
+
+        if (readVars < 1) { rl_UnloadFileText(fileText); return font; } // No fileName read
+    }
+
+    readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    searchPoint = strstr(buffer, "count");
+    readVars = sscanf(searchPoint, "count=%i", &glyphCount);
+    fileTextPtr += (readBytes + 1);
+
+    if (readVars < 1) { rl_UnloadFileText(fileText); return font; } // No glyphCount read
+
+    // Load all required images for further compose
+    rl_Image *imFonts = (rl_Image *)RL_CALLOC(pageCount, sizeof(rl_Image)); // rl_Font atlases, multiple images
+
+    for (int i = 0; i < pageCount; i++)
+    {
+        imFonts[i] = rl_LoadImage(rl_TextFormat("%s/%s", rl_GetDirectoryPath(fileName), imFileName[i]));
+
+        if (imFonts[i].format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+        {
+            // Convert image to GRAYSCALE + ALPHA, using the mask as the alpha channel
+            rl_Image imFontAlpha = {
+                .data = RL_CALLOC(imFonts[i].width*imFonts[i].height, 2),
+                .width = imFonts[i].width,
+                .height = imFonts[i].height,
+                .mipmaps = 1,
+                .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+            };
+
+            for (int p = 0, pi = 0; p < (imFonts[i].width*imFonts[i].height*2); p += 2, pi++)
+            {
+                ((unsigned char *)(imFontAlpha.data))[p] = 0xff;
+                ((unsigned char *)(imFontAlpha.data))[p + 1] = ((unsigned char *)imFonts[i].data)[pi];
+            }
+
+            rl_UnloadImage(imFonts[i]);
+            imFonts[i] = imFontAlpha;
+        }
+    }
+
+    rl_Image fullFont = imFonts[0];
+    for (int i = 1; i < pageCount; i++) rl_UnloadImage(imFonts[i]);
+
+    // If multiple atlas, then merge atlas
+    // NOTE: WARNING: This process could be really slow!
+    if (pageCount > 1)
+    {
+        // Resize font atlas to draw additional images
+        rl_ImageResizeCanvas(&fullFont, imWidth, imHeight*pageCount, 0, 0, rl_BLACK);
+
+        for (int i = 1; i < pageCount; i++)
+        {
+            rl_Rectangle srcRec = { 0.0f, 0.0f, (float)imWidth, (float)imHeight };
+            rl_Rectangle destRec = { 0.0f, (float)imHeight*(float)i, (float)imWidth, (float)imHeight };
+            rl_ImageDraw(&fullFont, imFonts[i], srcRec, destRec, rl_WHITE);
+        }
+    }
+
+    RL_FREE(imFonts);
+
+    font.texture = rl_LoadTextureFromImage(fullFont);
+
+    // Fill font characters info data
+    font.baseSize = fontSize;
+    font.glyphCount = glyphCount;
+    font.glyphPadding = 0;
+    font.glyphs = (rl_GlyphInfo *)RL_MALLOC(glyphCount*sizeof(rl_GlyphInfo));
+    font.recs = (rl_Rectangle *)RL_MALLOC(glyphCount*sizeof(rl_Rectangle));
+
+    int charId = 0;
+    int charX = 0;
+    int charY = 0;
+    int charWidth = 0;
+    int charHeight = 0;
+    int charOffsetX = 0;
+    int charOffsetY = 0;
+    int charAdvanceX = 0;
+    int pageID = 0;
+
+    for (int i = 0; i < glyphCount; i++)
+    {
+        readBytes = GetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+        readVars = sscanf(buffer, "char id=%i x=%i y=%i width=%i height=%i xoffset=%i yoffset=%i xadvance=%i page=%i",
+                       &charId, &charX, &charY, &charWidth, &charHeight, &charOffsetX, &charOffsetY, &charAdvanceX, &pageID);
+        fileTextPtr += (readBytes + 1);
+
+        if (readVars == 9)  // Make sure all char data has been properly read
+        {
+            // Get character rectangle in the font atlas texture
+            font.recs[i] = (rl_Rectangle){ (float)charX, (float)charY + (float)imHeight*pageID, (float)charWidth, (float)charHeight };
+
+            // Save data properly in sprite font
+            font.glyphs[i].value = charId;
+            font.glyphs[i].offsetX = charOffsetX;
+            font.glyphs[i].offsetY = charOffsetY;
+            font.glyphs[i].advanceX = charAdvanceX;
+
+            // Fill character image data from full font data
+            font.glyphs[i].image = rl_ImageFromImage(fullFont, font.recs[i]);
+        }
+        else
+        {
+            font.glyphs[i].image = rl_GenImageColor((int)font.recs[i].width, (int)font.recs[i].height, rl_BLACK);
+            TRACELOG(LOG_WARNING, "FONT: [%s] Some characters data not correctly provided", fileName);
+        }
+    }
+
+    rl_UnloadImage(fullFont);
+    rl_UnloadFileText(fileText);
+
+    font.glyphLookup = LoadGlyphLookup(font.glyphs, font.glyphCount);
 
     if (font.texture.id == 0)
     {
@@ -70,6 +70,7 @@
 
 #if defined(SUPPORT_MODULE_RTEXTURES)
 
+#define RL_MEMORY_MODULE MEMORY_MODULE_TEXTURES  // Memory tracking allocations module
 #include "utils.h"              // Required for: TRACELOG()
 #include "rlgl.h"               // OpenGL abstraction layer to multiple versions
 
@@ -77,6 +78,47 @@
 #include <string.h>             // Required for: strlen() [Used in rl_ImageTextEx()], strcmp() [Used in rl_LoadImageFromMemory()/rl_LoadImageAnimFromMemory()/rl_ExportImageToMemory()]
 #include <math.h>               // Required for: fabsf() [Used in rl_DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in rl_ExportImageAsCode()]
+#include <limits.h>             // Required for: INT_MAX [Used in rl_ImageCompress()]
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>          // Required for: SSE2 intrinsics [Used in rl_ImageFormat()]
+    #define RTEXTURES_SSE2_ENABLED
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+    #include <arm_neon.h>           // Required for: NEON intrinsics [Used in rl_ImageFormat()]
+    #define RTEXTURES_NEON_ENABLED
+#endif
+
+// Image worker threads (filters rows) are only supported with POSIX threads
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    #if defined(PLATFORM_WEB) || (defined(_WIN32) && !defined(__MINGW32__))
+        #undef SUPPORT_IMAGE_WORKER_THREADS
+    #endif
+#endif
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    #include <pthread.h>        // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*()
+#endif
+
+// Raw image files memory mapping is only supported on POSIX systems
+#if defined(SUPPORT_IMAGE_FILE_MAPPING)
+    #if defined(_WIN32) || defined(PLATFORM_WEB) || defined(PLATFORM_ANDROID)
+        #undef SUPPORT_IMAGE_FILE_MAPPING
+    #endif
+#endif
+#if defined(SUPPORT_IMAGE_FILE_MAPPING)
+    #include <fcntl.h>          // Required for: open() [Used in rl_LoadImageRawMapped()]
+    #include <sys/mman.h>       // Required for: mmap(), munmap()
+    #include <sys/stat.h>       // Required for: fstat()
+    #include <unistd.h>         // Required for: close()
+#endif
+
+// Mapped images regions are read from file with 64bit offsets if not memory mapped
+#if defined(_WIN32)
+    #define FSEEK64(file, offset, origin)   _fseeki64(file, offset, origin)
+    #define FTELL64(file)                   _ftelli64(file)
+#else
+    #define FSEEK64(file, offset, origin)   fseek(file, (long)(offset), origin)
+    #define FTELL64(file)                   (long long)ftell(file)
+#endif
 
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
@@ -143,7 +185,10 @@
     #define STBI_FREE RL_FREE
     #define STBI_REALLOC RL_REALLOC
 
-    #define STBI_NO_THREAD_LOCALS
+    // NOTE: Thread local failure reason is only required when decoding on worker threads
+    #if !defined(SUPPORT_IMAGE_WORKER_THREADS)
+        #define STBI_NO_THREAD_LOCALS
+    #endif
 
     #if defined(__TINYC__)
         #define STBI_NO_SIMD
@@ -206,6 +251,11 @@
 
     #define STB_IMAGE_WRITE_IMPLEMENTATION
     #include "external/stb_image_write.h"   // Required for: stbi_write_*()
+
+    #if defined(SUPPORT_FILEFORMAT_PNG) && defined(SUPPORT_COMPRESSION_API)
+        #include "external/sdefl.h"         // Required for: sdeflate_chunk() [Used in EncodeImagePNG()]
+                                            // NOTE: Implementation is compiled by rcore module
+    #endif
 #endif
 
 #if defined(SUPPORT_IMAGE_GENERATION)
@@ -213,8 +263,24 @@
     #include "external/stb_perlin.h"        // Required for: stb_perlin_fbm_noise3
 #endif
 
-#define STBIR_MALLOC(size,c) ((void)(c), RL_MALLOC(size))
-#define STBIR_FREE(ptr,c) ((void)(c), RL_FREE(ptr))
+#if defined(__GNUC__) // GCC and Clang
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wunused-function"
+#endif
+
+// NOTE: Packer is also implemented by rtext module (font atlas), functions are kept static to this module
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include "external/stb_rect_pack.h"         // Required for: stbrp_init_target(), stbrp_pack_rects() [rl_AddTextureAtlasImage()]
+
+#if defined(__GNUC__) // GCC and Clang
+    #pragma GCC diagnostic pop
+#endif
+
+// NOTE: Resizes with user data set to imageResizeScratch allocate samplers from frame arena (released by caller)
+static int imageResizeScratch = 0;
+#define STBIR_MALLOC(size,c) (((c) == (void *)&imageResizeScratch)? rl_MemFrameAlloc((unsigned int)(size)) : RL_MALLOC(size))
+#define STBIR_FREE(ptr,c) (((c) == (void *)&imageResizeScratch)? (void)0 : RL_FREE(ptr))
 
 #if defined(__GNUC__) // GCC and Clang
     #pragma GCC diagnostic push
@@ -225,7 +291,7 @@
     #define STBIR_NO_SIMD
 #endif
 #define STB_IMAGE_RESIZE_IMPLEMENTATION
-#include "external/stb_image_resize2.h"     // Required for: stbir_resize_uint8_linear() [rl_ImageResize()]
+#include "external/stb_image_resize2.h"     // Required for: stbir_resize_init(), stbir_build_samplers_with_splits(), stbir_resize_extended_split() [rl_ImageResizeEx()]
 
 #if defined(__GNUC__) // GCC and Clang
     #pragma GCC diagnostic pop
@@ -238,31 +304,986 @@
     #define PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD  50    // Threshold over 255 to set alpha as 0
 #endif
 
+#ifndef IMAGE_FORMAT_CHUNK_SIZE
+    #define IMAGE_FORMAT_CHUNK_SIZE     1024    // Pixels converted per chunk by rl_ImageFormat() direct conversion (RGBA8 intermediate)
+#endif
+
+// Uncompressed pixel formats list, X(format, name, bytesPerPixel) expanded for every format
+// NOTE: Used to generate per format pixel conversion kernels at compile time
+#define PIXEL_FORMATS_UNCOMPRESSED(X) \
+    X(PIXELFORMAT_UNCOMPRESSED_GRAYSCALE, Grayscale, 1) \
+    X(PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA, GrayAlpha, 2) \
+    X(PIXELFORMAT_UNCOMPRESSED_R5G6B5, R5G6B5, 2) \
+    X(PIXELFORMAT_UNCOMPRESSED_R8G8B8, R8G8B8, 3) \
+    X(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1, R5G5B5A1, 2) \
+    X(PIXELFORMAT_UNCOMPRESSED_R4G4B4A4, R4G4B4A4, 2) \
+    X(PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, R8G8B8A8, 4) \
+    X(PIXELFORMAT_UNCOMPRESSED_R32, R32, 4) \
+    X(PIXELFORMAT_UNCOMPRESSED_R32G32B32, R32G32B32, 12) \
+    X(PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, R32G32B32A32, 16) \
+    X(PIXELFORMAT_UNCOMPRESSED_R16, R16, 2) \
+    X(PIXELFORMAT_UNCOMPRESSED_R16G16B16, R16G16B16, 6) \
+    X(PIXELFORMAT_UNCOMPRESSED_R16G16B16A16, R16G16B16A16, 8)
+
+#ifndef TEXTURE_PALETTE_SIZE
+    #define TEXTURE_PALETTE_SIZE         256    // Palette texture colors, indexed images use 8-bit indices (maximum 256)
+#endif
+
+#ifndef DITHER_BLUE_NOISE_SIZE
+    #define DITHER_BLUE_NOISE_SIZE        64    // Blue noise dithering thresholds tile size (power of two, multiple of 8)
+#endif
+
 #ifndef GAUSSIAN_BLUR_ITERATIONS
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
+#ifndef IMAGE_FILTER_CHUNK_ROWS
+    #define IMAGE_FILTER_CHUNK_ROWS   16    // Image rows processed by a worker thread at once (blur, convolution)
+#endif
+#ifndef IMAGE_CANVAS_TILE_SIZE
+    #define IMAGE_CANVAS_TILE_SIZE   128    // Image canvas tile size in pixels, tiles are rasterized by worker threads
+#endif
+#ifndef IMAGE_MIPMAP_MAX_TAPS
+    #define IMAGE_MIPMAP_MAX_TAPS     16    // Maximum source pixels filtered per mipmap pixel along one dimension
+#endif
+#ifndef IMAGE_MIPMAP_KAISER_RADIUS
+    #define IMAGE_MIPMAP_KAISER_RADIUS 2.0f // Mipmap Kaiser filter radius, in mipmap level pixels
+#endif
+#ifndef IMAGE_MIPMAP_KAISER_ALPHA
+    #define IMAGE_MIPMAP_KAISER_ALPHA  4.0f // Mipmap Kaiser filter window shape parameter
+#endif
+#ifndef IMAGE_MIPMAP_SRGB_TABLE_SIZE
+    #define IMAGE_MIPMAP_SRGB_TABLE_SIZE 4096   // Linear to sRGB conversion table entries (mipmaps sRGB-correct filtering)
+#endif
+#ifndef IMAGE_CACHE_SIZE
+    #define IMAGE_CACHE_SIZE           0    // Decoded images cache default size in bytes (0: disabled)
+#endif
+#ifndef IMAGE_FILTER_CHUNK_COLUMNS
+    #define IMAGE_FILTER_CHUNK_COLUMNS 64   // Image columns processed by a worker thread at once (blur vertical pass)
+#endif
+#ifndef IMAGE_EXPORT_CHUNK_SIZE
+    #define IMAGE_EXPORT_CHUNK_SIZE  262144 // PNG export filtered data compressed by a worker thread at once (256 KB)
+#endif
+#ifndef IMAGE_EXPORT_COMPRESSION
+    #define IMAGE_EXPORT_COMPRESSION    2   // PNG export default compression level [0..8], higher levels are much slower on images
+#endif
+#ifndef TEXTURE_STREAM_MIN_SIZE
+    #define TEXTURE_STREAM_MIN_SIZE       64    // Texture streams mipmap levels up to this size are always resident
+#endif
+#ifndef TEXTURE_STREAM_IDLE_FRAMES
+    #define TEXTURE_STREAM_IDLE_FRAMES    30    // Frames a requested mipmap level is kept after last request
+#endif
+#ifndef TEXTURE_STREAM_UPLOAD_SIZE
+    #define TEXTURE_STREAM_UPLOAD_SIZE  4194304 // Texture streams data started uploading per frame (4 MB)
+#endif
+#ifndef TEXTURE_STREAM_BUDGET
+    #define TEXTURE_STREAM_BUDGET    268435456  // Texture streams default VRAM budget (256 MB)
+#endif
+#ifndef TEXTURE_ATLAS_PADDING
+    #define TEXTURE_ATLAS_PADDING          1    // Texture atlas pixels between packed images, avoids filtering bleeding
+#endif
+#ifndef ANIMATED_TEXTURE_MIN_DELAY
+    #define ANIMATED_TEXTURE_MIN_DELAY    20    // Animated textures minimum frame delay in milliseconds
+#endif
+#ifndef IMAGE_COMPRESSION_CHUNK_ROWS
+    #define IMAGE_COMPRESSION_CHUNK_ROWS 4  // Blocks rows compressed by a worker thread at once (rl_ImageCompress())
+#endif
+#ifndef IMAGE_BLUR_MAX_RADIUS
+    #define IMAGE_BLUR_MAX_RADIUS     32    // Maximum taps radius of render texture blur pass, larger blurs use several passes
+#endif
+
+#ifndef MAX_RENDER_TEXTURE_POOL
+    #define MAX_RENDER_TEXTURE_POOL        32    // Maximum number of transient render textures kept in pool
+#endif
+#ifndef MAX_IMAGE_TEXTURE_DIRTY_RECTS
+    #define MAX_IMAGE_TEXTURE_DIRTY_RECTS  16    // Maximum number of dirty rectangles tracked by an image texture, merged over limit
+#endif
+#ifndef RENDER_TEXTURE_POOL_IDLE_FRAMES
+    #define RENDER_TEXTURE_POOL_IDLE_FRAMES 3    // Frames a pooled render texture can stay unused before being unloaded
+#endif
+#ifndef MAX_RENDER_GRAPH_PASSES
+    #define MAX_RENDER_GRAPH_PASSES        32    // Maximum number of passes in a render graph
+#endif
+#ifndef MAX_RENDER_GRAPH_RESOURCES
+    #define MAX_RENDER_GRAPH_RESOURCES     32    // Maximum number of resources (targets, inputs, outputs) in a render graph
+#endif
+#ifndef MAX_RENDER_GRAPH_PASS_INPUTS
+    #define MAX_RENDER_GRAPH_PASS_INPUTS    4    // Maximum number of inputs read by a render graph pass (texture0..texture3)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Transient render texture, recycled by pool
+typedef struct RenderTexturePoolEntry {
+    rl_RenderTexture2D target;      // Render texture (id is 0 for empty entry)
+    bool depth;                     // Render texture has depth attachment
+    bool inUse;                     // Render texture handed out for current frame
+    bool fresh;                     // Render texture contents are undefined (not rendered since acquired)
+    int idleFrames;                 // Number of frames without being used
+} RenderTexturePoolEntry;
+
+// Render graph resource, transient target or imported render texture
+typedef struct RenderGraphResource {
+    rl_RenderTexture2D target;      // Render texture (transient: acquired from pool while alive, id 0 otherwise)
+    int width;                      // Transient target width (0 for render width, negative for render width divided)
+    int height;                     // Transient target height (0 for render height, negative for render height divided)
+    int format;                     // Transient target color format (rl_PixelFormat type)
+    bool depth;                     // Transient target has depth attachment
+    bool imported;                  // Imported render texture, not acquired from pool
+    bool output;                    // Graph output, passes writing it are never culled (id 0 for screen)
+    int lastPass;                   // Last pass using resource (compiled), released after it if transient
+} RenderGraphResource;
+
+// Render graph pass, fullscreen shader or custom callback drawing into output
+typedef struct RenderGraphPass {
+    rl_Shader shader;               // Fullscreen pass shader (id 0 for default shader)
+    RenderGraphPassCallback callback; // Custom drawing pass callback (NULL for fullscreen shader pass)
+    void *userData;                 // Custom drawing pass user data
+    int inputs[MAX_RENDER_GRAPH_PASS_INPUTS]; // Resources read by pass
+    int inputLocs[MAX_RENDER_GRAPH_PASS_INPUTS]; // Shader samplers locations for inputs (texture0..textureN)
+    int inputCount;                 // Number of resources read by pass
+    int output;                     // Resource written by pass
+    bool culled;                    // Pass not contributing to graph outputs (compiled)
+    bool merged;                    // Pass output bound by previous pass (compiled)
+    bool replace;                   // Pass is first writing output, contents replaced (compiled)
+} RenderGraphPass;
+
+// Render graph (opaque struct declared in raylib.h)
+struct rl_RenderGraph {
+    RenderGraphPass passes[MAX_RENDER_GRAPH_PASSES]; // Passes, executed in declaration order
+    int passCount;                  // Number of passes
+    RenderGraphResource resources[MAX_RENDER_GRAPH_RESOURCES]; // Resources read and written by passes
+    int resourceCount;              // Number of resources
+    bool compiled;                  // Passes culling and resources lifetimes are up to date
+};
+
+// Worker job, process function is called for chunks of the [0, count) range
+typedef void (*WorkerJobFunc)(const void *data, int start, int end);
+typedef struct WorkerJob {
+    WorkerJobFunc process;          // Range processing function
+    const void *data;               // Job data, passed to process function
+    int count;                      // Range size
+    int chunkSize;                  // Range processed by a thread at once
+} WorkerJob;
+
+// Mipmap filter taps, source pixels filtered for a mipmap pixel along one dimension
+typedef struct MipmapTaps {
+    int count;                              // Number of taps
+    int index[IMAGE_MIPMAP_MAX_TAPS];       // Source pixel index (clamped to edges)
+    float weight[IMAGE_MIPMAP_MAX_TAPS];    // Tap weight (normalized)
+} MipmapTaps;
+
+// Mipmap level generation job, level rows range generated from previous level
+typedef struct MipmapJob {
+    const unsigned char *src;       // Previous level pixels
+    unsigned char *dst;             // Level pixels
+    int srcWidth;                   // Previous level width
+    int srcHeight;                  // Previous level height
+    int dstWidth;                   // Level width
+    int dstHeight;                  // Level height
+    int channels;                   // Channels per pixel (8 bit per channel)
+    bool srgb[4];                   // Channels filtered in linear space
+    const MipmapTaps *tapsX;        // Horizontal taps per level column (filter path)
+    const MipmapTaps *tapsY;        // Vertical taps per level row (filter path)
+} MipmapJob;
+
+// Image batch loading job, one file per range element
+typedef struct ImageBatchJob {
+    const char **fileNames;         // Files to load
+    rl_Image *images;               // Loaded images
+} ImageBatchJob;
+
+// Decoded image cache entry, image loaded from file
+typedef struct ImageCacheEntry {
+    char *fileName;                 // Image file path (NULL for free entry)
+    long modTime;                   // File modification time when loaded
+    rl_Image image;                 // Decoded image
+    int size;                       // Image data size in bytes
+    unsigned int lastUse;           // Last use stamp, least recently used entry is released first
+} ImageCacheEntry;
+
+// Shared texture, loaded once per resource key and referenced by every load
+typedef struct SharedTextureEntry {
+    char *key;                      // Resource key: file path or data hash (NULL for free entry)
+    unsigned int hash;              // Resource key hash
+    rl_Texture2D texture;           // Shared texture (id is 0 until uploaded)
+    rl_Image image;                 // Decoded image pending upload (decoded by async loading thread)
+    long modTime;                   // Resource file modification time when loaded (0 if not a file)
+    int refCount;                   // References count, texture is unloaded on last release
+    bool loading;                   // Image being decoded by a thread, loads of same resource wait for it
+    int nextKey;                    // Next entry index on key hash bucket, next free entry for free entries (-1: last)
+    int nextId;                     // Next entry index on texture id bucket (-1: last), linked once texture is uploaded
+} SharedTextureEntry;
+
+// PNG encoding job, image rows chunks filtered and compressed independently
+typedef struct PngEncodeJob {
+    const unsigned char *pixels;    // Image pixels, 8 bit channels
+    int width;                      // Image width
+    int height;                     // Image height
+    int channels;                   // Image channels (1 to 4)
+    int chunkRows;                  // Image rows per chunk
+    int level;                      // Compression level
+    unsigned char **chunks;         // Chunks IDAT data (including length, tag and CRC)
+    int *chunkSizes;                // Chunks IDAT data size
+    unsigned int *checksums;        // Chunks filtered data Adler-32 checksums
+} PngEncodeJob;
+
+// Image export request, queued for export thread
+typedef struct ImageExportRequest {
+    rl_Image image;                 // Image copy to export
+    char *fileName;                 // Export file name
+    struct ImageExportRequest *next; // Next queued request
+} ImageExportRequest;
+
+// Image views shared storage, pixels released with last reference
+typedef struct ImageViewStorage {
+    void *data;                     // Image pixels
+    int refCount;                   // Views referencing storage
+} ImageViewStorage;
+
+// Image view color operation type
+typedef enum {
+    IMAGE_VIEW_COLOR_TINT = 0,      // Tint
+    IMAGE_VIEW_COLOR_INVERT,        // Invert
+    IMAGE_VIEW_COLOR_GRAYSCALE,     // Grayscale (luminance in color channels)
+    IMAGE_VIEW_COLOR_CONTRAST,      // Contrast
+    IMAGE_VIEW_COLOR_BRIGHTNESS,    // Brightness
+    IMAGE_VIEW_COLOR_REPLACE        // Replace color
+} ImageViewColorOperationType;
+
+// Indexed image job, pixels range mapped to nearest palette color index
+typedef struct IndexedImageJob {
+    const rl_Color *pixels;         // Image pixels (RGBA8)
+    unsigned char *indices;         // Indexed image pixels (palette indices)
+    const rl_Color *palette;        // Palette colors
+    int colorCount;                 // Palette colors count
+} IndexedImageJob;
+
+// Image ordered dithering job, image rows range
+typedef struct DitherJob {
+    const rl_Color *pixels;         // Image pixels (RGBA8)
+    unsigned short *dst;            // Dithered pixels (16bpp)
+    int width;                      // Image width
+    int bpp[4];                     // Channels bits (r, g, b, a)
+    const unsigned char *thresholds;    // Thresholds tile (0..254), same threshold for all color channels
+    int size;                       // Thresholds tile size (power of two, multiple of 8)
+} DitherJob;
+
+// Perlin noise image generation job, image rows range
+typedef struct PerlinNoiseJob {
+    rl_Color *pixels;               // Image pixels
+    int width;                      // Image width
+    int height;                     // Image height
+    int offsetX;                    // Noise offset x (pixels)
+    int offsetY;                    // Noise offset y (pixels)
+    float scale;                    // Noise scale
+} PerlinNoiseJob;
+
+// Perlin noise octave lattice data for an image row
+typedef struct PerlinNoiseRow {
+    int seed;                       // Octave seed (octave index)
+    int y0, y1;                     // Lattice rows (wrapped)
+    int z0, z1;                     // Lattice layers (wrapped)
+    float fy;                       // Row coordinate fraction within lattice cell
+    float fz;                       // Layer coordinate fraction within lattice cell
+    float v;                        // Row fade curve
+    float w;                        // Layer fade curve
+} PerlinNoiseRow;
+
+// Perlin noise lattice cell, corners gradients dot products terms (corner index bits: x (4), y (2), z (1))
+// NOTE: Dot products are evaluated as (gx*x + gy*y) + gz*z, same as stb_perlin, y and z terms are constant along a row
+typedef struct PerlinNoiseCell {
+    int px;                         // Lattice column
+    float gx[8];                    // Gradients x
+    float gy[8];                    // Gradients y multiplied by row fraction
+    float gz[8];                    // Gradients z multiplied by layer fraction
+} PerlinNoiseCell;
+
+// Cellular image generation job, image rows range
+typedef struct CellularJob {
+    rl_Color *pixels;               // Image pixels
+    const rl_Vector2 *seeds;        // Seeds positions, one per tile
+    int width;                      // Image width
+    int tileSize;                   // Tile size (pixels)
+    int seedsPerRow;                // Number of tiles per row
+    int seedsPerCol;                // Number of tiles per column
+} CellularJob;
+
+// Image box blur pass job, rows or columns range of the image
+typedef struct BlurPassJob {
+    const rl_Vector4 *src;          // Source pixels (premultiplied, 0..255)
+    rl_Vector4 *dst;                // Destination pixels
+    int width;                      // Image width
+    int height;                     // Image height
+    int blurSize;                   // Box radius
+} BlurPassJob;
+
+// Image convolution job, a pass of rows of the image
+// NOTE: Source pixels are zero padded, out of image samples are read from padding
+typedef struct ConvolutionJob {
+    const rl_Vector4 *src;          // Source pixels (normalized), first image pixel address
+    rl_Vector4 *dst;                // Destination pixels (horizontal pass of separable kernel)
+    rl_Color *colors;               // Destination colors (last pass)
+    const float *kernel;            // Kernel weights (square matrix or 1D kernel)
+    int kernelWidth;                // Kernel width
+    int width;                      // Image width
+    int firstRow;                   // Row of job range start, rows out of image are convolved for next pass
+} ConvolutionJob;
+
+// Image canvas command type
+typedef enum {
+    IMAGE_CANVAS_RECTANGLE = 0,     // Filled rectangle (also pixel and background)
+    IMAGE_CANVAS_LINE,              // Line
+    IMAGE_CANVAS_CIRCLE,            // Filled circle
+    IMAGE_CANVAS_CIRCLE_LINES,      // Circle outline
+    IMAGE_CANVAS_TRIANGLE,          // Filled triangle
+    IMAGE_CANVAS_TRIANGLE_COLORS    // Filled triangle with interpolated colors
+} ImageCanvasCommandType;
+
+// Image canvas command, drawing primitive recorded for rasterization by tiles
+typedef struct ImageCanvasCommand {
+    int type;                       // Command type (ImageCanvasCommandType)
+    int xMin;                       // Bounds min x (inclusive)
+    int yMin;                       // Bounds min y (inclusive)
+    int xMax;                       // Bounds max x (inclusive)
+    int yMax;                       // Bounds max y (inclusive)
+    int values[11];                 // Primitive values (line steps, circle, triangle barycentric setup)
+    float invSum;                   // Triangle barycentric coordinates normalization (interpolated colors)
+    rl_Color colors[3];             // Primitive color (vertex colors for interpolated colors)
+    unsigned char pixel[16];        // Primitive color converted to image format
+} ImageCanvasCommand;
+
+// Image canvas rasterization job, one tile per range element
+typedef struct ImageCanvasJob {
+    rl_Image *image;                        // Canvas image
+    const ImageCanvasCommand *commands;     // Recorded commands
+    const int *tileStarts;                  // First binned command per tile (tiles count + 1)
+    const int *tileCommands;                // Binned commands indices, in recording order per tile
+    int tilesX;                             // Number of tiles per row
+    int bytesPerPixel;                      // Image pixel size in bytes
+} ImageCanvasJob;
+
+// Texture stream entry, source image kept in RAM and resident mipmap levels in VRAM
+typedef struct TextureStreamEntry {
+    rl_Image image;                 // Source image, all mipmap levels (data is NULL for free entry)
+    rl_Texture2D texture;           // Resident texture, mipmap levels from residentMip
+    rl_Texture2D pending;           // Texture being uploaded, mipmap levels from pendingMip (id is 0 if none)
+    int residentMip;                // First resident mipmap level
+    int pendingMip;                 // First mipmap level of pending texture
+    int requestedMip;               // First mipmap level requested
+    int frameRequestedMip;          // First mipmap level requested on current frame (-1: not requested)
+    int baseMip;                    // First mipmap level always resident
+    int idleFrames;                 // Frames since last request
+} TextureStreamEntry;
+
+// Texture atlas entry, image packed in atlas
+typedef struct TextureAtlasEntry {
+    rl_Rectangle rec;               // Image rectangle in atlas (pixels)
+    bool used;                      // Entry holds an image
+} TextureAtlasEntry;
+
+// Texture atlas data, packed images pixels kept in RAM and uploaded by regions
+typedef struct TextureAtlasData {
+    rl_Image image;                 // Atlas image (RGBA8), copy of texture data (data is NULL for free slot)
+    rl_Texture2D texture;           // Atlas texture
+    stbrp_context *context;         // Skyline packer context
+    stbrp_node *nodes;              // Skyline packer nodes (atlas width)
+    TextureAtlasEntry *entries;     // Atlas entries, entry id is index + 1
+    int entryCount;                 // Entries allocated
+    int freedArea;                  // Packed area released, reclaimed on defragmentation
+} TextureAtlasData;
+
+// Image texture data, dirty rectangles of an image mirrored by texture
+typedef struct ImageTextureData {
+    rl_Image *image;                // Image mirrored by texture, kept by user (NULL for free slot)
+    void *imageData;                // Image data at last sync, data reallocated is uploaded in full
+    rl_Texture2D texture;           // Texture mirroring image
+    int dirtyCount;                 // Dirty rectangles count
+    int dirty[MAX_IMAGE_TEXTURE_DIRTY_RECTS][4];    // Dirty rectangles bounds (xMin, yMin, xMax, yMax), max bounds exclusive
+} ImageTextureData;
+
+// Image mapped data, raw image file mapped in memory or read on demand
+typedef struct ImageMappedData {
+    void *mapping;                  // File mapping (NULL if file is read on demand)
+    long long mappingSize;          // File mapping size in bytes
+    FILE *file;                     // File read on demand if not mapped (NULL if mapped)
+    long long dataOffset;           // Pixel data offset in file (header size)
+    int width;                      // Image width
+    int height;                     // Image height
+    int format;                     // Data format (rl_PixelFormat type)
+} ImageMappedData;
+
+// Animated texture data, frames decoded on demand from file data
+typedef struct AnimatedTextureData {
+    rl_Texture2D texture;           // Texture showing current frame (id is 0 for free slot)
+    int frameCount;                 // Number of frames
+    int frame;                      // Current frame
+    int delay;                      // Current frame delay in milliseconds
+    float frameTime;                // Time elapsed on current frame in milliseconds
+    unsigned char *fileData;        // File data, frames are decoded from it (NULL for single frame)
+    int dataSize;                   // File data size
+    unsigned char *frames[2];       // Last two decoded frames (RGBA8), indexed by frame parity
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    stbi__context context;          // GIF decoder data stream
+    stbi__gif *gif;                 // GIF decoder state
+#endif
+} AnimatedTextureData;
+
+// Image compression job, mipmap level compressed by blocks rows
+typedef struct CompressionJob {
+    const rl_Color *pixels;         // Level pixels (RGBA8)
+    int width;                      // Level width
+    int height;                     // Level height
+    int format;                     // Compressed pixel format
+    int blockSize;                  // Compressed block size in bytes (4x4 pixels)
+    unsigned char *dst;             // Level compressed data
+} CompressionJob;
+
+// Pixels row conversion kernels from/to RGBA8, generated for every uncompressed format
+typedef void (*GetPixelRowFunc)(const unsigned char *src, int count, rl_Color *dst);
+typedef void (*SetPixelRowFunc)(const rl_Color *src, int count, unsigned char *dst);
+
+// Image filters pixel, 4 float channels processed at once
+#if defined(RTEXTURES_SSE2_ENABLED)
+typedef __m128 FilterPixel;
+#elif defined(RTEXTURES_NEON_ENABLED)
+typedef float32x4_t FilterPixel;
+#else
+typedef rl_Vector4 FilterPixel;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// It's lonely here...
+static RL_CONTEXT_LOCAL RenderTexturePoolEntry renderTexturePool[MAX_RENDER_TEXTURE_POOL] = { 0 };
+static RL_CONTEXT_LOCAL int textureCompressionFormat = 0;    // Compressed format for textures loaded from uncompressed images (0: disabled)
+
+// Texture streams, entries array grows as required
+static struct {
+    TextureStreamEntry *entries;    // Texture streams entries
+    int capacity;                   // Entries allocated
+    long long budget;               // VRAM budget in bytes (0: no budget)
+} textureStreams = { NULL, 0, TEXTURE_STREAM_BUDGET };
+
+// sRGB conversion tables for mipmaps filtering in linear space
+static struct {
+    bool loaded;                    // Tables computed
+    float linear[256];              // sRGB 8 bit value to linear value
+    unsigned char srgb[IMAGE_MIPMAP_SRGB_TABLE_SIZE];   // Linear value to sRGB 8 bit value
+} mipmapSrgbTables = { 0 };
+
+// Ordered dithering 8x8 Bayer matrix
+static const unsigned char ditherBayerMatrix[64] = {
+     0, 32,  8, 40,  2, 34, 10, 42,
+    48, 16, 56, 24, 50, 18, 58, 26,
+    12, 44,  4, 36, 14, 46,  6, 38,
+    60, 28, 52, 20, 62, 30, 54, 22,
+     3, 35, 11, 43,  1, 33,  9, 41,
+    51, 19, 59, 27, 49, 17, 57, 25,
+    15, 47,  7, 39, 13, 45,  5, 37,
+    63, 31, 55, 23, 61, 29, 53, 21
+};
+
+// Blue noise dithering thresholds tile (void-and-cluster)
+static struct {
+    bool loaded;                    // Tile generated
+    unsigned char thresholds[DITHER_BLUE_NOISE_SIZE*DITHER_BLUE_NOISE_SIZE];    // Thresholds (0..254)
+} ditherBlueNoise = { 0 };
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Perlin noise gradients, same basis as stb_perlin (indexed by stb__perlin_randtab_grad_idx)
+static const float perlinGradients[12][3] = {
+    { 1, 1, 0 }, { -1, 1, 0 }, { 1, -1, 0 }, { -1, -1, 0 },
+    { 1, 0, 1 }, { -1, 0, 1 }, { 1, 0, -1 }, { -1, 0, -1 },
+    { 0, 1, 1 }, { 0, -1, 1 }, { 0, 1, -1 }, { 0, -1, -1 }
+};
+#endif
+
+// Texture atlases, array grows as required
+static struct {
+    TextureAtlasData *atlases;      // Texture atlases data
+    int capacity;                   // Atlases allocated
+} textureAtlases = { 0 };
+
+// Image textures, array grows as required
+static struct {
+    ImageTextureData *textures;     // Image textures data
+    int capacity;                   // Image textures allocated
+    int count;                      // Image textures loaded, image drawing is not tracked if 0
+} imageTextures = { 0 };
+
+// Mapped images, array grows as required
+static struct {
+    ImageMappedData *images;        // Mapped images data
+    int capacity;                   // Mapped images allocated
+} imagesMapped = { 0 };
+
+// Animated textures, array grows as required
+static struct {
+    AnimatedTextureData *animations; // Animated textures data
+    int capacity;                   // Animated textures allocated
+} animatedTextures = { 0 };
+
+// Image canvas, drawing commands recorded for image rasterized by tiles
+static struct {
+    rl_Image *image;                // Canvas image (NULL: canvas mode not active)
+    ImageCanvasCommand *commands;   // Recorded commands
+    int count;                      // Number of recorded commands
+    int capacity;                   // Commands allocated
+} imageCanvas = { 0 };
+
+// Decoded images cache, entries array grows as required
+static struct {
+    ImageCacheEntry *entries;       // Cache entries
+    int capacity;                   // Entries allocated
+    long long size;                 // Cached images data size in bytes
+    long long maxSize;              // Cache size in bytes (0: cache disabled)
+    unsigned int useCounter;        // Use stamps counter
+} imageCache = { NULL, 0, 0, IMAGE_CACHE_SIZE, 0 };
+
+#if defined(SUPPORT_SHARED_TEXTURES)
+// Shared textures registry, entries array grows as required
+// NOTE: Entries are indexed by key hash and by texture id, buckets count is entries capacity (power of two)
+static struct {
+    SharedTextureEntry *entries;    // Registry entries
+    int capacity;                   // Entries allocated
+    int *keyBuckets;                // First entry index by key hash bucket (-1: empty)
+    int *idBuckets;                 // First entry index by texture id bucket (-1: empty)
+    int freeEntry;                  // First free entry index (-1: registry full)
+} sharedTextures = { NULL, 0, NULL, NULL, -1 };
+#endif
+
+static int imageExportCompression = IMAGE_EXPORT_COMPRESSION;   // PNG export compression level
+
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+static pthread_mutex_t imageCacheLock = PTHREAD_MUTEX_INITIALIZER;  // Protects decoded images cache from batch loading threads
+static pthread_mutex_t imageViewsLock = PTHREAD_MUTEX_INITIALIZER;  // Protects image views storage reference counts
+#if defined(SUPPORT_SHARED_TEXTURES)
+static pthread_mutex_t sharedTexturesLock = PTHREAD_MUTEX_INITIALIZER;  // Protects shared textures registry from loading threads
+static pthread_cond_t sharedTexturesCond = PTHREAD_COND_INITIALIZER;    // Signaled when a shared resource loading completes
+#endif
+// Image export thread, created on first async export
+static pthread_mutex_t imageExportsLock = PTHREAD_MUTEX_INITIALIZER;   // Protects exports queue
+static pthread_cond_t imageExportsCond = PTHREAD_COND_INITIALIZER;      // Export queued or quit requested
+static pthread_cond_t imageExportsDoneCond = PTHREAD_COND_INITIALIZER;  // All queued exports completed
+static struct {
+    bool ready;                     // Export thread initialized
+    bool quit;                      // Export thread exit request (once queue is empty)
+    pthread_t thread;               // Export thread handle
+    ImageExportRequest *first;      // First queued request
+    ImageExportRequest *last;       // Last queued request
+    int pending;                    // Requests queued or being exported
+} imageExports = { 0 };
+#endif
+
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Render texture processing shaders, fragment passes sampling source texels centers
+// NOTE: Render textures keep image orientation (first row on top), passes use default vertex shader
+#if defined(GRAPHICS_API_OPENGL_21)
+    #define IMAGE_SHADER_HEADER         "#version 120\n"
+#elif defined(GRAPHICS_API_OPENGL_33)
+    #define IMAGE_SHADER_HEADER         "#version 330\n"
+#elif defined(GRAPHICS_API_OPENGL_ES3)
+    #define IMAGE_SHADER_HEADER         "#version 300 es\nprecision highp float;\n"
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    #define IMAGE_SHADER_HEADER         "#version 100\n#ifdef GL_FRAGMENT_PRECISION_HIGH\nprecision highp float;\n#else\nprecision mediump float;\n#endif\n"
+#endif
+#if defined(GRAPHICS_API_OPENGL_21) || (defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3))
+    #define IMAGE_SHADER_VARYING        "varying"
+    #define IMAGE_SHADER_OUTPUT         ""
+    #define IMAGE_SHADER_FRAGCOLOR      "gl_FragColor"
+    #define IMAGE_SHADER_TEXTURE        "texture2D"
+#else
+    #define IMAGE_SHADER_VARYING        "in"
+    #define IMAGE_SHADER_OUTPUT         "out vec4 finalColor;\n"
+    #define IMAGE_SHADER_FRAGCOLOR      "finalColor"
+    #define IMAGE_SHADER_TEXTURE        "texture"
+#endif
+#define IMAGE_SHADER_STRING(x)          #x
+#define IMAGE_SHADER_VALUE(x)           IMAGE_SHADER_STRING(x)
+
+#define IMAGE_SHADER_INPUTS IMAGE_SHADER_HEADER \
+    IMAGE_SHADER_VARYING " vec2 fragTexCoord;\n" \
+    IMAGE_SHADER_OUTPUT \
+    "uniform sampler2D texture0;\n"
+
+// Nearest texel sampling, used for copy, crop, flip and 90 degrees rotation passes
+static const char *imageNearestShaderCode = IMAGE_SHADER_INPUTS
+    "uniform vec2 sourceSize;\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 texel = (min(floor(fragTexCoord*sourceSize), sourceSize - 1.0) + 0.5)/sourceSize;\n"
+    "    " IMAGE_SHADER_FRAGCOLOR " = " IMAGE_SHADER_TEXTURE "(texture0, texel);\n"
+    "}\n";
+
+// Bilinear sampling from texels centers, independent of source texture filter
+static const char *imageBilinearShaderCode = IMAGE_SHADER_INPUTS
+    "uniform vec2 sourceSize;\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 position = fragTexCoord*sourceSize - 0.5;\n"
+    "    vec2 texel = floor(position);\n"
+    "    vec2 weight = position - texel;\n"
+    "    vec2 coord0 = (clamp(texel, vec2(0.0), sourceSize - 1.0) + 0.5)/sourceSize;\n"
+    "    vec2 coord1 = (clamp(texel + 1.0, vec2(0.0), sourceSize - 1.0) + 0.5)/sourceSize;\n"
+    "    vec4 top = mix(" IMAGE_SHADER_TEXTURE "(texture0, coord0), " IMAGE_SHADER_TEXTURE "(texture0, vec2(coord1.x, coord0.y)), weight.x);\n"
+    "    vec4 bottom = mix(" IMAGE_SHADER_TEXTURE "(texture0, vec2(coord0.x, coord1.y)), " IMAGE_SHADER_TEXTURE "(texture0, coord1), weight.x);\n"
+    "    " IMAGE_SHADER_FRAGCOLOR " = mix(top, bottom, weight.y);\n"
+    "}\n";
+
+// Color transform: tint, invert, grayscale, contrast and brightness
+static const char *imageColorShaderCode = IMAGE_SHADER_INPUTS
+    "uniform mat4 colorMatrix;\n"
+    "uniform vec4 colorOffset;\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 color = " IMAGE_SHADER_TEXTURE "(texture0, fragTexCoord);\n"
+    "    " IMAGE_SHADER_FRAGCOLOR " = clamp(colorMatrix*color + colorOffset, 0.0, 1.0);\n"
+    "}\n";
+
+// Color replacement, colors are compared with 8 bit precision
+static const char *imageReplaceShaderCode = IMAGE_SHADER_INPUTS
+    "uniform vec4 color;\n"
+    "uniform vec4 replace;\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 texel = " IMAGE_SHADER_TEXTURE "(texture0, fragTexCoord);\n"
+    "    " IMAGE_SHADER_FRAGCOLOR " = all(lessThan(abs(texel - color), vec4(0.5/255.0)))? replace : texel;\n"
+    "}\n";
+
+// Gaussian blur 1D pass, weights of taps out of texture are not accumulated
+// NOTE: First pass premultiplies alpha, last pass reverses it
+static const char *imageBlurShaderCode = IMAGE_SHADER_INPUTS
+    "#define MAX_RADIUS " IMAGE_SHADER_VALUE(IMAGE_BLUR_MAX_RADIUS) "\n"
+    "uniform vec2 texelStep;\n"
+    "uniform int radius;\n"
+    "uniform float weights[MAX_RADIUS + 1];\n"
+    "uniform float premultiply;\n"
+    "uniform float unpremultiply;\n"
+    "vec4 Sample(vec2 coord)\n"
+    "{\n"
+    "    vec4 texel = " IMAGE_SHADER_TEXTURE "(texture0, coord);\n"
+    "    if (premultiply > 0.5) texel.rgb *= texel.a;\n"
+    "    return texel;\n"
+    "}\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 sum = Sample(fragTexCoord)*weights[0];\n"
+    "    float weightSum = weights[0];\n"
+    "    for (int i = 1; i <= MAX_RADIUS; i++)\n"
+    "    {\n"
+    "        if (i > radius) break;\n"
+    "        vec2 offset = texelStep*float(i);\n"
+    "        if (all(greaterThanEqual(fragTexCoord - offset, vec2(0.0)))) { sum += Sample(fragTexCoord - offset)*weights[i]; weightSum += weights[i]; }\n"
+    "        if (all(lessThanEqual(fragTexCoord + offset, vec2(1.0)))) { sum += Sample(fragTexCoord + offset)*weights[i]; weightSum += weights[i]; }\n"
+    "    }\n"
+    "    vec4 color = sum/weightSum;\n"
+    "    if ((unpremultiply > 0.5) && (color.a > 0.0)) color.rgb /= color.a;\n"
+    "    " IMAGE_SHADER_FRAGCOLOR " = color;\n"
+    "}\n";
+
+// Ordered dithering (4x4 Bayer matrix) to channels levels, no levels drops the channel
+static const char *imageDitherShaderCode = IMAGE_SHADER_INPUTS
+    "uniform vec4 levels;\n"
+    "float Bayer2(vec2 position)\n"
+    "{\n"
+    "    position = floor(position);\n"
+    "    return fract(position.x/2.0 + position.y*position.y*0.75);\n"
+    "}\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 color = " IMAGE_SHADER_TEXTURE "(texture0, fragTexCoord);\n"
+    "    float threshold = Bayer2(0.5*gl_FragCoord.xy)*0.25 + Bayer2(gl_FragCoord.xy) + 1.0/32.0;\n"
+    "    vec4 dithered = min(floor(color*levels + threshold), levels)/max(levels, 1.0);\n"
+    "    " IMAGE_SHADER_FRAGCOLOR " = mix(vec4(0.0, 0.0, 0.0, 1.0), dithered, step(0.5, levels));\n"
+    "}\n";
+
+// Perlin fbm noise (6 octaves), same lattice as stb_perlin_fbm_noise3() on image pixels
+// NOTE: Source texture is the permutation table: first row hashes, second row gradients (+1)
+static const char *imagePerlinShaderCode = IMAGE_SHADER_INPUTS
+    "uniform vec2 noiseOffset;\n"
+    "uniform vec2 noiseScale;\n"
+    "float Hash(float index)\n"
+    "{\n"
+    "    return floor(" IMAGE_SHADER_TEXTURE "(texture0, vec2((index + 0.5)/512.0, 0.25)).r*255.0 + 0.5);\n"
+    "}\n"
+    "float Gradient(float index, vec3 position)\n"
+    "{\n"
+    "    vec3 gradient = floor(" IMAGE_SHADER_TEXTURE "(texture0, vec2((index + 0.5)/512.0, 0.75)).rgb*255.0 + 0.5) - 1.0;\n"
+    "    return dot(gradient, position);\n"
+    "}\n"
+    "float Noise(vec3 position, float seed)\n"
+    "{\n"
+    "    vec3 cell = floor(position);\n"
+    "    vec3 f = position - cell;\n"
+    "    vec3 c0 = mod(cell, 256.0);\n"
+    "    vec3 c1 = mod(cell + 1.0, 256.0);\n"
+    "    vec3 ease = ((f*6.0 - 15.0)*f + 10.0)*f*f*f;\n"
+    "    float r0 = Hash(c0.x + seed);\n"
+    "    float r1 = Hash(c1.x + seed);\n"
+    "    float r00 = Hash(r0 + c0.y);\n"
+    "    float r01 = Hash(r0 + c1.y);\n"
+    "    float r10 = Hash(r1 + c0.y);\n"
+    "    float r11 = Hash(r1 + c1.y);\n"
+    "    float n00 = mix(Gradient(r00 + c0.z, f), Gradient(r00 + c1.z, f - vec3(0.0, 0.0, 1.0)), ease.z);\n"
+    "    float n01 = mix(Gradient(r01 + c0.z, f - vec3(0.0, 1.0, 0.0)), Gradient(r01 + c1.z, f - vec3(0.0, 1.0, 1.0)), ease.z);\n"
+    "    float n10 = mix(Gradient(r10 + c0.z, f - vec3(1.0, 0.0, 0.0)), Gradient(r10 + c1.z, f - vec3(1.0, 0.0, 1.0)), ease.z);\n"
+    "    float n11 = mix(Gradient(r11 + c0.z, f - vec3(1.0, 1.0, 0.0)), Gradient(r11 + c1.z, f - vec3(1.0, 1.0, 1.0)), ease.z);\n"
+    "    return mix(mix(n00, n01, ease.y), mix(n10, n11, ease.y), ease.x);\n"
+    "}\n"
+    "void main()\n"
+    "{\n"
+    "    vec3 position = vec3((floor(gl_FragCoord.xy) + noiseOffset)*noiseScale, 1.0);\n"
+    "    float sum = 0.0;\n"
+    "    float frequency = 1.0;\n"
+    "    float amplitude = 1.0;\n"
+    "    for (int i = 0; i < 6; i++)\n"
+    "    {\n"
+    "        sum += Noise(position*frequency, float(i))*amplitude;\n"
+    "        frequency *= 2.0;\n"
+    "        amplitude *= 0.5;\n"
+    "    }\n"
+    "    float intensity = floor((clamp(sum, -1.0, 1.0) + 1.0)*0.5*255.0)/255.0;\n"
+    "    " IMAGE_SHADER_FRAGCOLOR " = vec4(intensity, intensity, intensity, 1.0);\n"
+    "}\n";
+
+// Cellular noise, distance to nearest seed of adjacent tiles
+// NOTE: Source texture holds a seed per tile, position in tile as 16 bit x (rg) and y (ba)
+static const char *imageCellularShaderCode = IMAGE_SHADER_INPUTS
+    "uniform vec2 seedCount;\n"
+    "uniform float tileSize;\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 position = floor(gl_FragCoord.xy);\n"
+    "    vec2 tile = floor((position + 0.5)/tileSize);\n"
+    "    float minDistance = 65536.0;\n"
+    "    for (int j = -1; j <= 1; j++)\n"
+    "    {\n"
+    "        for (int i = -1; i <= 1; i++)\n"
+    "        {\n"
+    "            vec2 neighbor = tile + vec2(float(i), float(j));\n"
+    "            if (any(lessThan(neighbor, vec2(0.0))) || any(greaterThanEqual(neighbor, seedCount))) continue;\n"
+    "            vec4 seed = floor(" IMAGE_SHADER_TEXTURE "(texture0, (neighbor + 0.5)/seedCount)*255.0 + 0.5);\n"
+    "            minDistance = min(minDistance, distance(position, neighbor*tileSize + vec2(seed.r*256.0 + seed.g, seed.b*256.0 + seed.a)));\n"
+    "        }\n"
+    "    }\n"
+    "    float intensity = min(floor(minDistance*256.0/tileSize), 255.0)/255.0;\n"
+    "    " IMAGE_SHADER_FRAGCOLOR " = vec4(intensity, intensity, intensity, 1.0);\n"
+    "}\n";
+
+// Palette lookup drawing shader, texels are 8-bit palette indices (red channel)
+// NOTE: Palette texture is TEXTURE_PALETTE_SIZE x 1, shader is used for drawing, output is tinted as default shader
+static const char *paletteShaderCode = IMAGE_SHADER_HEADER
+    IMAGE_SHADER_VARYING " vec2 fragTexCoord;\n"
+    IMAGE_SHADER_VARYING " vec4 fragColor;\n"
+    IMAGE_SHADER_OUTPUT
+    "uniform sampler2D texture0;\n"
+    "uniform sampler2D palette;\n"
+    "uniform vec4 colDiffuse;\n"
+    "void main()\n"
+    "{\n"
+    "    float index = floor(" IMAGE_SHADER_TEXTURE "(texture0, fragTexCoord).r*255.0 + 0.5);\n"
+    "    vec4 color = " IMAGE_SHADER_TEXTURE "(palette, vec2((index + 0.5)/" IMAGE_SHADER_VALUE(TEXTURE_PALETTE_SIZE) ".0, 0.5));\n"
+    "    " IMAGE_SHADER_FRAGCOLOR " = color*colDiffuse*fragColor;\n"
+    "}\n";
+
+static struct {
+    bool loaded;                    // Shaders loading was attempted
+    bool ready;                     // All shaders loaded successfully
+    rl_Shader nearest;              // Nearest texel sampling shader
+    rl_Shader bilinear;             // Bilinear sampling shader
+    rl_Shader color;                // Color transform shader
+    rl_Shader replace;              // Color replacement shader
+    rl_Shader blur;                 // Gaussian blur 1D pass shader
+    rl_Shader dither;               // Ordered dithering shader
+    rl_Shader perlin;               // Perlin noise generation shader
+    rl_Shader cellular;             // Cellular noise generation shader
+    rl_Texture2D perlinTable;       // Perlin noise permutation table (loaded on first use)
+    int nearestSizeLoc;             // Location: nearest shader source size
+    int bilinearSizeLoc;            // Location: bilinear shader source size
+    int colorMatrixLoc;             // Location: color transform matrix
+    int colorOffsetLoc;             // Location: color transform offset
+    int replaceColorLoc;            // Location: color to replace
+    int replaceLoc;                 // Location: replacement color
+    int blurStepLoc;                // Location: blur texel step (direction)
+    int blurRadiusLoc;              // Location: blur radius in texels
+    int blurWeightsLoc;             // Location: blur weights
+    int blurPremultiplyLoc;         // Location: blur alpha premultiply (first pass)
+    int blurUnpremultiplyLoc;       // Location: blur alpha premultiply reverse (last pass)
+    int ditherLevelsLoc;            // Location: dither channels levels
+    int perlinOffsetLoc;            // Location: perlin noise pixels offset
+    int perlinScaleLoc;             // Location: perlin noise scale per pixel
+    int cellularCountLoc;           // Location: cellular seeds per row and column
+    int cellularSizeLoc;            // Location: cellular tile size
+    bool paletteLoaded;             // Palette shader loading was attempted
+    bool paletteReady;              // Palette shader loaded successfully
+    rl_Shader palette;              // Palette lookup drawing shader (loaded on first use)
+    int paletteLoc;                 // Location: palette texture
+} imageShaders = { 0 };
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
 //----------------------------------------------------------------------------------
 extern void LoadFontDefault(void);          // [Module: text] Loads default font, required by rl_ImageDrawText()
+#if defined(SUPPORT_SHARED_TEXTURES) && defined(SUPPORT_ASSETS_HOT_RELOAD)
+extern void WatchAssetFile(const char *fileName); // [Module: core] Watch asset file for changes, shared textures files are reloaded
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration (required by core)
+//----------------------------------------------------------------------------------
+void UpdateRenderTexturePool(bool unloadIdle); // Recycle render textures handed out for current frame (called at frame end)
+void UnloadRenderTexturePool(void);         // Unload all pooled render textures
+void BeginRenderTexturePoolPass(unsigned int id);   // Invalidate pooled render texture contents on first pass since acquired
+void EndRenderTexturePoolPass(unsigned int id);     // Invalidate pooled render texture depth at pass end (not required after pass)
+void CloseImageWorkerThreads(void);         // Close image filters worker threads
+void RunImageWorkerTasks(void (*process)(const void *data, int start, int end), const void *data, int count, int chunkSize); // Run range tasks on image worker threads (required by text)
+void UnloadImageShaders(void);              // Unload render texture processing shaders
+void UpdateTextureStreams(void);            // Update texture streams, stream in requested levels and evict over budget (called at frame end)
+void UnloadTextureStreams(void);            // Unload all texture streams
+#if defined(SUPPORT_SHARED_TEXTURES)
+bool AcquireSharedTexture(const char *key, rl_Texture2D *texture); // Acquire shared texture by resource key, false if resource must be loaded by caller (required by models)
+rl_Texture2D StoreSharedTexture(const char *key, rl_Image image, bool upload); // Store shared texture image, completing resource loading (required by models)
+rl_Texture2D UploadSharedTexture(const char *key); // Upload shared texture image stored by a deferred load (required by models)
+void UnloadSharedTextures(void);            // Unload shared textures registry
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+bool ReloadSharedTextureFile(const char *fileName); // Reload shared texture by resource file, false if file is not a shared texture (required by core)
+#endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Internal Functions Declaration
 //----------------------------------------------------------------------------------
 static float HalfToFloat(unsigned short x);
 static unsigned short FloatToHalf(float x);
-static rl_Vector4 *LoadImageDataNormalized(rl_Image image);       // Load pixel data from image as rl_Vector4 array (float normalized)
+static rl_Vector4 *LoadImageDataNormalized(rl_Image image);       // Load pixel data from image as rl_Vector4 array (float normalized), allocated from frame arena
+static bool IsPixelFormatUnorm8(int format);                      // Check if pixel format stores 8 bit normalized channels
+static void DecodePixelsRGBA8(const void *src, int format, int offset, int count, rl_Color *dst); // Decode pixels to RGBA8
+static void EncodePixelsRGBA8(const rl_Color *src, int count, void *dst, int format, int offset); // Encode RGBA8 pixels
+static bool ConvertPixelData(const void *src, int srcFormat, void *dst, int dstFormat, int pixelCount); // Convert pixel data between formats (RGBA8 intermediate)
+static bool IsPixelFormatDrawRow(int format);                     // Check if pixel format can be drawn through RGBA8 rows
+static GetPixelRowFunc GetPixelRowKernel(int format);              // Get pixels row decoding kernel for format
+static SetPixelRowFunc SetPixelRowKernel(int format);              // Get pixels row encoding kernel for format
+static rl_ImageView GetImageViewArea(rl_ImageView view, rl_Rectangle rec); // Get image view area, clamped to view
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void ImageViewColorOperation(rl_ImageView view, int operation, rl_Color color, rl_Color replace, float amount); // Apply color operation to image view pixels, in place
+#endif
+static void BlendColorsRGBA8(rl_Color *dst, const rl_Color *src, int count, rl_Color tint); // Blend RGBA8 colors, same results as rl_ColorAlphaBlend() integer blending
+static void ImageDrawRow(unsigned char *dst, int dstFormat, const unsigned char *src, int srcFormat, int width, rl_Color tint, bool blend); // Draw pixels row through RGBA8 chunks
+static void ImageDrawRowKernels(unsigned char *dst, int dstFormat, const unsigned char *src, int srcFormat, int width, rl_Color tint, bool blend); // Draw pixels row through format kernels, any uncompressed formats
+static rl_RenderTexture2D LoadRenderTextureEx(int width, int height, int format, bool depth); // Load render texture with color format and optional depth
+static bool IsKernelSeparable(const float *kernel, int kernelWidth, float *columnWeights, float *rowWeights); // Check if square kernel is separable, getting its 1D kernels
+static void ProcessBlurRowsRange(const void *data, int start, int end); // Process box blur horizontal pass rows range on current thread
+static void ProcessBlurColumnsRange(const void *data, int start, int end); // Process box blur vertical pass columns range on current thread
+static void ProcessConvolutionRange(const void *data, int start, int end); // Process square kernel convolution rows range on current thread
+static void ProcessConvolutionRowsRange(const void *data, int start, int end); // Process separable kernel horizontal pass rows range on current thread
+static void ProcessConvolutionColumnsRange(const void *data, int start, int end); // Process separable kernel vertical pass rows range on current thread
+static bool IsPixelFormatResizable(int format); // Check if pixel format is resized directly (8 bit, 16 bit half float and 32 bit float channels)
+static bool ResizeImageData(const void *input, int width, int height, int inputStride, void *output, int newWidth, int newHeight, int format, int threadCount); // Resize pixel data (image or image region), resize samplers allocated from frame arena
+static void ProcessImageResizeRange(const void *data, int start, int end); // Process image resize splits range on current thread
+static void ProcessIndexedImageRange(const void *data, int start, int end); // Process indexed image pixels range on current thread
+static void LoadDitherBlueNoise(void); // Load blue noise dithering thresholds tile (on first use)
+static void ProcessDitherRange(const void *data, int start, int end); // Process image ordered dithering rows range on current thread
+static void LoadImageBlock(const rl_Color *pixels, int width, int height, int blockX, int blockY, rl_Color *block); // Load image 4x4 pixels block, clamped to image
+static bool GetBlockPrincipalAxis(const rl_Color *block, const bool *mask, int channels, float *mean, float *axis); // Get block principal axis, false if pixels are equal
+static void CompressBlockColorDXT(const rl_Color *block, unsigned char *dst, bool alpha); // Compress DXT color block (BC1 color part)
+static void CompressBlockAlphaDXT3(const rl_Color *block, unsigned char *dst); // Compress DXT3 explicit alpha block
+static void CompressBlockAlphaDXT5(const rl_Color *block, unsigned char *dst); // Compress DXT5 interpolated alpha block
+static void CompressBlockETC1(const rl_Color *block, unsigned char *dst); // Compress ETC1 color block (valid ETC2 RGB block)
+static void CompressBlockAlphaEAC(const rl_Color *block, unsigned char *dst); // Compress EAC alpha block (ETC2 RGBA alpha part)
+static void CompressBlockBC7(const rl_Color *block, unsigned char *dst); // Compress BC7 block (mode 6)
+static void CompressBlockBC4(const rl_Color *block, unsigned char *dst); // Compress BC4 block (red channel)
+static void ProcessCompressionRange(const void *data, int start, int end); // Process image compression blocks rows range on current thread
+static bool LoadTextureCompressedImage(rl_Image image, rl_Image *compressed); // Compress image for texture upload if compression is enabled and supported
+static TextureStreamEntry *GetTextureStreamEntry(rl_TextureStream stream); // Get texture stream entry, NULL if stream is not valid
+static long long GetTextureStreamBytes(const TextureStreamEntry *entry, int firstMip); // Get texture stream memory size with mipmap levels from first level
+static rl_Texture2D LoadTextureStreamMip(const TextureStreamEntry *entry, int firstMip, bool async); // Load texture with texture stream mipmap levels from first level
+static TextureAtlasData *GetTextureAtlasData(rl_TextureAtlas atlas); // Get texture atlas data, NULL if atlas is not valid
+static bool DefragTextureAtlasData(TextureAtlasData *data); // Defragment texture atlas data, images are repacked together
+static ImageTextureData *GetImageTextureData(rl_ImageTexture texture); // Get image texture data, NULL if image texture is not valid
+static void AddImageTextureDirtyRect(ImageTextureData *data, int xMin, int yMin, int xMax, int yMax); // Add dirty rectangle to image texture, merged with touching rectangles
+static void SetImageAreaDirty(const rl_Image *image, int x, int y, int width, int height); // Set image area dirty on image textures mirroring image
+static ImageMappedData *GetImageMappedData(rl_ImageMapped image); // Get mapped image data, NULL if mapped image is not valid
+static void UnloadImageMappedData(ImageMappedData *data); // Unload mapped image data, file mapping is released or file closed
+static bool GetImageMappedRegion(const ImageMappedData *data, rl_Rectangle rec, int *x, int *y, int *width, int *height); // Get mapped image region clipped to image bounds
+static const unsigned char *GetImageMappedRows(const ImageMappedData *data, int x, int y, int width); // Get mapped image rows data for full width regions
+static bool ReadImageMappedRegion(const ImageMappedData *data, int x, int y, int width, int height, unsigned char *dst); // Read mapped image region into packed pixel data
+static AnimatedTextureData *GetAnimatedTextureData(rl_AnimatedTexture anim); // Get animated texture data, NULL if animated texture is not valid
+static void UnloadAnimatedTextureData(AnimatedTextureData *data); // Unload animated texture data, decoder state and frames
+static bool DecodeAnimatedTextureFrame(AnimatedTextureData *data); // Decode next animated texture frame, restarting after last frame
+#if defined(SUPPORT_FILEFORMAT_GIF)
+static int GetGifFrameCount(const unsigned char *fileData, int dataSize); // Get GIF frames count, parsing file blocks without decoding frames
+#endif
+static float GetImageAlphaCoverage(const unsigned char *pixels, int count, int channels, int alphaChannel, float cutoff, float scale); // Get image alpha test coverage
+static void ScaleImageAlphaCoverage(unsigned char *pixels, int count, int channels, int alphaChannel, float cutoff, float coverage); // Scale image alpha to match alpha test coverage
+static void LoadMipmapSrgbTables(void); // Load sRGB conversion tables used by mipmaps filtering in linear space
+static float GetBesselI0(float x); // Get modified Bessel function of first kind (order 0)
+static void GetMipmapFilterTaps(MipmapTaps *taps, int srcSize, int dstSize, int filter); // Get mipmap filter taps for every destination pixel along one dimension
+static void GenImageMipmapLevel(const unsigned char *src, int srcWidth, int srcHeight, unsigned char *dst, int dstWidth, int dstHeight, int channels, int filter, bool srgb); // Generate mipmap level from previous level
+static void ProcessMipmapBoxRange(const void *data, int start, int end); // Process mipmap level 2x2 box reduction rows range on current thread
+static void ProcessMipmapFilterRange(const void *data, int start, int end); // Process mipmap level separable filter rows range on current thread
+static void ProcessImageBatchRange(const void *data, int start, int end); // Process image batch loading files range on current thread
+#if defined(SUPPORT_IMAGE_GENERATION)
+static void GetPerlinNoiseCell(PerlinNoiseCell *cell, int px, const PerlinNoiseRow *row); // Get perlin noise lattice cell terms of an octave row
+static float GetPerlinNoiseCellValue(const PerlinNoiseCell *cell, float fx, const PerlinNoiseRow *row); // Get perlin noise value within lattice cell
+static void AddPerlinNoiseOctave(rl_Vector4 *sums, const float *coords, int count, float y, float z, float frequency, float amplitude, int seed); // Add perlin noise octave to image row sums
+static void ProcessPerlinNoiseRange(const void *data, int start, int end); // Process perlin noise image rows range on current thread
+static void ProcessCellularRange(const void *data, int start, int end); // Process cellular image rows range on current thread
+#endif
+static bool GetImageRectangleArea(const rl_Image *dst, rl_Rectangle rec, int *area); // Get image rectangle area drawn by rl_ImageDrawRectangleRec(), rectangle clamped to image bounds
+static ImageCanvasCommand *AddImageCanvasCommand(const rl_Image *dst, int type, rl_Color color); // Add drawing command to image canvas, NULL if image is not the canvas image
+static void FlushImageCanvas(void); // Rasterize recorded image canvas commands by tiles, tiles are processed by worker threads
+static void FillImageCanvasArea(rl_Image *image, int xMin, int yMin, int xMax, int yMax, const unsigned char *pixel, int bytesPerPixel); // Fill image area with pixel value, area bounds inclusive
+static void ProcessImageCanvasRange(const void *data, int start, int end); // Process image canvas tiles range on current thread
+static void LockImageCache(void); // Lock decoded images cache, images can be loaded from worker threads
+static void UnlockImageCache(void); // Unlock decoded images cache
+#if defined(SUPPORT_SHARED_TEXTURES)
+static void LockSharedTextures(void); // Lock shared textures registry, resources can be acquired from loading threads
+static void UnlockSharedTextures(void); // Unlock shared textures registry
+static unsigned int GetSharedTextureKeyHash(const char *key); // Get shared texture resource key hash (FNV-1a)
+static SharedTextureEntry *FindSharedTexture(const char *key, unsigned int hash); // Find shared texture entry by resource key (registry locked)
+static SharedTextureEntry *FindSharedTextureId(unsigned int id); // Find shared texture entry by texture id (registry locked)
+static void LinkSharedTextureId(SharedTextureEntry *entry); // Link shared texture entry to texture id index, once texture is uploaded (registry locked)
+static bool GrowSharedTextures(void); // Grow shared textures registry, entries indices are rebuilt (registry locked)
+static SharedTextureEntry *AddSharedTexture(const char *key, unsigned int hash); // Add shared texture entry registered as loading (registry locked)
+static void RemoveSharedTexture(SharedTextureEntry *entry); // Remove shared texture entry (registry locked)
+static bool ReleaseSharedTexture(unsigned int id, bool *released); // Release shared texture reference by texture id, false if texture is not shared
+static bool ReloadSharedTexture(SharedTextureEntry *entry); // Reload shared texture from its resource file (registry locked)
+#endif
+static bool LoadCachedImage(const char *fileName, long modTime, rl_Image *image); // Load image copy from decoded images cache
+static void StoreCachedImage(const char *fileName, long modTime, rl_Image image); // Store image copy in decoded images cache
+static bool RemoveImageCacheEntry(int index); // Remove decoded images cache entry, least recently used entry if index is -1
+static void RunWorkerJob(const WorkerJob *job); // Run job, splitting its range in chunks processed by worker threads
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+static void ProcessWorkerJobRange(void *userData, int start, int end); // Process worker job range (job system callback)
+static void *ImageExportThreadLoop(void *arg); // Image export thread loop, queued images are exported in order
+#endif
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+static unsigned char *EncodeImagePNG(const unsigned char *pixels, int width, int height, int channels, int *dataSize); // Encode image pixels as PNG file data, rows chunks compressed by worker threads
+#if defined(SUPPORT_COMPRESSION_API)
+static void ProcessPngEncodeRange(const void *data, int start, int end); // Process PNG encoding chunks range on current thread
+static int GetPngRowFilter(const unsigned char *row, const unsigned char *prior, int size, int bpp); // Get PNG row filter type with lowest sum of absolute filtered values
+static unsigned int ComputeAdler32(unsigned int adler, const unsigned char *data, int size); // Compute Adler-32 checksum of data
+static unsigned int CombineAdler32(unsigned int adler1, unsigned int adler2, int size2); // Combine Adler-32 checksums of two consecutive data blocks
+#endif
+#endif
+static bool LoadImageShaders(void); // Load render texture processing shaders (on first use)
+static bool LoadPaletteShader(void); // Load palette lookup drawing shader (on first use)
+static void ImageColorPass(rl_RenderTexture2D *target, rl_Matrix matrix, rl_Vector4 offset); // Process render texture colors through color transform pass
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void ImageShaderPass(rl_RenderTexture2D target, rl_Texture2D source, rl_Shader shader, rl_Rectangle sourceRec, rl_Rectangle destRec, rl_Vector2 origin, float rotation, bool clear); // Draw source texture into render texture using processing shader
+static void ImageShaderPassSwap(rl_RenderTexture2D *target, rl_Shader shader, rl_Rectangle sourceRec); // Process render texture through a same size pass
+static void ReplaceRenderTexture(rl_RenderTexture2D *target, rl_RenderTexture2D result); // Replace render texture by a processed one, previous one is unloaded
+static void SetImageShaderSourceSize(rl_Shader shader, int locIndex, rl_Texture2D source); // Set processing shader source size uniform
+#endif
+#if defined(SUPPORT_RENDER_GRAPH)
+static int AddRenderGraphResource(rl_RenderGraph *graph, RenderGraphResource resource); // Add render graph resource, returns resource index
+static int AddRenderGraphPass(rl_RenderGraph *graph, RenderGraphPass pass, const int *inputs, int inputCount); // Add render graph pass, returns pass index
+static void CompileRenderGraph(rl_RenderGraph *graph); // Compile render graph, passes culling, merging and resources lifetimes
+static int GetRenderGraphTargetSize(int size, int renderSize); // Get render graph transient target size for render size
+#endif
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -285,6 +1306,29 @@ rl_Image rl_LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
+    PROFILE_ZONE_BEGIN("rl_LoadImage");
+
+    // Decoded images cache lookup, file modification invalidates cached image
+    long modTime = 0;
+
+    if (imageCache.maxSize > 0)
+    {
+        modTime = rl_GetFileModTime(fileName);
+
+        if (modTime != 0)
+        {
+            LockImageCache();
+            bool cached = LoadCachedImage(fileName, modTime, &image);
+            UnlockImageCache();
+
+            if (cached)
+            {
+                PROFILE_ZONE_END();
+                return image;
+            }
+        }
+    }
+
     // Loading file to memory
     int dataSize = 0;
     unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
@@ -297,6 +1341,15 @@ rl_Image rl_LoadImage(const char *fileName)
         rl_UnloadFileData(fileData);
     }
 
+    if ((modTime != 0) && (image.data != NULL))
+    {
+        LockImageCache();
+        StoreCachedImage(fileName, modTime, image);
+        UnlockImageCache();
+    }
+
+    PROFILE_ZONE_END();
+
     return image;
 }
 
@@ -332,6 +1385,231 @@ rl_Image rl_LoadImageRaw(const char *fileName, int width, int height, int format
     return image;
 }
 
+// Load mapped image from RAW file data, pixel data is paged in from file on access
+// NOTE: File is not loaded in memory, useful for images bigger than available RAM,
+// if memory mapping is not available, regions are read from file when required
+rl_ImageMapped rl_LoadImageRawMapped(const char *fileName, int width, int height, int format, long long headerSize)
+{
+    rl_ImageMapped image = { 0 };
+
+    if ((width <= 0) || (height <= 0) || (headerSize < 0) || (format < PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to map raw image, uncompressed format and valid size required", fileName);
+        return image;
+    }
+
+    ImageMappedData data = { 0 };
+    data.dataOffset = headerSize;
+    data.width = width;
+    data.height = height;
+    data.format = format;
+
+    long long size = (long long)width*height*rl_GetPixelDataSize(1, 1, format);
+    long long fileSize = -1;
+
+#if defined(SUPPORT_IMAGE_FILE_MAPPING)
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd >= 0)
+    {
+        struct stat fileStat = { 0 };
+
+        if (fstat(fd, &fileStat) == 0)
+        {
+            fileSize = (long long)fileStat.st_size;
+
+            if ((headerSize + size) <= fileSize)
+            {
+                void *mapping = mmap(NULL, (size_t)fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if (mapping != MAP_FAILED)
+                {
+                    data.mapping = mapping;
+                    data.mappingSize = fileSize;
+                }
+                else TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to map file in memory, regions read from file", fileName);
+            }
+        }
+
+        close(fd);  // NOTE: Mapping keeps file referenced until unmapped
+    }
+#endif
+
+    if (data.mapping == NULL)
+    {
+        data.file = fopen(fileName, "rb");
+
+        if ((data.file != NULL) && (fileSize < 0))
+        {
+            if (FSEEK64(data.file, 0, SEEK_END) == 0) fileSize = FTELL64(data.file);
+        }
+    }
+
+    if ((data.mapping == NULL) && (data.file == NULL))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: [%s] Failed to open raw image file", fileName);
+        return image;
+    }
+
+    if ((headerSize + size) > fileSize)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: [%s] Raw image file is smaller than expected image data (%lli bytes)", fileName, headerSize + size);
+        UnloadImageMappedData(&data);
+        return image;
+    }
+
+    int slot = 0;
+    for (; slot < imagesMapped.capacity; slot++) if ((imagesMapped.images[slot].mapping == NULL) && (imagesMapped.images[slot].file == NULL)) break;
+
+    if (slot == imagesMapped.capacity)
+    {
+        int capacity = (imagesMapped.capacity == 0)? 8 : imagesMapped.capacity*2;
+        ImageMappedData *images = (ImageMappedData *)RL_REALLOC(imagesMapped.images, capacity*sizeof(ImageMappedData));
+
+        if (images == NULL)
+        {
+            UnloadImageMappedData(&data);
+            return image;
+        }
+
+        memset(images + imagesMapped.capacity, 0, (capacity - imagesMapped.capacity)*sizeof(ImageMappedData));
+        imagesMapped.images = images;
+        imagesMapped.capacity = capacity;
+    }
+
+    imagesMapped.images[slot] = data;
+
+    image.id = slot + 1;
+    image.data = (data.mapping != NULL)? (const unsigned char *)data.mapping + headerSize : NULL;
+    image.width = width;
+    image.height = height;
+    image.format = format;
+
+    TRACELOG(LOG_INFO, "IMAGE: [%s] Raw image %s successfully (%ix%i | %lli bytes)", fileName, (data.mapping != NULL)? "mapped" : "opened", width, height, size);
+
+    return image;
+}
+
+// Check if a mapped image is valid (loaded)
+bool rl_IsImageMappedValid(rl_ImageMapped image)
+{
+    return (GetImageMappedData(image) != NULL);
+}
+
+// Unload mapped image, file mapping is released
+void rl_UnloadImageMapped(rl_ImageMapped image)
+{
+    ImageMappedData *data = GetImageMappedData(image);
+
+    if (data != NULL) UnloadImageMappedData(data);
+}
+
+// Load image from mapped image region (region copied, clipped to image bounds)
+rl_Image rl_ImageFromMapped(rl_ImageMapped image, rl_Rectangle rec)
+{
+    rl_Image result = { 0 };
+    ImageMappedData *data = GetImageMappedData(image);
+    int x, y, width, height;
+
+    if ((data == NULL) || !GetImageMappedRegion(data, rec, &x, &y, &width, &height)) return result;
+
+    result.data = RL_MALLOC(rl_GetPixelDataSize(width, height, data->format));
+
+    if ((result.data != NULL) && ReadImageMappedRegion(data, x, y, width, height, (unsigned char *)result.data))
+    {
+        result.width = width;
+        result.height = height;
+        result.mipmaps = 1;
+        result.format = data->format;
+    }
+    else
+    {
+        RL_FREE(result.data);
+        result.data = NULL;
+    }
+
+    return result;
+}
+
+// Load texture from mapped image region (clipped to image bounds)
+rl_Texture2D rl_LoadTextureMapped(rl_ImageMapped image, rl_Rectangle rec)
+{
+    rl_Texture2D texture = { 0 };
+    ImageMappedData *data = GetImageMappedData(image);
+    int x, y, width, height;
+
+    if ((data == NULL) || !GetImageMappedRegion(data, rec, &x, &y, &width, &height)) return texture;
+
+    const unsigned char *pixels = GetImageMappedRows(data, x, y, width);
+    unsigned char *region = NULL;
+
+    if (pixels == NULL)
+    {
+        region = (unsigned char *)RL_MALLOC(rl_GetPixelDataSize(width, height, data->format));
+        if ((region == NULL) || !ReadImageMappedRegion(data, x, y, width, height, region))
+        {
+            RL_FREE(region);
+            return texture;
+        }
+
+        pixels = region;
+    }
+
+    texture.id = rlLoadTexture(pixels, width, height, data->format, 1);
+
+    if (texture.id > 0)
+    {
+        texture.width = width;
+        texture.height = height;
+        texture.mipmaps = 1;
+        texture.format = data->format;
+    }
+
+    RL_FREE(region);
+
+    return texture;
+}
+
+// Update texture area at position with mapped image region, texture format must match image format
+// NOTE: Full width regions of mapped images are uploaded from mapped data directly
+void rl_UpdateTextureMapped(rl_Texture2D texture, rl_ImageMapped image, rl_Rectangle source, rl_Vector2 position)
+{
+    ImageMappedData *data = GetImageMappedData(image);
+    int x, y, width, height;
+
+    if ((data == NULL) || (texture.id == 0)) return;
+
+    if (texture.format != data->format)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to update texture, mapped image format does not match", texture.id);
+        return;
+    }
+
+    if (!GetImageMappedRegion(data, source, &x, &y, &width, &height)) return;
+
+    // Region is clipped to texture bounds
+    int offsetX = (int)position.x;
+    int offsetY = (int)position.y;
+    if ((offsetX < 0) || (offsetY < 0) || (offsetX >= texture.width) || (offsetY >= texture.height)) return;
+    if ((offsetX + width) > texture.width) width = texture.width - offsetX;
+    if ((offsetY + height) > texture.height) height = texture.height - offsetY;
+
+    const unsigned char *pixels = GetImageMappedRows(data, x, y, width);
+
+    if (pixels != NULL) rlUpdateTexture(texture.id, offsetX, offsetY, width, height, texture.format, pixels);
+    else
+    {
+        unsigned char *region = (unsigned char *)RL_MALLOC(rl_GetPixelDataSize(width, height, data->format));
+
+        if ((region != NULL) && ReadImageMappedRegion(data, x, y, width, height, region))
+        {
+            rlUpdateTexture(texture.id, offsetX, offsetY, width, height, texture.format, region);
+        }
+
+        RL_FREE(region);
+    }
+}
+
 // Load animated image data
 //  - rl_Image.data buffer includes all frames: [image#0][image#1][image#2][...]
 //  - Number of frames is returned through 'frames' parameter
@@ -557,6 +1835,67 @@ rl_Image rl_LoadImageFromMemory(const char *fileType, const unsigned char *fileD
     return image;
 }
 
+// Load images from files, decoding them in parallel on worker threads
+// NOTE: Images failing to load are returned empty (data is NULL), unload array with rl_UnloadImages()
+rl_Image *rl_LoadImages(const char **fileNames, int count)
+{
+    if ((fileNames == NULL) || (count <= 0)) return NULL;
+
+    rl_Image *images = (rl_Image *)RL_CALLOC(count, sizeof(rl_Image));
+
+    if (images != NULL)
+    {
+        ImageBatchJob batch = { fileNames, images };
+        WorkerJob job = { ProcessImageBatchRange, &batch, count, 1 };
+        RunWorkerJob(&job);
+
+        int loadedCount = 0;
+        for (int i = 0; i < count; i++) if (images[i].data != NULL) loadedCount++;
+
+        TRACELOG(LOG_INFO, "IMAGE: Batch loaded successfully (%i/%i images)", loadedCount, count);
+    }
+
+    return images;
+}
+
+// Unload images loaded with rl_LoadImages()
+void rl_UnloadImages(rl_Image *images, int count)
+{
+    if (images != NULL)
+    {
+        for (int i = 0; i < count; i++) rl_UnloadImage(images[i]);
+
+        RL_FREE(images);
+    }
+}
+
+// Set decoded images cache size in bytes, least recently used images over size are released (0: cache disabled)
+// NOTE: Images loaded with rl_LoadImage() are cached by file path and modification time
+void rl_SetImageCacheSize(long long bytes)
+{
+    LockImageCache();
+
+    imageCache.maxSize = (bytes > 0)? bytes : 0;
+    while ((imageCache.size > imageCache.maxSize) && RemoveImageCacheEntry(-1));
+
+    UnlockImageCache();
+}
+
+// Clear decoded images cache, releasing all cached images
+void rl_ClearImageCache(void)
+{
+    LockImageCache();
+
+    for (int i = 0; i < imageCache.capacity; i++) if (imageCache.entries[i].fileName != NULL) RemoveImageCacheEntry(i);
+
+    RL_FREE(imageCache.entries);
+    imageCache.entries = NULL;
+    imageCache.capacity = 0;
+    imageCache.size = 0;
+
+    UnlockImageCache();
+}
+
 // Load image from GPU texture data
 // NOTE: Compressed texture formats not supported
 rl_Image rl_LoadImageFromTexture(rl_Texture2D texture)
@@ -603,15 +1942,45 @@ rl_Image rl_LoadImageFromScreen(void)
     return image;
 }
 
-// Check if an image is ready
-bool rl_IsImageValid(rl_Image image)
+// Async screen capture request data
+typedef struct ScreenCaptureRequest {
+    ScreenCaptureCallback callback;     // User callback
+    void *userData;                     // User callback data
+} ScreenCaptureRequest;
+
+// Deliver async screen readback to user callback
+static void ScreenCaptureReadback(unsigned char *data, int width, int height, void *userData)
 {
-    bool result = false;
+    ScreenCaptureRequest *request = (ScreenCaptureRequest *)userData;
+    rl_Image image = { data, width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-    if ((image.data != NULL) &&     // Validate pixel data available
-        (image.width > 0) &&        // Validate image width
-        (image.height > 0) &&       // Validate image height
-        (image.format > 0) &&       // Validate image format
+    request->callback(image, request->userData);
+    RL_FREE(request);
+}
+
+// Load image from screen buffer asynchronously
+// NOTE: Screen is read into a pixel buffer without stalling the pipeline and delivered
+// to callback once available, image data is only valid during callback (copy it if required)
+void rl_LoadImageFromScreenAsync(ScreenCaptureCallback callback, void *userData)
+{
+    if (callback == NULL) return;
+
+    ScreenCaptureRequest *request = (ScreenCaptureRequest *)RL_MALLOC(sizeof(ScreenCaptureRequest));
+    request->callback = callback;
+    request->userData = userData;
+
+    rlReadScreenPixelsAsync(rl_GetRenderWidth(), rl_GetRenderHeight(), ScreenCaptureReadback, request);
+}
+
+// Check if an image is ready
+bool rl_IsImageValid(rl_Image image)
+{
+    bool result = false;
+
+    if ((image.data != NULL) &&     // Validate pixel data available
+        (image.width > 0) &&        // Validate image width
+        (image.height > 0) &&       // Validate image height
+        (image.format > 0) &&       // Validate image format
         (image.mipmaps > 0)) result = true; // Validate image mipmaps (at least 1 for basic mipmap level)
 
     return result;
@@ -641,9 +2010,10 @@ bool rl_ExportImage(rl_Image image, const char *fileName)
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
     else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-    else
+    else if (!rl_IsFileExtension(fileName, ".raw;.ktx"))
     {
         // NOTE: Getting rl_Color array as RGBA unsigned char values
+        // Raw and KTX data is exported as is, no conversion required
         imgData = (unsigned char *)rl_LoadImageColors(image);
         allocatedData = true;
     }
@@ -653,8 +2023,8 @@ bool rl_ExportImage(rl_Image image, const char *fileName)
     else if (rl_IsFileExtension(fileName, ".png"))
     {
         int dataSize = 0;
-        unsigned char *fileData = stbi_write_png_to_mem((const unsigned char *)imgData, image.width*channels, image.width, image.height, channels, &dataSize);
-        result = rl_SaveFileData(fileName, fileData, dataSize);
+        unsigned char *fileData = EncodeImagePNG(imgData, image.width, image.height, channels, &dataSize);
+        if (fileData != NULL) result = rl_SaveFileData(fileName, fileData, dataSize);
         RL_FREE(fileData);
     }
 #endif
@@ -671,21 +2041,24 @@ bool rl_ExportImage(rl_Image image, const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_QOI)
     else if (rl_IsFileExtension(fileName, ".qoi"))
     {
-        channels = 0;
-        if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
-        else if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
-        else TRACELOG(LOG_WARNING, "IMAGE: rl_Image pixel format must be R8G8B8 or R8G8B8A8");
-
-        if ((channels == 3) || (channels == 4))
+        if (channels < 3)
         {
-            qoi_desc desc = { 0 };
-            desc.width = image.width;
-            desc.height = image.height;
-            desc.channels = channels;
-            desc.colorspace = QOI_SRGB;
-
-            result = qoi_write(fileName, imgData, &desc);
+            // NOTE: QOI only supports RGB and RGBA pixels, grayscale images are exported as RGBA
+            imgData = (unsigned char *)rl_LoadImageColors(image);
+            allocatedData = true;
+            channels = 4;
         }
+
+        qoi_desc desc = { 0 };
+        desc.width = image.width;
+        desc.height = image.height;
+        desc.channels = channels;
+        desc.colorspace = QOI_SRGB;
+
+        int dataSize = 0;
+        unsigned char *fileData = (unsigned char *)qoi_encode(imgData, &desc, &dataSize);
+        if (fileData != NULL) result = rl_SaveFileData(fileName, fileData, dataSize);
+        RL_FREE(fileData);
     }
 #endif
 #if defined(SUPPORT_FILEFORMAT_KTX)
@@ -731,15 +2104,108 @@ unsigned char *rl_ExportImageToMemory(rl_Image image, const char *fileType, int
 #if defined(SUPPORT_FILEFORMAT_PNG)
     if ((strcmp(fileType, ".png") == 0) || (strcmp(fileType, ".PNG") == 0))
     {
-        fileData = stbi_write_png_to_mem((const unsigned char *)image.data, image.width*channels, image.width, image.height, channels, dataSize);
+        fileData = EncodeImagePNG((const unsigned char *)image.data, image.width, image.height, channels, dataSize);
     }
 #endif
+#if defined(SUPPORT_FILEFORMAT_QOI)
+    if (((strcmp(fileType, ".qoi") == 0) || (strcmp(fileType, ".QOI") == 0)) && (channels >= 3))
+    {
+        qoi_desc desc = { 0 };
+        desc.width = image.width;
+        desc.height = image.height;
+        desc.channels = channels;
+        desc.colorspace = QOI_SRGB;
+
+        fileData = (unsigned char *)qoi_encode(image.data, &desc, dataSize);
+    }
+#endif
+    if ((strcmp(fileType, ".raw") == 0) || (strcmp(fileType, ".RAW") == 0))
+    {
+        // Export raw pixel data (without header)
+        *dataSize = rl_GetPixelDataSize(image.width, image.height, image.format);
+        fileData = (unsigned char *)RL_MALLOC(*dataSize);
+        memcpy(fileData, image.data, *dataSize);
+    }
 
 #endif
 
     return fileData;
 }
 
+// Export image data to file on a background thread, returns true if export was queued
+// NOTE: rl_Image data is copied, export result is logged once file is saved,
+// use rl_WaitImageExports() to make sure queued images have been exported
+bool rl_ExportImageAsync(rl_Image image, const char *fileName)
+{
+    // Security check for input data
+    if ((image.width == 0) || (image.height == 0) || (image.data == NULL)) return false;
+
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    ImageExportRequest *request = (ImageExportRequest *)RL_CALLOC(1, sizeof(ImageExportRequest));
+    request->image = rl_ImageCopy(image);
+    request->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(request->fileName, fileName);
+
+    pthread_mutex_lock(&imageExportsLock);
+
+    if (!imageExports.ready)
+    {
+        if (pthread_create(&imageExports.thread, NULL, ImageExportThreadLoop, NULL) == 0) imageExports.ready = true;
+        else TRACELOG(LOG_WARNING, "IMAGE: Failed to create image export thread");
+    }
+
+    if (imageExports.ready && (request->image.data != NULL))
+    {
+        if (imageExports.last != NULL) imageExports.last->next = request;
+        else imageExports.first = request;
+
+        imageExports.last = request;
+        imageExports.pending++;
+        pthread_cond_signal(&imageExportsCond);
+        pthread_mutex_unlock(&imageExportsLock);
+
+        return true;
+    }
+
+    pthread_mutex_unlock(&imageExportsLock);
+
+    // Export thread not available, image is exported on caller thread
+    bool result = rl_ExportImage(image, fileName);
+
+    rl_UnloadImage(request->image);
+    RL_FREE(request->fileName);
+    RL_FREE(request);
+
+    return result;
+#else
+    return rl_ExportImage(image, fileName);
+#endif
+}
+
+// Wait for images queued by rl_ExportImageAsync() to be exported
+void rl_WaitImageExports(void)
+{
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    pthread_mutex_lock(&imageExportsLock);
+    while (imageExports.pending > 0) pthread_cond_wait(&imageExportsDoneCond, &imageExportsLock);
+    pthread_mutex_unlock(&imageExportsLock);
+#endif
+}
+
+// Set PNG export compression level [0..8], lower levels export faster (default: 2)
+// NOTE: Levels above 4 search long match chains, compression ratio improves slightly at a high time cost
+void rl_SetImageExportCompression(int level)
+{
+    if (level < 0) level = 0;
+    if (level > 8) level = 8;
+
+    imageExportCompression = level;
+
+#if defined(SUPPORT_IMAGE_EXPORT)
+    stbi_write_png_compression_level = level;   // Used if compression API is not available
+#endif
+}
+
 // Export image as code file (.h) defining an array of bytes
 bool rl_ExportImageAsCode(rl_Image image, const char *fileName)
 {
@@ -1005,44 +2471,14 @@ rl_Image rl_GenImageWhiteNoise(int width, int height, float factor)
 }
 
 // Generate image: perlin noise
+// NOTE: Rows are generated by worker threads, 4 pixels at once (SIMD)
 rl_Image rl_GenImagePerlinNoise(int width, int height, int offsetX, int offsetY, float scale)
 {
     rl_Color *pixels = (rl_Color *)RL_MALLOC(width*height*sizeof(rl_Color));
 
-    float aspectRatio = (float)width/(float)height;
-
-    for (int y = 0; y < height; y++)
-    {
-        for (int x = 0; x < width; x++)
-        {
-            float nx = (float)(x + offsetX)*(scale/(float)width);
-            float ny = (float)(y + offsetY)*(scale/(float)height);
-
-            // Apply aspect ratio compensation to wider side
-            if (width > height) nx *= aspectRatio;
-            else ny /= aspectRatio;
-
-            // Basic perlin noise implementation (not used)
-            //float p = (stb_perlin_noise3(nx, ny, 0.0f, 0, 0, 0);
-
-            // Calculate a better perlin noise using fbm (fractal brownian motion)
-            // Typical values to start playing with:
-            //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
-            //   gain       =  0.5   -- relative weighting applied to each successive octave
-            //   octaves    =  6     -- number of "octaves" of noise3() to sum
-            float p = stb_perlin_fbm_noise3(nx, ny, 1.0f, 2.0f, 0.5f, 6);
-
-            // Clamp between -1.0f and 1.0f
-            if (p < -1.0f) p = -1.0f;
-            if (p > 1.0f) p = 1.0f;
-
-            // We need to normalize the data from [-1..1] to [0..1]
-            float np = (p + 1.0f)/2.0f;
-
-            unsigned char intensity = (unsigned char)(np*255.0f);
-            pixels[y*width + x] = (rl_Color){ intensity, intensity, intensity, 255 };
-        }
-    }
+    PerlinNoiseJob noise = { pixels, width, height, offsetX, offsetY, scale };
+    WorkerJob job = { ProcessPerlinNoiseRange, &noise, height, IMAGE_FILTER_CHUNK_ROWS };
+    RunWorkerJob(&job);
 
     rl_Image image = {
         .data = pixels,
@@ -1056,6 +2492,7 @@ rl_Image rl_GenImagePerlinNoise(int width, int height, int offsetX, int offsetY,
 }
 
 // Generate image: cellular algorithm. Bigger tileSize means bigger cells
+// NOTE: Rows are generated by worker threads, seeds are generated first (random sequence kept)
 rl_Image rl_GenImageCellular(int width, int height, int tileSize)
 {
     rl_Color *pixels = (rl_Color *)RL_MALLOC(width*height*sizeof(rl_Color));
@@ -1073,40 +2510,9 @@ rl_Image rl_GenImageCellular(int width, int height, int tileSize)
         seeds[i] = (rl_Vector2){ (float)x, (float)y };
     }
 
-    for (int y = 0; y < height; y++)
-    {
-        int tileY = y/tileSize;
-
-        for (int x = 0; x < width; x++)
-        {
-            int tileX = x/tileSize;
-
-            float minDistance = 65536.0f; //(float)strtod("Inf", NULL);
-
-            // Check all adjacent tiles
-            for (int i = -1; i < 2; i++)
-            {
-                if ((tileX + i < 0) || (tileX + i >= seedsPerRow)) continue;
-
-                for (int j = -1; j < 2; j++)
-                {
-                    if ((tileY + j < 0) || (tileY + j >= seedsPerCol)) continue;
-
-                    rl_Vector2 neighborSeed = seeds[(tileY + j)*seedsPerRow + tileX + i];
-
-                    float dist = (float)hypot(x - (int)neighborSeed.x, y - (int)neighborSeed.y);
-                    minDistance = (float)fmin(minDistance, dist);
-                }
-            }
-
-            // This approach seems to give good results at all tile sizes
-            int intensity = (int)(minDistance*256.0f/tileSize);
-            if (intensity > 255) intensity = 255;
-
-            unsigned char intensityUC = (unsigned char)intensity;
-            pixels[y*width + x] = (rl_Color){ intensityUC, intensityUC, intensityUC, 255 };
-        }
-    }
+    CellularJob cellular = { pixels, seeds, width, tileSize, seedsPerRow, seedsPerCol };
+    WorkerJob job = { ProcessCellularRange, &cellular, height, IMAGE_FILTER_CHUNK_ROWS };
+    RunWorkerJob(&job);
 
     RL_FREE(seeds);
 
@@ -1186,22 +2592,8 @@ rl_Image rl_ImageCopy(rl_Image image)
 // Create an image from another image piece
 rl_Image rl_ImageFromImage(rl_Image image, rl_Rectangle rec)
 {
-    rl_Image result = { 0 };
-
-    int bytesPerPixel = rl_GetPixelDataSize(1, 1, image.format);
-
-    result.width = (int)rec.width;
-    result.height = (int)rec.height;
-    result.data = RL_CALLOC((int)rec.width*(int)rec.height*bytesPerPixel, 1);
-    result.format = image.format;
-    result.mipmaps = 1;
-
-    for (int y = 0; y < (int)rec.height; y++)
-    {
-        memcpy(((unsigned char *)result.data) + y*(int)rec.width*bytesPerPixel, ((unsigned char *)image.data) + ((y + (int)rec.y)*image.width + (int)rec.x)*bytesPerPixel, (int)rec.width*bytesPerPixel);
-    }
-
-    return result;
+    // NOTE: Piece is clamped to image, pixels rows are copied from image view
+    return rl_ImageFromView(rl_GetImageView(image, rec));
 }
 
 // Crop an image to area defined by a rectangle
@@ -1228,13 +2620,14 @@ void rl_ImageCrop(rl_Image *image, rl_Rectangle crop)
     {
         int bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
 
-        unsigned char *croppedData = (unsigned char *)RL_MALLOC((int)(crop.width*crop.height)*bytesPerPixel);
+        int rowSize = (int)crop.width*bytesPerPixel;
+        unsigned char *pixels = (unsigned char *)image->data;
 
-        // OPTION 1: Move cropped data line-by-line
-        for (int y = (int)crop.y, offsetSize = 0; y < (int)(crop.y + crop.height); y++)
+        // OPTION 1: Move cropped data line-by-line, in place
+        // NOTE: Rows are moved to lower or same addresses, not overwritten before being moved
+        for (int y = 0; y < (int)crop.height; y++)
         {
-            memcpy(croppedData + offsetSize, ((unsigned char *)image->data) + (y*image->width + (int)crop.x)*bytesPerPixel, (int)crop.width*bytesPerPixel);
-            offsetSize += ((int)crop.width*bytesPerPixel);
+            memmove(pixels + y*rowSize, pixels + ((y + (int)crop.y)*image->width + (int)crop.x)*bytesPerPixel, rowSize);
         }
 
         /*
@@ -1249,13 +2642,148 @@ void rl_ImageCrop(rl_Image *image, rl_Rectangle crop)
         }
         */
 
-        RL_FREE(image->data);
-        image->data = croppedData;
+        // Release memory not required anymore
+        if (((int)crop.height*rowSize) > 0)
+        {
+            void *croppedData = RL_REALLOC(image->data, (int)crop.height*rowSize);
+            if (croppedData != NULL) image->data = croppedData;
+        }
+
         image->width = (int)crop.width;
         image->height = (int)crop.height;
     }
 }
 
+// Get view of image area, pixels are not copied
+// NOTE: View is valid while image data is not reallocated or unloaded, area is clamped to image
+rl_ImageView rl_GetImageView(rl_Image image, rl_Rectangle rec)
+{
+    rl_ImageView view = { 0 };
+
+    // Security check to avoid program crash
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0)) return view;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: rl_Image views not supported for compressed formats");
+        return view;
+    }
+
+    view.data = image.data;
+    view.width = image.width;
+    view.height = image.height;
+    view.stride = image.width*rl_GetPixelDataSize(1, 1, image.format);
+    view.format = image.format;
+
+    return GetImageViewArea(view, rec);
+}
+
+// Load image view sharing reference-counted storage, image data ownership is taken
+// NOTE: Image must not be unloaded, its pixels are released with the last view unloaded (base level is viewed)
+rl_ImageView rl_LoadImageView(rl_Image image)
+{
+    rl_ImageView view = rl_GetImageView(image, (rl_Rectangle){ 0, 0, (float)image.width, (float)image.height });
+
+    if (view.data != NULL)
+    {
+        ImageViewStorage *storage = (ImageViewStorage *)RL_MALLOC(sizeof(ImageViewStorage));
+        storage->data = image.data;
+        storage->refCount = 1;
+
+        view.storage = storage;
+    }
+
+    return view;
+}
+
+// Get view of view area, pixels are not copied
+// NOTE: Views of shared views add a storage reference, they must be unloaded with rl_UnloadImageView()
+rl_ImageView rl_GetImageSubView(rl_ImageView view, rl_Rectangle rec)
+{
+    if (!rl_IsImageViewValid(view)) return (rl_ImageView){ 0 };
+
+    rl_ImageView area = GetImageViewArea(view, rec);
+
+    if ((area.data != NULL) && (area.storage != NULL))
+    {
+        ImageViewStorage *storage = (ImageViewStorage *)area.storage;
+
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+        pthread_mutex_lock(&imageViewsLock);
+#endif
+        storage->refCount++;
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+        pthread_mutex_unlock(&imageViewsLock);
+#endif
+    }
+
+    return area;
+}
+
+// Unload image view, shared storage pixels are released with last view referencing them
+// NOTE: Views not sharing storage do not require unloading (no-op)
+void rl_UnloadImageView(rl_ImageView view)
+{
+    if (view.storage == NULL) return;
+
+    ImageViewStorage *storage = (ImageViewStorage *)view.storage;
+    bool release = false;
+
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    pthread_mutex_lock(&imageViewsLock);
+#endif
+    storage->refCount--;
+    release = (storage->refCount == 0);
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    pthread_mutex_unlock(&imageViewsLock);
+#endif
+
+    if (release)
+    {
+        RL_FREE(storage->data);
+        RL_FREE(storage);
+    }
+}
+
+// Check if an image view is valid
+bool rl_IsImageViewValid(rl_ImageView view)
+{
+    bool result = false;
+
+    if ((view.data != NULL) &&      // Validate pixel data available
+        (view.width > 0) &&         // Validate view width
+        (view.height > 0) &&        // Validate view height
+        (view.format > 0) &&        // Validate view format
+        (view.format < PIXELFORMAT_COMPRESSED_DXT1_RGB) &&  // Validate uncompressed format
+        (view.stride >= view.width*rl_GetPixelDataSize(1, 1, view.format))) result = true; // Validate rows stride
+
+    return result;
+}
+
+// Create an image from view pixels (copied)
+rl_Image rl_ImageFromView(rl_ImageView view)
+{
+    rl_Image image = { 0 };
+
+    if (!rl_IsImageViewValid(view)) return image;
+
+    int rowSize = view.width*rl_GetPixelDataSize(1, 1, view.format);
+
+    image.data = RL_MALLOC(view.height*rowSize);
+
+    if (image.data != NULL)
+    {
+        for (int y = 0; y < view.height; y++) memcpy((unsigned char *)image.data + y*rowSize, (unsigned char *)view.data + y*view.stride, rowSize);
+
+        image.width = view.width;
+        image.height = view.height;
+        image.mipmaps = 1;
+        image.format = view.format;
+    }
+
+    return image;
+}
+
 // Convert image data to desired format
 void rl_ImageFormat(rl_Image *image, int newFormat)
 {
@@ -1266,190 +2794,205 @@ void rl_ImageFormat(rl_Image *image, int newFormat)
     {
         if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
-            rl_Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+            // Direct conversion for formats pairs not requiring normalized float intermediate
+            void *data = RL_MALLOC(rl_GetPixelDataSize(image->width, image->height, newFormat));
 
-            RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
-            image->data = NULL;
-            image->format = newFormat;
-
-            switch (image->format)
+            if (ConvertPixelData(image->data, image->format, data, newFormat, image->width*image->height))
             {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+                image->data = data;
+                image->format = newFormat;
+            }
+            else
+            {
+                RL_FREE(data);
+
+                MemoryFrameMark mark = GetMemoryFrameMark();
+                rl_Vector4 *pixels = LoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
+
+                RL_FREE(image->data);      // WARNING! We loose mipmaps data --> Regenerated at the end...
+                image->data = NULL;
+                image->format = newFormat;
+
+                switch (image->format)
                 {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+                    case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                    {
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*sizeof(unsigned char));
+
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f)*255.0f);
-                    }
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*2*sizeof(unsigned char));
+                        for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
+                        }
 
-                    for (int i = 0, k = 0; i < image->width*image->height*2; i += 2, k++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)((pixels[k].x*0.299f + (float)pixels[k].y*0.587f + (float)pixels[k].z*0.114f)*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].w*255.0f);
-                    }
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*31.0f));
+                            g = (unsigned char)(round(pixels[i].y*63.0f));
+                            b = (unsigned char)(round(pixels[i].z*31.0f));
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
                     {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*63.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
-                    }
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                            ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                    {
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned char));
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+                        unsigned char a = 0;
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*31.0f));
+                            g = (unsigned char)(round(pixels[i].y*31.0f));
+                            b = (unsigned char)(round(pixels[i].z*31.0f));
+                            a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
                     {
-                        r = (unsigned char)(round(pixels[i].x*31.0f));
-                        g = (unsigned char)(round(pixels[i].y*31.0f));
-                        b = (unsigned char)(round(pixels[i].z*31.0f));
-                        a = (pixels[i].w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
-                    }
+                        unsigned char r = 0;
+                        unsigned char g = 0;
+                        unsigned char b = 0;
+                        unsigned char a = 0;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            r = (unsigned char)(round(pixels[i].x*15.0f));
+                            g = (unsigned char)(round(pixels[i].y*15.0f));
+                            b = (unsigned char)(round(pixels[i].z*15.0f));
+                            a = (unsigned char)(round(pixels[i].w*15.0f));
 
-                    unsigned char r = 0;
-                    unsigned char g = 0;
-                    unsigned char b = 0;
-                    unsigned char a = 0;
+                            ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+                        }
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
                     {
-                        r = (unsigned char)(round(pixels[i].x*15.0f));
-                        g = (unsigned char)(round(pixels[i].y*15.0f));
-                        b = (unsigned char)(round(pixels[i].z*15.0f));
-                        a = (unsigned char)(round(pixels[i].w*15.0f));
+                        image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
 
-                        ((unsigned short *)image->data)[i] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
-                    }
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
+                            ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
+                            ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
+                            ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32:
+                    {
+                        // WARNING: rl_Image is converted to GRAYSCALE equivalent 32bit
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    image->data = (unsigned char *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned char));
+                        image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
                     {
-                        ((unsigned char *)image->data)[i] = (unsigned char)(pixels[k].x*255.0f);
-                        ((unsigned char *)image->data)[i + 1] = (unsigned char)(pixels[k].y*255.0f);
-                        ((unsigned char *)image->data)[i + 2] = (unsigned char)(pixels[k].z*255.0f);
-                        ((unsigned char *)image->data)[i + 3] = (unsigned char)(pixels[k].w*255.0f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    // WARNING: rl_Image is converted to GRAYSCALE equivalent 32bit
+                        image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
 
-                    image->data = (float *)RL_MALLOC(image->width*image->height*sizeof(float));
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((float *)image->data)[i] = pixels[k].x;
+                            ((float *)image->data)[i + 1] = pixels[k].y;
+                            ((float *)image->data)[i + 2] = pixels[k].z;
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                    {
+                        image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
 
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((float *)image->data)[i] = pixels[k].x;
+                            ((float *)image->data)[i + 1] = pixels[k].y;
+                            ((float *)image->data)[i + 2] = pixels[k].z;
+                            ((float *)image->data)[i + 3] = pixels[k].w;
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16:
                     {
-                        ((float *)image->data)[i] = (float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*3*sizeof(float));
+                        // WARNING: rl_Image is converted to GRAYSCALE equivalent 16bit
+
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        for (int i = 0; i < image->width*image->height; i++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
                     {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    image->data = (float *)RL_MALLOC(image->width*image->height*4*sizeof(float));
-
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((float *)image->data)[i] = pixels[k].x;
-                        ((float *)image->data)[i + 1] = pixels[k].y;
-                        ((float *)image->data)[i + 2] = pixels[k].z;
-                        ((float *)image->data)[i + 3] = pixels[k].w;
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
-                {
-                    // WARNING: rl_Image is converted to GRAYSCALE equivalent 16bit
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
 
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
-
-                    for (int i = 0; i < image->width*image->height; i++)
+                        for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
+                            ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
+                            ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
+                        }
+                    } break;
+                    case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
                     {
-                        ((unsigned short *)image->data)[i] = FloatToHalf((float)(pixels[i].x*0.299f + pixels[i].y*0.587f + pixels[i].z*0.114f));
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*3*sizeof(unsigned short));
+                        image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
 
-                    for (int i = 0, k = 0; i < image->width*image->height*3; i += 3, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                    }
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-                {
-                    image->data = (unsigned short *)RL_MALLOC(image->width*image->height*4*sizeof(unsigned short));
+                        for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
+                        {
+                            ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
+                            ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
+                            ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
+                            ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
+                        }
+                    } break;
+                    default: break;
+                }
 
-                    for (int i = 0, k = 0; i < image->width*image->height*4; i += 4, k++)
-                    {
-                        ((unsigned short *)image->data)[i] = FloatToHalf(pixels[k].x);
-                        ((unsigned short *)image->data)[i + 1] = FloatToHalf(pixels[k].y);
-                        ((unsigned short *)image->data)[i + 2] = FloatToHalf(pixels[k].z);
-                        ((unsigned short *)image->data)[i + 3] = FloatToHalf(pixels[k].w);
-                    }
-                } break;
-                default: break;
+                ReleaseMemoryFrame(mark);
+                pixels = NULL;
             }
 
-            RL_FREE(pixels);
-            pixels = NULL;
-
             // In case original image had mipmaps, generate mipmaps for formatted image
             // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
             if (image->mipmaps > 1)
@@ -1464,6 +3007,103 @@ void rl_ImageFormat(rl_Image *image, int newFormat)
     }
 }
 
+// Compress image data to GPU compressed pixel format
+// NOTE: Supported formats: DXT1 (BC1), DXT3 (BC2), DXT5 (BC3), ETC1, ETC2, ETC2_EAC, BC7 and BC4 (red channel),
+// image is converted to RGBA8 first, mipmaps levels are compressed and blocks processed over worker threads
+void rl_ImageCompress(rl_Image *image, int format)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
+    if (image->format == format) return;
+
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Compressed data formats can not be compressed again");
+        return;
+    }
+
+    switch (format)
+    {
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        case PIXELFORMAT_COMPRESSED_BC7_RGBA:
+        case PIXELFORMAT_COMPRESSED_BC4_R: break;
+        default:
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Compression not supported for pixel format (%i)", format);
+            return;
+        }
+    }
+
+    // Compressed levels are computed from RGBA8 levels
+    rl_Image source = rl_ImageCopy(*image);
+    rl_ImageFormat(&source, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+
+    int size = 0;
+    int width = source.width;
+    int height = source.height;
+
+    for (int i = 0; i < source.mipmaps; i++)
+    {
+        size += rl_GetPixelDataSize(width, height, format);
+
+        width /= 2;
+        height /= 2;
+
+        // Security check for NPOT textures
+        if (width < 1) width = 1;
+        if (height < 1) height = 1;
+    }
+
+    unsigned char *data = (unsigned char *)RL_CALLOC(size, 1);
+
+    if (data != NULL)
+    {
+        CompressionJob compression = { 0 };
+        compression.format = format;
+        compression.blockSize = ((format == PIXELFORMAT_COMPRESSED_DXT1_RGB) || (format == PIXELFORMAT_COMPRESSED_DXT1_RGBA) ||
+            (format == PIXELFORMAT_COMPRESSED_ETC1_RGB) || (format == PIXELFORMAT_COMPRESSED_ETC2_RGB) ||
+            (format == PIXELFORMAT_COMPRESSED_BC4_R))? 8 : 16;
+
+        const unsigned char *pixels = (const unsigned char *)source.data;
+        unsigned char *dst = data;
+        width = source.width;
+        height = source.height;
+
+        for (int i = 0; i < source.mipmaps; i++)
+        {
+            compression.pixels = (const rl_Color *)pixels;
+            compression.width = width;
+            compression.height = height;
+            compression.dst = dst;
+
+            WorkerJob job = { ProcessCompressionRange, &compression, (height + 3)/4, IMAGE_COMPRESSION_CHUNK_ROWS };
+            RunWorkerJob(&job);
+
+            pixels += rl_GetPixelDataSize(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            dst += rl_GetPixelDataSize(width, height, format);
+
+            width /= 2;
+            height /= 2;
+
+            if (width < 1) width = 1;
+            if (height < 1) height = 1;
+        }
+
+        RL_FREE(image->data);
+        image->data = data;
+        image->format = format;
+    }
+
+    rl_UnloadImage(source);
+}
+
 // Create an image from text (default font)
 rl_Image rl_ImageText(const char *text, int fontSize, rl_Color color)
 {
@@ -1760,53 +3400,47 @@ void rl_ImageResizeNN(rl_Image *image, int newWidth, int newHeight)
 // STBIR_DEFAULT_FILTER_DOWNSAMPLE  STBIR_FILTER_MITCHELL   (high-quality Catmull-Rom)
 void rl_ImageResize(rl_Image *image, int newWidth, int newHeight)
 {
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    // Check if we can use a fast path on image scaling
-    // It can be for 8 bit per channel images with 1 to 4 channels per pixel
-    if ((image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
-        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
-    {
-        int bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
-        unsigned char *output = (unsigned char *)RL_MALLOC(newWidth*newHeight*bytesPerPixel);
+    rl_ImageResizeEx(image, newWidth, newHeight, 0);
+}
 
-        switch (image->format)
-        {
-            case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)1); break;
-            case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)2); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)3); break;
-            case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: stbir_resize_uint8_linear((unsigned char *)image->data, image->width, image->height, 0, output, newWidth, newHeight, 0, (stbir_pixel_layout)4); break;
-            default: break;
-        }
+// Resize and image to new size, output rows split between threads (0: worker threads count)
+// NOTE: 8 bit (1 to 4 channels), 16 bit half float and 32 bit float formats are resized directly,
+// other formats are resized as RGBA8 and reformatted to original format
+void rl_ImageResizeEx(rl_Image *image, int newWidth, int newHeight, int threadCount)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || (newWidth <= 0) || (newHeight <= 0)) return;
 
-        RL_FREE(image->data);
-        image->data = output;
-        image->width = newWidth;
-        image->height = newHeight;
-    }
-    else
+    if (!IsPixelFormatResizable(image->format))
     {
         // Get data as rl_Color pixels array to work with it
         rl_Color *pixels = rl_LoadImageColors(*image);
-        rl_Color *output = (rl_Color *)RL_MALLOC(newWidth*newHeight*sizeof(rl_Color));
-
-        // NOTE: rl_Color data is cast to (unsigned char *), there shouldn't been any problem...
-        stbir_resize_uint8_linear((unsigned char *)pixels, image->width, image->height, 0, (unsigned char *)output, newWidth, newHeight, 0, (stbir_pixel_layout)4);
-
         int format = image->format;
 
-        rl_UnloadImageColors(pixels);
         RL_FREE(image->data);
 
-        image->data = output;
-        image->width = newWidth;
-        image->height = newHeight;
+        image->data = pixels;
         image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
+        rl_ImageResizeEx(image, newWidth, newHeight, threadCount);
         rl_ImageFormat(image, format);  // Reformat 32bit RGBA image to original format
+        return;
+    }
+
+    int bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
+    void *output = RL_MALLOC(newWidth*newHeight*bytesPerPixel);
+
+    if (ResizeImageData(image->data, image->width, image->height, 0, output, newWidth, newHeight, image->format, threadCount))
+    {
+        RL_FREE(image->data);
+        image->data = output;
+        image->width = newWidth;
+        image->height = newHeight;
+    }
+    else
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to resize image");
+        RL_FREE(output);
     }
 }
 
@@ -2120,94 +3754,32 @@ void rl_ImageBlurGaussian(rl_Image *image, int blurSize)
     }
 
     // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
+    // NOTE: Passes are split in row and column bands processed by worker threads
+    BlurPassJob pass = { 0 };
+    pass.width = image->width;
+    pass.height = image->height;
+    pass.blurSize = blurSize;
+
+    WorkerJob workerJob = { 0 };
+    workerJob.data = &pass;
+
     for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
     {
         // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
-
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
-
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-        }
-
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
-
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
+        pass.src = pixelsCopy1;
+        pass.dst = pixelsCopy2;
+        workerJob.process = ProcessBlurRowsRange;
+        workerJob.count = image->height;
+        workerJob.chunkSize = IMAGE_FILTER_CHUNK_ROWS;
+        RunWorkerJob(&workerJob);
+
+        // Vertical motion blur, results are truncated to integer values
+        pass.src = pixelsCopy2;
+        pass.dst = pixelsCopy1;
+        workerJob.process = ProcessBlurColumnsRange;
+        workerJob.count = image->width;
+        workerJob.chunkSize = IMAGE_FILTER_CHUNK_COLUMNS;
+        RunWorkerJob(&workerJob);
     }
 
     // Reverse premultiply
@@ -2242,7 +3814,8 @@ void rl_ImageBlurGaussian(rl_Image *image, int blurSize)
 }
 
 // Apply custom square convolution kernel to image
-// NOTE: The convolution kernel matrix is expected to be square
+// NOTE 1: The convolution kernel matrix is expected to be square
+// NOTE 2: Separable kernels (over 3x3) are applied as horizontal and vertical passes
 void rl_ImageKernelConvolution(rl_Image *image, const float *kernel, int kernelSize)
 {
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || kernel == NULL) return;
@@ -2257,114 +3830,69 @@ void rl_ImageKernelConvolution(rl_Image *image, const float *kernel, int kernelS
 
     rl_Color *pixels = rl_LoadImageColors(*image);
 
-    rl_Vector4 *imageCopy2 = (rl_Vector4 *)RL_MALLOC((image->height)*(image->width)*sizeof(rl_Vector4));
-    rl_Vector4 *temp = (rl_Vector4 *)RL_MALLOC(kernelSize*sizeof(rl_Vector4));
-
-    for (int i = 0; i < kernelSize; i++)
-    {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
-
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
+    int width = image->width;
+    int height = image->height;
+    int radius = kernelWidth/2;
 
-    int startRange = 0, endRange = 0;
+    // Normalized pixels surrounded by zero padding, samples out of image pixel data are zero
+    // NOTE: Pixels are indexed linearly, horizontal samples out of a row are read from previous or next row
+    int padding = width*radius + radius;
+    rl_Vector4 *paddedPixels = (rl_Vector4 *)RL_CALLOC(width*height + 2*padding, sizeof(rl_Vector4));
+    rl_Vector4 *imagePixels = paddedPixels + padding;
 
-    if (kernelWidth%2 == 0)
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2;
-    }
-    else
+    for (int i = 0; i < (width*height); i++)
     {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2 + 1;
+        imagePixels[i].x = (float)pixels[i].r/255.0f;
+        imagePixels[i].y = (float)pixels[i].g/255.0f;
+        imagePixels[i].z = (float)pixels[i].b/255.0f;
+        imagePixels[i].w = (float)pixels[i].a/255.0f;
     }
 
-    for (int x = 0; x < image->height; x++)
-    {
-        for (int y = 0; y < image->width; y++)
-        {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
-
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
-
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
-
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
+    float *weights = (float *)RL_MALLOC(2*kernelWidth*sizeof(float));
 
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
+    ConvolutionJob convolution = { 0 };
+    convolution.src = imagePixels;
+    convolution.colors = pixels;
+    convolution.kernelWidth = kernelWidth;
+    convolution.width = width;
 
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
+    WorkerJob workerJob = { 0 };
+    workerJob.data = &convolution;
+    workerJob.chunkSize = IMAGE_FILTER_CHUNK_ROWS;
 
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
-        }
+    if ((kernelWidth > 3) && IsKernelSeparable(kernel, kernelWidth, weights, weights + kernelWidth))
+    {
+        // Horizontal pass includes padding rows, they are sampled by the vertical pass
+        rl_Vector4 *passPixels = (rl_Vector4 *)RL_MALLOC(width*(height + 2*radius)*sizeof(rl_Vector4));
+
+        convolution.dst = passPixels;
+        convolution.kernel = weights + kernelWidth;
+        convolution.firstRow = -radius;
+        workerJob.process = ProcessConvolutionRowsRange;
+        workerJob.count = height + 2*radius;
+        RunWorkerJob(&workerJob);
+
+        convolution.src = passPixels + width*radius;
+        convolution.kernel = weights;
+        convolution.firstRow = 0;
+        workerJob.process = ProcessConvolutionColumnsRange;
+        workerJob.count = height;
+        RunWorkerJob(&workerJob);
+
+        RL_FREE(passPixels);
     }
-
-    for (int i = 0; i < (image->width*image->height); i++)
+    else
     {
-        float alpha = (float)imageCopy2[i].w;
-
-        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
-        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
-        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
-        pixels[i].a = (unsigned char)((alpha)*255.0f);
+        convolution.kernel = kernel;
+        workerJob.process = ProcessConvolutionRange;
+        workerJob.count = height;
+        RunWorkerJob(&workerJob);
     }
 
     int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(imageCopy2);
-    RL_FREE(temp);
+    RL_FREE(paddedPixels);
+    RL_FREE(weights);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
@@ -2375,7 +3903,17 @@ void rl_ImageKernelConvolution(rl_Image *image, const float *kernel, int kernelS
 // NOTE 1: Supports POT and NPOT images
 // NOTE 2: image.data is scaled to include mipmap levels
 // NOTE 3: Mipmaps format is the same as base image
+// NOTE 4: Levels are generated with a 2x2 box filter, use rl_ImageMipmapsEx() for other filters
 void rl_ImageMipmaps(rl_Image *image)
+{
+    rl_ImageMipmapsEx(image, MIPMAP_FILTER_BOX, false, 0.0f);
+}
+
+// Generate all mipmap levels for a provided image with filter (rl_MipmapFilter)
+// NOTE: Every level is generated from previous one, color is filtered in linear space if srgb is requested
+// and alpha test coverage at alphaCutoff is preserved on levels if cutoff is provided (> 0.0f)
+// WARNING: Only 8 bit per channel formats support filters, other formats levels are resized with rl_ImageResize()
+void rl_ImageMipmapsEx(rl_Image *image, int filter, bool srgb, float alphaCutoff)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
@@ -2403,22 +3941,56 @@ void rl_ImageMipmaps(rl_Image *image)
 
     if (image->mipmaps < mipCount)
     {
-        // Create second buffer and copy data manually to it
+        // Channels of 8 bit per channel formats, filtered directly from previous level
+        int channels = 0;
+        if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) channels = 1;
+        else if (image->format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) channels = 2;
+        else if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) channels = 3;
+        else if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) channels = 4;
+
+        // Create second buffer and copy available levels data to it
+        int availableSize = 0;
+        mipWidth = image->width;
+        mipHeight = image->height;
+
+        for (int i = 0; i < image->mipmaps; i++)
+        {
+            availableSize += rl_GetPixelDataSize(mipWidth, mipHeight, image->format);
+
+            mipWidth = (mipWidth/2 < 1)? 1 : mipWidth/2;
+            mipHeight = (mipHeight/2 < 1)? 1 : mipHeight/2;
+        }
+
         void *temp = RL_CALLOC(mipSize, 1);
-        memcpy(temp, image->data, rl_GetPixelDataSize(image->width, image->height, image->format));
+        memcpy(temp, image->data, availableSize);
         RL_FREE(image->data);
         image->data = temp;
 
+        // Alpha test coverage of base level, preserved on generated levels
+        int alphaChannel = ((channels == 2) || (channels == 4))? channels - 1 : -1;
+        float coverage = 0.0f;
+
+        if ((alphaCutoff > 0.0f) && (alphaChannel >= 0)) coverage = GetImageAlphaCoverage((const unsigned char *)image->data, image->width*image->height, channels, alphaChannel, alphaCutoff, 1.0f);
+        else alphaChannel = -1;
+
+        if (srgb) LoadMipmapSrgbTables();
+
         // Pointer to allocated memory point where store next mipmap level data
+        unsigned char *prevmip = NULL;
         unsigned char *nextmip = (unsigned char *)image->data;
+        rl_Image imCopy = { 0 };
 
+        int prevWidth = 0;
+        int prevHeight = 0;
         mipWidth = image->width;
         mipHeight = image->height;
         mipSize = rl_GetPixelDataSize(mipWidth, mipHeight, image->format);
-        rl_Image imCopy = rl_ImageCopy(*image);
 
         for (int i = 1; i < mipCount; i++)
         {
+            prevmip = nextmip;
+            prevWidth = mipWidth;
+            prevHeight = mipHeight;
             nextmip += mipSize;
 
             mipWidth /= 2;
@@ -2433,8 +4005,21 @@ void rl_ImageMipmaps(rl_Image *image)
             if (i < image->mipmaps) continue;
 
             TRACELOGD("IMAGE: Generating mipmap level: %i (%i x %i) - size: %i - offset: 0x%x", i, mipWidth, mipHeight, mipSize, nextmip);
-            rl_ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
-            memcpy(nextmip, imCopy.data, mipSize);
+
+            if (channels > 0)
+            {
+                GenImageMipmapLevel(prevmip, prevWidth, prevHeight, nextmip, mipWidth, mipHeight, channels, filter, srgb);
+
+                if (alphaChannel >= 0) ScaleImageAlphaCoverage(nextmip, mipWidth*mipHeight, channels, alphaChannel, alphaCutoff, coverage);
+            }
+            else
+            {
+                // Other formats levels are resized from base level copy
+                if (imCopy.data == NULL) imCopy = rl_ImageCopy(*image);
+
+                rl_ImageResize(&imCopy, mipWidth, mipHeight); // Uses internally Mitchell cubic downscale filter
+                memcpy(nextmip, imCopy.data, mipSize);
+            }
         }
 
         rl_UnloadImage(imCopy);
@@ -2448,6 +4033,14 @@ void rl_ImageMipmaps(rl_Image *image)
 // NOTE: In case selected bpp do not represent a known 16bit format,
 // dithered data is stored in the LSB part of the unsigned short
 void rl_ImageDither(rl_Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
+{
+    rl_ImageDitherEx(image, rBpp, gBpp, bBpp, aBpp, DITHER_FLOYD_STEINBERG);
+}
+
+// Dither image data to 16bpp or lower with dithering method (rl_DitherMethod)
+// NOTE: Ordered methods threshold every pixel independently, rows are processed by worker threads,
+// error diffusion (Floyd-Steinberg) is serial; unknown 16bit formats are stored as rl_ImageDither()
+void rl_ImageDitherEx(rl_Image *image, int rBpp, int gBpp, int bBpp, int aBpp, int method)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
@@ -2486,75 +4079,97 @@ void rl_ImageDither(rl_Image *image, int rBpp, int gBpp, int bBpp, int aBpp)
         // NOTE: We will store the dithered data as unsigned short (16bpp)
         image->data = (unsigned short *)RL_MALLOC(image->width*image->height*sizeof(unsigned short));
 
-        rl_Color oldPixel = rl_WHITE;
-        rl_Color newPixel = rl_WHITE;
+        if (method == DITHER_FLOYD_STEINBERG)
+        {
+            rl_Color oldPixel = rl_WHITE;
+            rl_Color newPixel = rl_WHITE;
 
-        int rError = 0;
-        int gError = 0;
-        int bError = 0;
-        unsigned short rPixel = 0;   // Used for 16bit pixel composition
-        unsigned short gPixel = 0;
-        unsigned short bPixel = 0;
-        unsigned short aPixel = 0;
+            int rError = 0;
+            int gError = 0;
+            int bError = 0;
+            unsigned short rPixel = 0;   // Used for 16bit pixel composition
+            unsigned short gPixel = 0;
+            unsigned short bPixel = 0;
+            unsigned short aPixel = 0;
 
-        #define MIN(a,b) (((a)<(b))?(a):(b))
+            #define MIN(a,b) (((a)<(b))?(a):(b))
 
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
+            for (int y = 0; y < image->height; y++)
             {
-                oldPixel = pixels[y*image->width + x];
+                for (int x = 0; x < image->width; x++)
+                {
+                    oldPixel = pixels[y*image->width + x];
 
-                // NOTE: New pixel obtained by bits truncate, it would be better to round values (check rl_ImageFormat())
-                newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
-                newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
-                newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
-                newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
+                    // NOTE: New pixel obtained by bits truncate, it would be better to round values (check rl_ImageFormat())
+                    newPixel.r = oldPixel.r >> (8 - rBpp);     // R bits
+                    newPixel.g = oldPixel.g >> (8 - gBpp);     // G bits
+                    newPixel.b = oldPixel.b >> (8 - bBpp);     // B bits
+                    newPixel.a = oldPixel.a >> (8 - aBpp);     // A bits (not used on dithering)
 
-                // NOTE: Error must be computed between new and old pixel but using same number of bits!
-                // We want to know how much color precision we have lost...
-                rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
-                gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
-                bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
+                    // NOTE: Error must be computed between new and old pixel but using same number of bits!
+                    // We want to know how much color precision we have lost...
+                    rError = (int)oldPixel.r - (int)(newPixel.r << (8 - rBpp));
+                    gError = (int)oldPixel.g - (int)(newPixel.g << (8 - gBpp));
+                    bError = (int)oldPixel.b - (int)(newPixel.b << (8 - bBpp));
 
-                pixels[y*image->width + x] = newPixel;
+                    pixels[y*image->width + x] = newPixel;
 
-                // NOTE: Some cases are out of the array and should be ignored
-                if (x < (image->width - 1))
-                {
-                    pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
-                    pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
-                }
+                    // NOTE: Some cases are out of the array and should be ignored
+                    if (x < (image->width - 1))
+                    {
+                        pixels[y*image->width + x+1].r = MIN((int)pixels[y*image->width + x+1].r + (int)((float)rError*7.0f/16), 0xff);
+                        pixels[y*image->width + x+1].g = MIN((int)pixels[y*image->width + x+1].g + (int)((float)gError*7.0f/16), 0xff);
+                        pixels[y*image->width + x+1].b = MIN((int)pixels[y*image->width + x+1].b + (int)((float)bError*7.0f/16), 0xff);
+                    }
 
-                if ((x > 0) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
-                }
+                    if ((x > 0) && (y < (image->height - 1)))
+                    {
+                        pixels[(y+1)*image->width + x-1].r = MIN((int)pixels[(y+1)*image->width + x-1].r + (int)((float)rError*3.0f/16), 0xff);
+                        pixels[(y+1)*image->width + x-1].g = MIN((int)pixels[(y+1)*image->width + x-1].g + (int)((float)gError*3.0f/16), 0xff);
+                        pixels[(y+1)*image->width + x-1].b = MIN((int)pixels[(y+1)*image->width + x-1].b + (int)((float)bError*3.0f/16), 0xff);
+                    }
 
-                if (y < (image->height - 1))
-                {
-                    pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
-                }
+                    if (y < (image->height - 1))
+                    {
+                        pixels[(y+1)*image->width + x].r = MIN((int)pixels[(y+1)*image->width + x].r + (int)((float)rError*5.0f/16), 0xff);
+                        pixels[(y+1)*image->width + x].g = MIN((int)pixels[(y+1)*image->width + x].g + (int)((float)gError*5.0f/16), 0xff);
+                        pixels[(y+1)*image->width + x].b = MIN((int)pixels[(y+1)*image->width + x].b + (int)((float)bError*5.0f/16), 0xff);
+                    }
 
-                if ((x < (image->width - 1)) && (y < (image->height - 1)))
-                {
-                    pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
-                    pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
-                }
+                    if ((x < (image->width - 1)) && (y < (image->height - 1)))
+                    {
+                        pixels[(y+1)*image->width + x+1].r = MIN((int)pixels[(y+1)*image->width + x+1].r + (int)((float)rError*1.0f/16), 0xff);
+                        pixels[(y+1)*image->width + x+1].g = MIN((int)pixels[(y+1)*image->width + x+1].g + (int)((float)gError*1.0f/16), 0xff);
+                        pixels[(y+1)*image->width + x+1].b = MIN((int)pixels[(y+1)*image->width + x+1].b + (int)((float)bError*1.0f/16), 0xff);
+                    }
+
+                    rPixel = (unsigned short)newPixel.r;
+                    gPixel = (unsigned short)newPixel.g;
+                    bPixel = (unsigned short)newPixel.b;
+                    aPixel = (unsigned short)newPixel.a;
 
-                rPixel = (unsigned short)newPixel.r;
-                gPixel = (unsigned short)newPixel.g;
-                bPixel = (unsigned short)newPixel.b;
-                aPixel = (unsigned short)newPixel.a;
+                    ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
+                }
+            }
+        }
+        else
+        {
+            // Ordered dithering, threshold tile values are spread in channel quantization step
+            unsigned char bayerThresholds[64] = { 0 };
+            const unsigned char *thresholds = bayerThresholds;
+            int size = 8;
 
-                ((unsigned short *)image->data)[y*image->width + x] = (rPixel << (gBpp + bBpp + aBpp)) | (gPixel << (bBpp + aBpp)) | (bPixel << aBpp) | aPixel;
+            if (method == DITHER_BLUE_NOISE)
+            {
+                LoadDitherBlueNoise();
+                thresholds = ditherBlueNoise.thresholds;
+                size = DITHER_BLUE_NOISE_SIZE;
             }
+            else for (int i = 0; i < 64; i++) bayerThresholds[i] = ditherBayerMatrix[i]*4 + 2;
+
+            DitherJob dither = { pixels, (unsigned short *)image->data, image->width, { rBpp, gBpp, bBpp, aBpp }, thresholds, size };
+            WorkerJob job = { ProcessDitherRange, &dither, image->height, IMAGE_FILTER_CHUNK_ROWS };
+            RunWorkerJob(&job);
         }
 
         rl_UnloadImageColors(pixels);
@@ -2569,20 +4184,7 @@ void rl_ImageFlipVertical(rl_Image *image)
 
     if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "rl_Image manipulation only applied to base mipmap level");
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "rl_Image manipulation not supported for compressed formats");
-    else
-    {
-        int bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int i = (image->height - 1), offsetSize = 0; i >= 0; i--)
-        {
-            memcpy(flippedData + offsetSize, ((unsigned char *)image->data) + i*image->width*bytesPerPixel, image->width*bytesPerPixel);
-            offsetSize += image->width*bytesPerPixel;
-        }
-
-        RL_FREE(image->data);
-        image->data = flippedData;
-    }
+    else rl_ImageViewFlipVertical(rl_GetImageView(*image, (rl_Rectangle){ 0, 0, (float)image->width, (float)image->height }));    // Rows swapped in place
 }
 
 // Flip image horizontally
@@ -2591,58 +4193,24 @@ void rl_ImageFlipHorizontal(rl_Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "rl_Image manipulation only applied to base mipmap level");
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "rl_Image manipulation not supported for compressed formats");
+    else rl_ImageViewFlipHorizontal(rl_GetImageView(*image, (rl_Rectangle){ 0, 0, (float)image->width, (float)image->height }));  // Pixels swapped in place
+}
+
+// Rotate image in degrees
+void rl_ImageRotate(rl_Image *image, int degrees)
+{
+    // Security check to avoid program crash
+    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
+
     if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "rl_Image manipulation only applied to base mipmap level");
     if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "rl_Image manipulation not supported for compressed formats");
     else
     {
-        int bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
-        unsigned char *flippedData = (unsigned char *)RL_MALLOC(image->width*image->height*bytesPerPixel);
-
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width; x++)
-            {
-                // OPTION 1: Move pixels with memcpy()
-                //memcpy(flippedData + (y*image->width + x)*bytesPerPixel, ((unsigned char *)image->data) + (y*image->width + (image->width - 1 - x))*bytesPerPixel, bytesPerPixel);
-
-                // OPTION 2: Just copy data pixel by pixel
-                for (int i = 0; i < bytesPerPixel; i++) flippedData[(y*image->width + x)*bytesPerPixel + i] = ((unsigned char *)image->data)[(y*image->width + (image->width - 1 - x))*bytesPerPixel + i];
-            }
-        }
-
-        RL_FREE(image->data);
-        image->data = flippedData;
-
-        /*
-        // OPTION 3: Faster implementation (specific for 32bit pixels)
-        // NOTE: It does not require additional allocations
-        uint32_t *ptr = (uint32_t *)image->data;
-        for (int y = 0; y < image->height; y++)
-        {
-            for (int x = 0; x < image->width/2; x++)
-            {
-                uint32_t backup = ptr[y*image->width + x];
-                ptr[y*image->width + x] = ptr[y*image->width + (image->width - 1 - x)];
-                ptr[y*image->width + (image->width - 1 - x)] = backup;
-            }
-        }
-        */
-    }
-}
-
-// Rotate image in degrees
-void rl_ImageRotate(rl_Image *image, int degrees)
-{
-    // Security check to avoid program crash
-    if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
-
-    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "rl_Image manipulation only applied to base mipmap level");
-    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "rl_Image manipulation not supported for compressed formats");
-    else
-    {
-        float rad = degrees*rl_PI/180.0f;
-        float sinRadius = sinf(rad);
-        float cosRadius = cosf(rad);
+        float rad = degrees*rl_PI/180.0f;
+        float sinRadius = sinf(rad);
+        float cosRadius = cosf(rad);
 
         int width = (int)(fabsf(image->width*cosRadius) + fabsf(image->height*sinRadius));
         int height = (int)(fabsf(image->height*cosRadius) + fabsf(image->width*sinRadius));
@@ -2759,6 +4327,13 @@ void rl_ImageColorTint(rl_Image *image, rl_Color color)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    // Pixels are modified in place when format can be processed through RGBA8 rows
+    if ((image->mipmaps == 1) && IsPixelFormatDrawRow(image->format))
+    {
+        rl_ImageViewColorTint(rl_GetImageView(*image, (rl_Rectangle){ 0, 0, (float)image->width, (float)image->height }), color);
+        return;
+    }
+
     rl_Color *pixels = rl_LoadImageColors(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
@@ -2789,6 +4364,13 @@ void rl_ImageColorInvert(rl_Image *image)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    // Pixels are modified in place when format can be processed through RGBA8 rows
+    if ((image->mipmaps == 1) && IsPixelFormatDrawRow(image->format))
+    {
+        rl_ImageViewColorInvert(rl_GetImageView(*image, (rl_Rectangle){ 0, 0, (float)image->width, (float)image->height }));
+        return;
+    }
+
     rl_Color *pixels = rl_LoadImageColors(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
@@ -2823,6 +4405,13 @@ void rl_ImageColorContrast(rl_Image *image, float contrast)
     if (contrast < -100) contrast = -100;
     if (contrast > 100) contrast = 100;
 
+    // Pixels are modified in place when format can be processed through RGBA8 rows
+    if ((image->mipmaps == 1) && IsPixelFormatDrawRow(image->format))
+    {
+        rl_ImageViewColorContrast(rl_GetImageView(*image, (rl_Rectangle){ 0, 0, (float)image->width, (float)image->height }), contrast);
+        return;
+    }
+
     contrast = (100.0f + contrast)/100.0f;
     contrast *= contrast;
 
@@ -2878,6 +4467,13 @@ void rl_ImageColorBrightness(rl_Image *image, int brightness)
     if (brightness < -255) brightness = -255;
     if (brightness > 255) brightness = 255;
 
+    // Pixels are modified in place when format can be processed through RGBA8 rows
+    if ((image->mipmaps == 1) && IsPixelFormatDrawRow(image->format))
+    {
+        rl_ImageViewColorBrightness(rl_GetImageView(*image, (rl_Rectangle){ 0, 0, (float)image->width, (float)image->height }), brightness);
+        return;
+    }
+
     rl_Color *pixels = rl_LoadImageColors(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
@@ -2915,6 +4511,16 @@ void rl_ImageColorReplace(rl_Image *image, rl_Color color, rl_Color replace)
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
+    // Pixels are modified in place when format can be processed through RGBA8 rows and result format is kept
+    if ((image->mipmaps == 1) && ((image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+        (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) ||
+        (image->format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) ||
+        (image->format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)))
+    {
+        rl_ImageViewColorReplace(rl_GetImageView(*image, (rl_Rectangle){ 0, 0, (float)image->width, (float)image->height }), color, replace);
+        return;
+    }
+
     rl_Color *pixels = rl_LoadImageColors(*image);
 
     for (int i = 0; i < image->width*image->height; i++)
@@ -2948,6 +4554,118 @@ void rl_ImageColorReplace(rl_Image *image, rl_Color color, rl_Color replace)
         (format == PIXELFORMAT_COMPRESSED_ETC2_RGB) ||
         (format == PIXELFORMAT_COMPRESSED_PVRT_RGB)) rl_ImageFormat(image, format);
 }
+
+// Flip image view vertically, in place
+void rl_ImageViewFlipVertical(rl_ImageView view)
+{
+    if (!rl_IsImageViewValid(view)) return;
+
+    int rowSize = view.width*rl_GetPixelDataSize(1, 1, view.format);
+    unsigned char *row = (unsigned char *)RL_MALLOC(rowSize);
+
+    for (int y = 0; y < view.height/2; y++)
+    {
+        unsigned char *top = (unsigned char *)view.data + y*view.stride;
+        unsigned char *bottom = (unsigned char *)view.data + (view.height - 1 - y)*view.stride;
+
+        memcpy(row, top, rowSize);
+        memcpy(top, bottom, rowSize);
+        memcpy(bottom, row, rowSize);
+    }
+
+    RL_FREE(row);
+}
+
+// Flip image view horizontally, in place
+void rl_ImageViewFlipHorizontal(rl_ImageView view)
+{
+    if (!rl_IsImageViewValid(view)) return;
+
+    int bytesPerPixel = rl_GetPixelDataSize(1, 1, view.format);
+
+    for (int y = 0; y < view.height; y++)
+    {
+        unsigned char *row = (unsigned char *)view.data + y*view.stride;
+
+        if (bytesPerPixel == 4)
+        {
+            // Faster implementation for 32bit pixels, pixels are swapped as unsigned int values
+            for (int x = 0; x < view.width/2; x++)
+            {
+                unsigned int left = 0;
+                unsigned int right = 0;
+
+                memcpy(&left, row + x*4, 4);
+                memcpy(&right, row + (view.width - 1 - x)*4, 4);
+                memcpy(row + x*4, &right, 4);
+                memcpy(row + (view.width - 1 - x)*4, &left, 4);
+            }
+        }
+        else
+        {
+            for (int x = 0; x < view.width/2; x++)
+            {
+                unsigned char *left = row + x*bytesPerPixel;
+                unsigned char *right = row + (view.width - 1 - x)*bytesPerPixel;
+
+                for (int i = 0; i < bytesPerPixel; i++)
+                {
+                    unsigned char backup = left[i];
+                    left[i] = right[i];
+                    right[i] = backup;
+                }
+            }
+        }
+    }
+}
+
+// Modify image view color: tint, in place
+void rl_ImageViewColorTint(rl_ImageView view, rl_Color color)
+{
+    ImageViewColorOperation(view, IMAGE_VIEW_COLOR_TINT, color, rl_BLANK, 0.0f);
+}
+
+// Modify image view color: invert, in place
+void rl_ImageViewColorInvert(rl_ImageView view)
+{
+    ImageViewColorOperation(view, IMAGE_VIEW_COLOR_INVERT, rl_BLANK, rl_BLANK, 0.0f);
+}
+
+// Modify image view color: grayscale, in place
+// NOTE: View format is kept, color channels are replaced by luminance (same as grayscale format conversion)
+void rl_ImageViewColorGrayscale(rl_ImageView view)
+{
+    ImageViewColorOperation(view, IMAGE_VIEW_COLOR_GRAYSCALE, rl_BLANK, rl_BLANK, 0.0f);
+}
+
+// Modify image view color: contrast, in place
+// NOTE: Contrast values between -100 and 100
+void rl_ImageViewColorContrast(rl_ImageView view, float contrast)
+{
+    if (contrast < -100) contrast = -100;
+    if (contrast > 100) contrast = 100;
+
+    contrast = (100.0f + contrast)/100.0f;
+    contrast *= contrast;
+
+    ImageViewColorOperation(view, IMAGE_VIEW_COLOR_CONTRAST, rl_BLANK, rl_BLANK, contrast);
+}
+
+// Modify image view color: brightness, in place
+// NOTE: Brightness values between -255 and 255
+void rl_ImageViewColorBrightness(rl_ImageView view, int brightness)
+{
+    if (brightness < -255) brightness = -255;
+    if (brightness > 255) brightness = 255;
+
+    ImageViewColorOperation(view, IMAGE_VIEW_COLOR_BRIGHTNESS, rl_BLANK, rl_BLANK, (float)brightness);
+}
+
+// Modify image view color: replace color, in place
+void rl_ImageViewColorReplace(rl_ImageView view, rl_Color color, rl_Color replace)
+{
+    ImageViewColorOperation(view, IMAGE_VIEW_COLOR_REPLACE, color, replace, 0.0f);
+}
 #endif      // SUPPORT_IMAGE_MANIPULATION
 
 // Load color data from image as a rl_Color array (RGBA - 32bit)
@@ -3168,6 +4886,67 @@ void rl_UnloadImagePalette(rl_Color *colors)
     RL_FREE(colors);
 }
 
+// Create indexed image from image and palette, pixels are mapped to nearest palette color
+// NOTE: Indexed image stores 8-bit palette indices as PIXELFORMAT_UNCOMPRESSED_GRAYSCALE,
+// exact colors are mapped to first matching palette entry, pixels are processed by worker threads
+rl_Image rl_ImageIndexed(rl_Image image, const rl_Color *palette, int colorCount)
+{
+    rl_Image indexed = { 0 };
+
+    if ((palette == NULL) || (colorCount <= 0)) return indexed;
+    if (colorCount > TEXTURE_PALETTE_SIZE)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Palette is greater than %i colors, only first colors are used", TEXTURE_PALETTE_SIZE);
+        colorCount = TEXTURE_PALETTE_SIZE;
+    }
+
+    rl_Color *pixels = rl_LoadImageColors(image);
+
+    if (pixels != NULL)
+    {
+        indexed.data = RL_MALLOC(image.width*image.height*sizeof(unsigned char));
+        indexed.width = image.width;
+        indexed.height = image.height;
+        indexed.mipmaps = 1;
+        indexed.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+        IndexedImageJob indexedJob = { pixels, (unsigned char *)indexed.data, palette, colorCount };
+        WorkerJob job = { ProcessIndexedImageRange, &indexedJob, image.width*image.height, IMAGE_FORMAT_CHUNK_SIZE };
+        RunWorkerJob(&job);
+
+        rl_UnloadImageColors(pixels);
+    }
+
+    return indexed;
+}
+
+// Create image from indexed image and palette (RGBA - 32bit)
+// NOTE: Indices out of palette are mapped to rl_BLANK
+rl_Image rl_ImageFromIndexed(rl_Image indexed, const rl_Color *palette, int colorCount)
+{
+    rl_Image image = { 0 };
+
+    if ((indexed.data == NULL) || (palette == NULL)) return image;
+    if (indexed.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Indexed image requires PIXELFORMAT_UNCOMPRESSED_GRAYSCALE format");
+        return image;
+    }
+
+    const unsigned char *indices = (const unsigned char *)indexed.data;
+    rl_Color *pixels = (rl_Color *)RL_MALLOC(indexed.width*indexed.height*sizeof(rl_Color));
+
+    for (int i = 0; i < indexed.width*indexed.height; i++) pixels[i] = (indices[i] < colorCount)? palette[indices[i]] : rl_BLANK;
+
+    image.data = pixels;
+    image.width = indexed.width;
+    image.height = indexed.height;
+    image.mipmaps = 1;
+    image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    return image;
+}
+
 // Get image alpha border rectangle
 // NOTE: Threshold is defined as a percentage: 0.0f -> 1.0f
 rl_Rectangle rl_GetImageAlphaBorder(rl_Image image, float threshold)
@@ -3345,6 +5124,15 @@ void rl_ImageClearBackground(rl_Image *dst, rl_Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
+    // Record background as image canvas rectangle
+    ImageCanvasCommand *command = AddImageCanvasCommand(dst, IMAGE_CANVAS_RECTANGLE, color);
+    if (command != NULL)
+    {
+        command->xMax = dst->width - 1;
+        command->yMax = dst->height - 1;
+        return;
+    }
+
     // Fill in first pixel based on image format
     rl_ImageDrawPixel(dst, 0, 0, color);
 
@@ -3359,6 +5147,8 @@ void rl_ImageClearBackground(rl_Image *dst, rl_Color color)
         int pixelsToCopy = MIN(i, totalPixels - i);
         memcpy(pSrcPixel + i*bytesPerPixel, pSrcPixel, pixelsToCopy*bytesPerPixel);
     }
+
+    SetImageAreaDirty(dst, 0, 0, dst->width, dst->height);
 }
 
 // Draw pixel within an image
@@ -3368,6 +5158,15 @@ void rl_ImageDrawPixel(rl_Image *dst, int x, int y, rl_Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (x < 0) || (x >= dst->width) || (y < 0) || (y >= dst->height)) return;
 
+    // Record pixel as image canvas rectangle
+    ImageCanvasCommand *command = AddImageCanvasCommand(dst, IMAGE_CANVAS_RECTANGLE, color);
+    if (command != NULL)
+    {
+        command->xMin = command->xMax = x;
+        command->yMin = command->yMax = y;
+        return;
+    }
+
     switch (dst->format)
     {
         case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
@@ -3500,6 +5299,8 @@ void rl_ImageDrawPixel(rl_Image *dst, int x, int y, rl_Color color)
         } break;
         default: break;
     }
+
+    SetImageAreaDirty(dst, x, y, 1, 1);
 }
 
 // Draw pixel within an image (Vector version)
@@ -3540,6 +5341,29 @@ void rl_ImageDrawLine(rl_Image *dst, int startPosX, int startPosY, int endPosX,
     // Calculate fixed-point increment for shorter length
     int decInc = (longLen == 0)? 0 : (shortLen << 16)/longLen;
 
+    // Record line in image canvas, bounds from first and last pixels
+    ImageCanvasCommand *command = (longLen > 0)? AddImageCanvasCommand(dst, IMAGE_CANVAS_LINE, color) : NULL;
+    if (command != NULL)
+    {
+        int majorStart = yLonger? startPosY : startPosX;
+        int majorEnd = majorStart + sgnInc*(longLen - 1);
+        int minorStart = yLonger? startPosX : startPosY;
+        int minorEnd = minorStart + (int)(((long long)(longLen - 1)*decInc) >> 16);
+        int majorMin = (majorStart < majorEnd)? majorStart : majorEnd;
+        int majorMax = (majorStart < majorEnd)? majorEnd : majorStart;
+        int minorMin = (minorStart < minorEnd)? minorStart : minorEnd;
+        int minorMax = (minorStart < minorEnd)? minorEnd : minorStart;
+
+        command->xMin = yLonger? minorMin : majorMin;
+        command->xMax = yLonger? minorMax : majorMax;
+        command->yMin = yLonger? majorMin : minorMin;
+        command->yMax = yLonger? majorMax : minorMax;
+
+        int values[6] = { startPosX, startPosY, longLen, sgnInc, decInc, yLonger };
+        memcpy(command->values, values, sizeof(values));
+        return;
+    }
+
     // Draw the line pixel by pixel
     if (yLonger)
     {
@@ -3631,6 +5455,20 @@ void rl_ImageDrawLineEx(rl_Image *dst, rl_Vector2 start, rl_Vector2 end, int thi
 // Draw circle within an image
 void rl_ImageDrawCircle(rl_Image* dst, int centerX, int centerY, int radius, rl_Color color)
 {
+    // Record circle in image canvas
+    ImageCanvasCommand *command = (radius >= 0)? AddImageCanvasCommand(dst, IMAGE_CANVAS_CIRCLE, color) : NULL;
+    if (command != NULL)
+    {
+        command->xMin = centerX - radius;
+        command->yMin = centerY - radius;
+        command->xMax = centerX + radius;
+        command->yMax = centerY + radius;
+        command->values[0] = centerX;
+        command->values[1] = centerY;
+        command->values[2] = radius;
+        return;
+    }
+
     int x = 0;
     int y = radius;
     int decesionParameter = 3 - 2*radius;
@@ -3661,6 +5499,20 @@ void rl_ImageDrawCircleV(rl_Image* dst, rl_Vector2 center, int radius, rl_Color
 // Draw circle outline within an image
 void rl_ImageDrawCircleLines(rl_Image *dst, int centerX, int centerY, int radius, rl_Color color)
 {
+    // Record circle outline in image canvas
+    ImageCanvasCommand *command = (radius >= 0)? AddImageCanvasCommand(dst, IMAGE_CANVAS_CIRCLE_LINES, color) : NULL;
+    if (command != NULL)
+    {
+        command->xMin = centerX - radius;
+        command->yMin = centerY - radius;
+        command->xMax = centerX + radius;
+        command->yMax = centerY + radius;
+        command->values[0] = centerX;
+        command->values[1] = centerY;
+        command->values[2] = radius;
+        return;
+    }
+
     int x = 0;
     int y = radius;
     int decesionParameter = 3 - 2*radius;
@@ -3710,25 +5562,30 @@ void rl_ImageDrawRectangleRec(rl_Image *dst, rl_Rectangle rec, rl_Color color)
     // Security check to avoid program crash
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) return;
 
-    // Security check to avoid drawing out of bounds in case of bad user data
-    if (rec.x < 0) { rec.width += rec.x; rec.x = 0; }
-    if (rec.y < 0) { rec.height += rec.y; rec.y = 0; }
-    if (rec.width < 0) rec.width = 0;
-    if (rec.height < 0) rec.height = 0;
-
-    // Clamp the size the the image bounds
-    if ((rec.x + rec.width) >= dst->width) rec.width = dst->width - rec.x;
-    if ((rec.y + rec.height) >= dst->height) rec.height = dst->height - rec.y;
+    // Rectangle area clamped to image bounds
+    int area[4] = { 0 };
+    if (!GetImageRectangleArea(dst, rec, area)) return;
 
-    // Check if the rect is even inside the image
-    if ((rec.x >= dst->width) || (rec.y >= dst->height)) return;
-    if (((rec.x + rec.width) <= 0) || (rec.y + rec.height <= 0)) return;
+    // Record rectangle in image canvas
+    ImageCanvasCommand *command = AddImageCanvasCommand(dst, IMAGE_CANVAS_RECTANGLE, color);
+    if (command != NULL)
+    {
+        command->xMin = area[0];
+        command->yMin = area[1];
+        command->xMax = area[0] + area[2] - 1;
+        command->yMax = area[1] + area[3] - 1;
+        return;
+    }
 
-    int sy = (int)rec.y;
-    int sx = (int)rec.x;
+    int sx = area[0];
+    int sy = area[1];
+    int width = area[2];
+    int height = area[3];
 
     int bytesPerPixel = rl_GetPixelDataSize(1, 1, dst->format);
 
+    SetImageAreaDirty(dst, sx, sy, width, height);
+
     // Fill in the first pixel of the first row based on image format
     rl_ImageDrawPixel(dst, sx, sy, color);
 
@@ -3736,15 +5593,15 @@ void rl_ImageDrawRectangleRec(rl_Image *dst, rl_Rectangle rec, rl_Color color)
     unsigned char *pSrcPixel = (unsigned char *)dst->data + bytesOffset;
 
     // Repeat the first pixel data throughout the row
-    for (int x = 1; x < (int)rec.width; x *= 2)
+    for (int x = 1; x < width; x *= 2)
     {
-        int pixelsToCopy = MIN(x, (int)rec.width - x);
+        int pixelsToCopy = MIN(x, width - x);
         memcpy(pSrcPixel + x*bytesPerPixel, pSrcPixel, pixelsToCopy*bytesPerPixel);
     }
 
     // Repeat the first row data for all other rows
-    int bytesPerRow = bytesPerPixel*(int)rec.width;
-    for (int y = 1; y < (int)rec.height; y++)
+    int bytesPerRow = bytesPerPixel*width;
+    for (int y = 1; y < height; y++)
     {
         memcpy(pSrcPixel + (y*dst->width)*bytesPerPixel, pSrcPixel, bytesPerRow);
     }
@@ -3799,6 +5656,22 @@ void rl_ImageDrawTriangle(rl_Image *dst, rl_Vector2 v1, rl_Vector2 v2, rl_Vector
     int w2Row = (int)((xMin - v3.x)*w2XStep + w2YStep*(yMin - v3.y));
     int w3Row = (int)((xMin - v1.x)*w3XStep + w3YStep*(yMin - v1.y));
 
+    // Record triangle in image canvas, barycentric coordinates are evaluated by tiles
+    ImageCanvasCommand *command = AddImageCanvasCommand(dst, IMAGE_CANVAS_TRIANGLE, color);
+    if (command != NULL)
+    {
+        command->xMin = xMin;
+        command->yMin = yMin;
+        command->xMax = xMax;
+        command->yMax = yMax;
+
+        int values[11] = { w1Row, w2Row, w3Row, w1XStep, w1YStep, w2XStep, w2YStep, w3XStep, w3YStep, xMin, yMin };
+        memcpy(command->values, values, sizeof(values));
+        return;
+    }
+
+    SetImageAreaDirty(dst, xMin, yMin, xMax - xMin + 1, yMax - yMin + 1);
+
     // Rasterization loop
     // Iterate through each pixel in the bounding box
     for (int y = yMin; y <= yMax; y++)
@@ -3872,6 +5745,25 @@ void rl_ImageDrawTriangleEx(rl_Image *dst, rl_Vector2 v1, rl_Vector2 v2, rl_Vect
     // NOTE 2: This sum remains constant throughout the triangle
     float wInvSum = 255.0f/(w1Row + w2Row + w3Row);
 
+    // Record triangle in image canvas, colors are interpolated by tiles
+    ImageCanvasCommand *command = AddImageCanvasCommand(dst, IMAGE_CANVAS_TRIANGLE_COLORS, c1);
+    if (command != NULL)
+    {
+        command->xMin = xMin;
+        command->yMin = yMin;
+        command->xMax = xMax;
+        command->yMax = yMax;
+        command->invSum = wInvSum;
+        command->colors[1] = c2;
+        command->colors[2] = c3;
+
+        int values[11] = { w1Row, w2Row, w3Row, w1XStep, w1YStep, w2XStep, w2YStep, w3XStep, w3YStep, xMin, yMin };
+        memcpy(command->values, values, sizeof(values));
+        return;
+    }
+
+    SetImageAreaDirty(dst, xMin, yMin, xMax - xMin + 1, yMax - yMin + 1);
+
     // Rasterization loop
     // Iterate through each pixel in the bounding box
     for (int y = yMin; y <= yMax; y++)
@@ -3955,6 +5847,9 @@ void rl_ImageDraw(rl_Image *dst, rl_Image src, rl_Rectangle srcRec, rl_Rectangle
     if ((dst->data == NULL) || (dst->width == 0) || (dst->height == 0) ||
         (src.data == NULL) || (src.width == 0) || (src.height == 0)) return;
 
+    // Image canvas recorded primitives are drawn first, images are drawn immediately
+    if ((imageCanvas.image != NULL) && (dst->data == imageCanvas.image->data)) FlushImageCanvas();
+
     if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "rl_Image drawing not supported for compressed formats");
     else
     {
@@ -3970,14 +5865,32 @@ void rl_ImageDraw(rl_Image *dst, rl_Image src, rl_Rectangle srcRec, rl_Rectangle
 
         // Check if source rectangle needs to be resized to destination rectangle
         // In that case, we make a copy of source, and we apply all required transform
+        // NOTE: Directly resizable formats are resized from source region into a frame arena copy
+        MemoryFrameMark mark = GetMemoryFrameMark();
+
         if (((int)srcRec.width != (int)dstRec.width) || ((int)srcRec.height != (int)dstRec.height))
         {
-            srcMod = rl_ImageFromImage(src, srcRec);   // Create image from another image
-            rl_ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
-            srcRec = (rl_Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
+            int bytesPerPixel = rl_GetPixelDataSize(1, 1, src.format);
+            srcMod = (rl_Image){ NULL, (int)dstRec.width, (int)dstRec.height, 1, src.format };
+
+            if (IsPixelFormatResizable(src.format) && (srcMod.width > 0) && (srcMod.height > 0))
+            {
+                srcMod.data = rl_MemFrameAlloc(srcMod.width*srcMod.height*bytesPerPixel);
+                const unsigned char *srcRegion = (const unsigned char *)src.data + ((int)srcRec.y*src.width + (int)srcRec.x)*bytesPerPixel;
+
+                if (!ResizeImageData(srcRegion, (int)srcRec.width, (int)srcRec.height, src.width*bytesPerPixel,
+                    srcMod.data, srcMod.width, srcMod.height, src.format, 0)) srcMod.data = NULL;
+            }
+
+            if (srcMod.data == NULL)
+            {
+                srcMod = rl_ImageFromImage(src, srcRec);   // Create image from another image
+                rl_ImageResize(&srcMod, (int)dstRec.width, (int)dstRec.height);   // Resize to destination rectangle
+                useSrcMod = true;
+            }
 
+            srcRec = (rl_Rectangle){ 0, 0, (float)srcMod.width, (float)srcMod.height };
             srcPtr = &srcMod;
-            useSrcMod = true;
         }
 
         // Destination rectangle out-of-bounds security checks
@@ -4009,12 +5922,11 @@ void rl_ImageDraw(rl_Image *dst, rl_Image src, rl_Rectangle srcRec, rl_Rectangle
         //    [x] Optimize rl_ColorAlphaBlend() for faster operations (maybe avoiding divs?)
         //    [x] Consider fast path: no alpha blending required cases (src has no alpha)
         //    [x] Consider fast path: same src/dst format with no alpha -> direct line copy
+        //    [x] Consider fast path: 8bit and 16bit packed formats -> rows converted and blended as RGBA8
         //    [-] rl_GetPixelColor(): Get rl_Vector4 instead of rl_Color, easier for rl_ColorAlphaBlend()
-        //    [ ] TODO: Support 16bit and 32bit (float) channels drawing
+        //    [x] Support 16bit and 32bit (float) channels drawing
+        //    [x] Consider fast path: other formats -> rows converted with per format kernels (no per pixel format switch)
 
-        rl_Color colSrc = { 0 };
-        rl_Color colDst = { 0 };
-        rl_Color blend = { 0 };
         bool blendRequired = true;
 
         // Fast path: Avoid blend if source has no alpha to blend
@@ -4028,6 +5940,9 @@ void rl_ImageDraw(rl_Image *dst, rl_Image src, rl_Rectangle srcRec, rl_Rectangle
             (srcPtr->format == PIXELFORMAT_UNCOMPRESSED_R16G16B16)))
             blendRequired = false;
 
+        // Fast path: Rows drawn through RGBA8 chunks, avoiding per pixel format decoding/encoding
+        bool drawRows = IsPixelFormatDrawRow(srcPtr->format) && IsPixelFormatDrawRow(dst->format);
+
         int strideDst = rl_GetPixelDataSize(dst->width, 1, dst->format);
         int bytesPerPixelDst = strideDst/(dst->width);
 
@@ -4037,6 +5952,8 @@ void rl_ImageDraw(rl_Image *dst, rl_Image src, rl_Rectangle srcRec, rl_Rectangle
         unsigned char *pSrcBase = (unsigned char *)srcPtr->data + ((int)srcRec.y*srcPtr->width + (int)srcRec.x)*bytesPerPixelSrc;
         unsigned char *pDstBase = (unsigned char *)dst->data + ((int)dstRec.y*dst->width + (int)dstRec.x)*bytesPerPixelDst;
 
+        SetImageAreaDirty(dst, (int)dstRec.x, (int)dstRec.y, (int)srcRec.width, (int)srcRec.height);
+
         for (int y = 0; y < (int)srcRec.height; y++)
         {
             unsigned char *pSrc = pSrcBase;
@@ -4044,29 +5961,15 @@ void rl_ImageDraw(rl_Image *dst, rl_Image src, rl_Rectangle srcRec, rl_Rectangle
 
             // Fast path: Avoid moving pixel by pixel if no blend required and same format
             if (!blendRequired && (srcPtr->format == dst->format)) memcpy(pDst, pSrc, (int)(srcRec.width)*bytesPerPixelSrc);
-            else
-            {
-                for (int x = 0; x < (int)srcRec.width; x++)
-                {
-                    colSrc = rl_GetPixelColor(pSrc, srcPtr->format);
-                    colDst = rl_GetPixelColor(pDst, dst->format);
-
-                    // Fast path: Avoid blend if source has no alpha to blend
-                    if (blendRequired) blend = rl_ColorAlphaBlend(colDst, colSrc, tint);
-                    else blend = colSrc;
-
-                    rl_SetPixelColor(pDst, blend, dst->format);
-
-                    pDst += bytesPerPixelDst;
-                    pSrc += bytesPerPixelSrc;
-                }
-            }
+            else if (drawRows) ImageDrawRow(pDst, dst->format, pSrc, srcPtr->format, (int)srcRec.width, tint, blendRequired);
+            else ImageDrawRowKernels(pDst, dst->format, pSrc, srcPtr->format, (int)srcRec.width, tint, blendRequired);
 
             pSrcBase += strideSrc;
             pDstBase += strideDst;
         }
 
         if (useSrcMod) rl_UnloadImage(srcMod);     // Unload source modified image
+        ReleaseMemoryFrame(mark);
 
         if ((dst->mipmaps > 1) && (src.mipmaps > 1))
         {
@@ -4126,14 +6029,57 @@ void rl_ImageDrawTextEx(rl_Image *dst, rl_Font font, const char *text, rl_Vector
     rl_UnloadImage(imText);
 }
 
+// Begin image canvas mode, drawing functions calls on image are recorded
+// NOTE: Recorded primitives are rasterized on rl_EndImageCanvas() by tiles processed in parallel,
+// image must not be modified by other functions than image drawing functions until then
+void rl_BeginImageCanvas(rl_Image *dst)
+{
+    if (imageCanvas.image != NULL)
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Canvas already active, ending previous canvas");
+        rl_EndImageCanvas();
+    }
+
+    if ((dst == NULL) || (dst->data == NULL) || (dst->width == 0) || (dst->height == 0)) TRACELOG(LOG_WARNING, "IMAGE: Canvas image is not valid");
+    else if (dst->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Canvas not supported for compressed formats");
+    else imageCanvas.image = dst;
+}
+
+// End image canvas mode, recorded primitives are rasterized to image
+void rl_EndImageCanvas(void)
+{
+    FlushImageCanvas();
+
+    RL_FREE(imageCanvas.commands);
+    imageCanvas.image = NULL;
+    imageCanvas.commands = NULL;
+    imageCanvas.count = 0;
+    imageCanvas.capacity = 0;
+}
+
 //------------------------------------------------------------------------------------
 // rl_Texture loading functions
 //------------------------------------------------------------------------------------
 // Load texture from file into GPU memory (VRAM)
+// NOTE: With SUPPORT_SHARED_TEXTURES, textures loaded from the same file share one GPU texture,
+// rl_UnloadTexture() releases one reference, texture is unloaded with last reference
 rl_Texture2D rl_LoadTexture(const char *fileName)
 {
     rl_Texture2D texture = { 0 };
 
+    PROFILE_ZONE_BEGIN("rl_LoadTexture");
+
+#if defined(SUPPORT_SHARED_TEXTURES)
+    if (AcquireSharedTexture(fileName, &texture))
+    {
+        // Texture image could be decoded by an async model loader, upload pending
+        if (texture.id == 0) texture = UploadSharedTexture(fileName);
+        PROFILE_ZONE_END();
+        return texture;
+    }
+
+    texture = StoreSharedTexture(fileName, rl_LoadImage(fileName), true);
+#else
     rl_Image image = rl_LoadImage(fileName);
 
     if (image.data != NULL)
@@ -4141,6 +6087,9 @@ rl_Texture2D rl_LoadTexture(const char *fileName)
         texture = rl_LoadTextureFromImage(image);
         rl_UnloadImage(image);
     }
+#endif
+
+    PROFILE_ZONE_END();
 
     return texture;
 }
@@ -4150,13 +6099,44 @@ rl_Texture2D rl_LoadTexture(const char *fileName)
 rl_Texture2D rl_LoadTextureFromImage(rl_Image image)
 {
     rl_Texture2D texture = { 0 };
+    rl_Image compressed = { 0 };
 
     if ((image.width != 0) && (image.height != 0))
     {
+        if (LoadTextureCompressedImage(image, &compressed)) image = compressed;
+
         texture.id = rlLoadTexture(image.data, image.width, image.height, image.format, image.mipmaps);
     }
     else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
 
+    rl_UnloadImage(compressed);
+
+    texture.width = image.width;
+    texture.height = image.height;
+    texture.mipmaps = image.mipmaps;
+    texture.format = image.format;
+
+    return texture;
+}
+
+// Load a texture from image data, GPU transfer completes asynchronously
+// NOTE: Image data is copied into a staging buffer, so image can be unloaded on return,
+// use rl_IsTextureReady() to check when texture can be drawn without stalling
+rl_Texture2D rl_LoadTextureFromImageAsync(rl_Image image)
+{
+    rl_Texture2D texture = { 0 };
+    rl_Image compressed = { 0 };
+
+    if ((image.width != 0) && (image.height != 0))
+    {
+        if (LoadTextureCompressedImage(image, &compressed)) image = compressed;
+
+        texture.id = rlLoadTextureAsync(image.data, image.width, image.height, image.format, image.mipmaps);
+    }
+    else TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture");
+
+    rl_UnloadImage(compressed);
+
     texture.width = image.width;
     texture.height = image.height;
     texture.mipmaps = image.mipmaps;
@@ -4165,6 +6145,14 @@ rl_Texture2D rl_LoadTextureFromImage(rl_Image image)
     return texture;
 }
 
+// Set GPU compressed format for textures loaded from uncompressed images
+// NOTE: Images are compressed with rl_ImageCompress() on rl_LoadTextureFromImage(), if format is supported
+// by GPU and image size is multiple of 4, texture format reports the compressed format used
+void rl_SetTextureCompression(int format)
+{
+    textureCompressionFormat = format;
+}
+
 // Load cubemap from image, multiple image cubemap layouts supported
 rl_TextureCubemap rl_LoadTextureCubemap(rl_Image image, int layout)
 {
@@ -4272,1338 +6260,8090 @@ rl_TextureCubemap rl_LoadTextureCubemap(rl_Image image, int layout)
     return cubemap;
 }
 
-// Load texture for rendering (framebuffer)
-// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
-rl_RenderTexture2D rl_LoadRenderTexture(int width, int height)
+// Load texture array from images, all images must have same size and format
+// NOTE: Mipmap levels common to all images are uploaded
+rl_TextureArray rl_LoadTextureArray(const rl_Image *images, int count)
 {
-    rl_RenderTexture2D target = { 0 };
+    rl_TextureArray texture = { 0 };
 
-    target.id = rlLoadFramebuffer(); // Load an empty framebuffer
+    if ((images == NULL) || (count <= 0) || (images[0].data == NULL)) return texture;
 
-    if (target.id > 0)
+    int width = images[0].width;
+    int height = images[0].height;
+    int format = images[0].format;
+    int mipmaps = images[0].mipmaps;
+
+    for (int i = 1; i < count; i++)
     {
-        rlEnableFramebuffer(target.id);
+        if ((images[i].data == NULL) || (images[i].width != width) || (images[i].height != height) || (images[i].format != format))
+        {
+            TRACELOG(LOG_WARNING, "TEXTURE: Failed to load texture array, images must have same size and format");
+            return texture;
+        }
 
-        // Create color texture (default to RGBA)
-        target.texture.id = rlLoadTexture(NULL, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
-        target.texture.width = width;
-        target.texture.height = height;
-        target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
-        target.texture.mipmaps = 1;
+        if (images[i].mipmaps < mipmaps) mipmaps = images[i].mipmaps;
+    }
 
-        // Create depth renderbuffer/texture
-        target.depth.id = rlLoadTextureDepth(width, height, true);
-        target.depth.width = width;
-        target.depth.height = height;
-        target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
-        target.depth.mipmaps = 1;
+    // Layers are uploaded level by level, every level containing all layers
+    int dataSize = 0;
+    for (int i = 0, mipWidth = width, mipHeight = height; i < mipmaps; i++)
+    {
+        dataSize += rl_GetPixelDataSize(mipWidth, mipHeight, format)*count;
 
-        // Attach color texture and depth renderbuffer/texture to FBO
-        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
-        rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+        mipWidth = (mipWidth/2 < 1)? 1 : mipWidth/2;
+        mipHeight = (mipHeight/2 < 1)? 1 : mipHeight/2;
+    }
 
-        // Check if fbo is complete with attachments (valid)
-        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
+    unsigned char *data = (unsigned char *)RL_MALLOC(dataSize);
 
-        rlDisableFramebuffer();
+    for (int i = 0, mipWidth = width, mipHeight = height, mipOffset = 0, dataOffset = 0; i < mipmaps; i++)
+    {
+        int mipSize = rl_GetPixelDataSize(mipWidth, mipHeight, format);
+
+        for (int layer = 0; layer < count; layer++, dataOffset += mipSize) memcpy(data + dataOffset, (unsigned char *)images[layer].data + mipOffset, mipSize);
+
+        mipOffset += mipSize;
+        mipWidth = (mipWidth/2 < 1)? 1 : mipWidth/2;
+        mipHeight = (mipHeight/2 < 1)? 1 : mipHeight/2;
     }
-    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
 
-    return target;
-}
+    texture.id = rlLoadTextureArray(data, width, height, count, format, mipmaps);
 
-// Check if a texture is valid (loaded in GPU)
-bool rl_IsTextureValid(rl_Texture2D texture)
-{
-    bool result = false;
+    RL_FREE(data);
 
-    if ((texture.id > 0) &&         // Validate OpenGL id (texture uplaoded to GPU)
-        (texture.width > 0) &&      // Validate texture width
-        (texture.height > 0) &&     // Validate texture height
-        (texture.format > 0) &&     // Validate texture pixel format
-        (texture.mipmaps > 0)) result = true; // Validate texture mipmaps (at least 1 for basic mipmap level)
+    if (texture.id > 0)
+    {
+        texture.width = width;
+        texture.height = height;
+        texture.layers = count;
+        texture.mipmaps = mipmaps;
+        texture.format = format;
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: Failed to load texture array");
 
-    return result;
+    return texture;
 }
 
-// Unload texture from GPU memory (VRAM)
-void rl_UnloadTexture(rl_Texture2D texture)
+// Load texture array from image tiles, one layer per tile (left to right, top to bottom)
+// NOTE: Tiles are sampled independently, no bleeding between neighbour tiles
+rl_TextureArray rl_LoadTextureArrayFromImage(rl_Image image, int tileWidth, int tileHeight)
 {
-    if (texture.id > 0)
+    rl_TextureArray texture = { 0 };
+
+    if ((image.data == NULL) || (tileWidth <= 0) || (tileHeight <= 0)) return texture;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
     {
-        rlUnloadTexture(texture.id);
+        TRACELOG(LOG_WARNING, "TEXTURE: Failed to load texture array, compressed image tiles can not be split");
+        return texture;
+    }
 
-        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
+    int columns = image.width/tileWidth;
+    int rows = image.height/tileHeight;
+
+    if ((columns == 0) || (rows == 0))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Failed to load texture array, tile size is bigger than image");
+        return texture;
     }
-}
 
-// Check if a render texture is valid (loaded in GPU)
-bool rl_IsRenderTextureValid(rl_RenderTexture2D target)
-{
-    bool result = false;
+    int rowSize = tileWidth*rl_GetPixelDataSize(1, 1, image.format);
+    int layerSize = rowSize*tileHeight;
+    unsigned char *data = (unsigned char *)RL_MALLOC(layerSize*columns*rows);
 
-    if ((target.id > 0) &&                  // Validate OpenGL id (loaded on GPU)
-        rl_IsTextureValid(target.depth) &&     // Validate FBO depth texture/renderbuffer attachment
-        rl_IsTextureValid(target.texture)) result = true; // Validate FBO texture attachment
+    // Tiles rows are copied from image views, tiles are packed one after the other
+    for (int layer = 0; layer < columns*rows; layer++)
+    {
+        rl_ImageView tile = rl_GetImageView(image, (rl_Rectangle){ (float)((layer%columns)*tileWidth), (float)((layer/columns)*tileHeight), (float)tileWidth, (float)tileHeight });
 
-    return result;
+        for (int y = 0; y < tileHeight; y++) memcpy(data + layer*layerSize + y*rowSize, (unsigned char *)tile.data + y*tile.stride, rowSize);
+    }
+
+    texture.id = rlLoadTextureArray(data, tileWidth, tileHeight, columns*rows, image.format, 1);
+
+    RL_FREE(data);
+
+    if (texture.id > 0)
+    {
+        texture.width = tileWidth;
+        texture.height = tileHeight;
+        texture.layers = columns*rows;
+        texture.mipmaps = 1;
+        texture.format = image.format;
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: Failed to load texture array");
+
+    return texture;
 }
 
-// Unload render texture from GPU memory (VRAM)
-void rl_UnloadRenderTexture(rl_RenderTexture2D target)
+// Load 3D texture from depth slices images, all images must have same size and format
+// NOTE: Only base level is uploaded, compressed formats not supported
+rl_Texture3D rl_LoadTexture3D(const rl_Image *slices, int count)
 {
-    if (target.id > 0)
+    rl_Texture3D texture = { 0 };
+
+    if ((slices == NULL) || (count <= 0) || (slices[0].data == NULL)) return texture;
+
+    int width = slices[0].width;
+    int height = slices[0].height;
+    int format = slices[0].format;
+
+    for (int i = 1; i < count; i++)
     {
-        if (target.texture.id > 0)
+        if ((slices[i].data == NULL) || (slices[i].width != width) || (slices[i].height != height) || (slices[i].format != format))
         {
-            // rl_Color texture attached to FBO is deleted
-            rlUnloadTexture(target.texture.id);
+            TRACELOG(LOG_WARNING, "TEXTURE: Failed to load 3D texture, slices must have same size and format");
+            return texture;
         }
+    }
 
-        // NOTE: Depth texture/renderbuffer is automatically
-        // queried and deleted before deleting framebuffer
-        rlUnloadFramebuffer(target.id);
+    int sliceSize = rl_GetPixelDataSize(width, height, format);
+    unsigned char *data = (unsigned char *)RL_MALLOC(sliceSize*count);
+
+    for (int i = 0; i < count; i++) memcpy(data + i*sliceSize, slices[i].data, sliceSize);
+
+    texture.id = rlLoadTexture3D(data, width, height, count, format, 1);
+
+    RL_FREE(data);
+
+    if (texture.id > 0)
+    {
+        texture.width = width;
+        texture.height = height;
+        texture.depth = count;
+        texture.mipmaps = 1;
+        texture.format = format;
     }
-}
+    else TRACELOG(LOG_WARNING, "TEXTURE: Failed to load 3D texture");
 
-// Update GPU texture with new data
-// NOTE 1: pixels data must match texture.format
-// NOTE 2: pixels data must contain at least as many pixels as texture
-void rl_UpdateTexture(rl_Texture2D texture, const void *pixels)
-{
-    rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels);
+    return texture;
 }
 
-// Update GPU texture rectangle with new data
-// NOTE 1: pixels data must match texture.format
-// NOTE 2: pixels data must contain as many pixels as rec contains
-// NOTE 3: rec must fit completely within texture's width and height
-void rl_UpdateTextureRec(rl_Texture2D texture, rl_Rectangle rec, const void *pixels)
+// Load texture for rendering (framebuffer)
+// NOTE: Render texture is loaded by default with RGBA color attachment and depth RenderBuffer
+rl_RenderTexture2D rl_LoadRenderTexture(int width, int height)
 {
-    rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
+    return LoadRenderTextureEx(width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, true);
 }
 
-//------------------------------------------------------------------------------------
-// rl_Texture configuration functions
-//------------------------------------------------------------------------------------
-// Generate GPU mipmaps for a texture
-void rl_GenTextureMipmaps(rl_Texture2D *texture)
+// Get transient render texture from pool
+// NOTE: Render texture is recycled at frame end (rl_EndDrawing()) or when released, contents are
+// undefined on acquire, unused pooled render textures are unloaded after RENDER_TEXTURE_POOL_IDLE_FRAMES
+// WARNING: Pooled render textures must not be unloaded with rl_UnloadRenderTexture()
+rl_RenderTexture2D rl_AcquireRenderTexture(int width, int height, int format, bool depth)
 {
-    // NOTE: NPOT textures support check inside function
-    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
-    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
-}
+    rl_RenderTexture2D target = { 0 };
+    int emptyIndex = -1;
 
-// Set texture scaling filter mode
-void rl_SetTextureFilter(rl_Texture2D texture, int filter)
-{
-    switch (filter)
+    // Reuse free render texture matching request
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
     {
-        case TEXTURE_FILTER_POINT:
-        {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+        RenderTexturePoolEntry *entry = &renderTexturePool[i];
 
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-            else
-            {
-                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
-            }
-        } break;
-        case TEXTURE_FILTER_BILINEAR:
+        if (entry->target.id == 0)
         {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
-                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+            if (emptyIndex == -1) emptyIndex = i;
+        }
+        else if (!entry->inUse && (entry->depth == depth) && (entry->target.texture.format == format) &&
+            (entry->target.texture.width == width) && (entry->target.texture.height == height))
+        {
+            entry->inUse = true;
+            entry->fresh = true;
+            entry->idleFrames = 0;
+            return entry->target;
+        }
+    }
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
+    // No empty entry available, evict the longest unused render texture
+    if (emptyIndex == -1)
+    {
+        int maxIdleFrames = -1;
+
+        for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+        {
+            if (!renderTexturePool[i].inUse && (renderTexturePool[i].idleFrames > maxIdleFrames))
             {
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                maxIdleFrames = renderTexturePool[i].idleFrames;
+                emptyIndex = i;
             }
-        } break;
-        case TEXTURE_FILTER_TRILINEAR:
+        }
+
+        if (emptyIndex == -1)
         {
-            if (texture.mipmaps > 1)
-            {
-                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+            TRACELOG(LOG_WARNING, "FBO: Render texture pool is full, %i render textures in use", MAX_RENDER_TEXTURE_POOL);
+            return target;
+        }
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-            else
-            {
-                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+        rl_UnloadRenderTexture(renderTexturePool[emptyIndex].target);
+        renderTexturePool[emptyIndex].target.id = 0;
+    }
 
-                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
-                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
-                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
-            }
-        } break;
-        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
-        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
-        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
-        default: break;
+    target = LoadRenderTextureEx(width, height, format, depth);
+
+    if (target.id > 0)
+    {
+        RenderTexturePoolEntry *entry = &renderTexturePool[emptyIndex];
+        entry->target = target;
+        entry->depth = depth;
+        entry->inUse = true;
+        entry->fresh = true;
+        entry->idleFrames = 0;
     }
+
+    return target;
 }
 
-// Set texture wrapping mode
-void rl_SetTextureWrap(rl_Texture2D texture, int wrap)
+// Return transient render texture to pool before frame end
+// NOTE: Contents must not be required anymore, render texture can be handed out again on next acquire
+void rl_ReleaseRenderTexture(rl_RenderTexture2D target)
 {
-    switch (wrap)
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
     {
-        case TEXTURE_WRAP_REPEAT:
-        {
-            // NOTE: It only works if NPOT textures are supported, i.e. OpenGL ES 2.0 could not support it
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_REPEAT);
-        } break;
-        case TEXTURE_WRAP_CLAMP:
+        if ((target.id > 0) && (renderTexturePool[i].target.id == target.id))
         {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
-        } break;
-        case TEXTURE_WRAP_MIRROR_REPEAT:
+            renderTexturePool[i].inUse = false;
+            return;
+        }
+    }
+
+    TRACELOG(LOG_WARNING, "FBO: [ID %i] Render texture released is not from pool", target.id);
+}
+
+// Recycle render textures handed out for current frame
+// NOTE: Called by rl_EndDrawing(), idle render textures can only be unloaded while graphics context is available
+void UpdateRenderTexturePool(bool unloadIdle)
+{
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+    {
+        RenderTexturePoolEntry *entry = &renderTexturePool[i];
+        if (entry->target.id == 0) continue;
+
+        if (entry->inUse)
         {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_REPEAT);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_REPEAT);
-        } break;
-        case TEXTURE_WRAP_MIRROR_CLAMP:
+            entry->inUse = false;
+            entry->idleFrames = 0;
+        }
+        else entry->idleFrames++;
+
+        if (unloadIdle && (entry->idleFrames > RENDER_TEXTURE_POOL_IDLE_FRAMES))
         {
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_CLAMP);
-            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_CLAMP);
-        } break;
-        default: break;
+            rl_UnloadRenderTexture(entry->target);
+            entry->target.id = 0;
+        }
     }
 }
 
-//------------------------------------------------------------------------------------
-// rl_Texture drawing functions
-//------------------------------------------------------------------------------------
-// Draw a texture
-void rl_DrawTexture(rl_Texture2D texture, int posX, int posY, rl_Color tint)
+// Unload all pooled render textures
+void UnloadRenderTexturePool(void)
 {
-    rl_DrawTextureEx(texture, (rl_Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+    {
+        if (renderTexturePool[i].target.id > 0) rl_UnloadRenderTexture(renderTexturePool[i].target);
+        renderTexturePool[i].target.id = 0;
+        renderTexturePool[i].inUse = false;
+    }
 }
 
-// Draw a texture with position defined as rl_Vector2
-void rl_DrawTextureV(rl_Texture2D texture, rl_Vector2 position, rl_Color tint)
+// Invalidate pooled render texture contents on first pass since acquired
+// NOTE: Tile-based GPUs can skip loading previous contents from memory
+void BeginRenderTexturePoolPass(unsigned int id)
 {
-    rl_DrawTextureEx(texture, position, 0, 1.0f, tint);
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+    {
+        if ((id > 0) && (renderTexturePool[i].target.id == id))
+        {
+            if (renderTexturePool[i].fresh) rlInvalidateFramebuffer(true, renderTexturePool[i].depth);
+            renderTexturePool[i].fresh = false;
+            break;
+        }
+    }
 }
 
-// Draw a texture with extended parameters
-void rl_DrawTextureEx(rl_Texture2D texture, rl_Vector2 position, float rotation, float scale, rl_Color tint)
+// Invalidate pooled render texture depth at pass end
+// NOTE: Transient depth is not required after the pass, tile-based GPUs can skip storing it to memory
+void EndRenderTexturePoolPass(unsigned int id)
 {
-    rl_Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
-    rl_Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
-    rl_Vector2 origin = { 0.0f, 0.0f };
-
-    rl_DrawTexturePro(texture, source, dest, origin, rotation, tint);
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+    {
+        if ((id > 0) && (renderTexturePool[i].target.id == id))
+        {
+            if (renderTexturePool[i].depth) rlInvalidateFramebuffer(false, true);
+            break;
+        }
+    }
 }
 
-// Draw a part of a texture (defined by a rectangle)
-void rl_DrawTextureRec(rl_Texture2D texture, rl_Rectangle source, rl_Vector2 position, rl_Color tint)
+// Close image filters worker threads
+// NOTE: Called by rl_CloseWindow(), threads are created again if a filter requires them
+void CloseImageWorkerThreads(void)
 {
-    rl_Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
-    rl_Vector2 origin = { 0.0f, 0.0f };
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    // Queued image exports are completed first, exports use worker threads
+    pthread_mutex_lock(&imageExportsLock);
+    bool exporting = imageExports.ready;
+    imageExports.quit = true;
+    pthread_cond_signal(&imageExportsCond);
+    pthread_mutex_unlock(&imageExportsLock);
+
+    if (exporting) pthread_join(imageExports.thread, NULL);
+
+    imageExports.ready = false;
+    imageExports.quit = false;
+#endif
+}
 
-    rl_DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
+// Run range tasks on image worker threads, process function is called for chunks of the [0, count) range
+// NOTE: Used by text module for glyphs generation, tasks run on job system worker threads
+void RunImageWorkerTasks(void (*process)(const void *data, int start, int end), const void *data, int count, int chunkSize)
+{
+    WorkerJob job = { process, data, count, chunkSize };
+    RunWorkerJob(&job);
 }
 
-// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
-// NOTE: origin is relative to destination rectangle size
-void rl_DrawTexturePro(rl_Texture2D texture, rl_Rectangle source, rl_Rectangle dest, rl_Vector2 origin, float rotation, rl_Color tint)
+// Unload render texture processing shaders
+// NOTE: Called by rl_CloseWindow(), shaders are loaded again on next processing function
+void UnloadImageShaders(void)
 {
-    // Check if texture is valid
-    if (texture.id > 0)
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (imageShaders.loaded)
     {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+        rl_UnloadShader(imageShaders.nearest);
+        rl_UnloadShader(imageShaders.bilinear);
+        rl_UnloadShader(imageShaders.color);
+        rl_UnloadShader(imageShaders.replace);
+        rl_UnloadShader(imageShaders.blur);
+        rl_UnloadShader(imageShaders.dither);
+        rl_UnloadShader(imageShaders.perlin);
+        rl_UnloadShader(imageShaders.cellular);
+    }
 
-        bool flipX = false;
+    if (imageShaders.perlinTable.id > 0) rlUnloadTexture(imageShaders.perlinTable.id);
+    if (imageShaders.paletteLoaded) rl_UnloadShader(imageShaders.palette);
 
-        if (source.width < 0) { flipX = true; source.width *= -1; }
-        if (source.height < 0) source.y -= source.height;
+    memset(&imageShaders, 0, sizeof(imageShaders));
+#endif
+}
 
-        if (dest.width < 0) dest.width *= -1;
-        if (dest.height < 0) dest.height *= -1;
+// Update texture streams: swap completed uploads, evict levels over budget and request new levels
+// NOTE: Called by rl_EndDrawing(), uploads go through async texture uploads (PBO)
+void UpdateTextureStreams(void)
+{
+    long long residentBytes = 0;
+    int uploadBytes = 0;
 
-        rl_Vector2 topLeft = { 0 };
-        rl_Vector2 topRight = { 0 };
-        rl_Vector2 bottomLeft = { 0 };
-        rl_Vector2 bottomRight = { 0 };
+    for (int i = 0; i < textureStreams.capacity; i++)
+    {
+        TextureStreamEntry *entry = &textureStreams.entries[i];
+        if (entry->image.data == NULL) continue;
 
-        // Only calculate rotation if needed
-        if (rotation == 0.0f)
+        // Swap completed uploads
+        if ((entry->pending.id > 0) && rlIsTextureUploadReady(entry->pending.id))
         {
-            float x = dest.x - origin.x;
-            float y = dest.y - origin.y;
-            topLeft = (rl_Vector2){ x, y };
-            topRight = (rl_Vector2){ x + dest.width, y };
-            bottomLeft = (rl_Vector2){ x, y + dest.height };
-            bottomRight = (rl_Vector2){ x + dest.width, y + dest.height };
+            rlUnloadTexture(entry->texture.id);
+            entry->texture = entry->pending;
+            entry->residentMip = entry->pendingMip;
+            entry->pending = (rl_Texture2D){ 0 };
         }
-        else
+
+        // Requested level is kept for some frames after last request, base level afterwards
+        if (entry->frameRequestedMip >= 0)
         {
-            float sinRotation = sinf(rotation*rl_DEG2RAD);
-            float cosRotation = cosf(rotation*rl_DEG2RAD);
-            float x = dest.x;
-            float y = dest.y;
-            float dx = -origin.x;
-            float dy = -origin.y;
+            entry->requestedMip = (entry->frameRequestedMip < entry->baseMip)? entry->frameRequestedMip : entry->baseMip;
+            entry->idleFrames = 0;
+        }
+        else if (entry->idleFrames <= TEXTURE_STREAM_IDLE_FRAMES) entry->idleFrames++;
+        else entry->requestedMip = entry->baseMip;
 
-            topLeft.x = x + dx*cosRotation - dy*sinRotation;
-            topLeft.y = y + dx*sinRotation + dy*cosRotation;
+        entry->frameRequestedMip = -1;
 
-            topRight.x = x + (dx + dest.width)*cosRotation - dy*sinRotation;
-            topRight.y = y + (dx + dest.width)*sinRotation + dy*cosRotation;
+        residentBytes += GetTextureStreamBytes(entry, entry->residentMip);
+        if (entry->pending.id > 0) residentBytes += GetTextureStreamBytes(entry, entry->pendingMip);
+    }
 
-            bottomLeft.x = x + dx*cosRotation - (dy + dest.height)*sinRotation;
-            bottomLeft.y = y + dx*sinRotation + (dy + dest.height)*cosRotation;
+    // Evict levels while over budget: idle streams first, then levels not requested anymore,
+    // finally requested levels are dropped one level per stream and frame until budget fits
+    if ((textureStreams.budget > 0) && (residentBytes > textureStreams.budget))
+    {
+        for (int pass = 0; (pass < 3) && (residentBytes > textureStreams.budget); pass++)
+        {
+            for (int i = 0; (i < textureStreams.capacity) && (residentBytes > textureStreams.budget); i++)
+            {
+                TextureStreamEntry *entry = &textureStreams.entries[i];
+                if ((entry->image.data == NULL) || (entry->pending.id > 0)) continue;
+                if ((pass == 0) && (entry->idleFrames <= TEXTURE_STREAM_IDLE_FRAMES)) continue;
+
+                int mip = (pass == 2)? entry->residentMip + 1 : entry->requestedMip;
+                if (mip > entry->baseMip) mip = entry->baseMip;
+                if (mip <= entry->residentMip) continue;
+
+                // NOTE: Coarser levels are small, they are uploaded synchronously to release memory at once
+                rl_Texture2D texture = LoadTextureStreamMip(entry, mip, false);
+                if (texture.id == 0) continue;
+
+                residentBytes -= GetTextureStreamBytes(entry, entry->residentMip) - GetTextureStreamBytes(entry, mip);
+                rlUnloadTexture(entry->texture.id);
+                entry->texture = texture;
+                entry->residentMip = mip;
+            }
+        }
+    }
 
-            bottomRight.x = x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
-            bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
+    // Stream in requested levels within budget, upload size per frame is limited
+    for (int i = 0; (i < textureStreams.capacity) && (uploadBytes < TEXTURE_STREAM_UPLOAD_SIZE); i++)
+    {
+        TextureStreamEntry *entry = &textureStreams.entries[i];
+        if ((entry->image.data == NULL) || (entry->pending.id > 0) || (entry->requestedMip >= entry->residentMip)) continue;
+
+        // Finest requested level fitting in budget, current texture is released when upload completes
+        int mip = entry->requestedMip;
+        if (textureStreams.budget > 0)
+        {
+            while ((mip < entry->residentMip) && ((residentBytes + GetTextureStreamBytes(entry, mip)) > textureStreams.budget)) mip++;
         }
 
-        rlSetTexture(texture.id);
-        rlBegin(RL_QUADS);
+        if (mip >= entry->residentMip) continue;
 
-            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+        entry->pending = LoadTextureStreamMip(entry, mip, true);
 
-            // Top-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            else rlTexCoord2f(source.x/width, source.y/height);
-            rlVertex2f(topLeft.x, topLeft.y);
+        if (entry->pending.id > 0)
+        {
+            entry->pendingMip = mip;
+            residentBytes += GetTextureStreamBytes(entry, mip);
+            uploadBytes += (int)GetTextureStreamBytes(entry, mip);
+        }
+    }
+}
 
-            // Bottom-left corner for texture and quad
-            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            rlVertex2f(bottomLeft.x, bottomLeft.y);
+// Unload all texture streams
+void UnloadTextureStreams(void)
+{
+    for (int i = 0; i < textureStreams.capacity; i++)
+    {
+        TextureStreamEntry *entry = &textureStreams.entries[i];
+        if (entry->image.data == NULL) continue;
 
-            // Bottom-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-            rlVertex2f(bottomRight.x, bottomRight.y);
+        if (entry->pending.id > 0) rlUnloadTexture(entry->pending.id);
+        rlUnloadTexture(entry->texture.id);
+        rl_UnloadImage(entry->image);
+    }
 
-            // Top-right corner for texture and quad
-            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-            rlVertex2f(topRight.x, topRight.y);
+    RL_FREE(textureStreams.entries);
+    textureStreams.entries = NULL;
+    textureStreams.capacity = 0;
+}
 
-        rlEnd();
-        rlSetTexture(0);
+// Check if a texture is valid (loaded in GPU)
+bool rl_IsTextureValid(rl_Texture2D texture)
+{
+    bool result = false;
 
-        // NOTE: Vertex position can be transformed using matrices
-        // but the process is way more costly than just calculating
-        // the vertex positions manually, like done above
-        // Old implementation is left here for educational purposes,
-        // just in case someone wants to do some performance test
-        /*
-        rlSetTexture(texture.id);
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+    if ((texture.id > 0) &&         // Validate OpenGL id (texture uplaoded to GPU)
+        (texture.width > 0) &&      // Validate texture width
+        (texture.height > 0) &&     // Validate texture height
+        (texture.format > 0) &&     // Validate texture pixel format
+        (texture.mipmaps > 0)) result = true; // Validate texture mipmaps (at least 1 for basic mipmap level)
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+    return result;
+}
 
-                // Bottom-left corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                else rlTexCoord2f(source.x/width, source.y/height);
-                rlVertex2f(0.0f, 0.0f);
+// Check if a texture async upload has completed (ready to be drawn)
+bool rl_IsTextureReady(rl_Texture2D texture)
+{
+    return (rl_IsTextureValid(texture) && rlIsTextureUploadReady(texture.id));
+}
 
-                // Bottom-right corner for texture and quad
-                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                rlVertex2f(0.0f, dest.height);
+// Unload texture from GPU memory (VRAM)
+void rl_UnloadTexture(rl_Texture2D texture)
+{
+    if (texture.id > 0)
+    {
+#if defined(SUPPORT_SHARED_TEXTURES)
+        // Shared textures are unloaded on last reference release
+        bool released = false;
+        if (ReleaseSharedTexture(texture.id, &released) && !released) return;
+#endif
 
-                // Top-right corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
-                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
-                rlVertex2f(dest.width, dest.height);
+        rlUnloadTexture(texture.id);
 
-                // Top-left corner for texture and quad
-                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
-                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
-                rlVertex2f(dest.width, 0.0f);
-            rlEnd();
-        rlPopMatrix();
-        rlSetTexture(0);
-        */
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture data from VRAM (GPU)", texture.id);
     }
 }
 
-// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
-void rl_DrawTextureNPatch(rl_Texture2D texture, rl_NPatchInfo nPatchInfo, rl_Rectangle dest, rl_Vector2 origin, float rotation, rl_Color tint)
+// Reload shared textures with modified files (hot reload), returns reloaded textures count
+// NOTE: Textures are updated in place (same id), file image must keep texture size
+int rl_ReloadModifiedTextures(void)
 {
-    if (texture.id > 0)
+    int count = 0;
+
+#if defined(SUPPORT_SHARED_TEXTURES)
+    LockSharedTextures();
+
+    for (int i = 0; i < sharedTextures.capacity; i++)
     {
-        float width = (float)texture.width;
-        float height = (float)texture.height;
+        SharedTextureEntry *entry = &sharedTextures.entries[i];
+        if ((entry->key == NULL) || (entry->modTime == 0) || (entry->texture.id == 0)) continue;
 
-        float patchWidth = ((int)dest.width <= 0)? 0.0f : dest.width;
-        float patchHeight = ((int)dest.height <= 0)? 0.0f : dest.height;
+        long modTime = rl_GetFileModTime(entry->key);
+        if ((modTime == 0) || (modTime == entry->modTime)) continue;
 
-        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
-        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
-        if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
-        if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+        entry->modTime = modTime;
 
-        bool drawCenter = true;
-        bool drawMiddle = true;
-        float leftBorder = (float)nPatchInfo.left;
-        float topBorder = (float)nPatchInfo.top;
-        float rightBorder = (float)nPatchInfo.right;
-        float bottomBorder = (float)nPatchInfo.bottom;
+        if (ReloadSharedTexture(entry)) count++;
+    }
 
-        // Adjust the lateral (left and right) border widths in case patchWidth < texture.width
-        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_VERTICAL)
+    UnlockSharedTextures();
+#endif
+
+    return count;
+}
+
+// Get shared texture references count, 0 if texture is not shared
+int rl_GetTextureReferenceCount(rl_Texture2D texture)
+{
+    int refCount = 0;
+
+#if defined(SUPPORT_SHARED_TEXTURES)
+    if (texture.id == 0) return 0;
+
+    LockSharedTextures();
+
+    SharedTextureEntry *entry = FindSharedTextureId(texture.id);
+    if (entry != NULL) refCount = entry->refCount;
+
+    UnlockSharedTextures();
+#endif
+
+    return refCount;
+}
+
+#if defined(SUPPORT_SHARED_TEXTURES)
+// Acquire shared texture by resource key, returns false if resource is not loaded yet
+// NOTE: If resource is being loaded by another thread, function waits for it. On false return,
+// resource is registered as loading by calling thread, StoreSharedTexture() must be called to complete it,
+// returned texture id is 0 if texture upload is pending (see UploadSharedTexture())
+bool AcquireSharedTexture(const char *key, rl_Texture2D *texture)
+{
+    unsigned int hash = GetSharedTextureKeyHash(key);
+    bool result = false;
+
+    LockSharedTextures();
+
+    SharedTextureEntry *entry = FindSharedTexture(key, hash);
+
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    while ((entry != NULL) && entry->loading)
+    {
+        pthread_cond_wait(&sharedTexturesCond, &sharedTexturesLock);
+        entry = FindSharedTexture(key, hash);   // Entry could be removed if loading failed
+    }
+#endif
+
+    if (entry != NULL)
+    {
+        entry->refCount++;
+        *texture = entry->texture;
+        result = true;
+    }
+    else
+    {
+        // Resource registered as loading, other threads loading it wait for StoreSharedTexture()
+        entry = AddSharedTexture(key, hash);
+        *texture = CLITERAL(rl_Texture2D){ 0 };
+    }
+
+    UnlockSharedTextures();
+
+    return result;
+}
+
+// Store shared texture image, completing resource loading started by AcquireSharedTexture()
+// NOTE: Image is owned by function, it is kept until upload if upload is deferred (returned texture id is 0),
+// invalid image removes resource from registry
+rl_Texture2D StoreSharedTexture(const char *key, rl_Image image, bool upload)
+{
+    rl_Texture2D texture = { 0 };
+    unsigned int hash = GetSharedTextureKeyHash(key);
+
+    // Texture is uploaded before locking registry, other resources are not blocked by GPU upload
+    if (upload && (image.data != NULL))
+    {
+        texture = rl_LoadTextureFromImage(image);
+        rl_UnloadImage(image);
+        image = CLITERAL(rl_Image){ 0 };
+    }
+
+    LockSharedTextures();
+
+    SharedTextureEntry *entry = FindSharedTexture(key, hash);
+
+    if (entry != NULL)
+    {
+        if (texture.id > 0)
         {
-            drawCenter = false;
-            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
-            rightBorder = patchWidth - leftBorder;
+            entry->texture = texture;
+            LinkSharedTextureId(entry);
         }
-
-        // Adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
-        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_HORIZONTAL)
+        else if (image.data != NULL)
         {
-            drawMiddle = false;
-            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
-            bottomBorder = patchHeight - topBorder;
+            entry->image = image;
+            entry->texture.width = image.width;
+            entry->texture.height = image.height;
+            entry->texture.mipmaps = image.mipmaps;
+            entry->texture.format = image.format;
+            texture = entry->texture;
+            image = CLITERAL(rl_Image){ 0 };
         }
 
-        rl_Vector2 vertA = { 0 };
-        rl_Vector2 vertB = { 0 };
-        rl_Vector2 vertC = { 0 };
-        rl_Vector2 vertD = { 0 };
-        vertA.x = 0.0f;                             // Outer left
-        vertA.y = 0.0f;                             // Outer top
-        vertB.x = leftBorder;                       // Inner left
-        vertB.y = topBorder;                        // Inner top
-        vertC.x = patchWidth  - rightBorder;        // Inner right
-        vertC.y = patchHeight - bottomBorder;       // Inner bottom
-        vertD.x = patchWidth;                       // Outer right
-        vertD.y = patchHeight;                      // Outer bottom
+        entry->loading = false;
+        entry->modTime = rl_GetFileModTime(key);    // Resources not loaded from a file get 0, they are not reloaded
 
-        rl_Vector2 coordA = { 0 };
-        rl_Vector2 coordB = { 0 };
-        rl_Vector2 coordC = { 0 };
-        rl_Vector2 coordD = { 0 };
-        coordA.x = nPatchInfo.source.x/width;
-        coordA.y = nPatchInfo.source.y/height;
-        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
-        coordB.y = (nPatchInfo.source.y + topBorder)/height;
-        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
-        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
-        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
-        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+        // NOTE: Uploaded textures are stored by main thread, deferred ones are watched on upload
+        if ((entry->texture.id > 0) && (entry->modTime != 0)) WatchAssetFile(key);
+#endif
 
-        rlSetTexture(texture.id);
+        if ((entry->texture.id == 0) && (entry->image.data == NULL)) RemoveSharedTexture(entry);
+    }
 
-        rlPushMatrix();
-            rlTranslatef(dest.x, dest.y, 0.0f);
-            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
-            rlTranslatef(-origin.x, -origin.y, 0.0f);
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    pthread_cond_broadcast(&sharedTexturesCond);
+#endif
 
-            rlBegin(RL_QUADS);
-                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
-                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+    UnlockSharedTextures();
 
-                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
-                {
-                    // ------------------------------------------------------------
-                    // TOP-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // TOP-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
+    rl_UnloadImage(image);
+
+    return texture;
+}
+
+// Upload shared texture image stored by a deferred load, returns uploaded texture
+// NOTE: Texture is uploaded by first call, next calls return it, GPU transfer completes asynchronously
+rl_Texture2D UploadSharedTexture(const char *key)
+{
+    rl_Texture2D texture = { 0 };
+    unsigned int hash = GetSharedTextureKeyHash(key);
+
+    LockSharedTextures();
+
+    SharedTextureEntry *entry = FindSharedTexture(key, hash);
+
+    if (entry != NULL)
+    {
+        if ((entry->texture.id == 0) && (entry->image.data != NULL))
+        {
+            entry->texture = rl_LoadTextureFromImageAsync(entry->image);
+            rl_UnloadImage(entry->image);
+            entry->image = CLITERAL(rl_Image){ 0 };
+
+            if (entry->texture.id > 0) LinkSharedTextureId(entry);
+
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+            if ((entry->texture.id > 0) && (entry->modTime != 0)) WatchAssetFile(key);
+#endif
+        }
+
+        texture = entry->texture;
+    }
+
+    UnlockSharedTextures();
+
+    return texture;
+}
+
+// Unload shared textures registry, textures still referenced are unloaded
+// NOTE: Called by rl_CloseWindow()
+void UnloadSharedTextures(void)
+{
+    LockSharedTextures();
+
+    for (int i = 0; i < sharedTextures.capacity; i++)
+    {
+        SharedTextureEntry *entry = &sharedTextures.entries[i];
+        if (entry->key == NULL) continue;
+
+        if (entry->texture.id > 0) rlUnloadTexture(entry->texture.id);
+        rl_UnloadImage(entry->image);
+        RL_FREE(entry->key);
+    }
+
+    RL_FREE(sharedTextures.entries);
+    RL_FREE(sharedTextures.keyBuckets);
+    RL_FREE(sharedTextures.idBuckets);
+    sharedTextures.entries = NULL;
+    sharedTextures.keyBuckets = NULL;
+    sharedTextures.idBuckets = NULL;
+    sharedTextures.capacity = 0;
+    sharedTextures.freeEntry = -1;
+
+    UnlockSharedTextures();
+}
+
+#if defined(SUPPORT_ASSETS_HOT_RELOAD)
+// Reload shared texture by resource file, returns false if file is not a shared texture
+// NOTE: Called by assets watcher when a watched file changes
+bool ReloadSharedTextureFile(const char *fileName)
+{
+    bool result = false;
+
+    LockSharedTextures();
+
+    SharedTextureEntry *entry = FindSharedTexture(fileName, GetSharedTextureKeyHash(fileName));
+
+    if ((entry != NULL) && (entry->texture.id > 0))
+    {
+        entry->modTime = rl_GetFileModTime(fileName);
+        result = ReloadSharedTexture(entry);
+    }
+
+    UnlockSharedTextures();
+
+    return result;
+}
+#endif
+#endif
+
+// Check if a texture array is valid (loaded in GPU)
+bool rl_IsTextureArrayValid(rl_TextureArray texture)
+{
+    bool result = false;
+
+    if ((texture.id > 0) &&         // Validate OpenGL id (texture uploaded to GPU)
+        (texture.width > 0) &&      // Validate texture width
+        (texture.height > 0) &&     // Validate texture height
+        (texture.layers > 0) &&     // Validate texture layers
+        (texture.format > 0) &&     // Validate texture pixel format
+        (texture.mipmaps > 0)) result = true; // Validate texture mipmaps (at least 1 for basic mipmap level)
+
+    return result;
+}
+
+// Unload texture array from GPU memory (VRAM)
+void rl_UnloadTextureArray(rl_TextureArray texture)
+{
+    if (texture.id > 0)
+    {
+        rlUnloadTexture(texture.id);
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded texture array data from VRAM (GPU)", texture.id);
+    }
+}
+
+// Check if a 3D texture is valid (loaded in GPU)
+bool rl_IsTexture3DValid(rl_Texture3D texture)
+{
+    bool result = false;
+
+    if ((texture.id > 0) &&         // Validate OpenGL id (texture uploaded to GPU)
+        (texture.width > 0) &&      // Validate texture width
+        (texture.height > 0) &&     // Validate texture height
+        (texture.depth > 0) &&      // Validate texture depth
+        (texture.format > 0) &&     // Validate texture pixel format
+        (texture.mipmaps > 0)) result = true; // Validate texture mipmaps (at least 1 for basic mipmap level)
+
+    return result;
+}
+
+// Unload 3D texture from GPU memory (VRAM)
+void rl_UnloadTexture3D(rl_Texture3D texture)
+{
+    if (texture.id > 0)
+    {
+        rlUnloadTexture(texture.id);
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Unloaded 3D texture data from VRAM (GPU)", texture.id);
+    }
+}
+
+// Check if a render texture is valid (loaded in GPU)
+bool rl_IsRenderTextureValid(rl_RenderTexture2D target)
+{
+    bool result = false;
+
+    if ((target.id > 0) &&                  // Validate OpenGL id (loaded on GPU)
+        rl_IsTextureValid(target.depth) &&     // Validate FBO depth texture/renderbuffer attachment
+        rl_IsTextureValid(target.texture)) result = true; // Validate FBO texture attachment
+
+    return result;
+}
+
+// Unload render texture from GPU memory (VRAM)
+void rl_UnloadRenderTexture(rl_RenderTexture2D target)
+{
+    if (target.id > 0)
+    {
+        if (target.texture.id > 0)
+        {
+            // rl_Color texture attached to FBO is deleted
+            rlUnloadTexture(target.texture.id);
+        }
+
+        // NOTE: Depth texture/renderbuffer is automatically
+        // queried and deleted before deleting framebuffer
+        rlUnloadFramebuffer(target.id);
+    }
+}
+
+// Update GPU texture with new data
+// NOTE 1: pixels data must match texture.format
+// NOTE 2: pixels data must contain at least as many pixels as texture
+void rl_UpdateTexture(rl_Texture2D texture, const void *pixels)
+{
+    rlUpdateTexture(texture.id, 0, 0, texture.width, texture.height, texture.format, pixels);
+}
+
+// Update GPU texture rectangle with new data
+// NOTE 1: pixels data must match texture.format
+// NOTE 2: pixels data must contain as many pixels as rec contains
+// NOTE 3: rec must fit completely within texture's width and height
+void rl_UpdateTextureRec(rl_Texture2D texture, rl_Rectangle rec, const void *pixels)
+{
+    rlUpdateTexture(texture.id, (int)rec.x, (int)rec.y, (int)rec.width, (int)rec.height, texture.format, pixels);
+}
+
+// Update GPU texture array layer with new data
+// NOTE: pixels data must match texture.format and contain at least as many pixels as a layer
+void rl_UpdateTextureArrayLayer(rl_TextureArray texture, int layer, const void *pixels)
+{
+    if ((layer < 0) || (layer >= texture.layers))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to update texture array, layer out of bounds (%i)", texture.id, layer);
+        return;
+    }
+
+    rlUpdateTextureArray(texture.id, layer, 0, 0, texture.width, texture.height, texture.format, pixels);
+}
+
+// Update GPU 3D texture with new data
+// NOTE: pixels data must match texture.format and contain all depth slices (one after the other)
+void rl_UpdateTexture3D(rl_Texture3D texture, const void *pixels)
+{
+    rlUpdateTexture3D(texture.id, 0, 0, 0, texture.width, texture.height, texture.depth, texture.format, pixels);
+}
+
+//------------------------------------------------------------------------------------
+// rl_Texture configuration functions
+//------------------------------------------------------------------------------------
+// Generate GPU mipmaps for a texture
+void rl_GenTextureMipmaps(rl_Texture2D *texture)
+{
+#if defined(GRAPHICS_API_OPENGL_11) && !defined(GRAPHICS_API_OPENGL_11_SOFTWARE) && defined(SUPPORT_IMAGE_MANIPULATION)
+    // NOTE: OpenGL 1.1 does not support GPU mipmap generation, levels are generated on CPU from texture data
+    rl_Image image = rl_LoadImageFromTexture(*texture);
+
+    if (image.data != NULL)
+    {
+        rl_ImageMipmaps(&image);
+        rlUpdateTextureMipmaps(texture->id, image.width, image.height, image.format, image.data, image.mipmaps);
+        texture->mipmaps = image.mipmaps;
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Mipmaps generated on CPU, total: %i", texture->id, texture->mipmaps);
+    }
+
+    rl_UnloadImage(image);
+#else
+    // NOTE: NPOT textures support check inside function
+    // On WebGL (OpenGL ES 2.0) NPOT textures support is limited
+    rlGenTextureMipmaps(texture->id, texture->width, texture->height, texture->format, &texture->mipmaps);
+#endif
+}
+
+// Set texture scaling filter mode
+void rl_SetTextureFilter(rl_Texture2D texture, int filter)
+{
+    switch (filter)
+    {
+        case TEXTURE_FILTER_POINT:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_NEAREST - tex filter: POINT, mipmaps filter: POINT (sharp switching between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_NEAREST - tex filter: POINT (no filter), no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            }
+        } break;
+        case TEXTURE_FILTER_BILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST - tex filter: BILINEAR, mipmaps filter: POINT (sharp switching between mipmaps)
+                // Alternative: RL_TEXTURE_FILTER_NEAREST_MIP_LINEAR - tex filter: POINT, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR_MIP_NEAREST);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_TRILINEAR:
+        {
+            if (texture.mipmaps > 1)
+            {
+                // RL_TEXTURE_FILTER_MIP_LINEAR - tex filter: BILINEAR, mipmaps filter: BILINEAR (smooth transition between mipmaps)
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_MIP_LINEAR);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+            else
+            {
+                TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] No mipmaps available for TRILINEAR texture filtering", texture.id);
+
+                // RL_TEXTURE_FILTER_LINEAR - tex filter: BILINEAR, no mipmaps
+                rlTextureParameters(texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_LINEAR);
+                rlTextureParameters(texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_LINEAR);
+            }
+        } break;
+        case TEXTURE_FILTER_ANISOTROPIC_4X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 4); break;
+        case TEXTURE_FILTER_ANISOTROPIC_8X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 8); break;
+        case TEXTURE_FILTER_ANISOTROPIC_16X: rlTextureParameters(texture.id, RL_TEXTURE_FILTER_ANISOTROPIC, 16); break;
+        default: break;
+    }
+}
+
+// Set texture wrapping mode
+void rl_SetTextureWrap(rl_Texture2D texture, int wrap)
+{
+    switch (wrap)
+    {
+        case TEXTURE_WRAP_REPEAT:
+        {
+            // NOTE: It only works if NPOT textures are supported, i.e. OpenGL ES 2.0 could not support it
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_REPEAT);
+        } break;
+        case TEXTURE_WRAP_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
+        } break;
+        case TEXTURE_WRAP_MIRROR_REPEAT:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_REPEAT);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_REPEAT);
+        } break;
+        case TEXTURE_WRAP_MIRROR_CLAMP:
+        {
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_MIRROR_CLAMP);
+            rlTextureParameters(texture.id, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_MIRROR_CLAMP);
+        } break;
+        default: break;
+    }
+}
+
+//------------------------------------------------------------------------------------
+// rl_Texture processing functions
+//------------------------------------------------------------------------------------
+// Load render texture from image data
+// NOTE: Render texture keeps image orientation (first row on top) for processing functions
+rl_RenderTexture2D rl_LoadRenderTextureFromImage(rl_Image image)
+{
+    rl_RenderTexture2D target = { 0 };
+
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0)) return target;
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Render texture can not be loaded from compressed image");
+        return target;
+    }
+
+    target = LoadRenderTextureEx(image.width, image.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, false);
+
+    if (target.id > 0)
+    {
+        if (image.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) rl_UpdateTexture(target.texture, image.data);
+        else
+        {
+            rl_Color *pixels = rl_LoadImageColors(image);
+            rl_UpdateTexture(target.texture, pixels);
+            rl_UnloadImageColors(pixels);
+        }
+    }
+
+    return target;
+}
+
+// Load render texture from texture (copy)
+rl_RenderTexture2D rl_LoadRenderTextureFromTexture(rl_Texture2D texture)
+{
+    rl_RenderTexture2D target = { 0 };
+
+    if ((texture.id == 0) || !LoadImageShaders()) return target;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    target = LoadRenderTextureEx(texture.width, texture.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, false);
+
+    if (target.id > 0)
+    {
+        rl_Rectangle rec = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+
+        SetImageShaderSourceSize(imageShaders.nearest, imageShaders.nearestSizeLoc, texture);
+        ImageShaderPass(target, texture, imageShaders.nearest, rec, rec, (rl_Vector2){ 0.0f, 0.0f }, 0.0f, false);
+    }
+#endif
+
+    return target;
+}
+
+// Crop a render texture to a defined rectangle
+void rl_RenderTextureCrop(rl_RenderTexture2D *target, rl_Rectangle crop)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+    // Security checks to validate crop rectangle
+    if (crop.x < 0) { crop.width += crop.x; crop.x = 0; }
+    if (crop.y < 0) { crop.height += crop.y; crop.y = 0; }
+    if ((crop.x + crop.width) > target->texture.width) crop.width = target->texture.width - crop.x;
+    if ((crop.y + crop.height) > target->texture.height) crop.height = target->texture.height - crop.y;
+    if ((crop.x > target->texture.width) || (crop.y > target->texture.height))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Render texture can not be cropped, crop rectangle out of bounds");
+        return;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rl_RenderTexture2D result = LoadRenderTextureEx((int)crop.width, (int)crop.height, target->texture.format, (target->depth.id > 0));
+
+    if (result.id > 0)
+    {
+        SetImageShaderSourceSize(imageShaders.nearest, imageShaders.nearestSizeLoc, target->texture);
+        ImageShaderPass(result, target->texture, imageShaders.nearest, crop, (rl_Rectangle){ 0.0f, 0.0f, crop.width, crop.height }, (rl_Vector2){ 0.0f, 0.0f }, 0.0f, false);
+        ReplaceRenderTexture(target, result);
+    }
+#endif
+}
+
+// Resize render texture (bilinear filtering)
+// NOTE: Downscaling halves size on pooled render textures first (box filtering), so every source texel contributes
+void rl_RenderTextureResize(rl_RenderTexture2D *target, int newWidth, int newHeight)
+{
+    if ((target->id == 0) || (newWidth <= 0) || (newHeight <= 0) || !LoadImageShaders()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rl_RenderTexture2D result = LoadRenderTextureEx(newWidth, newHeight, target->texture.format, (target->depth.id > 0));
+    if (result.id == 0) return;
+
+    rl_RenderTexture2D source = *target;
+    int width = target->texture.width;
+    int height = target->texture.height;
+
+    while (((width/2) >= newWidth) || ((height/2) >= newHeight))
+    {
+        int halfWidth = ((width/2) >= newWidth)? width/2 : width;
+        int halfHeight = ((height/2) >= newHeight)? height/2 : height;
+
+        rl_RenderTexture2D half = rl_AcquireRenderTexture(halfWidth, halfHeight, target->texture.format, false);
+        if (half.id == 0) break;
+
+        SetImageShaderSourceSize(imageShaders.bilinear, imageShaders.bilinearSizeLoc, source.texture);
+        ImageShaderPass(half, source.texture, imageShaders.bilinear, (rl_Rectangle){ 0.0f, 0.0f, (float)width, (float)height },
+            (rl_Rectangle){ 0.0f, 0.0f, (float)halfWidth, (float)halfHeight }, (rl_Vector2){ 0.0f, 0.0f }, 0.0f, false);
+
+        if (source.id != target->id) rl_ReleaseRenderTexture(source);
+        source = half;
+        width = halfWidth;
+        height = halfHeight;
+    }
+
+    SetImageShaderSourceSize(imageShaders.bilinear, imageShaders.bilinearSizeLoc, source.texture);
+    ImageShaderPass(result, source.texture, imageShaders.bilinear, (rl_Rectangle){ 0.0f, 0.0f, (float)width, (float)height },
+        (rl_Rectangle){ 0.0f, 0.0f, (float)newWidth, (float)newHeight }, (rl_Vector2){ 0.0f, 0.0f }, 0.0f, false);
+
+    if (source.id != target->id) rl_ReleaseRenderTexture(source);
+    ReplaceRenderTexture(target, result);
+#endif
+}
+
+// Resize render texture (Nearest-Neighbor scaling)
+void rl_RenderTextureResizeNN(rl_RenderTexture2D *target, int newWidth, int newHeight)
+{
+    if ((target->id == 0) || (newWidth <= 0) || (newHeight <= 0) || !LoadImageShaders()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rl_RenderTexture2D result = LoadRenderTextureEx(newWidth, newHeight, target->texture.format, (target->depth.id > 0));
+
+    if (result.id > 0)
+    {
+        SetImageShaderSourceSize(imageShaders.nearest, imageShaders.nearestSizeLoc, target->texture);
+        ImageShaderPass(result, target->texture, imageShaders.nearest, (rl_Rectangle){ 0.0f, 0.0f, (float)target->texture.width, (float)target->texture.height },
+            (rl_Rectangle){ 0.0f, 0.0f, (float)newWidth, (float)newHeight }, (rl_Vector2){ 0.0f, 0.0f }, 0.0f, false);
+        ReplaceRenderTexture(target, result);
+    }
+#endif
+}
+
+// Dither render texture data to channels bits per pixel (ordered dithering)
+// NOTE: Render texture keeps its format, channels are quantized to the levels of the requested bpp
+void rl_RenderTextureDither(rl_RenderTexture2D *target, int rBpp, int gBpp, int bBpp, int aBpp)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+    if ((rBpp + gBpp + bBpp + aBpp) > 16)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Unsupported dithering bpps (%ibpp), only 16bpp or lower modes supported", (rBpp + gBpp + bBpp + aBpp));
+        return;
+    }
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    float levels[4] = { (float)((1 << rBpp) - 1), (float)((1 << gBpp) - 1), (float)((1 << bBpp) - 1), (float)((1 << aBpp) - 1) };
+    rl_SetShaderValue(imageShaders.dither, imageShaders.ditherLevelsLoc, levels, SHADER_UNIFORM_VEC4);
+
+    ImageShaderPassSwap(target, imageShaders.dither, (rl_Rectangle){ 0.0f, 0.0f, (float)target->texture.width, (float)target->texture.height });
+#endif
+}
+
+// Flip render texture vertically
+void rl_RenderTextureFlipVertical(rl_RenderTexture2D *target)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    SetImageShaderSourceSize(imageShaders.nearest, imageShaders.nearestSizeLoc, target->texture);
+    ImageShaderPassSwap(target, imageShaders.nearest, (rl_Rectangle){ 0.0f, 0.0f, (float)target->texture.width, -(float)target->texture.height });
+#endif
+}
+
+// Flip render texture horizontally
+void rl_RenderTextureFlipHorizontal(rl_RenderTexture2D *target)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    SetImageShaderSourceSize(imageShaders.nearest, imageShaders.nearestSizeLoc, target->texture);
+    ImageShaderPassSwap(target, imageShaders.nearest, (rl_Rectangle){ 0.0f, 0.0f, -(float)target->texture.width, (float)target->texture.height });
+#endif
+}
+
+// Rotate render texture by input angle in degrees (-359 to 359), bilinear filtering
+// NOTE: Render texture grows to fit rotated contents, new areas are transparent
+void rl_RenderTextureRotate(rl_RenderTexture2D *target, int degrees)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int width = target->texture.width;
+    int height = target->texture.height;
+    float rad = degrees*rl_PI/180.0f;
+    float sinRadius = sinf(rad);
+    float cosRadius = cosf(rad);
+
+    int newWidth = (int)(fabsf(width*cosRadius) + fabsf(height*sinRadius));
+    int newHeight = (int)(fabsf(height*cosRadius) + fabsf(width*sinRadius));
+
+    rl_RenderTexture2D result = LoadRenderTextureEx(newWidth, newHeight, target->texture.format, (target->depth.id > 0));
+
+    if (result.id > 0)
+    {
+        SetImageShaderSourceSize(imageShaders.bilinear, imageShaders.bilinearSizeLoc, target->texture);
+        ImageShaderPass(result, target->texture, imageShaders.bilinear, (rl_Rectangle){ 0.0f, 0.0f, (float)width, (float)height },
+            (rl_Rectangle){ newWidth/2.0f, newHeight/2.0f, (float)width, (float)height }, (rl_Vector2){ width/2.0f, height/2.0f }, (float)degrees, true);
+        ReplaceRenderTexture(target, result);
+    }
+#endif
+}
+
+// Rotate render texture by 90 degrees, clockwise or counter-clockwise
+static void RenderTextureRotate90(rl_RenderTexture2D *target, float rotation)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int width = target->texture.width;
+    int height = target->texture.height;
+
+    rl_RenderTexture2D result = LoadRenderTextureEx(height, width, target->texture.format, (target->depth.id > 0));
+
+    if (result.id > 0)
+    {
+        SetImageShaderSourceSize(imageShaders.nearest, imageShaders.nearestSizeLoc, target->texture);
+        ImageShaderPass(result, target->texture, imageShaders.nearest, (rl_Rectangle){ 0.0f, 0.0f, (float)width, (float)height },
+            (rl_Rectangle){ height/2.0f, width/2.0f, (float)width, (float)height }, (rl_Vector2){ width/2.0f, height/2.0f }, rotation, false);
+        ReplaceRenderTexture(target, result);
+    }
+#endif
+}
+
+// Rotate render texture clockwise 90deg
+void rl_RenderTextureRotateCW(rl_RenderTexture2D *target)
+{
+    RenderTextureRotate90(target, 90.0f);
+}
+
+// Rotate render texture counter-clockwise 90deg
+void rl_RenderTextureRotateCCW(rl_RenderTexture2D *target)
+{
+    RenderTextureRotate90(target, -90.0f);
+}
+
+// Apply Gaussian blur to render texture, same blur size as rl_ImageBlurGaussian()
+// NOTE: Separable passes (horizontal, vertical) with alpha premultiplied, large radius is split in several passes
+void rl_RenderTextureBlurGaussian(rl_RenderTexture2D *target, int blurSize)
+{
+    if ((target->id == 0) || (blurSize <= 0) || !LoadImageShaders()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Gaussian matching box blur iterations variance
+    float sigma = sqrtf(GAUSSIAN_BLUR_ITERATIONS*(float)(blurSize*blurSize + blurSize)/3.0f);
+    int radius = (int)ceilf(3.0f*sigma);
+
+    // Variances of successive gaussian passes add up
+    int passCount = 1;
+    if (radius > IMAGE_BLUR_MAX_RADIUS)
+    {
+        passCount = (radius*radius + IMAGE_BLUR_MAX_RADIUS*IMAGE_BLUR_MAX_RADIUS - 1)/(IMAGE_BLUR_MAX_RADIUS*IMAGE_BLUR_MAX_RADIUS);
+        sigma /= sqrtf((float)passCount);
+        radius = (int)ceilf(3.0f*sigma);
+        if (radius > IMAGE_BLUR_MAX_RADIUS) radius = IMAGE_BLUR_MAX_RADIUS;
+    }
+
+    float weights[IMAGE_BLUR_MAX_RADIUS + 1] = { 0 };
+    for (int i = 0; i <= radius; i++) weights[i] = expf(-(float)(i*i)/(2.0f*sigma*sigma));
+
+    rl_SetShaderValue(imageShaders.blur, imageShaders.blurRadiusLoc, &radius, SHADER_UNIFORM_INT);
+    rl_SetShaderValueV(imageShaders.blur, imageShaders.blurWeightsLoc, weights, SHADER_UNIFORM_FLOAT, IMAGE_BLUR_MAX_RADIUS + 1);
+
+    rl_Rectangle rec = { 0.0f, 0.0f, (float)target->texture.width, (float)target->texture.height };
+    float horizontalStep[2] = { 1.0f/target->texture.width, 0.0f };
+    float verticalStep[2] = { 0.0f, 1.0f/target->texture.height };
+
+    for (int i = 0; i < passCount; i++)
+    {
+        float premultiply = (i == 0)? 1.0f : 0.0f;
+        rl_SetShaderValue(imageShaders.blur, imageShaders.blurPremultiplyLoc, &premultiply, SHADER_UNIFORM_FLOAT);
+        rl_SetShaderValue(imageShaders.blur, imageShaders.blurUnpremultiplyLoc, &(float){ 0.0f }, SHADER_UNIFORM_FLOAT);
+        rl_SetShaderValue(imageShaders.blur, imageShaders.blurStepLoc, horizontalStep, SHADER_UNIFORM_VEC2);
+        ImageShaderPassSwap(target, imageShaders.blur, rec);
+
+        float unpremultiply = (i == (passCount - 1))? 1.0f : 0.0f;
+        rl_SetShaderValue(imageShaders.blur, imageShaders.blurPremultiplyLoc, &(float){ 0.0f }, SHADER_UNIFORM_FLOAT);
+        rl_SetShaderValue(imageShaders.blur, imageShaders.blurUnpremultiplyLoc, &unpremultiply, SHADER_UNIFORM_FLOAT);
+        rl_SetShaderValue(imageShaders.blur, imageShaders.blurStepLoc, verticalStep, SHADER_UNIFORM_VEC2);
+        ImageShaderPassSwap(target, imageShaders.blur, rec);
+    }
+#endif
+}
+
+// Modify render texture color: tint
+void rl_RenderTextureColorTint(rl_RenderTexture2D *target, rl_Color color)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+    rl_Matrix matrix = { 0 };
+    matrix.m0 = (float)color.r/255.0f;
+    matrix.m5 = (float)color.g/255.0f;
+    matrix.m10 = (float)color.b/255.0f;
+    matrix.m15 = (float)color.a/255.0f;
+
+    ImageColorPass(target, matrix, (rl_Vector4){ 0.0f, 0.0f, 0.0f, 0.0f });
+}
+
+// Modify render texture color: invert
+void rl_RenderTextureColorInvert(rl_RenderTexture2D *target)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+    rl_Matrix matrix = { 0 };
+    matrix.m0 = -1.0f;
+    matrix.m5 = -1.0f;
+    matrix.m10 = -1.0f;
+    matrix.m15 = 1.0f;
+
+    ImageColorPass(target, matrix, (rl_Vector4){ 1.0f, 1.0f, 1.0f, 0.0f });
+}
+
+// Modify render texture color: grayscale
+// NOTE: Same luminance weights as rl_ImageColorGrayscale(), result is opaque
+void rl_RenderTextureColorGrayscale(rl_RenderTexture2D *target)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+    // Matrix element (row, column) is m[column*4 + row]
+    rl_Matrix matrix = { 0 };
+    matrix.m0 = 0.299f; matrix.m4 = 0.587f; matrix.m8 = 0.114f;
+    matrix.m1 = 0.299f; matrix.m5 = 0.587f; matrix.m9 = 0.114f;
+    matrix.m2 = 0.299f; matrix.m6 = 0.587f; matrix.m10 = 0.114f;
+
+    ImageColorPass(target, matrix, (rl_Vector4){ 0.0f, 0.0f, 0.0f, 1.0f });
+}
+
+// Modify render texture color: contrast
+// NOTE: Contrast values between -100 and 100
+void rl_RenderTextureColorContrast(rl_RenderTexture2D *target, float contrast)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+    if (contrast < -100) contrast = -100;
+    if (contrast > 100) contrast = 100;
+
+    float factor = (100.0f + contrast)/100.0f;
+    factor *= factor;
+
+    rl_Matrix matrix = { 0 };
+    matrix.m0 = factor;
+    matrix.m5 = factor;
+    matrix.m10 = factor;
+    matrix.m15 = 1.0f;
+
+    float offset = 0.5f - 0.5f*factor;
+    ImageColorPass(target, matrix, (rl_Vector4){ offset, offset, offset, 0.0f });
+}
+
+// Modify render texture color: brightness
+// NOTE: Brightness values between -255 and 255
+void rl_RenderTextureColorBrightness(rl_RenderTexture2D *target, int brightness)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+    if (brightness < -255) brightness = -255;
+    if (brightness > 255) brightness = 255;
+
+    rl_Matrix matrix = { 0 };
+    matrix.m0 = 1.0f;
+    matrix.m5 = 1.0f;
+    matrix.m10 = 1.0f;
+    matrix.m15 = 1.0f;
+
+    float offset = (float)brightness/255.0f;
+    ImageColorPass(target, matrix, (rl_Vector4){ offset, offset, offset, 0.0f });
+}
+
+// Modify render texture color: replace color
+void rl_RenderTextureColorReplace(rl_RenderTexture2D *target, rl_Color color, rl_Color replace)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rl_Vector4 colorNormalized = rl_ColorNormalize(color);
+    rl_Vector4 replaceNormalized = rl_ColorNormalize(replace);
+    rl_SetShaderValue(imageShaders.replace, imageShaders.replaceColorLoc, &colorNormalized, SHADER_UNIFORM_VEC4);
+    rl_SetShaderValue(imageShaders.replace, imageShaders.replaceLoc, &replaceNormalized, SHADER_UNIFORM_VEC4);
+
+    ImageShaderPassSwap(target, imageShaders.replace, (rl_Rectangle){ 0.0f, 0.0f, (float)target->texture.width, (float)target->texture.height });
+#endif
+}
+
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Generate perlin noise into render texture, same noise as rl_GenImagePerlinNoise()
+// NOTE: Render texture contents are replaced, noise is generated on GPU for its size
+void rl_RenderTexturePerlinNoise(rl_RenderTexture2D *target, int offsetX, int offsetY, float scale)
+{
+    if ((target->id == 0) || !LoadImageShaders()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Permutation table texture, loaded on first use
+    if (imageShaders.perlinTable.id == 0)
+    {
+        unsigned char table[512*2*4] = { 0 };
+
+        for (int i = 0; i < 512; i++)
+        {
+            const float *gradient = perlinGradients[stb__perlin_randtab_grad_idx[i]];
+
+            table[i*4] = stb__perlin_randtab[i];
+            table[(512 + i)*4] = (unsigned char)(gradient[0] + 1.0f);
+            table[(512 + i)*4 + 1] = (unsigned char)(gradient[1] + 1.0f);
+            table[(512 + i)*4 + 2] = (unsigned char)(gradient[2] + 1.0f);
+        }
+
+        imageShaders.perlinTable.id = rlLoadTexture(table, 512, 2, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+        imageShaders.perlinTable.width = 512;
+        imageShaders.perlinTable.height = 2;
+        imageShaders.perlinTable.mipmaps = 1;
+        imageShaders.perlinTable.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    }
+
+    int width = target->texture.width;
+    int height = target->texture.height;
+    float aspectRatio = (float)width/(float)height;
+
+    // Apply aspect ratio compensation to wider side
+    float noiseOffset[2] = { (float)offsetX, (float)offsetY };
+    float noiseScale[2] = { scale/(float)width, scale/(float)height };
+    if (width > height) noiseScale[0] *= aspectRatio;
+    else noiseScale[1] /= aspectRatio;
+
+    rl_SetShaderValue(imageShaders.perlin, imageShaders.perlinOffsetLoc, noiseOffset, SHADER_UNIFORM_VEC2);
+    rl_SetShaderValue(imageShaders.perlin, imageShaders.perlinScaleLoc, noiseScale, SHADER_UNIFORM_VEC2);
+
+    ImageShaderPass(*target, imageShaders.perlinTable, imageShaders.perlin, (rl_Rectangle){ 0.0f, 0.0f, 512.0f, 2.0f },
+        (rl_Rectangle){ 0.0f, 0.0f, (float)width, (float)height }, (rl_Vector2){ 0.0f, 0.0f }, 0.0f, false);
+#endif
+}
+
+// Generate cellular noise into render texture, bigger tileSize means bigger cells
+// NOTE: Seeds are generated on CPU (same random sequence as rl_GenImageCellular()), distances on GPU
+void rl_RenderTextureCellular(rl_RenderTexture2D *target, int tileSize)
+{
+    if ((target->id == 0) || (tileSize <= 0) || !LoadImageShaders()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    int width = target->texture.width;
+    int height = target->texture.height;
+    int seedsPerRow = width/tileSize;
+    int seedsPerCol = height/tileSize;
+
+    if ((seedsPerRow == 0) || (seedsPerCol == 0))
+    {
+        // No seed fits, every pixel is at maximum distance
+        rl_BeginTextureMode(*target);
+        rl_ClearBackground(rl_WHITE);
+        rl_EndTextureMode();
+        return;
+    }
+
+    // Seeds positions within tiles as 16 bit values
+    unsigned char *seeds = (unsigned char *)RL_MALLOC(seedsPerRow*seedsPerCol*4);
+
+    for (int i = 0; i < seedsPerRow*seedsPerCol; i++)
+    {
+        int y = rl_GetRandomValue(0, tileSize - 1);
+        int x = rl_GetRandomValue(0, tileSize - 1);
+
+        seeds[i*4] = (unsigned char)(x >> 8);
+        seeds[i*4 + 1] = (unsigned char)(x & 0xff);
+        seeds[i*4 + 2] = (unsigned char)(y >> 8);
+        seeds[i*4 + 3] = (unsigned char)(y & 0xff);
+    }
+
+    rl_Texture2D seedsTexture = { 0 };
+    seedsTexture.id = rlLoadTexture(seeds, seedsPerRow, seedsPerCol, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    seedsTexture.width = seedsPerRow;
+    seedsTexture.height = seedsPerCol;
+    seedsTexture.mipmaps = 1;
+    seedsTexture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    RL_FREE(seeds);
+
+    float seedCount[2] = { (float)seedsPerRow, (float)seedsPerCol };
+    float size = (float)tileSize;
+    rl_SetShaderValue(imageShaders.cellular, imageShaders.cellularCountLoc, seedCount, SHADER_UNIFORM_VEC2);
+    rl_SetShaderValue(imageShaders.cellular, imageShaders.cellularSizeLoc, &size, SHADER_UNIFORM_FLOAT);
+
+    if (seedsTexture.id > 0)
+    {
+        ImageShaderPass(*target, seedsTexture, imageShaders.cellular, (rl_Rectangle){ 0.0f, 0.0f, (float)seedsPerRow, (float)seedsPerCol },
+            (rl_Rectangle){ 0.0f, 0.0f, (float)width, (float)height }, (rl_Vector2){ 0.0f, 0.0f }, 0.0f, false);
+
+        rlUnloadTexture(seedsTexture.id);
+    }
+#endif
+}
+#endif      // SUPPORT_IMAGE_GENERATION
+
+//------------------------------------------------------------------------------------
+// rl_Texture palette functions
+//------------------------------------------------------------------------------------
+// Load palette texture for indexed textures drawing
+// NOTE: Palette texture is TEXTURE_PALETTE_SIZE x 1 (RGBA8), entries not provided are rl_BLANK
+rl_Texture2D rl_LoadTexturePalette(const rl_Color *colors, int colorCount)
+{
+    rl_Texture2D palette = { 0 };
+    rl_Color entries[TEXTURE_PALETTE_SIZE] = { 0 };
+
+    if (colorCount > TEXTURE_PALETTE_SIZE) colorCount = TEXTURE_PALETTE_SIZE;
+    if ((colors != NULL) && (colorCount > 0)) memcpy(entries, colors, colorCount*sizeof(rl_Color));
+
+    palette.id = rlLoadTexture(entries, TEXTURE_PALETTE_SIZE, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+
+    if (palette.id > 0)
+    {
+        palette.width = TEXTURE_PALETTE_SIZE;
+        palette.height = 1;
+        palette.mipmaps = 1;
+        palette.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    }
+    else TRACELOG(LOG_WARNING, "TEXTURE: Failed to load palette texture");
+
+    return palette;
+}
+
+// Update palette texture colors, entries not provided are rl_BLANK
+// NOTE: Palette in use by current palette mode is drawn with previous colors up to this call
+void rl_UpdateTexturePalette(rl_Texture2D palette, const rl_Color *colors, int colorCount)
+{
+    if ((palette.id == 0) || (palette.width != TEXTURE_PALETTE_SIZE) || (palette.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) return;
+
+    rl_Color entries[TEXTURE_PALETTE_SIZE] = { 0 };
+
+    if (colorCount > TEXTURE_PALETTE_SIZE) colorCount = TEXTURE_PALETTE_SIZE;
+    if ((colors != NULL) && (colorCount > 0)) memcpy(entries, colors, colorCount*sizeof(rl_Color));
+
+    rlDrawRenderBatchActive();      // Draws queued with previous colors are drawn first
+    rlUpdateTexture(palette.id, 0, 0, TEXTURE_PALETTE_SIZE, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, entries);
+}
+
+// Begin palette mode, textures drawn are indexed textures looked up in palette texture
+// NOTE: Indexed textures must use point filtering and no mipmaps, swapping palettes between
+// draws only changes palette sampler (render batch is drawn, index textures are kept)
+void rl_BeginPaletteMode(rl_Texture2D palette)
+{
+    if ((palette.id == 0) || !LoadPaletteShader()) return;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlDrawRenderBatchActive();      // Draws queued with previous palette are drawn first
+
+    rl_BeginShaderMode(imageShaders.palette);
+    rl_SetShaderValueTexture(imageShaders.palette, imageShaders.paletteLoc, palette);
+#endif
+}
+
+// End palette mode (returns to default shader)
+void rl_EndPaletteMode(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (imageShaders.paletteReady) rl_EndShaderMode();
+#endif
+}
+
+//------------------------------------------------------------------------------------
+// rl_Texture streaming functions
+//------------------------------------------------------------------------------------
+// Load texture stream from file
+rl_TextureStream rl_LoadTextureStream(const char *fileName)
+{
+    rl_TextureStream stream = { 0 };
+    rl_Image image = rl_LoadImage(fileName);
+
+    if (image.data != NULL)
+    {
+        stream = rl_LoadTextureStreamFromImage(image);
+        rl_UnloadImage(image);
+    }
+
+    return stream;
+}
+
+// Load texture stream from image data
+// NOTE: Image is copied (mipmaps generated if missing), low mipmaps (up to TEXTURE_STREAM_MIN_SIZE) are
+// uploaded on load, higher mipmaps are uploaded asynchronously when requested, within streaming budget
+rl_TextureStream rl_LoadTextureStreamFromImage(rl_Image image)
+{
+    rl_TextureStream stream = { 0 };
+
+    if ((image.data == NULL) || (image.width == 0) || (image.height == 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Data is not valid to load texture stream");
+        return stream;
+    }
+
+    rl_Image source = { 0 };
+    if (!LoadTextureCompressedImage(image, &source)) source = rl_ImageCopy(image);
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+    if ((source.mipmaps == 1) && (source.format < PIXELFORMAT_COMPRESSED_DXT1_RGB)) rl_ImageMipmaps(&source);
+#endif
+
+    // Find free stream entry, streams array grows as required
+    int index = -1;
+    for (int i = 0; i < textureStreams.capacity; i++)
+    {
+        if (textureStreams.entries[i].image.data == NULL) { index = i; break; }
+    }
+
+    if (index == -1)
+    {
+        int capacity = (textureStreams.capacity == 0)? 32 : textureStreams.capacity*2;
+        TextureStreamEntry *entries = (TextureStreamEntry *)RL_REALLOC(textureStreams.entries, capacity*sizeof(TextureStreamEntry));
+
+        if (entries == NULL)
+        {
+            TRACELOG(LOG_WARNING, "TEXTURE: Failed to allocate texture streams");
+            rl_UnloadImage(source);
+            return stream;
+        }
+
+        memset(entries + textureStreams.capacity, 0, (capacity - textureStreams.capacity)*sizeof(TextureStreamEntry));
+        index = textureStreams.capacity;
+        textureStreams.entries = entries;
+        textureStreams.capacity = capacity;
+    }
+
+    TextureStreamEntry *entry = &textureStreams.entries[index];
+    memset(entry, 0, sizeof(TextureStreamEntry));
+    entry->image = source;
+
+    // Low mipmaps are always resident
+    entry->baseMip = source.mipmaps - 1;
+    for (int i = 0, width = source.width, height = source.height; i < source.mipmaps; i++)
+    {
+        if ((width <= TEXTURE_STREAM_MIN_SIZE) && (height <= TEXTURE_STREAM_MIN_SIZE)) { entry->baseMip = i; break; }
+
+        width = (width/2 < 1)? 1 : width/2;
+        height = (height/2 < 1)? 1 : height/2;
+    }
+
+    entry->texture = LoadTextureStreamMip(entry, entry->baseMip, false);
+    entry->residentMip = entry->baseMip;
+    entry->requestedMip = entry->baseMip;
+    entry->frameRequestedMip = -1;
+    entry->idleFrames = TEXTURE_STREAM_IDLE_FRAMES + 1;
+
+    if (entry->texture.id == 0)
+    {
+        rl_UnloadImage(entry->image);
+        memset(entry, 0, sizeof(TextureStreamEntry));
+        return stream;
+    }
+
+    stream.id = index + 1;
+    stream.width = source.width;
+    stream.height = source.height;
+    stream.mipmaps = source.mipmaps;
+    stream.format = source.format;
+
+    return stream;
+}
+
+// Check if a texture stream is valid (loaded)
+bool rl_IsTextureStreamValid(rl_TextureStream stream)
+{
+    return (GetTextureStreamEntry(stream) != NULL);
+}
+
+// Unload texture stream, resident and pending textures are unloaded from GPU memory
+void rl_UnloadTextureStream(rl_TextureStream stream)
+{
+    TextureStreamEntry *entry = GetTextureStreamEntry(stream);
+    if (entry == NULL) return;
+
+    if (entry->pending.id > 0) rlUnloadTexture(entry->pending.id);
+    rlUnloadTexture(entry->texture.id);
+    rl_UnloadImage(entry->image);
+    memset(entry, 0, sizeof(TextureStreamEntry));
+}
+
+// Request texture stream mipmap level covering an on-screen size (in pixels)
+// NOTE: Finest level requested along the frame is streamed, levels not requested for some frames can be evicted
+void rl_RequestTextureStreamSize(rl_TextureStream stream, float screenWidth, float screenHeight)
+{
+    TextureStreamEntry *entry = GetTextureStreamEntry(stream);
+    if (entry == NULL) return;
+
+    // Finest mipmap level still not smaller than on-screen size
+    int mip = 0;
+    if ((screenWidth > 0.0f) && (screenHeight > 0.0f))
+    {
+        float ratio = fminf(entry->image.width/screenWidth, entry->image.height/screenHeight);
+        if (ratio > 1.0f) mip = (int)floorf(log2f(ratio));
+    }
+    else mip = entry->image.mipmaps - 1;
+
+    if (mip > entry->image.mipmaps - 1) mip = entry->image.mipmaps - 1;
+    if ((entry->frameRequestedMip == -1) || (mip < entry->frameRequestedMip)) entry->frameRequestedMip = mip;
+}
+
+// Get texture stream resident texture
+// NOTE: Texture size is the resident mipmap level size, texture changes when levels are streamed in or evicted
+rl_Texture2D rl_GetTextureStreamTexture(rl_TextureStream stream)
+{
+    TextureStreamEntry *entry = GetTextureStreamEntry(stream);
+
+    return (entry != NULL)? entry->texture : (rl_Texture2D){ 0 };
+}
+
+// Set texture streaming VRAM budget (in bytes, 0 for no budget)
+void rl_SetTextureStreamBudget(long long bytes)
+{
+    textureStreams.budget = bytes;
+}
+
+// Get texture streaming stats (resident and requested bytes)
+rl_TextureStreamStats rl_GetTextureStreamStats(void)
+{
+    rl_TextureStreamStats stats = { 0 };
+    stats.budgetBytes = textureStreams.budget;
+
+    for (int i = 0; i < textureStreams.capacity; i++)
+    {
+        TextureStreamEntry *entry = &textureStreams.entries[i];
+        if (entry->image.data == NULL) continue;
+
+        stats.streamCount++;
+        stats.residentBytes += GetTextureStreamBytes(entry, entry->residentMip);
+        stats.requestedBytes += GetTextureStreamBytes(entry, entry->requestedMip);
+
+        if (entry->pending.id > 0)
+        {
+            stats.pendingUploads++;
+            stats.residentBytes += GetTextureStreamBytes(entry, entry->pendingMip);
+        }
+    }
+
+    return stats;
+}
+
+// Draw a part of a texture stream defined by a rectangle with 'pro' parameters
+// NOTE: Source rectangle is defined in full resolution pixels, mipmap level for destination size is requested
+// WARNING: Destination size is used as on-screen size, use rl_RequestTextureStreamSize() if a camera scales it
+void rl_DrawTextureStream(rl_TextureStream stream, rl_Rectangle source, rl_Rectangle dest, rl_Vector2 origin, float rotation, rl_Color tint)
+{
+    TextureStreamEntry *entry = GetTextureStreamEntry(stream);
+    if ((entry == NULL) || (source.width == 0.0f) || (source.height == 0.0f)) return;
+
+    rl_RequestTextureStreamSize(stream, fabsf(dest.width*entry->image.width/source.width), fabsf(dest.height*entry->image.height/source.height));
+
+    // Source rectangle scaled to resident mipmap level size
+    float scaleX = (float)entry->texture.width/entry->image.width;
+    float scaleY = (float)entry->texture.height/entry->image.height;
+    rl_Rectangle scaled = { source.x*scaleX, source.y*scaleY, source.width*scaleX, source.height*scaleY };
+
+    rl_DrawTexturePro(entry->texture, scaled, dest, origin, rotation, tint);
+}
+
+//------------------------------------------------------------------------------------
+// rl_Texture atlas functions
+//------------------------------------------------------------------------------------
+// Load texture atlas, images are packed at runtime in a single texture (RGBA8) to batch their drawing
+// NOTE: Atlas pixels are kept in RAM, defragmentation repacks images without GPU readback
+rl_TextureAtlas rl_LoadTextureAtlas(int width, int height)
+{
+    rl_TextureAtlas atlas = { 0 };
+
+    if ((width <= 0) || (height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Failed to load atlas, invalid size (%ix%i)", width, height);
+        return atlas;
+    }
+
+    int index = 0;
+    while ((index < textureAtlases.capacity) && (textureAtlases.atlases[index].image.data != NULL)) index++;
+
+    if (index == textureAtlases.capacity)
+    {
+        int capacity = (textureAtlases.capacity == 0)? 8 : textureAtlases.capacity*2;
+        TextureAtlasData *atlases = (TextureAtlasData *)RL_REALLOC(textureAtlases.atlases, capacity*sizeof(TextureAtlasData));
+        if (atlases == NULL) return atlas;
+
+        memset(atlases + textureAtlases.capacity, 0, (capacity - textureAtlases.capacity)*sizeof(TextureAtlasData));
+        textureAtlases.atlases = atlases;
+        textureAtlases.capacity = capacity;
+    }
+
+    TextureAtlasData *data = &textureAtlases.atlases[index];
+
+    data->image.data = RL_CALLOC(width*height, 4);
+    data->context = (stbrp_context *)RL_MALLOC(sizeof(stbrp_context));
+    data->nodes = (stbrp_node *)RL_MALLOC(width*sizeof(stbrp_node));
+
+    if ((data->image.data == NULL) || (data->context == NULL) || (data->nodes == NULL))
+    {
+        RL_FREE(data->image.data);
+        RL_FREE(data->context);
+        RL_FREE(data->nodes);
+        *data = (TextureAtlasData){ 0 };
+        return atlas;
+    }
+
+    data->image.width = width;
+    data->image.height = height;
+    data->image.mipmaps = 1;
+    data->image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+
+    // NOTE: Atlas texture is not compressed, it is updated by regions
+    data->texture.id = rlLoadTexture(data->image.data, width, height, data->image.format, 1);
+    data->texture.width = width;
+    data->texture.height = height;
+    data->texture.mipmaps = 1;
+    data->texture.format = data->image.format;
+
+    stbrp_init_target(data->context, width, height, data->nodes, width);
+
+    atlas.id = index + 1;
+    atlas.texture = data->texture;
+
+    TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Atlas loaded successfully (%ix%i)", data->texture.id, width, height);
+
+    return atlas;
+}
+
+// Check if a texture atlas is valid (loaded)
+bool rl_IsTextureAtlasValid(rl_TextureAtlas atlas)
+{
+    return (GetTextureAtlasData(atlas) != NULL);
+}
+
+// Unload texture atlas from RAM and VRAM
+void rl_UnloadTextureAtlas(rl_TextureAtlas atlas)
+{
+    TextureAtlasData *data = GetTextureAtlasData(atlas);
+    if (data == NULL) return;
+
+    rlUnloadTexture(data->texture.id);
+    rl_UnloadImage(data->image);
+    RL_FREE(data->context);
+    RL_FREE(data->nodes);
+    RL_FREE(data->entries);
+
+    *data = (TextureAtlasData){ 0 };
+}
+
+// Add image to texture atlas, returns atlas entry id (0 if image does not fit)
+// NOTE: Atlas is defragmented if image does not fit and removed images released some space
+int rl_AddTextureAtlasImage(rl_TextureAtlas atlas, rl_Image image)
+{
+    TextureAtlasData *data = GetTextureAtlasData(atlas);
+    if ((data == NULL) || (image.data == NULL) || (image.width <= 0) || (image.height <= 0)) return 0;
+
+    stbrp_rect rect = { 0 };
+    rect.w = image.width + TEXTURE_ATLAS_PADDING;
+    rect.h = image.height + TEXTURE_ATLAS_PADDING;
+
+    stbrp_pack_rects(data->context, &rect, 1);
+
+    if (!rect.was_packed && (data->freedArea > 0) && DefragTextureAtlasData(data)) stbrp_pack_rects(data->context, &rect, 1);
+
+    if (!rect.was_packed)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Image does not fit in atlas (%ix%i)", data->texture.id, image.width, image.height);
+        return 0;
+    }
+
+    // Atlas image is RGBA8, other formats are converted
+    rl_Image pixels = image;
+
+    if ((image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) || (image.mipmaps > 1))
+    {
+        pixels = rl_ImageCopy(image);
+        pixels.mipmaps = 1;
+        rl_ImageFormat(&pixels, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+
+    int index = -1;
+
+    if ((pixels.data != NULL) && (pixels.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+    {
+        index = 0;
+        while ((index < data->entryCount) && data->entries[index].used) index++;
+
+        if (index == data->entryCount)
+        {
+            int entryCount = (data->entryCount == 0)? 32 : data->entryCount*2;
+            TextureAtlasEntry *entries = (TextureAtlasEntry *)RL_REALLOC(data->entries, entryCount*sizeof(TextureAtlasEntry));
+
+            if (entries != NULL)
+            {
+                memset(entries + data->entryCount, 0, (entryCount - data->entryCount)*sizeof(TextureAtlasEntry));
+                data->entries = entries;
+                data->entryCount = entryCount;
+            }
+            else index = -1;
+        }
+    }
+
+    if (index >= 0)
+    {
+        TextureAtlasEntry *entry = &data->entries[index];
+        entry->rec = (rl_Rectangle){ (float)rect.x, (float)rect.y, (float)image.width, (float)image.height };
+        entry->used = true;
+
+        for (int y = 0; y < image.height; y++)
+        {
+            memcpy((unsigned char *)data->image.data + ((rect.y + y)*data->image.width + rect.x)*4, (unsigned char *)pixels.data + y*image.width*4, image.width*4);
+        }
+
+        // Only the new image region is uploaded
+        rlUpdateTexture(data->texture.id, rect.x, rect.y, image.width, image.height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, pixels.data);
+    }
+    else
+    {
+        // Space packed for image is released on next defragmentation
+        data->freedArea += rect.w*rect.h;
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to add image to atlas", data->texture.id);
+    }
+
+    if (pixels.data != image.data) rl_UnloadImage(pixels);
+
+    return index + 1;
+}
+
+// Remove image from texture atlas, its space is reclaimed on defragmentation
+void rl_RemoveTextureAtlasImage(rl_TextureAtlas atlas, int entryId)
+{
+    TextureAtlasData *data = GetTextureAtlasData(atlas);
+    if ((data == NULL) || (entryId <= 0) || (entryId > data->entryCount) || !data->entries[entryId - 1].used) return;
+
+    TextureAtlasEntry *entry = &data->entries[entryId - 1];
+
+    data->freedArea += ((int)entry->rec.width + TEXTURE_ATLAS_PADDING)*((int)entry->rec.height + TEXTURE_ATLAS_PADDING);
+    *entry = (TextureAtlasEntry){ 0 };
+}
+
+// Get texture atlas image rectangle (pixels), to be used as source rectangle drawing atlas texture
+// NOTE: Rectangles change on defragmentation, get them again after adding images
+rl_Rectangle rl_GetTextureAtlasRect(rl_TextureAtlas atlas, int entryId)
+{
+    rl_Rectangle rec = { 0 };
+    TextureAtlasData *data = GetTextureAtlasData(atlas);
+
+    if ((data != NULL) && (entryId > 0) && (entryId <= data->entryCount) && data->entries[entryId - 1].used) rec = data->entries[entryId - 1].rec;
+
+    return rec;
+}
+
+// Defragment texture atlas, repacking images to reclaim space of removed images
+// NOTE: Full atlas texture is uploaded again, returns false if images could not be repacked
+bool rl_DefragTextureAtlas(rl_TextureAtlas atlas)
+{
+    TextureAtlasData *data = GetTextureAtlasData(atlas);
+
+    return (data != NULL)? DefragTextureAtlasData(data) : false;
+}
+
+//------------------------------------------------------------------------------------
+// rl_Texture animation functions
+//------------------------------------------------------------------------------------
+// Load animated texture from file, frames are decoded on demand into texture (GIF)
+rl_AnimatedTexture rl_LoadAnimatedTexture(const char *fileName)
+{
+    rl_AnimatedTexture anim = { 0 };
+
+    int dataSize = 0;
+    unsigned char *fileData = rl_LoadFileData(fileName, &dataSize);
+
+    if (fileData != NULL)
+    {
+        anim = rl_LoadAnimatedTextureFromMemory(rl_GetFileExtension(fileName), fileData, dataSize);
+
+        rl_UnloadFileData(fileData);
+    }
+
+    return anim;
+}
+
+// Load animated texture from memory buffer, fileType refers to extension: i.e. '.gif'
+// NOTE: Only file data and last two decoded frames are kept in RAM, memory does not depend on frames count,
+// other formats than GIF are loaded as a single frame texture
+rl_AnimatedTexture rl_LoadAnimatedTextureFromMemory(const char *fileType, const unsigned char *fileData, int dataSize)
+{
+    rl_AnimatedTexture anim = { 0 };
+
+    // Security check for input data
+    if ((fileType == NULL) || (fileData == NULL) || (dataSize == 0)) return anim;
+
+    int index = 0;
+    while ((index < animatedTextures.capacity) && (animatedTextures.animations[index].texture.id != 0)) index++;
+
+    if (index == animatedTextures.capacity)
+    {
+        int capacity = (animatedTextures.capacity == 0)? 8 : animatedTextures.capacity*2;
+        AnimatedTextureData *animations = (AnimatedTextureData *)RL_REALLOC(animatedTextures.animations, capacity*sizeof(AnimatedTextureData));
+        if (animations == NULL) return anim;
+
+        memset(animations + animatedTextures.capacity, 0, (capacity - animatedTextures.capacity)*sizeof(AnimatedTextureData));
+        animatedTextures.animations = animations;
+        animatedTextures.capacity = capacity;
+    }
+
+    AnimatedTextureData *data = &animatedTextures.animations[index];
+
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if ((strcmp(fileType, ".gif") == 0) || (strcmp(fileType, ".GIF") == 0))
+    {
+        data->frameCount = GetGifFrameCount(fileData, dataSize);
+        data->fileData = (unsigned char *)RL_MALLOC(dataSize);
+        data->gif = (stbi__gif *)RL_CALLOC(1, sizeof(stbi__gif));
+
+        if ((data->frameCount > 0) && (data->fileData != NULL) && (data->gif != NULL))
+        {
+            memcpy(data->fileData, fileData, dataSize);
+            data->dataSize = dataSize;
+            data->frame = -1;
+
+            if (DecodeAnimatedTextureFrame(data))
+            {
+                data->texture.id = rlLoadTexture(data->frames[0], data->gif->w, data->gif->h, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+                data->texture.width = data->gif->w;
+                data->texture.height = data->gif->h;
+                data->texture.mipmaps = 1;
+                data->texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+            }
+        }
+    }
+    else
+#endif
+    {
+        rl_Image image = rl_LoadImageFromMemory(fileType, fileData, dataSize);
+
+        if (image.data != NULL)
+        {
+            data->texture = rl_LoadTextureFromImage(image);
+            data->frameCount = 1;
+        }
+
+        rl_UnloadImage(image);
+    }
+
+    if (data->texture.id != 0)
+    {
+        anim.id = index + 1;
+        anim.texture = data->texture;
+        anim.frameCount = data->frameCount;
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Animated texture loaded successfully (%i frames)", data->texture.id, data->frameCount);
+    }
+    else
+    {
+        UnloadAnimatedTextureData(data);
+        TRACELOG(LOG_WARNING, "TEXTURE: Failed to load animated texture");
+    }
+
+    return anim;
+}
+
+// Check if an animated texture is valid (loaded)
+bool rl_IsAnimatedTextureValid(rl_AnimatedTexture anim)
+{
+    return (GetAnimatedTextureData(anim) != NULL);
+}
+
+// Unload animated texture from RAM and VRAM
+void rl_UnloadAnimatedTexture(rl_AnimatedTexture anim)
+{
+    AnimatedTextureData *data = GetAnimatedTextureData(anim);
+
+    if (data != NULL) UnloadAnimatedTextureData(data);
+}
+
+// Update animated texture, advancing frames by elapsed time (seconds) with file frames delays
+// NOTE: Texture is updated once with last frame reached, at most a full loop is decoded per update
+void rl_UpdateAnimatedTexture(rl_AnimatedTexture anim, float deltaTime)
+{
+    AnimatedTextureData *data = GetAnimatedTextureData(anim);
+    if ((data == NULL) || (data->frameCount <= 1)) return;
+
+    bool updated = false;
+    data->frameTime += deltaTime*1000.0f;
+
+    int frames = 0;
+
+    for (; frames < data->frameCount; frames++)
+    {
+        // NOTE: Frames with short or no delay use a minimum delay, as browsers do
+        float delay = (float)((data->delay < ANIMATED_TEXTURE_MIN_DELAY)? ANIMATED_TEXTURE_MIN_DELAY : data->delay);
+        if (data->frameTime < delay) break;
+
+        data->frameTime -= delay;
+
+        if (!DecodeAnimatedTextureFrame(data)) break;
+        updated = true;
+    }
+
+    if (frames == data->frameCount) data->frameTime = 0.0f;     // Full loop decoded, remaining time is dropped
+
+    if (updated) rlUpdateTexture(data->texture.id, 0, 0, data->texture.width, data->texture.height, data->texture.format, data->frames[data->frame%2]);
+}
+
+// Set animated texture current frame
+// NOTE: Frames are decoded from first frame when going back, seeking is slower than playing
+void rl_SetAnimatedTextureFrame(rl_AnimatedTexture anim, int frame)
+{
+    AnimatedTextureData *data = GetAnimatedTextureData(anim);
+    if ((data == NULL) || (data->frameCount <= 1)) return;
+
+    if (frame < 0) frame = 0;
+    if (frame >= data->frameCount) frame = data->frameCount - 1;
+
+    if (frame != data->frame)
+    {
+        // Decoder restarts from first frame after last frame
+        if (frame < data->frame) data->frame = data->frameCount - 1;
+
+        while ((data->frame != frame) && DecodeAnimatedTextureFrame(data)) { }
+
+        rlUpdateTexture(data->texture.id, 0, 0, data->texture.width, data->texture.height, data->texture.format, data->frames[data->frame%2]);
+    }
+
+    data->frameTime = 0.0f;
+}
+
+// Get animated texture current frame
+int rl_GetAnimatedTextureFrame(rl_AnimatedTexture anim)
+{
+    AnimatedTextureData *data = GetAnimatedTextureData(anim);
+
+    return (data != NULL)? data->frame : 0;
+}
+
+//------------------------------------------------------------------------------------
+// rl_Image texture functions
+//------------------------------------------------------------------------------------
+// Load image texture, texture mirrors image and rl_ImageDraw*() changes are tracked as dirty rectangles
+// NOTE: Image is kept by user and must stay valid while texture is loaded, only base mipmap level is mirrored
+rl_ImageTexture rl_LoadImageTexture(rl_Image *image)
+{
+    rl_ImageTexture texture = { 0 };
+
+    if ((image == NULL) || (image->data == NULL) || (image->width <= 0) || (image->height <= 0)) return texture;
+
+    if (image->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Image texture not supported for compressed formats");
+        return texture;
+    }
+
+    if (image->mipmaps > 1) TRACELOG(LOG_WARNING, "TEXTURE: Image texture only mirrors base mipmap level");
+
+    int index = 0;
+    while ((index < imageTextures.capacity) && (imageTextures.textures[index].image != NULL)) index++;
+
+    if (index == imageTextures.capacity)
+    {
+        int capacity = (imageTextures.capacity == 0)? 8 : imageTextures.capacity*2;
+        ImageTextureData *textures = (ImageTextureData *)RL_REALLOC(imageTextures.textures, capacity*sizeof(ImageTextureData));
+        if (textures == NULL) return texture;
+
+        memset(textures + imageTextures.capacity, 0, (capacity - imageTextures.capacity)*sizeof(ImageTextureData));
+        imageTextures.textures = textures;
+        imageTextures.capacity = capacity;
+    }
+
+    ImageTextureData *data = &imageTextures.textures[index];
+
+    // Image canvas recorded primitives are drawn first, texture mirrors current image
+    if ((imageCanvas.image != NULL) && (image->data == imageCanvas.image->data)) FlushImageCanvas();
+
+    // NOTE: Texture is not compressed, it is updated by regions
+    data->texture.id = rlLoadTexture(image->data, image->width, image->height, image->format, 1);
+    if (data->texture.id == 0) return texture;
+
+    data->texture.width = image->width;
+    data->texture.height = image->height;
+    data->texture.mipmaps = 1;
+    data->texture.format = image->format;
+    data->image = image;
+    data->imageData = image->data;
+    data->dirtyCount = 0;
+    imageTextures.count++;
+
+    texture.id = index + 1;
+    texture.texture = data->texture;
+
+    return texture;
+}
+
+// Check if an image texture is valid (loaded)
+bool rl_IsImageTextureValid(rl_ImageTexture texture)
+{
+    return (GetImageTextureData(texture) != NULL);
+}
+
+// Unload image texture from VRAM (image is not unloaded)
+void rl_UnloadImageTexture(rl_ImageTexture texture)
+{
+    ImageTextureData *data = GetImageTextureData(texture);
+    if (data == NULL) return;
+
+    rlUnloadTexture(data->texture.id);
+
+    *data = (ImageTextureData){ 0 };
+    imageTextures.count--;
+}
+
+// Set image texture region as dirty, for image changes not done by rl_ImageDraw*() functions
+void rl_SetImageTextureDirty(rl_ImageTexture texture, rl_Rectangle rec)
+{
+    ImageTextureData *data = GetImageTextureData(texture);
+    if (data == NULL) return;
+
+    int xMin = (rec.x > 0)? (int)rec.x : 0;
+    int yMin = (rec.y > 0)? (int)rec.y : 0;
+    int xMax = ((rec.x + rec.width) < data->texture.width)? (int)ceilf(rec.x + rec.width) : data->texture.width;
+    int yMax = ((rec.y + rec.height) < data->texture.height)? (int)ceilf(rec.y + rec.height) : data->texture.height;
+
+    if ((xMin < xMax) && (yMin < yMax)) AddImageTextureDirtyRect(data, xMin, yMin, xMax, yMax);
+}
+
+// Sync image texture, dirty regions are merged and uploaded, returns regions uploaded
+// NOTE: Image size and format changes are not supported, texture must be loaded again
+int rl_SyncImageTexture(rl_ImageTexture texture)
+{
+    ImageTextureData *data = GetImageTextureData(texture);
+    if (data == NULL) return 0;
+
+    rl_Image *image = data->image;
+
+    if ((image->width != data->texture.width) || (image->height != data->texture.height) || (image->format != data->texture.format))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Image texture size or format changed, texture not updated", data->texture.id);
+        return 0;
+    }
+
+    // Image canvas recorded primitives are drawn first, their bounds are set dirty
+    if ((imageCanvas.image != NULL) && (image->data == imageCanvas.image->data)) FlushImageCanvas();
+
+    // Image data reallocated (i.e. rl_ImageFormat() round trip), changes could not be tracked
+    if (image->data != data->imageData)
+    {
+        data->imageData = image->data;
+        AddImageTextureDirtyRect(data, 0, 0, image->width, image->height);
+    }
+
+    if (data->dirtyCount == 0) return 0;
+
+    // Dirty rectangles covering most of the image are uploaded at once
+    long long dirtyArea = 0;
+    for (int i = 0; i < data->dirtyCount; i++) dirtyArea += (long long)(data->dirty[i][2] - data->dirty[i][0])*(data->dirty[i][3] - data->dirty[i][1]);
+
+    if (dirtyArea*2 >= (long long)image->width*image->height)
+    {
+        data->dirty[0][0] = 0;
+        data->dirty[0][1] = 0;
+        data->dirty[0][2] = image->width;
+        data->dirty[0][3] = image->height;
+        data->dirtyCount = 1;
+    }
+
+    int bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
+    unsigned char *staging = NULL;
+    int stagingSize = 0;
+
+    for (int i = 0; i < data->dirtyCount; i++)
+    {
+        int x = data->dirty[i][0];
+        int y = data->dirty[i][1];
+        int width = data->dirty[i][2] - x;
+        int height = data->dirty[i][3] - y;
+        const unsigned char *pixels = (const unsigned char *)image->data + ((size_t)y*image->width + x)*bytesPerPixel;
+
+        // Full width regions are contiguous in image, other regions rows are packed first
+        if (width < image->width)
+        {
+            if (stagingSize < width*height*bytesPerPixel)
+            {
+                RL_FREE(staging);
+                stagingSize = width*height*bytesPerPixel;
+                staging = (unsigned char *)RL_MALLOC(stagingSize);
+            }
+
+            for (int row = 0; row < height; row++) memcpy(staging + (size_t)row*width*bytesPerPixel, pixels + (size_t)row*image->width*bytesPerPixel, width*bytesPerPixel);
+            pixels = staging;
+        }
+
+        rlUpdateTexture(data->texture.id, x, y, width, height, image->format, pixels);
+    }
+
+    RL_FREE(staging);
+
+    int count = data->dirtyCount;
+    data->dirtyCount = 0;
+
+    return count;
+}
+
+//------------------------------------------------------------------------------------
+// rl_Texture drawing functions
+//------------------------------------------------------------------------------------
+// Draw a texture
+void rl_DrawTexture(rl_Texture2D texture, int posX, int posY, rl_Color tint)
+{
+    rl_DrawTextureEx(texture, (rl_Vector2){ (float)posX, (float)posY }, 0.0f, 1.0f, tint);
+}
+
+// Draw a texture with position defined as rl_Vector2
+void rl_DrawTextureV(rl_Texture2D texture, rl_Vector2 position, rl_Color tint)
+{
+    rl_DrawTextureEx(texture, position, 0, 1.0f, tint);
+}
+
+// Draw a texture with extended parameters
+void rl_DrawTextureEx(rl_Texture2D texture, rl_Vector2 position, float rotation, float scale, rl_Color tint)
+{
+    rl_Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
+    rl_Rectangle dest = { position.x, position.y, (float)texture.width*scale, (float)texture.height*scale };
+    rl_Vector2 origin = { 0.0f, 0.0f };
+
+    rl_DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle)
+void rl_DrawTextureRec(rl_Texture2D texture, rl_Rectangle source, rl_Vector2 position, rl_Color tint)
+{
+    rl_Rectangle dest = { position.x, position.y, fabsf(source.width), fabsf(source.height) };
+    rl_Vector2 origin = { 0.0f, 0.0f };
+
+    rl_DrawTexturePro(texture, source, dest, origin, 0.0f, tint);
+}
+
+// Draw a part of a texture (defined by a rectangle) with 'pro' parameters
+// NOTE: origin is relative to destination rectangle size
+void rl_DrawTexturePro(rl_Texture2D texture, rl_Rectangle source, rl_Rectangle dest, rl_Vector2 origin, float rotation, rl_Color tint)
+{
+    // Check if texture is valid
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        bool flipX = false;
+
+        if (source.width < 0) { flipX = true; source.width *= -1; }
+        if (source.height < 0) source.y -= source.height;
+
+        if (dest.width < 0) dest.width *= -1;
+        if (dest.height < 0) dest.height *= -1;
+
+        rl_Vector2 topLeft = { 0 };
+        rl_Vector2 topRight = { 0 };
+        rl_Vector2 bottomLeft = { 0 };
+        rl_Vector2 bottomRight = { 0 };
+
+        // Only calculate rotation if needed
+        if (rotation == 0.0f)
+        {
+            float x = dest.x - origin.x;
+            float y = dest.y - origin.y;
+            topLeft = (rl_Vector2){ x, y };
+            topRight = (rl_Vector2){ x + dest.width, y };
+            bottomLeft = (rl_Vector2){ x, y + dest.height };
+            bottomRight = (rl_Vector2){ x + dest.width, y + dest.height };
+        }
+        else
+        {
+            float sinRotation = sinf(rotation*rl_DEG2RAD);
+            float cosRotation = cosf(rotation*rl_DEG2RAD);
+            float x = dest.x;
+            float y = dest.y;
+            float dx = -origin.x;
+            float dy = -origin.y;
+
+            topLeft.x = x + dx*cosRotation - dy*sinRotation;
+            topLeft.y = y + dx*sinRotation + dy*cosRotation;
+
+            topRight.x = x + (dx + dest.width)*cosRotation - dy*sinRotation;
+            topRight.y = y + (dx + dest.width)*sinRotation + dy*cosRotation;
+
+            bottomLeft.x = x + dx*cosRotation - (dy + dest.height)*sinRotation;
+            bottomLeft.y = y + dx*sinRotation + (dy + dest.height)*cosRotation;
+
+            bottomRight.x = x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
+            bottomRight.y = y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
+        }
+
+        rlSetTexture(texture.id);
+        rlBegin(RL_QUADS);
+
+            rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+            // Top-left corner for texture and quad
+            if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+            else rlTexCoord2f(source.x/width, source.y/height);
+            rlVertex2f(topLeft.x, topLeft.y);
+
+            // Bottom-left corner for texture and quad
+            if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+            else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+            rlVertex2f(bottomLeft.x, bottomLeft.y);
+
+            // Bottom-right corner for texture and quad
+            if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+            else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+            rlVertex2f(bottomRight.x, bottomRight.y);
+
+            // Top-right corner for texture and quad
+            if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+            else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+            rlVertex2f(topRight.x, topRight.y);
+
+        rlEnd();
+        rlSetTexture(0);
+
+        // NOTE: Vertex position can be transformed using matrices
+        // but the process is way more costly than just calculating
+        // the vertex positions manually, like done above
+        // Old implementation is left here for educational purposes,
+        // just in case someone wants to do some performance test
+        /*
+        rlSetTexture(texture.id);
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            if (rotation != 0.0f) rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+                // Bottom-left corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                else rlTexCoord2f(source.x/width, source.y/height);
+                rlVertex2f(0.0f, 0.0f);
+
+                // Bottom-right corner for texture and quad
+                if (flipX) rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                else rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                rlVertex2f(0.0f, dest.height);
+
+                // Top-right corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, (source.y + source.height)/height);
+                else rlTexCoord2f((source.x + source.width)/width, (source.y + source.height)/height);
+                rlVertex2f(dest.width, dest.height);
+
+                // Top-left corner for texture and quad
+                if (flipX) rlTexCoord2f(source.x/width, source.y/height);
+                else rlTexCoord2f((source.x + source.width)/width, source.y/height);
+                rlVertex2f(dest.width, 0.0f);
+            rlEnd();
+        rlPopMatrix();
+        rlSetTexture(0);
+        */
+    }
+}
+
+// Draws a texture (or part of it) that stretches or shrinks nicely using n-patch info
+void rl_DrawTextureNPatch(rl_Texture2D texture, rl_NPatchInfo nPatchInfo, rl_Rectangle dest, rl_Vector2 origin, float rotation, rl_Color tint)
+{
+    if (texture.id > 0)
+    {
+        float width = (float)texture.width;
+        float height = (float)texture.height;
+
+        float patchWidth = ((int)dest.width <= 0)? 0.0f : dest.width;
+        float patchHeight = ((int)dest.height <= 0)? 0.0f : dest.height;
+
+        if (nPatchInfo.source.width < 0) nPatchInfo.source.x -= nPatchInfo.source.width;
+        if (nPatchInfo.source.height < 0) nPatchInfo.source.y -= nPatchInfo.source.height;
+        if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL) patchHeight = nPatchInfo.source.height;
+        if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL) patchWidth = nPatchInfo.source.width;
+
+        bool drawCenter = true;
+        bool drawMiddle = true;
+        float leftBorder = (float)nPatchInfo.left;
+        float topBorder = (float)nPatchInfo.top;
+        float rightBorder = (float)nPatchInfo.right;
+        float bottomBorder = (float)nPatchInfo.bottom;
+
+        // Adjust the lateral (left and right) border widths in case patchWidth < texture.width
+        if (patchWidth <= (leftBorder + rightBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_VERTICAL)
+        {
+            drawCenter = false;
+            leftBorder = (leftBorder/(leftBorder + rightBorder))*patchWidth;
+            rightBorder = patchWidth - leftBorder;
+        }
+
+        // Adjust the lateral (top and bottom) border heights in case patchHeight < texture.height
+        if (patchHeight <= (topBorder + bottomBorder) && nPatchInfo.layout != NPATCH_THREE_PATCH_HORIZONTAL)
+        {
+            drawMiddle = false;
+            topBorder = (topBorder/(topBorder + bottomBorder))*patchHeight;
+            bottomBorder = patchHeight - topBorder;
+        }
+
+        rl_Vector2 vertA = { 0 };
+        rl_Vector2 vertB = { 0 };
+        rl_Vector2 vertC = { 0 };
+        rl_Vector2 vertD = { 0 };
+        vertA.x = 0.0f;                             // Outer left
+        vertA.y = 0.0f;                             // Outer top
+        vertB.x = leftBorder;                       // Inner left
+        vertB.y = topBorder;                        // Inner top
+        vertC.x = patchWidth  - rightBorder;        // Inner right
+        vertC.y = patchHeight - bottomBorder;       // Inner bottom
+        vertD.x = patchWidth;                       // Outer right
+        vertD.y = patchHeight;                      // Outer bottom
+
+        rl_Vector2 coordA = { 0 };
+        rl_Vector2 coordB = { 0 };
+        rl_Vector2 coordC = { 0 };
+        rl_Vector2 coordD = { 0 };
+        coordA.x = nPatchInfo.source.x/width;
+        coordA.y = nPatchInfo.source.y/height;
+        coordB.x = (nPatchInfo.source.x + leftBorder)/width;
+        coordB.y = (nPatchInfo.source.y + topBorder)/height;
+        coordC.x = (nPatchInfo.source.x + nPatchInfo.source.width  - rightBorder)/width;
+        coordC.y = (nPatchInfo.source.y + nPatchInfo.source.height - bottomBorder)/height;
+        coordD.x = (nPatchInfo.source.x + nPatchInfo.source.width)/width;
+        coordD.y = (nPatchInfo.source.y + nPatchInfo.source.height)/height;
+
+        rlSetTexture(texture.id);
+
+        rlPushMatrix();
+            rlTranslatef(dest.x, dest.y, 0.0f);
+            rlRotatef(rotation, 0.0f, 0.0f, 1.0f);
+            rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+            rlBegin(RL_QUADS);
+                rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+                rlNormal3f(0.0f, 0.0f, 1.0f);               // Normal vector pointing towards viewer
+
+                if (nPatchInfo.layout == NPATCH_NINE_PATCH)
+                {
+                    // ------------------------------------------------------------
+                    // TOP-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // TOP-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Bottom-left corner for texture and quad
                         rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-right corner for texture and quad
                         rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
                         rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
                     }
-                    // TOP-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawMiddle)
+                    // TOP-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawMiddle)
+                    {
+                        // ------------------------------------------------------------
+                        // MIDDLE-LEFT QUAD
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                        if (drawCenter)
+                        {
+                            // MIDDLE-CENTER QUAD
+                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
+                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
+                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
+                        }
+
+                        // MIDDLE-RIGHT QUAD
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+
+                    // ------------------------------------------------------------
+                    // BOTTOM-LEFT QUAD
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // BOTTOM-CENTER QUAD
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
+                    }
+
+                    // BOTTOM-RIGHT QUAD
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
+                {
+                    // TOP QUAD
+                    // -----------------------------------------------------------
+                    // rl_Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // MIDDLE QUAD
+                        // -----------------------------------------------------------
+                        // rl_Texture coords                 Vertices
+                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                    }
+                    // BOTTOM QUAD
+                    // -----------------------------------------------------------
+                    // rl_Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
+                }
+                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
+                {
+                    // LEFT QUAD
+                    // -----------------------------------------------------------
+                    // rl_Texture coords                 Vertices
+                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
+                    if (drawCenter)
+                    {
+                        // CENTER QUAD
+                        // -----------------------------------------------------------
+                        // rl_Texture coords                 Vertices
+                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
+                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
+                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                    }
+                    // RIGHT QUAD
+                    // -----------------------------------------------------------
+                    // rl_Texture coords                 Vertices
+                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
+                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
+                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+                }
+            rlEnd();
+        rlPopMatrix();
+
+        rlSetTexture(0);
+    }
+}
+
+#if defined(SUPPORT_RENDER_GRAPH)
+//------------------------------------------------------------------------------------
+// rl_RenderGraph functions
+//------------------------------------------------------------------------------------
+// Load empty render graph
+rl_RenderGraph *rl_LoadRenderGraph(void)
+{
+    rl_RenderGraph *graph = (rl_RenderGraph *)RL_CALLOC(1, sizeof(rl_RenderGraph));
+
+    return graph;
+}
+
+// Unload render graph
+// NOTE: Transient targets are released at execution end, imported render textures are owned by user
+void rl_UnloadRenderGraph(rl_RenderGraph *graph)
+{
+    RL_FREE(graph);
+}
+
+// Add transient target, acquired from render textures pool on first write and released after last read
+// NOTE: Size 0 is render size, negative size is render size divided (-2 for half render size)
+int rl_AddRenderGraphTarget(rl_RenderGraph *graph, int width, int height, int format, bool depth)
+{
+    RenderGraphResource resource = { 0 };
+    resource.width = width;
+    resource.height = height;
+    resource.format = format;
+    resource.depth = depth;
+
+    return AddRenderGraphResource(graph, resource);
+}
+
+// Add imported render texture read by passes, contents are kept (passes writing it draw over)
+int rl_AddRenderGraphInput(rl_RenderGraph *graph, rl_RenderTexture2D target)
+{
+    RenderGraphResource resource = { 0 };
+    resource.target = target;
+    resource.imported = true;
+
+    return AddRenderGraphResource(graph, resource);
+}
+
+// Add imported render texture written by passes, graph output
+// NOTE: Render texture with id 0 is the screen (current framebuffer when executed)
+int rl_AddRenderGraphOutput(rl_RenderGraph *graph, rl_RenderTexture2D target)
+{
+    RenderGraphResource resource = { 0 };
+    resource.target = target;
+    resource.imported = true;
+    resource.output = true;
+
+    return AddRenderGraphResource(graph, resource);
+}
+
+// Set imported resource render texture, graph passes do not need to be declared again
+void rl_SetRenderGraphTexture(rl_RenderGraph *graph, int resource, rl_RenderTexture2D target)
+{
+    if ((graph == NULL) || (resource < 0) || (resource >= graph->resourceCount) || !graph->resources[resource].imported)
+    {
+        TRACELOG(LOG_WARNING, "RENDERGRAPH: [ID %i] Resource is not an imported render texture", resource);
+        return;
+    }
+
+    graph->resources[resource].target = target;
+}
+
+// Add fullscreen shader pass, first input is drawn stretched to output with shader
+// NOTE: Inputs are bound to texture0..textureN samplers, a pass without inputs draws a white quad (generator pass)
+int rl_AddRenderGraphPass(rl_RenderGraph *graph, rl_Shader shader, const int *inputs, int inputCount, int output)
+{
+    RenderGraphPass pass = { 0 };
+    pass.shader = shader;
+    pass.output = output;
+
+    int index = AddRenderGraphPass(graph, pass, inputs, inputCount);
+
+    if ((index >= 0) && (shader.id > 0))
+    {
+        for (int i = 1; i < graph->passes[index].inputCount; i++) graph->passes[index].inputLocs[i] = rl_GetShaderLocation(shader, rl_TextFormat("texture%i", i));
+    }
+
+    return index;
+}
+
+// Add custom drawing pass, callback draws into output (bound) reading inputs textures
+// NOTE: Transient targets are in render texture orientation, draw them with negative source height
+int rl_AddRenderGraphPassCallback(rl_RenderGraph *graph, RenderGraphPassCallback callback, void *userData, const int *inputs, int inputCount, int output)
+{
+    RenderGraphPass pass = { 0 };
+    pass.callback = callback;
+    pass.userData = userData;
+    pass.output = output;
+
+    return AddRenderGraphPass(graph, pass, inputs, inputCount);
+}
+
+// Execute render graph passes not culled
+// NOTE: Must be called between rl_BeginDrawing() and rl_EndDrawing(), out of any other mode
+int rl_ExecuteRenderGraph(rl_RenderGraph *graph)
+{
+    if (graph == NULL) return 0;
+    if (!graph->compiled) CompileRenderGraph(graph);
+
+    int executed = 0;
+    int bound = -1;     // Resource bound as render target
+
+    for (int i = 0; i < graph->passCount; i++)
+    {
+        RenderGraphPass *pass = &graph->passes[i];
+        if (pass->culled) continue;
+
+        RenderGraphResource *output = &graph->resources[pass->output];
+
+        if (!pass->merged || (bound != pass->output))
+        {
+            if ((bound >= 0) && (graph->resources[bound].target.id > 0)) rl_EndTextureMode();
+            bound = -1;
+
+            // Transient target acquired on first write, pooled render textures released before are reused (aliasing)
+            if (!output->imported && (output->target.id == 0))
+            {
+                output->target = rl_AcquireRenderTexture(GetRenderGraphTargetSize(output->width, rl_GetRenderWidth()),
+                    GetRenderGraphTargetSize(output->height, rl_GetRenderHeight()), output->format, output->depth);
+
+                if (output->target.id == 0) continue;
+            }
+
+            if (output->target.id > 0) rl_BeginTextureMode(output->target);
+            bound = pass->output;
+        }
+
+        rl_Texture2D inputs[MAX_RENDER_GRAPH_PASS_INPUTS] = { 0 };
+        for (int k = 0; k < pass->inputCount; k++) inputs[k] = graph->resources[pass->inputs[k]].target.texture;
+
+        if (pass->callback != NULL)
+        {
+            // Custom pass first writing a transient target starts from cleared contents
+            if (pass->replace && !output->imported) rl_ClearBackground(rl_BLANK);
+
+            pass->callback(inputs, pass->inputCount, pass->userData);
+        }
+        else
+        {
+            float width = (float)((output->target.id > 0)? output->target.texture.width : rl_GetScreenWidth());
+            float height = (float)((output->target.id > 0)? output->target.texture.height : rl_GetScreenHeight());
+
+            // Generator pass (no inputs) draws default white texture
+            rl_Texture2D source = { rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+            rl_Rectangle sourceRec = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+            if (pass->inputCount > 0)
+            {
+                source = inputs[0];
+                sourceRec = (rl_Rectangle){ 0.0f, 0.0f, (float)source.width, -(float)source.height };
+            }
+
+            // First pass writing output replaces its contents, next ones are alpha blended over
+            if (pass->replace)
+            {
+                rlDrawRenderBatchActive();
+                rlDisableColorBlend();
+            }
+
+            if (pass->shader.id > 0) rl_BeginShaderMode(pass->shader);
+            for (int k = 1; k < pass->inputCount; k++) rl_SetShaderValueTexture(pass->shader, pass->inputLocs[k], inputs[k]);
+
+            rl_DrawTexturePro(source, sourceRec, (rl_Rectangle){ 0.0f, 0.0f, width, height }, (rl_Vector2){ 0.0f, 0.0f }, 0.0f, rl_WHITE);
+
+            if (pass->shader.id > 0) rl_EndShaderMode();
+
+            if (pass->replace)
+            {
+                rlDrawRenderBatchActive();
+                rlEnableColorBlend();
+            }
+        }
+
+        executed++;
+
+        // Transient targets not used anymore are returned to pool, next passes can reuse them
+        for (int r = 0; r < graph->resourceCount; r++)
+        {
+            RenderGraphResource *resource = &graph->resources[r];
+
+            if (!resource->imported && (resource->lastPass == i) && (resource->target.id > 0))
+            {
+                if (bound == r)
+                {
+                    rl_EndTextureMode();
+                    bound = -1;
+                }
+
+                rl_ReleaseRenderTexture(resource->target);
+                resource->target = (rl_RenderTexture2D){ 0 };
+            }
+        }
+    }
+
+    if ((bound >= 0) && (graph->resources[bound].target.id > 0)) rl_EndTextureMode();
+
+    return executed;
+}
+#endif  // SUPPORT_RENDER_GRAPH
+
+// Check if two colors are equal
+bool rl_ColorIsEqual(rl_Color col1, rl_Color col2)
+{
+    bool result = false;
+
+    if ((col1.r == col2.r) && (col1.g == col2.g) && (col1.b == col2.b) && (col1.a == col2.a)) result = true;
+
+    return result;
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+rl_Color rl_Fade(rl_Color color, float alpha)
+{
+    rl_Color result = color;
+
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    result.a = (unsigned char)(255.0f*alpha);
+
+    return result;
+}
+
+// Get hexadecimal value for a rl_Color
+int rl_ColorToInt(rl_Color color)
+{
+    int result = 0;
+
+    result = (int)(((unsigned int)color.r << 24) |
+                   ((unsigned int)color.g << 16) |
+                   ((unsigned int)color.b << 8) |
+                    (unsigned int)color.a);
+
+    return result;
+}
+
+// Get color normalized as float [0..1]
+rl_Vector4 rl_ColorNormalize(rl_Color color)
+{
+    rl_Vector4 result;
+
+    result.x = (float)color.r/255.0f;
+    result.y = (float)color.g/255.0f;
+    result.z = (float)color.b/255.0f;
+    result.w = (float)color.a/255.0f;
+
+    return result;
+}
+
+// Get color from normalized values [0..1]
+rl_Color rl_ColorFromNormalized(rl_Vector4 normalized)
+{
+    rl_Color result;
+
+    result.r = (unsigned char)(normalized.x*255.0f);
+    result.g = (unsigned char)(normalized.y*255.0f);
+    result.b = (unsigned char)(normalized.z*255.0f);
+    result.a = (unsigned char)(normalized.w*255.0f);
+
+    return result;
+}
+
+// Get HSV values for a rl_Color
+// NOTE: Hue is returned as degrees [0..360]
+rl_Vector3 rl_ColorToHSV(rl_Color color)
+{
+    rl_Vector3 hsv = { 0 };
+    rl_Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+    float min = 0.0f;
+    float max = 0.0f;
+    float delta = 0.0f;
+
+    min = rgb.x < rgb.y? rgb.x : rgb.y;
+    min = min  < rgb.z? min  : rgb.z;
+
+    max = rgb.x > rgb.y? rgb.x : rgb.y;
+    max = max  > rgb.z? max  : rgb.z;
+
+    hsv.z = max;            // Value
+    delta = max - min;
+
+    if (delta < 0.00001f)
+    {
+        hsv.y = 0.0f;
+        hsv.x = 0.0f;       // Undefined, maybe NAN?
+        return hsv;
+    }
+
+    if (max > 0.0f)
+    {
+        // NOTE: If max is 0, this divide would cause a crash
+        hsv.y = (delta/max);    // Saturation
+    }
+    else
+    {
+        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
+        hsv.y = 0.0f;
+        hsv.x = NAN;        // Undefined
+        return hsv;
+    }
+
+    // NOTE: Comparing float values could not work properly
+    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
+    else
+    {
+        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
+        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
+    }
+
+    hsv.x *= 60.0f;     // Convert to degrees
+
+    if (hsv.x < 0.0f) hsv.x += 360.0f;
+
+    return hsv;
+}
+
+// Get a rl_Color from HSV values
+// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
+// NOTE: rl_Color->HSV->rl_Color conversion will not yield exactly the same color due to rounding errors
+// Hue is provided in degrees: [0..360]
+// Saturation/Value are provided normalized: [0.0f..1.0f]
+rl_Color rl_ColorFromHSV(float hue, float saturation, float value)
+{
+    rl_Color color = { 0, 0, 0, 255 };
+
+    // Red channel
+    float k = fmodf((5.0f + hue/60.0f), 6);
+    float t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    // Green channel
+    k = fmodf((3.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    // Blue channel
+    k = fmodf((1.0f + hue/60.0f), 6);
+    t = 4.0f - k;
+    k = (t < k)? t : k;
+    k = (k < 1)? k : 1;
+    k = (k > 0)? k : 0;
+    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+
+    return color;
+}
+
+// Get color multiplied with another color
+rl_Color rl_ColorTint(rl_Color color, rl_Color tint)
+{
+    rl_Color result = color;
+
+    unsigned char r = (unsigned char)(((int)color.r*(int)tint.r)/255);
+    unsigned char g = (unsigned char)(((int)color.g*(int)tint.g)/255);
+    unsigned char b = (unsigned char)(((int)color.b*(int)tint.b)/255);
+    unsigned char a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+
+    result.r = r;
+    result.g = g;
+    result.b = b;
+    result.a = a;
+
+    return result;
+}
+
+// Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
+rl_Color rl_ColorBrightness(rl_Color color, float factor)
+{
+    rl_Color result = color;
+
+    if (factor > 1.0f) factor = 1.0f;
+    else if (factor < -1.0f) factor = -1.0f;
+
+    float red = (float)color.r;
+    float green = (float)color.g;
+    float blue = (float)color.b;
+
+    if (factor < 0.0f)
+    {
+        factor = 1.0f + factor;
+        red *= factor;
+        green *= factor;
+        blue *= factor;
+    }
+    else
+    {
+        red = (255 - red)*factor + red;
+        green = (255 - green)*factor + green;
+        blue = (255 - blue)*factor + blue;
+    }
+
+    result.r = (unsigned char)red;
+    result.g = (unsigned char)green;
+    result.b = (unsigned char)blue;
+
+    return result;
+}
+
+// Get color with contrast correction
+// NOTE: Contrast values between -1.0f and 1.0f
+rl_Color rl_ColorContrast(rl_Color color, float contrast)
+{
+    rl_Color result = color;
+
+    if (contrast < -1.0f) contrast = -1.0f;
+    else if (contrast > 1.0f) contrast = 1.0f;
+
+    contrast = (1.0f + contrast);
+    contrast *= contrast;
+
+    float pR = (float)color.r/255.0f;
+    pR -= 0.5f;
+    pR *= contrast;
+    pR += 0.5f;
+    pR *= 255;
+    if (pR < 0) pR = 0;
+    else if (pR > 255) pR = 255;
+
+    float pG = (float)color.g/255.0f;
+    pG -= 0.5f;
+    pG *= contrast;
+    pG += 0.5f;
+    pG *= 255;
+    if (pG < 0) pG = 0;
+    else if (pG > 255) pG = 255;
+
+    float pB = (float)color.b/255.0f;
+    pB -= 0.5f;
+    pB *= contrast;
+    pB += 0.5f;
+    pB *= 255;
+    if (pB < 0) pB = 0;
+    else if (pB > 255) pB = 255;
+
+    result.r = (unsigned char)pR;
+    result.g = (unsigned char)pG;
+    result.b = (unsigned char)pB;
+
+    return result;
+}
+
+// Get color with alpha applied, alpha goes from 0.0f to 1.0f
+rl_Color rl_ColorAlpha(rl_Color color, float alpha)
+{
+    rl_Color result = color;
+
+    if (alpha < 0.0f) alpha = 0.0f;
+    else if (alpha > 1.0f) alpha = 1.0f;
+
+    result.a = (unsigned char)(255.0f*alpha);
+
+    return result;
+}
+
+// Get src alpha-blended into dst color with tint
+rl_Color rl_ColorAlphaBlend(rl_Color dst, rl_Color src, rl_Color tint)
+{
+    rl_Color out = rl_WHITE;
+
+    // Apply color tint to source color
+    src.r = (unsigned char)(((unsigned int)src.r*((unsigned int)tint.r+1)) >> 8);
+    src.g = (unsigned char)(((unsigned int)src.g*((unsigned int)tint.g+1)) >> 8);
+    src.b = (unsigned char)(((unsigned int)src.b*((unsigned int)tint.b+1)) >> 8);
+    src.a = (unsigned char)(((unsigned int)src.a*((unsigned int)tint.a+1)) >> 8);
+
+//#define COLORALPHABLEND_FLOAT
+#define COLORALPHABLEND_INTEGERS
+#if defined(COLORALPHABLEND_INTEGERS)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
+        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+
+        if (out.a > 0)
+        {
+            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
+        }
+    }
+#endif
+#if defined(COLORALPHABLEND_FLOAT)
+    if (src.a == 0) out = dst;
+    else if (src.a == 255) out = src;
+    else
+    {
+        rl_Vector4 fdst = rl_ColorNormalize(dst);
+        rl_Vector4 fsrc = rl_ColorNormalize(src);
+        rl_Vector4 ftint = rl_ColorNormalize(tint);
+        rl_Vector4 fout = { 0 };
+
+        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+
+        if (fout.w > 0.0f)
+        {
+            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
+            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+        }
+
+        out = (rl_Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+    }
+#endif
+
+    return out;
+}
+
+// Get color lerp interpolation between two colors, factor [0.0f..1.0f]
+rl_Color rl_ColorLerp(rl_Color color1, rl_Color color2, float factor)
+{
+    rl_Color color = { 0 };
+
+    if (factor < 0.0f) factor = 0.0f;
+    else if (factor > 1.0f) factor = 1.0f;
+
+    color.r = (unsigned char)((1.0f - factor)*color1.r + factor*color2.r);
+    color.g = (unsigned char)((1.0f - factor)*color1.g + factor*color2.g);
+    color.b = (unsigned char)((1.0f - factor)*color1.b + factor*color2.b);
+    color.a = (unsigned char)((1.0f - factor)*color1.a + factor*color2.a);
+
+    return color;
+}
+
+// Get a rl_Color struct from hexadecimal value
+rl_Color rl_GetColor(unsigned int hexValue)
+{
+    rl_Color color;
+
+    color.r = (unsigned char)(hexValue >> 24) & 0xff;
+    color.g = (unsigned char)(hexValue >> 16) & 0xff;
+    color.b = (unsigned char)(hexValue >> 8) & 0xff;
+    color.a = (unsigned char)hexValue & 0xff;
+
+    return color;
+}
+
+// Get color from a pixel from certain format
+// NOTE: Use rl_LoadImageColors() to get all image pixels, format is not checked for every pixel
+rl_Color rl_GetPixelColor(void *srcPtr, int format)
+{
+    rl_Color color = { 0 };
+
+    GetPixelRowFunc getPixels = GetPixelRowKernel(format);
+    if (getPixels != NULL) getPixels((const unsigned char *)srcPtr, 1, &color);
+
+    return color;
+}
+
+// Set pixel color formatted into destination pointer
+void rl_SetPixelColor(void *dstPtr, rl_Color color, int format)
+{
+    SetPixelRowFunc setPixels = SetPixelRowKernel(format);
+    if (setPixels != NULL) setPixels(&color, 1, (unsigned char *)dstPtr);
+}
+
+// Get pixel data size in bytes for certain format
+// NOTE: Size can be requested for rl_Image or rl_Texture data
+int rl_GetPixelDataSize(int width, int height, int format)
+{
+    int dataSize = 0;       // Size in bytes
+    int bpp = 0;            // Bits per pixel
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
+        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
+        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
+        case PIXELFORMAT_COMPRESSED_PVRT_RGBA:
+        case PIXELFORMAT_COMPRESSED_BC4_R: bpp = 4; break;
+        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
+        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
+        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
+        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA:
+        case PIXELFORMAT_COMPRESSED_BC7_RGBA: bpp = 8; break;
+        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
+        default: break;
+    }
+
+    double bytesPerPixel = (double)bpp/8.0;
+    dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
+
+    // Most compressed formats works on 4x4 blocks, partial blocks are stored complete
+    if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format != PIXELFORMAT_COMPRESSED_PVRT_RGB) &&
+        (format != PIXELFORMAT_COMPRESSED_PVRT_RGBA) && (format != PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA))
+    {
+        dataSize = ((width + 3)/4)*((height + 3)/4)*bpp*2;  // 16 pixels per block
+    }
+    else if ((width < 4) && (height < 4) && (format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
+
+    return dataSize;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+// Load render texture with color format and optional depth
+static rl_RenderTexture2D LoadRenderTextureEx(int width, int height, int format, bool depth)
+{
+    rl_RenderTexture2D target = { 0 };
+
+    target.id = rlLoadFramebuffer(); // Load an empty framebuffer
+
+    if (target.id > 0)
+    {
+        rlEnableFramebuffer(target.id);
+
+        // Create color texture
+        target.texture.id = rlLoadTexture(NULL, width, height, format, 1);
+        target.texture.width = width;
+        target.texture.height = height;
+        target.texture.format = format;
+        target.texture.mipmaps = 1;
+
+        // Attach color texture to FBO
+        rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+
+        if (depth)
+        {
+            // Create depth renderbuffer/texture
+            target.depth.id = rlLoadTextureDepth(width, height, true);
+            target.depth.width = width;
+            target.depth.height = height;
+            target.depth.format = 19;       //DEPTH_COMPONENT_24BIT?
+            target.depth.mipmaps = 1;
+
+            // Attach depth renderbuffer/texture to FBO
+            rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_RENDERBUFFER, 0);
+        }
+
+        // Check if fbo is complete with attachments (valid)
+        if (rlFramebufferComplete(target.id)) TRACELOG(LOG_INFO, "FBO: [ID %i] Framebuffer object created successfully", target.id);
+
+        rlDisableFramebuffer();
+    }
+    else TRACELOG(LOG_WARNING, "FBO: Framebuffer object can not be created");
+
+    return target;
+}
+
+// Convert half-float (stored as unsigned short) to float
+// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
+static float HalfToFloat(unsigned short x)
+{
+    float result = 0.0f;
+
+    union {
+        float fm;
+        unsigned int ui;
+    } uni;
+
+    const unsigned int e = (x & 0x7c00) >> 10; // Exponent
+    const unsigned int m = (x & 0x03ff) << 13; // Mantissa
+    uni.fm = (float)m;
+    const unsigned int v = uni.ui >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
+    uni.ui = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007fe000)); // sign : normalized : denormalized
+
+    result = uni.fm;
+
+    return result;
+}
+
+// Convert float to half-float (stored as unsigned short)
+static unsigned short FloatToHalf(float x)
+{
+    unsigned short result = 0;
+
+    union {
+        float fm;
+        unsigned int ui;
+    } uni;
+    uni.fm = x;
+
+    const unsigned int b = uni.ui + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
+    const unsigned int e = (b & 0x7f800000) >> 23; // Exponent
+    const unsigned int m = b & 0x007fffff; // Mantissa; in line below: 0x007ff000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+
+    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7c00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007ff000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7fff; // sign : normalized : denormalized : saturate
+
+    return result;
+}
+
+// Get pixel data from image as rl_Vector4 array (float normalized)
+// NOTE: Pixels are temporary, allocated from frame arena, caller releases them with a frame mark
+static rl_Vector4 *LoadImageDataNormalized(rl_Image image)
+{
+    rl_Vector4 *pixels = (rl_Vector4 *)rl_MemFrameAlloc(image.width*image.height*sizeof(rl_Vector4));
+
+    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
+    else
+    {
+        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        {
+            switch (image.format)
+            {
+                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+
+                    k += 2;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
+                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
+                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
+                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
+                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
+                    pixels[i].w = 1.0f;
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+                {
+                    unsigned short pixel = ((unsigned short *)image.data)[i];
+
+                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
+                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
+                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
+                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+                {
+                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
+                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
+
+                    k += 1;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+                {
+                    pixels[i].x = ((float *)image.data)[k];
+                    pixels[i].y = ((float *)image.data)[k + 1];
+                    pixels[i].z = ((float *)image.data)[k + 2];
+                    pixels[i].w = ((float *)image.data)[k + 3];
+
+                    k += 4;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16:
+                {
+                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
+                    pixels[i].y = 0.0f;
+                    pixels[i].z = 0.0f;
+                    pixels[i].w = 1.0f;
+
+                    k += 1;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                {
+                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
+                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
+                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
+                    pixels[i].w = 1.0f;
+
+                    k += 3;
+                } break;
+                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+                {
+                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
+                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
+                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
+                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+
+                    k += 4;
+                } break;
+                default: break;
+            }
+        }
+    }
+
+    return pixels;
+}
+
+// Check if pixel format stores 8 bit normalized channels
+static bool IsPixelFormatUnorm8(int format)
+{
+    return ((format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) || (format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) ||
+            (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8) || (format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8));
+}
+
+// Quantize 8 bit channel to 4, 5 or 6 bits, round(c*max/255)
+static inline unsigned short QuantizeChannel(unsigned char c, int max)
+{
+    unsigned int t = c*max + 128;
+
+    return (unsigned short)((t + (t >> 8)) >> 8);
+}
+
+// Uncompressed pixel formats conversion from/to RGBA8 (rl_Color), one pixel
+// NOTE: Used by rl_GetPixelColor()/rl_SetPixelColor() and expanded into pixel rows kernels
+static inline rl_Color GetPixelGrayscale(const unsigned char *pixel) { return (rl_Color){ pixel[0], pixel[0], pixel[0], 255 }; }
+static inline rl_Color GetPixelGrayAlpha(const unsigned char *pixel) { return (rl_Color){ pixel[0], pixel[0], pixel[0], pixel[1] }; }
+static inline rl_Color GetPixelR8G8B8(const unsigned char *pixel) { return (rl_Color){ pixel[0], pixel[1], pixel[2], 255 }; }
+static inline rl_Color GetPixelR8G8B8A8(const unsigned char *pixel) { return (rl_Color){ pixel[0], pixel[1], pixel[2], pixel[3] }; }
+
+static inline rl_Color GetPixelR5G6B5(const unsigned char *pixel)
+{
+    unsigned short value = ((const unsigned short *)pixel)[0];
+
+    return (rl_Color){ (unsigned char)((value >> 11)*255/31), (unsigned char)(((value >> 5) & 0x3f)*255/63), (unsigned char)((value & 0x1f)*255/31), 255 };
+}
+
+static inline rl_Color GetPixelR5G5B5A1(const unsigned char *pixel)
+{
+    unsigned short value = ((const unsigned short *)pixel)[0];
+
+    return (rl_Color){ (unsigned char)((value >> 11)*255/31), (unsigned char)(((value >> 6) & 0x1f)*255/31), (unsigned char)(((value >> 1) & 0x1f)*255/31), (value & 0x01)? 255 : 0 };
+}
+
+static inline rl_Color GetPixelR4G4B4A4(const unsigned char *pixel)
+{
+    unsigned short value = ((const unsigned short *)pixel)[0];
+
+    return (rl_Color){ (unsigned char)((value >> 12)*255/15), (unsigned char)(((value >> 8) & 0x0f)*255/15), (unsigned char)(((value >> 4) & 0x0f)*255/15), (unsigned char)((value & 0x0f)*255/15) };
+}
+
+// NOTE: Pixel normalized float values are converted to [0..255], single channel formats are gray
+static inline rl_Color GetPixelR32(const unsigned char *pixel)
+{
+    const float *value = (const float *)pixel;
+
+    return (rl_Color){ (unsigned char)(value[0]*255.0f), (unsigned char)(value[0]*255.0f), (unsigned char)(value[0]*255.0f), 255 };
+}
+
+static inline rl_Color GetPixelR32G32B32(const unsigned char *pixel)
+{
+    const float *value = (const float *)pixel;
+
+    return (rl_Color){ (unsigned char)(value[0]*255.0f), (unsigned char)(value[1]*255.0f), (unsigned char)(value[2]*255.0f), 255 };
+}
+
+static inline rl_Color GetPixelR32G32B32A32(const unsigned char *pixel)
+{
+    const float *value = (const float *)pixel;
+
+    return (rl_Color){ (unsigned char)(value[0]*255.0f), (unsigned char)(value[1]*255.0f), (unsigned char)(value[2]*255.0f), (unsigned char)(value[3]*255.0f) };
+}
+
+static inline rl_Color GetPixelR16(const unsigned char *pixel)
+{
+    float value = HalfToFloat(((const unsigned short *)pixel)[0]);
+
+    return (rl_Color){ (unsigned char)(value*255.0f), (unsigned char)(value*255.0f), (unsigned char)(value*255.0f), 255 };
+}
+
+static inline rl_Color GetPixelR16G16B16(const unsigned char *pixel)
+{
+    const unsigned short *value = (const unsigned short *)pixel;
+
+    return (rl_Color){ (unsigned char)(HalfToFloat(value[0])*255.0f), (unsigned char)(HalfToFloat(value[1])*255.0f), (unsigned char)(HalfToFloat(value[2])*255.0f), 255 };
+}
+
+static inline rl_Color GetPixelR16G16B16A16(const unsigned char *pixel)
+{
+    const unsigned short *value = (const unsigned short *)pixel;
+
+    return (rl_Color){ (unsigned char)(HalfToFloat(value[0])*255.0f), (unsigned char)(HalfToFloat(value[1])*255.0f), (unsigned char)(HalfToFloat(value[2])*255.0f), (unsigned char)(HalfToFloat(value[3])*255.0f) };
+}
+
+// NOTE: Grayscale equivalent color calculated with normalized float values
+static inline unsigned char GetColorGray(rl_Color color)
+{
+    rl_Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+    return (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+}
+
+static inline void SetPixelGrayscale(unsigned char *pixel, rl_Color color) { pixel[0] = GetColorGray(color); }
+static inline void SetPixelGrayAlpha(unsigned char *pixel, rl_Color color) { pixel[0] = GetColorGray(color); pixel[1] = color.a; }
+static inline void SetPixelR8G8B8(unsigned char *pixel, rl_Color color) { pixel[0] = color.r; pixel[1] = color.g; pixel[2] = color.b; }
+static inline void SetPixelR8G8B8A8(unsigned char *pixel, rl_Color color) { pixel[0] = color.r; pixel[1] = color.g; pixel[2] = color.b; pixel[3] = color.a; }
+
+static inline void SetPixelR5G6B5(unsigned char *pixel, rl_Color color)
+{
+    rl_Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+    unsigned char r = (unsigned char)(round(coln.x*31.0f));
+    unsigned char g = (unsigned char)(round(coln.y*63.0f));
+    unsigned char b = (unsigned char)(round(coln.z*31.0f));
+
+    ((unsigned short *)pixel)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+}
+
+static inline void SetPixelR5G5B5A1(unsigned char *pixel, rl_Color color)
+{
+    rl_Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+    unsigned char r = (unsigned char)(round(coln.x*31.0f));
+    unsigned char g = (unsigned char)(round(coln.y*31.0f));
+    unsigned char b = (unsigned char)(round(coln.z*31.0f));
+    unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+
+    ((unsigned short *)pixel)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+}
+
+static inline void SetPixelR4G4B4A4(unsigned char *pixel, rl_Color color)
+{
+    rl_Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+
+    unsigned char r = (unsigned char)(round(coln.x*15.0f));
+    unsigned char g = (unsigned char)(round(coln.y*15.0f));
+    unsigned char b = (unsigned char)(round(coln.z*15.0f));
+    unsigned char a = (unsigned char)(round(coln.w*15.0f));
+
+    ((unsigned short *)pixel)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+}
+
+// NOTE: Single channel formats store grayscale equivalent color
+static inline void SetPixelR32(unsigned char *pixel, rl_Color color)
+{
+    rl_Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+    ((float *)pixel)[0] = coln.x*0.299f + coln.y*0.587f + coln.z*0.114f;
+}
+
+static inline void SetPixelR32G32B32(unsigned char *pixel, rl_Color color)
+{
+    float *value = (float *)pixel;
+
+    value[0] = (float)color.r/255.0f;
+    value[1] = (float)color.g/255.0f;
+    value[2] = (float)color.b/255.0f;
+}
+
+static inline void SetPixelR32G32B32A32(unsigned char *pixel, rl_Color color)
+{
+    float *value = (float *)pixel;
+
+    value[0] = (float)color.r/255.0f;
+    value[1] = (float)color.g/255.0f;
+    value[2] = (float)color.b/255.0f;
+    value[3] = (float)color.a/255.0f;
+}
+
+static inline void SetPixelR16(unsigned char *pixel, rl_Color color)
+{
+    rl_Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+
+    ((unsigned short *)pixel)[0] = FloatToHalf(coln.x*0.299f + coln.y*0.587f + coln.z*0.114f);
+}
+
+static inline void SetPixelR16G16B16(unsigned char *pixel, rl_Color color)
+{
+    unsigned short *value = (unsigned short *)pixel;
+
+    value[0] = FloatToHalf((float)color.r/255.0f);
+    value[1] = FloatToHalf((float)color.g/255.0f);
+    value[2] = FloatToHalf((float)color.b/255.0f);
+}
+
+static inline void SetPixelR16G16B16A16(unsigned char *pixel, rl_Color color)
+{
+    unsigned short *value = (unsigned short *)pixel;
+
+    value[0] = FloatToHalf((float)color.r/255.0f);
+    value[1] = FloatToHalf((float)color.g/255.0f);
+    value[2] = FloatToHalf((float)color.b/255.0f);
+    value[3] = FloatToHalf((float)color.a/255.0f);
+}
+
+// Pixel rows kernels, generated for every uncompressed format (PIXEL_FORMATS_UNCOMPRESSED)
+// NOTE: Kernel is selected once per row, pixel conversion is specialized and inlined in kernel loop
+#define PIXEL_ROW_KERNELS(format, name, bytesPerPixel) \
+    static void GetPixelRow##name(const unsigned char *src, int count, rl_Color *dst) \
+    { \
+        for (int i = 0; i < count; i++) dst[i] = GetPixel##name(src + i*(bytesPerPixel)); \
+    } \
+    static void SetPixelRow##name(const rl_Color *src, int count, unsigned char *dst) \
+    { \
+        for (int i = 0; i < count; i++) SetPixel##name(dst + i*(bytesPerPixel), src[i]); \
+    }
+
+PIXEL_FORMATS_UNCOMPRESSED(PIXEL_ROW_KERNELS)
+
+#undef PIXEL_ROW_KERNELS
+
+// Get pixels row decoding kernel for format, NULL if format is not supported
+static GetPixelRowFunc GetPixelRowKernel(int format)
+{
+    #define PIXEL_ROW_KERNEL_CASE(format, name, bytesPerPixel) case format: return GetPixelRow##name;
+
+    switch (format)
+    {
+        PIXEL_FORMATS_UNCOMPRESSED(PIXEL_ROW_KERNEL_CASE)
+        default: break;
+    }
+
+    #undef PIXEL_ROW_KERNEL_CASE
+
+    return NULL;
+}
+
+// Get pixels row encoding kernel for format, NULL if format is not supported
+static SetPixelRowFunc SetPixelRowKernel(int format)
+{
+    #define PIXEL_ROW_KERNEL_CASE(format, name, bytesPerPixel) case format: return SetPixelRow##name;
+
+    switch (format)
+    {
+        PIXEL_FORMATS_UNCOMPRESSED(PIXEL_ROW_KERNEL_CASE)
+        default: break;
+    }
+
+    #undef PIXEL_ROW_KERNEL_CASE
+
+    return NULL;
+}
+
+// Draw pixels row through format kernels, any uncompressed formats
+// NOTE: Same results as rl_GetPixelColor()/rl_SetPixelColor() per pixel conversion and rl_ColorAlphaBlend()
+static void ImageDrawRowKernels(unsigned char *dst, int dstFormat, const unsigned char *src, int srcFormat, int width, rl_Color tint, bool blend)
+{
+    GetPixelRowFunc getSrc = GetPixelRowKernel(srcFormat);
+    GetPixelRowFunc getDst = GetPixelRowKernel(dstFormat);
+    SetPixelRowFunc setDst = SetPixelRowKernel(dstFormat);
+    if ((getSrc == NULL) || (getDst == NULL) || (setDst == NULL)) return;
+
+    int srcBytesPerPixel = rl_GetPixelDataSize(1, 1, srcFormat);
+    int dstBytesPerPixel = rl_GetPixelDataSize(1, 1, dstFormat);
+
+    rl_Color srcColors[IMAGE_FORMAT_CHUNK_SIZE];
+    rl_Color dstColors[IMAGE_FORMAT_CHUNK_SIZE];
+
+    for (int offset = 0; offset < width; offset += IMAGE_FORMAT_CHUNK_SIZE)
+    {
+        int count = ((width - offset) < IMAGE_FORMAT_CHUNK_SIZE)? (width - offset) : IMAGE_FORMAT_CHUNK_SIZE;
+
+        getSrc(src + offset*srcBytesPerPixel, count, srcColors);
+
+        if (blend)
+        {
+            getDst(dst + offset*dstBytesPerPixel, count, dstColors);
+            BlendColorsRGBA8(dstColors, srcColors, count, tint);
+            setDst(dstColors, count, dst + offset*dstBytesPerPixel);
+        }
+        else setDst(srcColors, count, dst + offset*dstBytesPerPixel);
+    }
+}
+
+// Decode float and half-float channels pixels kernel, specialized at compile time for channels count and value type
+// NOTE: Missing channels are set to 0 (alpha to 1.0f), values are clamped to [0.0f..1.0f]
+#define LOAD_FLOAT_VALUE(value) (value)
+#define DECODE_FLOAT_PIXELS(pixels, channels, LOAD) \
+    for (; i < count; i++) \
+    { \
+        float values[4] = { 0.0f, 0.0f, 0.0f, 1.0f }; \
+        for (int c = 0; c < (channels); c++) values[c] = LOAD((pixels)[i*(channels) + c]); \
+        \
+        unsigned char color[4] = { 0 }; \
+        for (int c = 0; c < 4; c++) \
+        { \
+            float value = values[c]*255.0f; \
+            color[c] = (value <= 0.0f)? 0 : (value >= 255.0f)? 255 : (unsigned char)value; \
+        } \
+        \
+        dst[i] = (rl_Color){ color[0], color[1], color[2], color[3] }; \
+    }
+
+// Decode pixels to RGBA8 (rl_Color), offset and count in pixels
+// NOTE: Results match normalized float conversion, floats out of [0.0f..1.0f] range are clamped
+static void DecodePixelsRGBA8(const void *src, int format, int offset, int count, rl_Color *dst)
+{
+    int i = 0;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        {
+            const unsigned char *pixels = (const unsigned char *)src + offset;
+            for (; i < count; i++) dst[i] = (rl_Color){ pixels[i], pixels[i], pixels[i], 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            const unsigned char *pixels = (const unsigned char *)src + offset*2;
+            for (; i < count; i++) dst[i] = (rl_Color){ pixels[i*2], pixels[i*2], pixels[i*2], pixels[i*2 + 1] };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            const unsigned char *pixels = (const unsigned char *)src + offset*3;
+        #if defined(RTEXTURES_NEON_ENABLED)
+            for (; i + 16 <= count; i += 16)
+            {
+                uint8x16x3_t rgb = vld3q_u8(pixels + i*3);
+                uint8x16x4_t rgba = { { rgb.val[0], rgb.val[1], rgb.val[2], vdupq_n_u8(255) } };
+                vst4q_u8((unsigned char *)(dst + i), rgba);
+            }
+        #endif
+            for (; i < count; i++) dst[i] = (rl_Color){ pixels[i*3], pixels[i*3 + 1], pixels[i*3 + 2], 255 };
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy(dst, (const unsigned char *)src + offset*4, count*4); break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            // NOTE: Channels expanded as floor(c*255/max)
+            const unsigned short *pixels = (const unsigned short *)src + offset;
+        #if defined(RTEXTURES_SSE2_ENABLED)
+            const __m128i mask5 = _mm_set1_epi16(0x1f);
+            const __m128i mask6 = _mm_set1_epi16(0x3f);
+            const __m128i mask4 = _mm_set1_epi16(0x0f);
+            const __m128i scale = _mm_set1_epi16(255);
+
+            for (; i + 8 <= count; i += 8)
+            {
+                __m128i v = _mm_loadu_si128((const __m128i *)(pixels + i));
+                __m128i r, g, b, a;
+
+                // Division by 31, 63 and 15 computed as multiply high and shift (exact for channels range)
+                if (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+                {
+                    r = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 11), mask5), scale), _mm_set1_epi16(8457)), 2);
+                    g = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 5), mask6), scale), _mm_set1_epi16(16645)), 4);
+                    b = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(_mm_and_si128(v, mask5), scale), _mm_set1_epi16(8457)), 2);
+                    a = scale;
+                }
+                else if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+                {
+                    r = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 11), mask5), scale), _mm_set1_epi16(8457)), 2);
+                    g = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 6), mask5), scale), _mm_set1_epi16(8457)), 2);
+                    b = _mm_srli_epi16(_mm_mulhi_epu16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 1), mask5), scale), _mm_set1_epi16(8457)), 2);
+                    a = _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi16(1)), scale);
+                }
+                else
+                {
+                    r = _mm_mulhi_epu16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 12), mask4), scale), _mm_set1_epi16(4370));
+                    g = _mm_mulhi_epu16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 8), mask4), scale), _mm_set1_epi16(4370));
+                    b = _mm_mulhi_epu16(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi16(v, 4), mask4), scale), _mm_set1_epi16(4370));
+                    a = _mm_mulhi_epu16(_mm_mullo_epi16(_mm_and_si128(v, mask4), scale), _mm_set1_epi16(4370));
+                }
+
+                __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+                __m128i ba = _mm_or_si128(b, _mm_slli_epi16(a, 8));
+                _mm_storeu_si128((__m128i *)(dst + i), _mm_unpacklo_epi16(rg, ba));
+                _mm_storeu_si128((__m128i *)(dst + i + 4), _mm_unpackhi_epi16(rg, ba));
+            }
+        #endif
+            // NOTE: Remaining pixels decoded by format kernel, same results as vectorized decoding
+            GetPixelRowKernel(format)((const unsigned char *)(pixels + i), count - i, dst + i);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            const float *pixels = (const float *)src + offset*4;
+
+        #if defined(RTEXTURES_SSE2_ENABLED)
+            const __m128 scale = _mm_set1_ps(255.0f);
+            const __m128 zero = _mm_setzero_ps();
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128i p0 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(pixels + i*4), scale), zero), scale));
+                __m128i p1 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(pixels + i*4 + 4), scale), zero), scale));
+                __m128i p2 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(pixels + i*4 + 8), scale), zero), scale));
+                __m128i p3 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(pixels + i*4 + 12), scale), zero), scale));
+
+                _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3)));
+            }
+        #endif
+            DECODE_FLOAT_PIXELS(pixels, 4, LOAD_FLOAT_VALUE);
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: { const float *pixels = (const float *)src + offset; DECODE_FLOAT_PIXELS(pixels, 1, LOAD_FLOAT_VALUE); } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: { const float *pixels = (const float *)src + offset*3; DECODE_FLOAT_PIXELS(pixels, 3, LOAD_FLOAT_VALUE); } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: { const unsigned short *pixels = (const unsigned short *)src + offset; DECODE_FLOAT_PIXELS(pixels, 1, HalfToFloat); } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: { const unsigned short *pixels = (const unsigned short *)src + offset*3; DECODE_FLOAT_PIXELS(pixels, 3, HalfToFloat); } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: { const unsigned short *pixels = (const unsigned short *)src + offset*4; DECODE_FLOAT_PIXELS(pixels, 4, HalfToFloat); } break;
+        default: break;
+    }
+}
+
+#undef DECODE_FLOAT_PIXELS
+#undef LOAD_FLOAT_VALUE
+
+// Encode RGBA8 (rl_Color) pixels, offset and count in pixels
+// NOTE: Results match normalized float conversion, luminance computed with same float operations
+static void EncodePixelsRGBA8(const rl_Color *src, int count, void *dst, int format, int offset)
+{
+    int i = 0;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+        {
+            int stride = (format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)? 1 : 2;
+            unsigned char *pixels = (unsigned char *)dst + offset*stride;
+
+        #if defined(RTEXTURES_SSE2_ENABLED)
+            if (format == PIXELFORMAT_UNCOMPRESSED_GRAYSCALE)
+            {
+                const __m128i mask = _mm_set1_epi32(0xff);
+                const __m128 div = _mm_set1_ps(255.0f);
+
+                for (; i + 8 <= count; i += 8)
+                {
+                    __m128i lum[2] = { 0 };
+
+                    for (int k = 0; k < 2; k++)
+                    {
+                        __m128i p = _mm_loadu_si128((const __m128i *)(src + i + k*4));
+                        __m128 r = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(p, mask)), div);
+                        __m128 g = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 8), mask)), div);
+                        __m128 b = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(p, 16), mask)), div);
+                        __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, _mm_set1_ps(0.299f)), _mm_mul_ps(g, _mm_set1_ps(0.587f))), _mm_mul_ps(b, _mm_set1_ps(0.114f)));
+                        lum[k] = _mm_cvttps_epi32(_mm_mul_ps(y, div));
+                    }
+
+                    _mm_storel_epi64((__m128i *)(pixels + i), _mm_packus_epi16(_mm_packs_epi32(lum[0], lum[1]), _mm_setzero_si128()));
+                }
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                float r = (float)src[i].r/255.0f;
+                float g = (float)src[i].g/255.0f;
+                float b = (float)src[i].b/255.0f;
+
+                pixels[i*stride] = (unsigned char)((r*0.299f + g*0.587f + b*0.114f)*255.0f);
+                if (stride == 2) pixels[i*stride + 1] = src[i].a;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
+        {
+            unsigned char *pixels = (unsigned char *)dst + offset*3;
+        #if defined(RTEXTURES_NEON_ENABLED)
+            for (; i + 16 <= count; i += 16)
+            {
+                uint8x16x4_t rgba = vld4q_u8((const unsigned char *)(src + i));
+                uint8x16x3_t rgb = { { rgba.val[0], rgba.val[1], rgba.val[2] } };
+                vst3q_u8(pixels + i*3, rgb);
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                pixels[i*3] = src[i].r;
+                pixels[i*3 + 1] = src[i].g;
+                pixels[i*3 + 2] = src[i].b;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: memcpy((unsigned char *)dst + offset*4, src, count*4); break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            unsigned short *pixels = (unsigned short *)dst + offset;
+        #if defined(RTEXTURES_SSE2_ENABLED)
+            const __m128i mask = _mm_set1_epi32(0xff);
+            const __m128i bias = _mm_set1_epi16(128);
+
+            #define QUANTIZE_CHANNELS(c, max) _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(c, _mm_set1_epi16(max)), bias), \
+                _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(c, _mm_set1_epi16(max)), bias), 8)), 8)
+
+            for (; i + 8 <= count; i += 8)
+            {
+                __m128i p0 = _mm_loadu_si128((const __m128i *)(src + i));
+                __m128i p1 = _mm_loadu_si128((const __m128i *)(src + i + 4));
+
+                // Every channel of 8 pixels into 16 bit lanes
+                __m128i r = _mm_packs_epi32(_mm_and_si128(p0, mask), _mm_and_si128(p1, mask));
+                __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 8), mask), _mm_and_si128(_mm_srli_epi32(p1, 8), mask));
+                __m128i b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 16), mask), _mm_and_si128(_mm_srli_epi32(p1, 16), mask));
+                __m128i a = _mm_packs_epi32(_mm_srli_epi32(p0, 24), _mm_srli_epi32(p1, 24));
+                __m128i v;
+
+                if (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5)
+                {
+                    v = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(QUANTIZE_CHANNELS(r, 31), 11), _mm_slli_epi16(QUANTIZE_CHANNELS(g, 63), 5)), QUANTIZE_CHANNELS(b, 31));
+                }
+                else if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+                {
+                    __m128i alpha = _mm_and_si128(_mm_cmpgt_epi16(a, _mm_set1_epi16(PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)), _mm_set1_epi16(1));
+                    v = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(QUANTIZE_CHANNELS(r, 31), 11), _mm_slli_epi16(QUANTIZE_CHANNELS(g, 31), 6)),
+                                     _mm_or_si128(_mm_slli_epi16(QUANTIZE_CHANNELS(b, 31), 1), alpha));
+                }
+                else
+                {
+                    v = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(QUANTIZE_CHANNELS(r, 15), 12), _mm_slli_epi16(QUANTIZE_CHANNELS(g, 15), 8)),
+                                     _mm_or_si128(_mm_slli_epi16(QUANTIZE_CHANNELS(b, 15), 4), QUANTIZE_CHANNELS(a, 15)));
+                }
+
+                _mm_storeu_si128((__m128i *)(pixels + i), v);
+            }
+
+            #undef QUANTIZE_CHANNELS
+        #endif
+            for (; i < count; i++)
+            {
+                rl_Color color = src[i];
+
+                if (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) pixels[i] = QuantizeChannel(color.r, 31) << 11 | QuantizeChannel(color.g, 63) << 5 | QuantizeChannel(color.b, 31);
+                else if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1) pixels[i] = QuantizeChannel(color.r, 31) << 11 | QuantizeChannel(color.g, 31) << 6 | QuantizeChannel(color.b, 31) << 1 | ((color.a > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD)? 1 : 0);
+                else pixels[i] = QuantizeChannel(color.r, 15) << 12 | QuantizeChannel(color.g, 15) << 8 | QuantizeChannel(color.b, 15) << 4 | QuantizeChannel(color.a, 15);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
+        {
+            float *pixels = (float *)dst + offset*4;
+        #if defined(RTEXTURES_SSE2_ENABLED)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128 div = _mm_set1_ps(255.0f);
+
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128i p = _mm_loadu_si128((const __m128i *)(src + i));
+                __m128i lo = _mm_unpacklo_epi8(p, zero);
+                __m128i hi = _mm_unpackhi_epi8(p, zero);
+
+                _mm_storeu_ps(pixels + i*4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), div));
+                _mm_storeu_ps(pixels + i*4 + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), div));
+                _mm_storeu_ps(pixels + i*4 + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), div));
+                _mm_storeu_ps(pixels + i*4 + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), div));
+            }
+        #endif
+            for (; i < count; i++)
+            {
+                pixels[i*4] = (float)src[i].r/255.0f;
+                pixels[i*4 + 1] = (float)src[i].g/255.0f;
+                pixels[i*4 + 2] = (float)src[i].b/255.0f;
+                pixels[i*4 + 3] = (float)src[i].a/255.0f;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
+        {
+            float *pixels = (float *)dst + offset*3;
+
+            for (; i < count; i++)
+            {
+                pixels[i*3] = (float)src[i].r/255.0f;
+                pixels[i*3 + 1] = (float)src[i].g/255.0f;
+                pixels[i*3 + 2] = (float)src[i].b/255.0f;
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R32:
+        case PIXELFORMAT_UNCOMPRESSED_R16:
+        {
+            // NOTE: rl_Image is converted to grayscale equivalent
+            for (; i < count; i++)
+            {
+                float luminance = (float)src[i].r/255.0f*0.299f + (float)src[i].g/255.0f*0.587f + (float)src[i].b/255.0f*0.114f;
+
+                if (format == PIXELFORMAT_UNCOMPRESSED_R32) ((float *)dst)[offset + i] = luminance;
+                else ((unsigned short *)dst)[offset + i] = FloatToHalf(luminance);
+            }
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+        {
+            // Half-float values of all 8 bit channel values
+            unsigned short halfs[256] = { 0 };
+            for (int k = 0; k < 256; k++) halfs[k] = FloatToHalf((float)k/255.0f);
+
+            int channels = (format == PIXELFORMAT_UNCOMPRESSED_R16G16B16)? 3 : 4;
+            unsigned short *pixels = (unsigned short *)dst + offset*channels;
+
+            for (; i < count; i++)
+            {
+                pixels[i*channels] = halfs[src[i].r];
+                pixels[i*channels + 1] = halfs[src[i].g];
+                pixels[i*channels + 2] = halfs[src[i].b];
+                if (channels == 4) pixels[i*channels + 3] = halfs[src[i].a];
+            }
+        } break;
+        default: break;
+    }
+}
+
+// Convert pixel data between uncompressed formats without normalized float intermediate
+// NOTE: Only formats pairs where RGBA8 intermediate is lossless are supported: 8 bit per channel
+// source format or 8 bit per channel RGB/RGBA destination format, pixels are converted in chunks
+static bool ConvertPixelData(const void *src, int srcFormat, void *dst, int dstFormat, int pixelCount)
+{
+    if (!IsPixelFormatUnorm8(srcFormat) && (dstFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8) && (dstFormat != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)) return false;
+
+    if (srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) EncodePixelsRGBA8((const rl_Color *)src, pixelCount, dst, dstFormat, 0);
+    else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) DecodePixelsRGBA8(src, srcFormat, 0, pixelCount, (rl_Color *)dst);
+    else
+    {
+        rl_Color chunk[IMAGE_FORMAT_CHUNK_SIZE];
+
+        for (int offset = 0; offset < pixelCount; offset += IMAGE_FORMAT_CHUNK_SIZE)
+        {
+            int count = ((pixelCount - offset) < IMAGE_FORMAT_CHUNK_SIZE)? (pixelCount - offset) : IMAGE_FORMAT_CHUNK_SIZE;
+
+            DecodePixelsRGBA8(src, srcFormat, offset, count, chunk);
+            EncodePixelsRGBA8(chunk, count, dst, dstFormat, offset);
+        }
+    }
+
+    return true;
+}
+
+// Check if pixel format can be drawn through RGBA8 rows
+// NOTE: Decoding and encoding must match rl_GetPixelColor()/rl_SetPixelColor() results
+static bool IsPixelFormatDrawRow(int format)
+{
+    return (IsPixelFormatUnorm8(format) || (format == PIXELFORMAT_UNCOMPRESSED_R5G6B5) || (format == PIXELFORMAT_UNCOMPRESSED_R4G4B4A4));
+}
+
+// Get image view area, clamped to view
+// NOTE: Storage reference is copied but not added, empty view returned if area is out of bounds
+static rl_ImageView GetImageViewArea(rl_ImageView view, rl_Rectangle rec)
+{
+    int x = (int)rec.x;
+    int y = (int)rec.y;
+    int width = (int)rec.width;
+    int height = (int)rec.height;
+
+    // Security checks to validate area rectangle
+    if (x < 0) { width += x; x = 0; }
+    if (y < 0) { height += y; y = 0; }
+    if ((x + width) > view.width) width = view.width - x;
+    if ((y + height) > view.height) height = view.height - y;
+
+    if ((width <= 0) || (height <= 0))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Failed to get view, rectangle out of bounds");
+        return (rl_ImageView){ 0 };
+    }
+
+    view.data = (unsigned char *)view.data + y*view.stride + x*rl_GetPixelDataSize(1, 1, view.format);
+    view.width = width;
+    view.height = height;
+
+    return view;
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Apply color operation to image view pixels, in place through RGBA8 rows chunks
+// NOTE: Operations match rl_Image color functions results, RGBA8 pixels are processed directly
+static void ImageViewColorOperation(rl_ImageView view, int operation, rl_Color color, rl_Color replace, float amount)
+{
+    if (!rl_IsImageViewValid(view)) return;
+
+    if (!IsPixelFormatDrawRow(view.format))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: rl_Image view color operations require 8 bit per channel, R5G6B5 or R4G4B4A4 formats");
+        return;
+    }
+
+    rl_Color colors[IMAGE_FORMAT_CHUNK_SIZE];
+
+    for (int y = 0; y < view.height; y++)
+    {
+        unsigned char *row = (unsigned char *)view.data + y*view.stride;
+
+        for (int offset = 0; offset < view.width; offset += IMAGE_FORMAT_CHUNK_SIZE)
+        {
+            int count = ((view.width - offset) < IMAGE_FORMAT_CHUNK_SIZE)? (view.width - offset) : IMAGE_FORMAT_CHUNK_SIZE;
+            rl_Color *pixels = colors;
+
+            if (view.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) pixels = (rl_Color *)row + offset;
+            else DecodePixelsRGBA8(row, view.format, offset, count, colors);
+
+            switch (operation)
+            {
+                case IMAGE_VIEW_COLOR_TINT:
+                {
+                    for (int i = 0; i < count; i++)
+                    {
+                        pixels[i].r = (unsigned char)(((int)pixels[i].r*(int)color.r)/255);
+                        pixels[i].g = (unsigned char)(((int)pixels[i].g*(int)color.g)/255);
+                        pixels[i].b = (unsigned char)(((int)pixels[i].b*(int)color.b)/255);
+                        pixels[i].a = (unsigned char)(((int)pixels[i].a*(int)color.a)/255);
+                    }
+                } break;
+                case IMAGE_VIEW_COLOR_INVERT:
+                {
+                    for (int i = 0; i < count; i++)
                     {
-                        // ------------------------------------------------------------
-                        // MIDDLE-LEFT QUAD
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
-                        if (drawCenter)
+                        pixels[i].r = 255 - pixels[i].r;
+                        pixels[i].g = 255 - pixels[i].g;
+                        pixels[i].b = 255 - pixels[i].b;
+                    }
+                } break;
+                case IMAGE_VIEW_COLOR_GRAYSCALE:
+                {
+                    for (int i = 0; i < count; i++)
+                    {
+                        float r = (float)pixels[i].r/255.0f;
+                        float g = (float)pixels[i].g/255.0f;
+                        float b = (float)pixels[i].b/255.0f;
+                        unsigned char gray = (unsigned char)((r*0.299f + g*0.587f + b*0.114f)*255.0f);
+
+                        pixels[i].r = gray;
+                        pixels[i].g = gray;
+                        pixels[i].b = gray;
+                    }
+                } break;
+                case IMAGE_VIEW_COLOR_CONTRAST:
+                {
+                    for (int i = 0; i < count; i++)
+                    {
+                        unsigned char *channels[3] = { &pixels[i].r, &pixels[i].g, &pixels[i].b };
+
+                        for (int c = 0; c < 3; c++)
                         {
-                            // MIDDLE-CENTER QUAD
-                            rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Bottom-left corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-right corner for texture and quad
-                            rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-right corner for texture and quad
-                            rlTexCoord2f(coordB.x, coordB.y); rlVertex2f(vertB.x, vertB.y);  // Top-left corner for texture and quad
+                            float p = (float)*channels[c]/255.0f;
+                            p -= 0.5f;
+                            p *= amount;
+                            p += 0.5f;
+                            p *= 255;
+                            if (p < 0) p = 0;
+                            if (p > 255) p = 255;
+
+                            *channels[c] = (unsigned char)p;
                         }
+                    }
+                } break;
+                case IMAGE_VIEW_COLOR_BRIGHTNESS:
+                {
+                    int brightness = (int)amount;
+
+                    for (int i = 0; i < count; i++)
+                    {
+                        int cR = pixels[i].r + brightness;
+                        int cG = pixels[i].g + brightness;
+                        int cB = pixels[i].b + brightness;
+
+                        if (cR < 0) cR = 1;
+                        if (cR > 255) cR = 255;
+
+                        if (cG < 0) cG = 1;
+                        if (cG > 255) cG = 255;
+
+                        if (cB < 0) cB = 1;
+                        if (cB > 255) cB = 255;
+
+                        pixels[i].r = (unsigned char)cR;
+                        pixels[i].g = (unsigned char)cG;
+                        pixels[i].b = (unsigned char)cB;
+                    }
+                } break;
+                case IMAGE_VIEW_COLOR_REPLACE:
+                {
+                    for (int i = 0; i < count; i++)
+                    {
+                        if ((pixels[i].r == color.r) &&
+                            (pixels[i].g == color.g) &&
+                            (pixels[i].b == color.b) &&
+                            (pixels[i].a == color.a)) pixels[i] = replace;
+                    }
+                } break;
+                default: break;
+            }
+
+            if (view.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) EncodePixelsRGBA8(colors, count, row, view.format, offset);
+        }
+    }
+}
+#endif
+
+// Blend RGBA8 source color (tinted) over destination color, same results as rl_ColorAlphaBlend() integer blending
+// NOTE: Blending over opaque destination divides by constant alpha (255)
+static inline rl_Color BlendColorRGBA8(rl_Color dst, rl_Color src)
+{
+    rl_Color out = dst;
+
+    if (src.a == 255) out = src;
+    else if (src.a > 0)
+    {
+        unsigned int alpha = (unsigned int)src.a + 1;
+
+        if (dst.a == 255)
+        {
+            // NOTE: Blended alpha is always 255 over opaque destination
+            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*255*(256 - alpha))/255) >> 8);
+            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*255*(256 - alpha))/255) >> 8);
+            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*255*(256 - alpha))/255) >> 8);
+        }
+        else
+        {
+            unsigned int outAlpha = (alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8;
+
+            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/outAlpha) >> 8);
+            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/outAlpha) >> 8);
+            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/outAlpha) >> 8);
+            out.a = (unsigned char)outAlpha;
+        }
+    }
+
+    return out;
+}
+
+// Blend RGBA8 source colors over destination colors, same results as rl_ColorAlphaBlend() integer blending
+// NOTE: With no tint, groups of fully opaque or fully transparent source pixels are copied or skipped
+static void BlendColorsRGBA8(rl_Color *dst, const rl_Color *src, int count, rl_Color tint)
+{
+    int i = 0;
+
+    if ((tint.r == 255) && (tint.g == 255) && (tint.b == 255) && (tint.a == 255))
+    {
+    #if defined(RTEXTURES_SSE2_ENABLED)
+        const __m128i alphaMask = _mm_set1_epi32((int)0xff000000);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i color = _mm_loadu_si128((const __m128i *)(src + i));
+            __m128i alpha = _mm_and_si128(color, alphaMask);
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask)) == 0xffff) _mm_storeu_si128((__m128i *)(dst + i), color);
+            else if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, _mm_setzero_si128())) != 0xffff)
+            {
+                for (int k = i; k < (i + 4); k++) dst[k] = BlendColorRGBA8(dst[k], src[k]);
+            }
+        }
+    #endif
+        for (; i < count; i++) dst[i] = BlendColorRGBA8(dst[i], src[i]);
+    }
+    else
+    {
+        for (; i < count; i++)
+        {
+            // Apply color tint to source color
+            rl_Color color = {
+                (unsigned char)(((unsigned int)src[i].r*((unsigned int)tint.r + 1)) >> 8),
+                (unsigned char)(((unsigned int)src[i].g*((unsigned int)tint.g + 1)) >> 8),
+                (unsigned char)(((unsigned int)src[i].b*((unsigned int)tint.b + 1)) >> 8),
+                (unsigned char)(((unsigned int)src[i].a*((unsigned int)tint.a + 1)) >> 8)
+            };
+
+            dst[i] = BlendColorRGBA8(dst[i], color);
+        }
+    }
+}
+
+// Draw pixels row from source into destination, through RGBA8 chunks
+// NOTE: RGBA8 rows are read and blended in-place, no conversion required
+static void ImageDrawRow(unsigned char *dst, int dstFormat, const unsigned char *src, int srcFormat, int width, rl_Color tint, bool blend)
+{
+    rl_Color srcColors[IMAGE_FORMAT_CHUNK_SIZE];
+    rl_Color dstColors[IMAGE_FORMAT_CHUNK_SIZE];
+
+    for (int offset = 0; offset < width; offset += IMAGE_FORMAT_CHUNK_SIZE)
+    {
+        int count = ((width - offset) < IMAGE_FORMAT_CHUNK_SIZE)? (width - offset) : IMAGE_FORMAT_CHUNK_SIZE;
+        const rl_Color *srcRow = srcColors;
+
+        if (srcFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) srcRow = (const rl_Color *)src + offset;
+        else DecodePixelsRGBA8(src, srcFormat, offset, count, srcColors);
+
+        if (!blend) EncodePixelsRGBA8(srcRow, count, dst, dstFormat, offset);
+        else if (dstFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) BlendColorsRGBA8((rl_Color *)dst + offset, srcRow, count, tint);
+        else
+        {
+            DecodePixelsRGBA8(dst, dstFormat, offset, count, dstColors);
+            BlendColorsRGBA8(dstColors, srcRow, count, tint);
+            EncodePixelsRGBA8(dstColors, count, dst, dstFormat, offset);
+        }
+    }
+}
+
+// Image filters pixel operations, channels are processed in the same order and precision as scalar code
+static inline FilterPixel LoadFilterPixel(const rl_Vector4 *pixel)
+{
+#if defined(RTEXTURES_SSE2_ENABLED)
+    return _mm_loadu_ps((const float *)pixel);
+#elif defined(RTEXTURES_NEON_ENABLED)
+    return vld1q_f32((const float *)pixel);
+#else
+    return *pixel;
+#endif
+}
+
+static inline void StoreFilterPixel(rl_Vector4 *pixel, FilterPixel value)
+{
+#if defined(RTEXTURES_SSE2_ENABLED)
+    _mm_storeu_ps((float *)pixel, value);
+#elif defined(RTEXTURES_NEON_ENABLED)
+    vst1q_f32((float *)pixel, value);
+#else
+    *pixel = value;
+#endif
+}
+
+static inline FilterPixel ZeroFilterPixel(void)
+{
+#if defined(RTEXTURES_SSE2_ENABLED)
+    return _mm_setzero_ps();
+#elif defined(RTEXTURES_NEON_ENABLED)
+    return vdupq_n_f32(0.0f);
+#else
+    FilterPixel result = { 0.0f, 0.0f, 0.0f, 0.0f };
+    return result;
+#endif
+}
+
+static inline FilterPixel AddFilterPixel(FilterPixel a, FilterPixel b)
+{
+#if defined(RTEXTURES_SSE2_ENABLED)
+    return _mm_add_ps(a, b);
+#elif defined(RTEXTURES_NEON_ENABLED)
+    return vaddq_f32(a, b);
+#else
+    FilterPixel result = { a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w };
+    return result;
+#endif
+}
+
+static inline FilterPixel SubtractFilterPixel(FilterPixel a, FilterPixel b)
+{
+#if defined(RTEXTURES_SSE2_ENABLED)
+    return _mm_sub_ps(a, b);
+#elif defined(RTEXTURES_NEON_ENABLED)
+    return vsubq_f32(a, b);
+#else
+    FilterPixel result = { a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w };
+    return result;
+#endif
+}
+
+static inline FilterPixel MultiplyFilterPixel(FilterPixel a, FilterPixel b)
+{
+#if defined(RTEXTURES_SSE2_ENABLED)
+    return _mm_mul_ps(a, b);
+#elif defined(RTEXTURES_NEON_ENABLED)
+    return vmulq_f32(a, b);
+#else
+    FilterPixel result = { a.x*b.x, a.y*b.y, a.z*b.z, a.w*b.w };
+    return result;
+#endif
+}
+
+static inline FilterPixel SplatFilterPixel(float value)
+{
+#if defined(RTEXTURES_SSE2_ENABLED)
+    return _mm_set1_ps(value);
+#elif defined(RTEXTURES_NEON_ENABLED)
+    return vdupq_n_f32(value);
+#else
+    FilterPixel result = { value, value, value, value };
+    return result;
+#endif
+}
+
+// Add pixel scaled by weight to sum, multiply and add are not fused
+static inline FilterPixel AddScaledFilterPixel(FilterPixel sum, const rl_Vector4 *pixel, float weight)
+{
+#if defined(RTEXTURES_SSE2_ENABLED)
+    return _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps((const float *)pixel), _mm_set1_ps(weight)));
+#elif defined(RTEXTURES_NEON_ENABLED)
+    return vaddq_f32(sum, vmulq_n_f32(vld1q_f32((const float *)pixel), weight));
+#else
+    FilterPixel result = { sum.x + pixel->x*weight, sum.y + pixel->y*weight, sum.z + pixel->z*weight, sum.w + pixel->w*weight };
+    return result;
+#endif
+}
+
+static inline FilterPixel DivideFilterPixel(FilterPixel value, float divisor)
+{
+#if defined(RTEXTURES_SSE2_ENABLED)
+    return _mm_div_ps(value, _mm_set1_ps(divisor));
+#elif defined(RTEXTURES_NEON_ENABLED) && (defined(__aarch64__) || defined(_M_ARM64))
+    return vdivq_f32(value, vdupq_n_f32(divisor));
+#elif defined(RTEXTURES_NEON_ENABLED)
+    // NOTE: ARMv7 NEON has no division, reciprocal estimate is not precise enough
+    float lanes[4] = { 0 };
+    vst1q_f32(lanes, value);
+    for (int i = 0; i < 4; i++) lanes[i] /= divisor;
+    return vld1q_f32(lanes);
+#else
+    FilterPixel result = { value.x/divisor, value.y/divisor, value.z/divisor, value.w/divisor };
+    return result;
+#endif
+}
+
+// Truncate pixel channels toward zero (channels expected in [0..255] range)
+static inline FilterPixel TruncateFilterPixel(FilterPixel value)
+{
+#if defined(RTEXTURES_SSE2_ENABLED)
+    return _mm_cvtepi32_ps(_mm_cvttps_epi32(value));
+#elif defined(RTEXTURES_NEON_ENABLED)
+    return vcvtq_f32_s32(vcvtq_s32_f32(value));
+#else
+    FilterPixel result = { (float)(int)value.x, (float)(int)value.y, (float)(int)value.z, (float)(int)value.w };
+    return result;
+#endif
+}
+
+// Store convolution result color, RGB channels are clamped to [0..1], alpha is not
+static inline void StoreConvolutionColor(rl_Color *color, FilterPixel value)
+{
+    float channels[4] = { 0 };
+
+#if defined(RTEXTURES_SSE2_ENABLED)
+    _mm_storeu_ps(channels, value);
+#elif defined(RTEXTURES_NEON_ENABLED)
+    vst1q_f32(channels, value);
+#else
+    channels[0] = value.x;
+    channels[1] = value.y;
+    channels[2] = value.z;
+    channels[3] = value.w;
+#endif
+
+    for (int i = 0; i < 3; i++)
+    {
+        if (channels[i] < 0.0f) channels[i] = 0.0f;
+        if (channels[i] > 1.0f) channels[i] = 1.0f;
+    }
+
+    color->r = (unsigned char)(channels[0]*255.0f);
+    color->g = (unsigned char)(channels[1]*255.0f);
+    color->b = (unsigned char)(channels[2]*255.0f);
+    color->a = (unsigned char)(channels[3]*255.0f);
+}
+
+// Check if square kernel is separable (outer product of a column and a row 1D kernels)
+// NOTE: 1D kernels are scaled by the largest weight, tolerance is relative to it
+static bool IsKernelSeparable(const float *kernel, int kernelWidth, float *columnWeights, float *rowWeights)
+{
+    int pivot = 0;
+    float pivotWeight = 0.0f;
+
+    for (int i = 0; i < kernelWidth*kernelWidth; i++)
+    {
+        if (fabsf(kernel[i]) > pivotWeight)
+        {
+            pivotWeight = fabsf(kernel[i]);
+            pivot = i;
+        }
+    }
+
+    if (pivotWeight == 0.0f) return false;
+
+    int pivotRow = pivot/kernelWidth;
+    int pivotColumn = pivot%kernelWidth;
+
+    for (int i = 0; i < kernelWidth; i++)
+    {
+        columnWeights[i] = kernel[i*kernelWidth + pivotColumn];
+        rowWeights[i] = kernel[pivotRow*kernelWidth + i]/kernel[pivot];
+    }
+
+    for (int y = 0; y < kernelWidth; y++)
+    {
+        for (int x = 0; x < kernelWidth; x++)
+        {
+            if (fabsf(kernel[y*kernelWidth + x] - columnWeights[y]*rowWeights[x]) > pivotWeight*1e-5f) return false;
+        }
+    }
+
+    return true;
+}
+
+// Process box blur horizontal pass rows range on current thread
+// NOTE: Box is clamped to image bounds, the running sum is averaged by the pixels it holds
+static void ProcessBlurRowsRange(const void *data, int start, int end)
+{
+    const BlurPassJob *job = (const BlurPassJob *)data;
+    int width = job->width;
+    int blurSize = job->blurSize;
+    int initSize = (blurSize < width)? blurSize : width;
+
+    for (int row = start; row < end; row++)
+    {
+        const rl_Vector4 *src = job->src + row*width;
+        rl_Vector4 *dst = job->dst + row*width;
+        FilterPixel sum = ZeroFilterPixel();
+        int convolutionSize = initSize;
+
+        for (int i = 0; i < initSize; i++) sum = AddFilterPixel(sum, LoadFilterPixel(&src[i]));
+
+        for (int x = 0; x < width; x++)
+        {
+            if (x - blurSize - 1 >= 0)
+            {
+                sum = SubtractFilterPixel(sum, LoadFilterPixel(&src[x - blurSize - 1]));
+                convolutionSize--;
+            }
+
+            if (x + blurSize < width)
+            {
+                sum = AddFilterPixel(sum, LoadFilterPixel(&src[x + blurSize]));
+                convolutionSize++;
+            }
+
+            StoreFilterPixel(&dst[x], DivideFilterPixel(sum, (float)convolutionSize));
+        }
+    }
+}
+
+// Process box blur vertical pass columns range on current thread
+// NOTE: Columns are processed in bands, running sums of a band are updated row by row
+static void ProcessBlurColumnsRange(const void *data, int start, int end)
+{
+    const BlurPassJob *job = (const BlurPassJob *)data;
+    int width = job->width;
+    int height = job->height;
+    int blurSize = job->blurSize;
+    int initSize = (blurSize < height)? blurSize : height;
+    FilterPixel sums[IMAGE_FILTER_CHUNK_COLUMNS];
+
+    for (int bandStart = start; bandStart < end; bandStart += IMAGE_FILTER_CHUNK_COLUMNS)
+    {
+        int bandSize = ((end - bandStart) < IMAGE_FILTER_CHUNK_COLUMNS)? (end - bandStart) : IMAGE_FILTER_CHUNK_COLUMNS;
+        const rl_Vector4 *src = job->src + bandStart;
+        rl_Vector4 *dst = job->dst + bandStart;
+        int convolutionSize = initSize;
+
+        for (int c = 0; c < bandSize; c++) sums[c] = ZeroFilterPixel();
+
+        for (int i = 0; i < initSize; i++)
+        {
+            for (int c = 0; c < bandSize; c++) sums[c] = AddFilterPixel(sums[c], LoadFilterPixel(&src[i*width + c]));
+        }
+
+        for (int y = 0; y < height; y++)
+        {
+            if (y - blurSize - 1 >= 0)
+            {
+                const rl_Vector4 *removed = src + (y - blurSize - 1)*width;
+                for (int c = 0; c < bandSize; c++) sums[c] = SubtractFilterPixel(sums[c], LoadFilterPixel(&removed[c]));
+                convolutionSize--;
+            }
+
+            if (y + blurSize < height)
+            {
+                const rl_Vector4 *added = src + (y + blurSize)*width;
+                for (int c = 0; c < bandSize; c++) sums[c] = AddFilterPixel(sums[c], LoadFilterPixel(&added[c]));
+                convolutionSize++;
+            }
+
+            for (int c = 0; c < bandSize; c++) StoreFilterPixel(&dst[y*width + c], TruncateFilterPixel(DivideFilterPixel(sums[c], (float)convolutionSize)));
+        }
+    }
+}
+
+// Process square kernel convolution rows range on current thread
+// NOTE: Samples are accumulated in kernel order, out of image data samples are zero
+static void ProcessConvolutionRange(const void *data, int start, int end)
+{
+    const ConvolutionJob *job = (const ConvolutionJob *)data;
+    int width = job->width;
+    int kernelWidth = job->kernelWidth;
+    int offset = -kernelWidth/2;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            FilterPixel sum = ZeroFilterPixel();
+            const float *weights = job->kernel;
+
+            for (int ky = 0; ky < kernelWidth; ky++)
+            {
+                const rl_Vector4 *src = job->src + (y + ky + offset)*width + x + offset;
+                for (int kx = 0; kx < kernelWidth; kx++) sum = AddScaledFilterPixel(sum, &src[kx], weights[kx]);
+                weights += kernelWidth;
+            }
+
+            StoreConvolutionColor(&job->colors[y*width + x], sum);
+        }
+    }
+}
+
+// Process separable kernel horizontal pass rows range on current thread
+// NOTE: Range includes rows out of image, required by the vertical pass
+static void ProcessConvolutionRowsRange(const void *data, int start, int end)
+{
+    const ConvolutionJob *job = (const ConvolutionJob *)data;
+    int width = job->width;
+    int kernelWidth = job->kernelWidth;
+    int offset = -kernelWidth/2;
+
+    for (int row = start; row < end; row++)
+    {
+        const rl_Vector4 *src = job->src + (job->firstRow + row)*width + offset;
+        rl_Vector4 *dst = job->dst + row*width;
+
+        for (int x = 0; x < width; x++)
+        {
+            FilterPixel sum = ZeroFilterPixel();
+            for (int k = 0; k < kernelWidth; k++) sum = AddScaledFilterPixel(sum, &src[x + k], job->kernel[k]);
+            StoreFilterPixel(&dst[x], sum);
+        }
+    }
+}
+
+// Process separable kernel vertical pass rows range on current thread
+static void ProcessConvolutionColumnsRange(const void *data, int start, int end)
+{
+    const ConvolutionJob *job = (const ConvolutionJob *)data;
+    int width = job->width;
+    int kernelWidth = job->kernelWidth;
+    int offset = -kernelWidth/2;
+
+    for (int y = start; y < end; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            FilterPixel sum = ZeroFilterPixel();
+            const rl_Vector4 *src = job->src + (y + offset)*width + x;
+
+            for (int k = 0; k < kernelWidth; k++) sum = AddScaledFilterPixel(sum, &src[k*width], job->kernel[k]);
+
+            StoreConvolutionColor(&job->colors[y*width + x], sum);
+        }
+    }
+}
+
+// Get pixel format resize layout and data type, returns false if format is not resized directly
+static bool GetImageResizeLayout(int format, stbir_pixel_layout *layout, stbir_datatype *type)
+{
+    bool result = true;
+    *type = STBIR_TYPE_UINT8;
+
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: *layout = STBIR_1CHANNEL; break;
+        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: *layout = STBIR_2CHANNEL; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: *layout = STBIR_RGB; break;
+        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: *layout = STBIR_RGBA; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32: *layout = STBIR_1CHANNEL; *type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: *layout = STBIR_RGB; *type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: *layout = STBIR_RGBA; *type = STBIR_TYPE_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16: *layout = STBIR_1CHANNEL; *type = STBIR_TYPE_HALF_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: *layout = STBIR_RGB; *type = STBIR_TYPE_HALF_FLOAT; break;
+        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: *layout = STBIR_RGBA; *type = STBIR_TYPE_HALF_FLOAT; break;
+        default: result = false; break;
+    }
+
+    return result;
+}
+
+// Check if pixel format is resized directly (8 bit, 16 bit half float and 32 bit float channels)
+static bool IsPixelFormatResizable(int format)
+{
+    stbir_pixel_layout layout = STBIR_RGBA;
+    stbir_datatype type = STBIR_TYPE_UINT8;
+
+    return GetImageResizeLayout(format, &layout, &type);
+}
+
+// Resize pixel data (image or image region), output rows split between threads (0: worker threads count)
+// NOTE: Input rows stride in bytes (0: packed rows), resize samplers are allocated from frame arena
+static bool ResizeImageData(const void *input, int width, int height, int inputStride, void *output, int newWidth, int newHeight, int format, int threadCount)
+{
+    stbir_pixel_layout layout = STBIR_RGBA;
+    stbir_datatype type = STBIR_TYPE_UINT8;
+
+    if (!GetImageResizeLayout(format, &layout, &type)) return false;
+
+    MemoryFrameMark mark = GetMemoryFrameMark();
+
+    STBIR_RESIZE resize = { 0 };
+    stbir_resize_init(&resize, input, width, height, inputStride, output, newWidth, newHeight, 0, layout, type);
+    stbir_set_user_data(&resize, &imageResizeScratch);
+
+    if (threadCount <= 0)
+    {
+        threadCount = 1;
+    #if defined(SUPPORT_IMAGE_WORKER_THREADS)
+        // Job system worker threads plus caller thread
+        threadCount = rl_GetJobWorkerCount() + 1;
+    #endif
+    }
+
+    // Samplers are built once and shared by all splits, splits count can be lower than requested for small outputs
+    int splitCount = stbir_build_samplers_with_splits(&resize, threadCount);
+
+    if (splitCount > 0)
+    {
+        WorkerJob job = { ProcessImageResizeRange, &resize, splitCount, 1 };
+        RunWorkerJob(&job);
+
+        stbir_free_samplers(&resize);
+    }
+
+    ReleaseMemoryFrame(mark);
+
+    return (splitCount > 0);
+}
+
+// Process image resize splits range on current thread
+// NOTE: Splits write independent output rows, samplers are read only
+static void ProcessImageResizeRange(const void *data, int start, int end)
+{
+    stbir_resize_extended_split((STBIR_RESIZE *)data, start, end - start);
+}
+
+// Get image alpha test coverage, pixels fraction with scaled alpha over cutoff
+static float GetImageAlphaCoverage(const unsigned char *pixels, int count, int channels, int alphaChannel, float cutoff, float scale)
+{
+    float threshold = cutoff*255.0f;
+    int covered = 0;
+
+    for (int i = 0; i < count; i++) if ((pixels[i*channels + alphaChannel]*scale) > threshold) covered++;
+
+    return (count > 0)? (float)covered/count : 0.0f;
+}
+
+// Scale image alpha to match provided alpha test coverage
+// NOTE: Scale is searched by bisection, alpha test coverage grows with scale
+static void ScaleImageAlphaCoverage(unsigned char *pixels, int count, int channels, int alphaChannel, float cutoff, float coverage)
+{
+    float minScale = 0.0f;
+    float maxScale = 4.0f;
+    float scale = 1.0f;
+
+    for (int i = 0; i < 10; i++)
+    {
+        float levelCoverage = GetImageAlphaCoverage(pixels, count, channels, alphaChannel, cutoff, scale);
+
+        if (levelCoverage < coverage) minScale = scale;
+        else if (levelCoverage > coverage) maxScale = scale;
+        else break;
+
+        scale = (minScale + maxScale)/2.0f;
+    }
+
+    if (scale != 1.0f)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            float alpha = pixels[i*channels + alphaChannel]*scale + 0.5f;
+            pixels[i*channels + alphaChannel] = (alpha > 255.0f)? 255 : (unsigned char)alpha;
+        }
+    }
+}
+
+// Load sRGB conversion tables used by mipmaps filtering in linear space (on first use)
+static void LoadMipmapSrgbTables(void)
+{
+    if (mipmapSrgbTables.loaded) return;
+
+    for (int i = 0; i < 256; i++)
+    {
+        float value = i/255.0f;
+        mipmapSrgbTables.linear[i] = (value <= 0.04045f)? value/12.92f : powf((value + 0.055f)/1.055f, 2.4f);
+    }
+
+    for (int i = 0; i < IMAGE_MIPMAP_SRGB_TABLE_SIZE; i++)
+    {
+        float value = (float)i/(IMAGE_MIPMAP_SRGB_TABLE_SIZE - 1);
+        float srgb = (value <= 0.0031308f)? value*12.92f : 1.055f*powf(value, 1.0f/2.4f) - 0.055f;
+        mipmapSrgbTables.srgb[i] = (unsigned char)(srgb*255.0f + 0.5f);
+    }
+
+    mipmapSrgbTables.loaded = true;
+}
+
+// Get modified Bessel function of first kind (order 0), used by Kaiser window
+static float GetBesselI0(float x)
+{
+    float sum = 1.0f;
+    float term = 1.0f;
+
+    for (int k = 1; k < 32; k++)
+    {
+        term *= (x/(2.0f*k))*(x/(2.0f*k));
+        sum += term;
+
+        if (term < sum*1e-7f) break;
+    }
+
+    return sum;
+}
+
+// Get mipmap filter taps for every destination pixel along one dimension
+// NOTE: Source indices are clamped to edges, weights are normalized
+static void GetMipmapFilterTaps(MipmapTaps *taps, int srcSize, int dstSize, int filter)
+{
+    float scale = (float)srcSize/dstSize;
+
+    for (int x = 0; x < dstSize; x++)
+    {
+        MipmapTaps *tap = &taps[x];
+        tap->count = 0;
+
+        if (srcSize == dstSize)
+        {
+            tap->index[0] = x;
+            tap->weight[0] = 1.0f;
+            tap->count = 1;
+        }
+        else if (filter == MIPMAP_FILTER_KAISER)
+        {
+            // Kaiser windowed sinc, radius defined in destination pixels
+            float center = (x + 0.5f)*scale;
+            float windowScale = 1.0f/GetBesselI0(IMAGE_MIPMAP_KAISER_ALPHA);
+            float sum = 0.0f;
+
+            for (int s = (int)floorf(center - IMAGE_MIPMAP_KAISER_RADIUS*scale); (s <= (int)ceilf(center + IMAGE_MIPMAP_KAISER_RADIUS*scale)) && (tap->count < IMAGE_MIPMAP_MAX_TAPS); s++)
+            {
+                float t = (s + 0.5f - center)/scale;
+                if (fabsf(t) >= IMAGE_MIPMAP_KAISER_RADIUS) continue;
+
+                float sinc = (t == 0.0f)? 1.0f : sinf(rl_PI*t)/(rl_PI*t);
+                float window = t/IMAGE_MIPMAP_KAISER_RADIUS;
+                float weight = sinc*GetBesselI0(IMAGE_MIPMAP_KAISER_ALPHA*sqrtf(1.0f - window*window))*windowScale;
+
+                tap->index[tap->count] = (s < 0)? 0 : ((s >= srcSize)? srcSize - 1 : s);
+                tap->weight[tap->count] = weight;
+                tap->count++;
+                sum += weight;
+            }
+
+            for (int i = 0; i < tap->count; i++) tap->weight[i] /= sum;
+        }
+        else
+        {
+            // Box filter, last pixel of odd sizes covers three source pixels
+            tap->count = (((srcSize%2) != 0) && (x == (dstSize - 1)))? 3 : 2;
+
+            for (int i = 0; i < tap->count; i++)
+            {
+                tap->index[i] = 2*x + i;
+                tap->weight[i] = 1.0f/tap->count;
+            }
+        }
+    }
+}
+
+// Generate mipmap level from previous level (8 bit per channel formats)
+// NOTE: Box filter on even sizes uses integer path, other filters are processed in floating point
+static void GenImageMipmapLevel(const unsigned char *src, int srcWidth, int srcHeight, unsigned char *dst, int dstWidth, int dstHeight, int channels, int filter, bool srgb)
+{
+    MipmapJob mipmap = { src, dst, srcWidth, srcHeight, dstWidth, dstHeight, channels, { false }, NULL, NULL };
+    WorkerJob job = { ProcessMipmapBoxRange, &mipmap, dstHeight, IMAGE_FILTER_CHUNK_ROWS };
+    MipmapTaps *taps = NULL;
+
+    if ((filter != MIPMAP_FILTER_BOX) || srgb || (((srcWidth%2) != 0) && (srcWidth != 1)) || (((srcHeight%2) != 0) && (srcHeight != 1)))
+    {
+        taps = (MipmapTaps *)RL_MALLOC((dstWidth + dstHeight)*sizeof(MipmapTaps));
+        if (taps == NULL) return;
+
+        GetMipmapFilterTaps(taps, srcWidth, dstWidth, filter);
+        GetMipmapFilterTaps(taps + dstWidth, srcHeight, dstHeight, filter);
+
+        // Alpha channel is always filtered as linear data
+        for (int c = 0; c < channels; c++) mipmap.srgb[c] = srgb && !(((channels == 2) || (channels == 4)) && (c == (channels - 1)));
+
+        mipmap.tapsX = taps;
+        mipmap.tapsY = taps + dstWidth;
+        job.process = ProcessMipmapFilterRange;
+    }
+
+    RunWorkerJob(&job);
+
+    RL_FREE(taps);
+}
+
+// Load blue noise dithering thresholds tile (on first use)
+// NOTE: Tile is generated with void-and-cluster algorithm (toroidal gaussian energy, sigma 1.5),
+// initial pattern is deterministic, so tile is the same on every run
+static void LoadDitherBlueNoise(void)
+{
+    if (ditherBlueNoise.loaded) return;
+
+    const int size = DITHER_BLUE_NOISE_SIZE;
+    const int count = size*size;
+    const int initialCount = count/10;
+
+    float *kernel = (float *)RL_MALLOC(count*sizeof(float));
+    float *energy = (float *)RL_CALLOC(count, sizeof(float));
+    float *initialEnergy = (float *)RL_MALLOC(count*sizeof(float));
+    unsigned char *pattern = (unsigned char *)RL_CALLOC(count, sizeof(unsigned char));
+    unsigned char *initialPattern = (unsigned char *)RL_MALLOC(count*sizeof(unsigned char));
+    int *ranks = (int *)RL_MALLOC(count*sizeof(int));
+
+    // Gaussian energy of every toroidal offset
+    for (int y = 0; y < size; y++)
+    {
+        for (int x = 0; x < size; x++)
+        {
+            int dx = (x < size - x)? x : size - x;
+            int dy = (y < size - y)? y : size - y;
+            kernel[y*size + x] = expf(-(float)(dx*dx + dy*dy)/(2.0f*1.5f*1.5f));
+        }
+    }
+
+    #define UPDATE_DITHER_ENERGY(index, sign) \
+        for (int j = 0, ix = (index)%size, iy = (index)/size; j < count; j++) \
+            energy[j] += (sign)*kernel[(((j/size) - iy)&(size - 1))*size + (((j%size) - ix)&(size - 1))]
+
+    // Tightest cluster (maximum energy one) or largest void (minimum energy zero)
+    #define FIND_DITHER_EXTREME(result, value, compare) \
+        result = -1; \
+        for (int j = 0; j < count; j++) \
+            if ((pattern[j] == (value)) && ((result < 0) || (energy[j] compare energy[result]))) result = j
+
+    // Initial pattern: pseudo-random points, relaxed moving tightest cluster to largest void
+    unsigned int seed = 0x2545f491;
+    for (int placed = 0; placed < initialCount;)
+    {
+        seed = seed*1664525u + 1013904223u;
+        int index = (int)((seed >> 8)%(unsigned int)count);
+
+        if (pattern[index] == 0)
+        {
+            pattern[index] = 1;
+            UPDATE_DITHER_ENERGY(index, 1.0f);
+            placed++;
+        }
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        int cluster = 0;
+        int largestVoid = 0;
+
+        FIND_DITHER_EXTREME(cluster, 1, >);
+        pattern[cluster] = 0;
+        UPDATE_DITHER_ENERGY(cluster, -1.0f);
+
+        FIND_DITHER_EXTREME(largestVoid, 0, <);
+        pattern[largestVoid] = 1;
+        UPDATE_DITHER_ENERGY(largestVoid, 1.0f);
+
+        if (largestVoid == cluster) break;
+    }
+
+    memcpy(initialPattern, pattern, count*sizeof(unsigned char));
+    memcpy(initialEnergy, energy, count*sizeof(float));
+
+    // Ranks of initial points, removing tightest clusters
+    for (int rank = initialCount - 1; rank >= 0; rank--)
+    {
+        int cluster = 0;
+
+        FIND_DITHER_EXTREME(cluster, 1, >);
+        pattern[cluster] = 0;
+        UPDATE_DITHER_ENERGY(cluster, -1.0f);
+        ranks[cluster] = rank;
+    }
+
+    // Ranks of remaining points, filling largest voids
+    memcpy(pattern, initialPattern, count*sizeof(unsigned char));
+    memcpy(energy, initialEnergy, count*sizeof(float));
+
+    for (int rank = initialCount; rank < count; rank++)
+    {
+        int largestVoid = 0;
+
+        FIND_DITHER_EXTREME(largestVoid, 0, <);
+        pattern[largestVoid] = 1;
+        UPDATE_DITHER_ENERGY(largestVoid, 1.0f);
+        ranks[largestVoid] = rank;
+    }
+
+    #undef UPDATE_DITHER_ENERGY
+    #undef FIND_DITHER_EXTREME
+
+    for (int i = 0; i < count; i++) ditherBlueNoise.thresholds[i] = (unsigned char)((long long)ranks[i]*255/count);
+
+    RL_FREE(kernel);
+    RL_FREE(energy);
+    RL_FREE(initialEnergy);
+    RL_FREE(pattern);
+    RL_FREE(initialPattern);
+    RL_FREE(ranks);
+
+    ditherBlueNoise.loaded = true;
+}
+
+// Process image ordered dithering rows range on current thread
+// NOTE: Channels are quantized as (c*levels + threshold)/255, exact integer division
+// computed as ((x + 1 + (x >> 8)) >> 8), 8 pixels at once (SIMD)
+static void ProcessDitherRange(const void *data, int start, int end)
+{
+    const DitherJob *job = (const DitherJob *)data;
+    const int levels[4] = { (1 << job->bpp[0]) - 1, (1 << job->bpp[1]) - 1, (1 << job->bpp[2]) - 1, (1 << job->bpp[3]) - 1 };
+    const int shifts[4] = { job->bpp[1] + job->bpp[2] + job->bpp[3], job->bpp[2] + job->bpp[3], job->bpp[3], 0 };
+    const bool alphaDither = (job->bpp[3] > 1);    // Single bit alpha is rounded, dithered cutout edges are avoided
+
+    for (int y = start; y < end; y++)
+    {
+        const rl_Color *pixels = job->pixels + (size_t)y*job->width;
+        unsigned short *dst = job->dst + (size_t)y*job->width;
+        const unsigned char *thresholds = job->thresholds + (y&(job->size - 1))*job->size;
+        int x = 0;
+
+    #if defined(RTEXTURES_SSE2_ENABLED)
+        const __m128i mask = _mm_set1_epi32(0xff);
+        const __m128i one = _mm_set1_epi16(1);
+        const __m128i alphaRound = _mm_set1_epi16(127);
+        __m128i channelLevels[4];
+        for (int c = 0; c < 4; c++) channelLevels[c] = _mm_set1_epi16((short)levels[c]);
+
+        for (; x + 8 <= job->width; x += 8)
+        {
+            __m128i p0 = _mm_loadu_si128((const __m128i *)(pixels + x));
+            __m128i p1 = _mm_loadu_si128((const __m128i *)(pixels + x + 4));
+            __m128i threshold = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(thresholds + (x&(job->size - 1)))), _mm_setzero_si128());
+            __m128i result = _mm_setzero_si128();
+
+            for (int c = 0; c < 4; c++)
+            {
+                // Channel values as 16 bit lanes (values fit signed saturation)
+                __m128i channel = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, c*8), mask), _mm_and_si128(_mm_srli_epi32(p1, c*8), mask));
+                __m128i value = _mm_add_epi16(_mm_mullo_epi16(channel, channelLevels[c]), ((c < 3) || alphaDither)? threshold : alphaRound);
+                value = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(value, one), _mm_srli_epi16(value, 8)), 8);
+                result = _mm_or_si128(result, _mm_sll_epi16(value, _mm_cvtsi32_si128(shifts[c])));
+            }
+
+            _mm_storeu_si128((__m128i *)(dst + x), result);
+        }
+    #endif
+
+        for (; x < job->width; x++)
+        {
+            int threshold = thresholds[x&(job->size - 1)];
+            rl_Color color = pixels[x];
+
+            int r = (color.r*levels[0] + threshold)/255;
+            int g = (color.g*levels[1] + threshold)/255;
+            int b = (color.b*levels[2] + threshold)/255;
+            int a = (color.a*levels[3] + (alphaDither? threshold : 127))/255;
+
+            dst[x] = (unsigned short)((r << shifts[0]) | (g << shifts[1]) | (b << shifts[2]) | a);
+        }
+    }
+}
+
+// Process indexed image pixels range on current thread
+// NOTE: Last mapped color is kept, consecutive equal pixels are common
+static void ProcessIndexedImageRange(const void *data, int start, int end)
+{
+    const IndexedImageJob *job = (const IndexedImageJob *)data;
+    rl_Color last = job->palette[0];
+    unsigned char lastIndex = 0;
+
+    for (int i = start; i < end; i++)
+    {
+        rl_Color color = job->pixels[i];
+
+        if ((i == start) || (color.r != last.r) || (color.g != last.g) || (color.b != last.b) || (color.a != last.a))
+        {
+            int minDistance = INT_MAX;
+
+            for (int j = 0; j < job->colorCount; j++)
+            {
+                int dr = color.r - job->palette[j].r;
+                int dg = color.g - job->palette[j].g;
+                int db = color.b - job->palette[j].b;
+                int da = color.a - job->palette[j].a;
+                int distance = dr*dr + dg*dg + db*db + da*da;
+
+                if (distance < minDistance)
+                {
+                    minDistance = distance;
+                    lastIndex = (unsigned char)j;
+                    if (distance == 0) break;
+                }
+            }
+
+            last = color;
+        }
+
+        job->indices[i] = lastIndex;
+    }
+}
+
+// Process mipmap level 2x2 box reduction rows range on current thread
+// NOTE: Source sizes are even or 1, single source row or column is reused
+static void ProcessMipmapBoxRange(const void *data, int start, int end)
+{
+    const MipmapJob *job = (const MipmapJob *)data;
+    int channels = job->channels;
+    int srcPitch = job->srcWidth*channels;
+    int stepX = (job->srcWidth > 1)? channels : 0;
+
+    for (int y = start; y < end; y++)
+    {
+        const unsigned char *row0 = job->src + ((job->srcHeight > 1)? 2*y : y)*srcPitch;
+        const unsigned char *row1 = (job->srcHeight > 1)? row0 + srcPitch : row0;
+        unsigned char *dst = job->dst + y*job->dstWidth*channels;
+        int x = 0;
+
+#if defined(RTEXTURES_SSE2_ENABLED)
+        if ((channels == 4) && (stepX > 0))
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i round = _mm_set1_epi16(2);
+
+            for (; (x + 4) <= job->dstWidth; x += 4)
+            {
+                // Even and odd source pixels are deinterleaved, 8 source pixels per row reduced to 4 pixels
+                __m128 a0 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)(row0 + x*8)));
+                __m128 a1 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)(row0 + x*8 + 16)));
+                __m128 b0 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)(row1 + x*8)));
+                __m128 b1 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *)(row1 + x*8 + 16)));
+                __m128i evenA = _mm_castps_si128(_mm_shuffle_ps(a0, a1, _MM_SHUFFLE(2, 0, 2, 0)));
+                __m128i oddA = _mm_castps_si128(_mm_shuffle_ps(a0, a1, _MM_SHUFFLE(3, 1, 3, 1)));
+                __m128i evenB = _mm_castps_si128(_mm_shuffle_ps(b0, b1, _MM_SHUFFLE(2, 0, 2, 0)));
+                __m128i oddB = _mm_castps_si128(_mm_shuffle_ps(b0, b1, _MM_SHUFFLE(3, 1, 3, 1)));
+
+                __m128i lo = _mm_add_epi16(_mm_add_epi16(_mm_unpacklo_epi8(evenA, zero), _mm_unpacklo_epi8(oddA, zero)),
+                                           _mm_add_epi16(_mm_unpacklo_epi8(evenB, zero), _mm_unpacklo_epi8(oddB, zero)));
+                __m128i hi = _mm_add_epi16(_mm_add_epi16(_mm_unpackhi_epi8(evenA, zero), _mm_unpackhi_epi8(oddA, zero)),
+                                           _mm_add_epi16(_mm_unpackhi_epi8(evenB, zero), _mm_unpackhi_epi8(oddB, zero)));
+                lo = _mm_srli_epi16(_mm_add_epi16(lo, round), 2);
+                hi = _mm_srli_epi16(_mm_add_epi16(hi, round), 2);
+
+                _mm_storeu_si128((__m128i *)(dst + x*4), _mm_packus_epi16(lo, hi));
+            }
+        }
+#elif defined(RTEXTURES_NEON_ENABLED)
+        if ((channels == 4) && (stepX > 0))
+        {
+            for (; (x + 8) <= job->dstWidth; x += 8)
+            {
+                // Channels are deinterleaved, adjacent pixels added pairwise, 16 source pixels per row reduced to 8 pixels
+                uint8x16x4_t a = vld4q_u8(row0 + x*8);
+                uint8x16x4_t b = vld4q_u8(row1 + x*8);
+                uint8x8x4_t result;
+
+                for (int c = 0; c < 4; c++) result.val[c] = vrshrn_n_u16(vaddq_u16(vpaddlq_u8(a.val[c]), vpaddlq_u8(b.val[c])), 2);
+
+                vst4_u8(dst + x*4, result);
+            }
+        }
+#endif
+        for (; x < job->dstWidth; x++)
+        {
+            const unsigned char *p0 = row0 + x*2*stepX;
+            const unsigned char *p1 = row1 + x*2*stepX;
+
+            for (int c = 0; c < channels; c++) dst[x*channels + c] = (unsigned char)((p0[c] + p0[c + stepX] + p1[c] + p1[c + stepX] + 2) >> 2);
+        }
+    }
+}
+
+// Process mipmap level separable filter rows range on current thread
+// NOTE: Source rows are filtered vertically into a floating point row, then horizontally
+static void ProcessMipmapFilterRange(const void *data, int start, int end)
+{
+    const MipmapJob *job = (const MipmapJob *)data;
+    int channels = job->channels;
+    int srcPitch = job->srcWidth*channels;
+    float *row = (float *)RL_MALLOC(srcPitch*sizeof(float));
+    if (row == NULL) return;
+
+    for (int y = start; y < end; y++)
+    {
+        const MipmapTaps *tapY = &job->tapsY[y];
+        memset(row, 0, srcPitch*sizeof(float));
+
+        for (int t = 0; t < tapY->count; t++)
+        {
+            const unsigned char *src = job->src + tapY->index[t]*srcPitch;
+            float weight = tapY->weight[t];
+
+            for (int i = 0; i < srcPitch; i += channels)
+            {
+                for (int c = 0; c < channels; c++) row[i + c] += weight*(job->srgb[c]? mipmapSrgbTables.linear[src[i + c]] : src[i + c]/255.0f);
+            }
+        }
+
+        unsigned char *dst = job->dst + y*job->dstWidth*channels;
+
+        for (int x = 0; x < job->dstWidth; x++)
+        {
+            const MipmapTaps *tapX = &job->tapsX[x];
+
+            for (int c = 0; c < channels; c++)
+            {
+                float value = 0.0f;
+                for (int t = 0; t < tapX->count; t++) value += tapX->weight[t]*row[tapX->index[t]*channels + c];
+
+                value = (value < 0.0f)? 0.0f : ((value > 1.0f)? 1.0f : value);
+
+                if (job->srgb[c]) dst[x*channels + c] = mipmapSrgbTables.srgb[(int)(value*(IMAGE_MIPMAP_SRGB_TABLE_SIZE - 1) + 0.5f)];
+                else dst[x*channels + c] = (unsigned char)(value*255.0f + 0.5f);
+            }
+        }
+    }
+
+    RL_FREE(row);
+}
+
+// Process image batch loading files range on current thread
+static void ProcessImageBatchRange(const void *data, int start, int end)
+{
+    const ImageBatchJob *batch = (const ImageBatchJob *)data;
+
+    for (int i = start; i < end; i++) if (batch->fileNames[i] != NULL) batch->images[i] = rl_LoadImage(batch->fileNames[i]);
+}
+
+// Lock decoded images cache, images can be loaded from worker threads
+static void LockImageCache(void)
+{
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    pthread_mutex_lock(&imageCacheLock);
+#endif
+}
+
+// Unlock decoded images cache
+static void UnlockImageCache(void)
+{
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    pthread_mutex_unlock(&imageCacheLock);
+#endif
+}
+
+#if defined(SUPPORT_SHARED_TEXTURES)
+// Lock shared textures registry, resources can be acquired from loading threads
+static void LockSharedTextures(void)
+{
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    pthread_mutex_lock(&sharedTexturesLock);
+#endif
+}
+
+// Unlock shared textures registry
+static void UnlockSharedTextures(void)
+{
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    pthread_mutex_unlock(&sharedTexturesLock);
+#endif
+}
+
+// Get shared texture resource key hash (FNV-1a)
+static unsigned int GetSharedTextureKeyHash(const char *key)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; key[i] != '\0'; i++) hash = (hash ^ (unsigned char)key[i])*16777619u;
+
+    return hash;
+}
+
+// Find shared texture entry by resource key, NULL if not registered
+// NOTE: Registry must be locked
+static SharedTextureEntry *FindSharedTexture(const char *key, unsigned int hash)
+{
+    if (sharedTextures.capacity == 0) return NULL;
+
+    for (int i = sharedTextures.keyBuckets[hash & (sharedTextures.capacity - 1)]; i >= 0; i = sharedTextures.entries[i].nextKey)
+    {
+        SharedTextureEntry *entry = &sharedTextures.entries[i];
+        if ((entry->hash == hash) && (strcmp(entry->key, key) == 0)) return entry;
+    }
+
+    return NULL;
+}
+
+// Find shared texture entry by texture id, NULL if texture is not shared
+// NOTE: Registry must be locked
+static SharedTextureEntry *FindSharedTextureId(unsigned int id)
+{
+    if (sharedTextures.capacity == 0) return NULL;
+
+    for (int i = sharedTextures.idBuckets[id & (sharedTextures.capacity - 1)]; i >= 0; i = sharedTextures.entries[i].nextId)
+    {
+        if (sharedTextures.entries[i].texture.id == id) return &sharedTextures.entries[i];
+    }
+
+    return NULL;
+}
+
+// Link shared texture entry to texture id index, entry texture must be uploaded
+// NOTE: Registry must be locked
+static void LinkSharedTextureId(SharedTextureEntry *entry)
+{
+    int index = (int)(entry - sharedTextures.entries);
+    int bucket = entry->texture.id & (sharedTextures.capacity - 1);
+
+    entry->nextId = sharedTextures.idBuckets[bucket];
+    sharedTextures.idBuckets[bucket] = index;
+}
+
+// Grow shared textures registry, key and texture id indices are rebuilt and new entries added as free
+// NOTE: Registry must be locked
+static bool GrowSharedTextures(void)
+{
+    int capacity = (sharedTextures.capacity > 0)? sharedTextures.capacity*2 : 32;
+
+    SharedTextureEntry *entries = (SharedTextureEntry *)RL_REALLOC(sharedTextures.entries, capacity*sizeof(SharedTextureEntry));
+    if (entries == NULL) return false;
+    sharedTextures.entries = entries;
+
+    int *keyBuckets = (int *)RL_REALLOC(sharedTextures.keyBuckets, capacity*sizeof(int));
+    if (keyBuckets == NULL) return false;
+    sharedTextures.keyBuckets = keyBuckets;
+
+    int *idBuckets = (int *)RL_REALLOC(sharedTextures.idBuckets, capacity*sizeof(int));
+    if (idBuckets == NULL) return false;
+    sharedTextures.idBuckets = idBuckets;
+
+    memset(entries + sharedTextures.capacity, 0, (capacity - sharedTextures.capacity)*sizeof(SharedTextureEntry));
+    sharedTextures.capacity = capacity;
+
+    for (int i = 0; i < capacity; i++)
+    {
+        keyBuckets[i] = -1;
+        idBuckets[i] = -1;
+    }
+
+    sharedTextures.freeEntry = -1;
+
+    for (int i = capacity - 1; i >= 0; i--)
+    {
+        SharedTextureEntry *entry = &entries[i];
+
+        if (entry->key == NULL)
+        {
+            entry->nextKey = sharedTextures.freeEntry;
+            sharedTextures.freeEntry = i;
+            continue;
+        }
+
+        int bucket = entry->hash & (capacity - 1);
+        entry->nextKey = keyBuckets[bucket];
+        keyBuckets[bucket] = i;
+
+        if (entry->texture.id > 0) LinkSharedTextureId(entry);
+    }
+
+    return true;
+}
+
+// Add shared texture entry, registered as loading by calling thread with one reference
+// NOTE: Registry must be locked, entries array grows as required
+static SharedTextureEntry *AddSharedTexture(const char *key, unsigned int hash)
+{
+    if ((sharedTextures.freeEntry < 0) && !GrowSharedTextures()) return NULL;
+
+    int index = sharedTextures.freeEntry;
+    SharedTextureEntry *entry = &sharedTextures.entries[index];
+    int length = (int)strlen(key);
+
+    char *entryKey = (char *)RL_MALLOC(length + 1);
+    if (entryKey == NULL) return NULL;
+    memcpy(entryKey, key, length + 1);
+
+    sharedTextures.freeEntry = entry->nextKey;
+
+    int bucket = hash & (sharedTextures.capacity - 1);
+    *entry = CLITERAL(SharedTextureEntry){ 0 };
+    entry->key = entryKey;
+    entry->hash = hash;
+    entry->refCount = 1;
+    entry->loading = true;
+    entry->nextKey = sharedTextures.keyBuckets[bucket];
+    entry->nextId = -1;
+    sharedTextures.keyBuckets[bucket] = index;
+
+    return entry;
+}
+
+// Remove shared texture entry, texture and pending image are not unloaded
+// NOTE: Registry must be locked, entry is unlinked from indices and added as free
+static void RemoveSharedTexture(SharedTextureEntry *entry)
+{
+    int index = (int)(entry - sharedTextures.entries);
+    int mask = sharedTextures.capacity - 1;
+
+    for (int *link = &sharedTextures.keyBuckets[entry->hash & mask]; *link >= 0; link = &sharedTextures.entries[*link].nextKey)
+    {
+        if (*link == index) { *link = entry->nextKey; break; }
+    }
+
+    if (entry->texture.id > 0)
+    {
+        for (int *link = &sharedTextures.idBuckets[entry->texture.id & mask]; *link >= 0; link = &sharedTextures.entries[*link].nextId)
+        {
+            if (*link == index) { *link = entry->nextId; break; }
+        }
+    }
+
+    RL_FREE(entry->key);
+    *entry = CLITERAL(SharedTextureEntry){ 0 };
+    entry->nextKey = sharedTextures.freeEntry;
+    sharedTextures.freeEntry = index;
+}
+
+// Release shared texture reference by texture id, returns false if texture is not shared
+// NOTE: Texture is only unloaded by caller on last reference (released is true)
+static bool ReleaseSharedTexture(unsigned int id, bool *released)
+{
+    *released = false;
+
+    LockSharedTextures();
+
+    SharedTextureEntry *entry = FindSharedTextureId(id);
+
+    if (entry != NULL)
+    {
+        entry->refCount--;
+
+        if (entry->refCount <= 0)
+        {
+            RemoveSharedTexture(entry);
+            *released = true;
+        }
+    }
+
+    UnlockSharedTextures();
+
+    return (entry != NULL);
+}
+
+// Reload shared texture from its resource file, texture is updated in place (same id)
+// NOTE: Registry must be locked, file image must keep texture size
+static bool ReloadSharedTexture(SharedTextureEntry *entry)
+{
+    bool result = false;
+    rl_Image image = rl_LoadImage(entry->key);
+    if (image.data == NULL) return result;
+
+    rl_Texture2D *texture = &entry->texture;
+
+    if ((image.width != texture->width) || (image.height != texture->height))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to reload texture, image size changed (%ix%i)", entry->key, image.width, image.height);
+    }
+    else if (texture->format >= PIXELFORMAT_COMPRESSED_DXT1_RGB)
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: [%s] Failed to reload texture, compressed textures not supported", entry->key);
+    }
+    else
+    {
+        if (image.format != texture->format) rl_ImageFormat(&image, texture->format);
+
+        rl_UpdateTexture(*texture, image.data);
+        if (texture->mipmaps > 1) rl_GenTextureMipmaps(texture);
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Texture reloaded successfully (%s)", texture->id, entry->key);
+        result = true;
+    }
+
+    rl_UnloadImage(image);
+
+    return result;
+}
+#endif
+
+// Load image copy from decoded images cache, stale entries for the file are removed
+// NOTE: Returns false if image is not cached, cache must be locked
+static bool LoadCachedImage(const char *fileName, long modTime, rl_Image *image)
+{
+    for (int i = 0; i < imageCache.capacity; i++)
+    {
+        ImageCacheEntry *entry = &imageCache.entries[i];
+        if ((entry->fileName == NULL) || (strcmp(entry->fileName, fileName) != 0)) continue;
+
+        if (entry->modTime != modTime)
+        {
+            RemoveImageCacheEntry(i);
+            return false;
+        }
+
+        *image = rl_ImageCopy(entry->image);
+        entry->lastUse = ++imageCache.useCounter;
+
+        return (image->data != NULL);
+    }
+
+    return false;
+}
+
+// Store image copy in decoded images cache, least recently used images are released to fit cache size
+// NOTE: Cache must be locked
+static void StoreCachedImage(const char *fileName, long modTime, rl_Image image)
+{
+    int size = 0;
+
+    for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+    {
+        size += rl_GetPixelDataSize(width, height, image.format);
+
+        width = (width/2 < 1)? 1 : width/2;
+        height = (height/2 < 1)? 1 : height/2;
+    }
+
+    if ((size <= 0) || (size > imageCache.maxSize)) return;
+
+    // Image could have been stored by another thread loading the same file
+    int index = -1;
+
+    for (int i = 0; i < imageCache.capacity; i++)
+    {
+        if (imageCache.entries[i].fileName == NULL) { if (index < 0) index = i; }
+        else if (strcmp(imageCache.entries[i].fileName, fileName) == 0) return;
+    }
+
+    while ((imageCache.size + size) > imageCache.maxSize) RemoveImageCacheEntry(-1);
+
+    if (index < 0)
+    {
+        int capacity = (imageCache.capacity == 0)? 32 : imageCache.capacity*2;
+        ImageCacheEntry *entries = (ImageCacheEntry *)RL_REALLOC(imageCache.entries, capacity*sizeof(ImageCacheEntry));
+        if (entries == NULL) return;
+
+        memset(entries + imageCache.capacity, 0, (capacity - imageCache.capacity)*sizeof(ImageCacheEntry));
+        index = imageCache.capacity;
+        imageCache.entries = entries;
+        imageCache.capacity = capacity;
+    }
+
+    ImageCacheEntry *entry = &imageCache.entries[index];
+    entry->image = rl_ImageCopy(image);
+    if (entry->image.data == NULL) return;
+
+    entry->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(entry->fileName, fileName);
+    entry->modTime = modTime;
+    entry->size = size;
+    entry->lastUse = ++imageCache.useCounter;
+
+    imageCache.size += size;
+}
+
+// Remove decoded images cache entry, least recently used entry if index is -1
+// NOTE: Returns false if there is no entry to remove, cache must be locked
+static bool RemoveImageCacheEntry(int index)
+{
+    if (index < 0)
+    {
+        for (int i = 0; i < imageCache.capacity; i++)
+        {
+            if (imageCache.entries[i].fileName == NULL) continue;
+            if ((index < 0) || (imageCache.entries[i].lastUse < imageCache.entries[index].lastUse)) index = i;
+        }
+
+        if (index < 0) return false;
+    }
+
+    ImageCacheEntry *entry = &imageCache.entries[index];
+
+    imageCache.size -= entry->size;
+    rl_UnloadImage(entry->image);
+    RL_FREE(entry->fileName);
+    *entry = (ImageCacheEntry){ 0 };
+
+    return true;
+}
+
+// Run job, splitting its range in chunks processed by job system worker threads
+// NOTE: Caller thread processes chunks too, function returns once the full range is processed
+static void RunWorkerJob(const WorkerJob *job)
+{
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+    rl_ParallelFor(ProcessWorkerJobRange, (void *)job, job->count, job->chunkSize);
+#else
+    job->process(job->data, 0, job->count);
+#endif
+}
+
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+// Process worker job range, called by job system threads
+static void ProcessWorkerJobRange(void *userData, int start, int end)
+{
+    const WorkerJob *job = (const WorkerJob *)userData;
+    job->process(job->data, start, end);
+}
+#endif
+
+#if defined(SUPPORT_IMAGE_EXPORT) && defined(SUPPORT_FILEFORMAT_PNG)
+// Encode image pixels as PNG file data, 8 bit channels (grayscale, gray+alpha, RGB or RGBA)
+// NOTE: Rows chunks are filtered and compressed by worker threads into independent IDAT chunks,
+// compressed chunks form a single zlib stream (sync flushed), compression level set by rl_SetImageExportCompression()
+static unsigned char *EncodeImagePNG(const unsigned char *pixels, int width, int height, int channels, int *dataSize)
+{
+    *dataSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    int rowSize = width*channels + 1;   // Filtered row size, including filter type byte
+    int chunkRows = (IMAGE_EXPORT_CHUNK_SIZE/rowSize < 1)? 1 : IMAGE_EXPORT_CHUNK_SIZE/rowSize;
+    int chunkCount = (height + chunkRows - 1)/chunkRows;
+
+    PngEncodeJob encoder = { 0 };
+    encoder.pixels = pixels;
+    encoder.width = width;
+    encoder.height = height;
+    encoder.channels = channels;
+    encoder.chunkRows = chunkRows;
+    encoder.level = imageExportCompression;
+    encoder.chunks = (unsigned char **)RL_CALLOC(chunkCount, sizeof(unsigned char *));
+    encoder.chunkSizes = (int *)RL_CALLOC(chunkCount, sizeof(int));
+    encoder.checksums = (unsigned int *)RL_CALLOC(chunkCount, sizeof(unsigned int));
+
+    WorkerJob job = { ProcessPngEncodeRange, &encoder, chunkCount, 1 };
+    RunWorkerJob(&job);
+
+    // PNG data: signature, IHDR, zlib header IDAT, compressed chunks IDATs, Adler-32 IDAT and IEND
+    bool valid = true;
+    int size = 8 + 25 + 14 + 16 + 12;
+    unsigned int checksum = 1;
+
+    for (int i = 0; i < chunkCount; i++)
+    {
+        int rows = ((height - i*chunkRows) < chunkRows)? (height - i*chunkRows) : chunkRows;
+
+        if (encoder.chunks[i] == NULL) valid = false;
+        size += encoder.chunkSizes[i];
+        checksum = CombineAdler32(checksum, encoder.checksums[i], rows*rowSize);
+    }
+
+    unsigned char *fileData = valid? (unsigned char *)RL_MALLOC(size) : NULL;
+
+    if (fileData != NULL)
+    {
+        static const unsigned char signature[8] = { 137, 80, 78, 71, 13, 10, 26, 10 };
+        static const unsigned char colorType[5] = { 0, 0, 4, 2, 6 };
+        unsigned char *o = fileData;
+
+        memcpy(o, signature, 8); o += 8;
+
+        stbiw__wp32(o, 13);
+        stbiw__wptag(o, "IHDR");
+        stbiw__wp32(o, width);
+        stbiw__wp32(o, height);
+        *o++ = 8;                       // Bit depth
+        *o++ = colorType[channels];     // Color type
+        *o++ = 0;                       // Compression method
+        *o++ = 0;                       // Filter method
+        *o++ = 0;                       // Interlace method
+        stbiw__wpcrc(&o, 13);
+
+        stbiw__wp32(o, 2);
+        stbiw__wptag(o, "IDAT");
+        *o++ = 0x78;                    // Deflate, 32K window
+        *o++ = 0x01;                    // Fastest compression flag, header check bits
+        stbiw__wpcrc(&o, 2);
+
+        for (int i = 0; i < chunkCount; i++)
+        {
+            memcpy(o, encoder.chunks[i], encoder.chunkSizes[i]);
+            o += encoder.chunkSizes[i];
+        }
+
+        stbiw__wp32(o, 4);
+        stbiw__wptag(o, "IDAT");
+        stbiw__wp32(o, checksum);
+        stbiw__wpcrc(&o, 4);
+
+        stbiw__wp32(o, 0);
+        stbiw__wptag(o, "IEND");
+        stbiw__wpcrc(&o, 0);
+
+        *dataSize = size;
+    }
+
+    for (int i = 0; i < chunkCount; i++) RL_FREE(encoder.chunks[i]);
+    RL_FREE(encoder.chunks);
+    RL_FREE(encoder.chunkSizes);
+    RL_FREE(encoder.checksums);
+
+    return fileData;
+#else
+    return stbi_write_png_to_mem(pixels, width*channels, width, height, channels, dataSize);
+#endif
+}
+
+#if defined(SUPPORT_COMPRESSION_API)
+// Process PNG encoding chunks range on current thread, rows are filtered and compressed into IDAT chunks
+// NOTE: Rows filters are selected as stb_image_write does, lowest sum of absolute filtered values
+static void ProcessPngEncodeRange(const void *data, int start, int end)
+{
+    const PngEncodeJob *encoder = (const PngEncodeJob *)data;
+    int lineSize = encoder->width*encoder->channels;
+    int rowSize = lineSize + 1;
+
+    struct sdefl *sdefl = (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl));   // WARNING: struct sdefl is almost 1MB
+    unsigned char *filtered = (unsigned char *)RL_MALLOC(encoder->chunkRows*rowSize);
+
+    for (int i = start; i < end; i++)
+    {
+        int startRow = i*encoder->chunkRows;
+        int endRow = ((startRow + encoder->chunkRows) < encoder->height)? (startRow + encoder->chunkRows) : encoder->height;
+        int filteredSize = (endRow - startRow)*rowSize;
+
+        for (int y = startRow; y < endRow; y++)
+        {
+            unsigned char *row = filtered + (y - startRow)*rowSize;
+            int filter = stbi_write_force_png_filter;
+
+            if ((filter < 0) || (filter >= 5))
+            {
+                const unsigned char *pixels = encoder->pixels + y*lineSize;
+                filter = GetPngRowFilter(pixels, (y > 0)? (pixels - lineSize) : NULL, lineSize, encoder->channels);
+            }
+
+            row[0] = (unsigned char)filter;
+            stbiw__encode_png_line((unsigned char *)encoder->pixels, lineSize, encoder->width, encoder->height, y, encoder->channels, filter, (signed char *)(row + 1));
+        }
+
+        // IDAT chunk: length, tag, compressed data and CRC
+        unsigned char *chunk = (unsigned char *)RL_MALLOC(12 + sdefl_bound(filteredSize));
+        int compSize = sdeflate_chunk(sdefl, chunk + 8, filtered, filteredSize, encoder->level, (endRow == encoder->height));
+        unsigned char *o = chunk;
+
+        stbiw__wp32(o, compSize);
+        stbiw__wptag(o, "IDAT");
+        o += compSize;
+        stbiw__wpcrc(&o, compSize);
+
+        encoder->chunks[i] = chunk;
+        encoder->chunkSizes[i] = compSize + 12;
+        encoder->checksums[i] = ComputeAdler32(1, filtered, filteredSize);
+    }
+
+    RL_FREE(filtered);
+    RL_FREE(sdefl);
+}
+
+// Get PNG row filter type with lowest sum of absolute filtered values, all filters estimated at once
+// NOTE: Same selection as stb_image_write, prior row is NULL for first row (zero bytes)
+static int GetPngRowFilter(const unsigned char *row, const unsigned char *prior, int size, int bpp)
+{
+    int sums[5] = { 0 };
+
+    for (int i = 0; i < size; i++)
+    {
+        int left = (i >= bpp)? row[i - bpp] : 0;
+        int up = (prior != NULL)? prior[i] : 0;
+        int upLeft = ((prior != NULL) && (i >= bpp))? prior[i - bpp] : 0;
+
+        sums[0] += abs((signed char)row[i]);
+        sums[1] += abs((signed char)(row[i] - left));
+        sums[2] += abs((signed char)(row[i] - up));
+        sums[3] += abs((signed char)(row[i] - ((left + up) >> 1)));
+        sums[4] += abs((signed char)(row[i] - stbiw__paeth(left, up, upLeft)));
+    }
+
+    int filter = 0;
+    for (int f = 1; f < 5; f++) if (sums[f] < sums[filter]) filter = f;
+
+    return filter;
+}
+
+// Compute Adler-32 checksum of data, continuing from a previous checksum (1 for first data)
+static unsigned int ComputeAdler32(unsigned int adler, const unsigned char *data, int size)
+{
+    unsigned int s1 = adler & 0xffff;
+    unsigned int s2 = adler >> 16;
+
+    while (size > 0)
+    {
+        // NOTE: 5552 is the largest block size s2 can't overflow before modulo
+        int blockSize = (size < 5552)? size : 5552;
+
+        for (int i = 0; i < blockSize; i++)
+        {
+            s1 += data[i];
+            s2 += s1;
+        }
+
+        s1 %= 65521;
+        s2 %= 65521;
+        data += blockSize;
+        size -= blockSize;
+    }
+
+    return (s2 << 16) | s1;
+}
+
+// Combine Adler-32 checksums of two consecutive data blocks, second block size required
+static unsigned int CombineAdler32(unsigned int adler1, unsigned int adler2, int size2)
+{
+    unsigned int rem = (unsigned int)size2%65521;
+    unsigned int s1 = adler1 & 0xffff;
+    unsigned int s2 = (rem*s1)%65521;
+
+    s1 += (adler2 & 0xffff) + 65521 - 1;
+    s2 += (adler1 >> 16) + (adler2 >> 16) + 65521 - rem;
+
+    if (s1 >= 65521) s1 -= 65521;
+    if (s1 >= 65521) s1 -= 65521;
+    if (s2 >= 2*65521) s2 -= 2*65521;
+    if (s2 >= 65521) s2 -= 65521;
+
+    return (s2 << 16) | s1;
+}
+#endif
+#endif
+
+#if defined(SUPPORT_IMAGE_WORKER_THREADS)
+// Image export thread loop, queued images are exported in order
+static void *ImageExportThreadLoop(void *arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&imageExportsLock);
+
+    while (true)
+    {
+        ImageExportRequest *request = imageExports.first;
+
+        if (request == NULL)
+        {
+            if (imageExports.quit) break;
+
+            pthread_cond_wait(&imageExportsCond, &imageExportsLock);
+            continue;
+        }
+
+        imageExports.first = request->next;
+        if (imageExports.first == NULL) imageExports.last = NULL;
+
+        pthread_mutex_unlock(&imageExportsLock);
+
+        rl_ExportImage(request->image, request->fileName);
+        rl_UnloadImage(request->image);
+        RL_FREE(request->fileName);
+        RL_FREE(request);
+
+        pthread_mutex_lock(&imageExportsLock);
+
+        imageExports.pending--;
+        if (imageExports.pending == 0) pthread_cond_broadcast(&imageExportsDoneCond);
+    }
+
+    pthread_mutex_unlock(&imageExportsLock);
+
+    return NULL;
+}
+#endif
+
+// Load render texture processing shaders (on first use)
+// NOTE: Returns false if shaders are not available (OpenGL 1.1, compilation failed)
+static bool LoadImageShaders(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!imageShaders.loaded)
+    {
+        imageShaders.loaded = true;
+
+        imageShaders.nearest = rl_LoadShaderFromMemory(NULL, imageNearestShaderCode);
+        imageShaders.bilinear = rl_LoadShaderFromMemory(NULL, imageBilinearShaderCode);
+        imageShaders.color = rl_LoadShaderFromMemory(NULL, imageColorShaderCode);
+        imageShaders.replace = rl_LoadShaderFromMemory(NULL, imageReplaceShaderCode);
+        imageShaders.blur = rl_LoadShaderFromMemory(NULL, imageBlurShaderCode);
+        imageShaders.dither = rl_LoadShaderFromMemory(NULL, imageDitherShaderCode);
+        imageShaders.perlin = rl_LoadShaderFromMemory(NULL, imagePerlinShaderCode);
+        imageShaders.cellular = rl_LoadShaderFromMemory(NULL, imageCellularShaderCode);
+
+        rl_Shader shaders[8] = { imageShaders.nearest, imageShaders.bilinear, imageShaders.color, imageShaders.replace, imageShaders.blur, imageShaders.dither, imageShaders.perlin, imageShaders.cellular };
+        imageShaders.ready = true;
+
+        for (int i = 0; i < 8; i++)
+        {
+            if ((shaders[i].id == 0) || (shaders[i].id == rlGetShaderIdDefault())) imageShaders.ready = false;
+        }
+
+        imageShaders.nearestSizeLoc = rl_GetShaderLocation(imageShaders.nearest, "sourceSize");
+        imageShaders.bilinearSizeLoc = rl_GetShaderLocation(imageShaders.bilinear, "sourceSize");
+        imageShaders.colorMatrixLoc = rl_GetShaderLocation(imageShaders.color, "colorMatrix");
+        imageShaders.colorOffsetLoc = rl_GetShaderLocation(imageShaders.color, "colorOffset");
+        imageShaders.replaceColorLoc = rl_GetShaderLocation(imageShaders.replace, "color");
+        imageShaders.replaceLoc = rl_GetShaderLocation(imageShaders.replace, "replace");
+        imageShaders.blurStepLoc = rl_GetShaderLocation(imageShaders.blur, "texelStep");
+        imageShaders.blurRadiusLoc = rl_GetShaderLocation(imageShaders.blur, "radius");
+        imageShaders.blurWeightsLoc = rl_GetShaderLocation(imageShaders.blur, "weights");
+        imageShaders.blurPremultiplyLoc = rl_GetShaderLocation(imageShaders.blur, "premultiply");
+        imageShaders.blurUnpremultiplyLoc = rl_GetShaderLocation(imageShaders.blur, "unpremultiply");
+        imageShaders.ditherLevelsLoc = rl_GetShaderLocation(imageShaders.dither, "levels");
+        imageShaders.perlinOffsetLoc = rl_GetShaderLocation(imageShaders.perlin, "noiseOffset");
+        imageShaders.perlinScaleLoc = rl_GetShaderLocation(imageShaders.perlin, "noiseScale");
+        imageShaders.cellularCountLoc = rl_GetShaderLocation(imageShaders.cellular, "seedCount");
+        imageShaders.cellularSizeLoc = rl_GetShaderLocation(imageShaders.cellular, "tileSize");
+
+        if (imageShaders.ready) TRACELOG(LOG_INFO, "TEXTURE: Render texture processing shaders loaded successfully");
+        else TRACELOG(LOG_WARNING, "TEXTURE: Failed to load render texture processing shaders");
+    }
+
+    return imageShaders.ready;
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Render texture processing requires OpenGL 3.3 or OpenGL ES 2.0");
+    return false;
+#endif
+}
+
+// Load palette lookup drawing shader (on first use)
+// NOTE: Returns false if shader is not available (OpenGL 1.1, compilation failed)
+static bool LoadPaletteShader(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!imageShaders.paletteLoaded)
+    {
+        imageShaders.paletteLoaded = true;
+        imageShaders.palette = rl_LoadShaderFromMemory(NULL, paletteShaderCode);
+        imageShaders.paletteReady = (imageShaders.palette.id > 0) && (imageShaders.palette.id != rlGetShaderIdDefault());
+        imageShaders.paletteLoc = rl_GetShaderLocation(imageShaders.palette, "palette");
+
+        if (!imageShaders.paletteReady) TRACELOG(LOG_WARNING, "TEXTURE: Failed to load palette shader");
+    }
+
+    return imageShaders.paletteReady;
+#else
+    TRACELOG(LOG_WARNING, "TEXTURE: Palette mode requires OpenGL 3.3 or OpenGL ES 2.0");
+    return false;
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Draw source texture into render texture using processing shader
+// NOTE: Projection keeps image orientation, source and destination rectangles are in image coordinates
+static void ImageShaderPass(rl_RenderTexture2D target, rl_Texture2D source, rl_Shader shader, rl_Rectangle sourceRec, rl_Rectangle destRec, rl_Vector2 origin, float rotation, bool clear)
+{
+    rl_BeginTextureMode(target);
+
+    // First image row is drawn at framebuffer bottom, where texture data starts
+    rlMatrixMode(RL_PROJECTION);
+    rlLoadIdentity();
+    rlOrtho(0, target.texture.width, 0, target.texture.height, 0.0f, 1.0f);
+    rlMatrixMode(RL_MODELVIEW);
+
+    if (clear) rl_ClearBackground((rl_Color){ 0, 0, 0, 0 });
+
+    // Processed texels replace destination ones, flipped projection reverses triangles winding
+    rlDisableColorBlend();
+    rlDisableBackfaceCulling();
+
+    rl_BeginShaderMode(shader);
+    rl_DrawTexturePro(source, sourceRec, destRec, origin, rotation, rl_WHITE);
+    rl_EndShaderMode();
+    rlDrawRenderBatchActive();
+
+    rlEnableColorBlend();
+    rlEnableBackfaceCulling();
+
+    rl_EndTextureMode();
+}
+
+// Process render texture through a same size pass, result replaces its contents
+// NOTE: Pass is rendered into a pooled render texture that is swapped with target
+static void ImageShaderPassSwap(rl_RenderTexture2D *target, rl_Shader shader, rl_Rectangle sourceRec)
+{
+    rl_RenderTexture2D pass = rl_AcquireRenderTexture(target->texture.width, target->texture.height, target->texture.format, (target->depth.id > 0));
+    if (pass.id == 0) return;
+
+    rl_Rectangle destRec = { 0.0f, 0.0f, (float)target->texture.width, (float)target->texture.height };
+    ImageShaderPass(pass, target->texture, shader, sourceRec, destRec, (rl_Vector2){ 0.0f, 0.0f }, 0.0f, false);
+
+    // Previous render texture is returned to pool, pooled target keeps its entry
+    int passIndex = -1;
+    int targetIndex = -1;
+
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+    {
+        if (renderTexturePool[i].target.id == pass.id) passIndex = i;
+        else if (renderTexturePool[i].target.id == target->id) targetIndex = i;
+    }
+
+    if (passIndex == -1) return;
+
+    renderTexturePool[passIndex].target = *target;
+    renderTexturePool[passIndex].inUse = false;
+    if (targetIndex >= 0) renderTexturePool[targetIndex].target = pass;
+
+    *target = pass;
+}
+
+// Replace render texture by a processed one with a different size, previous render texture is unloaded
+static void ReplaceRenderTexture(rl_RenderTexture2D *target, rl_RenderTexture2D result)
+{
+    for (int i = 0; i < MAX_RENDER_TEXTURE_POOL; i++)
+    {
+        if (renderTexturePool[i].target.id == target->id)
+        {
+            renderTexturePool[i].target = result;
+            break;
+        }
+    }
+
+    rl_UnloadRenderTexture(*target);
+    *target = result;
+}
+#endif
+
+// Process render texture colors through color transform pass
+static void ImageColorPass(rl_RenderTexture2D *target, rl_Matrix matrix, rl_Vector4 offset)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rl_SetShaderValueMatrix(imageShaders.color, imageShaders.colorMatrixLoc, matrix);
+    rl_SetShaderValue(imageShaders.color, imageShaders.colorOffsetLoc, &offset, SHADER_UNIFORM_VEC4);
+
+    ImageShaderPassSwap(target, imageShaders.color, (rl_Rectangle){ 0.0f, 0.0f, (float)target->texture.width, (float)target->texture.height });
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Set processing shader source size uniform
+static void SetImageShaderSourceSize(rl_Shader shader, int locIndex, rl_Texture2D source)
+{
+    float size[2] = { (float)source.width, (float)source.height };
+    rl_SetShaderValue(shader, locIndex, size, SHADER_UNIFORM_VEC2);
+}
+#endif
+
+#if defined(SUPPORT_RENDER_GRAPH)
+// Add render graph resource, returns resource index (-1 on failure)
+static int AddRenderGraphResource(rl_RenderGraph *graph, RenderGraphResource resource)
+{
+    if (graph == NULL) return -1;
+
+    if (graph->resourceCount >= MAX_RENDER_GRAPH_RESOURCES)
+    {
+        TRACELOG(LOG_WARNING, "RENDERGRAPH: Maximum number of resources reached (%i)", MAX_RENDER_GRAPH_RESOURCES);
+        return -1;
+    }
+
+    resource.lastPass = -1;
+    graph->resources[graph->resourceCount] = resource;
+    graph->compiled = false;
+
+    return graph->resourceCount++;
+}
+
+// Add render graph pass, returns pass index (-1 on failure)
+static int AddRenderGraphPass(rl_RenderGraph *graph, RenderGraphPass pass, const int *inputs, int inputCount)
+{
+    if (graph == NULL) return -1;
+
+    if (graph->passCount >= MAX_RENDER_GRAPH_PASSES)
+    {
+        TRACELOG(LOG_WARNING, "RENDERGRAPH: Maximum number of passes reached (%i)", MAX_RENDER_GRAPH_PASSES);
+        return -1;
+    }
+
+    if ((pass.output < 0) || (pass.output >= graph->resourceCount))
+    {
+        TRACELOG(LOG_WARNING, "RENDERGRAPH: [ID %i] Pass output resource is not valid", pass.output);
+        return -1;
+    }
+
+    if (inputCount > MAX_RENDER_GRAPH_PASS_INPUTS)
+    {
+        TRACELOG(LOG_WARNING, "RENDERGRAPH: Pass inputs limited to %i", MAX_RENDER_GRAPH_PASS_INPUTS);
+        inputCount = MAX_RENDER_GRAPH_PASS_INPUTS;
+    }
+
+    for (int i = 0; i < inputCount; i++)
+    {
+        if ((inputs[i] < 0) || (inputs[i] >= graph->resourceCount) || (inputs[i] == pass.output))
+        {
+            TRACELOG(LOG_WARNING, "RENDERGRAPH: [ID %i] Pass input resource is not valid", inputs[i]);
+            return -1;
+        }
+
+        pass.inputs[i] = inputs[i];
+        pass.inputLocs[i] = -1;
+    }
+
+    pass.inputCount = inputCount;
+    graph->passes[graph->passCount] = pass;
+    graph->compiled = false;
+
+    return graph->passCount++;
+}
+
+// Compile render graph, passes culling, merging and resources lifetimes
+// NOTE: Passes are culled walking back from outputs, a pass is required if a required resource is written by it,
+// then its inputs are required by previous passes
+static void CompileRenderGraph(rl_RenderGraph *graph)
+{
+    bool required[MAX_RENDER_GRAPH_RESOURCES] = { 0 };
+    bool written[MAX_RENDER_GRAPH_RESOURCES] = { 0 };
+
+    for (int r = 0; r < graph->resourceCount; r++)
+    {
+        required[r] = graph->resources[r].output;
+        graph->resources[r].lastPass = -1;
+    }
+
+    for (int i = graph->passCount - 1; i >= 0; i--)
+    {
+        RenderGraphPass *pass = &graph->passes[i];
+        pass->culled = !required[pass->output];
+
+        if (!pass->culled)
+        {
+            for (int k = 0; k < pass->inputCount; k++) required[pass->inputs[k]] = true;
+        }
+    }
+
+    // Imported inputs keep their contents, transient targets and outputs are replaced by first write
+    for (int r = 0; r < graph->resourceCount; r++) written[r] = (graph->resources[r].imported && !graph->resources[r].output);
+
+    int previous = -1;
+    int culledCount = 0;
+
+    for (int i = 0; i < graph->passCount; i++)
+    {
+        RenderGraphPass *pass = &graph->passes[i];
+
+        // Transient inputs must be written by a previous pass
+        for (int k = 0; (k < pass->inputCount) && !pass->culled; k++)
+        {
+            if (!written[pass->inputs[k]])
+            {
+                TRACELOG(LOG_WARNING, "RENDERGRAPH: [ID %i] Pass reads resource %i not written before, pass culled", i, pass->inputs[k]);
+                pass->culled = true;
+            }
+        }
+
+        if (pass->culled)
+        {
+            culledCount++;
+            continue;
+        }
+
+        pass->replace = !written[pass->output];
+        pass->merged = (previous >= 0) && (graph->passes[previous].output == pass->output);
+        written[pass->output] = true;
+
+        graph->resources[pass->output].lastPass = i;
+        for (int k = 0; k < pass->inputCount; k++) graph->resources[pass->inputs[k]].lastPass = i;
+
+        previous = i;
+    }
+
+    graph->compiled = true;
+
+    TRACELOG(LOG_INFO, "RENDERGRAPH: Graph compiled (%i passes, %i culled)", graph->passCount, culledCount);
+}
+
+// Get render graph transient target size for render size
+static int GetRenderGraphTargetSize(int size, int renderSize)
+{
+    int result = size;
+
+    if (size == 0) result = renderSize;
+    else if (size < 0) result = renderSize/(-size);
+
+    return (result > 0)? result : 1;
+}
+#endif
+
+// Load image 4x4 pixels block, pixels out of image repeat the last row/column
+static void LoadImageBlock(const rl_Color *pixels, int width, int height, int blockX, int blockY, rl_Color *block)
+{
+    for (int y = 0; y < 4; y++)
+    {
+        int sy = blockY*4 + y;
+        if (sy >= height) sy = height - 1;
+
+        for (int x = 0; x < 4; x++)
+        {
+            int sx = blockX*4 + x;
+            if (sx >= width) sx = width - 1;
+
+            block[y*4 + x] = pixels[sy*width + sx];
+        }
+    }
+}
+
+// Get block principal axis (channels count: 3 or 4), returns false if all pixels are equal
+static bool GetBlockPrincipalAxis(const rl_Color *block, const bool *mask, int channels, float *mean, float *axis)
+{
+    float points[16][4] = { 0 };
+    int count = 0;
+
+    for (int c = 0; c < 4; c++) { mean[c] = 0.0f; axis[c] = 0.0f; }
+
+    for (int i = 0; i < 16; i++)
+    {
+        if ((mask != NULL) && !mask[i]) continue;
+
+        const unsigned char *p = (const unsigned char *)&block[i];
+        for (int c = 0; c < channels; c++) { points[count][c] = p[c]; mean[c] += p[c]; }
+        count++;
+    }
+
+    if (count == 0) return false;
+    for (int c = 0; c < channels; c++) mean[c] /= (float)count;
+
+    // Covariance matrix
+    float cov[4][4] = { 0 };
+    float minValue[4] = { 255.0f, 255.0f, 255.0f, 255.0f };
+    float maxValue[4] = { 0 };
+
+    for (int i = 0; i < count; i++)
+    {
+        for (int c = 0; c < channels; c++)
+        {
+            float d = points[i][c] - mean[c];
+            for (int k = c; k < channels; k++) cov[c][k] += d*(points[i][k] - mean[k]);
+
+            if (points[i][c] < minValue[c]) minValue[c] = points[i][c];
+            if (points[i][c] > maxValue[c]) maxValue[c] = points[i][c];
+        }
+    }
+
+    for (int c = 0; c < channels; c++) for (int k = 0; k < c; k++) cov[c][k] = cov[k][c];
+
+    // Power iteration, starting from bounding box diagonal
+    float length = 0.0f;
+    for (int c = 0; c < channels; c++) { axis[c] = maxValue[c] - minValue[c]; length += axis[c]; }
+    if (length <= 0.0f) return false;
+
+    for (int iteration = 0; iteration < 8; iteration++)
+    {
+        float next[4] = { 0 };
+        float maxComponent = 0.0f;
+
+        for (int c = 0; c < channels; c++)
+        {
+            for (int k = 0; k < channels; k++) next[c] += cov[c][k]*axis[k];
+            if (fabsf(next[c]) > maxComponent) maxComponent = fabsf(next[c]);
+        }
+
+        if (maxComponent <= 0.0f) break;
+        for (int c = 0; c < channels; c++) axis[c] = next[c]/maxComponent;
+    }
+
+    length = 0.0f;
+    for (int c = 0; c < channels; c++) length += axis[c]*axis[c];
+    if (length <= 0.0f) return false;
+
+    length = sqrtf(length);
+    for (int c = 0; c < channels; c++) axis[c] /= length;
+
+    return true;
+}
+
+// Expand RGB565 color to RGB8
+static void ExpandColor565(unsigned short color, int *rgb)
+{
+    int r = (color >> 11) & 0x1f;
+    int g = (color >> 5) & 0x3f;
+    int b = color & 0x1f;
+
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+// Quantize RGB float color to RGB565
+static unsigned short QuantizeColor565(const float *rgb)
+{
+    int q[3] = { 0 };
+    int max[3] = { 31, 63, 31 };
+
+    for (int c = 0; c < 3; c++)
+    {
+        float value = rgb[c];
+        if (value < 0.0f) value = 0.0f;
+        else if (value > 255.0f) value = 255.0f;
+
+        q[c] = (int)(value*max[c]/255.0f + 0.5f);
+    }
+
+    return (unsigned short)((q[0] << 11) | (q[1] << 5) | q[2]);
+}
+
+// Select DXT color block indices for endpoints, returns squared error
+// NOTE: Three colors mode (color0 <= color1) keeps index 3 for transparent pixels
+static int SelectColorIndicesDXT(const rl_Color *block, const bool *opaque, unsigned short color0, unsigned short color1, bool threeColors, unsigned char *indices)
+{
+    int palette[4][3] = { 0 };
+    ExpandColor565(color0, palette[0]);
+    ExpandColor565(color1, palette[1]);
+
+    for (int c = 0; c < 3; c++)
+    {
+        if (threeColors)
+        {
+            palette[2][c] = (palette[0][c] + palette[1][c])/2;
+            palette[3][c] = 0;
+        }
+        else
+        {
+            palette[2][c] = (2*palette[0][c] + palette[1][c])/3;
+            palette[3][c] = (palette[0][c] + 2*palette[1][c])/3;
+        }
+    }
+
+    int paletteCount = threeColors? 3 : 4;
+    int error = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if ((opaque != NULL) && !opaque[i]) { indices[i] = 3; continue; }
+
+        int bestError = INT_MAX;
+
+        for (int k = 0; k < paletteCount; k++)
+        {
+            int dr = palette[k][0] - block[i].r;
+            int dg = palette[k][1] - block[i].g;
+            int db = palette[k][2] - block[i].b;
+            int e = dr*dr + dg*dg + db*db;
+
+            if (e < bestError) { bestError = e; indices[i] = (unsigned char)k; }
+        }
+
+        error += bestError;
+    }
+
+    return error;
+}
+
+// Compress DXT color block (BC1 color part)
+// NOTE: Endpoints from principal axis extremes, refined once by least squares
+static void CompressBlockColorDXT(const rl_Color *block, unsigned char *dst, bool alpha)
+{
+    bool opaque[16] = { 0 };
+    bool transparent = false;
+
+    for (int i = 0; i < 16; i++)
+    {
+        opaque[i] = !alpha || (block[i].a >= 128);
+        if (!opaque[i]) transparent = true;
+    }
+
+    unsigned short color0 = 0;
+    unsigned short color1 = 0;
+    unsigned char indices[16] = { 0 };
+    float mean[4] = { 0 };
+    float axis[4] = { 0 };
+
+    if (GetBlockPrincipalAxis(block, opaque, 3, mean, axis))
+    {
+        float minT = 1e9f;
+        float maxT = -1e9f;
 
-                        // MIDDLE-RIGHT QUAD
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordB.y); rlVertex2f(vertC.x, vertB.y);  // Top-left corner for texture and quad
-                    }
+        for (int i = 0; i < 16; i++)
+        {
+            if (!opaque[i]) continue;
 
-                    // ------------------------------------------------------------
-                    // BOTTOM-LEFT QUAD
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
-                    {
-                        // BOTTOM-CENTER QUAD
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordC.y); rlVertex2f(vertB.x, vertC.y);  // Top-left corner for texture and quad
-                    }
+            float t = (block[i].r - mean[0])*axis[0] + (block[i].g - mean[1])*axis[1] + (block[i].b - mean[2])*axis[2];
+            if (t < minT) minT = t;
+            if (t > maxT) maxT = t;
+        }
 
-                    // BOTTOM-RIGHT QUAD
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordC.y); rlVertex2f(vertC.x, vertC.y);  // Top-left corner for texture and quad
+        float end0[3] = { mean[0] + axis[0]*maxT, mean[1] + axis[1]*maxT, mean[2] + axis[2]*maxT };
+        float end1[3] = { mean[0] + axis[0]*minT, mean[1] + axis[1]*minT, mean[2] + axis[2]*minT };
+        color0 = QuantizeColor565(end0);
+        color1 = QuantizeColor565(end1);
+    }
+    else
+    {
+        // Single color block (or fully transparent)
+        for (int i = 0; i < 16; i++)
+        {
+            if (!opaque[i]) continue;
+
+            float rgb[3] = { block[i].r, block[i].g, block[i].b };
+            color0 = QuantizeColor565(rgb);
+            break;
+        }
+
+        color1 = color0;
+    }
+
+    if (transparent)
+    {
+        // Three colors mode requires color0 <= color1
+        if (color0 > color1) { unsigned short temp = color0; color0 = color1; color1 = temp; }
+        SelectColorIndicesDXT(block, opaque, color0, color1, true, indices);
+    }
+    else
+    {
+        // Four colors mode requires color0 > color1, equal colors only use index 0
+        if (color0 < color1) { unsigned short temp = color0; color0 = color1; color1 = temp; }
+
+        if (color0 == color1) memset(indices, 0, 16);
+        else
+        {
+            int error = SelectColorIndicesDXT(block, NULL, color0, color1, false, indices);
+
+            // Least squares endpoints refinement for selected indices
+            const float weights[4] = { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f };
+            float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+            float ap[3] = { 0 };
+            float bp[3] = { 0 };
+
+            for (int i = 0; i < 16; i++)
+            {
+                float w = weights[indices[i]];
+                const unsigned char *p = (const unsigned char *)&block[i];
+
+                aa += w*w;
+                bb += (1.0f - w)*(1.0f - w);
+                ab += w*(1.0f - w);
+                for (int c = 0; c < 3; c++) { ap[c] += w*p[c]; bp[c] += (1.0f - w)*p[c]; }
+            }
+
+            float det = aa*bb - ab*ab;
+
+            if (fabsf(det) > 1e-6f)
+            {
+                float end0[3] = { 0 };
+                float end1[3] = { 0 };
+
+                for (int c = 0; c < 3; c++)
+                {
+                    end0[c] = (bb*ap[c] - ab*bp[c])/det;
+                    end1[c] = (aa*bp[c] - ab*ap[c])/det;
                 }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_VERTICAL)
+
+                unsigned short refined0 = QuantizeColor565(end0);
+                unsigned short refined1 = QuantizeColor565(end1);
+                if (refined0 < refined1) { unsigned short temp = refined0; refined0 = refined1; refined1 = temp; }
+
+                if (refined0 != refined1)
                 {
-                    // TOP QUAD
-                    // -----------------------------------------------------------
-                    // rl_Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
+                    unsigned char refinedIndices[16] = { 0 };
+                    int refinedError = SelectColorIndicesDXT(block, NULL, refined0, refined1, false, refinedIndices);
+
+                    if (refinedError < error)
                     {
-                        // MIDDLE QUAD
-                        // -----------------------------------------------------------
-                        // rl_Texture coords                 Vertices
-                        rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordD.x, coordB.y); rlVertex2f(vertD.x, vertB.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordA.x, coordB.y); rlVertex2f(vertA.x, vertB.y);  // Top-left corner for texture and quad
+                        color0 = refined0;
+                        color1 = refined1;
+                        memcpy(indices, refinedIndices, 16);
                     }
-                    // BOTTOM QUAD
-                    // -----------------------------------------------------------
-                    // rl_Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordC.y); rlVertex2f(vertD.x, vertC.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordC.y); rlVertex2f(vertA.x, vertC.y);  // Top-left corner for texture and quad
                 }
-                else if (nPatchInfo.layout == NPATCH_THREE_PATCH_HORIZONTAL)
+            }
+        }
+    }
+
+    unsigned int bits = 0;
+    for (int i = 0; i < 16; i++) bits |= (unsigned int)indices[i] << (2*i);
+
+    dst[0] = color0 & 0xff;
+    dst[1] = color0 >> 8;
+    dst[2] = color1 & 0xff;
+    dst[3] = color1 >> 8;
+    dst[4] = bits & 0xff;
+    dst[5] = (bits >> 8) & 0xff;
+    dst[6] = (bits >> 16) & 0xff;
+    dst[7] = bits >> 24;
+}
+
+// Compress DXT3 explicit alpha block (4 bit per pixel)
+static void CompressBlockAlphaDXT3(const rl_Color *block, unsigned char *dst)
+{
+    for (int i = 0; i < 8; i++)
+    {
+        int a0 = (block[2*i].a*15 + 127)/255;
+        int a1 = (block[2*i + 1].a*15 + 127)/255;
+
+        dst[i] = (unsigned char)(a0 | (a1 << 4));
+    }
+}
+
+// Compress DXT5 interpolated alpha block (BC3 alpha part, 8 levels between min and max)
+static void CompressBlockAlphaDXT5(const rl_Color *block, unsigned char *dst)
+{
+    int minAlpha = 255;
+    int maxAlpha = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (block[i].a < minAlpha) minAlpha = block[i].a;
+        if (block[i].a > maxAlpha) maxAlpha = block[i].a;
+    }
+
+    dst[0] = (unsigned char)maxAlpha;
+    dst[1] = (unsigned char)minAlpha;
+
+    unsigned long long bits = 0;
+
+    if (maxAlpha > minAlpha)
+    {
+        // Index 0 is alpha0 (max), index 1 is alpha1 (min), indices 2..7 interpolate from alpha0 to alpha1
+        const int ramp[8] = { 0, 2, 3, 4, 5, 6, 7, 1 };
+        int range = maxAlpha - minAlpha;
+
+        for (int i = 0; i < 16; i++)
+        {
+            int position = ((maxAlpha - block[i].a)*7 + range/2)/range;
+            bits |= (unsigned long long)ramp[position] << (3*i);
+        }
+    }
+
+    for (int i = 0; i < 6; i++) dst[2 + i] = (unsigned char)(bits >> (8*i));
+}
+
+// ETC1 modifiers tables (per codeword)
+static const int etcModifiers[8][4] = {
+    { 2, 8, -2, -8 }, { 5, 17, -5, -17 }, { 9, 29, -9, -29 }, { 13, 42, -13, -42 },
+    { 18, 60, -18, -60 }, { 24, 80, -24, -80 }, { 33, 106, -33, -106 }, { 47, 183, -47, -183 }
+};
+
+// Select ETC1 subblock codeword and pixel indices for base color, returns squared error
+static int SelectSubblockETC1(const rl_Color *block, int flip, int subblock, const int *base, int *codeword, unsigned char *indices)
+{
+    int bestError = INT_MAX;
+
+    for (int t = 0; t < 8; t++)
+    {
+        int error = 0;
+        unsigned char selected[16] = { 0 };
+
+        for (int i = 0; i < 16; i++)
+        {
+            int x = i%4;
+            int y = i/4;
+            if ((flip? (y/2) : (x/2)) != subblock) continue;
+
+            int pixelError = INT_MAX;
+
+            for (int k = 0; k < 4; k++)
+            {
+                int e = 0;
+                for (int c = 0; c < 3; c++)
                 {
-                    // LEFT QUAD
-                    // -----------------------------------------------------------
-                    // rl_Texture coords                 Vertices
-                    rlTexCoord2f(coordA.x, coordD.y); rlVertex2f(vertA.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordA.x, coordA.y); rlVertex2f(vertA.x, vertA.y);  // Top-left corner for texture and quad
-                    if (drawCenter)
+                    int value = base[c] + etcModifiers[t][k];
+                    if (value < 0) value = 0;
+                    else if (value > 255) value = 255;
+
+                    int d = value - ((const unsigned char *)&block[i])[c];
+                    e += d*d;
+                }
+
+                if (e < pixelError) { pixelError = e; selected[i] = (unsigned char)k; }
+            }
+
+            error += pixelError;
+            if (error >= bestError) break;
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            *codeword = t;
+
+            for (int i = 0; i < 16; i++)
+            {
+                if ((flip? ((i/4)/2) : ((i%4)/2)) == subblock) indices[i] = selected[i];
+            }
+        }
+    }
+
+    return bestError;
+}
+
+// Compress ETC1 color block, also valid ETC2 RGB block
+// NOTE: Individual and differential modes evaluated for both subblocks orientations
+static void CompressBlockETC1(const rl_Color *block, unsigned char *dst)
+{
+    int bestError = INT_MAX;
+    unsigned int bestHigh = 0;
+    unsigned char bestIndices[16] = { 0 };
+
+    for (int flip = 0; flip < 2; flip++)
+    {
+        float average[2][3] = { 0 };
+
+        for (int i = 0; i < 16; i++)
+        {
+            int subblock = flip? ((i/4)/2) : ((i%4)/2);
+            for (int c = 0; c < 3; c++) average[subblock][c] += ((const unsigned char *)&block[i])[c]/8.0f;
+        }
+
+        for (int differential = 0; differential < 2; differential++)
+        {
+            int quantized[2][3] = { 0 };
+            int base[2][3] = { 0 };
+
+            if (differential)
+            {
+                bool valid = true;
+
+                for (int c = 0; c < 3; c++)
+                {
+                    quantized[0][c] = (int)(average[0][c]*31.0f/255.0f + 0.5f);
+                    quantized[1][c] = (int)(average[1][c]*31.0f/255.0f + 0.5f);
+
+                    int delta = quantized[1][c] - quantized[0][c];
+                    if ((delta < -4) || (delta > 3)) valid = false;
+
+                    base[0][c] = (quantized[0][c] << 3) | (quantized[0][c] >> 2);
+                    base[1][c] = (quantized[1][c] << 3) | (quantized[1][c] >> 2);
+                }
+
+                if (!valid) continue;
+            }
+            else
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    quantized[0][c] = (int)(average[0][c]*15.0f/255.0f + 0.5f);
+                    quantized[1][c] = (int)(average[1][c]*15.0f/255.0f + 0.5f);
+                    base[0][c] = quantized[0][c]*17;
+                    base[1][c] = quantized[1][c]*17;
+                }
+            }
+
+            int codewords[2] = { 0 };
+            unsigned char indices[16] = { 0 };
+            int error = SelectSubblockETC1(block, flip, 0, base[0], &codewords[0], indices);
+            error += SelectSubblockETC1(block, flip, 1, base[1], &codewords[1], indices);
+
+            if (error < bestError)
+            {
+                bestError = error;
+                memcpy(bestIndices, indices, 16);
+
+                if (differential)
+                {
+                    bestHigh = ((unsigned int)quantized[0][0] << 27) | ((unsigned int)((quantized[1][0] - quantized[0][0]) & 7) << 24) |
+                               ((unsigned int)quantized[0][1] << 19) | ((unsigned int)((quantized[1][1] - quantized[0][1]) & 7) << 16) |
+                               ((unsigned int)quantized[0][2] << 11) | ((unsigned int)((quantized[1][2] - quantized[0][2]) & 7) << 8) | 0x2;
+                }
+                else
+                {
+                    bestHigh = ((unsigned int)quantized[0][0] << 28) | ((unsigned int)quantized[1][0] << 24) | ((unsigned int)quantized[0][1] << 20) |
+                               ((unsigned int)quantized[1][1] << 16) | ((unsigned int)quantized[0][2] << 12) | ((unsigned int)quantized[1][2] << 8);
+                }
+
+                bestHigh |= (codewords[0] << 5) | (codewords[1] << 2) | flip;
+            }
+        }
+    }
+
+    // Pixels indices are stored by columns, most significant bits first
+    unsigned int low = 0;
+    for (int i = 0; i < 16; i++)
+    {
+        int bit = (i%4)*4 + i/4;
+        low |= (unsigned int)(bestIndices[i] >> 1) << (bit + 16);
+        low |= (unsigned int)(bestIndices[i] & 1) << bit;
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        dst[i] = (unsigned char)(bestHigh >> (24 - 8*i));
+        dst[4 + i] = (unsigned char)(low >> (24 - 8*i));
+    }
+}
+
+// EAC alpha modifiers tables
+static const int eacModifiers[16][8] = {
+    { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 }, { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+    { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 }, { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+    { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 }, { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+    { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 }, { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
+// Compress EAC alpha block (ETC2 RGBA alpha part)
+static void CompressBlockAlphaEAC(const rl_Color *block, unsigned char *dst)
+{
+    int minAlpha = 255;
+    int maxAlpha = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        if (block[i].a < minAlpha) minAlpha = block[i].a;
+        if (block[i].a > maxAlpha) maxAlpha = block[i].a;
+    }
+
+    int bestError = INT_MAX;
+    int bestBase = maxAlpha;
+    int bestMultiplier = 1;
+    int bestTable = 13;                 // Table with 0 modifier, used for single alpha blocks
+    unsigned char bestIndices[16] = { 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 };
+
+    if (maxAlpha > minAlpha)
+    {
+        for (int t = 0; t < 16; t++)
+        {
+            int span = eacModifiers[t][7] - eacModifiers[t][3];
+            int center = (int)((float)(maxAlpha - minAlpha)/span + 0.5f);
+
+            for (int multiplier = center - 1; multiplier <= center + 1; multiplier++)
+            {
+                if ((multiplier < 1) || (multiplier > 15)) continue;
+
+                int base = (int)(minAlpha - eacModifiers[t][3]*multiplier + (maxAlpha - minAlpha - span*multiplier)/2.0f + 0.5f);
+                if (base < 0) base = 0;
+                else if (base > 255) base = 255;
+
+                int error = 0;
+                unsigned char indices[16] = { 0 };
+
+                for (int i = 0; i < 16; i++)
+                {
+                    int pixelError = INT_MAX;
+
+                    for (int k = 0; k < 8; k++)
                     {
-                        // CENTER QUAD
-                        // -----------------------------------------------------------
-                        // rl_Texture coords                 Vertices
-                        rlTexCoord2f(coordB.x, coordD.y); rlVertex2f(vertB.x, vertD.y);  // Bottom-left corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-right corner for texture and quad
-                        rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-right corner for texture and quad
-                        rlTexCoord2f(coordB.x, coordA.y); rlVertex2f(vertB.x, vertA.y);  // Top-left corner for texture and quad
+                        int value = base + eacModifiers[t][k]*multiplier;
+                        if (value < 0) value = 0;
+                        else if (value > 255) value = 255;
+
+                        int e = (value - block[i].a)*(value - block[i].a);
+                        if (e < pixelError) { pixelError = e; indices[i] = (unsigned char)k; }
                     }
-                    // RIGHT QUAD
-                    // -----------------------------------------------------------
-                    // rl_Texture coords                 Vertices
-                    rlTexCoord2f(coordC.x, coordD.y); rlVertex2f(vertC.x, vertD.y);  // Bottom-left corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordD.y); rlVertex2f(vertD.x, vertD.y);  // Bottom-right corner for texture and quad
-                    rlTexCoord2f(coordD.x, coordA.y); rlVertex2f(vertD.x, vertA.y);  // Top-right corner for texture and quad
-                    rlTexCoord2f(coordC.x, coordA.y); rlVertex2f(vertC.x, vertA.y);  // Top-left corner for texture and quad
+
+                    error += pixelError;
                 }
-            rlEnd();
-        rlPopMatrix();
 
-        rlSetTexture(0);
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestBase = base;
+                    bestMultiplier = multiplier;
+                    bestTable = t;
+                    memcpy(bestIndices, indices, 16);
+                }
+            }
+        }
+    }
+
+    // Pixels indices are stored by columns, first pixel in most significant bits
+    unsigned long long bits = ((unsigned long long)bestBase << 56) | ((unsigned long long)bestMultiplier << 52) | ((unsigned long long)bestTable << 48);
+    for (int i = 0; i < 16; i++)
+    {
+        int position = (i%4)*4 + i/4;
+        bits |= (unsigned long long)bestIndices[i] << (45 - 3*position);
+    }
+
+    for (int i = 0; i < 8; i++) dst[i] = (unsigned char)(bits >> (56 - 8*i));
+}
+
+// Write bits into little-endian block at bits offset
+static void WriteBlockBits(unsigned char *dst, int *offset, unsigned int value, int bits)
+{
+    for (int i = 0; i < bits; i++, (*offset)++)
+    {
+        if (value & (1u << i)) dst[*offset/8] |= (unsigned char)(1 << (*offset%8));
+    }
+}
+
+// Quantize BC7 mode 6 endpoint (7 bit channels with shared p-bit)
+static void QuantizeEndpointBC7(const float *endpoint, int *quantized, int *pbit)
+{
+    int bestError = INT_MAX;
+
+    // Opaque alpha requires p-bit set to be kept exact
+    for (int p = (endpoint[3] >= 254.5f)? 1 : 0; p < 2; p++)
+    {
+        int values[4] = { 0 };
+        int error = 0;
+
+        for (int c = 0; c < 4; c++)
+        {
+            float value = endpoint[c];
+            if (value < 0.0f) value = 0.0f;
+            else if (value > 255.0f) value = 255.0f;
+
+            int q = (int)((value - p)/2.0f + 0.5f);
+            if (q < 0) q = 0;
+            else if (q > 127) q = 127;
+
+            values[c] = q;
+            int d = ((q << 1) | p) - (int)(value + 0.5f);
+            error += d*d;
+        }
+
+        if (error < bestError)
+        {
+            bestError = error;
+            *pbit = p;
+            for (int c = 0; c < 4; c++) quantized[c] = values[c];
+        }
+    }
+}
+
+// BC7 4 bit indices interpolation weights
+static const int bc7Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+// Select BC7 mode 6 indices for quantized endpoints, returns squared error
+static int SelectIndicesBC7(const rl_Color *block, const int *quantized0, int pbit0, const int *quantized1, int pbit1, unsigned char *indices)
+{
+    int palette[16][4] = { 0 };
+
+    for (int c = 0; c < 4; c++)
+    {
+        int e0 = (quantized0[c] << 1) | pbit0;
+        int e1 = (quantized1[c] << 1) | pbit1;
+
+        for (int k = 0; k < 16; k++) palette[k][c] = ((64 - bc7Weights[k])*e0 + bc7Weights[k]*e1 + 32) >> 6;
+    }
+
+    int error = 0;
+
+    for (int i = 0; i < 16; i++)
+    {
+        const unsigned char *p = (const unsigned char *)&block[i];
+        int pixelError = INT_MAX;
+
+        for (int k = 0; k < 16; k++)
+        {
+            int e = 0;
+            for (int c = 0; c < 4; c++) e += (palette[k][c] - p[c])*(palette[k][c] - p[c]);
+
+            if (e < pixelError) { pixelError = e; indices[i] = (unsigned char)k; }
+        }
+
+        error += pixelError;
     }
+
+    return error;
 }
 
-// Check if two colors are equal
-bool rl_ColorIsEqual(rl_Color col1, rl_Color col2)
+// Compress BC7 block (mode 6: single subset, RGBA 7 bit endpoints with p-bits, 4 bit indices)
+// NOTE: Endpoints from principal axis extremes, refined once by least squares
+static void CompressBlockBC7(const rl_Color *block, unsigned char *dst)
 {
-    bool result = false;
+    float mean[4] = { 0 };
+    float axis[4] = { 0 };
+    float end0[4] = { 0 };
+    float end1[4] = { 0 };
 
-    if ((col1.r == col2.r) && (col1.g == col2.g) && (col1.b == col2.b) && (col1.a == col2.a)) result = true;
+    if (GetBlockPrincipalAxis(block, NULL, 4, mean, axis))
+    {
+        float minT = 1e9f;
+        float maxT = -1e9f;
 
-    return result;
-}
+        for (int i = 0; i < 16; i++)
+        {
+            const unsigned char *p = (const unsigned char *)&block[i];
+            float t = 0.0f;
+            for (int c = 0; c < 4; c++) t += (p[c] - mean[c])*axis[c];
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-rl_Color rl_Fade(rl_Color color, float alpha)
-{
-    rl_Color result = color;
+            if (t < minT) minT = t;
+            if (t > maxT) maxT = t;
+        }
 
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+        for (int c = 0; c < 4; c++)
+        {
+            end0[c] = mean[c] + axis[c]*minT;
+            end1[c] = mean[c] + axis[c]*maxT;
+        }
+    }
+    else
+    {
+        for (int c = 0; c < 4; c++) end0[c] = end1[c] = ((const unsigned char *)&block[0])[c];
+    }
 
-    result.a = (unsigned char)(255.0f*alpha);
+    int quantized0[4] = { 0 };
+    int quantized1[4] = { 0 };
+    int pbit0 = 0;
+    int pbit1 = 0;
+    unsigned char indices[16] = { 0 };
 
-    return result;
+    QuantizeEndpointBC7(end0, quantized0, &pbit0);
+    QuantizeEndpointBC7(end1, quantized1, &pbit1);
+    int error = SelectIndicesBC7(block, quantized0, pbit0, quantized1, pbit1, indices);
+
+    // Least squares endpoints refinement for selected indices
+    if (error > 0)
+    {
+        float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+        float ap[4] = { 0 };
+        float bp[4] = { 0 };
+
+        for (int i = 0; i < 16; i++)
+        {
+            float w = bc7Weights[indices[i]]/64.0f;
+            const unsigned char *p = (const unsigned char *)&block[i];
+
+            aa += (1.0f - w)*(1.0f - w);
+            bb += w*w;
+            ab += w*(1.0f - w);
+            for (int c = 0; c < 4; c++) { ap[c] += (1.0f - w)*p[c]; bp[c] += w*p[c]; }
+        }
+
+        float det = aa*bb - ab*ab;
+
+        if (fabsf(det) > 1e-6f)
+        {
+            float refined0[4] = { 0 };
+            float refined1[4] = { 0 };
+
+            for (int c = 0; c < 4; c++)
+            {
+                refined0[c] = (bb*ap[c] - ab*bp[c])/det;
+                refined1[c] = (aa*bp[c] - ab*ap[c])/det;
+            }
+
+            int refinedQuantized0[4] = { 0 };
+            int refinedQuantized1[4] = { 0 };
+            int refinedPbit0 = 0;
+            int refinedPbit1 = 0;
+            unsigned char refinedIndices[16] = { 0 };
+
+            QuantizeEndpointBC7(refined0, refinedQuantized0, &refinedPbit0);
+            QuantizeEndpointBC7(refined1, refinedQuantized1, &refinedPbit1);
+            int refinedError = SelectIndicesBC7(block, refinedQuantized0, refinedPbit0, refinedQuantized1, refinedPbit1, refinedIndices);
+
+            if (refinedError < error)
+            {
+                memcpy(quantized0, refinedQuantized0, sizeof(quantized0));
+                memcpy(quantized1, refinedQuantized1, sizeof(quantized1));
+                pbit0 = refinedPbit0;
+                pbit1 = refinedPbit1;
+                memcpy(indices, refinedIndices, 16);
+            }
+        }
+    }
+
+    // First pixel index (anchor) most significant bit is implicit zero, swap endpoints if required
+    if (indices[0] & 0x8)
+    {
+        for (int c = 0; c < 4; c++) { int temp = quantized0[c]; quantized0[c] = quantized1[c]; quantized1[c] = temp; }
+        int temp = pbit0; pbit0 = pbit1; pbit1 = temp;
+        for (int i = 0; i < 16; i++) indices[i] = 15 - indices[i];
+    }
+
+    memset(dst, 0, 16);
+    int offset = 0;
+
+    WriteBlockBits(dst, &offset, 1 << 6, 7);        // Mode 6
+    for (int c = 0; c < 4; c++)
+    {
+        WriteBlockBits(dst, &offset, quantized0[c], 7);
+        WriteBlockBits(dst, &offset, quantized1[c], 7);
+    }
+    WriteBlockBits(dst, &offset, pbit0, 1);
+    WriteBlockBits(dst, &offset, pbit1, 1);
+    WriteBlockBits(dst, &offset, indices[0], 3);
+    for (int i = 1; i < 16; i++) WriteBlockBits(dst, &offset, indices[i], 4);
 }
 
-// Get hexadecimal value for a rl_Color
-int rl_ColorToInt(rl_Color color)
+// Compress BC4 block (red channel)
+// NOTE: BC4 block layout matches DXT5 interpolated alpha block, red values are encoded as alpha
+static void CompressBlockBC4(const rl_Color *block, unsigned char *dst)
 {
-    int result = 0;
+    rl_Color red[16] = { 0 };
+    for (int i = 0; i < 16; i++) red[i].a = block[i].r;
 
-    result = (int)(((unsigned int)color.r << 24) |
-                   ((unsigned int)color.g << 16) |
-                   ((unsigned int)color.b << 8) |
-                    (unsigned int)color.a);
+    CompressBlockAlphaDXT5(red, dst);
+}
 
-    return result;
+// Process image compression blocks rows range on current thread
+static void ProcessCompressionRange(const void *data, int start, int end)
+{
+    const CompressionJob *job = (const CompressionJob *)data;
+    int blocksX = (job->width + 3)/4;
+    rl_Color block[16] = { 0 };
+
+    for (int by = start; by < end; by++)
+    {
+        for (int bx = 0; bx < blocksX; bx++)
+        {
+            unsigned char *dst = job->dst + (by*blocksX + bx)*job->blockSize;
+            LoadImageBlock(job->pixels, job->width, job->height, bx, by, block);
+
+            switch (job->format)
+            {
+                case PIXELFORMAT_COMPRESSED_DXT1_RGB: CompressBlockColorDXT(block, dst, false); break;
+                case PIXELFORMAT_COMPRESSED_DXT1_RGBA: CompressBlockColorDXT(block, dst, true); break;
+                case PIXELFORMAT_COMPRESSED_DXT3_RGBA: CompressBlockAlphaDXT3(block, dst); CompressBlockColorDXT(block, dst + 8, false); break;
+                case PIXELFORMAT_COMPRESSED_DXT5_RGBA: CompressBlockAlphaDXT5(block, dst); CompressBlockColorDXT(block, dst + 8, false); break;
+                case PIXELFORMAT_COMPRESSED_ETC1_RGB:
+                case PIXELFORMAT_COMPRESSED_ETC2_RGB: CompressBlockETC1(block, dst); break;
+                case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA: CompressBlockAlphaEAC(block, dst); CompressBlockETC1(block, dst + 8); break;
+                case PIXELFORMAT_COMPRESSED_BC7_RGBA: CompressBlockBC7(block, dst); break;
+                case PIXELFORMAT_COMPRESSED_BC4_R: CompressBlockBC4(block, dst); break;
+                default: break;
+            }
+        }
+    }
 }
 
-// Get color normalized as float [0..1]
-rl_Vector4 rl_ColorNormalize(rl_Color color)
+// Compress image for texture upload if compression is enabled and supported
+// NOTE: Only 8 bit per channel uncompressed images with size multiple of 4 are compressed
+static bool LoadTextureCompressedImage(rl_Image image, rl_Image *compressed)
 {
-    rl_Vector4 result;
+    bool result = false;
 
-    result.x = (float)color.r/255.0f;
-    result.y = (float)color.g/255.0f;
-    result.z = (float)color.b/255.0f;
-    result.w = (float)color.a/255.0f;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((textureCompressionFormat == 0) || (image.data == NULL) || (image.format > PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) ||
+        ((image.width%4) != 0) || ((image.height%4) != 0)) return result;
+
+    unsigned int glInternalFormat = 0;
+    unsigned int glFormat = 0;
+    unsigned int glType = 0;
+    rlGetGlTextureFormats(textureCompressionFormat, &glInternalFormat, &glFormat, &glType);
+
+    if (glInternalFormat != 0)
+    {
+        *compressed = rl_ImageCopy(image);
+        rl_ImageCompress(compressed, textureCompressionFormat);
+
+        result = (compressed->format == textureCompressionFormat);
+        if (!result)
+        {
+            rl_UnloadImage(*compressed);
+            *compressed = (rl_Image){ 0 };
+        }
+    }
+#endif
 
     return result;
 }
 
-// Get color from normalized values [0..1]
-rl_Color rl_ColorFromNormalized(rl_Vector4 normalized)
+// Get texture stream entry, NULL if stream is not valid
+static TextureStreamEntry *GetTextureStreamEntry(rl_TextureStream stream)
 {
-    rl_Color result;
+    if ((stream.id == 0) || (stream.id > (unsigned int)textureStreams.capacity)) return NULL;
 
-    result.r = (unsigned char)(normalized.x*255.0f);
-    result.g = (unsigned char)(normalized.y*255.0f);
-    result.b = (unsigned char)(normalized.z*255.0f);
-    result.a = (unsigned char)(normalized.w*255.0f);
+    TextureStreamEntry *entry = &textureStreams.entries[stream.id - 1];
 
-    return result;
+    return (entry->image.data != NULL)? entry : NULL;
 }
 
-// Get HSV values for a rl_Color
-// NOTE: Hue is returned as degrees [0..360]
-rl_Vector3 rl_ColorToHSV(rl_Color color)
+// Get texture stream memory size with mipmap levels from first level
+static long long GetTextureStreamBytes(const TextureStreamEntry *entry, int firstMip)
 {
-    rl_Vector3 hsv = { 0 };
-    rl_Vector3 rgb = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-    float min = 0.0f;
-    float max = 0.0f;
-    float delta = 0.0f;
+    long long size = 0;
 
-    min = rgb.x < rgb.y? rgb.x : rgb.y;
-    min = min  < rgb.z? min  : rgb.z;
+    for (int i = 0, width = entry->image.width, height = entry->image.height; i < entry->image.mipmaps; i++)
+    {
+        if (i >= firstMip) size += rl_GetPixelDataSize(width, height, entry->image.format);
 
-    max = rgb.x > rgb.y? rgb.x : rgb.y;
-    max = max  > rgb.z? max  : rgb.z;
+        width = (width/2 < 1)? 1 : width/2;
+        height = (height/2 < 1)? 1 : height/2;
+    }
 
-    hsv.z = max;            // Value
-    delta = max - min;
+    return size;
+}
 
-    if (delta < 0.00001f)
+// Load texture with texture stream mipmap levels from first level, optionally uploaded asynchronously
+static rl_Texture2D LoadTextureStreamMip(const TextureStreamEntry *entry, int firstMip, bool async)
+{
+    rl_Texture2D texture = { 0 };
+    const unsigned char *data = (const unsigned char *)entry->image.data;
+    int width = entry->image.width;
+    int height = entry->image.height;
+
+    for (int i = 0; i < firstMip; i++)
     {
-        hsv.y = 0.0f;
-        hsv.x = 0.0f;       // Undefined, maybe NAN?
-        return hsv;
+        data += rl_GetPixelDataSize(width, height, entry->image.format);
+
+        width = (width/2 < 1)? 1 : width/2;
+        height = (height/2 < 1)? 1 : height/2;
     }
 
-    if (max > 0.0f)
+    int mipmaps = entry->image.mipmaps - firstMip;
+
+    if (async) texture.id = rlLoadTextureAsync(data, width, height, entry->image.format, mipmaps);
+    else texture.id = rlLoadTexture(data, width, height, entry->image.format, mipmaps);
+
+    if (texture.id > 0)
     {
-        // NOTE: If max is 0, this divide would cause a crash
-        hsv.y = (delta/max);    // Saturation
+        texture.width = width;
+        texture.height = height;
+        texture.mipmaps = mipmaps;
+        texture.format = entry->image.format;
     }
-    else
+
+    return texture;
+}
+
+// Get texture atlas data, NULL if atlas is not valid
+static TextureAtlasData *GetTextureAtlasData(rl_TextureAtlas atlas)
+{
+    if ((atlas.id == 0) || (atlas.id > (unsigned int)textureAtlases.capacity)) return NULL;
+
+    TextureAtlasData *data = &textureAtlases.atlases[atlas.id - 1];
+
+    return (data->image.data != NULL)? data : NULL;
+}
+
+// Get image texture data, NULL if image texture is not valid
+static ImageTextureData *GetImageTextureData(rl_ImageTexture texture)
+{
+    if ((texture.id == 0) || (texture.id > (unsigned int)imageTextures.capacity)) return NULL;
+
+    ImageTextureData *data = &imageTextures.textures[texture.id - 1];
+
+    return (data->image != NULL)? data : NULL;
+}
+
+// Add dirty rectangle to image texture, bounds (xMin, yMin, xMax, yMax) with max bounds exclusive
+// NOTE: Rectangle is merged with the one requiring smallest union growth if they touch and union wastes
+// less than their area (or rectangles limit is reached), merged rectangle is merged again with the rest
+static void AddImageTextureDirtyRect(ImageTextureData *data, int xMin, int yMin, int xMax, int yMax)
+{
+    int rect[4] = { xMin, yMin, xMax, yMax };
+
+    while (true)
     {
-        // NOTE: If max is 0, then r = g = b = 0, s = 0, h is undefined
-        hsv.y = 0.0f;
-        hsv.x = NAN;        // Undefined
-        return hsv;
+        int best = -1;
+        long long bestGrowth = 0;
+        long long area = (long long)(rect[2] - rect[0])*(rect[3] - rect[1]);
+
+        for (int i = 0; i < data->dirtyCount; i++)
+        {
+            const int *dirty = data->dirty[i];
+
+            // Rectangle already dirty, usual case for pixels drawn by primitives
+            if ((rect[0] >= dirty[0]) && (rect[1] >= dirty[1]) && (rect[2] <= dirty[2]) && (rect[3] <= dirty[3])) return;
+
+            long long dirtyArea = (long long)(dirty[2] - dirty[0])*(dirty[3] - dirty[1]);
+            long long unionArea = (long long)(((rect[2] > dirty[2])? rect[2] : dirty[2]) - ((rect[0] < dirty[0])? rect[0] : dirty[0]))*
+                                  (((rect[3] > dirty[3])? rect[3] : dirty[3]) - ((rect[1] < dirty[1])? rect[1] : dirty[1]));
+            long long growth = unionArea - dirtyArea - area;
+            bool touching = (rect[0] <= dirty[2]) && (rect[2] >= dirty[0]) && (rect[1] <= dirty[3]) && (rect[3] >= dirty[1]);
+
+            if ((touching && (growth <= (dirtyArea + area))) || (data->dirtyCount == MAX_IMAGE_TEXTURE_DIRTY_RECTS))
+            {
+                if ((best < 0) || (growth < bestGrowth))
+                {
+                    best = i;
+                    bestGrowth = growth;
+                }
+            }
+        }
+
+        if (best < 0) break;
+
+        // Merged rectangle replaces selected one, it is added again to merge with the rest
+        int *dirty = data->dirty[best];
+        if (dirty[0] < rect[0]) rect[0] = dirty[0];
+        if (dirty[1] < rect[1]) rect[1] = dirty[1];
+        if (dirty[2] > rect[2]) rect[2] = dirty[2];
+        if (dirty[3] > rect[3]) rect[3] = dirty[3];
+
+        data->dirtyCount--;
+        memcpy(data->dirty[best], data->dirty[data->dirtyCount], sizeof(data->dirty[0]));
     }
 
-    // NOTE: Comparing float values could not work properly
-    if (rgb.x >= max) hsv.x = (rgb.y - rgb.z)/delta;    // Between yellow & magenta
-    else
+    memcpy(data->dirty[data->dirtyCount], rect, sizeof(rect));
+    data->dirtyCount++;
+}
+
+// Set image area dirty on image textures mirroring image, area clamped to image
+// NOTE: Called by image drawing functions, image is matched by data
+static void SetImageAreaDirty(const rl_Image *image, int x, int y, int width, int height)
+{
+    if (imageTextures.count == 0) return;
+
+    int xMin = (x > 0)? x : 0;
+    int yMin = (y > 0)? y : 0;
+    int xMax = ((x + width) < image->width)? x + width : image->width;
+    int yMax = ((y + height) < image->height)? y + height : image->height;
+    if ((xMin >= xMax) || (yMin >= yMax)) return;
+
+    for (int i = 0; i < imageTextures.capacity; i++)
     {
-        if (rgb.y >= max) hsv.x = 2.0f + (rgb.z - rgb.x)/delta;  // Between cyan & yellow
-        else hsv.x = 4.0f + (rgb.x - rgb.y)/delta;      // Between magenta & cyan
+        ImageTextureData *data = &imageTextures.textures[i];
+        if ((data->image != NULL) && (data->image->data == image->data)) AddImageTextureDirtyRect(data, xMin, yMin, xMax, yMax);
     }
+}
 
-    hsv.x *= 60.0f;     // Convert to degrees
+// Get mapped image data, NULL if mapped image is not valid
+static ImageMappedData *GetImageMappedData(rl_ImageMapped image)
+{
+    if ((image.id == 0) || (image.id > (unsigned int)imagesMapped.capacity)) return NULL;
 
-    if (hsv.x < 0.0f) hsv.x += 360.0f;
+    ImageMappedData *data = &imagesMapped.images[image.id - 1];
 
-    return hsv;
+    return ((data->mapping != NULL) || (data->file != NULL))? data : NULL;
 }
 
-// Get a rl_Color from HSV values
-// Implementation reference: https://en.wikipedia.org/wiki/HSL_and_HSV#Alternative_HSV_conversion
-// NOTE: rl_Color->HSV->rl_Color conversion will not yield exactly the same color due to rounding errors
-// Hue is provided in degrees: [0..360]
-// Saturation/Value are provided normalized: [0.0f..1.0f]
-rl_Color rl_ColorFromHSV(float hue, float saturation, float value)
+// Unload mapped image data, file mapping is released or file closed
+static void UnloadImageMappedData(ImageMappedData *data)
 {
-    rl_Color color = { 0, 0, 0, 255 };
+#if defined(SUPPORT_IMAGE_FILE_MAPPING)
+    if (data->mapping != NULL) munmap(data->mapping, (size_t)data->mappingSize);
+#endif
+    if (data->file != NULL) fclose(data->file);
 
-    // Red channel
-    float k = fmodf((5.0f + hue/60.0f), 6);
-    float t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.r = (unsigned char)((value - value*saturation*k)*255.0f);
+    *data = (ImageMappedData){ 0 };
+}
 
-    // Green channel
-    k = fmodf((3.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.g = (unsigned char)((value - value*saturation*k)*255.0f);
+// Get mapped image region clipped to image bounds, returns false if region is empty
+static bool GetImageMappedRegion(const ImageMappedData *data, rl_Rectangle rec, int *x, int *y, int *width, int *height)
+{
+    int xMin = (rec.x < 0)? 0 : (int)rec.x;
+    int yMin = (rec.y < 0)? 0 : (int)rec.y;
+    int xMax = ((rec.x + rec.width) > data->width)? data->width : (int)(rec.x + rec.width);
+    int yMax = ((rec.y + rec.height) > data->height)? data->height : (int)(rec.y + rec.height);
 
-    // Blue channel
-    k = fmodf((1.0f + hue/60.0f), 6);
-    t = 4.0f - k;
-    k = (t < k)? t : k;
-    k = (k < 1)? k : 1;
-    k = (k > 0)? k : 0;
-    color.b = (unsigned char)((value - value*saturation*k)*255.0f);
+    if ((xMin >= xMax) || (yMin >= yMax))
+    {
+        TRACELOG(LOG_WARNING, "IMAGE: Mapped image region is out of image bounds");
+        return false;
+    }
 
-    return color;
+    *x = xMin;
+    *y = yMin;
+    *width = xMax - xMin;
+    *height = yMax - yMin;
+
+    return true;
 }
 
-// Get color multiplied with another color
-rl_Color rl_ColorTint(rl_Color color, rl_Color tint)
+// Get mapped image rows data for a region, only available for full width regions of mapped files
+static const unsigned char *GetImageMappedRows(const ImageMappedData *data, int x, int y, int width)
 {
-    rl_Color result = color;
+    if ((data->mapping == NULL) || (x != 0) || (width != data->width)) return NULL;
 
-    unsigned char r = (unsigned char)(((int)color.r*(int)tint.r)/255);
-    unsigned char g = (unsigned char)(((int)color.g*(int)tint.g)/255);
-    unsigned char b = (unsigned char)(((int)color.b*(int)tint.b)/255);
-    unsigned char a = (unsigned char)(((int)color.a*(int)tint.a)/255);
+    long long rowSize = (long long)data->width*rl_GetPixelDataSize(1, 1, data->format);
 
-    result.r = r;
-    result.g = g;
-    result.b = b;
-    result.a = a;
+    return (const unsigned char *)data->mapping + data->dataOffset + y*rowSize;
+}
 
-    return result;
+// Read mapped image region into packed pixel data, rows are copied from mapping or read from file
+static bool ReadImageMappedRegion(const ImageMappedData *data, int x, int y, int width, int height, unsigned char *dst)
+{
+    int bytesPerPixel = rl_GetPixelDataSize(1, 1, data->format);
+    long long rowSize = (long long)data->width*bytesPerPixel;
+    long long offset = data->dataOffset + y*rowSize + (long long)x*bytesPerPixel;
+    size_t regionRowSize = (size_t)width*bytesPerPixel;
+
+    if (data->mapping != NULL)
+    {
+        const unsigned char *src = (const unsigned char *)data->mapping + offset;
+
+        if (width == data->width) memcpy(dst, src, regionRowSize*height);
+        else for (int i = 0; i < height; i++) memcpy(dst + i*regionRowSize, src + i*rowSize, regionRowSize);
+
+        return true;
+    }
+
+    // Full width regions are read at once, other regions row by row
+    int rowCount = (width == data->width)? 1 : height;
+    size_t readSize = (width == data->width)? regionRowSize*height : regionRowSize;
+
+    for (int i = 0; i < rowCount; i++)
+    {
+        if ((FSEEK64(data->file, offset + i*rowSize, SEEK_SET) != 0) || (fread(dst + i*readSize, 1, readSize, data->file) != readSize))
+        {
+            TRACELOG(LOG_WARNING, "IMAGE: Failed to read mapped image region from file");
+            return false;
+        }
+    }
+
+    return true;
 }
 
-// Get color with brightness correction, brightness factor goes from -1.0f to 1.0f
-rl_Color rl_ColorBrightness(rl_Color color, float factor)
+// Defragment texture atlas data, images are repacked together into a new atlas image
+// NOTE: Current packing is kept if images could not be repacked
+static bool DefragTextureAtlasData(TextureAtlasData *data)
 {
-    rl_Color result = color;
+    int width = data->image.width;
+    int height = data->image.height;
+    int count = 0;
+
+    for (int i = 0; i < data->entryCount; i++) if (data->entries[i].used) count++;
+
+    // NOTE: Packer context points to its nodes and itself, it is allocated to be kept on success
+    stbrp_context *context = (stbrp_context *)RL_MALLOC(sizeof(stbrp_context));
+    stbrp_node *nodes = (stbrp_node *)RL_MALLOC(width*sizeof(stbrp_node));
+    stbrp_rect *rects = (stbrp_rect *)RL_CALLOC((count > 0)? count : 1, sizeof(stbrp_rect));
+    unsigned char *pixels = (unsigned char *)RL_CALLOC(width*height, 4);
+    bool packed = (context != NULL) && (nodes != NULL) && (rects != NULL) && (pixels != NULL);
+
+    if (packed)
+    {
+        for (int i = 0, k = 0; i < data->entryCount; i++)
+        {
+            if (!data->entries[i].used) continue;
+
+            rects[k].id = i;
+            rects[k].w = (int)data->entries[i].rec.width + TEXTURE_ATLAS_PADDING;
+            rects[k].h = (int)data->entries[i].rec.height + TEXTURE_ATLAS_PADDING;
+            k++;
+        }
+
+        // NOTE: Packer sorts all rectangles by height, usually denser than incremental packing
+        stbrp_init_target(context, width, height, nodes, width);
+        packed = (stbrp_pack_rects(context, rects, count) == 1);
+    }
+
+    if (packed)
+    {
+        for (int k = 0; k < count; k++)
+        {
+            TextureAtlasEntry *entry = &data->entries[rects[k].id];
+            int recWidth = (int)entry->rec.width;
+
+            for (int y = 0; y < (int)entry->rec.height; y++)
+            {
+                memcpy(pixels + ((rects[k].y + y)*width + rects[k].x)*4,
+                    (unsigned char *)data->image.data + (((int)entry->rec.y + y)*width + (int)entry->rec.x)*4, recWidth*4);
+            }
 
-    if (factor > 1.0f) factor = 1.0f;
-    else if (factor < -1.0f) factor = -1.0f;
+            entry->rec.x = (float)rects[k].x;
+            entry->rec.y = (float)rects[k].y;
+        }
 
-    float red = (float)color.r;
-    float green = (float)color.g;
-    float blue = (float)color.b;
+        RL_FREE(data->image.data);
+        RL_FREE(data->context);
+        RL_FREE(data->nodes);
+        data->image.data = pixels;
+        data->nodes = nodes;
+        data->context = context;
+        data->freedArea = 0;
 
-    if (factor < 0.0f)
-    {
-        factor = 1.0f + factor;
-        red *= factor;
-        green *= factor;
-        blue *= factor;
+        rlUpdateTexture(data->texture.id, 0, 0, width, height, data->image.format, data->image.data);
+
+        TRACELOG(LOG_INFO, "TEXTURE: [ID %i] Atlas defragmented successfully (%i images)", data->texture.id, count);
     }
     else
     {
-        red = (255 - red)*factor + red;
-        green = (255 - green)*factor + green;
-        blue = (255 - blue)*factor + blue;
+        RL_FREE(context);
+        RL_FREE(nodes);
+        RL_FREE(pixels);
+        TRACELOG(LOG_WARNING, "TEXTURE: [ID %i] Failed to defragment atlas", data->texture.id);
     }
 
-    result.r = (unsigned char)red;
-    result.g = (unsigned char)green;
-    result.b = (unsigned char)blue;
+    RL_FREE(rects);
 
-    return result;
+    return packed;
 }
 
-// Get color with contrast correction
-// NOTE: Contrast values between -1.0f and 1.0f
-rl_Color rl_ColorContrast(rl_Color color, float contrast)
+// Get animated texture data, NULL if animated texture is not valid
+static AnimatedTextureData *GetAnimatedTextureData(rl_AnimatedTexture anim)
 {
-    rl_Color result = color;
-
-    if (contrast < -1.0f) contrast = -1.0f;
-    else if (contrast > 1.0f) contrast = 1.0f;
-
-    contrast = (1.0f + contrast);
-    contrast *= contrast;
+    if ((anim.id == 0) || (anim.id > (unsigned int)animatedTextures.capacity)) return NULL;
 
-    float pR = (float)color.r/255.0f;
-    pR -= 0.5f;
-    pR *= contrast;
-    pR += 0.5f;
-    pR *= 255;
-    if (pR < 0) pR = 0;
-    else if (pR > 255) pR = 255;
+    AnimatedTextureData *data = &animatedTextures.animations[anim.id - 1];
 
-    float pG = (float)color.g/255.0f;
-    pG -= 0.5f;
-    pG *= contrast;
-    pG += 0.5f;
-    pG *= 255;
-    if (pG < 0) pG = 0;
-    else if (pG > 255) pG = 255;
+    return (data->texture.id != 0)? data : NULL;
+}
 
-    float pB = (float)color.b/255.0f;
-    pB -= 0.5f;
-    pB *= contrast;
-    pB += 0.5f;
-    pB *= 255;
-    if (pB < 0) pB = 0;
-    else if (pB > 255) pB = 255;
+// Unload animated texture data, decoder state and frames
+static void UnloadAnimatedTextureData(AnimatedTextureData *data)
+{
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    if (data->gif != NULL)
+    {
+        STBI_FREE(data->gif->out);
+        STBI_FREE(data->gif->background);
+        STBI_FREE(data->gif->history);
+        RL_FREE(data->gif);
+    }
+#endif
+    if (data->texture.id != 0) rlUnloadTexture(data->texture.id);
 
-    result.r = (unsigned char)pR;
-    result.g = (unsigned char)pG;
-    result.b = (unsigned char)pB;
+    RL_FREE(data->fileData);
+    RL_FREE(data->frames[0]);
+    RL_FREE(data->frames[1]);
 
-    return result;
+    *data = (AnimatedTextureData){ 0 };
 }
 
-// Get color with alpha applied, alpha goes from 0.0f to 1.0f
-rl_Color rl_ColorAlpha(rl_Color color, float alpha)
+// Decode next animated texture frame, decoding restarts from first frame after last frame
+// NOTE: Decoded frame is stored in frames ring, frame before previous one is required by GIF disposal
+static bool DecodeAnimatedTextureFrame(AnimatedTextureData *data)
 {
-    rl_Color result = color;
+#if defined(SUPPORT_FILEFORMAT_GIF)
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        if ((data->frame < 0) || (data->frame >= (data->frameCount - 1)))
+        {
+            STBI_FREE(data->gif->out);
+            STBI_FREE(data->gif->background);
+            STBI_FREE(data->gif->history);
+            memset(data->gif, 0, sizeof(stbi__gif));
 
-    if (alpha < 0.0f) alpha = 0.0f;
-    else if (alpha > 1.0f) alpha = 1.0f;
+            stbi__start_mem(&data->context, data->fileData, data->dataSize);
+            data->frame = -1;
+        }
 
-    result.a = (unsigned char)(255.0f*alpha);
+        int frame = data->frame + 1;
+        int comp = 0;
+        stbi_uc *pixels = stbi__gif_load_next(&data->context, data->gif, &comp, 4, (frame >= 2)? data->frames[frame%2] : NULL);
 
-    return result;
+        if ((pixels != NULL) && (pixels != (stbi_uc *)&data->context))
+        {
+            int size = data->gif->w*data->gif->h*4;
+
+            if (data->frames[0] == NULL)
+            {
+                data->frames[0] = (unsigned char *)RL_MALLOC(size);
+                data->frames[1] = (unsigned char *)RL_MALLOC(size);
+                if ((data->frames[0] == NULL) || (data->frames[1] == NULL)) return false;
+            }
+
+            memcpy(data->frames[frame%2], pixels, size);
+            data->frame = frame;
+            data->delay = data->gif->delay;
+
+            return true;
+        }
+
+        // Frames count could be wrong for damaged files, animation loops over decoded frames
+        if (frame == 0) break;
+        data->frameCount = frame;
+    }
+#endif
+
+    return false;
 }
 
-// Get src alpha-blended into dst color with tint
-rl_Color rl_ColorAlphaBlend(rl_Color dst, rl_Color src, rl_Color tint)
+#if defined(SUPPORT_FILEFORMAT_GIF)
+// Get GIF frames count, parsing file blocks without decoding frames
+static int GetGifFrameCount(const unsigned char *fileData, int dataSize)
 {
-    rl_Color out = rl_WHITE;
+    if ((dataSize < 13) || (memcmp(fileData, "GIF", 3) != 0)) return 0;
 
-    // Apply color tint to source color
-    src.r = (unsigned char)(((unsigned int)src.r*((unsigned int)tint.r+1)) >> 8);
-    src.g = (unsigned char)(((unsigned int)src.g*((unsigned int)tint.g+1)) >> 8);
-    src.b = (unsigned char)(((unsigned int)src.b*((unsigned int)tint.b+1)) >> 8);
-    src.a = (unsigned char)(((unsigned int)src.a*((unsigned int)tint.a+1)) >> 8);
+    int frameCount = 0;
+    int offset = 13;
 
-//#define COLORALPHABLEND_FLOAT
-#define COLORALPHABLEND_INTEGERS
-#if defined(COLORALPHABLEND_INTEGERS)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
+    // Global color table after logical screen descriptor
+    if (fileData[10] & 0x80) offset += 3*(1 << ((fileData[10] & 0x07) + 1));
+
+    while (offset < dataSize)
     {
-        unsigned int alpha = (unsigned int)src.a + 1;     // We are shifting by 8 (dividing by 256), so we need to take that excess into account
-        out.a = (unsigned char)(((unsigned int)alpha*256 + (unsigned int)dst.a*(256 - alpha)) >> 8);
+        unsigned char block = fileData[offset++];
 
-        if (out.a > 0)
+        if (block == 0x3b) break;               // Trailer
+        else if (block == 0x21) offset++;       // Extension, label before data sub-blocks
+        else if (block == 0x2c)
         {
-            out.r = (unsigned char)((((unsigned int)src.r*alpha*256 + (unsigned int)dst.r*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.g = (unsigned char)((((unsigned int)src.g*alpha*256 + (unsigned int)dst.g*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-            out.b = (unsigned char)((((unsigned int)src.b*alpha*256 + (unsigned int)dst.b*(unsigned int)dst.a*(256 - alpha))/out.a) >> 8);
-        }
-    }
-#endif
-#if defined(COLORALPHABLEND_FLOAT)
-    if (src.a == 0) out = dst;
-    else if (src.a == 255) out = src;
-    else
-    {
-        rl_Vector4 fdst = rl_ColorNormalize(dst);
-        rl_Vector4 fsrc = rl_ColorNormalize(src);
-        rl_Vector4 ftint = rl_ColorNormalize(tint);
-        rl_Vector4 fout = { 0 };
+            // Image descriptor, local color table and LZW code size before data sub-blocks
+            if ((offset + 9) > dataSize) break;
 
-        fout.w = fsrc.w + fdst.w*(1.0f - fsrc.w);
+            unsigned char flags = fileData[offset + 8];
+            offset += 9;
 
-        if (fout.w > 0.0f)
-        {
-            fout.x = (fsrc.x*fsrc.w + fdst.x*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.y = (fsrc.y*fsrc.w + fdst.y*fdst.w*(1 - fsrc.w))/fout.w;
-            fout.z = (fsrc.z*fsrc.w + fdst.z*fdst.w*(1 - fsrc.w))/fout.w;
+            if (flags & 0x80) offset += 3*(1 << ((flags & 0x07) + 1));
+            offset++;
+
+            frameCount++;
         }
+        else break;
 
-        out = (rl_Color){ (unsigned char)(fout.x*255.0f), (unsigned char)(fout.y*255.0f), (unsigned char)(fout.z*255.0f), (unsigned char)(fout.w*255.0f) };
+        // Skip data sub-blocks, terminated by a zero size block
+        while ((offset < dataSize) && (fileData[offset] != 0)) offset += fileData[offset] + 1;
+        offset++;
     }
-#endif
 
-    return out;
+    return frameCount;
 }
+#endif
 
-// Get color lerp interpolation between two colors, factor [0.0f..1.0f]
-rl_Color rl_ColorLerp(rl_Color color1, rl_Color color2, float factor)
+#if defined(SUPPORT_IMAGE_GENERATION)
+// Get perlin noise lattice cell terms of an octave row, corners gradients dot products without x fraction term
+static void GetPerlinNoiseCell(PerlinNoiseCell *cell, int px, const PerlinNoiseRow *row)
 {
-    rl_Color color = { 0 };
+    int x0 = px & 255, x1 = (px + 1) & 255;
+    int r0 = stb__perlin_randtab[x0 + row->seed];
+    int r1 = stb__perlin_randtab[x1 + row->seed];
+    int r[4] = { stb__perlin_randtab[r0 + row->y0], stb__perlin_randtab[r0 + row->y1], stb__perlin_randtab[r1 + row->y0], stb__perlin_randtab[r1 + row->y1] };
 
-    if (factor < 0.0f) factor = 0.0f;
-    else if (factor > 1.0f) factor = 1.0f;
+    cell->px = px;
 
-    color.r = (unsigned char)((1.0f - factor)*color1.r + factor*color2.r);
-    color.g = (unsigned char)((1.0f - factor)*color1.g + factor*color2.g);
-    color.b = (unsigned char)((1.0f - factor)*color1.b + factor*color2.b);
-    color.a = (unsigned char)((1.0f - factor)*color1.a + factor*color2.a);
+    for (int c = 0; c < 8; c++)
+    {
+        const float *gradient = perlinGradients[stb__perlin_randtab_grad_idx[r[c/2] + ((c & 1)? row->z1 : row->z0)]];
 
-    return color;
+        cell->gx[c] = gradient[0];
+        cell->gy[c] = gradient[1]*((c & 2)? (row->fy - 1) : row->fy);
+        cell->gz[c] = gradient[2]*((c & 1)? (row->fz - 1) : row->fz);
+    }
 }
 
-// Get a rl_Color struct from hexadecimal value
-rl_Color rl_GetColor(unsigned int hexValue)
+// Get perlin noise value within lattice cell, same operations as stb_perlin_noise3()
+static float GetPerlinNoiseCellValue(const PerlinNoiseCell *cell, float fx, const PerlinNoiseRow *row)
 {
-    rl_Color color;
+    float n[8] = { 0 };
+    float u = (((fx*6 - 15)*fx + 10)*fx*fx*fx);
 
-    color.r = (unsigned char)(hexValue >> 24) & 0xff;
-    color.g = (unsigned char)(hexValue >> 16) & 0xff;
-    color.b = (unsigned char)(hexValue >> 8) & 0xff;
-    color.a = (unsigned char)hexValue & 0xff;
+    for (int c = 0; c < 8; c++) n[c] = cell->gx[c]*((c & 4)? (fx - 1) : fx) + cell->gy[c] + cell->gz[c];
+    for (int c = 0; c < 4; c++) n[c] = n[c*2] + (n[c*2 + 1] - n[c*2])*row->w;
+    for (int c = 0; c < 2; c++) n[c] = n[c*2] + (n[c*2 + 1] - n[c*2])*row->v;
 
-    return color;
+    return n[0] + (n[1] - n[0])*u;
 }
 
-// Get color from a pixel from certain format
-rl_Color rl_GetPixelColor(void *srcPtr, int format)
+// Add perlin noise octave to image row sums (4 pixels per element), same as stb_perlin_fbm_noise3() octave
+// NOTE: Lattice cell terms are computed once per cell, 4 pixels within a cell are evaluated at once (SIMD)
+static void AddPerlinNoiseOctave(rl_Vector4 *sums, const float *coords, int count, float y, float z, float frequency, float amplitude, int seed)
 {
-    rl_Color color = { 0 };
-
-    switch (format)
+    // Row lattice cell and fade curves
+    PerlinNoiseRow row = { 0 };
+    float fy = y*frequency;
+    float fz = z*frequency;
+    int py = stb__perlin_fastfloor(fy);
+    int pz = stb__perlin_fastfloor(fz);
+
+    row.seed = seed;
+    row.y0 = py & 255;
+    row.y1 = (py + 1) & 255;
+    row.z0 = pz & 255;
+    row.z1 = (pz + 1) & 255;
+    row.fy = fy - py;
+    row.fz = fz - pz;
+    row.v = (((row.fy*6 - 15)*row.fy + 10)*row.fy*row.fy*row.fy);
+    row.w = (((row.fz*6 - 15)*row.fz + 10)*row.fz*row.fz*row.fz);
+
+    PerlinNoiseCell cell = { 0 };
+    GetPerlinNoiseCell(&cell, stb__perlin_fastfloor(coords[0]*frequency), &row);
+
+    for (int x = 0; x < count; x += 4)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: color = (rl_Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA: color = (rl_Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 5) & 0b0000000000111111)*255/63);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = 255;
-
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 11)*255/31);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 6) & 0b0000000000011111)*255/31);
-            color.b = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000011111)*255/31);
-            color.a = (((unsigned short *)srcPtr)[0] & 0b0000000000000001)? 255 : 0;
+        int lanes = ((count - x) < 4)? (count - x) : 4;
+        int px[4] = { 0 };
+        rl_Vector4 coord = { 0 };
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        for (int l = 0; l < lanes; l++)
         {
-            color.r = (unsigned char)((((unsigned short *)srcPtr)[0] >> 12)*255/15);
-            color.g = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 8) & 0b0000000000001111)*255/15);
-            color.b = (unsigned char)(((((unsigned short *)srcPtr)[0] >> 4) & 0b0000000000001111)*255/15);
-            color.a = (unsigned char)((((unsigned short *)srcPtr)[0] & 0b0000000000001111)*255/15);
+            ((float *)&coord)[l] = coords[x + l]*frequency;
+            px[l] = stb__perlin_fastfloor(((float *)&coord)[l]);
+        }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: color = (rl_Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], ((unsigned char *)srcPtr)[3] }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: color = (rl_Color){ ((unsigned char *)srcPtr)[0], ((unsigned char *)srcPtr)[1], ((unsigned char *)srcPtr)[2], 255 }; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32:
+        if ((lanes < 4) || (px[0] != px[3]) || (px[1] != px[0]) || (px[2] != px[0]))
         {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.a = 255;
+            // Pixels crossing lattice cells and last pixels are evaluated one by one
+            for (int l = 0; l < lanes; l++)
+            {
+                if (px[l] != cell.px) GetPerlinNoiseCell(&cell, px[l], &row);
+                ((float *)&sums[x/4])[l] += GetPerlinNoiseCellValue(&cell, ((float *)&coord)[l] - px[l], &row)*amplitude;
+            }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = 255;
+            continue;
+        }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(((float *)srcPtr)[0]*255.0f);
-            color.g = (unsigned char)(((float *)srcPtr)[1]*255.0f);
-            color.b = (unsigned char)(((float *)srcPtr)[2]*255.0f);
-            color.a = (unsigned char)(((float *)srcPtr)[3]*255.0f);
+        if (px[0] != cell.px) GetPerlinNoiseCell(&cell, px[0], &row);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.a = 255;
+        FilterPixel one = SplatFilterPixel(1.0f);
+        FilterPixel fx = SubtractFilterPixel(LoadFilterPixel(&coord), SplatFilterPixel((float)px[0]));
+        FilterPixel u = MultiplyFilterPixel(MultiplyFilterPixel(MultiplyFilterPixel(AddFilterPixel(MultiplyFilterPixel(
+            SubtractFilterPixel(MultiplyFilterPixel(fx, SplatFilterPixel(6.0f)), SplatFilterPixel(15.0f)), fx), SplatFilterPixel(10.0f)), fx), fx), fx);
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+        FilterPixel n[8];
+        for (int c = 0; c < 8; c++)
         {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = 255;
+            FilterPixel cx = (c & 4)? SubtractFilterPixel(fx, one) : fx;
+            n[c] = AddFilterPixel(AddFilterPixel(MultiplyFilterPixel(SplatFilterPixel(cell.gx[c]), cx), SplatFilterPixel(cell.gy[c])), SplatFilterPixel(cell.gz[c]));
+        }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
-        {
-            // NOTE: Pixel normalized float value is converted to [0..255]
-            color.r = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[0])*255.0f);
-            color.g = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[1])*255.0f);
-            color.b = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[2])*255.0f);
-            color.a = (unsigned char)(HalfToFloat(((unsigned short *)srcPtr)[3])*255.0f);
+        // Trilinear interpolation: a + (b - a)*t
+        FilterPixel w = SplatFilterPixel(row.w);
+        FilterPixel v = SplatFilterPixel(row.v);
+        for (int c = 0; c < 4; c++) n[c] = AddFilterPixel(n[c*2], MultiplyFilterPixel(SubtractFilterPixel(n[c*2 + 1], n[c*2]), w));
+        for (int c = 0; c < 2; c++) n[c] = AddFilterPixel(n[c*2], MultiplyFilterPixel(SubtractFilterPixel(n[c*2 + 1], n[c*2]), v));
+        FilterPixel noise = AddFilterPixel(n[0], MultiplyFilterPixel(SubtractFilterPixel(n[1], n[0]), u));
 
-        } break;
-        default: break;
+        StoreFilterPixel(&sums[x/4], AddFilterPixel(LoadFilterPixel(&sums[x/4]), MultiplyFilterPixel(noise, SplatFilterPixel(amplitude))));
     }
-
-    return color;
 }
 
-// Set pixel color formatted into destination pointer
-void rl_SetPixelColor(void *dstPtr, rl_Color color, int format)
+// Process perlin noise image rows range on current thread
+// NOTE: Octaves are added to row sums, noise lattice cells are shared by neighbor pixels
+static void ProcessPerlinNoiseRange(const void *data, int start, int end)
 {
-    switch (format)
+    const PerlinNoiseJob *noise = (const PerlinNoiseJob *)data;
+    int width = noise->width;
+    int height = noise->height;
+    float aspectRatio = (float)width/(float)height;
+
+    float *coords = (float *)RL_MALLOC(width*sizeof(float));
+    rl_Vector4 *sums = (rl_Vector4 *)RL_MALLOC(((width + 3)/4)*sizeof(rl_Vector4));
+
+    for (int x = 0; x < width; x++)
     {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-        {
-            // NOTE: Calculate grayscale equivalent color
-            rl_Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
+        coords[x] = (float)(x + noise->offsetX)*(noise->scale/(float)width);
 
-            ((unsigned char *)dstPtr)[0] = gray;
+        // Apply aspect ratio compensation to wider side
+        if (width > height) coords[x] *= aspectRatio;
+    }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
+    for (int y = start; y < end; y++)
+    {
+        float ny = (float)(y + noise->offsetY)*(noise->scale/(float)height);
+        if (width <= height) ny /= aspectRatio;
+
+        // Calculate a better perlin noise using fbm (fractal brownian motion)
+        // Typical values to start playing with:
+        //   lacunarity = ~2.0   -- spacing between successive octaves (use exactly 2.0 for wrapping output)
+        //   gain       =  0.5   -- relative weighting applied to each successive octave
+        //   octaves    =  6     -- number of "octaves" of noise3() to sum
+        float frequency = 1.0f;
+        float amplitude = 1.0f;
+        memset(sums, 0, ((width + 3)/4)*sizeof(rl_Vector4));
+
+        for (int i = 0; i < 6; i++)
         {
-            // NOTE: Calculate grayscale equivalent color
-            rl_Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
-            unsigned char gray = (unsigned char)((coln.x*0.299f + coln.y*0.587f + coln.z*0.114f)*255.0f);
-
-            ((unsigned char *)dstPtr)[0] = gray;
-            ((unsigned char *)dstPtr)[1] = color.a;
+            AddPerlinNoiseOctave(sums, coords, width, ny, 1.0f, frequency, amplitude, i);
+            frequency *= 2.0f;
+            amplitude *= 0.5f;
+        }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        for (int x = 0; x < width; x++)
         {
-            // NOTE: Calculate R5G6B5 equivalent color
-            rl_Vector3 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f };
+            float p = ((float *)&sums[x/4])[x%4];
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*63.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
+            // Clamp between -1.0f and 1.0f
+            if (p < -1.0f) p = -1.0f;
+            if (p > 1.0f) p = 1.0f;
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 5 | (unsigned short)b;
+            // We need to normalize the data from [-1..1] to [0..1]
+            float np = (p + 1.0f)/2.0f;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            rl_Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+            unsigned char intensity = (unsigned char)(np*255.0f);
+            noise->pixels[y*width + x] = (rl_Color){ intensity, intensity, intensity, 255 };
+        }
+    }
 
-            unsigned char r = (unsigned char)(round(coln.x*31.0f));
-            unsigned char g = (unsigned char)(round(coln.y*31.0f));
-            unsigned char b = (unsigned char)(round(coln.z*31.0f));
-            unsigned char a = (coln.w > ((float)PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD/255.0f))? 1 : 0;
+    RL_FREE(sums);
+    RL_FREE(coords);
+}
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 11 | (unsigned short)g << 6 | (unsigned short)b << 1 | (unsigned short)a;
+// Process cellular image rows range on current thread
+// NOTE: Nearest seed is searched with squared integer distances, distance is computed once per pixel
+static void ProcessCellularRange(const void *data, int start, int end)
+{
+    const CellularJob *cellular = (const CellularJob *)data;
+    int tileSize = cellular->tileSize;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+    for (int y = start; y < end; y++)
+    {
+        int tileY = y/tileSize;
+
+        for (int x = 0; x < cellular->width; x++)
         {
-            // NOTE: Calculate R5G5B5A1 equivalent color
-            rl_Vector4 coln = { (float)color.r/255.0f, (float)color.g/255.0f, (float)color.b/255.0f, (float)color.a/255.0f };
+            int tileX = x/tileSize;
+            int minDistanceSqr = -1;
 
-            unsigned char r = (unsigned char)(round(coln.x*15.0f));
-            unsigned char g = (unsigned char)(round(coln.y*15.0f));
-            unsigned char b = (unsigned char)(round(coln.z*15.0f));
-            unsigned char a = (unsigned char)(round(coln.w*15.0f));
+            // Check all adjacent tiles
+            for (int i = -1; i < 2; i++)
+            {
+                if ((tileX + i < 0) || (tileX + i >= cellular->seedsPerRow)) continue;
+
+                for (int j = -1; j < 2; j++)
+                {
+                    if ((tileY + j < 0) || (tileY + j >= cellular->seedsPerCol)) continue;
+
+                    rl_Vector2 neighborSeed = cellular->seeds[(tileY + j)*cellular->seedsPerRow + tileX + i];
 
-            ((unsigned short *)dstPtr)[0] = (unsigned short)r << 12 | (unsigned short)g << 8 | (unsigned short)b << 4 | (unsigned short)a;
+                    int dx = x - (int)neighborSeed.x;
+                    int dy = y - (int)neighborSeed.y;
+                    int distanceSqr = dx*dx + dy*dy;
+                    if ((minDistanceSqr < 0) || (distanceSqr < minDistanceSqr)) minDistanceSqr = distanceSqr;
+                }
+            }
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
+            float minDistance = (minDistanceSqr < 0)? 65536.0f : (float)sqrt((double)minDistanceSqr);
+            if (minDistance > 65536.0f) minDistance = 65536.0f;
 
-        } break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-        {
-            ((unsigned char *)dstPtr)[0] = color.r;
-            ((unsigned char *)dstPtr)[1] = color.g;
-            ((unsigned char *)dstPtr)[2] = color.b;
-            ((unsigned char *)dstPtr)[3] = color.a;
+            // This approach seems to give good results at all tile sizes
+            int intensity = (int)(minDistance*256.0f/tileSize);
+            if (intensity > 255) intensity = 255;
 
-        } break;
-        default: break;
+            unsigned char intensityUC = (unsigned char)intensity;
+            cellular->pixels[y*cellular->width + x] = (rl_Color){ intensityUC, intensityUC, intensityUC, 255 };
+        }
     }
 }
+#endif      // SUPPORT_IMAGE_GENERATION
 
-// Get pixel data size in bytes for certain format
-// NOTE: Size can be requested for rl_Image or rl_Texture data
-int rl_GetPixelDataSize(int width, int height, int format)
+// Get image rectangle area drawn by rl_ImageDrawRectangleRec(), rectangle clamped to image bounds
+// NOTE: Area is returned as { x, y, width, height } in pixels, empty rectangle within image draws its first pixel (or first row)
+static bool GetImageRectangleArea(const rl_Image *dst, rl_Rectangle rec, int *area)
 {
-    int dataSize = 0;       // Size in bytes
-    int bpp = 0;            // Bits per pixel
+    // Security check to avoid drawing out of bounds in case of bad user data
+    if (rec.x < 0) { rec.width += rec.x; rec.x = 0; }
+    if (rec.y < 0) { rec.height += rec.y; rec.y = 0; }
+    if (rec.width < 0) rec.width = 0;
+    if (rec.height < 0) rec.height = 0;
 
-    switch (format)
-    {
-        case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE: bpp = 8; break;
-        case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4: bpp = 16; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8: bpp = 32; break;
-        case PIXELFORMAT_UNCOMPRESSED_R8G8B8: bpp = 24; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32: bpp = 32; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32: bpp = 32*3; break;
-        case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32: bpp = 32*4; break;
-        case PIXELFORMAT_UNCOMPRESSED_R16: bpp = 16; break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16: bpp = 16*3; break;
-        case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16: bpp = 16*4; break;
-        case PIXELFORMAT_COMPRESSED_DXT1_RGB:
-        case PIXELFORMAT_COMPRESSED_DXT1_RGBA:
-        case PIXELFORMAT_COMPRESSED_ETC1_RGB:
-        case PIXELFORMAT_COMPRESSED_ETC2_RGB:
-        case PIXELFORMAT_COMPRESSED_PVRT_RGB:
-        case PIXELFORMAT_COMPRESSED_PVRT_RGBA: bpp = 4; break;
-        case PIXELFORMAT_COMPRESSED_DXT3_RGBA:
-        case PIXELFORMAT_COMPRESSED_DXT5_RGBA:
-        case PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA:
-        case PIXELFORMAT_COMPRESSED_ASTC_4x4_RGBA: bpp = 8; break;
-        case PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA: bpp = 2; break;
-        default: break;
-    }
+    // Clamp the size the the image bounds
+    if ((rec.x + rec.width) >= dst->width) rec.width = dst->width - rec.x;
+    if ((rec.y + rec.height) >= dst->height) rec.height = dst->height - rec.y;
 
-    double bytesPerPixel = (double)bpp/8.0;
-    dataSize = (int)(bytesPerPixel*width*height); // Total data size in bytes
+    // Check if the rect is even inside the image
+    if ((rec.x >= dst->width) || (rec.y >= dst->height)) return false;
+    if (((rec.x + rec.width) <= 0) || (rec.y + rec.height <= 0)) return false;
 
-    // Most compressed formats works on 4x4 blocks,
-    // if texture is smaller, minimum dataSize is 8 or 16
-    if ((width < 4) && (height < 4))
-    {
-        if ((format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) && (format < PIXELFORMAT_COMPRESSED_DXT3_RGBA)) dataSize = 8;
-        else if ((format >= PIXELFORMAT_COMPRESSED_DXT3_RGBA) && (format < PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA)) dataSize = 16;
-    }
+    area[0] = (int)rec.x;
+    area[1] = (int)rec.y;
+    area[2] = ((int)rec.width > 0)? (int)rec.width : 1;
+    area[3] = (((int)rec.width > 0) && ((int)rec.height > 0))? (int)rec.height : 1;
 
-    return dataSize;
+    return true;
 }
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
-// Convert half-float (stored as unsigned short) to float
-// REF: https://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion/60047308#60047308
-static float HalfToFloat(unsigned short x)
+// Add drawing command to image canvas, NULL if image is not the canvas image
+// NOTE: Command color is converted to image format, bounds are clipped to image on rasterization
+static ImageCanvasCommand *AddImageCanvasCommand(const rl_Image *dst, int type, rl_Color color)
 {
-    float result = 0.0f;
+    if ((imageCanvas.image == NULL) || (dst->data != imageCanvas.image->data)) return NULL;
 
-    union {
-        float fm;
-        unsigned int ui;
-    } uni;
+    if (imageCanvas.count == imageCanvas.capacity)
+    {
+        int capacity = (imageCanvas.capacity == 0)? 256 : imageCanvas.capacity*2;
+        ImageCanvasCommand *commands = (ImageCanvasCommand *)RL_REALLOC(imageCanvas.commands, capacity*sizeof(ImageCanvasCommand));
 
-    const unsigned int e = (x & 0x7c00) >> 10; // Exponent
-    const unsigned int m = (x & 0x03ff) << 13; // Mantissa
-    uni.fm = (float)m;
-    const unsigned int v = uni.ui >> 23; // Evil log2 bit hack to count leading zeros in denormalized format
-    uni.ui = (x & 0x8000) << 16 | (e != 0)*((e + 112) << 23 | m) | ((e == 0)&(m != 0))*((v - 37) << 23 | ((m << (150 - v)) & 0x007fe000)); // sign : normalized : denormalized
+        if (commands != NULL)
+        {
+            imageCanvas.commands = commands;
+            imageCanvas.capacity = capacity;
+        }
+        else
+        {
+            // Out of memory, recorded commands are rasterized to record new ones
+            TRACELOG(LOG_WARNING, "IMAGE: Failed to grow canvas commands, rasterizing recorded commands");
+            FlushImageCanvas();
 
-    result = uni.fm;
+            // Drawing is done immediately if no command can be recorded
+            if (imageCanvas.capacity == 0) return NULL;
+        }
+    }
 
-    return result;
+    ImageCanvasCommand *command = &imageCanvas.commands[imageCanvas.count++];
+    memset(command, 0, sizeof(ImageCanvasCommand));
+    command->type = type;
+    command->colors[0] = color;
+
+    // Convert color to image format once, pixels are copied while rasterizing
+    rl_Image pixel = { command->pixel, 1, 1, 1, dst->format };
+    rl_ImageDrawPixel(&pixel, 0, 0, color);
+
+    return command;
 }
 
-// Convert float to half-float (stored as unsigned short)
-static unsigned short FloatToHalf(float x)
+// Rasterize recorded image canvas commands by tiles, tiles are processed by worker threads
+// NOTE: Commands are binned to the tiles they overlap, every tile draws its commands in recording order
+static void FlushImageCanvas(void)
 {
-    unsigned short result = 0;
+    rl_Image *image = imageCanvas.image;
+    if ((image == NULL) || (imageCanvas.count == 0)) return;
 
-    union {
-        float fm;
-        unsigned int ui;
-    } uni;
-    uni.fm = x;
+    int tilesX = (image->width + IMAGE_CANVAS_TILE_SIZE - 1)/IMAGE_CANVAS_TILE_SIZE;
+    int tilesY = (image->height + IMAGE_CANVAS_TILE_SIZE - 1)/IMAGE_CANVAS_TILE_SIZE;
+    int tileCount = tilesX*tilesY;
+    int *tileStarts = (int *)RL_CALLOC(tileCount + 1, sizeof(int));
 
-    const unsigned int b = uni.ui + 0x00001000; // Round-to-nearest-even: add last bit after truncated mantissa
-    const unsigned int e = (b & 0x7f800000) >> 23; // Exponent
-    const unsigned int m = b & 0x007fffff; // Mantissa; in line below: 0x007ff000 = 0x00800000-0x00001000 = decimal indicator flag - initial rounding
+    // Count commands overlapping every tile, bounds clipped to image
+    for (int i = 0; i < imageCanvas.count; i++)
+    {
+        ImageCanvasCommand *command = &imageCanvas.commands[i];
 
-    result = (b & 0x80000000) >> 16 | (e > 112)*((((e - 112) << 10) & 0x7c00) | m >> 13) | ((e < 113) & (e > 101))*((((0x007ff000 + m) >> (125 - e)) + 1) >> 1) | (e > 143)*0x7fff; // sign : normalized : denormalized : saturate
+        if (command->xMin < 0) command->xMin = 0;
+        if (command->yMin < 0) command->yMin = 0;
+        if (command->xMax >= image->width) command->xMax = image->width - 1;
+        if (command->yMax >= image->height) command->yMax = image->height - 1;
+        if ((command->xMin > command->xMax) || (command->yMin > command->yMax)) continue;
 
-    return result;
-}
+        SetImageAreaDirty(image, command->xMin, command->yMin, command->xMax - command->xMin + 1, command->yMax - command->yMin + 1);
 
-// Get pixel data from image as rl_Vector4 array (float normalized)
-static rl_Vector4 *LoadImageDataNormalized(rl_Image image)
-{
-    rl_Vector4 *pixels = (rl_Vector4 *)RL_MALLOC(image.width*image.height*sizeof(rl_Vector4));
+        for (int ty = command->yMin/IMAGE_CANVAS_TILE_SIZE; ty <= command->yMax/IMAGE_CANVAS_TILE_SIZE; ty++)
+        {
+            for (int tx = command->xMin/IMAGE_CANVAS_TILE_SIZE; tx <= command->xMax/IMAGE_CANVAS_TILE_SIZE; tx++) tileStarts[ty*tilesX + tx + 1]++;
+        }
+    }
 
-    if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) TRACELOG(LOG_WARNING, "IMAGE: Pixel data retrieval not supported for compressed image formats");
-    else
+    for (int t = 0; t < tileCount; t++) tileStarts[t + 1] += tileStarts[t];
+
+    // Bin commands indices, in recording order for every tile
+    int *tileCommands = (int *)RL_MALLOC(((tileStarts[tileCount] > 0)? tileStarts[tileCount] : 1)*sizeof(int));
+    int *tileCursors = (int *)RL_MALLOC(tileCount*sizeof(int));
+    memcpy(tileCursors, tileStarts, tileCount*sizeof(int));
+
+    for (int i = 0; i < imageCanvas.count; i++)
     {
-        for (int i = 0, k = 0; i < image.width*image.height; i++)
+        const ImageCanvasCommand *command = &imageCanvas.commands[i];
+        if ((command->xMin > command->xMax) || (command->yMin > command->yMax)) continue;
+
+        for (int ty = command->yMin/IMAGE_CANVAS_TILE_SIZE; ty <= command->yMax/IMAGE_CANVAS_TILE_SIZE; ty++)
         {
-            switch (image.format)
-            {
-                case PIXELFORMAT_UNCOMPRESSED_GRAYSCALE:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[i]/255.0f;
-                    pixels[i].w = 1.0f;
+            for (int tx = command->xMin/IMAGE_CANVAS_TILE_SIZE; tx <= command->xMax/IMAGE_CANVAS_TILE_SIZE; tx++) tileCommands[tileCursors[ty*tilesX + tx]++] = i;
+        }
+    }
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 1]/255.0f;
+    ImageCanvasJob canvas = { 0 };
+    canvas.image = image;
+    canvas.commands = imageCanvas.commands;
+    canvas.tileStarts = tileStarts;
+    canvas.tileCommands = tileCommands;
+    canvas.tilesX = tilesX;
+    canvas.bytesPerPixel = rl_GetPixelDataSize(1, 1, image->format);
 
-                    k += 2;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    // Canvas is detached while rasterizing, pixels drawn by tiles are not recorded
+    imageCanvas.image = NULL;
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111000000) >> 6)*(1.0f/31);
-                    pixels[i].z = (float)((pixel & 0b0000000000111110) >> 1)*(1.0f/31);
-                    pixels[i].w = ((pixel & 0b0000000000000001) == 0)? 0.0f : 1.0f;
+    WorkerJob job = { ProcessImageCanvasRange, &canvas, tileCount, 1 };
+    RunWorkerJob(&job);
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+    imageCanvas.image = image;
+    imageCanvas.count = 0;
 
-                    pixels[i].x = (float)((pixel & 0b1111100000000000) >> 11)*(1.0f/31);
-                    pixels[i].y = (float)((pixel & 0b0000011111100000) >> 5)*(1.0f/63);
-                    pixels[i].z = (float)(pixel & 0b0000000000011111)*(1.0f/31);
-                    pixels[i].w = 1.0f;
+    RL_FREE(tileCursors);
+    RL_FREE(tileCommands);
+    RL_FREE(tileStarts);
+}
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
-                {
-                    unsigned short pixel = ((unsigned short *)image.data)[i];
+// Fill image area with pixel value, area bounds inclusive
+// NOTE: Pixel value is already converted to image format, usual pixel sizes are copied as integers
+static void FillImageCanvasArea(rl_Image *image, int xMin, int yMin, int xMax, int yMax, const unsigned char *pixel, int bytesPerPixel)
+{
+    if ((xMin > xMax) || (yMin > yMax)) return;
 
-                    pixels[i].x = (float)((pixel & 0b1111000000000000) >> 12)*(1.0f/15);
-                    pixels[i].y = (float)((pixel & 0b0000111100000000) >> 8)*(1.0f/15);
-                    pixels[i].z = (float)((pixel & 0b0000000011110000) >> 4)*(1.0f/15);
-                    pixels[i].w = (float)(pixel & 0b0000000000001111)*(1.0f/15);
+    int count = xMax - xMin + 1;
 
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8A8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = (float)((unsigned char *)image.data)[k + 3]/255.0f;
+    for (int y = yMin; y <= yMax; y++)
+    {
+        unsigned char *dst = (unsigned char *)image->data + ((size_t)y*image->width + xMin)*bytesPerPixel;
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R8G8B8:
-                {
-                    pixels[i].x = (float)((unsigned char *)image.data)[k]/255.0f;
-                    pixels[i].y = (float)((unsigned char *)image.data)[k + 1]/255.0f;
-                    pixels[i].z = (float)((unsigned char *)image.data)[k + 2]/255.0f;
-                    pixels[i].w = 1.0f;
+        switch (bytesPerPixel)
+        {
+            case 1: memset(dst, pixel[0], count); break;
+            case 2:
+            {
+                unsigned short value = 0;
+                memcpy(&value, pixel, 2);
+                for (int i = 0; i < count; i++) ((unsigned short *)dst)[i] = value;
+            } break;
+            case 4:
+            {
+                unsigned int value = 0;
+                memcpy(&value, pixel, 4);
+                for (int i = 0; i < count; i++) ((unsigned int *)dst)[i] = value;
+            } break;
+            default:
+            {
+                for (int i = 0; i < count; i++) memcpy(dst + i*bytesPerPixel, pixel, bytesPerPixel);
+            } break;
+        }
+    }
+}
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+// Process image canvas tiles range on current thread
+// NOTE: Primitives are rasterized as spans clipped to tile, pixels match immediate image drawing functions
+static void ProcessImageCanvasRange(const void *data, int start, int end)
+{
+    const ImageCanvasJob *canvas = (const ImageCanvasJob *)data;
+    rl_Image *image = canvas->image;
+    int bytesPerPixel = canvas->bytesPerPixel;
 
-                    k += 1;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = 1.0f;
+    for (int t = start; t < end; t++)
+    {
+        int tileXMin = (t%canvas->tilesX)*IMAGE_CANVAS_TILE_SIZE;
+        int tileYMin = (t/canvas->tilesX)*IMAGE_CANVAS_TILE_SIZE;
+        int tileXMax = ((tileXMin + IMAGE_CANVAS_TILE_SIZE) < image->width)? (tileXMin + IMAGE_CANVAS_TILE_SIZE - 1) : (image->width - 1);
+        int tileYMax = ((tileYMin + IMAGE_CANVAS_TILE_SIZE) < image->height)? (tileYMin + IMAGE_CANVAS_TILE_SIZE - 1) : (image->height - 1);
 
-                    k += 3;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R32G32B32A32:
-                {
-                    pixels[i].x = ((float *)image.data)[k];
-                    pixels[i].y = ((float *)image.data)[k + 1];
-                    pixels[i].z = ((float *)image.data)[k + 2];
-                    pixels[i].w = ((float *)image.data)[k + 3];
+        for (int i = canvas->tileStarts[t]; i < canvas->tileStarts[t + 1]; i++)
+        {
+            const ImageCanvasCommand *command = &canvas->commands[canvas->tileCommands[i]];
+            const int *values = command->values;
 
-                    k += 4;
-                } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16:
+            // Command bounds clipped to tile
+            int xMin = (command->xMin > tileXMin)? command->xMin : tileXMin;
+            int yMin = (command->yMin > tileYMin)? command->yMin : tileYMin;
+            int xMax = (command->xMax < tileXMax)? command->xMax : tileXMax;
+            int yMax = (command->yMax < tileYMax)? command->yMax : tileYMax;
+
+            switch (command->type)
+            {
+                case IMAGE_CANVAS_RECTANGLE: FillImageCanvasArea(image, xMin, yMin, xMax, yMax, command->pixel, bytesPerPixel); break;
+                case IMAGE_CANVAS_LINE:
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = 0.0f;
-                    pixels[i].z = 0.0f;
-                    pixels[i].w = 1.0f;
+                    // Line values: start x, start y, steps count, step sign, minor axis increment (16.16 fixed point), y major axis
+                    bool yLonger = (values[5] != 0);
+                    int majorStart = yLonger? values[1] : values[0];
+                    int minorStart = yLonger? values[0] : values[1];
+                    int majorMin = yLonger? yMin : xMin;
+                    int majorMax = yLonger? yMax : xMax;
+                    int minorMin = yLonger? xMin : yMin;
+                    int minorMax = yLonger? xMax : yMax;
+
+                    // Steps range along major axis within tile
+                    int first = (values[3] > 0)? (majorMin - majorStart) : (majorStart - majorMax);
+                    int last = (values[3] > 0)? (majorMax - majorStart) : (majorStart - majorMin);
+                    if (first < 0) first = 0;
+                    if (last > (values[2] - 1)) last = values[2] - 1;
+
+                    for (int k = first; k <= last; k++)
+                    {
+                        int minor = minorStart + (int)(((long long)k*values[4]) >> 16);
+                        if ((minor < minorMin) || (minor > minorMax)) continue;
 
-                    k += 1;
+                        int major = majorStart + k*values[3];
+                        if (yLonger) FillImageCanvasArea(image, minor, major, minor, major, command->pixel, bytesPerPixel);
+                        else FillImageCanvasArea(image, major, minor, major, minor, command->pixel, bytesPerPixel);
+                    }
                 } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16:
+                case IMAGE_CANVAS_CIRCLE:
+                case IMAGE_CANVAS_CIRCLE_LINES:
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = 1.0f;
+                    // Midpoint circle, circle values: center x, center y, radius
+                    int centerX = values[0];
+                    int centerY = values[1];
+                    int x = 0;
+                    int y = values[2];
+                    int decesionParameter = 3 - 2*values[2];
+
+                    while (y >= x)
+                    {
+                        if (command->type == IMAGE_CANVAS_CIRCLE)
+                        {
+                            // Same spans as rl_ImageDrawCircle() rectangles
+                            rl_Rectangle spans[4] = {
+                                { (float)(centerX - x), (float)(centerY + y), (float)(x*2), 1 },
+                                { (float)(centerX - x), (float)(centerY - y), (float)(x*2), 1 },
+                                { (float)(centerX - y), (float)(centerY + x), (float)(y*2), 1 },
+                                { (float)(centerX - y), (float)(centerY - x), (float)(y*2), 1 }
+                            };
+
+                            for (int s = 0; s < 4; s++)
+                            {
+                                int area[4] = { 0 };
+                                if (((int)spans[s].y < yMin) || ((int)spans[s].y > yMax) || !GetImageRectangleArea(image, spans[s], area)) continue;
+
+                                int spanMin = (area[0] > xMin)? area[0] : xMin;
+                                int spanMax = ((area[0] + area[2] - 1) < xMax)? (area[0] + area[2] - 1) : xMax;
+                                FillImageCanvasArea(image, spanMin, area[1], spanMax, area[1], command->pixel, bytesPerPixel);
+                            }
+                        }
+                        else
+                        {
+                            int points[8][2] = {
+                                { centerX + x, centerY + y }, { centerX - x, centerY + y }, { centerX + x, centerY - y }, { centerX - x, centerY - y },
+                                { centerX + y, centerY + x }, { centerX - y, centerY + x }, { centerX + y, centerY - x }, { centerX - y, centerY - x }
+                            };
+
+                            for (int p = 0; p < 8; p++)
+                            {
+                                if ((points[p][0] >= xMin) && (points[p][0] <= xMax) && (points[p][1] >= yMin) && (points[p][1] <= yMax))
+                                {
+                                    FillImageCanvasArea(image, points[p][0], points[p][1], points[p][0], points[p][1], command->pixel, bytesPerPixel);
+                                }
+                            }
+                        }
 
-                    k += 3;
+                        x++;
+
+                        if (decesionParameter > 0)
+                        {
+                            y--;
+                            decesionParameter = decesionParameter + 4*(x - y) + 10;
+                        }
+                        else decesionParameter = decesionParameter + 4*x + 6;
+                    }
                 } break;
-                case PIXELFORMAT_UNCOMPRESSED_R16G16B16A16:
+                case IMAGE_CANVAS_TRIANGLE:
+                case IMAGE_CANVAS_TRIANGLE_COLORS:
                 {
-                    pixels[i].x = HalfToFloat(((unsigned short *)image.data)[k]);
-                    pixels[i].y = HalfToFloat(((unsigned short *)image.data)[k + 1]);
-                    pixels[i].z = HalfToFloat(((unsigned short *)image.data)[k + 2]);
-                    pixels[i].w = HalfToFloat(((unsigned short *)image.data)[k + 3]);
+                    // Triangle values: barycentric coordinates at origin, x and y steps per coordinate, origin x, origin y
+                    for (int y = yMin; y <= yMax; y++)
+                    {
+                        int w[3] = { 0 };
+                        int first = xMin;
+                        int last = xMax;
 
-                    k += 4;
+                        // Pixels with all barycentric coordinates positive form a single span of the row
+                        for (int e = 0; e < 3; e++)
+                        {
+                            int xStep = values[3 + e*2];
+                            w[e] = values[e] + (xMin - values[9])*xStep + (y - values[10])*values[4 + e*2];
+
+                            if (xStep > 0)
+                            {
+                                int edge = (w[e] < 0)? (xMin + (-w[e] + xStep - 1)/xStep) : xMin;
+                                if (edge > first) first = edge;
+                            }
+                            else if (xStep < 0)
+                            {
+                                int edge = (w[e] < 0)? (xMin - 1) : (xMin + w[e]/(-xStep));
+                                if (edge < last) last = edge;
+                            }
+                            else if (w[e] < 0) last = xMin - 1;
+                        }
+
+                        if (first > last) continue;
+
+                        if (command->type == IMAGE_CANVAS_TRIANGLE) FillImageCanvasArea(image, first, y, last, y, command->pixel, bytesPerPixel);
+                        else
+                        {
+                            // Interpolated colors, same as rl_ImageDrawTriangleEx()
+                            for (int x = first; x <= last; x++)
+                            {
+                                unsigned char aW1 = (unsigned char)((float)(w[0] + (x - xMin)*values[3])*command->invSum);
+                                unsigned char aW2 = (unsigned char)((float)(w[1] + (x - xMin)*values[5])*command->invSum);
+                                unsigned char aW3 = (unsigned char)((float)(w[2] + (x - xMin)*values[7])*command->invSum);
+
+                                const rl_Color *c = command->colors;
+                                rl_Color finalColor = { 0 };
+                                finalColor.r = (c[0].r*aW1 + c[1].r*aW2 + c[2].r*aW3)/255;
+                                finalColor.g = (c[0].g*aW1 + c[1].g*aW2 + c[2].g*aW3)/255;
+                                finalColor.b = (c[0].b*aW1 + c[1].b*aW2 + c[2].b*aW3)/255;
+                                finalColor.a = (c[0].a*aW1 + c[1].a*aW2 + c[2].a*aW3)/255;
+
+                                rl_ImageDrawPixel(image, x, y, finalColor);
+                            }
+                        }
+                    }
                 } break;
                 default: break;
             }
         }
     }
-
-    return pixels;
 }
 
 #endif      // SUPPORT_MODULE_RTEXTURES
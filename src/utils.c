@@ -36,6 +36,7 @@
     #include "config.h"                 // Defines module configuration flags
 #endif
 
+#define RL_MEMORY_MODULE MEMORY_MODULE_UTILS     // Memory tracking allocations module
 #include "utils.h"
 
 #if defined(PLATFORM_ANDROID)
@@ -47,7 +48,79 @@
 #include <stdlib.h>                     // Required for: exit()
 #include <stdio.h>                      // Required for: FILE, fopen(), fseek(), ftell(), fread(), fwrite(), fprintf(), vprintf(), fclose()
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
-#include <string.h>                     // Required for: strcpy(), strcat()
+#include <string.h>                     // Required for: strcpy(), strcat(), memset(), memcpy()
+#include <limits.h>                     // Required for: UINT_MAX
+
+// File I/O worker threads are only supported with POSIX threads
+#if defined(SUPPORT_FILE_IO_THREADS)
+    #if defined(PLATFORM_WEB) || (defined(_WIN32) && !defined(__MINGW32__))
+        #undef SUPPORT_FILE_IO_THREADS
+    #endif
+#endif
+#if defined(SUPPORT_FILE_IO_THREADS)
+    #include <pthread.h>                // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*()
+#endif
+
+// Job system worker threads are only supported with POSIX threads
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+    #if defined(PLATFORM_WEB) || (defined(_WIN32) && !defined(__MINGW32__))
+        #undef SUPPORT_JOB_WORKER_THREADS
+    #endif
+#endif
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+    #include <pthread.h>                // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*(), pthread_key_create()
+    #include <unistd.h>                 // Required for: sysconf() [Used in StartJobWorkers()]
+    #define JOBS_LOCK()             pthread_mutex_lock(&jobsLock)
+    #define JOBS_UNLOCK()           pthread_mutex_unlock(&jobsLock)
+#else
+    #define JOBS_LOCK()             (void)0
+    #define JOBS_UNLOCK()           (void)0
+#endif
+
+// Tagged memory stats are protected by a mutex and frame arenas are per thread when POSIX threads are available
+#if !defined(PLATFORM_WEB) && !(defined(_WIN32) && !defined(__MINGW32__))
+    #include <pthread.h>                // Required for: pthread_mutex_*(), pthread_key_create(), pthread_getspecific(), pthread_setspecific()
+    #define SUPPORT_MEMORY_THREADS
+    #define MEMORY_LOCK(mutex)      pthread_mutex_lock(&mutex)
+    #define MEMORY_UNLOCK(mutex)    pthread_mutex_unlock(&mutex)
+#else
+    #define MEMORY_LOCK(mutex)      (void)0
+    #define MEMORY_UNLOCK(mutex)    (void)0
+#endif
+
+// CPU profiler zones are recorded per thread (thread local storage), threads buffers list is protected by a mutex
+#if defined(SUPPORT_CPU_PROFILER)
+    #if defined(_MSC_VER)
+        #define PROFILER_THREAD_LOCAL __declspec(thread)
+    #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_THREADS__)
+        #define PROFILER_THREAD_LOCAL _Thread_local
+    #else
+        #define PROFILER_THREAD_LOCAL __thread
+    #endif
+    #if defined(SUPPORT_MEMORY_THREADS)
+        #define PROFILER_LOCK()     pthread_mutex_lock(&profilerLock)
+        #define PROFILER_UNLOCK()   pthread_mutex_unlock(&profilerLock)
+    #else
+        #define PROFILER_LOCK()     (void)0
+        #define PROFILER_UNLOCK()   (void)0
+    #endif
+#endif
+
+// Packed archives are memory mapped on POSIX systems
+#if defined(SUPPORT_FILE_ARCHIVES)
+    #if (defined(__unix__) || defined(__APPLE__)) && !defined(PLATFORM_WEB) && !defined(PLATFORM_ANDROID)
+        #include <sys/mman.h>           // Required for: mmap(), munmap() [Used in rl_MountArchive()]
+        #include <sys/stat.h>           // Required for: fstat() [Used in rl_MountArchive()]
+        #include <fcntl.h>              // Required for: open() [Used in rl_MountArchive()]
+        #include <unistd.h>             // Required for: close() [Used in rl_MountArchive()]
+        #define SUPPORT_ARCHIVE_MAPPING
+    #endif
+    #if defined(SUPPORT_COMPRESSION_API)
+        #include "external/sinfl.h"     // Required for: sinflate() [Used in LoadArchiveFile()]
+        #include "external/sdefl.h"     // Required for: sdeflate() [Used in rl_ExportArchive()]
+                                        // NOTE: Implementation is compiled by rcore module
+    #endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Defines and Macros
@@ -55,6 +128,153 @@
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_FILE_IO_THREADS
+    #define MAX_FILE_IO_THREADS           2         // Max number of file I/O worker threads (async file requests)
+#endif
+#ifndef MAX_JOB_WORKER_THREADS
+    #define MAX_JOB_WORKER_THREADS        8         // Max number of job system worker threads (one per additional processor by default)
+#endif
+#ifndef MAX_MOUNTED_ARCHIVES
+    #define MAX_MOUNTED_ARCHIVES          8         // Max number of packed archives mounted at the same time
+#endif
+#ifndef MAX_FILEPATH_LENGTH
+    #define MAX_FILEPATH_LENGTH        4096         // Maximum length for filepaths
+#endif
+#ifndef CPU_PROFILER_MAX_ZONES
+    #define CPU_PROFILER_MAX_ZONES    16384         // Max zones recorded per thread, oldest zones are overwritten (SUPPORT_CPU_PROFILER)
+#endif
+#ifndef MEMORY_FRAME_ARENA_SIZE
+    #define MEMORY_FRAME_ARENA_SIZE  (256*1024)     // Frame arena initial size (in bytes), grows to the largest frame usage
+#endif
+#ifndef MEMORY_FRAME_ARENA_MAX_SIZE
+    #define MEMORY_FRAME_ARENA_MAX_SIZE (16*1024*1024) // Frame arena maximum size (in bytes), usage over it served from overflow blocks
+#endif
+
+#define MAX_MEMORY_MODULES                8         // Memory modules tracked (rl_MemoryModule)
+#define MAX_MEMORY_PURPOSES               3         // Memory purposes tracked (rl_MemoryPurpose)
+#define MEMORY_HEADER_MAGIC      0x4d454d54         // Tagged allocation header identifier ("TMEM")
+#define MEMORY_ARENA_ALIGNMENT           16         // Frame arena allocations alignment (in bytes)
+
+#define CPU_PROFILER_MAX_DEPTH           32         // Max nested zones open per thread, deeper zones are not recorded
+
+#define ARCHIVE_HEADER_SIZE              16         // Archive header size: id (4 bytes), version, entries count, index offset
+#define ARCHIVE_ENTRY_SIZE               16         // Archive index entry size, entry name follows: offset, size, packed size, compression, name length
+#define ARCHIVE_COMPRESSION_NONE          0         // Archive entry data stored
+#define ARCHIVE_COMPRESSION_DEFLATE       1         // Archive entry data compressed (DEFLATE)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Async file request, read or written on a file I/O worker thread
+struct rl_FileRequest {
+    char *fileName;                 // File name (copied)
+    unsigned char *data;            // File data: loaded data or data to save (copied)
+    int dataSize;                   // File data size in bytes
+    bool save;                      // Request type: save data (write) or load data (read)
+    bool success;                   // Request result
+    bool done;                      // Request completed (protected by workers mutex)
+    struct rl_FileRequest *next;    // Next request in queue
+};
+
+// Job, single function or range processed in chunks by job worker threads
+struct rl_Job {
+    JobCallback process;            // Job function (single job)
+    JobRangeCallback processRange;  // Job range function (parallel job)
+    void *userData;                 // Job functions user data
+    int count;                      // Range size (1 for single job)
+    int chunkSize;                  // Range processed by a thread at once
+    int chunkCount;                 // Range chunks count
+    int nextChunk;                  // Next chunk to process
+    int pendingChunks;              // Chunks not completed yet
+    int pendingDependencies;        // Dependencies jobs not completed yet
+    int refCount;                   // References: handle, scheduler (until completed), queue and completed queue
+    bool completed;                 // Job completed, all chunks processed
+    bool callbackQueued;            // Job in completed queue, callback pending
+    JobCallback completedCallback;  // Completed callback, called by rl_UpdateJobs()
+    void *completedUserData;        // Completed callback user data
+    struct JobLink *dependents;     // Jobs depending on this job
+    struct rl_Job *prev;            // Previous job in queue
+    struct rl_Job *next;            // Next job in queue (or unused jobs list)
+    struct rl_Job *completedNext;   // Next job in completed queue
+};
+
+// Job dependency link, dependent job is queued once all its dependencies are completed
+typedef struct JobLink {
+    rl_Job *job;                    // Dependent job
+    struct JobLink *next;           // Next link (job dependents or unused links list)
+} JobLink;
+
+// Jobs queue, oldest job first
+typedef struct JobQueue {
+    rl_Job *first;                  // Oldest job (stolen by other threads)
+    rl_Job *last;                   // Newest job (taken by queue thread)
+} JobQueue;
+
+// Frame arena, temporary allocations released on frame start
+// NOTE: Allocations not fitting arena are served from overflow blocks, arena grows on reset to fit them
+typedef struct FrameArena {
+    unsigned char *data;            // Arena memory (allocated on first use)
+    unsigned int size;              // Arena memory size
+    unsigned int offset;            // Arena memory used
+    unsigned char *overflow;        // Overflow blocks list, last allocated first
+    unsigned int overflowSize;      // Overflow blocks allocations size
+    unsigned int peakSize;          // Maximum arena usage, including overflow blocks
+} FrameArena;
+
+// Tagged allocation header, precedes every tagged allocation
+// NOTE: Header size is 16 bytes, allocations keep allocator alignment
+typedef struct MemoryHeader {
+    unsigned long long size;        // Allocation size (without header)
+    unsigned short module;          // Allocation module (rl_MemoryModule)
+    unsigned short purpose;         // Allocation purpose (rl_MemoryPurpose)
+    unsigned int magic;             // Header identifier, cleared on free
+} MemoryHeader;
+
+#if defined(SUPPORT_FILE_ARCHIVES)
+// Packed archive entry, name points to archive index data (not '\0' terminated)
+typedef struct ArchiveEntry {
+    const char *name;               // Entry name, path relative to archive root
+    unsigned int nameLength;        // Entry name length
+    unsigned int hash;              // Entry name hash
+    unsigned int offset;            // Entry data offset in archive
+    unsigned int size;              // Entry data size (uncompressed)
+    unsigned int packedSize;        // Entry data size in archive
+    unsigned int compression;       // Entry data compression (ARCHIVE_COMPRESSION_*)
+} ArchiveEntry;
+
+// Packed archive mounted, entries looked up by name hash
+typedef struct Archive {
+    char *fileName;                 // Archive file name (copied)
+    char *mountPath;                // Mount path, normalized with trailing '/' ("" for root)
+    unsigned char *data;            // Archive data (mapped or loaded)
+    int dataSize;                   // Archive data size
+    bool mapped;                    // Archive data is memory mapped
+    ArchiveEntry *entries;          // Archive entries
+    int entryCount;                 // Archive entries count
+    int *table;                     // Entries hash table (open addressing), -1 for empty slots
+    int tableSize;                  // Entries hash table size (power of two)
+} Archive;
+#endif
+
+#if defined(SUPPORT_CPU_PROFILER)
+// CPU profiler zone, recorded when zone ends
+typedef struct ProfileZone {
+    const char *name;               // Zone name (not copied)
+    double start;                   // Zone start time (seconds, rl_GetTime())
+    double duration;                // Zone duration (seconds)
+} ProfileZone;
+
+// CPU profiler thread zones, ring buffer written only by its thread
+typedef struct ProfileThread {
+    ProfileZone *zones;             // Recorded zones ring buffer (CPU_PROFILER_MAX_ZONES)
+    unsigned int count;             // Zones recorded since reset, next zone written at count%CPU_PROFILER_MAX_ZONES
+    const char *openNames[CPU_PROFILER_MAX_DEPTH]; // Open zones names
+    double openStarts[CPU_PROFILER_MAX_DEPTH]; // Open zones start times
+    int depth;                      // Open zones count (including zones over CPU_PROFILER_MAX_DEPTH)
+    int id;                         // Thread id in exported trace (registration order, main thread usually first)
+    struct ProfileThread *next;     // Next registered thread
+} ProfileThread;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -67,6 +287,80 @@ static SaveFileDataCallback saveFileData = NULL;    // rl_SaveFileText callback
 static LoadFileTextCallback loadFileText = NULL;    // rl_LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // rl_SaveFileText callback function pointer
 
+static MemAllocCallback memAlloc = NULL;            // Tagged memory allocator callback function pointer
+static MemReallocCallback memRealloc = NULL;        // Tagged memory reallocator callback function pointer
+static MemFreeCallback memFree = NULL;              // Tagged memory free callback function pointer
+
+// Tagged memory stats by module and purpose, last module/purpose entries accumulate all modules/purposes
+static rl_MemoryStats memoryStats[MAX_MEMORY_MODULES + 1][MAX_MEMORY_PURPOSES + 1] = { 0 };
+
+#if defined(SUPPORT_MEMORY_THREADS)
+static pthread_mutex_t memoryStatsLock = PTHREAD_MUTEX_INITIALIZER;     // Tagged memory stats mutex
+static pthread_once_t frameArenaKeyOnce = PTHREAD_ONCE_INIT;           // Frame arenas thread key initialization
+static pthread_key_t frameArenaKey;                                     // Frame arena of current thread
+#else
+static FrameArena frameArena = { 0 };                                   // Frame arena, single thread
+#endif
+
+#if defined(SUPPORT_FILE_IO_THREADS)
+// File I/O worker threads, requests queue processed in order
+static struct {
+    bool ready;                     // Worker threads initialized
+    bool quit;                      // Worker threads exit request
+    int threadCount;                // Worker threads created
+    pthread_t threads[MAX_FILE_IO_THREADS]; // Worker threads handles
+    rl_FileRequest *first;          // Queued requests head
+    rl_FileRequest *last;           // Queued requests tail
+} fileWorkers = { 0 };
+
+static pthread_mutex_t fileWorkersLock = PTHREAD_MUTEX_INITIALIZER;     // File workers queue and requests state mutex
+static pthread_cond_t fileWorkersCond = PTHREAD_COND_INITIALIZER;       // Signaled when a request is queued (or on exit)
+static pthread_cond_t fileWorkersDoneCond = PTHREAD_COND_INITIALIZER;   // Signaled when a request is completed
+#endif
+
+// Job system, one jobs queue per worker thread plus one for non-worker threads, idle workers steal jobs
+static struct {
+    bool ready;                     // Worker threads initialized
+    bool quit;                      // Worker threads exit request (once queues are empty)
+    int threadCount;                // Worker threads created
+    int sleeping;                   // Worker threads waiting for jobs
+    int waiting;                    // Threads waiting for jobs completion
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+    pthread_t threads[MAX_JOB_WORKER_THREADS];  // Worker threads handles
+#endif
+    JobQueue queues[MAX_JOB_WORKER_THREADS + 1]; // Jobs queues: non-worker threads queue, then one per worker
+    rl_Job *completedFirst;         // Completed jobs with callback pending, first
+    rl_Job *completedLast;          // Completed jobs with callback pending, last
+    rl_Job *freeJobs;               // Unused jobs, reused by new jobs
+    JobLink *freeLinks;             // Unused dependency links
+} jobs = { 0 };
+
+static int jobWorkerCount = -1;                                         // Job worker threads requested (-1: one per additional processor)
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+static pthread_mutex_t jobsLock = PTHREAD_MUTEX_INITIALIZER;            // Job system mutex, protects queues and jobs state
+static pthread_cond_t jobsCond = PTHREAD_COND_INITIALIZER;              // Signaled when a job is queued (or on exit)
+static pthread_cond_t jobsDoneCond = PTHREAD_COND_INITIALIZER;          // Signaled when a job is completed (or queued, for waiting threads)
+static pthread_once_t jobWorkerKeyOnce = PTHREAD_ONCE_INIT;             // Worker threads key initialization
+static pthread_key_t jobWorkerKey;                                      // Worker thread queue index
+#endif
+
+#if defined(SUPPORT_CPU_PROFILER)
+// CPU profiler threads, thread buffers are kept after threads exit (zones exported) until UnloadProfileZones()
+static ProfileThread *profileThreads = NULL;                            // Registered threads list
+static int profileThreadCount = 0;                                      // Registered threads count
+static unsigned int profileGeneration = 1;                              // Threads list generation, threads register again on change
+static PROFILER_THREAD_LOCAL ProfileThread *profileThread = NULL;       // Calling thread zones
+static PROFILER_THREAD_LOCAL unsigned int profileThreadGeneration = 0;  // Generation calling thread zones were registered on
+#if defined(SUPPORT_MEMORY_THREADS)
+static pthread_mutex_t profilerLock = PTHREAD_MUTEX_INITIALIZER;        // CPU profiler threads list mutex
+#endif
+#endif
+
+#if defined(SUPPORT_FILE_ARCHIVES)
+static Archive archives[MAX_MOUNTED_ARCHIVES] = { 0 };  // Mounted archives, last mounted archives are looked up first
+static int archiveCount = 0;                            // Mounted archives count
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
@@ -94,6 +388,43 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+static void UpdateMemoryStats(int module, int purpose, long long bytes, int count); // Update tagged memory stats (module, purpose and accumulated entries)
+static FrameArena *GetFrameArena(bool create); // Get frame arena of calling thread (created on first use if requested)
+static void ReleaseFrameArena(FrameArena *arena, unsigned int offset, unsigned char *overflow); // Release frame arena allocations up to offset and overflow block
+static void UnloadFrameArena(void *arena); // Unload frame arena memory (also called on threads exit)
+
+#if defined(SUPPORT_CPU_PROFILER)
+static ProfileThread *GetProfileThread(void); // Get CPU profiler zones of calling thread (registered on first use)
+#endif
+
+static rl_FileRequest *QueueFileRequest(rl_FileRequest *request); // Queue file request for worker threads (completed on caller thread if not available)
+static void ProcessFileRequest(rl_FileRequest *request); // Process file request, load or save file data
+#if defined(SUPPORT_FILE_IO_THREADS)
+static void *FileWorkerThreadLoop(void *arg); // File I/O worker thread loop
+#endif
+static rl_Job *NewJob(void); // Get new job, taken from unused jobs if available (jobs mutex locked)
+static void SubmitJob(rl_Job *job, rl_Job *const *dependencies, int dependencyCount); // Submit job, queued if its dependencies are completed (jobs mutex locked)
+static void QueueJob(rl_Job *job); // Queue job on calling thread queue (jobs mutex locked)
+static void PushJob(JobQueue *queue, rl_Job *job); // Push job on queue top, idle workers are woken up (jobs mutex locked)
+static void UnlinkJob(JobQueue *queue, rl_Job *job); // Remove job from queue (jobs mutex locked)
+static bool RunJobChunk(void); // Take one queued job chunk and process it, false if no job is queued (jobs mutex locked)
+static void ProcessJobChunk(rl_Job *job); // Process next job chunk, completing job on last chunk (jobs mutex locked)
+static void CompleteJob(rl_Job *job); // Complete job, queue dependent jobs and completed callback (jobs mutex locked)
+static void QueueJobCallback(rl_Job *job); // Queue completed job callback for rl_UpdateJobs() (jobs mutex locked)
+static void ReleaseJobReference(rl_Job *job); // Release job reference, unreferenced job is kept for reuse (jobs mutex locked)
+static int GetJobQueueIndex(void); // Get calling thread jobs queue index (jobs mutex locked)
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+static void StartJobWorkers(void); // Create job worker threads (jobs mutex locked)
+static void InitJobWorkerKey(void); // Init job worker threads key
+static void *JobWorkerThreadLoop(void *arg); // Job worker thread loop
+#endif
+#if defined(SUPPORT_FILE_ARCHIVES)
+static unsigned int GetArchiveNameHash(const char *name, int length); // Get archive entry name hash (FNV-1a)
+static int NormalizeArchivePath(const char *fileName, char *path); // Normalize file path for archive lookup, returns path length
+static const ArchiveEntry *FindArchiveEntry(const char *fileName, const Archive **archive); // Find file entry in mounted archives
+static unsigned char *LoadArchiveFile(const Archive *archive, const ArchiveEntry *entry, int *dataSize, bool text); // Load archive entry data
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
@@ -160,14 +491,22 @@ void rl_TraceLog(int logType, const char *text, ...)
 // NOTE: Initializes to zero by default
 void *rl_MemAlloc(unsigned int size)
 {
+#if defined(SUPPORT_MEMORY_TRACKING)
+    void *ptr = MemAllocTracked(1, size, MEMORY_MODULE_USER, MEMORY_PURPOSE_GENERAL, true);
+#else
     void *ptr = RL_CALLOC(size, 1);
+#endif
     return ptr;
 }
 
 // Internal memory reallocator
 void *rl_MemRealloc(void *ptr, unsigned int size)
 {
+#if defined(SUPPORT_MEMORY_TRACKING)
+    void *ret = MemReallocTracked(ptr, size, MEMORY_MODULE_USER, MEMORY_PURPOSE_GENERAL);
+#else
     void *ret = RL_REALLOC(ptr, size);
+#endif
     return ret;
 }
 
@@ -177,19 +516,284 @@ void rl_MemFree(void *ptr)
     RL_FREE(ptr);
 }
 
+// Tagged memory allocator, tracked by module and purpose
+// NOTE: Initializes to zero by default, memory must be released with rl_MemFreeTagged()
+void *rl_MemAllocTagged(unsigned int size, int module, int purpose)
+{
+    return MemAllocTracked(1, size, module, purpose, true);
+}
+
+// Tagged memory reallocator, module and purpose only used if ptr is NULL
+void *rl_MemReallocTagged(void *ptr, unsigned int size, int module, int purpose)
+{
+    return MemReallocTracked(ptr, size, module, purpose);
+}
+
+// Tagged memory free
+// NOTE: Memory not allocated by tagged allocator is not released (detected by header identifier)
+void rl_MemFreeTagged(void *ptr)
+{
+    if (ptr == NULL) return;
+
+    MemoryHeader *header = (MemoryHeader *)ptr - 1;
+
+    if (header->magic != MEMORY_HEADER_MAGIC)
+    {
+        TRACELOG(LOG_WARNING, "MEMORY: Failed to free memory, not allocated by tagged allocator or already freed");
+        return;
+    }
+
+    int module = header->module;
+    int purpose = header->purpose;
+
+    header->magic = 0;
+    UpdateMemoryStats(module, purpose, -(long long)header->size, -1);
+
+    if (memFree != NULL) memFree(header, module, purpose);
+    else free(header);
+}
+
+// Tagged memory allocator, used by RL_MALLOC and RL_CALLOC on memory tracking
+// NOTE: Invalid module or purpose are tracked as MEMORY_MODULE_USER and MEMORY_PURPOSE_GENERAL
+void *MemAllocTracked(size_t count, size_t size, int module, int purpose, bool clear)
+{
+    if ((size > 0) && (count > (UINT_MAX - sizeof(MemoryHeader))/size)) return NULL;
+    if ((module < 0) || (module >= MAX_MEMORY_MODULES)) module = MEMORY_MODULE_USER;
+    if ((purpose < 0) || (purpose >= MAX_MEMORY_PURPOSES)) purpose = MEMORY_PURPOSE_GENERAL;
+
+    unsigned int dataSize = (unsigned int)(count*size);
+    MemoryHeader *header = NULL;
+
+    if (memAlloc != NULL) header = (MemoryHeader *)memAlloc(dataSize + sizeof(MemoryHeader), module, purpose);
+    else header = (MemoryHeader *)malloc(dataSize + sizeof(MemoryHeader));
+
+    if (header == NULL) return NULL;
+
+    header->size = dataSize;
+    header->module = (unsigned short)module;
+    header->purpose = (unsigned short)purpose;
+    header->magic = MEMORY_HEADER_MAGIC;
+
+    if (clear) memset(header + 1, 0, dataSize);
+
+    UpdateMemoryStats(module, purpose, dataSize, 1);
+
+    return header + 1;
+}
+
+// Tagged memory reallocator, used by RL_REALLOC on memory tracking
+// NOTE: Reallocated memory keeps its module and purpose, module and purpose only used if ptr is NULL
+void *MemReallocTracked(void *ptr, size_t size, int module, int purpose)
+{
+    if (ptr == NULL) return MemAllocTracked(1, size, module, purpose, false);
+    if (size > (UINT_MAX - sizeof(MemoryHeader))) return NULL;
+
+    MemoryHeader *header = (MemoryHeader *)ptr - 1;
+
+    if (header->magic != MEMORY_HEADER_MAGIC)
+    {
+        TRACELOG(LOG_WARNING, "MEMORY: Failed to reallocate memory, not allocated by tagged allocator or already freed");
+        return NULL;
+    }
+
+    module = header->module;
+    purpose = header->purpose;
+    long long previousSize = (long long)header->size;
+    MemoryHeader *result = NULL;
+
+    if (memRealloc != NULL) result = (MemoryHeader *)memRealloc(header, (unsigned int)size + sizeof(MemoryHeader), module, purpose);
+    else if (memAlloc != NULL)
+    {
+        // No reallocator provided, emulated with custom allocator
+        result = (MemoryHeader *)memAlloc((unsigned int)size + sizeof(MemoryHeader), module, purpose);
+
+        if (result != NULL)
+        {
+            memcpy(result, header, sizeof(MemoryHeader) + (size_t)((previousSize < (long long)size)? previousSize : (long long)size));
+            memFree(header, module, purpose);
+        }
+    }
+    else result = (MemoryHeader *)realloc(header, size + sizeof(MemoryHeader));
+
+    if (result == NULL) return NULL;
+
+    result->size = size;
+    UpdateMemoryStats(module, purpose, (long long)size - previousSize, 0);
+
+    return result + 1;
+}
+
+// Get tagged memory stats, use -1 module or purpose to accumulate all
+rl_MemoryStats rl_GetMemoryStats(int module, int purpose)
+{
+    rl_MemoryStats stats = { 0 };
+
+    if ((module < -1) || (module >= MAX_MEMORY_MODULES) || (purpose < -1) || (purpose >= MAX_MEMORY_PURPOSES)) return stats;
+    if (module == -1) module = MAX_MEMORY_MODULES;
+    if (purpose == -1) purpose = MAX_MEMORY_PURPOSES;
+
+    MEMORY_LOCK(memoryStatsLock);
+    stats = memoryStats[module][purpose];
+    MEMORY_UNLOCK(memoryStatsLock);
+
+    return stats;
+}
+
+// Set custom tagged memory allocator (NULL for default)
+// NOTE: Allocator and free callbacks are required together, reallocator is optional (emulated if not provided),
+// callbacks must be set before any tagged allocation, memory is released with the free callback set at release time
+void rl_SetMemoryCallbacks(MemAllocCallback allocCallback, MemReallocCallback reallocCallback, MemFreeCallback freeCallback)
+{
+    if ((allocCallback == NULL) != (freeCallback == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MEMORY: Failed to set memory callbacks, allocator and free callbacks required together");
+        return;
+    }
+
+    memAlloc = allocCallback;
+    memRealloc = (allocCallback != NULL)? reallocCallback : NULL;
+    memFree = freeCallback;
+}
+
+// Frame arena allocator, memory released on next frame start (rl_BeginDrawing() or rl_MemFrameReset())
+// NOTE: Memory is not initialized, allocations are 16 bytes aligned, every thread uses its own arena
+void *rl_MemFrameAlloc(unsigned int size)
+{
+    if (size > (UINT_MAX - 2*MEMORY_ARENA_ALIGNMENT)) return NULL;
+
+    FrameArena *arena = GetFrameArena(true);
+    if (arena == NULL) return NULL;
+
+    unsigned int alignedSize = (size + MEMORY_ARENA_ALIGNMENT - 1) & ~(unsigned int)(MEMORY_ARENA_ALIGNMENT - 1);
+    void *ptr = NULL;
+
+    if (arena->data == NULL)
+    {
+        if (arena->size == 0) arena->size = MEMORY_FRAME_ARENA_SIZE;
+        arena->data = (unsigned char *)MemAllocTracked(1, arena->size, MEMORY_MODULE_UTILS, MEMORY_PURPOSE_TEMPORARY, false);
+        arena->offset = 0;
+    }
+
+    if ((arena->data != NULL) && ((arena->size - arena->offset) >= alignedSize))
+    {
+        ptr = arena->data + arena->offset;
+        arena->offset += alignedSize;
+    }
+    else
+    {
+        // Arena full, allocation served from an overflow block until next reset
+        // NOTE: Block starts with next block pointer and block allocation size
+        unsigned char *block = (unsigned char *)MemAllocTracked(1, alignedSize + MEMORY_ARENA_ALIGNMENT, MEMORY_MODULE_UTILS, MEMORY_PURPOSE_TEMPORARY, false);
+
+        if (block != NULL)
+        {
+            *(unsigned char **)block = arena->overflow;
+            *(unsigned int *)(block + sizeof(unsigned char *)) = alignedSize;
+            arena->overflow = block;
+            arena->overflowSize += alignedSize;
+            ptr = block + MEMORY_ARENA_ALIGNMENT;
+        }
+    }
+
+    if ((arena->offset + arena->overflowSize) > arena->peakSize) arena->peakSize = arena->offset + arena->overflowSize;
+
+    return ptr;
+}
+
+// Release frame arena allocations of calling thread and start new frame memory stats, called by rl_BeginDrawing()
+// NOTE: If arena was exceeded, it is reallocated on next allocation to fit the largest usage (up to MEMORY_FRAME_ARENA_MAX_SIZE)
+void rl_MemFrameReset(void)
+{
+    FrameArena *arena = GetFrameArena(false);
+
+    if (arena != NULL)
+    {
+        ReleaseFrameArena(arena, 0, NULL);
+
+        unsigned int requiredSize = (arena->peakSize < MEMORY_FRAME_ARENA_MAX_SIZE)? arena->peakSize : MEMORY_FRAME_ARENA_MAX_SIZE;
+
+        if (requiredSize > arena->size)
+        {
+            rl_MemFreeTagged(arena->data);
+            arena->data = NULL;
+            arena->size = requiredSize;
+        }
+    }
+
+    MEMORY_LOCK(memoryStatsLock);
+    for (int m = 0; m <= MAX_MEMORY_MODULES; m++)
+    {
+        for (int p = 0; p <= MAX_MEMORY_PURPOSES; p++) memoryStats[m][p].frameCount = 0;
+    }
+    MEMORY_UNLOCK(memoryStatsLock);
+}
+
+// Get frame arena position of calling thread, allocations after it can be released with ReleaseMemoryFrame()
+MemoryFrameMark GetMemoryFrameMark(void)
+{
+    MemoryFrameMark mark = { 0 };
+    FrameArena *arena = GetFrameArena(false);
+
+    if (arena != NULL)
+    {
+        mark.offset = arena->offset;
+        mark.overflow = arena->overflow;
+    }
+
+    return mark;
+}
+
+// Release frame arena allocations of calling thread done after mark, before frame start
+// NOTE: Marks must be released in reverse order, on the thread they were taken
+void ReleaseMemoryFrame(MemoryFrameMark mark)
+{
+    FrameArena *arena = GetFrameArena(false);
+
+    if ((arena != NULL) && (mark.offset <= arena->offset)) ReleaseFrameArena(arena, mark.offset, mark.overflow);
+}
+
+// Unload frame arena memory of calling thread
+// NOTE: Other threads arenas are unloaded on threads exit
+void UnloadMemoryFrameArena(void)
+{
+    FrameArena *arena = GetFrameArena(false);
+
+    if (arena != NULL)
+    {
+        UnloadFrameArena(arena);
+#if defined(SUPPORT_MEMORY_THREADS)
+        pthread_setspecific(frameArenaKey, NULL);
+#endif
+    }
+}
+
 // Load data from file into a buffer
 unsigned char *rl_LoadFileData(const char *fileName, int *dataSize)
 {
     unsigned char *data = NULL;
     *dataSize = 0;
 
+    PROFILE_ZONE_BEGIN("rl_LoadFileData");
+
     if (fileName != NULL)
     {
         if (loadFileData)
         {
             data = loadFileData(fileName, dataSize);
+            PROFILE_ZONE_END();
             return data;
         }
+#if defined(SUPPORT_FILE_ARCHIVES)
+        // Files in mounted archives are loaded without opening files
+        const Archive *archive = NULL;
+        const ArchiveEntry *entry = FindArchiveEntry(fileName, &archive);
+        if (entry != NULL)
+        {
+            data = LoadArchiveFile(archive, entry, dataSize, false);
+            PROFILE_ZONE_END();
+            return data;
+        }
+#endif
 #if defined(SUPPORT_STANDARD_FILEIO)
         FILE *file = fopen(fileName, "rb");
 
@@ -240,6 +844,8 @@ unsigned char *rl_LoadFileData(const char *fileName, int *dataSize)
     }
     else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
 
+    PROFILE_ZONE_END();
+
     return data;
 }
 
@@ -352,6 +958,15 @@ char *rl_LoadFileText(const char *fileName)
             text = loadFileText(fileName);
             return text;
         }
+#if defined(SUPPORT_FILE_ARCHIVES)
+        const Archive *archive = NULL;
+        const ArchiveEntry *entry = FindArchiveEntry(fileName, &archive);
+        if (entry != NULL)
+        {
+            int textSize = 0;
+            return (char *)LoadArchiveFile(archive, entry, &textSize, true);
+        }
+#endif
 #if defined(SUPPORT_STANDARD_FILEIO)
         FILE *file = fopen(fileName, "rt");
 
@@ -437,52 +1052,1507 @@ bool rl_SaveFileText(const char *fileName, const char *text)
     return success;
 }
 
-#if defined(PLATFORM_ANDROID)
-// Initialize asset manager from android app
-void InitAssetManager(AAssetManager *manager, const char *dataPath)
+// Load file data asynchronously, file is read on a file I/O worker thread
+// NOTE: Returned request must be passed to rl_FinishFileRequest() to get data and free it
+rl_FileRequest *rl_LoadFileDataAsync(const char *fileName)
 {
-    assetManager = manager;
-    internalDataPath = dataPath;
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return NULL;
+    }
+
+    rl_FileRequest *request = (rl_FileRequest *)RL_CALLOC(1, sizeof(rl_FileRequest));
+    request->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(request->fileName, fileName);
+
+    return QueueFileRequest(request);
 }
 
-// Replacement for fopen()
-// REF: https://developer.android.com/ndk/reference/group/asset
-FILE *android_fopen(const char *fileName, const char *mode)
+// Save data to file asynchronously, file is written on a file I/O worker thread
+// NOTE: Data is copied, requests are processed in queue order but
+// several worker threads could be writing files at the same time
+rl_FileRequest *rl_SaveFileDataAsync(const char *fileName, void *data, int dataSize)
 {
-    if (mode[0] == 'w')
+    if ((fileName == NULL) || ((data == NULL) && (dataSize > 0)) || (dataSize < 0))
     {
-        // NOTE: fopen() is mapped to android_fopen() that only grants read access to
-        // assets directory through AAssetManager but we want to also be able to
-        // write data when required using the standard stdio FILE access functions
-        // REF: https://stackoverflow.com/questions/11294487/android-writing-saving-files-from-native-code-only
-        #undef fopen
-        return fopen(rl_TextFormat("%s/%s", internalDataPath, fileName), mode);
-        #define fopen(name, mode) android_fopen(name, mode)
+        TRACELOG(LOG_WARNING, "FILEIO: Data provided to save is not valid");
+        return NULL;
+    }
+
+    rl_FileRequest *request = (rl_FileRequest *)RL_CALLOC(1, sizeof(rl_FileRequest));
+    request->fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(request->fileName, fileName);
+    request->save = true;
+    request->dataSize = dataSize;
+
+    if (dataSize > 0)
+    {
+        request->data = (unsigned char *)RL_MALLOC(dataSize);
+        memcpy(request->data, data, dataSize);
+    }
+
+    return QueueFileRequest(request);
+}
+
+// Check if file request has been completed (non-blocking)
+bool rl_IsFileRequestDone(rl_FileRequest *request)
+{
+    if (request == NULL) return true;
+
+    bool done = false;
+
+#if defined(SUPPORT_FILE_IO_THREADS)
+    pthread_mutex_lock(&fileWorkersLock);
+    done = request->done;
+    pthread_mutex_unlock(&fileWorkersLock);
+#else
+    done = request->done;
+#endif
+
+    return done;
+}
+
+// Finish file request (waits if required), request is freed
+// NOTE: Load requests return loaded data (to be freed with rl_UnloadFileData()) and its size,
+// save requests return NULL and dataSize is set to saved bytes (0 on failure)
+unsigned char *rl_FinishFileRequest(rl_FileRequest *request, int *dataSize)
+{
+    if (dataSize != NULL) *dataSize = 0;
+    if (request == NULL) return NULL;
+
+#if defined(SUPPORT_FILE_IO_THREADS)
+    pthread_mutex_lock(&fileWorkersLock);
+    while (!request->done) pthread_cond_wait(&fileWorkersDoneCond, &fileWorkersLock);
+    pthread_mutex_unlock(&fileWorkersLock);
+#endif
+
+    unsigned char *data = NULL;
+
+    if (request->save)
+    {
+        if (request->success && (dataSize != NULL)) *dataSize = request->dataSize;
+        RL_FREE(request->data);
     }
     else
     {
-        // NOTE: AAsset provides access to read-only asset
-        AAsset *asset = AAssetManager_open(assetManager, fileName, AASSET_MODE_UNKNOWN);
+        data = request->data;
+        if (dataSize != NULL) *dataSize = request->dataSize;
+    }
 
-        if (asset != NULL)
-        {
-            // Get pointer to file in the assets
-            return funopen(asset, android_read, android_write, android_seek, android_close);
-        }
-        else
-        {
-            #undef fopen
-            // Just do a regular open if file is not found in the assets
-            return fopen(rl_TextFormat("%s/%s", internalDataPath, fileName), mode);
-            #define fopen(name, mode) android_fopen(name, mode)
-        }
+    RL_FREE(request->fileName);
+    RL_FREE(request);
+
+    return data;
+}
+
+// Close file I/O worker threads, queued requests are completed
+// NOTE: Requests not finished with rl_FinishFileRequest() keep their data
+void CloseFileWorkerThreads(void)
+{
+#if defined(SUPPORT_FILE_IO_THREADS)
+    pthread_mutex_lock(&fileWorkersLock);
+
+    if (!fileWorkers.ready)
+    {
+        pthread_mutex_unlock(&fileWorkersLock);
+        return;
     }
+
+    fileWorkers.quit = true;
+    pthread_cond_broadcast(&fileWorkersCond);
+    pthread_mutex_unlock(&fileWorkersLock);
+
+    for (int i = 0; i < fileWorkers.threadCount; i++) pthread_join(fileWorkers.threads[i], NULL);
+
+    fileWorkers.threadCount = 0;
+    fileWorkers.ready = false;
+    fileWorkers.quit = false;
+#endif
 }
-#endif  // PLATFORM_ANDROID
 
-//----------------------------------------------------------------------------------
-// Module Internal Functions Definition
-//----------------------------------------------------------------------------------
+// Mount packed archive, files under mountPath are loaded from archive
+// NOTE: Archive data is memory mapped (if supported), entries index is hashed for constant time lookup,
+// mountPath is prepended to entries names, use NULL or "" to mount archive at root path
+bool rl_MountArchive(const char *fileName, const char *mountPath)
+{
+    bool result = false;
+
+#if defined(SUPPORT_FILE_ARCHIVES)
+    if (fileName == NULL) return false;
+
+    if (archiveCount >= MAX_MOUNTED_ARCHIVES)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to mount archive, maximum archives mounted (%i)", fileName, MAX_MOUNTED_ARCHIVES);
+        return false;
+    }
+
+    Archive archive = { 0 };
+
+#if defined(SUPPORT_ARCHIVE_MAPPING)
+    int fd = open(fileName, O_RDONLY);
+
+    if (fd != -1)
+    {
+        struct stat info = { 0 };
+
+        if ((fstat(fd, &info) == 0) && (info.st_size > 0) && (info.st_size <= 2147483647))
+        {
+            void *mapped = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (mapped != MAP_FAILED)
+            {
+                archive.data = (unsigned char *)mapped;
+                archive.dataSize = (int)info.st_size;
+                archive.mapped = true;
+            }
+        }
+
+        close(fd);
+    }
+#endif
+    // Archive could not be mapped (or mapping not supported), archive data is loaded
+    if (archive.data == NULL) archive.data = rl_LoadFileData(fileName, &archive.dataSize);
+
+    if (archive.data == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open archive", fileName);
+        return false;
+    }
+
+    // Read and validate header, all values stored little-endian
+    const unsigned char *data = archive.data;
+    unsigned int version = 0;
+    unsigned int indexOffset = 0;
+
+    if ((archive.dataSize >= ARCHIVE_HEADER_SIZE) && (memcmp(data, "rPAK", 4) == 0))
+    {
+        version = data[4] | (data[5] << 8) | (data[6] << 16) | ((unsigned int)data[7] << 24);
+        archive.entryCount = (int)(data[8] | (data[9] << 8) | (data[10] << 16) | ((unsigned int)data[11] << 24));
+        indexOffset = data[12] | (data[13] << 8) | (data[14] << 16) | ((unsigned int)data[15] << 24);
+    }
+
+    // Entries count is limited by index size, every entry requires at least its info data
+    bool valid = (version == 1) && (archive.entryCount >= 0) && (indexOffset >= ARCHIVE_HEADER_SIZE) && (indexOffset <= (unsigned int)archive.dataSize) &&
+        ((unsigned int)archive.entryCount <= (((unsigned int)archive.dataSize - indexOffset)/ARCHIVE_ENTRY_SIZE));
+
+    if (valid)
+    {
+        archive.entries = (ArchiveEntry *)RL_CALLOC(archive.entryCount + 1, sizeof(ArchiveEntry));
+
+        unsigned int position = indexOffset;
+
+        for (int i = 0; (i < archive.entryCount) && valid; i++)
+        {
+            if ((position + ARCHIVE_ENTRY_SIZE) > (unsigned int)archive.dataSize) { valid = false; break; }
+
+            const unsigned char *info = data + position;
+            ArchiveEntry *entry = &archive.entries[i];
+            entry->offset = info[0] | (info[1] << 8) | (info[2] << 16) | ((unsigned int)info[3] << 24);
+            entry->size = info[4] | (info[5] << 8) | (info[6] << 16) | ((unsigned int)info[7] << 24);
+            entry->packedSize = info[8] | (info[9] << 8) | (info[10] << 16) | ((unsigned int)info[11] << 24);
+            entry->compression = info[12] | (info[13] << 8);
+            entry->nameLength = info[14] | (info[15] << 8);
+            entry->name = (const char *)(info + ARCHIVE_ENTRY_SIZE);
+
+            position += ARCHIVE_ENTRY_SIZE + entry->nameLength;
+
+            if ((position > (unsigned int)archive.dataSize) || (entry->offset > (unsigned int)archive.dataSize) ||
+                (entry->packedSize > ((unsigned int)archive.dataSize - entry->offset)) || (entry->size >= 2147483647) ||
+                ((entry->compression == ARCHIVE_COMPRESSION_NONE) && (entry->size != entry->packedSize))) { valid = false; break; }
+
+            // Name is hashed once validated to be inside archive data
+            entry->hash = GetArchiveNameHash(entry->name, entry->nameLength);
+        }
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Archive file is not valid", fileName);
+        RL_FREE(archive.entries);
+#if defined(SUPPORT_ARCHIVE_MAPPING)
+        if (archive.mapped) munmap(archive.data, (size_t)archive.dataSize);
+        else
+#endif
+        RL_FREE(archive.data);
+
+        return false;
+    }
+
+    // Build entries hash table, load factor kept under 0.5
+    archive.tableSize = 16;
+    while (archive.tableSize < archive.entryCount*2) archive.tableSize *= 2;
+    archive.table = (int *)RL_MALLOC(archive.tableSize*sizeof(int));
+    for (int i = 0; i < archive.tableSize; i++) archive.table[i] = -1;
+
+    for (int i = 0; i < archive.entryCount; i++)
+    {
+        int slot = archive.entries[i].hash & (archive.tableSize - 1);
+        while (archive.table[slot] != -1) slot = (slot + 1) & (archive.tableSize - 1);
+        archive.table[slot] = i;
+    }
+
+    archive.fileName = (char *)RL_MALLOC(strlen(fileName) + 1);
+    strcpy(archive.fileName, fileName);
+
+    // Mount path normalized with trailing separator
+    char path[MAX_FILEPATH_LENGTH] = { 0 };
+    int pathLength = ((mountPath != NULL) && (mountPath[0] != '\0'))? NormalizeArchivePath(mountPath, path) : 0;
+    if ((pathLength > 0) && (path[pathLength - 1] != '/') && (pathLength < (MAX_FILEPATH_LENGTH - 1))) path[pathLength++] = '/';
+    archive.mountPath = (char *)RL_CALLOC(pathLength + 1, 1);
+    memcpy(archive.mountPath, path, pathLength);
+
+    archives[archiveCount] = archive;
+    archiveCount++;
+    result = true;
+
+    TRACELOG(LOG_INFO, "FILEIO: [%s] Archive mounted successfully (%i entries%s)", fileName, archive.entryCount, archive.mapped? ", memory mapped" : "");
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Archives not supported, SUPPORT_FILE_ARCHIVES required", fileName);
+#endif
+
+    return result;
+}
+
+// Unmount packed archive, NULL to unmount all archives
+// WARNING: Archives should not be unmounted while async file requests are pending
+void rl_UnmountArchive(const char *fileName)
+{
+#if defined(SUPPORT_FILE_ARCHIVES)
+    for (int i = archiveCount - 1; i >= 0; i--)
+    {
+        if ((fileName != NULL) && (strcmp(archives[i].fileName, fileName) != 0)) continue;
+
+#if defined(SUPPORT_ARCHIVE_MAPPING)
+        if (archives[i].mapped) munmap(archives[i].data, (size_t)archives[i].dataSize);
+        else
+#endif
+        RL_FREE(archives[i].data);
+
+        RL_FREE(archives[i].entries);
+        RL_FREE(archives[i].table);
+        RL_FREE(archives[i].mountPath);
+
+        TRACELOG(LOG_INFO, "FILEIO: [%s] Archive unmounted successfully", archives[i].fileName);
+        RL_FREE(archives[i].fileName);
+
+        for (int j = i; j < (archiveCount - 1); j++) archives[j] = archives[j + 1];
+        archiveCount--;
+        archives[archiveCount] = (Archive){ 0 };
+    }
+#endif
+}
+
+// Export files into a packed archive, entries named relative to basePath
+// NOTE: Entries are compressed (DEFLATE) if requested and compression reduces size
+bool rl_ExportArchive(const char *fileName, rl_FilePathList files, const char *basePath, bool compress)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILE_ARCHIVES) && defined(SUPPORT_STANDARD_FILEIO)
+    FILE *file = fopen(fileName, "wb");
+
+    if (file == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open archive file", fileName);
+        return false;
+    }
+
+    // Index is written after entries data, header updated at the end
+    unsigned char header[ARCHIVE_HEADER_SIZE] = { 'r', 'P', 'A', 'K', 1, 0, 0, 0 };
+    fwrite(header, 1, ARCHIVE_HEADER_SIZE, file);
+
+    int indexCapacity = 1024;
+    int indexSize = 0;
+    unsigned char *index = (unsigned char *)RL_MALLOC(indexCapacity);
+
+#if defined(SUPPORT_COMPRESSION_API)
+    struct sdefl *sdefl = compress? (struct sdefl *)RL_CALLOC(1, sizeof(struct sdefl)) : NULL;
+#endif
+    int basePathLength = (basePath != NULL)? (int)strlen(basePath) : 0;
+    unsigned int offset = ARCHIVE_HEADER_SIZE;
+    unsigned int entryCount = 0;
+    success = true;
+
+    for (unsigned int i = 0; (i < files.count) && success; i++)
+    {
+        if (rl_DirectoryExists(files.paths[i])) continue;  // Skip directories
+
+        int dataSize = 0;
+        unsigned char *data = rl_LoadFileData(files.paths[i], &dataSize);
+
+        // Entry name relative to base path, normalized
+        const char *name = files.paths[i];
+        if ((basePathLength > 0) && (strncmp(name, basePath, basePathLength) == 0)) name += basePathLength;
+        while ((name[0] == '/') || (name[0] == '\\')) name++;
+
+        char entryName[MAX_FILEPATH_LENGTH] = { 0 };
+        int nameLength = NormalizeArchivePath(name, entryName);
+
+        const unsigned char *entryData = data;
+        unsigned int packedSize = (unsigned int)dataSize;
+        unsigned int compression = ARCHIVE_COMPRESSION_NONE;
+        unsigned char *compData = NULL;
+
+#if defined(SUPPORT_COMPRESSION_API)
+        if ((sdefl != NULL) && (dataSize > 0))
+        {
+            compData = (unsigned char *)RL_MALLOC(sdefl_bound(dataSize));
+            int compSize = sdeflate(sdefl, compData, data, dataSize, 8);
+
+            // Entries not reduced by compression are stored
+            if ((compSize > 0) && (compSize < dataSize))
+            {
+                entryData = compData;
+                packedSize = (unsigned int)compSize;
+                compression = ARCHIVE_COMPRESSION_DEFLATE;
+            }
+        }
+#endif
+        if ((packedSize > 0) && (fwrite(entryData, 1, packedSize, file) != packedSize)) success = false;
+
+        // Register entry in index
+        while ((indexSize + ARCHIVE_ENTRY_SIZE + nameLength) > indexCapacity)
+        {
+            indexCapacity *= 2;
+            index = (unsigned char *)RL_REALLOC(index, indexCapacity);
+        }
+
+        unsigned int values[3] = { offset, (unsigned int)dataSize, packedSize };
+        unsigned char *info = index + indexSize;
+        for (int k = 0; k < 3; k++)
+        {
+            info[k*4 + 0] = (unsigned char)(values[k] & 0xff);
+            info[k*4 + 1] = (unsigned char)((values[k] >> 8) & 0xff);
+            info[k*4 + 2] = (unsigned char)((values[k] >> 16) & 0xff);
+            info[k*4 + 3] = (unsigned char)((values[k] >> 24) & 0xff);
+        }
+        info[12] = (unsigned char)(compression & 0xff);
+        info[13] = (unsigned char)((compression >> 8) & 0xff);
+        info[14] = (unsigned char)(nameLength & 0xff);
+        info[15] = (unsigned char)((nameLength >> 8) & 0xff);
+        memcpy(info + ARCHIVE_ENTRY_SIZE, entryName, nameLength);
+
+        indexSize += ARCHIVE_ENTRY_SIZE + nameLength;
+        offset += packedSize;
+        entryCount++;
+
+        RL_FREE(compData);
+        rl_UnloadFileData(data);
+    }
+
+    if (success && (fwrite(index, 1, indexSize, file) != (size_t)indexSize)) success = false;
+
+    // Update header with entries count and index offset
+    unsigned int values[2] = { entryCount, offset };
+    for (int k = 0; k < 2; k++)
+    {
+        header[8 + k*4 + 0] = (unsigned char)(values[k] & 0xff);
+        header[8 + k*4 + 1] = (unsigned char)((values[k] >> 8) & 0xff);
+        header[8 + k*4 + 2] = (unsigned char)((values[k] >> 16) & 0xff);
+        header[8 + k*4 + 3] = (unsigned char)((values[k] >> 24) & 0xff);
+    }
+
+    if (success && ((fseek(file, 0, SEEK_SET) != 0) || (fwrite(header, 1, ARCHIVE_HEADER_SIZE, file) != ARCHIVE_HEADER_SIZE))) success = false;
+
+    fclose(file);
+    RL_FREE(index);
+#if defined(SUPPORT_COMPRESSION_API)
+    RL_FREE(sdefl);
+#endif
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Archive exported successfully (%i entries)", fileName, entryCount);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export archive", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: [%s] Archives export not supported", fileName);
+#endif
+
+    return success;
+}
+
+// Check if file is available in a mounted archive
+bool IsArchiveFile(const char *fileName)
+{
+    bool result = false;
+
+#if defined(SUPPORT_FILE_ARCHIVES)
+    const Archive *archive = NULL;
+    if ((fileName != NULL) && (FindArchiveEntry(fileName, &archive) != NULL)) result = true;
+#endif
+
+    return result;
+}
+
+// Run job on worker threads, job is queued once all dependencies jobs are completed
+// NOTE: Returned handle must be released with rl_ReleaseJob(), dependencies can be NULL
+rl_Job *rl_RunJob(JobCallback callback, void *userData, rl_Job *const *dependencies, int dependencyCount)
+{
+    if (callback == NULL) return NULL;
+
+    JOBS_LOCK();
+
+    rl_Job *job = NewJob();
+
+    if (job != NULL)
+    {
+        job->process = callback;
+        job->userData = userData;
+        job->count = 1;
+        job->chunkSize = 1;
+        job->chunkCount = 1;
+        job->pendingChunks = 1;
+
+        SubmitJob(job, dependencies, dependencyCount);
+    }
+
+    // Queued jobs are run on caller thread if no worker thread is available
+    if (jobs.threadCount == 0) while (RunJobChunk()) { }
+
+    JOBS_UNLOCK();
+
+    return job;
+}
+
+// Run parallel job on worker threads, range [0, count) is processed in chunks of chunkSize
+// NOTE: Job is queued once all dependencies jobs are completed, chunks are processed in parallel
+rl_Job *rl_RunJobRange(JobRangeCallback callback, void *userData, int count, int chunkSize, rl_Job *const *dependencies, int dependencyCount)
+{
+    if (callback == NULL) return NULL;
+    if (count < 0) count = 0;
+    if (chunkSize < 1) chunkSize = 1;
+
+    JOBS_LOCK();
+
+    rl_Job *job = NewJob();
+
+    if (job != NULL)
+    {
+        job->processRange = callback;
+        job->userData = userData;
+        job->count = count;
+        job->chunkSize = chunkSize;
+        job->chunkCount = (count + chunkSize - 1)/chunkSize;
+        job->pendingChunks = job->chunkCount;
+
+        SubmitJob(job, dependencies, dependencyCount);
+    }
+
+    // Queued jobs are run on caller thread if no worker thread is available
+    if (jobs.threadCount == 0) while (RunJobChunk()) { }
+
+    JOBS_UNLOCK();
+
+    return job;
+}
+
+// Process range [0, count) in chunks of chunkSize, caller thread processes chunks too
+// NOTE: Function returns once the full range is processed, range is processed at once if no worker thread is available
+void rl_ParallelFor(JobRangeCallback callback, void *userData, int count, int chunkSize)
+{
+    if ((callback == NULL) || (count <= 0)) return;
+    if (chunkSize < 1) chunkSize = 1;
+
+    rl_Job *job = NULL;
+
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+    int chunkCount = (count + chunkSize - 1)/chunkSize;
+
+    if (chunkCount > 1)
+    {
+        JOBS_LOCK();
+
+        if (!jobs.ready) StartJobWorkers();
+        if (jobs.threadCount > 0) job = NewJob();
+
+        if (job != NULL)
+        {
+            job->processRange = callback;
+            job->userData = userData;
+            job->count = count;
+            job->chunkSize = chunkSize;
+            job->chunkCount = chunkCount;
+            job->pendingChunks = chunkCount;
+
+            SubmitJob(job, NULL, 0);
+
+            // Caller takes chunks until none is left, then waits for chunks processed by workers
+            // NOTE: Other queued jobs are not run meanwhile, they could delay caller
+            while (job->nextChunk < job->chunkCount) ProcessJobChunk(job);
+            while (!job->completed)
+            {
+                jobs.waiting++;
+                pthread_cond_wait(&jobsDoneCond, &jobsLock);
+                jobs.waiting--;
+            }
+
+            ReleaseJobReference(job);
+        }
+
+        JOBS_UNLOCK();
+    }
+#endif
+
+    if (job == NULL) callback(userData, 0, count);
+}
+
+// Set job completed callback, called by rl_UpdateJobs() on its thread
+// NOTE: Callback is queued right away if job is already completed
+void rl_SetJobCompletedCallback(rl_Job *job, JobCallback callback, void *userData)
+{
+    if (job == NULL) return;
+
+    JOBS_LOCK();
+
+    job->completedCallback = callback;
+    job->completedUserData = userData;
+
+    if (job->completed && (callback != NULL)) QueueJobCallback(job);
+
+    JOBS_UNLOCK();
+}
+
+// Check if job has been completed (non-blocking)
+bool rl_IsJobCompleted(rl_Job *job)
+{
+    if (job == NULL) return false;
+
+    JOBS_LOCK();
+    bool completed = job->completed;
+    JOBS_UNLOCK();
+
+    return completed;
+}
+
+// Wait for job completion, caller thread runs queued jobs meanwhile
+void rl_WaitJob(rl_Job *job)
+{
+    if (job == NULL) return;
+
+    JOBS_LOCK();
+
+    while (!job->completed)
+    {
+        if (RunJobChunk()) continue;
+
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+        if (jobs.threadCount > 0)
+        {
+            jobs.waiting++;
+            pthread_cond_wait(&jobsDoneCond, &jobsLock);
+            jobs.waiting--;
+            continue;
+        }
+#endif
+        // Nothing left to run on caller thread, job is waiting for itself (or a job depending on it)
+        TRACELOG(LOG_WARNING, "JOBS: Job can not be completed, dependencies are not completed");
+        break;
+    }
+
+    JOBS_UNLOCK();
+}
+
+// Release job handle, job is still run if not completed
+// NOTE: Completed callback is still called if set
+void rl_ReleaseJob(rl_Job *job)
+{
+    if (job == NULL) return;
+
+    JOBS_LOCK();
+    ReleaseJobReference(job);
+    JOBS_UNLOCK();
+}
+
+// Call completed jobs callbacks, in completion order
+// NOTE: Called by rl_BeginDrawing(), callbacks run on main thread
+void rl_UpdateJobs(void)
+{
+    JOBS_LOCK();
+
+    rl_Job *job = jobs.completedFirst;
+    jobs.completedFirst = NULL;
+    jobs.completedLast = NULL;
+
+    while (job != NULL)
+    {
+        rl_Job *next = job->completedNext;
+        JobCallback callback = job->completedCallback;
+        void *userData = job->completedUserData;
+
+        job->callbackQueued = false;
+
+        JOBS_UNLOCK();
+        if (callback != NULL) callback(userData);
+        JOBS_LOCK();
+
+        ReleaseJobReference(job);
+        job = next;
+    }
+
+    JOBS_UNLOCK();
+}
+
+// Set job worker threads count, -1 for one worker per additional processor
+// NOTE: Running workers complete queued jobs and exit, new workers are created on next job
+void rl_SetJobWorkerCount(int count)
+{
+    CloseJobWorkers();
+
+    jobWorkerCount = (count < 0)? -1 : ((count > MAX_JOB_WORKER_THREADS)? MAX_JOB_WORKER_THREADS : count);
+}
+
+// Get job worker threads count, worker threads are created if required
+int rl_GetJobWorkerCount(void)
+{
+    JOBS_LOCK();
+
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+    if (!jobs.ready) StartJobWorkers();
+#endif
+    int count = jobs.threadCount;
+
+    JOBS_UNLOCK();
+
+    return count;
+}
+
+// Close job system worker threads, queued jobs are completed
+// NOTE: Called by rl_CloseWindow(), threads are created again on next job
+void CloseJobWorkers(void)
+{
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+    pthread_mutex_lock(&jobsLock);
+
+    if (jobs.ready)
+    {
+        jobs.quit = true;
+        pthread_cond_broadcast(&jobsCond);
+        pthread_mutex_unlock(&jobsLock);
+
+        for (int i = 0; i < jobs.threadCount; i++) pthread_join(jobs.threads[i], NULL);
+
+        pthread_mutex_lock(&jobsLock);
+
+        jobs.threadCount = 0;
+        jobs.ready = false;
+        jobs.quit = false;
+    }
+#endif
+
+    // Unused jobs and links are freed, handles still referenced are kept
+    while (jobs.freeJobs != NULL)
+    {
+        rl_Job *job = jobs.freeJobs;
+        jobs.freeJobs = job->next;
+        RL_FREE(job);
+    }
+
+    while (jobs.freeLinks != NULL)
+    {
+        JobLink *link = jobs.freeLinks;
+        jobs.freeLinks = link->next;
+        RL_FREE(link);
+    }
+
+    JOBS_UNLOCK();
+}
+
+// Begin named CPU profiler zone on calling thread
+// NOTE: Name is not copied, it must remain valid until zones are exported (i.e. string literal)
+void rl_BeginProfileZone(const char *name)
+{
+#if defined(SUPPORT_CPU_PROFILER)
+    ProfileThread *thread = GetProfileThread();
+    if (thread == NULL) return;
+
+    if (thread->depth < CPU_PROFILER_MAX_DEPTH)
+    {
+        thread->openNames[thread->depth] = name;
+        thread->openStarts[thread->depth] = rl_GetTime();
+    }
+
+    thread->depth++;
+#else
+    (void)name;
+#endif
+}
+
+// End last CPU profiler zone begun on calling thread, zone is recorded
+void rl_EndProfileZone(void)
+{
+#if defined(SUPPORT_CPU_PROFILER)
+    ProfileThread *thread = GetProfileThread();
+    if ((thread == NULL) || (thread->depth == 0)) return;
+
+    thread->depth--;
+
+    if (thread->depth < CPU_PROFILER_MAX_DEPTH)
+    {
+        ProfileZone *zone = &thread->zones[thread->count%CPU_PROFILER_MAX_ZONES];
+        zone->name = thread->openNames[thread->depth];
+        zone->start = thread->openStarts[thread->depth];
+        zone->duration = rl_GetTime() - zone->start;
+
+        thread->count++;
+    }
+#endif
+}
+
+// Reset recorded CPU profiler zones of all threads
+// NOTE: Zones being recorded by other threads meanwhile could be kept
+void rl_ResetProfileZones(void)
+{
+#if defined(SUPPORT_CPU_PROFILER)
+    PROFILER_LOCK();
+    for (ProfileThread *thread = profileThreads; thread != NULL; thread = thread->next) thread->count = 0;
+    PROFILER_UNLOCK();
+#endif
+}
+
+// Export recorded CPU profiler zones as Chrome trace events JSON, returns true on success
+// NOTE: Trace can be opened with chrome://tracing or https://ui.perfetto.dev, zones still open are not exported,
+// zones recorded by other threads while exporting could be skipped
+bool rl_ExportProfileTrace(const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_CPU_PROFILER) && defined(SUPPORT_STANDARD_FILEIO)
+    FILE *file = fopen(fileName, "wt");
+
+    if (file != NULL)
+    {
+        int zoneCount = 0;
+
+        fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+        PROFILER_LOCK();
+        for (ProfileThread *thread = profileThreads; thread != NULL; thread = thread->next)
+        {
+            fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%i,\"args\":{\"name\":\"thread %i\"}}",
+                (thread == profileThreads)? "" : ",\n", thread->id, thread->id);
+
+            // Oldest zones are overwritten once ring buffer is full
+            unsigned int count = thread->count;
+            unsigned int first = (count > CPU_PROFILER_MAX_ZONES)? count - CPU_PROFILER_MAX_ZONES : 0;
+
+            for (unsigned int i = first; i < count; i++)
+            {
+                const ProfileZone *zone = &thread->zones[i%CPU_PROFILER_MAX_ZONES];
+
+                // NOTE: Trace events times are in microseconds
+                fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"raylib\",\"ph\":\"X\",\"pid\":1,\"tid\":%i,\"ts\":%.3f,\"dur\":%.3f}",
+                    zone->name, thread->id, zone->start*1e6, zone->duration*1e6);
+                zoneCount++;
+            }
+        }
+        PROFILER_UNLOCK();
+
+        fprintf(file, "\n]}\n");
+
+        success = (ferror(file) == 0);
+        fclose(file);
+
+        if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Profile trace exported successfully (%i zones)", fileName, zoneCount);
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to write profile trace", fileName);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+#else
+    (void)fileName;
+    TRACELOG(LOG_WARNING, "PROFILER: CPU profiler not supported, build raylib with SUPPORT_CPU_PROFILER");
+#endif
+
+    return success;
+}
+
+// Unload CPU profiler zones of all threads
+// NOTE: Called by rl_CloseWindow(), threads register again on next zone
+void UnloadProfileZones(void)
+{
+#if defined(SUPPORT_CPU_PROFILER)
+    PROFILER_LOCK();
+
+    while (profileThreads != NULL)
+    {
+        ProfileThread *thread = profileThreads;
+        profileThreads = thread->next;
+        RL_FREE(thread->zones);
+        RL_FREE(thread);
+    }
+
+    profileThreadCount = 0;
+    profileGeneration++;        // Threads zones pointers are no longer valid
+
+    PROFILER_UNLOCK();
+#endif
+}
+
+#if defined(PLATFORM_ANDROID)
+// Initialize asset manager from android app
+void InitAssetManager(AAssetManager *manager, const char *dataPath)
+{
+    assetManager = manager;
+    internalDataPath = dataPath;
+}
+
+// Replacement for fopen()
+// REF: https://developer.android.com/ndk/reference/group/asset
+FILE *android_fopen(const char *fileName, const char *mode)
+{
+    if (mode[0] == 'w')
+    {
+        // NOTE: fopen() is mapped to android_fopen() that only grants read access to
+        // assets directory through AAssetManager but we want to also be able to
+        // write data when required using the standard stdio FILE access functions
+        // REF: https://stackoverflow.com/questions/11294487/android-writing-saving-files-from-native-code-only
+        #undef fopen
+        return fopen(rl_TextFormat("%s/%s", internalDataPath, fileName), mode);
+        #define fopen(name, mode) android_fopen(name, mode)
+    }
+    else
+    {
+        // NOTE: AAsset provides access to read-only asset
+        AAsset *asset = AAssetManager_open(assetManager, fileName, AASSET_MODE_UNKNOWN);
+
+        if (asset != NULL)
+        {
+            // Get pointer to file in the assets
+            return funopen(asset, android_read, android_write, android_seek, android_close);
+        }
+        else
+        {
+            #undef fopen
+            // Just do a regular open if file is not found in the assets
+            return fopen(rl_TextFormat("%s/%s", internalDataPath, fileName), mode);
+            #define fopen(name, mode) android_fopen(name, mode)
+        }
+    }
+}
+#endif  // PLATFORM_ANDROID
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_CPU_PROFILER)
+// Get CPU profiler zones of calling thread (registered on first use)
+static ProfileThread *GetProfileThread(void)
+{
+    if (profileThreadGeneration != profileGeneration)
+    {
+        profileThread = NULL;
+
+        ProfileThread *thread = (ProfileThread *)RL_CALLOC(1, sizeof(ProfileThread));
+        if (thread == NULL) return NULL;
+
+        thread->zones = (ProfileZone *)RL_MALLOC(CPU_PROFILER_MAX_ZONES*sizeof(ProfileZone));
+        if (thread->zones == NULL)
+        {
+            RL_FREE(thread);
+            return NULL;
+        }
+
+        // Thread appended to list, main thread keeps first place
+        PROFILER_LOCK();
+        thread->id = ++profileThreadCount;
+        ProfileThread **last = &profileThreads;
+        while (*last != NULL) last = &(*last)->next;
+        *last = thread;
+        profileThreadGeneration = profileGeneration;
+        PROFILER_UNLOCK();
+
+        profileThread = thread;
+    }
+
+    return profileThread;
+}
+#endif
+
+// Queue file request for worker threads, worker threads are created on first request
+// NOTE: Request is completed on caller thread if worker threads are not available
+// Update tagged memory stats (module, purpose and accumulated entries)
+static void UpdateMemoryStats(int module, int purpose, long long bytes, int count)
+{
+    MEMORY_LOCK(memoryStatsLock);
+
+    rl_MemoryStats *entries[4] = {
+        &memoryStats[module][purpose], &memoryStats[module][MAX_MEMORY_PURPOSES],
+        &memoryStats[MAX_MEMORY_MODULES][purpose], &memoryStats[MAX_MEMORY_MODULES][MAX_MEMORY_PURPOSES]
+    };
+
+    for (int i = 0; i < 4; i++)
+    {
+        entries[i]->liveBytes += bytes;
+        entries[i]->liveCount += count;
+        if (count > 0)
+        {
+            entries[i]->totalCount++;
+            entries[i]->frameCount++;
+        }
+        if (entries[i]->liveBytes > entries[i]->peakBytes) entries[i]->peakBytes = entries[i]->liveBytes;
+    }
+
+    MEMORY_UNLOCK(memoryStatsLock);
+}
+
+#if defined(SUPPORT_MEMORY_THREADS)
+// Initialize frame arenas thread key, arenas are unloaded on threads exit
+static void InitFrameArenaKey(void)
+{
+    pthread_key_create(&frameArenaKey, UnloadFrameArena);
+}
+#endif
+
+// Get frame arena of calling thread (created on first use if requested)
+static FrameArena *GetFrameArena(bool create)
+{
+#if defined(SUPPORT_MEMORY_THREADS)
+    pthread_once(&frameArenaKeyOnce, InitFrameArenaKey);
+
+    FrameArena *arena = (FrameArena *)pthread_getspecific(frameArenaKey);
+
+    if ((arena == NULL) && create)
+    {
+        arena = (FrameArena *)MemAllocTracked(1, sizeof(FrameArena), MEMORY_MODULE_UTILS, MEMORY_PURPOSE_TEMPORARY, true);
+        if (arena != NULL) pthread_setspecific(frameArenaKey, arena);
+    }
+
+    return arena;
+#else
+    (void)create;
+    return &frameArena;
+#endif
+}
+
+// Release frame arena allocations up to offset and overflow block
+static void ReleaseFrameArena(FrameArena *arena, unsigned int offset, unsigned char *overflow)
+{
+    while ((arena->overflow != NULL) && (arena->overflow != overflow))
+    {
+        unsigned char *block = arena->overflow;
+        arena->overflow = *(unsigned char **)block;
+        arena->overflowSize -= *(unsigned int *)(block + sizeof(unsigned char *));
+        rl_MemFreeTagged(block);
+    }
+
+    arena->offset = offset;
+}
+
+// Unload frame arena memory (also called on threads exit)
+static void UnloadFrameArena(void *arena)
+{
+    FrameArena *frame = (FrameArena *)arena;
+
+    ReleaseFrameArena(frame, 0, NULL);
+    rl_MemFreeTagged(frame->data);
+
+#if defined(SUPPORT_MEMORY_THREADS)
+    rl_MemFreeTagged(frame);
+#else
+    *frame = (FrameArena){ 0 };
+#endif
+}
+
+static rl_FileRequest *QueueFileRequest(rl_FileRequest *request)
+{
+#if defined(SUPPORT_FILE_IO_THREADS)
+    pthread_mutex_lock(&fileWorkersLock);
+
+    if (!fileWorkers.ready)
+    {
+        for (int i = 0; i < MAX_FILE_IO_THREADS; i++)
+        {
+            if (pthread_create(&fileWorkers.threads[fileWorkers.threadCount], NULL, FileWorkerThreadLoop, NULL) == 0) fileWorkers.threadCount++;
+        }
+
+        if (fileWorkers.threadCount > 0) fileWorkers.ready = true;
+        else TRACELOG(LOG_WARNING, "FILEIO: Failed to create file I/O worker threads");
+    }
+
+    if (fileWorkers.ready)
+    {
+        if (fileWorkers.last != NULL) fileWorkers.last->next = request;
+        else fileWorkers.first = request;
+
+        fileWorkers.last = request;
+        pthread_cond_signal(&fileWorkersCond);
+        pthread_mutex_unlock(&fileWorkersLock);
+
+        return request;
+    }
+
+    pthread_mutex_unlock(&fileWorkersLock);
+#endif
+
+    // Worker threads not available, request is completed on caller thread
+    ProcessFileRequest(request);
+    request->done = true;
+
+    return request;
+}
+
+// Process file request, load or save file data
+static void ProcessFileRequest(rl_FileRequest *request)
+{
+    if (request->save) request->success = rl_SaveFileData(request->fileName, request->data, request->dataSize);
+    else
+    {
+        request->data = rl_LoadFileData(request->fileName, &request->dataSize);
+        request->success = (request->data != NULL);
+    }
+}
+
+#if defined(SUPPORT_FILE_ARCHIVES)
+// Get archive entry name hash (FNV-1a)
+static unsigned int GetArchiveNameHash(const char *name, int length)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; i < length; i++)
+    {
+        hash ^= (unsigned char)name[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Normalize file path for archive lookup, returns path length
+// NOTE: Backslashes are converted to slashes, leading "./" and duplicated separators removed
+static int NormalizeArchivePath(const char *fileName, char *path)
+{
+    int length = 0;
+
+    while ((fileName[0] == '.') && ((fileName[1] == '/') || (fileName[1] == '\\'))) fileName += 2;
+
+    for (int i = 0; (fileName[i] != '\0') && (length < (MAX_FILEPATH_LENGTH - 1)); i++)
+    {
+        char c = (fileName[i] == '\\')? '/' : fileName[i];
+        if ((c == '/') && (length > 0) && (path[length - 1] == '/')) continue;
+        path[length++] = c;
+    }
+
+    path[length] = '\0';
+
+    return length;
+}
+
+// Find file entry in mounted archives, last mounted archives are looked up first
+static const ArchiveEntry *FindArchiveEntry(const char *fileName, const Archive **archive)
+{
+    if (archiveCount == 0) return NULL;
+
+    char path[MAX_FILEPATH_LENGTH] = { 0 };
+    int length = NormalizeArchivePath(fileName, path);
+
+    for (int i = archiveCount - 1; i >= 0; i--)
+    {
+        const char *name = path;
+        int nameLength = length;
+        int mountLength = (int)strlen(archives[i].mountPath);
+
+        if (mountLength > 0)
+        {
+            if ((nameLength <= mountLength) || (strncmp(name, archives[i].mountPath, mountLength) != 0)) continue;
+            name += mountLength;
+            nameLength -= mountLength;
+        }
+
+        unsigned int hash = GetArchiveNameHash(name, nameLength);
+        int slot = hash & (archives[i].tableSize - 1);
+
+        while (archives[i].table[slot] != -1)
+        {
+            const ArchiveEntry *entry = &archives[i].entries[archives[i].table[slot]];
+
+            if ((entry->hash == hash) && (entry->nameLength == (unsigned int)nameLength) && (memcmp(entry->name, name, nameLength) == 0))
+            {
+                *archive = &archives[i];
+                return entry;
+            }
+
+            slot = (slot + 1) & (archives[i].tableSize - 1);
+        }
+    }
+
+    return NULL;
+}
+
+// Load archive entry data, text data is '\0' terminated
+static unsigned char *LoadArchiveFile(const Archive *archive, const ArchiveEntry *entry, int *dataSize, bool text)
+{
+    // NOTE: One extra byte is always allocated, used for text '\0' or to detect compressed data longer than expected
+    unsigned char *data = (unsigned char *)RL_MALLOC(entry->size + 1);
+    *dataSize = 0;
+
+    if (entry->compression == ARCHIVE_COMPRESSION_NONE) memcpy(data, archive->data + entry->offset, entry->size);
+    else
+    {
+        int size = -1;
+#if defined(SUPPORT_COMPRESSION_API)
+        if (entry->compression == ARCHIVE_COMPRESSION_DEFLATE) size = sinflate(data, (int)entry->size + 1, archive->data + entry->offset, (int)entry->packedSize);
+#endif
+        if (size != (int)entry->size)
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to decompress archive entry [%.*s]", archive->fileName, (int)entry->nameLength, entry->name);
+            RL_FREE(data);
+            return NULL;
+        }
+    }
+
+    if (text) data[entry->size] = '\0';
+    *dataSize = (int)entry->size;
+
+    TRACELOG(LOG_INFO, "FILEIO: [%.*s] File loaded successfully from archive", (int)entry->nameLength, entry->name);
+
+    return data;
+}
+#endif
+
+#if defined(SUPPORT_FILE_IO_THREADS)
+// File I/O worker thread loop, queued requests are processed until exit is requested
+static void *FileWorkerThreadLoop(void *arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&fileWorkersLock);
+
+    while (true)
+    {
+        rl_FileRequest *request = fileWorkers.first;
+
+        if (request == NULL)
+        {
+            if (fileWorkers.quit) break;
+
+            pthread_cond_wait(&fileWorkersCond, &fileWorkersLock);
+            continue;
+        }
+
+        fileWorkers.first = request->next;
+        if (fileWorkers.first == NULL) fileWorkers.last = NULL;
+
+        pthread_mutex_unlock(&fileWorkersLock);
+
+        ProcessFileRequest(request);
+
+        pthread_mutex_lock(&fileWorkersLock);
+
+        request->done = true;
+        pthread_cond_broadcast(&fileWorkersDoneCond);
+    }
+
+    pthread_mutex_unlock(&fileWorkersLock);
+
+    return NULL;
+}
+#endif
+
+// Get new job, taken from unused jobs if available
+// NOTE: Called with jobs mutex locked, job is referenced by its handle and by scheduler until completed
+static rl_Job *NewJob(void)
+{
+    rl_Job *job = jobs.freeJobs;
+
+    if (job != NULL) jobs.freeJobs = job->next;
+    else job = (rl_Job *)RL_MALLOC(sizeof(rl_Job));
+
+    if (job == NULL)
+    {
+        TRACELOG(LOG_WARNING, "JOBS: Failed to allocate job");
+        return NULL;
+    }
+
+    memset(job, 0, sizeof(rl_Job));
+    job->refCount = 2;
+
+    return job;
+}
+
+// Submit job, queued right away if its dependencies are completed
+// NOTE: Called with jobs mutex locked, worker threads are created on first job
+static void SubmitJob(rl_Job *job, rl_Job *const *dependencies, int dependencyCount)
+{
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+    if (!jobs.ready) StartJobWorkers();
+#endif
+
+    for (int i = 0; (dependencies != NULL) && (i < dependencyCount); i++)
+    {
+        rl_Job *dependency = dependencies[i];
+        if ((dependency == NULL) || dependency->completed) continue;
+
+        JobLink *link = jobs.freeLinks;
+
+        if (link != NULL) jobs.freeLinks = link->next;
+        else link = (JobLink *)RL_MALLOC(sizeof(JobLink));
+
+        if (link == NULL)
+        {
+            // Job can not be linked to dependency, dependency is completed before continuing
+            TRACELOG(LOG_WARNING, "JOBS: Failed to allocate job dependency, waiting for dependency");
+            JOBS_UNLOCK();
+            rl_WaitJob(dependency);
+            JOBS_LOCK();
+            continue;
+        }
+
+        link->job = job;
+        link->next = dependency->dependents;
+        dependency->dependents = link;
+        job->pendingDependencies++;
+    }
+
+    if (job->pendingDependencies == 0) QueueJob(job);
+}
+
+// Queue job on calling thread queue, idle workers are woken up
+// NOTE: Called with jobs mutex locked, queue keeps a job reference
+static void QueueJob(rl_Job *job)
+{
+    // Empty range jobs are completed right away
+    if (job->chunkCount == 0)
+    {
+        CompleteJob(job);
+        return;
+    }
+
+    job->refCount++;
+    PushJob(&jobs.queues[GetJobQueueIndex()], job);
+}
+
+// Push job on queue top (newest job)
+// NOTE: Called with jobs mutex locked, queue reference is not taken
+static void PushJob(JobQueue *queue, rl_Job *job)
+{
+    job->prev = queue->last;
+    job->next = NULL;
+
+    if (queue->last != NULL) queue->last->next = job;
+    else queue->first = job;
+    queue->last = job;
+
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+    // Parallel jobs with multiple chunks left wake up all idle workers
+    if (jobs.sleeping > 0)
+    {
+        if ((job->chunkCount - job->nextChunk) > 1) pthread_cond_broadcast(&jobsCond);
+        else pthread_cond_signal(&jobsCond);
+    }
+
+    // Threads waiting for jobs completion also run queued jobs
+    if (jobs.waiting > 0) pthread_cond_broadcast(&jobsDoneCond);
+#endif
+}
+
+// Remove job from queue
+// NOTE: Called with jobs mutex locked
+static void UnlinkJob(JobQueue *queue, rl_Job *job)
+{
+    if (job->prev != NULL) job->prev->next = job->next;
+    else queue->first = job->next;
+
+    if (job->next != NULL) job->next->prev = job->prev;
+    else queue->last = job->prev;
+
+    job->prev = NULL;
+    job->next = NULL;
+}
+
+// Take one queued job chunk and process it, returns false if no job is queued
+// NOTE: Called with jobs mutex locked, calling thread queue is popped from newest job (LIFO),
+// other threads queues are stolen from oldest job (FIFO), jobs queued by non-worker threads are run in order
+static bool RunJobChunk(void)
+{
+    int ownIndex = GetJobQueueIndex();
+    int queueCount = jobs.threadCount + 1;
+    rl_Job *job = NULL;
+
+    for (int i = 0; (i < queueCount) && (job == NULL); i++)
+    {
+        int index = (ownIndex + i)%queueCount;
+        JobQueue *queue = &jobs.queues[index];
+
+        while (queue->first != NULL)
+        {
+            rl_Job *candidate = ((i == 0) && (ownIndex > 0))? queue->last : queue->first;
+            UnlinkJob(queue, candidate);
+
+            if (candidate->nextChunk < candidate->chunkCount)
+            {
+                job = candidate;
+                break;
+            }
+
+            // Chunks already taken by other threads, queue reference is released
+            ReleaseJobReference(candidate);
+        }
+    }
+
+    if (job == NULL) return false;
+
+    // Job with chunks left is queued again (keeping queue reference), idle workers steal remaining chunks
+    // NOTE: Job is alive while processing, scheduler reference is released on completion
+    if ((job->nextChunk + 1) < job->chunkCount) PushJob(&jobs.queues[ownIndex], job);
+    else ReleaseJobReference(job);
+
+    ProcessJobChunk(job);
+
+    return true;
+}
+
+// Process next job chunk, job is completed with its last chunk
+// NOTE: Called with jobs mutex locked, mutex is released while processing the chunk
+static void ProcessJobChunk(rl_Job *job)
+{
+    int start = (job->nextChunk++)*job->chunkSize;
+    int end = ((start + job->chunkSize) < job->count)? (start + job->chunkSize) : job->count;
+
+    JOBS_UNLOCK();
+
+    // Frame arena allocations done by chunk are released, worker threads never start a frame
+    MemoryFrameMark mark = GetMemoryFrameMark();
+
+    if (job->process != NULL) job->process(job->userData);
+    else job->processRange(job->userData, start, end);
+
+    ReleaseMemoryFrame(mark);
+
+    JOBS_LOCK();
+
+    job->pendingChunks--;
+    if (job->pendingChunks == 0) CompleteJob(job);
+}
+
+// Complete job, dependent jobs with all dependencies completed are queued
+// NOTE: Called with jobs mutex locked, scheduler reference is released
+static void CompleteJob(rl_Job *job)
+{
+    job->completed = true;
+
+    JobLink *link = job->dependents;
+    job->dependents = NULL;
+
+    while (link != NULL)
+    {
+        JobLink *next = link->next;
+        rl_Job *dependent = link->job;
+
+        dependent->pendingDependencies--;
+        if (dependent->pendingDependencies == 0) QueueJob(dependent);
+
+        link->next = jobs.freeLinks;
+        jobs.freeLinks = link;
+        link = next;
+    }
+
+    if (job->completedCallback != NULL) QueueJobCallback(job);
+
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+    if (jobs.waiting > 0) pthread_cond_broadcast(&jobsDoneCond);
+#endif
+
+    ReleaseJobReference(job);
+}
+
+// Queue completed job callback, called by rl_UpdateJobs()
+// NOTE: Called with jobs mutex locked, completed queue keeps a job reference
+static void QueueJobCallback(rl_Job *job)
+{
+    if (job->callbackQueued) return;
+
+    job->callbackQueued = true;
+    job->refCount++;
+    job->completedNext = NULL;
+
+    if (jobs.completedLast != NULL) jobs.completedLast->completedNext = job;
+    else jobs.completedFirst = job;
+    jobs.completedLast = job;
+}
+
+// Release job reference, unreferenced job is kept for reuse
+// NOTE: Called with jobs mutex locked
+static void ReleaseJobReference(rl_Job *job)
+{
+    job->refCount--;
+
+    if (job->refCount == 0)
+    {
+        job->next = jobs.freeJobs;
+        jobs.freeJobs = job;
+    }
+}
+
+// Get calling thread jobs queue index, 0 for non-worker threads
+// NOTE: Called with jobs mutex locked
+static int GetJobQueueIndex(void)
+{
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+    if (jobs.threadCount > 0) return (int)(size_t)pthread_getspecific(jobWorkerKey);
+#endif
+
+    return 0;
+}
+
+#if defined(SUPPORT_JOB_WORKER_THREADS)
+// Create job worker threads, one per additional processor by default
+// NOTE: Called with jobs mutex locked
+static void StartJobWorkers(void)
+{
+    pthread_once(&jobWorkerKeyOnce, InitJobWorkerKey);
+
+    int threadCount = jobWorkerCount;
+
+    if (threadCount < 0)
+    {
+        // Caller thread is also processing jobs while waiting for them
+        long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+        threadCount = (processorCount > 1)? (int)processorCount - 1 : 0;
+    }
+
+    if (threadCount > MAX_JOB_WORKER_THREADS) threadCount = MAX_JOB_WORKER_THREADS;
+
+    jobs.quit = false;
+    jobs.threadCount = 0;
+
+    for (int i = 0; i < threadCount; i++)
+    {
+        // Worker thread queue index is passed as argument, queue 0 is used by non-worker threads
+        if (pthread_create(&jobs.threads[jobs.threadCount], NULL, JobWorkerThreadLoop, (void *)(size_t)(jobs.threadCount + 1)) == 0) jobs.threadCount++;
+        else TRACELOG(LOG_WARNING, "JOBS: Failed to create worker thread");
+    }
+
+    jobs.ready = true;
+
+    TRACELOG(LOG_INFO, "JOBS: Worker threads initialized successfully (%i threads)", jobs.threadCount);
+}
+
+// Init job worker threads key, storing worker queue index
+static void InitJobWorkerKey(void)
+{
+    pthread_key_create(&jobWorkerKey, NULL);
+}
+
+// Job worker thread loop, queued jobs are processed until exit is requested and no job is left
+static void *JobWorkerThreadLoop(void *arg)
+{
+    pthread_setspecific(jobWorkerKey, arg);
+
+    pthread_mutex_lock(&jobsLock);
+
+    while (true)
+    {
+        if (RunJobChunk()) continue;
+        if (jobs.quit) break;
+
+        jobs.sleeping++;
+        pthread_cond_wait(&jobsCond, &jobsLock);
+        jobs.sleeping--;
+    }
+
+    pthread_mutex_unlock(&jobsLock);
+
+    return NULL;
+}
+#endif
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *data, int dataSize)
 {
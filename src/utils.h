@@ -27,6 +27,8 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+#include <stddef.h>                         // Required for: size_t
+
 #if defined(PLATFORM_ANDROID)
     #include <stdio.h>                      // Required for: FILE
     #include <android/asset_manager.h>      // Required for: AAssetManager
@@ -52,10 +54,39 @@
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
+#if defined(SUPPORT_CPU_PROFILER)
+    #define PROFILE_ZONE_BEGIN(name) rl_BeginProfileZone(name)
+    #define PROFILE_ZONE_END() rl_EndProfileZone()
+#else
+    #define PROFILE_ZONE_BEGIN(name) (void)0
+    #define PROFILE_ZONE_END() (void)0
+#endif
+
+// Memory tracking, modules allocations tagged with RL_MEMORY_MODULE (defined by every module)
+// NOTE: Custom allocators are set at runtime with rl_SetMemoryCallbacks(), RL_MALLOC overrides are replaced
+#if defined(SUPPORT_MEMORY_TRACKING)
+    #ifndef RL_MEMORY_MODULE
+        #define RL_MEMORY_MODULE MEMORY_MODULE_USER
+    #endif
+
+    #undef RL_MALLOC
+    #undef RL_CALLOC
+    #undef RL_REALLOC
+    #undef RL_FREE
+    #define RL_MALLOC(sz)       MemAllocTracked(1, (sz), RL_MEMORY_MODULE, MEMORY_PURPOSE_GENERAL, false)
+    #define RL_CALLOC(n,sz)     MemAllocTracked((n), (sz), RL_MEMORY_MODULE, MEMORY_PURPOSE_GENERAL, true)
+    #define RL_REALLOC(ptr,sz)  MemReallocTracked((ptr), (sz), RL_MEMORY_MODULE, MEMORY_PURPOSE_GENERAL)
+    #define RL_FREE(ptr)        rl_MemFreeTagged(ptr)
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Frame arena position, used to release scoped temporary allocations before frame end
+typedef struct MemoryFrameMark {
+    unsigned int offset;            // Arena memory used
+    unsigned char *overflow;        // Last overflow block
+} MemoryFrameMark;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -74,6 +105,16 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+void CloseFileWorkerThreads(void);                                     // Close file I/O worker threads, queued requests are completed
+void CloseJobWorkers(void);                                            // Close job system worker threads, queued jobs are completed
+void UnloadMemoryFrameArena(void);                                     // Unload frame arena memory
+void UnloadProfileZones(void);                                         // Unload CPU profiler zones of all threads
+MemoryFrameMark GetMemoryFrameMark(void);                              // Get frame arena current position
+void ReleaseMemoryFrame(MemoryFrameMark mark);                         // Release frame arena allocations done after mark
+void *MemAllocTracked(size_t count, size_t size, int module, int purpose, bool clear); // Tagged memory allocator, used by RL_MALLOC/RL_CALLOC on memory tracking
+void *MemReallocTracked(void *ptr, size_t size, int module, int purpose); // Tagged memory reallocator, used by RL_REALLOC on memory tracking
+bool IsArchiveFile(const char *fileName);                              // Check if file is available in a mounted archive
+
 #if defined(__cplusplus)
 }
 #endif
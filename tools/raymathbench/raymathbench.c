@@ -0,0 +1,405 @@
+/**********************************************************************************************
+
+    raymathbench - raymath precision and performance benchmark
+
+    Evaluates raymath hot functions over arrays of pseudo-random inputs, with default functions
+    and with RAYMATH_FAST_MATH approximations, reporting maximum error against double precision
+    references and time per call, to check documented error bounds and measure speedups.
+
+    FUNCTIONS:
+     - InvSqrt:                 1.0f/sqrtf(x) vs FastInvSqrt(x), x in [1e-4, 1e4], relative error
+     - Sin, Cos:                sinf()/cosf() vs FastSin()/FastCos(), angles in [-2*PI, 2*PI]
+     - Vector3Normalize:        Components in [-100, 100]
+     - QuaternionSlerp:         Random unit quaternions, amount in [0, 1]
+     - QuaternionFromAxisAngle: Random axes, angles in [-2*PI, 2*PI]
+     - MatrixRotate:            Random axes, angles in [-2*PI, 2*PI]
+
+    Errors are absolute except for InvSqrt, maximum error over all components is reported.
+
+    USAGE:
+
+        > raymathbench [--help] [--count <count>] [--iterations <count>]
+
+    OPTIONS:
+
+        -h, --help                      : Show tool version and command line usage help
+
+        -c, --count <count>             : Inputs evaluated per function
+                                          NOTE: If not specified, defaults to 65536
+
+        -i, --iterations <count>        : Times inputs are evaluated for timing
+                                          NOTE: If not specified, defaults to 50
+
+    BUILD OPTIONS:
+        raymath configuration is defined at compile time, check Makefile variables:
+        SIMD (RAYMATH_USE_SIMD_INTRINSICS)
+
+    LICENSE: zlib/libpng
+
+    raymathbench is licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+    BSD-like license that allows static linking with closed source software:
+
+    Copyright (c) 2026 Ramon Santamaria (@raysan5)
+
+**********************************************************************************************/
+
+#if !defined(_WIN32)
+    #define _POSIX_C_SOURCE 200112L     // Required for: CLOCK_MONOTONIC if compiled with c99 without GNU extensions
+#endif
+
+#include <stdlib.h>             // Required for: malloc(), free(), atoi()
+#include <stdio.h>              // Required for: printf()
+#include <string.h>             // Required for: strcmp()
+#include <stdint.h>             // Required for: uint32_t
+#include <math.h>               // Required for: sqrt(), sin(), cos(), acos(), fabs(), powf()
+
+#if defined(_WIN32)
+    #include <windows.h>        // Required for: QueryPerformanceCounter(), QueryPerformanceFrequency()
+#else
+    #include <time.h>           // Required for: clock_gettime()
+#endif
+
+#include "raymathbench_kernels.h"
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RAYMATHBENCH_VERSION    "1.0"
+
+#define DEFAULT_COUNT        65536      // Inputs evaluated per function
+#define DEFAULT_ITERATIONS      50      // Times inputs are evaluated for timing
+
+#define BENCH_PI    3.14159265358979323846
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef enum {
+    BENCH_INVSQRT = 0,
+    BENCH_SIN,
+    BENCH_COS,
+    BENCH_VECTOR3_NORMALIZE,
+    BENCH_QUATERNION_SLERP,
+    BENCH_QUATERNION_FROM_AXIS_ANGLE,
+    BENCH_MATRIX_ROTATE,
+    BENCH_COUNT
+} BenchFunction;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const char *functionNames[BENCH_COUNT] = {
+    "InvSqrt", "Sin", "Cos", "Vector3Normalize", "QuaternionSlerp", "QuaternionFromAxisAngle", "MatrixRotate"
+};
+static const int resultComponents[BENCH_COUNT] = { 1, 1, 1, 3, 4, 4, 16 };
+
+// Inputs, shared by all functions
+static float *values = NULL;        // Positive values, 1 per input
+static float *angles = NULL;        // Angles in radians, 1 per input
+static float *amounts = NULL;       // Interpolation amounts, 1 per input
+static float *vectors = NULL;       // Vectors (also used as axes), 3 per input
+static float *quats1 = NULL;        // Unit quaternions, 4 per input
+static float *quats2 = NULL;        // Unit quaternions, 4 per input
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void ShowCommandLineInfo(void);          // Show command line usage info
+static double GetTimeSeconds(void);             // Get monotonic time in seconds
+static float GetRandomFloat(uint32_t *seed, float min, float max);  // Get pseudo-random float, deterministic sequence
+
+static void LoadInputs(int count);              // Load pseudo-random inputs
+static void UnloadInputs(void);                 // Unload inputs
+
+static void RunKernel(int function, int fast, float *results, int count);       // Run precise or fast kernel of a function
+static void ComputeReference(int function, double *reference, int count);       // Compute function results in double precision
+static double GetMaxError(int function, const float *results, const double *reference, int count);   // Get maximum error against reference
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    int count = DEFAULT_COUNT;
+    int iterations = DEFAULT_ITERATIONS;
+
+    // Process command line arguments
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-h") == 0) || (strcmp(argv[i], "--help") == 0))
+        {
+            ShowCommandLineInfo();
+            return 0;
+        }
+        else if (((strcmp(argv[i], "-c") == 0) || (strcmp(argv[i], "--count") == 0)) && ((i + 1) < argc))
+        {
+            count = atoi(argv[++i]);
+            if (count <= 0) count = DEFAULT_COUNT;
+        }
+        else if (((strcmp(argv[i], "-i") == 0) || (strcmp(argv[i], "--iterations") == 0)) && ((i + 1) < argc))
+        {
+            iterations = atoi(argv[++i]);
+            if (iterations <= 0) iterations = DEFAULT_ITERATIONS;
+        }
+        else
+        {
+            printf("WARNING: Argument not recognized: %s\n", argv[i]);
+            ShowCommandLineInfo();
+            return 1;
+        }
+    }
+
+    LoadInputs(count);
+
+    float *results = (float *)malloc((size_t)count*16*sizeof(float));
+    double *reference = (double *)malloc((size_t)count*16*sizeof(double));
+
+    printf("\nraymathbench v%s | SIMD: %s | inputs: %i | iterations: %i\n\n", RAYMATHBENCH_VERSION,
+#if defined(RAYMATH_USE_SIMD_INTRINSICS)
+        "yes",
+#else
+        "no",
+#endif
+        count, iterations);
+
+    printf("%-24s %5s %13s %13s %11s %11s %8s\n",
+        "function", "error", "precise", "fast", "precise ns", "fast ns", "speedup");
+
+    for (int function = 0; function < BENCH_COUNT; function++)
+    {
+        double error[2] = { 0 };
+        double time[2] = { 0 };
+
+        ComputeReference(function, reference, count);
+
+        for (int fast = 0; fast < 2; fast++)
+        {
+            // First run not measured, it warms up caches
+            RunKernel(function, fast, results, count);
+            error[fast] = GetMaxError(function, results, reference, count);
+
+            double time0 = GetTimeSeconds();
+            for (int i = 0; i < iterations; i++) RunKernel(function, fast, results, count);
+            time[fast] = (GetTimeSeconds() - time0)*1e9/((double)iterations*count);
+        }
+
+        printf("%-24s %5s %13.3e %13.3e %11.2f %11.2f %7.2fx\n", functionNames[function],
+            (function == BENCH_INVSQRT)? "rel" : "abs", error[0], error[1], time[0], time[1],
+            (time[1] > 0.0)? time[0]/time[1] : 0.0);
+    }
+
+    printf("\nNOTE: Errors measured against double precision references, time per call in ns\n");
+
+    free(reference);
+    free(results);
+    UnloadInputs();
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Show command line usage info
+static void ShowCommandLineInfo(void)
+{
+    printf("\n//////////////////////////////////////////////////////////////////////////////////\n");
+    printf("//                                                                              //\n");
+    printf("// raymathbench v%s - raymath precision and performance benchmark              //\n", RAYMATHBENCH_VERSION);
+    printf("//                                                                              //\n");
+    printf("// more info and bugs-report: github.com/raysan5/raylib/tools/raymathbench      //\n");
+    printf("//                                                                              //\n");
+    printf("// Copyright (c) 2026 Ramon Santamaria (@raysan5)                               //\n");
+    printf("//                                                                              //\n");
+    printf("//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+    printf("USAGE:\n\n");
+    printf("    > raymathbench [--help] [--count <count>] [--iterations <count>]\n");
+
+    printf("\nOPTIONS:\n\n");
+    printf("    -h, --help                      : Show tool version and command line usage help\n\n");
+    printf("    -c, --count <count>             : Inputs evaluated per function\n");
+    printf("                                      NOTE: If not specified, defaults to %i\n\n", DEFAULT_COUNT);
+    printf("    -i, --iterations <count>        : Times inputs are evaluated for timing\n");
+    printf("                                      NOTE: If not specified, defaults to %i\n\n", DEFAULT_ITERATIONS);
+
+    printf("\nEXAMPLES:\n\n");
+    printf("    > raymathbench --count 1000000 --iterations 10\n");
+    printf("        Evaluate 1000000 inputs per function, 10 times each\n\n");
+}
+
+// Get monotonic time in seconds
+static double GetTimeSeconds(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart/(double)frequency.QuadPart;
+#else
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#endif
+}
+
+// Get pseudo-random float in [min, max], deterministic sequence (xorshift32)
+static float GetRandomFloat(uint32_t *seed, float min, float max)
+{
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 17;
+    *seed ^= *seed << 5;
+
+    return min + (max - min)*(float)(*seed >> 8)/16777215.0f;
+}
+
+// Load pseudo-random inputs
+static void LoadInputs(int count)
+{
+    uint32_t seed = 0x12345678;
+
+    values = (float *)malloc((size_t)count*sizeof(float));
+    angles = (float *)malloc((size_t)count*sizeof(float));
+    amounts = (float *)malloc((size_t)count*sizeof(float));
+    vectors = (float *)malloc((size_t)count*3*sizeof(float));
+    quats1 = (float *)malloc((size_t)count*4*sizeof(float));
+    quats2 = (float *)malloc((size_t)count*4*sizeof(float));
+
+    for (int i = 0; i < count; i++)
+    {
+        // Values distributed evenly over exponents
+        values[i] = powf(10.0f, GetRandomFloat(&seed, -4.0f, 4.0f));
+        angles[i] = GetRandomFloat(&seed, -2.0f*(float)BENCH_PI, 2.0f*(float)BENCH_PI);
+        amounts[i] = GetRandomFloat(&seed, 0.0f, 1.0f);
+
+        // Vectors not too close to zero, they are also used as rotation axes
+        do
+        {
+            for (int k = 0; k < 3; k++) vectors[i*3 + k] = GetRandomFloat(&seed, -100.0f, 100.0f);
+        } while ((fabsf(vectors[i*3]) + fabsf(vectors[i*3 + 1]) + fabsf(vectors[i*3 + 2])) < 1.0f);
+
+        float *quats[2] = { quats1, quats2 };
+        for (int q = 0; q < 2; q++)
+        {
+            double length = 0.0;
+            do
+            {
+                length = 0.0;
+                for (int k = 0; k < 4; k++)
+                {
+                    quats[q][i*4 + k] = GetRandomFloat(&seed, -1.0f, 1.0f);
+                    length += (double)quats[q][i*4 + k]*quats[q][i*4 + k];
+                }
+            } while (length < 0.01);
+
+            for (int k = 0; k < 4; k++) quats[q][i*4 + k] = (float)(quats[q][i*4 + k]/sqrt(length));
+        }
+    }
+}
+
+// Unload inputs
+static void UnloadInputs(void)
+{
+    free(values);
+    free(angles);
+    free(amounts);
+    free(vectors);
+    free(quats1);
+    free(quats2);
+}
+
+// Run precise or fast kernel of a function
+static void RunKernel(int function, int fast, float *results, int count)
+{
+    switch (function)
+    {
+        case BENCH_INVSQRT: (fast? BenchInvSqrtFast : BenchInvSqrtPrecise)(values, results, count); break;
+        case BENCH_SIN: (fast? BenchSinFast : BenchSinPrecise)(angles, results, count); break;
+        case BENCH_COS: (fast? BenchCosFast : BenchCosPrecise)(angles, results, count); break;
+        case BENCH_VECTOR3_NORMALIZE: (fast? BenchVector3NormalizeFast : BenchVector3NormalizePrecise)(vectors, results, count); break;
+        case BENCH_QUATERNION_SLERP: (fast? BenchQuaternionSlerpFast : BenchQuaternionSlerpPrecise)(quats1, quats2, amounts, results, count); break;
+        case BENCH_QUATERNION_FROM_AXIS_ANGLE: (fast? BenchQuaternionFromAxisAngleFast : BenchQuaternionFromAxisAnglePrecise)(vectors, angles, results, count); break;
+        case BENCH_MATRIX_ROTATE: (fast? BenchMatrixRotateFast : BenchMatrixRotatePrecise)(vectors, angles, results, count); break;
+        default: break;
+    }
+}
+
+// Compute function results in double precision
+// NOTE: Results follow raymath layouts and conventions, slerp takes the shortest path
+static void ComputeReference(int function, double *reference, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        double *r = reference + i*resultComponents[function];
+        const float *v = vectors + i*3;
+
+        switch (function)
+        {
+            case BENCH_INVSQRT: r[0] = 1.0/sqrt((double)values[i]); break;
+            case BENCH_SIN: r[0] = sin((double)angles[i]); break;
+            case BENCH_COS: r[0] = cos((double)angles[i]); break;
+            case BENCH_VECTOR3_NORMALIZE:
+            {
+                double length = sqrt((double)v[0]*v[0] + (double)v[1]*v[1] + (double)v[2]*v[2]);
+                for (int k = 0; k < 3; k++) r[k] = v[k]/length;
+            } break;
+            case BENCH_QUATERNION_SLERP:
+            {
+                const float *q1 = quats1 + i*4;
+                const float *q2 = quats2 + i*4;
+                double dot = 0.0;
+                for (int k = 0; k < 4; k++) dot += (double)q1[k]*q2[k];
+                double sign = (dot < 0.0)? -1.0 : 1.0;
+                dot = fabs(dot);
+                if (dot > 1.0) dot = 1.0;
+
+                double theta = acos(dot);
+                double ratioA = 1.0 - amounts[i];
+                double ratioB = amounts[i];
+                if (sin(theta) > 1e-9)
+                {
+                    ratioA = sin((1.0 - amounts[i])*theta)/sin(theta);
+                    ratioB = sin(amounts[i]*theta)/sin(theta);
+                }
+                for (int k = 0; k < 4; k++) r[k] = ratioA*q1[k] + ratioB*sign*q2[k];
+            } break;
+            case BENCH_QUATERNION_FROM_AXIS_ANGLE:
+            {
+                double length = sqrt((double)v[0]*v[0] + (double)v[1]*v[1] + (double)v[2]*v[2]);
+                double sinres = sin(0.5*angles[i]);
+                for (int k = 0; k < 3; k++) r[k] = v[k]/length*sinres;
+                r[3] = cos(0.5*angles[i]);
+            } break;
+            case BENCH_MATRIX_ROTATE:
+            {
+                double length = sqrt((double)v[0]*v[0] + (double)v[1]*v[1] + (double)v[2]*v[2]);
+                double x = v[0]/length, y = v[1]/length, z = v[2]/length;
+                double sinres = sin((double)angles[i]);
+                double cosres = cos((double)angles[i]);
+                double t = 1.0 - cosres;
+
+                r[0] = x*x*t + cosres; r[1] = y*x*t + z*sinres; r[2] = z*x*t - y*sinres; r[3] = 0.0;
+                r[4] = x*y*t - z*sinres; r[5] = y*y*t + cosres; r[6] = z*y*t + x*sinres; r[7] = 0.0;
+                r[8] = x*z*t + y*sinres; r[9] = y*z*t - x*sinres; r[10] = z*z*t + cosres; r[11] = 0.0;
+                r[12] = 0.0; r[13] = 0.0; r[14] = 0.0; r[15] = 1.0;
+            } break;
+            default: break;
+        }
+    }
+}
+
+// Get maximum error against reference, relative for InvSqrt, absolute otherwise
+static double GetMaxError(int function, const float *results, const double *reference, int count)
+{
+    double maxError = 0.0;
+    int components = count*resultComponents[function];
+
+    for (int i = 0; i < components; i++)
+    {
+        double error = fabs((double)results[i] - reference[i]);
+        if (function == BENCH_INVSQRT) error /= fabs(reference[i]);
+        if (error > maxError) maxError = error;
+    }
+
+    return maxError;
+}
@@ -0,0 +1,103 @@
+/**********************************************************************************************
+
+    raymathbench kernels - raymath functions evaluated over arrays
+
+    This file is compiled twice by raymathbench Makefile, with and without RAYMATH_FAST_MATH,
+    kernels names get a Precise or Fast suffix accordingly, so both raymath configurations
+    can be measured and compared by the same benchmark binary
+
+    LICENSE: zlib/libpng
+
+    Copyright (c) 2026 Ramon Santamaria (@raysan5)
+
+**********************************************************************************************/
+
+#define RAYMATH_STATIC_INLINE
+#include "../../src/raymath.h"
+
+#include "raymathbench_kernels.h"
+
+#if defined(RAYMATH_FAST_MATH)
+    #define KERNEL(name) name##Fast
+#else
+    #define KERNEL(name) name##Precise
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+void KERNEL(BenchInvSqrt)(const float *values, float *results, int count)
+{
+#if defined(RAYMATH_FAST_MATH)
+    for (int i = 0; i < count; i++) results[i] = FastInvSqrt(values[i]);
+#else
+    for (int i = 0; i < count; i++) results[i] = 1.0f/sqrtf(values[i]);
+#endif
+}
+
+void KERNEL(BenchSin)(const float *angles, float *results, int count)
+{
+#if defined(RAYMATH_FAST_MATH)
+    for (int i = 0; i < count; i++) results[i] = FastSin(angles[i]);
+#else
+    for (int i = 0; i < count; i++) results[i] = sinf(angles[i]);
+#endif
+}
+
+void KERNEL(BenchCos)(const float *angles, float *results, int count)
+{
+#if defined(RAYMATH_FAST_MATH)
+    for (int i = 0; i < count; i++) results[i] = FastCos(angles[i]);
+#else
+    for (int i = 0; i < count; i++) results[i] = cosf(angles[i]);
+#endif
+}
+
+void KERNEL(BenchVector3Normalize)(const float *vectors, float *results, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        rl_Vector3 v = { vectors[i*3], vectors[i*3 + 1], vectors[i*3 + 2] };
+        v = Vector3Normalize(v);
+        results[i*3] = v.x;
+        results[i*3 + 1] = v.y;
+        results[i*3 + 2] = v.z;
+    }
+}
+
+void KERNEL(BenchQuaternionSlerp)(const float *quats1, const float *quats2, const float *amounts, float *results, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        rl_Quaternion q1 = { quats1[i*4], quats1[i*4 + 1], quats1[i*4 + 2], quats1[i*4 + 3] };
+        rl_Quaternion q2 = { quats2[i*4], quats2[i*4 + 1], quats2[i*4 + 2], quats2[i*4 + 3] };
+        rl_Quaternion q = QuaternionSlerp(q1, q2, amounts[i]);
+        results[i*4] = q.x;
+        results[i*4 + 1] = q.y;
+        results[i*4 + 2] = q.z;
+        results[i*4 + 3] = q.w;
+    }
+}
+
+void KERNEL(BenchQuaternionFromAxisAngle)(const float *axes, const float *angles, float *results, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        rl_Vector3 axis = { axes[i*3], axes[i*3 + 1], axes[i*3 + 2] };
+        rl_Quaternion q = QuaternionFromAxisAngle(axis, angles[i]);
+        results[i*4] = q.x;
+        results[i*4 + 1] = q.y;
+        results[i*4 + 2] = q.z;
+        results[i*4 + 3] = q.w;
+    }
+}
+
+void KERNEL(BenchMatrixRotate)(const float *axes, const float *angles, float *results, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        rl_Vector3 axis = { axes[i*3], axes[i*3 + 1], axes[i*3 + 2] };
+        rl_float16 m = MatrixToFloatV(MatrixRotate(axis, angles[i]));
+        for (int k = 0; k < 16; k++) results[i*16 + k] = m.v[k];
+    }
+}
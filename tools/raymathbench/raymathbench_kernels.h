@@ -0,0 +1,35 @@
+/**********************************************************************************************
+
+    raymathbench kernels - raymath functions evaluated over arrays
+
+    Precise kernels use default raymath functions, Fast kernels use RAYMATH_FAST_MATH functions,
+    vectors are packed arrays of floats (3 per rl_Vector3, 4 per rl_Quaternion, 16 per rl_Matrix)
+
+    LICENSE: zlib/libpng
+
+    Copyright (c) 2026 Ramon Santamaria (@raysan5)
+
+**********************************************************************************************/
+
+#ifndef RAYMATHBENCH_KERNELS_H
+#define RAYMATHBENCH_KERNELS_H
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+void BenchInvSqrtPrecise(const float *values, float *results, int count);
+void BenchInvSqrtFast(const float *values, float *results, int count);
+void BenchSinPrecise(const float *angles, float *results, int count);
+void BenchSinFast(const float *angles, float *results, int count);
+void BenchCosPrecise(const float *angles, float *results, int count);
+void BenchCosFast(const float *angles, float *results, int count);
+void BenchVector3NormalizePrecise(const float *vectors, float *results, int count);
+void BenchVector3NormalizeFast(const float *vectors, float *results, int count);
+void BenchQuaternionSlerpPrecise(const float *quats1, const float *quats2, const float *amounts, float *results, int count);
+void BenchQuaternionSlerpFast(const float *quats1, const float *quats2, const float *amounts, float *results, int count);
+void BenchQuaternionFromAxisAnglePrecise(const float *axes, const float *angles, float *results, int count);
+void BenchQuaternionFromAxisAngleFast(const float *axes, const float *angles, float *results, int count);
+void BenchMatrixRotatePrecise(const float *axes, const float *angles, float *results, int count);
+void BenchMatrixRotateFast(const float *axes, const float *angles, float *results, int count);
+
+#endif // RAYMATHBENCH_KERNELS_H
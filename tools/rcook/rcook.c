@@ -0,0 +1,412 @@
+/**********************************************************************************************
+
+    rcook - raylib offline assets cooking tool
+
+    Converts source assets into runtime ready formats with raylib loaders, so the game loads
+    them without decoding, rasterization or vertex processing. Cooked assets are loaded by the
+    same raylib loading functions, file format is selected by extension.
+
+    COOKED ASSETS:
+     - Images (.png, .bmp, .tga, .jpg, .gif, .psd, .hdr, .qoi, .dds) -> .ktx
+         Mipmaps generated and optionally GPU compressed (DXT, ETC2, BC7), uploaded as is by rl_LoadTexture()
+     - Models (.obj, .iqm, .gltf, .glb, .vox, .m3d) -> .rmdl
+         Meshes, materials, textures, skeleton and animations, loaded by rl_LoadModel() and rl_LoadModelAnimations()
+     - Fonts (.ttf, .otf) -> .rfnt
+         Glyphs metrics, kerning pairs and pre-rasterized atlas, loaded by rl_LoadFont()
+     - Sounds (.wav, .ogg, .mp3, .flac, .qoa) -> .wav or .qoa
+         Decoded and converted to the target sample rate, 16 bit PCM (no decoding on load) or QOA (fast decoding)
+
+    Source directory tree is replicated in output directory, assets are only cooked again if the
+    source file is newer than the cooked file, unless --force is provided.
+
+    USAGE:
+
+        > rcook [--help] --input <dir> --output <dir> [--texture-format <format>] [--font-size <size>]
+                [--font-type <type>] [--audio-format <format>] [--sample-rate <rate>] [--force]
+
+    OPTIONS:
+
+        -h, --help                      : Show tool version and command line usage help
+
+        -i, --input <dir>               : Source assets directory, scanned recursively
+
+        -o, --output <dir>              : Cooked assets directory, created if it does not exist
+
+        -t, --texture-format <format>   : Textures compression format: none, dxt1, dxt5, etc2, bc7
+                                          NOTE: If not specified, textures are not compressed
+
+        -s, --font-size <size>          : Fonts atlas glyphs size in pixels
+                                          NOTE: If not specified, defaults to 32
+
+        -y, --font-type <type>          : Fonts atlas type: default, sdf, msdf
+                                          NOTE: If not specified, defaults to default (bitmap glyphs)
+
+        -a, --audio-format <format>     : Sounds output format: wav (16 bit PCM), qoa
+                                          NOTE: If not specified, defaults to wav
+
+        -r, --sample-rate <rate>        : Sounds output sample rate, should match audio device sample rate
+                                          NOTE: If not specified, defaults to 48000
+
+        -f, --force                     : Cook all assets, even if cooked files are up to date
+
+    LICENSE: zlib/libpng
+
+    rcook is licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+    BSD-like license that allows static linking with closed source software:
+
+    Copyright (c) 2026 Ramon Santamaria (@raysan5)
+
+**********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>          // Required for: printf()
+#include <stdlib.h>         // Required for: atoi()
+#include <string.h>         // Required for: strcmp(), strncpy(), strlen()
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RCOOK_VERSION           "1.0"
+
+#define MAX_PATH_LENGTH           512       // Maximum assets file path length
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Asset type, selected by source file extension
+typedef enum {
+    ASSET_NONE = 0,
+    ASSET_IMAGE,
+    ASSET_MODEL,
+    ASSET_FONT,
+    ASSET_SOUND
+} AssetType;
+
+// Cooking options, from command line
+typedef struct CookOptions {
+    int textureFormat;              // Textures compression pixel format, 0: not compressed
+    int fontSize;                   // Fonts atlas glyphs size
+    int fontType;                   // Fonts atlas type (rl_FontType)
+    bool audioQoa;                  // Sounds exported as QOA instead of PCM WAV
+    int sampleRate;                 // Sounds output sample rate
+    bool force;                     // Cook all assets, even if cooked files are up to date
+} CookOptions;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void ShowCommandLineInfo(void);                  // Show command line usage info
+static AssetType GetAssetType(const char *fileName);    // Get asset type from file extension
+static const char *GetCookedExtension(AssetType type, CookOptions options); // Get cooked file extension for asset type
+static bool CookImage(const char *srcFile, const char *dstFile, CookOptions options); // Cook image into mipmapped (compressed) KTX texture
+static bool CookModel(const char *srcFile, const char *dstFile, CookOptions options); // Cook model and animations into model cache file
+static bool CookFont(const char *srcFile, const char *dstFile, CookOptions options);  // Cook font into pre-rasterized font atlas file
+static bool CookSound(const char *srcFile, const char *dstFile, CookOptions options); // Cook sound into PCM WAV or QOA file
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    const char *inputDir = NULL;
+    const char *outputDir = NULL;
+    CookOptions options = { 0, 32, FONT_DEFAULT, false, 48000, false };
+
+    // Process command line arguments
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-h") == 0) || (strcmp(argv[i], "--help") == 0))
+        {
+            ShowCommandLineInfo();
+            return 0;
+        }
+        else if (((strcmp(argv[i], "-i") == 0) || (strcmp(argv[i], "--input") == 0)) && ((i + 1) < argc)) inputDir = argv[++i];
+        else if (((strcmp(argv[i], "-o") == 0) || (strcmp(argv[i], "--output") == 0)) && ((i + 1) < argc)) outputDir = argv[++i];
+        else if (((strcmp(argv[i], "-t") == 0) || (strcmp(argv[i], "--texture-format") == 0)) && ((i + 1) < argc))
+        {
+            i++;
+            if (strcmp(argv[i], "none") == 0) options.textureFormat = 0;
+            else if (strcmp(argv[i], "dxt1") == 0) options.textureFormat = PIXELFORMAT_COMPRESSED_DXT1_RGBA;
+            else if (strcmp(argv[i], "dxt5") == 0) options.textureFormat = PIXELFORMAT_COMPRESSED_DXT5_RGBA;
+            else if (strcmp(argv[i], "etc2") == 0) options.textureFormat = PIXELFORMAT_COMPRESSED_ETC2_EAC_RGBA;
+            else if (strcmp(argv[i], "bc7") == 0) options.textureFormat = PIXELFORMAT_COMPRESSED_BC7_RGBA;
+            else
+            {
+                printf("WARNING: Texture format not recognized: %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (((strcmp(argv[i], "-s") == 0) || (strcmp(argv[i], "--font-size") == 0)) && ((i + 1) < argc))
+        {
+            options.fontSize = atoi(argv[++i]);
+            if (options.fontSize <= 0) options.fontSize = 32;
+        }
+        else if (((strcmp(argv[i], "-y") == 0) || (strcmp(argv[i], "--font-type") == 0)) && ((i + 1) < argc))
+        {
+            i++;
+            if (strcmp(argv[i], "default") == 0) options.fontType = FONT_DEFAULT;
+            else if (strcmp(argv[i], "sdf") == 0) options.fontType = FONT_SDF;
+            else if (strcmp(argv[i], "msdf") == 0) options.fontType = FONT_MSDF;
+            else
+            {
+                printf("WARNING: Font type not recognized: %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (((strcmp(argv[i], "-a") == 0) || (strcmp(argv[i], "--audio-format") == 0)) && ((i + 1) < argc))
+        {
+            i++;
+            if (strcmp(argv[i], "wav") == 0) options.audioQoa = false;
+            else if (strcmp(argv[i], "qoa") == 0) options.audioQoa = true;
+            else
+            {
+                printf("WARNING: Audio format not recognized: %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (((strcmp(argv[i], "-r") == 0) || (strcmp(argv[i], "--sample-rate") == 0)) && ((i + 1) < argc))
+        {
+            options.sampleRate = atoi(argv[++i]);
+            if (options.sampleRate <= 0) options.sampleRate = 48000;
+        }
+        else if ((strcmp(argv[i], "-f") == 0) || (strcmp(argv[i], "--force") == 0)) options.force = true;
+        else
+        {
+            printf("WARNING: Argument not recognized: %s\n", argv[i]);
+            ShowCommandLineInfo();
+            return 1;
+        }
+    }
+
+    if ((inputDir == NULL) || (outputDir == NULL) || !rl_DirectoryExists(inputDir))
+    {
+        printf("WARNING: Valid input and output directories are required\n");
+        ShowCommandLineInfo();
+        return 1;
+    }
+
+    // NOTE: Graphics context is required, models and fonts loaders upload textures to GPU,
+    // models export reads them back, window is not shown
+    rl_SetTraceLogLevel(LOG_WARNING);
+    rl_SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    rl_InitWindow(64, 64, "rcook");
+
+    rl_FilePathList files = rl_LoadDirectoryFilesEx(inputDir, NULL, true);
+    int inputDirLength = (int)strlen(inputDir);
+    int cookedCount = 0;
+    int skippedCount = 0;
+    int failedCount = 0;
+
+    printf("\nrcook v%s | %i source files | input: %s | output: %s\n\n", RCOOK_VERSION, files.count, inputDir, outputDir);
+
+    for (unsigned int i = 0; i < files.count; i++)
+    {
+        const char *srcFile = files.paths[i];
+        AssetType type = GetAssetType(srcFile);
+
+        if (type == ASSET_NONE) continue;
+
+        // Output file path: source path relative to input directory, cooked extension
+        const char *relPath = srcFile + inputDirLength;
+        while ((relPath[0] == '/') || (relPath[0] == '\\')) relPath++;
+
+        char dstFile[MAX_PATH_LENGTH] = { 0 };
+        int extLength = (int)strlen(rl_GetFileExtension(relPath));
+        snprintf(dstFile, MAX_PATH_LENGTH, "%s/%.*s%s", outputDir, (int)strlen(relPath) - extLength, relPath, GetCookedExtension(type, options));
+
+        if (!options.force && rl_FileExists(dstFile) && (rl_GetFileModTime(dstFile) >= rl_GetFileModTime(srcFile)))
+        {
+            skippedCount++;
+            continue;
+        }
+
+        const char *dstDir = rl_GetDirectoryPath(dstFile);
+        if (!rl_DirectoryExists(dstDir)) rl_MakeDirectory(dstDir);
+
+        bool success = false;
+
+        switch (type)
+        {
+            case ASSET_IMAGE: success = CookImage(srcFile, dstFile, options); break;
+            case ASSET_MODEL: success = CookModel(srcFile, dstFile, options); break;
+            case ASSET_FONT: success = CookFont(srcFile, dstFile, options); break;
+            case ASSET_SOUND: success = CookSound(srcFile, dstFile, options); break;
+            default: break;
+        }
+
+        printf("%-8s %s -> %s\n", success? "COOKED" : "FAILED", srcFile, dstFile);
+
+        if (success) cookedCount++;
+        else failedCount++;
+    }
+
+    printf("\n%i cooked | %i up to date | %i failed\n", cookedCount, skippedCount, failedCount);
+
+    rl_UnloadDirectoryFiles(files);
+    rl_CloseWindow();
+
+    return (failedCount > 0)? 1 : 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Show command line usage info
+static void ShowCommandLineInfo(void)
+{
+    printf("\n////////////////////////////////////////////////////////////////////////////////////////////\n");
+    printf("//                                                                                        //\n");
+    printf("// rcook v%s - raylib offline assets cooking tool                                         //\n", RCOOK_VERSION);
+    printf("//                                                                                        //\n");
+    printf("// Copyright (c) 2026 Ramon Santamaria (@raysan5)                                         //\n");
+    printf("//                                                                                        //\n");
+    printf("////////////////////////////////////////////////////////////////////////////////////////////\n\n");
+
+    printf("USAGE:\n\n");
+    printf("    > rcook [--help] --input <dir> --output <dir> [--texture-format <format>] [--font-size <size>]\n");
+    printf("            [--font-type <type>] [--audio-format <format>] [--sample-rate <rate>] [--force]\n");
+
+    printf("\nOPTIONS:\n\n");
+    printf("    -h, --help                      : Show tool version and command line usage help\n\n");
+    printf("    -i, --input <dir>               : Source assets directory, scanned recursively\n\n");
+    printf("    -o, --output <dir>              : Cooked assets directory, created if it does not exist\n\n");
+    printf("    -t, --texture-format <format>   : Textures compression format: none, dxt1, dxt5, etc2, bc7\n");
+    printf("                                      NOTE: If not specified, textures are not compressed\n\n");
+    printf("    -s, --font-size <size>          : Fonts atlas glyphs size in pixels\n");
+    printf("                                      NOTE: If not specified, defaults to 32\n\n");
+    printf("    -y, --font-type <type>          : Fonts atlas type: default, sdf, msdf\n");
+    printf("                                      NOTE: If not specified, defaults to default (bitmap glyphs)\n\n");
+    printf("    -a, --audio-format <format>     : Sounds output format: wav (16 bit PCM), qoa\n");
+    printf("                                      NOTE: If not specified, defaults to wav\n\n");
+    printf("    -r, --sample-rate <rate>        : Sounds output sample rate, should match audio device sample rate\n");
+    printf("                                      NOTE: If not specified, defaults to 48000\n\n");
+    printf("    -f, --force                     : Cook all assets, even if cooked files are up to date\n\n");
+
+    printf("\nEXAMPLES:\n\n");
+    printf("    > rcook --input resources --output cooked --texture-format bc7 --font-type sdf\n");
+    printf("        Cook all assets in resources directory, BC7 compressed textures and SDF fonts\n\n");
+    printf("    > rcook -i resources -o cooked -a qoa -r 44100\n");
+    printf("        Cook all assets in resources directory, sounds as QOA at 44100 Hz\n\n");
+}
+
+// Get asset type from file extension
+static AssetType GetAssetType(const char *fileName)
+{
+    AssetType type = ASSET_NONE;
+
+    if (rl_IsFileExtension(fileName, ".png;.bmp;.tga;.jpg;.gif;.psd;.hdr;.qoi;.dds")) type = ASSET_IMAGE;
+    else if (rl_IsFileExtension(fileName, ".obj;.iqm;.gltf;.glb;.vox;.m3d")) type = ASSET_MODEL;
+    else if (rl_IsFileExtension(fileName, ".ttf;.otf")) type = ASSET_FONT;
+    else if (rl_IsFileExtension(fileName, ".wav;.ogg;.mp3;.flac;.qoa")) type = ASSET_SOUND;
+
+    return type;
+}
+
+// Get cooked file extension for asset type
+static const char *GetCookedExtension(AssetType type, CookOptions options)
+{
+    const char *ext = "";
+
+    switch (type)
+    {
+        case ASSET_IMAGE: ext = ".ktx"; break;
+        case ASSET_MODEL: ext = ".rmdl"; break;
+        case ASSET_FONT: ext = ".rfnt"; break;
+        case ASSET_SOUND: ext = options.audioQoa? ".qoa" : ".wav"; break;
+        default: break;
+    }
+
+    return ext;
+}
+
+// Cook image into mipmapped KTX texture, compressed if requested
+// NOTE: Block compression requires image size multiple of 4, images not fitting are kept uncompressed
+static bool CookImage(const char *srcFile, const char *dstFile, CookOptions options)
+{
+    bool success = false;
+    rl_Image image = rl_LoadImage(srcFile);
+
+    if (rl_IsImageValid(image))
+    {
+        if (image.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB) success = rl_ExportImage(image, dstFile);
+        else
+        {
+            if ((image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) && (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8)) rl_ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            rl_ImageMipmaps(&image);
+
+            if (options.textureFormat != 0)
+            {
+                if (((image.width%4) == 0) && ((image.height%4) == 0)) rl_ImageCompress(&image, options.textureFormat);
+                else printf("WARNING: [%s] Image size not multiple of 4, not compressed\n", srcFile);
+            }
+
+            success = rl_ExportImage(image, dstFile);
+        }
+    }
+
+    rl_UnloadImage(image);
+
+    return success;
+}
+
+// Cook model and animations into model cache file
+static bool CookModel(const char *srcFile, const char *dstFile, CookOptions options)
+{
+    bool success = false;
+    rl_Model model = rl_LoadModel(srcFile);
+
+    if (rl_IsModelValid(model))
+    {
+        int animCount = 0;
+        rl_ModelAnimation *animations = NULL;
+        if (rl_IsFileExtension(srcFile, ".iqm;.gltf;.glb;.m3d")) animations = rl_LoadModelAnimations(srcFile, &animCount);
+
+        success = rl_ExportModel(model, animations, animCount, dstFile);
+
+        rl_UnloadModelAnimations(animations, animCount);
+
+        for (int i = 0; i < model.materialCount; i++) rl_UnloadMaterial(model.materials[i]);
+        model.materialCount = 0;
+    }
+
+    rl_UnloadModel(model);
+
+    return success;
+}
+
+// Cook font into pre-rasterized font atlas file
+static bool CookFont(const char *srcFile, const char *dstFile, CookOptions options)
+{
+    bool success = false;
+    rl_Font font = { 0 };
+
+    if (options.fontType == FONT_DEFAULT) font = rl_LoadFontEx(srcFile, options.fontSize, NULL, 0);
+    else font = rl_LoadFontSDF(srcFile, options.fontSize, NULL, 0, options.fontType);
+
+    if (rl_IsFontValid(font) && (font.texture.id != rl_GetFontDefault().texture.id))
+    {
+        success = rl_ExportFont(font, dstFile);
+        rl_UnloadFont(font);
+    }
+
+    return success;
+}
+
+// Cook sound into PCM WAV or QOA file, converted to output sample rate
+// NOTE: Channels are kept, QOA requires 16 bit samples
+static bool CookSound(const char *srcFile, const char *dstFile, CookOptions options)
+{
+    bool success = false;
+    rl_Wave wave = rl_LoadWave(srcFile);
+
+    if (rl_IsWaveValid(wave))
+    {
+        rl_WaveFormat(&wave, options.sampleRate, 16, wave.channels);
+        success = rl_ExportWave(wave, dstFile);
+    }
+
+    rl_UnloadWave(wave);
+
+    return success;
+}
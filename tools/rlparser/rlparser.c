@@ -146,7 +146,7 @@ typedef struct FunctionInfo {
 } FunctionInfo;
 
 // Output format for parsed data
-typedef enum { DEFAULT = 0, JSON, XML, LUA, CODE } OutputFormat;
+typedef enum { DEFAULT = 0, JSON, XML, LUA, CODE, TRACE } OutputFormat;
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -194,6 +194,7 @@ static char *EscapeBackslashes(char *text);                 // Replace '\' by "\
 static const char *StrDefineType(DefineType type);          // Get string of define type
 
 static void ExportParsedData(const char *fileName, int format); // Export parsed data in desired format
+static void ExportTraceParams(FILE *outFile, const FunctionInfo *func, bool names); // Export function parameters list for TRACE format
 
 //----------------------------------------------------------------------------------
 // Program main entry point
@@ -1061,6 +1062,7 @@ int main(int argc, char* argv[])
     else if (outputFormat == XML) printf("\nOutput format:    XML\n\n");
     else if (outputFormat == LUA) printf("\nOutput format:    LUA\n\n");
     else if (outputFormat == CODE) printf("\nOutput format:    CODE\n\n");
+    else if (outputFormat == TRACE) printf("\nOutput format:    TRACE\n\n");
 
     ExportParsedData(outFileName, outputFormat);
 
@@ -1096,10 +1098,11 @@ static void ShowCommandLineInfo(void)
     printf("    -i, --input <filename.h>        : Define input header file to parse.\n");
     printf("                                      NOTE: If not specified, defaults to: raylib.h\n\n");
     printf("    -o, --output <filename.ext>     : Define output file and format.\n");
-    printf("                                      Supported extensions: .txt, .json, .xml, .lua, .h\n");
+    printf("                                      Supported extensions: .txt, .json, .xml, .lua, .h, .c\n");
     printf("                                      NOTE: If not specified, defaults to: raylib_api.txt\n\n");
     printf("    -f, --format <type>             : Define output format for parser data.\n");
-    printf("                                      Supported types: DEFAULT, JSON, XML, LUA, CODE\n\n");
+    printf("                                      Supported types: DEFAULT, JSON, XML, LUA, CODE, TRACE\n");
+    printf("                                      NOTE: TRACE generates a C tracing shim wrapping all API functions\n\n");
     printf("    -d, --define <DEF>              : Define functions specifiers (i.e. RLAPI for raylib.h, RMAPI for raymath.h, etc.)\n");
     printf("                                      NOTE: If no specifier defined, defaults to: RLAPI\n\n");
     printf("    -t, --truncate <after>          : Define string to truncate input after (i.e. \"RLGL IMPLEMENTATION\" for rlgl.h)\n");
@@ -1112,6 +1115,8 @@ static void ShowCommandLineInfo(void)
     printf("        Process <raylib.h> to generate <raylib_data.info> as XML text data\n\n");
     printf("    > rlparser --input raymath.h --output raymath_data.info --format XML --define RMAPI\n");
     printf("        Process <raymath.h> to generate <raymath_data.info> as XML text data\n\n");
+    printf("    > rlparser --input raylib.h --output raylib_trace.c --format TRACE --define rl_RLAPI\n");
+    printf("        Process <raylib.h> to generate <raylib_trace.c> API tracing shim\n\n");
 }
 
 // Process command line arguments
@@ -1153,6 +1158,7 @@ static void ProcessCommandLine(int argc, char *argv[])
                 else if (IsTextEqual(argv[i + 1], "XML\0", 4)) outputFormat = XML;
                 else if (IsTextEqual(argv[i + 1], "LUA\0", 4)) outputFormat = LUA;
                 else if (IsTextEqual(argv[i + 1], "CODE\0", 4)) outputFormat = CODE;
+                else if (IsTextEqual(argv[i + 1], "TRACE\0", 6)) outputFormat = TRACE;
             }
             else printf("WARNING: No format parameters provided\n");
         }
@@ -2005,9 +2011,247 @@ static void ExportParsedData(const char *fileName, int format)
             fprintf(outFile, "  }\n");
             fprintf(outFile, "}\n");
         } break;
+        case TRACE:
+        {
+            // Get input header file name, included by the generated shim
+            const char *headerName = inFileName;
+            for (int c = 0; inFileName[c] != '\0'; c++) if ((inFileName[c] == '/') || (inFileName[c] == '\\')) headerName = &inFileName[c + 1];
+
+            fprintf(outFile, "/**********************************************************************************************\n");
+            fprintf(outFile, "*\n");
+            fprintf(outFile, "*   %s API tracing shim - Call frequency and cost capture for every %s function\n", headerName, apiDefine);
+            fprintf(outFile, "*\n");
+            fprintf(outFile, "*   NOTE: This file has been generated by rlparser from %s, do not edit it manually\n", headerName);
+            fprintf(outFile, "*\n");
+            fprintf(outFile, "*   Every API function is wrapped with counting and timing, only calls done by the application\n");
+            fprintf(outFile, "*   are measured, nested API calls done internally by the library are part of the caller cost\n");
+            fprintf(outFile, "*   Report is written on program exit, sorted by total time, to stderr or to the file defined\n");
+            fprintf(outFile, "*   by RAYLIB_TRACE_REPORT environment variable, calls per frame are measured by rl_EndDrawing()\n");
+            fprintf(outFile, "*\n");
+            fprintf(outFile, "*   USAGE:\n");
+            fprintf(outFile, "*     Shared library preloaded before raylib shared library (no application rebuild required):\n");
+            fprintf(outFile, "*       > cc -shared -fPIC -O2 raylib_trace.c -I<raylib/src> -o libraylib_trace.so -ldl\n");
+            fprintf(outFile, "*       > LD_PRELOAD=./libraylib_trace.so ./game\n");
+            fprintf(outFile, "*     Static library linking with linker symbols wrapping (application relink required):\n");
+            fprintf(outFile, "*       > cc -c -O2 -DTRACE_LINKER_WRAP raylib_trace.c -I<raylib/src>\n");
+            fprintf(outFile, "*       > cc game.o raylib_trace.o @raylib_trace.wrap -lraylib ...\n");
+            fprintf(outFile, "*       NOTE: raylib_trace.wrap contains one -Wl,--wrap=<function> option per wrapped function\n");
+            fprintf(outFile, "*\n");
+            fprintf(outFile, "*   LIMITATIONS:\n");
+            fprintf(outFile, "*     - Variadic functions can not be forwarded and they are not traced:");
+            for (int i = 0; i < funcCount; i++)
+            {
+                if ((funcs[i].paramCount > 0) && IsTextEqual(funcs[i].paramType[funcs[i].paramCount - 1], "...", 3)) fprintf(outFile, " %s()", funcs[i].name);
+            }
+            fprintf(outFile, "\n");
+            fprintf(outFile, "*     - Tracing state is not thread-safe, API is expected to be called from main thread\n");
+            fprintf(outFile, "*\n");
+            fprintf(outFile, "**********************************************************************************************/\n\n");
+
+            fprintf(outFile, "#define _GNU_SOURCE                 // Required for: RTLD_NEXT, clock_gettime()\n\n");
+            fprintf(outFile, "#include \"%s\"\n\n", headerName);
+            fprintf(outFile, "#include <stdio.h>                  // Required for: FILE, fopen(), fprintf(), fclose()\n");
+            fprintf(outFile, "#include <stdlib.h>                 // Required for: atexit(), getenv(), qsort()\n\n");
+
+            fprintf(outFile, "#if defined(_WIN32)\n");
+            fprintf(outFile, "    #if !defined(TRACE_LINKER_WRAP)\n");
+            fprintf(outFile, "        #error \"Preloaded tracing shim not supported on Windows, define TRACE_LINKER_WRAP\"\n");
+            fprintf(outFile, "    #endif\n");
+            fprintf(outFile, "    // Functions required to query time on Windows, avoid including windows.h\n");
+            fprintf(outFile, "    __declspec(dllimport) int __stdcall QueryPerformanceCounter(unsigned long long int *lpPerformanceCount);\n");
+            fprintf(outFile, "    __declspec(dllimport) int __stdcall QueryPerformanceFrequency(unsigned long long int *lpFrequency);\n");
+            fprintf(outFile, "#else\n");
+            fprintf(outFile, "    #include <time.h>                 // Required for: clock_gettime()\n");
+            fprintf(outFile, "    #if !defined(TRACE_LINKER_WRAP)\n");
+            fprintf(outFile, "        #include <dlfcn.h>            // Required for: dlsym()\n");
+            fprintf(outFile, "    #endif\n");
+            fprintf(outFile, "#endif\n\n");
+
+            fprintf(outFile, "//----------------------------------------------------------------------------------\n");
+            fprintf(outFile, "// Defines and Macros\n");
+            fprintf(outFile, "//----------------------------------------------------------------------------------\n");
+            fprintf(outFile, "#define TRACE_FUNCTIONS_COUNT    %i\n\n", funcCount);
+            fprintf(outFile, "#if defined(TRACE_LINKER_WRAP)\n");
+            fprintf(outFile, "    // Linker redirects calls to __wrap_<function>, original function available as __real_<function>\n");
+            fprintf(outFile, "    // NOTE: Original functions referenced weakly, platform specific functions could be missing in library\n");
+            fprintf(outFile, "    #define TRACE_FUNCTION(name) __wrap_##name\n");
+            fprintf(outFile, "    #define TRACE_REAL(ret, name, params) extern ret __real_##name params __attribute__((weak)); ret (*traceReal) params = __real_##name\n");
+            fprintf(outFile, "#else\n");
+            fprintf(outFile, "    // Shim defines the API functions, original function resolved from next loaded library\n");
+            fprintf(outFile, "    #define TRACE_FUNCTION(name) name\n");
+            fprintf(outFile, "    #define TRACE_REAL(ret, name, params) static ret (*traceReal) params = NULL; if (traceReal == NULL) traceReal = (ret (*) params)TraceResolve(#name)\n");
+            fprintf(outFile, "#endif\n\n");
+
+            fprintf(outFile, "//----------------------------------------------------------------------------------\n");
+            fprintf(outFile, "// Types and Structures Definition\n");
+            fprintf(outFile, "//----------------------------------------------------------------------------------\n");
+            fprintf(outFile, "// Traced function data\n");
+            fprintf(outFile, "typedef struct TraceFunction {\n");
+            fprintf(outFile, "    const char *name;               // Function name\n");
+            fprintf(outFile, "    unsigned long long int calls;   // Calls done by the application\n");
+            fprintf(outFile, "    double time;                    // Accumulated time (seconds), including nested API calls\n");
+            fprintf(outFile, "} TraceFunction;\n\n");
+
+            fprintf(outFile, "//----------------------------------------------------------------------------------\n");
+            fprintf(outFile, "// Global Variables Definition\n");
+            fprintf(outFile, "//----------------------------------------------------------------------------------\n");
+            fprintf(outFile, "static TraceFunction traceFunctions[TRACE_FUNCTIONS_COUNT] = {\n");
+            for (int i = 0; i < funcCount; i++) fprintf(outFile, "    { \"%s\", 0, 0.0 },\n", funcs[i].name);
+            fprintf(outFile, "};\n\n");
+            fprintf(outFile, "static int traceDepth = 0;                     // Current API calls nesting depth\n");
+            fprintf(outFile, "static unsigned long long int traceFrames = 0; // Frames completed (rl_EndDrawing() calls)\n");
+            fprintf(outFile, "static double traceStartTime = -1.0;          // Time of first traced call\n\n");
+
+            fprintf(outFile, "//----------------------------------------------------------------------------------\n");
+            fprintf(outFile, "// Module Internal Functions Definition\n");
+            fprintf(outFile, "//----------------------------------------------------------------------------------\n");
+            fprintf(outFile, "// Get current time in seconds\n");
+            fprintf(outFile, "static double TraceGetTime(void)\n");
+            fprintf(outFile, "{\n");
+            fprintf(outFile, "#if defined(_WIN32)\n");
+            fprintf(outFile, "    static unsigned long long int frequency = 0;\n");
+            fprintf(outFile, "    unsigned long long int counter = 0;\n\n");
+            fprintf(outFile, "    if (frequency == 0) QueryPerformanceFrequency(&frequency);\n");
+            fprintf(outFile, "    QueryPerformanceCounter(&counter);\n\n");
+            fprintf(outFile, "    return (double)counter/(double)frequency;\n");
+            fprintf(outFile, "#else\n");
+            fprintf(outFile, "    struct timespec ts = { 0 };\n");
+            fprintf(outFile, "    clock_gettime(CLOCK_MONOTONIC, &ts);\n\n");
+            fprintf(outFile, "    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;\n");
+            fprintf(outFile, "#endif\n");
+            fprintf(outFile, "}\n\n");
+
+            fprintf(outFile, "#if !defined(TRACE_LINKER_WRAP)\n");
+            fprintf(outFile, "// Resolve original function from next loaded library\n");
+            fprintf(outFile, "static void *TraceResolve(const char *name)\n");
+            fprintf(outFile, "{\n");
+            fprintf(outFile, "    void *function = dlsym(RTLD_NEXT, name);\n\n");
+            fprintf(outFile, "    if (function == NULL)\n");
+            fprintf(outFile, "    {\n");
+            fprintf(outFile, "        fprintf(stderr, \"TRACE: Function %%s() could not be resolved, raylib must be a shared library\\n\", name);\n");
+            fprintf(outFile, "        abort();\n");
+            fprintf(outFile, "    }\n\n");
+            fprintf(outFile, "    return function;\n");
+            fprintf(outFile, "}\n");
+            fprintf(outFile, "#endif\n\n");
+
+            fprintf(outFile, "// Compare traced functions by accumulated time (descending), required by qsort()\n");
+            fprintf(outFile, "static int TraceCompare(const void *a, const void *b)\n");
+            fprintf(outFile, "{\n");
+            fprintf(outFile, "    double timeA = traceFunctions[*(const int *)a].time;\n");
+            fprintf(outFile, "    double timeB = traceFunctions[*(const int *)b].time;\n\n");
+            fprintf(outFile, "    return (timeA < timeB) - (timeA > timeB);\n");
+            fprintf(outFile, "}\n\n");
+
+            fprintf(outFile, "// Write traced functions report, called on program exit\n");
+            fprintf(outFile, "static void TraceReport(void)\n");
+            fprintf(outFile, "{\n");
+            fprintf(outFile, "    static int order[TRACE_FUNCTIONS_COUNT] = { 0 };\n");
+            fprintf(outFile, "    unsigned long long int totalCalls = 0;\n");
+            fprintf(outFile, "    double totalTime = 0.0;\n");
+            fprintf(outFile, "    int count = 0;\n\n");
+            fprintf(outFile, "    for (int i = 0; i < TRACE_FUNCTIONS_COUNT; i++)\n");
+            fprintf(outFile, "    {\n");
+            fprintf(outFile, "        if (traceFunctions[i].calls == 0) continue;\n\n");
+            fprintf(outFile, "        totalCalls += traceFunctions[i].calls;\n");
+            fprintf(outFile, "        totalTime += traceFunctions[i].time;\n");
+            fprintf(outFile, "        order[count] = i;\n");
+            fprintf(outFile, "        count++;\n");
+            fprintf(outFile, "    }\n\n");
+            fprintf(outFile, "    qsort(order, count, sizeof(int), TraceCompare);\n\n");
+            fprintf(outFile, "    const char *fileName = getenv(\"RAYLIB_TRACE_REPORT\");\n");
+            fprintf(outFile, "    FILE *report = (fileName != NULL)? fopen(fileName, \"wt\") : stderr;\n");
+            fprintf(outFile, "    if (report == NULL) report = stderr;\n\n");
+            fprintf(outFile, "    fprintf(report, \"\\nraylib API trace: %%llu frames, %%.3f s elapsed, %%llu calls, %%.3f s in API\\n\\n\",\n");
+            fprintf(outFile, "        traceFrames, TraceGetTime() - traceStartTime, totalCalls, totalTime);\n");
+            fprintf(outFile, "    fprintf(report, \"%%-40s %%14s %%14s %%12s %%12s %%8s\\n\", \"function\", \"calls\", \"calls/frame\", \"total ms\", \"avg ns\", \"time %%\");\n\n");
+            fprintf(outFile, "    for (int i = 0; i < count; i++)\n");
+            fprintf(outFile, "    {\n");
+            fprintf(outFile, "        TraceFunction *function = &traceFunctions[order[i]];\n\n");
+            fprintf(outFile, "        fprintf(report, \"%%-40s %%14llu %%14.1f %%12.3f %%12.1f %%8.2f\\n\", function->name, function->calls,\n");
+            fprintf(outFile, "            (traceFrames > 0)? (double)function->calls/(double)traceFrames : 0.0, function->time*1e3,\n");
+            fprintf(outFile, "            function->time*1e9/(double)function->calls, (totalTime > 0.0)? function->time*100.0/totalTime : 0.0);\n");
+            fprintf(outFile, "    }\n\n");
+            fprintf(outFile, "    if (report != stderr) fclose(report);\n");
+            fprintf(outFile, "}\n\n");
+
+            fprintf(outFile, "// Start traced call, only calls done by the application are measured\n");
+            fprintf(outFile, "static inline double TraceBegin(void)\n");
+            fprintf(outFile, "{\n");
+            fprintf(outFile, "    traceDepth++;\n");
+            fprintf(outFile, "    if (traceDepth > 1) return 0.0;\n\n");
+            fprintf(outFile, "    double currentTime = TraceGetTime();\n\n");
+            fprintf(outFile, "    if (traceStartTime < 0.0)\n");
+            fprintf(outFile, "    {\n");
+            fprintf(outFile, "        traceStartTime = currentTime;\n");
+            fprintf(outFile, "        atexit(TraceReport);\n");
+            fprintf(outFile, "    }\n\n");
+            fprintf(outFile, "    return currentTime;\n");
+            fprintf(outFile, "}\n\n");
+            fprintf(outFile, "// End traced call, accumulating call time\n");
+            fprintf(outFile, "static inline void TraceEnd(int id, double startTime)\n");
+            fprintf(outFile, "{\n");
+            fprintf(outFile, "    if (traceDepth == 1)\n");
+            fprintf(outFile, "    {\n");
+            fprintf(outFile, "        traceFunctions[id].calls++;\n");
+            fprintf(outFile, "        traceFunctions[id].time += TraceGetTime() - startTime;\n");
+            fprintf(outFile, "    }\n\n");
+            fprintf(outFile, "    traceDepth--;\n");
+            fprintf(outFile, "}\n\n");
+
+            fprintf(outFile, "//----------------------------------------------------------------------------------\n");
+            fprintf(outFile, "// Traced API Functions Definition\n");
+            fprintf(outFile, "//----------------------------------------------------------------------------------\n");
+            for (int i = 0; i < funcCount; i++)
+            {
+                // Variadic functions arguments can not be forwarded
+                if ((funcs[i].paramCount > 0) && IsTextEqual(funcs[i].paramType[funcs[i].paramCount - 1], "...", 3)) continue;
+
+                bool returnsValue = !IsTextEqual(funcs[i].retType, "void\0", 5);
+
+                fprintf(outFile, "// %s\n", funcs[i].desc);
+                fprintf(outFile, "%s TRACE_FUNCTION(%s)", funcs[i].retType, funcs[i].name);
+                ExportTraceParams(outFile, &funcs[i], true);
+                fprintf(outFile, "\n{\n");
+                fprintf(outFile, "    TRACE_REAL(%s, %s, ", funcs[i].retType, funcs[i].name);
+                ExportTraceParams(outFile, &funcs[i], false);
+                fprintf(outFile, ");\n");
+                fprintf(outFile, "    double traceTime = TraceBegin();\n");
+                if (returnsValue) fprintf(outFile, "    %s traceResult = traceReal(", funcs[i].retType);
+                else fprintf(outFile, "    traceReal(");
+                for (int p = 0; p < funcs[i].paramCount; p++) fprintf(outFile, "%s%s", (p > 0)? ", " : "", funcs[i].paramName[p]);
+                fprintf(outFile, ");\n");
+                fprintf(outFile, "    TraceEnd(%i, traceTime);\n", i);
+                if (IsTextEqual(funcs[i].name, "rl_EndDrawing\0", 14)) fprintf(outFile, "    if (traceDepth == 0) traceFrames++;\n");
+                if (returnsValue) fprintf(outFile, "    return traceResult;\n");
+                fprintf(outFile, "}\n\n");
+            }
+        } break;
         case CODE:
         default: break;
     }
 
     fclose(outFile);
 }
+
+// Export function parameters list for TRACE format, with or without parameters names
+// NOTE: Array sizes moved to parameter type are exported after parameter name
+static void ExportTraceParams(FILE *outFile, const FunctionInfo *func, bool names)
+{
+    fprintf(outFile, "(");
+    if (func->paramCount == 0) fprintf(outFile, "void");
+
+    for (int p = 0; p < func->paramCount; p++)
+    {
+        const char *type = func->paramType[p];
+        int arrayStart = TextFindIndex(type, "[");
+        int typeLength = (arrayStart >= 0)? arrayStart : (int)TextLength(type);
+
+        if (p > 0) fprintf(outFile, ", ");
+        fprintf(outFile, "%.*s", typeLength, type);
+        if (names) fprintf(outFile, "%s%s", (type[typeLength - 1] == '*')? "" : " ", func->paramName[p]);
+        if (arrayStart >= 0) fprintf(outFile, "%s", &type[arrayStart]);
+    }
+
+    fprintf(outFile, ")");
+}
@@ -0,0 +1,789 @@
+/**********************************************************************************************
+
+    rlswbench - rlsw software renderer benchmark
+
+    Renders standardized scenes through rlsw (raylib software renderer) at several resolutions,
+    reporting frame time, fill rate, triangle rate and per-stage timings, to measure rendering
+    performance and check SIMD and multithreaded rasterization builds against each other.
+
+    SCENES:
+     - sprites:   Alpha blended 64x64 textured quads, nearest filtering (sprite blitting path)
+     - text:      Alpha blended 8x12 glyph quads from a font atlas, screen filled with text lines
+     - mesh:      Textured 3d spheres, indexed vertex arrays, depth test, backface culling, bilinear filtering
+     - particles: Additive blended 12x12 textured quads, vertex colored
+
+    Objects count of 2d scenes scales with screen area, meshes are laid out to cover the same screen portion.
+
+    STAGES:
+     - clear:  Color and depth buffers clear, swClear()
+     - submit: Vertex processing, clipping and rasterization (only binning with SW_RASTER_THREADS)
+     - finish: Binned primitives rasterization, swFinish(), only used with SW_RASTER_THREADS
+     - copy:   Framebuffer copy to RGBA8 pixels, as presented by platforms, swCopyFramebuffer()
+
+    Fill rate counts the pixels covered by scene primitives (overdraw included, before depth test),
+    triangle rate counts submitted triangles (quads count as two). Scenes are identical every frame,
+    last frame checksum is reported to compare the output of different builds: tile-binned and SIMD
+    builds must match the default build, half-space rasterization can differ on triangle edges.
+
+    USAGE:
+
+        > rlswbench [--help] [--scene <name>] [--size <width>x<height>] [--frames <count>]
+
+    OPTIONS:
+
+        -h, --help                      : Show tool version and command line usage help
+
+        -s, --scene <name>              : Scene to run: sprites, text, mesh, particles
+                                          NOTE: If not specified, all scenes are run
+
+        -r, --size <width>x<height>     : Framebuffer resolution
+                                          NOTE: If not specified, runs 320x240, 640x480, 1280x720, 1920x1080
+
+        -f, --frames <count>            : Frames rendered per scene and resolution
+                                          NOTE: If not specified, defaults to 30
+
+    BUILD OPTIONS:
+        rlsw configuration is defined at compile time, check Makefile variables:
+        SIMD (RLSW_USE_SIMD_INTRINSICS), THREADS (SW_RASTER_THREADS), HALF_SPACE (SW_RASTER_HALF_SPACE)
+
+    LICENSE: zlib/libpng
+
+    rlswbench is licensed under an unmodified zlib/libpng license, which is an OSI-certified,
+    BSD-like license that allows static linking with closed source software:
+
+    Copyright (c) 2026 Ramon Santamaria (@raysan5)
+
+**********************************************************************************************/
+
+#if !defined(_WIN32)
+    #define _POSIX_C_SOURCE 200112L     // Required for: CLOCK_MONOTONIC if compiled with c99 without GNU extensions
+#endif
+
+#include <stdlib.h>             // Required for: malloc(), free(), atoi()
+#include <stdio.h>              // Required for: printf(), sscanf()
+#include <string.h>             // Required for: strcmp()
+#include <math.h>               // Required for: sinf(), cosf()
+
+#if defined(_WIN32)
+    #include <windows.h>        // Required for: QueryPerformanceCounter(), QueryPerformanceFrequency()
+#else
+    #include <time.h>           // Required for: clock_gettime()
+#endif
+
+#define RLSW_IMPLEMENTATION
+#include "../../src/external/rlsw.h"
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#define RLSWBENCH_VERSION       "1.0"
+
+#define DEFAULT_FRAMES          30      // Frames rendered per scene and resolution
+
+#define BASE_AREA        (640*480)      // Screen area objects count of 2d scenes is defined for
+
+#define SPRITE_SIZE             64      // Sprites size in pixels
+#define SPRITES_COUNT         1000      // Sprites drawn per frame at base area
+
+#define GLYPH_WIDTH              8      // Text glyphs size in pixels
+#define GLYPH_HEIGHT            12
+
+#define PARTICLE_SIZE           12      // Particles size in pixels
+#define PARTICLES_COUNT       8000      // Particles drawn per frame at base area
+
+#define SPHERE_SLICES           48      // Mesh sphere subdivisions
+#define SPHERE_RINGS            32
+#define MESH_COLUMNS             6      // Mesh spheres grid
+#define MESH_ROWS                4
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Scene quad, screen space rectangle with texture coordinates and color
+typedef struct {
+    float x, y, width, height;
+    float u0, v0, u1, v1;
+    uint8_t color[4];
+} BenchQuad;
+
+// Scene data, generated once per resolution
+typedef struct {
+    BenchQuad *quads;           // Quads of 2d scenes
+    int quadCount;
+    uint32_t texture;           // Texture bound by the scene
+    double pixels;              // Pixels covered per frame
+    double triangles;           // Triangles submitted per frame
+} BenchScene;
+
+// Stages timing accumulated over frames, in seconds
+typedef struct {
+    double clear;
+    double submit;
+    double finish;
+    double copy;
+} BenchTiming;
+
+typedef enum {
+    SCENE_SPRITES = 0,
+    SCENE_TEXT,
+    SCENE_MESH,
+    SCENE_PARTICLES,
+    SCENE_COUNT
+} BenchSceneType;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static const char *sceneNames[SCENE_COUNT] = { "sprites", "text", "mesh", "particles" };
+static const int defaultSizes[][2] = { { 320, 240 }, { 640, 480 }, { 1280, 720 }, { 1920, 1080 } };
+
+static uint32_t textures[SCENE_COUNT] = { 0 };  // Texture used by every scene
+
+// Sphere mesh, shared by all mesh instances
+static float *meshPositions = NULL;
+static float *meshTexcoords = NULL;
+static uint8_t *meshColors = NULL;
+static uint16_t *meshIndices = NULL;
+static int meshVertexCount = 0;
+static int meshIndexCount = 0;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static void ShowCommandLineInfo(void);          // Show command line usage info
+static double GetTimeSeconds(void);             // Get monotonic time in seconds
+static uint32_t GetRandomValue(uint32_t *seed); // Get pseudo-random value, deterministic sequence
+
+static void LoadTextures(void);                 // Load procedural textures of all scenes
+static void LoadSphereMesh(void);               // Load sphere mesh data
+static void UnloadSphereMesh(void);             // Unload sphere mesh data
+
+static BenchScene LoadScene(int type, int width, int height);  // Load scene data for a resolution
+static void UnloadScene(BenchScene *scene);     // Unload scene data
+static void SetupScene(int type, int width, int height);       // Set scene render state
+static void DrawScene(int type, const BenchScene *scene, int width, int height);   // Submit scene primitives
+
+static double GetQuadPixels(const BenchQuad *quad, int width, int height);    // Get quad pixels inside screen
+static double GetMeshPixels(int width, int height);                           // Get mesh front faces pixels
+static void SetMeshTransform(int instance, int width, int height);            // Set mesh instance matrices
+
+//------------------------------------------------------------------------------------
+// Program main entry point
+//------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    int sceneSelected = -1;     // All scenes
+    int sizeSelected[2] = { 0 };
+    int frames = DEFAULT_FRAMES;
+
+    // Process command line arguments
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-h") == 0) || (strcmp(argv[i], "--help") == 0))
+        {
+            ShowCommandLineInfo();
+            return 0;
+        }
+        else if (((strcmp(argv[i], "-s") == 0) || (strcmp(argv[i], "--scene") == 0)) && ((i + 1) < argc))
+        {
+            i++;
+            for (int s = 0; s < SCENE_COUNT; s++) if (strcmp(argv[i], sceneNames[s]) == 0) sceneSelected = s;
+
+            if (sceneSelected < 0)
+            {
+                printf("WARNING: Scene not recognized: %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (((strcmp(argv[i], "-r") == 0) || (strcmp(argv[i], "--size") == 0)) && ((i + 1) < argc))
+        {
+            i++;
+            if ((sscanf(argv[i], "%dx%d", &sizeSelected[0], &sizeSelected[1]) != 2) || (sizeSelected[0] <= 0) || (sizeSelected[1] <= 0))
+            {
+                printf("WARNING: Size not valid: %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else if (((strcmp(argv[i], "-f") == 0) || (strcmp(argv[i], "--frames") == 0)) && ((i + 1) < argc))
+        {
+            frames = atoi(argv[++i]);
+            if (frames <= 0) frames = DEFAULT_FRAMES;
+        }
+        else
+        {
+            printf("WARNING: Argument not recognized: %s\n", argv[i]);
+            ShowCommandLineInfo();
+            return 1;
+        }
+    }
+
+    const int (*sizes)[2] = (sizeSelected[0] > 0)? (const int (*)[2])&sizeSelected : defaultSizes;
+    int sizeCount = (sizeSelected[0] > 0)? 1 : (int)(sizeof(defaultSizes)/sizeof(defaultSizes[0]));
+
+    if (!swInit(sizes[0][0], sizes[0][1]))
+    {
+        printf("ERROR: Software renderer could not be initialized\n");
+        return 1;
+    }
+
+    LoadTextures();
+    LoadSphereMesh();
+
+    printf("\nrlswbench v%s | SIMD: %s | raster threads: %i | half-space: %s | depth tiles: %s | frames: %i\n\n", RLSWBENCH_VERSION,
+#if defined(RLSW_USE_SIMD_INTRINSICS)
+        "yes",
+#else
+        "no",
+#endif
+        SW_RASTER_THREADS, SW_RASTER_HALF_SPACE? "yes" : "no", SW_DEPTH_TILES? "yes" : "no", frames);
+
+    printf("%-10s %-10s %9s %8s %8s %8s %8s %10s %9s %9s\n",
+        "scene", "size", "ms/frame", "clear", "submit", "finish", "copy", "Mpixels/s", "Mtris/s", "checksum");
+
+    for (int s = 0; s < sizeCount; s++)
+    {
+        int width = sizes[s][0];
+        int height = sizes[s][1];
+
+        swResizeFramebuffer(width, height);
+        swViewport(0, 0, width, height);
+
+        uint8_t *pixels = (uint8_t *)malloc((size_t)width*height*4);
+
+        for (int type = 0; type < SCENE_COUNT; type++)
+        {
+            if ((sceneSelected >= 0) && (type != sceneSelected)) continue;
+
+            BenchScene scene = LoadScene(type, width, height);
+            BenchTiming timing = { 0 };
+
+            SetupScene(type, width, height);
+
+            // First frame not measured, it warms up caches and binning buffers
+            for (int frame = -1; frame < frames; frame++)
+            {
+                double time0 = GetTimeSeconds();
+                swClear(SW_COLOR_BUFFER_BIT | SW_DEPTH_BUFFER_BIT);
+                double time1 = GetTimeSeconds();
+                DrawScene(type, &scene, width, height);
+                double time2 = GetTimeSeconds();
+                swFinish();
+                double time3 = GetTimeSeconds();
+                swCopyFramebuffer(0, 0, width, height, SW_RGBA, SW_UNSIGNED_BYTE, pixels);
+                double time4 = GetTimeSeconds();
+
+                if (frame < 0) continue;
+
+                timing.clear += time1 - time0;
+                timing.submit += time2 - time1;
+                timing.finish += time3 - time2;
+                timing.copy += time4 - time3;
+            }
+
+            // Last frame checksum, FNV-1a hash
+            uint32_t checksum = 2166136261u;
+            for (int i = 0; i < width*height*4; i++) checksum = (checksum ^ pixels[i])*16777619u;
+
+            double total = timing.clear + timing.submit + timing.finish + timing.copy;
+            double render = timing.submit + timing.finish;
+            char size[32] = { 0 };
+            snprintf(size, sizeof(size), "%ix%i", width, height);
+
+            printf("%-10s %-10s %9.3f %8.3f %8.3f %8.3f %8.3f %10.1f %9.3f  %08x\n", sceneNames[type], size,
+                1000.0*total/frames, 1000.0*timing.clear/frames, 1000.0*timing.submit/frames,
+                1000.0*timing.finish/frames, 1000.0*timing.copy/frames,
+                (render > 0.0)? scene.pixels*frames/render/1e6 : 0.0,
+                (render > 0.0)? scene.triangles*frames/render/1e6 : 0.0, checksum);
+
+            UnloadScene(&scene);
+        }
+
+        free(pixels);
+    }
+
+    printf("\nNOTE: Stages time in ms/frame, fill and triangle rates measured on submit and finish stages\n");
+
+    UnloadSphereMesh();
+    swDeleteTextures(SCENE_COUNT, textures);
+    swClose();
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Show command line usage info
+static void ShowCommandLineInfo(void)
+{
+    printf("\n//////////////////////////////////////////////////////////////////////////////////\n");
+    printf("//                                                                              //\n");
+    printf("// rlswbench v%s - rlsw software renderer benchmark                            //\n", RLSWBENCH_VERSION);
+    printf("//                                                                              //\n");
+    printf("// more info and bugs-report: github.com/raysan5/raylib/tools/rlswbench         //\n");
+    printf("//                                                                              //\n");
+    printf("// Copyright (c) 2026 Ramon Santamaria (@raysan5)                               //\n");
+    printf("//                                                                              //\n");
+    printf("//////////////////////////////////////////////////////////////////////////////////\n\n");
+
+    printf("USAGE:\n\n");
+    printf("    > rlswbench [--help] [--scene <name>] [--size <width>x<height>] [--frames <count>]\n");
+
+    printf("\nOPTIONS:\n\n");
+    printf("    -h, --help                      : Show tool version and command line usage help\n\n");
+    printf("    -s, --scene <name>              : Scene to run: sprites, text, mesh, particles\n");
+    printf("                                      NOTE: If not specified, all scenes are run\n\n");
+    printf("    -r, --size <width>x<height>     : Framebuffer resolution\n");
+    printf("                                      NOTE: If not specified, runs 320x240, 640x480, 1280x720, 1920x1080\n\n");
+    printf("    -f, --frames <count>            : Frames rendered per scene and resolution\n");
+    printf("                                      NOTE: If not specified, defaults to %i\n\n", DEFAULT_FRAMES);
+
+    printf("\nEXAMPLES:\n\n");
+    printf("    > rlswbench --scene sprites --size 1280x720\n");
+    printf("        Run sprites scene at 1280x720 resolution\n\n");
+    printf("    > rlswbench --frames 100\n");
+    printf("        Run all scenes at all resolutions, 100 frames each\n\n");
+}
+
+// Get monotonic time in seconds
+static double GetTimeSeconds(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart/(double)frequency.QuadPart;
+#else
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+#endif
+}
+
+// Get pseudo-random value, deterministic sequence (xorshift32)
+static uint32_t GetRandomValue(uint32_t *seed)
+{
+    uint32_t x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *seed = x;
+
+    return x;
+}
+
+// Load procedural textures of all scenes
+static void LoadTextures(void)
+{
+    swGenTextures(SCENE_COUNT, textures);
+
+    // Sprites: shaded ball with transparent corners and semi-transparent border
+    uint8_t *sprite = (uint8_t *)malloc(SPRITE_SIZE*SPRITE_SIZE*4);
+    for (int y = 0; y < SPRITE_SIZE; y++)
+    {
+        for (int x = 0; x < SPRITE_SIZE; x++)
+        {
+            float dx = (x + 0.5f)/SPRITE_SIZE*2.0f - 1.0f;
+            float dy = (y + 0.5f)/SPRITE_SIZE*2.0f - 1.0f;
+            float d = dx*dx + dy*dy;
+            uint8_t *p = &sprite[(y*SPRITE_SIZE + x)*4];
+
+            p[0] = (uint8_t)(255*(1.0f - 0.5f*d));
+            p[1] = (uint8_t)(128 + 127*dx*dy);
+            p[2] = (uint8_t)(64 + 4*x);
+            p[3] = (d < 0.8f)? 255 : ((d < 1.0f)? 128 : 0);
+        }
+    }
+
+    swBindTexture(textures[SCENE_SPRITES]);
+    swTexImage2D(SPRITE_SIZE, SPRITE_SIZE, SW_RGBA, SW_UNSIGNED_BYTE, sprite);
+    swTexParameteri(SW_TEXTURE_MIN_FILTER, SW_NEAREST);
+    swTexParameteri(SW_TEXTURE_MAG_FILTER, SW_NEAREST);
+    free(sprite);
+
+    // Text: 16x8 glyphs atlas, random glyph pixels, white with alpha coverage
+    const int atlasWidth = 16*GLYPH_WIDTH, atlasHeight = 8*GLYPH_HEIGHT;
+    uint8_t *atlas = (uint8_t *)malloc(atlasWidth*atlasHeight*4);
+    uint32_t seed = 0x1234567;
+    for (int i = 0; i < atlasWidth*atlasHeight; i++)
+    {
+        int x = i%atlasWidth, y = i/atlasWidth;
+        bool border = ((x%GLYPH_WIDTH) == 0) || ((y%GLYPH_HEIGHT) < 2);
+
+        atlas[i*4 + 0] = 255;
+        atlas[i*4 + 1] = 255;
+        atlas[i*4 + 2] = 255;
+        atlas[i*4 + 3] = (!border && ((GetRandomValue(&seed) & 3) == 0))? 255 : 0;
+    }
+
+    swBindTexture(textures[SCENE_TEXT]);
+    swTexImage2D(atlasWidth, atlasHeight, SW_RGBA, SW_UNSIGNED_BYTE, atlas);
+    swTexParameteri(SW_TEXTURE_MIN_FILTER, SW_NEAREST);
+    swTexParameteri(SW_TEXTURE_MAG_FILTER, SW_NEAREST);
+    free(atlas);
+
+    // Mesh: 256x256 checkerboard, bilinear filtering
+    uint8_t *checker = (uint8_t *)malloc(256*256*4);
+    for (int y = 0; y < 256; y++)
+    {
+        for (int x = 0; x < 256; x++)
+        {
+            uint8_t *p = &checker[(y*256 + x)*4];
+            bool odd = ((x/32 + y/32)%2) != 0;
+
+            p[0] = odd? 230 : (uint8_t)x;
+            p[1] = odd? 230 : (uint8_t)y;
+            p[2] = odd? 230 : 96;
+            p[3] = 255;
+        }
+    }
+
+    swBindTexture(textures[SCENE_MESH]);
+    swTexImage2D(256, 256, SW_RGBA, SW_UNSIGNED_BYTE, checker);
+    swTexParameteri(SW_TEXTURE_MIN_FILTER, SW_LINEAR);
+    swTexParameteri(SW_TEXTURE_MAG_FILTER, SW_LINEAR);
+    free(checker);
+
+    // Particles: radial falloff glow
+    uint8_t *glow = (uint8_t *)malloc(16*16*4);
+    for (int y = 0; y < 16; y++)
+    {
+        for (int x = 0; x < 16; x++)
+        {
+            float dx = (x + 0.5f)/8.0f - 1.0f;
+            float dy = (y + 0.5f)/8.0f - 1.0f;
+            float a = 1.0f - (dx*dx + dy*dy);
+            uint8_t *p = &glow[(y*16 + x)*4];
+
+            p[0] = 255;
+            p[1] = 255;
+            p[2] = 255;
+            p[3] = (a > 0.0f)? (uint8_t)(255*a) : 0;
+        }
+    }
+
+    swBindTexture(textures[SCENE_PARTICLES]);
+    swTexImage2D(16, 16, SW_RGBA, SW_UNSIGNED_BYTE, glow);
+    swTexParameteri(SW_TEXTURE_MIN_FILTER, SW_NEAREST);
+    swTexParameteri(SW_TEXTURE_MAG_FILTER, SW_NEAREST);
+    free(glow);
+
+    swBindTexture(0);
+}
+
+// Load sphere mesh data, unit radius
+static void LoadSphereMesh(void)
+{
+    meshVertexCount = (SPHERE_SLICES + 1)*(SPHERE_RINGS + 1);
+    meshIndexCount = SPHERE_SLICES*SPHERE_RINGS*6;
+
+    meshPositions = (float *)malloc(meshVertexCount*3*sizeof(float));
+    meshTexcoords = (float *)malloc(meshVertexCount*2*sizeof(float));
+    meshColors = (uint8_t *)malloc(meshVertexCount*4);
+    meshIndices = (uint16_t *)malloc(meshIndexCount*sizeof(uint16_t));
+
+    for (int r = 0, v = 0; r <= SPHERE_RINGS; r++)
+    {
+        for (int s = 0; s <= SPHERE_SLICES; s++, v++)
+        {
+            float theta = (float)r/SPHERE_RINGS*3.14159265f;
+            float phi = (float)s/SPHERE_SLICES*6.28318531f;
+
+            meshPositions[v*3 + 0] = sinf(theta)*cosf(phi);
+            meshPositions[v*3 + 1] = cosf(theta);
+            meshPositions[v*3 + 2] = sinf(theta)*sinf(phi);
+
+            meshTexcoords[v*2 + 0] = 2.0f*s/SPHERE_SLICES;
+            meshTexcoords[v*2 + 1] = (float)r/SPHERE_RINGS;
+
+            // Simple top-down lighting baked in vertex colors
+            uint8_t light = (uint8_t)(128 + 127*cosf(theta));
+            meshColors[v*4 + 0] = light;
+            meshColors[v*4 + 1] = light;
+            meshColors[v*4 + 2] = light;
+            meshColors[v*4 + 3] = 255;
+        }
+    }
+
+    for (int r = 0, i = 0; r < SPHERE_RINGS; r++)
+    {
+        for (int s = 0; s < SPHERE_SLICES; s++)
+        {
+            uint16_t a = (uint16_t)(r*(SPHERE_SLICES + 1) + s);
+            uint16_t b = (uint16_t)(a + SPHERE_SLICES + 1);
+
+            meshIndices[i++] = a;
+            meshIndices[i++] = b;
+            meshIndices[i++] = a + 1;
+            meshIndices[i++] = a + 1;
+            meshIndices[i++] = b;
+            meshIndices[i++] = b + 1;
+        }
+    }
+}
+
+// Unload sphere mesh data
+static void UnloadSphereMesh(void)
+{
+    free(meshPositions);
+    free(meshTexcoords);
+    free(meshColors);
+    free(meshIndices);
+}
+
+// Load scene data for a resolution
+static BenchScene LoadScene(int type, int width, int height)
+{
+    BenchScene scene = { 0 };
+    scene.texture = textures[type];
+
+    double areaScale = (double)width*height/BASE_AREA;
+    uint32_t seed = 0x9e3779b9u;
+
+    switch (type)
+    {
+        case SCENE_SPRITES:
+        {
+            scene.quadCount = (int)(SPRITES_COUNT*areaScale);
+            scene.quads = (BenchQuad *)calloc(scene.quadCount, sizeof(BenchQuad));
+
+            for (int i = 0; i < scene.quadCount; i++)
+            {
+                BenchQuad *quad = &scene.quads[i];
+
+                // Integer positions, unscaled sprites, as usual in 2d games
+                quad->x = (float)(GetRandomValue(&seed)%(width + SPRITE_SIZE)) - SPRITE_SIZE/2;
+                quad->y = (float)(GetRandomValue(&seed)%(height + SPRITE_SIZE)) - SPRITE_SIZE/2;
+                quad->width = SPRITE_SIZE;
+                quad->height = SPRITE_SIZE;
+                quad->u0 = 0.0f; quad->v0 = 0.0f;
+                quad->u1 = 1.0f; quad->v1 = 1.0f;
+                quad->color[0] = 255; quad->color[1] = 255; quad->color[2] = 255; quad->color[3] = 255;
+            }
+        } break;
+        case SCENE_TEXT:
+        {
+            int columns = width/GLYPH_WIDTH;
+            int rows = height/GLYPH_HEIGHT;
+
+            scene.quadCount = columns*rows;
+            scene.quads = (BenchQuad *)calloc(scene.quadCount, sizeof(BenchQuad));
+
+            for (int i = 0; i < scene.quadCount; i++)
+            {
+                BenchQuad *quad = &scene.quads[i];
+                int glyph = GetRandomValue(&seed)%128;
+                uint32_t color = GetRandomValue(&seed);
+
+                quad->x = (float)((i%columns)*GLYPH_WIDTH);
+                quad->y = (float)((i/columns)*GLYPH_HEIGHT);
+                quad->width = GLYPH_WIDTH;
+                quad->height = GLYPH_HEIGHT;
+                quad->u0 = (float)(glyph%16)/16.0f; quad->v0 = (float)(glyph/16)/8.0f;
+                quad->u1 = quad->u0 + 1.0f/16.0f; quad->v1 = quad->v0 + 1.0f/8.0f;
+                quad->color[0] = (uint8_t)(color | 0x80); quad->color[1] = (uint8_t)((color >> 8) | 0x80);
+                quad->color[2] = (uint8_t)((color >> 16) | 0x80); quad->color[3] = 255;
+            }
+        } break;
+        case SCENE_PARTICLES:
+        {
+            scene.quadCount = (int)(PARTICLES_COUNT*areaScale);
+            scene.quads = (BenchQuad *)calloc(scene.quadCount, sizeof(BenchQuad));
+
+            for (int i = 0; i < scene.quadCount; i++)
+            {
+                BenchQuad *quad = &scene.quads[i];
+                uint32_t color = GetRandomValue(&seed);
+
+                // Subpixel positions, particles move freely
+                quad->x = (float)(GetRandomValue(&seed)%(width*16))/16.0f - PARTICLE_SIZE/2;
+                quad->y = (float)(GetRandomValue(&seed)%(height*16))/16.0f - PARTICLE_SIZE/2;
+                quad->width = PARTICLE_SIZE;
+                quad->height = PARTICLE_SIZE;
+                quad->u0 = 0.0f; quad->v0 = 0.0f;
+                quad->u1 = 1.0f; quad->v1 = 1.0f;
+                quad->color[0] = (uint8_t)color; quad->color[1] = (uint8_t)(color >> 8);
+                quad->color[2] = (uint8_t)(color >> 16); quad->color[3] = 96;
+            }
+        } break;
+        default: break;
+    }
+
+    if (type == SCENE_MESH)
+    {
+        scene.triangles = (double)MESH_COLUMNS*MESH_ROWS*meshIndexCount/3;
+        scene.pixels = GetMeshPixels(width, height);
+    }
+    else
+    {
+        scene.triangles = 2.0*scene.quadCount;
+        for (int i = 0; i < scene.quadCount; i++) scene.pixels += GetQuadPixels(&scene.quads[i], width, height);
+    }
+
+    return scene;
+}
+
+// Unload scene data
+static void UnloadScene(BenchScene *scene)
+{
+    free(scene->quads);
+    *scene = (BenchScene){ 0 };
+}
+
+// Set scene render state
+static void SetupScene(int type, int width, int height)
+{
+    swClearColor(0.1f, 0.1f, 0.15f, 1.0f);
+    swClearDepth(1.0f);
+    swColor4f(1.0f, 1.0f, 1.0f, 1.0f);  // Vertex arrays colors are modulated by current color
+
+    swBindTexture(textures[type]);
+    swEnable(SW_TEXTURE_2D);
+
+    swMatrixMode(SW_PROJECTION);
+    swLoadIdentity();
+    swMatrixMode(SW_MODELVIEW);
+    swLoadIdentity();
+
+    if (type == SCENE_MESH)
+    {
+        swDisable(SW_BLEND);
+        swEnable(SW_DEPTH_TEST);
+        swEnable(SW_CULL_FACE);
+        swCullFace(SW_BACK);
+    }
+    else
+    {
+        swDisable(SW_DEPTH_TEST);
+        swDisable(SW_CULL_FACE);
+        swEnable(SW_BLEND);
+
+        if (type == SCENE_PARTICLES) swBlendFunc(SW_SRC_ALPHA, SW_ONE);
+        else swBlendFunc(SW_SRC_ALPHA, SW_ONE_MINUS_SRC_ALPHA);
+
+        swMatrixMode(SW_PROJECTION);
+        swOrtho(0, width, height, 0, -1, 1);
+        swMatrixMode(SW_MODELVIEW);
+    }
+}
+
+// Submit scene primitives
+static void DrawScene(int type, const BenchScene *scene, int width, int height)
+{
+    if (type == SCENE_MESH)
+    {
+        swBindArray(SW_VERTEX_ARRAY, meshPositions);
+        swBindArray(SW_TEXTURE_COORD_ARRAY, meshTexcoords);
+        swBindArray(SW_COLOR_ARRAY, meshColors);
+
+        for (int i = 0; i < MESH_COLUMNS*MESH_ROWS; i++)
+        {
+            SetMeshTransform(i, width, height);
+            swDrawElements(SW_TRIANGLES, meshIndexCount, SW_UNSIGNED_SHORT, meshIndices);
+        }
+
+        swBindArray(SW_VERTEX_ARRAY, NULL);
+        swBindArray(SW_TEXTURE_COORD_ARRAY, NULL);
+        swBindArray(SW_COLOR_ARRAY, NULL);
+        return;
+    }
+
+    swBegin(SW_QUADS);
+    for (int i = 0; i < scene->quadCount; i++)
+    {
+        const BenchQuad *quad = &scene->quads[i];
+
+        swColor4ub(quad->color[0], quad->color[1], quad->color[2], quad->color[3]);
+        swTexCoord2f(quad->u0, quad->v0);
+        swVertex2f(quad->x, quad->y);
+        swTexCoord2f(quad->u0, quad->v1);
+        swVertex2f(quad->x, quad->y + quad->height);
+        swTexCoord2f(quad->u1, quad->v1);
+        swVertex2f(quad->x + quad->width, quad->y + quad->height);
+        swTexCoord2f(quad->u1, quad->v0);
+        swVertex2f(quad->x + quad->width, quad->y);
+    }
+    swEnd();
+}
+
+// Get quad pixels inside screen
+static double GetQuadPixels(const BenchQuad *quad, int width, int height)
+{
+    float x0 = (quad->x > 0.0f)? quad->x : 0.0f;
+    float y0 = (quad->y > 0.0f)? quad->y : 0.0f;
+    float x1 = (quad->x + quad->width < width)? quad->x + quad->width : (float)width;
+    float y1 = (quad->y + quad->height < height)? quad->y + quad->height : (float)height;
+
+    return ((x1 > x0) && (y1 > y0))? (double)(x1 - x0)*(y1 - y0) : 0.0;
+}
+
+// Set mesh instance matrices, spheres grid covering the same screen portion at any resolution
+static void SetMeshTransform(int instance, int width, int height)
+{
+    float aspect = (float)width/height;
+
+    swMatrixMode(SW_PROJECTION);
+    swLoadIdentity();
+    swFrustum(-0.5*aspect, 0.5*aspect, -0.5, 0.5, 1.0, 100.0);
+
+    swMatrixMode(SW_MODELVIEW);
+    swLoadIdentity();
+    // Visible area at z = -8 is 8*aspect x 8 units, every sphere fills most of its grid cell
+    float cellWidth = 8.0f*aspect/MESH_COLUMNS;
+    float cellHeight = 8.0f/MESH_ROWS;
+
+    swTranslatef(((instance%MESH_COLUMNS) - (MESH_COLUMNS - 1)*0.5f)*cellWidth, ((instance/MESH_COLUMNS) - (MESH_ROWS - 1)*0.5f)*cellHeight, -8.0f);
+    swRotatef(instance*23.0f, 0.3f, 1.0f, 0.1f);
+    swScalef(0.48f*cellWidth, 0.48f*cellHeight, 0.48f*cellHeight);
+}
+
+// Get mesh front faces pixels, triangles projected with the renderer matrices
+static double GetMeshPixels(int width, int height)
+{
+    double pixels = 0.0;
+    float *screen = (float *)malloc(meshVertexCount*2*sizeof(float));
+
+    for (int instance = 0; instance < MESH_COLUMNS*MESH_ROWS; instance++)
+    {
+        float mv[16], proj[16], mvp[16];
+
+        SetMeshTransform(instance, width, height);
+        swGetFloatv(SW_MODELVIEW_MATRIX, mv);
+        swGetFloatv(SW_PROJECTION_MATRIX, proj);
+
+        // Column-major matrices, mvp = proj*mv
+        for (int c = 0; c < 4; c++)
+        {
+            for (int r = 0; r < 4; r++)
+            {
+                mvp[c*4 + r] = proj[r]*mv[c*4] + proj[4 + r]*mv[c*4 + 1] + proj[8 + r]*mv[c*4 + 2] + proj[12 + r]*mv[c*4 + 3];
+            }
+        }
+
+        for (int v = 0; v < meshVertexCount; v++)
+        {
+            const float *p = &meshPositions[v*3];
+            float x = mvp[0]*p[0] + mvp[4]*p[1] + mvp[8]*p[2] + mvp[12];
+            float y = mvp[1]*p[0] + mvp[5]*p[1] + mvp[9]*p[2] + mvp[13];
+            float w = mvp[3]*p[0] + mvp[7]*p[1] + mvp[11]*p[2] + mvp[15];
+
+            screen[v*2 + 0] = (x/w*0.5f + 0.5f)*width;
+            screen[v*2 + 1] = (0.5f - y/w*0.5f)*height;
+        }
+
+        // Counter-clockwise triangles in screen space (y down) are front faces
+        for (int i = 0; i < meshIndexCount; i += 3)
+        {
+            const float *a = &screen[meshIndices[i]*2];
+            const float *b = &screen[meshIndices[i + 1]*2];
+            const float *c = &screen[meshIndices[i + 2]*2];
+            double area = 0.5*((double)(b[0] - a[0])*(c[1] - a[1]) - (double)(c[0] - a[0])*(b[1] - a[1]));
+
+            if (area < 0.0) pixels -= area;
+        }
+    }
+
+    free(screen);
+
+    return pixels;
+}